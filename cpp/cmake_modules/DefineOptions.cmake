@@ -320,6 +320,9 @@ Always OFF if building binaries" OFF)
   define_option(ARROW_EXTRA_ERROR_CONTEXT
                 "Compile with extra error context (line numbers, code)" OFF)
 
+  define_option(ARROW_TRACING
+                "Compile the tracing spans and counters of util/tracing.h" OFF)
+
   define_option(ARROW_OPTIONAL_INSTALL
                 "If enabled install ONLY targets that have already been built. Please be \
 advised that if this is enabled 'install' will fail silently on components \
@@ -19,6 +19,7 @@
 #include "arrow/adapters/orc/adapter_util.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -32,6 +33,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -39,14 +41,17 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
 #include "orc/OrcFile.hh"
+#include "orc/Statistics.hh"
 
 // alias to not interfere with nested orc namespace
 namespace liborc = orc;
@@ -100,6 +105,32 @@ class ArrowInputFile : public liborc::InputStream {
   std::shared_ptr<io::RandomAccessFile> file_;
 };
 
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(const std::shared_ptr<io::OutputStream>& output)
+      : output_(output), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_->Write(buf, static_cast<int64_t>(length)));
+    length_ += length;
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputStream");
+    return filename;
+  }
+
+  void close() override { ORC_THROW_NOT_OK(output_->Close()); }
+
+ private:
+  std::shared_ptr<io::OutputStream> output_;
+  uint64_t length_;
+};
+
 struct StripeInformation {
   uint64_t offset;
   uint64_t length;
@@ -110,6 +141,110 @@ struct StripeInformation {
 // The number of rows to read in a ColumnVectorBatch
 constexpr int64_t kReadRowsBatch = 1000;
 
+// A run of consecutive rows within a stripe: (first row, number of rows)
+using RowRun = std::pair<int64_t, int64_t>;
+
+static bool GetIntegerValue(const Scalar& scalar, int64_t* out) {
+  switch (scalar.type->id()) {
+#define INTEGER_CASE(TYPE_CLASS)                                                  \
+  case TYPE_CLASS##Type::type_id:                                                 \
+    *out = static_cast<int64_t>(checked_cast<const TYPE_CLASS##Scalar&>(scalar).value); \
+    return true;
+    INTEGER_CASE(Int8)
+    INTEGER_CASE(Int16)
+    INTEGER_CASE(Int32)
+    INTEGER_CASE(Int64)
+    INTEGER_CASE(UInt8)
+    INTEGER_CASE(UInt16)
+    INTEGER_CASE(UInt32)
+#undef INTEGER_CASE
+    default:
+      return false;
+  }
+}
+
+static bool GetDoubleValue(const Scalar& scalar, double* out) {
+  int64_t integer;
+  switch (scalar.type->id()) {
+    case Type::FLOAT:
+      *out = checked_cast<const FloatScalar&>(scalar).value;
+      return true;
+    case Type::DOUBLE:
+      *out = checked_cast<const DoubleScalar&>(scalar).value;
+      return true;
+    default:
+      if (!GetIntegerValue(scalar, &integer)) {
+        return false;
+      }
+      *out = static_cast<double>(integer);
+      return true;
+  }
+}
+
+template <typename T>
+static bool RangeMayMatch(ColumnPredicate::Operator op, const T& min, const T& max,
+                          const T& value) {
+  switch (op) {
+    case ColumnPredicate::EQUAL:
+      return !(value < min) && !(max < value);
+    case ColumnPredicate::LESS:
+      return min < value;
+    case ColumnPredicate::LESS_EQUAL:
+      return !(value < min);
+    case ColumnPredicate::GREATER:
+      return value < max;
+    case ColumnPredicate::GREATER_EQUAL:
+      return !(max < value);
+  }
+  return true;
+}
+
+// Whether a value described by the column statistics of a stripe or a row group
+// may satisfy the predicate
+static bool MayMatch(const ColumnPredicate& predicate,
+                     const liborc::ColumnStatistics* stats) {
+  const Scalar& scalar = *predicate.value;
+  if (stats == nullptr || !scalar.is_valid) {
+    return true;
+  }
+  if (stats->getNumberOfValues() == 0) {
+    // Only nulls, which never compare true
+    return false;
+  }
+  if (auto int_stats = dynamic_cast<const liborc::IntegerColumnStatistics*>(stats)) {
+    int64_t value;
+    if (!int_stats->hasMinimum() || !int_stats->hasMaximum() ||
+        !GetIntegerValue(scalar, &value)) {
+      return true;
+    }
+    return RangeMayMatch(predicate.op, int_stats->getMinimum(), int_stats->getMaximum(),
+                         value);
+  }
+  if (auto double_stats = dynamic_cast<const liborc::DoubleColumnStatistics*>(stats)) {
+    double value;
+    if (!double_stats->hasMinimum() || !double_stats->hasMaximum() ||
+        !GetDoubleValue(scalar, &value)) {
+      return true;
+    }
+    const double min = double_stats->getMinimum();
+    const double max = double_stats->getMaximum();
+    if (std::isnan(min) || std::isnan(max) || std::isnan(value)) {
+      return true;
+    }
+    return RangeMayMatch(predicate.op, min, max, value);
+  }
+  if (auto string_stats = dynamic_cast<const liborc::StringColumnStatistics*>(stats)) {
+    if (!string_stats->hasMinimum() || !string_stats->hasMaximum() ||
+        (scalar.type->id() != Type::STRING && scalar.type->id() != Type::BINARY)) {
+      return true;
+    }
+    return RangeMayMatch(predicate.op, string_stats->getMinimum(),
+                         string_stats->getMaximum(),
+                         checked_cast<const BinaryScalar&>(scalar).value->ToString());
+  }
+  return true;
+}
+
 class OrcStripeReader : public RecordBatchReader {
  public:
   OrcStripeReader(std::unique_ptr<liborc::RowReader> row_reader,
@@ -266,6 +401,41 @@ class ORCFileReader::Impl {
     return ReadTable(opts, schema, out);
   }
 
+  Status Read(const ORCReadOptions& options, std::shared_ptr<Table>* out) {
+    liborc::RowReaderOptions opts;
+    if (!options.include_indices.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, options.include_indices));
+    }
+    std::vector<uint64_t> column_ids;
+    RETURN_NOT_OK(GetColumnIds(options.predicates, &column_ids));
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+
+    std::vector<std::shared_ptr<RecordBatch>> batches(stripes_.size());
+    auto read_stripe = [&](int stripe) -> Status {
+      std::vector<RowRun> runs;
+      RETURN_NOT_OK(SelectRows(stripe, options.predicates, column_ids, &runs));
+      if (runs.empty()) {
+        return Status::OK();
+      }
+      liborc::RowReaderOptions stripe_opts(opts);
+      stripe_opts.range(stripes_[stripe].offset, stripes_[stripe].length);
+      return ReadRuns(stripe_opts, schema, stripes_[stripe], runs, &batches[stripe]);
+    };
+    const int num_stripes = static_cast<int>(stripes_.size());
+    if (options.use_threads) {
+      RETURN_NOT_OK(internal::ParallelFor(num_stripes, read_stripe));
+    } else {
+      for (int stripe = 0; stripe < num_stripes; stripe++) {
+        RETURN_NOT_OK(read_stripe(stripe));
+      }
+    }
+
+    // Drop the skipped stripes
+    batches.erase(std::remove(batches.begin(), batches.end(), nullptr), batches.end());
+    return Table::FromRecordBatches(schema, batches, out);
+  }
+
   Status ReadStripe(int64_t stripe, std::shared_ptr<RecordBatch>* out) {
     liborc::RowReaderOptions opts;
     RETURN_NOT_OK(SelectStripe(&opts, stripe));
@@ -359,6 +529,120 @@ class ORCFileReader::Impl {
     return Status::OK();
   }
 
+  // The ORC column ids of the fields the predicates refer to
+  Status GetColumnIds(const std::vector<ColumnPredicate>& predicates,
+                      std::vector<uint64_t>* out) {
+    const liborc::Type& type = reader_->getType();
+    for (const auto& predicate : predicates) {
+      ARROW_RETURN_IF(predicate.field_index < 0 ||
+                          static_cast<uint64_t>(predicate.field_index) >=
+                              type.getSubtypeCount(),
+                      Status::Invalid("Out of bounds predicate field index: ",
+                                      predicate.field_index));
+      ARROW_RETURN_IF(predicate.value == nullptr,
+                      Status::Invalid("Predicate without a value"));
+      out->push_back(type.getSubtype(predicate.field_index)->getColumnId());
+    }
+    return Status::OK();
+  }
+
+  // Select the rows of a stripe which may satisfy all predicates, as runs of
+  // consecutive row groups; no runs are returned if the stripe can be skipped
+  Status SelectRows(int64_t stripe, const std::vector<ColumnPredicate>& predicates,
+                    const std::vector<uint64_t>& column_ids, std::vector<RowRun>* out) {
+    const int64_t num_rows = static_cast<int64_t>(stripes_[stripe].num_rows);
+    if (predicates.empty()) {
+      out->emplace_back(0, num_rows);
+      return Status::OK();
+    }
+    std::unique_ptr<liborc::StripeStatistics> stats;
+    try {
+      stats = reader_->getStripeStatistics(stripe);
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    for (size_t i = 0; i < predicates.size(); ++i) {
+      const auto column_id = static_cast<uint32_t>(column_ids[i]);
+      if (!MayMatch(predicates[i], stats->getColumnStatistics(column_id))) {
+        return Status::OK();
+      }
+    }
+
+    const int64_t stride = static_cast<int64_t>(reader_->getRowIndexStride());
+    if (stride == 0) {
+      out->emplace_back(0, num_rows);
+      return Status::OK();
+    }
+    for (int64_t first_row = 0; first_row < num_rows; first_row += stride) {
+      const auto row_group = static_cast<uint32_t>(first_row / stride);
+      bool may_match = true;
+      for (size_t i = 0; i < predicates.size() && may_match; ++i) {
+        const auto column_id = static_cast<uint32_t>(column_ids[i]);
+        if (row_group < stats->getNumberOfRowIndexStats(column_id)) {
+          may_match =
+              MayMatch(predicates[i], stats->getRowIndexStatistics(column_id, row_group));
+        }
+      }
+      if (!may_match) {
+        continue;
+      }
+      const int64_t length = std::min(stride, num_rows - first_row);
+      if (!out->empty() && out->back().first + out->back().second == first_row) {
+        out->back().second += length;
+      } else {
+        out->emplace_back(first_row, length);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Read runs of rows of a stripe into a single record batch
+  Status ReadRuns(const liborc::RowReaderOptions& opts,
+                  const std::shared_ptr<Schema>& schema, const StripeInformation& stripe,
+                  const std::vector<RowRun>& runs, std::shared_ptr<RecordBatch>* out) {
+    if (runs.size() == 1 && runs[0].first == 0 &&
+        runs[0].second == static_cast<int64_t>(stripe.num_rows)) {
+      return ReadBatch(opts, schema, runs[0].second, out);
+    }
+    int64_t nrows = 0;
+    for (const auto& run : runs) {
+      nrows += run.second;
+    }
+    std::unique_ptr<liborc::RowReader> row_reader;
+    std::unique_ptr<liborc::ColumnVectorBatch> batch;
+    try {
+      row_reader = reader_->createRowReader(opts);
+      batch = row_reader->createRowBatch(std::min(nrows, kReadRowsBatch));
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    std::unique_ptr<RecordBatchBuilder> builder;
+    RETURN_NOT_OK(RecordBatchBuilder::Make(schema, pool_, nrows, &builder));
+
+    // The top-level type must be a struct to read into an arrow table
+    const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
+
+    const liborc::Type& type = row_reader->getSelectedType();
+    for (const auto& run : runs) {
+      try {
+        row_reader->seekToRow(stripe.first_row_of_stripe + run.first);
+      } catch (const liborc::ParseError& e) {
+        return Status::Invalid(e.what());
+      }
+      int64_t remaining = run.second;
+      while (remaining > 0 && row_reader->next(*batch)) {
+        const int64_t length =
+            std::min(static_cast<int64_t>(batch->numElements), remaining);
+        for (int i = 0; i < builder->num_fields(); i++) {
+          RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i], 0, length,
+                                    builder->GetField(i)));
+        }
+        remaining -= length;
+      }
+    }
+    return builder->Flush(out);
+  }
+
   Status Seek(int64_t row_number) {
     ARROW_RETURN_IF(row_number >= NumberOfRows(),
                     Status::Invalid("Out of bounds row number: ", row_number));
@@ -441,6 +725,10 @@ Status ORCFileReader::Read(const std::shared_ptr<Schema>& schema,
   return impl_->Read(schema, include_indices, out);
 }
 
+Status ORCFileReader::Read(const ORCReadOptions& options, std::shared_ptr<Table>* out) {
+  return impl_->Read(options, out);
+}
+
 Status ORCFileReader::ReadStripe(int64_t stripe, std::shared_ptr<RecordBatch>* out) {
   return impl_->ReadStripe(stripe, out);
 }
@@ -467,6 +755,152 @@ int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+static Status GetCompressionKind(Compression::type compression,
+                                 liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::Invalid("ORC does not support ",
+                             util::Codec::GetCodecAsString(compression),
+                             " compression");
+  }
+  return Status::OK();
+}
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema,
+              const std::shared_ptr<io::OutputStream>& output,
+              const ORCWriteOptions& options) {
+    if (options.stripe_size <= 0 || options.batch_size <= 0) {
+      return Status::Invalid("ORC stripe size and batch size must be positive");
+    }
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetCompressionKind(options.compression, &compression));
+
+    ORC_UNIQUE_PTR<liborc::Type> type = liborc::createStructType();
+    for (const auto& field : schema->fields()) {
+      ORC_UNIQUE_PTR<liborc::Type> field_type;
+      RETURN_NOT_OK(GetORCType(*field->type(), &field_type));
+      type->addStructField(field->name(), std::move(field_type));
+    }
+
+    liborc::WriterOptions writer_options;
+    writer_options.setStripeSize(options.stripe_size);
+    writer_options.setCompression(compression);
+
+    schema_ = schema;
+    options_ = options;
+    type_ = std::move(type);
+    stream_.reset(new ArrowOutputStream(output));
+    try {
+      writer_ = liborc::createWriter(*type_, stream_.get(), writer_options);
+      batch_ = writer_->createRowBatch(options.batch_size);
+    } catch (const std::exception& e) {
+      return Status::IOError("Failed to open ORC writer: ", e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("RecordBatch schema does not match the ORC writer's");
+    }
+    auto root = checked_cast<liborc::StructVectorBatch*>(batch_.get());
+    const int num_columns = batch.num_columns();
+
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      const int64_t length = std::min(options_.batch_size, batch.num_rows() - offset);
+      auto write_column = [&](int i) {
+        return WriteBatch(*batch.column(i), offset, length, root->fields[i], 0);
+      };
+      if (options_.use_threads) {
+        RETURN_NOT_OK(internal::ParallelFor(num_columns, write_column));
+      } else {
+        for (int i = 0; i < num_columns; i++) {
+          RETURN_NOT_OK(write_column(i));
+        }
+      }
+      root->numElements = length;
+      try {
+        writer_->add(*batch_);
+      } catch (const std::exception& e) {
+        return Status::IOError("Failed to write ORC batch: ", e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Write(const Table& table) {
+    if (!table.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("Table schema does not match the ORC writer's");
+    }
+    TableBatchReader reader(table);
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        return Status::OK();
+      }
+      RETURN_NOT_OK(Write(*batch));
+    }
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const std::exception& e) {
+      return Status::IOError("Failed to close ORC writer: ", e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  ORCWriteOptions options_;
+  ORC_UNIQUE_PTR<liborc::Type> type_;
+  std::unique_ptr<ArrowOutputStream> stream_;
+  ORC_UNIQUE_PTR<liborc::Writer> writer_;
+  ORC_UNIQUE_PTR<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           const std::shared_ptr<io::OutputStream>& output,
+                           const ORCWriteOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, output, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) { return impl_->Write(table); }
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -25,8 +25,10 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -35,6 +37,33 @@ namespace adapters {
 
 namespace orc {
 
+/// \brief A comparison of a top-level column with a scalar value
+///
+/// Predicates are checked against the column statistics of stripes and row
+/// groups, so that those in which no value can satisfy them are skipped.
+/// They do not filter the rows of the stripes and row groups that are read.
+struct ARROW_EXPORT ColumnPredicate {
+  enum Operator { EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+  /// The index of the top-level field in the file schema
+  int field_index;
+  Operator op;
+  /// An integer, floating-point or string value; other values never cause
+  /// anything to be skipped
+  std::shared_ptr<Scalar> value;
+};
+
+/// \brief Options for ORCFileReader::Read
+struct ARROW_EXPORT ORCReadOptions {
+  /// The selected field indices to read, all fields if empty
+  std::vector<int> include_indices;
+  /// Whether to read and convert stripes in parallel on the CPU thread pool
+  bool use_threads = false;
+  /// Predicates which must all hold (the search argument), used to skip the
+  /// stripes and row groups that cannot contain a matching row
+  std::vector<ColumnPredicate> predicates;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -88,6 +117,15 @@ class ARROW_EXPORT ORCFileReader {
   Status Read(const std::shared_ptr<Schema>& schema,
               const std::vector<int>& include_indices, std::shared_ptr<Table>* out);
 
+  /// \brief Read the file as a Table
+  ///
+  /// The table will be composed of one record batch per stripe that is not
+  /// skipped by the predicates, holding the row groups that are not skipped.
+  ///
+  /// \param[in] options the selected fields, threading and predicates
+  /// \param[out] out the returned Table
+  Status Read(const ORCReadOptions& options, std::shared_ptr<Table>* out);
+
   /// \brief Read a single stripe as a RecordBatch
   ///
   /// \param[in] stripe the stripe index
@@ -143,6 +181,56 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options for ORCFileWriter
+struct ARROW_EXPORT ORCWriteOptions {
+  /// The size in bytes of the stripe data buffered before a stripe is written
+  int64_t stripe_size = 64 * 1024 * 1024;
+  /// The compression of the stripes: UNCOMPRESSED, SNAPPY, GZIP (zlib, the
+  /// default of Hive), LZ4, LZO or ZSTD
+  Compression::type compression = Compression::GZIP;
+  /// The number of rows converted to ORC at a time
+  int64_t batch_size = 1024;
+  /// Whether to convert the columns in parallel on the CPU thread pool
+  bool use_threads = false;
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow Tables and RecordBatches to an ORC file.
+///
+/// Booleans, integers, floating-point numbers, strings, binaries, dates,
+/// timestamps, decimals, lists and structs are supported.  Timestamps are
+/// written without a time zone; fixed size binaries are written as binaries.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Creates a new ORC writer.
+  ///
+  /// \param[in] schema the schema of the data to write
+  /// \param[in] output the data sink, closed by Close()
+  /// \param[in] options the stripe size, compression and threading
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     const std::shared_ptr<io::OutputStream>& output,
+                     const ORCWriteOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a RecordBatch, whose schema must be the one of Open()
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write a Table, whose schema must be the one of Open()
+  Status Write(const Table& table);
+
+  /// \brief Write the last stripe and the file footer, and close the output
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
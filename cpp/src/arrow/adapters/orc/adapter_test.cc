@@ -19,7 +19,11 @@
 
 #include "arrow/adapters/orc/adapter.h"
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/io/api.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 
 #include <gtest/gtest.h>
 #include <orc/OrcFile.hh>
@@ -60,12 +64,13 @@ class MemoryOutputStream : public liborc::OutputStream {
 
 std::unique_ptr<liborc::Writer> CreateWriter(uint64_t stripe_size,
                                              const liborc::Type& type,
-                                             liborc::OutputStream* stream) {
+                                             liborc::OutputStream* stream,
+                                             uint64_t row_index_stride = 0) {
   liborc::WriterOptions options;
   options.setStripeSize(stripe_size);
   options.setCompressionBlockSize(1024);
   options.setMemoryPool(liborc::getDefaultPool());
-  options.setRowIndexStride(0);
+  options.setRowIndexStride(row_index_stride);
   return liborc::createWriter(type, stream, options);
 }
 
@@ -157,4 +162,168 @@ TEST(TestAdapter, readIntAndStringFileMultipleStripes) {
     EXPECT_TRUE(stripe_reader->ReadNext(&record_batch).ok());
   }
 }
+
+TEST(TestAdapter, readWithPredicates) {
+  MemoryOutputStream mem_stream(DEFAULT_MEM_STREAM_SIZE);
+  ORC_UNIQUE_PTR<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<col1:bigint>"));
+
+  constexpr uint64_t stripe_count = 4;
+  constexpr uint64_t stripe_row_count = 10000;
+  constexpr uint64_t row_index_stride = 1000;
+
+  auto writer = CreateWriter(1024, *type, &mem_stream, row_index_stride);
+  auto batch = writer->createRowBatch(stripe_row_count);
+  auto struct_batch = dynamic_cast<liborc::StructVectorBatch*>(batch.get());
+  auto long_batch = dynamic_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+  for (uint64_t j = 0; j < stripe_count; ++j) {
+    for (uint64_t i = 0; i < stripe_row_count; ++i) {
+      long_batch->data[i] = static_cast<int64_t>(j * stripe_row_count + i);
+    }
+    struct_batch->numElements = stripe_row_count;
+    long_batch->numElements = stripe_row_count;
+    writer->add(*batch);
+  }
+  writer->close();
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
+                               static_cast<int64_t>(mem_stream.getLength()))));
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  ASSERT_TRUE(
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool(), &reader).ok());
+  ASSERT_EQ(stripe_count, reader->NumberOfStripes());
+
+  using adapters::orc::ColumnPredicate;
+  for (bool use_threads : {false, true}) {
+    adapters::orc::ORCReadOptions options;
+    options.use_threads = use_threads;
+    std::shared_ptr<Table> table;
+    ASSERT_TRUE(reader->Read(options, &table).ok());
+    ASSERT_EQ(stripe_count * stripe_row_count, table->num_rows());
+    ASSERT_EQ(stripe_count, table->column(0)->num_chunks());
+
+    // Only row groups 5 to 7 of the third stripe may hold values in [25000, 27500)
+    options.predicates = {
+        {0, ColumnPredicate::GREATER_EQUAL, std::make_shared<Int64Scalar>(25000)},
+        {0, ColumnPredicate::LESS, std::make_shared<Int64Scalar>(27500)}};
+    ASSERT_TRUE(reader->Read(options, &table).ok());
+    ASSERT_EQ(3000, table->num_rows());
+    ASSERT_EQ(1, table->column(0)->num_chunks());
+    auto values = std::dynamic_pointer_cast<Int64Array>(table->column(0)->chunk(0));
+    for (int64_t i = 0; i < values->length(); ++i) {
+      EXPECT_EQ(25000 + i, values->Value(i));
+    }
+
+    // No value can be equal to -1
+    options.predicates = {{0, ColumnPredicate::EQUAL, std::make_shared<Int64Scalar>(-1)}};
+    ASSERT_TRUE(reader->Read(options, &table).ok());
+    ASSERT_EQ(0, table->num_rows());
+
+    options.predicates = {{1, ColumnPredicate::EQUAL, std::make_shared<Int64Scalar>(0)}};
+    ASSERT_FALSE(reader->Read(options, &table).ok());
+  }
+}
+
+void WriteORCFile(const Table& table, const adapters::orc::ORCWriteOptions& options,
+                  std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  ASSERT_OK(adapters::orc::ORCFileWriter::Open(table.schema(), sink, options, &writer));
+  ASSERT_OK(writer->Write(table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink->Finish(out));
+}
+
+TEST(TestAdapterWrite, RoundTrip) {
+  auto struct_type = struct_({field("a", int64()), field("b", utf8())});
+  auto schema = ::arrow::schema(
+      {field("bool", boolean()), field("int8", int8()), field("int16", int16()),
+       field("int32", int32()), field("int64", int64()), field("float", float32()),
+       field("double", float64()), field("string", utf8()), field("binary", binary()),
+       field("date", date32()), field("timestamp", timestamp(TimeUnit::NANO)),
+       field("decimal64", decimal(10, 2)), field("decimal128", decimal(25, 3)),
+       field("list", list(int32())), field("struct", struct_type)});
+  auto batch = RecordBatch::Make(
+      schema, 4,
+      {ArrayFromJSON(boolean(), "[true, null, false, true]"),
+       ArrayFromJSON(int8(), "[1, -2, null, 4]"),
+       ArrayFromJSON(int16(), "[null, 300, -400, 5]"),
+       ArrayFromJSON(int32(), "[70000, null, -1, 0]"),
+       ArrayFromJSON(int64(), "[-5000000000, 1, 2, null]"),
+       ArrayFromJSON(float32(), "[1.5, null, -2.25, 0]"),
+       ArrayFromJSON(float64(), "[null, 1e100, -0.5, 3]"),
+       ArrayFromJSON(utf8(), R"(["", "foo", null, "bar baz"])"),
+       ArrayFromJSON(binary(), R"([null, "a", "bc", ""])"),
+       ArrayFromJSON(date32(), "[0, -365, null, 18000]"),
+       ArrayFromJSON(timestamp(TimeUnit::NANO),
+                     "[1500000000123456789, -1, null, 0]"),
+       ArrayFromJSON(decimal(10, 2), R"(["12345678.90", null, "-0.01", "0.00"])"),
+       ArrayFromJSON(decimal(25, 3),
+                     R"(["1234567890123456789012.345", "-1.000", null, "0.000"])"),
+       ArrayFromJSON(list(int32()), "[[1, 2], null, [], [3, null]]"),
+       ArrayFromJSON(struct_type,
+                     R"([{"a": 1, "b": "x"}, null, {"a": null, "b": "y"},
+                         {"a": 4, "b": null}])")});
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &expected));
+
+  for (bool use_threads : {false, true}) {
+    adapters::orc::ORCWriteOptions options;
+    // Several ORC batches per record batch
+    options.batch_size = 3;
+    options.use_threads = use_threads;
+    std::shared_ptr<Buffer> buffer;
+    WriteORCFile(*expected, options, &buffer);
+
+    auto input = std::make_shared<io::BufferReader>(buffer);
+    std::unique_ptr<adapters::orc::ORCFileReader> reader;
+    ASSERT_OK(
+        adapters::orc::ORCFileReader::Open(input, default_memory_pool(), &reader));
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(reader->Read(&actual));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(TestAdapterWrite, StripesAndCompression) {
+  Int64Builder builder;
+  for (int64_t i = 0; i < 100000; ++i) {
+    ASSERT_OK(builder.Append(i * i));
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  auto table = Table::Make(::arrow::schema({field("col", int64())}),
+                           std::vector<std::shared_ptr<Array>>{values});
+
+  adapters::orc::ORCWriteOptions options;
+  options.stripe_size = 16 * 1024;
+  options.compression = Compression::SNAPPY;
+  std::shared_ptr<Buffer> buffer;
+  WriteORCFile(*table, options, &buffer);
+
+  std::unique_ptr<adapters::orc::ORCFileReader> reader;
+  auto input = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK(adapters::orc::ORCFileReader::Open(input, default_memory_pool(), &reader));
+  ASSERT_GT(reader->NumberOfStripes(), 1);
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(reader->Read(&actual));
+  AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(TestAdapterWrite, UnsupportedOptions) {
+  auto schema = ::arrow::schema({field("col", uint32())});
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+  std::unique_ptr<adapters::orc::ORCFileWriter> writer;
+  adapters::orc::ORCWriteOptions options;
+  ASSERT_RAISES(NotImplemented,
+                adapters::orc::ORCFileWriter::Open(schema, sink, options, &writer));
+
+  schema = ::arrow::schema({field("col", int32())});
+  options.compression = Compression::BROTLI;
+  ASSERT_RAISES(Invalid,
+                adapters::orc::ORCFileWriter::Open(schema, sink, options, &writer));
+}
 }  // namespace arrow
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstring>
 #include <string>
 #include <vector>
 
@@ -22,6 +24,7 @@
 #include "arrow/array/builder_base.h"
 #include "arrow/builder.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/range.h"
@@ -316,6 +319,319 @@ Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
   }
 }
 
+// Grow the batch to hold size rows, and set the nulls of the rows written
+template <class batch_type>
+batch_type* PrepareBatch(const Array& array, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  auto batch = checked_cast<batch_type*>(cbatch);
+  const int64_t size = batch_offset + length;
+  if (batch->capacity < static_cast<uint64_t>(size)) {
+    batch->resize(size);
+  }
+  batch->numElements = size;
+
+  if (batch_offset == 0) {
+    batch->hasNulls = false;
+  }
+  char* not_null = batch->notNull.data() + batch_offset;
+  if (array.null_count() == 0) {
+    std::memset(not_null, 1, length);
+  } else {
+    batch->hasNulls = true;
+    for (int64_t i = 0; i < length; i++) {
+      not_null[i] = array.IsValid(offset + i);
+    }
+  }
+  return batch;
+}
+
+template <class array_type, class batch_type>
+Status WriteNumericBatch(const Array& parray, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  const auto& array = checked_cast<const array_type&>(parray);
+  auto batch = PrepareBatch<batch_type>(array, offset, length, cbatch, batch_offset);
+
+  auto target = batch->data.data() + batch_offset;
+  for (int64_t i = 0; i < length; i++) {
+    target[i] = array.Value(offset + i);
+  }
+  return Status::OK();
+}
+
+Status WriteTimestampBatch(const Array& parray, int64_t offset, int64_t length,
+                           liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  const auto& array = checked_cast<const TimestampArray&>(parray);
+  auto batch =
+      PrepareBatch<liborc::TimestampVectorBatch>(array, offset, length, cbatch,
+                                                 batch_offset);
+
+  int64_t units_per_second = 1;
+  switch (checked_cast<const TimestampType&>(*array.type()).unit()) {
+    case TimeUnit::SECOND:
+      break;
+    case TimeUnit::MILLI:
+      units_per_second = 1000;
+      break;
+    case TimeUnit::MICRO:
+      units_per_second = 1000000;
+      break;
+    case TimeUnit::NANO:
+      units_per_second = kOneSecondNanos;
+      break;
+  }
+  const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+
+  int64_t* seconds = batch->data.data() + batch_offset;
+  int64_t* nanos = batch->nanoseconds.data() + batch_offset;
+  for (int64_t i = 0; i < length; i++) {
+    // ORC nanoseconds are positive, round the seconds down
+    const int64_t value = array.Value(offset + i);
+    int64_t second = value / units_per_second;
+    int64_t remainder = value % units_per_second;
+    if (remainder < 0) {
+      --second;
+      remainder += units_per_second;
+    }
+    seconds[i] = second;
+    nanos[i] = remainder * nanos_per_unit;
+  }
+  return Status::OK();
+}
+
+template <class array_type>
+Status WriteBinaryBatch(const Array& parray, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  const auto& array = checked_cast<const array_type&>(parray);
+  auto batch = PrepareBatch<liborc::StringVectorBatch>(array, offset, length, cbatch,
+                                                       batch_offset);
+
+  char** data = batch->data.data() + batch_offset;
+  int64_t* lengths = batch->length.data() + batch_offset;
+  for (int64_t i = 0; i < length; i++) {
+    typename array_type::offset_type value_length;
+    const uint8_t* value = array.GetValue(offset + i, &value_length);
+    data[i] = const_cast<char*>(reinterpret_cast<const char*>(value));
+    lengths[i] = value_length;
+  }
+  return Status::OK();
+}
+
+Status WriteFixedBinaryBatch(const Array& parray, int64_t offset, int64_t length,
+                             liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  const auto& array = checked_cast<const FixedSizeBinaryArray&>(parray);
+  auto batch = PrepareBatch<liborc::StringVectorBatch>(array, offset, length, cbatch,
+                                                       batch_offset);
+
+  char** data = batch->data.data() + batch_offset;
+  int64_t* lengths = batch->length.data() + batch_offset;
+  for (int64_t i = 0; i < length; i++) {
+    const uint8_t* value = array.GetValue(offset + i);
+    data[i] = const_cast<char*>(reinterpret_cast<const char*>(value));
+    lengths[i] = array.byte_width();
+  }
+  return Status::OK();
+}
+
+Status WriteDecimalBatch(const Array& parray, int64_t offset, int64_t length,
+                         liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  const auto& array = checked_cast<const Decimal128Array&>(parray);
+  const auto& type = checked_cast<const Decimal128Type&>(*array.type());
+
+  // Mirrors the batch types created by liborc for the precision
+  if (type.precision() > 18) {
+    auto batch = PrepareBatch<liborc::Decimal128VectorBatch>(array, offset, length,
+                                                             cbatch, batch_offset);
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+    auto target = batch->values.data() + batch_offset;
+    for (int64_t i = 0; i < length; i++) {
+      const Decimal128 value(array.GetValue(offset + i));
+      target[i] = liborc::Int128(value.high_bits(), value.low_bits());
+    }
+  } else {
+    auto batch = PrepareBatch<liborc::Decimal64VectorBatch>(array, offset, length,
+                                                            cbatch, batch_offset);
+    batch->precision = type.precision();
+    batch->scale = type.scale();
+    auto target = batch->values.data() + batch_offset;
+    for (int64_t i = 0; i < length; i++) {
+      const Decimal128 value(array.GetValue(offset + i));
+      target[i] = static_cast<int64_t>(value.low_bits());
+    }
+  }
+  return Status::OK();
+}
+
+Status WriteStructBatch(const Array& parray, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  const auto& array = checked_cast<const StructArray&>(parray);
+  auto batch = PrepareBatch<liborc::StructVectorBatch>(array, offset, length, cbatch,
+                                                       batch_offset);
+
+  for (int i = 0; i < array.num_fields(); i++) {
+    RETURN_NOT_OK(
+        WriteBatch(*array.field(i), offset, length, batch->fields[i], batch_offset));
+  }
+  return Status::OK();
+}
+
+template <class array_type>
+Status WriteListBatch(const Array& parray, int64_t offset, int64_t length,
+                      liborc::ColumnVectorBatch* cbatch, int64_t batch_offset) {
+  const auto& array = checked_cast<const array_type&>(parray);
+  auto batch = PrepareBatch<liborc::ListVectorBatch>(array, offset, length, cbatch,
+                                                     batch_offset);
+  liborc::ColumnVectorBatch* elements = batch->elements.get();
+
+  int64_t* offsets = batch->offsets.data() + batch_offset;
+  if (batch_offset == 0) {
+    offsets[0] = 0;
+  }
+  // Only the elements of the valid lists are written, one run of consecutive
+  // valid lists at a time
+  int64_t run_start = offset;
+  auto write_run = [&](int64_t run_end) -> Status {
+    const int64_t start = array.value_offset(run_start);
+    const int64_t end = array.value_offset(run_end);
+    if (end > start) {
+      const int64_t elements_offset = offsets[run_start - offset];
+      RETURN_NOT_OK(
+          WriteBatch(*array.values(), start, end - start, elements, elements_offset));
+    }
+    return Status::OK();
+  };
+  for (int64_t i = 0; i < length; i++) {
+    if (array.IsValid(offset + i)) {
+      offsets[i + 1] = offsets[i] + array.value_length(offset + i);
+    } else {
+      RETURN_NOT_OK(write_run(offset + i));
+      run_start = offset + i + 1;
+      offsets[i + 1] = offsets[i];
+    }
+  }
+  RETURN_NOT_OK(write_run(offset + length));
+  elements->numElements = offsets[length];
+  return Status::OK();
+}
+
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch, int64_t batch_offset) {
+  switch (array.type_id()) {
+    case Type::BOOL:
+      return WriteNumericBatch<BooleanArray, liborc::LongVectorBatch>(
+          array, offset, length, batch, batch_offset);
+    case Type::INT8:
+      return WriteNumericBatch<Int8Array, liborc::LongVectorBatch>(array, offset, length,
+                                                                  batch, batch_offset);
+    case Type::INT16:
+      return WriteNumericBatch<Int16Array, liborc::LongVectorBatch>(
+          array, offset, length, batch, batch_offset);
+    case Type::INT32:
+      return WriteNumericBatch<Int32Array, liborc::LongVectorBatch>(
+          array, offset, length, batch, batch_offset);
+    case Type::INT64:
+      return WriteNumericBatch<Int64Array, liborc::LongVectorBatch>(
+          array, offset, length, batch, batch_offset);
+    case Type::DATE32:
+      return WriteNumericBatch<Date32Array, liborc::LongVectorBatch>(
+          array, offset, length, batch, batch_offset);
+    case Type::FLOAT:
+      return WriteNumericBatch<FloatArray, liborc::DoubleVectorBatch>(
+          array, offset, length, batch, batch_offset);
+    case Type::DOUBLE:
+      return WriteNumericBatch<DoubleArray, liborc::DoubleVectorBatch>(
+          array, offset, length, batch, batch_offset);
+    case Type::TIMESTAMP:
+      return WriteTimestampBatch(array, offset, length, batch, batch_offset);
+    case Type::STRING:
+    case Type::BINARY:
+      return WriteBinaryBatch<BinaryArray>(array, offset, length, batch, batch_offset);
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      return WriteBinaryBatch<LargeBinaryArray>(array, offset, length, batch,
+                                                batch_offset);
+    case Type::FIXED_SIZE_BINARY:
+      return WriteFixedBinaryBatch(array, offset, length, batch, batch_offset);
+    case Type::DECIMAL:
+      return WriteDecimalBatch(array, offset, length, batch, batch_offset);
+    case Type::STRUCT:
+      return WriteStructBatch(array, offset, length, batch, batch_offset);
+    case Type::LIST:
+      return WriteListBatch<ListArray>(array, offset, length, batch, batch_offset);
+    case Type::LARGE_LIST:
+      return WriteListBatch<LargeListArray>(array, offset, length, batch, batch_offset);
+    default:
+      return Status::NotImplemented("Writing type ", array.type()->ToString(),
+                                    " to ORC");
+  }
+}
+
+Status GetORCType(const DataType& type, ORC_UNIQUE_PTR<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+    case Type::LARGE_STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+    case Type::LARGE_BINARY:
+    case Type::FIXED_SIZE_BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::DATE32:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(decimal_type.precision(), decimal_type.scale());
+      break;
+    }
+    case Type::LIST:
+    case Type::LARGE_LIST: {
+      ORC_UNIQUE_PTR<liborc::Type> elemtype;
+      RETURN_NOT_OK(GetORCType(*type.child(0)->type(), &elemtype));
+      *out = liborc::createListType(std::move(elemtype));
+      break;
+    }
+    case Type::STRUCT: {
+      ORC_UNIQUE_PTR<liborc::Type> struct_type = liborc::createStructType();
+      for (const auto& child : type.children()) {
+        ORC_UNIQUE_PTR<liborc::Type> child_type;
+        RETURN_NOT_OK(GetORCType(*child->type(), &child_type));
+        struct_type->addStructField(child->name(), std::move(child_type));
+      }
+      *out = std::move(struct_type);
+      break;
+    }
+    default:
+      return Status::NotImplemented("Writing type ", type.ToString(), " to ORC");
+  }
+  return Status::OK();
+}
+
 Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   // When subselecting fields on read, liborc will set some nodes to nullptr,
   // so we need to check for nullptr before progressing
@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/array.h"
 #include "arrow/array/builder_base.h"
 #include "arrow/status.h"
 #include "orc/OrcFile.hh"
@@ -37,6 +38,15 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out);
 
 Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                    int64_t offset, int64_t length, ArrayBuilder* builder);
+
+Status GetORCType(const DataType& type, ORC_UNIQUE_PTR<liborc::Type>* out);
+
+/// \brief Write the values [offset, offset + length) of array to the rows starting
+/// at batch_offset of batch, growing it as needed
+///
+/// Strings and binaries are not copied: the batch points into the array buffers.
+Status WriteBatch(const Array& array, int64_t offset, int64_t length,
+                  liborc::ColumnVectorBatch* batch, int64_t batch_offset);
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -1453,8 +1453,13 @@ Status Array::Validate() const {
                            "of type ",
                            type.ToString(), ", got ", data.buffers.size());
   }
-  if (data.child_data.size() != static_cast<size_t>(type.num_children())) {
-    return Status::Invalid("Expected ", type.num_children(),
+  // Extension arrays have the children of their storage
+  const int num_children =
+      type.id() == Type::EXTENSION
+          ? checked_cast<const ExtensionType&>(type).storage_type()->num_children()
+          : type.num_children();
+  if (data.child_data.size() != static_cast<size_t>(num_children)) {
+    return Status::Invalid("Expected ", num_children,
                            " child arrays in array "
                            "of type ",
                            type.ToString(), ", got ", data.child_data.size());
@@ -201,6 +201,14 @@ struct ARROW_EXPORT ArrayData {
   /// \brief Return null count, or compute and set it if it's not known
   int64_t GetNullCount() const;
 
+  /// \brief Return false if the data is known to have no nulls, without
+  /// computing an unknown null count
+  ///
+  /// Data without a validity bitmap is all valid, except for NullType.
+  bool MayHaveNulls() const {
+    return null_count != 0 && !buffers.empty() && buffers[0] != NULLPTR;
+  }
+
   std::shared_ptr<DataType> type;
   int64_t length;
   mutable int64_t null_count;
@@ -50,6 +50,15 @@ Status ArrayBuilder::TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buf
   return Status::OK();
 }
 
+Status ArrayBuilder::FinishNullBitmap(std::shared_ptr<Buffer>* out) {
+  if (null_count_ == 0) {
+    null_bitmap_builder_.Reset();
+    *out = NULLPTR;
+    return Status::OK();
+  }
+  return null_bitmap_builder_.Finish(out);
+}
+
 Status ArrayBuilder::AppendToBitmap(bool is_valid) {
   RETURN_NOT_OK(Reserve(1));
   UnsafeAppendToBitmap(is_valid);
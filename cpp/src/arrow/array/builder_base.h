@@ -181,6 +181,10 @@ class ARROW_EXPORT ArrayBuilder {
 
   static Status TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buffer);
 
+  /// \brief Finish the validity bitmap, or output null if there were no
+  /// nulls so that all-valid arrays don't carry a bitmap
+  Status FinishNullBitmap(std::shared_ptr<Buffer>* out);
+
   /// \brief Finish to an array of the specified ArrayType
   template <typename ArrayType>
   Status FinishTyped(std::shared_ptr<ArrayType>* out) {
@@ -102,7 +102,7 @@ Status FixedSizeBinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   RETURN_NOT_OK(byte_builder_.Finish(&data));
 
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
   *out = ArrayData::Make(type_, length_, {null_bitmap, data}, null_count_);
 
   capacity_ = length_ = null_count_ = 0;
@@ -171,6 +171,49 @@ Status ChunkedStringBuilder::Finish(ArrayVector* out) {
   return Status::OK();
 }
 
+Status ChunkedBinaryBuilder::AppendValues(const util::string_view* values,
+                                          int64_t length, const uint8_t* valid_bits,
+                                          int64_t valid_bits_offset) {
+  auto is_valid = [&](int64_t i) {
+    return valid_bits == NULLPTR || BitUtil::GetBit(valid_bits, valid_bits_offset + i);
+  };
+  int64_t i = 0;
+  while (i < length) {
+    // The values which fit in the current chunk
+    const int64_t max_values = max_chunk_length_ - builder_->length();
+    const int64_t max_bytes = max_chunk_value_length_ - builder_->value_data_length();
+    int64_t end = i;
+    int64_t num_bytes = 0;
+    while (end < length && end - i < max_values) {
+      const int64_t value_length =
+          is_valid(end) ? static_cast<int64_t>(values[end].size()) : 0;
+      if (num_bytes + value_length > max_bytes) {
+        break;
+      }
+      num_bytes += value_length;
+      ++end;
+    }
+
+    if (end == i) {
+      // The value starts the next chunk, or is larger than a chunk
+      RETURN_NOT_OK(is_valid(i) ? Append(values[i]) : AppendNull());
+      ++i;
+      continue;
+    }
+
+    RETURN_NOT_OK(builder_->Reserve(end - i));
+    RETURN_NOT_OK(builder_->ReserveData(num_bytes));
+    for (; i < end; ++i) {
+      if (is_valid(i)) {
+        builder_->UnsafeAppend(values[i]);
+      } else {
+        builder_->UnsafeAppendNull();
+      }
+    }
+  }
+  return Status::OK();
+}
+
 Status ChunkedBinaryBuilder::Reserve(int64_t values) {
   if (ARROW_PREDICT_FALSE(extra_capacity_ != 0)) {
     extra_capacity_ += values;
@@ -192,6 +235,13 @@ Status ChunkedBinaryBuilder::Reserve(int64_t values) {
   return builder_->Resize(max_chunk_length_);
 }
 
+Status ChunkedBinaryBuilder::ReserveData(int64_t num_bytes) {
+  // Values which don't fit go to later chunks, which grow as they are filled
+  const int64_t chunk_remaining = max_chunk_value_length_ - builder_->value_data_length();
+  return builder_->ReserveData(
+      std::max<int64_t>(0, std::min(num_bytes, chunk_remaining)));
+}
+
 }  // namespace internal
 
 }  // namespace arrow
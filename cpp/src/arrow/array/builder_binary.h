@@ -219,6 +219,46 @@ class BaseBinaryBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a block of values laid out as in a binary array
+  ///
+  /// The value data is copied in one piece (one per run of valid values if
+  /// valid_bytes is given, as null slots are left empty) and the offsets are
+  /// rebased onto the data already in the builder.
+  ///
+  /// \param[in] offsets length + 1 offsets into data, value i spanning
+  /// [offsets[i], offsets[i + 1])
+  /// \param[in] data the value data the offsets point into
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bytes an optional sequence of bytes where non-zero
+  /// indicates a valid (non-null) value
+  /// \return Status
+  Status AppendValues(const offset_type* offsets, const uint8_t* data, int64_t length,
+                      const uint8_t* valid_bytes = NULLPTR) {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(static_cast<int64_t>(offsets[length]) - offsets[0]));
+
+    if (valid_bytes == NULLPTR) {
+      UnsafeAppendValues(offsets, data, length);
+    } else {
+      int64_t i = 0;
+      while (i < length) {
+        if (!valid_bytes[i]) {
+          UnsafeAppendNextOffset();
+          ++i;
+          continue;
+        }
+        int64_t run_end = i + 1;
+        while (run_end < length && valid_bytes[run_end]) {
+          ++run_end;
+        }
+        UnsafeAppendValues(offsets + i, data, run_end - i);
+        i = run_end;
+      }
+    }
+    UnsafeAppendToBitmap(valid_bytes, length);
+    return Status::OK();
+  }
+
   void Reset() override {
     ArrayBuilder::Reset();
     offsets_builder_.Reset();
@@ -258,7 +298,7 @@ class BaseBinaryBuilder : public ArrayBuilder {
     std::shared_ptr<Buffer> offsets, value_data, null_bitmap;
     ARROW_RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
     ARROW_RETURN_NOT_OK(value_data_builder_.Finish(&value_data));
-    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    ARROW_RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
 
     *out = ArrayData::Make(type_, length_, {null_bitmap, offsets, value_data},
                            null_count_, 0);
@@ -327,6 +367,20 @@ class BaseBinaryBuilder : public ArrayBuilder {
     const int64_t num_bytes = value_data_builder_.length();
     offsets_builder_.UnsafeAppend(static_cast<offset_type>(num_bytes));
   }
+
+  // Append the offsets and data of consecutive values, without the validity
+  void UnsafeAppendValues(const offset_type* offsets, const uint8_t* data,
+                          int64_t length) {
+    const int64_t data_length = static_cast<int64_t>(offsets[length]) - offsets[0];
+    const int64_t shift = value_data_builder_.length() - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(static_cast<offset_type>(offsets[i] + shift));
+    }
+    // Safety check for UBSAN.
+    if (ARROW_PREDICT_TRUE(data_length > 0)) {
+      value_data_builder_.UnsafeAppend(data + offsets[0], data_length);
+    }
+  }
 };
 
 /// \class BinaryBuilder
@@ -552,8 +606,26 @@ class ARROW_EXPORT ChunkedBinaryBuilder {
     return builder_->AppendNull();
   }
 
+  /// \brief Append a sequence of values, starting new chunks as needed
+  ///
+  /// Chunks the values as appending them one by one would, but copies the
+  /// values which fit in the current chunk without checking each of them.
+  ///
+  /// \param[in] values the values; those of the null slots are ignored
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bits an optional validity bitmap, nullptr if all the
+  /// values are valid
+  /// \param[in] valid_bits_offset the offset of the first value in valid_bits
+  Status AppendValues(const util::string_view* values, int64_t length,
+                      const uint8_t* valid_bits = NULLPTR,
+                      int64_t valid_bits_offset = 0);
+
   Status Reserve(int64_t values);
 
+  /// \brief Reserve value data for the current chunk, up to the chunk's
+  /// maximum value length
+  Status ReserveData(int64_t num_bytes);
+
   virtual Status Finish(ArrayVector* out);
 
  protected:
@@ -127,7 +127,7 @@ class BaseListBuilder : public ArrayBuilder {
           std::make_shared<TypeClass>(value_builder_->type()));
     }
     std::shared_ptr<Buffer> null_bitmap;
-    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    ARROW_RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
     *out = ArrayData::Make(type_, length_, {null_bitmap, offsets}, null_count_);
     (*out)->child_data.emplace_back(std::move(items));
     Reset();
@@ -66,7 +66,7 @@ Status BooleanBuilder::Resize(int64_t capacity) {
 
 Status BooleanBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> null_bitmap, data;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
   RETURN_NOT_OK(data_builder_.Finish(&data));
 
   *out = ArrayData::Make(boolean(), length_, {null_bitmap, data}, null_count_);
@@ -160,7 +160,7 @@ class NumericBuilder : public ArrayBuilder {
 
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
     std::shared_ptr<Buffer> data, null_bitmap;
-    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+    ARROW_RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
     ARROW_RETURN_NOT_OK(data_builder_.Finish(&data));
     *out = ArrayData::Make(type_, length_, {null_bitmap, data}, null_count_);
     capacity_ = length_ = null_count_ = 0;
@@ -29,7 +29,7 @@ using internal::checked_cast;
 
 Status BasicUnionBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> types, null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(FinishNullBitmap(&null_bitmap));
   RETURN_NOT_OK(types_builder_.Finish(&types));
 
   // If the type has not been specified in the constructor, gather type_codes
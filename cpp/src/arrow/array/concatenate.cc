@@ -18,6 +18,7 @@
 #include "arrow/array/concatenate.h"
 
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
@@ -27,6 +28,8 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/visibility.h"
 #include "arrow/visitor_inline.h"
 
@@ -53,6 +56,62 @@ struct Bitmap {
   bool AllSet() const { return data == nullptr; }
 };
 
+// Copies of large buffers are split across threads, each of which copies at
+// least this many bytes
+static constexpr int64_t kConcatenateBytesPerThread = 1 << 20;
+
+// The number of threads to copy nbytes with
+static int ConcatenateThreads(int64_t nbytes) {
+  const int64_t num_threads =
+      std::min<int64_t>(GetCpuThreadPoolCapacity(), nbytes / kConcatenateBytesPerThread);
+  return static_cast<int>(std::max<int64_t>(1, num_threads));
+}
+
+// Run func(0) ... func(num_tasks - 1) on num_threads threads.
+//
+// Dedicated threads are used rather than the CPU thread pool, as concatenation
+// may itself run on a thread pool task and waiting on the pool could deadlock.
+template <typename Function>
+static Status RunConcatenateTasks(int num_threads, int num_tasks, Function&& func) {
+  if (num_threads <= 1) {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(func(i));
+    }
+    return Status::OK();
+  }
+  return internal::ParallelFor(std::min(num_threads, num_tasks), num_tasks,
+                               std::forward<Function>(func));
+}
+
+// Allocate a buffer and copy buffers one after the other into it.  Large
+// outputs are split into equal ranges of bytes, each copied by its own thread.
+static Status ConcatenateValueBuffers(const BufferVector& buffers, MemoryPool* pool,
+                                      std::shared_ptr<Buffer>* out) {
+  // starts[i] is the position of buffers[i] in the output
+  std::vector<int64_t> starts(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    starts[i + 1] = starts[i] + buffers[i]->size();
+  }
+  const int64_t out_length = starts.back();
+  RETURN_NOT_OK(AllocateBuffer(pool, out_length, out));
+  uint8_t* dst = (*out)->mutable_data();
+
+  const int num_threads = ConcatenateThreads(out_length);
+  return RunConcatenateTasks(num_threads, num_threads, [&](int task) {
+    const int64_t begin = out_length * task / num_threads;
+    const int64_t end = out_length * (task + 1) / num_threads;
+    // the first buffer overlapping [begin, end)
+    size_t i = std::upper_bound(starts.begin(), starts.end(), begin) - starts.begin() - 1;
+    for (int64_t position = begin; position < end; ++i) {
+      const int64_t copy_end = std::min(end, starts[i + 1]);
+      std::memcpy(dst + position, buffers[i]->data() + (position - starts[i]),
+                  static_cast<size_t>(copy_end - position));
+      position = copy_end;
+    }
+    return Status::OK();
+  });
+}
+
 // Allocate a buffer and concatenate bitmaps into it.
 static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool* pool,
                                  std::shared_ptr<Buffer>* out) {
@@ -85,8 +144,7 @@ static Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool*
 // Write offsets in src into dst, adjusting them such that first_offset
 // will be the first offset written.
 template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range);
+static void PutOffsets(const Buffer& src, Offset first_offset, Offset* dst);
 
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
@@ -96,24 +154,41 @@ static Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
                                  std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
 
-  // allocate output buffer
+  // Compute the range of values spanned by each buffer of offsets, and
+  // where its adjusted offsets go in the output
+  std::vector<int64_t> elements_starts(buffers.size());
+  std::vector<Offset> first_offsets(buffers.size());
   int64_t out_length = 0;
+  Offset values_length = 0;
   for (size_t i = 0; i < buffers.size(); ++i) {
+    const Buffer& src = *buffers[i];
+    auto src_begin = reinterpret_cast<const Offset*>(src.data());
+    auto src_end = reinterpret_cast<const Offset*>(src.data() + src.size());
+    Range* values_range = &values_ranges->at(i);
+    values_range->offset = src_begin[0];
+    values_range->length = *src_end - values_range->offset;
+    if (values_length > std::numeric_limits<Offset>::max() - values_range->length) {
+      return Status::Invalid("offset overflow while concatenating arrays");
+    }
+
+    // the first offset from buffers[i] will be adjusted to values_length
+    // (the cumulative length of values spanned by offsets in previous buffers)
+    elements_starts[i] = out_length;
+    first_offsets[i] = values_length;
     out_length += buffers[i]->size() / sizeof(Offset);
+    values_length += static_cast<Offset>(values_range->length);
   }
+
+  // allocate output buffer
   RETURN_NOT_OK(AllocateBuffer(pool, (out_length + 1) * sizeof(Offset), out));
   auto dst = reinterpret_cast<Offset*>((*out)->mutable_data());
 
-  int64_t elements_length = 0;
-  Offset values_length = 0;
-  for (size_t i = 0; i < buffers.size(); ++i) {
-    // the first offset from buffers[i] will be adjusted to values_length
-    // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(buffers[i], values_length, &dst[elements_length],
-                                     &values_ranges->at(i)));
-    elements_length += buffers[i]->size() / sizeof(Offset);
-    values_length += static_cast<Offset>(values_ranges->at(i).length);
-  }
+  const int num_threads = ConcatenateThreads(out_length * sizeof(Offset));
+  RETURN_NOT_OK(RunConcatenateTasks(
+      num_threads, static_cast<int>(buffers.size()), [&](int i) {
+        PutOffsets<Offset>(*buffers[i], first_offsets[i], &dst[elements_starts[i]]);
+        return Status::OK();
+      }));
 
   // the final element in dst is the length of all values spanned by the offsets
   dst[out_length] = values_length;
@@ -121,25 +196,16 @@ static Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
 }
 
 template <typename Offset>
-static Status PutOffsets(const std::shared_ptr<Buffer>& src, Offset first_offset,
-                         Offset* dst, Range* values_range) {
+static void PutOffsets(const Buffer& src, Offset first_offset, Offset* dst) {
   // Get the range of offsets to transfer from src
-  auto src_begin = reinterpret_cast<const Offset*>(src->data());
-  auto src_end = reinterpret_cast<const Offset*>(src->data() + src->size());
-
-  // Compute the range of values which is spanned by this range of offsets
-  values_range->offset = src_begin[0];
-  values_range->length = *src_end - values_range->offset;
-  if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
-    return Status::Invalid("offset overflow while concatenating arrays");
-  }
+  auto src_begin = reinterpret_cast<const Offset*>(src.data());
+  auto src_end = reinterpret_cast<const Offset*>(src.data() + src.size());
 
   // Write offsets into dst, ensuring that the first offset written is
   // first_offset
   auto adjustment = first_offset - src_begin[0];
   std::transform(src_begin, src_end, dst,
                  [adjustment](Offset offset) { return offset + adjustment; });
-  return Status::OK();
 }
 
 class ConcatenateImpl {
@@ -179,21 +245,21 @@ class ConcatenateImpl {
 
   Status Visit(const FixedWidthType& fixed) {
     // handles numbers, decimal128, fixed_size_binary
-    return ConcatenateBuffers(Buffers(1, fixed), pool_, &out_.buffers[1]);
+    return ConcatenateValueBuffers(Buffers(1, fixed), pool_, &out_.buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
     std::vector<Range> value_ranges;
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(Buffers(1, sizeof(int32_t)), pool_,
                                               &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
+    return ConcatenateValueBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
     std::vector<Range> value_ranges;
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(Buffers(1, sizeof(int64_t)), pool_,
                                               &out_.buffers[1], &value_ranges));
-    return ConcatenateBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
+    return ConcatenateValueBuffers(Buffers(2, value_ranges), pool_, &out_.buffers[2]);
   }
 
   Status Visit(const ListType&) {
@@ -240,7 +306,7 @@ class ConcatenateImpl {
 
     if (dictionaries_same) {
       out_.dictionary = in_[0].dictionary;
-      return ConcatenateBuffers(Buffers(1, *fixed), pool_, &out_.buffers[1]);
+      return ConcatenateValueBuffers(Buffers(1, *fixed), pool_, &out_.buffers[1]);
     } else {
       return Status::NotImplemented("Concat with dictionary unification NYI");
     }
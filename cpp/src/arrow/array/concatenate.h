@@ -28,6 +28,9 @@ namespace arrow {
 
 /// \brief Concatenate arrays
 ///
+/// Copies of large value and offset buffers are split across threads, up to
+/// the capacity of the CPU thread pool.
+///
 /// \param[in] arrays a vector of arrays to be concatenated
 /// \param[in] pool memory to store the result will be allocated from this memory pool
 /// \param[out] out the resulting concatenated array
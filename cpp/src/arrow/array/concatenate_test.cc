@@ -39,6 +39,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -231,6 +232,29 @@ TEST_F(ConcatenateTest, DISABLED_UnionType) {
   });
 }
 
+TEST_F(ConcatenateTest, LargeInputsWithThreads) {
+  // Large enough for the copies of value and offset buffers to be split
+  // across threads
+  const int old_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  const int32_t size = 1 << 20;
+  auto offsets = this->Offsets<int32_t>(size, 7);
+  std::vector<std::shared_ptr<Array>> arrays = {
+      rng_.Numeric<Int64Type>(size, 0, 1000, 0.1),
+      rng_.String(size, /*min_length =*/0, /*max_length =*/15, 0.1),
+      rng_.LargeString(size, /*min_length =*/0, /*max_length =*/15, 0)};
+  for (const auto& array : arrays) {
+    auto expected = array->Slice(offsets.front(), offsets.back() - offsets.front());
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(Concatenate(this->Slices(array, offsets), default_memory_pool(), &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  ASSERT_OK(SetCpuThreadPoolCapacity(old_capacity));
+}
+
 TEST_F(ConcatenateTest, OffsetOverflow) {
   auto fake_long = ArrayFromJSON(utf8(), "[\"\"]");
   fake_long->data()->GetMutableValues<int32_t>(1)[1] =
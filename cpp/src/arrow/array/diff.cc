@@ -32,6 +32,7 @@
 #include "arrow/pretty_print.h"
 #include "arrow/status.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
 #include "arrow/util/stl.h"
@@ -45,6 +46,7 @@ namespace arrow {
 
 using internal::checked_cast;
 using internal::checked_pointer_cast;
+using internal::hash_t;
 using internal::MakeLazyRange;
 
 template <typename ArrayType>
@@ -169,6 +171,68 @@ internal::LazyRange<NullOrViewGenerator<ArrayType>> MakeNullOrViewRange(
   return internal::LazyRange<Generator>(Generator(array), array.length());
 }
 
+// A view of an element whose hash is compared before the element itself, so that
+// most unequal elements are told apart without reading their values
+template <typename ArrayType>
+class HashedView {
+ public:
+  HashedView(const ArrayType& array, const hash_t* hashes, int64_t index)
+      : array_(&array), hashes_(hashes), index_(index) {}
+
+  bool operator==(const HashedView& other) const {
+    return hashes_[index_] == other.hashes_[other.index_] && view() == other.view();
+  }
+  bool operator!=(const HashedView& other) const { return !(*this == other); }
+
+ private:
+  using View = ViewType<ArrayType>;
+
+  NullOr<View> view() const {
+    return array_->IsNull(index_) ? NullOr<View>()
+                                  : NullOr<View>(GetView(*array_, index_));
+  }
+
+  const ArrayType* array_;
+  const hash_t* hashes_;
+  int64_t index_;
+};
+
+template <typename ArrayType>
+class HashedViewGenerator {
+ public:
+  explicit HashedViewGenerator(const Array& array)
+      : array_(checked_cast<const ArrayType&>(array)), hashes_(array.length()) {
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (array_.IsNull(i)) {
+        hashes_[i] = 0;
+      } else {
+        auto view = array_.GetView(i);
+        hashes_[i] = internal::ComputeStringHash<0>(view.data(),
+                                                    static_cast<int64_t>(view.size()));
+      }
+    }
+  }
+
+  HashedView<ArrayType> operator()(int64_t index) const {
+    return {array_, hashes_.data(), index};
+  }
+
+ private:
+  const ArrayType& array_;
+  std::vector<hash_t> hashes_;
+};
+
+template <typename ArrayType>
+internal::LazyRange<HashedViewGenerator<ArrayType>> MakeHashedViewRange(
+    const Array& array) {
+  using Generator = HashedViewGenerator<ArrayType>;
+  return internal::LazyRange<Generator>(Generator(array), array.length());
+}
+
+// Elements whose views point into a data buffer are hashed before diffing
+template <typename ArrayType>
+using is_hashed_view = std::is_same<ViewType<ArrayType>, util::string_view>;
+
 /// A generic sequence difference algorithm, based on
 ///
 /// E. W. Myers, "An O(ND) difference algorithm and its variations,"
@@ -304,7 +368,10 @@ class QuadraticSpaceMyersDiff {
 
   bool Done() { return finish_index_ != -1; }
 
-  Result<std::shared_ptr<StructArray>> GetEdits(MemoryPool* pool) {
+  // leading_run and trailing_run are added to the first and last runs of shared
+  // elements, for sequences whose common prefix and suffix were not diffed
+  Result<std::shared_ptr<StructArray>> GetEdits(MemoryPool* pool, int64_t leading_run,
+                                                int64_t trailing_run) {
     DCHECK(Done());
 
     int64_t length = edit_count_ + 1;
@@ -338,6 +405,8 @@ class QuadraticSpaceMyersDiff {
     }
     BitUtil::SetBitTo(insert_buf->mutable_data(), 0, false);
     run_length[0] = endpoint.base - base_begin_;
+    run_length[0] += leading_run;
+    run_length[edit_count_] += trailing_run;
 
     return StructArray::Make({std::make_shared<BooleanArray>(length, insert_buf),
                               std::make_shared<Int64Array>(length, run_length_buf)},
@@ -390,20 +459,94 @@ struct DiffImpl {
   template <typename T>
   Status Visit(const T&) {
     using ArrayType = typename TypeTraits<T>::ArrayType;
-    if (base_.null_count() == 0 && target_.null_count() == 0) {
-      auto base = MakeViewRange<ArrayType>(base_);
-      auto target = MakeViewRange<ArrayType>(target_);
+    // the shared elements at either end are skipped in bulk, leaving only the
+    // elements between them to the Myers algorithm
+    prefix_length_ = CommonPrefixLength();
+    suffix_length_ = CommonSuffixLength();
+    auto base = base_.Slice(prefix_length_,
+                            base_.length() - prefix_length_ - suffix_length_);
+    auto target = target_.Slice(prefix_length_,
+                                target_.length() - prefix_length_ - suffix_length_);
+    return DiffSlices<ArrayType>(*base, *target);
+  }
+
+  template <typename ArrayType>
+  typename std::enable_if<is_hashed_view<ArrayType>::value, Status>::type DiffSlices(
+      const Array& base_slice, const Array& target_slice) {
+    auto base = MakeHashedViewRange<ArrayType>(base_slice);
+    auto target = MakeHashedViewRange<ArrayType>(target_slice);
+    ARROW_ASSIGN_OR_RAISE(out_,
+                          Diff(base.begin(), base.end(), target.begin(), target.end()));
+    return Status::OK();
+  }
+
+  template <typename ArrayType>
+  typename std::enable_if<!is_hashed_view<ArrayType>::value, Status>::type DiffSlices(
+      const Array& base_slice, const Array& target_slice) {
+    if (base_slice.null_count() == 0 && target_slice.null_count() == 0) {
+      auto base = MakeViewRange<ArrayType>(base_slice);
+      auto target = MakeViewRange<ArrayType>(target_slice);
       ARROW_ASSIGN_OR_RAISE(out_,
                             Diff(base.begin(), base.end(), target.begin(), target.end()));
     } else {
-      auto base = MakeNullOrViewRange<ArrayType>(base_);
-      auto target = MakeNullOrViewRange<ArrayType>(target_);
+      auto base = MakeNullOrViewRange<ArrayType>(base_slice);
+      auto target = MakeNullOrViewRange<ArrayType>(target_slice);
       ARROW_ASSIGN_OR_RAISE(out_,
                             Diff(base.begin(), base.end(), target.begin(), target.end()));
     }
     return Status::OK();
   }
 
+  // Find the length of the run of shared elements at the start of base and target.
+  // Blocks of doubling length are compared with RangeEquals until one differs, then
+  // the first difference is bisected.
+  int64_t CommonPrefixLength() const {
+    const int64_t max_length = std::min(base_.length(), target_.length());
+    int64_t length = 0, block_length = kMinBlockLength;
+    bool bisecting = false;
+    while (length < max_length) {
+      const int64_t compared = std::min(block_length, max_length - length);
+      if (base_.RangeEquals(length, length + compared, length, target_)) {
+        length += compared;
+        if (!bisecting) {
+          block_length *= 2;
+        }
+      } else if (compared == 1) {
+        break;
+      } else {
+        bisecting = true;
+        block_length = compared / 2;
+      }
+    }
+    return length;
+  }
+
+  // Find the length of the run of shared elements at the end of base and target,
+  // excluding the common prefix
+  int64_t CommonSuffixLength() const {
+    const int64_t max_length =
+        std::min(base_.length(), target_.length()) - prefix_length_;
+    int64_t length = 0, block_length = kMinBlockLength;
+    bool bisecting = false;
+    while (length < max_length) {
+      const int64_t compared = std::min(block_length, max_length - length);
+      const int64_t base_start = base_.length() - length - compared;
+      const int64_t target_start = target_.length() - length - compared;
+      if (base_.RangeEquals(base_start, base_start + compared, target_start, target_)) {
+        length += compared;
+        if (!bisecting) {
+          block_length *= 2;
+        }
+      } else if (compared == 1) {
+        break;
+      } else {
+        bisecting = true;
+        block_length = compared / 2;
+      }
+    }
+    return length;
+  }
+
   Status Visit(const ExtensionType&) {
     auto base = checked_cast<const ExtensionArray&>(base_).storage();
     auto target = checked_cast<const ExtensionArray&>(target_).storage();
@@ -428,22 +571,27 @@ struct DiffImpl {
     while (!impl.Done()) {
       impl.Next();
     }
-    return impl.GetEdits(pool_);
+    return impl.GetEdits(pool_, prefix_length_, suffix_length_);
   }
 
+  static constexpr int64_t kMinBlockLength = 64;
+
   const Array& base_;
   const Array& target_;
   MemoryPool* pool_;
   std::shared_ptr<StructArray> out_;
+  int64_t prefix_length_, suffix_length_;
 };
 
+constexpr int64_t DiffImpl::kMinBlockLength;
+
 Result<std::shared_ptr<StructArray>> Diff(const Array& base, const Array& target,
                                           MemoryPool* pool) {
   if (!base.type()->Equals(target.type())) {
     return Status::TypeError("only taking the diff of like-typed arrays is supported.");
   }
 
-  return DiffImpl{base, target, pool, nullptr}.Diff();
+  return DiffImpl{base, target, pool, nullptr, 0, 0}.Diff();
 }
 
 using Formatter = std::function<void(const Array&, int64_t index, std::ostream*)>;
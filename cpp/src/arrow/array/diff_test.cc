@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/diff.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
@@ -192,7 +193,7 @@ TYPED_TEST(DiffTestWithNumeric, Basics) {
   this->target_ = ArrayFromJSON(this->type_singleton(), "[1, 2, null, null, 5]");
   this->DoDiff();
   this->AssertInsertIs("[false, false, true]");
-  this->AssertRunLengthIs("[2, 1, 1]");
+  this->AssertRunLengthIs("[2, 0, 2]");
 
   // append some
   this->base_ = ArrayFromJSON(this->type_singleton(), "[1, 2, 3, null, 5]");
@@ -251,6 +252,33 @@ TEST_F(DiffTest, CompareRandomStrings) {
   }
 }
 
+TEST_F(DiffTest, CompareLongArraysWithFewDeletions) {
+  constexpr int64_t length = 1 << 16;
+  const std::vector<int64_t> deleted = {0, 1000, 1001, 1002, 40000, length - 1};
+  for (auto null_probability : {0.0, 0.25}) {
+    for (auto values : {this->rng_.Int64(length, 0, 127, null_probability),
+                        this->rng_.StringWithRepeats(length, 1 << 8, 0, 32,
+                                                     null_probability)}) {
+      ArrayVector kept;
+      int64_t kept_begin = 0;
+      for (auto i : deleted) {
+        kept.push_back(values->Slice(kept_begin, i - kept_begin));
+        kept_begin = i + 1;
+      }
+      this->base_ = values;
+      ASSERT_OK(Concatenate(kept, default_memory_pool(), &this->target_));
+
+      this->DoDiff();
+      ASSERT_OK(ValidateEditScript(*this->edits_, *this->base_, *this->target_));
+      // target is a subsequence of base, so only deletions are needed
+      for (int64_t i = 1; i < this->insert_->length(); ++i) {
+        ASSERT_FALSE(this->insert_->Value(i));
+      }
+      ASSERT_EQ(this->edits_->length() - 1, base_->length() - target_->length());
+    }
+  }
+}
+
 TEST_F(DiffTest, BasicsWithStrings) {
   // insert one
   base_ = ArrayFromJSON(utf8(), R"(["give", "a", "break"])");
@@ -394,6 +394,40 @@ class TestStringBuilder : public TestBuilder {
     CheckStringArray(*result_, {"", "bb", "a", "", "ccc"}, {1, 1, 1, 0, 1}, reps);
   }
 
+  void TestAppendOffsetsAndData() {
+    // Offsets needn't start at zero; the null's data is skipped
+    const std::string data = "xxbbaignoredccc";
+    std::vector<offset_type> offsets = {2, 2, 4, 5, 12, 15};
+    std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
+    const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+
+    int N = static_cast<int>(valid_bytes.size());
+    int reps = 1000;
+
+    ASSERT_OK(builder_->Append("z"));
+    for (int j = 0; j < reps; ++j) {
+      ASSERT_OK(builder_->AppendValues(offsets.data(), raw_data, N, valid_bytes.data()));
+      ASSERT_OK(builder_->AppendValues(offsets.data() + 1, raw_data, 2));
+    }
+    Done();
+
+    ASSERT_EQ(1 + reps * (N + 2), result_->length());
+    ASSERT_EQ(reps, result_->null_count());
+    ASSERT_EQ(1 + reps * 9, result_->value_data()->size());
+
+    ASSERT_EQ("z", result_->GetString(0));
+    for (int j = 0; j < reps; ++j) {
+      const int64_t base = 1 + j * (N + 2);
+      ASSERT_EQ("", result_->GetString(base));
+      ASSERT_EQ("bb", result_->GetString(base + 1));
+      ASSERT_EQ("a", result_->GetString(base + 2));
+      ASSERT_TRUE(result_->IsNull(base + 3));
+      ASSERT_EQ("ccc", result_->GetString(base + 4));
+      ASSERT_EQ("bb", result_->GetString(base + 5));
+      ASSERT_EQ("a", result_->GetString(base + 6));
+    }
+  }
+
   void TestCapacityReserve() {
     std::vector<std::string> strings = {"aaaaa", "bbbbbbbbbb", "ccccccccccccccc",
                                         "dddddddddd"};
@@ -463,6 +497,10 @@ TYPED_TEST(TestStringBuilder, TestAppendCStringsWithoutValidBytes) {
   this->TestAppendCStringsWithoutValidBytes();
 }
 
+TYPED_TEST(TestStringBuilder, TestAppendOffsetsAndData) {
+  this->TestAppendOffsetsAndData();
+}
+
 TYPED_TEST(TestStringBuilder, TestCapacityReserve) { this->TestCapacityReserve(); }
 
 TYPED_TEST(TestStringBuilder, TestZeroLength) { this->TestZeroLength(); }
@@ -536,6 +574,28 @@ TEST_F(TestChunkedBinaryBuilder, Reserve) {
   ASSERT_EQ(default_memory_pool()->bytes_allocated(), bytes_after_first_reserve);
 }
 
+TEST_F(TestChunkedBinaryBuilder, ReserveData) {
+  const int32_t chunksize = 1000;
+  Init(chunksize);
+  ASSERT_OK(builder_->Reserve(20));
+  ASSERT_OK(builder_->Append(reinterpret_cast<const uint8_t*>("abc"), 3));
+  // Only the current chunk's remaining value length is reserved
+  ASSERT_OK(builder_->ReserveData(10 * chunksize));
+  auto bytes_after_reserve = default_memory_pool()->bytes_allocated();
+  uint8_t buf[99] = {};
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(builder_->Append(buf, sizeof(buf)));
+  }
+  ASSERT_EQ(default_memory_pool()->bytes_allocated(), bytes_after_reserve);
+  ASSERT_OK(builder_->Append(buf, sizeof(buf)));
+
+  ArrayVector chunks;
+  ASSERT_OK(builder_->Finish(&chunks));
+  ASSERT_EQ(2, chunks.size());
+  ASSERT_EQ(11, chunks[0]->length());
+  ASSERT_EQ(1, chunks[1]->length());
+}
+
 TEST_F(TestChunkedBinaryBuilder, NoData) {
   Init(1000);
 
@@ -601,6 +661,50 @@ TEST_F(TestChunkedBinaryBuilder, LargeElementCount) {
   }
 }
 
+TEST_F(TestChunkedBinaryBuilder, AppendValues) {
+  // Values of various sizes, some larger than a chunk, and nulls
+  std::vector<std::string> values;
+  std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(300));
+  for (int i = 0; i < 300; ++i) {
+    values.emplace_back(i % 37 == 0 ? 120 : i % 7, static_cast<char>('a' + i % 26));
+    BitUtil::SetBitTo(valid_bits.data(), i, i % 5 != 0);
+  }
+  std::vector<util::string_view> views(values.begin(), values.end());
+
+  internal::ChunkedBinaryBuilder expected_builder(100, 20);
+  for (int i = 10; i < 300; ++i) {
+    if (BitUtil::GetBit(valid_bits.data(), i)) {
+      ASSERT_OK(expected_builder.Append(views[i]));
+    } else {
+      ASSERT_OK(expected_builder.AppendNull());
+    }
+  }
+  ArrayVector expected;
+  ASSERT_OK(expected_builder.Finish(&expected));
+
+  Init(100, 20);
+  ASSERT_OK(builder_->AppendValues(views.data() + 10, 150, valid_bits.data(), 10));
+  ASSERT_OK(builder_->AppendValues(views.data() + 160, 140, valid_bits.data(), 160));
+  ArrayVector chunks;
+  ASSERT_OK(builder_->Finish(&chunks));
+
+  ASSERT_EQ(expected.size(), chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    AssertArraysEqual(*expected[i], *chunks[i]);
+  }
+
+  // Without a validity bitmap
+  Init(100, 20);
+  ASSERT_OK(builder_->AppendValues(views.data(), 300));
+  ASSERT_OK(builder_->Finish(&chunks));
+  int64_t length = 0;
+  for (const auto& chunk : chunks) {
+    ASSERT_EQ(0, chunk->null_count());
+    length += chunk->length();
+  }
+  ASSERT_EQ(300, length);
+}
+
 TEST(TestChunkedStringBuilder, BasicOperation) {
   const int chunksize = 100;
   internal::ChunkedStringBuilder builder(chunksize);
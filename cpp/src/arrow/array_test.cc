@@ -483,8 +483,12 @@ void TestPrimitiveBuilder<PBoolean>::Check(const std::unique_ptr<BooleanBuilder>
   }
   AssertArraysEqual(*result, *expected);
 
-  // buffers are correctly sized
-  ASSERT_EQ(result->data()->buffers[0]->size(), BitUtil::BytesForBits(size));
+  // buffers are correctly sized, and there is no validity bitmap without nulls
+  if (ex_null_count > 0) {
+    ASSERT_EQ(result->data()->buffers[0]->size(), BitUtil::BytesForBits(size));
+  } else {
+    ASSERT_EQ(result->data()->buffers[0], nullptr);
+  }
   ASSERT_EQ(result->data()->buffers[1]->size(), BitUtil::BytesForBits(size));
 
   // Builder is now reset
@@ -1193,6 +1197,47 @@ TEST(TestPrimitiveAdHoc, FloatingNanEquality) {
   CheckFloatingNanEquality<DoubleType>();
 }
 
+TEST(TestPrimitiveAdHoc, EqualityMasksNullSlots) {
+  // Runs of valid and null slots of various lengths, across bitmap bytes, with
+  // different values in the null slots
+  const int32_t length = 200;
+  std::vector<bool> is_valid;
+  std::vector<int32_t> values, other_values, all_valid_values;
+  for (int32_t i = 0; i < length; ++i) {
+    const bool valid = i % 7 != 0 && !(i >= 40 && i < 60) && !(i >= 100 && i < 104);
+    is_valid.push_back(valid);
+    values.push_back(i);
+    other_values.push_back(valid ? i : -i - 1);
+  }
+  std::shared_ptr<Array> a, b, c, d;
+  ArrayFromVector<Int32Type>(is_valid, values, &a);
+  ArrayFromVector<Int32Type>(is_valid, other_values, &b);
+  ArrayFromVector<Int32Type>(values, &d);
+
+  ASSERT_TRUE(a->Equals(b));
+  ASSERT_TRUE(a->Slice(3)->Equals(b->Slice(3)));
+  ASSERT_TRUE(a->RangeEquals(b, 0, length, 0));
+  ASSERT_TRUE(a->RangeEquals(b, 5, 190, 5));
+  ASSERT_TRUE(a->Slice(3)->RangeEquals(b->Slice(1), 2, 150, 4));
+
+  // A different valid value is found wherever it is
+  for (int32_t position : {1, 61, 130, 199}) {
+    std::vector<int32_t> changed_values = values;
+    ++changed_values[position];
+    ArrayFromVector<Int32Type>(is_valid, changed_values, &c);
+    ASSERT_FALSE(a->Equals(c));
+    ASSERT_FALSE(a->Slice(1)->Equals(c->Slice(1)));
+    ASSERT_FALSE(a->RangeEquals(c, 0, length, 0));
+    ASSERT_TRUE(a->RangeEquals(c, position + 1, length, position + 1));
+  }
+
+  // The validity of the ranges must match
+  ASSERT_FALSE(a->RangeEquals(d, 0, length, 0));
+  ASSERT_FALSE(d->RangeEquals(a, 0, length, 0));
+  ASSERT_TRUE(a->RangeEquals(d, 1, 7, 1));
+  ASSERT_TRUE(d->RangeEquals(a, 1, 7, 1));
+}
+
 // ----------------------------------------------------------------------
 // FixedSizeBinary tests
 
@@ -117,6 +117,87 @@ inline bool FloatingApproxEquals(const NumericArray<ArrowType>& left,
   }
 }
 
+// Whether the length slots from left_start in left and from right_start in right
+// have the same validity
+static bool RangeNullsEqual(const Array& left, int64_t left_start, const Array& right,
+                            int64_t right_start, int64_t length) {
+  const uint8_t* left_bitmap = left.null_count() > 0 ? left.null_bitmap_data() : NULLPTR;
+  const uint8_t* right_bitmap =
+      right.null_count() > 0 ? right.null_bitmap_data() : NULLPTR;
+  if (left_bitmap == NULLPTR && right_bitmap == NULLPTR) {
+    return true;
+  }
+  if (left_bitmap != NULLPTR && right_bitmap != NULLPTR) {
+    return BitmapEquals(left_bitmap, left.offset() + left_start, right_bitmap,
+                        right.offset() + right_start, length);
+  }
+  // The range of the array with nulls must be all valid
+  if (left_bitmap != NULLPTR) {
+    return CountSetBits(left_bitmap, left.offset() + left_start, length) == length;
+  }
+  return CountSetBits(right_bitmap, right.offset() + right_start, length) == length;
+}
+
+// Call equal_run(start, run_length) for each run of consecutive valid slots among
+// the length slots of the validity bitmap from offset (all valid if the bitmap is
+// null), until it returns false.  Whole bytes with all slots valid or null are
+// skipped at once, so that runs are compared in bulk.
+template <typename EqualRun>
+static bool ValidRunsEqual(const uint8_t* bitmap, int64_t offset, int64_t length,
+                           EqualRun&& equal_run) {
+  if (bitmap == NULLPTR) {
+    return length == 0 || equal_run(0, length);
+  }
+  int64_t run_start = -1;
+  int64_t i = 0;
+  while (i < length) {
+    const int64_t bit = offset + i;
+    if (bit % 8 == 0 && i + 8 <= length) {
+      const uint8_t byte = bitmap[bit / 8];
+      if (byte == 0xFF) {
+        if (run_start < 0) {
+          run_start = i;
+        }
+        i += 8;
+        continue;
+      }
+      if (byte == 0) {
+        if (run_start >= 0 && !equal_run(run_start, i - run_start)) {
+          return false;
+        }
+        run_start = -1;
+        i += 8;
+        continue;
+      }
+    }
+    if (BitUtil::GetBit(bitmap, bit)) {
+      if (run_start < 0) {
+        run_start = i;
+      }
+    } else {
+      if (run_start >= 0 && !equal_run(run_start, i - run_start)) {
+        return false;
+      }
+      run_start = -1;
+    }
+    ++i;
+  }
+  return run_start < 0 || equal_run(run_start, length - run_start);
+}
+
+// Compare the valid values of length slots of fixed width values, left_data and
+// right_data pointing to the first slot, given the validity of the left slots
+static bool FixedWidthValuesEqual(const uint8_t* left_data, const uint8_t* right_data,
+                                  int byte_width, const uint8_t* left_bitmap,
+                                  int64_t left_bitmap_offset, int64_t length) {
+  return ValidRunsEqual(
+      left_bitmap, left_bitmap_offset, length, [&](int64_t start, int64_t run_length) {
+        return std::memcmp(left_data + start * byte_width,
+                           right_data + start * byte_width,
+                           static_cast<size_t>(run_length * byte_width)) == 0;
+      });
+}
+
 // RangeEqualsVisitor assumes the range sizes are equal
 
 class RangeEqualsVisitor {
@@ -146,10 +227,73 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  // Fixed width values which are equal if their bytes are
+  bool CompareFixedWidthRange(const PrimitiveArray& left) const {
+    const auto& right = checked_cast<const PrimitiveArray&>(right_);
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (length <= 0) {
+      return true;
+    }
+    if (!RangeNullsEqual(left, left_start_idx_, right, right_start_idx_, length)) {
+      return false;
+    }
+    const int byte_width =
+        checked_cast<const FixedWidthType&>(*left.type()).bit_width() / CHAR_BIT;
+    if (byte_width == 0) {
+      return true;
+    }
+    const uint8_t* left_data =
+        left.values()->data() + (left.offset() + left_start_idx_) * byte_width;
+    const uint8_t* right_data =
+        right.values()->data() + (right.offset() + right_start_idx_) * byte_width;
+    const uint8_t* left_bitmap =
+        left.null_count() > 0 ? left.null_bitmap_data() : NULLPTR;
+    return FixedWidthValuesEqual(left_data, right_data, byte_width, left_bitmap,
+                                 left.offset() + left_start_idx_, length);
+  }
+
   template <typename BinaryArrayType>
   bool CompareBinaryRange(const BinaryArrayType& left) const {
     const auto& right = checked_cast<const BinaryArrayType&>(right_);
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (length <= 0) {
+      return true;
+    }
+    if (!RangeNullsEqual(left, left_start_idx_, right, right_start_idx_, length)) {
+      return false;
+    }
 
+    // When the slots have the same lengths, compare the data of each run of
+    // valid slots at once
+    const auto left_offsets = left.raw_value_offsets() + left_start_idx_;
+    const auto right_offsets = right.raw_value_offsets() + right_start_idx_;
+    bool equal_lengths = true;
+    for (int64_t i = 1; i <= length; ++i) {
+      if (left_offsets[i] - left_offsets[0] != right_offsets[i] - right_offsets[0]) {
+        equal_lengths = false;
+        break;
+      }
+    }
+    if (equal_lengths) {
+      if (left_offsets[length] == left_offsets[0]) {
+        return true;
+      }
+      const uint8_t* left_data = left.value_data()->data();
+      const uint8_t* right_data = right.value_data()->data();
+      const uint8_t* left_bitmap =
+          left.null_count() > 0 ? left.null_bitmap_data() : NULLPTR;
+      return ValidRunsEqual(
+          left_bitmap, left.offset() + left_start_idx_, length,
+          [&](int64_t start, int64_t run_length) {
+            const auto nbytes = left_offsets[start + run_length] - left_offsets[start];
+            return nbytes == 0 ||
+                   std::memcmp(left_data + left_offsets[start],
+                               right_data + right_offsets[start],
+                               static_cast<size_t>(nbytes)) == 0;
+          });
+    }
+
+    // Null slots may have different lengths: compare slot by slot
     for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
          ++i, ++o_i) {
       const bool is_null = left.IsNull(i);
@@ -287,56 +431,33 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
-  Status Visit(const FixedSizeBinaryArray& left) {
-    const auto& right = checked_cast<const FixedSizeBinaryArray&>(right_);
-
-    int32_t width = left.byte_width();
-
-    const uint8_t* left_data = nullptr;
-    const uint8_t* right_data = nullptr;
-
-    if (left.values()) {
-      left_data = left.raw_values();
-    }
-
-    if (right.values()) {
-      right_data = right.raw_values();
-    }
-
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        result_ = false;
-        return Status::OK();
-      }
-      if (is_null) continue;
-
-      if (std::memcmp(left_data + width * i, right_data + width * o_i, width)) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
-    return Status::OK();
-  }
-
-  Status Visit(const Decimal128Array& left) {
-    return Visit(checked_cast<const FixedSizeBinaryArray&>(left));
-  }
-
   Status Visit(const NullArray& left) {
     ARROW_UNUSED(left);
     result_ = true;
     return Status::OK();
   }
 
+  // Floating-point values compare by value, booleans are not byte-aligned
   template <typename T>
-  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value, Status>::type Visit(
-      const T& left) {
+  typename std::enable_if<std::is_base_of<FloatArray, T>::value ||
+                              std::is_base_of<DoubleArray, T>::value ||
+                              std::is_base_of<BooleanArray, T>::value,
+                          Status>::type
+  Visit(const T& left) {
     return CompareValues<T>(left);
   }
 
+  template <typename T>
+  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value &&
+                              !std::is_base_of<FloatArray, T>::value &&
+                              !std::is_base_of<DoubleArray, T>::value &&
+                              !std::is_base_of<BooleanArray, T>::value,
+                          Status>::type
+  Visit(const T& left) {
+    result_ = CompareFixedWidthRange(left);
+    return Status::OK();
+  }
+
   Status Visit(const ListArray& left) {
     result_ = CompareLists(left);
     return Status::OK();
@@ -419,19 +540,9 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
     }
     return true;
   } else if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (left_null != right_null) {
-        return false;
-      }
-      if (!left_null && memcmp(left_data, right_data, byte_width) != 0) {
-        return false;
-      }
-      left_data += byte_width;
-      right_data += byte_width;
-    }
-    return true;
+    // The null bitmaps are equal, compare the runs of valid values
+    return FixedWidthValuesEqual(left_data, right_data, byte_width,
+                                 left.null_bitmap_data(), left.offset(), left.length());
   } else {
     auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
     return memcmp(left_data, right_data, number_of_bytes_to_compare) == 0;
@@ -561,19 +672,19 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
                            static_cast<size_t>(total_bytes)) == 0;
       }
     } else {
-      // ARROW-537: Only compare data in non-null slots
+      // ARROW-537: Only compare data in non-null slots, a run of valid slots at
+      // a time
       auto left_offsets = left.raw_value_offsets();
       auto right_offsets = right.raw_value_offsets();
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsNull(i)) {
-          continue;
-        }
-        if (std::memcmp(left_data + left_offsets[i], right_data + right_offsets[i],
-                        left.value_length(i))) {
-          return false;
-        }
-      }
-      return true;
+      return ValidRunsEqual(
+          left.null_bitmap_data(), left.offset(), left.length(),
+          [&](int64_t start, int64_t run_length) {
+            const auto nbytes = left_offsets[start + run_length] - left_offsets[start];
+            return nbytes == 0 ||
+                   std::memcmp(left_data + left_offsets[start],
+                               right_data + right_offsets[start],
+                               static_cast<size_t>(nbytes)) == 0;
+          });
     }
   }
 
@@ -990,7 +1101,7 @@ bool ArrayApproxEquals(const Array& left, const Array& right, const EqualOptions
 bool ArrayRangeEquals(const Array& left, const Array& right, int64_t left_start_idx,
                       int64_t left_end_idx, int64_t right_start_idx) {
   bool are_equal;
-  if (&left == &right) {
+  if (&left == &right && left_start_idx == right_start_idx) {
     are_equal = true;
   } else if (left.type_id() != right.type_id()) {
     are_equal = false;
@@ -1201,6 +1312,20 @@ inline bool SparseTensorEqualsImplDispatch(const SparseTensorImpl<SparseIndexTyp
                                                                               right_csr);
     }
 
+    case SparseTensorFormat::CSC: {
+      const auto& right_csc =
+          checked_cast<const SparseTensorImpl<SparseCSCIndex>&>(right);
+      return SparseTensorEqualsImpl<SparseIndexType, SparseCSCIndex>::Compare(left,
+                                                                              right_csc);
+    }
+
+    case SparseTensorFormat::CSF: {
+      const auto& right_csf =
+          checked_cast<const SparseTensorImpl<SparseCSFIndex>&>(right);
+      return SparseTensorEqualsImpl<SparseIndexType, SparseCSFIndex>::Compare(left,
+                                                                              right_csf);
+    }
+
     default:
       return false;
   }
@@ -1232,6 +1357,16 @@ bool SparseTensorEquals(const SparseTensor& left, const SparseTensor& right) {
       return SparseTensorEqualsImplDispatch(left_csr, right);
     }
 
+    case SparseTensorFormat::CSC: {
+      const auto& left_csc = checked_cast<const SparseTensorImpl<SparseCSCIndex>&>(left);
+      return SparseTensorEqualsImplDispatch(left_csc, right);
+    }
+
+    case SparseTensorFormat::CSF: {
+      const auto& left_csf = checked_cast<const SparseTensorImpl<SparseCSFIndex>&>(left);
+      return SparseTensorEqualsImplDispatch(left_csf, right);
+    }
+
     default:
       return false;
   }
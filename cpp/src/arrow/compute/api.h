@@ -23,14 +23,21 @@
 
 #include "arrow/compute/kernels/boolean.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/cast.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/column_index.h"     // IWYU pragma: export
 #include "arrow/compute/kernels/compare.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/count.h"            // IWYU pragma: export
+#include "arrow/compute/kernels/decimal.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/filter.h"           // IWYU pragma: export
+#include "arrow/compute/kernels/groupby.h"          // IWYU pragma: export
 #include "arrow/compute/kernels/hash.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/isin.h"             // IWYU pragma: export
 #include "arrow/compute/kernels/mean.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/partition.h"        // IWYU pragma: export
+#include "arrow/compute/kernels/run_length.h"       // IWYU pragma: export
 #include "arrow/compute/kernels/sort_to_indices.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/strptime.h"         // IWYU pragma: export
 #include "arrow/compute/kernels/sum.h"              // IWYU pragma: export
 #include "arrow/compute/kernels/take.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/window.h"           // IWYU pragma: export
 
 #endif  // ARROW_COMPUTE_API_H
@@ -26,7 +26,10 @@ namespace arrow {
 namespace compute {
 
 FunctionContext::FunctionContext(MemoryPool* pool)
-    : pool_(pool), cpu_info_(internal::CpuInfo::GetInstance()) {}
+    : pool_(pool),
+      cpu_info_(internal::CpuInfo::GetInstance()),
+      use_threads_(false),
+      max_parallelism_(0) {}
 
 MemoryPool* FunctionContext::memory_pool() const { return pool_; }
 
@@ -70,10 +70,29 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Set whether kernels may process the chunks of ChunkedArray inputs
+  /// in parallel on the CPU thread pool (default false)
+  ///
+  /// Output chunks are produced in input order either way.  Only kernels
+  /// without per-call state use this; others still process chunks serially.
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
+  /// \brief Return true if chunks may be processed in parallel
+  bool use_threads() const { return use_threads_; }
+
+  /// \brief Set the maximum number of chunks processed concurrently when
+  /// use_threads() is true.  0 (the default) means the CPU thread pool capacity.
+  void set_max_parallelism(int max_parallelism) { max_parallelism_ = max_parallelism; }
+
+  /// \brief Return the maximum number of chunks processed concurrently
+  int max_parallelism() const { return max_parallelism_; }
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_;
+  int max_parallelism_;
 };
 
 }  // namespace compute
@@ -0,0 +1,701 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/expr_executor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/boolean.h"
+#include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/compare.h"
+#include "arrow/compute/operations/field_ref.h"
+#include "arrow/compute/operations/literal.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+#define NUMERIC_TYPES(ACTION) \
+  ACTION(UINT8, UInt8Type)    \
+  ACTION(INT8, Int8Type)      \
+  ACTION(UINT16, UInt16Type)  \
+  ACTION(INT16, Int16Type)    \
+  ACTION(UINT32, UInt32Type)  \
+  ACTION(INT32, Int32Type)    \
+  ACTION(UINT64, UInt64Type)  \
+  ACTION(INT64, Int64Type)    \
+  ACTION(FLOAT, FloatType)    \
+  ACTION(DOUBLE, DoubleType)
+
+// The values of a node for the current morsel.  Numeric values are native
+// values and booleans are bytes of 0 or 1.  valid holds a byte per value, 0 for
+// null, or is null if all the values are valid.
+struct MorselValues {
+  const uint8_t* data = NULLPTR;
+  const uint8_t* valid = NULLPTR;
+};
+
+// The buffers a node writes the values of a morsel to, reused for every
+// morsel an evaluation task processes
+struct Scratch {
+  // uint64_t for the alignment of any value type
+  std::vector<uint64_t> data;
+  std::vector<uint8_t> valid;
+
+  template <typename T>
+  T* values() {
+    return reinterpret_cast<T*>(data.data());
+  }
+};
+
+struct Node;
+
+using NodeFunc = Status (*)(const Node& node, const ArrayData* const* columns,
+                            int64_t offset, int64_t length, const MorselValues* inputs,
+                            Scratch* scratch, MorselValues* out);
+
+struct Node {
+  NodeFunc func;
+  std::shared_ptr<DataType> type;
+  // Indices of the input nodes, which come before this one
+  std::vector<int> inputs;
+
+  int field_index = -1;
+  CompareOperator compare_op = EQUAL;
+  // The literal value repeated over a morsel, and its validity if null
+  std::vector<uint64_t> literal_data;
+  std::vector<uint8_t> literal_valid;
+};
+
+int ValueWidth(const DataType& type) {
+  if (type.id() == Type::BOOL) {
+    return 1;
+  }
+  return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+}
+
+Status ToArrowType(const LogicalType& type, std::shared_ptr<DataType>* out) {
+  switch (type.id()) {
+    case LogicalType::BOOL:
+      *out = ::arrow::boolean();
+      break;
+    case LogicalType::UINT8:
+      *out = ::arrow::uint8();
+      break;
+    case LogicalType::INT8:
+      *out = ::arrow::int8();
+      break;
+    case LogicalType::UINT16:
+      *out = ::arrow::uint16();
+      break;
+    case LogicalType::INT16:
+      *out = ::arrow::int16();
+      break;
+    case LogicalType::UINT32:
+      *out = ::arrow::uint32();
+      break;
+    case LogicalType::INT32:
+      *out = ::arrow::int32();
+      break;
+    case LogicalType::UINT64:
+      *out = ::arrow::uint64();
+      break;
+    case LogicalType::INT64:
+      *out = ::arrow::int64();
+      break;
+    case LogicalType::FLOAT32:
+      *out = ::arrow::float32();
+      break;
+    case LogicalType::FLOAT64:
+      *out = ::arrow::float64();
+      break;
+    default:
+      return Status::NotImplemented("Evaluation of expressions of type ",
+                                    type.ToString());
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Validity helpers
+
+void UnpackBits(const uint8_t* bitmap, int64_t bit_offset, int64_t length,
+                uint8_t* out) {
+  internal::BitmapReader reader(bitmap, bit_offset, length);
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = reader.IsSet();
+    reader.Next();
+  }
+}
+
+const uint8_t* UnpackValidity(const ArrayData& data, int64_t offset, int64_t length,
+                              Scratch* scratch) {
+  if (data.null_count == 0 || data.buffers[0] == NULLPTR) {
+    return NULLPTR;
+  }
+  UnpackBits(data.buffers[0]->data(), data.offset + offset, length,
+             scratch->valid.data());
+  return scratch->valid.data();
+}
+
+const uint8_t* CombineValidity(const uint8_t* left, const uint8_t* right,
+                               int64_t length, Scratch* scratch) {
+  if (left == NULLPTR) {
+    return right;
+  }
+  if (right == NULLPTR) {
+    return left;
+  }
+  uint8_t* out = scratch->valid.data();
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = left[i] & right[i];
+  }
+  return out;
+}
+
+// ----------------------------------------------------------------------
+// Leaves
+
+template <typename CType>
+Status ReadField(const Node& node, const ArrayData* const* columns, int64_t offset,
+                 int64_t length, const MorselValues*, Scratch* scratch,
+                 MorselValues* out) {
+  const ArrayData& data = *columns[node.field_index];
+  out->data = data.buffers[1]->data() + (data.offset + offset) * sizeof(CType);
+  out->valid = UnpackValidity(data, offset, length, scratch);
+  return Status::OK();
+}
+
+Status ReadBooleanField(const Node& node, const ArrayData* const* columns,
+                        int64_t offset, int64_t length, const MorselValues*,
+                        Scratch* scratch, MorselValues* out) {
+  const ArrayData& data = *columns[node.field_index];
+  uint8_t* values = scratch->values<uint8_t>();
+  UnpackBits(data.buffers[1]->data(), data.offset + offset, length, values);
+  out->data = values;
+  out->valid = UnpackValidity(data, offset, length, scratch);
+  return Status::OK();
+}
+
+Status ReadLiteral(const Node& node, const ArrayData* const*, int64_t, int64_t,
+                   const MorselValues*, Scratch*, MorselValues* out) {
+  out->data = reinterpret_cast<const uint8_t*>(node.literal_data.data());
+  out->valid = node.literal_valid.empty() ? NULLPTR : node.literal_valid.data();
+  return Status::OK();
+}
+
+template <typename CType>
+void FillLiteral(CType value, int64_t morsel_size, Node* node) {
+  node->literal_data.resize(
+      BitUtil::CeilDiv(morsel_size * sizeof(CType), sizeof(uint64_t)));
+  CType* values = reinterpret_cast<CType*>(node->literal_data.data());
+  std::fill(values, values + morsel_size, value);
+}
+
+// ----------------------------------------------------------------------
+// Casts, checked as with the default CastOptions
+
+template <typename T>
+typename std::enable_if<std::is_signed<T>::value, bool>::type IsNegative(T value) {
+  return value < 0;
+}
+
+template <typename T>
+typename std::enable_if<!std::is_signed<T>::value, bool>::type IsNegative(T) {
+  return false;
+}
+
+template <typename InType, typename OutType>
+typename std::enable_if<std::is_integral<InType>::value, bool>::type CastIsSafe(
+    InType value) {
+  const OutType out = static_cast<OutType>(value);
+  return static_cast<InType>(out) == value && IsNegative(value) == IsNegative(out);
+}
+
+template <typename InType, typename OutType>
+typename std::enable_if<std::is_floating_point<InType>::value &&
+                            std::is_integral<OutType>::value,
+                        bool>::type
+CastIsSafe(InType value) {
+  // The bounds of OutType are powers of two, exactly represented by InType
+  const InType lower = static_cast<InType>(std::numeric_limits<OutType>::min());
+  const InType upper = std::ldexp(InType(1), std::numeric_limits<OutType>::digits);
+  return value >= lower && value < upper && std::trunc(value) == value;
+}
+
+template <typename InType, typename OutType>
+typename std::enable_if<std::is_floating_point<InType>::value &&
+                            std::is_floating_point<OutType>::value,
+                        bool>::type
+CastIsSafe(InType) {
+  return true;
+}
+
+template <typename InType, typename OutType>
+Status CastValues(const Node&, const ArrayData* const*, int64_t, int64_t length,
+                  const MorselValues* inputs, Scratch* scratch, MorselValues* out) {
+  const InType* in = reinterpret_cast<const InType*>(inputs[0].data);
+  const uint8_t* valid = inputs[0].valid;
+  OutType* values = scratch->values<OutType>();
+  bool safe = true;
+  for (int64_t i = 0; i < length; ++i) {
+    const bool value_safe = CastIsSafe<InType, OutType>(in[i]);
+    values[i] = value_safe ? static_cast<OutType>(in[i]) : OutType(0);
+    safe &= value_safe | (valid != NULLPTR && !valid[i]);
+  }
+  if (!safe) {
+    return Status::Invalid(std::is_integral<InType>::value
+                               ? "Integer value out of bounds"
+                               : "Float value was truncated or out of bounds");
+  }
+  out->data = reinterpret_cast<const uint8_t*>(values);
+  out->valid = valid;
+  return Status::OK();
+}
+
+template <typename InType>
+Status CastToBoolean(const Node&, const ArrayData* const*, int64_t, int64_t length,
+                     const MorselValues* inputs, Scratch* scratch, MorselValues* out) {
+  const InType* in = reinterpret_cast<const InType*>(inputs[0].data);
+  uint8_t* values = scratch->values<uint8_t>();
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = in[i] != 0;
+  }
+  out->data = values;
+  out->valid = inputs[0].valid;
+  return Status::OK();
+}
+
+template <typename InType>
+NodeFunc GetCastFunc(Type::type out_id) {
+  switch (out_id) {
+#define CAST_CASE(ID, TYPE) \
+  case Type::ID:            \
+    return CastValues<InType, typename TYPE::c_type>;
+    NUMERIC_TYPES(CAST_CASE)
+#undef CAST_CASE
+    case Type::BOOL:
+      return CastToBoolean<InType>;
+    default:
+      return NULLPTR;
+  }
+}
+
+NodeFunc GetCastFunc(Type::type in_id, Type::type out_id) {
+  switch (in_id) {
+#define CAST_CASE(ID, TYPE) \
+  case Type::ID:            \
+    return GetCastFunc<typename TYPE::c_type>(out_id);
+    NUMERIC_TYPES(CAST_CASE)
+#undef CAST_CASE
+    case Type::BOOL:
+      // Booleans are bytes of 0 or 1, which any type represents
+      return GetCastFunc<uint8_t>(out_id);
+    default:
+      return NULLPTR;
+  }
+}
+
+// ----------------------------------------------------------------------
+// Comparisons and logical operations
+
+template <typename T, typename Op>
+void CompareLoop(const T* left, const T* right, int64_t length, uint8_t* out, Op op) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = op(left[i], right[i]);
+  }
+}
+
+template <typename T>
+Status CompareValues(const Node& node, const ArrayData* const*, int64_t, int64_t length,
+                     const MorselValues* inputs, Scratch* scratch, MorselValues* out) {
+  const T* left = reinterpret_cast<const T*>(inputs[0].data);
+  const T* right = reinterpret_cast<const T*>(inputs[1].data);
+  uint8_t* values = scratch->values<uint8_t>();
+  switch (node.compare_op) {
+    case EQUAL:
+      CompareLoop(left, right, length, values, std::equal_to<T>());
+      break;
+    case NOT_EQUAL:
+      CompareLoop(left, right, length, values, std::not_equal_to<T>());
+      break;
+    case GREATER:
+      CompareLoop(left, right, length, values, std::greater<T>());
+      break;
+    case GREATER_EQUAL:
+      CompareLoop(left, right, length, values, std::greater_equal<T>());
+      break;
+    case LESS:
+      CompareLoop(left, right, length, values, std::less<T>());
+      break;
+    case LESS_EQUAL:
+      CompareLoop(left, right, length, values, std::less_equal<T>());
+      break;
+  }
+  out->data = values;
+  out->valid = CombineValidity(inputs[0].valid, inputs[1].valid, length, scratch);
+  return Status::OK();
+}
+
+NodeFunc GetCompareFunc(Type::type id) {
+  switch (id) {
+#define COMPARE_CASE(ID, TYPE) \
+  case Type::ID:               \
+    return CompareValues<typename TYPE::c_type>;
+    NUMERIC_TYPES(COMPARE_CASE)
+#undef COMPARE_CASE
+    case Type::BOOL:
+      return CompareValues<uint8_t>;
+    default:
+      return NULLPTR;
+  }
+}
+
+template <typename Op>
+Status BinaryLogical(const Node&, const ArrayData* const*, int64_t, int64_t length,
+                     const MorselValues* inputs, Scratch* scratch, MorselValues* out) {
+  const uint8_t* left = inputs[0].data;
+  const uint8_t* right = inputs[1].data;
+  uint8_t* values = scratch->values<uint8_t>();
+  Op op;
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = op(left[i], right[i]);
+  }
+  out->data = values;
+  out->valid = CombineValidity(inputs[0].valid, inputs[1].valid, length, scratch);
+  return Status::OK();
+}
+
+Status NotLogical(const Node&, const ArrayData* const*, int64_t, int64_t length,
+                  const MorselValues* inputs, Scratch* scratch, MorselValues* out) {
+  const uint8_t* in = inputs[0].data;
+  uint8_t* values = scratch->values<uint8_t>();
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = in[i] ^ 1;
+  }
+  out->data = values;
+  out->valid = inputs[0].valid;
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Output
+
+// Pack length bytes of 0 or 1 into a bitmap starting at a byte boundary
+void PackBits(const uint8_t* bytes, int64_t length, uint8_t* out) {
+  const int64_t whole_bytes = length / 8;
+  for (int64_t i = 0; i < whole_bytes; ++i, bytes += 8) {
+    out[i] = static_cast<uint8_t>(bytes[0] | bytes[1] << 1 | bytes[2] << 2 |
+                                  bytes[3] << 3 | bytes[4] << 4 | bytes[5] << 5 |
+                                  bytes[6] << 6 | bytes[7] << 7);
+  }
+  if (length % 8 != 0) {
+    uint8_t last = 0;
+    for (int64_t j = 0; j < length % 8; ++j) {
+      last = static_cast<uint8_t>(last | bytes[j] << j);
+    }
+    out[whole_bytes] = last;
+  }
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// ExprExecutor
+
+class ExprExecutor::Impl {
+ public:
+  Impl(std::shared_ptr<Schema> schema, int64_t morsel_size)
+      : schema_(std::move(schema)), morsel_size_(morsel_size) {}
+
+  Status Compile(const ExprPtr& expr, int* out_index) {
+    const Operation* op = expr->op().get();
+    Node node;
+    if (auto field_ref = dynamic_cast<const ops::FieldRef*>(op)) {
+      RETURN_NOT_OK(CompileFieldRef(*field_ref, &node));
+    } else if (auto literal = dynamic_cast<const ops::Literal*>(op)) {
+      RETURN_NOT_OK(CompileLiteral(*literal, &node));
+    } else if (auto cast = dynamic_cast<const ops::Cast*>(op)) {
+      int input;
+      RETURN_NOT_OK(Compile(cast->value(), &input));
+      RETURN_NOT_OK(ToArrowType(*cast->out_type(), &node.type));
+      const Type::type in_id = nodes_[input].type->id();
+      if (in_id == node.type->id()) {
+        // Nothing to do
+        *out_index = input;
+        return Status::OK();
+      }
+      node.func = GetCastFunc(in_id, node.type->id());
+      if (node.func == NULLPTR) {
+        return Status::NotImplemented("Cast from ", nodes_[input].type->ToString(),
+                                      " to ", node.type->ToString());
+      }
+      node.inputs = {input};
+    } else if (auto compare = dynamic_cast<const ops::Compare*>(op)) {
+      int left, right;
+      RETURN_NOT_OK(Compile(compare->left(), &left));
+      RETURN_NOT_OK(Compile(compare->right(), &right));
+      const auto& left_type = nodes_[left].type;
+      if (!left_type->Equals(*nodes_[right].type)) {
+        return Status::TypeError("Cannot compare ", left_type->ToString(), " to ",
+                                 nodes_[right].type->ToString());
+      }
+      node.func = GetCompareFunc(left_type->id());
+      node.type = ::arrow::boolean();
+      node.inputs = {left, right};
+      node.compare_op = compare->op();
+    } else if (dynamic_cast<const ops::BooleanOperation*>(op) != NULLPTR) {
+      for (const auto& arg : op->input_args()) {
+        int input;
+        RETURN_NOT_OK(Compile(arg, &input));
+        node.inputs.push_back(input);
+      }
+      if (dynamic_cast<const ops::And*>(op) != NULLPTR) {
+        node.func = BinaryLogical<std::bit_and<uint8_t>>;
+      } else if (dynamic_cast<const ops::Or*>(op) != NULLPTR) {
+        node.func = BinaryLogical<std::bit_or<uint8_t>>;
+      } else if (dynamic_cast<const ops::Not*>(op) != NULLPTR) {
+        node.func = NotLogical;
+      } else {
+        return Status::NotImplemented("Evaluation of ", expr->kind(), " expression");
+      }
+      node.type = ::arrow::boolean();
+    } else {
+      return Status::NotImplemented("Evaluation of ", expr->kind(), " expression");
+    }
+    DCHECK_NE(node.func, NULLPTR);
+    nodes_.push_back(std::move(node));
+    *out_index = static_cast<int>(nodes_.size()) - 1;
+    return Status::OK();
+  }
+
+  void set_root(int root) { root_ = root; }
+
+  std::shared_ptr<DataType> type() const { return nodes_[root_].type; }
+
+  Status Evaluate(FunctionContext* ctx, const RecordBatch& batch,
+                  std::shared_ptr<Array>* out) const {
+    std::vector<const ArrayData*> columns(batch.num_columns());
+    for (const Node& node : nodes_) {
+      if (node.field_index < 0) {
+        continue;
+      }
+      if (node.field_index >= batch.num_columns() ||
+          !batch.column(node.field_index)->type()->Equals(*node.type)) {
+        return Status::Invalid("Batch does not match the schema of the expression: ",
+                               schema_->field(node.field_index)->ToString());
+      }
+      columns[node.field_index] = batch.column_data(node.field_index).get();
+    }
+
+    const auto& type = nodes_[root_].type;
+    const int64_t length = batch.num_rows();
+    std::shared_ptr<Buffer> values, validity;
+    const int64_t values_size = type->id() == Type::BOOL
+                                    ? BitUtil::BytesForBits(length)
+                                    : length * ValueWidth(*type);
+    RETURN_NOT_OK(ctx->Allocate(values_size, &values));
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &validity));
+
+    const int64_t num_morsels = BitUtil::CeilDiv(length, morsel_size_);
+    int num_tasks = 1;
+    if (ctx->use_threads() && num_morsels > 1) {
+      const int capacity = ctx->max_parallelism() > 0 ? ctx->max_parallelism()
+                                                      : GetCpuThreadPoolCapacity();
+      num_tasks = static_cast<int>(std::min<int64_t>(num_morsels, capacity));
+    }
+    // Tasks evaluate consecutive morsels, so their outputs start at byte
+    // boundaries of the bitmaps
+    std::vector<int64_t> null_counts(num_tasks, 0);
+    auto evaluate_task = [&](int task) {
+      const int64_t begin = num_morsels * task / num_tasks * morsel_size_;
+      const int64_t end =
+          std::min(length, num_morsels * (task + 1) / num_tasks * morsel_size_);
+      return EvaluateRange(columns.data(), begin, end, values->mutable_data(),
+                           validity->mutable_data(), &null_counts[task]);
+    };
+    if (num_tasks > 1) {
+      RETURN_NOT_OK(internal::ParallelFor(num_tasks, evaluate_task));
+    } else {
+      RETURN_NOT_OK(evaluate_task(0));
+    }
+
+    int64_t null_count = 0;
+    for (int64_t task_null_count : null_counts) {
+      null_count += task_null_count;
+    }
+    if (null_count == 0) {
+      validity = NULLPTR;
+    }
+    *out = MakeArray(ArrayData::Make(type, length, {validity, values}, null_count));
+    return Status::OK();
+  }
+
+ private:
+  Status CompileFieldRef(const ops::FieldRef& field_ref, Node* node) {
+    node->field_index = schema_->GetFieldIndex(field_ref.name());
+    if (node->field_index < 0) {
+      return Status::KeyError("No field named '", field_ref.name(), "' in the schema");
+    }
+    std::shared_ptr<DataType> expected;
+    RETURN_NOT_OK(ToArrowType(*field_ref.type(), &expected));
+    node->type = schema_->field(node->field_index)->type();
+    if (!node->type->Equals(*expected)) {
+      return Status::TypeError("Field '", field_ref.name(), "' is of type ",
+                               node->type->ToString(), " rather than ",
+                               expected->ToString());
+    }
+    switch (expected->id()) {
+#define FIELD_CASE(ID, TYPE)                       \
+  case Type::ID:                                   \
+    node->func = ReadField<typename TYPE::c_type>; \
+    break;
+      NUMERIC_TYPES(FIELD_CASE)
+#undef FIELD_CASE
+      default:
+        node->func = ReadBooleanField;
+        break;
+    }
+    return Status::OK();
+  }
+
+  Status CompileLiteral(const ops::Literal& literal, Node* node) {
+    const Scalar& scalar = *literal.value();
+    LogicalTypePtr logical_type;
+    RETURN_NOT_OK(LogicalType::FromArrow(*scalar.type, &logical_type));
+    RETURN_NOT_OK(ToArrowType(*logical_type, &node->type));
+    switch (node->type->id()) {
+#define LITERAL_CASE(ID, TYPE)                                              \
+  case Type::ID:                                                            \
+    FillLiteral(checked_cast<const NumericScalar<TYPE>&>(scalar).value,     \
+                morsel_size_, node);                                        \
+    break;
+      NUMERIC_TYPES(LITERAL_CASE)
+#undef LITERAL_CASE
+      default:
+        FillLiteral<uint8_t>(checked_cast<const BooleanScalar&>(scalar).value,
+                             morsel_size_, node);
+        break;
+    }
+    if (!scalar.is_valid) {
+      node->literal_valid.assign(morsel_size_, 0);
+    }
+    node->func = ReadLiteral;
+    return Status::OK();
+  }
+
+  Status EvaluateRange(const ArrayData* const* columns, int64_t begin, int64_t end,
+                       uint8_t* out_values, uint8_t* out_validity,
+                       int64_t* null_count) const {
+    std::vector<Scratch> scratch(nodes_.size());
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+      scratch[i].data.resize(BitUtil::CeilDiv(
+          morsel_size_ * ValueWidth(*nodes_[i].type), sizeof(uint64_t)));
+      scratch[i].valid.resize(morsel_size_);
+    }
+    std::vector<MorselValues> values(nodes_.size());
+
+    const Node& root = nodes_[root_];
+    const bool is_boolean = root.type->id() == Type::BOOL;
+    const int width = ValueWidth(*root.type);
+    for (int64_t offset = begin; offset < end; offset += morsel_size_) {
+      const int64_t length = std::min(morsel_size_, end - offset);
+      for (size_t i = 0; i <= static_cast<size_t>(root_); ++i) {
+        const Node& node = nodes_[i];
+        MorselValues inputs[2];
+        for (size_t j = 0; j < node.inputs.size(); ++j) {
+          inputs[j] = values[node.inputs[j]];
+        }
+        RETURN_NOT_OK(
+            node.func(node, columns, offset, length, inputs, &scratch[i], &values[i]));
+      }
+
+      const MorselValues& result = values[root_];
+      if (is_boolean) {
+        PackBits(result.data, length, out_values + offset / 8);
+      } else {
+        std::memcpy(out_values + offset * width, result.data, length * width);
+      }
+      if (result.valid == NULLPTR) {
+        std::memset(out_validity + offset / 8, 0xFF, BitUtil::BytesForBits(length));
+      } else {
+        PackBits(result.valid, length, out_validity + offset / 8);
+        *null_count += length - std::count(result.valid, result.valid + length, 1);
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  const int64_t morsel_size_;
+  // The nodes in evaluation order, inputs first
+  std::vector<Node> nodes_;
+  int root_ = -1;
+};
+
+ExprExecutor::ExprExecutor(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+ExprExecutor::~ExprExecutor() {}
+
+Status ExprExecutor::Make(const std::shared_ptr<Schema>& schema, const ExprPtr& expr,
+                          int64_t morsel_size, std::unique_ptr<ExprExecutor>* out) {
+  if (morsel_size <= 0) {
+    return Status::Invalid("Morsel size must be positive");
+  }
+  morsel_size = BitUtil::RoundUpToMultipleOf64(morsel_size);
+  std::unique_ptr<Impl> impl(new Impl(schema, morsel_size));
+  int root;
+  RETURN_NOT_OK(impl->Compile(expr, &root));
+  impl->set_root(root);
+  out->reset(new ExprExecutor(std::move(impl)));
+  return Status::OK();
+}
+
+std::shared_ptr<DataType> ExprExecutor::type() const { return impl_->type(); }
+
+Status ExprExecutor::Evaluate(FunctionContext* ctx, const RecordBatch& batch,
+                              std::shared_ptr<Array>* out) const {
+  return impl_->Evaluate(ctx, batch, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/compute/type_fwd.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Evaluates an expression tree over record batches
+///
+/// The expression is compiled once against a schema: field references are
+/// resolved to columns and every node is bound to a loop specialized for its
+/// types.  The supported nodes are ops::FieldRef, ops::Literal, ops::Cast,
+/// ops::Compare and the logical ops::And, ops::Or and ops::Not, over boolean
+/// and numeric values other than float16.
+///
+/// A batch is evaluated in morsels of morsel_size rows.  Each node writes the
+/// values of a morsel to a scratch buffer which is reused for the next morsel,
+/// so that intermediate results stay in cache and are never materialized for
+/// the whole batch.  Numeric columns are read in place.  Casts follow the
+/// default (safe) CastOptions: integer overflow and float truncation are
+/// errors.  Logical operations are null where any input is, as with the And
+/// and Or kernels.
+class ARROW_EXPORT ExprExecutor {
+ public:
+  static constexpr int64_t kDefaultMorselSize = 4096;
+
+  ~ExprExecutor();
+
+  /// \brief Compile an expression over the fields of a schema
+  ///
+  /// \param[in] schema the schema of the batches to evaluate
+  /// \param[in] expr the value expression to evaluate
+  /// \param[in] morsel_size the number of rows evaluated at a time, rounded
+  /// up to a multiple of 64
+  /// \param[out] out the executor
+  /// \return Status
+  static Status Make(const std::shared_ptr<Schema>& schema, const ExprPtr& expr,
+                     int64_t morsel_size, std::unique_ptr<ExprExecutor>* out);
+
+  static Status Make(const std::shared_ptr<Schema>& schema, const ExprPtr& expr,
+                     std::unique_ptr<ExprExecutor>* out) {
+    return Make(schema, expr, kDefaultMorselSize, out);
+  }
+
+  /// \brief The type of the evaluated arrays
+  std::shared_ptr<DataType> type() const;
+
+  /// \brief Evaluate the expression over a batch of the compiled schema
+  ///
+  /// If the context uses threads, ranges of morsels are evaluated in parallel
+  /// on the CPU thread pool, each with scratch buffers of its own.  Scalar
+  /// expressions are broadcast to the length of the batch.
+  ///
+  /// \param[in] ctx the FunctionContext, also providing the output memory
+  /// \param[in] batch the batch to evaluate the expression over
+  /// \param[out] out the array of batch.num_rows() values
+  /// \return Status
+  Status Evaluate(FunctionContext* ctx, const RecordBatch& batch,
+                  std::shared_ptr<Array>* out) const;
+
+ private:
+  class Impl;
+  explicit ExprExecutor(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ExprExecutor);
+};
+
+}  // namespace compute
+}  // namespace arrow
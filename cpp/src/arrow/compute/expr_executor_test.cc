@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/expr_executor.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/boolean.h"
+#include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/compare.h"
+#include "arrow/compute/operations/field_ref.h"
+#include "arrow/compute/operations/literal.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+void ToExpr(const std::shared_ptr<Operation>& op, ExprPtr* out) {
+  ASSERT_OK(op->ToExpr(out));
+}
+
+class TestExprExecutor : public ComputeFixture, public TestBase {
+ public:
+  ExprPtr Field(const std::string& name, LogicalTypePtr type) {
+    ExprPtr out;
+    ToExpr(std::make_shared<ops::FieldRef>(name, type), &out);
+    return out;
+  }
+
+  ExprPtr Literal(std::shared_ptr<Scalar> value) {
+    ExprPtr out;
+    ToExpr(std::make_shared<ops::Literal>(value), &out);
+    return out;
+  }
+
+  ExprPtr Cast(ExprPtr value, LogicalTypePtr type) {
+    ExprPtr out;
+    ToExpr(std::make_shared<ops::Cast>(value, type), &out);
+    return out;
+  }
+
+  ExprPtr Compare(ExprPtr left, ExprPtr right, CompareOperator op) {
+    ExprPtr out;
+    ToExpr(std::make_shared<ops::Compare>(left, right, op), &out);
+    return out;
+  }
+
+  ExprPtr And(ExprPtr left, ExprPtr right) {
+    ExprPtr out;
+    ToExpr(std::make_shared<ops::And>(left, right), &out);
+    return out;
+  }
+
+  ExprPtr Not(ExprPtr value) {
+    ExprPtr out;
+    ToExpr(std::make_shared<ops::Not>(value), &out);
+    return out;
+  }
+
+  void AssertEvaluate(const ExprPtr& expr, const RecordBatch& batch,
+                      const Array& expected, int64_t morsel_size) {
+    std::unique_ptr<ExprExecutor> executor;
+    ASSERT_OK(ExprExecutor::Make(batch.schema(), expr, morsel_size, &executor));
+    ASSERT_TRUE(executor->type()->Equals(*expected.type()));
+    // Several tasks even on a small machine
+    ctx_.set_max_parallelism(4);
+    for (bool use_threads : {false, true}) {
+      ctx_.set_use_threads(use_threads);
+      std::shared_ptr<Array> out;
+      ASSERT_OK(executor->Evaluate(&ctx_, batch, &out));
+      ASSERT_OK(out->Validate());
+      AssertArraysEqual(expected, *out);
+    }
+  }
+};
+
+TEST_F(TestExprExecutor, FusedPredicate) {
+  // (a > 2) and not (cast(b, int64) == 5), over several morsels and a partial one
+  const int64_t length = 1000;
+  random::RandomArrayGenerator rand(0x5EED);
+  auto a = rand.Int32(length, 0, 5, 0.1);
+  auto b = rand.Int16(length, 0, 10, 0.1);
+  auto batch = RecordBatch::Make(schema({field("a", int32()), field("b", int16())}),
+                                 length, {a, b});
+  auto expr =
+      And(Compare(Field("a", type::int32()),
+                  Literal(std::make_shared<Int32Scalar>(2)), GREATER),
+          Not(Compare(Cast(Field("b", type::int16()), type::int64()),
+                      Literal(std::make_shared<Int64Scalar>(5)), EQUAL)));
+
+  const auto& a_values = checked_cast<const Int32Array&>(*a);
+  const auto& b_values = checked_cast<const Int16Array&>(*b);
+  BooleanBuilder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    if (a_values.IsNull(i) || b_values.IsNull(i)) {
+      ASSERT_OK(builder.AppendNull());
+    } else {
+      ASSERT_OK(builder.Append(a_values.Value(i) > 2 && b_values.Value(i) != 5));
+    }
+  }
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(builder.Finish(&expected));
+
+  AssertEvaluate(expr, *batch, *expected, 64);
+  AssertEvaluate(expr, *batch, *expected, ExprExecutor::kDefaultMorselSize);
+  // Sliced columns
+  AssertEvaluate(expr, *batch->Slice(3), *expected->Slice(3), 64);
+}
+
+TEST_F(TestExprExecutor, NumericResult) {
+  auto a = ArrayFromJSON(int32(), "[1, -2, null, 4, 5]");
+  auto b = ArrayFromJSON(boolean(), "[true, false, true, null, false]");
+  auto batch = RecordBatch::Make(schema({field("a", int32()), field("b", boolean())}),
+                                 5, {a, b});
+  AssertEvaluate(Cast(Field("a", type::int32()), type::float64()), *batch,
+                 *ArrayFromJSON(float64(), "[1, -2, null, 4, 5]"), 64);
+  AssertEvaluate(Cast(Field("b", type::boolean()), type::uint8()), *batch,
+                 *ArrayFromJSON(uint8(), "[1, 0, 1, null, 0]"), 64);
+  AssertEvaluate(Cast(Field("a", type::int32()), type::boolean()), *batch,
+                 *ArrayFromJSON(boolean(), "[true, true, null, true, true]"), 64);
+  // A scalar expression is broadcast
+  AssertEvaluate(Cast(Literal(std::make_shared<Int8Scalar>(7)), type::int16()), *batch,
+                 *ArrayFromJSON(int16(), "[7, 7, 7, 7, 7]"), 64);
+  AssertEvaluate(
+      Compare(Field("a", type::int32()),
+              Literal(std::make_shared<Int32Scalar>(0, /*is_valid=*/false)), LESS),
+      *batch, *ArrayFromJSON(boolean(), "[null, null, null, null, null]"), 64);
+}
+
+TEST_F(TestExprExecutor, CheckedCasts) {
+  auto schm = schema({field("a", int64()), field("f", float64())});
+  auto batch = RecordBatch::Make(schm, 3,
+                                 {ArrayFromJSON(int64(), "[1, 300, -1]"),
+                                  ArrayFromJSON(float64(), "[1.0, 1.5, 1e10]")});
+  std::unique_ptr<ExprExecutor> executor;
+  std::shared_ptr<Array> out;
+
+  ASSERT_OK(ExprExecutor::Make(schm, Cast(Field("a", type::int64()), type::int8()),
+                               &executor));
+  ASSERT_RAISES(Invalid, executor->Evaluate(&ctx_, *batch, &out));
+  ASSERT_OK(ExprExecutor::Make(schm, Cast(Field("a", type::int64()), type::uint32()),
+                               &executor));
+  ASSERT_RAISES(Invalid, executor->Evaluate(&ctx_, *batch, &out));
+  ASSERT_OK(ExprExecutor::Make(schm, Cast(Field("f", type::float64()), type::int64()),
+                               &executor));
+  ASSERT_RAISES(Invalid, executor->Evaluate(&ctx_, *batch, &out));
+  ASSERT_OK(ExprExecutor::Make(schm, Cast(Field("f", type::float64()), type::int32()),
+                               &executor));
+  ASSERT_RAISES(Invalid, executor->Evaluate(&ctx_, *batch->Slice(2), &out));
+
+  // Null slots are not checked
+  std::vector<int64_t> values = {1, 300, -1};
+  auto valid = ArrayFromJSON(boolean(), "[true, false, true]");
+  auto masked_array = std::make_shared<Int64Array>(3, Buffer::Wrap(values),
+                                                   valid->data()->buffers[1], 1);
+  auto masked = RecordBatch::Make(schema({field("a", int64())}), 3, {masked_array});
+  AssertEvaluate(Cast(Field("a", type::int64()), type::int8()), *masked,
+                 *ArrayFromJSON(int8(), "[1, null, -1]"), 64);
+}
+
+TEST_F(TestExprExecutor, CompileErrors) {
+  auto schm = schema({field("a", int32()), field("s", utf8())});
+  std::unique_ptr<ExprExecutor> executor;
+  ASSERT_RAISES(KeyError,
+                ExprExecutor::Make(schm, Field("missing", type::int32()), &executor));
+  ASSERT_RAISES(TypeError,
+                ExprExecutor::Make(schm, Field("a", type::int64()), &executor));
+  ASSERT_RAISES(NotImplemented,
+                ExprExecutor::Make(schm, Field("s", type::utf8()), &executor));
+  ASSERT_RAISES(Invalid,
+                ExprExecutor::Make(schm, Field("a", type::int32()), 0, &executor));
+
+  ASSERT_OK(ExprExecutor::Make(schm, Field("a", type::int32()), &executor));
+  auto other = RecordBatch::Make(schema({field("a", int64())}), 1,
+                                 {ArrayFromJSON(int64(), "[1]")});
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, executor->Evaluate(&ctx_, *other, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -16,9 +16,13 @@
 // under the License.
 
 #include <utility>
+#include <vector>
 
+#include "arrow/array.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/table.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace compute {
@@ -49,14 +53,66 @@ class ManagedAggregateState {
   std::shared_ptr<Buffer> state_;
 };
 
+namespace {
+
+// The number of values consumed by each task of a parallel aggregation
+constexpr int64_t kParallelAggregateTaskSize = 1 << 16;
+
+}  // namespace
+
 Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
-  if (!input.is_array()) return Status::Invalid("AggregateKernel expects Array datum");
+  if (!input.is_arraylike()) {
+    return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
+  }
 
   auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
   if (!state) return Status::OutOfMemory("AggregateState allocation failed");
 
-  auto array = input.make_array();
-  RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
+  // Split the input into the parts consumed into states of their own, which
+  // are then merged in order.  Large arrays are split into slices consumed in
+  // parallel if the context uses threads.
+  std::vector<std::shared_ptr<Array>> parts;
+  auto add_part = [&](const std::shared_ptr<Array>& array) {
+    const int64_t length = array->length();
+    if (ctx->use_threads() && length >= 2 * kParallelAggregateTaskSize) {
+      for (int64_t offset = 0; offset < length; offset += kParallelAggregateTaskSize) {
+        parts.push_back(array->Slice(offset, kParallelAggregateTaskSize));
+      }
+    } else {
+      parts.push_back(array);
+    }
+  };
+  if (input.is_array()) {
+    add_part(input.make_array());
+  } else {
+    for (const auto& chunk : input.chunked_array()->chunks()) {
+      add_part(chunk);
+    }
+  }
+
+  if (parts.size() == 1) {
+    RETURN_NOT_OK(aggregate_function_->Consume(*parts[0], state->mutable_data()));
+  } else if (parts.size() > 1) {
+    const int num_parts = static_cast<int>(parts.size());
+    std::vector<std::shared_ptr<ManagedAggregateState>> part_states(num_parts);
+    auto consume_part = [&](int i) -> Status {
+      part_states[i] =
+          ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+      if (!part_states[i]) return Status::OutOfMemory("AggregateState allocation failed");
+      return aggregate_function_->Consume(*parts[i], part_states[i]->mutable_data());
+    };
+    if (ctx->use_threads()) {
+      RETURN_NOT_OK(internal::ParallelFor(num_parts, consume_part));
+    } else {
+      for (int i = 0; i < num_parts; ++i) {
+        RETURN_NOT_OK(consume_part(i));
+      }
+    }
+    for (const auto& part_state : part_states) {
+      RETURN_NOT_OK(
+          aggregate_function_->Merge(part_state->mutable_data(), state->mutable_data()));
+    }
+  }
   RETURN_NOT_OK(aggregate_function_->Finalize(state->mutable_data(), out));
 
   return Status::OK();
@@ -23,11 +23,15 @@
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/quantile.h"
 #include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/variance.h"
 #include "arrow/memory_pool.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/decimal.h"
 
 namespace arrow {
 namespace compute {
@@ -328,5 +332,105 @@ static void SumKernel(benchmark::State& state) {
 
 BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
 
+template <int32_t kPrecision>
+static void DecimalSumKernel(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / 16;
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto ints = std::static_pointer_cast<NumericArray<Int64Type>>(
+      rand.Int64(array_size, -100000, 100000, null_percent));
+  Decimal128Builder builder(decimal(kPrecision, 2));
+  for (int64_t i = 0; i < array_size; ++i) {
+    if (ints->IsNull(i)) {
+      ABORT_NOT_OK(builder.AppendNull());
+    } else {
+      ABORT_NOT_OK(builder.Append(Decimal128(ints->Value(i))));
+    }
+  }
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(builder.Finish(&array));
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Sum(&ctx, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * 16);
+}
+
+// Values fitting in an int64 are summed with 64-bit arithmetic
+BENCHMARK_TEMPLATE(DecimalSumKernel, 18)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(DecimalSumKernel, 38)->Apply(RegressionSetArgs);
+
+template <typename ArrowType>
+static void MinMaxKernel(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  const int64_t array_size = state.range(0) / sizeof(CType);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Numeric<ArrowType>(array_size, -100, 100, null_percent);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(MinMax(&ctx, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType));
+}
+
+BENCHMARK_TEMPLATE(MinMaxKernel, Int32Type)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(MinMaxKernel, Int64Type)->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(MinMaxKernel, DoubleType)->Apply(RegressionSetArgs);
+
+static void VarianceKernel(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(double);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Float64(array_size, -100, 100, null_percent);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Variance(&ctx, VarianceOptions(), Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(double));
+}
+
+BENCHMARK(VarianceKernel)->Apply(RegressionSetArgs);
+
+static void QuantileKernel(benchmark::State& state) {
+  const int64_t array_size = state.range(0) / sizeof(double);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(1923);
+  auto array = rand.Float64(array_size, -100, 100, null_percent);
+
+  FunctionContext ctx;
+  const QuantileOptions options({0.01, 0.5, 0.99});
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(ApproximateQuantile(&ctx, options, Datum(array), &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(state.range(0));
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(double));
+}
+
+BENCHMARK(QuantileKernel)->Apply(RegressionSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
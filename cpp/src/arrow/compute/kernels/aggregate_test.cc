@@ -16,6 +16,8 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -23,12 +25,17 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/quantile.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/variance.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
@@ -38,6 +45,9 @@
 #include "arrow/testing/random.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 ///
@@ -55,17 +65,14 @@ static SumResult<ArrowType> NaiveSumPartial(const Array& array) {
 
   ResultType result;
 
-  auto data = array.data();
-  internal::BitmapReader reader(array.null_bitmap_data(), array.offset(), array.length());
   const auto& array_numeric = reinterpret_cast<const ArrayType&>(array);
   const auto values = array_numeric.raw_values();
   for (int64_t i = 0; i < array.length(); i++) {
-    if (reader.IsSet()) {
+    // Arrays without nulls may not have a validity bitmap
+    if (array.IsValid(i)) {
       result.first += values[i];
       result.second++;
     }
-
-    reader.Next();
   }
 
   return result;
@@ -125,6 +132,37 @@ TYPED_TEST(TestNumericSumKernel, SimpleSum) {
                          Datum(std::make_shared<ScalarType>(expected_result)));
 }
 
+TYPED_TEST(TestNumericSumKernel, SelectionSum) {
+  using SumType = typename FindAccumulatorType<TypeParam>::Type;
+  using ScalarType = typename TypeTraits<SumType>::ScalarType;
+  using T = typename TypeParam::c_type;
+
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto array = ArrayFromJSON(type, "[1, null, 3, 4, null, 6, 7]");
+  auto AssertSum = [&](const Array& values, const std::string& selection,
+                       std::shared_ptr<Scalar> expected) {
+    Datum result;
+    ASSERT_OK(Sum(&this->ctx_, values, *ArrayFromJSON(int32(), selection), &result));
+    DatumEqual<SumType>::EnsureEqual(result, Datum(expected));
+  };
+
+  AssertSum(*array, "[]", std::make_shared<ScalarType>(0, false));
+  AssertSum(*array, "[1, null, 4]", std::make_shared<ScalarType>(0, false));
+  AssertSum(*array, "[0, 2, 3, 6]", std::make_shared<ScalarType>(static_cast<T>(15)));
+  AssertSum(*array, "[6, 6, null, 1, 0]",
+            std::make_shared<ScalarType>(static_cast<T>(15)));
+  AssertSum(*array->Slice(2), "[0, 3, 4]",
+            std::make_shared<ScalarType>(static_cast<T>(16)));
+
+  Datum result;
+  ASSERT_RAISES(IndexError,
+                Sum(&this->ctx_, *array, *ArrayFromJSON(int32(), "[0, 7]"), &result));
+  ASSERT_RAISES(IndexError,
+                Sum(&this->ctx_, *array, *ArrayFromJSON(int8(), "[-1]"), &result));
+  ASSERT_RAISES(TypeError,
+                Sum(&this->ctx_, *array, *ArrayFromJSON(float32(), "[0]"), &result));
+}
+
 template <typename ArrowType>
 class TestRandomNumericSumKernel : public ComputeFixture, public TestBase {};
 
@@ -308,5 +346,340 @@ TYPED_TEST(TestRandomNumericCountKernel, RandomArrayCount) {
   }
 }
 
+///
+/// MinMax
+///
+
+template <typename ArrowType>
+static Datum NaiveMinMax(const Array& array) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  const auto& array_numeric = checked_cast<const ArrayType&>(array);
+  CType min = std::numeric_limits<CType>::max();
+  CType max = std::numeric_limits<CType>::lowest();
+  bool has_values = false;
+  for (int64_t i = 0; i < array.length(); i++) {
+    if (array.IsValid(i)) {
+      min = std::min(min, array_numeric.Value(i));
+      max = std::max(max, array_numeric.Value(i));
+      has_values = true;
+    }
+  }
+  if (!has_values) {
+    min = max = 0;
+  }
+  std::vector<Datum> extrema = {Datum(std::make_shared<ScalarType>(min, has_values)),
+                                Datum(std::make_shared<ScalarType>(max, has_values))};
+  return Datum(extrema);
+}
+
+template <typename ArrowType>
+void ValidateMinMax(FunctionContext* ctx, const Datum& input, const Datum& expected) {
+  Datum result;
+  ASSERT_OK(MinMax(ctx, input, &result));
+  ASSERT_EQ(result.kind(), Datum::COLLECTION);
+  ASSERT_EQ(result.collection().size(), 2);
+  for (size_t i = 0; i < 2; i++) {
+    DatumEqual<ArrowType>::EnsureEqual(result.collection()[i],
+                                       expected.collection()[i]);
+  }
+}
+
+template <typename ArrowType>
+void ValidateMinMax(FunctionContext* ctx, const Array& array) {
+  ValidateMinMax<ArrowType>(ctx, array.data(), NaiveMinMax<ArrowType>(array));
+}
+
+template <typename ArrowType>
+void ValidateMinMax(FunctionContext* ctx, const char* json) {
+  auto array = ArrayFromJSON(TypeTraits<ArrowType>::type_singleton(), json);
+  ValidateMinMax<ArrowType>(ctx, *array);
+}
+
+template <typename ArrowType>
+class TestMinMaxKernel : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestMinMaxKernel, NumericArrowTypes);
+TYPED_TEST(TestMinMaxKernel, SimpleMinMax) {
+  ValidateMinMax<TypeParam>(&this->ctx_, "[]");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[null, null]");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[5, null, 1, 9]");
+  ValidateMinMax<TypeParam>(&this->ctx_, "[3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9]");
+}
+
+TYPED_TEST(TestMinMaxKernel, RandomArrayMinMax) {
+  auto rand = random::RandomArrayGenerator(0x3d8f412);
+  for (size_t i = 3; i < 14; i++) {
+    for (auto null_probability : {0.0, 0.01, 0.1, 0.25, 0.5, 1.0}) {
+      for (auto length_adjust : {-2, -1, 0, 1, 2}) {
+        int64_t length = (1UL << i) + length_adjust;
+        auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+        ValidateMinMax<TypeParam>(&this->ctx_, *array);
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestMinMaxKernel, RandomSliceArrayMinMax) {
+  auto rand = random::RandomArrayGenerator(0x7e11a5);
+  const int64_t length = 1U << 6;
+  auto array = rand.Numeric<TypeParam>(length, 0, 100, 0.5);
+  for (size_t i = 1; i < 16; i++) {
+    for (size_t j = 1; j < 16; j++) {
+      ValidateMinMax<TypeParam>(&this->ctx_, *array->Slice(i, length - i - j));
+    }
+  }
+}
+
+TYPED_TEST(TestMinMaxKernel, ChunkedArrayMinMax) {
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(type, "[4, null, 7]"), ArrayFromJSON(type, "[null, null]"),
+      ArrayFromJSON(type, "[2, 9, 3]")});
+  auto concatenated = ArrayFromJSON(type, "[4, null, 7, null, null, 2, 9, 3]");
+  ValidateMinMax<TypeParam>(&this->ctx_, chunked, NaiveMinMax<TypeParam>(*concatenated));
+
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, type);
+  ValidateMinMax<TypeParam>(&this->ctx_, empty,
+                            NaiveMinMax<TypeParam>(*ArrayFromJSON(type, "[]")));
+}
+
+TYPED_TEST(TestMinMaxKernel, ParallelMinMax) {
+  auto rand = random::RandomArrayGenerator(0x51a0b7);
+  auto array = rand.Numeric<TypeParam>((1 << 18) + 3, 0, 100, 0.1);
+  this->ctx_.set_use_threads(true);
+  ValidateMinMax<TypeParam>(&this->ctx_, *array);
+}
+
+TEST(TestMinMaxKernel, IgnoresNaN) {
+  FunctionContext ctx;
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  DoubleBuilder builder;
+  ASSERT_OK(builder.AppendValues({nan, 1.5, nan, -2.0, nan, nan, nan, nan, nan}));
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+
+  Datum result;
+  ASSERT_OK(MinMax(&ctx, *array, &result));
+  AssertDatumsEqual(result.collection()[0], Datum(-2.0));
+  AssertDatumsEqual(result.collection()[1], Datum(1.5));
+
+  ASSERT_OK(MinMax(&ctx, *array->Slice(4), &result));
+  const auto& min = checked_cast<const DoubleScalar&>(*result.collection()[0].scalar());
+  ASSERT_TRUE(min.is_valid);
+  ASSERT_TRUE(std::isnan(min.value));
+}
+
+///
+/// Variance
+///
+
+// The two-pass variance, in long double
+template <typename ArrowType>
+static double NaiveVariance(const Array& array, int ddof) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  const auto& array_numeric = checked_cast<const ArrayType&>(array);
+  long double sum = 0;
+  int64_t count = 0;
+  for (int64_t i = 0; i < array.length(); i++) {
+    if (array.IsValid(i)) {
+      sum += static_cast<long double>(array_numeric.Value(i));
+      count++;
+    }
+  }
+  const long double mean = sum / count;
+  long double m2 = 0;
+  for (int64_t i = 0; i < array.length(); i++) {
+    if (array.IsValid(i)) {
+      const long double deviation = array_numeric.Value(i) - mean;
+      m2 += deviation * deviation;
+    }
+  }
+  return static_cast<double>(m2 / (count - ddof));
+}
+
+static void AssertVarianceNear(const Datum& result, bool is_valid, double expected) {
+  ASSERT_EQ(result.kind(), Datum::SCALAR);
+  const auto& scalar = checked_cast<const DoubleScalar&>(*result.scalar());
+  ASSERT_EQ(scalar.is_valid, is_valid);
+  if (is_valid) {
+    ASSERT_NEAR(scalar.value, expected, 1e-9 * std::max(1.0, std::abs(expected)));
+  }
+}
+
+template <typename ArrowType>
+class TestVarianceKernel : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestVarianceKernel, NumericArrowTypes);
+TYPED_TEST(TestVarianceKernel, SimpleVariance) {
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  Datum result;
+
+  auto array = ArrayFromJSON(type, "[1, null, 2, 3, 4]");
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(), array, &result));
+  AssertVarianceNear(result, true, 1.25);
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), array, &result));
+  AssertVarianceNear(result, true, 5.0 / 3);
+  ASSERT_OK(StandardDeviation(&this->ctx_, VarianceOptions(), array, &result));
+  AssertVarianceNear(result, true, std::sqrt(1.25));
+
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(), ArrayFromJSON(type, "[]"), &result));
+  AssertVarianceNear(result, false, 0);
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), ArrayFromJSON(type, "[null, 5]"),
+                     &result));
+  AssertVarianceNear(result, false, 0);
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(0), ArrayFromJSON(type, "[null, 5]"),
+                     &result));
+  AssertVarianceNear(result, true, 0);
+
+  ASSERT_RAISES(Invalid, Variance(&this->ctx_, VarianceOptions(-1), array, &result));
+}
+
+TYPED_TEST(TestVarianceKernel, RandomArrayVariance) {
+  auto rand = random::RandomArrayGenerator(0x2c81f0a);
+  Datum result;
+  for (size_t i = 3; i < 14; i++) {
+    for (auto null_probability : {0.0, 0.1, 0.5}) {
+      for (auto length_adjust : {-1, 0, 1}) {
+        int64_t length = (1UL << i) + length_adjust;
+        auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+        auto slice = array->Slice(3, length - 5);
+        for (const auto& input : {array, slice}) {
+          const bool is_valid = input->length() - input->null_count() > 1;
+          ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), input, &result));
+          AssertVarianceNear(result, is_valid, NaiveVariance<TypeParam>(*input, 1));
+        }
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestVarianceKernel, ChunkedAndParallelVariance) {
+  auto rand = random::RandomArrayGenerator(0x90d1c3);
+  auto array = rand.Numeric<TypeParam>((1 << 18) + 5, 0, 100, 0.1);
+  const double expected = NaiveVariance<TypeParam>(*array, 1);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      array->Slice(0, 1000), array->Slice(1000, 0), array->Slice(1000)});
+
+  Datum result;
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), chunked, &result));
+  AssertVarianceNear(result, true, expected);
+  this->ctx_.set_use_threads(true);
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), array, &result));
+  AssertVarianceNear(result, true, expected);
+  ASSERT_OK(Variance(&this->ctx_, VarianceOptions(1), chunked, &result));
+  AssertVarianceNear(result, true, expected);
+}
+
+TEST(TestVarianceKernel, LargeMean) {
+  // The naive sum of squares loses all the digits of such values
+  FunctionContext ctx;
+  auto array = ArrayFromJSON(
+      float64(), "[1000000004, 1000000007, 1000000013, 1000000016, 1000000010]");
+  Datum result;
+  ASSERT_OK(Variance(&ctx, VarianceOptions(1), array, &result));
+  AssertVarianceNear(result, true, 22.5);
+}
+
+///
+/// Quantile
+///
+
+static std::vector<double> QuantileValues(const Datum& result) {
+  std::vector<double> values;
+  const auto& array = checked_cast<const DoubleArray&>(*result.make_array());
+  for (int64_t i = 0; i < array.length(); i++) {
+    values.push_back(array.Value(i));
+  }
+  return values;
+}
+
+// The fraction of the non-null values of array below value
+static double Rank(const DoubleArray& array, double value) {
+  int64_t below = 0;
+  for (int64_t i = 0; i < array.length(); i++) {
+    below += array.IsValid(i) && array.Value(i) < value;
+  }
+  return static_cast<double>(below) / (array.length() - array.null_count());
+}
+
+class TestQuantileKernel : public ComputeFixture, public TestBase {};
+
+TEST_F(TestQuantileKernel, Basics) {
+  Datum result;
+  QuantileOptions options({0, 0.5, 1});
+
+  ASSERT_OK(ApproximateQuantile(&ctx_, options, ArrayFromJSON(int32(), "[null]"),
+                                &result));
+  AssertArraysEqual(*result.make_array(),
+                    *ArrayFromJSON(float64(), "[null, null, null]"));
+
+  ASSERT_OK(ApproximateQuantile(&ctx_, options, ArrayFromJSON(int32(), "[7, null]"),
+                                &result));
+  AssertArraysEqual(*result.make_array(), *ArrayFromJSON(float64(), "[7, 7, 7]"));
+
+  ASSERT_OK(ApproximateQuantile(
+      &ctx_, options, ArrayFromJSON(int16(), "[5, 1, null, 3, 2, 4]"), &result));
+  AssertArraysEqual(*result.make_array(), *ArrayFromJSON(float64(), "[1, 3, 5]"));
+
+  auto array = ArrayFromJSON(float64(), "[1, 2]");
+  ASSERT_RAISES(Invalid, ApproximateQuantile(&ctx_, QuantileOptions({1.5}), array,
+                                             &result));
+  ASSERT_RAISES(Invalid, ApproximateQuantile(&ctx_, QuantileOptions({0.5}, 0), array,
+                                             &result));
+  ASSERT_RAISES(Invalid, ApproximateQuantile(&ctx_, QuantileOptions(),
+                                             ArrayFromJSON(utf8(), "[]"), &result));
+}
+
+TEST_F(TestQuantileKernel, RandomArrayQuantile) {
+  auto rand = random::RandomArrayGenerator(0x4b0e95);
+  const std::vector<double> q = {0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999};
+  auto array = std::static_pointer_cast<DoubleArray>(
+      rand.Float64((1 << 18) + 7, -1000, 1000, 0.1));
+  const QuantileOptions options(q);
+
+  auto check = [&](const Datum& input) {
+    Datum result;
+    ASSERT_OK(ApproximateQuantile(&ctx_, options, input, &result));
+    const auto quantiles = QuantileValues(result);
+    ASSERT_EQ(quantiles.size(), q.size());
+    for (size_t i = 0; i < q.size(); i++) {
+      // The rank error is smaller near the tails
+      const double tolerance = 0.02 * std::sqrt(q[i] * (1 - q[i]));
+      ASSERT_NEAR(Rank(*array, quantiles[i]), q[i], tolerance) << "q = " << q[i];
+    }
+  };
+
+  check(array);
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 30000), array->Slice(30000, 1), array->Slice(30001)});
+  check(chunked);
+  ctx_.set_use_threads(true);
+  check(array);
+  check(chunked);
+}
+
+TEST_F(TestQuantileKernel, SkewedValues) {
+  // Many duplicates and a long tail
+  Int64Builder builder;
+  for (int64_t i = 0; i < 100000; i++) {
+    ASSERT_OK(builder.Append(i % 10 == 0 ? i : 0));
+  }
+  std::shared_ptr<Array> array;
+  ASSERT_OK(builder.Finish(&array));
+
+  Datum result;
+  ASSERT_OK(ApproximateQuantile(&ctx_, QuantileOptions({0, 0.5, 0.8, 1}), array,
+                                &result));
+  const auto quantiles = QuantileValues(result);
+  ASSERT_EQ(quantiles[0], 0);
+  ASSERT_EQ(quantiles[1], 0);
+  ASSERT_EQ(quantiles[2], 0);
+  ASSERT_EQ(quantiles[3], 99990);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,470 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/decimal.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Operators
+//
+// Call() is the unchecked operation, which wraps integers around.
+// CallChecked() also sets an overflow flag, non-zero if the operation
+// overflowed.  The flags are integers of the width of the operands rather
+// than bools, and are computed without branches wherever possible, so that
+// the loops accumulating them still vectorize.
+
+template <typename T, typename R = T>
+using enable_if_integer_ctype =
+    typename std::enable_if<std::is_integral<T>::value, R>::type;
+
+template <typename T, typename R = T>
+using enable_if_signed_ctype =
+    typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                            R>::type;
+
+template <typename T, typename R = T>
+using enable_if_unsigned_ctype =
+    typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value,
+                            R>::type;
+
+template <typename T, typename R = T>
+using enable_if_floating_ctype =
+    typename std::enable_if<std::is_floating_point<T>::value, R>::type;
+
+// The unsigned type in which integers of type T wrap around, at least as wide
+// as unsigned int so that small integers aren't promoted to signed int
+template <typename T>
+using WrappingType =
+    typename std::conditional<(sizeof(T) < sizeof(unsigned int)), unsigned int,
+                              typename std::make_unsigned<T>::type>::type;
+
+template <typename T>
+using OverflowFlag = typename std::make_unsigned<T>::type;
+
+// An integer type in which the product of two integers of type T is exact,
+// for types narrower than 64 bits
+template <typename T>
+using WideType = typename std::conditional<std::is_signed<T>::value, int64_t,
+                                           uint64_t>::type;
+
+// The sign bit of a signed integer, as 0 or 1
+template <typename T>
+OverflowFlag<T> SignBit(T value) {
+  return static_cast<OverflowFlag<T>>(static_cast<OverflowFlag<T>>(value) >>
+                                      (sizeof(T) * 8 - 1));
+}
+
+struct AddOp {
+  static const char* name() { return "Add"; }
+
+  template <typename T>
+  static enable_if_integer_ctype<T> Call(T a, T b) {
+    return static_cast<T>(static_cast<WrappingType<T>>(a) +
+                          static_cast<WrappingType<T>>(b));
+  }
+
+  template <typename T>
+  static enable_if_floating_ctype<T> Call(T a, T b) {
+    return a + b;
+  }
+
+  template <typename T>
+  static enable_if_signed_ctype<T> CallChecked(T a, T b, OverflowFlag<T>* overflow) {
+    const T result = Call(a, b);
+    // Overflow iff both operands have a sign different from the result
+    *overflow = SignBit<T>((a ^ result) & (b ^ result));
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_ctype<T> CallChecked(T a, T b, OverflowFlag<T>* overflow) {
+    const T result = Call(a, b);
+    *overflow = result < a;
+    return result;
+  }
+};
+
+struct SubtractOp {
+  static const char* name() { return "Subtract"; }
+
+  template <typename T>
+  static enable_if_integer_ctype<T> Call(T a, T b) {
+    return static_cast<T>(static_cast<WrappingType<T>>(a) -
+                          static_cast<WrappingType<T>>(b));
+  }
+
+  template <typename T>
+  static enable_if_floating_ctype<T> Call(T a, T b) {
+    return a - b;
+  }
+
+  template <typename T>
+  static enable_if_signed_ctype<T> CallChecked(T a, T b, OverflowFlag<T>* overflow) {
+    const T result = Call(a, b);
+    // Overflow iff the operands have different signs and the result has the
+    // sign of b
+    *overflow = SignBit<T>((a ^ b) & (a ^ result));
+    return result;
+  }
+
+  template <typename T>
+  static enable_if_unsigned_ctype<T> CallChecked(T a, T b, OverflowFlag<T>* overflow) {
+    *overflow = a < b;
+    return Call(a, b);
+  }
+};
+
+struct MultiplyOp {
+  static const char* name() { return "Multiply"; }
+
+  template <typename T>
+  static enable_if_integer_ctype<T> Call(T a, T b) {
+    return static_cast<T>(static_cast<WrappingType<T>>(a) *
+                          static_cast<WrappingType<T>>(b));
+  }
+
+  template <typename T>
+  static enable_if_floating_ctype<T> Call(T a, T b) {
+    return a * b;
+  }
+
+  // The product is computed exactly in a 64-bit integer, which vectorizes
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value && (sizeof(T) < 8), T>::type
+  CallChecked(T a, T b, OverflowFlag<T>* overflow) {
+    const auto product = static_cast<WideType<T>>(a) * static_cast<WideType<T>>(b);
+    const T result = static_cast<T>(product);
+    *overflow = product != static_cast<WideType<T>>(result);
+    return result;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value && (sizeof(T) == 8), T>::type
+  CallChecked(T a, T b, OverflowFlag<T>* overflow) {
+#if defined(__GNUC__) || defined(__clang__)
+    T result;
+    *overflow = __builtin_mul_overflow(a, b, &result);
+    return result;
+#else
+    const T result = Call(a, b);
+    *overflow = a != 0 && (Call(result, static_cast<T>(1)) / a != b ||
+                           (std::is_signed<T>::value && a == static_cast<T>(-1) &&
+                            b == std::numeric_limits<T>::min()));
+    return result;
+#endif
+  }
+};
+
+// ----------------------------------------------------------------------
+// Loops
+//
+// Each loop computes `length` values from the left and right operands, either
+// array values or a scalar broadcast.  `validity` is the validity bitmap of
+// the output, without offset, or null if all values are valid.
+
+template <typename T>
+struct ArrayOperand {
+  T operator[](int64_t i) const { return values[i]; }
+
+  const T* values;
+};
+
+template <typename T>
+struct ScalarOperand {
+  T operator[](int64_t) const { return value; }
+
+  T value;
+};
+
+inline bool IsValid(const uint8_t* validity, int64_t i) {
+  return validity == NULLPTR || BitUtil::GetBit(validity, i);
+}
+
+// The number of values whose overflows are accumulated before being tested
+constexpr int64_t kOverflowBlockSize = 1024;
+
+template <typename Op, typename T, typename Left, typename Right>
+Status ExecuteUnchecked(const Left& left, const Right& right, int64_t length,
+                        const uint8_t*, T* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = Op::template Call<T>(left[i], right[i]);
+  }
+  return Status::OK();
+}
+
+template <typename Op, typename T, typename Left, typename Right>
+enable_if_integer_ctype<T, Status> ExecuteChecked(const Left& left, const Right& right,
+                                                  int64_t length,
+                                                  const uint8_t* validity, T* out) {
+  for (int64_t start = 0; start < length; start += kOverflowBlockSize) {
+    const int64_t end = std::min(start + kOverflowBlockSize, length);
+    OverflowFlag<T> block_overflow = 0;
+    for (int64_t i = start; i < end; ++i) {
+      OverflowFlag<T> overflow;
+      out[i] = Op::template CallChecked<T>(left[i], right[i], &overflow);
+      block_overflow |= overflow;
+    }
+    if (ARROW_PREDICT_FALSE(block_overflow != 0)) {
+      // The overflow may be in null slots, whose values are unspecified
+      for (int64_t i = start; i < end; ++i) {
+        OverflowFlag<T> overflow;
+        Op::template CallChecked<T>(left[i], right[i], &overflow);
+        if (overflow && IsValid(validity, i)) {
+          return Status::Invalid("Integer overflow in ", Op::name());
+        }
+      }
+    }
+  }
+  return Status::OK();
+}
+
+// Floating point operations never overflow
+template <typename Op, typename T, typename Left, typename Right>
+enable_if_floating_ctype<T, Status> ExecuteChecked(const Left& left, const Right& right,
+                                                   int64_t length,
+                                                   const uint8_t* validity, T* out) {
+  return ExecuteUnchecked<Op>(left, right, length, validity, out);
+}
+
+template <typename T, typename Left, typename Right>
+enable_if_floating_ctype<T, Status> ExecuteDivide(const Left& left, const Right& right,
+                                               int64_t length, const uint8_t*,
+                                               bool, T* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    out[i] = left[i] / right[i];
+  }
+  return Status::OK();
+}
+
+// Integer division doesn't vectorize, so the divisions by zero, which would
+// trap, and of the minimum by -1, which would trap too, are branched over
+template <typename T, typename Left, typename Right>
+enable_if_integer_ctype<T, Status> ExecuteDivide(const Left& left, const Right& right,
+                                              int64_t length, const uint8_t* validity,
+                                              bool check_overflow, T* out) {
+  for (int64_t i = 0; i < length; ++i) {
+    const T a = left[i];
+    const T b = right[i];
+    if (ARROW_PREDICT_FALSE(b == 0)) {
+      if (IsValid(validity, i)) {
+        return Status::Invalid("Divide by zero");
+      }
+      out[i] = 0;
+    } else if (std::is_signed<T>::value && ARROW_PREDICT_FALSE(b == static_cast<T>(-1))) {
+      if (check_overflow && a == std::numeric_limits<T>::min() && IsValid(validity, i)) {
+        return Status::Invalid("Integer overflow in Divide");
+      }
+      out[i] = SubtractOp::Call(static_cast<T>(0), a);
+    } else {
+      out[i] = a / b;
+    }
+  }
+  return Status::OK();
+}
+
+template <typename T, typename Left, typename Right>
+Status ExecuteLoop(const ArithmeticOptions& options, const Left& left,
+                   const Right& right, int64_t length, const uint8_t* validity,
+                   T* out) {
+  const bool checked = options.check_overflow;
+  switch (options.op) {
+    case ArithmeticOptions::ADD:
+      return checked ? ExecuteChecked<AddOp>(left, right, length, validity, out)
+                     : ExecuteUnchecked<AddOp>(left, right, length, validity, out);
+    case ArithmeticOptions::SUBTRACT:
+      return checked ? ExecuteChecked<SubtractOp>(left, right, length, validity, out)
+                     : ExecuteUnchecked<SubtractOp>(left, right, length, validity, out);
+    case ArithmeticOptions::MULTIPLY:
+      return checked ? ExecuteChecked<MultiplyOp>(left, right, length, validity, out)
+                     : ExecuteUnchecked<MultiplyOp>(left, right, length, validity, out);
+    case ArithmeticOptions::DIVIDE:
+      return ExecuteDivide(left, right, length, validity, options.check_overflow, out);
+  }
+  return Status::Invalid("Unknown arithmetic operator");
+}
+
+// ----------------------------------------------------------------------
+// Kernel
+
+template <typename ArrowType>
+class ArithmeticBinaryKernel : public BinaryKernel {
+  using T = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+ public:
+  explicit ArithmeticBinaryKernel(const ArithmeticOptions& options)
+      : options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    const auto left_kind = left.kind();
+    const auto right_kind = right.kind();
+    if (!(left_kind == Datum::ARRAY || left_kind == Datum::SCALAR) ||
+        !(right_kind == Datum::ARRAY || right_kind == Datum::SCALAR) ||
+        (left_kind == Datum::SCALAR && right_kind == Datum::SCALAR)) {
+      return Status::Invalid(
+          "Arithmetic expects an array and an array or a scalar as operands");
+    }
+    if (left_kind == Datum::ARRAY && right_kind == Datum::ARRAY &&
+        left.length() != right.length()) {
+      return Status::Invalid("Arithmetic operands must have identical lengths");
+    }
+
+    const ArrayData& array = left_kind == Datum::ARRAY ? *left.array() : *right.array();
+    const int64_t length = array.length;
+    std::shared_ptr<ArrayData> out_data = ArrayData::Make(out_type(), length);
+    out_data->buffers.resize(2);
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(T), &out_data->buffers[1]));
+    T* out_values = out_data->GetMutableValues<T>(1);
+
+    const bool left_null = left_kind == Datum::SCALAR && !left.scalar()->is_valid;
+    const bool right_null = right_kind == Datum::SCALAR && !right.scalar()->is_valid;
+    if (left_null || right_null) {
+      RETURN_NOT_OK(detail::SetAllNulls(ctx, array, out_data.get()));
+      std::memset(out_values, 0, length * sizeof(T));
+      *out = out_data;
+      return Status::OK();
+    }
+    if (left_kind == Datum::ARRAY && right_kind == Datum::ARRAY) {
+      RETURN_NOT_OK(detail::AssignNullIntersection(ctx, *left.array(), *right.array(),
+                                                   out_data.get()));
+    } else {
+      RETURN_NOT_OK(detail::PropagateNulls(ctx, array, out_data.get()));
+    }
+
+    // The output has no offset
+    const uint8_t* validity =
+        out_data->GetNullCount() > 0 ? out_data->buffers[0]->data() : NULLPTR;
+
+    if (left_kind == Datum::SCALAR) {
+      RETURN_NOT_OK(ExecuteLoop(options_, ScalarOperand<T>{ScalarValue(left)},
+                                ArrayOperand<T>{right.array()->GetValues<T>(1)},
+                                length, validity, out_values));
+    } else if (right_kind == Datum::SCALAR) {
+      RETURN_NOT_OK(ExecuteLoop(options_, ArrayOperand<T>{left.array()->GetValues<T>(1)},
+                                ScalarOperand<T>{ScalarValue(right)}, length, validity,
+                                out_values));
+    } else {
+      RETURN_NOT_OK(ExecuteLoop(options_, ArrayOperand<T>{left.array()->GetValues<T>(1)},
+                                ArrayOperand<T>{right.array()->GetValues<T>(1)},
+                                length, validity, out_values));
+    }
+    *out = out_data;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+ private:
+  static T ScalarValue(const Datum& datum) {
+    return checked_cast<const ScalarType&>(*datum.scalar()).value;
+  }
+
+  ArithmeticOptions options_;
+};
+
+Status DecimalArithmetic(FunctionContext* ctx, const Datum& left, const Datum& right,
+                         const ArithmeticOptions& options, Datum* out) {
+  switch (options.op) {
+    case ArithmeticOptions::ADD:
+      return DecimalAdd(ctx, left, right, out);
+    case ArithmeticOptions::SUBTRACT:
+      return DecimalSubtract(ctx, left, right, out);
+    case ArithmeticOptions::MULTIPLY:
+      return DecimalMultiply(ctx, left, right, out);
+    default:
+      return Status::NotImplemented("Decimal division");
+  }
+}
+
+}  // namespace
+
+#define ARITHMETIC_KERNEL_CASE(T) \
+  case T::type_id:                \
+    return std::make_shared<ArithmeticBinaryKernel<T>>(options);
+
+std::shared_ptr<BinaryKernel> MakeArithmeticKernel(const DataType& type,
+                                                   const ArithmeticOptions& options) {
+  switch (type.id()) {
+    ARITHMETIC_KERNEL_CASE(UInt8Type);
+    ARITHMETIC_KERNEL_CASE(Int8Type);
+    ARITHMETIC_KERNEL_CASE(UInt16Type);
+    ARITHMETIC_KERNEL_CASE(Int16Type);
+    ARITHMETIC_KERNEL_CASE(UInt32Type);
+    ARITHMETIC_KERNEL_CASE(Int32Type);
+    ARITHMETIC_KERNEL_CASE(UInt64Type);
+    ARITHMETIC_KERNEL_CASE(Int64Type);
+    ARITHMETIC_KERNEL_CASE(FloatType);
+    ARITHMETIC_KERNEL_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+}
+
+#undef ARITHMETIC_KERNEL_CASE
+
+Status Arithmetic(FunctionContext* ctx, const Datum& left, const Datum& right,
+                  const ArithmeticOptions& options, Datum* out) {
+  auto left_type = left.type();
+  auto right_type = right.type();
+  if (left_type == nullptr || right_type == nullptr) {
+    return Status::Invalid("Arithmetic expects array or scalar operands");
+  }
+  if (left_type->id() == Type::DECIMAL && right_type->id() == Type::DECIMAL) {
+    return DecimalArithmetic(ctx, left, right, options, out);
+  }
+  if (!left_type->Equals(*right_type)) {
+    return Status::Invalid("Arithmetic operands must have the same type, got ",
+                           *left_type, " and ", *right_type);
+  }
+  auto kernel = MakeArithmeticKernel(*left_type, options);
+  if (kernel == nullptr) {
+    return Status::NotImplemented("Arithmetic not implemented for type ", *left_type);
+  }
+  return kernel->Call(ctx, left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
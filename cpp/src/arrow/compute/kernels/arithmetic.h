@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Options for the Arithmetic kernels
+struct ARROW_EXPORT ArithmeticOptions {
+  enum Operator {
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    /// Integer division truncates towards zero
+    DIVIDE,
+  };
+
+  explicit ArithmeticOptions(Operator op, bool check_overflow = false)
+      : op(op), check_overflow(check_overflow) {}
+
+  Operator op;
+  /// Fail on integer overflow instead of wrapping around.  Overflows in null
+  /// slots are ignored.  Floating point operations follow IEEE 754 either way.
+  bool check_overflow;
+};
+
+/// \brief Return a BinaryKernel computing an arithmetic operation on two
+/// operands of a numeric type, or null if the type isn't supported
+///
+/// The kernel accepts an array and an array or a scalar, in either order, and
+/// allocates its output.
+///
+/// \param[in] type the type of both operands and of the result
+/// \param[in] options the operator and overflow handling
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<BinaryKernel> MakeArithmeticKernel(const DataType& type,
+                                                   const ArithmeticOptions& options);
+
+/// \brief Compute an element-wise arithmetic operation
+///
+/// The operands are two arrays of the same length, or an array and a scalar,
+/// of the same numeric type, which is that of the result.  The result is null
+/// where either operand is null, its validity bitmap being the intersection of
+/// those of the operands.
+///
+/// Without overflow checking, the loops are branch-free and integers wrap
+/// around, so that compilers vectorize them.  With overflow checking, the
+/// overflows of a block of values are detected with comparisons that
+/// vectorize too, or in a wider integer type, and only blocks with an
+/// overflow are checked again for nulls.  Dividing an integer by zero fails
+/// either way.
+///
+/// Decimal operands are forwarded to DecimalAdd, DecimalSubtract and
+/// DecimalMultiply.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left array or scalar
+/// \param[in] right array or scalar, at least one of the operands being an
+/// array
+/// \param[in] options the operator and overflow handling
+/// \param[out] out resulting array
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Arithmetic(FunctionContext* context, const Datum& left, const Datum& right,
+                  const ArithmeticOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,105 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x71c5e0a3;
+
+template <typename ArrowType, ArithmeticOptions::Operator Op, bool kCheckOverflow>
+static void ArithmeticArrayArrayKernel(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(CType);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Numeric<ArrowType>(array_size, 1, 100, null_percent);
+  auto rhs = rand.Numeric<ArrowType>(array_size, 1, 100, null_percent);
+
+  const ArithmeticOptions options(Op, kCheckOverflow);
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Arithmetic(&ctx, Datum(lhs), Datum(rhs), options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType) * 2);
+}
+
+template <typename ArrowType, ArithmeticOptions::Operator Op, bool kCheckOverflow>
+static void ArithmeticArrayScalarKernel(benchmark::State& state) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(CType);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Numeric<ArrowType>(array_size, 1, 100, null_percent);
+  Datum scalar(std::make_shared<ScalarType>(static_cast<CType>(3)));
+
+  const ArithmeticOptions options(Op, kCheckOverflow);
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Arithmetic(&ctx, Datum(array), scalar, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(CType));
+}
+
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Int32Type, ArithmeticOptions::ADD, false)
+    ->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Int32Type, ArithmeticOptions::ADD, true)
+    ->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Int64Type, ArithmeticOptions::MULTIPLY,
+                   false)
+    ->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, Int64Type, ArithmeticOptions::MULTIPLY,
+                   true)
+    ->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayArrayKernel, DoubleType, ArithmeticOptions::DIVIDE,
+                   false)
+    ->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayScalarKernel, Int32Type, ArithmeticOptions::SUBTRACT,
+                   true)
+    ->Apply(RegressionSetArgs);
+BENCHMARK_TEMPLATE(ArithmeticArrayScalarKernel, Int64Type, ArithmeticOptions::DIVIDE,
+                   false)
+    ->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
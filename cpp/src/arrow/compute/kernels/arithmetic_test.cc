@@ -0,0 +1,325 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/decimal.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+template <typename ArrowType>
+class TestArithmeticKernel : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  std::shared_ptr<DataType> type() { return TypeTraits<ArrowType>::type_singleton(); }
+
+  std::shared_ptr<arrow::Array> ArrayOf(const std::string& json) {
+    return ArrayFromJSON(type(), json);
+  }
+
+  Datum ScalarOf(CType value, bool is_valid = true) {
+    return Datum(std::make_shared<ScalarType>(value, is_valid));
+  }
+
+  void AssertArithmetic(ArithmeticOptions::Operator op, const Datum& left,
+                        const Datum& right, const std::string& expected,
+                        bool check_overflow = false) {
+    Datum out;
+    ASSERT_OK(Arithmetic(&this->ctx_, left, right,
+                         ArithmeticOptions(op, check_overflow), &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    auto actual = out.make_array();
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayOf(expected), *actual);
+  }
+
+  // The same results whether overflows are checked or not
+  void AssertBoth(ArithmeticOptions::Operator op, const Datum& left,
+                  const Datum& right, const std::string& expected) {
+    AssertArithmetic(op, left, right, expected, false);
+    AssertArithmetic(op, left, right, expected, true);
+  }
+
+  // An array of values, the null ones holding the given value
+  std::shared_ptr<arrow::Array> WithNullValues(const std::vector<CType>& values,
+                                               const std::vector<bool>& is_valid) {
+    typename TypeTraits<ArrowType>::BuilderType builder;
+    ABORT_NOT_OK(builder.AppendValues(values, is_valid));
+    std::shared_ptr<arrow::Array> array;
+    ABORT_NOT_OK(builder.Finish(&array));
+    return array;
+  }
+};
+
+template <typename ArrowType>
+class TestIntegerArithmetic : public TestArithmeticKernel<ArrowType> {};
+
+TYPED_TEST_CASE(TestArithmeticKernel, NumericArrowTypes);
+TYPED_TEST_CASE(TestIntegerArithmetic, IntegralArrowTypes);
+
+TYPED_TEST(TestArithmeticKernel, ArrayArray) {
+  auto left = this->ArrayOf("[8, 2, null, 4, 10, 9]");
+  auto right = this->ArrayOf("[5, null, 7, 2, 5, 3]");
+
+  this->AssertBoth(ArithmeticOptions::ADD, left, right, "[13, null, null, 6, 15, 12]");
+  this->AssertBoth(ArithmeticOptions::SUBTRACT, left, right, "[3, null, null, 2, 5, 6]");
+  this->AssertBoth(ArithmeticOptions::MULTIPLY, left, right,
+                   "[40, null, null, 8, 50, 27]");
+  this->AssertBoth(ArithmeticOptions::DIVIDE, this->ArrayOf("[10, 2, null, 4, 10, 9]"),
+                   right, "[2, null, null, 2, 2, 3]");
+
+  auto empty = this->ArrayOf("[]");
+  this->AssertBoth(ArithmeticOptions::ADD, empty, empty, "[]");
+}
+
+TYPED_TEST(TestArithmeticKernel, ArrayScalar) {
+  auto array = this->ArrayOf("[8, 2, null, 4, 10, 40]");
+
+  this->AssertBoth(ArithmeticOptions::ADD, array, this->ScalarOf(3),
+                   "[11, 5, null, 7, 13, 43]");
+  this->AssertBoth(ArithmeticOptions::ADD, this->ScalarOf(3), array,
+                   "[11, 5, null, 7, 13, 43]");
+  this->AssertBoth(ArithmeticOptions::SUBTRACT, this->ScalarOf(50), array,
+                   "[42, 48, null, 46, 40, 10]");
+  this->AssertBoth(ArithmeticOptions::SUBTRACT, array, this->ScalarOf(2),
+                   "[6, 0, null, 2, 8, 38]");
+  this->AssertBoth(ArithmeticOptions::MULTIPLY, array, this->ScalarOf(2),
+                   "[16, 4, null, 8, 20, 80]");
+  this->AssertBoth(ArithmeticOptions::DIVIDE, array, this->ScalarOf(2),
+                   "[4, 1, null, 2, 5, 20]");
+  this->AssertBoth(ArithmeticOptions::DIVIDE, this->ScalarOf(80), array,
+                   "[10, 40, null, 20, 8, 2]");
+
+  // A null scalar nulls the whole result
+  this->AssertBoth(ArithmeticOptions::ADD, array, this->ScalarOf(1, false),
+                   "[null, null, null, null, null, null]");
+  this->AssertBoth(ArithmeticOptions::DIVIDE, this->ScalarOf(0, false), array,
+                   "[null, null, null, null, null, null]");
+}
+
+TYPED_TEST(TestArithmeticKernel, Sliced) {
+  auto left = this->ArrayOf("[1, 8, 2, null, 4, 10, 9, 3, 1, 2, 3]");
+  auto right = this->ArrayOf("[null, 9, 5, null, 7, 2, 5, 3, 1, 1, 6]");
+
+  this->AssertBoth(ArithmeticOptions::ADD, left->Slice(1, 9), right->Slice(2, 9),
+                   "[13, null, null, 6, 15, 12, 4, 2, 8]");
+  this->AssertBoth(ArithmeticOptions::MULTIPLY, left->Slice(3), this->ScalarOf(2),
+                   "[null, 8, 20, 18, 6, 2, 4, 6]");
+}
+
+TYPED_TEST(TestIntegerArithmetic, Overflow) {
+  using CType = typename TestFixture::CType;
+  const CType min = std::numeric_limits<CType>::min();
+  const CType max = std::numeric_limits<CType>::max();
+  auto max_array = this->WithNullValues({max, 1}, {true, true});
+  auto min_array = this->WithNullValues({min, 1}, {true, true});
+  Datum out;
+
+  for (auto op : {ArithmeticOptions::ADD, ArithmeticOptions::MULTIPLY}) {
+    ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, max_array, this->ScalarOf(2),
+                                      ArithmeticOptions(op, true), &out));
+  }
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, min_array, this->ScalarOf(1),
+                                    ArithmeticOptions(ArithmeticOptions::SUBTRACT, true),
+                                    &out));
+
+  // Without checks, integers wrap around
+  ASSERT_OK(Arithmetic(&this->ctx_, max_array, this->ScalarOf(1),
+                       ArithmeticOptions(ArithmeticOptions::ADD), &out));
+  AssertArraysEqual(*this->WithNullValues({min, 2}, {true, true}), *out.make_array());
+  ASSERT_OK(Arithmetic(&this->ctx_, min_array, this->ScalarOf(1),
+                       ArithmeticOptions(ArithmeticOptions::SUBTRACT), &out));
+  AssertArraysEqual(*this->WithNullValues({max, 0}, {true, true}), *out.make_array());
+  ASSERT_OK(Arithmetic(&this->ctx_, max_array, this->ScalarOf(2),
+                       ArithmeticOptions(ArithmeticOptions::MULTIPLY), &out));
+  const auto wrapped_product = static_cast<CType>(static_cast<uint64_t>(max) * 2);
+  AssertArraysEqual(*this->WithNullValues({wrapped_product, 2}, {true, true}),
+                    *out.make_array());
+
+  // Overflows in null slots are ignored
+  auto null_max = this->WithNullValues({max, 1}, {false, true});
+  for (auto op : {ArithmeticOptions::ADD, ArithmeticOptions::MULTIPLY}) {
+    ASSERT_OK(Arithmetic(&this->ctx_, null_max, this->ScalarOf(2),
+                         ArithmeticOptions(op, true), &out));
+    const auto& result = checked_cast<const NumericArray<TypeParam>&>(*out.make_array());
+    ASSERT_FALSE(result.IsValid(0));
+    ASSERT_EQ(op == ArithmeticOptions::ADD ? 3 : 2, result.Value(1));
+  }
+}
+
+TYPED_TEST(TestIntegerArithmetic, OverflowInLargeArray) {
+  using CType = typename TestFixture::CType;
+  const int64_t length = 5000;
+  std::vector<CType> values(length, 1);
+  std::vector<bool> is_valid(length, true);
+  // An overflow in a null slot of the same block as the real one
+  values[3000] = std::numeric_limits<CType>::max();
+  is_valid[3000] = false;
+  values[4000] = std::numeric_limits<CType>::max();
+  const ArithmeticOptions options(ArithmeticOptions::ADD, true);
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, this->WithNullValues(values, is_valid),
+                                    this->ScalarOf(1), options, &out));
+  values[4000] = 1;
+  ASSERT_OK(Arithmetic(&this->ctx_, this->WithNullValues(values, is_valid),
+                       this->ScalarOf(1), options, &out));
+  ASSERT_EQ(1, out.make_array()->null_count());
+}
+
+TYPED_TEST(TestIntegerArithmetic, DivideByZero) {
+  using CType = typename TestFixture::CType;
+  Datum out;
+  for (bool check_overflow : {false, true}) {
+    const ArithmeticOptions options(ArithmeticOptions::DIVIDE, check_overflow);
+    ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, this->ArrayOf("[1, 2]"),
+                                      this->ArrayOf("[1, 0]"), options, &out));
+    ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, this->ArrayOf("[1, 2]"),
+                                      this->ScalarOf(0), options, &out));
+    // Zeros in null slots are ignored
+    ASSERT_OK(Arithmetic(&this->ctx_, this->ArrayOf("[4, 6]"),
+                         this->WithNullValues({0, 3}, {false, true}), options, &out));
+    AssertArraysEqual(*this->ArrayOf("[null, 2]"), *out.make_array());
+  }
+
+  if (std::is_signed<CType>::value) {
+    const CType min = std::numeric_limits<CType>::min();
+    auto array = this->WithNullValues({min, 6}, {true, true});
+    ASSERT_RAISES(Invalid, Arithmetic(&this->ctx_, array, this->ScalarOf(-1),
+                                      ArithmeticOptions(ArithmeticOptions::DIVIDE, true),
+                                      &out));
+    ASSERT_OK(Arithmetic(&this->ctx_, array, this->ScalarOf(-1),
+                         ArithmeticOptions(ArithmeticOptions::DIVIDE), &out));
+    AssertArraysEqual(*this->WithNullValues({min, static_cast<CType>(-6)}, {true, true}),
+                      *out.make_array());
+  }
+}
+
+TYPED_TEST(TestIntegerArithmetic, RandomArrays) {
+  using CType = typename TestFixture::CType;
+  auto rand = random::RandomArrayGenerator(0x61c9e3);
+  const CType bound = std::numeric_limits<CType>::max() / 4;
+  auto left = rand.Numeric<TypeParam>(3000, static_cast<CType>(0), bound, 0.1);
+  auto right = rand.Numeric<TypeParam>(3000, static_cast<CType>(0), bound, 0.1);
+
+  for (auto op : {ArithmeticOptions::ADD, ArithmeticOptions::SUBTRACT}) {
+    Datum unchecked, checked;
+    ASSERT_OK(Arithmetic(&this->ctx_, left, right, ArithmeticOptions(op), &unchecked));
+    auto status = Arithmetic(&this->ctx_, left, right, ArithmeticOptions(op, true),
+                             &checked);
+    if (op == ArithmeticOptions::SUBTRACT && std::is_unsigned<CType>::value) {
+      ASSERT_RAISES(Invalid, status);
+      continue;
+    }
+    ASSERT_OK(status);
+    AssertArraysEqual(*unchecked.make_array(), *checked.make_array());
+
+    const auto& result = checked_cast<const NumericArray<TypeParam>&>(
+        *checked.make_array());
+    const auto& left_values = checked_cast<const NumericArray<TypeParam>&>(*left);
+    const auto& right_values = checked_cast<const NumericArray<TypeParam>&>(*right);
+    for (int64_t i = 0; i < result.length(); i++) {
+      ASSERT_EQ(result.IsValid(i), left->IsValid(i) && right->IsValid(i));
+      if (result.IsValid(i)) {
+        const CType expected =
+            op == ArithmeticOptions::ADD
+                ? static_cast<CType>(left_values.Value(i) + right_values.Value(i))
+                : static_cast<CType>(left_values.Value(i) - right_values.Value(i));
+        ASSERT_EQ(expected, result.Value(i));
+      }
+    }
+  }
+}
+
+class TestArithmetic : public ComputeFixture, public TestBase {};
+
+TEST_F(TestArithmetic, FloatingPoint) {
+  Datum out;
+  auto array = ArrayFromJSON(float64(), "[1, -1, 0, 2]");
+  ASSERT_OK(Arithmetic(&ctx_, array, ArrayFromJSON(float64(), "[0, 0, 0, 0.5]"),
+                       ArithmeticOptions(ArithmeticOptions::DIVIDE, true), &out));
+  const auto& result = checked_cast<const DoubleArray&>(*out.make_array());
+  ASSERT_EQ(std::numeric_limits<double>::infinity(), result.Value(0));
+  ASSERT_EQ(-std::numeric_limits<double>::infinity(), result.Value(1));
+  ASSERT_TRUE(std::isnan(result.Value(2)));
+  ASSERT_EQ(4, result.Value(3));
+
+  ASSERT_OK(Arithmetic(&ctx_, ArrayFromJSON(float32(), "[3.5e38]"),
+                       Datum(std::make_shared<FloatScalar>(10.0f)),
+                       ArithmeticOptions(ArithmeticOptions::MULTIPLY, true), &out));
+  ASSERT_EQ(std::numeric_limits<float>::infinity(),
+            checked_cast<const FloatArray&>(*out.make_array()).Value(0));
+}
+
+TEST_F(TestArithmetic, Decimal) {
+  auto type = decimal(5, 2);
+  Datum out;
+  ASSERT_OK(Arithmetic(&ctx_, ArrayFromJSON(type, R"(["1.25", null, "-3.00"])"),
+                       ArrayFromJSON(type, R"(["2.50", "1.00", "1.01"])"),
+                       ArithmeticOptions(ArithmeticOptions::ADD), &out));
+  AssertArraysEqual(*ArrayFromJSON(decimal(6, 2), R"(["3.75", null, "-1.99"])"),
+                    *out.make_array());
+  ASSERT_RAISES(NotImplemented,
+                Arithmetic(&ctx_, ArrayFromJSON(type, "[]"), ArrayFromJSON(type, "[]"),
+                           ArithmeticOptions(ArithmeticOptions::DIVIDE), &out));
+}
+
+TEST_F(TestArithmetic, InvalidOperands) {
+  const ArithmeticOptions options(ArithmeticOptions::ADD);
+  Datum out;
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ArrayFromJSON(int32(), "[1]"),
+                                    ArrayFromJSON(int64(), "[1]"), options, &out));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ArrayFromJSON(int32(), "[1]"),
+                                    ArrayFromJSON(int32(), "[1, 2]"), options, &out));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, Datum(std::make_shared<Int32Scalar>(1)),
+                                    Datum(std::make_shared<Int32Scalar>(2)), options,
+                                    &out));
+  ASSERT_RAISES(NotImplemented, Arithmetic(&ctx_, ArrayFromJSON(utf8(), "[]"),
+                                           ArrayFromJSON(utf8(), "[]"), options, &out));
+  ASSERT_EQ(nullptr, MakeArithmeticKernel(*boolean(), options));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -70,7 +70,8 @@ Status Invert(FunctionContext* ctx, const Datum& value, Datum* out) {
   detail::PrimitiveAllocatingUnaryKernel kernel(&invert);
 
   std::vector<Datum> result;
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, value, &result));
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, value, &result,
+                                               /*parallelizable=*/true));
 
   *out = detail::WrapDatumsLike(value, result);
   return Status::OK();
@@ -112,7 +113,8 @@ class AndKernel : public BinaryBooleanKernel {
 Status And(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
   AndKernel and_kernel;
   detail::PrimitiveAllocatingBinaryKernel kernel(&and_kernel);
-  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out,
+                                         /*parallelizable=*/true);
 }
 
 class OrKernel : public BinaryBooleanKernel {
@@ -129,7 +131,8 @@ class OrKernel : public BinaryBooleanKernel {
 Status Or(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
   OrKernel or_kernel;
   detail::PrimitiveAllocatingBinaryKernel kernel(&or_kernel);
-  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out,
+                                         /*parallelizable=*/true);
 }
 
 class XorKernel : public BinaryBooleanKernel {
@@ -146,7 +149,8 @@ class XorKernel : public BinaryBooleanKernel {
 Status Xor(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
   XorKernel xor_kernel;
   detail::PrimitiveAllocatingBinaryKernel kernel(&xor_kernel);
-  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out,
+                                         /*parallelizable=*/true);
 }
 
 }  // namespace compute
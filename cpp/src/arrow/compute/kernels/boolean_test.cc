@@ -173,5 +173,30 @@ TEST_F(TestBooleanKernel, Xor) {
   TestBinaryKernel(Xor, values1, values2, values3, values3_nulls);
 }
 
+TEST_F(TestBooleanKernel, UseThreads) {
+  std::vector<bool> values1 = {true, false, true, false, true, true};
+  std::vector<bool> values2 = {true, true, false, false, true, false};
+  std::vector<bool> values3 = {false, true, true, false, false, true};
+  std::vector<bool> values3_nulls = {true, false, false, false, true, false};
+
+  auto a1 = _MakeArray<BooleanType, bool>(boolean(), values1, values2);
+  ArrayVector arrays;
+  for (int i = 0; i < 10; ++i) {
+    arrays.push_back(a1->Slice(i % 3));
+  }
+  auto carr = std::make_shared<ChunkedArray>(arrays);
+  Datum expected;
+  ASSERT_OK(Invert(&this->ctx_, carr, &expected));
+
+  ctx_.set_use_threads(true);
+  ctx_.set_max_parallelism(2);
+  TestBinaryKernel(Xor, values1, values2, values3, values3_nulls);
+
+  Datum result;
+  ASSERT_OK(Invert(&this->ctx_, carr, &result));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+  AssertChunkedEqual(*expected.chunked_array(), *result.chunked_array());
+}
+
 }  // namespace compute
 }  // namespace arrow
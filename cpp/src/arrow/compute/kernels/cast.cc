@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/cast.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -85,6 +86,20 @@ Status CastNotImplemented(const DataType& in_type, const DataType& out_type) {
 template <typename OutType, typename InType, typename Enable = void>
 struct CastFunctor {};
 
+// Checked casts convert and check their values in blocks, reducing the
+// checks of a block without branches so that the loops vectorize.  Only the
+// blocks with a failing value have their validity bitmap looked at, as the
+// values of null slots are unspecified.
+constexpr int64_t kCastBlockSize = 256;
+
+inline const uint8_t* GetValidity(const ArrayData& input) {
+  return input.null_count != 0 && input.buffers[0] ? input.buffers[0]->data() : NULLPTR;
+}
+
+inline bool IsValid(const uint8_t* validity, int64_t offset, int64_t i) {
+  return validity == NULLPTR || BitUtil::GetBit(validity, offset + i);
+}
+
 // ----------------------------------------------------------------------
 // Dictionary to null
 
@@ -275,8 +290,6 @@ struct CastFunctor<
     using in_type = typename I::c_type;
     using out_type = typename O::c_type;
 
-    auto in_offset = input.offset;
-
     const in_type* in_data = input.GetValues<in_type>(1);
     auto out_data = output->GetMutableValues<out_type>(1);
 
@@ -285,23 +298,27 @@ struct CastFunctor<
       constexpr in_type kMin = SafeMinimum<O, I>();
 
       // Null count may be -1 if the input array had been sliced
-      if (input.null_count != 0) {
-        internal::BitmapReader is_valid_reader(input.buffers[0]->data(), in_offset,
-                                               input.length);
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(is_valid_reader.IsSet() &&
-                                  (*in_data > kMax || *in_data < kMin))) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
-          }
-          *out_data++ = static_cast<out_type>(*in_data++);
-          is_valid_reader.Next();
+      const uint8_t* validity = GetValidity(input);
+      for (int64_t start = 0; start < input.length; start += kCastBlockSize) {
+        const int64_t end = std::min(start + kCastBlockSize, input.length);
+        // The extrema of the block and of the range, which are only beyond
+        // the range if a value is
+        in_type block_min = kMin;
+        in_type block_max = kMax;
+        for (int64_t i = start; i < end; ++i) {
+          const in_type value = in_data[i];
+          out_data[i] = static_cast<out_type>(value);
+          block_min = std::min(block_min, value);
+          block_max = std::max(block_max, value);
         }
-      } else {
-        for (int64_t i = 0; i < input.length; ++i) {
-          if (ARROW_PREDICT_FALSE(*in_data > kMax || *in_data < kMin)) {
-            ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+        if (ARROW_PREDICT_FALSE(block_min < kMin || block_max > kMax)) {
+          for (int64_t i = start; i < end; ++i) {
+            if ((in_data[i] > kMax || in_data[i] < kMin) &&
+                IsValid(validity, input.offset, i)) {
+              ctx->SetStatus(Status::Invalid("Integer value out of bounds"));
+              return;
+            }
           }
-          *out_data++ = static_cast<out_type>(*in_data++);
         }
       }
     } else {
@@ -335,7 +352,12 @@ struct CastFunctor<O, I, typename std::enable_if<is_float_truncate<O, I>::value>
     using in_type = typename I::c_type;
     using out_type = typename O::c_type;
 
-    auto in_offset = input.offset;
+    // An integer of the width of the input, in which the comparison results
+    // are or'ed in the lanes of the input values
+    using flag_type = typename std::conditional<
+        sizeof(in_type) == 8, uint64_t,
+        typename std::conditional<sizeof(in_type) == 4, uint32_t, uint16_t>::type>::type;
+
     const in_type* in_data = input.GetValues<in_type>(1);
     auto out_data = output->GetMutableValues<out_type>(1);
 
@@ -345,28 +367,26 @@ struct CastFunctor<O, I, typename std::enable_if<is_float_truncate<O, I>::value>
         *out_data++ = static_cast<out_type>(*in_data++);
       }
     } else {
-      // safe cast
-      if (input.null_count != 0) {
-        internal::BitmapReader is_valid_reader(input.buffers[0]->data(), in_offset,
-                                               input.length);
-        for (int64_t i = 0; i < input.length; ++i) {
-          auto out_value = static_cast<out_type>(*in_data);
-          if (ARROW_PREDICT_FALSE(is_valid_reader.IsSet() &&
-                                  static_cast<in_type>(out_value) != *in_data)) {
-            ctx->SetStatus(Status::Invalid("Floating point value truncated"));
-          }
-          *out_data++ = out_value;
-          in_data++;
-          is_valid_reader.Next();
+      // safe cast, which fails for values out of the range of the output as
+      // they don't convert back either
+      const uint8_t* validity = GetValidity(input);
+      for (int64_t start = 0; start < input.length; start += kCastBlockSize) {
+        const int64_t end = std::min(start + kCastBlockSize, input.length);
+        flag_type truncated = 0;
+        for (int64_t i = start; i < end; ++i) {
+          const auto out_value = static_cast<out_type>(in_data[i]);
+          out_data[i] = out_value;
+          truncated |=
+              static_cast<flag_type>(static_cast<in_type>(out_value) != in_data[i]);
         }
-      } else {
-        for (int64_t i = 0; i < input.length; ++i) {
-          auto out_value = static_cast<out_type>(*in_data);
-          if (ARROW_PREDICT_FALSE(static_cast<in_type>(out_value) != *in_data)) {
-            ctx->SetStatus(Status::Invalid("Floating point value truncated"));
+        if (ARROW_PREDICT_FALSE(truncated != 0)) {
+          for (int64_t i = start; i < end; ++i) {
+            if (static_cast<in_type>(out_data[i]) != in_data[i] &&
+                IsValid(validity, input.offset, i)) {
+              ctx->SetStatus(Status::Invalid("Floating point value truncated"));
+              return;
+            }
           }
-          *out_data++ = out_value;
-          in_data++;
         }
       }
     }
@@ -415,6 +435,43 @@ struct CastFunctor<O, I,
 // ----------------------------------------------------------------------
 // From one timestamp to another
 
+// Divide times by a factor.  kFactor is the factor if it is known at
+// compile time, which lets compilers turn the divisions into
+// multiplications, or 0.
+template <typename in_type, typename out_type, int64_t kFactor>
+void DivideTime(FunctionContext* ctx, const CastOptions& options, int64_t factor,
+                const ArrayData& input, ArrayData* output) {
+  const in_type* in_data = input.GetValues<in_type>(1);
+  auto out_data = output->GetMutableValues<out_type>(1);
+  const int64_t divisor = kFactor != 0 ? kFactor : factor;
+
+  if (options.allow_time_truncate) {
+    for (int64_t i = 0; i < input.length; i++) {
+      out_data[i] = static_cast<out_type>(in_data[i] / divisor);
+    }
+    return;
+  }
+  const uint8_t* validity = GetValidity(input);
+  for (int64_t start = 0; start < input.length; start += kCastBlockSize) {
+    const int64_t end = std::min(start + kCastBlockSize, input.length);
+    bool lost_data = false;
+    for (int64_t i = start; i < end; i++) {
+      out_data[i] = static_cast<out_type>(in_data[i] / divisor);
+      lost_data |= out_data[i] * divisor != in_data[i];
+    }
+    if (ARROW_PREDICT_FALSE(lost_data)) {
+      for (int64_t i = start; i < end; i++) {
+        if (out_data[i] * divisor != in_data[i] && IsValid(validity, input.offset, i)) {
+          ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(), " to ",
+                                         output->type->ToString(),
+                                         " would lose data: ", in_data[i]));
+          return;
+        }
+      }
+    }
+  }
+}
+
 template <typename in_type, typename out_type>
 void ShiftTime(FunctionContext* ctx, const CastOptions& options, const bool is_multiply,
                const int64_t factor, const ArrayData& input, ArrayData* output) {
@@ -430,37 +487,23 @@ void ShiftTime(FunctionContext* ctx, const CastOptions& options, const bool is_m
       out_data[i] = static_cast<out_type>(in_data[i] * factor);
     }
   } else {
-    if (options.allow_time_truncate) {
-      for (int64_t i = 0; i < input.length; i++) {
-        out_data[i] = static_cast<out_type>(in_data[i] / factor);
-      }
-    } else {
-#define RAISE_INVALID_CAST(VAL)                                                   \
-  ctx->SetStatus(Status::Invalid("Casting from ", input.type->ToString(), " to ", \
-                                 output->type->ToString(), " would lose data: ", VAL));
-
-      if (input.null_count != 0) {
-        internal::BitmapReader bit_reader(input.buffers[0]->data(), input.offset,
-                                          input.length);
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (bit_reader.IsSet() && (out_data[i] * factor != in_data[i])) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
-          }
-          bit_reader.Next();
-        }
-      } else {
-        for (int64_t i = 0; i < input.length; i++) {
-          out_data[i] = static_cast<out_type>(in_data[i] / factor);
-          if (out_data[i] * factor != in_data[i]) {
-            RAISE_INVALID_CAST(in_data[i]);
-            break;
-          }
-        }
-      }
-
-#undef RAISE_INVALID_CAST
+    // The factors between time units and days
+    switch (factor) {
+      case 1000:
+        return DivideTime<in_type, out_type, 1000>(ctx, options, factor, input, output);
+      case 1000000:
+        return DivideTime<in_type, out_type, 1000000>(ctx, options, factor, input,
+                                                      output);
+      case 1000000000:
+        return DivideTime<in_type, out_type, 1000000000>(ctx, options, factor, input,
+                                                         output);
+      case 86400:
+        return DivideTime<in_type, out_type, 86400>(ctx, options, factor, input, output);
+      case kMillisecondsInDay:
+        return DivideTime<in_type, out_type, kMillisecondsInDay>(ctx, options, factor,
+                                                                 input, output);
+      default:
+        return DivideTime<in_type, out_type, 0>(ctx, options, factor, input, output);
     }
   }
 }
@@ -633,12 +676,15 @@ bool NeedToPreallocate(const DataType& type) { return is_fixed_width(type.id());
 Status InvokeWithAllocation(FunctionContext* ctx, UnaryKernel* func, const Datum& input,
                             Datum* out) {
   std::vector<Datum> result;
+  // Cast kernels hold no mutable state, so chunks may be cast in parallel
   if (NeedToPreallocate(*func->out_type())) {
     // Create wrapper that allocates output memory for primitive types
     detail::PrimitiveAllocatingUnaryKernel wrapper(func);
-    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &wrapper, input, &result));
+    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &wrapper, input, &result,
+                                                 /*parallelizable=*/true));
   } else {
-    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func, input, &result));
+    RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, func, input, &result,
+                                                 /*parallelizable=*/true));
   }
   ARROW_RETURN_IF_ERROR(ctx);
   *out = detail::WrapDatumsLike(input, result);
@@ -1050,6 +1096,60 @@ struct CastFunctor<LargeStringType, LargeBinaryType>
 #pragma warning(pop)
 #endif
 
+// ----------------------------------------------------------------------
+// Binary to binary with another offset width, sharing the value data
+
+template <typename O, typename I>
+struct BinaryOffsetWidthCastFunctor {
+  using in_offset_type = typename I::offset_type;
+  using out_offset_type = typename O::offset_type;
+
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const in_offset_type* in_offsets = input.GetValues<in_offset_type>(1);
+    const int64_t first_offset = in_offsets[0];
+    const int64_t data_length = in_offsets[input.length] - first_offset;
+    if (data_length > std::numeric_limits<out_offset_type>::max()) {
+      ctx->SetStatus(Status::Invalid("Failed casting from ", input.type->ToString(),
+                                     " to ", output->type->ToString(),
+                                     ": input array too large"));
+      return;
+    }
+
+    std::shared_ptr<Buffer> offsets;
+    Status st = ctx->Allocate((input.length + 1) * sizeof(out_offset_type), &offsets);
+    if (!st.ok()) {
+      ctx->SetStatus(st);
+      return;
+    }
+    auto out_offsets = reinterpret_cast<out_offset_type*>(offsets->mutable_data());
+    for (int64_t i = 0; i <= input.length; ++i) {
+      out_offsets[i] = static_cast<out_offset_type>(in_offsets[i] - first_offset);
+    }
+    output->buffers.resize(3);
+    output->buffers[1] = std::move(offsets);
+    if (input.buffers[2] != nullptr) {
+      output->buffers[2] = SliceBuffer(input.buffers[2], first_offset, data_length);
+    }
+  }
+};
+
+template <>
+struct CastFunctor<LargeBinaryType, BinaryType>
+    : public BinaryOffsetWidthCastFunctor<LargeBinaryType, BinaryType> {};
+
+template <>
+struct CastFunctor<BinaryType, LargeBinaryType>
+    : public BinaryOffsetWidthCastFunctor<BinaryType, LargeBinaryType> {};
+
+template <>
+struct CastFunctor<LargeStringType, StringType>
+    : public BinaryOffsetWidthCastFunctor<LargeStringType, StringType> {};
+
+template <>
+struct CastFunctor<StringType, LargeStringType>
+    : public BinaryOffsetWidthCastFunctor<StringType, LargeStringType> {};
+
 // ----------------------------------------------------------------------
 
 typedef std::function<void(FunctionContext*, const CastOptions& options, const ArrayData&,
@@ -1180,20 +1280,39 @@ Status GetListCastFunc(const DataType& in_type, std::shared_ptr<DataType> out_ty
 
 }  // namespace
 
-inline bool IsZeroCopyCast(Type::type in_type, Type::type out_type) {
+// Whether the values of the input are those of the output, only the type of
+// the array changing
+inline bool IsZeroCopyCast(Type::type in_type, Type::type out_type,
+                           const CastOptions& options) {
   switch (in_type) {
     case Type::INT32:
-      return (out_type == Type::DATE32) || (out_type == Type::TIME32);
+      return (out_type == Type::DATE32) || (out_type == Type::TIME32) ||
+             (options.allow_int_overflow && out_type == Type::UINT32);
     case Type::INT64:
       return ((out_type == Type::DATE64) || (out_type == Type::TIME64) ||
-              (out_type == Type::TIMESTAMP));
+              (out_type == Type::TIMESTAMP) || (out_type == Type::DURATION) ||
+              (options.allow_int_overflow && out_type == Type::UINT64));
     case Type::DATE32:
     case Type::TIME32:
       return out_type == Type::INT32;
     case Type::DATE64:
     case Type::TIME64:
     case Type::TIMESTAMP:
+    case Type::DURATION:
       return out_type == Type::INT64;
+    // Integers of the same width wrap around between signed and unsigned
+    case Type::INT8:
+      return options.allow_int_overflow && out_type == Type::UINT8;
+    case Type::UINT8:
+      return options.allow_int_overflow && out_type == Type::INT8;
+    case Type::INT16:
+      return options.allow_int_overflow && out_type == Type::UINT16;
+    case Type::UINT16:
+      return options.allow_int_overflow && out_type == Type::INT16;
+    case Type::UINT32:
+      return options.allow_int_overflow && out_type == Type::INT32;
+    case Type::UINT64:
+      return options.allow_int_overflow && out_type == Type::INT64;
     default:
       break;
   }
@@ -1207,7 +1326,7 @@ Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_ty
     return Status::OK();
   }
 
-  if (IsZeroCopyCast(in_type.id(), out_type->id())) {
+  if (IsZeroCopyCast(in_type.id(), out_type->id(), options)) {
     kernel->reset(new ZeroCopyCast(std::move(out_type)));
     return Status::OK();
   }
@@ -915,6 +915,35 @@ TEST_F(TestCast, ChunkedArray) {
   ASSERT_TRUE(out.chunked_array()->Equals(*ex_carr));
 }
 
+TEST_F(TestCast, ChunkedArrayUseThreads) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  ArrayVector arrays;
+  for (int i = 0; i < 20; ++i) {
+    arrays.push_back(rand.Int32(100 + i, -1000, 1000, /*null_probability=*/0.1));
+  }
+  auto carr = std::make_shared<ChunkedArray>(arrays);
+
+  CastOptions options;
+  Datum expected;
+  ASSERT_OK(Cast(&this->ctx_, carr, int64(), options, &expected));
+
+  for (int max_parallelism : {0, 2, 3}) {
+    ctx_.set_use_threads(true);
+    ctx_.set_max_parallelism(max_parallelism);
+    Datum out;
+    ASSERT_OK(Cast(&this->ctx_, carr, int64(), options, &out));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+    AssertChunkedEqual(*expected.chunked_array(), *out.chunked_array());
+
+    // The overflow in the last chunk is reported
+    ArrayVector bad_arrays = arrays;
+    bad_arrays.push_back(rand.Int32(10, 40000, 50000, /*null_probability=*/0));
+    auto bad_carr = std::make_shared<ChunkedArray>(bad_arrays);
+    ASSERT_RAISES(Invalid, Cast(&this->ctx_, bad_carr, int16(), options, &out));
+    ASSERT_FALSE(ctx_.HasError());
+  }
+}
+
 TEST_F(TestCast, UnsupportedTarget) {
   std::vector<bool> is_valid = {true, false, true, true, true};
   std::vector<int32_t> v1 = {0, 1, 2, 3, 4};
@@ -944,6 +973,82 @@ TEST_F(TestCast, DateTimeZeroCopy) {
   CheckZeroCopy(*arr, timestamp(TimeUnit::NANO));
 }
 
+TEST_F(TestCast, ReinterpretZeroCopy) {
+  std::vector<bool> is_valid = {true, false, true, true, true};
+  CastOptions options;
+  options.allow_int_overflow = true;
+  auto check_zero_copy = [&](const Array& input, const std::shared_ptr<DataType>& type) {
+    std::shared_ptr<Array> result;
+    ASSERT_OK(Cast(&ctx_, input, type, options, &result));
+    ASSERT_OK(result->Validate());
+    ASSERT_TRUE(result->type()->Equals(type));
+    AssertBufferSame(input, *result, 1);
+  };
+
+  std::shared_ptr<Array> arr;
+  ArrayFromVector<Int32Type, int32_t>(int32(), is_valid, {0, -1, 2, INT32_MIN, 4}, &arr);
+  check_zero_copy(*arr, uint32());
+  ArrayFromVector<UInt64Type, uint64_t>(uint64(), is_valid, {0, 1, UINT64_MAX, 3, 4},
+                                        &arr);
+  check_zero_copy(*arr, int64());
+  ArrayFromVector<Int8Type, int8_t>(int8(), is_valid, {0, -1, 2, 3, 4}, &arr);
+  check_zero_copy(*arr, uint8());
+
+  ArrayFromVector<Int64Type, int64_t>(int64(), is_valid, {0, 70000, 2000, 1000, 0},
+                                      &arr);
+  CheckZeroCopy(*arr, duration(TimeUnit::NANO));
+  ArrayFromVector<DurationType, int64_t>(duration(TimeUnit::SECOND), is_valid,
+                                         {0, 70000, 2000, 1000, 0}, &arr);
+  CheckZeroCopy(*arr, int64());
+
+  // Without overflow, reinterpreting isn't safe and values are checked
+  ArrayFromVector<Int32Type, int32_t>(int32(), is_valid, {0, -1, 2, INT32_MIN, 4}, &arr);
+  std::shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid, Cast(&ctx_, *arr, uint32(), CastOptions::Safe(), &result));
+}
+
+TEST_F(TestCast, ChecksAcrossBlocks) {
+  // Failing values in null slots are ignored, in blocks with and without
+  // failing valid values
+  const int64_t length = 1000;
+  std::vector<bool> is_valid(length, true);
+  std::vector<int64_t> ints(length), expected_ints(length);
+  std::vector<double> doubles(length);
+  std::vector<int64_t> times(length), expected_times(length);
+  for (int64_t i = 0; i < length; ++i) {
+    ints[i] = expected_ints[i] = i - 500;
+    doubles[i] = static_cast<double>(i);
+    times[i] = i * 1000;
+    expected_times[i] = i;
+  }
+  for (int64_t i : {3, 300, 999}) {
+    is_valid[i] = false;
+    ints[i] = INT64_MAX;
+    doubles[i] = 0.5;
+    times[i] = 1;
+  }
+  std::vector<int32_t> expected_int32s(expected_ints.begin(), expected_ints.end());
+  std::vector<int64_t> expected_doubles(length);
+  for (int64_t i = 0; i < length; ++i) {
+    expected_doubles[i] = i;
+  }
+
+  auto options = CastOptions::Safe();
+  CheckCase<Int64Type, int64_t, Int32Type, int32_t>(int64(), ints, is_valid, int32(),
+                                                    expected_int32s, options);
+  CheckCase<DoubleType, double, Int64Type, int64_t>(float64(), doubles, is_valid,
+                                                    int64(), expected_doubles, options);
+  CheckCase<TimestampType, int64_t, TimestampType, int64_t>(
+      timestamp(TimeUnit::MILLI), times, is_valid, timestamp(TimeUnit::SECOND),
+      expected_times, options);
+
+  is_valid[300] = true;
+  CheckFails<Int64Type>(int64(), ints, is_valid, int32(), options);
+  CheckFails<DoubleType>(float64(), doubles, is_valid, int64(), options);
+  CheckFails<TimestampType>(timestamp(TimeUnit::MILLI), times, is_valid,
+                            timestamp(TimeUnit::SECOND), options);
+}
+
 TEST_F(TestCast, PreallocatedMemory) {
   CastOptions options;
   options.allow_int_overflow = false;
@@ -1115,6 +1220,29 @@ TEST_F(TestCast, LargeBinaryToLargeString) {
   TestCastBinaryToString<LargeBinaryType, LargeStringType>();
 }
 
+TEST_F(TestCast, BinaryOffsetWidths) {
+  CastOptions options;
+
+  std::vector<bool> is_valid = {true, false, true, true};
+  std::vector<std::string> values = {"ab", "", "", "cde"};
+
+  CheckCase<BinaryType, std::string, LargeBinaryType, std::string>(
+      binary(), values, is_valid, large_binary(), values, options);
+  CheckCase<LargeBinaryType, std::string, BinaryType, std::string>(
+      large_binary(), values, is_valid, binary(), values, options);
+  CheckCase<StringType, std::string, LargeStringType, std::string>(
+      utf8(), values, is_valid, large_utf8(), values, options);
+  CheckCase<LargeStringType, std::string, StringType, std::string>(
+      large_utf8(), values, is_valid, utf8(), values, options);
+
+  // The value data is shared
+  std::shared_ptr<Array> input, result;
+  ArrayFromVector<StringType, std::string>(utf8(), is_valid, values, &input);
+  ASSERT_OK(Cast(&ctx_, *input->Slice(1), large_utf8(), options, &result));
+  ASSERT_EQ(input->data()->buffers[2]->data() + 2,
+            result->data()->buffers[2]->data());
+}
+
 TEST_F(TestCast, ListToList) {
   CastOptions options;
   std::shared_ptr<Array> offsets;
@@ -0,0 +1,559 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/column_index.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// How the values of an indexed type are read and compared
+template <typename Type, typename Enable = void>
+struct IndexTraits {};
+
+template <typename Type>
+struct IndexTraits<Type, enable_if_has_c_type<Type>> {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using BuilderType = typename TypeTraits<Type>::BuilderType;
+  using ValueType = typename Type::c_type;
+
+  static ValueType Get(const ArrayType& array, int64_t i) { return array.Value(i); }
+
+  static ValueType FromScalar(const Scalar& scalar) {
+    return checked_cast<const typename TypeTraits<Type>::ScalarType&>(scalar).value;
+  }
+
+  // NaN is the only value which differs from itself
+  static bool IsNaN(ValueType value) { return !(value == value); }
+};
+
+template <typename Type>
+struct IndexTraits<Type, enable_if_base_binary<Type>> {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  using BuilderType = typename TypeTraits<Type>::BuilderType;
+  using ValueType = util::string_view;
+
+  static ValueType Get(const ArrayType& array, int64_t i) { return array.GetView(i); }
+
+  static ValueType FromScalar(const Scalar& scalar) {
+    const Buffer& value =
+        *checked_cast<const typename TypeTraits<Type>::ScalarType&>(scalar).value;
+    return util::string_view(reinterpret_cast<const char*>(value.data()),
+                             static_cast<size_t>(value.size()));
+  }
+
+  static bool IsNaN(ValueType) { return false; }
+};
+
+#define COLUMN_INDEX_TYPES(PROCESS) \
+  PROCESS(Int8Type)                 \
+  PROCESS(UInt8Type)                \
+  PROCESS(Int16Type)                \
+  PROCESS(UInt16Type)               \
+  PROCESS(Int32Type)                \
+  PROCESS(UInt32Type)               \
+  PROCESS(Int64Type)                \
+  PROCESS(UInt64Type)               \
+  PROCESS(FloatType)                \
+  PROCESS(DoubleType)               \
+  PROCESS(Date32Type)               \
+  PROCESS(Date64Type)               \
+  PROCESS(Time32Type)               \
+  PROCESS(Time64Type)               \
+  PROCESS(TimestampType)            \
+  PROCESS(DurationType)             \
+  PROCESS(BinaryType)               \
+  PROCESS(StringType)               \
+  PROCESS(LargeBinaryType)          \
+  PROCESS(LargeStringType)
+
+template <typename Type>
+std::vector<const typename IndexTraits<Type>::ArrayType*> TypedChunks(
+    const ChunkedArray& column) {
+  std::vector<const typename IndexTraits<Type>::ArrayType*> chunks;
+  for (const auto& chunk : column.chunks()) {
+    chunks.push_back(
+        checked_cast<const typename IndexTraits<Type>::ArrayType*>(chunk.get()));
+  }
+  return chunks;
+}
+
+std::shared_ptr<Schema> ZonesSchema(const std::shared_ptr<DataType>& type) {
+  return schema({field("offset", int64(), /*nullable=*/false),
+                 field("length", int64(), /*nullable=*/false),
+                 field("num_values", int64(), /*nullable=*/false), field("min", type),
+                 field("max", type)});
+}
+
+template <typename Type>
+Status BuildZones(FunctionContext* ctx, const ChunkedArray& column, int64_t zone_size,
+                  std::shared_ptr<RecordBatch>* out) {
+  using Traits = IndexTraits<Type>;
+  using ValueType = typename Traits::ValueType;
+
+  MemoryPool* pool = ctx->memory_pool();
+  Int64Builder offsets(pool);
+  Int64Builder lengths(pool);
+  Int64Builder num_values(pool);
+  std::unique_ptr<ArrayBuilder> min_builder;
+  std::unique_ptr<ArrayBuilder> max_builder;
+  RETURN_NOT_OK(MakeBuilder(pool, column.type(), &min_builder));
+  RETURN_NOT_OK(MakeBuilder(pool, column.type(), &max_builder));
+  auto mins = checked_cast<typename Traits::BuilderType*>(min_builder.get());
+  auto maxs = checked_cast<typename Traits::BuilderType*>(max_builder.get());
+
+  int64_t chunk_offset = 0;
+  for (const auto* array : TypedChunks<Type>(column)) {
+    for (int64_t start = 0; start < array->length(); start += zone_size) {
+      const int64_t end = std::min(start + zone_size, array->length());
+      int64_t count = 0;
+      ValueType min{};
+      ValueType max{};
+      for (int64_t i = start; i < end; ++i) {
+        if (array->IsNull(i)) {
+          continue;
+        }
+        const ValueType value = Traits::Get(*array, i);
+        if (Traits::IsNaN(value)) {
+          continue;
+        }
+        if (count++ == 0) {
+          min = max = value;
+        } else if (value < min) {
+          min = value;
+        } else if (max < value) {
+          max = value;
+        }
+      }
+      RETURN_NOT_OK(offsets.Append(chunk_offset + start));
+      RETURN_NOT_OK(lengths.Append(end - start));
+      RETURN_NOT_OK(num_values.Append(count));
+      if (count > 0) {
+        RETURN_NOT_OK(mins->Append(min));
+        RETURN_NOT_OK(maxs->Append(max));
+      } else {
+        RETURN_NOT_OK(mins->AppendNull());
+        RETURN_NOT_OK(maxs->AppendNull());
+      }
+    }
+    chunk_offset += array->length();
+  }
+
+  ArrayVector columns(5);
+  RETURN_NOT_OK(offsets.Finish(&columns[0]));
+  RETURN_NOT_OK(lengths.Finish(&columns[1]));
+  RETURN_NOT_OK(num_values.Finish(&columns[2]));
+  RETURN_NOT_OK(mins->Finish(&columns[3]));
+  RETURN_NOT_OK(maxs->Finish(&columns[4]));
+  const int64_t num_zones = columns[0]->length();
+  *out = RecordBatch::Make(ZonesSchema(column.type()), num_zones, std::move(columns));
+  return Status::OK();
+}
+
+template <typename Type>
+Status BuildSortedIndices(FunctionContext* ctx, const ChunkedArray& column,
+                          std::shared_ptr<Array>* out) {
+  using Traits = IndexTraits<Type>;
+  using Entry = std::pair<typename Traits::ValueType, uint64_t>;
+
+  std::vector<Entry> entries;
+  entries.reserve(static_cast<size_t>(column.length() - column.null_count()));
+  uint64_t row = 0;
+  for (const auto* array : TypedChunks<Type>(column)) {
+    for (int64_t i = 0; i < array->length(); ++i, ++row) {
+      if (array->IsValid(i) && !Traits::IsNaN(Traits::Get(*array, i))) {
+        entries.emplace_back(Traits::Get(*array, i), row);
+      }
+    }
+  }
+  std::stable_sort(entries.begin(), entries.end(),
+                   [](const Entry& a, const Entry& b) { return a.first < b.first; });
+
+  TypedBufferBuilder<uint64_t> indices(ctx->memory_pool());
+  RETURN_NOT_OK(indices.Reserve(static_cast<int64_t>(entries.size())));
+  for (const Entry& entry : entries) {
+    indices.UnsafeAppend(entry.second);
+  }
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(indices.Finish(&buffer));
+  *out = std::make_shared<UInt64Array>(static_cast<int64_t>(entries.size()), buffer);
+  return Status::OK();
+}
+
+// A range of values of an indexed type
+template <typename Type>
+class TypedRange {
+ public:
+  using Traits = IndexTraits<Type>;
+  using ValueType = typename Traits::ValueType;
+
+  explicit TypedRange(const IndexRange& range)
+      : has_lower_(range.lower != nullptr),
+        lower_inclusive_(range.lower_inclusive),
+        has_upper_(range.upper != nullptr),
+        upper_inclusive_(range.upper_inclusive),
+        empty_(false) {
+    if (has_lower_) {
+      empty_ |= !range.lower->is_valid;
+      if (range.lower->is_valid) {
+        lower_ = Traits::FromScalar(*range.lower);
+        empty_ |= Traits::IsNaN(lower_);
+      }
+    }
+    if (has_upper_) {
+      empty_ |= !range.upper->is_valid;
+      if (range.upper->is_valid) {
+        upper_ = Traits::FromScalar(*range.upper);
+        empty_ |= Traits::IsNaN(upper_);
+      }
+    }
+    if (!empty_ && has_lower_ && has_upper_) {
+      empty_ = upper_ < lower_ ||
+               (!(lower_ < upper_) && !(lower_inclusive_ && upper_inclusive_));
+    }
+  }
+
+  // Whether nothing matches, e.g. for a null bound
+  bool empty() const { return empty_; }
+
+  bool AboveLower(const ValueType& value) const {
+    return !has_lower_ || lower_ < value || (lower_inclusive_ && !(value < lower_));
+  }
+
+  bool BelowUpper(const ValueType& value) const {
+    return !has_upper_ || value < upper_ || (upper_inclusive_ && !(upper_ < value));
+  }
+
+  bool Contains(const ValueType& value) const {
+    return AboveLower(value) && BelowUpper(value);
+  }
+
+ private:
+  bool has_lower_;
+  bool lower_inclusive_;
+  bool has_upper_;
+  bool upper_inclusive_;
+  bool empty_;
+  ValueType lower_{};
+  ValueType upper_{};
+};
+
+Status FinishIndices(TypedBufferBuilder<uint64_t>* builder, std::shared_ptr<Array>* out) {
+  const int64_t length = builder->length();
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(builder->Finish(&buffer));
+  *out = std::make_shared<UInt64Array>(length, buffer);
+  return Status::OK();
+}
+
+}  // namespace
+
+class ColumnIndex::Impl {
+ public:
+  Impl(std::shared_ptr<ChunkedArray> column, std::shared_ptr<RecordBatch> zones,
+       std::shared_ptr<Array> sorted_indices)
+      : column_(std::move(column)),
+        zones_(std::move(zones)),
+        sorted_indices_(std::move(sorted_indices)) {}
+
+  // Check that the zones and the sorted indices fit the column
+  Status Init() {
+    if (!zones_->schema()->Equals(*ZonesSchema(column_->type()),
+                                  /*check_metadata=*/false)) {
+      return Status::Invalid("Zones of schema ", zones_->schema()->ToString(),
+                             " don't fit a column of type ", *column_->type());
+    }
+    chunk_offsets_.push_back(0);
+    for (const auto& chunk : column_->chunks()) {
+      chunk_offsets_.push_back(chunk_offsets_.back() + chunk->length());
+    }
+
+    const auto& offsets = checked_cast<const Int64Array&>(*zones_->column(0));
+    const auto& lengths = checked_cast<const Int64Array&>(*zones_->column(1));
+    const auto& num_values = checked_cast<const Int64Array&>(*zones_->column(2));
+    int64_t expected_offset = 0;
+    for (int64_t i = 0; i < zones_->num_rows(); ++i) {
+      // Each zone lies within a chunk, right after the previous zone
+      auto next_chunk = std::upper_bound(chunk_offsets_.begin(), chunk_offsets_.end(),
+                                         offsets.Value(i));
+      if (offsets.IsNull(i) || offsets.Value(i) != expected_offset ||
+          next_chunk == chunk_offsets_.end() || lengths.Value(i) <= 0 ||
+          offsets.Value(i) + lengths.Value(i) > *next_chunk ||
+          num_values.Value(i) > lengths.Value(i)) {
+        return Status::Invalid("Zone ", i, " doesn't fit the chunks of the column");
+      }
+      zone_chunks_.push_back(
+          static_cast<int>(next_chunk - chunk_offsets_.begin()) - 1);
+      expected_offset += lengths.Value(i);
+    }
+    if (expected_offset != column_->length()) {
+      return Status::Invalid("Zones cover ", expected_offset, " rows of a column of ",
+                             column_->length());
+    }
+
+    if (sorted_indices_ != nullptr) {
+      if (sorted_indices_->type_id() != Type::UINT64 ||
+          sorted_indices_->null_count() != 0 ||
+          sorted_indices_->length() > column_->length()) {
+        return Status::Invalid("Sorted indices don't fit the column");
+      }
+      const auto& indices = checked_cast<const UInt64Array&>(*sorted_indices_);
+      for (int64_t i = 0; i < indices.length(); ++i) {
+        if (indices.Value(i) >= static_cast<uint64_t>(column_->length())) {
+          return Status::Invalid("Sorted index ", indices.Value(i), " out of bounds");
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  Status Lookup(FunctionContext* ctx, const TypedRange<Type>& range,
+                std::shared_ptr<Array>* out, IndexScanStats* stats) const {
+    TypedBufferBuilder<uint64_t> indices(ctx->memory_pool());
+    if (range.empty()) {
+      return FinishIndices(&indices, out);
+    }
+    if (sorted_indices_ != nullptr) {
+      stats->used_sorted = true;
+      RETURN_NOT_OK(LookupSorted(range, &indices));
+    } else {
+      RETURN_NOT_OK(LookupZones(range, &indices, stats));
+    }
+    return FinishIndices(&indices, out);
+  }
+
+  const std::shared_ptr<ChunkedArray>& column() const { return column_; }
+
+  const std::shared_ptr<RecordBatch>& zones() const { return zones_; }
+
+  const std::shared_ptr<Array>& sorted_indices() const { return sorted_indices_; }
+
+ private:
+  template <typename Type>
+  Status LookupZones(const TypedRange<Type>& range, TypedBufferBuilder<uint64_t>* out,
+                     IndexScanStats* stats) const {
+    using Traits = IndexTraits<Type>;
+    using ArrayType = typename Traits::ArrayType;
+
+    const auto chunks = TypedChunks<Type>(*column_);
+    const auto& offsets = checked_cast<const Int64Array&>(*zones_->column(0));
+    const auto& lengths = checked_cast<const Int64Array&>(*zones_->column(1));
+    const auto& num_values = checked_cast<const Int64Array&>(*zones_->column(2));
+    const auto& mins = checked_cast<const ArrayType&>(*zones_->column(3));
+    const auto& maxs = checked_cast<const ArrayType&>(*zones_->column(4));
+
+    for (int64_t zone = 0; zone < zones_->num_rows(); ++zone) {
+      const int64_t offset = offsets.Value(zone);
+      const int64_t length = lengths.Value(zone);
+      if (num_values.Value(zone) == 0 || !range.BelowUpper(Traits::Get(mins, zone)) ||
+          !range.AboveLower(Traits::Get(maxs, zone))) {
+        ++stats->zones_skipped;
+        continue;
+      }
+      if (num_values.Value(zone) == length && range.Contains(Traits::Get(mins, zone)) &&
+          range.Contains(Traits::Get(maxs, zone))) {
+        ++stats->zones_matched;
+        RETURN_NOT_OK(out->Reserve(length));
+        for (int64_t i = 0; i < length; ++i) {
+          out->UnsafeAppend(static_cast<uint64_t>(offset + i));
+        }
+        continue;
+      }
+      ++stats->zones_scanned;
+      const int chunk_index = zone_chunks_[zone];
+      const ArrayType& chunk = *chunks[chunk_index];
+      const int64_t start = offset - chunk_offsets_[chunk_index];
+      for (int64_t i = start; i < start + length; ++i) {
+        if (chunk.IsValid(i)) {
+          const auto value = Traits::Get(chunk, i);
+          if (!Traits::IsNaN(value) && range.Contains(value)) {
+            RETURN_NOT_OK(
+                out->Append(static_cast<uint64_t>(chunk_offsets_[chunk_index] + i)));
+          }
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename Type>
+  Status LookupSorted(const TypedRange<Type>& range,
+                      TypedBufferBuilder<uint64_t>* out) const {
+    using Traits = IndexTraits<Type>;
+
+    const auto chunks = TypedChunks<Type>(*column_);
+    const uint64_t* sorted =
+        checked_cast<const UInt64Array&>(*sorted_indices_).raw_values();
+    auto value_at = [&](int64_t position) {
+      const int64_t row = static_cast<int64_t>(sorted[position]);
+      const auto chunk_index =
+          std::upper_bound(chunk_offsets_.begin(), chunk_offsets_.end(), row) -
+          chunk_offsets_.begin() - 1;
+      return Traits::Get(*chunks[chunk_index], row - chunk_offsets_[chunk_index]);
+    };
+    // The first position in [begin, end) for which predicate is false, given
+    // that it is true before and false after it
+    auto partition_point = [&](int64_t begin, int64_t end, bool below_upper) {
+      while (begin < end) {
+        const int64_t middle = begin + (end - begin) / 2;
+        const auto value = value_at(middle);
+        if (below_upper ? range.BelowUpper(value) : !range.AboveLower(value)) {
+          begin = middle + 1;
+        } else {
+          end = middle;
+        }
+      }
+      return begin;
+    };
+
+    const int64_t num_sorted = sorted_indices_->length();
+    const int64_t begin = partition_point(0, num_sorted, /*below_upper=*/false);
+    const int64_t end = partition_point(begin, num_sorted, /*below_upper=*/true);
+    RETURN_NOT_OK(out->Reserve(end - begin));
+    uint64_t* first = out->mutable_data() + out->length();
+    out->UnsafeAppend(sorted + begin, end - begin);
+    // Return the rows in their order in the column
+    std::sort(first, first + (end - begin));
+    return Status::OK();
+  }
+
+  std::shared_ptr<ChunkedArray> column_;
+  std::shared_ptr<RecordBatch> zones_;
+  std::shared_ptr<Array> sorted_indices_;
+  // The index of the first row of each chunk, then the length of the column
+  std::vector<int64_t> chunk_offsets_;
+  // The chunk of each zone
+  std::vector<int> zone_chunks_;
+};
+
+ColumnIndex::ColumnIndex(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+ColumnIndex::~ColumnIndex() {}
+
+Status ColumnIndex::Make(FunctionContext* ctx,
+                         const std::shared_ptr<ChunkedArray>& column,
+                         const ColumnIndexOptions& options,
+                         std::shared_ptr<ColumnIndex>* out) {
+  if (options.zone_size <= 0) {
+    return Status::Invalid("Zone size must be positive, got ", options.zone_size);
+  }
+  std::shared_ptr<RecordBatch> zones;
+  std::shared_ptr<Array> sorted_indices;
+  switch (column->type()->id()) {
+#define PROCESS(InType)                                                           \
+  case InType::type_id:                                                           \
+    RETURN_NOT_OK(BuildZones<InType>(ctx, *column, options.zone_size, &zones));   \
+    if (options.sorted) {                                                         \
+      RETURN_NOT_OK(BuildSortedIndices<InType>(ctx, *column, &sorted_indices));   \
+    }                                                                             \
+    break;
+
+    COLUMN_INDEX_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      return Status::NotImplemented("ColumnIndex not implemented for type ",
+                                    column->type()->ToString());
+  }
+  return Make(column, zones, sorted_indices, out);
+}
+
+Status ColumnIndex::Make(const std::shared_ptr<ChunkedArray>& column,
+                         const std::shared_ptr<RecordBatch>& zones,
+                         const std::shared_ptr<Array>& sorted_indices,
+                         std::shared_ptr<ColumnIndex>* out) {
+  std::unique_ptr<Impl> impl(new Impl(column, zones, sorted_indices));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new ColumnIndex(std::move(impl)));
+  return Status::OK();
+}
+
+Status ColumnIndex::Lookup(FunctionContext* ctx, const Scalar& value,
+                           std::shared_ptr<Array>* indices,
+                           IndexScanStats* stats) const {
+  // The scalar is only borrowed for the duration of the lookup
+  std::shared_ptr<Scalar> bound(const_cast<Scalar*>(&value), [](Scalar*) {});
+  IndexRange range;
+  range.lower = range.upper = bound;
+  return Lookup(ctx, range, indices, stats);
+}
+
+Status ColumnIndex::Lookup(FunctionContext* ctx, const IndexRange& range,
+                           std::shared_ptr<Array>* indices,
+                           IndexScanStats* stats) const {
+  const auto& type = impl_->column()->type();
+  for (const auto& bound : {range.lower, range.upper}) {
+    if (bound != nullptr && !bound->type->Equals(*type)) {
+      return Status::TypeError("Cannot look up a value of type ", *bound->type,
+                               " in an index of type ", *type);
+    }
+  }
+  IndexScanStats local_stats;
+  if (stats == nullptr) {
+    stats = &local_stats;
+  }
+  *stats = IndexScanStats();
+  switch (type->id()) {
+#define PROCESS(InType)                                                         \
+  case InType::type_id:                                                         \
+    return impl_->Lookup<InType>(ctx, TypedRange<InType>(range), indices, stats);
+
+    COLUMN_INDEX_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("ColumnIndex not implemented for type ",
+                                type->ToString());
+}
+
+const std::shared_ptr<RecordBatch>& ColumnIndex::zones() const { return impl_->zones(); }
+
+const std::shared_ptr<Array>& ColumnIndex::sorted_indices() const {
+  return impl_->sorted_indices();
+}
+
+const std::shared_ptr<ChunkedArray>& ColumnIndex::column() const {
+  return impl_->column();
+}
+
+#undef COLUMN_INDEX_TYPES
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class ChunkedArray;
+class RecordBatch;
+struct Scalar;
+
+namespace io {
+
+class InputStream;
+class OutputStream;
+
+}  // namespace io
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Options for building a ColumnIndex
+struct ARROW_EXPORT ColumnIndexOptions {
+  ColumnIndexOptions() = default;
+
+  /// The number of rows per zone of the zone map.  Zones don't cross chunk
+  /// boundaries, so the last zone of each chunk may be shorter.
+  int64_t zone_size = 4096;
+
+  /// Whether to also build the permutation which sorts the column, so that
+  /// lookups are answered by binary search rather than by scanning zones
+  bool sorted = false;
+};
+
+/// \brief A range of values to look up in a ColumnIndex
+///
+/// A null bound leaves the range unbounded on its side.
+struct ARROW_EXPORT IndexRange {
+  std::shared_ptr<Scalar> lower;
+  bool lower_inclusive = true;
+  std::shared_ptr<Scalar> upper;
+  bool upper_inclusive = true;
+};
+
+/// \brief How a ColumnIndex answered a lookup
+struct ARROW_EXPORT IndexScanStats {
+  /// Whether the lookup was answered by binary search in the sorted
+  /// permutation, without consulting the zones
+  bool used_sorted = false;
+  /// The zones which could not match and were not read
+  int64_t zones_skipped = 0;
+  /// The zones which matched as a whole and were not read
+  int64_t zones_matched = 0;
+  /// The zones whose values were compared one by one
+  int64_t zones_scanned = 0;
+};
+
+/// \brief A secondary index over a column, answering point and range lookups
+/// without comparing every value of the column
+///
+/// The index is a zone map: the column is cut into zones of
+/// ColumnIndexOptions::zone_size rows, each with the minimum and maximum of
+/// its values.  A lookup skips the zones whose range of values doesn't
+/// intersect the looked-up range, takes the zones whose range of values lies
+/// within it as a whole, and only compares the values of the other zones.
+/// If ColumnIndexOptions::sorted, the index also holds the permutation which
+/// sorts the column, and lookups binary search it instead.
+///
+/// Lookups return the indices of the matching rows, in increasing order, as
+/// a UInt64Array to be passed to Take.  Nulls and NaNs never match.
+///
+/// Numeric, temporal and binary-like columns are supported.  The index
+/// refers to the column, which it keeps alive, and must be rebuilt when the
+/// column changes.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+class ARROW_EXPORT ColumnIndex {
+ public:
+  ~ColumnIndex();
+
+  /// \brief Build the index of a column
+  static Status Make(FunctionContext* ctx, const std::shared_ptr<ChunkedArray>& column,
+                     const ColumnIndexOptions& options,
+                     std::shared_ptr<ColumnIndex>* out);
+
+  /// \brief Make an index of a column from its zones and sorted indices, as
+  /// returned by zones() and sorted_indices(), e.g. after storing them
+  ///
+  /// Returns Invalid if they don't fit the column.
+  static Status Make(const std::shared_ptr<ChunkedArray>& column,
+                     const std::shared_ptr<RecordBatch>& zones,
+                     const std::shared_ptr<Array>& sorted_indices,
+                     std::shared_ptr<ColumnIndex>* out);
+
+  /// \brief Read an index written by Write, as an IPC stream
+  ///
+  /// Only available if Arrow is built with ARROW_IPC.
+  ///
+  /// \param[in] ctx the FunctionContext
+  /// \param[in] stream the stream to read from
+  /// \param[in] column the indexed column, which must have the type, the
+  /// length and the chunk lengths of the column the index was built on
+  /// \param[out] out the index
+  static Status Read(FunctionContext* ctx, io::InputStream* stream,
+                     const std::shared_ptr<ChunkedArray>& column,
+                     std::shared_ptr<ColumnIndex>* out);
+
+  /// \brief Write the index, without the column, as IPC streams, e.g. to a
+  /// file next to the IPC file of the column's table
+  ///
+  /// The zones are written as the record batch of a first stream, the sorted
+  /// permutation, if any, as that of a second one.  Only available if Arrow
+  /// is built with ARROW_IPC.
+  Status Write(io::OutputStream* stream) const;
+
+  /// \brief The indices of the rows equal to value
+  Status Lookup(FunctionContext* ctx, const Scalar& value,
+                std::shared_ptr<Array>* indices,
+                IndexScanStats* stats = NULLPTR) const;
+
+  /// \brief The indices of the rows whose value lies within range
+  Status Lookup(FunctionContext* ctx, const IndexRange& range,
+                std::shared_ptr<Array>* indices,
+                IndexScanStats* stats = NULLPTR) const;
+
+  /// \brief The zone map, with one row per zone and the columns "offset"
+  /// (the index of its first row), "length", "num_values" (its number of
+  /// values other than nulls and NaNs), "min" and "max" (null if num_values
+  /// is 0)
+  const std::shared_ptr<RecordBatch>& zones() const;
+
+  /// \brief The indices which sort the values other than nulls and NaNs,
+  /// as a UInt64Array, or nullptr if the index isn't sorted
+  const std::shared_ptr<Array>& sorted_indices() const;
+
+  const std::shared_ptr<ChunkedArray>& column() const;
+
+ private:
+  class Impl;
+  explicit ColumnIndex(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// The serialization of ColumnIndex, only built with ARROW_IPC
+
+#include "arrow/compute/kernels/column_index.h"
+
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+std::shared_ptr<Schema> SortedIndicesSchema() {
+  return schema({field("index", uint64(), /*nullable=*/false)});
+}
+
+Status WriteStream(io::OutputStream* stream, const std::shared_ptr<Schema>& schema,
+                   const RecordBatch* batch) {
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  RETURN_NOT_OK(ipc::RecordBatchStreamWriter::Open(stream, schema, &writer));
+  if (batch != nullptr) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+// Read the stream of at most one record batch at the position of stream,
+// leaving it at the end of the stream
+Status ReadStream(io::InputStream* stream, std::shared_ptr<RecordBatch>* out) {
+  std::shared_ptr<RecordBatchReader> reader;
+  RETURN_NOT_OK(ipc::RecordBatchStreamReader::Open(stream, &reader));
+  RETURN_NOT_OK(reader->ReadNext(out));
+  if (*out != nullptr) {
+    std::shared_ptr<RecordBatch> next;
+    RETURN_NOT_OK(reader->ReadNext(&next));
+    if (next != nullptr) {
+      return Status::Invalid("Expected a single record batch in a column index stream");
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status ColumnIndex::Write(io::OutputStream* stream) const {
+  RETURN_NOT_OK(WriteStream(stream, zones()->schema(), zones().get()));
+  std::shared_ptr<RecordBatch> sorted;
+  if (sorted_indices() != nullptr) {
+    sorted = RecordBatch::Make(SortedIndicesSchema(), sorted_indices()->length(),
+                               {sorted_indices()});
+  }
+  return WriteStream(stream, SortedIndicesSchema(), sorted.get());
+}
+
+Status ColumnIndex::Read(FunctionContext* ctx, io::InputStream* stream,
+                         const std::shared_ptr<ChunkedArray>& column,
+                         std::shared_ptr<ColumnIndex>* out) {
+  std::shared_ptr<RecordBatch> zones;
+  RETURN_NOT_OK(ReadStream(stream, &zones));
+  if (zones == nullptr) {
+    return Status::Invalid("Column index stream without zones");
+  }
+  std::shared_ptr<RecordBatch> sorted;
+  RETURN_NOT_OK(ReadStream(stream, &sorted));
+  std::shared_ptr<Array> sorted_indices;
+  if (sorted != nullptr) {
+    if (sorted->num_columns() != 1) {
+      return Status::Invalid("Sorted indices stream of ", sorted->num_columns(),
+                             " columns");
+    }
+    sorted_indices = sorted->column(0);
+  }
+  // Make checks that the zones and the sorted indices fit the column
+  return Make(column, zones, sorted_indices, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
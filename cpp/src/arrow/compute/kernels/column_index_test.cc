@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/column_index.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestColumnIndex : public ComputeFixture, public ::testing::Test {
+ protected:
+  std::shared_ptr<ChunkedArray> MakeColumn(const std::shared_ptr<DataType>& type,
+                                           const std::vector<std::string>& chunks) {
+    ArrayVector arrays;
+    for (const auto& json : chunks) {
+      arrays.push_back(ArrayFromJSON(type, json));
+    }
+    return std::make_shared<ChunkedArray>(arrays, type);
+  }
+
+  std::shared_ptr<ColumnIndex> MakeIndex(const std::shared_ptr<ChunkedArray>& column,
+                                         int64_t zone_size, bool sorted = false) {
+    ColumnIndexOptions options;
+    options.zone_size = zone_size;
+    options.sorted = sorted;
+    std::shared_ptr<ColumnIndex> index;
+    ABORT_NOT_OK(ColumnIndex::Make(&ctx_, column, options, &index));
+    return index;
+  }
+
+  void AssertLookup(const ColumnIndex& index, const IndexRange& range,
+                    const std::string& expected, IndexScanStats* stats = NULLPTR) {
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(index.Lookup(&ctx_, range, &indices, stats));
+    ASSERT_OK(indices->Validate());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *indices);
+  }
+
+  static IndexRange Range(std::shared_ptr<Scalar> lower, std::shared_ptr<Scalar> upper,
+                          bool lower_inclusive = true, bool upper_inclusive = true) {
+    IndexRange range;
+    range.lower = std::move(lower);
+    range.lower_inclusive = lower_inclusive;
+    range.upper = std::move(upper);
+    range.upper_inclusive = upper_inclusive;
+    return range;
+  }
+
+  static std::shared_ptr<Scalar> Int(int64_t value) {
+    return std::make_shared<Int64Scalar>(value);
+  }
+
+  static std::shared_ptr<Scalar> Str(std::string value) {
+    return std::make_shared<StringScalar>(Buffer::FromString(std::move(value)));
+  }
+};
+
+TEST_F(TestColumnIndex, Zones) {
+  auto column = MakeColumn(int64(), {"[1, 2, 3, 4]", "[10, 11, null, 13, 14]", "[]",
+                                     "[20, null, 22, 23]"});
+  auto index = MakeIndex(column, 2);
+
+  auto zones = index->zones();
+  ASSERT_EQ(7, zones->num_rows());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[0, 2, 4, 6, 8, 9, 11]"), *zones->column(0));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[2, 2, 2, 2, 1, 2, 2]"), *zones->column(1));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[2, 2, 2, 1, 1, 1, 2]"), *zones->column(2));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 3, 10, 13, 14, 20, 22]"),
+                    *zones->column(3));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[2, 4, 11, 13, 14, 20, 23]"),
+                    *zones->column(4));
+  ASSERT_EQ(nullptr, index->sorted_indices());
+
+  IndexScanStats stats;
+  AssertLookup(*index, Range(Int(10), Int(13)), "[4, 5, 7]", &stats);
+  ASSERT_FALSE(stats.used_sorted);
+  ASSERT_EQ(5, stats.zones_skipped);
+  ASSERT_EQ(1, stats.zones_matched);
+  ASSERT_EQ(1, stats.zones_scanned);
+
+  AssertLookup(*index, Range(Int(10), Int(13), false, false), "[5]");
+  AssertLookup(*index, Range(Int(14), nullptr), "[8, 9, 11, 12]");
+  AssertLookup(*index, Range(nullptr, Int(2), true, false), "[0]");
+  AssertLookup(*index, Range(nullptr, nullptr), "[0, 1, 2, 3, 4, 5, 7, 8, 9, 11, 12]");
+  AssertLookup(*index, Range(Int(5), Int(9)), "[]");
+  AssertLookup(*index, Range(Int(13), Int(10)), "[]");
+  AssertLookup(*index, Range(Int(13), Int(13), true, false), "[]");
+
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(index->Lookup(&ctx_, Int64Scalar(22), &indices, &stats));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[11]"), *indices);
+  ASSERT_EQ(6, stats.zones_skipped);
+  ASSERT_EQ(1, stats.zones_scanned);
+
+  // Nulls never match
+  ASSERT_OK(index->Lookup(&ctx_, Int64Scalar(0, /*is_valid=*/false), &indices));
+  ASSERT_EQ(0, indices->length());
+}
+
+TEST_F(TestColumnIndex, NaN) {
+  auto column = MakeColumn(float64(), {"[1.5, NaN, null, 2.5]", "[NaN, null]"});
+  for (bool sorted : {false, true}) {
+    auto index = MakeIndex(column, 4, sorted);
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[2, 0]"), *index->zones()->column(2));
+    AssertLookup(*index, Range(std::make_shared<DoubleScalar>(1.0), nullptr), "[0, 3]");
+    AssertLookup(*index, Range(std::make_shared<DoubleScalar>(NAN), nullptr), "[]");
+  }
+}
+
+TEST_F(TestColumnIndex, Sorted) {
+  auto column = MakeColumn(utf8(), {R"(["b", "a", null])", R"(["c", "a"])"});
+  auto index = MakeIndex(column, 2, /*sorted=*/true);
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 0, 3]"), *index->sorted_indices());
+
+  IndexScanStats stats;
+  std::shared_ptr<Array> indices;
+  ASSERT_OK(index->Lookup(&ctx_, *Str("a"), &indices, &stats));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4]"), *indices);
+  ASSERT_TRUE(stats.used_sorted);
+  ASSERT_EQ(0, stats.zones_scanned);
+
+  AssertLookup(*index, Range(Str("a"), nullptr, false), "[0, 3]");
+  AssertLookup(*index, Range(Str("aa"), Str("c"), true, false), "[0]");
+  AssertLookup(*index, Range(Str("d"), nullptr), "[]");
+  AssertLookup(*index, Range(nullptr, nullptr), "[0, 1, 3, 4]");
+}
+
+TEST_F(TestColumnIndex, SortedMatchesZones) {
+  random::RandomArrayGenerator rng(0x1D3);
+  ArrayVector chunks;
+  for (int64_t length : {1000, 0, 4000, 77}) {
+    chunks.push_back(rng.Int32(length, -100, 100, /*null_probability=*/0.1));
+  }
+  auto column = std::make_shared<ChunkedArray>(chunks);
+  auto zoned = MakeIndex(column, 256);
+  auto sorted = MakeIndex(column, 256, /*sorted=*/true);
+
+  for (int32_t lower = -110; lower <= 110; lower += 37) {
+    for (int32_t width : {0, 1, 10, 100}) {
+      auto range = Range(std::make_shared<Int32Scalar>(lower),
+                         std::make_shared<Int32Scalar>(lower + width));
+      std::shared_ptr<Array> expected;
+      std::shared_ptr<Array> actual;
+      ASSERT_OK(zoned->Lookup(&ctx_, range, &expected));
+      ASSERT_OK(sorted->Lookup(&ctx_, range, &actual));
+      AssertArraysEqual(*expected, *actual);
+
+      // Check against the column itself
+      const auto& values = checked_cast<const UInt64Array&>(*expected);
+      int64_t num_matching = 0;
+      int64_t row = 0;
+      for (const auto& chunk : chunks) {
+        const auto& array = checked_cast<const Int32Array&>(*chunk);
+        for (int64_t i = 0; i < array.length(); ++i, ++row) {
+          if (array.IsValid(i) && array.Value(i) >= lower &&
+              array.Value(i) <= lower + width) {
+            ASSERT_LT(num_matching, values.length());
+            ASSERT_EQ(static_cast<uint64_t>(row), values.Value(num_matching++));
+          }
+        }
+      }
+      ASSERT_EQ(num_matching, values.length());
+    }
+  }
+}
+
+TEST_F(TestColumnIndex, Errors) {
+  auto column = MakeColumn(int64(), {"[1, 2, 3]"});
+  ColumnIndexOptions options;
+  options.zone_size = 0;
+  std::shared_ptr<ColumnIndex> index;
+  ASSERT_RAISES(Invalid, ColumnIndex::Make(&ctx_, column, options, &index));
+
+  ASSERT_RAISES(NotImplemented,
+                ColumnIndex::Make(&ctx_, MakeColumn(boolean(), {"[true]"}),
+                                  ColumnIndexOptions(), &index));
+
+  index = MakeIndex(column, 2);
+  std::shared_ptr<Array> indices;
+  ASSERT_RAISES(TypeError, index->Lookup(&ctx_, Int32Scalar(1), &indices));
+
+  // Zones of another column
+  auto other = MakeColumn(int64(), {"[1]", "[2, 3]"});
+  ASSERT_RAISES(Invalid, ColumnIndex::Make(other, index->zones(), nullptr, &index));
+}
+
+TEST_F(TestColumnIndex, ReadWrite) {
+  auto column = MakeColumn(utf8(), {R"(["b", "a", null])", R"(["c", "a"])"});
+  for (bool sorted : {false, true}) {
+    auto index = MakeIndex(column, 2, sorted);
+    std::shared_ptr<io::BufferOutputStream> sink;
+    ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+    ASSERT_OK(index->Write(sink.get()));
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(sink->Finish(&buffer));
+
+    io::BufferReader source(buffer);
+    std::shared_ptr<ColumnIndex> read;
+    ASSERT_OK(ColumnIndex::Read(&ctx_, &source, column, &read));
+    ASSERT_TRUE(read->zones()->Equals(*index->zones()));
+    if (sorted) {
+      AssertArraysEqual(*index->sorted_indices(), *read->sorted_indices());
+    } else {
+      ASSERT_EQ(nullptr, read->sorted_indices());
+    }
+    AssertLookup(*read, Range(Str("a"), Str("b")), "[0, 1, 4]");
+
+    // The chunks of the column must be those the index was built on
+    io::BufferReader other_source(buffer);
+    auto rechunked = MakeColumn(utf8(), {R"(["b", "a"])", R"([null, "c", "a"])"});
+    ASSERT_RAISES(Invalid, ColumnIndex::Read(&ctx_, &other_source, rechunked, &read));
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
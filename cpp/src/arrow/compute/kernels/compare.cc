@@ -17,16 +17,29 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/run_length.h"
+#include "arrow/compute/kernels/selection_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 
 namespace compute {
 
+using internal::checked_cast;
+
 std::shared_ptr<DataType> CompareBinaryKernel::out_type() const {
   return compare_function_->out_type();
 }
@@ -57,18 +70,463 @@ Status CompareBinaryKernel::Call(FunctionContext* ctx, const Datum& left,
   return Status::Invalid("Invalid datum signature for CompareBinaryKernel");
 }
 
+namespace {
+
+// ----------------------------------------------------------------------
+// Comparison loops
+//
+// Each loop compares `length` values of `left` with the right operand, either
+// an array or a scalar, and writes one bit per value to a bitmap without
+// offset.  The SIMD loops handle whole blocks of values and return the number
+// of values processed, the rest is done by the portable loop.
+
+template <typename T>
+struct ArrayOperand {
+  T operator[](int64_t i) const { return values[i]; }
+
+  const T* values;
+};
+
+template <typename T>
+struct ScalarOperand {
+  T operator[](int64_t) const { return value; }
+
+  T value;
+};
+
+// a OP b is equivalent to b SwapOperands(OP) a
+constexpr CompareOperator SwapOperands(CompareOperator op) {
+  return op == GREATER
+             ? LESS
+             : op == GREATER_EQUAL
+                   ? LESS_EQUAL
+                   : op == LESS ? GREATER : op == LESS_EQUAL ? GREATER_EQUAL : op;
+}
+
+// Compare the values from `offset` (a multiple of 8) on, a byte at a time.
+// Branch-free so that compilers can vectorize it for any target.
+template <typename T, CompareOperator Op, typename Right>
+void CompareBytes(const T* left, const Right& right, int64_t offset, int64_t length,
+                  uint8_t* out) {
+  int64_t i = offset;
+  for (; i + 8 <= length; i += 8) {
+    uint8_t byte = 0;
+    for (int j = 0; j < 8; ++j) {
+      byte |= static_cast<uint8_t>(Comparator<T, Op>::Compare(left[i + j], right[i + j])
+                                   << j);
+    }
+    out[i / 8] = byte;
+  }
+  if (i < length) {
+    uint8_t byte = 0;
+    for (int j = 0; i + j < length; ++j) {
+      byte |= static_cast<uint8_t>(Comparator<T, Op>::Compare(left[i + j], right[i + j])
+                                   << j);
+    }
+    out[i / 8] = byte;
+  }
+}
+
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+
+// The x86 comparison predicates matching the C++ operators, including for NaNs
+template <CompareOperator Op>
+struct X86Predicate;
+
+template <>
+struct X86Predicate<EQUAL> {
+  static constexpr int kInt = _MM_CMPINT_EQ;
+  static constexpr int kFloat = _CMP_EQ_OQ;
+};
+
+template <>
+struct X86Predicate<NOT_EQUAL> {
+  static constexpr int kInt = _MM_CMPINT_NE;
+  static constexpr int kFloat = _CMP_NEQ_UQ;
+};
+
+template <>
+struct X86Predicate<GREATER> {
+  static constexpr int kInt = _MM_CMPINT_NLE;
+  static constexpr int kFloat = _CMP_GT_OQ;
+};
+
+template <>
+struct X86Predicate<GREATER_EQUAL> {
+  static constexpr int kInt = _MM_CMPINT_NLT;
+  static constexpr int kFloat = _CMP_GE_OQ;
+};
+
+template <>
+struct X86Predicate<LESS> {
+  static constexpr int kInt = _MM_CMPINT_LT;
+  static constexpr int kFloat = _CMP_LT_OQ;
+};
+
+template <>
+struct X86Predicate<LESS_EQUAL> {
+  static constexpr int kInt = _MM_CMPINT_LE;
+  static constexpr int kFloat = _CMP_LE_OQ;
+};
+
+// AVX2 integer operations by integer width
+template <int kSize>
+struct Avx2IntOps;
+
+template <>
+struct Avx2IntOps<1> {
+  static constexpr int kLanes = 32;
+  ARROW_TARGET_AVX2 static __m256i Set1(int64_t v) {
+    return _mm256_set1_epi8(static_cast<char>(v));
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpEq(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi8(a, b);
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpGt(__m256i a, __m256i b) {
+    return _mm256_cmpgt_epi8(a, b);
+  }
+  ARROW_TARGET_AVX2 static uint32_t MoveMask(__m256i v) {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+  }
+};
+
+template <>
+struct Avx2IntOps<2> {
+  static constexpr int kLanes = 16;
+  ARROW_TARGET_AVX2 static __m256i Set1(int64_t v) {
+    return _mm256_set1_epi16(static_cast<int16_t>(v));
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpEq(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi16(a, b);
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpGt(__m256i a, __m256i b) {
+    return _mm256_cmpgt_epi16(a, b);
+  }
+  ARROW_TARGET_AVX2 static uint32_t MoveMask(__m256i v) {
+    // Narrow the lanes to bytes first, there is no 16-bit movemask
+    const __m128i bytes =
+        _mm_packs_epi16(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+    return static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+  }
+};
+
+template <>
+struct Avx2IntOps<4> {
+  static constexpr int kLanes = 8;
+  ARROW_TARGET_AVX2 static __m256i Set1(int64_t v) {
+    return _mm256_set1_epi32(static_cast<int32_t>(v));
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpEq(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi32(a, b);
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpGt(__m256i a, __m256i b) {
+    return _mm256_cmpgt_epi32(a, b);
+  }
+  ARROW_TARGET_AVX2 static uint32_t MoveMask(__m256i v) {
+    return static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(v)));
+  }
+};
+
+template <>
+struct Avx2IntOps<8> {
+  static constexpr int kLanes = 4;
+  ARROW_TARGET_AVX2 static __m256i Set1(int64_t v) {
+    return _mm256_set1_epi64x(static_cast<long long>(v));  // NOLINT
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpEq(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi64(a, b);
+  }
+  ARROW_TARGET_AVX2 static __m256i CmpGt(__m256i a, __m256i b) {
+    return _mm256_cmpgt_epi64(a, b);
+  }
+  ARROW_TARGET_AVX2 static uint32_t MoveMask(__m256i v) {
+    return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(v)));
+  }
+};
+
+// Load, broadcast and compare vectors of T, the comparison yielding one bit
+// per lane
+template <typename T, typename Enable = void>
+struct Avx2Traits {
+  using Ops = Avx2IntOps<sizeof(T)>;
+  using Vec = __m256i;
+  static constexpr int kLanes = Ops::kLanes;
+
+  // AVX2 only has signed integer comparisons, so unsigned integers are
+  // compared with their sign bit flipped
+  ARROW_TARGET_AVX2 static Vec Bias(Vec v) {
+    using SignedT = typename std::make_signed<T>::type;
+    return std::is_signed<T>::value
+               ? v
+               : _mm256_xor_si256(v, Ops::Set1(std::numeric_limits<SignedT>::min()));
+  }
+  ARROW_TARGET_AVX2 static Vec Load(const T* values) {
+    return Bias(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+  }
+  ARROW_TARGET_AVX2 static Vec Set1(T value) { return Bias(Ops::Set1(value)); }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX2 static uint32_t Compare(Vec a, Vec b) {
+    constexpr uint32_t kLaneMask = kLanes == 32 ? ~0U : (1U << kLanes) - 1;
+    switch (Op) {
+      case EQUAL:
+        return Ops::MoveMask(Ops::CmpEq(a, b));
+      case NOT_EQUAL:
+        return ~Ops::MoveMask(Ops::CmpEq(a, b)) & kLaneMask;
+      case GREATER:
+        return Ops::MoveMask(Ops::CmpGt(a, b));
+      case GREATER_EQUAL:
+        return ~Ops::MoveMask(Ops::CmpGt(b, a)) & kLaneMask;
+      case LESS:
+        return Ops::MoveMask(Ops::CmpGt(b, a));
+      case LESS_EQUAL:
+        return ~Ops::MoveMask(Ops::CmpGt(a, b)) & kLaneMask;
+    }
+    return 0;
+  }
+};
+
+template <>
+struct Avx2Traits<float> {
+  using Vec = __m256;
+  static constexpr int kLanes = 8;
+
+  ARROW_TARGET_AVX2 static Vec Load(const float* values) {
+    return _mm256_loadu_ps(values);
+  }
+  ARROW_TARGET_AVX2 static Vec Set1(float value) { return _mm256_set1_ps(value); }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX2 static uint32_t Compare(Vec a, Vec b) {
+    return static_cast<uint32_t>(
+        _mm256_movemask_ps(_mm256_cmp_ps(a, b, X86Predicate<Op>::kFloat)));
+  }
+};
+
+template <>
+struct Avx2Traits<double> {
+  using Vec = __m256d;
+  static constexpr int kLanes = 4;
+
+  ARROW_TARGET_AVX2 static Vec Load(const double* values) {
+    return _mm256_loadu_pd(values);
+  }
+  ARROW_TARGET_AVX2 static Vec Set1(double value) { return _mm256_set1_pd(value); }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX2 static uint32_t Compare(Vec a, Vec b) {
+    return static_cast<uint32_t>(
+        _mm256_movemask_pd(_mm256_cmp_pd(a, b, X86Predicate<Op>::kFloat)));
+  }
+};
+
+template <typename T>
+ARROW_TARGET_AVX2 typename Avx2Traits<T>::Vec LoadAvx2(const ArrayOperand<T>& right,
+                                                        int64_t i) {
+  return Avx2Traits<T>::Load(right.values + i);
+}
+
+template <typename T>
+ARROW_TARGET_AVX2 typename Avx2Traits<T>::Vec LoadAvx2(const ScalarOperand<T>& right,
+                                                        int64_t) {
+  return Avx2Traits<T>::Set1(right.value);
+}
+
+// Compare blocks of 32 values, yielding 32 bits at a time
+template <typename T, CompareOperator Op, typename Right>
+ARROW_TARGET_AVX2 int64_t CompareAvx2(const T* left, const Right& right, int64_t length,
+                                      uint8_t* out) {
+  using Traits = Avx2Traits<T>;
+  constexpr int kBlockSize = 32;
+  const int64_t num_blocks = length / kBlockSize;
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    uint32_t bits = 0;
+    for (int j = 0; j < kBlockSize / Traits::kLanes; ++j) {
+      const int64_t i = block * kBlockSize + j * Traits::kLanes;
+      bits |= Traits::template Compare<Op>(Traits::Load(left + i), LoadAvx2(right, i))
+              << (j * Traits::kLanes);
+    }
+    std::memcpy(out + block * sizeof(bits), &bits, sizeof(bits));
+  }
+  return num_blocks * kBlockSize;
+}
+
+// Load, broadcast and compare vectors of T, the comparison yielding a mask
+// with one bit per lane
+template <typename T, int kSize = sizeof(T), typename Enable = void>
+struct Avx512Traits;
+
+template <typename T>
+struct Avx512Traits<T, 1, typename std::enable_if<std::is_integral<T>::value>::type> {
+  using Vec = __m512i;
+  static constexpr int kLanes = 64;
+
+  ARROW_TARGET_AVX512 static Vec Load(const T* values) {
+    return _mm512_loadu_si512(values);
+  }
+  ARROW_TARGET_AVX512 static Vec Set1(T value) {
+    return _mm512_set1_epi8(static_cast<char>(value));
+  }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX512 static uint64_t Compare(Vec a, Vec b) {
+    return std::is_signed<T>::value
+               ? _mm512_cmp_epi8_mask(a, b, X86Predicate<Op>::kInt)
+               : _mm512_cmp_epu8_mask(a, b, X86Predicate<Op>::kInt);
+  }
+};
+
+template <typename T>
+struct Avx512Traits<T, 2, typename std::enable_if<std::is_integral<T>::value>::type> {
+  using Vec = __m512i;
+  static constexpr int kLanes = 32;
+
+  ARROW_TARGET_AVX512 static Vec Load(const T* values) {
+    return _mm512_loadu_si512(values);
+  }
+  ARROW_TARGET_AVX512 static Vec Set1(T value) {
+    return _mm512_set1_epi16(static_cast<int16_t>(value));
+  }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX512 static uint64_t Compare(Vec a, Vec b) {
+    return std::is_signed<T>::value
+               ? _mm512_cmp_epi16_mask(a, b, X86Predicate<Op>::kInt)
+               : _mm512_cmp_epu16_mask(a, b, X86Predicate<Op>::kInt);
+  }
+};
+
+template <typename T>
+struct Avx512Traits<T, 4, typename std::enable_if<std::is_integral<T>::value>::type> {
+  using Vec = __m512i;
+  static constexpr int kLanes = 16;
+
+  ARROW_TARGET_AVX512 static Vec Load(const T* values) {
+    return _mm512_loadu_si512(values);
+  }
+  ARROW_TARGET_AVX512 static Vec Set1(T value) {
+    return _mm512_set1_epi32(static_cast<int32_t>(value));
+  }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX512 static uint64_t Compare(Vec a, Vec b) {
+    return std::is_signed<T>::value
+               ? _mm512_cmp_epi32_mask(a, b, X86Predicate<Op>::kInt)
+               : _mm512_cmp_epu32_mask(a, b, X86Predicate<Op>::kInt);
+  }
+};
+
+template <typename T>
+struct Avx512Traits<T, 8, typename std::enable_if<std::is_integral<T>::value>::type> {
+  using Vec = __m512i;
+  static constexpr int kLanes = 8;
+
+  ARROW_TARGET_AVX512 static Vec Load(const T* values) {
+    return _mm512_loadu_si512(values);
+  }
+  ARROW_TARGET_AVX512 static Vec Set1(T value) {
+    return _mm512_set1_epi64(static_cast<long long>(value));  // NOLINT
+  }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX512 static uint64_t Compare(Vec a, Vec b) {
+    return std::is_signed<T>::value
+               ? _mm512_cmp_epi64_mask(a, b, X86Predicate<Op>::kInt)
+               : _mm512_cmp_epu64_mask(a, b, X86Predicate<Op>::kInt);
+  }
+};
+
+template <>
+struct Avx512Traits<float> {
+  using Vec = __m512;
+  static constexpr int kLanes = 16;
+
+  ARROW_TARGET_AVX512 static Vec Load(const float* values) {
+    return _mm512_loadu_ps(values);
+  }
+  ARROW_TARGET_AVX512 static Vec Set1(float value) { return _mm512_set1_ps(value); }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX512 static uint64_t Compare(Vec a, Vec b) {
+    return _mm512_cmp_ps_mask(a, b, X86Predicate<Op>::kFloat);
+  }
+};
+
+template <>
+struct Avx512Traits<double> {
+  using Vec = __m512d;
+  static constexpr int kLanes = 8;
+
+  ARROW_TARGET_AVX512 static Vec Load(const double* values) {
+    return _mm512_loadu_pd(values);
+  }
+  ARROW_TARGET_AVX512 static Vec Set1(double value) { return _mm512_set1_pd(value); }
+
+  template <CompareOperator Op>
+  ARROW_TARGET_AVX512 static uint64_t Compare(Vec a, Vec b) {
+    return _mm512_cmp_pd_mask(a, b, X86Predicate<Op>::kFloat);
+  }
+};
+
+template <typename T>
+ARROW_TARGET_AVX512 typename Avx512Traits<T>::Vec LoadAvx512(
+    const ArrayOperand<T>& right, int64_t i) {
+  return Avx512Traits<T>::Load(right.values + i);
+}
+
+template <typename T>
+ARROW_TARGET_AVX512 typename Avx512Traits<T>::Vec LoadAvx512(
+    const ScalarOperand<T>& right, int64_t) {
+  return Avx512Traits<T>::Set1(right.value);
+}
+
+// Compare blocks of 64 values, yielding 64 bits at a time
+template <typename T, CompareOperator Op, typename Right>
+ARROW_TARGET_AVX512 int64_t CompareAvx512(const T* left, const Right& right,
+                                          int64_t length, uint8_t* out) {
+  using Traits = Avx512Traits<T>;
+  constexpr int kBlockSize = 64;
+  const int64_t num_blocks = length / kBlockSize;
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    uint64_t bits = 0;
+    for (int j = 0; j < kBlockSize / Traits::kLanes; ++j) {
+      const int64_t i = block * kBlockSize + j * Traits::kLanes;
+      bits |= Traits::template Compare<Op>(Traits::Load(left + i), LoadAvx512(right, i))
+              << (j * Traits::kLanes);
+    }
+    std::memcpy(out + block * sizeof(bits), &bits, sizeof(bits));
+  }
+  return num_blocks * kBlockSize;
+}
+
+#endif  // ARROW_HAVE_RUNTIME_X86_SIMD
+
+// Use the widest instruction set supported by the CPU, then finish with the
+// portable loop
+template <typename T, CompareOperator Op, typename Right>
+void CompareValues(const T* left, const Right& right, int64_t length, uint8_t* out) {
+  int64_t offset = 0;
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+  auto cpu_info = internal::CpuInfo::GetInstance();
+  if (cpu_info->IsSupported(internal::CpuInfo::AVX512F) &&
+      cpu_info->IsSupported(internal::CpuInfo::AVX512BW)) {
+    offset = CompareAvx512<T, Op>(left, right, length, out);
+  } else if (cpu_info->IsSupported(internal::CpuInfo::AVX2)) {
+    offset = CompareAvx2<T, Op>(left, right, length, out);
+  }
+#endif
+  CompareBytes<T, Op>(left, right, offset, length, out);
+}
+
+}  // namespace
+
 template <typename ArrowType, CompareOperator Op,
           typename ScalarType = typename TypeTraits<ArrowType>::ScalarType,
           typename T = typename TypeTraits<ArrowType>::CType>
 static Status CompareArrayScalar(const ArrayData& array, const ScalarType& scalar,
                                  uint8_t* output_bitmap) {
-  const T* left = array.GetValues<T>(1);
-  const T right = scalar.value;
-
-  internal::GenerateBitsUnrolled(
-      output_bitmap, 0, array.length,
-      [&left, right]() -> bool { return Comparator<T, Op>::Compare(*left++, right); });
-
+  CompareValues<T, Op>(array.GetValues<T>(1), ScalarOperand<T>{scalar.value},
+                       array.length, output_bitmap);
   return Status::OK();
 }
 
@@ -77,13 +535,9 @@ template <typename ArrowType, CompareOperator Op,
           typename T = typename TypeTraits<ArrowType>::CType>
 static Status CompareScalarArray(const ScalarType& scalar, const ArrayData& array,
                                  uint8_t* output_bitmap) {
-  const T left = scalar.value;
-  const T* right = array.GetValues<T>(1);
-
-  internal::GenerateBitsUnrolled(
-      output_bitmap, 0, array.length,
-      [left, &right]() -> bool { return Comparator<T, Op>::Compare(left, *right++); });
-
+  CompareValues<T, SwapOperands(Op)>(array.GetValues<T>(1),
+                                     ScalarOperand<T>{scalar.value}, array.length,
+                                     output_bitmap);
   return Status::OK();
 }
 
@@ -91,13 +545,8 @@ template <typename ArrowType, CompareOperator Op,
           typename T = typename TypeTraits<ArrowType>::CType>
 static Status CompareArrayArray(const ArrayData& lhs, const ArrayData& rhs,
                                 uint8_t* output_bitmap) {
-  const T* left = lhs.GetValues<T>(1);
-  const T* right = rhs.GetValues<T>(1);
-
-  internal::GenerateBitsUnrolled(output_bitmap, 0, lhs.length, [&left, &right]() -> bool {
-    return Comparator<T, Op>::Compare(*left++, *right++);
-  });
-
+  CompareValues<T, Op>(lhs.GetValues<T>(1), ArrayOperand<T>{rhs.GetValues<T>(1)},
+                       lhs.length, output_bitmap);
   return Status::OK();
 }
 
@@ -172,6 +621,113 @@ class CompareFunctionImpl final : public CompareFunction {
   FunctionContext* ctx_;
 };
 
+template <typename T, CompareOperator Op, typename Right>
+static void CompareSelectedValues(const T* left, const Right& right,
+                                  const int64_t* indices, int64_t length,
+                                  internal::FirstTimeBitmapWriter* writer) {
+  for (int64_t i = 0; i < length; ++i) {
+    const int64_t index = indices[i];
+    if (Comparator<T, Op>::Compare(left[index], right[index])) {
+      writer->Set();
+    }
+    writer->Next();
+  }
+}
+
+template <typename T, typename Right>
+static void CompareSelectedValues(CompareOperator op, const T* left, const Right& right,
+                                  const int64_t* indices, int64_t length,
+                                  internal::FirstTimeBitmapWriter* writer) {
+  switch (op) {
+    case EQUAL:
+      return CompareSelectedValues<T, EQUAL>(left, right, indices, length, writer);
+    case NOT_EQUAL:
+      return CompareSelectedValues<T, NOT_EQUAL>(left, right, indices, length, writer);
+    case GREATER:
+      return CompareSelectedValues<T, GREATER>(left, right, indices, length, writer);
+    case GREATER_EQUAL:
+      return CompareSelectedValues<T, GREATER_EQUAL>(left, right, indices, length,
+                                                     writer);
+    case LESS:
+      return CompareSelectedValues<T, LESS>(left, right, indices, length, writer);
+    case LESS_EQUAL:
+      return CompareSelectedValues<T, LESS_EQUAL>(left, right, indices, length, writer);
+  }
+}
+
+// Compare an array with an array or a scalar at the positions of a selection
+// vector, writing the comparison bits and their validity in a single pass
+template <typename ArrowType>
+static Status CompareSelected(FunctionContext* ctx, const Array& left, const Datum& right,
+                              CompareOperator op, const Array& selection,
+                              std::shared_ptr<ArrayData>* out) {
+  using T = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  const T* left_values = left.data()->GetValues<T>(1);
+  std::shared_ptr<Array> right_array;
+  bool right_is_valid = true;
+  if (right.kind() == Datum::ARRAY) {
+    right_array = right.make_array();
+    if (right_array->length() != left.length()) {
+      return Status::Invalid("Compared arrays must have the same length");
+    }
+  } else {
+    right_is_valid = right.scalar()->is_valid;
+  }
+  const ArrayOperand<T> right_values{
+      right_array ? right_array->data()->GetValues<T>(1) : nullptr};
+  const ScalarOperand<T> right_value{
+      right_array ? T() : checked_cast<const ScalarType&>(*right.scalar()).value};
+
+  const int64_t length = selection.length();
+  std::shared_ptr<Buffer> values, validity;
+  RETURN_NOT_OK(AllocateBitmap(ctx->memory_pool(), length, &values));
+  internal::FirstTimeBitmapWriter values_writer(values->mutable_data(), 0, length);
+
+  const bool may_have_nulls = selection.null_count() != 0 || left.null_count() != 0 ||
+                              !right_is_valid ||
+                              (right_array && right_array->null_count() != 0);
+  int64_t null_count = 0;
+  if (may_have_nulls) {
+    RETURN_NOT_OK(AllocateBitmap(ctx->memory_pool(), length, &validity));
+  }
+  internal::FirstTimeBitmapWriter validity_writer(
+      may_have_nulls ? validity->mutable_data() : nullptr, 0,
+      may_have_nulls ? length : 0);
+
+  RETURN_NOT_OK(detail::VisitSelection(
+      selection, left.length(),
+      [&](int64_t offset, const int64_t* indices, int64_t batch_length) {
+        if (right_array) {
+          CompareSelectedValues(op, left_values, right_values, indices, batch_length,
+                                &values_writer);
+        } else {
+          CompareSelectedValues(op, left_values, right_value, indices, batch_length,
+                                &values_writer);
+        }
+        if (!may_have_nulls) {
+          return Status::OK();
+        }
+        for (int64_t i = 0; i < batch_length; ++i) {
+          const int64_t index = indices[i];
+          if (right_is_valid && selection.IsValid(offset + i) && left.IsValid(index) &&
+              (!right_array || right_array->IsValid(index))) {
+            validity_writer.Set();
+          } else {
+            ++null_count;
+          }
+          validity_writer.Next();
+        }
+        return Status::OK();
+      }));
+  values_writer.Finish();
+  validity_writer.Finish();
+
+  *out = ArrayData::Make(boolean(), length, {validity, values}, null_count);
+  return Status::OK();
+}
+
 template <typename ArrowType, CompareOperator Op>
 static inline std::shared_ptr<CompareFunction> MakeCompareFunctionTypeOp(
     FunctionContext* ctx) {
@@ -238,11 +794,130 @@ std::shared_ptr<CompareFunction> MakeCompareFunction(FunctionContext* ctx,
   }
 }
 
+template <typename T>
+static bool CompareWithOperator(CompareOperator op, const T& lhs, const T& rhs) {
+  switch (op) {
+    case EQUAL:
+      return Comparator<T, EQUAL>::Compare(lhs, rhs);
+    case NOT_EQUAL:
+      return Comparator<T, NOT_EQUAL>::Compare(lhs, rhs);
+    case GREATER:
+      return Comparator<T, GREATER>::Compare(lhs, rhs);
+    case GREATER_EQUAL:
+      return Comparator<T, GREATER_EQUAL>::Compare(lhs, rhs);
+    case LESS:
+      return Comparator<T, LESS>::Compare(lhs, rhs);
+    case LESS_EQUAL:
+      return Comparator<T, LESS_EQUAL>::Compare(lhs, rhs);
+  }
+  return false;
+}
+
+// Compare binary-like values with a scalar, bytewise
+template <typename ArrayType, typename ScalarType>
+static Status CompareBinaryArrayScalar(FunctionContext* ctx, const Array& values,
+                                       const Scalar& scalar, CompareOperator op,
+                                       std::shared_ptr<Array>* out) {
+  const auto& array = checked_cast<const ArrayType&>(values);
+  BooleanBuilder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(array.length()));
+  if (!scalar.is_valid) {
+    RETURN_NOT_OK(builder.AppendNulls(array.length()));
+    return builder.Finish(out);
+  }
+  const auto& buffer = *checked_cast<const ScalarType&>(scalar).value;
+  const util::string_view value(reinterpret_cast<const char*>(buffer.data()),
+                                static_cast<size_t>(buffer.size()));
+  for (int64_t i = 0; i < array.length(); ++i) {
+    if (array.IsNull(i)) {
+      builder.UnsafeAppendNull();
+    } else {
+      builder.UnsafeAppend(CompareWithOperator(op, array.GetView(i), value));
+    }
+  }
+  return builder.Finish(out);
+}
+
+// Compare the values of a dictionary with a scalar
+static Status CompareDictionaryScalar(FunctionContext* ctx, const Array& dictionary,
+                                      const std::shared_ptr<Scalar>& scalar,
+                                      CompareOperator op, std::shared_ptr<Array>* out) {
+  if (!scalar->type->Equals(dictionary.type())) {
+    return Status::TypeError("Cannot compare dictionary values of type ",
+                             *dictionary.type(), " with a scalar of type ",
+                             *scalar->type);
+  }
+  switch (dictionary.type_id()) {
+    case Type::BINARY:
+    case Type::STRING:
+      return CompareBinaryArrayScalar<BinaryArray, BinaryScalar>(ctx, dictionary,
+                                                                 *scalar, op, out);
+    case Type::FIXED_SIZE_BINARY:
+      return CompareBinaryArrayScalar<FixedSizeBinaryArray, FixedSizeBinaryScalar>(
+          ctx, dictionary, *scalar, op, out);
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return CompareBinaryArrayScalar<LargeBinaryArray, LargeBinaryScalar>(
+          ctx, dictionary, *scalar, op, out);
+    default: {
+      Datum result;
+      RETURN_NOT_OK(Compare(ctx, Datum(dictionary.data()), Datum(scalar),
+                            CompareOptions(op), &result));
+      *out = result.make_array();
+      return Status::OK();
+    }
+  }
+}
+
+// Compare a dictionary-encoded array with a scalar through the dictionary: the
+// scalar is compared once with each dictionary value, and indices only look up
+// the result
+static Status CompareDictionary(FunctionContext* ctx, const Datum& array,
+                                const std::shared_ptr<Scalar>& scalar,
+                                CompareOperator op, Datum* out) {
+  const BooleanScalar null_result(false, false);
+  return detail::EvaluateOnDictionary(
+      ctx, array,
+      [&](const Array& dictionary, std::shared_ptr<Array>* dictionary_result) {
+        return CompareDictionaryScalar(ctx, dictionary, scalar, op, dictionary_result);
+      },
+      null_result, out);
+}
+
 ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out) {
   DCHECK(out);
 
+  if (left.type()->id() == Type::DICTIONARY && right.kind() == Datum::SCALAR) {
+    return CompareDictionary(context, left, right.scalar(), options.op, out);
+  }
+  if (right.type()->id() == Type::DICTIONARY && left.kind() == Datum::SCALAR) {
+    return CompareDictionary(context, right, left.scalar(), SwapOperands(options.op),
+                             out);
+  }
+  // Run-length encoded arrays are compared with a scalar once per run
+  if (IsRunLengthEncoded(*left.type()) && right.kind() == Datum::SCALAR) {
+    return detail::EvaluateOnRuns(
+        context, left, [&](const Array& values, std::shared_ptr<Array>* result) {
+          Datum result_datum;
+          RETURN_NOT_OK(Compare(context, values.data(), right, options, &result_datum));
+          *result = result_datum.make_array();
+          return Status::OK();
+        },
+        out);
+  }
+  if (IsRunLengthEncoded(*right.type()) && left.kind() == Datum::SCALAR) {
+    return detail::EvaluateOnRuns(
+        context, right, [&](const Array& values, std::shared_ptr<Array>* result) {
+          Datum result_datum;
+          RETURN_NOT_OK(Compare(context, left, values.data(), options, &result_datum));
+          *result = result_datum.make_array();
+          return Status::OK();
+        },
+        out);
+  }
+
   auto type = left.type();
   DCHECK(type->Equals(right.type()));
   // Requires that both types are equal.
@@ -260,5 +935,65 @@ Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
   return kernel.Call(context, left, right, out);
 }
 
+#define COMPARE_SELECTED_CASE(T)                                                         \
+  case T::type_id:                                                                       \
+    RETURN_NOT_OK(CompareSelected<T>(context, *array, other, op, selection, &out_data)); \
+    break;
+
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               const Array& selection, struct CompareOptions options, Datum* out) {
+  DCHECK(out);
+
+  auto type = left.type();
+  DCHECK(type->Equals(right.type()));
+
+  // Compare the array operand with the other one, swapping the operator if the
+  // array is on the right
+  std::shared_ptr<Array> array;
+  Datum other;
+  CompareOperator op = options.op;
+  if (left.kind() == Datum::ARRAY) {
+    array = left.make_array();
+    other = right;
+  } else if (right.kind() == Datum::ARRAY) {
+    array = right.make_array();
+    other = left;
+    op = SwapOperands(op);
+  }
+  if (array == nullptr ||
+      (other.kind() != Datum::ARRAY && other.kind() != Datum::SCALAR)) {
+    return Status::Invalid("Compare with a selection vector expects an array and "
+                           "an array or a scalar");
+  }
+
+  std::shared_ptr<ArrayData> out_data;
+  switch (type->id()) {
+    COMPARE_SELECTED_CASE(UInt8Type);
+    COMPARE_SELECTED_CASE(Int8Type);
+    COMPARE_SELECTED_CASE(UInt16Type);
+    COMPARE_SELECTED_CASE(Int16Type);
+    COMPARE_SELECTED_CASE(UInt32Type);
+    COMPARE_SELECTED_CASE(Int32Type);
+    COMPARE_SELECTED_CASE(UInt64Type);
+    COMPARE_SELECTED_CASE(Int64Type);
+    COMPARE_SELECTED_CASE(FloatType);
+    COMPARE_SELECTED_CASE(DoubleType);
+    COMPARE_SELECTED_CASE(Date32Type);
+    COMPARE_SELECTED_CASE(Date64Type);
+    COMPARE_SELECTED_CASE(TimestampType);
+    COMPARE_SELECTED_CASE(Time32Type);
+    COMPARE_SELECTED_CASE(Time64Type);
+    default:
+      return Status::NotImplemented("Compare not implemented for type ",
+                                    type->ToString());
+  }
+
+  *out = out_data;
+  return Status::OK();
+}
+
+#undef COMPARE_SELECTED_CASE
+
 }  // namespace compute
 }  // namespace arrow
@@ -166,11 +166,41 @@ std::shared_ptr<CompareFunction> MakeCompareFunction(FunctionContext* context,
 ///
 /// Note on floating point arrays, this uses ieee-754 compare semantics.
 ///
+/// A dictionary-encoded Array or ChunkedArray may also be compared with a
+/// Scalar of its value type, including binary and string types.  The scalar
+/// is then compared once with each dictionary value, and the dictionary
+/// indices are only mapped to these results.
+///
 /// \since 0.14.0
 /// \note API not yet finalized
 ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out);
 
+/// \brief Compare numeric values at the positions of a selection vector.
+///
+/// The output is a BooleanArray with one slot per index of the selection
+/// vector, comparing the left and right values at that index; a Scalar
+/// operand is compared as is.  The result is the same as comparing
+/// Take(left, selection) with Take(right, selection), without materializing
+/// the selected values.  Slots are null where the index or either value is
+/// null.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left datum to compare, an Array or a Scalar
+/// \param[in] right datum to compare, an Array or a Scalar of the same type
+///            than left Datum.  At least one of left and right must be an
+///            Array, and arrays must have the same length.
+/// \param[in] selection integer array of indices into the arrays, e.g. the
+///            output of FilterToIndices
+/// \param[in] options compare options
+/// \param[out] out resulting datum
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               const Array& selection, struct CompareOptions options, Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -25,12 +26,16 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -387,5 +392,223 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+// Run `func` with each of the SIMD instruction sets used by the kernels, from
+// the widest supported by the CPU down to none
+template <typename Func>
+static void ForEachInstructionSet(Func&& func) {
+  auto cpu_info = internal::CpuInfo::GetInstance();
+  const int64_t original_flags = cpu_info->hardware_flags();
+  {
+    SCOPED_TRACE("all instruction sets");
+    func();
+  }
+  cpu_info->EnableFeature(internal::CpuInfo::AVX512F | internal::CpuInfo::AVX512BW,
+                          false);
+  {
+    SCOPED_TRACE("without AVX-512");
+    func();
+  }
+  cpu_info->EnableFeature(internal::CpuInfo::AVX2, false);
+  {
+    SCOPED_TRACE("without AVX2");
+    func();
+  }
+  for (auto flag : {internal::CpuInfo::AVX2, internal::CpuInfo::AVX512F,
+                    internal::CpuInfo::AVX512BW}) {
+    if (original_flags & flag) {
+      cpu_info->EnableFeature(flag, true);
+    }
+  }
+}
+
+TYPED_TEST(TestNumericCompareKernel, CompareInstructionSets) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  // Lengths around the SIMD block sizes, with the extreme values of the type
+  // and small ones which often compare equal
+  const bool is_integer = std::is_integral<CType>::value;
+  const CType min = is_integer ? std::numeric_limits<CType>::min() : CType(-1000);
+  const CType max = is_integer ? std::numeric_limits<CType>::max() : CType(1000);
+  for (int64_t length : {1, 7, 8, 31, 32, 33, 63, 64, 65, 100, 127, 128, 129, 1000}) {
+    for (auto range : {std::make_pair(min, max), std::make_pair(CType(0), CType(3))}) {
+      auto lhs = rand.Numeric<TypeParam>(length + 3, range.first, range.second, 0.1);
+      auto rhs = rand.Numeric<TypeParam>(length + 3, range.first, range.second, 0.1);
+      auto scalar = Datum(
+          std::make_shared<ScalarType>(CType(range.first / 2 + range.second / 2)));
+      for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+        auto options = CompareOptions(op);
+        ForEachInstructionSet([&]() {
+          for (int64_t offset : {0, 3}) {
+            auto left = Datum(lhs->Slice(offset, length));
+            auto right = Datum(rhs->Slice(offset, length));
+            ValidateCompare<TypeParam>(&this->ctx_, options, left, scalar);
+            ValidateCompare<TypeParam>(&this->ctx_, options, scalar, left);
+            ValidateCompare<TypeParam>(&this->ctx_, options, left, right);
+          }
+        });
+      }
+    }
+  }
+}
+
+TYPED_TEST(TestNumericCompareKernel, CompareSelection) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  // Comparing at the positions of a selection vector is the same as comparing
+  // the taken values
+  auto AssertCompareSelection = [&](const Datum& left, const Datum& right,
+                                    const Array& selection, CompareOptions options) {
+    Datum expected, actual;
+    auto TakeOperand = [&](const Datum& operand) -> Datum {
+      if (operand.kind() != Datum::ARRAY) return operand;
+      std::shared_ptr<Array> taken;
+      ABORT_NOT_OK(
+          Take(&this->ctx_, *operand.make_array(), selection, TakeOptions(), &taken));
+      return Datum(taken);
+    };
+    ASSERT_OK(Compare(&this->ctx_, TakeOperand(left), TakeOperand(right), options,
+                      &expected));
+    ASSERT_OK(Compare(&this->ctx_, left, right, selection, options, &actual));
+    ASSERT_OK(actual.make_array()->Validate());
+    AssertArraysEqual(*expected.make_array(), *actual.make_array());
+  };
+
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  auto fifty = Datum(std::make_shared<ScalarType>(CType(50)));
+  auto null = Datum(std::make_shared<ScalarType>(CType(50), false));
+  for (int64_t length : {0, 1, 31, 1000, 3000}) {
+    for (auto null_probability : {0.0, 0.1}) {
+      auto lhs = Datum(rand.Numeric<TypeParam>(length + 3, 0, 100, null_probability)
+                           ->Slice(3, length));
+      auto rhs = Datum(rand.Numeric<TypeParam>(length, 0, 100, null_probability));
+      std::vector<std::shared_ptr<Array>> selections = {
+          rand.Numeric<Int32Type>(2 * length, 0, std::max<int32_t>(length - 1, 0),
+                                  null_probability),
+          rand.UInt64(length / 2, 0, std::max<int64_t>(length - 1, 0), 0)};
+      for (const auto& selection : selections) {
+        for (auto op : {EQUAL, NOT_EQUAL, GREATER, LESS_EQUAL}) {
+          auto options = CompareOptions(op);
+          AssertCompareSelection(lhs, rhs, *selection, options);
+          AssertCompareSelection(lhs, fifty, *selection, options);
+          AssertCompareSelection(fifty, lhs, *selection, options);
+          AssertCompareSelection(lhs, null, *selection, options);
+        }
+      }
+    }
+  }
+
+  auto type = TypeTraits<TypeParam>::type_singleton();
+  auto values = Datum(ArrayFromJSON(type, "[1, 2, 3]"));
+  Datum out;
+  CompareOptions eq(EQUAL);
+  ASSERT_RAISES(IndexError, Compare(&this->ctx_, values, fifty,
+                                    *ArrayFromJSON(int32(), "[0, 3]"), eq, &out));
+  ASSERT_RAISES(Invalid,
+                Compare(&this->ctx_, values, Datum(ArrayFromJSON(type, "[1, 2]")),
+                        *ArrayFromJSON(int32(), "[0]"), eq, &out));
+  ASSERT_RAISES(Invalid, Compare(&this->ctx_, fifty, fifty,
+                                 *ArrayFromJSON(int32(), "[0]"), eq, &out));
+}
+
+class TestDictionaryCompareKernel : public ComputeFixture, public TestBase {
+ protected:
+  void AssertCompare(const Datum& left, const Datum& right, CompareOperator op,
+                     const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Compare(&this->ctx_, left, right, CompareOptions(op), &out));
+    AssertArraysEqual(*ArrayFromJSON(boolean(), expected), *out.make_array());
+  }
+};
+
+TEST_F(TestDictionaryCompareKernel, CompareStringDictionary) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto array = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int32(), "[0, 1, null, 2, 0, 3]"),
+      ArrayFromJSON(utf8(), R"(["b", "a", "c", null])"));
+  auto b = Datum(std::make_shared<StringScalar>(Buffer::FromString("b")));
+
+  AssertCompare(array, b, EQUAL, "[true, false, null, false, true, null]");
+  AssertCompare(array, b, NOT_EQUAL, "[false, true, null, true, false, null]");
+  AssertCompare(array, b, LESS, "[false, true, null, false, false, null]");
+  AssertCompare(array, b, GREATER_EQUAL, "[true, false, null, true, true, null]");
+  AssertCompare(b, array, LESS, "[false, false, null, true, false, null]");
+  AssertCompare(b, array, GREATER_EQUAL, "[true, true, null, false, true, null]");
+
+  auto null = Datum(std::make_shared<StringScalar>(Buffer::FromString(""), false));
+  AssertCompare(array, null, EQUAL, "[null, null, null, null, null, null]");
+
+  // Chunks with different dictionaries
+  auto other_dict = ArrayFromJSON(utf8(), R"(["b", "z"])");
+  auto other = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int32(), "[1, 0]"), other_dict);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{array, other, array});
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, chunked, b, CompareOptions(GREATER), &out));
+  auto expected = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(boolean(), "[false, false, null, true, false, null]"),
+      ArrayFromJSON(boolean(), "[true, false]"),
+      ArrayFromJSON(boolean(), "[false, false, null, true, false, null]")});
+  AssertChunkedEqual(*expected, *out.chunked_array());
+
+  auto one = Datum(std::make_shared<Int32Scalar>(1));
+  ASSERT_RAISES(TypeError, Compare(&this->ctx_, array, one, CompareOptions(EQUAL), &out));
+}
+
+TEST_F(TestDictionaryCompareKernel, CompareNumericDictionary) {
+  auto dict = ArrayFromJSON(int64(), "[30, 10, 20]");
+  auto indices = ArrayFromJSON(int16(), "[2, 0, 1, null, 1, 2]");
+  auto array = std::make_shared<DictionaryArray>(dictionary(int16(), int64()), indices,
+                                                 dict);
+  auto fifteen = Datum(std::make_shared<Int64Scalar>(15));
+
+  // Same result as comparing the decoded values
+  std::shared_ptr<Array> decoded;
+  ASSERT_OK(Take(&this->ctx_, *dict, *indices, TakeOptions(), &decoded));
+  for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+    Datum expected, actual;
+    ASSERT_OK(Compare(&this->ctx_, decoded, fifteen, CompareOptions(op), &expected));
+    ASSERT_OK(Compare(&this->ctx_, array, fifteen, CompareOptions(op), &actual));
+    AssertArraysEqual(*expected.make_array(), *actual.make_array());
+    ASSERT_OK(Compare(&this->ctx_, fifteen, decoded, CompareOptions(op), &expected));
+    ASSERT_OK(Compare(&this->ctx_, fifteen, array, CompareOptions(op), &actual));
+    AssertArraysEqual(*expected.make_array(), *actual.make_array());
+  }
+}
+
+template <typename ArrowType>
+class TestFloatingPointCompareKernel : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestFloatingPointCompareKernel, RealArrowTypes);
+
+TYPED_TEST(TestFloatingPointCompareKernel, NaNs) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  const CType nan = std::numeric_limits<CType>::quiet_NaN();
+  std::vector<CType> left_values, right_values;
+  for (int i = 0; i < 200; ++i) {
+    left_values.push_back(i % 3 == 0 ? nan : static_cast<CType>(i % 5));
+    right_values.push_back(i % 7 == 0 ? nan : static_cast<CType>(i % 4));
+  }
+  std::shared_ptr<Array> left, right;
+  ArrayFromVector<TypeParam>(left_values, &left);
+  ArrayFromVector<TypeParam>(right_values, &right);
+
+  for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+    auto options = CompareOptions(op);
+    ForEachInstructionSet([&]() {
+      for (CType value : {nan, CType(2)}) {
+        auto scalar = Datum(std::make_shared<ScalarType>(value));
+        ValidateCompare<TypeParam>(&this->ctx_, options, left, scalar);
+        ValidateCompare<TypeParam>(&this->ctx_, options, scalar, left);
+      }
+      ValidateCompare<TypeParam>(&this->ctx_, options, left, right);
+    });
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
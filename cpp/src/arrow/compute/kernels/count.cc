@@ -19,6 +19,7 @@
 
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/run_length.h"
 
 namespace arrow {
 namespace compute {
@@ -99,6 +100,9 @@ std::shared_ptr<AggregateFunction> MakeCountAggregateFunction(
 Status Count(FunctionContext* context, const CountOptions& options, const Datum& value,
              Datum* out) {
   if (!value.is_array()) return Status::Invalid("Count is expecting an array datum.");
+  if (IsRunLengthEncoded(*value.type())) {
+    return detail::RunLengthCount(context, options, value, out);
+  }
 
   auto aggregate = MakeCountAggregateFunction(context, options);
   auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
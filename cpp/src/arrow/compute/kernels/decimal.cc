@@ -0,0 +1,488 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/decimal.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+constexpr int32_t kMaxDecimalPrecision = 38;
+
+// The largest precision of which all values fit in an int64
+constexpr int32_t kMaxInt64Precision = 18;
+
+constexpr int64_t kDecimalWidth = 16;
+
+// Values of a precision of at most kMaxInt64Precision are the sign extension
+// of their low 64 bits
+inline int64_t ReadInt64(const uint8_t* value) {
+  return BitUtil::FromLittleEndian(*reinterpret_cast<const int64_t*>(value));
+}
+
+// Return true if a + b overflows, and the result in *out otherwise
+inline bool AddWithOverflow(int64_t a, int64_t b, int64_t* out) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(a, b, out);
+#else
+  *out = static_cast<int64_t>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+  return (a >= 0) == (b >= 0) && (*out >= 0) != (a >= 0);
+#endif
+}
+
+inline bool SubtractWithOverflow(int64_t a, int64_t b, int64_t* out) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(a, b, out);
+#else
+  *out = static_cast<int64_t>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+  return (a >= 0) != (b >= 0) && (*out >= 0) != (a >= 0);
+#endif
+}
+
+inline bool MultiplyWithOverflow(int64_t a, int64_t b, int64_t* out) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(a, b, out);
+#else
+  *out = static_cast<int64_t>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b));
+  if (a == 0 || b == 0) {
+    return false;
+  }
+  const int64_t min = std::numeric_limits<int64_t>::min();
+  return (a == -1 && b == min) || (b == -1 && a == min) || *out / b != a;
+#endif
+}
+
+// Call visit(value bytes) for each non-null value of a decimal array
+template <typename Visit>
+void VisitValidDecimals(const Decimal128Array& array, Visit&& visit) {
+  const uint8_t* values = array.raw_values();
+  const int64_t length = array.length();
+  if (array.null_count() == 0) {
+    for (int64_t i = 0; i < length; ++i) {
+      visit(values + i * kDecimalWidth);
+    }
+    return;
+  }
+  internal::BitmapReader reader(array.null_bitmap_data(), array.offset(), length);
+  for (int64_t i = 0; i < length; ++i) {
+    if (reader.IsSet()) {
+      visit(values + i * kDecimalWidth);
+    }
+    reader.Next();
+  }
+}
+
+// ----------------------------------------------------------------------
+// Aggregates
+
+struct DecimalSumState {
+  // Consecutive small values are summed in an int64, which is added to the
+  // 128-bit sum when it would overflow.
+  void Add(int64_t value) {
+    int64_t result;
+    if (AddWithOverflow(small_sum, value, &result)) {
+      sum += small_sum;
+      small_sum = value;
+    } else {
+      small_sum = result;
+    }
+    ++count;
+  }
+
+  void Add(const BasicDecimal128& value) {
+    sum += value;
+    ++count;
+  }
+
+  void Merge(const DecimalSumState& other) {
+    sum += other.sum;
+    sum += other.small_sum;
+    count += other.count;
+  }
+
+  BasicDecimal128 Total() const { return sum + small_sum; }
+
+  static std::shared_ptr<DataType> out_type(const Decimal128Type& type) {
+    return decimal(kMaxDecimalPrecision, type.scale());
+  }
+
+  std::shared_ptr<Scalar> Finalize(const Decimal128Type& type) const {
+    return std::make_shared<Decimal128Scalar>(Total(), out_type(type), count > 0);
+  }
+
+  BasicDecimal128 sum;
+  int64_t small_sum = 0;
+  int64_t count = 0;
+};
+
+struct DecimalMeanState : public DecimalSumState {
+  static std::shared_ptr<DataType> out_type(const Decimal128Type& type) {
+    return decimal(type.precision(), type.scale());
+  }
+
+  std::shared_ptr<Scalar> Finalize(const Decimal128Type& type) const {
+    if (count == 0) {
+      return std::make_shared<Decimal128Scalar>(Decimal128(), out_type(type), false);
+    }
+    const BasicDecimal128 total = Total();
+    BasicDecimal128 mean, remainder;
+    const DecimalStatus status = total.Divide(count, &mean, &remainder);
+    DCHECK(status == DecimalStatus::kSuccess);
+    ARROW_UNUSED(status);
+    // Round half away from zero: the remainder has the sign of the total
+    if (BasicDecimal128::Abs(remainder) * 2 >= BasicDecimal128(count)) {
+      mean += total.Sign();
+    }
+    return std::make_shared<Decimal128Scalar>(mean, out_type(type));
+  }
+};
+
+template <bool kMax>
+struct DecimalMinMaxState {
+  static bool Better(const BasicDecimal128& a, const BasicDecimal128& b) {
+    return kMax ? a > b : a < b;
+  }
+
+  void Add(int64_t value) {
+    if (!has_small || (kMax ? value > small : value < small)) {
+      small = value;
+    }
+    has_small = true;
+  }
+
+  void Add(const BasicDecimal128& value) {
+    if (!has_wide || Better(value, wide)) {
+      wide = value;
+    }
+    has_wide = true;
+  }
+
+  void Merge(const DecimalMinMaxState& other) {
+    if (other.has_small) Add(other.small);
+    if (other.has_wide) Add(other.wide);
+  }
+
+  static std::shared_ptr<DataType> out_type(const Decimal128Type& type) {
+    return decimal(type.precision(), type.scale());
+  }
+
+  std::shared_ptr<Scalar> Finalize(const Decimal128Type& type) const {
+    BasicDecimal128 result = has_wide ? wide : BasicDecimal128(small);
+    if (has_wide && has_small && Better(BasicDecimal128(small), wide)) {
+      result = small;
+    }
+    return std::make_shared<Decimal128Scalar>(result, out_type(type),
+                                              has_small || has_wide);
+  }
+
+  int64_t small = 0;
+  BasicDecimal128 wide;
+  bool has_small = false;
+  bool has_wide = false;
+};
+
+template <typename StateType>
+class DecimalAggregateFunction final : public AggregateFunctionStaticState<StateType> {
+ public:
+  explicit DecimalAggregateFunction(const Decimal128Type& type)
+      : type_(type.precision(), type.scale()) {}
+
+  Status Consume(const Array& input, StateType* state) const override {
+    const auto& array = checked_cast<const Decimal128Array&>(input);
+    *state = StateType();
+    if (type_.precision() <= kMaxInt64Precision) {
+      VisitValidDecimals(array,
+                         [&](const uint8_t* value) { state->Add(ReadInt64(value)); });
+    } else {
+      VisitValidDecimals(array, [&](const uint8_t* value) {
+        state->Add(BasicDecimal128(value));
+      });
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const StateType& src, StateType* dst) const override {
+    dst->Merge(src);
+    return Status::OK();
+  }
+
+  Status Finalize(const StateType& src, Datum* output) const override {
+    *output = src.Finalize(type_);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return StateType::out_type(type_);
+  }
+
+ private:
+  Decimal128Type type_;
+};
+
+template <typename StateType>
+std::shared_ptr<AggregateFunction> MakeDecimalAggregateFunction(const DataType& type) {
+  if (type.id() != Type::DECIMAL) {
+    return nullptr;
+  }
+  return std::make_shared<DecimalAggregateFunction<StateType>>(
+      checked_cast<const Decimal128Type&>(type));
+}
+
+template <typename StateType>
+Status DecimalAggregate(FunctionContext* ctx, const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  auto aggregate = MakeDecimalAggregateFunction<StateType>(*data_type);
+  if (!aggregate) {
+    return Status::Invalid("Datum must contain a Decimal128Type, got ", *data_type);
+  }
+  AggregateUnaryKernel kernel(aggregate);
+  return kernel.Call(ctx, value, out);
+}
+
+// ----------------------------------------------------------------------
+// Arithmetic
+
+// The values of an array, or a scalar broadcast with a zero stride
+struct DecimalOperand {
+  const Decimal128Type* type;
+  const uint8_t* values;
+  int64_t stride;
+  std::array<uint8_t, kDecimalWidth> scalar_value;
+
+  const uint8_t* Value(int64_t i) const { return values + i * stride; }
+};
+
+Status InitOperand(const Datum& datum, DecimalOperand* operand) {
+  if (datum.type() == nullptr || datum.type()->id() != Type::DECIMAL) {
+    return Status::Invalid("Decimal arithmetic expects Decimal128 operands");
+  }
+  operand->type = checked_cast<const Decimal128Type*>(datum.type().get());
+  if (datum.kind() == Datum::SCALAR) {
+    const auto& scalar = checked_cast<const Decimal128Scalar&>(*datum.scalar());
+    scalar.value.ToBytes(operand->scalar_value.data());
+    operand->values = operand->scalar_value.data();
+    operand->stride = 0;
+  } else if (datum.kind() == Datum::ARRAY) {
+    const ArrayData& data = *datum.array();
+    operand->values = data.GetValues<uint8_t>(1) + data.offset * kDecimalWidth;
+    operand->stride = kDecimalWidth;
+  } else {
+    return Status::Invalid("Decimal arithmetic expects array or scalar operands");
+  }
+  return Status::OK();
+}
+
+struct AddOp {
+  static bool Small(int64_t a, int64_t b, int64_t* out) {
+    return !AddWithOverflow(a, b, out);
+  }
+  static BasicDecimal128 Wide(const BasicDecimal128& a, const BasicDecimal128& b) {
+    return a + b;
+  }
+};
+
+struct SubtractOp {
+  static bool Small(int64_t a, int64_t b, int64_t* out) {
+    return !SubtractWithOverflow(a, b, out);
+  }
+  static BasicDecimal128 Wide(const BasicDecimal128& a, const BasicDecimal128& b) {
+    return a - b;
+  }
+};
+
+struct MultiplyOp {
+  static bool Small(int64_t a, int64_t b, int64_t* out) {
+    return !MultiplyWithOverflow(a, b, out);
+  }
+  static BasicDecimal128 Wide(const BasicDecimal128& a, const BasicDecimal128& b) {
+    return a * b;
+  }
+};
+
+// Compute op(left * left_multiplier, right * right_multiplier) for each slot
+template <typename Op>
+void ExecuteDecimalOp(const DecimalOperand& left, int32_t left_rescale,
+                      const DecimalOperand& right, int32_t right_rescale,
+                      int64_t length, uint8_t* out) {
+  const BasicDecimal128& left_multiplier =
+      BasicDecimal128::GetScaleMultiplier(left_rescale);
+  const BasicDecimal128& right_multiplier =
+      BasicDecimal128::GetScaleMultiplier(right_rescale);
+
+  // The operands fit in an int64 when rescaled
+  if (left.type->precision() + left_rescale <= kMaxInt64Precision &&
+      right.type->precision() + right_rescale <= kMaxInt64Precision) {
+    const auto left_small = static_cast<int64_t>(left_multiplier.low_bits());
+    const auto right_small = static_cast<int64_t>(right_multiplier.low_bits());
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t a = ReadInt64(left.Value(i)) * left_small;
+      const int64_t b = ReadInt64(right.Value(i)) * right_small;
+      int64_t result;
+      if (Op::Small(a, b, &result)) {
+        BasicDecimal128(result).ToBytes(out + i * kDecimalWidth);
+      } else {
+        Op::Wide(a, b).ToBytes(out + i * kDecimalWidth);
+      }
+    }
+    return;
+  }
+
+  for (int64_t i = 0; i < length; ++i) {
+    BasicDecimal128 a(left.Value(i));
+    BasicDecimal128 b(right.Value(i));
+    if (left_rescale > 0) a *= left_multiplier;
+    if (right_rescale > 0) b *= right_multiplier;
+    Op::Wide(a, b).ToBytes(out + i * kDecimalWidth);
+  }
+}
+
+enum class DecimalOpKind { ADD, SUBTRACT, MULTIPLY };
+
+Status ExecuteDecimalArithmetic(FunctionContext* ctx, DecimalOpKind kind,
+                                const Datum& left, const Datum& right, Datum* out) {
+  DecimalOperand left_operand, right_operand;
+  RETURN_NOT_OK(InitOperand(left, &left_operand));
+  RETURN_NOT_OK(InitOperand(right, &right_operand));
+
+  if (left.kind() == Datum::SCALAR && right.kind() == Datum::SCALAR) {
+    return Status::Invalid("Decimal arithmetic expects at least one array operand");
+  }
+  if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY &&
+      left.length() != right.length()) {
+    return Status::Invalid("Decimal arithmetic operands must have identical lengths");
+  }
+  const int64_t length = left.kind() == Datum::ARRAY ? left.length() : right.length();
+
+  const Decimal128Type& left_type = *left_operand.type;
+  const Decimal128Type& right_type = *right_operand.type;
+  int32_t precision, scale;
+  int32_t left_rescale = 0, right_rescale = 0;
+  if (kind == DecimalOpKind::MULTIPLY) {
+    scale = left_type.scale() + right_type.scale();
+    if (scale > kMaxDecimalPrecision) {
+      return Status::Invalid("Scale of the product of ", left_type, " and ", right_type,
+                             " exceeds ", kMaxDecimalPrecision);
+    }
+    precision = left_type.precision() + right_type.precision() + 1;
+  } else {
+    scale = std::max(left_type.scale(), right_type.scale());
+    left_rescale = scale - left_type.scale();
+    right_rescale = scale - right_type.scale();
+    precision = std::max(left_type.precision() - left_type.scale(),
+                         right_type.precision() - right_type.scale()) +
+                scale + 1;
+  }
+  precision = std::min(precision, kMaxDecimalPrecision);
+
+  auto out_data = ArrayData::Make(decimal(std::max(precision, scale), scale), length);
+  out_data->buffers.resize(2);
+  const bool left_null = left.kind() == Datum::SCALAR && !left.scalar()->is_valid;
+  const bool right_null = right.kind() == Datum::SCALAR && !right.scalar()->is_valid;
+  const ArrayData& array = left.kind() == Datum::ARRAY ? *left.array() : *right.array();
+  if (left_null || right_null) {
+    RETURN_NOT_OK(detail::SetAllNulls(ctx, array, out_data.get()));
+  } else if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+    RETURN_NOT_OK(detail::AssignNullIntersection(ctx, *left.array(), *right.array(),
+                                                 out_data.get()));
+  } else {
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, out_data.get()));
+  }
+  RETURN_NOT_OK(ctx->Allocate(length * kDecimalWidth, &out_data->buffers[1]));
+  uint8_t* out_values = out_data->buffers[1]->mutable_data();
+
+  switch (kind) {
+    case DecimalOpKind::ADD:
+      ExecuteDecimalOp<AddOp>(left_operand, left_rescale, right_operand, right_rescale,
+                              length, out_values);
+      break;
+    case DecimalOpKind::SUBTRACT:
+      ExecuteDecimalOp<SubtractOp>(left_operand, left_rescale, right_operand,
+                                   right_rescale, length, out_values);
+      break;
+    case DecimalOpKind::MULTIPLY:
+      ExecuteDecimalOp<MultiplyOp>(left_operand, 0, right_operand, 0, length,
+                                   out_values);
+      break;
+  }
+  *out = out_data;
+  return Status::OK();
+}
+
+}  // namespace
+
+std::shared_ptr<AggregateFunction> MakeDecimalSumAggregateFunction(
+    const DataType& type, FunctionContext* ctx) {
+  return MakeDecimalAggregateFunction<DecimalSumState>(type);
+}
+
+std::shared_ptr<AggregateFunction> MakeDecimalMeanAggregateFunction(
+    const DataType& type, FunctionContext* ctx) {
+  return MakeDecimalAggregateFunction<DecimalMeanState>(type);
+}
+
+Status DecimalMin(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return DecimalAggregate<DecimalMinMaxState<false>>(ctx, value, out);
+}
+
+Status DecimalMax(FunctionContext* ctx, const Datum& value, Datum* out) {
+  return DecimalAggregate<DecimalMinMaxState<true>>(ctx, value, out);
+}
+
+Status DecimalAdd(FunctionContext* ctx, const Datum& left, const Datum& right,
+                  Datum* out) {
+  return ExecuteDecimalArithmetic(ctx, DecimalOpKind::ADD, left, right, out);
+}
+
+Status DecimalSubtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                       Datum* out) {
+  return ExecuteDecimalArithmetic(ctx, DecimalOpKind::SUBTRACT, left, right, out);
+}
+
+Status DecimalMultiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                       Datum* out) {
+  return ExecuteDecimalArithmetic(ctx, DecimalOpKind::MULTIPLY, left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
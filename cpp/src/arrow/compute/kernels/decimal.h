@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+// Decimal128 kernels.  Values of a precision of 18 or less fit in an int64, so
+// the kernels compute them with 64-bit integer arithmetic, and only fall back
+// to 128-bit arithmetic on overflow or for larger precisions.
+
+/// \brief Return the Sum function aggregate for a Decimal128Type
+///
+/// The sum is a decimal128(38, scale) of the scale of the input.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeDecimalSumAggregateFunction(
+    const DataType& type, FunctionContext* context);
+
+/// \brief Return the Mean function aggregate for a Decimal128Type
+///
+/// The mean is of the input type, rounded half away from zero.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeDecimalMeanAggregateFunction(
+    const DataType& type, FunctionContext* context);
+
+/// \brief Compute the smallest non-null value of a decimal array
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum of Decimal128Type, expecting Array
+/// \param[out] out a Decimal128Scalar of the input type, null if there are no
+/// non-null values
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DecimalMin(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the largest non-null value of a decimal array
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum of Decimal128Type, expecting Array
+/// \param[out] out a Decimal128Scalar of the input type, null if there are no
+/// non-null values
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DecimalMax(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Add two decimal arrays, or a decimal array and a decimal scalar
+///
+/// The operands are rescaled to the larger of their scales, which is the
+/// scale of the result; its precision is one more than the largest number of
+/// integral digits plus that scale, up to 38.  The result is null where
+/// either operand is null.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left Decimal128 array or scalar
+/// \param[in] right Decimal128 array or scalar, at least one being an array
+/// of the same length as the other
+/// \param[out] out resulting Decimal128 array
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DecimalAdd(FunctionContext* context, const Datum& left, const Datum& right,
+                  Datum* out);
+
+/// \brief Subtract a decimal array or scalar from another
+///
+/// The scale and precision of the result are those of DecimalAdd.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left Decimal128 array or scalar
+/// \param[in] right Decimal128 array or scalar, at least one being an array
+/// of the same length as the other
+/// \param[out] out resulting Decimal128 array of left - right
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DecimalSubtract(FunctionContext* context, const Datum& left, const Datum& right,
+                       Datum* out);
+
+/// \brief Multiply two decimal arrays, or a decimal array and a decimal scalar
+///
+/// The scale of the result is the sum of the scales of the operands, which
+/// must not exceed 38, and its precision the sum of their precisions plus
+/// one, up to 38.  Like BasicDecimal128 multiplication, products which do not
+/// fit in 128 bits are truncated.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left Decimal128 array or scalar
+/// \param[in] right Decimal128 array or scalar, at least one being an array
+/// of the same length as the other
+/// \param[out] out resulting Decimal128 array
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DecimalMultiply(FunctionContext* context, const Datum& left, const Datum& right,
+                       Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
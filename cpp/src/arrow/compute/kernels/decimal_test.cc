@@ -0,0 +1,221 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/decimal.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/decimal.h"
+#include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestDecimalKernels : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertScalar(const Datum& actual, const std::shared_ptr<DataType>& type,
+                    const std::string& expected) {
+    ASSERT_EQ(Datum::SCALAR, actual.kind());
+    const auto& scalar = checked_cast<const Decimal128Scalar&>(*actual.scalar());
+    ASSERT_TRUE(scalar.type->Equals(type)) << scalar.type->ToString();
+    ASSERT_TRUE(scalar.is_valid);
+    ASSERT_EQ(expected, scalar.value.ToString(checked_cast<const Decimal128Type&>(*type)
+                                                  .scale()));
+  }
+
+  void AssertNullScalar(const Datum& actual) {
+    ASSERT_EQ(Datum::SCALAR, actual.kind());
+    ASSERT_FALSE(actual.scalar()->is_valid);
+  }
+
+  void AssertArray(const Datum& actual, const std::shared_ptr<DataType>& type,
+                   const std::string& expected_json) {
+    auto array = actual.make_array();
+    ASSERT_OK(array->Validate());
+    AssertArraysEqual(*ArrayFromJSON(type, expected_json), *array);
+  }
+
+  Datum DecimalScalar(const std::shared_ptr<DataType>& type, const std::string& value) {
+    Decimal128 decimal;
+    ARROW_EXPECT_OK(Decimal128::FromString(value, &decimal));
+    return Datum(std::make_shared<Decimal128Scalar>(decimal, type));
+  }
+};
+
+TEST_F(TestDecimalKernels, Sum) {
+  auto type = decimal(10, 2);
+  Datum out;
+  ASSERT_OK(Sum(&this->ctx_, ArrayFromJSON(type, R"(["1.50", "-0.25", null, "10.00"])"),
+                &out));
+  AssertScalar(out, decimal(38, 2), "11.25");
+
+  ASSERT_OK(Sum(&this->ctx_, ArrayFromJSON(type, "[null, null]"), &out));
+  AssertNullScalar(out);
+
+  // Sliced
+  ASSERT_OK(Sum(&this->ctx_, ArrayFromJSON(type, R"(["1.00", "2.00", "3.00"])")->Slice(1),
+                &out));
+  AssertScalar(out, decimal(38, 2), "5.00");
+
+  // Beyond 18 digits
+  ASSERT_OK(Sum(&this->ctx_,
+                ArrayFromJSON(decimal(30, 0),
+                              R"(["100000000000000000000000000", "-1", null])"),
+                &out));
+  AssertScalar(out, decimal(38, 0), "99999999999999999999999999");
+}
+
+TEST_F(TestDecimalKernels, SumOverflowsInt64) {
+  // Each value fits in an int64, but their sum does not
+  auto type = decimal(18, 0);
+  std::string json = "[";
+  for (int i = 0; i < 20; ++i) {
+    json += std::string(i == 0 ? "" : ", ") + "\"999999999999999999\"";
+  }
+  json += ", \"-5\"]";
+  Datum out;
+  ASSERT_OK(Sum(&this->ctx_, ArrayFromJSON(type, json), &out));
+  AssertScalar(out, decimal(38, 0), "19999999999999999975");
+}
+
+TEST_F(TestDecimalKernels, Mean) {
+  auto type = decimal(5, 1);
+  Datum out;
+  ASSERT_OK(Mean(&this->ctx_, ArrayFromJSON(type, R"(["1.0", "2.0", null, "2.5"])"),
+                 &out));
+  // 5.5 / 3, rounded half away from zero
+  AssertScalar(out, type, "1.8");
+
+  ASSERT_OK(Mean(&this->ctx_, ArrayFromJSON(type, R"(["-1.0", "-0.5"])"), &out));
+  AssertScalar(out, type, "-0.8");
+
+  ASSERT_OK(Mean(&this->ctx_, ArrayFromJSON(type, "[]"), &out));
+  AssertNullScalar(out);
+}
+
+TEST_F(TestDecimalKernels, MinMax) {
+  for (int32_t precision : {10, 25}) {
+    auto type = decimal(precision, 3);
+    auto values = ArrayFromJSON(type, R"(["1.250", null, "-7.125", "3.000", "0.000"])");
+    Datum out;
+    ASSERT_OK(DecimalMin(&this->ctx_, values, &out));
+    AssertScalar(out, type, "-7.125");
+    ASSERT_OK(DecimalMax(&this->ctx_, values, &out));
+    AssertScalar(out, type, "3.000");
+
+    ASSERT_OK(DecimalMax(&this->ctx_, ArrayFromJSON(type, "[null]"), &out));
+    AssertNullScalar(out);
+  }
+
+  Datum out;
+  ASSERT_RAISES(Invalid, DecimalMin(&this->ctx_, ArrayFromJSON(int32(), "[1]"), &out));
+}
+
+TEST_F(TestDecimalKernels, AddSubtract) {
+  auto left = ArrayFromJSON(decimal(5, 2), R"(["1.25", "-3.50", null, "999.99"])");
+  auto right = ArrayFromJSON(decimal(4, 1), R"(["0.5", "1.0", "2.0", null])");
+  Datum out;
+  ASSERT_OK(DecimalAdd(&this->ctx_, left, right, &out));
+  AssertArray(out, decimal(6, 2), R"(["1.75", "-2.50", null, null])");
+
+  ASSERT_OK(DecimalSubtract(&this->ctx_, left, right, &out));
+  AssertArray(out, decimal(6, 2), R"(["0.75", "-4.50", null, null])");
+
+  ASSERT_OK(DecimalSubtract(&this->ctx_, right, left, &out));
+  AssertArray(out, decimal(6, 2), R"(["-0.75", "4.50", null, null])");
+
+  // Scalar operands are broadcast
+  ASSERT_OK(DecimalAdd(&this->ctx_, left, DecimalScalar(decimal(3, 0), "100"), &out));
+  AssertArray(out, decimal(6, 2), R"(["101.25", "96.50", null, "1099.99"])");
+  ASSERT_OK(
+      DecimalSubtract(&this->ctx_, DecimalScalar(decimal(3, 0), "100"), left, &out));
+  AssertArray(out, decimal(6, 2), R"(["98.75", "103.50", null, "-899.99"])");
+
+  auto null_scalar =
+      Datum(std::make_shared<Decimal128Scalar>(Decimal128(), decimal(3, 0), false));
+  ASSERT_OK(DecimalAdd(&this->ctx_, left, null_scalar, &out));
+  AssertArray(out, decimal(6, 2), "[null, null, null, null]");
+}
+
+TEST_F(TestDecimalKernels, AddOverflowsInt64) {
+  // The operands fit in an int64, but not their sum
+  auto type = decimal(18, 0);
+  auto left =
+      ArrayFromJSON(type, R"(["999999999999999999", "-999999999999999999", "1"])");
+  auto right =
+      ArrayFromJSON(type, R"(["999999999999999999", "-999999999999999999", "2"])");
+  Datum out;
+  ASSERT_OK(DecimalAdd(&this->ctx_, left, right, &out));
+  AssertArray(out, decimal(19, 0),
+              R"(["1999999999999999998", "-1999999999999999998", "3"])");
+
+  // Large precisions
+  auto wide = ArrayFromJSON(decimal(30, 10), R"(["12345678901234567890.0123456789"])");
+  ASSERT_OK(DecimalAdd(&this->ctx_, wide, ArrayFromJSON(decimal(3, 0), R"(["1"])"),
+                       &out));
+  AssertArray(out, decimal(31, 10), R"(["12345678901234567891.0123456789"])");
+}
+
+TEST_F(TestDecimalKernels, Multiply) {
+  auto left = ArrayFromJSON(decimal(5, 2), R"(["1.25", "-3.50", null, "0.01"])");
+  auto right = ArrayFromJSON(decimal(4, 1), R"(["0.5", "2.0", "1.0", "-1.5"])");
+  Datum out;
+  ASSERT_OK(DecimalMultiply(&this->ctx_, left, right, &out));
+  AssertArray(out, decimal(10, 3), R"(["0.625", "-7.000", null, "-0.015"])");
+
+  // The operands fit in an int64, but not their product
+  auto big = ArrayFromJSON(decimal(18, 0), R"(["999999999999999999", "-3"])");
+  ASSERT_OK(DecimalMultiply(&this->ctx_, big, big, &out));
+  AssertArray(out, decimal(37, 0),
+              R"(["999999999999999998000000000000000001", "9"])");
+
+  ASSERT_OK(DecimalMultiply(&this->ctx_, DecimalScalar(decimal(1, 0), "2"), big, &out));
+  AssertArray(out, decimal(20, 0), R"(["1999999999999999998", "-6"])");
+
+  ASSERT_RAISES(Invalid, DecimalMultiply(&this->ctx_,
+                                         ArrayFromJSON(decimal(38, 20), "[]"),
+                                         ArrayFromJSON(decimal(38, 20), "[]"), &out));
+}
+
+TEST_F(TestDecimalKernels, ArithmeticErrors) {
+  auto type = decimal(5, 2);
+  Datum out;
+  ASSERT_RAISES(Invalid, DecimalAdd(&this->ctx_, ArrayFromJSON(type, R"(["1.00"])"),
+                                    ArrayFromJSON(type, "[]"), &out));
+  ASSERT_RAISES(Invalid, DecimalAdd(&this->ctx_, ArrayFromJSON(type, R"(["1.00"])"),
+                                    ArrayFromJSON(int32(), "[1]"), &out));
+  ASSERT_RAISES(Invalid, DecimalAdd(&this->ctx_, DecimalScalar(type, "1.00"),
+                                    DecimalScalar(type, "1.00"), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
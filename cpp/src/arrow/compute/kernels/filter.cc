@@ -17,12 +17,16 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
 
 #include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/run_length.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -32,6 +36,22 @@ namespace compute {
 using internal::checked_cast;
 using internal::checked_pointer_cast;
 
+// Bits set where the filter is either null or true, for up to 64 positions
+// starting at `position`
+static uint64_t SelectedBits(const BooleanArray& filter, int64_t position) {
+  const int64_t num_bits = std::min<int64_t>(64, filter.length() - position);
+  const int64_t offset = filter.offset() + position;
+  uint64_t word = internal::ReadBitmapWord(filter.values()->data(), offset, num_bits);
+  if (filter.null_count() != 0) {
+    const uint64_t valid =
+        internal::ReadBitmapWord(filter.null_bitmap_data(), offset, num_bits);
+    const uint64_t mask = num_bits == 64 ? ~static_cast<uint64_t>(0)
+                                         : (static_cast<uint64_t>(1) << num_bits) - 1;
+    word |= ~valid & mask;
+  }
+  return word;
+}
+
 // IndexSequence which yields the indices of positions in a BooleanArray
 // which are either null or true
 class FilterIndexSequence {
@@ -46,12 +66,15 @@ class FilterIndexSequence {
       : filter_(&filter), out_length_(out_length) {}
 
   std::pair<int64_t, bool> Next() {
-    // skip until an index is found at which the filter is either null or true
-    while (filter_->IsValid(index_) && !filter_->Value(index_)) {
-      ++index_;
+    // skip a word at a time until an index is found at which the filter is
+    // either null or true
+    while (selected_ == 0) {
+      word_start_ += 64;
+      selected_ = SelectedBits(*filter_, word_start_);
     }
-    bool is_valid = filter_->IsValid(index_);
-    return std::make_pair(index_++, is_valid);
+    const int64_t index = word_start_ + BitUtil::CountTrailingZeros(selected_);
+    selected_ &= selected_ - 1;
+    return std::make_pair(index, filter_->IsValid(index));
   }
 
   int64_t length() const { return out_length_; }
@@ -60,18 +83,20 @@ class FilterIndexSequence {
 
  private:
   const BooleanArray* filter_ = nullptr;
-  int64_t index_ = 0, out_length_ = -1;
+  int64_t out_length_ = -1;
+  // Selected positions not yet yielded in the word starting at word_start_
+  int64_t word_start_ = -64;
+  uint64_t selected_ = 0;
 };
 
-// TODO(bkietz) this can be optimized
 static int64_t OutputSize(const BooleanArray& filter) {
-  auto offset = filter.offset();
-  auto length = filter.length();
+  if (filter.null_count() == 0) {
+    return internal::CountSetBits(filter.values()->data(), filter.offset(),
+                                  filter.length());
+  }
   int64_t size = 0;
-  for (auto i = offset; i < offset + length; ++i) {
-    if (filter.IsNull(i) || filter.Value(i)) {
-      ++size;
-    }
+  for (int64_t position = 0; position < filter.length(); position += 64) {
+    size += BitUtil::PopCount(SelectedBits(filter, position));
   }
   return size;
 }
@@ -128,10 +153,35 @@ Status Filter(FunctionContext* ctx, const Array& values, const Array& filter,
 
 Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
               Datum* out) {
+  if (values.type() != nullptr && IsRunLengthEncoded(*values.type())) {
+    return detail::RunLengthFilter(ctx, values, filter, out);
+  }
   std::unique_ptr<FilterKernel> kernel;
   RETURN_NOT_OK(FilterKernel::Make(values.type(), &kernel));
   return kernel->Call(ctx, values, filter, out);
 }
 
+Status FilterToIndices(FunctionContext* ctx, const Array& filter,
+                       std::shared_ptr<Array>* out) {
+  if (filter.type_id() != Type::BOOL) {
+    return Status::TypeError("filter must be a boolean array, got ", *filter.type());
+  }
+  const auto& boolean_filter = checked_cast<const BooleanArray&>(filter);
+  const int64_t length = OutputSize(boolean_filter);
+
+  UInt64Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.Reserve(length));
+  FilterIndexSequence indices(boolean_filter, length);
+  for (int64_t i = 0; i < length; ++i) {
+    auto index_valid = indices.Next();
+    if (index_valid.second) {
+      builder.UnsafeAppend(static_cast<uint64_t>(index_valid.first));
+    } else {
+      builder.UnsafeAppendNull();
+    }
+  }
+  return builder.Finish(out);
+}
+
 }  // namespace compute
 }  // namespace arrow
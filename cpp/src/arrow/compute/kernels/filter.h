@@ -58,6 +58,28 @@ Status Filter(FunctionContext* ctx, const Array& values, const Array& filter,
 ARROW_EXPORT
 Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter, Datum* out);
 
+/// \brief Compute the selection vector of a boolean selection filter
+///
+/// The output is a UInt64Array holding, in increasing order, the positions
+/// at which the filter is not 0.  Positions at which the filter is null yield
+/// null indices, so that Take(values, indices) is equivalent to
+/// Filter(values, filter).
+///
+/// Unlike Filter, this does not copy any column data: the selection vector
+/// can be passed to Take, Sum and Compare so that a pipeline of kernels only
+/// reads the selected values, and columns are compacted once with Take at the
+/// end.  A selection vector is itself refined by filtering it.
+///
+/// For example given filter = [0, 1, 1, 0, null, 1], the output will be
+/// = [1, 2, null, 5]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] filter indicates which positions should be selected
+/// \param[out] out resulting selection vector
+ARROW_EXPORT
+Status FilterToIndices(FunctionContext* ctx, const Array& filter,
+                       std::shared_ptr<Array>* out);
+
 /// \brief BinaryKernel implementing Filter operation
 class ARROW_EXPORT FilterKernel : public BinaryKernel {
  public:
@@ -24,6 +24,9 @@
 #include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -164,11 +167,106 @@ TYPED_TEST(TestFilterKernelWithNumeric, FilterRandomNumeric) {
         auto values = rand.Numeric<TypeParam>(length, 0, 127, null_probability);
         auto filter = rand.Boolean(length, filter_probability, null_probability);
         this->ValidateFilter(values, filter);
+        this->ValidateFilter(values->Slice(3), filter->Slice(3));
       }
     }
   }
 }
 
+class TestFilterToIndices : public ComputeFixture, public TestBase {};
+
+TEST_F(TestFilterToIndices, Basics) {
+  auto AssertIndices = [&](const std::shared_ptr<Array>& filter,
+                           const std::string& expected) {
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(FilterToIndices(&this->ctx_, *filter, &indices));
+    ASSERT_OK(indices->Validate());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *indices);
+  };
+
+  AssertIndices(ArrayFromJSON(boolean(), "[]"), "[]");
+  AssertIndices(ArrayFromJSON(boolean(), "[0, 0]"), "[]");
+  AssertIndices(ArrayFromJSON(boolean(), "[0, 1, 1, 0, null, 1]"), "[1, 2, null, 5]");
+  AssertIndices(ArrayFromJSON(boolean(), "[1, 0, 1, 1, 0, null, 1]")->Slice(2, 4),
+                "[0, 1, null]");
+
+  std::shared_ptr<Array> indices;
+  ASSERT_RAISES(TypeError,
+                FilterToIndices(&this->ctx_, *ArrayFromJSON(int8(), "[1]"), &indices));
+}
+
+TYPED_TEST(TestFilterKernelWithNumeric, FilterToIndicesRandomNumeric) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  for (size_t i = 3; i < 13; i++) {
+    const int64_t length = static_cast<int64_t>(1ULL << i);
+    for (auto null_probability : {0.0, 0.01, 0.25}) {
+      auto values = rand.Numeric<TypeParam>(length + 3, 0, 127, null_probability);
+      auto filter = rand.Boolean(length + 3, 0.5, null_probability);
+      for (int64_t offset : {0, 3}) {
+        auto sliced_values = values->Slice(offset, length);
+        auto sliced_filter = filter->Slice(offset, length);
+        std::shared_ptr<Array> indices, taken, filtered;
+        ASSERT_OK(FilterToIndices(&this->ctx_, *sliced_filter, &indices));
+        ASSERT_OK(Take(&this->ctx_, *sliced_values, *indices, TakeOptions(), &taken));
+        ASSERT_OK(arrow::compute::Filter(&this->ctx_, *sliced_values, *sliced_filter,
+                                         &filtered));
+        AssertArraysEqual(*filtered, *taken);
+      }
+    }
+  }
+}
+
+// Filter through a selection vector, then compare, sum and take the selected
+// values, comparing with the same pipeline over compacted arrays
+TYPED_TEST(TestFilterKernelWithNumeric, SelectionPipelineRandomNumeric) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+  using SumType = typename FindAccumulatorType<TypeParam>::Type;
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto fifty = std::make_shared<ScalarType>(static_cast<CType>(50));
+  for (size_t i = 3; i < 13; i++) {
+    const int64_t length = static_cast<int64_t>(1ULL << i);
+    for (auto null_probability : {0.0, 0.1}) {
+      auto values = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+      auto other = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+      auto filter = rand.Boolean(length, 0.5, 0.0);
+
+      // Compacting path
+      Datum filtered_values, filtered_other, mask, result_values, expected_sum;
+      ASSERT_OK(arrow::compute::Filter(&this->ctx_, values, filter, &filtered_values));
+      ASSERT_OK(arrow::compute::Filter(&this->ctx_, other, filter, &filtered_other));
+      ASSERT_OK(arrow::compute::Compare(&this->ctx_, filtered_values, filtered_other,
+                                        CompareOptions(LESS), &mask));
+      ASSERT_OK(
+          arrow::compute::Filter(&this->ctx_, filtered_values, mask, &result_values));
+      ASSERT_OK(Sum(&this->ctx_, result_values, &expected_sum));
+
+      // Selection vector path
+      std::shared_ptr<Array> selection, refined, taken;
+      Datum selected_mask, selected_greater, sum;
+      ASSERT_OK(FilterToIndices(&this->ctx_, *filter, &selection));
+      ASSERT_OK(arrow::compute::Compare(&this->ctx_, values, other, *selection,
+                                        CompareOptions(LESS), &selected_mask));
+      ASSERT_OK(arrow::compute::Filter(&this->ctx_, *selection,
+                                       *selected_mask.make_array(), &refined));
+      ASSERT_OK(Sum(&this->ctx_, *values, *refined, &sum));
+      ASSERT_OK(Take(&this->ctx_, *values, *refined, TakeOptions(), &taken));
+
+      AssertArraysEqual(*result_values.make_array(), *taken);
+      DatumEqual<SumType>::EnsureEqual(expected_sum, sum);
+
+      // Comparing with a scalar
+      Datum expected_greater;
+      ASSERT_OK(arrow::compute::Compare(&this->ctx_, filtered_values, Datum(fifty),
+                                        CompareOptions(GREATER), &expected_greater));
+      ASSERT_OK(arrow::compute::Compare(&this->ctx_, values, Datum(fifty), *selection,
+                                        CompareOptions(GREATER), &selected_greater));
+      AssertArraysEqual(*expected_greater.make_array(), *selected_greater.make_array());
+    }
+  }
+}
+
 template <typename CType>
 decltype(Comparator<CType, EQUAL>::Compare)* GetComparator(CompareOperator op) {
   using cmp_t = decltype(Comparator<CType, EQUAL>::Compare);
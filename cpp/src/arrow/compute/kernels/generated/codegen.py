@@ -84,10 +84,10 @@ CAST_GENERATORS = [
                       parametric=True),
     CastCodeGenerator('Timestamp', ['Date32', 'Date64', 'Timestamp'],
                       parametric=True),
-    CastCodeGenerator('Binary', ['String']),
-    CastCodeGenerator('LargeBinary', ['LargeString']),
-    CastCodeGenerator('String', NUMERIC_TYPES + ['Timestamp']),
-    CastCodeGenerator('LargeString', NUMERIC_TYPES + ['Timestamp']),
+    CastCodeGenerator('Binary', ['String', 'LargeBinary']),
+    CastCodeGenerator('LargeBinary', ['LargeString', 'Binary']),
+    CastCodeGenerator('String', NUMERIC_TYPES + ['Timestamp', 'LargeString']),
+    CastCodeGenerator('LargeString', NUMERIC_TYPES + ['Timestamp', 'String']),
     CastCodeGenerator('Dictionary',
                       INTEGER_TYPES + FLOATING_TYPES + DATE_TIME_TYPES +
                       ['Null', 'Binary', 'FixedSizeBinary', 'String',
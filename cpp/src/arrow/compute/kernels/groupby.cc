@@ -0,0 +1,1131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/groupby.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::DictionaryTraits;
+using internal::HashTraits;
+
+namespace compute {
+
+namespace {
+
+// Don't split the input in slices smaller than this when aggregating in
+// parallel, the merge step would dominate.
+constexpr int64_t kMinParallelSliceLength = 1 << 16;
+
+// ----------------------------------------------------------------------
+// Key encoding: map each value of a key column to a dense integer id
+
+class GroupKeyEncoder {
+ public:
+  virtual ~GroupKeyEncoder() = default;
+
+  // Write the id of each (possibly null) value of `data` to `ids`
+  virtual Status Encode(const ArrayData& data, int32_t* ids) = 0;
+
+  // Number of distinct values seen so far
+  virtual int32_t size() const = 0;
+
+  // The distinct values seen so far, ordered by id
+  virtual Status GetUniques(std::shared_ptr<ArrayData>* out) = 0;
+};
+
+template <typename Type, typename Scalar>
+class TypedGroupKeyEncoder : public GroupKeyEncoder {
+ public:
+  TypedGroupKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool), memo_table_(pool, 0) {}
+
+  Status Encode(const ArrayData& data, int32_t* ids) override {
+    out_ids_ = ids;
+    return ArrayDataVisitor<Type>::Visit(data, this);
+  }
+
+  int32_t size() const override { return memo_table_.size(); }
+
+  Status GetUniques(std::shared_ptr<ArrayData>* out) override {
+    if (memo_table_.size() == 0) {
+      // DictionaryTraits doesn't allocate any buffer in that case
+      std::unique_ptr<ArrayBuilder> builder;
+      RETURN_NOT_OK(MakeBuilder(pool_, type_, &builder));
+      return builder->FinishInternal(out);
+    }
+    return DictionaryTraits<Type>::GetDictionaryArrayData(pool_, type_, memo_table_,
+                                                          0 /* start_offset */, out);
+  }
+
+  Status VisitNull() {
+    *out_ids_++ = memo_table_.GetOrInsertNull();
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    *out_ids_++ = memo_table_.GetOrInsert(value);
+    return Status::OK();
+  }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  MemoTable memo_table_;
+  int32_t* out_ids_ = NULLPTR;
+};
+
+template <typename Type, typename Enable = void>
+struct GroupKeyEncoderTraits {};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_boolean<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, bool>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_binary<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, util::string_view>;
+};
+
+template <typename Type>
+struct GroupKeyEncoderTraits<Type, enable_if_fixed_size_binary<Type>> {
+  using EncoderType = TypedGroupKeyEncoder<Type, util::string_view>;
+};
+
+#define PROCESS_SUPPORTED_GROUP_KEY_TYPES(PROCESS) \
+  PROCESS(BooleanType)                             \
+  PROCESS(UInt8Type)                               \
+  PROCESS(Int8Type)                                \
+  PROCESS(UInt16Type)                              \
+  PROCESS(Int16Type)                               \
+  PROCESS(UInt32Type)                              \
+  PROCESS(Int32Type)                               \
+  PROCESS(UInt64Type)                              \
+  PROCESS(Int64Type)                               \
+  PROCESS(FloatType)                               \
+  PROCESS(DoubleType)                              \
+  PROCESS(Date32Type)                              \
+  PROCESS(Date64Type)                              \
+  PROCESS(Time32Type)                              \
+  PROCESS(Time64Type)                              \
+  PROCESS(TimestampType)                           \
+  PROCESS(BinaryType)                              \
+  PROCESS(StringType)                              \
+  PROCESS(FixedSizeBinaryType)                     \
+  PROCESS(Decimal128Type)
+
+Status MakeGroupKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                           std::unique_ptr<GroupKeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                              \
+  case InType::type_id:                                                              \
+    out->reset(new typename GroupKeyEncoderTraits<InType>::EncoderType(type, pool)); \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_GROUP_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("group-by not implemented for key type ",
+                                type->ToString());
+}
+
+#undef PROCESS_SUPPORTED_GROUP_KEY_TYPES
+
+// ----------------------------------------------------------------------
+// Grouper: map each row of a set of key columns to a dense group id
+
+class Grouper {
+ public:
+  static Status Make(const std::vector<std::shared_ptr<DataType>>& key_types,
+                     MemoryPool* pool, std::unique_ptr<Grouper>* out) {
+    std::unique_ptr<Grouper> grouper(new Grouper(pool));
+    for (const auto& type : key_types) {
+      std::unique_ptr<GroupKeyEncoder> encoder;
+      RETURN_NOT_OK(MakeGroupKeyEncoder(type, pool, &encoder));
+      grouper->encoders_.push_back(std::move(encoder));
+    }
+    grouper->group_key_ids_.resize(key_types.size());
+    *out = std::move(grouper);
+    return Status::OK();
+  }
+
+  int32_t num_groups() const { return num_groups_; }
+
+  // Compute the group id of each of the `length` rows of `keys`
+  Status Consume(const std::vector<std::shared_ptr<ArrayData>>& keys, int64_t length,
+                 std::vector<int32_t>* group_ids) {
+    DCHECK_EQ(keys.size(), encoders_.size());
+    group_ids->resize(length);
+
+    if (encoders_.size() == 1) {
+      // Single key: the key id is the group id
+      RETURN_NOT_OK(encoders_[0]->Encode(*keys[0], group_ids->data()));
+      num_groups_ = encoders_[0]->size();
+      return Status::OK();
+    }
+
+    // Multiple keys: the group id is the memo index of the tuple of key ids
+    const size_t num_keys = encoders_.size();
+    column_ids_.resize(num_keys);
+    for (size_t i = 0; i < num_keys; ++i) {
+      column_ids_[i].resize(length);
+      RETURN_NOT_OK(encoders_[i]->Encode(*keys[i], column_ids_[i].data()));
+    }
+
+    const int32_t tuple_length = static_cast<int32_t>(num_keys * sizeof(int32_t));
+    std::string tuple(tuple_length, '\0');
+    auto on_found = [](int32_t group_id) {};
+    auto on_not_found = [this](int32_t group_id) {
+      for (size_t i = 0; i < group_key_ids_.size(); ++i) {
+        group_key_ids_[i].push_back(column_ids_[i][current_row_]);
+      }
+    };
+    for (current_row_ = 0; current_row_ < length; ++current_row_) {
+      for (size_t i = 0; i < num_keys; ++i) {
+        std::memcpy(&tuple[i * sizeof(int32_t)], &column_ids_[i][current_row_],
+                    sizeof(int32_t));
+      }
+      (*group_ids)[current_row_] = tuple_memo_table_.GetOrInsert(
+          tuple.data(), tuple_length, on_found, on_not_found);
+    }
+    num_groups_ = tuple_memo_table_.size();
+    return Status::OK();
+  }
+
+  // The key values of each group seen so far, one array per key column
+  Status GetKeys(FunctionContext* ctx, std::vector<std::shared_ptr<Array>>* out) {
+    out->clear();
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      std::shared_ptr<ArrayData> uniques;
+      RETURN_NOT_OK(encoders_[i]->GetUniques(&uniques));
+      if (encoders_.size() == 1) {
+        out->push_back(MakeArray(uniques));
+        continue;
+      }
+      Int32Builder indices_builder(ctx->memory_pool());
+      RETURN_NOT_OK(indices_builder.AppendValues(group_key_ids_[i]));
+      std::shared_ptr<Array> indices, keys;
+      RETURN_NOT_OK(indices_builder.Finish(&indices));
+      RETURN_NOT_OK(Take(ctx, *MakeArray(uniques), *indices, TakeOptions(), &keys));
+      out->push_back(keys);
+    }
+    return Status::OK();
+  }
+
+ private:
+  explicit Grouper(MemoryPool* pool) : tuple_memo_table_(pool, 0) {}
+
+  std::vector<std::unique_ptr<GroupKeyEncoder>> encoders_;
+  int32_t num_groups_ = 0;
+
+  // Only used with multiple keys
+  internal::BinaryMemoTable tuple_memo_table_;
+  // The key ids of each group, per key column
+  std::vector<std::vector<int32_t>> group_key_ids_;
+  // Scratch space for the key ids of the current batch, per key column
+  std::vector<std::vector<int32_t>> column_ids_;
+  int64_t current_row_ = 0;
+};
+
+// ----------------------------------------------------------------------
+// Grouped aggregators
+//
+// Like AggregateFunction, a grouped aggregator consumes inputs into a partial
+// state, can merge another partial state into its own and finalizes its state
+// into a result, except that each of those operations is done independently
+// for every group.
+
+class GroupedAggregator {
+ public:
+  virtual ~GroupedAggregator() = default;
+
+  /// \brief Consume values into the state of their group.
+  ///
+  /// `group_ids` has an entry for each value, all lower than `num_groups`.
+  virtual Status Consume(const ArrayData& values, const int32_t* group_ids,
+                         int32_t num_groups) = 0;
+
+  /// \brief Merge the state of another aggregator of the same kind.
+  ///
+  /// `group_id_mapping` maps each group of `other` to a group of this aggregator,
+  /// lower than `num_groups`.
+  virtual Status Merge(const GroupedAggregator& other, const int32_t* group_id_mapping,
+                       int32_t num_groups) = 0;
+
+  /// \brief Convert the state into one result value for each group.
+  virtual Status Finalize(std::shared_ptr<ArrayData>* out) = 0;
+
+  virtual std::shared_ptr<DataType> out_type() const = 0;
+};
+
+// Call `func(group_id, value)` for each non-null value
+template <typename CType, typename Func>
+void VisitGroupedValues(const ArrayData& data, const int32_t* group_ids, Func&& func) {
+  const CType* values = data.GetValues<CType>(1);
+  if (data.GetNullCount() != 0) {
+    internal::BitmapReader reader(data.buffers[0]->data(), data.offset, data.length);
+    for (int64_t i = 0; i < data.length; ++i) {
+      if (reader.IsSet()) {
+        func(group_ids[i], values[i]);
+      }
+      reader.Next();
+    }
+  } else {
+    for (int64_t i = 0; i < data.length; ++i) {
+      func(group_ids[i], values[i]);
+    }
+  }
+}
+
+class GroupedCount final : public GroupedAggregator {
+ public:
+  explicit GroupedCount(MemoryPool* pool) : pool_(pool) {}
+
+  Status Consume(const ArrayData& values, const int32_t* group_ids,
+                 int32_t num_groups) override {
+    counts_.resize(num_groups, 0);
+    if (values.GetNullCount() != 0) {
+      internal::BitmapReader reader(values.buffers[0]->data(), values.offset,
+                                    values.length);
+      for (int64_t i = 0; i < values.length; ++i) {
+        counts_[group_ids[i]] += reader.IsSet();
+        reader.Next();
+      }
+    } else {
+      for (int64_t i = 0; i < values.length; ++i) {
+        ++counts_[group_ids[i]];
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregator& other, const int32_t* group_id_mapping,
+               int32_t num_groups) override {
+    const auto& other_counts = checked_cast<const GroupedCount&>(other).counts_;
+    counts_.resize(num_groups, 0);
+    for (size_t i = 0; i < other_counts.size(); ++i) {
+      counts_[group_id_mapping[i]] += other_counts[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::shared_ptr<ArrayData>* out) override {
+    Int64Builder builder(pool_);
+    RETURN_NOT_OK(builder.AppendValues(counts_));
+    return builder.FinishInternal(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+ private:
+  MemoryPool* pool_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+class GroupedSum : public GroupedAggregator {
+ public:
+  using CType = typename ArrowType::c_type;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+
+  explicit GroupedSum(MemoryPool* pool) : pool_(pool) {}
+
+  Status Consume(const ArrayData& values, const int32_t* group_ids,
+                 int32_t num_groups) override {
+    Resize(num_groups);
+    VisitGroupedValues<CType>(values, group_ids, [this](int32_t group, CType value) {
+      sums_[group] += value;
+      ++counts_[group];
+    });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregator& other, const int32_t* group_id_mapping,
+               int32_t num_groups) override {
+    const auto& other_sum = checked_cast<const GroupedSum&>(other);
+    Resize(num_groups);
+    for (size_t i = 0; i < other_sum.sums_.size(); ++i) {
+      sums_[group_id_mapping[i]] += other_sum.sums_[i];
+      counts_[group_id_mapping[i]] += other_sum.counts_[i];
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::shared_ptr<ArrayData>* out) override {
+    NumericBuilder<SumType> builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(sums_.size())));
+    for (size_t i = 0; i < sums_.size(); ++i) {
+      if (counts_[i] > 0) {
+        builder.UnsafeAppend(sums_[i]);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.FinishInternal(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<SumType>::type_singleton();
+  }
+
+ protected:
+  void Resize(int32_t num_groups) {
+    sums_.resize(num_groups, 0);
+    counts_.resize(num_groups, 0);
+  }
+
+  MemoryPool* pool_;
+  std::vector<SumCType> sums_;
+  std::vector<int64_t> counts_;
+};
+
+template <typename ArrowType>
+class GroupedMean final : public GroupedSum<ArrowType> {
+ public:
+  using GroupedSum<ArrowType>::GroupedSum;
+
+  Status Finalize(std::shared_ptr<ArrayData>* out) override {
+    DoubleBuilder builder(this->pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(this->sums_.size())));
+    for (size_t i = 0; i < this->sums_.size(); ++i) {
+      if (this->counts_[i] > 0) {
+        builder.UnsafeAppend(static_cast<double>(this->sums_[i]) /
+                             static_cast<double>(this->counts_[i]));
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.FinishInternal(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+};
+
+// Compare is std::less for MIN and std::greater for MAX
+template <typename ArrowType, typename Compare>
+class GroupedMinMax final : public GroupedAggregator {
+ public:
+  using CType = typename ArrowType::c_type;
+
+  GroupedMinMax(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : type_(type), pool_(pool) {}
+
+  Status Consume(const ArrayData& values, const int32_t* group_ids,
+                 int32_t num_groups) override {
+    Resize(num_groups);
+    VisitGroupedValues<CType>(
+        values, group_ids, [this](int32_t group, CType value) { Update(group, value); });
+    return Status::OK();
+  }
+
+  Status Merge(const GroupedAggregator& other, const int32_t* group_id_mapping,
+               int32_t num_groups) override {
+    const auto& other_minmax = checked_cast<const GroupedMinMax&>(other);
+    Resize(num_groups);
+    for (size_t i = 0; i < other_minmax.values_.size(); ++i) {
+      if (other_minmax.has_values_[i]) {
+        Update(group_id_mapping[i], other_minmax.values_[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::shared_ptr<ArrayData>* out) override {
+    NumericBuilder<ArrowType> builder(type_, pool_);
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(values_.size())));
+    for (size_t i = 0; i < values_.size(); ++i) {
+      if (has_values_[i]) {
+        builder.UnsafeAppend(values_[i]);
+      } else {
+        builder.UnsafeAppendNull();
+      }
+    }
+    return builder.FinishInternal(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  void Resize(int32_t num_groups) {
+    values_.resize(num_groups, CType());
+    has_values_.resize(num_groups, false);
+  }
+
+  void Update(int32_t group, CType value) {
+    if (!has_values_[group] || Compare()(value, values_[group])) {
+      values_[group] = value;
+      has_values_[group] = true;
+    }
+  }
+
+  std::shared_ptr<DataType> type_;
+  MemoryPool* pool_;
+  std::vector<CType> values_;
+  std::vector<bool> has_values_;
+};
+
+const char* AggregateName(GroupByOptions::Aggregate aggregate) {
+  switch (aggregate) {
+    case GroupByOptions::COUNT:
+      return "count";
+    case GroupByOptions::SUM:
+      return "sum";
+    case GroupByOptions::MEAN:
+      return "mean";
+    case GroupByOptions::MIN:
+      return "min";
+    case GroupByOptions::MAX:
+      return "max";
+  }
+  return "<unknown>";
+}
+
+#define PROCESS_SUMMABLE_TYPES(PROCESS) \
+  PROCESS(UInt8Type)                    \
+  PROCESS(Int8Type)                     \
+  PROCESS(UInt16Type)                   \
+  PROCESS(Int16Type)                    \
+  PROCESS(UInt32Type)                   \
+  PROCESS(Int32Type)                    \
+  PROCESS(UInt64Type)                   \
+  PROCESS(Int64Type)                    \
+  PROCESS(FloatType)                    \
+  PROCESS(DoubleType)
+
+#define PROCESS_ORDERABLE_TYPES(PROCESS) \
+  PROCESS_SUMMABLE_TYPES(PROCESS)        \
+  PROCESS(Date32Type)                    \
+  PROCESS(Date64Type)                    \
+  PROCESS(Time32Type)                    \
+  PROCESS(Time64Type)                    \
+  PROCESS(TimestampType)
+
+Status MakeGroupedAggregator(GroupByOptions::Aggregate aggregate,
+                             const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                             std::unique_ptr<GroupedAggregator>* out) {
+  switch (aggregate) {
+    case GroupByOptions::COUNT:
+      out->reset(new GroupedCount(pool));
+      return Status::OK();
+    case GroupByOptions::SUM:
+      switch (type->id()) {
+#define PROCESS(InType)                       \
+  case InType::type_id:                       \
+    out->reset(new GroupedSum<InType>(pool)); \
+    return Status::OK();
+
+        PROCESS_SUMMABLE_TYPES(PROCESS)
+#undef PROCESS
+        default:
+          break;
+      }
+      break;
+    case GroupByOptions::MEAN:
+      switch (type->id()) {
+#define PROCESS(InType)                        \
+  case InType::type_id:                        \
+    out->reset(new GroupedMean<InType>(pool)); \
+    return Status::OK();
+
+        PROCESS_SUMMABLE_TYPES(PROCESS)
+#undef PROCESS
+        default:
+          break;
+      }
+      break;
+    case GroupByOptions::MIN:
+      switch (type->id()) {
+#define PROCESS(InType)                                                             \
+  case InType::type_id:                                                             \
+    out->reset(                                                                     \
+        new GroupedMinMax<InType, std::less<typename InType::c_type>>(type, pool)); \
+    return Status::OK();
+
+        PROCESS_ORDERABLE_TYPES(PROCESS)
+#undef PROCESS
+        default:
+          break;
+      }
+      break;
+    case GroupByOptions::MAX:
+      switch (type->id()) {
+#define PROCESS(InType)                                                                \
+  case InType::type_id:                                                                \
+    out->reset(                                                                        \
+        new GroupedMinMax<InType, std::greater<typename InType::c_type>>(type, pool)); \
+    return Status::OK();
+
+        PROCESS_ORDERABLE_TYPES(PROCESS)
+#undef PROCESS
+        default:
+          break;
+      }
+      break;
+  }
+  return Status::NotImplemented("group-by ", AggregateName(aggregate),
+                                " not implemented for value type ", type->ToString());
+}
+
+#undef PROCESS_ORDERABLE_TYPES
+#undef PROCESS_SUMMABLE_TYPES
+
+// ----------------------------------------------------------------------
+// Group-by driver
+
+// The partial state of a group-by over a subset of the input rows
+struct GroupByState : public GroupByAggregator::State {
+  std::unique_ptr<Grouper> grouper;
+  std::vector<std::unique_ptr<GroupedAggregator>> aggregators;
+  std::vector<int32_t> group_ids;
+};
+
+class GroupByImpl {
+ public:
+  GroupByImpl(FunctionContext* ctx, const GroupByOptions& options,
+              const std::shared_ptr<Schema>& schema, int num_keys)
+      : ctx_(ctx), options_(options), schema_(schema), num_keys_(num_keys) {}
+
+  Status MakeState(std::unique_ptr<GroupByState>* out) {
+    std::unique_ptr<GroupByState> state(new GroupByState);
+    std::vector<std::shared_ptr<DataType>> key_types;
+    for (int i = 0; i < num_keys_; ++i) {
+      key_types.push_back(schema_->field(i)->type());
+    }
+    RETURN_NOT_OK(Grouper::Make(key_types, ctx_->memory_pool(), &state->grouper));
+    for (size_t i = 0; i < options_.aggregates.size(); ++i) {
+      std::unique_ptr<GroupedAggregator> aggregator;
+      RETURN_NOT_OK(MakeGroupedAggregator(
+          options_.aggregates[i], schema_->field(num_keys_ + static_cast<int>(i))->type(),
+          ctx_->memory_pool(), &aggregator));
+      state->aggregators.push_back(std::move(aggregator));
+    }
+    *out = std::move(state);
+    return Status::OK();
+  }
+
+  Status Consume(const RecordBatch& batch, GroupByState* state) {
+    // The encoders and aggregators need the null counts of the columns,
+    // which are unknown in sliced batches: Array::null_count() computes them.
+    std::vector<std::shared_ptr<ArrayData>> columns;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      std::shared_ptr<Array> column = batch.column(i);
+      column->null_count();
+      columns.push_back(column->data());
+    }
+    std::vector<std::shared_ptr<ArrayData>> keys(columns.begin(),
+                                                 columns.begin() + num_keys_);
+    RETURN_NOT_OK(state->grouper->Consume(keys, batch.num_rows(), &state->group_ids));
+    const int32_t num_groups = state->grouper->num_groups();
+    for (size_t i = 0; i < state->aggregators.size(); ++i) {
+      RETURN_NOT_OK(state->aggregators[i]->Consume(
+          *columns[num_keys_ + i], state->group_ids.data(), num_groups));
+    }
+    return Status::OK();
+  }
+
+  // Merge `src` into `dst`, by looking up the key values of the groups of
+  // `src` as if they were input rows of `dst`.
+  Status Merge(GroupByState* src, GroupByState* dst) {
+    std::vector<std::shared_ptr<Array>> src_keys;
+    RETURN_NOT_OK(src->grouper->GetKeys(ctx_, &src_keys));
+    std::vector<std::shared_ptr<ArrayData>> src_key_data;
+    for (const auto& key : src_keys) {
+      src_key_data.push_back(key->data());
+    }
+    RETURN_NOT_OK(dst->grouper->Consume(src_key_data, src->grouper->num_groups(),
+                                        &dst->group_ids));
+    const int32_t num_groups = dst->grouper->num_groups();
+    for (size_t i = 0; i < dst->aggregators.size(); ++i) {
+      RETURN_NOT_OK(dst->aggregators[i]->Merge(*src->aggregators[i],
+                                               dst->group_ids.data(), num_groups));
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(GroupByState* state, std::shared_ptr<Array>* out) {
+    std::vector<std::shared_ptr<Array>> columns;
+    RETURN_NOT_OK(state->grouper->GetKeys(ctx_, &columns));
+
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i = 0; i < num_keys_; ++i) {
+      fields.push_back(field("key_" + std::to_string(i), columns[i]->type()));
+    }
+    for (size_t i = 0; i < state->aggregators.size(); ++i) {
+      std::shared_ptr<ArrayData> result;
+      RETURN_NOT_OK(state->aggregators[i]->Finalize(&result));
+      columns.push_back(MakeArray(result));
+      fields.push_back(field(
+          std::string(AggregateName(options_.aggregates[i])) + "_" + std::to_string(i),
+          state->aggregators[i]->out_type()));
+    }
+    *out = std::make_shared<StructArray>(struct_(fields), state->grouper->num_groups(),
+                                         columns);
+    return Status::OK();
+  }
+
+ private:
+  FunctionContext* ctx_;
+  const GroupByOptions& options_;
+  std::shared_ptr<Schema> schema_;
+  int num_keys_;
+};
+
+Status AsChunkedArray(const Datum& datum, std::shared_ptr<ChunkedArray>* out) {
+  switch (datum.kind()) {
+    case Datum::ARRAY:
+      *out = std::make_shared<ChunkedArray>(ArrayVector{datum.make_array()});
+      return Status::OK();
+    case Datum::CHUNKED_ARRAY:
+      *out = datum.chunked_array();
+      return Status::OK();
+    default:
+      break;
+  }
+  return Status::Invalid("GroupBy expects Array or ChunkedArray datums");
+}
+
+// ----------------------------------------------------------------------
+// Distinct driver
+
+// The row kept for each distinct key of the rows consumed into it
+class DistinctState {
+ public:
+  static Status Make(const std::vector<std::shared_ptr<DataType>>& key_types,
+                     DistinctOptions::Keep keep, MemoryPool* pool,
+                     std::unique_ptr<DistinctState>* out) {
+    std::unique_ptr<DistinctState> state(new DistinctState(keep));
+    RETURN_NOT_OK(Grouper::Make(key_types, pool, &state->grouper_));
+    *out = std::move(state);
+    return Status::OK();
+  }
+
+  // Consume the `length` rows of `keys`, numbered `row_ids` if not null, else
+  // from `first_row_id` on.  The positions in `keys` of the rows with new keys
+  // are appended to `new_rows` if not null.
+  Status Consume(const std::vector<std::shared_ptr<ArrayData>>& keys, int64_t length,
+                 int64_t first_row_id, const int64_t* row_ids,
+                 std::vector<int64_t>* new_rows) {
+    RETURN_NOT_OK(grouper_->Consume(keys, length, &group_ids_));
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t row_id = row_ids ? row_ids[i] : first_row_id + i;
+      // Group ids are given in order of first appearance
+      const auto group_id = static_cast<size_t>(group_ids_[i]);
+      if (group_id == kept_rows_.size()) {
+        kept_rows_.push_back(row_id);
+        if (new_rows) {
+          new_rows->push_back(i);
+        }
+      } else if (keep_ == DistinctOptions::LAST) {
+        kept_rows_[group_id] = row_id;
+      }
+    }
+    return Status::OK();
+  }
+
+  // The row kept for each distinct key, by group id
+  const std::vector<int64_t>& kept_rows() const { return kept_rows_; }
+
+ private:
+  explicit DistinctState(DistinctOptions::Keep keep) : keep_(keep) {}
+
+  DistinctOptions::Keep keep_;
+  std::unique_ptr<Grouper> grouper_;
+  std::vector<int32_t> group_ids_;
+  std::vector<int64_t> kept_rows_;
+};
+
+Status GetKeyTypes(const Schema& schema, const std::vector<int>& keys,
+                   std::vector<std::shared_ptr<DataType>>* out) {
+  if (keys.empty()) {
+    return Status::Invalid("Distinct needs at least one key");
+  }
+  out->clear();
+  for (int key : keys) {
+    if (key < 0 || key >= schema.num_fields()) {
+      return Status::Invalid("Distinct key ", key, " out of bounds for ",
+                             schema.num_fields(), " columns");
+    }
+    out->push_back(schema.field(key)->type());
+  }
+  return Status::OK();
+}
+
+// The key columns of a batch, with their null counts computed as the
+// encoders need them
+std::vector<std::shared_ptr<ArrayData>> GetKeyData(const RecordBatch& batch,
+                                                   const std::vector<int>& keys) {
+  std::vector<std::shared_ptr<ArrayData>> out;
+  for (int key : keys) {
+    std::shared_ptr<Array> column = batch.column(key);
+    column->null_count();
+    out.push_back(column->data());
+  }
+  return out;
+}
+
+Status MakeIndices(MemoryPool* pool, const std::vector<int64_t>& values,
+                   std::shared_ptr<Array>* out) {
+  Int64Builder builder(pool);
+  RETURN_NOT_OK(builder.AppendValues(values));
+  return builder.Finish(out);
+}
+
+}  // namespace
+
+class GroupByAggregator::Impl {
+ public:
+  Impl(FunctionContext* ctx, const GroupByOptions& options,
+       const std::shared_ptr<Schema>& schema, int num_keys)
+      : options_(options), group_by_(ctx, options_, schema, num_keys) {}
+
+  GroupByImpl* group_by() { return &group_by_; }
+
+ private:
+  // Referred to by group_by_
+  const GroupByOptions options_;
+  GroupByImpl group_by_;
+};
+
+GroupByAggregator::GroupByAggregator(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+GroupByAggregator::~GroupByAggregator() {}
+
+Status GroupByAggregator::Make(FunctionContext* ctx,
+                               const std::shared_ptr<Schema>& schema, int num_keys,
+                               const GroupByOptions& options,
+                               std::unique_ptr<GroupByAggregator>* out) {
+  if (num_keys < 1) {
+    return Status::Invalid("GroupBy needs at least one key");
+  }
+  if (schema->num_fields() - num_keys != static_cast<int>(options.aggregates.size())) {
+    return Status::Invalid("GroupBy got ", schema->num_fields() - num_keys,
+                           " value columns but ", options.aggregates.size(),
+                           " aggregates");
+  }
+  std::unique_ptr<Impl> impl(new Impl(ctx, options, schema, num_keys));
+  // Check the key and value types
+  std::unique_ptr<GroupByState> state;
+  RETURN_NOT_OK(impl->group_by()->MakeState(&state));
+  out->reset(new GroupByAggregator(std::move(impl)));
+  return Status::OK();
+}
+
+Status GroupByAggregator::MakeState(std::unique_ptr<State>* out) const {
+  std::unique_ptr<GroupByState> state;
+  RETURN_NOT_OK(impl_->group_by()->MakeState(&state));
+  *out = std::move(state);
+  return Status::OK();
+}
+
+Status GroupByAggregator::Consume(const RecordBatch& batch, State* state) const {
+  return impl_->group_by()->Consume(batch, checked_cast<GroupByState*>(state));
+}
+
+Status GroupByAggregator::Merge(State* src, State* dst) const {
+  return impl_->group_by()->Merge(checked_cast<GroupByState*>(src),
+                                  checked_cast<GroupByState*>(dst));
+}
+
+Status GroupByAggregator::Finalize(State* state, std::shared_ptr<Array>* out) const {
+  return impl_->group_by()->Finalize(checked_cast<GroupByState*>(state), out);
+}
+
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& values, const GroupByOptions& options,
+               std::shared_ptr<Array>* out) {
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy needs at least one key");
+  }
+  if (options.aggregates.size() != values.size()) {
+    return Status::Invalid("GroupBy got ", values.size(), " value columns but ",
+                           options.aggregates.size(), " aggregates");
+  }
+
+  // Assemble all inputs in a Table, so as to iterate over aligned row slices
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (size_t i = 0; i < keys.size() + values.size(); ++i) {
+    const bool is_key = i < keys.size();
+    const Datum& datum = is_key ? keys[i] : values[i - keys.size()];
+    std::shared_ptr<ChunkedArray> column;
+    RETURN_NOT_OK(AsChunkedArray(datum, &column));
+    if (i > 0 && column->length() != columns[0]->length()) {
+      return Status::Invalid("GroupBy inputs must all have the same length");
+    }
+    fields.push_back(field((is_key ? "key_" : "value_") + std::to_string(i),
+                           column->type()));
+    columns.push_back(std::move(column));
+  }
+  auto table = Table::Make(schema(fields), columns);
+  const int64_t length = columns[0]->length();
+
+  int num_tasks = 1;
+  if (options.use_threads) {
+    const int64_t max_tasks = std::max<int64_t>(length / kMinParallelSliceLength, 1);
+    num_tasks = static_cast<int>(
+        std::min<int64_t>(internal::GetCpuThreadPool()->GetCapacity(), max_tasks));
+  }
+
+  TableBatchReader reader(*table);
+  if (num_tasks > 1) {
+    reader.set_chunksize(BitUtil::CeilDiv(length, num_tasks));
+  }
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+
+  GroupByImpl impl(ctx, options, table->schema(), static_cast<int>(keys.size()));
+
+  // Each task aggregates a contiguous range of batches into its own state
+  num_tasks = std::max(1, std::min(num_tasks, static_cast<int>(batches.size())));
+  std::vector<std::unique_ptr<GroupByState>> states(num_tasks);
+  for (auto& state : states) {
+    RETURN_NOT_OK(impl.MakeState(&state));
+  }
+  auto consume_range = [&](int task) -> Status {
+    const size_t begin = batches.size() * task / num_tasks;
+    const size_t end = batches.size() * (task + 1) / num_tasks;
+    for (size_t i = begin; i < end; ++i) {
+      RETURN_NOT_OK(impl.Consume(*batches[i], states[task].get()));
+    }
+    return Status::OK();
+  };
+  if (num_tasks > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_tasks, consume_range));
+  } else {
+    RETURN_NOT_OK(consume_range(0));
+  }
+
+  // Merging in input order keeps groups in order of first appearance
+  for (int task = 1; task < num_tasks; ++task) {
+    RETURN_NOT_OK(impl.Merge(states[task].get(), states[0].get()));
+  }
+  return impl.Finalize(states[0].get(), out);
+}
+
+Status DistinctIndices(FunctionContext* ctx, const Table& table,
+                       const std::vector<int>& keys, const DistinctOptions& options,
+                       std::shared_ptr<Array>* out) {
+  std::vector<std::shared_ptr<DataType>> key_types;
+  RETURN_NOT_OK(GetKeyTypes(*table.schema(), keys, &key_types));
+
+  // Only the key columns are read
+  std::vector<std::shared_ptr<Field>> key_fields;
+  std::vector<std::shared_ptr<ChunkedArray>> key_columns;
+  std::vector<int> key_indices;
+  for (int key : keys) {
+    key_indices.push_back(static_cast<int>(key_fields.size()));
+    key_fields.push_back(table.schema()->field(key));
+    key_columns.push_back(table.column(key));
+  }
+  auto key_table = Table::Make(schema(key_fields), key_columns, table.num_rows());
+  const int64_t length = table.num_rows();
+
+  int num_partitions = 1;
+  if (options.use_threads) {
+    const int64_t max_partitions = std::max<int64_t>(length / kMinParallelSliceLength, 1);
+    num_partitions = static_cast<int>(
+        std::min<int64_t>(internal::GetCpuThreadPool()->GetCapacity(), max_partitions));
+  }
+
+  TableBatchReader reader(*key_table);
+  if (num_partitions > 1) {
+    reader.set_chunksize(BitUtil::CeilDiv(length, num_partitions));
+  }
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+  std::vector<int64_t> batch_offsets(batches.size() + 1, 0);
+  for (size_t i = 0; i < batches.size(); ++i) {
+    batch_offsets[i + 1] = batch_offsets[i] + batches[i]->num_rows();
+  }
+
+  std::vector<int64_t> kept_rows;
+  if (num_partitions == 1) {
+    std::unique_ptr<DistinctState> state;
+    RETURN_NOT_OK(
+        DistinctState::Make(key_types, options.keep, ctx->memory_pool(), &state));
+    for (size_t i = 0; i < batches.size(); ++i) {
+      RETURN_NOT_OK(state->Consume(GetKeyData(*batches[i], key_indices),
+                                   batches[i]->num_rows(), batch_offsets[i], NULLPTR,
+                                   NULLPTR));
+    }
+    kept_rows = state->kept_rows();
+  } else {
+    // Radix-partition the rows of each batch by the hash of their keys, so that
+    // all the rows with equal keys land in the same partition
+    std::vector<std::shared_ptr<Array>> partition_indices(batches.size());
+    std::vector<std::vector<int64_t>> partition_offsets(batches.size());
+    RETURN_NOT_OK(internal::ParallelFor(
+        static_cast<int>(batches.size()), [&](int i) -> Status {
+          return HashPartitionIndices(ctx, *batches[i], key_indices, num_partitions,
+                                      &partition_indices[i], &partition_offsets[i]);
+        }));
+
+    // Then deduplicate the partitions independently, each over the batches in
+    // order so as to keep the first or last row of each key
+    std::vector<std::vector<int64_t>> partition_kept_rows(num_partitions);
+    RETURN_NOT_OK(internal::ParallelFor(num_partitions, [&](int partition) -> Status {
+      std::unique_ptr<DistinctState> state;
+      RETURN_NOT_OK(
+          DistinctState::Make(key_types, options.keep, ctx->memory_pool(), &state));
+      std::vector<int64_t> row_ids;
+      for (size_t i = 0; i < batches.size(); ++i) {
+        const int64_t begin = partition_offsets[i][partition];
+        const int64_t num_rows = partition_offsets[i][partition + 1] - begin;
+        if (num_rows == 0) {
+          continue;
+        }
+        auto indices = partition_indices[i]->Slice(begin, num_rows);
+        std::vector<std::shared_ptr<ArrayData>> key_data;
+        for (int key : key_indices) {
+          std::shared_ptr<Array> taken;
+          RETURN_NOT_OK(
+              Take(ctx, *batches[i]->column(key), *indices, TakeOptions(), &taken));
+          taken->null_count();
+          key_data.push_back(taken->data());
+        }
+        const int64_t* batch_rows =
+            checked_cast<const Int64Array&>(*indices).raw_values();
+        row_ids.resize(num_rows);
+        for (int64_t j = 0; j < num_rows; ++j) {
+          row_ids[j] = batch_offsets[i] + batch_rows[j];
+        }
+        RETURN_NOT_OK(state->Consume(key_data, num_rows, 0, row_ids.data(), NULLPTR));
+      }
+      partition_kept_rows[partition] = state->kept_rows();
+      return Status::OK();
+    }));
+
+    for (const auto& rows : partition_kept_rows) {
+      kept_rows.insert(kept_rows.end(), rows.begin(), rows.end());
+    }
+  }
+
+  std::sort(kept_rows.begin(), kept_rows.end());
+  return MakeIndices(ctx->memory_pool(), kept_rows, out);
+}
+
+class DistinctIndexer::Impl {
+ public:
+  Impl(FunctionContext* ctx, const std::vector<int>& keys)
+      : ctx_(ctx), keys_(keys) {}
+
+  Status Init(const Schema& schema, const DistinctOptions& options) {
+    std::vector<std::shared_ptr<DataType>> key_types;
+    RETURN_NOT_OK(GetKeyTypes(schema, keys_, &key_types));
+    return DistinctState::Make(key_types, options.keep, ctx_->memory_pool(), &state_);
+  }
+
+  Status Consume(const RecordBatch& batch, std::shared_ptr<Array>* new_indices) {
+    new_rows_.clear();
+    RETURN_NOT_OK(state_->Consume(GetKeyData(batch, keys_), batch.num_rows(), num_rows_,
+                                  NULLPTR, new_indices ? &new_rows_ : NULLPTR));
+    num_rows_ += batch.num_rows();
+    if (new_indices) {
+      RETURN_NOT_OK(MakeIndices(ctx_->memory_pool(), new_rows_, new_indices));
+    }
+    return Status::OK();
+  }
+
+  int64_t num_rows() const { return num_rows_; }
+
+  int64_t num_distinct() const {
+    return static_cast<int64_t>(state_->kept_rows().size());
+  }
+
+  Status GetIndices(std::shared_ptr<Array>* out) const {
+    std::vector<int64_t> kept_rows = state_->kept_rows();
+    std::sort(kept_rows.begin(), kept_rows.end());
+    return MakeIndices(ctx_->memory_pool(), kept_rows, out);
+  }
+
+ private:
+  FunctionContext* ctx_;
+  std::vector<int> keys_;
+  std::unique_ptr<DistinctState> state_;
+  int64_t num_rows_ = 0;
+  std::vector<int64_t> new_rows_;
+};
+
+DistinctIndexer::DistinctIndexer(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+DistinctIndexer::~DistinctIndexer() {}
+
+Status DistinctIndexer::Make(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                             const std::vector<int>& keys,
+                             const DistinctOptions& options,
+                             std::unique_ptr<DistinctIndexer>* out) {
+  std::unique_ptr<Impl> impl(new Impl(ctx, keys));
+  RETURN_NOT_OK(impl->Init(*schema, options));
+  out->reset(new DistinctIndexer(std::move(impl)));
+  return Status::OK();
+}
+
+Status DistinctIndexer::Consume(const RecordBatch& batch,
+                                std::shared_ptr<Array>* new_indices) {
+  return impl_->Consume(batch, new_indices);
+}
+
+int64_t DistinctIndexer::num_rows() const { return impl_->num_rows(); }
+
+int64_t DistinctIndexer::num_distinct() const { return impl_->num_distinct(); }
+
+Status DistinctIndexer::GetIndices(std::shared_ptr<Array>* out) const {
+  return impl_->GetIndices(out);
+}
+
+}  // namespace compute
+}  // namespace arrow
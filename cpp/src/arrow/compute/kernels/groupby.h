@@ -0,0 +1,239 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+class Schema;
+class Table;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class GroupByOptions
+///
+/// Controls which aggregate is computed for each value column passed to
+/// GroupBy, and whether partial aggregates may be computed in parallel.
+struct ARROW_EXPORT GroupByOptions {
+  enum Aggregate {
+    // Count non-null values in each group.
+    COUNT = 0,
+    // Sum non-null values in each group, using the widest type of the same kind.
+    SUM,
+    // Arithmetic mean of non-null values in each group, as a double.
+    MEAN,
+    // Smallest non-null value in each group.
+    MIN,
+    // Largest non-null value in each group.
+    MAX,
+  };
+
+  GroupByOptions() = default;
+
+  explicit GroupByOptions(std::vector<Aggregate> aggregates)
+      : aggregates(std::move(aggregates)) {}
+
+  /// One aggregate for each value column, in the same order.
+  std::vector<Aggregate> aggregates;
+
+  /// If true, the input is split in slices which are aggregated independently
+  /// on the CPU thread pool, then merged.
+  bool use_threads = true;
+};
+
+/// \brief Compute aggregates over the values grouped by one or more keys.
+///
+/// Rows are grouped by the tuple of their key values; a null key is a group
+/// of its own.  Groups are emitted in order of first appearance in the input.
+///
+/// The result is a StructArray with one row per group.  Its first fields
+/// ("key_0", "key_1", ...) hold the key values of each group, followed by one
+/// field per value column (named after the aggregate and the value column
+/// index, e.g. "sum_0"), holding the aggregated values.  SUM, MEAN, MIN and
+/// MAX yield null for groups without any non-null value.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] keys the key columns, as Array or ChunkedArray of equal lengths
+/// \param[in] values the value columns, as Array or ChunkedArray of the same
+/// length as the keys
+/// \param[in] options the aggregates to compute, one per value column
+/// \param[out] out the resulting StructArray
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* context, const std::vector<Datum>& keys,
+               const std::vector<Datum>& values, const GroupByOptions& options,
+               std::shared_ptr<Array>* out);
+
+/// \brief Incremental group-by, aggregating a stream of record batches
+///
+/// Batches are consumed into partial states, which are independent of each
+/// other: several threads may consume batches concurrently, each into a state
+/// of its own.  The states are then merged and finalized into the same
+/// StructArray as GroupBy() returns.  GroupByOptions::use_threads is ignored.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+class ARROW_EXPORT GroupByAggregator {
+ public:
+  /// \brief The partial aggregates of the batches consumed into it
+  class State {
+   public:
+    virtual ~State() = default;
+  };
+
+  ~GroupByAggregator();
+
+  /// \brief Make an aggregator of batches of the given schema
+  ///
+  /// \param[in] context the FunctionContext, whose memory pool the states use
+  /// \param[in] schema the schema of the batches, the key columns first, then
+  /// the value columns, one per aggregate
+  /// \param[in] num_keys the number of key columns
+  /// \param[in] options the aggregates to compute
+  /// \param[out] out the aggregator
+  static Status Make(FunctionContext* context, const std::shared_ptr<Schema>& schema,
+                     int num_keys, const GroupByOptions& options,
+                     std::unique_ptr<GroupByAggregator>* out);
+
+  /// \brief Make an empty state
+  Status MakeState(std::unique_ptr<State>* out) const;
+
+  /// \brief Aggregate a batch into a state, which no other thread may use
+  Status Consume(const RecordBatch& batch, State* state) const;
+
+  /// \brief Merge the groups of src after those of dst into dst
+  Status Merge(State* src, State* dst) const;
+
+  /// \brief Return the keys and aggregates of the groups of a state
+  Status Finalize(State* state, std::shared_ptr<Array>* out) const;
+
+ private:
+  class Impl;
+  explicit GroupByAggregator(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \class DistinctOptions
+///
+/// Controls which row DistinctIndices keeps for each distinct key, and whether
+/// the rows may be deduplicated in parallel.
+struct ARROW_EXPORT DistinctOptions {
+  enum Keep {
+    // Keep the first row with each key.
+    FIRST = 0,
+    // Keep the last row with each key.
+    LAST,
+  };
+
+  DistinctOptions() = default;
+
+  explicit DistinctOptions(Keep keep) : keep(keep) {}
+
+  Keep keep = FIRST;
+
+  /// If true, the rows are split in partitions by hashing their keys, which
+  /// are deduplicated independently on the CPU thread pool.
+  bool use_threads = true;
+};
+
+/// \brief Compute the indices of the rows of a table to keep so that no two
+/// rows have the same key values.
+///
+/// Rows are compared on the tuple of their key values, as by GroupBy(): null
+/// keys are equal to each other.  One row is kept per distinct key, the first
+/// or the last one depending on options.keep.  The indices are in increasing
+/// order, so that taking them preserves the order of the rows.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] table the rows to deduplicate
+/// \param[in] keys the indices of the key columns in the table
+/// \param[in] options which row to keep, and whether to use threads
+/// \param[out] out an Int64Array of the indices of the rows kept
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status DistinctIndices(FunctionContext* context, const Table& table,
+                       const std::vector<int>& keys, const DistinctOptions& options,
+                       std::shared_ptr<Array>* out);
+
+/// \brief Incremental DistinctIndices, deduplicating a stream of record batches
+///
+/// The key values seen in the batches consumed so far are kept, so that rows
+/// are deduplicated across batches, e.g. those of a dataset scan.  Rows are
+/// numbered across batches in the order they are consumed.
+/// DistinctOptions::use_threads is ignored.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+class ARROW_EXPORT DistinctIndexer {
+ public:
+  ~DistinctIndexer();
+
+  /// \brief Make an indexer of batches of the given schema
+  ///
+  /// \param[in] context the FunctionContext, whose memory pool the indexer uses
+  /// \param[in] schema the schema of the batches
+  /// \param[in] keys the indices of the key columns in the schema
+  /// \param[in] options which row to keep
+  /// \param[out] out the indexer
+  static Status Make(FunctionContext* context, const std::shared_ptr<Schema>& schema,
+                     const std::vector<int>& keys, const DistinctOptions& options,
+                     std::unique_ptr<DistinctIndexer>* out);
+
+  /// \brief Consume the next batch of the stream
+  ///
+  /// \param[in] batch the batch, of the schema of the indexer
+  /// \param[out] new_indices if not null, an Int64Array of the indices in the
+  /// batch of the rows with keys not seen before.  With DistinctOptions::FIRST,
+  /// those are the rows of the batch which are kept, for filtering it on the fly.
+  Status Consume(const RecordBatch& batch,
+                 std::shared_ptr<Array>* new_indices = NULLPTR);
+
+  /// \brief The number of rows consumed so far
+  int64_t num_rows() const;
+
+  /// \brief The number of distinct keys among the rows consumed so far
+  int64_t num_distinct() const;
+
+  /// \brief Return the indices of the rows kept among the rows consumed so far,
+  /// as an Int64Array in increasing order
+  Status GetIndices(std::shared_ptr<Array>* out) const;
+
+ private:
+  class Impl;
+  explicit DistinctIndexer(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,330 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/groupby.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestGroupBy : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertGroupBy(const std::vector<Datum>& keys, const std::vector<Datum>& values,
+                     const GroupByOptions& options, const std::string& expected_json) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(GroupBy(&this->ctx_, keys, values, options, &actual));
+    ASSERT_OK(actual->Validate());
+    auto expected = ArrayFromJSON(actual->type(), expected_json);
+    AssertArraysEqual(*expected, *actual);
+  }
+};
+
+TEST_F(TestGroupBy, SingleKey) {
+  auto keys = ArrayFromJSON(utf8(), R"(["a", "b", null, "a", "b", "c", null])");
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, null, null, 7]");
+
+  GroupByOptions options({GroupByOptions::COUNT, GroupByOptions::SUM,
+                          GroupByOptions::MEAN, GroupByOptions::MIN,
+                          GroupByOptions::MAX});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values, values, values, values, values},
+                    options, &actual));
+  ASSERT_OK(actual->Validate());
+
+  auto expected_type =
+      struct_({field("key_0", utf8()), field("count_0", int64()),
+               field("sum_1", int64()), field("mean_2", float64()),
+               field("min_3", int32()), field("max_4", int32())});
+  ASSERT_TRUE(actual->type()->Equals(expected_type));
+
+  auto expected = ArrayFromJSON(expected_type, R"([
+    {"key_0": "a", "count_0": 2, "sum_1": 5, "mean_2": 2.5, "min_3": 1, "max_4": 4},
+    {"key_0": "b", "count_0": 1, "sum_1": 2, "mean_2": 2.0, "min_3": 2, "max_4": 2},
+    {"key_0": null, "count_0": 2, "sum_1": 10, "mean_2": 5.0, "min_3": 3, "max_4": 7},
+    {"key_0": "c", "count_0": 0, "sum_1": null, "mean_2": null, "min_3": null,
+     "max_4": null}
+  ])");
+  AssertArraysEqual(*expected, *actual);
+}
+
+TEST_F(TestGroupBy, MultipleKeys) {
+  auto key0 = ArrayFromJSON(int64(), "[1, 1, 2, 2, 1, null, null]");
+  auto key1 = ArrayFromJSON(boolean(), "[true, false, true, true, true, null, false]");
+  auto values = ArrayFromJSON(float64(), "[0.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5]");
+
+  GroupByOptions options({GroupByOptions::SUM});
+  AssertGroupBy({key0, key1}, {values}, options, R"([
+    {"key_0": 1, "key_1": true, "sum_0": 5.0},
+    {"key_0": 1, "key_1": false, "sum_0": 1.5},
+    {"key_0": 2, "key_1": true, "sum_0": 6.0},
+    {"key_0": null, "key_1": null, "sum_0": 5.5},
+    {"key_0": null, "key_1": false, "sum_0": 6.5}
+  ])");
+}
+
+TEST_F(TestGroupBy, ChunkedInputs) {
+  auto keys = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[3, 1]"), ArrayFromJSON(int32(), "[3, 2, 1, 3]")});
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(uint8(), "[10, 20, 30]"),
+                  ArrayFromJSON(uint8(), "[40, 50]"), ArrayFromJSON(uint8(), "[60]")});
+
+  GroupByOptions options({GroupByOptions::SUM, GroupByOptions::MAX});
+  AssertGroupBy({keys}, {values, values}, options, R"([
+    {"key_0": 3, "sum_0": 100, "max_1": 60},
+    {"key_0": 1, "sum_0": 70, "max_1": 50},
+    {"key_0": 2, "sum_0": 40, "max_1": 40}
+  ])");
+}
+
+TEST_F(TestGroupBy, EmptyInput) {
+  auto keys = ArrayFromJSON(utf8(), "[]");
+  auto values = ArrayFromJSON(int8(), "[]");
+  AssertGroupBy({keys}, {values}, GroupByOptions({GroupByOptions::COUNT}), "[]");
+}
+
+TEST_F(TestGroupBy, ParallelMatchesSerial) {
+  // Large enough to be split into several slices aggregated in parallel
+  const int64_t length = 1 << 19;
+  Int32Builder key_builder;
+  Int64Builder value_builder;
+  ASSERT_OK(key_builder.Reserve(length));
+  ASSERT_OK(value_builder.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    key_builder.UnsafeAppend(static_cast<int32_t>((i * 7919) % 1013));
+    if (i % 11 == 0) {
+      value_builder.UnsafeAppendNull();
+    } else {
+      value_builder.UnsafeAppend(i);
+    }
+  }
+  std::shared_ptr<Array> keys, values;
+  ASSERT_OK(key_builder.Finish(&keys));
+  ASSERT_OK(value_builder.Finish(&values));
+
+  GroupByOptions options({GroupByOptions::COUNT, GroupByOptions::SUM,
+                          GroupByOptions::MIN, GroupByOptions::MAX});
+  options.use_threads = false;
+  std::shared_ptr<Array> serial, parallel;
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values, values, values, values}, options,
+                    &serial));
+  options.use_threads = true;
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values, values, values, values}, options,
+                    &parallel));
+  ASSERT_EQ(1013, serial->length());
+  AssertArraysEqual(*serial, *parallel);
+}
+
+TEST_F(TestGroupBy, Errors) {
+  auto keys = ArrayFromJSON(int32(), "[1, 2, 3]");
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  std::shared_ptr<Array> out;
+
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {}, {values},
+                                 GroupByOptions({GroupByOptions::COUNT}), &out));
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {keys}, {values}, GroupByOptions(), &out));
+  ASSERT_RAISES(Invalid, GroupBy(&this->ctx_, {keys}, {ArrayFromJSON(int32(), "[1]")},
+                                 GroupByOptions({GroupByOptions::SUM}), &out));
+  ASSERT_RAISES(NotImplemented, GroupBy(&this->ctx_, {keys}, {values},
+                                        GroupByOptions({GroupByOptions::SUM}), &out));
+
+  // COUNT works for any value type
+  ASSERT_OK(GroupBy(&this->ctx_, {keys}, {values},
+                    GroupByOptions({GroupByOptions::COUNT}), &out));
+}
+
+TEST_F(TestGroupBy, Aggregator) {
+  auto schm = schema({field("k", utf8()), field("v", int32())});
+  auto batch0 = RecordBatch::Make(schm, 3,
+                                  {ArrayFromJSON(utf8(), R"(["a", "b", "a"])"),
+                                   ArrayFromJSON(int32(), "[1, 2, 3]")});
+  auto batch1 = RecordBatch::Make(schm, 3,
+                                  {ArrayFromJSON(utf8(), R"(["c", "a", null])"),
+                                   ArrayFromJSON(int32(), "[4, 5, 6]")});
+  GroupByOptions options({GroupByOptions::SUM});
+
+  std::unique_ptr<GroupByAggregator> aggregator;
+  ASSERT_OK(GroupByAggregator::Make(&this->ctx_, schm, 1, options, &aggregator));
+  std::unique_ptr<GroupByAggregator::State> state0, state1;
+  ASSERT_OK(aggregator->MakeState(&state0));
+  ASSERT_OK(aggregator->MakeState(&state1));
+  ASSERT_OK(aggregator->Consume(*batch0, state0.get()));
+  ASSERT_OK(aggregator->Consume(*batch1, state1.get()));
+  ASSERT_OK(aggregator->Merge(state1.get(), state0.get()));
+
+  std::shared_ptr<Array> actual, expected;
+  ASSERT_OK(aggregator->Finalize(state0.get(), &actual));
+  auto all_keys = ArrayFromJSON(utf8(), R"(["a", "b", "a", "c", "a", null])");
+  auto all_values = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6]");
+  ASSERT_OK(GroupBy(&this->ctx_, {all_keys}, {all_values}, options, &expected));
+  AssertArraysEqual(*expected, *actual);
+
+  ASSERT_RAISES(Invalid, GroupByAggregator::Make(&this->ctx_, schm, 0, options,
+                                                 &aggregator));
+  ASSERT_RAISES(Invalid, GroupByAggregator::Make(&this->ctx_, schm, 2, options,
+                                                 &aggregator));
+  auto string_values = schema({field("k", int32()), field("v", utf8())});
+  ASSERT_RAISES(NotImplemented, GroupByAggregator::Make(&this->ctx_, string_values, 1,
+                                                        options, &aggregator));
+}
+
+class TestDistinct : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertDistinct(const Table& table, const std::vector<int>& keys,
+                      DistinctOptions::Keep keep, const std::string& expected_json) {
+    DistinctOptions options(keep);
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(DistinctIndices(&this->ctx_, table, keys, options, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayFromJSON(int64(), expected_json), *actual);
+  }
+};
+
+TEST_F(TestDistinct, MultipleKeys) {
+  auto schm = schema({field("k0", int64()), field("v", float64()), field("k1", utf8())});
+  auto k0 = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int64(), "[1, 1, 2, null]"),
+                  ArrayFromJSON(int64(), "[2, 1, null, 1]")});
+  auto v = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(float64(), "[0, 1, 2, 3, 4, 5, 6, 7]")});
+  auto k1 = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(utf8(), R"(["a", "b", "a", null, "a", "a", null, "b"])")});
+  auto table = Table::Make(schm, {k0, v, k1});
+
+  AssertDistinct(*table, {0, 2}, DistinctOptions::FIRST, "[0, 1, 2, 3]");
+  AssertDistinct(*table, {0, 2}, DistinctOptions::LAST, "[4, 5, 6, 7]");
+  AssertDistinct(*table, {2}, DistinctOptions::FIRST, "[0, 1, 3]");
+  AssertDistinct(*table, {2}, DistinctOptions::LAST, "[5, 6, 7]");
+  AssertDistinct(*table, {1}, DistinctOptions::LAST, "[0, 1, 2, 3, 4, 5, 6, 7]");
+
+  auto empty = Table::Make(
+      schm, {std::make_shared<ChunkedArray>(ArrayVector{}, int64()),
+             std::make_shared<ChunkedArray>(ArrayVector{}, float64()),
+             std::make_shared<ChunkedArray>(ArrayVector{}, utf8())});
+  AssertDistinct(*empty, {0, 2}, DistinctOptions::FIRST, "[]");
+}
+
+TEST_F(TestDistinct, ParallelMatchesSerial) {
+  // Large enough to be split into several partitions deduplicated in parallel
+  const int64_t length = 1 << 19;
+  Int32Builder key0_builder;
+  StringBuilder key1_builder;
+  ASSERT_OK(key0_builder.Reserve(length));
+  for (int64_t i = 0; i < length; ++i) {
+    if (i % 13 == 0) {
+      key0_builder.UnsafeAppendNull();
+    } else {
+      key0_builder.UnsafeAppend(static_cast<int32_t>((i * 7919) % 1013));
+    }
+    ASSERT_OK(key1_builder.Append(std::to_string(i % 7)));
+  }
+  std::shared_ptr<Array> key0, key1;
+  ASSERT_OK(key0_builder.Finish(&key0));
+  ASSERT_OK(key1_builder.Finish(&key1));
+  // Several chunks, not aligned with the partitions
+  auto chunked = [&](const std::shared_ptr<Array>& array) {
+    return std::make_shared<ChunkedArray>(
+        ArrayVector{array->Slice(0, 1000), array->Slice(1000, 200000),
+                    array->Slice(201000)});
+  };
+  auto table = Table::Make(schema({field("k0", int32()), field("k1", utf8())}),
+                           {chunked(key0), chunked(key1)});
+
+  for (auto keep : {DistinctOptions::FIRST, DistinctOptions::LAST}) {
+    DistinctOptions options(keep);
+    options.use_threads = false;
+    std::shared_ptr<Array> serial, parallel;
+    ASSERT_OK(DistinctIndices(&this->ctx_, *table, {0, 1}, options, &serial));
+    options.use_threads = true;
+    ASSERT_OK(DistinctIndices(&this->ctx_, *table, {0, 1}, options, &parallel));
+    ASSERT_EQ(1014 * 7, serial->length());
+    AssertArraysEqual(*serial, *parallel);
+  }
+}
+
+TEST_F(TestDistinct, Indexer) {
+  auto schm = schema({field("k", utf8()), field("v", int32())});
+  auto batch0 = RecordBatch::Make(schm, 3,
+                                  {ArrayFromJSON(utf8(), R"(["a", "b", "a"])"),
+                                   ArrayFromJSON(int32(), "[1, 2, 3]")});
+  auto batch1 = RecordBatch::Make(schm, 4,
+                                  {ArrayFromJSON(utf8(), R"(["c", "a", null, null])"),
+                                   ArrayFromJSON(int32(), "[4, 5, 6, 7]")});
+  auto table = Table::Make(schm, {std::make_shared<ChunkedArray>(ArrayVector{
+                                      batch0->column(0), batch1->column(0)}),
+                                  std::make_shared<ChunkedArray>(ArrayVector{
+                                      batch0->column(1), batch1->column(1)})});
+
+  for (auto keep : {DistinctOptions::FIRST, DistinctOptions::LAST}) {
+    std::unique_ptr<DistinctIndexer> indexer;
+    ASSERT_OK(DistinctIndexer::Make(&this->ctx_, schm, {0}, DistinctOptions(keep),
+                                    &indexer));
+    std::shared_ptr<Array> new_indices;
+    ASSERT_OK(indexer->Consume(*batch0, &new_indices));
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[0, 1]"), *new_indices);
+    ASSERT_OK(indexer->Consume(*batch1->Slice(0, 0)));
+    ASSERT_OK(indexer->Consume(*batch1, &new_indices));
+    AssertArraysEqual(*ArrayFromJSON(int64(), "[0, 2]"), *new_indices);
+    ASSERT_EQ(7, indexer->num_rows());
+    ASSERT_EQ(4, indexer->num_distinct());
+
+    std::shared_ptr<Array> actual, expected;
+    ASSERT_OK(indexer->GetIndices(&actual));
+    ASSERT_OK(DistinctIndices(&this->ctx_, *table, {0}, DistinctOptions(keep),
+                              &expected));
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
+TEST_F(TestDistinct, Errors) {
+  auto schm = schema({field("k", int32()), field("v", list(int32()))});
+  auto table = Table::Make(
+      schm, {std::make_shared<ChunkedArray>(ArrayVector{}, int32()),
+             std::make_shared<ChunkedArray>(ArrayVector{}, list(int32()))});
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid,
+                DistinctIndices(&this->ctx_, *table, {}, DistinctOptions(), &out));
+  ASSERT_RAISES(Invalid,
+                DistinctIndices(&this->ctx_, *table, {2}, DistinctOptions(), &out));
+  ASSERT_RAISES(NotImplemented,
+                DistinctIndices(&this->ctx_, *table, {1}, DistinctOptions(), &out));
+
+  std::unique_ptr<DistinctIndexer> indexer;
+  ASSERT_RAISES(Invalid, DistinctIndexer::Make(&this->ctx_, schm, {-1},
+                                               DistinctOptions(), &indexer));
+  ASSERT_RAISES(NotImplemented, DistinctIndexer::Make(&this->ctx_, schm, {0, 1},
+                                                      DistinctOptions(), &indexer));
+}
+
+}  // namespace compute
+}  // namespace arrow
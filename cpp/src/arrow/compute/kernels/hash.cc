@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -34,6 +36,7 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
@@ -41,7 +44,9 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -285,6 +290,9 @@ class RegularHashKernelImpl : public HashKernelImpl {
 
   Status Append(const ArrayData& arr) override {
     RETURN_NOT_OK(action_.Reserve(arr.length));
+    if (arr.GetNullCount() == 0) {
+      return AppendNonNull(arr);
+    }
     return ArrayDataVisitor<Type>::Visit(arr, this);
   }
 
@@ -297,6 +305,40 @@ class RegularHashKernelImpl : public HashKernelImpl {
                                                           0 /* start_offset */, out);
   }
 
+  // Arrays without nulls are looked up in batches, which overlaps the cache
+  // misses of the lookups (see ScalarMemoTable::GetOrInsertBatch)
+  template <typename T = Type>
+  auto AppendNonNull(const ArrayData& arr) -> enable_if_t<
+      !with_error_status && has_c_type<T>::value && !std::is_same<Scalar, bool>::value,
+      Status> {
+    memo_table_->GetOrInsertBatch(
+        arr.GetValues<Scalar>(1), arr.length,
+        [this](int32_t memo_index) { action_.ObserveFound(memo_index); },
+        [this](int32_t memo_index) { action_.ObserveNotFound(memo_index); });
+    return Status::OK();
+  }
+
+  template <typename T = Type>
+  auto AppendNonNull(const ArrayData& arr)
+      -> enable_if_t<!with_error_status && std::is_base_of<BinaryType, T>::value,
+                     Status> {
+    const uint8_t* data = arr.buffers[2] ? arr.buffers[2]->data() : nullptr;
+    memo_table_->GetOrInsertBatch(
+        data, arr.GetValues<int32_t>(1), arr.length,
+        [this](int32_t memo_index) { action_.ObserveFound(memo_index); },
+        [this](int32_t memo_index) { action_.ObserveNotFound(memo_index); });
+    return Status::OK();
+  }
+
+  template <typename T = Type>
+  auto AppendNonNull(const ArrayData& arr) -> enable_if_t<
+      with_error_status ||
+          !((has_c_type<T>::value && !std::is_same<Scalar, bool>::value) ||
+            std::is_base_of<BinaryType, T>::value),
+      Status> {
+    return ArrayDataVisitor<Type>::Visit(arr, this);
+  }
+
   template <typename Enable = Status>
   auto VisitNull() -> enable_if_t<!with_error_status, Enable> {
     auto on_found = [this](int32_t memo_index) { action_.ObserveNullFound(memo_index); };
@@ -451,6 +493,361 @@ struct HashKernelTraits<Type, Action, with_error_status, with_memo_visit_null,
                                                with_error_status, with_memo_visit_null>;
 };
 
+// ----------------------------------------------------------------------
+// Partitioned parallel hashing, used by Unique and DictionaryEncode when
+// FunctionContext::use_threads() is set
+//
+// The rows are split into ranges, and the non-null rows of each range are
+// scattered in parallel into partitions according to the top bits of their
+// hash.  As equal values always fall in the same partition, the partitions
+// get independent memo tables, which are built concurrently.  The values of
+// all partitions are then numbered in order of first occurrence, so that the
+// results are the same as those of the serial kernels, and the memo indices
+// of the rows are remapped to these global indices in parallel.
+
+using ArrayDataVector = std::vector<std::shared_ptr<ArrayData>>;
+
+constexpr int kPartitionBits = 6;
+constexpr int kNumPartitions = 1 << kPartitionBits;
+// The smallest input worth hashing in parallel, and the smallest range size
+constexpr int64_t kMinPartitionedHashLength = 1 << 16;
+
+template <typename Type, typename Enable = void>
+struct PartitionedValueReader {
+  using Scalar = typename Type::c_type;
+
+  explicit PartitionedValueReader(const ArrayData& data)
+      : values_(data.GetValues<Scalar>(1)) {}
+
+  Scalar operator[](int64_t i) const { return values_[i]; }
+
+  const Scalar* values_;
+};
+
+template <typename Type>
+struct PartitionedValueReader<Type, enable_if_binary<Type>> {
+  using Scalar = util::string_view;
+
+  explicit PartitionedValueReader(const ArrayData& data)
+      : offsets_(data.GetValues<int32_t>(1)),
+        data_(data.buffers[2] ? reinterpret_cast<const char*>(data.buffers[2]->data())
+                              : nullptr) {}
+
+  Scalar operator[](int64_t i) const {
+    return Scalar(data_ + offsets_[i], offsets_[i + 1] - offsets_[i]);
+  }
+
+  const int32_t* offsets_;
+  const char* data_;
+};
+
+template <typename T>
+void GetMemoValues(const internal::ScalarMemoTable<T>& memo_table, std::vector<T>* out) {
+  out->resize(memo_table.size());
+  memo_table.CopyValues(out->data());
+}
+
+void GetMemoValues(const internal::BinaryMemoTable& memo_table,
+                   std::vector<util::string_view>* out) {
+  out->reserve(memo_table.size());
+  memo_table.VisitValues(0, [out](util::string_view value) { out->push_back(value); });
+}
+
+template <typename Type>
+class PartitionedHashImpl {
+ public:
+  using Reader = PartitionedValueReader<Type>;
+  using Scalar = typename Reader::Scalar;
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+  using BuilderType = typename TypeTraits<Type>::BuilderType;
+
+  PartitionedHashImpl(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                      const ArrayDataVector& chunks)
+      : ctx_(ctx), type_(type), chunks_(chunks), partitions_(kNumPartitions) {}
+
+  // Build the memo tables and number their values.  With `with_nulls`, a null
+  // gets a memo index like the other values (as in Unique).  With `encode`,
+  // the memo index of each row is kept for GetIndices().
+  Status Hash(bool with_nulls, bool encode) {
+    MakeRanges();
+    const int num_ranges = static_cast<int>(ranges_.size());
+    RETURN_NOT_OK(internal::ParallelFor(
+        num_ranges, [&](int i) { return ScatterRange(&ranges_[i]); }));
+    RETURN_NOT_OK(internal::ParallelFor(
+        kNumPartitions, [&](int i) { return HashPartition(i, encode); }));
+    NumberValues(with_nulls);
+    return Status::OK();
+  }
+
+  // The distinct values, in order of first occurrence
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) {
+    std::vector<std::vector<Scalar>> values(kNumPartitions);
+    for (int i = 0; i < kNumPartitions; ++i) {
+      GetMemoValues(*partitions_[i].memo_table, &values[i]);
+    }
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(ctx_->memory_pool(), type_, &builder));
+    auto typed_builder = checked_cast<BuilderType*>(builder.get());
+    RETURN_NOT_OK(builder->Reserve(static_cast<int64_t>(order_.size())));
+    for (const auto& entry : order_) {
+      if (entry.first < 0) {
+        RETURN_NOT_OK(builder->AppendNull());
+      } else {
+        RETURN_NOT_OK(typed_builder->Append(values[entry.first][entry.second]));
+      }
+    }
+    return builder->FinishInternal(out);
+  }
+
+  // The int32 dictionary indices of the rows, one array per input chunk
+  Status GetIndices(ArrayDataVector* out) {
+    ArrayDataVector indices;
+    for (const auto& chunk : chunks_) {
+      std::shared_ptr<Buffer> values, null_bitmap;
+      RETURN_NOT_OK(AllocateBuffer(ctx_->memory_pool(), chunk->length * sizeof(int32_t),
+                                   &values));
+      memset(values->mutable_data(), 0, values->size());
+      const int64_t null_count = chunk->GetNullCount();
+      if (null_count != 0) {
+        RETURN_NOT_OK(internal::CopyBitmap(ctx_->memory_pool(), chunk->buffers[0]->data(),
+                                           chunk->offset, chunk->length, &null_bitmap));
+      }
+      indices.push_back(
+          ArrayData::Make(int32(), chunk->length, {null_bitmap, values}, null_count));
+    }
+    RETURN_NOT_OK(
+        internal::ParallelFor(static_cast<int>(ranges_.size()), [&](int i) -> Status {
+          const Range& range = ranges_[i];
+          auto out_indices =
+              indices[range.chunk]->template GetMutableValues<int32_t>(1) + range.offset;
+          for (int p = 0; p < kNumPartitions; ++p) {
+            const auto& rows = range.rows[p];
+            const auto& memo_indices = range.memo_indices[p];
+            const auto& global_indices = partitions_[p].global_indices;
+            for (size_t k = 0; k < rows.size(); ++k) {
+              out_indices[rows[k]] = global_indices[memo_indices[k]];
+            }
+          }
+          return Status::OK();
+        }));
+    *out = std::move(indices);
+    return Status::OK();
+  }
+
+ private:
+  struct Range {
+    size_t chunk;
+    int64_t offset;
+    int64_t length;
+    // The position of the first row of the range among all input rows
+    int64_t first_row;
+    // The offset of the first null in the range, or -1
+    int64_t first_null;
+    // For each partition, the offsets of its rows in the range...
+    std::vector<std::vector<uint32_t>> rows;
+    // ...and, when encoding, their memo indices in the partition
+    std::vector<std::vector<int32_t>> memo_indices;
+  };
+
+  struct Partition {
+    std::unique_ptr<MemoTable> memo_table;
+    // The position of the first occurrence of each value among all input rows
+    std::vector<int64_t> first_rows;
+    // The global memo index of each value
+    std::vector<int32_t> global_indices;
+  };
+
+  void MakeRanges() {
+    int64_t length = 0;
+    for (const auto& chunk : chunks_) {
+      length += chunk->length;
+    }
+    const int64_t capacity = internal::GetCpuThreadPool()->GetCapacity();
+    const int64_t range_size = std::min<int64_t>(
+        std::max(kMinPartitionedHashLength, length / (4 * capacity) + 1), 1 << 30);
+    int64_t first_row = 0;
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      for (int64_t offset = 0; offset < chunks_[i]->length; offset += range_size) {
+        Range range;
+        range.chunk = i;
+        range.offset = offset;
+        range.length = std::min(range_size, chunks_[i]->length - offset);
+        range.first_row = first_row + offset;
+        ranges_.push_back(std::move(range));
+      }
+      first_row += chunks_[i]->length;
+    }
+  }
+
+  Status ScatterRange(Range* range) {
+    const ArrayData& data = *chunks_[range->chunk];
+    const Reader reader(data);
+    const uint8_t* null_bitmap =
+        data.GetNullCount() != 0 ? data.buffers[0]->data() : nullptr;
+    range->first_null = -1;
+    range->rows.resize(kNumPartitions);
+    range->memo_indices.resize(kNumPartitions);
+    for (int64_t i = 0; i < range->length; ++i) {
+      const int64_t j = range->offset + i;
+      if (null_bitmap != nullptr && !BitUtil::GetBit(null_bitmap, data.offset + j)) {
+        if (range->first_null < 0) {
+          range->first_null = i;
+        }
+        continue;
+      }
+      const auto h = internal::ScalarHelper<Scalar, 0>::ComputeHash(reader[j]);
+      range->rows[h >> (64 - kPartitionBits)].push_back(static_cast<uint32_t>(i));
+    }
+    return Status::OK();
+  }
+
+  Status HashPartition(int p, bool encode) {
+    Partition& partition = partitions_[p];
+    partition.memo_table.reset(new MemoTable(ctx_->memory_pool(), 0));
+    for (auto& range : ranges_) {
+      const Reader reader(*chunks_[range.chunk]);
+      const auto& rows = range.rows[p];
+      auto& memo_indices = range.memo_indices[p];
+      if (encode) {
+        memo_indices.resize(rows.size());
+      }
+      for (size_t k = 0; k < rows.size(); ++k) {
+        const int32_t memo_index =
+            partition.memo_table->GetOrInsert(reader[range.offset + rows[k]]);
+        if (memo_index == static_cast<int32_t>(partition.first_rows.size())) {
+          partition.first_rows.push_back(range.first_row + rows[k]);
+        }
+        if (encode) {
+          memo_indices[k] = memo_index;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  // Number the values of all partitions in order of first occurrence, by
+  // merging the partitions' first occurrences (which are already sorted)
+  void NumberValues(bool with_nulls) {
+    int64_t null_row = -1;
+    if (with_nulls) {
+      for (const auto& range : ranges_) {
+        if (range.first_null >= 0) {
+          null_row = range.first_row + range.first_null;
+          break;
+        }
+      }
+    }
+
+    using Head = std::pair<int64_t, int>;
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+    std::vector<size_t> next(kNumPartitions, 0);
+    for (int p = 0; p < kNumPartitions; ++p) {
+      auto& partition = partitions_[p];
+      partition.global_indices.resize(partition.first_rows.size());
+      if (!partition.first_rows.empty()) {
+        heads.emplace(partition.first_rows[0], p);
+      }
+    }
+    while (!heads.empty()) {
+      const Head head = heads.top();
+      heads.pop();
+      if (null_row >= 0 && null_row < head.first) {
+        order_.emplace_back(-1, 0);
+        null_row = -1;
+      }
+      auto& partition = partitions_[head.second];
+      const size_t memo_index = next[head.second]++;
+      partition.global_indices[memo_index] = static_cast<int32_t>(order_.size());
+      order_.emplace_back(head.second, memo_index);
+      if (memo_index + 1 < partition.first_rows.size()) {
+        heads.emplace(partition.first_rows[memo_index + 1], head.second);
+      }
+    }
+    if (null_row >= 0) {
+      order_.emplace_back(-1, 0);
+    }
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<DataType> type_;
+  ArrayDataVector chunks_;
+  std::vector<Range> ranges_;
+  std::vector<Partition> partitions_;
+  // The (partition, memo index) of each global memo index, partition being
+  // -1 for the null
+  std::vector<std::pair<int, size_t>> order_;
+};
+
+#define PROCESS_PARTITIONED_HASH_TYPES(PROCESS) \
+  PROCESS(UInt16Type)                           \
+  PROCESS(Int16Type)                            \
+  PROCESS(UInt32Type)                           \
+  PROCESS(Int32Type)                            \
+  PROCESS(UInt64Type)                           \
+  PROCESS(Int64Type)                            \
+  PROCESS(FloatType)                            \
+  PROCESS(DoubleType)                           \
+  PROCESS(Date32Type)                           \
+  PROCESS(Date64Type)                           \
+  PROCESS(Time32Type)                           \
+  PROCESS(Time64Type)                           \
+  PROCESS(TimestampType)                        \
+  PROCESS(BinaryType)                           \
+  PROCESS(StringType)
+
+// Get the input chunks if the partitioned implementation should be used
+bool GetPartitionedHashChunks(FunctionContext* ctx, const Datum& value,
+                              ArrayDataVector* out) {
+  // Partitioning costs an extra pass over the rows, which only pays off
+  // when partitions are hashed concurrently
+  if (!ctx->use_threads() || internal::GetCpuThreadPool()->GetCapacity() < 2) {
+    return false;
+  }
+  switch (value.type()->id()) {
+#define PROCESS(InType)     \
+  case InType::type_id:     \
+    break;
+
+    PROCESS_PARTITIONED_HASH_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      return false;
+  }
+  int64_t length = 0;
+  if (value.kind() == Datum::ARRAY) {
+    out->push_back(value.array());
+    length = value.length();
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    for (const auto& chunk : value.chunked_array()->chunks()) {
+      out->push_back(chunk->data());
+      length += chunk->length();
+    }
+  }
+  return length >= kMinPartitionedHashLength;
+}
+
+// Hash the chunks with the partitioned implementation, returning the
+// dictionary and, if `indices` is non-null, the indices of each chunk
+Status PartitionedHash(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                       const ArrayDataVector& chunks, bool with_nulls,
+                       std::shared_ptr<ArrayData>* dictionary, ArrayDataVector* indices) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                  \
+  case InType::type_id: {                                                \
+    PartitionedHashImpl<InType> impl(ctx, type, chunks);                 \
+    RETURN_NOT_OK(impl.Hash(with_nulls, indices != nullptr));            \
+    RETURN_NOT_OK(impl.GetDictionary(dictionary));                       \
+    return indices != nullptr ? impl.GetIndices(indices) : Status::OK(); \
+  }
+
+    PROCESS_PARTITIONED_HASH_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("partitioned hashing of ", type->ToString());
+}
+
 }  // namespace
 
 #define PROCESS_SUPPORTED_HASH_TYPES(PROCESS) \
@@ -564,9 +961,67 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+// Split a dictionary-encoded input into its indices and its dictionary, so
+// that hash kernels only process the integer indices
+Status GetDictionaryIndices(FunctionContext* ctx, const Datum& value, Datum* indices,
+                            std::shared_ptr<Array>* dictionary) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*value.type());
+  std::vector<std::shared_ptr<Array>> chunks, index_chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.make_array());
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = value.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("Expected array-like input");
+  }
+
+  *dictionary = nullptr;
+  for (const auto& chunk : chunks) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+    if (*dictionary == nullptr) {
+      *dictionary = dict_array.dictionary();
+    } else if (dict_array.dictionary() != *dictionary &&
+               !dict_array.dictionary()->Equals(**dictionary)) {
+      return Status::NotImplemented(
+          "Hashing dictionary-encoded chunks with different dictionaries");
+    }
+    index_chunks.push_back(dict_array.indices());
+  }
+  if (*dictionary == nullptr) {
+    std::unique_ptr<ArrayBuilder> builder;
+    RETURN_NOT_OK(MakeBuilder(ctx->memory_pool(), dict_type.value_type(), &builder));
+    RETURN_NOT_OK(builder->Finish(dictionary));
+  }
+
+  if (value.kind() == Datum::ARRAY) {
+    *indices = index_chunks[0];
+  } else {
+    *indices = std::make_shared<ChunkedArray>(index_chunks, dict_type.index_type());
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  if (value.type()->id() == Type::DICTIONARY) {
+    Datum indices;
+    std::shared_ptr<Array> dictionary, unique_indices;
+    RETURN_NOT_OK(GetDictionaryIndices(ctx, value, &indices, &dictionary));
+    RETURN_NOT_OK(Unique(ctx, indices, &unique_indices));
+    *out = std::make_shared<DictionaryArray>(value.type(), unique_indices, dictionary);
+    return Status::OK();
+  }
+
+  ArrayDataVector chunks;
+  if (GetPartitionedHashChunks(ctx, value, &chunks)) {
+    std::shared_ptr<ArrayData> uniques;
+    RETURN_NOT_OK(PartitionedHash(ctx, value.type(), chunks, true /* with_nulls */,
+                                  &uniques, nullptr));
+    *out = MakeArray(uniques);
+    return Status::OK();
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
@@ -575,12 +1030,21 @@ Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>*
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
-
   std::shared_ptr<Array> dictionary;
   std::vector<Datum> indices_outputs;
-  RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dictionary));
+  ArrayDataVector chunks;
+  if (GetPartitionedHashChunks(ctx, value, &chunks)) {
+    std::shared_ptr<ArrayData> dict_data;
+    ArrayDataVector indices;
+    RETURN_NOT_OK(PartitionedHash(ctx, value.type(), chunks, false /* with_nulls */,
+                                  &dict_data, &indices));
+    dictionary = MakeArray(dict_data);
+    indices_outputs.assign(indices.begin(), indices.end());
+  } else {
+    std::unique_ptr<HashKernel> func;
+    RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
+    RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dictionary));
+  }
 
   // Create the dictionary type
   DCHECK_EQ(indices_outputs[0].kind(), Datum::ARRAY);
@@ -604,6 +1068,24 @@ const int32_t kValuesFieldIndex = 0;
 const int32_t kCountsFieldIndex = 1;
 Status ValueCounts(FunctionContext* ctx, const Datum& value,
                    std::shared_ptr<Array>* counts) {
+  if (value.type()->id() == Type::DICTIONARY) {
+    Datum indices;
+    std::shared_ptr<Array> dictionary, index_counts;
+    RETURN_NOT_OK(GetDictionaryIndices(ctx, value, &indices, &dictionary));
+    RETURN_NOT_OK(ValueCounts(ctx, indices, &index_counts));
+
+    const auto& index_struct = checked_cast<const StructArray&>(*index_counts);
+    auto values = std::make_shared<DictionaryArray>(
+        value.type(), index_struct.field(kValuesFieldIndex), dictionary);
+    auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
+        std::make_shared<Field>(kValuesFieldName, value.type()),
+        std::make_shared<Field>(kCountsFieldName, int64())});
+    std::vector<std::shared_ptr<Array>> fields = {values,
+                                                  index_struct.field(kCountsFieldIndex)};
+    *counts = std::make_shared<StructArray>(data_type, index_struct.length(), fields);
+    return Status::OK();
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetValueCountsKernel(ctx, value.type(), &func));
 
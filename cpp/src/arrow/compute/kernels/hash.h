@@ -38,6 +38,13 @@ class FunctionContext;
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
 ///
+/// The unique values of a dictionary-encoded input are computed from its
+/// indices only, and returned as a DictionaryArray sharing its dictionary.
+///
+/// If the context allows threads, large integer, floating-point, temporal and
+/// binary inputs are hashed in parallel, partitioned by hash value.  The
+/// result is the same, uniques being in order of first occurrence either way.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -60,6 +67,9 @@ ARROW_EXPORT extern const int32_t kCountsFieldIndex;
 /// For floating point arrays there is no attempt to normalize -0.0, 0.0 and NaN values
 /// which can lead to unexpected results if the input Array has these values.
 ///
+/// The values of a dictionary-encoded input are counted from its indices
+/// only, and the "Values" field is a DictionaryArray sharing its dictionary.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value array-like input
 /// \param[out] counts An array of  <input type "Values", int64_t "Counts"> structs.
@@ -71,6 +81,10 @@ Status ValueCounts(FunctionContext* context, const Datum& value,
                    std::shared_ptr<Array>* counts);
 
 /// \brief Dictionary-encode values in an array-like object
+///
+/// As with Unique, large inputs are hashed in parallel if the context allows
+/// threads, giving the same dictionary and indices.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] data array-like input
 /// \param[out] out result with same shape and type as input
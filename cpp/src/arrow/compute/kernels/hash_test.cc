@@ -21,6 +21,7 @@
 #include <functional>
 #include <locale>
 #include <memory>
+#include <random>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -38,6 +39,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -478,5 +480,96 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   AssertChunkedEqual(*dict_carr, *encoded_out.chunked_array());
 }
 
+TEST_F(TestHashKernel, PartitionedUniqueAndDictEncode) {
+  // Inputs large enough to be hashed in parallel, whose results must match
+  // those of the serial kernels
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(0, 5000);
+  std::bernoulli_distribution valid_dist(0.99);
+  ArrayVector int_chunks, string_chunks;
+  for (int64_t length : {70000, 1, 50000}) {
+    std::vector<int64_t> ints(length);
+    std::vector<std::string> strings(length);
+    std::vector<bool> is_valid(length);
+    for (int64_t i = 0; i < length; ++i) {
+      ints[i] = value_dist(gen);
+      strings[i] = "s" + std::to_string(value_dist(gen));
+      is_valid[i] = valid_dist(gen);
+    }
+    int_chunks.push_back(_MakeArray<Int64Type, int64_t>(int64(), ints, is_valid));
+    string_chunks.push_back(
+        _MakeArray<StringType, std::string>(utf8(), strings, is_valid)->Slice(1));
+  }
+
+  // Partitioned hashing is only used with several threads
+  auto pool = internal::GetCpuThreadPool();
+  const int capacity = pool->GetCapacity();
+  ASSERT_OK(pool->SetCapacity(std::max(capacity, 4)));
+
+  for (const auto& chunks : {int_chunks, string_chunks}) {
+    std::vector<Datum> inputs = {Datum(chunks[0]),
+                                 Datum(std::make_shared<ChunkedArray>(chunks))};
+    for (const auto& input : inputs) {
+      std::shared_ptr<Array> expected_uniques, uniques;
+      Datum expected_encoded, encoded;
+      this->ctx_.set_use_threads(false);
+      ASSERT_OK(Unique(&this->ctx_, input, &expected_uniques));
+      ASSERT_OK(DictionaryEncode(&this->ctx_, input, &expected_encoded));
+      this->ctx_.set_use_threads(true);
+      ASSERT_OK(Unique(&this->ctx_, input, &uniques));
+      ASSERT_OK(DictionaryEncode(&this->ctx_, input, &encoded));
+
+      ASSERT_OK(uniques->Validate());
+      ASSERT_ARRAYS_EQUAL(*expected_uniques, *uniques);
+      ASSERT_EQ(expected_encoded.kind(), encoded.kind());
+      if (encoded.kind() == Datum::ARRAY) {
+        ASSERT_ARRAYS_EQUAL(*expected_encoded.make_array(), *encoded.make_array());
+      } else {
+        AssertChunkedEqual(*expected_encoded.chunked_array(), *encoded.chunked_array());
+      }
+    }
+  }
+  ASSERT_OK(pool->SetCapacity(capacity));
+}
+
+TEST_F(TestHashKernel, DictionaryUniqueAndValueCounts) {
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+  auto dict_type = dictionary(int32(), utf8());
+  auto MakeDictArray = [&](const std::string& indices) {
+    return std::make_shared<DictionaryArray>(dict_type, ArrayFromJSON(int32(), indices),
+                                             dict);
+  };
+
+  // The hash kernels run on the indices, and return the same dictionary
+  auto array = MakeDictArray("[2, 0, null, 2, 0, 0]");
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&this->ctx_, array, &result));
+  AssertArraysEqual(*MakeDictArray("[2, 0, null]"), *result);
+
+  ASSERT_OK(ValueCounts(&this->ctx_, array, &result));
+  auto counts_struct = internal::checked_pointer_cast<StructArray>(result);
+  ASSERT_TRUE(counts_struct->type()->child(kValuesFieldIndex)->type()->Equals(dict_type));
+  AssertArraysEqual(*MakeDictArray("[2, 0, null]"),
+                    *counts_struct->field(kValuesFieldIndex));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[2, 3, 1]"),
+                    *counts_struct->field(kCountsFieldIndex));
+
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{MakeDictArray("[1, 1]"), MakeDictArray("[0, 1, 2]")});
+  ASSERT_OK(Unique(&this->ctx_, chunked, &result));
+  AssertArraysEqual(*MakeDictArray("[1, 0, 2]"), *result);
+
+  ASSERT_OK(Unique(&this->ctx_, std::make_shared<ChunkedArray>(ArrayVector{}, dict_type),
+                   &result));
+  ASSERT_EQ(0, result->length());
+  ASSERT_TRUE(result->type()->Equals(dict_type));
+
+  auto other_dict = ArrayFromJSON(utf8(), R"(["bar"])");
+  chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      MakeDictArray("[1]"), std::make_shared<DictionaryArray>(
+                                dict_type, ArrayFromJSON(int32(), "[0]"), other_dict)});
+  ASSERT_RAISES(NotImplemented, Unique(&this->ctx_, chunked, &result));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -32,6 +33,7 @@
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type.h"
@@ -72,29 +74,232 @@ class IsInKernelImpl : public UnaryKernel {
 // Using a visitor create a memo_table_ for the right array
 // TODO: Implement for small lists
 
+// Value sets of at least this many distinct values also get a Bloom filter,
+// as their memo table no longer fits in the CPU caches
+constexpr int32_t kMinBloomFilterValues = 1 << 15;
+
+// The number of values of left looked up at once
+constexpr int64_t kLookupBatchSize = 256;
+
 template <typename T, typename Scalar>
-struct MemoTableRight {
-  Status VisitNull() { return Status::OK(); }
+class ValueSet {
+ public:
+  // \brief with_positions tells whether to record the position of the first
+  // occurrence of each value, as needed by IndexIn
+  ValueSet(MemoryPool* pool, bool with_positions)
+      : pool_(pool), with_positions_(with_positions) {}
+
+  Status VisitNull() {
+    if (null_position_ == internal::kKeyNotFound) {
+      null_position_ = static_cast<int32_t>(position_);
+    }
+    ++position_;
+    return Status::OK();
+  }
 
   Status VisitValue(const Scalar& value) {
-    memo_table_->GetOrInsert(value);
+    memo_table_->GetOrInsert(value, [](int32_t i) {},
+                             [this](int32_t i) {
+                               if (with_positions_) {
+                                 positions_.push_back(static_cast<int32_t>(position_));
+                               }
+                             });
+    ++position_;
     return Status::OK();
   }
 
-  Status Reset(MemoryPool* pool) {
-    memo_table_.reset(new MemoTable(pool, 0));
+  Status Construct(const Datum& right) {
+    memo_table_.reset(new MemoTable(pool_, 0));
+    if (right.kind() == Datum::ARRAY) {
+      RETURN_NOT_OK(Append(*right.array()));
+    } else if (right.kind() == Datum::CHUNKED_ARRAY) {
+      const ChunkedArray& right_array = *right.chunked_array();
+      for (int i = 0; i < right_array.num_chunks(); i++) {
+        RETURN_NOT_OK(Append(*right_array.chunk(i)->data()));
+      }
+    } else {
+      return Status::Invalid("Input Datum was not array-like");
+    }
+    if (memo_table_->size() >= kMinBloomFilterValues) {
+      RETURN_NOT_OK(BuildFilter(*memo_table_));
+    }
     return Status::OK();
   }
 
-  Status Append(FunctionContext* ctx, const Datum& right) {
-    const ArrayData& right_data = *right.array();
-    right_null_count += right_data.GetNullCount();
-    return ArrayDataVisitor<T>::Visit(right_data, this);
+  // \brief Look the values of data up in order, calling on_null() for its null
+  // slots and on_value(memo_index) for the others, memo_index being
+  // kKeyNotFound for the values not in the set
+  template <typename OnNull, typename OnValue>
+  Status Lookup(const ArrayData& data, OnNull&& on_null, OnValue&& on_value) const {
+    if (filter_ == NULLPTR) {
+      // Small value sets stay in cache, where batching costs more than it saves
+      DirectLookup<OnNull, OnValue> lookup(*this, on_null, on_value);
+      return ArrayDataVisitor<T>::Visit(data, &lookup);
+    }
+    return LookupBatches(data, on_null, on_value, HasContiguousValues());
   }
 
+  int64_t null_count() const { return null_count_; }
+
+  // \brief The position of the first null in the value set, or kKeyNotFound
+  int32_t null_position() const { return null_position_; }
+
+  // \brief The position of the first occurrence of a value in the value set
+  int32_t position(int32_t memo_index) const { return positions_[memo_index]; }
+
+ private:
   using MemoTable = typename HashTraits<T>::MemoTableType;
+  using HasContiguousValues =
+      std::integral_constant<bool, has_c_type<T>::value &&
+                                       !std::is_same<T, BooleanType>::value>;
+
+  // \brief The filter only pays for itself when most values are not found, so
+  // it is skipped for the batch after one in which they mostly were
+  static bool UseFilter(int64_t num_found, int64_t num_values) {
+    return num_found * 2 < num_values;
+  }
+
+  // \brief Look up the values stored contiguously in place, nulls included
+  template <typename OnNull, typename OnValue>
+  Status LookupBatches(const ArrayData& data, OnNull& on_null, OnValue& on_value,
+                       std::true_type) const {
+    const Scalar* values = data.GetValues<Scalar>(1);
+    const uint8_t* validity =
+        data.GetNullCount() != 0 ? data.buffers[0]->data() : NULLPTR;
+    int32_t memo_indices[kLookupBatchSize];
+    bool use_filter = true;
+    for (int64_t offset = 0; offset < data.length; offset += kLookupBatchSize) {
+      const int64_t batch_length = std::min(kLookupBatchSize, data.length - offset);
+      memo_table_->GetBatch(values + offset, batch_length,
+                            use_filter ? filter_.get() : NULLPTR, memo_indices);
+      int64_t num_found = 0;
+      for (int64_t i = 0; i < batch_length; ++i) {
+        if (validity != NULLPTR &&
+            !BitUtil::GetBit(validity, data.offset + offset + i)) {
+          on_null();
+        } else {
+          num_found += memo_indices[i] != internal::kKeyNotFound;
+          on_value(memo_indices[i]);
+        }
+      }
+      use_filter = UseFilter(num_found, batch_length);
+    }
+    return Status::OK();
+  }
+
+  template <typename OnNull, typename OnValue>
+  Status LookupBatches(const ArrayData& data, OnNull& on_null, OnValue& on_value,
+                       std::false_type) const {
+    BatchLookup<OnNull, OnValue> lookup(*this, on_null, on_value);
+    RETURN_NOT_OK(ArrayDataVisitor<T>::Visit(data, &lookup));
+    lookup.Flush();
+    return Status::OK();
+  }
+
+  template <typename OnNull, typename OnValue>
+  struct DirectLookup {
+    DirectLookup(const ValueSet& value_set, OnNull& on_null, OnValue& on_value)
+        : value_set(value_set), on_null(on_null), on_value(on_value) {}
+
+    Status VisitNull() {
+      on_null();
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      on_value(value_set.memo_table_->Get(value));
+      return Status::OK();
+    }
+
+    const ValueSet& value_set;
+    OnNull& on_null;
+    OnValue& on_value;
+  };
+
+  // \brief Buffer the values visited, so that their hashes are computed, the
+  // Bloom filter tested and the memo table probed a batch at a time, as for
+  // contiguous values
+  template <typename OnNull, typename OnValue>
+  struct BatchLookup {
+    BatchLookup(const ValueSet& value_set, OnNull& on_null, OnValue& on_value)
+        : value_set(value_set), on_null(on_null), on_value(on_value) {}
+
+    Status VisitNull() {
+      is_null[num_slots++] = true;
+      if (num_slots == kLookupBatchSize) {
+        Flush();
+      }
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      values[num_values++] = value;
+      is_null[num_slots++] = false;
+      if (num_slots == kLookupBatchSize) {
+        Flush();
+      }
+      return Status::OK();
+    }
+
+    void Flush() {
+      value_set.memo_table_->GetBatch(values, num_values,
+                                      use_filter ? value_set.filter_.get() : NULLPTR,
+                                      memo_indices);
+      int64_t j = 0, num_found = 0;
+      for (int64_t i = 0; i < num_slots; ++i) {
+        if (is_null[i]) {
+          on_null();
+        } else {
+          num_found += memo_indices[j] != internal::kKeyNotFound;
+          on_value(memo_indices[j++]);
+        }
+      }
+      use_filter = UseFilter(num_found, num_values);
+      num_slots = num_values = 0;
+    }
+
+    const ValueSet& value_set;
+    OnNull& on_null;
+    OnValue& on_value;
+    Scalar values[kLookupBatchSize];
+    int32_t memo_indices[kLookupBatchSize];
+    bool is_null[kLookupBatchSize];
+    int64_t num_slots = 0;
+    int64_t num_values = 0;
+    bool use_filter = true;
+  };
+
+  Status Append(const ArrayData& right_data) {
+    null_count_ += right_data.GetNullCount();
+    if (with_positions_ &&
+        position_ + right_data.length > std::numeric_limits<int32_t>::max()) {
+      return Status::Invalid("IndexIn value set has more than 2^31 - 1 values");
+    }
+    return ArrayDataVisitor<T>::Visit(right_data, this);
+  }
+
+  // Direct-addressed tables are small enough without a filter
+  template <typename U, template <class> class HashTableType>
+  Status BuildFilter(const internal::SmallScalarMemoTable<U, HashTableType>&) {
+    return Status::OK();
+  }
+
+  template <typename Table>
+  Status BuildFilter(const Table& memo_table) {
+    filter_.reset(new internal::BlockedBloomFilter(pool_));
+    RETURN_NOT_OK(filter_->Init(memo_table.size()));
+    memo_table.VisitHashes([this](internal::hash_t h) { filter_->Insert(h); });
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  bool with_positions_;
   std::unique_ptr<MemoTable> memo_table_;
-  int64_t right_null_count{};
+  std::unique_ptr<internal::BlockedBloomFilter> filter_;
+  std::vector<int32_t> positions_;
+  int32_t null_position_ = internal::kKeyNotFound;
+  int64_t null_count_ = 0;
+  int64_t position_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -103,80 +308,103 @@ template <typename Type, typename Scalar>
 class IsInKernel : public IsInKernelImpl {
  public:
   IsInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
-      : type_(type), pool_(pool) {}
-
-  // \brief if left array has a null return true
-  Status VisitNull() {
-    writer->Set();
-    writer->Next();
-    return Status::OK();
-  }
-
-  // \brief Iterate over the left array using another visitor.
-  // In VisitValue, use the memo_table_ (for right array) and check if value
-  // in left array is in the memo_table_. Return true if condition satisfied,
-  // else false.
-  Status VisitValue(const Scalar& value) {
-    if (memo_table_->Get(value) != -1) {
-      writer->Set();
-    } else {
-      writer->Clear();
-    }
-    writer->Next();
-    return Status::OK();
-  }
+      : value_set_(pool, /*with_positions=*/false) {}
 
+  // \brief Write true for the values of left in the value set, and for its
+  // nulls if the value set has nulls.  Otherwise nulls of left are propagated.
   Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
     const ArrayData& left_data = *left.array();
 
-    output = out->array();
+    std::shared_ptr<ArrayData> output = out->array();
     output->type = boolean();
 
-    writer = std::make_shared<internal::FirstTimeBitmapWriter>(
-        output.get()->buffers[1]->mutable_data(), output.get()->offset, left_data.length);
-
-    RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(left_data, this));
-    writer->Finish();
+    internal::FirstTimeBitmapWriter writer(output->buffers[1]->mutable_data(),
+                                           output->offset, left_data.length);
+    auto on_null = [&writer]() {
+      writer.Set();
+      writer.Next();
+    };
+    auto on_value = [&writer](int32_t memo_index) {
+      if (memo_index != internal::kKeyNotFound) {
+        writer.Set();
+      } else {
+        writer.Clear();
+      }
+      writer.Next();
+    };
+    RETURN_NOT_OK(value_set_.Lookup(left_data, on_null, on_value));
+    writer.Finish();
 
     // if right null count is zero and left null count is not zero, propagate nulls
-    if (right_null_count_ == 0 && left_data.GetNullCount() != 0) {
+    if (value_set_.null_count() == 0 && left_data.GetNullCount() != 0) {
       RETURN_NOT_OK(detail::PropagateNulls(ctx, left_data, output.get()));
     }
     return Status::OK();
   }
 
   Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
-    MemoTableRight<Type, Scalar> func;
-    RETURN_NOT_OK(func.Reset(pool_));
+    return value_set_.Construct(right);
+  }
 
-    if (right.kind() == Datum::ARRAY) {
-      RETURN_NOT_OK(func.Append(ctx, right));
-    } else if (right.kind() == Datum::CHUNKED_ARRAY) {
-      const ChunkedArray& right_array = *right.chunked_array();
-      for (int i = 0; i < right_array.num_chunks(); i++) {
-        RETURN_NOT_OK(func.Append(ctx, right_array.chunk(i)));
+ private:
+  ValueSet<Type, Scalar> value_set_;
+};
+
+template <typename Type, typename Scalar>
+class IndexInKernel : public IsInKernelImpl {
+ public:
+  IndexInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : value_set_(pool, /*with_positions=*/true) {}
+
+  // \brief Write the position in the value set of each value of left, null if
+  // not found.  Nulls of left are found at the first null of the value set.
+  Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
+    const ArrayData& left_data = *left.array();
+
+    std::shared_ptr<ArrayData> output = out->array();
+    output->type = int32();
+
+    std::shared_ptr<Buffer> validity;
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(left_data.length), &validity));
+    internal::FirstTimeBitmapWriter writer(validity->mutable_data(), 0,
+                                           left_data.length);
+    int32_t* out_values = output->GetMutableValues<int32_t>(1);
+    int64_t null_count = 0;
+    auto write = [&](int32_t position) {
+      if (position != internal::kKeyNotFound) {
+        *out_values++ = position;
+        writer.Set();
+      } else {
+        *out_values++ = 0;
+        writer.Clear();
+        ++null_count;
       }
-    } else {
-      return Status::Invalid("Input Datum was not array-like");
+      writer.Next();
+    };
+    const int32_t null_position = value_set_.null_position();
+    auto on_null = [&]() { write(null_position); };
+    auto on_value = [&](int32_t memo_index) {
+      write(memo_index != internal::kKeyNotFound ? value_set_.position(memo_index)
+                                                 : internal::kKeyNotFound);
+    };
+    RETURN_NOT_OK(value_set_.Lookup(left_data, on_null, on_value));
+    writer.Finish();
+
+    output->null_count = null_count;
+    if (null_count > 0) {
+      output->buffers[0] = std::move(validity);
     }
-
-    memo_table_ = std::move(func.memo_table_);
-    right_null_count_ = func.right_null_count;
     return Status::OK();
   }
 
- protected:
-  using MemoTable = typename HashTraits<Type>::MemoTableType;
-  std::unique_ptr<MemoTable> memo_table_;
-  std::shared_ptr<DataType> type_;
-  MemoryPool* pool_;
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+  Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
+    return value_set_.Construct(right);
+  }
 
  private:
-  // \brief Additional member "right_null_count" is used to check if
-  // null count in right is not 0
-  int64_t right_null_count_{};
-  std::shared_ptr<internal::FirstTimeBitmapWriter> writer;
-  std::shared_ptr<ArrayData> output;
+  ValueSet<Type, Scalar> value_set_;
 };
 
 // ----------------------------------------------------------------------
@@ -232,6 +460,41 @@ class NullIsInKernel : public IsInKernelImpl {
   std::shared_ptr<ArrayData> output;
 };
 
+// \brief Values of NullType are all null, thus found at position 0 of a
+// non-empty value set
+class NullIndexInKernel : public IsInKernelImpl {
+ public:
+  NullIndexInKernel(const std::shared_ptr<DataType>& type, MemoryPool* pool) {}
+
+  Status Compute(FunctionContext* ctx, const Datum& left, Datum* out) override {
+    const ArrayData& left_data = *left.array();
+
+    std::shared_ptr<ArrayData> output = out->array();
+    output->type = int32();
+
+    int32_t* out_values = output->GetMutableValues<int32_t>(1);
+    std::fill(out_values, out_values + left_data.length, 0);
+    if (right_length_ == 0) {
+      return detail::SetAllNulls(ctx, left_data, output.get());
+    }
+    output->null_count = 0;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+  Status ConstructRight(FunctionContext* ctx, const Datum& right) override {
+    if (right.kind() != Datum::ARRAY && right.kind() != Datum::CHUNKED_ARRAY) {
+      return Status::Invalid("Input Datum was not array-like");
+    }
+    right_length_ = right.length();
+    return Status::OK();
+  }
+
+ private:
+  int64_t right_length_ = 0;
+};
+
 // ----------------------------------------------------------------------
 // Kernel wrapper for generic hash table kernels
 
@@ -241,36 +504,48 @@ struct IsInKernelTraits {};
 template <typename Type>
 struct IsInKernelTraits<Type, enable_if_null<Type>> {
   using IsInKernelImpl = NullIsInKernel;
+  using IndexInKernelImpl = NullIndexInKernel;
 };
 
 template <typename Type>
 struct IsInKernelTraits<Type, enable_if_has_c_type<Type>> {
   using IsInKernelImpl = IsInKernel<Type, typename Type::c_type>;
+  using IndexInKernelImpl = IndexInKernel<Type, typename Type::c_type>;
 };
 
 template <typename Type>
 struct IsInKernelTraits<Type, enable_if_boolean<Type>> {
   using IsInKernelImpl = IsInKernel<Type, bool>;
+  using IndexInKernelImpl = IndexInKernel<Type, bool>;
 };
 
 template <typename Type>
 struct IsInKernelTraits<Type, enable_if_binary<Type>> {
   using IsInKernelImpl = IsInKernel<Type, util::string_view>;
+  using IndexInKernelImpl = IndexInKernel<Type, util::string_view>;
 };
 
 template <typename Type>
 struct IsInKernelTraits<Type, enable_if_fixed_size_binary<Type>> {
   using IsInKernelImpl = IsInKernel<Type, util::string_view>;
+  using IndexInKernelImpl = IndexInKernel<Type, util::string_view>;
 };
 
+// \brief Make an IsIn kernel, or an IndexIn kernel if index_in is true
 Status GetIsInKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
-                     const Datum& right, std::unique_ptr<IsInKernelImpl>* out) {
+                     const Datum& right, bool index_in,
+                     std::unique_ptr<IsInKernelImpl>* out) {
   std::unique_ptr<IsInKernelImpl> kernel;
 
-#define ISIN_CASE(InType)                                               \
-  case InType::type_id:                                                 \
-    kernel.reset(new typename IsInKernelTraits<InType>::IsInKernelImpl( \
-        type, ctx->memory_pool()));                                     \
+#define ISIN_CASE(InType)                                                    \
+  case InType::type_id:                                                      \
+    if (index_in) {                                                          \
+      kernel.reset(new typename IsInKernelTraits<InType>::IndexInKernelImpl( \
+          type, ctx->memory_pool()));                                        \
+    } else {                                                                 \
+      kernel.reset(new typename IsInKernelTraits<InType>::IsInKernelImpl(    \
+          type, ctx->memory_pool()));                                        \
+    }                                                                        \
     break
 
   switch (type->id()) {
@@ -301,19 +576,73 @@ Status GetIsInKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type
 #undef ISIN_CASE
 
   if (!kernel) {
-    return Status::NotImplemented("IsIn is not implemented for ", type->ToString());
+    return Status::NotImplemented(index_in ? "IndexIn" : "IsIn",
+                                  " is not implemented for ", type->ToString());
   }
   RETURN_NOT_OK(kernel->ConstructRight(ctx, right));
   *out = std::move(kernel);
   return Status::OK();
 }
 
+// Decode a dictionary-encoded value set, which is expected to be small
+static Status DecodeDictionary(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::vector<std::shared_ptr<Array>> chunks, decoded;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.make_array());
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = value.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("Expected array-like value set");
+  }
+  for (const auto& chunk : chunks) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(Take(ctx, *dict_array.dictionary(), *dict_array.indices(),
+                       TakeOptions(), &values));
+    decoded.push_back(values);
+  }
+  *out = detail::WrapArraysLike(value, decoded);
+  return Status::OK();
+}
+
+// Look up the value set once per dictionary of left, then map its indices
+static Status DictionaryIsIn(FunctionContext* ctx, const Datum& left, const Datum& right,
+                             Datum* out) {
+  const auto& value_type = checked_cast<const DictionaryType&>(*left.type()).value_type();
+  Datum value_set = right;
+  if (right.type()->id() == Type::DICTIONARY) {
+    RETURN_NOT_OK(DecodeDictionary(ctx, right, &value_set));
+  }
+  if (!value_set.type()->Equals(value_type)) {
+    return Status::TypeError("IsIn value set of type ", *right.type(),
+                             " does not match dictionary values of type ", *value_type);
+  }
+
+  // Null indices behave like null values
+  const int64_t value_set_nulls = value_set.kind() == Datum::ARRAY
+                                      ? value_set.array()->GetNullCount()
+                                      : value_set.chunked_array()->null_count();
+  const BooleanScalar null_result(true, value_set_nulls > 0);
+  return detail::EvaluateOnDictionary(
+      ctx, left,
+      [&](const Array& dictionary, std::shared_ptr<Array>* dictionary_result) {
+        Datum result;
+        RETURN_NOT_OK(IsIn(ctx, Datum(dictionary.data()), value_set, &result));
+        *dictionary_result = result.make_array();
+        return Status::OK();
+      },
+      null_result, out);
+}
+
 Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
+  if (left.type()->id() == Type::DICTIONARY) {
+    return DictionaryIsIn(ctx, left, right, out);
+  }
   DCHECK(left.type()->Equals(right.type()));
   std::vector<Datum> outputs;
   std::unique_ptr<IsInKernelImpl> lkernel;
 
-  RETURN_NOT_OK(GetIsInKernel(ctx, left.type(), right, &lkernel));
+  RETURN_NOT_OK(GetIsInKernel(ctx, left.type(), right, /*index_in=*/false, &lkernel));
   detail::PrimitiveAllocatingUnaryKernel kernel(lkernel.get());
   RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, left, &outputs));
 
@@ -321,5 +650,32 @@ Status IsIn(FunctionContext* ctx, const Datum& left, const Datum& right, Datum*
   return Status::OK();
 }
 
+Status IndexIn(FunctionContext* ctx, const Datum& left, const Datum& right,
+               Datum* out) {
+  // Positions in a dictionary-encoded value set are those of its indices, and
+  // thus of its decoded values
+  Datum left_values = left, value_set = right;
+  if (left.type()->id() == Type::DICTIONARY) {
+    RETURN_NOT_OK(DecodeDictionary(ctx, left, &left_values));
+  }
+  if (right.type()->id() == Type::DICTIONARY) {
+    RETURN_NOT_OK(DecodeDictionary(ctx, right, &value_set));
+  }
+  if (!left_values.type()->Equals(value_set.type())) {
+    return Status::TypeError("IndexIn value set of type ", *right.type(),
+                             " does not match values of type ", *left.type());
+  }
+  std::vector<Datum> outputs;
+  std::unique_ptr<IsInKernelImpl> lkernel;
+
+  RETURN_NOT_OK(
+      GetIsInKernel(ctx, left_values.type(), value_set, /*index_in=*/true, &lkernel));
+  detail::PrimitiveAllocatingUnaryKernel kernel(lkernel.get());
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, left_values, &outputs));
+
+  *out = detail::WrapDatumsLike(left_values, outputs);
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -35,6 +35,13 @@ namespace compute {
 /// If null occurs in left, if null count in right is not 0,
 /// it returns true, else returns null.
 ///
+/// If left is dictionary-encoded, right may be given either in the value
+/// type of the dictionary or dictionary-encoded.  The value set is then
+/// looked up once per dictionary of left rather than once per value.
+///
+/// Value sets of many distinct values get a Bloom filter, which answers most
+/// lookups of values not in right without the cache misses of the hash table.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] left array-like input
 /// \param[in] right array-like input
@@ -45,5 +52,28 @@ namespace compute {
 ARROW_EXPORT
 Status IsIn(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
 
+/// \brief IndexIn returns the position in right of each value of left,
+/// as needed by semi-joins.
+///
+/// The position is that of the first occurrence of the value in right,
+/// counted across its chunks, and is null if the value is not in right.
+/// Nulls in left are at the position of the first null in right, if any.
+///
+/// As with IsIn, right is hashed, and large value sets are prefiltered with
+/// a Bloom filter, so that most values of left which are not in right are
+/// rejected without probing the hash table.  Dictionary-encoded inputs are
+/// decoded first.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left array-like input
+/// \param[in] right array-like input, of at most 2^31 - 1 values
+/// \param[out] out resulting datum of int32 positions, like left
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status IndexIn(FunctionContext* context, const Datum& left, const Datum& right,
+               Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/builder.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/isin.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+constexpr int64_t kNumProbes = 1 << 20;
+
+// A value set of distinct ids and probes of which hit_percent percent are in it
+static void MakeProbes(int64_t value_set_size, int64_t hit_percent,
+                       std::shared_ptr<Array>* value_set,
+                       std::shared_ptr<Array>* probes) {
+  Int64Builder value_set_builder;
+  for (int64_t i = 0; i < value_set_size; ++i) {
+    ABORT_NOT_OK(value_set_builder.Append(i * 2));
+  }
+  ABORT_NOT_OK(value_set_builder.Finish(value_set));
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto ids = std::static_pointer_cast<Int64Array>(
+      rand.Int64(kNumProbes, 0, value_set_size - 1, /*null_probability=*/0));
+  auto hits = std::static_pointer_cast<Int64Array>(
+      rand.Int64(kNumProbes, 0, 99, /*null_probability=*/0));
+  Int64Builder probe_builder;
+  for (int64_t i = 0; i < kNumProbes; ++i) {
+    // Odd ids are never in the value set
+    const int64_t id = ids->Value(i) * 2 + (hits->Value(i) < hit_percent ? 0 : 1);
+    ABORT_NOT_OK(probe_builder.Append(id));
+  }
+  ABORT_NOT_OK(probe_builder.Finish(probes));
+}
+
+static void IsInInt64(benchmark::State& state) {
+  std::shared_ptr<Array> value_set, probes;
+  MakeProbes(state.range(0), state.range(1), &value_set, &probes);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(IsIn(&ctx, probes, value_set, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["value_set_size"] = static_cast<double>(state.range(0));
+  state.counters["hit_percent"] = static_cast<double>(state.range(1));
+  state.SetItemsProcessed(state.iterations() * kNumProbes);
+}
+
+static void IndexInInt64(benchmark::State& state) {
+  std::shared_ptr<Array> value_set, probes;
+  MakeProbes(state.range(0), state.range(1), &value_set, &probes);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(IndexIn(&ctx, probes, value_set, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["value_set_size"] = static_cast<double>(state.range(0));
+  state.counters["hit_percent"] = static_cast<double>(state.range(1));
+  state.SetItemsProcessed(state.iterations() * kNumProbes);
+}
+
+static void ValueSetArgs(benchmark::internal::Benchmark* bench) {
+  // Value sets below and above the Bloom filter threshold, with mostly
+  // missing and mostly found probes
+  for (const int64_t value_set_size : {1 << 10, 1 << 20}) {
+    for (const int64_t hit_percent : {1, 50, 100}) {
+      bench->Args({value_set_size, hit_percent});
+    }
+  }
+  bench->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(IsInInt64)->Apply(ValueSetArgs);
+BENCHMARK(IndexInInt64)->Apply(ValueSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -29,6 +29,7 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/isin.h"
@@ -410,5 +411,175 @@ TEST_F(TestIsInKernel, IsInChunkedArrayInvoke) {
   AssertChunkedEqual(*expected_carr, *encoded_out.chunked_array());
 }
 
+TEST_F(TestIsInKernel, IsInDictionary) {
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])");
+  auto dict_type = dictionary(int8(), utf8());
+  auto MakeDictArray = [&](const std::string& indices) {
+    return std::make_shared<DictionaryArray>(dict_type, ArrayFromJSON(int8(), indices),
+                                             dict);
+  };
+  auto AssertIsIn = [&](const Datum& left, const Datum& right,
+                        const std::string& expected) {
+    Datum out;
+    ASSERT_OK(IsIn(&this->ctx_, left, right, &out));
+    AssertArraysEqual(*ArrayFromJSON(boolean(), expected), *out.make_array());
+  };
+
+  auto array = MakeDictArray("[0, 1, null, 3, 2, 0]");
+  AssertIsIn(array, ArrayFromJSON(utf8(), R"(["baz", "foo", "zzz"])"),
+             "[true, false, null, false, true, true]");
+  AssertIsIn(array, ArrayFromJSON(utf8(), R"(["bar", null])"),
+             "[false, true, true, false, false, false]");
+  AssertIsIn(array, ArrayFromJSON(utf8(), "[]"),
+             "[false, false, null, false, false, false]");
+  // Dictionary-encoded value set
+  AssertIsIn(array, MakeDictArray("[3, 3]"), "[false, false, null, true, false, false]");
+
+  // Chunks with different dictionaries
+  auto other_dict = ArrayFromJSON(utf8(), R"(["quux", "x"])");
+  auto other = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[0, 1]"), other_dict);
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{array, other});
+  Datum out;
+  ASSERT_OK(IsIn(&this->ctx_, chunked, ArrayFromJSON(utf8(), R"(["quux"])"), &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  auto expected = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(boolean(), "[false, false, null, true, false, false]"),
+      ArrayFromJSON(boolean(), "[true, false]")});
+  AssertChunkedEqual(*expected, *out.chunked_array());
+
+  ASSERT_RAISES(TypeError, IsIn(&this->ctx_, array, ArrayFromJSON(int32(), "[1]"), &out));
+}
+
+TEST_F(TestIsInKernel, IsInLargeValueSet) {
+  // Enough distinct values for the value set to get a Bloom filter, with most
+  // values of left absent
+  const int64_t kNumValues = 1 << 16;
+  std::vector<int64_t> values, member_set;
+  std::vector<bool> expected;
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    member_set.push_back(i * 7);
+  }
+  for (int64_t i = 0; i < 4 * kNumValues; ++i) {
+    values.push_back(i * 3);
+    expected.push_back(i % 7 == 0 && 3 * i < 7 * kNumValues);
+  }
+  CheckIsIn<Int64Type, int64_t>(&this->ctx_, int64(), values, {}, member_set, {},
+                                expected, {});
+
+  std::vector<std::string> strings, string_set;
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    string_set.push_back(std::to_string(i * 7));
+  }
+  for (int64_t i = 0; i < kNumValues; ++i) {
+    strings.push_back(std::to_string(i * 3));
+  }
+  expected.resize(kNumValues);
+  CheckIsIn<StringType, std::string>(&this->ctx_, utf8(), strings, {}, string_set, {},
+                                     expected, {});
+}
+
+// ----------------------------------------------------------------------
+// IndexIn tests
+
+class TestIndexInKernel : public ComputeFixture, public TestBase {
+ public:
+  void AssertIndexIn(const Datum& left, const Datum& right,
+                     const std::string& expected) {
+    Datum out;
+    ASSERT_OK(IndexIn(&this->ctx_, left, right, &out));
+    AssertArraysEqual(*ArrayFromJSON(int32(), expected), *out.make_array());
+  }
+
+  void AssertIndexIn(const std::shared_ptr<DataType>& type, const std::string& left,
+                     const std::string& right, const std::string& expected) {
+    AssertIndexIn(ArrayFromJSON(type, left), ArrayFromJSON(type, right), expected);
+  }
+};
+
+TEST_F(TestIndexInKernel, Primitive) {
+  for (const auto& type : {int8(), uint16(), int32(), int64(), float64()}) {
+    AssertIndexIn(type, "[2, 1, 5, 2, 3]", "[3, 2, 2, 1]", "[1, 3, null, 1, 0]");
+    AssertIndexIn(type, "[2, null, 1]", "[1, 2]", "[1, null, 0]");
+    AssertIndexIn(type, "[2, null, 1]", "[1, null, 2, null]", "[2, 1, 0]");
+    AssertIndexIn(type, "[2, 1]", "[]", "[null, null]");
+    AssertIndexIn(type, "[]", "[1]", "[]");
+  }
+  AssertIndexIn(boolean(), "[true, null, false]", "[false, false, true]",
+                "[2, null, 0]");
+}
+
+TEST_F(TestIndexInKernel, Binary) {
+  AssertIndexIn(utf8(), R"(["foo", "bar", null, "baz", ""])",
+                R"(["baz", "", null, "foo"])", "[3, null, 2, 0, 1]");
+  AssertIndexIn(binary(), R"(["foo", "bar"])", R"(["bar", "bar"])", "[null, 0]");
+  AssertIndexIn(fixed_size_binary(2), R"(["ab", "cd", null])", R"(["cd", "ab"])",
+                "[1, 0, null]");
+}
+
+TEST_F(TestIndexInKernel, Null) {
+  AssertIndexIn(null(), "[null, null]", "[null]", "[0, 0]");
+  AssertIndexIn(null(), "[null, null]", "[]", "[null, null]");
+}
+
+TEST_F(TestIndexInKernel, ChunkedArray) {
+  // Positions are counted across the chunks of the value set
+  auto value_set = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[4, 5]"), ArrayFromJSON(int32(), "[]"),
+                  ArrayFromJSON(int32(), "[6, null, 4]")});
+  AssertIndexIn(ArrayFromJSON(int32(), "[6, 4, null, 7]"), value_set, "[2, 0, 3, null]");
+
+  auto left = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[5, 7]"), ArrayFromJSON(int32(), "[6]")});
+  Datum out;
+  ASSERT_OK(IndexIn(&this->ctx_, left, value_set, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  auto expected = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[1, null]"), ArrayFromJSON(int32(), "[2]")});
+  AssertChunkedEqual(*expected, *out.chunked_array());
+}
+
+TEST_F(TestIndexInKernel, Dictionary) {
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+  auto dict_type = dictionary(int8(), utf8());
+  auto array = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[0, 1, null, 2]"), dict);
+  AssertIndexIn(array, ArrayFromJSON(utf8(), R"(["baz", "foo", null])"),
+                "[1, null, 2, 0]");
+  auto value_set = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[2, 2, 1]"), dict);
+  AssertIndexIn(array, value_set, "[null, 2, null, 0]");
+  AssertIndexIn(ArrayFromJSON(utf8(), R"(["bar", "qux"])"), value_set, "[2, null]");
+
+  Datum out;
+  ASSERT_RAISES(TypeError,
+                IndexIn(&this->ctx_, array, ArrayFromJSON(int32(), "[1]"), &out));
+}
+
+TEST_F(TestIndexInKernel, LargeValueSet) {
+  const int32_t kNumValues = 1 << 16;
+  Int64Builder right_builder, left_builder;
+  Int32Builder expected_builder;
+  for (int32_t i = 0; i < kNumValues; ++i) {
+    ASSERT_OK(right_builder.Append(static_cast<int64_t>(i) * 7));
+  }
+  for (int32_t i = 0; i < 2 * kNumValues; ++i) {
+    ASSERT_OK(left_builder.Append(static_cast<int64_t>(i) * 3));
+    if (i % 7 == 0 && i / 7 * 3 < kNumValues) {
+      ASSERT_OK(expected_builder.Append(i / 7 * 3));
+    } else {
+      ASSERT_OK(expected_builder.AppendNull());
+    }
+  }
+  std::shared_ptr<Array> left, right, expected;
+  ASSERT_OK(left_builder.Finish(&left));
+  ASSERT_OK(right_builder.Finish(&right));
+  ASSERT_OK(expected_builder.Finish(&expected));
+
+  Datum out;
+  ASSERT_OK(IndexIn(&this->ctx_, left, right, &out));
+  AssertArraysEqual(*expected, *out.make_array());
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,588 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::HashTraits;
+using internal::kKeyNotFound;
+using internal::ScalarHelper;
+
+namespace compute {
+
+namespace {
+
+// Don't split the input in slices smaller than this when building or probing
+// in parallel, the per-task overhead would dominate.
+constexpr int64_t kMinParallelSliceLength = 1 << 16;
+
+// The memo tables pick their slots from the low bits of the hash, so use the
+// high bits to pick a partition.
+int PartitionOf(internal::hash_t h, int num_partitions) {
+  return static_cast<int>((h >> 32) % static_cast<uint64_t>(num_partitions));
+}
+
+template <typename Scalar, typename NullFunc, typename ValueFunc>
+struct KeyVisitor {
+  Status VisitNull() {
+    on_null();
+    return Status::OK();
+  }
+
+  Status VisitValue(const Scalar& value) {
+    on_value(value);
+    return Status::OK();
+  }
+
+  NullFunc& on_null;
+  ValueFunc& on_value;
+};
+
+// Call `on_null()` or `on_value(value)` for each value of `data`
+template <typename Type, typename Scalar, typename NullFunc, typename ValueFunc>
+Status VisitKeys(const ArrayData& data, NullFunc&& on_null, ValueFunc&& on_value) {
+  KeyVisitor<Scalar, NullFunc, ValueFunc> visitor{on_null, on_value};
+  return ArrayDataVisitor<Type>::Visit(data, &visitor);
+}
+
+// ----------------------------------------------------------------------
+// Key encoding: map each value of a key column to the dense id of the equal
+// build side value, if any
+
+class JoinKeyEncoder {
+ public:
+  virtual ~JoinKeyEncoder() = default;
+
+  // Insert the values of the build side `slices`, writing the id of each
+  // row to `ids` (kKeyNotFound for nulls).  The values are spread over
+  // `num_partitions` memo tables by hash, each filled by its own task.
+  virtual Status Build(const std::vector<std::shared_ptr<ArrayData>>& slices,
+                       int num_partitions, int32_t* ids) = 0;
+
+  // Write the id of each value of `data` to `ids`, or kKeyNotFound if the
+  // value is null or absent from the build side.  Thread-safe.
+  virtual Status Probe(const ArrayData& data, int32_t* ids) const = 0;
+
+  // Number of distinct build side values
+  virtual int32_t size() const = 0;
+};
+
+template <typename Type, typename Scalar>
+class TypedJoinKeyEncoder : public JoinKeyEncoder {
+ public:
+  explicit TypedJoinKeyEncoder(MemoryPool* pool) : pool_(pool) {}
+
+  Status Build(const std::vector<std::shared_ptr<ArrayData>>& slices, int num_partitions,
+               int32_t* ids) override {
+    memo_tables_.clear();
+    for (int i = 0; i < num_partitions; ++i) {
+      memo_tables_.emplace_back(new MemoTable(pool_, 0));
+    }
+    int64_t length = 0;
+    for (const auto& slice : slices) {
+      length += slice->length;
+    }
+    // The partition of each row, to turn partition-local ids into global ids
+    std::vector<int32_t> row_partitions(num_partitions > 1 ? length : 0);
+
+    auto build_partition = [&](int partition) -> Status {
+      MemoTable* memo_table = memo_tables_[partition].get();
+      int64_t row = 0;
+      auto on_null = [&]() {
+        if (partition == 0) {
+          ids[row] = kKeyNotFound;
+        }
+        ++row;
+      };
+      auto on_value = [&](const Scalar& value) {
+        if (num_partitions == 1) {
+          ids[row] = memo_table->GetOrInsert(value);
+        } else if (PartitionOf(ScalarHelper<Scalar, 0>::ComputeHash(value),
+                               num_partitions) == partition) {
+          ids[row] = memo_table->GetOrInsert(value);
+          row_partitions[row] = partition;
+        }
+        ++row;
+      };
+      for (const auto& slice : slices) {
+        auto status = VisitKeys<Type, Scalar>(*slice, on_null, on_value);
+        RETURN_NOT_OK(status);
+      }
+      return Status::OK();
+    };
+    if (num_partitions > 1) {
+      RETURN_NOT_OK(internal::ParallelFor(num_partitions, build_partition));
+    } else {
+      RETURN_NOT_OK(build_partition(0));
+    }
+
+    // Number the values of each partition after those of the previous ones
+    partition_offsets_.resize(num_partitions);
+    size_ = 0;
+    for (int i = 0; i < num_partitions; ++i) {
+      partition_offsets_[i] = size_;
+      size_ += memo_tables_[i]->size();
+    }
+    if (num_partitions > 1) {
+      for (int64_t row = 0; row < length; ++row) {
+        if (ids[row] != kKeyNotFound) {
+          ids[row] += partition_offsets_[row_partitions[row]];
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Probe(const ArrayData& data, int32_t* ids) const override {
+    const int num_partitions = static_cast<int>(memo_tables_.size());
+    auto on_null = [&]() { *ids++ = kKeyNotFound; };
+    auto on_value = [&](const Scalar& value) {
+      const int partition =
+          num_partitions == 1
+              ? 0
+              : PartitionOf(ScalarHelper<Scalar, 0>::ComputeHash(value), num_partitions);
+      const int32_t id = memo_tables_[partition]->Get(value);
+      *ids++ = id == kKeyNotFound ? kKeyNotFound : partition_offsets_[partition] + id;
+    };
+    return VisitKeys<Type, Scalar>(data, on_null, on_value);
+  }
+
+  int32_t size() const override { return size_; }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  MemoryPool* pool_;
+  std::vector<std::unique_ptr<MemoTable>> memo_tables_;
+  std::vector<int32_t> partition_offsets_;
+  int32_t size_ = 0;
+};
+
+template <typename Type, typename Enable = void>
+struct JoinKeyEncoderTraits {};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_has_c_type<Type>> {
+  using EncoderType = TypedJoinKeyEncoder<Type, typename Type::c_type>;
+};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_boolean<Type>> {
+  using EncoderType = TypedJoinKeyEncoder<Type, bool>;
+};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_binary<Type>> {
+  using EncoderType = TypedJoinKeyEncoder<Type, util::string_view>;
+};
+
+template <typename Type>
+struct JoinKeyEncoderTraits<Type, enable_if_fixed_size_binary<Type>> {
+  using EncoderType = TypedJoinKeyEncoder<Type, util::string_view>;
+};
+
+#define PROCESS_SUPPORTED_JOIN_KEY_TYPES(PROCESS) \
+  PROCESS(BooleanType)                            \
+  PROCESS(UInt8Type)                              \
+  PROCESS(Int8Type)                               \
+  PROCESS(UInt16Type)                             \
+  PROCESS(Int16Type)                              \
+  PROCESS(UInt32Type)                             \
+  PROCESS(Int32Type)                              \
+  PROCESS(UInt64Type)                             \
+  PROCESS(Int64Type)                              \
+  PROCESS(FloatType)                              \
+  PROCESS(DoubleType)                             \
+  PROCESS(Date32Type)                             \
+  PROCESS(Date64Type)                             \
+  PROCESS(Time32Type)                             \
+  PROCESS(Time64Type)                             \
+  PROCESS(TimestampType)                          \
+  PROCESS(BinaryType)                             \
+  PROCESS(StringType)                             \
+  PROCESS(FixedSizeBinaryType)                    \
+  PROCESS(Decimal128Type)
+
+Status MakeJoinKeyEncoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                          std::unique_ptr<JoinKeyEncoder>* out) {
+  switch (type->id()) {
+#define PROCESS(InType)                                                       \
+  case InType::type_id:                                                       \
+    out->reset(new typename JoinKeyEncoderTraits<InType>::EncoderType(pool)); \
+    return Status::OK();
+
+    PROCESS_SUPPORTED_JOIN_KEY_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+  return Status::NotImplemented("hash join not implemented for key type ",
+                                type->ToString());
+}
+
+#undef PROCESS_SUPPORTED_JOIN_KEY_TYPES
+
+// ----------------------------------------------------------------------
+// Hash table: the build side rows, grouped by the tuple of their key ids
+
+int64_t PackIds(int32_t left, int32_t right) {
+  return static_cast<int64_t>((static_cast<uint64_t>(left) << 32) |
+                              static_cast<uint32_t>(right));
+}
+
+class JoinHashTable {
+ public:
+  static Status Make(const std::vector<std::shared_ptr<DataType>>& key_types,
+                     MemoryPool* pool, std::unique_ptr<JoinHashTable>* out) {
+    std::unique_ptr<JoinHashTable> table(new JoinHashTable());
+    for (size_t i = 0; i < key_types.size(); ++i) {
+      std::unique_ptr<JoinKeyEncoder> encoder;
+      RETURN_NOT_OK(MakeJoinKeyEncoder(key_types[i], pool, &encoder));
+      table->encoders_.push_back(std::move(encoder));
+      if (i > 0) {
+        table->tuple_memo_tables_.emplace_back(new TupleMemoTable(pool));
+      }
+    }
+    *out = std::move(table);
+    return Status::OK();
+  }
+
+  Status Build(const std::vector<std::shared_ptr<RecordBatch>>& batches, int64_t length,
+               int num_partitions) {
+    // Encode the key columns one at a time, each with partitioned memo tables
+    std::vector<int32_t> row_ids(length);
+    std::vector<int32_t> column_ids(encoders_.size() > 1 ? length : 0);
+    std::vector<std::shared_ptr<ArrayData>> slices(batches.size());
+    for (size_t i = 0; i < encoders_.size(); ++i) {
+      for (size_t j = 0; j < batches.size(); ++j) {
+        slices[j] = batches[j]->column_data(static_cast<int>(i));
+      }
+      if (i == 0) {
+        RETURN_NOT_OK(encoders_[i]->Build(slices, num_partitions, row_ids.data()));
+        continue;
+      }
+      // Fold the ids of this column into the tuple ids of the previous ones
+      RETURN_NOT_OK(encoders_[i]->Build(slices, num_partitions, column_ids.data()));
+      TupleMemoTable* memo_table = tuple_memo_tables_[i - 1].get();
+      for (int64_t row = 0; row < length; ++row) {
+        if (row_ids[row] != kKeyNotFound && column_ids[row] != kKeyNotFound) {
+          row_ids[row] = memo_table->GetOrInsert(PackIds(row_ids[row], column_ids[row]));
+        } else {
+          row_ids[row] = kKeyNotFound;
+        }
+      }
+    }
+    const int64_t num_ids = tuple_memo_tables_.empty()
+                                ? encoders_[0]->size()
+                                : tuple_memo_tables_.back()->size();
+
+    // Bucket the rows by id, keeping them in order within each bucket
+    offsets_.assign(num_ids + 1, 0);
+    for (int64_t row = 0; row < length; ++row) {
+      if (row_ids[row] != kKeyNotFound) {
+        ++offsets_[row_ids[row] + 1];
+      }
+    }
+    for (int64_t id = 0; id < num_ids; ++id) {
+      offsets_[id + 1] += offsets_[id];
+    }
+    rows_.resize(offsets_[num_ids]);
+    std::vector<int64_t> positions(offsets_.begin(), offsets_.end() - 1);
+    for (int64_t row = 0; row < length; ++row) {
+      if (row_ids[row] != kKeyNotFound) {
+        rows_[positions[row_ids[row]]++] = row;
+      }
+    }
+    return Status::OK();
+  }
+
+  // Write the id of each row of `batch` to `ids`, kKeyNotFound if it has no
+  // match.  Thread-safe.
+  Status Probe(const RecordBatch& batch, int32_t* ids) const {
+    RETURN_NOT_OK(encoders_[0]->Probe(*batch.column_data(0), ids));
+    if (encoders_.size() == 1) {
+      return Status::OK();
+    }
+    const int64_t length = batch.num_rows();
+    std::vector<int32_t> column_ids(length);
+    for (size_t i = 1; i < encoders_.size(); ++i) {
+      const auto& data = *batch.column_data(static_cast<int>(i));
+      RETURN_NOT_OK(encoders_[i]->Probe(data, column_ids.data()));
+      const TupleMemoTable* memo_table = tuple_memo_tables_[i - 1].get();
+      for (int64_t row = 0; row < length; ++row) {
+        if (ids[row] != kKeyNotFound && column_ids[row] != kKeyNotFound) {
+          ids[row] = memo_table->Get(PackIds(ids[row], column_ids[row]));
+        } else {
+          ids[row] = kKeyNotFound;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  // The build side rows with the given id, in increasing order
+  const int64_t* rows_begin(int32_t id) const { return rows_.data() + offsets_[id]; }
+  const int64_t* rows_end(int32_t id) const { return rows_.data() + offsets_[id + 1]; }
+
+ private:
+  using TupleMemoTable = internal::ScalarMemoTable<int64_t>;
+
+  JoinHashTable() = default;
+
+  std::vector<std::unique_ptr<JoinKeyEncoder>> encoders_;
+  // With multiple keys, tuple_memo_tables_[i] maps the pair (tuple id of
+  // the keys up to i, id of key i + 1) to the tuple id up to key i + 1
+  std::vector<std::unique_ptr<TupleMemoTable>> tuple_memo_tables_;
+  std::vector<int64_t> offsets_;
+  std::vector<int64_t> rows_;
+};
+
+// ----------------------------------------------------------------------
+// Probe: emit the index pairs of a slice of the left input
+
+struct JoinOutput {
+  std::vector<int64_t> left_indices;
+  // -1 stands for a null index (unmatched row of a left outer join)
+  std::vector<int64_t> right_indices;
+};
+
+Status ProbeBatch(const JoinHashTable& hash_table, const RecordBatch& batch,
+                  int64_t row_offset, HashJoinOptions::JoinType join_type,
+                  JoinOutput* out) {
+  std::vector<int32_t> ids(batch.num_rows());
+  RETURN_NOT_OK(hash_table.Probe(batch, ids.data()));
+  for (int64_t i = 0; i < batch.num_rows(); ++i) {
+    const int64_t left_row = row_offset + i;
+    const bool matched = ids[i] != kKeyNotFound;
+    switch (join_type) {
+      case HashJoinOptions::INNER:
+      case HashJoinOptions::LEFT_OUTER:
+        if (matched) {
+          const int64_t* begin = hash_table.rows_begin(ids[i]);
+          const int64_t* end = hash_table.rows_end(ids[i]);
+          out->left_indices.insert(out->left_indices.end(), end - begin, left_row);
+          out->right_indices.insert(out->right_indices.end(), begin, end);
+        } else if (join_type == HashJoinOptions::LEFT_OUTER) {
+          out->left_indices.push_back(left_row);
+          out->right_indices.push_back(-1);
+        }
+        break;
+      case HashJoinOptions::LEFT_SEMI:
+        if (matched) {
+          out->left_indices.push_back(left_row);
+        }
+        break;
+      case HashJoinOptions::LEFT_ANTI:
+        if (!matched) {
+          out->left_indices.push_back(left_row);
+        }
+        break;
+    }
+  }
+  return Status::OK();
+}
+
+// Concatenate the indices of all slices in an Int64Array, -1 becoming null
+Status MakeIndices(FunctionContext* ctx, const std::vector<JoinOutput>& outputs,
+                   std::vector<int64_t> JoinOutput::*member,
+                   std::shared_ptr<Array>* out) {
+  int64_t length = 0;
+  for (const auto& output : outputs) {
+    length += static_cast<int64_t>((output.*member).size());
+  }
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(int64_t), &data));
+  auto values = reinterpret_cast<int64_t*>(data->mutable_data());
+  for (const auto& output : outputs) {
+    const std::vector<int64_t>& indices = output.*member;
+    std::copy(indices.begin(), indices.end(), values);
+    values += indices.size();
+  }
+
+  values = reinterpret_cast<int64_t*>(data->mutable_data());
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    if (values[i] >= 0) {
+      continue;
+    }
+    if (null_bitmap == nullptr) {
+      RETURN_NOT_OK(AllocateBitmap(ctx->memory_pool(), length, &null_bitmap));
+      BitUtil::SetBitsTo(null_bitmap->mutable_data(), 0, length, true);
+    }
+    BitUtil::ClearBit(null_bitmap->mutable_data(), i);
+    values[i] = 0;
+    ++null_count;
+  }
+  *out = std::make_shared<Int64Array>(length, data, null_bitmap, null_count);
+  return Status::OK();
+}
+
+Status MakeBatches(const std::vector<Datum>& keys, const char* side, int64_t chunksize,
+                   std::vector<std::shared_ptr<RecordBatch>>* out, int64_t* length) {
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    std::shared_ptr<ChunkedArray> column;
+    switch (keys[i].kind()) {
+      case Datum::ARRAY:
+        column = std::make_shared<ChunkedArray>(ArrayVector{keys[i].make_array()});
+        break;
+      case Datum::CHUNKED_ARRAY:
+        column = keys[i].chunked_array();
+        break;
+      default:
+        return Status::Invalid("HashJoinIndices expects Array or ChunkedArray datums");
+    }
+    if (i > 0 && column->length() != columns[0]->length()) {
+      return Status::Invalid("HashJoinIndices ", side,
+                             " keys must all have the same length");
+    }
+    fields.push_back(field("key_" + std::to_string(i), column->type()));
+    columns.push_back(std::move(column));
+  }
+  *length = columns[0]->length();
+
+  auto table = Table::Make(schema(fields), columns);
+  TableBatchReader reader(*table);
+  if (chunksize > 0) {
+    reader.set_chunksize(chunksize);
+  }
+  RETURN_NOT_OK(reader.ReadAll(out));
+  // Compute the null counts up front, they are computed lazily otherwise and
+  // the slices are visited from several threads
+  for (const auto& batch : *out) {
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      batch->column_data(i)->GetNullCount();
+    }
+  }
+  return Status::OK();
+}
+
+int NumTasks(const HashJoinOptions& options, int64_t length) {
+  if (!options.use_threads) {
+    return 1;
+  }
+  const int64_t max_tasks = std::max<int64_t>(length / kMinParallelSliceLength, 1);
+  return static_cast<int>(
+      std::min<int64_t>(internal::GetCpuThreadPool()->GetCapacity(), max_tasks));
+}
+
+}  // namespace
+
+Status HashJoinIndices(FunctionContext* ctx, const std::vector<Datum>& left_keys,
+                       const std::vector<Datum>& right_keys,
+                       const HashJoinOptions& options,
+                       std::shared_ptr<Array>* left_indices,
+                       std::shared_ptr<Array>* right_indices) {
+  if (left_keys.empty()) {
+    return Status::Invalid("HashJoinIndices needs at least one key");
+  }
+  if (left_keys.size() != right_keys.size()) {
+    return Status::Invalid("HashJoinIndices got ", left_keys.size(), " left keys but ",
+                           right_keys.size(), " right keys");
+  }
+  std::vector<std::shared_ptr<DataType>> key_types;
+  for (size_t i = 0; i < left_keys.size(); ++i) {
+    const auto left_type = left_keys[i].type();
+    const auto right_type = right_keys[i].type();
+    if (left_type == nullptr || right_type == nullptr) {
+      return Status::Invalid("HashJoinIndices expects Array or ChunkedArray datums");
+    }
+    if (!left_type->Equals(*right_type)) {
+      return Status::TypeError("HashJoinIndices key ", i, " has type ",
+                               left_type->ToString(), " on the left but ",
+                               right_type->ToString(), " on the right");
+    }
+    key_types.push_back(left_type);
+  }
+
+  // Build
+  std::vector<std::shared_ptr<RecordBatch>> right_batches;
+  int64_t right_length;
+  RETURN_NOT_OK(MakeBatches(right_keys, "right", 0, &right_batches, &right_length));
+  std::unique_ptr<JoinHashTable> hash_table;
+  RETURN_NOT_OK(JoinHashTable::Make(key_types, ctx->memory_pool(), &hash_table));
+  RETURN_NOT_OK(
+      hash_table->Build(right_batches, right_length, NumTasks(options, right_length)));
+
+  // Probe, emitting the index pairs of each contiguous range of left slices
+  // on its own
+  int64_t left_length = left_keys[0].length();
+  int num_tasks = NumTasks(options, left_length);
+  std::vector<std::shared_ptr<RecordBatch>> left_batches;
+  RETURN_NOT_OK(MakeBatches(left_keys, "left",
+                            num_tasks > 1 ? BitUtil::CeilDiv(left_length, num_tasks) : 0,
+                            &left_batches, &left_length));
+  std::vector<int64_t> row_offsets(left_batches.size());
+  for (size_t i = 1; i < left_batches.size(); ++i) {
+    row_offsets[i] = row_offsets[i - 1] + left_batches[i - 1]->num_rows();
+  }
+
+  num_tasks = std::max(1, std::min(num_tasks, static_cast<int>(left_batches.size())));
+  std::vector<JoinOutput> outputs(num_tasks);
+  auto probe_range = [&](int task) -> Status {
+    const size_t begin = left_batches.size() * task / num_tasks;
+    const size_t end = left_batches.size() * (task + 1) / num_tasks;
+    for (size_t i = begin; i < end; ++i) {
+      RETURN_NOT_OK(ProbeBatch(*hash_table, *left_batches[i], row_offsets[i],
+                               options.join_type, &outputs[task]));
+    }
+    return Status::OK();
+  };
+  if (num_tasks > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_tasks, probe_range));
+  } else {
+    RETURN_NOT_OK(probe_range(0));
+  }
+
+  RETURN_NOT_OK(MakeIndices(ctx, outputs, &JoinOutput::left_indices, left_indices));
+  if (options.join_type == HashJoinOptions::INNER ||
+      options.join_type == HashJoinOptions::LEFT_OUTER) {
+    RETURN_NOT_OK(MakeIndices(ctx, outputs, &JoinOutput::right_indices, right_indices));
+  } else {
+    *right_indices = nullptr;
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
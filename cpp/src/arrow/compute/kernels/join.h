@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernel.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class HashJoinOptions
+///
+/// Controls which rows HashJoinIndices emits, and whether the hash table may
+/// be built and probed in parallel.
+struct ARROW_EXPORT HashJoinOptions {
+  enum JoinType {
+    // One output row per pair of matching left and right rows.
+    INNER = 0,
+    // Like INNER, plus one output row with a null right index for each left
+    // row without any match.
+    LEFT_OUTER,
+    // One output row per left row with at least one match.
+    LEFT_SEMI,
+    // One output row per left row without any match.
+    LEFT_ANTI,
+  };
+
+  HashJoinOptions() = default;
+
+  explicit HashJoinOptions(JoinType join_type) : join_type(join_type) {}
+
+  JoinType join_type = INNER;
+
+  /// If true, the hash table is built in partitions on the CPU thread pool,
+  /// and the left rows are probed in parallel slices.
+  bool use_threads = true;
+};
+
+/// \brief Compute the row indices of an equi-join between two sets of keys.
+///
+/// A hash table is built over the right keys, then probed with the left keys.
+/// Left and right rows match if all their key values are equal; null keys
+/// never match.  The output rows are ordered by left row, then by right row.
+///
+/// The indices are Int64Arrays meant to be passed to Take() in order to
+/// materialize the joined columns.  For INNER and LEFT_OUTER joins,
+/// `left_indices` and `right_indices` have the same length; right indices
+/// are null for unmatched left rows of a LEFT_OUTER join.  For LEFT_SEMI and
+/// LEFT_ANTI joins, only `left_indices` is computed and `right_indices` is
+/// set to null.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left_keys the probe side key columns, as Array or ChunkedArray
+/// of equal lengths
+/// \param[in] right_keys the build side key columns, as many as the left keys
+/// and of the same types
+/// \param[in] options the join type
+/// \param[out] left_indices the indices of the output rows in the left input
+/// \param[out] right_indices the indices of the output rows in the right input
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoinIndices(FunctionContext* context, const std::vector<Datum>& left_keys,
+                       const std::vector<Datum>& right_keys,
+                       const HashJoinOptions& options,
+                       std::shared_ptr<Array>* left_indices,
+                       std::shared_ptr<Array>* right_indices);
+
+}  // namespace compute
+}  // namespace arrow
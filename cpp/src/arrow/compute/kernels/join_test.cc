@@ -0,0 +1,218 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/join.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoinIndices : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertJoin(const std::vector<Datum>& left_keys,
+                  const std::vector<Datum>& right_keys,
+                  HashJoinOptions::JoinType join_type, const std::string& expected_left,
+                  const std::string& expected_right = "") {
+    std::shared_ptr<Array> left_indices, right_indices;
+    ASSERT_OK(HashJoinIndices(&this->ctx_, left_keys, right_keys,
+                              HashJoinOptions(join_type), &left_indices,
+                              &right_indices));
+    ASSERT_OK(left_indices->Validate());
+    AssertArraysEqual(*ArrayFromJSON(int64(), expected_left), *left_indices);
+    if (expected_right.empty()) {
+      ASSERT_EQ(nullptr, right_indices);
+    } else {
+      ASSERT_OK(right_indices->Validate());
+      AssertArraysEqual(*ArrayFromJSON(int64(), expected_right), *right_indices);
+    }
+  }
+};
+
+TEST_F(TestHashJoinIndices, JoinTypes) {
+  auto left = ArrayFromJSON(utf8(), R"(["a", "b", null, "c", "a", "d"])");
+  auto right = ArrayFromJSON(utf8(), R"(["c", "a", null, "a", "e"])");
+
+  AssertJoin({left}, {right}, HashJoinOptions::INNER, "[0, 0, 3, 4, 4]",
+             "[1, 3, 0, 1, 3]");
+  AssertJoin({left}, {right}, HashJoinOptions::LEFT_OUTER, "[0, 0, 1, 2, 3, 4, 4, 5]",
+             "[1, 3, null, null, 0, 1, 3, null]");
+  AssertJoin({left}, {right}, HashJoinOptions::LEFT_SEMI, "[0, 3, 4]");
+  AssertJoin({left}, {right}, HashJoinOptions::LEFT_ANTI, "[1, 2, 5]");
+}
+
+TEST_F(TestHashJoinIndices, MultipleKeys) {
+  auto left0 = ArrayFromJSON(int64(), "[1, 1, 2, 2, null, 3]");
+  auto left1 = ArrayFromJSON(utf8(), R"(["x", "y", "x", null, "x", "y"])");
+  auto right0 = ArrayFromJSON(int64(), "[2, 1, 1, 2, null, 3]");
+  auto right1 = ArrayFromJSON(utf8(), R"(["x", "y", "y", null, "x", "x"])");
+
+  AssertJoin({left0, left1}, {right0, right1}, HashJoinOptions::INNER, "[1, 1, 2]",
+             "[1, 2, 0]");
+  AssertJoin({left0, left1}, {right0, right1}, HashJoinOptions::LEFT_ANTI,
+             "[0, 3, 4, 5]");
+}
+
+TEST_F(TestHashJoinIndices, KeyTypes) {
+  for (const auto& type : {boolean(), int8(), uint16(), int32(), uint64(), float64(),
+                           date32(), timestamp(TimeUnit::MICRO), binary()}) {
+    SCOPED_TRACE(type->ToString());
+    const char* left_json = type->id() == Type::BOOL ? "[true, false, null, true]"
+                            : type->id() == Type::BINARY ? R"(["1", "0", null, "1"])"
+                                                         : "[1, 0, null, 1]";
+    const char* right_json = type->id() == Type::BOOL ? "[null, true]"
+                             : type->id() == Type::BINARY ? R"([null, "1"])"
+                                                          : "[null, 1]";
+    AssertJoin({ArrayFromJSON(type, left_json)}, {ArrayFromJSON(type, right_json)},
+               HashJoinOptions::INNER, "[0, 3]", "[1, 1]");
+  }
+}
+
+TEST_F(TestHashJoinIndices, ChunkedInputs) {
+  auto left = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[3, 1]"), ArrayFromJSON(int32(), "[4, 2, 1]")});
+  auto right = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1]"), ArrayFromJSON(int32(), "[2, 3]"),
+                  ArrayFromJSON(int32(), "[1]")});
+
+  AssertJoin({left}, {right}, HashJoinOptions::INNER, "[0, 1, 1, 3, 4, 4]",
+             "[2, 0, 3, 1, 0, 3]");
+}
+
+TEST_F(TestHashJoinIndices, SlicedInputs) {
+  auto left = ArrayFromJSON(utf8(), R"(["xx", "a", "bb", null, "a", "ccc"])")->Slice(1);
+  auto right = ArrayFromJSON(utf8(), R"(["ccc", "zz", "a", "ccc"])")->Slice(1, 2);
+  AssertJoin({left}, {right}, HashJoinOptions::INNER, "[0, 3]", "[1, 1]");
+
+  auto type = fixed_size_binary(2);
+  left = ArrayFromJSON(type, R"(["aa", "bb", null, "cc"])")->Slice(1);
+  right = ArrayFromJSON(type, R"(["bb", "cc", "aa"])")->Slice(1);
+  AssertJoin({left}, {right}, HashJoinOptions::INNER, "[2]", "[0]");
+}
+
+TEST_F(TestHashJoinIndices, EmptyInputs) {
+  auto empty = ArrayFromJSON(int32(), "[]");
+  auto keys = ArrayFromJSON(int32(), "[1, null]");
+
+  AssertJoin({empty}, {keys}, HashJoinOptions::INNER, "[]", "[]");
+  AssertJoin({keys}, {empty}, HashJoinOptions::LEFT_OUTER, "[0, 1]", "[null, null]");
+  AssertJoin({keys}, {empty}, HashJoinOptions::LEFT_ANTI, "[0, 1]");
+}
+
+TEST_F(TestHashJoinIndices, MaterializeWithTake) {
+  auto left_keys = ArrayFromJSON(int32(), "[10, 20, 30]");
+  auto right_keys = ArrayFromJSON(int32(), "[30, 10]");
+  auto right_values = ArrayFromJSON(utf8(), R"(["thirty", "ten"])");
+
+  std::shared_ptr<Array> left_indices, right_indices, left_out, right_out;
+  ASSERT_OK(HashJoinIndices(&this->ctx_, {left_keys}, {right_keys},
+                            HashJoinOptions(HashJoinOptions::LEFT_OUTER), &left_indices,
+                            &right_indices));
+  ASSERT_OK(Take(&this->ctx_, *left_keys, *left_indices, TakeOptions(), &left_out));
+  ASSERT_OK(Take(&this->ctx_, *right_values, *right_indices, TakeOptions(), &right_out));
+  AssertArraysEqual(*left_keys, *left_out);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["ten", null, "thirty"])"), *right_out);
+}
+
+TEST_F(TestHashJoinIndices, ParallelMatchesSerial) {
+  // Large enough to build several partitions and probe several slices in
+  // parallel, even on a small machine
+  auto pool = internal::GetCpuThreadPool();
+  const int capacity = pool->GetCapacity();
+  ASSERT_OK(pool->SetCapacity(4));
+
+  const int64_t length = 1 << 18;
+  Int64Builder left_builder, right_builder;
+  StringBuilder right_string_builder, left_string_builder;
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_OK(left_builder.Append((i * 7919) % 5003));
+    ASSERT_OK(left_string_builder.Append(std::to_string(i % 7)));
+    if (i % 13 == 0) {
+      ASSERT_OK(right_builder.AppendNull());
+    } else {
+      ASSERT_OK(right_builder.Append((i * 104729) % 10007));
+    }
+    ASSERT_OK(right_string_builder.Append(std::to_string(i % 5)));
+  }
+  std::shared_ptr<Array> left0, left1, right0, right1;
+  ASSERT_OK(left_builder.Finish(&left0));
+  ASSERT_OK(left_string_builder.Finish(&left1));
+  ASSERT_OK(right_builder.Finish(&right0));
+  ASSERT_OK(right_string_builder.Finish(&right1));
+
+  for (auto join_type : {HashJoinOptions::INNER, HashJoinOptions::LEFT_OUTER,
+                         HashJoinOptions::LEFT_SEMI, HashJoinOptions::LEFT_ANTI}) {
+    SCOPED_TRACE(join_type);
+    HashJoinOptions options(join_type);
+    options.use_threads = false;
+    std::shared_ptr<Array> serial_left, serial_right, parallel_left, parallel_right;
+    ASSERT_OK(HashJoinIndices(&this->ctx_, {left0, left1}, {right0, right1}, options,
+                              &serial_left, &serial_right));
+    options.use_threads = true;
+    ASSERT_OK(HashJoinIndices(&this->ctx_, {left0, left1}, {right0, right1}, options,
+                              &parallel_left, &parallel_right));
+    ASSERT_GT(serial_left->length(), 0);
+    AssertArraysEqual(*serial_left, *parallel_left);
+    if (serial_right != nullptr) {
+      AssertArraysEqual(*serial_right, *parallel_right);
+    }
+  }
+
+  ASSERT_OK(pool->SetCapacity(capacity));
+}
+
+TEST_F(TestHashJoinIndices, Errors) {
+  auto int_keys = ArrayFromJSON(int32(), "[1, 2, 3]");
+  auto string_keys = ArrayFromJSON(utf8(), R"(["a", "b", "c"])");
+  std::shared_ptr<Array> left_indices, right_indices;
+
+  ASSERT_RAISES(Invalid, HashJoinIndices(&this->ctx_, {}, {}, HashJoinOptions(),
+                                         &left_indices, &right_indices));
+  ASSERT_RAISES(Invalid, HashJoinIndices(&this->ctx_, {int_keys}, {int_keys, int_keys},
+                                         HashJoinOptions(), &left_indices,
+                                         &right_indices));
+  ASSERT_RAISES(Invalid, HashJoinIndices(&this->ctx_, {int_keys, string_keys},
+                                         {int_keys, ArrayFromJSON(utf8(), "[]")},
+                                         HashJoinOptions(), &left_indices,
+                                         &right_indices));
+  ASSERT_RAISES(TypeError, HashJoinIndices(&this->ctx_, {int_keys}, {string_keys},
+                                           HashJoinOptions(), &left_indices,
+                                           &right_indices));
+  auto list_keys = ArrayFromJSON(list(int32()), "[[1], [2]]");
+  ASSERT_RAISES(NotImplemented, HashJoinIndices(&this->ctx_, {list_keys}, {list_keys},
+                                                HashJoinOptions(), &left_indices,
+                                                &right_indices));
+}
+
+}  // namespace compute
+}  // namespace arrow
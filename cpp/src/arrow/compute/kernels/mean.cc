@@ -19,6 +19,7 @@
 
 #include <algorithm>
 
+#include "arrow/compute/kernels/decimal.h"
 #include "arrow/compute/kernels/sum_internal.h"
 
 namespace arrow {
@@ -76,6 +77,8 @@ std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& typ
     MEAN_AGG_FN_CASE(Int64Type);
     MEAN_AGG_FN_CASE(FloatType);
     MEAN_AGG_FN_CASE(DoubleType);
+    case Type::DECIMAL:
+      return MakeDecimalMeanAggregateFunction(type, ctx);
     default:
       return nullptr;
   }
@@ -99,7 +102,8 @@ Status Mean(FunctionContext* ctx, const Datum& value, Datum* out) {
   auto data_type = value.type();
   if (data_type == nullptr)
     return Status::Invalid("Datum must be array-like");
-  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()))
+  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()) &&
+           data_type->id() != Type::DECIMAL)
     return Status::Invalid("Datum must contain a NumericType");
 
   RETURN_NOT_OK(GetMeanKernel(ctx, *data_type, kernel));
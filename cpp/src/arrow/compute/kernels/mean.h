@@ -42,6 +42,9 @@ std::shared_ptr<AggregateFunction> MakeMeanAggregateFunction(const DataType& typ
 
 /// \brief Compute the mean of a numeric array.
 ///
+/// The mean of a decimal array is a Decimal128Scalar of its type, rounded half
+/// away from zero.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value datum to compute the mean, expecting Array
 /// \param[out] mean datum of the computed mean as a DoubleScalar
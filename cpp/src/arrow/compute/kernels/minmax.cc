@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/minmax.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/min_max.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::DenseMinMax;
+using internal::MaxOf;
+using internal::MinMaxIdentity;
+using internal::MinOf;
+using internal::SpacedMinMax;
+
+namespace compute {
+
+template <typename ArrowType>
+struct MinMaxState {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  MinMaxState& operator+=(const MinMaxState& rhs) {
+    this->has_values |= rhs.has_values;
+    this->min = MinOf(rhs.min, this->min);
+    this->max = MaxOf(rhs.max, this->max);
+    return *this;
+  }
+
+  CType min = MinMaxIdentity<CType>::min();
+  CType max = MinMaxIdentity<CType>::max();
+  bool has_values = false;
+};
+
+template <typename ArrowType>
+class MinMaxAggregateFunction final
+    : public AggregateFunctionStaticState<MinMaxState<ArrowType>> {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using StateType = MinMaxState<ArrowType>;
+
+ public:
+  Status Consume(const Array& input, StateType* state) const override {
+    const auto& array = checked_cast<const ArrayType&>(input);
+
+    *state = StateType();
+    const int64_t length = array.length();
+    const int64_t null_count = array.null_count();
+    if (null_count == length) {
+      return Status::OK();
+    }
+    state->has_values = true;
+    if (null_count == 0) {
+      DenseMinMax(array.raw_values(), length, &state->min, &state->max);
+    } else {
+      SpacedMinMax(array.raw_values(), length, array.null_bitmap_data(), array.offset(),
+                   &state->min, &state->max);
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const StateType& src, StateType* dst) const override {
+    *dst += src;
+    return Status::OK();
+  }
+
+  Status Finalize(const StateType& src, Datum* output) const override {
+    CType min = src.min;
+    CType max = src.max;
+    if (!src.has_values) {
+      min = max = 0;
+    } else if (std::is_floating_point<CType>::value && min > max) {
+      // Only NaN values were seen
+      min = max = std::numeric_limits<CType>::quiet_NaN();
+    }
+    std::vector<Datum> extrema = {
+        Datum(std::make_shared<ScalarType>(min, src.has_values)),
+        Datum(std::make_shared<ScalarType>(max, src.has_values))};
+    *output = std::move(extrema);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+};
+
+#define MINMAX_AGG_FN_CASE(T)                           \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<MinMaxAggregateFunction<T>>());
+
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(const DataType& type,
+                                                               FunctionContext* ctx) {
+  switch (type.id()) {
+    MINMAX_AGG_FN_CASE(UInt8Type);
+    MINMAX_AGG_FN_CASE(Int8Type);
+    MINMAX_AGG_FN_CASE(UInt16Type);
+    MINMAX_AGG_FN_CASE(Int16Type);
+    MINMAX_AGG_FN_CASE(UInt32Type);
+    MINMAX_AGG_FN_CASE(Int32Type);
+    MINMAX_AGG_FN_CASE(UInt64Type);
+    MINMAX_AGG_FN_CASE(Int64Type);
+    MINMAX_AGG_FN_CASE(FloatType);
+    MINMAX_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef MINMAX_AGG_FN_CASE
+}
+
+Status MinMax(FunctionContext* ctx, const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeMinMaxAggregateFunction(*data_type, ctx);
+  if (!aggregate) {
+    return Status::Invalid("No min/max for type ", *data_type);
+  }
+  AggregateUnaryKernel kernel(aggregate);
+  return kernel.Call(ctx, value, out);
+}
+
+Status MinMax(FunctionContext* ctx, const Array& array, Datum* out) {
+  return MinMax(ctx, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,328 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/partition.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// Hash the key values of each row into hashes, combining them with the
+// hashes of the previous key columns.  Null-free columns are hashed in
+// loops without any per-value branch.
+struct KeyHasher {
+  static constexpr uint64_t kNullHash = 0x9E3779B97F4A7C15ULL;
+
+  const ArrayData& data;
+  uint64_t* hashes;
+
+  static uint64_t Combine(uint64_t seed, uint64_t hash) {
+    return (seed ^ hash) * 0xff51afd7ed558ccdULL;
+  }
+
+  // Combine hash_of(i) for the valid rows and kNullHash for the null ones
+  template <typename HashFunc>
+  void CombineAll(HashFunc&& hash_of) {
+    if (data.GetNullCount() == 0) {
+      for (int64_t i = 0; i < data.length; ++i) {
+        hashes[i] = Combine(hashes[i], hash_of(i));
+      }
+      return;
+    }
+    internal::BitmapReader valid(data.buffers[0]->data(), data.offset, data.length);
+    for (int64_t i = 0; i < data.length; ++i) {
+      hashes[i] = Combine(hashes[i], valid.IsSet() ? hash_of(i) : kNullHash);
+      valid.Next();
+    }
+  }
+
+  template <typename Type>
+  enable_if_has_c_type<Type, Status> Visit(const Type&) {
+    using c_type = typename Type::c_type;
+    const c_type* values = data.GetValues<c_type>(1);
+    // The hash of the memo tables, which treats equal floating-point
+    // values alike
+    CombineAll([&](int64_t i) {
+      return internal::ScalarHelper<c_type, 0>::ComputeHash(values[i]);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const uint8_t* values = data.buffers[1]->data();
+    CombineAll([&](int64_t i) -> uint64_t {
+      return BitUtil::GetBit(values, data.offset + i) ? 1 : 2;
+    });
+    return Status::OK();
+  }
+
+  template <typename Type>
+  enable_if_base_binary<Type, Status> Visit(const Type&) {
+    using offset_type = typename Type::offset_type;
+    const offset_type* offsets = data.GetValues<offset_type>(1);
+    const uint8_t* values = data.buffers[2] ? data.buffers[2]->data() : NULLPTR;
+    CombineAll([&](int64_t i) {
+      return HashBytes(values + offsets[i], offsets[i + 1] - offsets[i]);
+    });
+    return Status::OK();
+  }
+
+  Status Visit(const FixedSizeBinaryType& type) {
+    const int32_t width = type.byte_width();
+    const uint8_t* values = data.GetValues<uint8_t>(1, data.offset * width);
+    CombineAll([&](int64_t i) { return HashBytes(values + i * width, width); });
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Hash partitioning on keys of type ", type.ToString());
+  }
+
+  static uint64_t HashBytes(const uint8_t* data, int64_t length) {
+    return internal::ComputeStringHash<0>(data, length);
+  }
+};
+
+// Scale the high bits of the hash to [0, num_partitions), which avoids a
+// division per row
+int PartitionOf(uint64_t hash, uint64_t num_partitions) {
+  return static_cast<int>(((hash >> 32) * num_partitions) >> 32);
+}
+
+// First pass: the partition of each row, and the offsets of the partitions
+// in the output
+Status ComputePartitions(const RecordBatch& batch, const std::vector<int>& keys,
+                         int num_partitions, std::vector<int32_t>* partitions,
+                         std::vector<int64_t>* offsets) {
+  if (num_partitions < 1) {
+    return Status::Invalid("HashPartition needs at least one partition, got ",
+                           num_partitions);
+  }
+  if (keys.empty()) {
+    return Status::Invalid("HashPartition needs at least one key");
+  }
+  const int64_t length = batch.num_rows();
+  std::vector<uint64_t> hashes(length, 0);
+  for (int key : keys) {
+    if (key < 0 || key >= batch.num_columns()) {
+      return Status::IndexError("HashPartition key ", key, " out of bounds for ",
+                                batch.num_columns(), " columns");
+    }
+    const ArrayData& data = *batch.column_data(key);
+    KeyHasher hasher{data, hashes.data()};
+    RETURN_NOT_OK(VisitTypeInline(*data.type, &hasher));
+  }
+
+  partitions->resize(length);
+  offsets->assign(num_partitions + 1, 0);
+  int32_t* out = partitions->data();
+  int64_t* counts = offsets->data() + 1;
+  for (int64_t i = 0; i < length; ++i) {
+    const int partition = PartitionOf(hashes[i], num_partitions);
+    out[i] = partition;
+    ++counts[partition];
+  }
+  for (int p = 0; p < num_partitions; ++p) {
+    counts[p] += (*offsets)[p];
+  }
+  return Status::OK();
+}
+
+// The byte width of the values of columns laid out as a validity bitmap and
+// a buffer of 1, 2, 4 or 8-byte values, 0 for other columns
+int ScatterByteWidth(const DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+    case Type::DICTIONARY:
+    case Type::EXTENSION:
+      return 0;
+    default:
+      break;
+  }
+  const auto fixed_width = dynamic_cast<const FixedWidthType*>(&type);
+  if (fixed_width == NULLPTR) {
+    return 0;
+  }
+  const int bit_width = fixed_width->bit_width();
+  if (bit_width == 8 || bit_width == 16 || bit_width == 32 || bit_width == 64) {
+    return bit_width / 8;
+  }
+  return 0;
+}
+
+template <typename CType>
+void ScatterValues(const ArrayData& data, const int32_t* partitions,
+                   std::vector<int64_t> cursors, uint8_t* out) {
+  const CType* values = data.GetValues<CType>(1);
+  CType* out_values = reinterpret_cast<CType*>(out);
+  for (int64_t i = 0; i < data.length; ++i) {
+    out_values[cursors[partitions[i]]++] = values[i];
+  }
+}
+
+// Second pass for a fixed-width column: write each value at the cursor of
+// its partition in a single output buffer, and slice it into partitions
+Status ScatterColumn(FunctionContext* ctx, const ArrayData& data, int byte_width,
+                     const std::vector<int32_t>& partitions,
+                     const std::vector<int64_t>& offsets,
+                     std::vector<std::shared_ptr<ArrayData>>* out) {
+  const int num_partitions = static_cast<int>(offsets.size()) - 1;
+  const int64_t length = data.length;
+
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * byte_width, &values));
+  switch (byte_width) {
+    case 1:
+      ScatterValues<uint8_t>(data, partitions.data(), offsets, values->mutable_data());
+      break;
+    case 2:
+      ScatterValues<uint16_t>(data, partitions.data(), offsets, values->mutable_data());
+      break;
+    case 4:
+      ScatterValues<uint32_t>(data, partitions.data(), offsets, values->mutable_data());
+      break;
+    default:
+      DCHECK_EQ(byte_width, 8);
+      ScatterValues<uint64_t>(data, partitions.data(), offsets, values->mutable_data());
+      break;
+  }
+
+  std::shared_ptr<Buffer> validity;
+  std::vector<int64_t> null_counts(num_partitions, 0);
+  if (data.GetNullCount() > 0) {
+    RETURN_NOT_OK(AllocateBitmap(ctx->memory_pool(), length, &validity));
+    uint8_t* out_bits = validity->mutable_data();
+    std::memset(out_bits, 0xff, validity->size());
+    std::vector<int64_t> cursors = offsets;
+    internal::BitmapReader valid(data.buffers[0]->data(), data.offset, length);
+    for (int64_t i = 0; i < length; ++i) {
+      const int32_t partition = partitions[i];
+      const int64_t position = cursors[partition]++;
+      if (valid.IsNotSet()) {
+        BitUtil::ClearBit(out_bits, position);
+        ++null_counts[partition];
+      }
+      valid.Next();
+    }
+  }
+
+  out->resize(num_partitions);
+  for (int p = 0; p < num_partitions; ++p) {
+    const int64_t partition_length = offsets[p + 1] - offsets[p];
+    (*out)[p] = ArrayData::Make(data.type, partition_length,
+                                {null_counts[p] > 0 ? validity : NULLPTR, values},
+                                null_counts[p], offsets[p]);
+  }
+  return Status::OK();
+}
+
+Status MakeIndices(FunctionContext* ctx, const std::vector<int32_t>& partitions,
+                   const std::vector<int64_t>& offsets, std::shared_ptr<Array>* out) {
+  const int64_t length = static_cast<int64_t>(partitions.size());
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(int64_t), &data));
+  auto indices = reinterpret_cast<int64_t*>(data->mutable_data());
+  std::vector<int64_t> cursors = offsets;
+  for (int64_t i = 0; i < length; ++i) {
+    indices[cursors[partitions[i]]++] = i;
+  }
+  *out = std::make_shared<Int64Array>(length, data);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status HashPartitionIndices(FunctionContext* ctx, const RecordBatch& batch,
+                            const std::vector<int>& keys, int num_partitions,
+                            std::shared_ptr<Array>* indices,
+                            std::vector<int64_t>* offsets) {
+  std::vector<int32_t> partitions;
+  RETURN_NOT_OK(ComputePartitions(batch, keys, num_partitions, &partitions, offsets));
+  return MakeIndices(ctx, partitions, *offsets, indices);
+}
+
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<int>& keys, int num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out) {
+  std::vector<int32_t> partitions;
+  std::vector<int64_t> offsets;
+  RETURN_NOT_OK(ComputePartitions(batch, keys, num_partitions, &partitions, &offsets));
+
+  const int num_columns = batch.num_columns();
+  // columns[p][i] is column i of partition p
+  std::vector<std::vector<std::shared_ptr<ArrayData>>> columns(
+      num_partitions, std::vector<std::shared_ptr<ArrayData>>(num_columns));
+  // Only computed if some column needs to be gathered
+  std::shared_ptr<Array> indices;
+  for (int i = 0; i < num_columns; ++i) {
+    const ArrayData& data = *batch.column_data(i);
+    const int byte_width = ScatterByteWidth(*data.type);
+    if (byte_width > 0) {
+      std::vector<std::shared_ptr<ArrayData>> scattered;
+      RETURN_NOT_OK(
+          ScatterColumn(ctx, data, byte_width, partitions, offsets, &scattered));
+      for (int p = 0; p < num_partitions; ++p) {
+        columns[p][i] = std::move(scattered[p]);
+      }
+      continue;
+    }
+    if (indices == nullptr) {
+      RETURN_NOT_OK(MakeIndices(ctx, partitions, offsets, &indices));
+    }
+    const auto column = batch.column(i);
+    for (int p = 0; p < num_partitions; ++p) {
+      std::shared_ptr<Array> taken;
+      RETURN_NOT_OK(Take(ctx, *column,
+                         *indices->Slice(offsets[p], offsets[p + 1] - offsets[p]),
+                         TakeOptions(), &taken));
+      columns[p][i] = taken->data();
+    }
+  }
+
+  out->resize(num_partitions);
+  for (int p = 0; p < num_partitions; ++p) {
+    (*out)[p] = RecordBatch::Make(batch.schema(), offsets[p + 1] - offsets[p],
+                                  std::move(columns[p]));
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Compute the partition of each row by hashing its key values, and
+/// the row indices grouped by partition.
+///
+/// The partition of a row only depends on its key values and on
+/// `num_partitions`, so that equal keys land in the same partition across
+/// batches and processes.  All null keys hash alike.
+///
+/// Within a partition, row indices are in increasing order.  The indices of
+/// partition `i` are `indices[offsets[i]:offsets[i + 1]]`.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] batch the rows to partition
+/// \param[in] keys the indices of the key columns in the batch
+/// \param[in] num_partitions the number of partitions, at least 1
+/// \param[out] indices an Int64Array of the row indices, grouped by partition
+/// \param[out] offsets the `num_partitions + 1` offsets of the partitions in
+/// `indices`
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashPartitionIndices(FunctionContext* context, const RecordBatch& batch,
+                            const std::vector<int>& keys, int num_partitions,
+                            std::shared_ptr<Array>* indices,
+                            std::vector<int64_t>* offsets);
+
+/// \brief Split the rows of a batch into partitions by hashing their key
+/// values.
+///
+/// Rows are partitioned as by HashPartitionIndices().  Each output batch has
+/// the schema of the input and holds the rows of its partition in input
+/// order; it may be empty.
+///
+/// Fixed-width columns are scattered into all partitions in a single pass
+/// over the input, and the partitions are slices of a single output buffer.
+/// The other columns are gathered from the row indices of each partition.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] batch the rows to partition
+/// \param[in] keys the indices of the key columns in the batch
+/// \param[in] num_partitions the number of partitions, at least 1
+/// \param[out] out the `num_partitions` output batches
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashPartition(FunctionContext* context, const RecordBatch& batch,
+                     const std::vector<int>& keys, int num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/compute/kernels/partition.h"
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+// Partition a batch of an int64 key and a double value column in 64
+static void HashPartitionInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t num_rows = args.size / (2 * sizeof(int64_t));
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto keys = rand.Int64(num_rows, 0, 1 << 20, args.null_proportion);
+  auto values = rand.Float64(num_rows, -100, 100, args.null_proportion);
+  auto batch = RecordBatch::Make(
+      schema({field("key", int64()), field("value", float64())}), num_rows,
+      {keys, values});
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::vector<std::shared_ptr<RecordBatch>> out;
+    ABORT_NOT_OK(HashPartition(&ctx, *batch, {0}, 64, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+BENCHMARK(HashPartitionInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+}  // namespace compute
+}  // namespace arrow
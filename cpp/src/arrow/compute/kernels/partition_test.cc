@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestHashPartition : public ComputeFixture, public ::testing::Test {
+ protected:
+  // Partition the batch both ways and check that the partitions hold the
+  // rows of their indices, in input order, and that equal keys share a
+  // partition
+  void CheckPartition(const RecordBatch& batch, const std::vector<int>& keys,
+                      int num_partitions) {
+    std::shared_ptr<Array> indices;
+    std::vector<int64_t> offsets;
+    ASSERT_OK(HashPartitionIndices(&this->ctx_, batch, keys, num_partitions, &indices,
+                                   &offsets));
+    ASSERT_OK(indices->Validate());
+    ASSERT_EQ(static_cast<size_t>(num_partitions + 1), offsets.size());
+    ASSERT_EQ(0, offsets.front());
+    ASSERT_EQ(batch.num_rows(), offsets.back());
+    ASSERT_EQ(batch.num_rows(), indices->length());
+
+    std::vector<std::shared_ptr<RecordBatch>> partitions;
+    ASSERT_OK(HashPartition(&this->ctx_, batch, keys, num_partitions, &partitions));
+    ASSERT_EQ(static_cast<size_t>(num_partitions), partitions.size());
+
+    std::vector<int> row_partitions(batch.num_rows());
+    const auto& raw_indices = internal::checked_cast<const Int64Array&>(*indices);
+    for (int p = 0; p < num_partitions; ++p) {
+      const auto& partition = *partitions[p];
+      ASSERT_OK(partition.Validate());
+      ASSERT_TRUE(partition.schema()->Equals(*batch.schema()));
+      ASSERT_EQ(offsets[p + 1] - offsets[p], partition.num_rows());
+
+      auto partition_indices = indices->Slice(offsets[p], partition.num_rows());
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        std::shared_ptr<Array> expected;
+        ASSERT_OK(Take(&this->ctx_, *batch.column(i), *partition_indices, TakeOptions(),
+                       &expected));
+        AssertArraysEqual(*expected, *partition.column(i));
+      }
+      for (int64_t j = offsets[p]; j < offsets[p + 1]; ++j) {
+        if (j > offsets[p]) {
+          ASSERT_LT(raw_indices.Value(j - 1), raw_indices.Value(j));
+        }
+        row_partitions[raw_indices.Value(j)] = p;
+      }
+    }
+
+    for (int64_t i = 0; i < batch.num_rows(); ++i) {
+      for (int64_t j = i + 1; j < batch.num_rows(); ++j) {
+        bool equal_keys = true;
+        for (int k : keys) {
+          const auto& column = batch.column(k);
+          equal_keys = equal_keys && column->RangeEquals(i, i + 1, j, column);
+        }
+        if (equal_keys) {
+          ASSERT_EQ(row_partitions[i], row_partitions[j]) << "rows " << i << ", " << j;
+        }
+      }
+    }
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::shared_ptr<Schema>& schema,
+                                         const std::vector<std::string>& json) {
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      columns.push_back(ArrayFromJSON(schema->field(i)->type(), json[i]));
+    }
+    return RecordBatch::Make(schema, columns[0]->length(), columns);
+  }
+};
+
+TEST_F(TestHashPartition, Basics) {
+  auto schema = ::arrow::schema(
+      {field("k", int64()), field("s", utf8()), field("d", float64())});
+  auto batch = MakeBatch(schema, {"[1, 2, null, 1, 3, 2, null, 4]",
+                                   R"(["a", "b", "c", null, "e", "b", "g", "h"])",
+                                   "[1.5, null, 2.5, 3.5, 4.5, 5.5, 6.5, null]"});
+  for (int num_partitions : {1, 2, 3, 7, 64}) {
+    CheckPartition(*batch, {0}, num_partitions);
+    CheckPartition(*batch, {1}, num_partitions);
+    CheckPartition(*batch, {2, 0}, num_partitions);
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> partitions;
+  ASSERT_OK(HashPartition(&this->ctx_, *batch, {0}, 1, &partitions));
+  ASSERT_EQ(1U, partitions.size());
+  ASSERT_BATCHES_EQUAL(*batch, *partitions[0]);
+}
+
+TEST_F(TestHashPartition, KeyTypes) {
+  auto schema = ::arrow::schema({field("b", boolean()), field("u8", uint8()),
+                                 field("f", fixed_size_binary(3)),
+                                 field("ts", timestamp(TimeUnit::MILLI)),
+                                 field("dec", decimal(5, 2))});
+  auto batch = MakeBatch(schema, {"[true, false, null, true, false]",
+                                   "[1, 2, null, 1, 3]",
+                                   R"(["abc", "def", null, "abc", "ghi"])",
+                                   "[1, 2, null, 1, 3]",
+                                   R"(["1.00", "2.00", null, "1.00", "-3.00"])"});
+  for (int key = 0; key < batch->num_columns(); ++key) {
+    CheckPartition(*batch, {key}, 4);
+  }
+  CheckPartition(*batch, {0, 1, 2, 3, 4}, 3);
+}
+
+TEST_F(TestHashPartition, SlicedInput) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  const int64_t length = 300;
+  auto keys = rand.Int32(length, 0, 50, /*null_probability=*/0.1);
+  auto values = rand.Int16(length, -100, 100, /*null_probability=*/0.3);
+  auto strings = rand.String(length, 0, 5, /*null_probability=*/0.2);
+  auto schema = ::arrow::schema(
+      {field("k", keys->type()), field("v", values->type()), field("s", utf8())});
+  auto batch = RecordBatch::Make(schema, length, {keys, values, strings});
+  CheckPartition(*batch, {0}, 16);
+  CheckPartition(*batch->Slice(13, 200), {0}, 5);
+  CheckPartition(*batch->Slice(7, 0), {0}, 5);
+}
+
+TEST_F(TestHashPartition, Errors) {
+  auto schema = ::arrow::schema({field("k", int32()), field("l", list(int32()))});
+  auto batch = MakeBatch(schema, {"[1, 2]", "[[1], null]"});
+  std::vector<std::shared_ptr<RecordBatch>> partitions;
+  ASSERT_RAISES(Invalid, HashPartition(&this->ctx_, *batch, {0}, 0, &partitions));
+  ASSERT_RAISES(Invalid, HashPartition(&this->ctx_, *batch, {}, 2, &partitions));
+  ASSERT_RAISES(IndexError, HashPartition(&this->ctx_, *batch, {2}, 2, &partitions));
+  ASSERT_RAISES(NotImplemented, HashPartition(&this->ctx_, *batch, {1}, 2, &partitions));
+  // Non-key columns of any type are partitioned
+  CheckPartition(*batch, {0}, 2);
+}
+
+}  // namespace compute
+}  // namespace arrow
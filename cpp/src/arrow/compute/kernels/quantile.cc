@@ -0,0 +1,312 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/kernels/quantile.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+constexpr double kPi = 3.14159265358979323846;
+
+// The number of values buffered per unit of delta before they are merged
+// into the centroids
+constexpr size_t kBufferFactor = 8;
+
+struct Centroid {
+  double mean;
+  double weight;
+};
+
+inline bool CentroidLess(const Centroid& left, const Centroid& right) {
+  return left.mean < right.mean;
+}
+
+// The k1 scale function of the t-digest and its inverse, which bound the
+// weight of a centroid by the quantiles it spans
+inline double ScaleK(double q, double delta) {
+  return delta / (2 * kPi) * std::asin(2 * q - 1);
+}
+
+inline double ScaleKInverse(double k, double delta) {
+  if (k >= delta / 4) {
+    return 1;
+  }
+  return (std::sin(k * (2 * kPi) / delta) + 1) / 2;
+}
+
+}  // namespace
+
+struct TDigestState {
+  void Add(double value, uint32_t delta) {
+    if (std::isnan(value)) {
+      return;
+    }
+    buffer.push_back(value);
+    this->min = std::min(this->min, value);
+    this->max = std::max(this->max, value);
+    ++count;
+    if (buffer.size() >= kBufferFactor * delta) {
+      Flush(delta);
+    }
+  }
+
+  // Merge the buffered values into the centroids
+  void Flush(uint32_t delta) {
+    if (buffer.empty()) {
+      return;
+    }
+    std::vector<Centroid> incoming;
+    incoming.reserve(buffer.size());
+    for (double value : buffer) {
+      incoming.push_back({value, 1});
+    }
+    buffer.clear();
+    Compress(std::move(incoming), delta);
+  }
+
+  void MergeFrom(const TDigestState& other, uint32_t delta) {
+    if (other.count == 0) {
+      return;
+    }
+    std::vector<Centroid> incoming(other.centroids);
+    for (double value : other.buffer) {
+      incoming.push_back({value, 1});
+    }
+    for (double value : buffer) {
+      incoming.push_back({value, 1});
+    }
+    buffer.clear();
+    Compress(std::move(incoming), delta);
+    this->min = std::min(this->min, other.min);
+    this->max = std::max(this->max, other.max);
+    count += other.count;
+  }
+
+  // The approximate quantile q of a flushed, non-empty digest, interpolated
+  // between the centers of the centroids and the exact extrema
+  double Quantile(double q) const {
+    const double target = q * static_cast<double>(count);
+    if (target <= 0) {
+      return this->min;
+    }
+    if (target >= static_cast<double>(count)) {
+      return this->max;
+    }
+
+    const Centroid& first = centroids.front();
+    if (target < first.weight / 2) {
+      return this->min + (first.mean - this->min) * target / (first.weight / 2);
+    }
+    double preceding_weight = 0;
+    for (size_t i = 0; i + 1 < centroids.size(); ++i) {
+      const Centroid& left = centroids[i];
+      const Centroid& right = centroids[i + 1];
+      const double left_center = preceding_weight + left.weight / 2;
+      const double right_center = preceding_weight + left.weight + right.weight / 2;
+      if (target < right_center) {
+        const double fraction = (target - left_center) / (right_center - left_center);
+        return left.mean + fraction * (right.mean - left.mean);
+      }
+      preceding_weight += left.weight;
+    }
+    const Centroid& last = centroids.back();
+    const double last_center = static_cast<double>(count) - last.weight / 2;
+    return last.mean +
+           (this->max - last.mean) * (target - last_center) / (last.weight / 2);
+  }
+
+  // Sorted by mean
+  std::vector<Centroid> centroids;
+  std::vector<double> buffer;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+  int64_t count = 0;
+
+ private:
+  // Merge centroids into the digest, in one pass over all of them sorted by
+  // mean: a centroid absorbs the next one as long as the quantiles they span
+  // together stay within one unit of the scale function
+  void Compress(std::vector<Centroid> incoming, uint32_t delta) {
+    std::sort(incoming.begin(), incoming.end(), CentroidLess);
+    std::vector<Centroid> all;
+    all.reserve(centroids.size() + incoming.size());
+    std::merge(centroids.begin(), centroids.end(), incoming.begin(), incoming.end(),
+               std::back_inserter(all), CentroidLess);
+
+    double total_weight = 0;
+    for (const Centroid& centroid : all) {
+      total_weight += centroid.weight;
+    }
+
+    centroids.clear();
+    Centroid current = all.front();
+    double preceding_weight = 0;
+    double weight_limit = total_weight * ScaleKInverse(ScaleK(0, delta) + 1, delta);
+    for (size_t i = 1; i < all.size(); ++i) {
+      const Centroid& next = all[i];
+      const double merged_weight = current.weight + next.weight;
+      if (preceding_weight + merged_weight <= weight_limit) {
+        current.mean += (next.mean - current.mean) * next.weight / merged_weight;
+        current.weight = merged_weight;
+      } else {
+        preceding_weight += current.weight;
+        centroids.push_back(current);
+        weight_limit =
+            total_weight *
+            ScaleKInverse(ScaleK(preceding_weight / total_weight, delta) + 1, delta);
+        current = next;
+      }
+    }
+    centroids.push_back(current);
+  }
+};
+
+template <typename ArrowType>
+class QuantileAggregateFunction final
+    : public AggregateFunctionStaticState<TDigestState> {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  QuantileAggregateFunction(const QuantileOptions& options, MemoryPool* pool)
+      : options_(options), pool_(pool) {}
+
+  Status Consume(const Array& input, TDigestState* state) const override {
+    const auto& array = checked_cast<const ArrayType&>(input);
+
+    *state = TDigestState();
+    const int64_t length = array.length();
+    const CType* values = array.raw_values();
+    if (array.null_count() == 0) {
+      for (int64_t i = 0; i < length; ++i) {
+        state->Add(static_cast<double>(values[i]), options_.delta);
+      }
+    } else {
+      internal::BitmapReader reader(array.null_bitmap_data(), array.offset(), length);
+      for (int64_t i = 0; i < length; ++i) {
+        if (reader.IsSet()) {
+          state->Add(static_cast<double>(values[i]), options_.delta);
+        }
+        reader.Next();
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const TDigestState& src, TDigestState* dst) const override {
+    dst->MergeFrom(src, options_.delta);
+    return Status::OK();
+  }
+
+  Status Finalize(const TDigestState& src, Datum* output) const override {
+    DoubleBuilder builder(pool_);
+    RETURN_NOT_OK(builder.Reserve(options_.q.size()));
+    if (src.count == 0) {
+      RETURN_NOT_OK(builder.AppendNulls(options_.q.size()));
+    } else {
+      TDigestState digest = src;
+      digest.Flush(options_.delta);
+      for (double q : options_.q) {
+        builder.UnsafeAppend(digest.Quantile(q));
+      }
+    }
+    std::shared_ptr<Array> quantiles;
+    RETURN_NOT_OK(builder.Finish(&quantiles));
+    *output = quantiles;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  QuantileOptions options_;
+  MemoryPool* pool_;
+};
+
+#define QUANTILE_AGG_FN_CASE(T)                         \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<QuantileAggregateFunction<T>>(options, ctx->memory_pool()));
+
+std::shared_ptr<AggregateFunction> MakeQuantileAggregateFunction(
+    const DataType& type, const QuantileOptions& options, FunctionContext* ctx) {
+  switch (type.id()) {
+    QUANTILE_AGG_FN_CASE(UInt8Type);
+    QUANTILE_AGG_FN_CASE(Int8Type);
+    QUANTILE_AGG_FN_CASE(UInt16Type);
+    QUANTILE_AGG_FN_CASE(Int16Type);
+    QUANTILE_AGG_FN_CASE(UInt32Type);
+    QUANTILE_AGG_FN_CASE(Int32Type);
+    QUANTILE_AGG_FN_CASE(UInt64Type);
+    QUANTILE_AGG_FN_CASE(Int64Type);
+    QUANTILE_AGG_FN_CASE(FloatType);
+    QUANTILE_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef QUANTILE_AGG_FN_CASE
+}
+
+Status ApproximateQuantile(FunctionContext* ctx, const QuantileOptions& options,
+                           const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  if (options.delta == 0) {
+    return Status::Invalid("Quantile delta must be positive");
+  }
+  for (double q : options.q) {
+    if (!(q >= 0 && q <= 1)) {
+      return Status::Invalid("Quantile must be between 0 and 1, got ", q);
+    }
+  }
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeQuantileAggregateFunction(*data_type, options, ctx);
+  if (!aggregate) {
+    return Status::Invalid("No quantile for type ", *data_type);
+  }
+  AggregateUnaryKernel kernel(aggregate);
+  return kernel.Call(ctx, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \brief Options for the ApproximateQuantile kernel
+struct ARROW_EXPORT QuantileOptions {
+  explicit QuantileOptions(std::vector<double> q = {0.5}, uint32_t delta = 100)
+      : q(std::move(q)), delta(delta) {}
+
+  /// The quantiles to compute, each between 0 and 1
+  std::vector<double> q;
+  /// The compression of the t-digest: the number of centroids it keeps is of
+  /// the order of delta, larger values trading memory and time for accuracy
+  uint32_t delta;
+};
+
+/// \brief Return an ApproximateQuantile aggregate function for a numeric
+/// type, or null
+///
+/// \param[in] type required to specialize the kernel
+/// \param[in] options the quantiles and the compression of the t-digest
+/// \param[in] context the FunctionContext
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeQuantileAggregateFunction(
+    const DataType& type, const QuantileOptions& options, FunctionContext* context);
+
+/// \brief Compute approximate quantiles of a numeric array
+///
+/// The values are summarized by a merging t-digest (Dunning and Ertl), whose
+/// centroids are smaller near the tails, so that extreme quantiles are more
+/// accurate than the median.  The digests of the chunks, and of the slices
+/// consumed in parallel if the context uses threads, are merged into one.
+/// The minimum and maximum are exact.  NaN values are ignored.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the quantiles and the compression of the t-digest
+/// \param[in] value datum to compute the quantiles of, expecting Array or
+/// ChunkedArray
+/// \param[out] out datum of a double array of the quantiles, in the order of
+/// options.q, all null if there is no non-null value
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproximateQuantile(FunctionContext* context, const QuantileOptions& options,
+                           const Datum& value, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
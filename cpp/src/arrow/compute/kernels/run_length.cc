@@ -0,0 +1,444 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/run_length.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/count.h"
+#include "arrow/compute/kernels/sum_internal.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+namespace {
+
+std::shared_ptr<DataType> RunLengthStorageType(
+    const std::shared_ptr<DataType>& value_type) {
+  return struct_({field("run_ends", int64(), /*nullable=*/false),
+                  field("values", value_type)});
+}
+
+// The logical start of each run is the end of the previous one
+int64_t RunStart(const int64_t* run_ends, int64_t run) {
+  return run == 0 ? 0 : run_ends[run - 1];
+}
+
+}  // namespace
+
+RunLengthEncodedType::RunLengthEncodedType(const std::shared_ptr<DataType>& value_type)
+    : ExtensionType(RunLengthStorageType(value_type)) {}
+
+bool RunLengthEncodedType::ExtensionEquals(const ExtensionType& other) const {
+  return other.extension_name() == extension_name() &&
+         other.storage_type()->Equals(*storage_type());
+}
+
+std::shared_ptr<Array> RunLengthEncodedType::MakeArray(
+    std::shared_ptr<ArrayData> data) const {
+  DCHECK_EQ(data->type->id(), Type::EXTENSION);
+  DCHECK(ExtensionEquals(checked_cast<const ExtensionType&>(*data->type)));
+  return std::make_shared<RunLengthEncodedArray>(data);
+}
+
+Status RunLengthEncodedType::Deserialize(std::shared_ptr<DataType> storage_type,
+                                         const std::string& serialized,
+                                         std::shared_ptr<DataType>* out) const {
+  if (storage_type->id() != Type::STRUCT || storage_type->num_children() != 2 ||
+      storage_type->child(0)->name() != "run_ends" ||
+      storage_type->child(0)->type()->id() != Type::INT64) {
+    return Status::Invalid("Invalid storage type for run-length encoded array: ",
+                           storage_type->ToString());
+  }
+  *out = std::make_shared<RunLengthEncodedType>(storage_type->child(1)->type());
+  return Status::OK();
+}
+
+std::shared_ptr<DataType> RunLengthEncodedType::value_type() const {
+  return storage_type()->child(1)->type();
+}
+
+std::shared_ptr<Int64Array> RunLengthEncodedArray::run_ends() const {
+  return checked_pointer_cast<Int64Array>(
+      checked_cast<const StructArray&>(*storage()).field(0));
+}
+
+std::shared_ptr<Array> RunLengthEncodedArray::values() const {
+  return checked_cast<const StructArray&>(*storage()).field(1);
+}
+
+int64_t RunLengthEncodedArray::logical_length() const {
+  return length() == 0 ? 0 : run_ends()->Value(length() - 1);
+}
+
+std::shared_ptr<DataType> run_length_encoded(
+    const std::shared_ptr<DataType>& value_type) {
+  return std::make_shared<RunLengthEncodedType>(value_type);
+}
+
+bool IsRunLengthEncoded(const DataType& type) {
+  return type.id() == Type::EXTENSION &&
+         checked_cast<const ExtensionType&>(type).extension_name() ==
+             "arrow.run_length_encoded";
+}
+
+Status MakeRunLengthEncodedArray(const std::shared_ptr<Array>& run_ends,
+                                 const std::shared_ptr<Array>& values,
+                                 std::shared_ptr<Array>* out) {
+  if (run_ends->type_id() != Type::INT64 || run_ends->null_count() != 0) {
+    return Status::Invalid("Run ends must be non-null int64 values");
+  }
+  if (run_ends->length() != values->length()) {
+    return Status::Invalid("Expected as many run values as run ends, got ",
+                           values->length(), " and ", run_ends->length());
+  }
+  const int64_t* ends = checked_cast<const Int64Array&>(*run_ends).raw_values();
+  for (int64_t i = 0; i < run_ends->length(); ++i) {
+    if (ends[i] <= RunStart(ends, i)) {
+      return Status::Invalid("Run ends must be strictly increasing and positive");
+    }
+  }
+
+  auto type = run_length_encoded(values->type());
+  auto storage = std::make_shared<StructArray>(
+      checked_cast<const ExtensionType&>(*type).storage_type(), run_ends->length(),
+      std::vector<std::shared_ptr<Array>>{run_ends, values});
+  *out = std::make_shared<RunLengthEncodedArray>(type, storage);
+  return Status::OK();
+}
+
+namespace {
+
+// Append the (exclusive) end of each run of equal values, `equal(i, j)`
+// comparing two non-null values
+template <typename Equal>
+void FindRunEnds(const Array& values, Equal&& equal, std::vector<int64_t>* run_ends) {
+  const int64_t length = values.length();
+  for (int64_t i = 1; i < length; ++i) {
+    const bool valid = values.IsValid(i);
+    if (valid != values.IsValid(i - 1) || (valid && !equal(i - 1, i))) {
+      run_ends->push_back(i);
+    }
+  }
+  if (length > 0) {
+    run_ends->push_back(length);
+  }
+}
+
+template <typename ArrayType>
+void FindBinaryRunEnds(const Array& values, std::vector<int64_t>* run_ends) {
+  const auto& binary = checked_cast<const ArrayType&>(values);
+  FindRunEnds(values,
+              [&](int64_t i, int64_t j) {
+                return binary.GetView(i) == binary.GetView(j);
+              },
+              run_ends);
+}
+
+void FindRunEnds(const Array& values, std::vector<int64_t>* run_ends) {
+  if (values.length() == 0) {
+    return;
+  }
+  const auto& type = *values.type();
+  switch (type.id()) {
+    case Type::NA:
+      return FindRunEnds(values, [](int64_t, int64_t) { return true; }, run_ends);
+    case Type::BOOL: {
+      const uint8_t* bits = values.data()->buffers[1]->data();
+      const int64_t offset = values.offset();
+      return FindRunEnds(values,
+                         [&](int64_t i, int64_t j) {
+                           return BitUtil::GetBit(bits, offset + i) ==
+                                  BitUtil::GetBit(bits, offset + j);
+                         },
+                         run_ends);
+    }
+    case Type::BINARY:
+    case Type::STRING:
+      return FindBinaryRunEnds<BinaryArray>(values, run_ends);
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      return FindBinaryRunEnds<LargeBinaryArray>(values, run_ends);
+    default:
+      break;
+  }
+  if (is_fixed_width(type.id()) && type.id() != Type::DICTIONARY) {
+    const int byte_width = checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+    const uint8_t* data =
+        values.data()->buffers[1]->data() + values.offset() * byte_width;
+    return FindRunEnds(values,
+                       [&](int64_t i, int64_t j) {
+                         return std::memcmp(data + i * byte_width, data + j * byte_width,
+                                            byte_width) == 0;
+                       },
+                       run_ends);
+  }
+  FindRunEnds(values,
+              [&](int64_t i, int64_t j) {
+                return values.RangeEquals(i, i + 1, j, values);
+              },
+              run_ends);
+}
+
+}  // namespace
+
+Status RunLengthEncode(FunctionContext* ctx, const Array& values,
+                       std::shared_ptr<Array>* out) {
+  std::vector<int64_t> run_ends;
+  FindRunEnds(values, &run_ends);
+
+  Int64Builder ends_builder(ctx->memory_pool());
+  Int64Builder starts_builder(ctx->memory_pool());
+  RETURN_NOT_OK(ends_builder.AppendValues(run_ends));
+  RETURN_NOT_OK(starts_builder.Reserve(run_ends.size()));
+  for (size_t run = 0; run < run_ends.size(); ++run) {
+    starts_builder.UnsafeAppend(RunStart(run_ends.data(), run));
+  }
+  std::shared_ptr<Array> ends, starts, run_values;
+  RETURN_NOT_OK(ends_builder.Finish(&ends));
+  RETURN_NOT_OK(starts_builder.Finish(&starts));
+
+  // The value of each run is its first value
+  RETURN_NOT_OK(Take(ctx, values, *starts, TakeOptions(), &run_values));
+  return MakeRunLengthEncodedArray(ends, run_values, out);
+}
+
+Status RunLengthDecode(FunctionContext* ctx, const Array& encoded,
+                       std::shared_ptr<Array>* out) {
+  if (!IsRunLengthEncoded(*encoded.type())) {
+    return Status::Invalid("Expected a run-length encoded array, got ",
+                           encoded.type()->ToString());
+  }
+  const auto& rle = checked_cast<const RunLengthEncodedArray&>(encoded);
+  const int64_t* run_ends = rle.run_ends()->raw_values();
+
+  // Repeat the index of each run value over the run
+  Int64Builder indices_builder(ctx->memory_pool());
+  RETURN_NOT_OK(indices_builder.Reserve(rle.logical_length()));
+  for (int64_t run = 0; run < rle.length(); ++run) {
+    for (int64_t i = RunStart(run_ends, run); i < run_ends[run]; ++i) {
+      indices_builder.UnsafeAppend(run);
+    }
+  }
+  std::shared_ptr<Array> indices;
+  RETURN_NOT_OK(indices_builder.Finish(&indices));
+  return Take(ctx, *rle.values(), *indices, TakeOptions(), out);
+}
+
+namespace detail {
+
+Status EvaluateOnRuns(FunctionContext* ctx, const Datum& value,
+                      const RunsFunction& func, Datum* out) {
+  std::vector<std::shared_ptr<Array>> chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.make_array());
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = value.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("Expected array-like input");
+  }
+
+  std::vector<std::shared_ptr<Array>> results;
+  for (const auto& chunk : chunks) {
+    const auto& rle = checked_cast<const RunLengthEncodedArray&>(*chunk);
+    std::shared_ptr<Array> run_result, result;
+    RETURN_NOT_OK(func(*rle.values(), &run_result));
+    DCHECK_EQ(run_result->length(), rle.length());
+    RETURN_NOT_OK(MakeRunLengthEncodedArray(rle.run_ends(), run_result, &result));
+    results.push_back(result);
+  }
+  *out = WrapArraysLike(value, results);
+  return Status::OK();
+}
+
+namespace {
+
+template <typename ArrowType>
+Status SumRuns(const RunLengthEncodedArray& rle, Datum* out) {
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename SumType::c_type;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<SumType>::ScalarType;
+
+  const auto& values = checked_cast<const ArrayType&>(*rle.values());
+  const int64_t* run_ends = rle.run_ends()->raw_values();
+  SumCType sum = 0;
+  int64_t count = 0;
+  for (int64_t run = 0; run < rle.length(); ++run) {
+    if (values.IsValid(run)) {
+      const int64_t run_length = run_ends[run] - RunStart(run_ends, run);
+      sum += static_cast<SumCType>(values.Value(run)) * static_cast<SumCType>(run_length);
+      count += run_length;
+    }
+  }
+  *out = Datum(std::make_shared<ScalarType>(sum, /*is_valid=*/count > 0));
+  return Status::OK();
+}
+
+}  // namespace
+
+#define SUM_RUNS_CASE(T) \
+  case T::type_id:       \
+    return SumRuns<T>(rle, out);
+
+Status RunLengthSum(FunctionContext* ctx, const Datum& value, Datum* out) {
+  if (value.kind() != Datum::ARRAY || !IsRunLengthEncoded(*value.type())) {
+    return Status::Invalid("Expected a run-length encoded array");
+  }
+  auto array = value.make_array();
+  const auto& rle = checked_cast<const RunLengthEncodedArray&>(*array);
+  switch (rle.values()->type_id()) {
+    SUM_RUNS_CASE(UInt8Type);
+    SUM_RUNS_CASE(Int8Type);
+    SUM_RUNS_CASE(UInt16Type);
+    SUM_RUNS_CASE(Int16Type);
+    SUM_RUNS_CASE(UInt32Type);
+    SUM_RUNS_CASE(Int32Type);
+    SUM_RUNS_CASE(UInt64Type);
+    SUM_RUNS_CASE(Int64Type);
+    SUM_RUNS_CASE(FloatType);
+    SUM_RUNS_CASE(DoubleType);
+    default:
+      return Status::Invalid("Datum must contain a NumericType");
+  }
+}
+
+#undef SUM_RUNS_CASE
+
+Status RunLengthCount(FunctionContext* ctx, const CountOptions& options,
+                      const Datum& value, Datum* out) {
+  if (value.kind() != Datum::ARRAY || !IsRunLengthEncoded(*value.type())) {
+    return Status::Invalid("Expected a run-length encoded array");
+  }
+  auto array = value.make_array();
+  const auto& rle = checked_cast<const RunLengthEncodedArray&>(*array);
+  const auto values = rle.values();
+  const int64_t* run_ends = rle.run_ends()->raw_values();
+  int64_t nulls = 0;
+  if (values->null_count() > 0) {
+    for (int64_t run = 0; run < rle.length(); ++run) {
+      if (values->IsNull(run)) {
+        nulls += run_ends[run] - RunStart(run_ends, run);
+      }
+    }
+  }
+
+  switch (options.count_mode) {
+    case CountOptions::COUNT_ALL:
+      *out = Datum(std::make_shared<Int64Scalar>(rle.logical_length() - nulls));
+      break;
+    case CountOptions::COUNT_NULL:
+      *out = Datum(std::make_shared<Int64Scalar>(nulls));
+      break;
+    default:
+      return Status::Invalid("Unknown CountOptions encountered");
+  }
+  return Status::OK();
+}
+
+Status RunLengthFilter(FunctionContext* ctx, const Datum& values, const Datum& filter,
+                       Datum* out) {
+  if (values.kind() != Datum::ARRAY || !filter.is_array()) {
+    return Status::Invalid("FilterKernel expects array values and filter");
+  }
+  if (filter.type()->id() != Type::BOOL) {
+    return Status::TypeError("filter must be a boolean array, got ", *filter.type());
+  }
+  auto array = values.make_array();
+  const auto& rle = checked_cast<const RunLengthEncodedArray&>(*array);
+  const auto filter_array = checked_pointer_cast<BooleanArray>(filter.make_array());
+  if (rle.logical_length() != filter_array->length()) {
+    return Status::Invalid("filter and value array must have identical lengths");
+  }
+  const int64_t* run_ends = rle.run_ends()->raw_values();
+  const uint8_t* filter_bits = filter_array->values()->data();
+  const int64_t filter_offset = filter_array->offset();
+
+  // Each output run takes its value from an input run, or is null where the
+  // filter is null (source -1)
+  std::vector<int64_t> out_ends, out_sources;
+  int64_t out_length = 0;
+  auto emit = [&](int64_t source, int64_t length) {
+    if (length == 0) return;
+    out_length += length;
+    if (!out_sources.empty() && out_sources.back() == source) {
+      out_ends.back() = out_length;
+    } else {
+      out_ends.push_back(out_length);
+      out_sources.push_back(source);
+    }
+  };
+  for (int64_t run = 0; run < rle.length(); ++run) {
+    const int64_t start = RunStart(run_ends, run);
+    const int64_t end = run_ends[run];
+    if (filter_array->null_count() == 0) {
+      emit(run, internal::CountSetBits(filter_bits, filter_offset + start, end - start));
+      continue;
+    }
+    for (int64_t i = start; i < end; ++i) {
+      if (filter_array->IsNull(i)) {
+        emit(-1, 1);
+      } else if (BitUtil::GetBit(filter_bits, filter_offset + i)) {
+        emit(run, 1);
+      }
+    }
+  }
+
+  Int64Builder ends_builder(ctx->memory_pool());
+  Int64Builder sources_builder(ctx->memory_pool());
+  RETURN_NOT_OK(ends_builder.AppendValues(out_ends));
+  RETURN_NOT_OK(sources_builder.Reserve(out_sources.size()));
+  for (int64_t source : out_sources) {
+    if (source < 0) {
+      sources_builder.UnsafeAppendNull();
+    } else {
+      sources_builder.UnsafeAppend(source);
+    }
+  }
+  std::shared_ptr<Array> ends, sources, run_values, result;
+  RETURN_NOT_OK(ends_builder.Finish(&ends));
+  RETURN_NOT_OK(sources_builder.Finish(&sources));
+  RETURN_NOT_OK(Take(ctx, *rle.values(), *sources, TakeOptions(), &run_values));
+  RETURN_NOT_OK(MakeRunLengthEncodedArray(ends, run_values, &result));
+  *out = result;
+  return Status::OK();
+}
+
+}  // namespace detail
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "arrow/extension_type.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct CountOptions;
+struct Datum;
+class FunctionContext;
+
+/// \brief Extension type of run-length encoded arrays
+///
+/// The storage is a StructArray holding one slot per run of equal values: its
+/// "run_ends" field holds the logical (exclusive) end of each run, as strictly
+/// increasing non-null int64 values, and its "values" field holds the value
+/// of each run, which may be null.  The logical length of the array is
+/// therefore the last run end, while its length() is the number of runs.
+///
+/// Sum, Count, Compare with a scalar and Filter accept run-length encoded
+/// arrays and operate on the runs without decoding them.
+///
+/// \note API not yet finalized
+class ARROW_EXPORT RunLengthEncodedType : public ExtensionType {
+ public:
+  explicit RunLengthEncodedType(const std::shared_ptr<DataType>& value_type);
+
+  std::string extension_name() const override { return "arrow.run_length_encoded"; }
+
+  bool ExtensionEquals(const ExtensionType& other) const override;
+
+  std::shared_ptr<Array> MakeArray(std::shared_ptr<ArrayData> data) const override;
+
+  Status Deserialize(std::shared_ptr<DataType> storage_type,
+                     const std::string& serialized,
+                     std::shared_ptr<DataType>* out) const override;
+
+  std::string Serialize() const override { return ""; }
+
+  /// \brief The type of the run values
+  std::shared_ptr<DataType> value_type() const;
+};
+
+/// \brief Array of a RunLengthEncodedType
+class ARROW_EXPORT RunLengthEncodedArray : public ExtensionArray {
+ public:
+  using ExtensionArray::ExtensionArray;
+
+  /// \brief The logical (exclusive) end of each run
+  std::shared_ptr<Int64Array> run_ends() const;
+
+  /// \brief The value of each run
+  std::shared_ptr<Array> values() const;
+
+  /// \brief The number of values the array decodes to
+  int64_t logical_length() const;
+};
+
+/// \brief Return a RunLengthEncodedType instance
+ARROW_EXPORT
+std::shared_ptr<DataType> run_length_encoded(const std::shared_ptr<DataType>& value_type);
+
+/// \brief Return whether a type is a RunLengthEncodedType
+ARROW_EXPORT
+bool IsRunLengthEncoded(const DataType& type);
+
+/// \brief Build a run-length encoded array from its run ends and values
+///
+/// \param[in] run_ends the logical (exclusive) end of each run, as a
+/// non-null, strictly increasing Int64Array
+/// \param[in] values the value of each run, of the same length as run_ends
+/// \param[out] out the RunLengthEncodedArray
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MakeRunLengthEncodedArray(const std::shared_ptr<Array>& run_ends,
+                                 const std::shared_ptr<Array>& values,
+                                 std::shared_ptr<Array>* out);
+
+/// \brief Run-length encode an array
+///
+/// Consecutive equal values, and consecutive nulls, are stored as a single
+/// run.
+///
+/// For example given values = [1, 1, 1, null, null, 2, 2, 1], the output
+/// has run_ends = [3, 5, 7, 8] and values = [1, null, 2, 1].
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the array to encode
+/// \param[out] out the RunLengthEncodedArray
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status RunLengthEncode(FunctionContext* context, const Array& values,
+                       std::shared_ptr<Array>* out);
+
+/// \brief Decode a run-length encoded array into a plain array of its value type
+///
+/// \param[in] context the FunctionContext
+/// \param[in] encoded the RunLengthEncodedArray to decode
+/// \param[out] out the decoded array, of length encoded.logical_length()
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status RunLengthDecode(FunctionContext* context, const Array& encoded,
+                       std::shared_ptr<Array>* out);
+
+namespace detail {
+
+// The run-aware implementations that Sum, Count, Compare and Filter dispatch
+// to when passed a run-length encoded array.
+
+using RunsFunction =
+    std::function<Status(const Array& run_values, std::shared_ptr<Array>* out)>;
+
+// Evaluate an element-wise function once per run rather than once per value:
+// `func` maps the run values to an array of the same length, and the result
+// is a run-length encoded Array or ChunkedArray with the same run ends.
+ARROW_EXPORT
+Status EvaluateOnRuns(FunctionContext* ctx, const Datum& value,
+                      const RunsFunction& func, Datum* out);
+
+ARROW_EXPORT
+Status RunLengthSum(FunctionContext* ctx, const Datum& value, Datum* out);
+
+ARROW_EXPORT
+Status RunLengthCount(FunctionContext* ctx, const CountOptions& options,
+                      const Datum& value, Datum* out);
+
+// The filter is a plain BooleanArray of the logical length of the values.
+ARROW_EXPORT
+Status RunLengthFilter(FunctionContext* ctx, const Datum& values, const Datum& filter,
+                       Datum* out);
+
+}  // namespace detail
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/count.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/run_length.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+class TestRunLength : public ComputeFixture, public ::testing::Test {
+ protected:
+  std::shared_ptr<Array> Encode(const std::shared_ptr<DataType>& type,
+                                const std::string& values_json) {
+    std::shared_ptr<Array> encoded;
+    ARROW_EXPECT_OK(RunLengthEncode(&this->ctx_, *ArrayFromJSON(type, values_json),
+                                    &encoded));
+    return encoded;
+  }
+
+  void AssertRuns(const Array& actual, const std::string& run_ends_json,
+                  const std::shared_ptr<DataType>& value_type,
+                  const std::string& values_json) {
+    ASSERT_OK(actual.Validate());
+    ASSERT_TRUE(actual.type()->Equals(run_length_encoded(value_type)));
+    const auto& rle = checked_cast<const RunLengthEncodedArray&>(actual);
+    AssertArraysEqual(*ArrayFromJSON(int64(), run_ends_json), *rle.run_ends());
+    AssertArraysEqual(*ArrayFromJSON(value_type, values_json), *rle.values());
+  }
+
+  void AssertRoundTrip(const std::shared_ptr<DataType>& type,
+                       const std::string& values_json) {
+    auto values = ArrayFromJSON(type, values_json);
+    std::shared_ptr<Array> encoded, decoded;
+    ASSERT_OK(RunLengthEncode(&this->ctx_, *values, &encoded));
+    ASSERT_OK(encoded->Validate());
+    ASSERT_EQ(values->length(),
+              checked_cast<const RunLengthEncodedArray&>(*encoded).logical_length());
+    ASSERT_OK(RunLengthDecode(&this->ctx_, *encoded, &decoded));
+    AssertArraysEqual(*values, *decoded);
+  }
+};
+
+TEST_F(TestRunLength, Encode) {
+  auto encoded = Encode(int32(), "[1, 1, 1, null, null, 2, 2, 1]");
+  AssertRuns(*encoded, "[3, 5, 7, 8]", int32(), "[1, null, 2, 1]");
+  ASSERT_EQ(8, checked_cast<const RunLengthEncodedArray&>(*encoded).logical_length());
+
+  AssertRuns(*Encode(utf8(), R"(["a", "a", "bc", "bc", "bc", null, "a"])"),
+             "[2, 5, 6, 7]", utf8(), R"(["a", "bc", null, "a"])");
+  AssertRuns(*Encode(boolean(), "[true, true, false, false, false, true]"),
+             "[2, 5, 6]", boolean(), "[true, false, true]");
+  AssertRuns(*Encode(null(), "[null, null, null]"), "[3]", null(), "[null]");
+  AssertRuns(*Encode(int32(), "[]"), "[]", int32(), "[]");
+}
+
+TEST_F(TestRunLength, EncodeSliced) {
+  auto values = ArrayFromJSON(int16(), "[5, 5, 6, 6, 6, 7]")->Slice(1, 4);
+  std::shared_ptr<Array> encoded;
+  ASSERT_OK(RunLengthEncode(&this->ctx_, *values, &encoded));
+  AssertRuns(*encoded, "[1, 4]", int16(), "[5, 6]");
+}
+
+TEST_F(TestRunLength, RoundTrip) {
+  AssertRoundTrip(int8(), "[1, 1, null, null, -1, -1, -1, 0]");
+  AssertRoundTrip(float64(), "[0.5, 0.5, 1.5, null, 1.5]");
+  AssertRoundTrip(large_utf8(), R"(["x", "x", "", "", null, "y"])");
+  AssertRoundTrip(fixed_size_binary(2), R"(["ab", "ab", "cd", null, null])");
+  AssertRoundTrip(list(int32()), "[[1, 2], [1, 2], [], null, [3]]");
+}
+
+TEST_F(TestRunLength, MakeRunLengthEncodedArray) {
+  std::shared_ptr<Array> out;
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_OK(MakeRunLengthEncodedArray(ArrayFromJSON(int64(), "[2, 5]"), values, &out));
+  AssertRuns(*out, "[2, 5]", int32(), "[1, 2]");
+
+  for (const auto& run_ends : {"[5, 5]", "[0, 5]", "[5]"}) {
+    ASSERT_RAISES(Invalid, MakeRunLengthEncodedArray(ArrayFromJSON(int64(), run_ends),
+                                                     values, &out));
+  }
+  ASSERT_RAISES(Invalid, MakeRunLengthEncodedArray(ArrayFromJSON(int32(), "[2, 5]"),
+                                                   values, &out));
+}
+
+TEST_F(TestRunLength, TypeSerialization) {
+  auto type = run_length_encoded(utf8());
+  const auto& ext_type = checked_cast<const ExtensionType&>(*type);
+  std::shared_ptr<DataType> deserialized;
+  ASSERT_OK(ext_type.Deserialize(ext_type.storage_type(), ext_type.Serialize(),
+                                 &deserialized));
+  ASSERT_TRUE(deserialized->Equals(*type));
+  ASSERT_FALSE(type->Equals(*run_length_encoded(binary())));
+  ASSERT_TRUE(IsRunLengthEncoded(*type));
+  ASSERT_FALSE(IsRunLengthEncoded(*utf8()));
+
+  ASSERT_RAISES(Invalid, ext_type.Deserialize(struct_({field("values", utf8())}), "",
+                                              &deserialized));
+}
+
+TEST_F(TestRunLength, Sum) {
+  Datum out;
+  ASSERT_OK(Sum(&this->ctx_, Encode(int32(), "[1, 1, 1, null, 2, 2, -3]"), &out));
+  ASSERT_TRUE(out.scalar()->Equals(Int64Scalar(4)));
+
+  ASSERT_OK(Sum(&this->ctx_, Encode(uint8(), "[200, 200, 200]"), &out));
+  ASSERT_TRUE(out.scalar()->Equals(UInt64Scalar(600)));
+
+  ASSERT_OK(Sum(&this->ctx_, Encode(float32(), "[0.5, 0.5, 0.25]"), &out));
+  ASSERT_TRUE(out.scalar()->Equals(DoubleScalar(1.25)));
+
+  ASSERT_OK(Sum(&this->ctx_, Encode(int64(), "[null, null]"), &out));
+  ASSERT_FALSE(out.scalar()->is_valid);
+
+  ASSERT_RAISES(Invalid, Sum(&this->ctx_, Encode(utf8(), R"(["a"])"), &out));
+}
+
+TEST_F(TestRunLength, Count) {
+  auto encoded = Encode(int32(), "[1, 1, null, null, null, 2, null]");
+  Datum out;
+  ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_ALL), encoded, &out));
+  ASSERT_TRUE(out.scalar()->Equals(Int64Scalar(3)));
+  ASSERT_OK(Count(&this->ctx_, CountOptions(CountOptions::COUNT_NULL), encoded, &out));
+  ASSERT_TRUE(out.scalar()->Equals(Int64Scalar(4)));
+}
+
+TEST_F(TestRunLength, CompareScalar) {
+  auto encoded = Encode(int32(), "[1, 1, 5, 5, 5, null, 3]");
+  Datum out;
+  ASSERT_OK(Compare(&this->ctx_, encoded, Datum(std::make_shared<Int32Scalar>(3)),
+                    CompareOptions(GREATER), &out));
+  AssertRuns(*out.make_array(), "[2, 5, 6, 7]", boolean(),
+             "[false, true, null, false]");
+
+  ASSERT_OK(Compare(&this->ctx_, Datum(std::make_shared<Int32Scalar>(3)), encoded,
+                    CompareOptions(GREATER), &out));
+  AssertRuns(*out.make_array(), "[2, 5, 6, 7]", boolean(), "[true, false, null, false]");
+
+  auto status = Encode(int8(), "[0, 0, 2, 0]");
+  ASSERT_OK(Compare(&this->ctx_, status, Datum(std::make_shared<Int8Scalar>(0)),
+                    CompareOptions(EQUAL), &out));
+  AssertRuns(*out.make_array(), "[2, 3, 4]", boolean(), "[true, false, true]");
+}
+
+TEST_F(TestRunLength, Filter) {
+  auto encoded = Encode(int32(), "[1, 1, 1, 2, 2, null, 3, 3]");
+  Datum out;
+  ASSERT_OK(Filter(&this->ctx_, encoded,
+                   ArrayFromJSON(boolean(), "[1, 0, 1, 0, 0, 1, 1, 1]"), &out));
+  AssertRuns(*out.make_array(), "[2, 3, 5]", int32(), "[1, null, 3]");
+
+  // Null filter slots emit nulls
+  ASSERT_OK(Filter(&this->ctx_, encoded,
+                   ArrayFromJSON(boolean(), "[1, null, null, 1, 0, 0, 0, 1]"), &out));
+  AssertRuns(*out.make_array(), "[1, 3, 4, 5]", int32(), "[1, null, 2, 3]");
+
+  ASSERT_OK(Filter(&this->ctx_, encoded,
+                   ArrayFromJSON(boolean(), "[0, 0, 0, 0, 0, 0, 0, 0]"), &out));
+  AssertRuns(*out.make_array(), "[]", int32(), "[]");
+
+  ASSERT_RAISES(Invalid,
+                Filter(&this->ctx_, encoded, ArrayFromJSON(boolean(), "[1, 0]"), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "arrow/array.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+namespace arrow {
+namespace compute {
+namespace detail {
+
+// Number of indices converted at once by VisitSelection
+constexpr int64_t kSelectionBatchSize = 1024;
+
+template <typename IndexCType, typename Visitor>
+Status VisitSelectionImpl(const Array& selection, int64_t values_length,
+                          Visitor&& visit) {
+  const auto raw_indices = selection.data()->GetValues<IndexCType>(1);
+  const bool may_have_nulls = selection.null_count() != 0;
+
+  int64_t indices[kSelectionBatchSize];
+  for (int64_t offset = 0; offset < selection.length(); offset += kSelectionBatchSize) {
+    const int64_t length = std::min(kSelectionBatchSize, selection.length() - offset);
+    for (int64_t i = 0; i < length; ++i) {
+      if (may_have_nulls && selection.IsNull(offset + i)) {
+        indices[i] = 0;
+        continue;
+      }
+      // Unsigned indices beyond the int64_t range wrap to negative values
+      const auto index = static_cast<int64_t>(raw_indices[offset + i]);
+      if (index < 0 || index >= values_length) {
+        return Status::IndexError("selection index ", index, " out of bounds");
+      }
+      indices[i] = index;
+    }
+    RETURN_NOT_OK(visit(offset, static_cast<const int64_t*>(indices), length));
+  }
+  return Status::OK();
+}
+
+/// \brief Visit the indices of a selection vector in batches of int64_t.
+///
+/// A selection vector is an array of integers, of any width and signedness,
+/// holding positions in an array of `values_length` values, like the output
+/// of FilterToIndices.  The indices are bounds checked and converted to
+/// int64_t once per batch so that kernels evaluate their inner loop over
+/// contiguous indices.  Null indices are converted to 0; callers must check
+/// selection.IsNull(offset + i) themselves if selection.null_count() != 0.
+///
+/// \param[in] selection the selection vector
+/// \param[in] values_length the length of the array being selected from
+/// \param[in] visit called as Status(int64_t offset, const int64_t* indices,
+///            int64_t length) for each batch of indices, where `offset` is the
+///            position of indices[0] in the selection vector
+template <typename Visitor>
+Status VisitSelection(const Array& selection, int64_t values_length, Visitor&& visit) {
+  switch (selection.type_id()) {
+    case Type::INT8:
+      return VisitSelectionImpl<int8_t>(selection, values_length, visit);
+    case Type::UINT8:
+      return VisitSelectionImpl<uint8_t>(selection, values_length, visit);
+    case Type::INT16:
+      return VisitSelectionImpl<int16_t>(selection, values_length, visit);
+    case Type::UINT16:
+      return VisitSelectionImpl<uint16_t>(selection, values_length, visit);
+    case Type::INT32:
+      return VisitSelectionImpl<int32_t>(selection, values_length, visit);
+    case Type::UINT32:
+      return VisitSelectionImpl<uint32_t>(selection, values_length, visit);
+    case Type::INT64:
+      return VisitSelectionImpl<int64_t>(selection, values_length, visit);
+    case Type::UINT64:
+      return VisitSelectionImpl<uint64_t>(selection, values_length, visit);
+    default:
+      return Status::TypeError("selection vector must be an integer array, got ",
+                               *selection.type());
+  }
+}
+
+}  // namespace detail
+}  // namespace compute
+}  // namespace arrow
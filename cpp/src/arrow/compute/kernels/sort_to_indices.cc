@@ -18,14 +18,24 @@
 #include "arrow/compute/kernels/sort_to_indices.h"
 
 #include <algorithm>
+#include <cstring>
 #include <numeric>
+#include <type_traits>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/expression.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/logical_type.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -65,11 +75,6 @@ bool CompareValues(const ArrayType& array, uint64_t lhs, uint64_t rhs) {
   return array.Value(lhs) < array.Value(rhs);
 }
 
-template <typename ArrayType>
-bool CompareViews(const ArrayType& array, uint64_t lhs, uint64_t rhs) {
-  return array.GetView(lhs) < array.GetView(rhs);
-}
-
 template <typename ArrowType, typename Comparator>
 class SortToIndicesKernelImpl : public SortToIndicesKernel {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
@@ -123,6 +128,92 @@ class SortToIndicesKernelImpl : public SortToIndicesKernel {
   }
 };
 
+// Sorting binary values through their offsets and data costs a couple of cache
+// misses per comparison, so the values are sorted as keys holding their first
+// bytes inline, the data only being compared when those are equal
+template <typename ArrowType>
+class BinarySortToIndicesKernelImpl : public SortToIndicesKernel {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  Status SortToIndices(FunctionContext* ctx, const std::shared_ptr<Array>& values,
+                       std::shared_ptr<Array>* offsets) {
+    return SortToIndicesImpl(ctx, internal::checked_cast<const ArrayType&>(*values),
+                             offsets);
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& values, Datum* offsets) {
+    if (!values.is_array()) {
+      return Status::Invalid("SortToIndicesKernel expects array values");
+    }
+    auto values_array = values.make_array();
+    std::shared_ptr<Array> offsets_array;
+    RETURN_NOT_OK(this->SortToIndices(ctx, values_array, &offsets_array));
+    *offsets = offsets_array;
+    return Status::OK();
+  }
+
+ private:
+  static constexpr int64_t kPrefixLength = sizeof(uint64_t);
+
+  struct SortKey {
+    // The first kPrefixLength bytes, zero padded, ordered as the bytes are
+    uint64_t prefix;
+    int64_t length;
+    int64_t index;
+  };
+
+  static uint64_t LoadPrefix(util::string_view value) {
+    uint64_t prefix = 0;
+    if (!value.empty()) {
+      std::memcpy(&prefix, value.data(),
+                  value.size() < sizeof(prefix) ? value.size() : sizeof(prefix));
+    }
+    return BitUtil::FromBigEndian(prefix);
+  }
+
+  Status SortToIndicesImpl(FunctionContext* ctx, const ArrayType& values,
+                           std::shared_ptr<Array>* offsets) {
+    std::shared_ptr<Buffer> indices_buf;
+    RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), values.length() * sizeof(uint64_t),
+                                 &indices_buf));
+    auto indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+
+    std::vector<SortKey> keys;
+    keys.reserve(values.length() - values.null_count());
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsValid(i)) {
+        const auto value = values.GetView(i);
+        keys.push_back({LoadPrefix(value), static_cast<int64_t>(value.size()), i});
+      }
+    }
+    auto before = [&values](const SortKey& left, const SortKey& right) {
+      if (left.prefix != right.prefix) {
+        return left.prefix < right.prefix;
+      }
+      if (left.length <= kPrefixLength && right.length <= kPrefixLength) {
+        // Both values are their zero-padded prefixes
+        return left.length < right.length;
+      }
+      return values.GetView(left.index) < values.GetView(right.index);
+    };
+    std::stable_sort(keys.begin(), keys.end(), before);
+
+    for (const auto& key : keys) {
+      *indices++ = static_cast<uint64_t>(key.index);
+    }
+    if (values.null_count() > 0) {
+      for (int64_t i = 0; i < values.length(); ++i) {
+        if (values.IsNull(i)) {
+          *indices++ = static_cast<uint64_t>(i);
+        }
+      }
+    }
+    *offsets = std::make_shared<UInt64Array>(values.length(), indices_buf);
+    return Status::OK();
+  }
+};
+
 template <typename ArrowType, typename Comparator>
 SortToIndicesKernelImpl<ArrowType, Comparator>* MakeSortToIndicesKernelImpl(
     Comparator comparator) {
@@ -164,10 +255,10 @@ Status SortToIndicesKernel::Make(const std::shared_ptr<DataType>& value_type,
       kernel = MakeSortToIndicesKernelImpl<DoubleType>(CompareValues<DoubleArray>);
       break;
     case Type::BINARY:
-      kernel = MakeSortToIndicesKernelImpl<BinaryType>(CompareViews<BinaryArray>);
+      kernel = new BinarySortToIndicesKernelImpl<BinaryType>();
       break;
     case Type::STRING:
-      kernel = MakeSortToIndicesKernelImpl<StringType>(CompareViews<StringArray>);
+      kernel = new BinarySortToIndicesKernelImpl<StringType>();
       break;
     default:
       return Status::NotImplemented("Sorting of ", *value_type, " arrays");
@@ -190,5 +281,1157 @@ Status SortToIndices(FunctionContext* ctx, const Array& values,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Partial sorts
+
+namespace {
+
+// The value of a non-null array slot, as compared by SortToIndices
+template <typename ArrayType>
+struct SortValue {
+  static auto Get(const ArrayType& array, int64_t i) -> decltype(array.Value(i)) {
+    return array.Value(i);
+  }
+};
+
+template <>
+struct SortValue<BinaryArray> {
+  static util::string_view Get(const BinaryArray& array, int64_t i) {
+    return array.GetView(i);
+  }
+};
+
+template <>
+struct SortValue<StringArray> {
+  static util::string_view Get(const StringArray& array, int64_t i) {
+    return array.GetView(i);
+  }
+};
+
+// Call visitor->Visit<ArrayType>() for the array type of a sortable type
+template <typename Visitor>
+Status VisitSortableType(const DataType& type, Visitor* visitor) {
+  switch (type.id()) {
+#define SORTABLE_CASE(TYPE_CLASS)   \
+  case TYPE_CLASS##Type::type_id: \
+    return visitor->template Visit<TYPE_CLASS##Array>();
+
+    SORTABLE_CASE(UInt8)
+    SORTABLE_CASE(Int8)
+    SORTABLE_CASE(UInt16)
+    SORTABLE_CASE(Int16)
+    SORTABLE_CASE(UInt32)
+    SORTABLE_CASE(Int32)
+    SORTABLE_CASE(UInt64)
+    SORTABLE_CASE(Int64)
+    SORTABLE_CASE(Float)
+    SORTABLE_CASE(Double)
+    SORTABLE_CASE(Binary)
+    SORTABLE_CASE(String)
+
+#undef SORTABLE_CASE
+
+    default:
+      return Status::NotImplemented("Sorting of ", type, " arrays");
+  }
+}
+
+// Write the indices of the non-null values of array, then those of the nulls,
+// and return the end of the non-null indices
+uint64_t* PartitionNulls(const Array& array, uint64_t* indices_begin,
+                         uint64_t* indices_end) {
+  std::iota(indices_begin, indices_end, 0);
+  if (array.null_count() == 0) {
+    return indices_end;
+  }
+  return std::stable_partition(indices_begin, indices_end,
+                               [&array](uint64_t ind) { return !array.IsNull(ind); });
+}
+
+struct PartitionNthIndicesVisitor {
+  template <typename ArrayType>
+  Status Visit() {
+    const auto& array = static_cast<const ArrayType&>(values);
+    uint64_t* nulls_begin = PartitionNulls(array, indices_begin, indices_end);
+    uint64_t* nth = indices_begin + n;
+    if (nth < nulls_begin) {
+      std::nth_element(indices_begin, nth, nulls_begin,
+                       [&array](uint64_t left, uint64_t right) {
+                         return SortValue<ArrayType>::Get(array, left) <
+                                SortValue<ArrayType>::Get(array, right);
+                       });
+    }
+    return Status::OK();
+  }
+
+  const Array& values;
+  int64_t n;
+  uint64_t* indices_begin;
+  uint64_t* indices_end;
+};
+
+struct TopKIndicesVisitor {
+  // A non-null value, identified by its chunk and its index in the chunk
+  struct Candidate {
+    int chunk;
+    uint64_t index;
+  };
+
+  template <typename ArrayType>
+  Status Visit() {
+    using Getter = SortValue<ArrayType>;
+
+    // A strict order on (value, logical index), so that the selection is the
+    // same as the first values of a stable sort
+    auto before = [&](const Candidate& left, const Candidate& right) {
+      const auto left_value =
+          Getter::Get(static_cast<const ArrayType&>(*chunks[left.chunk]), left.index);
+      const auto right_value =
+          Getter::Get(static_cast<const ArrayType&>(*chunks[right.chunk]), right.index);
+      if (left_value < right_value) {
+        return !descending;
+      }
+      if (right_value < left_value) {
+        return descending;
+      }
+      return chunk_offsets[left.chunk] + left.index <
+             chunk_offsets[right.chunk] + right.index;
+    };
+
+    // Select the k first values of each chunk...
+    std::vector<std::vector<Candidate>> candidates(chunks.size());
+    std::vector<uint64_t> chunk_indices;
+    for (int i = 0; i < static_cast<int>(chunks.size()); ++i) {
+      const Array& chunk = *chunks[i];
+      chunk_indices.resize(chunk.length());
+      const uint64_t* nulls_begin = PartitionNulls(chunk, chunk_indices.data(),
+                                                   chunk_indices.data() + chunk.length());
+      std::vector<Candidate>& chunk_candidates = candidates[i];
+      for (const uint64_t* index = chunk_indices.data(); index != nulls_begin; ++index) {
+        chunk_candidates.push_back({i, *index});
+      }
+      if (static_cast<int64_t>(chunk_candidates.size()) > k) {
+        std::nth_element(chunk_candidates.begin(), chunk_candidates.begin() + k,
+                         chunk_candidates.end(), before);
+        chunk_candidates.resize(k);
+      }
+      std::sort(chunk_candidates.begin(), chunk_candidates.end(), before);
+    }
+
+    // ...then merge them, with a heap holding the next candidate of each chunk
+    std::vector<size_t> next(chunks.size(), 0);
+    auto heap_after = [&](int left, int right) {
+      return before(candidates[right][next[right]], candidates[left][next[left]]);
+    };
+    std::vector<int> heap;
+    for (int i = 0; i < static_cast<int>(chunks.size()); ++i) {
+      if (!candidates[i].empty()) {
+        heap.push_back(i);
+      }
+    }
+    std::make_heap(heap.begin(), heap.end(), heap_after);
+    while (!heap.empty() && static_cast<int64_t>(out->size()) < k) {
+      std::pop_heap(heap.begin(), heap.end(), heap_after);
+      const int chunk = heap.back();
+      const Candidate& candidate = candidates[chunk][next[chunk]];
+      out->push_back(chunk_offsets[chunk] + candidate.index);
+      if (++next[chunk] < candidates[chunk].size()) {
+        std::push_heap(heap.begin(), heap.end(), heap_after);
+      } else {
+        heap.pop_back();
+      }
+    }
+
+    // Nulls come last, in order
+    for (int i = 0; i < static_cast<int>(chunks.size()); ++i) {
+      const Array& chunk = *chunks[i];
+      if (chunk.null_count() == 0) {
+        continue;
+      }
+      for (int64_t j = 0; j < chunk.length() && static_cast<int64_t>(out->size()) < k;
+           ++j) {
+        if (chunk.IsNull(j)) {
+          out->push_back(chunk_offsets[i] + j);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  const ArrayVector& chunks;
+  const std::vector<uint64_t>& chunk_offsets;
+  int64_t k;
+  bool descending;
+  std::vector<uint64_t>* out;
+};
+
+}  // namespace
+
+Status PartitionNthIndices(FunctionContext* ctx, const Array& values, int64_t n,
+                           std::shared_ptr<Array>* offsets) {
+  if (n < 0 || n > values.length()) {
+    return Status::IndexError("Partition position ", n, " out of bounds for array of ",
+                              "length ", values.length());
+  }
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), values.length() * sizeof(uint64_t),
+                               &indices_buf));
+  uint64_t* indices_begin = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  PartitionNthIndicesVisitor visitor{values, n, indices_begin,
+                                     indices_begin + values.length()};
+  RETURN_NOT_OK(VisitSortableType(*values.type(), &visitor));
+  *offsets = std::make_shared<UInt64Array>(values.length(), indices_buf);
+  return Status::OK();
+}
+
+Status TopKIndices(FunctionContext* ctx, const Datum& values, int64_t k,
+                   SortKey::Order order, std::shared_ptr<Array>* offsets) {
+  if (k < 0) {
+    return Status::Invalid("TopKIndices needs a non-negative k, got ", k);
+  }
+  ArrayVector chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.make_array());
+  } else if (values.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = values.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("TopKIndices expects array values");
+  }
+  std::vector<uint64_t> chunk_offsets(chunks.size() + 1, 0);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    chunk_offsets[i + 1] = chunk_offsets[i] + chunks[i]->length();
+  }
+
+  std::vector<uint64_t> indices;
+  TopKIndicesVisitor visitor{chunks, chunk_offsets, k, order == SortKey::DESCENDING,
+                             &indices};
+  RETURN_NOT_OK(VisitSortableType(*values.type(), &visitor));
+
+  UInt64Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.AppendValues(indices));
+  return builder.Finish(offsets);
+}
+
+// ----------------------------------------------------------------------
+// Sorting the rows of a table
+
+namespace {
+
+// Don't split the rows in runs smaller than this when sorting in parallel,
+// the merge step would dominate.
+constexpr int64_t kMinParallelSortLength = 1 << 16;
+
+// Below this length, rows are sorted with comparisons only
+constexpr int64_t kMinRadixSortLength = 256;
+
+// Map values to 64-bit keys whose unsigned order is the value order
+
+template <typename T>
+typename std::enable_if<std::is_unsigned<T>::value, uint64_t>::type NormalizeValue(
+    T value) {
+  return static_cast<uint64_t>(value);
+}
+
+template <typename T>
+typename std::enable_if<std::is_signed<T>::value && std::is_integral<T>::value,
+                        uint64_t>::type
+NormalizeValue(T value) {
+  return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (uint64_t(1) << 63);
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, uint64_t>::type
+NormalizeValue(T value) {
+  const double as_double = value;
+  uint64_t bits;
+  std::memcpy(&bits, &as_double, sizeof(bits));
+  // Negative values sort in reverse order of their magnitude
+  return (bits >> 63) ? ~bits : bits | (uint64_t(1) << 63);
+}
+
+// The first 8 bytes, so that keys compare like the strings' prefixes
+uint64_t NormalizeValue(util::string_view value) {
+  uint64_t key = 0;
+  const size_t prefix_length = std::min<size_t>(value.size(), 8);
+  for (size_t i = 0; i < prefix_length; ++i) {
+    key |= static_cast<uint64_t>(static_cast<uint8_t>(value[i])) << (56 - 8 * i);
+  }
+  return key;
+}
+
+// A sort key column, with its chunks combined
+class SortColumn {
+ public:
+  SortColumn(std::shared_ptr<Array> array, const SortKey& key,
+             SortOptions::NullPlacement null_placement)
+      : array_(std::move(array)),
+        // Computes the null count once, so that it isn't updated concurrently
+        has_nulls_(array_->null_count() > 0),
+        descending_(key.order == SortKey::DESCENDING),
+        nulls_first_(null_placement == SortOptions::NULLS_AT_START) {}
+
+  virtual ~SortColumn() = default;
+
+  bool has_nulls() const { return has_nulls_; }
+
+  bool IsNull(uint64_t index) const { return has_nulls_ && array_->IsNull(index); }
+
+  // Negative if the left row sorts first, positive if the right one does
+  int Compare(uint64_t left, uint64_t right) const {
+    if (has_nulls_) {
+      const bool left_null = array_->IsNull(left);
+      const bool right_null = array_->IsNull(right);
+      if (left_null || right_null) {
+        if (left_null == right_null) {
+          return 0;
+        }
+        return left_null == nulls_first_ ? -1 : 1;
+      }
+    }
+    const int result = CompareValues(left, right);
+    return descending_ ? -result : result;
+  }
+
+  // Write the normalized keys of the given non-null rows, such that rows
+  // with smaller keys sort first
+  void Normalize(const uint64_t* indices, int64_t length, uint64_t* keys) const {
+    NormalizeValues(indices, length, keys);
+    if (descending_) {
+      for (int64_t i = 0; i < length; ++i) {
+        keys[i] = ~keys[i];
+      }
+    }
+  }
+
+  // Whether rows with equal normalized keys have equal values
+  virtual bool exact_normalized_keys() const = 0;
+
+ protected:
+  virtual int CompareValues(uint64_t left, uint64_t right) const = 0;
+
+  virtual void NormalizeValues(const uint64_t* indices, int64_t length,
+                               uint64_t* keys) const = 0;
+
+  std::shared_ptr<Array> array_;
+  const bool has_nulls_;
+  const bool descending_;
+  const bool nulls_first_;
+};
+
+// Values of at most 64 bits are ordered by their normalized keys, which makes
+// floating-point ordering total and consistent with the radix sort.
+template <typename ArrayType>
+class FixedWidthSortColumn : public SortColumn {
+ public:
+  using SortColumn::SortColumn;
+
+  bool exact_normalized_keys() const override { return true; }
+
+ protected:
+  int CompareValues(uint64_t left, uint64_t right) const override {
+    const uint64_t left_key = NormalizeValue(values().Value(left));
+    const uint64_t right_key = NormalizeValue(values().Value(right));
+    return left_key < right_key ? -1 : (left_key > right_key ? 1 : 0);
+  }
+
+  void NormalizeValues(const uint64_t* indices, int64_t length,
+                       uint64_t* keys) const override {
+    const ArrayType& array = values();
+    for (int64_t i = 0; i < length; ++i) {
+      keys[i] = NormalizeValue(array.Value(indices[i]));
+    }
+  }
+
+ private:
+  const ArrayType& values() const {
+    return internal::checked_cast<const ArrayType&>(*array_);
+  }
+};
+
+// Binary values are radix-sorted on their prefix, then compared in full
+template <typename ArrayType>
+class BinarySortColumn : public SortColumn {
+ public:
+  using SortColumn::SortColumn;
+
+  bool exact_normalized_keys() const override { return false; }
+
+ protected:
+  int CompareValues(uint64_t left, uint64_t right) const override {
+    return values().GetView(left).compare(values().GetView(right));
+  }
+
+  void NormalizeValues(const uint64_t* indices, int64_t length,
+                       uint64_t* keys) const override {
+    const ArrayType& array = values();
+    for (int64_t i = 0; i < length; ++i) {
+      keys[i] = NormalizeValue(array.GetView(indices[i]));
+    }
+  }
+
+ private:
+  const ArrayType& values() const {
+    return internal::checked_cast<const ArrayType&>(*array_);
+  }
+};
+
+// Make a column of a sort key of the given type, FixedWidthColumn<ArrayType> or
+// BinaryColumn<ArrayType> constructed from args
+template <typename Column, template <typename> class FixedWidthColumn,
+          template <typename> class BinaryColumn, typename... Args>
+Status MakeColumn(const DataType& type, const SortKey& key, std::unique_ptr<Column>* out,
+                  Args&&... args) {
+  Column* column;
+  switch (type.id()) {
+#define FIXED_WIDTH_CASE(TYPE_CLASS)                                               \
+  case TYPE_CLASS##Type::type_id:                                                  \
+    column = new FixedWidthColumn<TYPE_CLASS##Array>(std::forward<Args>(args)...); \
+    break;
+
+    FIXED_WIDTH_CASE(Boolean)
+    FIXED_WIDTH_CASE(UInt8)
+    FIXED_WIDTH_CASE(Int8)
+    FIXED_WIDTH_CASE(UInt16)
+    FIXED_WIDTH_CASE(Int16)
+    FIXED_WIDTH_CASE(UInt32)
+    FIXED_WIDTH_CASE(Int32)
+    FIXED_WIDTH_CASE(UInt64)
+    FIXED_WIDTH_CASE(Int64)
+    FIXED_WIDTH_CASE(Float)
+    FIXED_WIDTH_CASE(Double)
+    FIXED_WIDTH_CASE(Date32)
+    FIXED_WIDTH_CASE(Date64)
+    FIXED_WIDTH_CASE(Time32)
+    FIXED_WIDTH_CASE(Time64)
+    FIXED_WIDTH_CASE(Timestamp)
+    FIXED_WIDTH_CASE(Duration)
+
+#undef FIXED_WIDTH_CASE
+
+    case Type::BINARY:
+    case Type::STRING:
+      column = new BinaryColumn<BinaryArray>(std::forward<Args>(args)...);
+      break;
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      column = new BinaryColumn<LargeBinaryArray>(std::forward<Args>(args)...);
+      break;
+    case Type::FIXED_SIZE_BINARY:
+      column = new BinaryColumn<FixedSizeBinaryArray>(std::forward<Args>(args)...);
+      break;
+    default:
+      return Status::NotImplemented("Sorting by ", type, " column '", key.name, "'");
+  }
+  out->reset(column);
+  return Status::OK();
+}
+
+Status MakeSortColumn(const std::shared_ptr<Array>& array, const SortKey& key,
+                      SortOptions::NullPlacement null_placement,
+                      std::unique_ptr<SortColumn>* out) {
+  return MakeColumn<SortColumn, FixedWidthSortColumn, BinarySortColumn>(
+      *array->type(), key, out, array, key, null_placement);
+}
+
+// Stable LSD radix sort of indices by keys, 8 bits at a time
+void RadixSort(uint64_t* keys, uint64_t* indices, int64_t length, uint64_t* keys_tmp,
+               uint64_t* indices_tmp) {
+  constexpr int kNumDigits = 8;
+  constexpr int kNumBuckets = 256;
+  std::vector<int64_t> counts(kNumDigits * kNumBuckets, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    const uint64_t key = keys[i];
+    for (int digit = 0; digit < kNumDigits; ++digit) {
+      ++counts[digit * kNumBuckets + ((key >> (8 * digit)) & 0xff)];
+    }
+  }
+
+  uint64_t* src_keys = keys;
+  uint64_t* src_indices = indices;
+  uint64_t* dst_keys = keys_tmp;
+  uint64_t* dst_indices = indices_tmp;
+  for (int digit = 0; digit < kNumDigits; ++digit) {
+    const int shift = 8 * digit;
+    int64_t* offsets = counts.data() + digit * kNumBuckets;
+    // Skip digits which are the same for all keys, e.g. the high bytes of
+    // small integers
+    if (offsets[(src_keys[0] >> shift) & 0xff] == length) {
+      continue;
+    }
+    int64_t offset = 0;
+    for (int bucket = 0; bucket < kNumBuckets; ++bucket) {
+      const int64_t count = offsets[bucket];
+      offsets[bucket] = offset;
+      offset += count;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const uint64_t key = src_keys[i];
+      const int64_t pos = offsets[(key >> shift) & 0xff]++;
+      dst_keys[pos] = key;
+      dst_indices[pos] = src_indices[i];
+    }
+    std::swap(src_keys, dst_keys);
+    std::swap(src_indices, dst_indices);
+  }
+  if (src_keys != keys) {
+    std::copy(src_keys, src_keys + length, keys);
+    std::copy(src_indices, src_indices + length, indices);
+  }
+}
+
+class TableSorter {
+ public:
+  TableSorter(std::vector<std::unique_ptr<SortColumn>> columns, bool nulls_first)
+      : columns_(std::move(columns)), nulls_first_(nulls_first) {}
+
+  Status Sort(uint64_t* indices, int64_t length, bool use_threads) {
+    int num_runs = 1;
+    if (use_threads) {
+      const int64_t max_runs = std::max<int64_t>(length / kMinParallelSortLength, 1);
+      num_runs = static_cast<int>(
+          std::min<int64_t>(internal::GetCpuThreadPool()->GetCapacity(), max_runs));
+    }
+    if (num_runs <= 1) {
+      SortRun(indices, indices + length);
+      return Status::OK();
+    }
+
+    // Sort runs in parallel...
+    std::vector<int64_t> bounds(num_runs + 1);
+    for (int i = 0; i <= num_runs; ++i) {
+      bounds[i] = length * i / num_runs;
+    }
+    RETURN_NOT_OK(internal::ParallelFor(num_runs, [&](int i) {
+      SortRun(indices + bounds[i], indices + bounds[i + 1]);
+      return Status::OK();
+    }));
+
+    // ...then merge adjacent runs pairwise, in parallel, until one is left
+    std::vector<uint64_t> scratch(length);
+    uint64_t* src = indices;
+    uint64_t* dst = scratch.data();
+    auto less = [this](uint64_t left, uint64_t right) {
+      return Compare(left, right) < 0;
+    };
+    while (num_runs > 1) {
+      RETURN_NOT_OK(internal::ParallelFor(num_runs / 2, [&](int i) {
+        // std::merge takes from the first run first on ties, so it is stable
+        std::merge(src + bounds[2 * i], src + bounds[2 * i + 1], src + bounds[2 * i + 1],
+                   src + bounds[2 * i + 2], dst + bounds[2 * i], less);
+        return Status::OK();
+      }));
+      if (num_runs % 2 == 1) {
+        std::copy(src + bounds[num_runs - 1], src + bounds[num_runs],
+                  dst + bounds[num_runs - 1]);
+      }
+      std::vector<int64_t> merged_bounds;
+      for (int i = 0; i < num_runs; i += 2) {
+        merged_bounds.push_back(bounds[i]);
+      }
+      merged_bounds.push_back(length);
+      bounds = std::move(merged_bounds);
+      num_runs = static_cast<int>(bounds.size()) - 1;
+      std::swap(src, dst);
+    }
+    if (src != indices) {
+      std::copy(src, src + length, indices);
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Compare rows on the columns from first_column on
+  int Compare(uint64_t left, uint64_t right, size_t first_column = 0) const {
+    for (size_t i = first_column; i < columns_.size(); ++i) {
+      const int result = columns_[i]->Compare(left, right);
+      if (result != 0) {
+        return result;
+      }
+    }
+    return 0;
+  }
+
+  // Stable sort of rows which are equal on the columns before first_column
+  void SortTies(uint64_t* begin, uint64_t* end, size_t first_column) const {
+    if (end - begin > 1 && first_column < columns_.size()) {
+      std::stable_sort(begin, end, [&](uint64_t left, uint64_t right) {
+        return Compare(left, right, first_column) < 0;
+      });
+    }
+  }
+
+  void SortRun(uint64_t* begin, uint64_t* end) const {
+    if (end - begin < kMinRadixSortLength) {
+      SortTies(begin, end, 0);
+      return;
+    }
+    const SortColumn& first = *columns_[0];
+    uint64_t* values_begin = begin;
+    uint64_t* values_end = end;
+    if (first.has_nulls()) {
+      if (nulls_first_) {
+        values_begin = std::stable_partition(
+            begin, end, [&](uint64_t index) { return first.IsNull(index); });
+        SortTies(begin, values_begin, 1);
+      } else {
+        values_end = std::stable_partition(
+            begin, end, [&](uint64_t index) { return !first.IsNull(index); });
+        SortTies(values_end, end, 1);
+      }
+    }
+    const int64_t length = values_end - values_begin;
+    if (length == 0) {
+      return;
+    }
+
+    std::vector<uint64_t> keys(length);
+    std::vector<uint64_t> keys_tmp(length);
+    std::vector<uint64_t> indices_tmp(length);
+    first.Normalize(values_begin, length, keys.data());
+    RadixSort(keys.data(), values_begin, length, keys_tmp.data(), indices_tmp.data());
+
+    // Rows with equal keys are ordered by the remaining columns, and by the
+    // full values of the first one if the keys are only prefixes
+    const size_t first_column = first.exact_normalized_keys() ? 1 : 0;
+    if (first_column == columns_.size()) {
+      return;
+    }
+    int64_t ties_begin = 0;
+    for (int64_t i = 1; i <= length; ++i) {
+      if (i == length || keys[i] != keys[ties_begin]) {
+        SortTies(values_begin + ties_begin, values_begin + i, first_column);
+        ties_begin = i;
+      }
+    }
+  }
+
+  std::vector<std::unique_ptr<SortColumn>> columns_;
+  const bool nulls_first_;
+};
+
+Status CombineChunks(FunctionContext* ctx, const ChunkedArray& chunked_array,
+                     std::shared_ptr<Array>* out) {
+  if (chunked_array.num_chunks() == 1) {
+    *out = chunked_array.chunk(0);
+    return Status::OK();
+  }
+  if (chunked_array.num_chunks() == 0) {
+    return MakeArrayOfNull(chunked_array.type(), 0, out);
+  }
+  return Concatenate(chunked_array.chunks(), ctx->memory_pool(), out);
+}
+
+// A sort key column of the current batch of each merged input
+class MergeColumn {
+ public:
+  MergeColumn(const SortKey& key, SortOptions::NullPlacement null_placement,
+              int num_inputs)
+      : arrays_(num_inputs),
+        descending_(key.order == SortKey::DESCENDING),
+        nulls_first_(null_placement == SortOptions::NULLS_AT_START) {}
+
+  virtual ~MergeColumn() = default;
+
+  void SetArray(int input, std::shared_ptr<Array> array) {
+    arrays_[input] = std::move(array);
+  }
+
+  bool IsNull(int input, int64_t index) const { return arrays_[input]->IsNull(index); }
+
+  // Negative if the left row sorts first, positive if the right one does
+  int Compare(int left_input, int64_t left, int right_input, int64_t right) const {
+    const Array& left_array = *arrays_[left_input];
+    const Array& right_array = *arrays_[right_input];
+    const bool left_null = left_array.IsNull(left);
+    const bool right_null = right_array.IsNull(right);
+    if (left_null || right_null) {
+      if (left_null == right_null) {
+        return 0;
+      }
+      return left_null == nulls_first_ ? -1 : 1;
+    }
+    const int result = CompareValues(left_array, left, right_array, right);
+    return descending_ ? -result : result;
+  }
+
+  // Write the normalized keys of all the rows of the array of an input.  The
+  // keys of null rows are unspecified.
+  void Normalize(int input, uint64_t* keys) const {
+    const Array& array = *arrays_[input];
+    NormalizeValues(array, keys);
+    if (descending_) {
+      for (int64_t i = 0; i < array.length(); ++i) {
+        keys[i] = ~keys[i];
+      }
+    }
+  }
+
+  // Whether rows with equal normalized keys have equal values
+  virtual bool exact_normalized_keys() const = 0;
+
+ protected:
+  virtual int CompareValues(const Array& left_array, int64_t left,
+                            const Array& right_array, int64_t right) const = 0;
+
+  virtual void NormalizeValues(const Array& array, uint64_t* keys) const = 0;
+
+  std::vector<std::shared_ptr<Array>> arrays_;
+  const bool descending_;
+  const bool nulls_first_;
+};
+
+template <typename ArrayType>
+class FixedWidthMergeColumn : public MergeColumn {
+ public:
+  using MergeColumn::MergeColumn;
+
+  bool exact_normalized_keys() const override { return true; }
+
+ protected:
+  int CompareValues(const Array& left_array, int64_t left, const Array& right_array,
+                    int64_t right) const override {
+    const uint64_t left_key =
+        NormalizeValue(internal::checked_cast<const ArrayType&>(left_array).Value(left));
+    const uint64_t right_key = NormalizeValue(
+        internal::checked_cast<const ArrayType&>(right_array).Value(right));
+    return left_key < right_key ? -1 : (left_key > right_key ? 1 : 0);
+  }
+
+  void NormalizeValues(const Array& array, uint64_t* keys) const override {
+    const auto& values = internal::checked_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < values.length(); ++i) {
+      keys[i] = NormalizeValue(values.Value(i));
+    }
+  }
+};
+
+template <typename ArrayType>
+class BinaryMergeColumn : public MergeColumn {
+ public:
+  using MergeColumn::MergeColumn;
+
+  bool exact_normalized_keys() const override { return false; }
+
+ protected:
+  int CompareValues(const Array& left_array, int64_t left, const Array& right_array,
+                    int64_t right) const override {
+    return internal::checked_cast<const ArrayType&>(left_array)
+        .GetView(left)
+        .compare(internal::checked_cast<const ArrayType&>(right_array).GetView(right));
+  }
+
+  void NormalizeValues(const Array& array, uint64_t* keys) const override {
+    const auto& values = internal::checked_cast<const ArrayType&>(array);
+    for (int64_t i = 0; i < values.length(); ++i) {
+      keys[i] = NormalizeValue(values.GetView(i));
+    }
+  }
+};
+
+// Check that all inputs have the same schema, holding the sort keys, and
+// return the indices of the sort key fields
+Status CheckMergeInputs(const std::vector<std::shared_ptr<Schema>>& schemas,
+                        const SortOptions& options, std::vector<int>* key_fields) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify at least one sort key");
+  }
+  for (const auto& schema : schemas) {
+    if (!schema->Equals(*schemas[0])) {
+      return Status::Invalid("Cannot merge inputs of different schemas: ",
+                             schemas[0]->ToString(), " and ", schema->ToString());
+    }
+  }
+  for (const auto& key : options.sort_keys) {
+    const int index = schemas[0]->GetFieldIndex(key.name);
+    if (index < 0) {
+      return Status::Invalid("No single column named '", key.name, "' to sort by");
+    }
+    key_fields->push_back(index);
+  }
+  return Status::OK();
+}
+
+/// \brief Merge inputs sorted by the same keys, a row at a time
+///
+/// The inputs are the leaves of a tree of losers: each inner node holds the
+/// input which lost the comparison between the winners of its two subtrees,
+/// and the root the overall winner, the input of the next row.  Once that row
+/// is consumed, the input's next row only needs to be replayed against the
+/// losers on the path to the root, in log2(number of inputs) comparisons.
+///
+/// Rows are compared on the normalized keys of their first sort key, which
+/// are computed a batch at a time, then on their values if the keys are
+/// equal or only prefixes.  Ties are won by the first input, so that the
+/// merge is stable.
+class SortedMerger {
+ public:
+  static Status Make(std::vector<std::shared_ptr<RecordBatchReader>> inputs,
+                     const SortOptions& options, std::unique_ptr<SortedMerger>* out) {
+    std::vector<std::shared_ptr<Schema>> schemas;
+    for (const auto& input : inputs) {
+      schemas.push_back(input->schema());
+    }
+    std::unique_ptr<SortedMerger> merger(new SortedMerger(std::move(inputs)));
+    RETURN_NOT_OK(CheckMergeInputs(schemas, options, &merger->key_fields_));
+    const int num_inputs = static_cast<int>(merger->inputs_.size());
+    for (size_t i = 0; i < options.sort_keys.size(); ++i) {
+      const SortKey& key = options.sort_keys[i];
+      std::unique_ptr<MergeColumn> column;
+      RETURN_NOT_OK((MakeColumn<MergeColumn, FixedWidthMergeColumn, BinaryMergeColumn>(
+          *schemas[0]->field(merger->key_fields_[i])->type(), key, &column, key,
+          options.null_placement, num_inputs)));
+      merger->columns_.push_back(std::move(column));
+    }
+    merger->exact_first_keys_ = merger->columns_[0]->exact_normalized_keys();
+    for (int i = 0; i < num_inputs; ++i) {
+      RETURN_NOT_OK(merger->ReadBatch(i));
+    }
+    merger->tree_.assign(num_inputs, -1);
+    for (int i = 0; i < num_inputs; ++i) {
+      merger->Replay(i);
+    }
+    *out = std::move(merger);
+    return Status::OK();
+  }
+
+  /// The input of the next row, or -1 once all the inputs are exhausted
+  int top() const {
+    const int input = tree_[0];
+    return cursors_[input].batch == NULLPTR ? -1 : input;
+  }
+
+  /// The current batch of an input, and the index of its next row in it
+  const std::shared_ptr<RecordBatch>& batch(int input) const {
+    return cursors_[input].batch;
+  }
+  int64_t index(int input) const { return cursors_[input].index; }
+
+  /// The index of the next row of an input among all its rows
+  int64_t row(int input) const {
+    return cursors_[input].batch_offset + cursors_[input].index;
+  }
+
+  /// Consume the next row
+  Status Pop() {
+    const int input = tree_[0];
+    Cursor& cursor = cursors_[input];
+    if (++cursor.index == cursor.batch->num_rows()) {
+      RETURN_NOT_OK(ReadBatch(input));
+    } else {
+      LoadHead(input);
+    }
+    Replay(input);
+    return Status::OK();
+  }
+
+ private:
+  struct Cursor {
+    // Null once the input is exhausted
+    std::shared_ptr<RecordBatch> batch;
+    int64_t index = 0;
+    // The number of rows of the input before batch
+    int64_t batch_offset = 0;
+    // The normalized keys of the first sort key of batch
+    std::vector<uint64_t> keys;
+    // The normalized key of the next row, unless its first sort key is null
+    uint64_t head_key = 0;
+    bool head_null = false;
+  };
+
+  explicit SortedMerger(std::vector<std::shared_ptr<RecordBatchReader>> inputs)
+      : inputs_(std::move(inputs)), cursors_(inputs_.size()) {}
+
+  // Read the next non-empty batch of an input
+  Status ReadBatch(int input) {
+    Cursor& cursor = cursors_[input];
+    if (cursor.batch != NULLPTR) {
+      cursor.batch_offset += cursor.batch->num_rows();
+    }
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      RETURN_NOT_OK(inputs_[input]->ReadNext(&batch));
+    } while (batch != NULLPTR && batch->num_rows() == 0);
+    cursor.batch = std::move(batch);
+    cursor.index = 0;
+    if (cursor.batch == NULLPTR) {
+      return Status::OK();
+    }
+    for (size_t i = 0; i < columns_.size(); ++i) {
+      columns_[i]->SetArray(input, cursor.batch->column(key_fields_[i]));
+    }
+    cursor.keys.resize(cursor.batch->num_rows());
+    columns_[0]->Normalize(input, cursor.keys.data());
+    LoadHead(input);
+    return Status::OK();
+  }
+
+  void LoadHead(int input) {
+    Cursor& cursor = cursors_[input];
+    cursor.head_key = cursor.keys[cursor.index];
+    cursor.head_null = columns_[0]->IsNull(input, cursor.index);
+  }
+
+  // Whether the next row of the left input comes before that of the right one
+  bool Less(int left, int right) const {
+    const Cursor& left_cursor = cursors_[left];
+    const Cursor& right_cursor = cursors_[right];
+    // Exhausted inputs sort last
+    if (left_cursor.batch == NULLPTR || right_cursor.batch == NULLPTR) {
+      return right_cursor.batch == NULLPTR &&
+             (left_cursor.batch != NULLPTR || left < right);
+    }
+    size_t first_column = 0;
+    if (!left_cursor.head_null && !right_cursor.head_null) {
+      if (left_cursor.head_key != right_cursor.head_key) {
+        return left_cursor.head_key < right_cursor.head_key;
+      }
+      first_column = exact_first_keys_ ? 1 : 0;
+    }
+    for (size_t i = first_column; i < columns_.size(); ++i) {
+      const int result =
+          columns_[i]->Compare(left, left_cursor.index, right, right_cursor.index);
+      if (result != 0) {
+        return result < 0;
+      }
+    }
+    return left < right;
+  }
+
+  // Play the next row of an input against the losers up to the root.  While
+  // the tree is being built, the winner stops at the first empty node.
+  void Replay(int input) {
+    const int num_inputs = static_cast<int>(tree_.size());
+    int winner = input;
+    for (int node = (input + num_inputs) / 2; node > 0; node /= 2) {
+      int& loser = tree_[node];
+      if (loser < 0) {
+        loser = winner;
+        return;
+      }
+      if (Less(loser, winner)) {
+        std::swap(loser, winner);
+      }
+    }
+    tree_[0] = winner;
+  }
+
+  std::vector<std::shared_ptr<RecordBatchReader>> inputs_;
+  std::vector<Cursor> cursors_;
+  std::vector<int> key_fields_;
+  std::vector<std::unique_ptr<MergeColumn>> columns_;
+  bool exact_first_keys_ = false;
+  // tree_[0] is the winner, tree_[1:] the losers of the inner nodes, the
+  // children of node i being nodes 2 * i and 2 * i + 1.  Input i is leaf
+  // node num_inputs + i.
+  std::vector<int> tree_;
+};
+
+// Concatenate batches of the same schema into one
+Status ConcatenateBatches(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                          const std::vector<std::shared_ptr<RecordBatch>>& batches,
+                          std::shared_ptr<RecordBatch>* out) {
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    ArrayVector chunks;
+    for (const auto& batch : batches) {
+      chunks.push_back(batch->column(i));
+    }
+    RETURN_NOT_OK(Concatenate(chunks, ctx->memory_pool(), &columns[i]));
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(columns));
+  return Status::OK();
+}
+
+/// \brief Yield the merged rows of sorted inputs, in batches
+///
+/// The rows of an output batch are gathered from slices of the input batches,
+/// as the rows of an input batch which end up in an output batch are
+/// consecutive.  A slice is output as is if it makes the whole output batch,
+/// and slices are only concatenated if their rows don't interleave.
+class SortedMergeReader : public RecordBatchReader {
+ public:
+  SortedMergeReader(FunctionContext* ctx, std::shared_ptr<Schema> schema, int num_inputs,
+                    std::unique_ptr<SortedMerger> merger, int64_t batch_size)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        num_inputs_(num_inputs),
+        merger_(std::move(merger)),
+        batch_size_(batch_size) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::vector<std::shared_ptr<RecordBatch>> slices;
+    std::vector<int64_t> slice_offsets;
+    // The current slice of each input
+    std::vector<int> input_slices(num_inputs_, -1);
+    // The slice of each output row, and its index in the slice's batch
+    std::vector<int> row_slices;
+    std::vector<int64_t> row_indices;
+    bool interleaved = false;
+    int input;
+    while (static_cast<int64_t>(row_slices.size()) < batch_size_ &&
+           (input = merger_->top()) >= 0) {
+      const auto& batch = merger_->batch(input);
+      int& slice = input_slices[input];
+      if (slice < 0 || slices[slice] != batch) {
+        slice = static_cast<int>(slices.size());
+        slices.push_back(batch);
+        slice_offsets.push_back(merger_->index(input));
+      }
+      interleaved = interleaved || (!row_slices.empty() && slice < row_slices.back());
+      row_slices.push_back(slice);
+      row_indices.push_back(merger_->index(input));
+      RETURN_NOT_OK(merger_->Pop());
+    }
+
+    const int64_t length = static_cast<int64_t>(row_slices.size());
+    if (length == 0) {
+      *out = NULLPTR;
+      return Status::OK();
+    }
+    std::vector<int64_t> slice_lengths(slices.size(), 0);
+    for (int slice : row_slices) {
+      ++slice_lengths[slice];
+    }
+    for (size_t i = 0; i < slices.size(); ++i) {
+      slices[i] = slices[i]->Slice(slice_offsets[i], slice_lengths[i]);
+    }
+    if (slices.size() == 1) {
+      *out = std::move(slices[0]);
+      return Status::OK();
+    }
+    std::shared_ptr<RecordBatch> combined;
+    RETURN_NOT_OK(ConcatenateBatches(ctx_, schema_, slices, &combined));
+    if (!interleaved) {
+      *out = std::move(combined);
+      return Status::OK();
+    }
+
+    // The rows of the combined batch at which each slice starts
+    std::vector<int64_t> slice_starts(slices.size(), 0);
+    for (size_t i = 1; i < slices.size(); ++i) {
+      slice_starts[i] = slice_starts[i - 1] + slice_lengths[i - 1];
+    }
+    std::shared_ptr<Buffer> indices_buf;
+    RETURN_NOT_OK(
+        AllocateBuffer(ctx_->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+    auto indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+    for (int64_t i = 0; i < length; ++i) {
+      const int slice = row_slices[i];
+      indices[i] = slice_starts[slice] + row_indices[i] - slice_offsets[slice];
+    }
+    UInt64Array indices_array(length, indices_buf);
+    std::vector<std::shared_ptr<Array>> columns(schema_->num_fields());
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      RETURN_NOT_OK(
+          Take(ctx_, *combined->column(i), indices_array, TakeOptions(), &columns[i]));
+    }
+    *out = RecordBatch::Make(schema_, length, std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  const int num_inputs_;
+  std::unique_ptr<SortedMerger> merger_;
+  const int64_t batch_size_;
+};
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets) {
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify at least one sort key");
+  }
+  std::vector<std::unique_ptr<SortColumn>> columns;
+  for (const auto& key : options.sort_keys) {
+    const int index = table.schema()->GetFieldIndex(key.name);
+    if (index < 0) {
+      return Status::Invalid("No single column named '", key.name, "' to sort by");
+    }
+    std::shared_ptr<Array> array;
+    RETURN_NOT_OK(CombineChunks(ctx, *table.column(index), &array));
+    std::unique_ptr<SortColumn> column;
+    RETURN_NOT_OK(MakeSortColumn(array, key, options.null_placement, &column));
+    columns.push_back(std::move(column));
+  }
+
+  const int64_t length = table.num_rows();
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  uint64_t* indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  std::iota(indices, indices + length, 0);
+
+  TableSorter sorter(std::move(columns),
+                     options.null_placement == SortOptions::NULLS_AT_START);
+  RETURN_NOT_OK(sorter.Sort(indices, length, options.use_threads));
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets) {
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns[i] = batch.column(i);
+  }
+  auto table = Table::Make(batch.schema(), columns, batch.num_rows());
+  return SortToIndices(ctx, *table, options, offsets);
+}
+
+Status MergeIndices(FunctionContext* ctx,
+                    const std::vector<std::shared_ptr<Table>>& tables,
+                    const SortOptions& options, std::shared_ptr<Array>* offsets) {
+  std::vector<std::shared_ptr<RecordBatchReader>> inputs;
+  std::vector<int64_t> table_offsets;
+  int64_t length = 0;
+  for (const auto& table : tables) {
+    inputs.push_back(std::make_shared<TableBatchReader>(*table));
+    table_offsets.push_back(length);
+    length += table->num_rows();
+  }
+  std::shared_ptr<Buffer> indices_buf;
+  RETURN_NOT_OK(
+      AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t), &indices_buf));
+  auto indices = reinterpret_cast<uint64_t*>(indices_buf->mutable_data());
+  if (!tables.empty()) {
+    std::unique_ptr<SortedMerger> merger;
+    RETURN_NOT_OK(SortedMerger::Make(std::move(inputs), options, &merger));
+    int input;
+    while ((input = merger->top()) >= 0) {
+      *indices++ = table_offsets[input] + merger->row(input);
+      RETURN_NOT_OK(merger->Pop());
+    }
+  }
+  *offsets = std::make_shared<UInt64Array>(length, indices_buf);
+  return Status::OK();
+}
+
+Status MergeSorted(FunctionContext* ctx,
+                   const std::vector<std::shared_ptr<RecordBatchReader>>& inputs,
+                   const SortOptions& options, int64_t batch_size,
+                   std::shared_ptr<RecordBatchReader>* out) {
+  if (inputs.empty()) {
+    return Status::Invalid("Must merge at least one input");
+  }
+  if (batch_size <= 0) {
+    return Status::Invalid("Batch size must be positive, got ", batch_size);
+  }
+  std::unique_ptr<SortedMerger> merger;
+  RETURN_NOT_OK(SortedMerger::Make(inputs, options, &merger));
+  *out = std::make_shared<SortedMergeReader>(ctx, inputs[0]->schema(),
+                                             static_cast<int>(inputs.size()),
+                                             std::move(merger), batch_size);
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,9 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
@@ -26,6 +29,9 @@
 namespace arrow {
 
 class Array;
+class RecordBatch;
+class RecordBatchReader;
+class Table;
 
 namespace compute {
 
@@ -47,5 +53,151 @@ ARROW_EXPORT
 Status SortToIndices(FunctionContext* ctx, const Array& values,
                      std::shared_ptr<Array>* offsets);
 
+/// \brief Returns indices that partition an array around its n-th element.
+///
+/// Perform an indirect partial sort of array, in linear time on average.
+/// The output array contains indices such that the value at output[n] is the
+/// value which would be at position n in the sorted array.  Values at
+/// positions before n are less or equal to it, and values at positions after
+/// n are greater or equal.  As in SortToIndices, nulls are placed at the end.
+///
+/// For example given values = [null, 5, 1, 3, null, 4] and n = 2, the output
+/// may be [2, 3, 5, 1, 0, 4] or [3, 2, 5, 1, 4, 0]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values array to partition
+/// \param[in] n the position of the partition point, at most values.length()
+/// \param[out] offsets indices that would partition the array
+ARROW_EXPORT
+Status PartitionNthIndices(FunctionContext* ctx, const Array& values, int64_t n,
+                           std::shared_ptr<Array>* offsets);
+
+/// \brief A column to sort by and the order to sort it in
+struct ARROW_EXPORT SortKey {
+  enum Order { ASCENDING, DESCENDING };
+
+  explicit SortKey(std::string name, Order order = ASCENDING)
+      : name(std::move(name)), order(order) {}
+
+  /// The name of the column
+  std::string name;
+  Order order;
+};
+
+/// \class SortOptions
+///
+/// Controls how SortToIndices sorts the rows of a table.
+struct ARROW_EXPORT SortOptions {
+  enum NullPlacement { NULLS_AT_END, NULLS_AT_START };
+
+  SortOptions() = default;
+
+  explicit SortOptions(std::vector<SortKey> sort_keys)
+      : sort_keys(std::move(sort_keys)) {}
+
+  /// The columns to sort by, by decreasing significance
+  std::vector<SortKey> sort_keys;
+
+  /// Where nulls are placed, whatever the order of their column
+  NullPlacement null_placement = NULLS_AT_END;
+
+  /// If true, slices of the rows are sorted on the CPU thread pool, then
+  /// merged.
+  bool use_threads = true;
+};
+
+/// \brief Returns the indices that would sort the rows of a table.
+///
+/// Rows are ordered by the values of the first sort key, then by those of
+/// the next one for rows with equal values, and so on.  The sort is stable:
+/// rows with equal values for all sort keys keep their original order.
+///
+/// Numeric, temporal, boolean and binary-like columns are supported.
+/// Floating-point values are totally ordered, with -0.0 before 0.0 and NaN
+/// after infinity (or before negative infinity for NaN with the sign bit set).
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table the table to sort
+/// \param[in] options the sort keys and null placement
+/// \param[out] offsets indices that would sort the rows, as a UInt64Array
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const Table& table, const SortOptions& options,
+                     std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would sort the rows of a record batch.
+///
+/// \see SortToIndices(FunctionContext*, const Table&, const SortOptions&,
+/// std::shared_ptr<Array>*)
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* ctx, const RecordBatch& batch,
+                     const SortOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \brief Returns the indices that would merge the rows of tables sorted by
+/// the same keys.
+///
+/// Each table must be sorted as by SortToIndices with the given options; the
+/// order of the output is unspecified otherwise.  The tables are merged
+/// without being sorted again, in O(n log k) comparisons for n rows and k
+/// tables.  The merge is stable: rows with equal values for all sort keys
+/// come in table order, then in row order.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] tables the sorted tables, of the same schema
+/// \param[in] options the sort keys and null placement the tables are sorted by
+/// \param[out] offsets indices of the merged rows in the concatenation of the
+/// tables, as a UInt64Array
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MergeIndices(FunctionContext* ctx,
+                    const std::vector<std::shared_ptr<Table>>& tables,
+                    const SortOptions& options, std::shared_ptr<Array>* offsets);
+
+/// \brief Merge streams of record batches sorted by the same keys.
+///
+/// As MergeIndices, but the inputs are read a batch at a time as the merged
+/// rows are read, in batches of at most batch_size rows.  Runs of rows from a
+/// single input batch are output without being copied.
+///
+/// \param[in] ctx the FunctionContext, which must outlive the reader
+/// \param[in] inputs the sorted inputs, of the same schema
+/// \param[in] options the sort keys and null placement the inputs are sorted by
+/// \param[in] batch_size the maximum number of rows of the output batches
+/// \param[out] out a reader of the merged rows
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MergeSorted(FunctionContext* ctx,
+                   const std::vector<std::shared_ptr<RecordBatchReader>>& inputs,
+                   const SortOptions& options, int64_t batch_size,
+                   std::shared_ptr<RecordBatchReader>* out);
+
+/// \brief Returns the indices of the k first values in the given order.
+///
+/// This is equivalent to taking the first k indices from a stable sort of
+/// values, with nulls at the end, but runs in linear time for a fixed k.
+/// Only if there are fewer than k non-null values are nulls included.
+///
+/// For example given values = [null, 5, 1, 3, 5], k = 3 and a descending
+/// order, the output will be [1, 4, 3]
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values Array or ChunkedArray to select from; indices of a
+/// ChunkedArray refer to its logical position, across chunks
+/// \param[in] k the maximum number of indices to return
+/// \param[in] order whether to select the smallest or the largest values
+/// \param[out] offsets indices of the selected values, in sorted order
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopKIndices(FunctionContext* ctx, const Datum& values, int64_t k,
+                   SortKey::Order order, std::shared_ptr<Array>* offsets);
+
 }  // namespace compute
 }  // namespace arrow
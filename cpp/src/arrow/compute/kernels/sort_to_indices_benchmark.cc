@@ -18,9 +18,11 @@
 #include "benchmark/benchmark.h"
 
 #include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
 
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 
@@ -55,5 +57,151 @@ BENCHMARK(SortToIndicesInt64)
     ->Args({1 << 23, 1})
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
+
+static void SortToIndicesString(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / 16;
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.String(array_size, 0, 32, args.null_proportion);
+
+  SortToIndicesBenchmark(state, values);
+}
+
+BENCHMARK(SortToIndicesString)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+// Select the 100 largest values, as opposed to sorting all of them above
+static void TopKIndicesInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -1000000, 1000000, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(TopKIndices(&ctx, values, 100, SortKey::DESCENDING, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void PartitionNthIndicesInt64(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -1000000, 1000000, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(PartitionNthIndices(&ctx, *values, array_size / 2, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+BENCHMARK(TopKIndicesInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+BENCHMARK(PartitionNthIndicesInt64)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
+static void SortTableToIndicesBenchmark(benchmark::State& state,
+                                        const std::shared_ptr<Table>& table,
+                                        const SortOptions& options) {
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(SortToIndices(&ctx, *table, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * table->num_rows());
+}
+
+// Sort by a low-cardinality integer column, then by a string column
+static void SortTableToIndicesInt64String(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto ints = rand.Int64(num_rows, -100, 100, /*null_probability=*/0.01);
+  auto strings = rand.String(num_rows, 0, 16, /*null_probability=*/0.01);
+  auto table = Table::Make(schema({field("ints", int64()), field("strings", utf8())}),
+                           {ints, strings});
+
+  SortOptions options({SortKey("ints"), SortKey("strings", SortKey::DESCENDING)});
+  options.use_threads = state.range(1) != 0;
+  SortTableToIndicesBenchmark(state, table, options);
+}
+
+static void SortTableToIndicesDouble(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto doubles = rand.Float64(num_rows, -1e9, 1e9, /*null_probability=*/0.01);
+  auto table = Table::Make(schema({field("doubles", float64())}), {doubles});
+
+  SortOptions options({SortKey("doubles")});
+  options.use_threads = state.range(1) != 0;
+  SortTableToIndicesBenchmark(state, table, options);
+}
+
+BENCHMARK(SortTableToIndicesInt64String)
+    ->ArgNames({"rows", "use_threads"})
+    ->Args({1 << 20, 0})
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+BENCHMARK(SortTableToIndicesDouble)
+    ->ArgNames({"rows", "use_threads"})
+    ->Args({1 << 20, 0})
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
+// Merge sorted tables of doubles, as opposed to sorting their concatenation
+static void MergeIndicesDouble(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int num_tables = static_cast<int>(state.range(1));
+  auto rand = random::RandomArrayGenerator(kSeed);
+  SortOptions options({SortKey("doubles")});
+  FunctionContext ctx;
+  std::vector<std::shared_ptr<Table>> tables;
+  for (int i = 0; i < num_tables; ++i) {
+    auto doubles =
+        rand.Float64(num_rows / num_tables, -1e9, 1e9, /*null_probability=*/0.01);
+    std::shared_ptr<Array> indices, sorted;
+    ABORT_NOT_OK(SortToIndices(&ctx, *doubles, &indices));
+    ABORT_NOT_OK(Take(&ctx, *doubles, *indices, TakeOptions(), &sorted));
+    tables.push_back(Table::Make(schema({field("doubles", float64())}), {sorted}));
+  }
+
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(MergeIndices(&ctx, tables, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+BENCHMARK(MergeIndicesDouble)
+    ->ArgNames({"rows", "tables"})
+    ->Args({1 << 20, 2})
+    ->Args({1 << 20, 16})
+    ->Args({1 << 20, 256})
+    ->Unit(benchmark::TimeUnit::kMillisecond);
+
 }  // namespace compute
 }  // namespace arrow
@@ -15,21 +15,31 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace compute {
 
 template <typename ArrowType>
@@ -100,6 +110,16 @@ TYPED_TEST(TestSortToIndicesKernelForStrings, SortStrings) {
   this->AssertSortToIndices(R"(["foo", "bar", "baz"])", "[1,2,0]");
 
   this->AssertSortToIndices(R"(["testing", "sort", "for", "strings"])", "[2, 1, 3, 0]");
+
+  // Values sharing their first bytes
+  this->AssertSortToIndices(
+      R"(["abcdefghij", "abcdefgh", "abcdefghia", "ab", "abcdefgg", "abcdefghi"])",
+      "[3, 4, 1, 5, 2, 0]");
+
+  // Equal values keep their order, nulls come last
+  this->AssertSortToIndices(
+      R"(["b", "a", "b", "", "a", null, "abcdefghijk", "", "abcdefghijk"])",
+      "[3, 7, 1, 4, 6, 8, 0, 2, 5]");
 }
 
 template <typename ArrowType>
@@ -191,5 +211,438 @@ TYPED_TEST(TestSortToIndicesKernelRandom, SortRandomValues) {
   }
 }
 
+template <typename ArrowType>
+class TestPartitionNthIndicesRandom : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestPartitionNthIndicesRandom, SortToIndicesableTypes);
+
+TYPED_TEST(TestPartitionNthIndicesRandom, PartitionRandomValues) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  Random<TypeParam> rand(0x5487655);
+  const int length = 1000;
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto array = rand.Generate(length, null_probability);
+    const auto& values = checked_cast<const ArrayType&>(*array);
+    for (int64_t n : {0, 1, 500, 999, 1000}) {
+      std::shared_ptr<Array> offsets;
+      ASSERT_OK(PartitionNthIndices(&this->ctx_, *array, n, &offsets));
+      ASSERT_OK(offsets->Validate());
+      ASSERT_EQ(length, offsets->length());
+      const auto& indices = checked_cast<const UInt64Array&>(*offsets);
+      // The output is a permutation
+      std::vector<uint64_t> sorted_indices(indices.raw_values(),
+                                           indices.raw_values() + length);
+      std::sort(sorted_indices.begin(), sorted_indices.end());
+      for (int i = 0; i < length; ++i) {
+        ASSERT_EQ(static_cast<uint64_t>(i), sorted_indices[i]);
+      }
+      if (n == length) {
+        continue;
+      }
+      // Values are partitioned around the n-th one
+      Comparator<ArrayType> compare;
+      const uint64_t nth = indices.Value(n);
+      for (int64_t i = 0; i < length; ++i) {
+        if (i < n) {
+          ASSERT_TRUE(compare(values, indices.Value(i), nth));
+        } else if (i > n) {
+          ASSERT_TRUE(compare(values, nth, indices.Value(i)));
+        }
+      }
+    }
+  }
+}
+
+TEST(TestPartitionNthIndices, Basics) {
+  FunctionContext ctx;
+  std::shared_ptr<Array> offsets;
+  auto values = ArrayFromJSON(int32(), "[null, 5, 1, 3, null, 4]");
+  ASSERT_OK(PartitionNthIndices(&ctx, *values, 2, &offsets));
+  ASSERT_EQ(5, checked_cast<const UInt64Array&>(*offsets).Value(2));
+  ASSERT_OK(PartitionNthIndices(&ctx, *values, 6, &offsets));
+  ASSERT_RAISES(IndexError, PartitionNthIndices(&ctx, *values, 7, &offsets));
+  ASSERT_RAISES(IndexError, PartitionNthIndices(&ctx, *values, -1, &offsets));
+  auto booleans = ArrayFromJSON(boolean(), "[true]");
+  ASSERT_RAISES(NotImplemented, PartitionNthIndices(&ctx, *booleans, 0, &offsets));
+}
+
+class TestTopKIndices : public ComputeFixture, public TestBase {
+ protected:
+  void AssertTopK(const Datum& values, int64_t k, SortKey::Order order,
+                  const std::string& expected) {
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(TopKIndices(&this->ctx_, values, k, order, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+  }
+};
+
+TEST_F(TestTopKIndices, Basics) {
+  auto values = ArrayFromJSON(int32(), "[null, 5, 1, 3, 5]");
+  AssertTopK(values, 3, SortKey::DESCENDING, "[1, 4, 3]");
+  AssertTopK(values, 3, SortKey::ASCENDING, "[2, 3, 1]");
+  AssertTopK(values, 0, SortKey::ASCENDING, "[]");
+  // Nulls only come in if needed
+  AssertTopK(values, 5, SortKey::DESCENDING, "[1, 4, 3, 2, 0]");
+  AssertTopK(values, 10, SortKey::ASCENDING, "[2, 3, 1, 4, 0]");
+
+  auto strings = ArrayFromJSON(utf8(), R"(["b", null, "a", "c", "b"])");
+  AssertTopK(strings, 2, SortKey::ASCENDING, "[2, 0]");
+  AssertTopK(strings, 2, SortKey::DESCENDING, "[3, 0]");
+
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, TopKIndices(&this->ctx_, values, -1, SortKey::ASCENDING, &out));
+}
+
+TEST_F(TestTopKIndices, Chunked) {
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(float64(), "[4, null, 2]"), ArrayFromJSON(float64(), "[]"),
+      ArrayFromJSON(float64(), "[null, 2, 6]"), ArrayFromJSON(float64(), "[1, 4]")});
+  AssertTopK(chunked, 3, SortKey::ASCENDING, "[6, 2, 4]");
+  AssertTopK(chunked, 3, SortKey::DESCENDING, "[5, 0, 7]");
+  AssertTopK(chunked, 8, SortKey::DESCENDING, "[5, 0, 7, 2, 4, 6, 1, 3]");
+
+  auto empty = std::make_shared<ChunkedArray>(ArrayVector{}, int8());
+  AssertTopK(empty, 3, SortKey::DESCENDING, "[]");
+}
+
+TEST_F(TestTopKIndices, Random) {
+  Random<Int16Type> rand(0x5487655);
+  ArrayVector chunks;
+  for (int i = 0; i < 5; ++i) {
+    chunks.push_back(rand.Generate(2000, 0.1));
+  }
+  auto chunked = std::make_shared<ChunkedArray>(chunks);
+  auto table = Table::Make(schema({field("f0", chunked->type())}), {chunked});
+
+  for (auto order : {SortKey::ASCENDING, SortKey::DESCENDING}) {
+    // Reference: the first values of a stable sort
+    std::shared_ptr<Array> sorted;
+    ASSERT_OK(
+        SortToIndices(&this->ctx_, *table, SortOptions({SortKey("f0", order)}), &sorted));
+    for (int64_t k : {1, 10, 100, 3000, 9500, 10000}) {
+      std::shared_ptr<Array> actual;
+      ASSERT_OK(TopKIndices(&this->ctx_, chunked, k, order, &actual));
+      AssertArraysEqual(*sorted->Slice(0, k), *actual);
+    }
+  }
+}
+
+class TestSortTableToIndices : public ComputeFixture, public TestBase {
+ protected:
+  void AssertSortToIndices(const std::shared_ptr<Table>& table,
+                           const SortOptions& options, const std::string& expected) {
+    for (bool use_threads : {false, true}) {
+      SortOptions thread_options = options;
+      thread_options.use_threads = use_threads;
+      std::shared_ptr<Array> actual;
+      ASSERT_OK(SortToIndices(&this->ctx_, *table, thread_options, &actual));
+      ASSERT_OK(actual->Validate());
+      AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *actual);
+    }
+  }
+
+  std::shared_ptr<Table> MakeTable(const std::vector<std::shared_ptr<Array>>& columns) {
+    std::vector<std::shared_ptr<Field>> fields;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      fields.push_back(field("f" + std::to_string(i), columns[i]->type()));
+    }
+    return Table::Make(schema(fields), columns);
+  }
+};
+
+TEST_F(TestSortTableToIndices, SingleKey) {
+  auto table = MakeTable({ArrayFromJSON(int32(), "[3, null, 1, 2, null, 1]")});
+  SortOptions options({SortKey("f0")});
+  AssertSortToIndices(table, options, "[2, 5, 3, 0, 1, 4]");
+  options.null_placement = SortOptions::NULLS_AT_START;
+  AssertSortToIndices(table, options, "[1, 4, 2, 5, 3, 0]");
+  options.sort_keys = {SortKey("f0", SortKey::DESCENDING)};
+  AssertSortToIndices(table, options, "[1, 4, 0, 3, 2, 5]");
+  options.null_placement = SortOptions::NULLS_AT_END;
+  AssertSortToIndices(table, options, "[0, 3, 2, 5, 1, 4]");
+}
+
+TEST_F(TestSortTableToIndices, MultipleKeys) {
+  auto table = MakeTable(
+      {ArrayFromJSON(int64(), "[1, 2, 1, null, 2, 1, null]"),
+       ArrayFromJSON(utf8(), R"(["b", "a", "a", "x", null, "b", "w"])"),
+       ArrayFromJSON(float64(), "[1.5, 2.0, 3.0, 4.0, 5.0, -1.5, 7.0]")});
+
+  SortOptions options({SortKey("f0"), SortKey("f1", SortKey::DESCENDING)});
+  AssertSortToIndices(table, options, "[0, 5, 2, 1, 4, 3, 6]");
+  options.sort_keys.emplace_back("f2");
+  AssertSortToIndices(table, options, "[5, 0, 2, 1, 4, 3, 6]");
+  options.null_placement = SortOptions::NULLS_AT_START;
+  AssertSortToIndices(table, options, "[3, 6, 5, 0, 2, 4, 1]");
+  options.sort_keys = {SortKey("f2", SortKey::DESCENDING), SortKey("f0")};
+  AssertSortToIndices(table, options, "[6, 4, 3, 2, 1, 0, 5]");
+}
+
+TEST_F(TestSortTableToIndices, Types) {
+  auto check = [this](const std::shared_ptr<DataType>& type, const std::string& values,
+                      const std::string& expected) {
+    auto table = MakeTable({ArrayFromJSON(type, values)});
+    AssertSortToIndices(table, SortOptions({SortKey("f0")}), expected);
+  };
+  check(boolean(), "[true, null, false, true]", "[2, 0, 3, 1]");
+  check(int8(), "[3, -128, 127, -1]", "[1, 3, 0, 2]");
+  check(uint64(), "[18446744073709551615, 0, 9223372036854775808]", "[1, 2, 0]");
+  check(float32(), "[0.5, -3, -0.5, 3, 0]", "[1, 2, 4, 0, 3]");
+  check(date32(), "[3, 1, 2]", "[1, 2, 0]");
+  check(timestamp(TimeUnit::MILLI), "[3, null, -1]", "[2, 0, 1]");
+  check(binary(), R"(["abcdefgh2", "abcdefgh1", "abcdefgh", "ab"])", "[3, 2, 1, 0]");
+  check(large_utf8(), R"(["b", "", "a"])", "[1, 2, 0]");
+  check(fixed_size_binary(2), R"(["ba", "ab", "bb"])", "[1, 0, 2]");
+}
+
+TEST_F(TestSortTableToIndices, LongStrings) {
+  // Many strings sharing their first 8 bytes
+  std::vector<std::string> values;
+  for (int i = 0; i < 1000; ++i) {
+    values.push_back("prefix_" + std::to_string(i * 7919 % 1000));
+  }
+  std::shared_ptr<Array> strings;
+  ArrayFromVector<StringType, std::string>(values, &strings);
+  auto table = MakeTable({strings, strings});
+
+  std::vector<uint64_t> expected(values.size());
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&](uint64_t left, uint64_t right) {
+    return values[left] > values[right];
+  });
+  std::shared_ptr<Array> expected_array;
+  ArrayFromVector<UInt64Type, uint64_t>(expected, &expected_array);
+
+  SortOptions options({SortKey("f0", SortKey::DESCENDING), SortKey("f1")});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+  AssertArraysEqual(*expected_array, *actual);
+}
+
+TEST_F(TestSortTableToIndices, ChunksAndBatches) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int16(), "[5, 3]"), ArrayFromJSON(int16(), "[4, 1, 2]")});
+  auto table = Table::Make(schema({field("f0", int16())}), {chunked});
+  AssertSortToIndices(table, SortOptions({SortKey("f0")}), "[3, 4, 1, 2, 0]");
+
+  auto batch = RecordBatch::Make(schema({field("f0", utf8())}), 3,
+                                 {ArrayFromJSON(utf8(), R"(["c", "a", "b"])")});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(SortToIndices(&this->ctx_, *batch, SortOptions({SortKey("f0")}), &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 2, 0]"), *actual);
+
+  auto empty = Table::Make(schema({field("f0", int16())}),
+                           {std::make_shared<ChunkedArray>(ArrayVector{}, int16())});
+  AssertSortToIndices(empty, SortOptions({SortKey("f0")}), "[]");
+}
+
+TEST_F(TestSortTableToIndices, Errors) {
+  auto table = MakeTable({ArrayFromJSON(int32(), "[1]"),
+                          ArrayFromJSON(list(int32()), "[[1]]")});
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *table, SortOptions(), &out));
+  ASSERT_RAISES(Invalid, SortToIndices(&this->ctx_, *table,
+                                       SortOptions({SortKey("missing")}), &out));
+  ASSERT_RAISES(NotImplemented,
+                SortToIndices(&this->ctx_, *table, SortOptions({SortKey("f1")}), &out));
+}
+
+TEST_F(TestSortTableToIndices, Random) {
+  // Enough rows to be sorted in several runs with radix sort, then merged
+  constexpr int64_t kLength = 300000;
+  random::RandomArrayGenerator rand(0x5487655);
+  auto ints = rand.Int32(kLength, -100, 100, /*null_probability=*/0.1);
+  auto strings = rand.String(kLength, 0, 10, /*null_probability=*/0.1);
+  auto doubles = rand.Float64(kLength, -1e6, 1e6, /*null_probability=*/0.1);
+  auto table = MakeTable({ints, strings, doubles});
+  SortOptions options({SortKey("f0", SortKey::DESCENDING), SortKey("f1"),
+                       SortKey("f2", SortKey::DESCENDING)});
+
+  // Reference: nulls at the end, stable
+  const auto& int_values = checked_cast<const Int32Array&>(*ints);
+  const auto& string_values = checked_cast<const StringArray&>(*strings);
+  const auto& double_values = checked_cast<const DoubleArray&>(*doubles);
+  auto compare = [](const Array& array, uint64_t left, uint64_t right,
+                    bool descending, int values_compare) {
+    if (array.IsNull(left) || array.IsNull(right)) {
+      return static_cast<int>(array.IsNull(left)) - static_cast<int>(array.IsNull(right));
+    }
+    return descending ? -values_compare : values_compare;
+  };
+  std::vector<uint64_t> expected(kLength);
+  std::iota(expected.begin(), expected.end(), 0);
+  std::stable_sort(expected.begin(), expected.end(), [&](uint64_t left, uint64_t right) {
+    int result = compare(
+        *ints, left, right, true,
+        int_values.Value(left) < int_values.Value(right)
+            ? -1
+            : static_cast<int>(int_values.Value(left) > int_values.Value(right)));
+    if (result == 0) {
+      result = compare(*strings, left, right, false,
+                       string_values.GetView(left).compare(string_values.GetView(right)));
+    }
+    if (result == 0) {
+      result = compare(
+          *doubles, left, right, true,
+          double_values.Value(left) < double_values.Value(right)
+              ? -1
+              : static_cast<int>(double_values.Value(left) > double_values.Value(right)));
+    }
+    return result < 0;
+  });
+  std::shared_ptr<Array> expected_array;
+  ArrayFromVector<UInt64Type, uint64_t>(expected, &expected_array);
+
+  auto thread_pool = internal::GetCpuThreadPool();
+  const int capacity = thread_pool->GetCapacity();
+  ASSERT_OK(thread_pool->SetCapacity(3));
+  for (bool use_threads : {false, true}) {
+    options.use_threads = use_threads;
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(SortToIndices(&this->ctx_, *table, options, &actual));
+    AssertArraysEqual(*expected_array, *actual);
+  }
+  ASSERT_OK(thread_pool->SetCapacity(capacity));
+}
+
+class TestMergeSorted : public TestSortTableToIndices {
+ protected:
+  // Merging sorted tables must be equivalent to a stable sort of their
+  // concatenation
+  void CheckMerge(const std::vector<std::shared_ptr<Table>>& tables,
+                  const SortOptions& options, int64_t batch_size) {
+    std::shared_ptr<Table> concatenated;
+    ASSERT_OK(ConcatenateTables(tables, &concatenated));
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(SortToIndices(&this->ctx_, *concatenated, options, &expected));
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(MergeIndices(&this->ctx_, tables, options, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*expected, *actual);
+
+    auto expected_table = TakeRows(*concatenated, *expected);
+
+    // Read the inputs in small batches, so that they interleave in the output
+    std::vector<std::shared_ptr<RecordBatchReader>> inputs;
+    for (const auto& table : tables) {
+      auto reader = std::make_shared<TableBatchReader>(*table);
+      reader->set_chunksize(batch_size / 2 + 1);
+      inputs.push_back(reader);
+    }
+    std::shared_ptr<RecordBatchReader> merged;
+    ASSERT_OK(MergeSorted(&this->ctx_, inputs, options, batch_size, &merged));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ASSERT_OK(merged->ReadAll(&batches));
+    for (const auto& batch : batches) {
+      ASSERT_OK(batch->Validate());
+      ASSERT_GT(batch->num_rows(), 0);
+      ASSERT_LE(batch->num_rows(), batch_size);
+    }
+    std::shared_ptr<Table> actual_table;
+    ASSERT_OK(Table::FromRecordBatches(concatenated->schema(), batches, &actual_table));
+    AssertTablesEqual(*expected_table, *actual_table, /*same_chunk_layout=*/false);
+  }
+
+  std::shared_ptr<Table> TakeRows(const Table& table, const Array& indices) {
+    std::vector<std::shared_ptr<Array>> columns(table.num_columns());
+    for (int i = 0; i < table.num_columns(); ++i) {
+      ABORT_NOT_OK(
+          Take(&this->ctx_, *table.column(i), indices, TakeOptions(), &columns[i]));
+    }
+    return Table::Make(table.schema(), columns);
+  }
+
+  // Split a table into slices of the given lengths, each sorted
+  std::vector<std::shared_ptr<Table>> SortedSlices(const std::shared_ptr<Table>& table,
+                                                   const SortOptions& options,
+                                                   const std::vector<int64_t>& lengths) {
+    std::vector<std::shared_ptr<Table>> slices;
+    int64_t offset = 0;
+    for (int64_t length : lengths) {
+      auto slice = table->Slice(offset, length);
+      offset += length;
+      std::shared_ptr<Array> indices;
+      ABORT_NOT_OK(SortToIndices(&this->ctx_, *slice, options, &indices));
+      slices.push_back(TakeRows(*slice, *indices));
+    }
+    return slices;
+  }
+};
+
+TEST_F(TestMergeSorted, Basics) {
+  auto left = MakeTable({ArrayFromJSON(int32(), "[1, 3, 3, 5, null]"),
+                         ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e"])")});
+  auto right = MakeTable({ArrayFromJSON(int32(), "[2, 3, 6, null]"),
+                          ArrayFromJSON(utf8(), R"(["f", "g", "h", "i"])")});
+  SortOptions options({SortKey("f0")});
+  std::shared_ptr<Array> actual;
+  ASSERT_OK(MergeIndices(&this->ctx_, {left, right}, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 5, 1, 2, 6, 3, 7, 4, 8]"), *actual);
+  ASSERT_OK(MergeIndices(&this->ctx_, {right, left}, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[4, 0, 1, 5, 6, 7, 2, 3, 8]"), *actual);
+  ASSERT_OK(MergeIndices(&this->ctx_, {left}, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[0, 1, 2, 3, 4]"), *actual);
+  ASSERT_OK(MergeIndices(&this->ctx_, {}, options, &actual));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[]"), *actual);
+
+  for (int64_t batch_size : {1, 2, 3, 100}) {
+    CheckMerge({left, right}, options, batch_size);
+    CheckMerge({left, left->Slice(0, 0), right, left}, options, batch_size);
+  }
+}
+
+TEST_F(TestMergeSorted, Options) {
+  auto table = MakeTable(
+      {ArrayFromJSON(int64(), "[1, 2, 1, null, 2, 1, null, 3, 2, 2]"),
+       ArrayFromJSON(utf8(), R"(["b", "a", "a", "x", null, "b", "w", "c", "a", null])"),
+       ArrayFromJSON(float64(), "[1.5, 2.0, 3.0, 4.0, 5.0, -1.5, 7.0, 1.5, -0.0, 0.0]")});
+  std::vector<SortOptions> all_options = {
+      SortOptions({SortKey("f0"), SortKey("f1", SortKey::DESCENDING)}),
+      SortOptions({SortKey("f1"), SortKey("f2")}),
+      SortOptions({SortKey("f2", SortKey::DESCENDING), SortKey("f0")})};
+  for (auto options : all_options) {
+    for (auto null_placement : {SortOptions::NULLS_AT_END, SortOptions::NULLS_AT_START}) {
+      options.null_placement = null_placement;
+      CheckMerge(SortedSlices(table, options, {4, 3, 3}), options, 2);
+      CheckMerge(SortedSlices(table, options, {1, 9}), options, 4);
+    }
+  }
+}
+
+TEST_F(TestMergeSorted, Random) {
+  random::RandomArrayGenerator rand(0x2c7a91);
+  const int64_t length = 5000;
+  auto ints = rand.Int16(length, -50, 50, /*null_probability=*/0.1);
+  auto strings = rand.String(length, 0, 12, /*null_probability=*/0.1);
+  auto table = MakeTable({ints, strings});
+  SortOptions options({SortKey("f1", SortKey::DESCENDING), SortKey("f0")});
+  auto slices = SortedSlices(table, options, {1000, 17, 2000, 1, 1982});
+  CheckMerge(slices, options, 256);
+  CheckMerge(SortedSlices(table, options, {length}), options, 1000);
+}
+
+TEST_F(TestMergeSorted, Errors) {
+  auto table = MakeTable({ArrayFromJSON(int32(), "[1]"),
+                          ArrayFromJSON(list(int32()), "[[1]]")});
+  auto other = MakeTable({ArrayFromJSON(int64(), "[1]")});
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, MergeIndices(&this->ctx_, {table}, SortOptions(), &out));
+  ASSERT_RAISES(Invalid, MergeIndices(&this->ctx_, {table},
+                                      SortOptions({SortKey("missing")}), &out));
+  ASSERT_RAISES(Invalid, MergeIndices(&this->ctx_, {table, other},
+                                      SortOptions({SortKey("f0")}), &out));
+  ASSERT_RAISES(NotImplemented, MergeIndices(&this->ctx_, {table},
+                                             SortOptions({SortKey("f1")}), &out));
+
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_RAISES(Invalid,
+                MergeSorted(&this->ctx_, {}, SortOptions({SortKey("f0")}), 10, &reader));
+  std::shared_ptr<RecordBatchReader> input = std::make_shared<TableBatchReader>(*table);
+  ASSERT_RAISES(Invalid, MergeSorted(&this->ctx_, {input}, SortOptions({SortKey("f0")}),
+                                     0, &reader));
+}
+
 }  // namespace compute
 }  // namespace arrow
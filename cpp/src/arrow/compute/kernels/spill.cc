@@ -0,0 +1,529 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/spill.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::PlatformFilename;
+using internal::TemporaryDir;
+
+namespace compute {
+
+namespace {
+
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+
+// The size of the buffers of an array, buffers shared by slices being counted
+// once per slice
+int64_t BufferedSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != NULLPTR) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferedSize(*child);
+  }
+  return size;
+}
+
+int64_t BufferedSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += BufferedSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+Status ValidateSpillOptions(const SpillOptions& options) {
+  if (options.memory_limit < 0) {
+    return Status::Invalid("Spill memory limit must be non-negative");
+  }
+  if (options.batch_size <= 0) {
+    return Status::Invalid("Spill batch size must be positive");
+  }
+  return Status::OK();
+}
+
+Status CheckSchema(const Schema& expected, const RecordBatch& batch) {
+  if (!batch.schema()->Equals(expected, /*check_metadata=*/false)) {
+    return Status::Invalid("Batch of schema ", batch.schema()->ToString(),
+                           " doesn't match ", expected.ToString());
+  }
+  return Status::OK();
+}
+
+Status MakeScratchDir(const SpillOptions& options, std::shared_ptr<TemporaryDir>* out) {
+  std::unique_ptr<TemporaryDir> dir;
+  if (options.directory.empty()) {
+    RETURN_NOT_OK(TemporaryDir::Make("arrow-spill-", &dir));
+  } else {
+    PlatformFilename parent;
+    RETURN_NOT_OK(PlatformFilename::FromString(options.directory, &parent));
+    RETURN_NOT_OK(TemporaryDir::Make(parent, "arrow-spill-", &dir));
+  }
+  *out = std::move(dir);
+  return Status::OK();
+}
+
+Status TakeBatch(FunctionContext* ctx, const RecordBatch& batch, const Array& indices,
+                 std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    RETURN_NOT_OK(Take(ctx, *batch.column(i), indices, TakeOptions(), &columns[i]));
+  }
+  *out = RecordBatch::Make(batch.schema(), indices.length(), std::move(columns));
+  return Status::OK();
+}
+
+// The indices of the first num_keys columns
+std::vector<int> KeyIndices(int num_keys) {
+  std::vector<int> keys(num_keys);
+  for (int i = 0; i < num_keys; ++i) {
+    keys[i] = i;
+  }
+  return keys;
+}
+
+Status MakeEmptyArray(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                      std::shared_ptr<Array>* out) {
+  std::unique_ptr<ArrayBuilder> builder;
+  RETURN_NOT_OK(MakeBuilder(pool, type, &builder));
+  return builder->Finish(out);
+}
+
+// Concatenate batches of the same schema into one
+Status CombineBatches(FunctionContext* ctx, const std::shared_ptr<Schema>& schema,
+                      const RecordBatchVector& batches,
+                      std::shared_ptr<RecordBatch>* out) {
+  if (batches.size() == 1) {
+    *out = batches[0];
+    return Status::OK();
+  }
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    num_rows += batch->num_rows();
+  }
+  std::vector<std::shared_ptr<Array>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    ArrayVector chunks;
+    for (const auto& batch : batches) {
+      chunks.push_back(batch->column(i));
+    }
+    if (chunks.empty()) {
+      RETURN_NOT_OK(
+          MakeEmptyArray(ctx->memory_pool(), schema->field(i)->type(), &columns[i]));
+    } else {
+      RETURN_NOT_OK(Concatenate(chunks, ctx->memory_pool(), &columns[i]));
+    }
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(columns));
+  return Status::OK();
+}
+
+/// \brief An IPC file being written in the scratch directory
+class SpillFile {
+ public:
+  static Status Open(TemporaryDir* dir, const std::string& name,
+                     const std::shared_ptr<Schema>& schema, const SpillOptions& options,
+                     std::unique_ptr<SpillFile>* out) {
+    std::unique_ptr<SpillFile> file(new SpillFile);
+    PlatformFilename path;
+    RETURN_NOT_OK(dir->path().Join(name, &path));
+    file->path_ = path.ToString();
+    RETURN_NOT_OK(io::FileOutputStream::Open(file->path_, &file->stream_));
+    auto ipc_options = ipc::IpcOptions::Defaults();
+    ipc_options.compression = options.compression;
+    ARROW_ASSIGN_OR_RAISE(file->writer_, ipc::RecordBatchFileWriter::Open(
+                                             file->stream_.get(), schema, ipc_options));
+    file->batch_size_ = options.batch_size;
+    *out = std::move(file);
+    return Status::OK();
+  }
+
+  // Write a batch in slices of at most batch_size rows
+  Status Write(const RecordBatch& batch) {
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += batch_size_) {
+      RETURN_NOT_OK(writer_->WriteRecordBatch(*batch.Slice(offset, batch_size_)));
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    RETURN_NOT_OK(writer_->Close());
+    return stream_->Close();
+  }
+
+  const std::string& path() const { return path_; }
+
+ private:
+  SpillFile() = default;
+
+  std::string path_;
+  std::shared_ptr<io::OutputStream> stream_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  int64_t batch_size_ = 0;
+};
+
+Status OpenSpilledFile(const std::string& path,
+                       std::shared_ptr<ipc::RecordBatchFileReader>* out) {
+  std::shared_ptr<io::MemoryMappedFile> file;
+  RETURN_NOT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READ, &file));
+  return ipc::RecordBatchFileReader::Open(file, out);
+}
+
+/// \brief Yield the slices of a batch
+class SliceReader : public RecordBatchReader {
+ public:
+  SliceReader(std::shared_ptr<RecordBatch> batch, int64_t batch_size)
+      : batch_(std::move(batch)), batch_size_(batch_size) {}
+
+  std::shared_ptr<Schema> schema() const override { return batch_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (offset_ >= batch_->num_rows()) {
+      *out = NULLPTR;
+      return Status::OK();
+    }
+    *out = batch_->Slice(offset_, batch_size_);
+    offset_ += batch_size_;
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<RecordBatch> batch_;
+  int64_t batch_size_;
+  int64_t offset_ = 0;
+};
+
+/// \brief Read the batches of a spilled run
+class RunReader : public RecordBatchReader {
+ public:
+  static Status Open(const std::string& path, std::shared_ptr<TemporaryDir> dir,
+                     std::shared_ptr<RecordBatchReader>* out) {
+    auto reader = std::make_shared<RunReader>();
+    reader->dir_ = std::move(dir);
+    RETURN_NOT_OK(OpenSpilledFile(path, &reader->reader_));
+    *out = std::move(reader);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (next_batch_ == reader_->num_record_batches()) {
+      *out = NULLPTR;
+      return Status::OK();
+    }
+    return reader_->ReadRecordBatch(next_batch_++, out);
+  }
+
+ private:
+  // Deleted once the runs are closed
+  std::shared_ptr<TemporaryDir> dir_;
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  int next_batch_ = 0;
+};
+
+}  // namespace
+
+//
+// ExternalSorter
+//
+
+class ExternalSorter::Impl {
+ public:
+  Impl(FunctionContext* ctx, std::shared_ptr<Schema> schema, SortOptions options,
+       SpillOptions spill_options)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        options_(std::move(options)),
+        spill_options_(std::move(spill_options)) {}
+
+  Status Consume(const std::shared_ptr<RecordBatch>& batch) {
+    RETURN_NOT_OK(CheckSchema(*schema_, *batch));
+    buffered_.push_back(batch);
+    buffered_size_ += BufferedSize(*batch);
+    if (buffered_size_ > spill_options_.memory_limit) {
+      return SpillRun();
+    }
+    return Status::OK();
+  }
+
+  int num_spilled_runs() const { return static_cast<int>(run_paths_.size()); }
+
+  Status Finish(std::shared_ptr<RecordBatchReader>* out) {
+    if (run_paths_.empty()) {
+      std::shared_ptr<RecordBatch> sorted;
+      RETURN_NOT_OK(SortBuffered(&sorted));
+      *out = std::make_shared<SliceReader>(std::move(sorted), spill_options_.batch_size);
+      return Status::OK();
+    }
+    if (!buffered_.empty()) {
+      RETURN_NOT_OK(SpillRun());
+    }
+    // The runs are merged without being sorted again
+    std::vector<std::shared_ptr<RecordBatchReader>> runs;
+    for (const auto& path : run_paths_) {
+      std::shared_ptr<RecordBatchReader> run;
+      RETURN_NOT_OK(RunReader::Open(path, dir_, &run));
+      runs.push_back(std::move(run));
+    }
+    dir_.reset();
+    return MergeSorted(ctx_, runs, options_, spill_options_.batch_size, out);
+  }
+
+ private:
+  Status SortBuffered(std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<RecordBatch> combined;
+    RETURN_NOT_OK(CombineBatches(ctx_, schema_, buffered_, &combined));
+    buffered_.clear();
+    buffered_size_ = 0;
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(SortToIndices(ctx_, *combined, options_, &indices));
+    return TakeBatch(ctx_, *combined, *indices, out);
+  }
+
+  Status SpillRun() {
+    if (dir_ == NULLPTR) {
+      RETURN_NOT_OK(MakeScratchDir(spill_options_, &dir_));
+    }
+    std::shared_ptr<RecordBatch> sorted;
+    RETURN_NOT_OK(SortBuffered(&sorted));
+    std::unique_ptr<SpillFile> file;
+    RETURN_NOT_OK(SpillFile::Open(dir_.get(), "run-" + std::to_string(run_paths_.size()),
+                                  schema_, spill_options_, &file));
+    RETURN_NOT_OK(file->Write(*sorted));
+    RETURN_NOT_OK(file->Close());
+    run_paths_.push_back(file->path());
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  SortOptions options_;
+  SpillOptions spill_options_;
+  RecordBatchVector buffered_;
+  int64_t buffered_size_ = 0;
+  std::shared_ptr<TemporaryDir> dir_;
+  std::vector<std::string> run_paths_;
+};
+
+ExternalSorter::ExternalSorter(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+ExternalSorter::~ExternalSorter() = default;
+
+Status ExternalSorter::Make(FunctionContext* context,
+                            const std::shared_ptr<Schema>& schema,
+                            const SortOptions& options, const SpillOptions& spill_options,
+                            std::unique_ptr<ExternalSorter>* out) {
+  RETURN_NOT_OK(ValidateSpillOptions(spill_options));
+  if (options.sort_keys.empty()) {
+    return Status::Invalid("Must specify at least one sort key");
+  }
+  for (const auto& key : options.sort_keys) {
+    if (schema->GetFieldIndex(key.name) < 0) {
+      return Status::Invalid("No single column named '", key.name, "' to sort by");
+    }
+  }
+  std::unique_ptr<Impl> impl(new Impl(context, schema, options, spill_options));
+  out->reset(new ExternalSorter(std::move(impl)));
+  return Status::OK();
+}
+
+Status ExternalSorter::Consume(const std::shared_ptr<RecordBatch>& batch) {
+  return impl_->Consume(batch);
+}
+
+int ExternalSorter::num_spilled_runs() const { return impl_->num_spilled_runs(); }
+
+Status ExternalSorter::Finish(std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->Finish(out);
+}
+
+//
+// SpillingGroupBy
+//
+
+class SpillingGroupBy::Impl {
+ public:
+  Impl(FunctionContext* ctx, std::shared_ptr<Schema> schema, int num_keys,
+       SpillOptions spill_options, std::unique_ptr<GroupByAggregator> aggregator)
+      : ctx_(ctx),
+        schema_(std::move(schema)),
+        num_keys_(num_keys),
+        spill_options_(std::move(spill_options)),
+        aggregator_(std::move(aggregator)) {}
+
+  Status Consume(const std::shared_ptr<RecordBatch>& batch) {
+    RETURN_NOT_OK(CheckSchema(*schema_, *batch));
+    if (spilled()) {
+      return Partition(*batch);
+    }
+    buffered_.push_back(batch);
+    buffered_size_ += BufferedSize(*batch);
+    if (buffered_size_ > spill_options_.memory_limit) {
+      return Spill();
+    }
+    return Status::OK();
+  }
+
+  bool spilled() const { return !partitions_.empty(); }
+
+  Status Finish(std::shared_ptr<Array>* out) {
+    if (!spilled()) {
+      std::unique_ptr<GroupByAggregator::State> state;
+      RETURN_NOT_OK(aggregator_->MakeState(&state));
+      for (const auto& batch : buffered_) {
+        RETURN_NOT_OK(aggregator_->Consume(*batch, state.get()));
+      }
+      buffered_.clear();
+      return aggregator_->Finalize(state.get(), out);
+    }
+
+    ArrayVector groups;
+    for (const auto& partition : partitions_) {
+      RETURN_NOT_OK(partition->Close());
+    }
+    for (const auto& partition : partitions_) {
+      std::shared_ptr<ipc::RecordBatchFileReader> reader;
+      RETURN_NOT_OK(OpenSpilledFile(partition->path(), &reader));
+      std::unique_ptr<GroupByAggregator::State> state;
+      RETURN_NOT_OK(aggregator_->MakeState(&state));
+      for (int i = 0; i < reader->num_record_batches(); ++i) {
+        std::shared_ptr<RecordBatch> batch;
+        RETURN_NOT_OK(reader->ReadRecordBatch(i, &batch));
+        RETURN_NOT_OK(aggregator_->Consume(*batch, state.get()));
+      }
+      std::shared_ptr<Array> partition_groups;
+      RETURN_NOT_OK(aggregator_->Finalize(state.get(), &partition_groups));
+      groups.push_back(std::move(partition_groups));
+    }
+    partitions_.clear();
+    dir_.reset();
+    return Concatenate(groups, ctx_->memory_pool(), out);
+  }
+
+ private:
+  Status Spill() {
+    RETURN_NOT_OK(MakeScratchDir(spill_options_, &dir_));
+    const int num_partitions = std::max(spill_options_.num_partitions, 1);
+    for (int i = 0; i < num_partitions; ++i) {
+      std::unique_ptr<SpillFile> file;
+      RETURN_NOT_OK(SpillFile::Open(dir_.get(), "partition-" + std::to_string(i), schema_,
+                                    spill_options_, &file));
+      partitions_.push_back(std::move(file));
+    }
+    for (const auto& batch : buffered_) {
+      RETURN_NOT_OK(Partition(*batch));
+    }
+    buffered_.clear();
+    buffered_size_ = 0;
+    return Status::OK();
+  }
+
+  // Write the rows of a batch to the partitions of their key hashes
+  Status Partition(const RecordBatch& batch) {
+    std::vector<std::shared_ptr<RecordBatch>> partitioned;
+    RETURN_NOT_OK(HashPartition(ctx_, batch, KeyIndices(num_keys_),
+                                static_cast<int>(partitions_.size()), &partitioned));
+    for (size_t p = 0; p < partitioned.size(); ++p) {
+      if (partitioned[p]->num_rows() > 0) {
+        RETURN_NOT_OK(partitions_[p]->Write(*partitioned[p]));
+      }
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<Schema> schema_;
+  int num_keys_;
+  SpillOptions spill_options_;
+  std::unique_ptr<GroupByAggregator> aggregator_;
+  RecordBatchVector buffered_;
+  int64_t buffered_size_ = 0;
+  std::shared_ptr<TemporaryDir> dir_;
+  std::vector<std::unique_ptr<SpillFile>> partitions_;
+};
+
+SpillingGroupBy::SpillingGroupBy(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+SpillingGroupBy::~SpillingGroupBy() = default;
+
+Status SpillingGroupBy::Make(FunctionContext* context,
+                             const std::shared_ptr<Schema>& schema, int num_keys,
+                             const GroupByOptions& options,
+                             const SpillOptions& spill_options,
+                             std::unique_ptr<SpillingGroupBy>* out) {
+  RETURN_NOT_OK(ValidateSpillOptions(spill_options));
+  std::unique_ptr<GroupByAggregator> aggregator;
+  RETURN_NOT_OK(
+      GroupByAggregator::Make(context, schema, num_keys, options, &aggregator));
+  // Fail early on keys which can't be partitioned
+  std::vector<std::shared_ptr<Array>> empty_columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    RETURN_NOT_OK(MakeEmptyArray(context->memory_pool(), schema->field(i)->type(),
+                                 &empty_columns[i]));
+  }
+  std::shared_ptr<Array> indices;
+  std::vector<int64_t> offsets;
+  RETURN_NOT_OK(HashPartitionIndices(context,
+                                     *RecordBatch::Make(schema, 0, empty_columns),
+                                     KeyIndices(num_keys), 1, &indices, &offsets));
+  std::unique_ptr<Impl> impl(
+      new Impl(context, schema, num_keys, spill_options, std::move(aggregator)));
+  out->reset(new SpillingGroupBy(std::move(impl)));
+  return Status::OK();
+}
+
+Status SpillingGroupBy::Consume(const std::shared_ptr<RecordBatch>& batch) {
+  return impl_->Consume(batch);
+}
+
+bool SpillingGroupBy::spilled() const { return impl_->spilled(); }
+
+Status SpillingGroupBy::Finish(std::shared_ptr<Array>* out) { return impl_->Finish(out); }
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,168 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/compute/kernels/groupby.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/status.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class RecordBatch;
+class RecordBatchReader;
+class Schema;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \class SpillOptions
+///
+/// Controls when and how ExternalSorter and SpillingGroupBy write their input
+/// to disk.  Spilled data is written as IPC files in a scratch directory, which
+/// is deleted once the data has been read back.
+struct ARROW_EXPORT SpillOptions {
+  SpillOptions() = default;
+
+  explicit SpillOptions(int64_t memory_limit) : memory_limit(memory_limit) {}
+
+  /// Bytes of buffered input above which the input is spilled.  The size of
+  /// a batch is that of its buffers.
+  int64_t memory_limit = int64_t(256) << 20;
+
+  /// The directory in which the scratch directory is created, the system
+  /// temporary directory if empty.
+  std::string directory;
+
+  /// The codec of the spilled buffers, Compression::UNCOMPRESSED,
+  /// Compression::LZ4 or Compression::ZSTD.
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// The number of rows of the spilled batches, which are read back one at a
+  /// time per sorted run.
+  int64_t batch_size = 1 << 16;
+
+  /// The number of hash partitions of a spilling group-by.  Each partition is
+  /// aggregated in memory on its own, so input of up to about num_partitions
+  /// times memory_limit is aggregated within the limit.
+  int num_partitions = 16;
+};
+
+/// \brief Sort a stream of record batches larger than memory
+///
+/// Batches are buffered until their size exceeds SpillOptions::memory_limit.
+/// The buffered rows are then sorted, as by SortToIndices, and written as a
+/// sorted run to the scratch directory.  Finish merges the runs back, reading
+/// them through memory maps a batch at a time.  If nothing was spilled, the
+/// rows are sorted in memory.  The sort is stable.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+class ARROW_EXPORT ExternalSorter {
+ public:
+  ~ExternalSorter();
+
+  /// \brief Make a sorter of batches of the given schema
+  ///
+  /// \param[in] context the FunctionContext, which must outlive the sorter and
+  /// the reader returned by Finish
+  /// \param[in] schema the schema of the batches
+  /// \param[in] options the sort keys and null placement
+  /// \param[in] spill_options when and where to spill
+  /// \param[out] out the sorter
+  static Status Make(FunctionContext* context, const std::shared_ptr<Schema>& schema,
+                     const SortOptions& options, const SpillOptions& spill_options,
+                     std::unique_ptr<ExternalSorter>* out);
+
+  /// \brief Add a batch to sort, spilling if over the memory limit
+  Status Consume(const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief The number of sorted runs spilled so far
+  int num_spilled_runs() const;
+
+  /// \brief Return a reader of the sorted rows
+  ///
+  /// The sorter must not be used afterwards.  The reader owns the spilled
+  /// files and deletes them when destroyed.
+  Status Finish(std::shared_ptr<RecordBatchReader>* out);
+
+ private:
+  class Impl;
+  explicit ExternalSorter(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Group-by over a stream of record batches larger than memory
+///
+/// Batches are buffered until their size exceeds SpillOptions::memory_limit.
+/// The buffered rows and all the following ones are then partitioned by the
+/// hash of their keys into SpillOptions::num_partitions files.  Finish
+/// aggregates each partition in turn with a GroupByAggregator, so that only
+/// the groups of one partition are held in memory at a time.  If nothing was
+/// spilled, the buffered batches are aggregated in memory.
+///
+/// The result is the StructArray of GroupBy().  Once spilled, the groups are
+/// ordered by partition, then by first appearance.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+class ARROW_EXPORT SpillingGroupBy {
+ public:
+  ~SpillingGroupBy();
+
+  /// \brief Make a group-by of batches of the given schema
+  ///
+  /// \param[in] context the FunctionContext, which must outlive the group-by
+  /// \param[in] schema the schema of the batches, the key columns first, then
+  /// the value columns, one per aggregate
+  /// \param[in] num_keys the number of key columns
+  /// \param[in] options the aggregates to compute
+  /// \param[in] spill_options when and where to spill
+  /// \param[out] out the group-by
+  static Status Make(FunctionContext* context, const std::shared_ptr<Schema>& schema,
+                     int num_keys, const GroupByOptions& options,
+                     const SpillOptions& spill_options,
+                     std::unique_ptr<SpillingGroupBy>* out);
+
+  /// \brief Add a batch to aggregate, spilling if over the memory limit
+  Status Consume(const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief Whether the input was spilled to partition files
+  bool spilled() const;
+
+  /// \brief Return the keys and aggregates of the groups and delete the
+  /// spilled files.  The group-by must not be used afterwards.
+  Status Finish(std::shared_ptr<Array>* out);
+
+ private:
+  class Impl;
+  explicit SpillingGroupBy(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,233 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/groupby.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/spill.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::PlatformFilename;
+using internal::TemporaryDir;
+
+namespace compute {
+
+class TestSpill : public ComputeFixture, public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_OK(TemporaryDir::Make("spill-test-", &scratch_));
+    spill_options_.directory = scratch_->path().ToString();
+    spill_options_.batch_size = 100;
+    // A few batches of the input
+    spill_options_.memory_limit = 16 << 10;
+  }
+
+  // int32 keys with duplicates and nulls, a string value, and the row
+  // number, which checks that sorts are stable
+  void MakeInput(int64_t num_batches, int64_t batch_size) {
+    schema_ = schema(
+        {field("key", int32()), field("value", utf8()), field("row", int64())});
+    random::RandomArrayGenerator rng(42);
+    int64_t row = 0;
+    batches_.clear();
+    for (int64_t i = 0; i < num_batches; ++i) {
+      std::vector<int64_t> rows(batch_size);
+      std::iota(rows.begin(), rows.end(), row);
+      row += batch_size;
+      std::shared_ptr<Array> row_array;
+      ArrayFromVector<Int64Type>(rows, &row_array);
+      batches_.push_back(RecordBatch::Make(
+          schema_, batch_size,
+          {rng.Int32(batch_size, -50, 50, 0.1), rng.String(batch_size, 0, 8, 0.1),
+           row_array}));
+    }
+    ASSERT_OK(Table::FromRecordBatches(batches_, &table_));
+  }
+
+  void AssertSorted(const SortOptions& options, bool expect_spill) {
+    std::unique_ptr<ExternalSorter> sorter;
+    ASSERT_OK(ExternalSorter::Make(&ctx_, schema_, options, spill_options_, &sorter));
+    for (const auto& batch : batches_) {
+      ASSERT_OK(sorter->Consume(batch));
+    }
+    ASSERT_EQ(expect_spill, sorter->num_spilled_runs() > 0);
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(sorter->Finish(&reader));
+    std::vector<std::shared_ptr<RecordBatch>> sorted_batches;
+    ASSERT_OK(reader->ReadAll(&sorted_batches));
+    reader.reset();
+    AssertScratchEmpty();
+
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(Table::FromRecordBatches(schema_, sorted_batches, &actual));
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(SortToIndices(&ctx_, *table_, options, &indices));
+    std::vector<std::shared_ptr<Array>> columns(table_->num_columns());
+    for (int i = 0; i < table_->num_columns(); ++i) {
+      ASSERT_OK(Take(&ctx_, *table_->column(i), *indices, TakeOptions(), &columns[i]));
+    }
+    auto expected = Table::Make(schema_, columns);
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+
+  void AssertGroupBy(const GroupByOptions& options, bool expect_spill) {
+    std::unique_ptr<SpillingGroupBy> group_by;
+    ASSERT_OK(
+        SpillingGroupBy::Make(&ctx_, schema_, 2, options, spill_options_, &group_by));
+    for (const auto& batch : batches_) {
+      ASSERT_OK(group_by->Consume(batch));
+    }
+    ASSERT_EQ(expect_spill, group_by->spilled());
+    std::shared_ptr<Array> actual;
+    ASSERT_OK(group_by->Finish(&actual));
+    group_by.reset();
+    AssertScratchEmpty();
+    ASSERT_OK(actual->Validate());
+
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(GroupBy(&ctx_, {table_->column(0), table_->column(1)},
+                      {table_->column(2)}, options, &expected));
+    // Only the order of the groups differs
+    AssertArraysEqual(*SortGroups(expected), *SortGroups(actual));
+  }
+
+  std::shared_ptr<Array> SortGroups(const std::shared_ptr<Array>& groups) {
+    const auto& struct_array = checked_cast<const StructArray&>(*groups);
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < struct_array.num_fields(); ++i) {
+      fields.push_back(struct_array.type()->child(i));
+      columns.push_back(struct_array.field(i));
+    }
+    auto table = Table::Make(schema(fields), columns, groups->length());
+    std::shared_ptr<Array> indices;
+    ARROW_EXPECT_OK(SortToIndices(
+        &ctx_, *table, SortOptions({SortKey("key_0"), SortKey("key_1")}), &indices));
+    std::shared_ptr<Array> sorted;
+    ARROW_EXPECT_OK(Take(&ctx_, *groups, *indices, TakeOptions(), &sorted));
+    return sorted;
+  }
+
+  // The spilled files are deleted once read
+  void AssertScratchEmpty() {
+    fs::LocalFileSystem local_fs;
+    fs::Selector selector;
+    selector.base_dir = scratch_->path().ToString();
+    std::vector<fs::FileStats> stats;
+    ASSERT_OK(local_fs.GetTargetStats(selector, &stats));
+    ASSERT_EQ(stats.size(), 0);
+  }
+
+  std::unique_ptr<TemporaryDir> scratch_;
+  SpillOptions spill_options_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  std::shared_ptr<Table> table_;
+};
+
+TEST_F(TestSpill, SortInMemory) {
+  MakeInput(2, 50);
+  AssertSorted(SortOptions({SortKey("key")}), /*expect_spill=*/false);
+}
+
+TEST_F(TestSpill, SortSpilled) {
+  MakeInput(40, 500);
+  AssertSorted(SortOptions({SortKey("key")}), /*expect_spill=*/true);
+
+  SortOptions options({SortKey("value", SortKey::DESCENDING), SortKey("key")});
+  options.null_placement = SortOptions::NULLS_AT_START;
+  AssertSorted(options, /*expect_spill=*/true);
+}
+
+TEST_F(TestSpill, SortSpilledCompressed) {
+#ifdef ARROW_WITH_LZ4
+  spill_options_.compression = Compression::LZ4;
+  MakeInput(40, 500);
+  AssertSorted(SortOptions({SortKey("key")}), /*expect_spill=*/true);
+#endif
+}
+
+TEST_F(TestSpill, SortErrors) {
+  MakeInput(1, 10);
+  std::unique_ptr<ExternalSorter> sorter;
+  ASSERT_RAISES(Invalid, ExternalSorter::Make(&ctx_, schema_, SortOptions(),
+                                              spill_options_, &sorter));
+  ASSERT_RAISES(Invalid, ExternalSorter::Make(&ctx_, schema_,
+                                              SortOptions({SortKey("missing")}),
+                                              spill_options_, &sorter));
+  ASSERT_OK(ExternalSorter::Make(&ctx_, schema_, SortOptions({SortKey("key")}),
+                                 spill_options_, &sorter));
+  auto other = RecordBatch::Make(schema({field("key", int64())}), 0,
+                                 {ArrayFromJSON(int64(), "[]")});
+  ASSERT_RAISES(Invalid, sorter->Consume(other));
+}
+
+TEST_F(TestSpill, GroupByInMemory) {
+  MakeInput(2, 50);
+  AssertGroupBy(GroupByOptions({GroupByOptions::COUNT}), /*expect_spill=*/false);
+}
+
+TEST_F(TestSpill, GroupBySpilled) {
+  MakeInput(40, 500);
+  AssertGroupBy(GroupByOptions({GroupByOptions::SUM}), /*expect_spill=*/true);
+
+  spill_options_.num_partitions = 3;
+  AssertGroupBy(GroupByOptions({GroupByOptions::MEAN}), /*expect_spill=*/true);
+}
+
+TEST_F(TestSpill, GroupByErrors) {
+  MakeInput(1, 10);
+  std::unique_ptr<SpillingGroupBy> group_by;
+  ASSERT_RAISES(Invalid, SpillingGroupBy::Make(&ctx_, schema_, 2, GroupByOptions(),
+                                                spill_options_, &group_by));
+  auto list_schema = schema({field("key", list(int32())), field("value", int64())});
+  ASSERT_RAISES(NotImplemented,
+                SpillingGroupBy::Make(&ctx_, list_schema, 1,
+                                      GroupByOptions({GroupByOptions::SUM}),
+                                      spill_options_, &group_by));
+  spill_options_.batch_size = 0;
+  ASSERT_RAISES(Invalid,
+                SpillingGroupBy::Make(&ctx_, schema_, 2,
+                                      GroupByOptions({GroupByOptions::SUM}),
+                                      spill_options_, &group_by));
+}
+
+}  // namespace compute
+}  // namespace arrow
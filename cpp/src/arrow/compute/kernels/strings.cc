@@ -0,0 +1,604 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/kernels/strings.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/sse_util.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+
+namespace compute {
+
+namespace {
+
+constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+constexpr uint64_t kAllOnes = 0x0101010101010101ULL;
+
+// ----------------------------------------------------------------------
+// Case mappings
+
+// Flip the case of the ASCII letters of a byte
+template <bool kLower>
+inline uint8_t AsciiCase(uint8_t c) {
+  const uint8_t first = kLower ? 'A' : 'a';
+  return static_cast<uint8_t>(c ^ ((static_cast<uint8_t>(c - first) < 26) << 5));
+}
+
+// Flip the case of the letters of eight ASCII bytes.  Adding 0x80 - first to
+// a byte sets its high bit if the byte is at least first, and adding
+// 0x80 - last - 1 if it's beyond last; no byte carries into the next one, as
+// they are all below 0x80.
+template <bool kLower>
+inline uint64_t AsciiCaseWord(uint64_t word) {
+  const uint64_t first = kLower ? 'A' : 'a';
+  const uint64_t last = kLower ? 'Z' : 'z';
+  const uint64_t at_least_first = word + (0x80 - first) * kAllOnes;
+  const uint64_t beyond_last = word + (0x80 - last - 1) * kAllOnes;
+  return word ^ (((at_least_first ^ beyond_last) & kHighBits) >> 2);
+}
+
+template <bool kLower>
+void AsciiCaseMap(const uint8_t* in, int64_t length, uint8_t* out) {
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const uint64_t word = AsciiCaseWord<kLower>(util::SafeLoadAs<uint64_t>(in + i));
+    std::memcpy(out + i, &word, sizeof(word));
+  }
+  for (; i < length; ++i) {
+    out[i] = AsciiCase<kLower>(in[i]);
+  }
+}
+
+// The case mappings of the codepoints of two-byte sequences, which are all
+// below 0x800.  Only mappings to codepoints of two bytes are kept, so that the
+// encoded length is preserved.
+class CaseTables {
+ public:
+  static const CaseTables& Get() {
+    static const CaseTables tables;
+    return tables;
+  }
+
+  const uint16_t* lower() const { return lower_; }
+  const uint16_t* upper() const { return upper_; }
+
+  static constexpr uint32_t kSize = 0x800;
+
+ private:
+  CaseTables() {
+    for (uint32_t c = 0; c < kSize; ++c) {
+      lower_[c] = upper_[c] = static_cast<uint16_t>(c);
+    }
+    // Latin-1 Supplement, but for the multiplication sign
+    AddRange(0xC0, 0xD6, 0x20);
+    AddRange(0xD8, 0xDE, 0x20);
+    Add(0x178, 0xFF);
+    // Latin Extended-A and B, where letters mostly come in pairs
+    AddPairs(0x100, 0x12F);
+    AddPairs(0x132, 0x137);
+    AddPairs(0x139, 0x148);
+    AddPairs(0x14A, 0x177);
+    AddPairs(0x179, 0x17E);
+    AddPairs(0x1CD, 0x1DC);
+    AddPairs(0x1DE, 0x1EF);
+    AddPairs(0x1F8, 0x21F);
+    AddPairs(0x222, 0x233);
+    // Greek
+    Add(0x386, 0x3AC);
+    AddRange(0x388, 0x38A, 0x25);
+    Add(0x38C, 0x3CC);
+    AddRange(0x38E, 0x38F, 0x3F);
+    AddRange(0x391, 0x3A1, 0x20);
+    AddRange(0x3A3, 0x3AB, 0x20);
+    AddPairs(0x3D8, 0x3EF);
+    // Cyrillic
+    AddRange(0x400, 0x40F, 0x50);
+    AddRange(0x410, 0x42F, 0x20);
+    AddPairs(0x460, 0x481);
+    AddPairs(0x48A, 0x4BF);
+    Add(0x4C0, 0x4CF);
+    AddPairs(0x4C1, 0x4CE);
+    AddPairs(0x4D0, 0x52F);
+    // Armenian
+    AddRange(0x531, 0x556, 0x30);
+    // Lower case letters without a lower case pair of their own
+    upper_[0xB5] = 0x39C;   // micro sign
+    upper_[0x3C2] = 0x3A3;  // final sigma
+  }
+
+  void Add(uint16_t upper, uint16_t lower) {
+    lower_[upper] = lower;
+    upper_[lower] = upper;
+  }
+
+  void AddRange(uint16_t first, uint16_t last, uint16_t distance) {
+    for (uint16_t c = first; c <= last; ++c) {
+      Add(c, static_cast<uint16_t>(c + distance));
+    }
+  }
+
+  // Upper case letters at every other codepoint from first, each followed by
+  // its lower case
+  void AddPairs(uint16_t first, uint16_t last) {
+    for (uint16_t c = first; c < last; c += 2) {
+      Add(c, static_cast<uint16_t>(c + 1));
+    }
+  }
+
+  uint16_t lower_[kSize];
+  uint16_t upper_[kSize];
+};
+
+constexpr uint32_t CaseTables::kSize;
+
+// The case mapping of the codepoints of three-byte sequences: Latin Extended
+// Additional, which has pairs, and fullwidth Latin letters
+template <bool kLower>
+inline uint32_t ThreeByteCase(uint32_t c) {
+  if ((c >= 0x1E00 && c <= 0x1E95) || (c >= 0x1EA0 && c <= 0x1EFF)) {
+    return kLower ? (c | 1) : (c & ~1U);
+  }
+  if (kLower && c >= 0xFF21 && c <= 0xFF3A) {
+    return c + 0x20;
+  }
+  if (!kLower && c >= 0xFF41 && c <= 0xFF5A) {
+    return c - 0x20;
+  }
+  return c;
+}
+
+template <bool kLower>
+void Utf8CaseMap(const uint8_t* in, int64_t length, uint8_t* out) {
+  const CaseTables& tables = CaseTables::Get();
+  const uint16_t* table = kLower ? tables.lower() : tables.upper();
+  const uint8_t* end = in + length;
+  while (in < end) {
+    if (end - in >= 8) {
+      const uint64_t word = util::SafeLoadAs<uint64_t>(in);
+      if ((word & kHighBits) == 0) {
+        const uint64_t mapped = AsciiCaseWord<kLower>(word);
+        std::memcpy(out, &mapped, sizeof(mapped));
+        in += 8;
+        out += 8;
+        continue;
+      }
+    }
+    const uint8_t c = *in;
+    if (c < 0x80) {
+      *out++ = AsciiCase<kLower>(c);
+      ++in;
+    } else if ((c & 0xE0) == 0xC0 && end - in >= 2 && (in[1] & 0xC0) == 0x80) {
+      const uint32_t codepoint = table[((c & 0x1F) << 6) | (in[1] & 0x3F)];
+      out[0] = static_cast<uint8_t>(0xC0 | (codepoint >> 6));
+      out[1] = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+      in += 2;
+      out += 2;
+    } else if ((c & 0xF0) == 0xE0 && end - in >= 3 && (in[1] & 0xC0) == 0x80 &&
+               (in[2] & 0xC0) == 0x80) {
+      const uint32_t codepoint = ThreeByteCase<kLower>(
+          ((c & 0x0F) << 12) | ((in[1] & 0x3F) << 6) | (in[2] & 0x3F));
+      out[0] = static_cast<uint8_t>(0xE0 | (codepoint >> 12));
+      out[1] = static_cast<uint8_t>(0x80 | ((codepoint >> 6) & 0x3F));
+      out[2] = static_cast<uint8_t>(0x80 | (codepoint & 0x3F));
+      in += 3;
+      out += 3;
+    } else {
+      // Four-byte sequences have no case mapping, and invalid bytes are kept
+      *out++ = *in++;
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// Codepoints
+
+// The number of codepoints of a UTF-8 string, that of its bytes which are not
+// continuation bytes (0b10xxxxxx)
+inline int64_t CountCodepoints(const uint8_t* data, int64_t length) {
+  int64_t continuations = 0;
+  int64_t i = 0;
+  for (; i + 8 <= length; i += 8) {
+    const uint64_t word = util::SafeLoadAs<uint64_t>(data + i);
+    continuations += BitUtil::PopCount(word & (~word << 1) & kHighBits);
+  }
+  for (; i < length; ++i) {
+    continuations += (data[i] & 0xC0) == 0x80;
+  }
+  return length - continuations;
+}
+
+// The byte position after the first num_codepoints codepoints, or length
+inline int64_t SkipCodepoints(const uint8_t* data, int64_t length,
+                              int64_t num_codepoints) {
+  int64_t i = 0;
+  for (; num_codepoints > 0 && i < length; --num_codepoints) {
+    ++i;
+    while (i < length && (data[i] & 0xC0) == 0x80) {
+      ++i;
+    }
+  }
+  return i;
+}
+
+// The byte position of the last num_codepoints codepoints, or 0
+inline int64_t SkipCodepointsBack(const uint8_t* data, int64_t length,
+                                  int64_t num_codepoints) {
+  int64_t i = length;
+  for (; num_codepoints > 0 && i > 0; --num_codepoints) {
+    --i;
+    while (i > 0 && (data[i] & 0xC0) == 0x80) {
+      --i;
+    }
+  }
+  return i;
+}
+
+// ----------------------------------------------------------------------
+// Substring search
+
+class SubstringFinder {
+ public:
+  explicit SubstringFinder(const std::string& pattern)
+      : pattern_(reinterpret_cast<const uint8_t*>(pattern.data())),
+        length_(static_cast<int64_t>(pattern.size())) {}
+
+  bool Find(const uint8_t* data, int64_t length) const {
+    if (length_ == 0) {
+      return true;
+    }
+    if (length < length_) {
+      return false;
+    }
+    if (length_ == 1) {
+      return std::memchr(data, pattern_[0], length) != NULLPTR;
+    }
+    // The last position at which the pattern may start
+    const int64_t last = length - length_;
+    int64_t i = 0;
+#ifdef ARROW_HAVE_SSE2
+    const __m128i first_bytes = _mm_set1_epi8(static_cast<char>(pattern_[0]));
+    const __m128i last_bytes = _mm_set1_epi8(static_cast<char>(pattern_[length_ - 1]));
+    for (; i + 16 <= last + 1; i += 16) {
+      const __m128i firsts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+      const __m128i lasts =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + length_ - 1));
+      uint32_t candidates = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(
+          _mm_cmpeq_epi8(firsts, first_bytes), _mm_cmpeq_epi8(lasts, last_bytes))));
+      while (candidates != 0) {
+        const int64_t position = i + BitUtil::CountTrailingZeros(candidates);
+        if (std::memcmp(data + position + 1, pattern_ + 1, length_ - 2) == 0) {
+          return true;
+        }
+        candidates &= candidates - 1;
+      }
+    }
+#endif
+    for (; i <= last; ++i) {
+      if (data[i] == pattern_[0] && data[i + length_ - 1] == pattern_[length_ - 1] &&
+          std::memcmp(data + i + 1, pattern_ + 1, length_ - 2) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  const uint8_t* pattern_;
+  int64_t length_;
+};
+
+// ----------------------------------------------------------------------
+// Array kernels
+
+// A string array whose value data is transformed into data of the same
+// length, its offsets being shared when possible.  The data is transformed as
+// a whole, or value by value if sequences mustn't be decoded across values.
+template <typename ArrayType, bool kPerValue, typename Transform>
+Status TransformStrings(FunctionContext* ctx, const ArrayData& input,
+                        Transform&& transform, std::shared_ptr<ArrayData>* out) {
+  using offset_type = typename ArrayType::offset_type;
+  const ArrayType array(input.Copy());
+  const int64_t length = input.length;
+
+  auto out_data = ArrayData::Make(input.type, length);
+  out_data->buffers.resize(3);
+  RETURN_NOT_OK(detail::PropagateNulls(ctx, input, out_data.get()));
+
+  const offset_type* offsets = array.raw_value_offsets();
+  const offset_type first = length > 0 ? offsets[0] : 0;
+  const offset_type data_length = length > 0 ? offsets[length] - first : 0;
+  if (input.offset == 0 && first == 0 && length > 0) {
+    out_data->buffers[1] = input.buffers[1];
+  } else {
+    RETURN_NOT_OK(
+        ctx->Allocate((length + 1) * sizeof(offset_type), &out_data->buffers[1]));
+    auto out_offsets =
+        reinterpret_cast<offset_type*>(out_data->buffers[1]->mutable_data());
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      out_offsets[i + 1] = offsets[i + 1] - first;
+    }
+  }
+  RETURN_NOT_OK(ctx->Allocate(data_length, &out_data->buffers[2]));
+  if (data_length > 0) {
+    const uint8_t* data = array.value_data()->data() + first;
+    uint8_t* out_values = out_data->buffers[2]->mutable_data();
+    if (kPerValue) {
+      for (int64_t i = 0; i < length; ++i) {
+        transform(data + offsets[i] - first, offsets[i + 1] - offsets[i],
+                  out_values + offsets[i] - first);
+      }
+    } else {
+      transform(data, static_cast<int64_t>(data_length), out_values);
+    }
+  }
+  *out = std::move(out_data);
+  return Status::OK();
+}
+
+template <bool kLower>
+struct AsciiCaseImpl {
+  template <typename ArrayType>
+  Status Exec(FunctionContext* ctx, const ArrayData& input,
+              std::shared_ptr<ArrayData>* out) const {
+    return TransformStrings<ArrayType, false>(ctx, input, AsciiCaseMap<kLower>, out);
+  }
+};
+
+template <bool kLower>
+struct Utf8CaseImpl {
+  template <typename ArrayType>
+  Status Exec(FunctionContext* ctx, const ArrayData& input,
+              std::shared_ptr<ArrayData>* out) const {
+    return TransformStrings<ArrayType, true>(ctx, input, Utf8CaseMap<kLower>, out);
+  }
+};
+
+struct Utf8LengthImpl {
+  template <typename ArrayType>
+  Status Exec(FunctionContext* ctx, const ArrayData& input,
+              std::shared_ptr<ArrayData>* out) const {
+    using offset_type = typename ArrayType::offset_type;
+    const ArrayType array(input.Copy());
+    const int64_t length = input.length;
+
+    auto out_data = ArrayData::Make(
+        TypeTraits<typename CTypeTraits<offset_type>::ArrowType>::type_singleton(),
+        length);
+    out_data->buffers.resize(2);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, input, out_data.get()));
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(offset_type), &out_data->buffers[1]));
+    auto out_values =
+        reinterpret_cast<offset_type*>(out_data->buffers[1]->mutable_data());
+    const offset_type* offsets = array.raw_value_offsets();
+    const uint8_t* data = length > 0 ? array.value_data()->data() : NULLPTR;
+    for (int64_t i = 0; i < length; ++i) {
+      out_values[i] = static_cast<offset_type>(
+          CountCodepoints(data + offsets[i], offsets[i + 1] - offsets[i]));
+    }
+    *out = std::move(out_data);
+    return Status::OK();
+  }
+};
+
+// A boolean array of the results of a predicate on each string
+template <typename Predicate>
+struct MatchImpl {
+  template <typename ArrayType>
+  Status Exec(FunctionContext* ctx, const ArrayData& input,
+              std::shared_ptr<ArrayData>* out) const {
+    const ArrayType array(input.Copy());
+    const int64_t length = input.length;
+
+    auto out_data = ArrayData::Make(boolean(), length);
+    out_data->buffers.resize(2);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, input, out_data.get()));
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &out_data->buffers[1]));
+    const auto* offsets = array.raw_value_offsets();
+    const uint8_t* data = length > 0 ? array.value_data()->data() : NULLPTR;
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(out_data->buffers[1]->mutable_data(), 0, length,
+                                   [&]() {
+                                     const int64_t position = offsets[i];
+                                     const int64_t size = offsets[i + 1] - position;
+                                     ++i;
+                                     return predicate(data + position, size);
+                                   });
+    *out = std::move(out_data);
+    return Status::OK();
+  }
+
+  Predicate predicate;
+};
+
+template <typename Predicate>
+MatchImpl<Predicate> MakeMatchImpl(Predicate predicate) {
+  return MatchImpl<Predicate>{predicate};
+}
+
+struct SubstringImpl {
+  template <typename ArrayType>
+  Status Exec(FunctionContext* ctx, const ArrayData& input,
+              std::shared_ptr<ArrayData>* out) const {
+    using offset_type = typename ArrayType::offset_type;
+    const ArrayType array(input.Copy());
+    const int64_t length = input.length;
+
+    auto out_data = ArrayData::Make(input.type, length);
+    out_data->buffers.resize(3);
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, input, out_data.get()));
+
+    // First compute the byte range of each substring, then copy them
+    RETURN_NOT_OK(
+        ctx->Allocate((length + 1) * sizeof(offset_type), &out_data->buffers[1]));
+    auto out_offsets =
+        reinterpret_cast<offset_type*>(out_data->buffers[1]->mutable_data());
+    std::shared_ptr<Buffer> starts_buffer;
+    RETURN_NOT_OK(ctx->Allocate(length * sizeof(offset_type), &starts_buffer));
+    auto starts = reinterpret_cast<offset_type*>(starts_buffer->mutable_data());
+
+    const offset_type* offsets = array.raw_value_offsets();
+    const uint8_t* data = length > 0 ? array.value_data()->data() : NULLPTR;
+    out_offsets[0] = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const uint8_t* value = data + offsets[i];
+      const int64_t size = offsets[i + 1] - offsets[i];
+      const int64_t begin = options.start >= 0
+                                ? SkipCodepoints(value, size, options.start)
+                                : SkipCodepointsBack(value, size, -options.start);
+      const int64_t end =
+          begin + SkipCodepoints(value + begin, size - begin, options.length);
+      starts[i] = static_cast<offset_type>(offsets[i] + begin);
+      out_offsets[i + 1] = static_cast<offset_type>(out_offsets[i] + (end - begin));
+    }
+
+    RETURN_NOT_OK(ctx->Allocate(out_offsets[length], &out_data->buffers[2]));
+    uint8_t* out_values = out_data->buffers[2]->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      std::memcpy(out_values + out_offsets[i], data + starts[i],
+                  out_offsets[i + 1] - out_offsets[i]);
+    }
+    *out = std::move(out_data);
+    return Status::OK();
+  }
+
+  SubstringOptions options;
+};
+
+// Run a kernel on each array of a datum of strings
+template <typename Impl>
+Status ExecStrings(FunctionContext* ctx, const char* name, const Datum& values,
+                   const Impl& impl, Datum* out) {
+  if (values.kind() != Datum::ARRAY && values.kind() != Datum::CHUNKED_ARRAY) {
+    return Status::Invalid(name, " expects array or chunked array values");
+  }
+  const auto& type = *values.type();
+  if (type.id() != Type::STRING && type.id() != Type::LARGE_STRING) {
+    return Status::Invalid(name, " expects strings, got ", type.ToString());
+  }
+  auto exec_array = [&](const ArrayData& input, std::shared_ptr<ArrayData>* result) {
+    if (input.type->id() == Type::LARGE_STRING) {
+      return impl.template Exec<LargeStringArray>(ctx, input, result);
+    }
+    return impl.template Exec<StringArray>(ctx, input, result);
+  };
+
+  if (values.kind() == Datum::ARRAY) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(exec_array(*values.array(), &result));
+    *out = result;
+    return Status::OK();
+  }
+  const auto& chunked = *values.chunked_array();
+  // The output type, for chunked arrays without chunks
+  std::shared_ptr<ArrayData> empty_result;
+  RETURN_NOT_OK(
+      exec_array(*ArrayData::Make(values.type(), 0, {NULLPTR, NULLPTR, NULLPTR}, 0),
+                 &empty_result));
+  ArrayVector chunks;
+  for (const auto& chunk : chunked.chunks()) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(exec_array(*chunk->data(), &result));
+    chunks.push_back(MakeArray(result));
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, empty_result->type);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status AsciiLower(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStrings(ctx, "AsciiLower", values, AsciiCaseImpl<true>(), out);
+}
+
+Status AsciiUpper(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStrings(ctx, "AsciiUpper", values, AsciiCaseImpl<false>(), out);
+}
+
+Status Utf8Lower(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStrings(ctx, "Utf8Lower", values, Utf8CaseImpl<true>(), out);
+}
+
+Status Utf8Upper(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStrings(ctx, "Utf8Upper", values, Utf8CaseImpl<false>(), out);
+}
+
+Status Utf8Length(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return ExecStrings(ctx, "Utf8Length", values, Utf8LengthImpl(), out);
+}
+
+Status StartsWith(FunctionContext* ctx, const Datum& values, const std::string& pattern,
+                  Datum* out) {
+  const auto* prefix = reinterpret_cast<const uint8_t*>(pattern.data());
+  const int64_t prefix_length = static_cast<int64_t>(pattern.size());
+  auto starts_with = [=](const uint8_t* data, int64_t length) {
+    return length >= prefix_length && std::memcmp(data, prefix, prefix_length) == 0;
+  };
+  return ExecStrings(ctx, "StartsWith", values, MakeMatchImpl(starts_with), out);
+}
+
+Status EndsWith(FunctionContext* ctx, const Datum& values, const std::string& pattern,
+                Datum* out) {
+  const auto* suffix = reinterpret_cast<const uint8_t*>(pattern.data());
+  const int64_t suffix_length = static_cast<int64_t>(pattern.size());
+  auto ends_with = [=](const uint8_t* data, int64_t length) {
+    return length >= suffix_length &&
+           std::memcmp(data + length - suffix_length, suffix, suffix_length) == 0;
+  };
+  return ExecStrings(ctx, "EndsWith", values, MakeMatchImpl(ends_with), out);
+}
+
+Status Contains(FunctionContext* ctx, const Datum& values, const std::string& pattern,
+                Datum* out) {
+  const SubstringFinder finder(pattern);
+  auto contains = [&finder](const uint8_t* data, int64_t length) {
+    return finder.Find(data, length);
+  };
+  return ExecStrings(ctx, "Contains", values, MakeMatchImpl(contains), out);
+}
+
+Status Substring(FunctionContext* ctx, const SubstringOptions& options,
+                 const Datum& values, Datum* out) {
+  if (options.length < 0) {
+    return Status::Invalid("Substring length must be non-negative, got ",
+                           options.length);
+  }
+  return ExecStrings(ctx, "Substring", values, SubstringImpl{options}, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
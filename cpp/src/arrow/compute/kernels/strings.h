@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+// String kernels over utf8 and large_utf8 values, given as Array or
+// ChunkedArray datums.  The results are of the same kind as the input and
+// null where it is.
+//
+// The output of each kernel is sized before being allocated at once: the
+// case mappings never change the encoded length of a string, and Substring
+// computes the byte range of each string in a first pass.
+
+/// \brief Convert ASCII letters to lower case, leaving other bytes as is
+///
+/// The whole value data is converted at once, eight bytes at a time.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiLower(FunctionContext* context, const Datum& values, Datum* out);
+
+/// \brief Convert ASCII letters to upper case, leaving other bytes as is
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiUpper(FunctionContext* context, const Datum& values, Datum* out);
+
+/// \brief Convert UTF-8 strings to lower case
+///
+/// Codepoints are mapped by the simple (one to one) Unicode case mapping of
+/// the Latin, Greek, Cyrillic and Armenian letters for which it preserves
+/// the encoded length, and of fullwidth Latin letters.  Other codepoints,
+/// such as the dotted capital I, and invalid bytes are left as is.  Runs of
+/// ASCII are converted eight bytes at a time.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Lower(FunctionContext* context, const Datum& values, Datum* out);
+
+/// \brief Convert UTF-8 strings to upper case, as Utf8Lower
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Upper(FunctionContext* context, const Datum& values, Datum* out);
+
+/// \brief Compute the number of codepoints of UTF-8 strings
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values datum of utf8 or large_utf8
+/// \param[out] out resulting datum of int32 for utf8, or int64 for large_utf8
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* context, const Datum& values, Datum* out);
+
+/// \brief Tell whether strings start with a pattern
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values datum of utf8 or large_utf8
+/// \param[in] pattern the bytes to look for
+/// \param[out] out resulting datum of boolean
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StartsWith(FunctionContext* context, const Datum& values,
+                  const std::string& pattern, Datum* out);
+
+/// \brief Tell whether strings end with a pattern
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status EndsWith(FunctionContext* context, const Datum& values,
+                const std::string& pattern, Datum* out);
+
+/// \brief Tell whether strings contain a pattern
+///
+/// Candidate positions are found by comparing the first and last bytes of
+/// the pattern at 16 positions at once (with SSE2), and only checked in full
+/// where both match.
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Contains(FunctionContext* context, const Datum& values,
+                const std::string& pattern, Datum* out);
+
+/// \brief Options for the Substring kernel
+struct ARROW_EXPORT SubstringOptions {
+  explicit SubstringOptions(int64_t start,
+                            int64_t length = std::numeric_limits<int64_t>::max())
+      : start(start), length(length) {}
+
+  /// The index of the first codepoint, counted from the end if negative
+  int64_t start;
+  /// The maximum number of codepoints
+  int64_t length;
+};
+
+/// \brief Extract codepoints of UTF-8 strings
+///
+/// As with Python slicing, a start beyond either end of a string is clamped
+/// to that end.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the start and length of the substrings, in codepoints
+/// \param[in] values datum of utf8 or large_utf8
+/// \param[out] out resulting datum of the type of values
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Substring(FunctionContext* context, const SubstringOptions& options,
+                 const Datum& values, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <random>
+#include <string>
+
+#include "arrow/builder.h"
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/strings.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+// Generate strings of 0 to 2 * average_length letters, about one in
+// non_ascii_every being a two-byte one if non_ascii_every isn't 0
+static std::shared_ptr<Array> MakeStrings(int64_t data_length, int average_length,
+                                          int non_ascii_every = 0) {
+  std::default_random_engine gen(kSeed);
+  std::uniform_int_distribution<int> lengths(0, 2 * average_length);
+  std::uniform_int_distribution<int> letters(0, 51);
+  std::uniform_int_distribution<int> pick(0, std::max(non_ascii_every - 1, 0));
+  const char* alphabet = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+  StringBuilder builder;
+  std::string value;
+  for (int64_t total = 0; total < data_length; total += value.size()) {
+    value.clear();
+    const int length = lengths(gen);
+    for (int i = 0; i < length; ++i) {
+      if (non_ascii_every != 0 && pick(gen) == 0) {
+        value += "\xc3\x89";  // É
+      } else {
+        value += alphabet[letters(gen)];
+      }
+    }
+    ABORT_NOT_OK(builder.Append(value));
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
+template <Status (*Kernel)(FunctionContext*, const Datum&, Datum*)>
+static void BenchUnary(benchmark::State& state, int non_ascii_every) {
+  RegressionArgs args(state);
+  auto values = MakeStrings(args.size, 16, non_ascii_every);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Kernel(&ctx, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void AsciiLowerAscii(benchmark::State& state) {
+  BenchUnary<AsciiLower>(state, 0);
+}
+
+static void Utf8LowerAscii(benchmark::State& state) { BenchUnary<Utf8Lower>(state, 0); }
+
+static void Utf8LowerMixed(benchmark::State& state) { BenchUnary<Utf8Lower>(state, 8); }
+
+static void Utf8LengthMixed(benchmark::State& state) {
+  BenchUnary<Utf8Length>(state, 8);
+}
+
+static void ContainsLong(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeStrings(args.size, 64);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Contains(&ctx, values, "needle", &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void SubstringMixed(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeStrings(args.size, 16, 8);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Substring(&ctx, SubstringOptions(2, 8), values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+BENCHMARK(AsciiLowerAscii)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8LowerAscii)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8LowerMixed)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8LengthMixed)->Apply(RegressionSetArgs);
+BENCHMARK(ContainsLong)->Apply(RegressionSetArgs);
+BENCHMARK(SubstringMixed)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
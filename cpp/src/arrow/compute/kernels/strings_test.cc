@@ -0,0 +1,237 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/strings.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+using UnaryStringKernel = Status (*)(FunctionContext*, const Datum&, Datum*);
+
+class TestStrings : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertUnary(UnaryStringKernel kernel, const std::string& values_json,
+                   const std::shared_ptr<DataType>& out_type,
+                   const std::string& expected_json,
+                   const std::shared_ptr<DataType>& type = utf8()) {
+    AssertUnary(kernel, ArrayFromJSON(type, values_json),
+                ArrayFromJSON(out_type, expected_json));
+  }
+
+  void AssertUnary(UnaryStringKernel kernel, const std::shared_ptr<Array>& values,
+                   const std::shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(kernel(&this->ctx_, values, &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  void AssertSubstring(int64_t start, int64_t length, const std::string& values_json,
+                       const std::string& expected_json) {
+    Datum out;
+    ASSERT_OK(Substring(&this->ctx_, SubstringOptions(start, length),
+                        ArrayFromJSON(utf8(), values_json), &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayFromJSON(utf8(), expected_json), *actual);
+  }
+};
+
+TEST_F(TestStrings, AsciiCase) {
+  const std::string values =
+      R"(["aAbBzZ@[`{", null, "", "Hello, World! 0123456789", "ÉtÉ"])";
+  AssertUnary(AsciiLower, values, utf8(),
+              R"(["aabbzz@[`{", null, "", "hello, world! 0123456789", "ÉtÉ"])");
+  AssertUnary(AsciiUpper, values, utf8(),
+              R"(["AABBZZ@[`{", null, "", "HELLO, WORLD! 0123456789", "ÉTÉ"])");
+  AssertUnary(AsciiUpper, values, large_utf8(),
+              R"(["AABBZZ@[`{", null, "", "HELLO, WORLD! 0123456789", "ÉTÉ"])",
+              large_utf8());
+  AssertUnary(AsciiLower, "[]", utf8(), "[]");
+}
+
+TEST_F(TestStrings, Utf8Case) {
+  // Latin-1, Latin Extended-A, Greek, Cyrillic, Armenian, Latin Extended
+  // Additional and fullwidth letters, mixed with ASCII runs
+  const std::string values = R"(["Straße Àé×÷ÿ",
+      "ĀāŸ ΔδΣς ЖжЁё",
+      "Աա Ḁḁ Ａａ 😀", null,
+      "AN ASCII STRING OF MORE THAN EIGHT BYTES"])";
+  AssertUnary(Utf8Lower, values, utf8(), R"(["straße àé×÷ÿ",
+      "āāÿ δδσς жжёё",
+      "աա ḁḁ ａａ 😀", null,
+      "an ascii string of more than eight bytes"])");
+  AssertUnary(Utf8Upper, values, utf8(), R"(["STRAßE ÀÉ×÷Ÿ",
+      "ĀĀŸ ΔΔΣΣ ЖЖЁЁ",
+      "ԱԱ ḀḀ ＡＡ 😀", null,
+      "AN ASCII STRING OF MORE THAN EIGHT BYTES"])");
+  // Codepoints whose mappings would change the encoded length are left as is
+  AssertUnary(Utf8Lower, R"(["İΩ"])", utf8(), R"(["İΩ"])");
+  AssertUnary(Utf8Upper, R"(["ıſ"])", utf8(), R"(["ıſ"])");
+}
+
+TEST_F(TestStrings, Utf8CaseInvalid) {
+  // Truncated and stray bytes are copied, even where they would make a valid
+  // sequence across values
+  StringBuilder builder;
+  ASSERT_OK(builder.Append(std::string("A\xc3", 2)));
+  ASSERT_OK(builder.Append(std::string("\x80" "B\xe1\xb8", 4)));
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  ASSERT_OK(builder.Append(std::string("a\xc3", 2)));
+  ASSERT_OK(builder.Append(std::string("\x80" "b\xe1\xb8", 4)));
+  std::shared_ptr<Array> expected;
+  ASSERT_OK(builder.Finish(&expected));
+  AssertUnary(Utf8Lower, values, expected);
+}
+
+TEST_F(TestStrings, Sliced) {
+  auto values = ArrayFromJSON(utf8(), R"(["Ab", null, "cD", "eF", "Gh"])");
+  AssertUnary(AsciiUpper, values->Slice(1, 3),
+              ArrayFromJSON(utf8(), R"([null, "CD", "EF"])"));
+  AssertUnary(Utf8Lower, values->Slice(3), ArrayFromJSON(utf8(), R"(["ef", "gh"])"));
+  AssertUnary(Utf8Length, values->Slice(2, 2), ArrayFromJSON(int32(), "[2, 2]"));
+  AssertUnary(Utf8Upper, values->Slice(5), ArrayFromJSON(utf8(), "[]"));
+
+  Datum out;
+  ASSERT_OK(Contains(&this->ctx_, values->Slice(2), "F", &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, false]"),
+                    *out.make_array());
+  ASSERT_OK(Substring(&this->ctx_, SubstringOptions(1), values->Slice(1), &out));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"([null, "D", "F", "h"])"),
+                    *out.make_array());
+}
+
+TEST_F(TestStrings, Utf8Length) {
+  AssertUnary(Utf8Length, R"(["", null, "abc", "é€😀x",
+                              "an ascii string é of more than eight bytes"])",
+              int32(), "[0, null, 3, 4, 42]");
+  AssertUnary(Utf8Length, R"(["éééééééé", null])",
+              int64(), "[8, null]", large_utf8());
+}
+
+TEST_F(TestStrings, StartsEndsWith) {
+  const std::string values = R"(["abcdef", null, "", "ab", "xabc", "cdef"])";
+  Datum out;
+  ASSERT_OK(StartsWith(&this->ctx_, ArrayFromJSON(utf8(), values), "ab", &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, false, true, false, false]"),
+                    *out.make_array());
+  ASSERT_OK(EndsWith(&this->ctx_, ArrayFromJSON(large_utf8(), values), "def", &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, false, false, false, true]"),
+                    *out.make_array());
+  ASSERT_OK(StartsWith(&this->ctx_, ArrayFromJSON(utf8(), values), "", &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, true, true, true, true]"),
+                    *out.make_array());
+}
+
+TEST_F(TestStrings, Contains) {
+  const std::string values = R"(["", null, "a", "needle", "a haystack with a needle",
+      "a long haystack with a needle after more than sixteen bytes",
+      "a long haystack with neither seedle nor needl but nee and dle",
+      "needle at the start of a long haystack", "nee"])";
+  auto check = [&](const std::string& pattern, const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Contains(&this->ctx_, ArrayFromJSON(utf8(), values), pattern, &out));
+    AssertArraysEqual(*ArrayFromJSON(boolean(), expected), *out.make_array());
+  };
+  check("needle", "[false, null, false, true, true, true, false, true, false]");
+  check("", "[true, null, true, true, true, true, true, true, true]");
+  check("a", "[false, null, true, false, true, true, true, true, false]");
+  check("ne", "[false, null, false, true, true, true, true, true, true]");
+  check("bytes", "[false, null, false, false, false, true, false, false, false]");
+}
+
+TEST_F(TestStrings, ContainsLong) {
+  // Matches at each position of a string spanning several vectors
+  std::string haystack(100, 'x');
+  auto values = ArrayFromJSON(utf8(), "[\"" + haystack + "\"]");
+  for (size_t position = 0; position + 3 <= haystack.size(); ++position) {
+    std::string value = haystack;
+    value.replace(position, 3, "xyz");
+    Datum out;
+    ASSERT_OK(Contains(&this->ctx_, ArrayFromJSON(utf8(), "[\"" + value + "\"]"),
+                       "xyz", &out));
+    AssertArraysEqual(*ArrayFromJSON(boolean(), "[true]"), *out.make_array());
+    ASSERT_OK(Contains(&this->ctx_, values, "xyz", &out));
+    AssertArraysEqual(*ArrayFromJSON(boolean(), "[false]"), *out.make_array());
+  }
+}
+
+TEST_F(TestStrings, Substring) {
+  const std::string values = R"(["", null, "a", "abcdef", "é€😀x"])";
+  AssertSubstring(0, 2, values, R"(["", null, "a", "ab", "é€"])");
+  AssertSubstring(2, 2, values, R"(["", null, "", "cd", "😀x"])");
+  AssertSubstring(1, 100, values, R"(["", null, "", "bcdef", "€😀x"])");
+  AssertSubstring(-2, 1, values, R"(["", null, "a", "e", "😀"])");
+  AssertSubstring(-10, 2, values, R"(["", null, "a", "ab", "é€"])");
+  AssertSubstring(10, 2, values, R"(["", null, "", "", ""])");
+  AssertSubstring(1, 0, values, R"(["", null, "", "", ""])");
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Substring(&this->ctx_, SubstringOptions(0, -1),
+                                   ArrayFromJSON(utf8(), values), &out));
+}
+
+TEST_F(TestStrings, ChunkedArray) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["aB", null])"),
+                  ArrayFromJSON(utf8(), R"(["é"])")});
+  Datum out;
+  ASSERT_OK(Utf8Upper(&this->ctx_, chunked, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(*std::make_shared<ChunkedArray>(
+                         ArrayVector{ArrayFromJSON(utf8(), R"(["AB", null])"),
+                                     ArrayFromJSON(utf8(), R"(["É"])")}),
+                     *out.chunked_array());
+
+  ASSERT_OK(Utf8Length(&this->ctx_, chunked, &out));
+  AssertChunkedEqual(*std::make_shared<ChunkedArray>(ArrayVector{
+                         ArrayFromJSON(int32(), "[2, null]"),
+                         ArrayFromJSON(int32(), "[1]")}),
+                     *out.chunked_array());
+
+  ASSERT_OK(Utf8Length(&this->ctx_, std::make_shared<ChunkedArray>(ArrayVector{},
+                                                                   large_utf8()),
+                       &out));
+  ASSERT_TRUE(out.chunked_array()->type()->Equals(int64()));
+}
+
+TEST_F(TestStrings, InvalidType) {
+  Datum out;
+  ASSERT_RAISES(Invalid, Utf8Lower(&this->ctx_, ArrayFromJSON(int32(), "[1]"), &out));
+  ASSERT_RAISES(Invalid,
+                Contains(&this->ctx_, ArrayFromJSON(binary(), "[\"a\"]"), "a", &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
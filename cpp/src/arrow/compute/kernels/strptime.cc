@@ -0,0 +1,710 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/strptime.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/sse_util.h"
+
+namespace arrow {
+
+namespace compute {
+
+namespace {
+
+// The number of strings parsed by each task of a parallel Strptime
+constexpr int64_t kParallelStrptimeTaskSize = 1 << 16;
+
+// Fixed-width formats up to this width are parsed a word at a time
+constexpr int32_t kMaxFixedWidth = 32;
+constexpr int32_t kFixedWords = kMaxFixedWidth / 8;
+
+constexpr uint64_t kAllZeros = 0x3030303030303030ULL;
+constexpr uint64_t kAllSixes = 0x0606060606060606ULL;
+constexpr uint64_t kHighNibbles = 0xF0F0F0F0F0F0F0F0ULL;
+
+constexpr int32_t kMaxFractionDigits = 9;
+
+constexpr int64_t kPowersOfTen[] = {1,       10,       100,       1000,      10000,
+                                    100000,  1000000,  10000000,  100000000, 1000000000};
+
+// The fields of a parsed string
+struct TimestampFields {
+  enum Field { YEAR, MONTH, DAY, HOUR, MINUTE, SECOND, NUM_FIELDS };
+
+  // Indexed by Field, defaulting to 1970-01-01 00:00:00
+  uint32_t values[NUM_FIELDS] = {1970, 1, 1, 0, 0, 0};
+  // In units of the timestamp
+  int64_t fraction = 0;
+  // In seconds east of UTC
+  int32_t utc_offset = 0;
+};
+
+inline bool IsLeapYear(uint32_t year) {
+  return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+inline uint32_t DaysInMonth(uint32_t year, uint32_t month) {
+  static constexpr uint8_t kDaysInMonth[] = {31, 28, 31, 30, 31, 30,
+                                             31, 31, 30, 31, 30, 31};
+  return month == 2 && IsLeapYear(year) ? 29 : kDaysInMonth[month - 1];
+}
+
+// The number of days between 1970-01-01 and the given date of the proleptic
+// Gregorian calendar (Howard Hinnant's days_from_civil, for years from 0)
+inline int64_t DaysFromCivil(uint32_t year, uint32_t month, uint32_t day) {
+  const int64_t y = static_cast<int64_t>(year) - (month <= 2 ? 1 : 0);
+  const int64_t era = (y >= 0 ? y : y - 399) / 400;
+  const uint32_t year_of_era = static_cast<uint32_t>(y - era * 400);
+  const uint32_t month_of_year = month > 2 ? month - 3 : month + 9;
+  const uint32_t day_of_year = (153 * month_of_year + 2) / 5 + day - 1;
+  const uint32_t day_of_era =
+      year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+}
+
+// The number of fractional digits of a unit
+inline int32_t UnitDigits(TimeUnit::type unit) {
+  switch (unit) {
+    case TimeUnit::SECOND:
+      return 0;
+    case TimeUnit::MILLI:
+      return 3;
+    case TimeUnit::MICRO:
+      return 6;
+    default:
+      return 9;
+  }
+}
+
+// A Strptime format compiled into a sequence of steps, each matching a
+// literal or a field.
+//
+// Formats of a fixed width are also compiled into per-byte masks, which check
+// a string and extract its digits a 64-bit word (or a 128-bit vector) at a
+// time rather than a character at a time.  Each digit is then summed with ten
+// times the one before it, and each field is gathered from one or two of
+// these pairs of digits.
+class StrptimeFormat {
+ public:
+  static Status Make(const std::string& format, TimeUnit::type unit,
+                     std::unique_ptr<StrptimeFormat>* out) {
+    std::unique_ptr<StrptimeFormat> plan(new StrptimeFormat(unit));
+    RETURN_NOT_OK(plan->Compile(format));
+    *out = std::move(plan);
+    return Status::OK();
+  }
+
+  /// Parse a string, returning false if it doesn't match the format or
+  /// isn't a valid timestamp of the unit
+  bool Parse(const char* s, size_t length, int64_t* out) const {
+    TimestampFields fields;
+    bool ok;
+    switch (num_words_) {
+      case 1:
+        ok = ParseFixed<1>(s, length, &fields);
+        break;
+      case 2:
+        ok = ParseFixed<2>(s, length, &fields);
+        break;
+#ifdef ARROW_HAVE_SSE4_2
+      case 3:
+      case 4:
+        ok = ParseFixedSse(s, length, &fields);
+        break;
+#else
+      case 3:
+        ok = ParseFixed<3>(s, length, &fields);
+        break;
+      case 4:
+        ok = ParseFixed<4>(s, length, &fields);
+        break;
+#endif
+      default:
+        ok = ParseSteps(s, length, &fields);
+        break;
+    }
+    if (ARROW_PREDICT_FALSE(!ok)) {
+      return false;
+    }
+    if (two_digit_year_) {
+      uint32_t& year = fields.values[TimestampFields::YEAR];
+      year += year < 69 ? 2000 : 1900;
+    }
+    return Convert(fields, out);
+  }
+
+ private:
+  enum StepKind { LITERAL, FIELD, FRACTION, UTC_OFFSET };
+
+  struct Step {
+    StepKind kind;
+    // Number of characters, for all steps but FRACTION
+    int32_t width;
+    // Offset in the string, for fixed-width formats
+    int32_t offset;
+    // For FIELD steps
+    TimestampFields::Field field;
+    // For LITERAL steps
+    std::string literal;
+  };
+
+  // The values gathered from the pairs of digits of a fixed-width string: the
+  // fields, then the hours and minutes of the UTC offset
+  static constexpr int32_t kUtcOffsetHours = TimestampFields::NUM_FIELDS;
+  static constexpr int32_t kUtcOffsetMinutes = TimestampFields::NUM_FIELDS + 1;
+  static constexpr int32_t kNumGathered = TimestampFields::NUM_FIELDS + 2;
+
+  // The position of a zero after the pairs of digits, for gathering nothing
+  static constexpr uint8_t kNoPair = kMaxFixedWidth;
+
+  explicit StrptimeFormat(TimeUnit::type unit)
+      : unit_digits_(UnitDigits(unit)),
+        units_per_second_(kPowersOfTen[unit_digits_]),
+        // Keep a second of margin for the fraction
+        max_seconds_(std::numeric_limits<int64_t>::max() / units_per_second_ - 1),
+        min_seconds_(std::numeric_limits<int64_t>::min() / units_per_second_ + 1) {}
+
+  void AddStep(StepKind kind, int32_t width,
+               TimestampFields::Field field = TimestampFields::NUM_FIELDS) {
+    steps_.push_back({kind, width, 0, field, ""});
+  }
+
+  void AddLiteral(char c) {
+    if (steps_.empty() || steps_.back().kind != LITERAL) {
+      AddStep(LITERAL, 0);
+    }
+    steps_.back().literal += c;
+    ++steps_.back().width;
+  }
+
+  Status Compile(const std::string& format) {
+    bool has_utc_offset = false;
+    for (size_t i = 0; i < format.size(); ++i) {
+      if (format[i] != '%') {
+        AddLiteral(format[i]);
+        continue;
+      }
+      if (++i == format.size()) {
+        return Status::Invalid("Strptime format '", format, "' ends with '%'");
+      }
+      switch (format[i]) {
+        case '%':
+          AddLiteral('%');
+          break;
+        case 'Y':
+          AddStep(FIELD, 4, TimestampFields::YEAR);
+          two_digit_year_ = false;
+          break;
+        case 'y':
+          AddStep(FIELD, 2, TimestampFields::YEAR);
+          two_digit_year_ = true;
+          break;
+        case 'm':
+          AddStep(FIELD, 2, TimestampFields::MONTH);
+          break;
+        case 'd':
+          AddStep(FIELD, 2, TimestampFields::DAY);
+          break;
+        case 'H':
+          AddStep(FIELD, 2, TimestampFields::HOUR);
+          break;
+        case 'M':
+          AddStep(FIELD, 2, TimestampFields::MINUTE);
+          break;
+        case 'S':
+          AddStep(FIELD, 2, TimestampFields::SECOND);
+          break;
+        case 'f':
+          if (!steps_.empty() && steps_.back().kind == FRACTION) {
+            return Status::Invalid("Adjacent %f in Strptime format '", format, "'");
+          }
+          AddStep(FRACTION, 0);
+          break;
+        case 'z':
+          if (has_utc_offset) {
+            return Status::Invalid("Several %z in Strptime format '", format, "'");
+          }
+          has_utc_offset = true;
+          AddStep(UTC_OFFSET, 5);
+          break;
+        default:
+          return Status::Invalid("Unsupported directive '%", format[i],
+                                 "' in Strptime format '", format, "'");
+      }
+    }
+    CompileFixedWidth();
+    return Status::OK();
+  }
+
+  void CompileFixedWidth() {
+    int32_t width = 0;
+    for (auto& step : steps_) {
+      if (step.kind == FRACTION) {
+        return;
+      }
+      step.offset = width;
+      width += step.width;
+    }
+    if (width == 0 || width > kMaxFixedWidth) {
+      return;
+    }
+    fixed_width_ = width;
+    num_words_ = static_cast<int32_t>(BitUtil::CeilDiv(width, 8));
+
+    std::memset(literal_mask_, 0, sizeof(literal_mask_));
+    std::memset(literal_bytes_, 0, sizeof(literal_bytes_));
+    std::memset(digit_mask_, 0, sizeof(digit_mask_));
+    auto set_byte = [](uint64_t* words, int32_t position, uint8_t value) {
+      words[position / 8] |= static_cast<uint64_t>(value) << (8 * (position % 8));
+    };
+    // Absent fields default to 1970-01-01 00:00:00
+    const uint8_t default_high[kNumGathered] = {19, 0, 0, 0, 0, 0, 0, 0};
+    const uint8_t default_low[kNumGathered] = {70, 1, 1, 0, 0, 0, 0, 0};
+    for (int32_t i = 0; i < kNumGathered; ++i) {
+      gather_high_[i] = gather_low_[i] = kNoPair;
+      default_high_[i] = default_high[i];
+      default_low_[i] = default_low[i];
+    }
+    auto gather = [&](int32_t value, int32_t high, int32_t low) {
+      gather_high_[value] = static_cast<uint8_t>(high);
+      gather_low_[value] = static_cast<uint8_t>(low);
+      default_high_[value] = default_low_[value] = 0;
+    };
+    for (const auto& step : steps_) {
+      if (step.kind == LITERAL) {
+        for (int32_t i = 0; i < step.width; ++i) {
+          set_byte(literal_mask_, step.offset + i, 0xFF);
+          set_byte(literal_bytes_, step.offset + i,
+                   static_cast<uint8_t>(step.literal[i]));
+        }
+        continue;
+      }
+      // The sign of a UTC offset is checked on its own
+      const int32_t first_digit = step.kind == UTC_OFFSET ? 1 : 0;
+      for (int32_t i = first_digit; i < step.width; ++i) {
+        set_byte(digit_mask_, step.offset + i, 0xFF);
+      }
+      if (step.kind == UTC_OFFSET) {
+        utc_offset_position_ = step.offset;
+        gather(kUtcOffsetHours, kNoPair, step.offset + 1);
+        gather(kUtcOffsetMinutes, kNoPair, step.offset + 3);
+      } else if (step.width == 4) {
+        gather(step.field, step.offset, step.offset + 2);
+      } else {
+        gather(step.field, kNoPair, step.offset);
+      }
+    }
+
+#ifdef ARROW_HAVE_SSE4_2
+    // Byte i of the tail shuffle is byte i + 32 - width of the last 16 bytes
+    // of the string, or zero past its end.  Bytes of the gather shuffles pick
+    // the pairs of either vector, or zero (0x80).
+    for (int32_t i = 0; i < 16; ++i) {
+      tail_shuffle_[i] = i + 16 < width ? static_cast<uint8_t>(i + 32 - width) : 0x80;
+    }
+    for (int32_t v = 0; v < 2; ++v) {
+      auto pick = [v](uint8_t position) {
+        return position >= 16 * v && position < 16 * v + 16
+                   ? static_cast<uint8_t>(position - 16 * v)
+                   : static_cast<uint8_t>(0x80);
+      };
+      std::memset(sse_gather_high_[v], 0x80, sizeof(sse_gather_high_[v]));
+      std::memset(sse_gather_low_[v], 0x80, sizeof(sse_gather_low_[v]));
+      for (int32_t i = 0; i < kNumGathered; ++i) {
+        sse_gather_high_[v][i] = pick(gather_high_[i]);
+        sse_gather_low_[v][i] = pick(gather_low_[i]);
+      }
+    }
+#endif
+  }
+
+  template <int32_t kNumWords>
+  bool ParseFixed(const char* s, size_t length, TimestampFields* out) const {
+    if (ARROW_PREDICT_FALSE(length != static_cast<size_t>(fixed_width_))) {
+      return false;
+    }
+    uint64_t digits[kNumWords + 1];
+    uint64_t mismatch = 0;
+    for (int32_t i = 0; i < kNumWords; ++i) {
+      uint64_t word = 0;
+      const int32_t padding = 8 * i + 8 - fixed_width_;
+      if (padding <= 0) {
+        std::memcpy(&word, s + 8 * i, sizeof(word));
+        word = BitUtil::FromLittleEndian(word);
+      } else if (fixed_width_ >= 8) {
+        // Zero-pad the last word, so as not to read past the string, by
+        // loading the last eight bytes of the string
+        std::memcpy(&word, s + fixed_width_ - 8, sizeof(word));
+        word = BitUtil::FromLittleEndian(word) >> (8 * padding);
+      } else {
+        std::memcpy(&word, s, fixed_width_);
+        word = BitUtil::FromLittleEndian(word);
+      }
+      const uint64_t digit_mask = digit_mask_[i];
+      // Literals must match, and digits be within 0x30 and 0x39 ('0' and '9'),
+      // the latter being checked without carries beyond their own byte
+      mismatch |= (word ^ literal_bytes_[i]) & literal_mask_[i];
+      mismatch |= (word & kHighNibbles & digit_mask) ^ (kAllZeros & digit_mask);
+      mismatch |= ((word + (kAllSixes & digit_mask)) & kHighNibbles & digit_mask) ^
+                  (kAllZeros & digit_mask);
+      digits[i] = (word & digit_mask) - (kAllZeros & digit_mask);
+    }
+    if (ARROW_PREDICT_FALSE(mismatch != 0)) {
+      return false;
+    }
+    uint8_t pairs[kMaxFixedWidth + 1];
+    digits[kNumWords] = 0;
+    for (int32_t i = 0; i < kNumWords; ++i) {
+      const uint64_t next_digits = (digits[i] >> 8) | (digits[i + 1] << 56);
+      const uint64_t values = BitUtil::ToLittleEndian(digits[i] * 10 + next_digits);
+      std::memcpy(pairs + 8 * i, &values, sizeof(values));
+    }
+    pairs[kNoPair] = 0;
+    uint32_t values[kNumGathered];
+    for (int32_t i = 0; i < kNumGathered; ++i) {
+      values[i] = (pairs[gather_high_[i]] + default_high_[i]) * 100U +
+                  pairs[gather_low_[i]] + default_low_[i];
+    }
+    std::memcpy(out->values, values, sizeof(out->values));
+    return utc_offset_position_ < 0 ||
+           SetUtcOffset(s[utc_offset_position_], values[kUtcOffsetHours],
+                        values[kUtcOffsetMinutes], out);
+  }
+
+#ifdef ARROW_HAVE_SSE4_2
+  // Parse a fixed-width string of 17 to 32 characters as two vectors of 16
+  bool ParseFixedSse(const char* s, size_t length, TimestampFields* out) const {
+    if (ARROW_PREDICT_FALSE(length != static_cast<size_t>(fixed_width_))) {
+      return false;
+    }
+    auto load = [](const void* p) {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    };
+    const __m128i zeros = _mm_set1_epi8('0');
+    const __m128i nines = _mm_set1_epi8(9);
+    __m128i chars[2];
+    chars[0] = load(s);
+    // Zero-pad the second vector, so as not to read past the string, by
+    // loading the last sixteen bytes of the string and shuffling them in place
+    chars[1] = _mm_shuffle_epi8(load(s + fixed_width_ - 16), load(tail_shuffle_));
+    __m128i digits[2];
+    int match = 0xFFFF;
+    for (int i = 0; i < 2; ++i) {
+      const __m128i literal_mask = load(literal_mask_ + 2 * i);
+      const __m128i digit_mask = load(digit_mask_ + 2 * i);
+      // Literals must match, and digits be within '0' and '9'
+      const __m128i literals_match = _mm_cmpeq_epi8(_mm_and_si128(chars[i], literal_mask),
+                                                    load(literal_bytes_ + 2 * i));
+      const __m128i unmasked_digits = _mm_sub_epi8(chars[i], zeros);
+      const __m128i digits_match = _mm_or_si128(
+          _mm_cmpeq_epi8(_mm_min_epu8(unmasked_digits, nines), unmasked_digits),
+          _mm_andnot_si128(digit_mask, _mm_set1_epi8(-1)));
+      match &= _mm_movemask_epi8(_mm_and_si128(literals_match, digits_match));
+      digits[i] = _mm_and_si128(unmasked_digits, digit_mask);
+    }
+    if (ARROW_PREDICT_FALSE(match != 0xFFFF)) {
+      return false;
+    }
+    // Gather the high and low pairs of each value from both vectors.  The
+    // digits being at most 9, multiplying them by 8 and 2 with shifts of
+    // 16-bit lanes doesn't carry into the next byte.
+    const __m128i next_digits[2] = {_mm_alignr_epi8(digits[1], digits[0], 1),
+                                    _mm_srli_si128(digits[1], 1)};
+    __m128i high = load(default_high_);
+    __m128i low = load(default_low_);
+    for (int i = 0; i < 2; ++i) {
+      const __m128i tens = _mm_add_epi8(_mm_slli_epi16(digits[i], 3),
+                                        _mm_add_epi8(digits[i], digits[i]));
+      const __m128i pairs = _mm_add_epi8(tens, next_digits[i]);
+      high = _mm_or_si128(high, _mm_shuffle_epi8(pairs, load(sse_gather_high_[i])));
+      low = _mm_or_si128(low, _mm_shuffle_epi8(pairs, load(sse_gather_low_[i])));
+    }
+    // Each 16-bit lane of the values is low + 100 * high
+    const __m128i values =
+        _mm_maddubs_epi16(_mm_unpacklo_epi8(low, high), _mm_set1_epi16(100 << 8 | 1));
+    out->values[0] = static_cast<uint32_t>(_mm_extract_epi16(values, 0));
+    out->values[1] = static_cast<uint32_t>(_mm_extract_epi16(values, 1));
+    out->values[2] = static_cast<uint32_t>(_mm_extract_epi16(values, 2));
+    out->values[3] = static_cast<uint32_t>(_mm_extract_epi16(values, 3));
+    out->values[4] = static_cast<uint32_t>(_mm_extract_epi16(values, 4));
+    out->values[5] = static_cast<uint32_t>(_mm_extract_epi16(values, 5));
+    return utc_offset_position_ < 0 ||
+           SetUtcOffset(s[utc_offset_position_], _mm_extract_epi16(values, 6),
+                        _mm_extract_epi16(values, 7), out);
+  }
+#endif
+
+  static bool ToDigits(const char* s, int32_t width, uint8_t* digits) {
+    for (int32_t i = 0; i < width; ++i) {
+      digits[i] = static_cast<uint8_t>(s[i] - '0');
+      if (ARROW_PREDICT_FALSE(digits[i] > 9)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool ParseSteps(const char* s, size_t length, TimestampFields* out) const {
+    uint8_t digits[4];
+    size_t position = 0;
+    for (const auto& step : steps_) {
+      const char* current = s + position;
+      const size_t remaining = length - position;
+      if (step.kind == FRACTION) {
+        // Digits beyond those of the unit are truncated
+        int32_t width = 0;
+        int64_t fraction = 0;
+        while (static_cast<size_t>(width) < remaining && width < kMaxFractionDigits &&
+               current[width] >= '0' && current[width] <= '9') {
+          if (width < unit_digits_) {
+            fraction = fraction * 10 + (current[width] - '0');
+          }
+          ++width;
+        }
+        if (ARROW_PREDICT_FALSE(width == 0)) {
+          return false;
+        }
+        out->fraction = fraction * kPowersOfTen[std::max(unit_digits_ - width, 0)];
+        position += width;
+        continue;
+      }
+      if (ARROW_PREDICT_FALSE(remaining < static_cast<size_t>(step.width))) {
+        return false;
+      }
+      switch (step.kind) {
+        case LITERAL:
+          if (ARROW_PREDICT_FALSE(
+                  std::memcmp(current, step.literal.data(), step.width) != 0)) {
+            return false;
+          }
+          break;
+        case UTC_OFFSET:
+          if (ARROW_PREDICT_FALSE(!ToDigits(current + 1, 4, digits)) ||
+              ARROW_PREDICT_FALSE(!SetUtcOffset(current[0], digits[0] * 10 + digits[1],
+                                                digits[2] * 10 + digits[3], out))) {
+            return false;
+          }
+          break;
+        default: {
+          if (ARROW_PREDICT_FALSE(!ToDigits(current, step.width, digits))) {
+            return false;
+          }
+          uint32_t value = 0;
+          for (int32_t i = 0; i < step.width; ++i) {
+            value = value * 10 + digits[i];
+          }
+          out->values[step.field] = value;
+          break;
+        }
+      }
+      position += step.width;
+    }
+    return position == length;
+  }
+
+  static bool SetUtcOffset(char sign, int32_t hours, int32_t minutes,
+                           TimestampFields* out) {
+    if (ARROW_PREDICT_FALSE(sign != '+' && sign != '-') ||
+        ARROW_PREDICT_FALSE(hours >= 24) || ARROW_PREDICT_FALSE(minutes >= 60)) {
+      return false;
+    }
+    out->utc_offset = (sign == '+' ? 1 : -1) * (hours * 3600 + minutes * 60);
+    return true;
+  }
+
+  bool Convert(const TimestampFields& fields, int64_t* out) const {
+    const uint32_t year = fields.values[TimestampFields::YEAR];
+    const uint32_t month = fields.values[TimestampFields::MONTH];
+    const uint32_t day = fields.values[TimestampFields::DAY];
+    const uint32_t hour = fields.values[TimestampFields::HOUR];
+    const uint32_t minute = fields.values[TimestampFields::MINUTE];
+    const uint32_t second = fields.values[TimestampFields::SECOND];
+    if (ARROW_PREDICT_FALSE(month < 1 || month > 12) ||
+        ARROW_PREDICT_FALSE(day < 1 || day > DaysInMonth(year, month)) ||
+        ARROW_PREDICT_FALSE(hour >= 24) || ARROW_PREDICT_FALSE(minute >= 60) ||
+        ARROW_PREDICT_FALSE(second >= 60)) {
+      return false;
+    }
+    const int64_t seconds = DaysFromCivil(year, month, day) * 86400 + hour * 3600 +
+                            minute * 60 + second - fields.utc_offset;
+    if (ARROW_PREDICT_FALSE(seconds > max_seconds_ || seconds < min_seconds_)) {
+      return false;
+    }
+    *out = seconds * units_per_second_ + fields.fraction;
+    return true;
+  }
+
+  const int32_t unit_digits_;
+  const int64_t units_per_second_;
+  const int64_t max_seconds_;
+  const int64_t min_seconds_;
+
+  std::vector<Step> steps_;
+  bool two_digit_year_ = false;
+
+  // Only for fixed-width formats.  Byte i of the string is byte i % 8 of
+  // word i / 8 of the masks, from the least significant one.
+  int32_t fixed_width_ = -1;
+  int32_t num_words_ = 0;
+  int32_t utc_offset_position_ = -1;
+  uint64_t literal_mask_[kFixedWords];
+  uint64_t literal_bytes_[kFixedWords];
+  uint64_t digit_mask_[kFixedWords];
+  // Each gathered value is 100 * (pairs[gather_high] + default_high) +
+  // pairs[gather_low] + default_low, padded to 16 bytes for SSE loads
+  uint8_t gather_high_[kNumGathered];
+  uint8_t gather_low_[kNumGathered];
+  uint8_t default_high_[16] = {};
+  uint8_t default_low_[16] = {};
+#ifdef ARROW_HAVE_SSE4_2
+  uint8_t tail_shuffle_[16];
+  uint8_t sse_gather_high_[2][16];
+  uint8_t sse_gather_low_[2][16];
+#endif
+};
+
+constexpr int32_t StrptimeFormat::kUtcOffsetHours;
+constexpr int32_t StrptimeFormat::kUtcOffsetMinutes;
+constexpr int32_t StrptimeFormat::kNumGathered;
+constexpr uint8_t StrptimeFormat::kNoPair;
+
+template <typename ArrayType>
+Status StrptimeArray(FunctionContext* ctx, const StrptimeFormat& format,
+                     const StrptimeOptions& options, const ArrayData& input,
+                     std::shared_ptr<ArrayData>* out) {
+  const ArrayType values(input.Copy());
+  const int64_t length = input.length;
+  auto out_data = ArrayData::Make(timestamp(options.unit), length);
+  out_data->buffers.resize(2);
+  uint8_t* out_bitmap = nullptr;
+  if (options.error_is_null) {
+    // Strings failing to parse are nulled out, so the bitmap can't be shared
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &out_data->buffers[0]));
+    out_bitmap = out_data->buffers[0]->mutable_data();
+    if (input.GetNullCount() == 0) {
+      BitUtil::SetBitsTo(out_bitmap, 0, length, true);
+    } else {
+      internal::CopyBitmap(input.buffers[0]->data(), input.offset, length, out_bitmap,
+                           0);
+    }
+  } else {
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, input, out_data.get()));
+  }
+  RETURN_NOT_OK(ctx->Allocate(length * sizeof(int64_t), &out_data->buffers[1]));
+  auto out_values = reinterpret_cast<int64_t*>(out_data->buffers[1]->mutable_data());
+
+  auto parse_range = [&](int64_t offset, int64_t range_length) -> Status {
+    for (int64_t i = offset; i < offset + range_length; ++i) {
+      if (values.IsNull(i)) {
+        out_values[i] = 0;
+        continue;
+      }
+      const auto view = values.GetView(i);
+      if (ARROW_PREDICT_FALSE(!format.Parse(view.data(), view.size(), out_values + i))) {
+        if (!options.error_is_null) {
+          return Status::Invalid("Failed to parse string '", view,
+                                 "' with Strptime format '", options.format, "'");
+        }
+        out_values[i] = 0;
+        BitUtil::ClearBit(out_bitmap, i);
+      }
+    }
+    return Status::OK();
+  };
+
+  if (ctx->use_threads() && length >= 2 * kParallelStrptimeTaskSize) {
+    // Task offsets are multiples of 8, so no two tasks write to the same byte
+    // of the output bitmap
+    const int num_tasks =
+        static_cast<int>(BitUtil::CeilDiv(length, kParallelStrptimeTaskSize));
+    RETURN_NOT_OK(internal::ParallelFor(num_tasks, [&](int task) {
+      const int64_t offset = task * kParallelStrptimeTaskSize;
+      return parse_range(offset, std::min(kParallelStrptimeTaskSize, length - offset));
+    }));
+  } else {
+    RETURN_NOT_OK(parse_range(0, length));
+  }
+
+  if (options.error_is_null) {
+    out_data->null_count = length - internal::CountSetBits(out_bitmap, 0, length);
+  }
+  *out = std::move(out_data);
+  return Status::OK();
+}
+
+Status StrptimeArray(FunctionContext* ctx, const StrptimeFormat& format,
+                     const StrptimeOptions& options, const ArrayData& input,
+                     std::shared_ptr<ArrayData>* out) {
+  switch (input.type->id()) {
+    case Type::STRING:
+      return StrptimeArray<StringArray>(ctx, format, options, input, out);
+    case Type::LARGE_STRING:
+      return StrptimeArray<LargeStringArray>(ctx, format, options, input, out);
+    default:
+      return Status::Invalid("Strptime expects strings, got ", input.type->ToString());
+  }
+}
+
+}  // namespace
+
+Status Strptime(FunctionContext* ctx, const StrptimeOptions& options,
+                const Datum& values, Datum* out) {
+  std::unique_ptr<StrptimeFormat> format;
+  RETURN_NOT_OK(StrptimeFormat::Make(options.format, options.unit, &format));
+
+  if (values.kind() == Datum::ARRAY) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(StrptimeArray(ctx, *format, options, *values.array(), &result));
+    *out = result;
+    return Status::OK();
+  }
+  if (values.kind() == Datum::CHUNKED_ARRAY) {
+    const auto& chunked = *values.chunked_array();
+    ArrayVector chunks;
+    for (const auto& chunk : chunked.chunks()) {
+      std::shared_ptr<ArrayData> result;
+      RETURN_NOT_OK(StrptimeArray(ctx, *format, options, *chunk->data(), &result));
+      chunks.push_back(MakeArray(result));
+    }
+    *out = std::make_shared<ChunkedArray>(chunks, timestamp(options.unit));
+    return Status::OK();
+  }
+  return Status::Invalid("Strptime expects array or chunked array values");
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+#include <utility>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Options for the Strptime kernel
+///
+/// The format is made of literal characters and of the following directives,
+/// which all expect zero-padded fields of a fixed number of digits:
+/// - %Y: four-digit year
+/// - %y: two-digit year, 69-99 being 1969-1999 and 00-68 being 2000-2068
+/// - %m: month, 01-12
+/// - %d: day of the month, 01-31
+/// - %H: hour, 00-23
+/// - %M: minute, 00-59
+/// - %S: second, 00-59
+/// - %f: fractional second of 1 to 9 digits, truncated to the unit
+/// - %z: UTC offset, as +hhmm or -hhmm
+/// - %%: a literal '%'
+///
+/// Missing date fields default to 1970-01-01, and missing time fields to
+/// zero.  Without %z, times are taken as UTC.
+struct ARROW_EXPORT StrptimeOptions {
+  explicit StrptimeOptions(std::string format, TimeUnit::type unit = TimeUnit::SECOND,
+                           bool error_is_null = false)
+      : format(std::move(format)), unit(unit), error_is_null(error_is_null) {}
+
+  /// The format of the strings to parse
+  std::string format;
+  /// The unit of the resulting timestamps
+  TimeUnit::type unit;
+  /// Emit null rather than fail for strings not matching the format
+  bool error_is_null;
+};
+
+/// \brief Parse strings into timestamps according to a format
+///
+/// The format is compiled once into a parsing plan.  Formats without %f,
+/// such as "%Y-%m-%d %H:%M:%S", have a fixed width, and their strings are
+/// checked and have their digits extracted a 64-bit word (or, with SSE4.2,
+/// a 128-bit vector) at a time.
+/// Large arrays are parsed in parallel if the context uses threads.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the format, unit and error handling
+/// \param[in] values datum of utf8 or large_utf8, expecting Array or
+/// ChunkedArray
+/// \param[out] out resulting datum of timestamp(options.unit), of the same
+/// kind as the input
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Strptime(FunctionContext* context, const StrptimeOptions& options,
+                const Datum& values, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
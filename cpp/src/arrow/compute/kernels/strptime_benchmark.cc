@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+
+#include "arrow/builder.h"
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/strptime.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x0ff1ce;
+
+constexpr int64_t kTimestampLength = 19;
+
+// Generate "YYYY-MM-DD HH:MM:SS" strings, followed by the given suffix
+static std::shared_ptr<Array> MakeTimestampStrings(int64_t length,
+                                                   const char* suffix = "") {
+  std::default_random_engine engine(kSeed);
+  std::uniform_int_distribution<int> year(1970, 2037), month(1, 12), day(1, 28),
+      hour(0, 23), minute(0, 59);
+  StringBuilder builder;
+  ABORT_NOT_OK(builder.Reserve(length));
+  char buffer[64];
+  for (int64_t i = 0; i < length; ++i) {
+    snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d:%02d:%02d%s", year(engine),
+             month(engine), day(engine), hour(engine), minute(engine), minute(engine),
+             suffix);
+    ABORT_NOT_OK(builder.Append(buffer));
+  }
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(builder.Finish(&out));
+  return out;
+}
+
+static void StrptimeFixedWidth(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeTimestampStrings(args.size / kTimestampLength);
+  StrptimeOptions options("%Y-%m-%d %H:%M:%S");
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Strptime(&ctx, options, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void StrptimeFraction(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeTimestampStrings(args.size / (kTimestampLength + 4), ".125");
+  StrptimeOptions options("%Y-%m-%d %H:%M:%S.%f", TimeUnit::MILLI);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Strptime(&ctx, options, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+// The ISO-8601 cast, for comparison
+static void CastStringToTimestamp(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeTimestampStrings(args.size / kTimestampLength);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, values, timestamp(TimeUnit::SECOND), CastOptions(), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+BENCHMARK(StrptimeFixedWidth)->Apply(RegressionSetArgs);
+BENCHMARK(StrptimeFraction)->Apply(RegressionSetArgs);
+BENCHMARK(CastStringToTimestamp)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,197 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/strptime.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestStrptime : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertParse(const std::string& format, TimeUnit::type unit,
+                   const std::string& values_json, const std::string& expected_json,
+                   const std::shared_ptr<DataType>& type = utf8()) {
+    Datum out;
+    ASSERT_OK(Strptime(&this->ctx_, StrptimeOptions(format, unit),
+                       ArrayFromJSON(type, values_json), &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*ArrayFromJSON(timestamp(unit), expected_json), *actual);
+  }
+
+  void AssertFails(const std::string& format, const std::string& value) {
+    Datum out;
+    auto values = ArrayFromJSON(utf8(), "[\"" + value + "\"]");
+    ASSERT_RAISES(Invalid, Strptime(&this->ctx_, StrptimeOptions(format), values, &out));
+    ASSERT_OK(
+        Strptime(&this->ctx_, StrptimeOptions(format, TimeUnit::SECOND, true), values,
+                 &out));
+    AssertArraysEqual(*ArrayFromJSON(timestamp(TimeUnit::SECOND), "[null]"),
+                      *out.make_array());
+  }
+};
+
+TEST_F(TestStrptime, FixedWidth) {
+  const std::string format = "%Y-%m-%d %H:%M:%S";
+  const std::string values = R"(["2019-08-30 12:34:56", null, "1969-12-31 23:59:59",
+                                 "2000-02-29 00:00:00", "1900-01-01 00:00:00"])";
+  AssertParse(format, TimeUnit::SECOND, values,
+              "[1567168496, null, -1, 951782400, -2208988800]");
+  AssertParse(format, TimeUnit::MILLI, values,
+              "[1567168496000, null, -1000, 951782400000, -2208988800000]");
+  AssertParse(format, TimeUnit::NANO, values,
+              R"([1567168496000000000, null, -1000000000, 951782400000000000,
+                  -2208988800000000000])",
+              large_utf8());
+
+  // Sliced
+  Datum out;
+  ASSERT_OK(Strptime(&this->ctx_, StrptimeOptions(format),
+                     ArrayFromJSON(utf8(), values)->Slice(2, 2), &out));
+  AssertArraysEqual(*ArrayFromJSON(timestamp(TimeUnit::SECOND), "[-1, 951782400]"),
+                    *out.make_array());
+}
+
+TEST_F(TestStrptime, FieldsAndDefaults) {
+  AssertParse("%y%m%d", TimeUnit::SECOND, R"(["190830", "691231"])",
+              "[1567123200, -86400]");
+  AssertParse("%y", TimeUnit::SECOND, R"(["68", "69"])", "[3092601600, -31536000]");
+  AssertParse("%H:%M", TimeUnit::SECOND, R"(["23:00"])", "[82800]");
+  AssertParse("%%%Y", TimeUnit::SECOND, R"(["%2019"])", "[1546300800]");
+  AssertParse("at %d.%m.%Y", TimeUnit::SECOND, R"(["at 30.08.2019"])", "[1567123200]");
+  // Too wide for the word-wise path
+  AssertParse("%Y-%m-%d %H:%M:%S, and that is all", TimeUnit::SECOND,
+              R"(["2019-08-30 12:34:56, and that is all"])", "[1567168496]");
+}
+
+TEST_F(TestStrptime, Fraction) {
+  AssertParse("%Y-%m-%dT%H:%M:%S.%f", TimeUnit::MICRO,
+              R"(["2019-08-30T12:34:56.5", "2019-08-30T12:34:56.123456789",
+                  "1969-12-31T23:59:59.000001", null])",
+              "[1567168496500000, 1567168496123456, -999999, null]");
+  AssertParse("%H:%M:%S.%fZ", TimeUnit::NANO, R"(["00:00:01.5Z"])", "[1500000000]");
+  AssertFails("%S.%f", "01.");
+  AssertFails("%S.%f", "01.1234567890");
+}
+
+TEST_F(TestStrptime, UtcOffset) {
+  AssertParse("%Y-%m-%d %H:%M%z", TimeUnit::SECOND,
+              R"(["2019-08-30 14:34+0200", "2019-08-30 07:04-0530",
+                  "2019-08-30 12:34+0000"])",
+              "[1567168440, 1567168440, 1567168440]");
+  AssertParse("%d/%m/%y %H:%M:%S.%f %z", TimeUnit::MILLI,
+              R"(["30/08/19 14:34:56.25 +0200"])", "[1567168496250]");
+  AssertFails("%H:%M%z", "12:34 0200");
+  AssertFails("%H:%M%z", "12:34+2400");
+}
+
+TEST_F(TestStrptime, InvalidStrings) {
+  const std::string format = "%Y-%m-%d %H:%M:%S";
+  for (const std::string value :
+       {"2019-8-30 12:34:56", "2019-02-29 00:00:00", "2019-13-01 00:00:00",
+        "2019-00-01 00:00:00", "2019-08-00 00:00:00", "2019-08-30 24:00:00",
+        "2019-08-30 12:60:00", "2019-08-30 12:34:60", "2019-08-30T12:34:56",
+        "2019-08-3a 12:34:56", "2019-08-30 12:34:56 ", "", "2019-08-30 12:34:5/"}) {
+    AssertFails(format, value);
+  }
+  AssertFails("%Y-%m-%d %H:%M:%S and more", "2019-08-30 12:34:56 and mor");
+  AssertFails("%Y-%m-%d %H:%M:%S and more", "2019-08-30 12:34:56 and more!");
+
+  // Out of the range of nanosecond timestamps
+  Datum out;
+  ASSERT_RAISES(Invalid,
+                Strptime(&this->ctx_, StrptimeOptions("%Y-%m-%d", TimeUnit::NANO),
+                         ArrayFromJSON(utf8(), R"(["2262-04-12"])"), &out));
+  AssertParse("%Y-%m-%d", TimeUnit::NANO, R"(["2262-04-11"])", "[9223286400000000000]");
+}
+
+TEST_F(TestStrptime, InvalidOptions) {
+  Datum out;
+  auto values = ArrayFromJSON(utf8(), "[]");
+  for (const std::string format : {"%Y-%q", "%Y%", "%f%f", "%z%z"}) {
+    ASSERT_RAISES(Invalid, Strptime(&this->ctx_, StrptimeOptions(format), values, &out));
+  }
+  ASSERT_RAISES(Invalid, Strptime(&this->ctx_, StrptimeOptions("%Y"),
+                                  ArrayFromJSON(int32(), "[]"), &out));
+}
+
+TEST_F(TestStrptime, ChunkedArray) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["2019-08-30", null])"),
+                  ArrayFromJSON(utf8(), R"(["1970-01-02"])")});
+  Datum out;
+  ASSERT_OK(Strptime(&this->ctx_, StrptimeOptions("%Y-%m-%d", TimeUnit::MILLI), chunked,
+                     &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  auto expected = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(timestamp(TimeUnit::MILLI), "[1567123200000, null]"),
+                  ArrayFromJSON(timestamp(TimeUnit::MILLI), "[86400000]")});
+  AssertChunkedEqual(*expected, *out.chunked_array());
+}
+
+TEST_F(TestStrptime, Parallel) {
+  const int64_t length = 300000;
+  StringBuilder builder;
+  TimestampBuilder expected_builder(timestamp(TimeUnit::SECOND), default_memory_pool());
+  for (int64_t i = 0; i < length; ++i) {
+    if (i % 1000 == 7) {
+      ASSERT_OK(builder.AppendNull());
+      ASSERT_OK(expected_builder.AppendNull());
+    } else if (i % 70001 == 3) {
+      ASSERT_OK(builder.Append("1970-01-01 00:00:0?"));
+      ASSERT_OK(expected_builder.AppendNull());
+    } else {
+      const int64_t seconds = i % 60;
+      ASSERT_OK(builder.Append("1970-01-01 00:00:" + std::to_string(seconds / 10) +
+                               std::to_string(seconds % 10)));
+      ASSERT_OK(expected_builder.Append(seconds));
+    }
+  }
+  std::shared_ptr<Array> values, expected;
+  ASSERT_OK(builder.Finish(&values));
+  ASSERT_OK(expected_builder.Finish(&expected));
+
+  this->ctx_.set_use_threads(true);
+  const std::string format = "%Y-%m-%d %H:%M:%S";
+  Datum out;
+  ASSERT_OK(Strptime(&this->ctx_, StrptimeOptions(format, TimeUnit::SECOND, true),
+                     values, &out));
+  ASSERT_OK(out.make_array()->Validate());
+  AssertArraysEqual(*expected, *out.make_array());
+
+  ASSERT_RAISES(Invalid,
+                Strptime(&this->ctx_, StrptimeOptions(format), values, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
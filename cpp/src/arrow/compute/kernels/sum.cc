@@ -18,6 +18,9 @@
 #include <utility>
 
 #include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/decimal.h"
+#include "arrow/compute/kernels/run_length.h"
+#include "arrow/compute/kernels/selection_internal.h"
 #include "arrow/compute/kernels/sum_internal.h"
 
 namespace arrow {
@@ -77,6 +80,8 @@ std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type
     SUM_AGG_FN_CASE(Int64Type);
     SUM_AGG_FN_CASE(FloatType);
     SUM_AGG_FN_CASE(DoubleType);
+    case Type::DECIMAL:
+      return MakeDecimalSumAggregateFunction(type, ctx);
     default:
       return nullptr;
   }
@@ -84,6 +89,35 @@ std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type
 #undef SUM_AGG_FN_CASE
 }
 
+template <typename ArrowType>
+static Status SumSelected(const Array& array, const Array& selection, Datum* out) {
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  const auto values = array.data()->GetValues<CType>(1);
+  const bool may_have_nulls = array.null_count() != 0 || selection.null_count() != 0;
+  SumState<ArrowType> state;
+  RETURN_NOT_OK(detail::VisitSelection(
+      selection, array.length(),
+      [&](int64_t offset, const int64_t* indices, int64_t length) {
+        if (!may_have_nulls) {
+          for (int64_t i = 0; i < length; ++i) {
+            state.sum += values[indices[i]];
+          }
+          state.count += length;
+          return Status::OK();
+        }
+        for (int64_t i = 0; i < length; ++i) {
+          if (selection.IsValid(offset + i) && array.IsValid(indices[i])) {
+            state.sum += values[indices[i]];
+            state.count++;
+          }
+        }
+        return Status::OK();
+      }));
+  *out = state.Finalize();
+  return Status::OK();
+}
+
 static Status GetSumKernel(FunctionContext* ctx, const DataType& type,
                            std::shared_ptr<AggregateUnaryKernel>& kernel) {
   std::shared_ptr<AggregateFunction> aggregate = MakeSumAggregateFunction(type, ctx);
@@ -100,7 +134,10 @@ Status Sum(FunctionContext* ctx, const Datum& value, Datum* out) {
   auto data_type = value.type();
   if (data_type == nullptr)
     return Status::Invalid("Datum must be array-like");
-  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()))
+  else if (IsRunLengthEncoded(*data_type))
+    return detail::RunLengthSum(ctx, value, out);
+  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()) &&
+           data_type->id() != Type::DECIMAL)
     return Status::Invalid("Datum must contain a NumericType");
 
   RETURN_NOT_OK(GetSumKernel(ctx, *data_type, kernel));
@@ -112,5 +149,29 @@ Status Sum(FunctionContext* ctx, const Array& array, Datum* out) {
   return Sum(ctx, array.data(), out);
 }
 
+#define SUM_SELECTED_CASE(T) \
+  case T::type_id:           \
+    return SumSelected<T>(array, selection, out);
+
+Status Sum(FunctionContext* ctx, const Array& array, const Array& selection,
+           Datum* out) {
+  switch (array.type_id()) {
+    SUM_SELECTED_CASE(UInt8Type);
+    SUM_SELECTED_CASE(Int8Type);
+    SUM_SELECTED_CASE(UInt16Type);
+    SUM_SELECTED_CASE(Int16Type);
+    SUM_SELECTED_CASE(UInt32Type);
+    SUM_SELECTED_CASE(Int32Type);
+    SUM_SELECTED_CASE(UInt64Type);
+    SUM_SELECTED_CASE(Int64Type);
+    SUM_SELECTED_CASE(FloatType);
+    SUM_SELECTED_CASE(DoubleType);
+    default:
+      return Status::Invalid("Datum must contain a NumericType");
+  }
+}
+
+#undef SUM_SELECTED_CASE
+
 }  // namespace compute
 }  // namespace arrow
@@ -46,6 +46,8 @@ std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type
 
 /// \brief Sum values of a numeric array.
 ///
+/// Decimal arrays are also accepted; their sum is a decimal128(38, scale).
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value datum to sum, expecting Array or ChunkedArray
 /// \param[out] out resulting datum
@@ -66,5 +68,23 @@ Status Sum(FunctionContext* context, const Datum& value, Datum* out);
 ARROW_EXPORT
 Status Sum(FunctionContext* context, const Array& array, Datum* out);
 
+/// \brief Sum the values of a numeric array at the positions of a selection
+/// vector, without materializing the selected values.
+///
+/// The result is the same as summing Take(array, selection); null indices
+/// are skipped like null values.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array to sum
+/// \param[in] selection integer array of indices into array, e.g. the output
+///            of FilterToIndices
+/// \param[out] out resulting datum
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Sum(FunctionContext* context, const Array& array, const Array& selection,
+           Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -15,21 +15,456 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <utility>
+#include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
 namespace compute {
 
+using internal::checked_cast;
+
+// ----------------------------------------------------------------------
+// Direct gather of fixed-width values
+//
+// Primitive values of 1, 2, 4 or 8 bytes are gathered as machine words
+// straight into a preallocated output buffer instead of going through a
+// builder.  The indices are bounds-checked up front, which lets the gather
+// itself run as a tight loop, or as AVX2 / AVX-512 gathers for 32- and
+// 64-bit words with signed 32- and 64-bit indices.
+
+// The number of indices handled by each task when taking in parallel,
+// a multiple of 8 so that tasks don't share bytes of the output bitmap
+constexpr int64_t kParallelTakeTaskSize = 1 << 16;
+
+static bool CanGather(const DataType& type) {
+  if (!is_primitive(type.id()) || type.id() == Type::NA || type.id() == Type::BOOL) {
+    return false;
+  }
+  const int bit_width = checked_cast<const FixedWidthType&>(type).bit_width();
+  return bit_width == 8 || bit_width == 16 || bit_width == 32 || bit_width == 64;
+}
+
+template <typename IndexCType>
+static Status CheckIndexBounds(const IndexCType* indices, int64_t length,
+                               int64_t upper_limit) {
+  // Negative indices wrap around to large unsigned values; the loop is
+  // branch-free so that the compiler can vectorize it
+  bool out_of_bounds = false;
+  for (int64_t i = 0; i < length; ++i) {
+    out_of_bounds |=
+        static_cast<uint64_t>(indices[i]) >= static_cast<uint64_t>(upper_limit);
+  }
+  if (out_of_bounds) {
+    return Status::IndexError("take index out of bounds");
+  }
+  return Status::OK();
+}
+
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+
+// Gather whole vectors of words, returning the number of words gathered.
+// Unsupported word and index types gather nothing.
+template <typename Word, typename IndexCType>
+struct X86Gather {
+  static int64_t Avx2(const Word*, const IndexCType*, int64_t, Word*) { return 0; }
+  static int64_t Avx512(const Word*, const IndexCType*, int64_t, Word*) { return 0; }
+};
+
+template <>
+struct X86Gather<uint32_t, int32_t> {
+  ARROW_TARGET_AVX2 static int64_t Avx2(const uint32_t* values, const int32_t* indices,
+                                        int64_t length, uint32_t* out) {
+    const auto base = reinterpret_cast<const int*>(values);
+    int64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      const __m256i index =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                          _mm256_i32gather_epi32(base, index, 4));
+    }
+    return i;
+  }
+  ARROW_TARGET_AVX512 static int64_t Avx512(const uint32_t* values,
+                                            const int32_t* indices, int64_t length,
+                                            uint32_t* out) {
+    int64_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+      const __m512i index = _mm512_loadu_si512(indices + i);
+      _mm512_storeu_si512(out + i, _mm512_i32gather_epi32(index, values, 4));
+    }
+    return i;
+  }
+};
+
+template <>
+struct X86Gather<uint32_t, int64_t> {
+  ARROW_TARGET_AVX2 static int64_t Avx2(const uint32_t* values, const int64_t* indices,
+                                        int64_t length, uint32_t* out) {
+    const auto base = reinterpret_cast<const int*>(values);
+    int64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+      const __m256i index =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                       _mm256_i64gather_epi32(base, index, 4));
+    }
+    return i;
+  }
+  ARROW_TARGET_AVX512 static int64_t Avx512(const uint32_t* values,
+                                            const int64_t* indices, int64_t length,
+                                            uint32_t* out) {
+    int64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      const __m512i index = _mm512_loadu_si512(indices + i);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                          _mm512_i64gather_epi32(index, values, 4));
+    }
+    return i;
+  }
+};
+
+template <>
+struct X86Gather<uint64_t, int32_t> {
+  ARROW_TARGET_AVX2 static int64_t Avx2(const uint64_t* values, const int32_t* indices,
+                                        int64_t length, uint64_t* out) {
+    const auto base = reinterpret_cast<const long long*>(values);  // NOLINT
+    int64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+      const __m128i index =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                          _mm256_i32gather_epi64(base, index, 8));
+    }
+    return i;
+  }
+  ARROW_TARGET_AVX512 static int64_t Avx512(const uint64_t* values,
+                                            const int32_t* indices, int64_t length,
+                                            uint64_t* out) {
+    int64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      const __m256i index =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      _mm512_storeu_si512(out + i, _mm512_i32gather_epi64(index, values, 8));
+    }
+    return i;
+  }
+};
+
+template <>
+struct X86Gather<uint64_t, int64_t> {
+  ARROW_TARGET_AVX2 static int64_t Avx2(const uint64_t* values, const int64_t* indices,
+                                        int64_t length, uint64_t* out) {
+    const auto base = reinterpret_cast<const long long*>(values);  // NOLINT
+    int64_t i = 0;
+    for (; i + 4 <= length; i += 4) {
+      const __m256i index =
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i),
+                          _mm256_i64gather_epi64(base, index, 8));
+    }
+    return i;
+  }
+  ARROW_TARGET_AVX512 static int64_t Avx512(const uint64_t* values,
+                                            const int64_t* indices, int64_t length,
+                                            uint64_t* out) {
+    int64_t i = 0;
+    for (; i + 8 <= length; i += 8) {
+      const __m512i index = _mm512_loadu_si512(indices + i);
+      _mm512_storeu_si512(out + i, _mm512_i64gather_epi64(index, values, 8));
+    }
+    return i;
+  }
+};
+
+#endif  // ARROW_HAVE_RUNTIME_X86_SIMD
+
+// Gather values at in-bounds indices, using the widest instruction set
+// supported by the CPU, then finishing with the portable loop
+template <typename Word, typename IndexCType>
+static void GatherWords(const Word* values, const IndexCType* indices, int64_t length,
+                        Word* out) {
+  int64_t i = 0;
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+  auto cpu_info = internal::CpuInfo::GetInstance();
+  if (cpu_info->IsSupported(internal::CpuInfo::AVX512F) &&
+      cpu_info->IsSupported(internal::CpuInfo::AVX512BW)) {
+    i = X86Gather<Word, IndexCType>::Avx512(values, indices, length, out);
+  } else if (cpu_info->IsSupported(internal::CpuInfo::AVX2)) {
+    i = X86Gather<Word, IndexCType>::Avx2(values, indices, length, out);
+  }
+#endif
+  for (; i < length; ++i) {
+    out[i] = values[indices[i]];
+  }
+}
+
+// Take indices [offset, offset + length) of an array of values into the same
+// range of the output
+template <typename IndexCType>
+struct ArrayGatherer {
+  template <typename Word>
+  Status Gather(int64_t offset, int64_t length, Word* out, uint8_t* out_bitmap) const {
+    const Word* value_data = values.GetValues<Word>(1);
+    const IndexCType* index_data = indices.GetValues<IndexCType>(1) + offset;
+    const uint8_t* index_bitmap =
+        indices.MayHaveNulls() ? indices.buffers[0]->data() : nullptr;
+    out += offset;
+
+    if (index_bitmap == nullptr) {
+      RETURN_NOT_OK(CheckIndexBounds(index_data, length, values.length));
+      GatherWords(value_data, index_data, length, out);
+    } else {
+      const int64_t index_offset = indices.offset + offset;
+      for (int64_t i = 0; i < length; ++i) {
+        if (!BitUtil::GetBit(index_bitmap, index_offset + i)) {
+          out[i] = 0;
+          continue;
+        }
+        if (static_cast<uint64_t>(index_data[i]) >=
+            static_cast<uint64_t>(values.length)) {
+          return Status::IndexError("take index out of bounds");
+        }
+        out[i] = value_data[index_data[i]];
+      }
+    }
+
+    if (out_bitmap != nullptr) {
+      const uint8_t* value_bitmap =
+          values.MayHaveNulls() ? values.buffers[0]->data() : nullptr;
+      for (int64_t i = 0; i < length; ++i) {
+        const bool valid =
+            (index_bitmap == nullptr ||
+             BitUtil::GetBit(index_bitmap, indices.offset + offset + i)) &&
+            (value_bitmap == nullptr ||
+             BitUtil::GetBit(value_bitmap, values.offset + index_data[i]));
+        BitUtil::SetBitTo(out_bitmap, offset + i, valid);
+      }
+    }
+    return Status::OK();
+  }
+
+  const ArrayData& values;
+  const ArrayData& indices;
+};
+
+// Take indices [offset, offset + length) of a chunked array of values into the
+// same range of the output, locating the chunk of each index by binary search
+// over the chunk offsets unless it falls in the same chunk as the previous one
+template <typename IndexCType>
+struct ChunkedGatherer {
+  template <typename Word>
+  Status Gather(int64_t offset, int64_t length, Word* out, uint8_t* out_bitmap) const {
+    const std::vector<int64_t>& chunk_offsets = values.chunk_offsets();
+    const int num_chunks = values.num_chunks();
+    std::vector<const Word*> chunk_data(num_chunks);
+    std::vector<const uint8_t*> chunk_bitmaps(num_chunks);
+    std::vector<int64_t> chunk_bitmap_offsets(num_chunks);
+    for (int c = 0; c < num_chunks; ++c) {
+      const ArrayData& chunk = *values.chunk(c)->data();
+      chunk_data[c] = chunk.GetValues<Word>(1);
+      chunk_bitmaps[c] = chunk.MayHaveNulls() ? chunk.buffers[0]->data() : nullptr;
+      chunk_bitmap_offsets[c] = chunk.offset;
+    }
+
+    const IndexCType* index_data = indices.GetValues<IndexCType>(1) + offset;
+    const uint8_t* index_bitmap =
+        indices.MayHaveNulls() ? indices.buffers[0]->data() : nullptr;
+    const int64_t index_offset = indices.offset + offset;
+    out += offset;
+
+    int c = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      if (index_bitmap != nullptr && !BitUtil::GetBit(index_bitmap, index_offset + i)) {
+        out[i] = 0;
+        if (out_bitmap != nullptr) {
+          BitUtil::ClearBit(out_bitmap, offset + i);
+        }
+        continue;
+      }
+      const auto index = static_cast<int64_t>(index_data[i]);
+      if (index < 0 || index >= values.length()) {
+        return Status::IndexError("take index out of bounds");
+      }
+      if (index < chunk_offsets[c] || index >= chunk_offsets[c + 1]) {
+        c = static_cast<int>(std::upper_bound(chunk_offsets.begin(), chunk_offsets.end(),
+                                              index) -
+                             chunk_offsets.begin()) -
+            1;
+      }
+      const int64_t index_in_chunk = index - chunk_offsets[c];
+      out[i] = chunk_data[c][index_in_chunk];
+      if (out_bitmap != nullptr) {
+        const bool valid =
+            chunk_bitmaps[c] == nullptr ||
+            BitUtil::GetBit(chunk_bitmaps[c], chunk_bitmap_offsets[c] + index_in_chunk);
+        BitUtil::SetBitTo(out_bitmap, offset + i, valid);
+      }
+    }
+    return Status::OK();
+  }
+
+  const ChunkedArray& values;
+  const ArrayData& indices;
+};
+
+// Allocate the output and fill it with the gatherer, over several tasks if the
+// context allows it
+template <typename Gatherer>
+static Status GatherFixedWidth(FunctionContext* ctx,
+                               const std::shared_ptr<DataType>& type,
+                               const ArrayData& indices, bool values_have_nulls,
+                               const Gatherer& gatherer, std::shared_ptr<Array>* out) {
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t length = indices.length;
+  MemoryPool* pool = ctx->memory_pool();
+
+  std::shared_ptr<Buffer> data, bitmap;
+  RETURN_NOT_OK(AllocateBuffer(pool, length * byte_width, &data));
+  if (indices.MayHaveNulls() || values_have_nulls) {
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool, length, &bitmap));
+  }
+  uint8_t* out_data = data->mutable_data();
+  uint8_t* out_bitmap = bitmap ? bitmap->mutable_data() : nullptr;
+
+  auto gather_range = [&](int64_t offset, int64_t range_length) -> Status {
+    switch (byte_width) {
+      case 1:
+        return gatherer.Gather(offset, range_length, out_data, out_bitmap);
+      case 2:
+        return gatherer.Gather(offset, range_length,
+                               reinterpret_cast<uint16_t*>(out_data), out_bitmap);
+      case 4:
+        return gatherer.Gather(offset, range_length,
+                               reinterpret_cast<uint32_t*>(out_data), out_bitmap);
+      default:
+        return gatherer.Gather(offset, range_length,
+                               reinterpret_cast<uint64_t*>(out_data), out_bitmap);
+    }
+  };
+
+  if (ctx->use_threads() && length >= 2 * kParallelTakeTaskSize) {
+    const int num_tasks =
+        static_cast<int>(BitUtil::CeilDiv(length, kParallelTakeTaskSize));
+    RETURN_NOT_OK(internal::ParallelFor(num_tasks, [&](int task) {
+      const int64_t offset = task * kParallelTakeTaskSize;
+      return gather_range(offset, std::min(kParallelTakeTaskSize, length - offset));
+    }));
+  } else {
+    RETURN_NOT_OK(gather_range(0, length));
+  }
+
+  const int64_t null_count =
+      bitmap ? length - internal::CountSetBits(out_bitmap, 0, length) : 0;
+  if (null_count == 0) {
+    // Don't carry an all-valid bitmap
+    bitmap = nullptr;
+  }
+  *out = MakeArray(ArrayData::Make(type, length, {bitmap, data}, null_count));
+  return Status::OK();
+}
+
+// Take from a chunked array of values of any type: the indices are split by
+// chunk, each chunk is taken from on its own, and the results, which are
+// grouped by chunk, are put back in the order of the indices with a last
+// take.  Only output-sized data is copied, never the values as a whole.
+template <typename IndexCType>
+static Status TakeFromChunks(FunctionContext* ctx, const ChunkedArray& values,
+                             const ArrayData& indices, std::shared_ptr<Array>* out) {
+  const std::vector<int64_t>& chunk_offsets = values.chunk_offsets();
+  const int num_chunks = values.num_chunks();
+  const IndexCType* index_data = indices.GetValues<IndexCType>(1);
+  const uint8_t* index_bitmap =
+      indices.MayHaveNulls() ? indices.buffers[0]->data() : nullptr;
+  auto is_valid = [&](int64_t i) {
+    return index_bitmap == nullptr || BitUtil::GetBit(index_bitmap, indices.offset + i);
+  };
+
+  // Locate the chunk of each index
+  std::vector<int> index_chunks(indices.length);
+  std::vector<int64_t> chunk_lengths(num_chunks, 0);
+  int c = 0;
+  for (int64_t i = 0; i < indices.length; ++i) {
+    if (!is_valid(i)) {
+      continue;
+    }
+    const auto index = static_cast<int64_t>(index_data[i]);
+    if (index < 0 || index >= values.length()) {
+      return Status::IndexError("take index out of bounds");
+    }
+    if (index < chunk_offsets[c] || index >= chunk_offsets[c + 1]) {
+      c = static_cast<int>(std::upper_bound(chunk_offsets.begin(), chunk_offsets.end(),
+                                            index) -
+                           chunk_offsets.begin()) -
+          1;
+    }
+    index_chunks[i] = c;
+    ++chunk_lengths[c];
+  }
+
+  // Split the indices by chunk, and compute where each taken value will land
+  // among the per-chunk results
+  std::vector<std::vector<int64_t>> chunk_indices(num_chunks);
+  std::vector<int64_t> chunk_starts(num_chunks, 0);
+  for (c = 0; c < num_chunks; ++c) {
+    chunk_indices[c].reserve(chunk_lengths[c]);
+    if (c > 0) {
+      chunk_starts[c] = chunk_starts[c - 1] + chunk_lengths[c - 1];
+    }
+  }
+  Int64Builder positions(ctx->memory_pool());
+  RETURN_NOT_OK(positions.Resize(indices.length));
+  for (int64_t i = 0; i < indices.length; ++i) {
+    if (!is_valid(i)) {
+      positions.UnsafeAppendNull();
+      continue;
+    }
+    c = index_chunks[i];
+    positions.UnsafeAppend(chunk_starts[c] +
+                           static_cast<int64_t>(chunk_indices[c].size()));
+    chunk_indices[c].push_back(static_cast<int64_t>(index_data[i]) - chunk_offsets[c]);
+  }
+  std::shared_ptr<Array> positions_array;
+  RETURN_NOT_OK(positions.Finish(&positions_array));
+
+  TakeOptions options;
+  ArrayVector taken(num_chunks);
+  for (c = 0; c < num_chunks; ++c) {
+    Int64Builder builder(ctx->memory_pool());
+    RETURN_NOT_OK(builder.AppendValues(chunk_indices[c]));
+    std::shared_ptr<Array> local_indices;
+    RETURN_NOT_OK(builder.Finish(&local_indices));
+    RETURN_NOT_OK(Take(ctx, *values.chunk(c), *local_indices, options, &taken[c]));
+  }
+  std::shared_ptr<Array> grouped;
+  RETURN_NOT_OK(Concatenate(taken, ctx->memory_pool(), &grouped));
+  return Take(ctx, *grouped, *positions_array, options, out);
+}
+
 template <typename IndexType>
 class TakeKernelImpl : public TakeKernel {
  public:
+  using IndexCType = typename IndexType::c_type;
+
   explicit TakeKernelImpl(const std::shared_ptr<DataType>& value_type)
       : TakeKernel(value_type) {}
 
@@ -39,11 +474,34 @@ class TakeKernelImpl : public TakeKernel {
 
   Status Take(FunctionContext* ctx, const Array& values, const Array& indices_array,
               std::shared_ptr<Array>* out) override {
+    if (CanGather(*values.type())) {
+      ArrayGatherer<IndexCType> gatherer{*values.data(), *indices_array.data()};
+      return GatherFixedWidth(ctx, values.type(), *indices_array.data(),
+                              values.data()->MayHaveNulls(), gatherer, out);
+    }
     RETURN_NOT_OK(taker_->SetContext(ctx));
     RETURN_NOT_OK(taker_->Take(values, ArrayIndexSequence<IndexType>(indices_array)));
     return taker_->Finish(out);
   }
 
+  Status Take(FunctionContext* ctx, const ChunkedArray& values,
+              const Array& indices_array, std::shared_ptr<Array>* out) override {
+    if (values.num_chunks() == 1) {
+      return Take(ctx, *values.chunk(0), indices_array, out);
+    }
+    if (values.num_chunks() == 0) {
+      std::shared_ptr<Array> empty;
+      RETURN_NOT_OK(MakeArrayOfNull(values.type(), 0, &empty));
+      return Take(ctx, *empty, indices_array, out);
+    }
+    if (CanGather(*values.type())) {
+      ChunkedGatherer<IndexCType> gatherer{values, *indices_array.data()};
+      return GatherFixedWidth(ctx, values.type(), *indices_array.data(),
+                              values.null_count() != 0, gatherer, out);
+    }
+    return TakeFromChunks<IndexCType>(ctx, values, *indices_array.data(), out);
+  }
+
   std::unique_ptr<Taker<ArrayIndexSequence<IndexType>>> taker_;
 };
 
@@ -92,8 +550,57 @@ Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
   return Status::OK();
 }
 
+// Take from chunked values and/or with chunked indices, the index chunks
+// being taken in parallel if the context allows it
+static Status TakeChunked(FunctionContext* ctx, const Datum& values,
+                          const Datum& indices, const TakeOptions& options,
+                          Datum* out) {
+  const ArrayVector index_chunks = indices.kind() == Datum::CHUNKED_ARRAY
+                                       ? indices.chunked_array()->chunks()
+                                       : ArrayVector{indices.make_array()};
+  ArrayVector out_chunks(index_chunks.size());
+  auto take_chunk = [&](FunctionContext* chunk_ctx, int i) {
+    if (values.kind() == Datum::CHUNKED_ARRAY) {
+      return Take(chunk_ctx, *values.chunked_array(), *index_chunks[i], options,
+                  &out_chunks[i]);
+    }
+    return Take(chunk_ctx, *values.make_array(), *index_chunks[i], options,
+                &out_chunks[i]);
+  };
+  if (ctx->use_threads() && index_chunks.size() > 1) {
+    // Each chunk is taken serially, so as not to wait on the thread pool
+    // from within its own tasks
+    RETURN_NOT_OK(internal::ParallelFor(static_cast<int>(index_chunks.size()),
+                                        [&](int i) {
+                                          FunctionContext chunk_ctx(ctx->memory_pool());
+                                          return take_chunk(&chunk_ctx, i);
+                                        }));
+  } else {
+    for (int i = 0; i < static_cast<int>(index_chunks.size()); ++i) {
+      RETURN_NOT_OK(take_chunk(ctx, i));
+    }
+  }
+
+  if (indices.kind() == Datum::CHUNKED_ARRAY) {
+    *out = std::make_shared<ChunkedArray>(std::move(out_chunks), values.type());
+  } else {
+    *out = out_chunks[0];
+  }
+  return Status::OK();
+}
+
+Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
+            const TakeOptions& options, std::shared_ptr<Array>* out) {
+  std::unique_ptr<TakeKernel> kernel;
+  RETURN_NOT_OK(TakeKernel::Make(values.type(), indices.type(), &kernel));
+  return kernel->Take(ctx, values, indices, out);
+}
+
 Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
             const TakeOptions& options, Datum* out) {
+  if (values.kind() == Datum::CHUNKED_ARRAY || indices.kind() == Datum::CHUNKED_ARRAY) {
+    return TakeChunked(ctx, values, indices, options, out);
+  }
   std::unique_ptr<TakeKernel> kernel;
   RETURN_NOT_OK(TakeKernel::Make(values.type(), indices.type(), &kernel));
   return kernel->Call(ctx, values, indices, out);
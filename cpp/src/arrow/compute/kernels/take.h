@@ -26,6 +26,7 @@
 namespace arrow {
 
 class Array;
+class ChunkedArray;
 
 namespace compute {
 
@@ -53,8 +54,27 @@ ARROW_EXPORT
 Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
             const TakeOptions& options, std::shared_ptr<Array>* out);
 
+/// \brief Take from a chunked array of values at indices in an array
+///
+/// Indices are logical positions in the chunked array.  Values are taken
+/// from the chunks in place, without concatenating them first.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] values chunked array from which to take
+/// \param[in] indices which values to take
+/// \param[in] options options
+/// \param[out] out resulting array
+ARROW_EXPORT
+Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
+            const TakeOptions& options, std::shared_ptr<Array>* out);
+
 /// \brief Take from an array of values at indices in another array
 ///
+/// Values and indices may be arrays or chunked arrays.  The output is a
+/// chunked array with one chunk per index chunk if the indices are chunked,
+/// and an array otherwise.  Index chunks are taken in parallel if
+/// ctx->use_threads() is true.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values datum from which to take
 /// \param[in] indices which values to take
@@ -94,6 +114,10 @@ class ARROW_EXPORT TakeKernel : public BinaryKernel {
   virtual Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
                       std::shared_ptr<Array>* out) = 0;
 
+  /// \brief chunked-values implementation
+  virtual Status Take(FunctionContext* ctx, const ChunkedArray& values,
+                      const Array& indices, std::shared_ptr<Array>* out) = 0;
+
  protected:
   std::shared_ptr<DataType> type_;
 };
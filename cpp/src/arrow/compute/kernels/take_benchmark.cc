@@ -30,8 +30,10 @@ namespace compute {
 constexpr auto kSeed = 0x0ff1ce;
 
 static void TakeBenchmark(benchmark::State& state, const std::shared_ptr<Array>& values,
-                          const std::shared_ptr<Array>& indices) {
+                          const std::shared_ptr<Array>& indices,
+                          bool use_threads = false) {
   FunctionContext ctx;
+  ctx.set_use_threads(use_threads);
   TakeOptions options;
   for (auto _ : state) {
     Datum out;
@@ -54,6 +56,20 @@ static void TakeInt64(benchmark::State& state) {
   TakeBenchmark(state, values, indices);
 }
 
+static void TakeInt64Threaded(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+
+  auto values = rand.Int64(array_size, -100, 100, args.null_proportion);
+
+  auto indices = rand.Int32(static_cast<int32_t>(array_size), 0,
+                            static_cast<int32_t>(array_size - 1), args.null_proportion);
+
+  TakeBenchmark(state, values, indices, /*use_threads=*/true);
+}
+
 static void TakeFixedSizeList1Int64(benchmark::State& state) {
   RegressionArgs args(state);
 
@@ -125,6 +141,13 @@ BENCHMARK(TakeInt64)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(TakeInt64Threaded)
+    ->Apply(RegressionSetArgs)
+    ->Args({1 << 20, 1})
+    ->Args({1 << 23, 1})
+    ->MinTime(1.0)
+    ->Unit(benchmark::TimeUnit::kNanosecond);
+
 BENCHMARK(TakeFixedSizeList1Int64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
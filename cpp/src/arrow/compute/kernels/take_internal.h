@@ -116,6 +116,18 @@ Status VisitIndices(IndexSequence indices, const Array& values, Visitor&& vis) {
   return VisitIndices<true>(indices, values, std::forward<Visitor>(vis));
 }
 
+// Finish a validity bitmap, or output null if no value is null so that
+// all-valid results don't carry a bitmap
+static inline Status FinishNullBitmap(TypedBufferBuilder<bool>* null_bitmap_builder,
+                                      std::shared_ptr<Buffer>* out) {
+  if (null_bitmap_builder->false_count() == 0) {
+    null_bitmap_builder->Reset();
+    *out = nullptr;
+    return Status::OK();
+  }
+  return null_bitmap_builder->Finish(out);
+}
+
 // Helper class for gathering values from an array
 template <typename IndexSequence>
 class Taker {
@@ -348,7 +360,7 @@ class ListTakerImpl : public Taker<IndexSequence> {
     auto length = null_bitmap_builder_->length();
 
     std::shared_ptr<Buffer> offsets, null_bitmap;
-    RETURN_NOT_OK(null_bitmap_builder_->Finish(&null_bitmap));
+    RETURN_NOT_OK(FinishNullBitmap(null_bitmap_builder_.get(), &null_bitmap));
     RETURN_NOT_OK(offset_builder_->Finish(&offsets));
 
     std::shared_ptr<Array> taken_values;
@@ -419,7 +431,7 @@ class TakerImpl<IndexSequence, FixedSizeListType> : public Taker<IndexSequence>
     auto length = null_bitmap_builder_->length();
 
     std::shared_ptr<Buffer> null_bitmap;
-    RETURN_NOT_OK(null_bitmap_builder_->Finish(&null_bitmap));
+    RETURN_NOT_OK(FinishNullBitmap(null_bitmap_builder_.get(), &null_bitmap));
 
     std::shared_ptr<Array> taken_values;
     RETURN_NOT_OK(value_taker_->Finish(&taken_values));
@@ -479,7 +491,7 @@ class TakerImpl<IndexSequence, StructType> : public Taker<IndexSequence> {
     auto null_count = null_bitmap_builder_->false_count();
     auto length = null_bitmap_builder_->length();
     std::shared_ptr<Buffer> null_bitmap;
-    RETURN_NOT_OK(null_bitmap_builder_->Finish(&null_bitmap));
+    RETURN_NOT_OK(FinishNullBitmap(null_bitmap_builder_.get(), &null_bitmap));
 
     ArrayVector fields(this->type_->num_children());
     for (int i = 0; i < this->type_->num_children(); ++i) {
@@ -634,7 +646,7 @@ class TakerImpl<IndexSequence, UnionType> : public Taker<IndexSequence> {
     auto null_count = null_bitmap_builder_->false_count();
     auto length = null_bitmap_builder_->length();
     std::shared_ptr<Buffer> null_bitmap, type_ids;
-    RETURN_NOT_OK(null_bitmap_builder_->Finish(&null_bitmap));
+    RETURN_NOT_OK(FinishNullBitmap(null_bitmap_builder_.get(), &null_bitmap));
     RETURN_NOT_OK(type_id_builder_->Finish(&type_ids));
 
     std::shared_ptr<Buffer> offsets;
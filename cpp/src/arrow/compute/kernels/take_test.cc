@@ -21,6 +21,7 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/test_util.h"
@@ -182,6 +183,25 @@ TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestTakeKernelWithNumeric, TakeRandomNumericThreaded) {
+  // Large enough to be split into several tasks
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t indices_length = 1 << 18;
+  for (auto null_probability : {0.0, 0.1}) {
+    auto values = rand.Numeric<TypeParam>(1000, 0, 127, null_probability);
+    auto indices = rand.Int32(indices_length, 0, 999, null_probability);
+    std::shared_ptr<Array> serial, threaded;
+    TakeOptions options;
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, *values, *indices, options, &serial));
+    this->ctx_.set_use_threads(true);
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, *values, *indices, options, &threaded));
+    this->ctx_.set_use_threads(false);
+    ASSERT_OK(threaded->Validate());
+    AssertArraysEqual(*serial, *threaded);
+    this->ValidateTake(values, indices);
+  }
+}
+
 using StringTypes =
     ::testing::Types<BinaryType, StringType, LargeBinaryType, LargeStringType>;
 
@@ -411,6 +431,158 @@ TEST_F(TestTakeKernelWithUnion, TakeUnion) {
   }
 }
 
+class TestTakeKernelGather : public ComputeFixture, public TestBase {
+ protected:
+  template <typename IndexType>
+  std::shared_ptr<Array> MakeIndices(const std::vector<int64_t>& indices) {
+    using c_type = typename IndexType::c_type;
+    std::shared_ptr<Array> out;
+    ArrayFromVector<IndexType, c_type>(
+        std::vector<c_type>(indices.begin(), indices.end()), &out);
+    return out;
+  }
+};
+
+TEST_F(TestTakeKernelGather, IndexTypes) {
+  // Values of every gathered width, taken with indices of every width
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto indices = checked_pointer_cast<Int32Array>(rand.Int32(1000, 0, 99, 0.0));
+  std::vector<int64_t> raw(indices->raw_values(),
+                           indices->raw_values() + indices->length());
+  ArrayVector index_arrays = {MakeIndices<Int8Type>(raw), MakeIndices<UInt16Type>(raw),
+                              MakeIndices<UInt32Type>(raw), MakeIndices<Int64Type>(raw),
+                              MakeIndices<UInt64Type>(raw)};
+
+  TakeOptions options;
+  for (auto values : {rand.Int8(100, -100, 100, 0.1), rand.Int16(100, -100, 100, 0.1),
+                      rand.Float32(100, -1, 1, 0.1), rand.Float64(100, -1, 1, 0.1)}) {
+    std::shared_ptr<Array> expected;
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, *values, *indices, options, &expected));
+    for (int64_t i = 0; i < indices->length(); ++i) {
+      const int64_t index = indices->Value(i);
+      ASSERT_TRUE(values->RangeEquals(index, index + 1, i, expected));
+    }
+    for (const auto& index_array : index_arrays) {
+      std::shared_ptr<Array> actual;
+      ASSERT_OK(
+          arrow::compute::Take(&this->ctx_, *values, *index_array, options, &actual));
+      ASSERT_OK(actual->Validate());
+      AssertArraysEqual(*expected, *actual);
+    }
+  }
+}
+
+TEST_F(TestTakeKernelGather, OutOfBounds) {
+  std::shared_ptr<Array> values, indices, out;
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3}, &values);
+  TakeOptions options;
+  for (bool use_threads : {false, true}) {
+    this->ctx_.set_use_threads(use_threads);
+    std::vector<int64_t> raw(1 << 18, 1);
+    raw.back() = 3;
+    ASSERT_RAISES(IndexError, arrow::compute::Take(&this->ctx_, *values,
+                                                   *MakeIndices<Int32Type>(raw),
+                                                   options, &out));
+    raw.back() = -1;
+    ASSERT_RAISES(IndexError, arrow::compute::Take(&this->ctx_, *values,
+                                                   *MakeIndices<Int64Type>(raw),
+                                                   options, &out));
+    std::vector<bool> is_valid(raw.size(), true);
+    is_valid[0] = false;
+    ArrayFromVector<Int64Type, int64_t>(is_valid, raw, &indices);
+    ASSERT_RAISES(IndexError,
+                  arrow::compute::Take(&this->ctx_, *values, *indices, options, &out));
+  }
+}
+
+TEST_F(TestTakeKernelGather, Sliced) {
+  std::shared_ptr<Array> values, indices, actual, expected;
+  ArrayFromVector<Int32Type, int32_t>({true, false, true, true, true},
+                                      {10, 11, 12, 13, 14}, &values);
+  ArrayFromVector<Int64Type, int64_t>({true, true, true, false, true}, {4, 3, 0, 2, 1},
+                                      &indices);
+  ArrayFromVector<Int32Type, int32_t>({true, false, false, true}, {14, 0, 0, 12},
+                                      &expected);
+  TakeOptions options;
+  ASSERT_OK(arrow::compute::Take(&this->ctx_, *values->Slice(1), *indices->Slice(1),
+                                 options, &actual));
+  ASSERT_OK(actual->Validate());
+  AssertArraysEqual(*expected, *actual);
+}
+
+TEST_F(TestTakeKernelGather, Chunked) {
+  std::shared_ptr<ChunkedArray> values, indices, expected;
+  ChunkedArrayFromVector<Int32Type, int32_t>({{true, true}, {false, true}},
+                                             {{1, 2}, {3, 4}}, &values);
+  ChunkedArrayFromVector<Int32Type, int32_t>({{true, true}, {}, {true, true, true}},
+                                             {{3, 0}, {}, {2, 1, 3}}, &indices);
+  ChunkedArrayFromVector<Int32Type, int32_t>({{true, true}, {}, {false, true, true}},
+                                             {{4, 1}, {}, {0, 2, 4}}, &expected);
+  TakeOptions options;
+  for (bool use_threads : {false, true}) {
+    this->ctx_.set_use_threads(use_threads);
+    Datum out;
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, Datum(values), Datum(indices), options,
+                                   &out));
+    ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+    AssertChunkedEqual(*expected, *out.chunked_array());
+
+    // Chunked values with array indices
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, Datum(values), Datum(indices->chunk(2)),
+                                   options, &out));
+    ASSERT_EQ(out.kind(), Datum::ARRAY);
+    AssertArraysEqual(*expected->chunk(2), *out.make_array());
+
+    // Array values with chunked indices
+    std::shared_ptr<Array> value_array;
+    ASSERT_OK(Concatenate(values->chunks(), default_memory_pool(), &value_array));
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, Datum(value_array), Datum(indices),
+                                   options, &out));
+    AssertChunkedEqual(*expected, *out.chunked_array());
+  }
+}
+
+TEST_F(TestTakeKernelGather, ChunkedValues) {
+  // Chunks are taken from in place, including empty and sliced chunks
+  std::shared_ptr<Array> chunk, indices, expected, actual;
+  ArrayVector int_chunks;
+  ArrayFromVector<Int16Type, int16_t>({true, false, true}, {1, 2, 3}, &chunk);
+  int_chunks.push_back(chunk->Slice(1));
+  ArrayFromVector<Int16Type, int16_t>(std::vector<int16_t>{}, &chunk);
+  int_chunks.push_back(chunk);
+  ArrayFromVector<Int16Type, int16_t>({4, 5}, &chunk);
+  int_chunks.push_back(chunk);
+  ChunkedArray int_values(int_chunks);
+
+  ArrayFromVector<UInt8Type, uint8_t>({true, true, false, true, true}, {3, 1, 7, 0, 2},
+                                      &indices);
+  ArrayFromVector<Int16Type, int16_t>({true, true, false, false, true}, {5, 3, 0, 0, 4},
+                                      &expected);
+  TakeOptions options;
+  for (bool use_threads : {false, true}) {
+    this->ctx_.set_use_threads(use_threads);
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, int_values, *indices, options, &actual));
+    ASSERT_OK(actual->Validate());
+    AssertArraysEqual(*expected, *actual);
+  }
+
+  std::shared_ptr<ChunkedArray> string_values;
+  ChunkedArrayFromVector<StringType, std::string>(
+      {{true, false}, {}, {true, true}}, {{"a", ""}, {}, {"c", "dd"}}, &string_values);
+  ArrayFromVector<StringType, std::string>({true, false, false, true, true},
+                                           {"dd", "", "", "a", "c"}, &expected);
+  ASSERT_OK(
+      arrow::compute::Take(&this->ctx_, *string_values, *indices, options, &actual));
+  ASSERT_OK(actual->Validate());
+  AssertArraysEqual(*expected, *actual);
+
+  ArrayFromVector<Int32Type, int32_t>({0, 4}, &indices);
+  ASSERT_RAISES(IndexError, arrow::compute::Take(&this->ctx_, int_values, *indices,
+                                                 options, &actual));
+  ASSERT_RAISES(IndexError, arrow::compute::Take(&this->ctx_, *string_values, *indices,
+                                                 options, &actual));
+}
+
 class TestPermutationsWithTake : public ComputeFixture, public TestBase {
  protected:
   void Take(const Int16Array& values, const Int16Array& indices,
@@ -18,8 +18,12 @@
 #include "arrow/compute/kernels/util_internal.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
@@ -29,6 +33,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -74,10 +79,102 @@ Status AllocateValueBuffer(FunctionContext* ctx, const DataType& type, int64_t l
   return Status::OK();
 }
 
+using ChunkFunction = std::function<Status(FunctionContext*, int)>;
+
+// Shared between the caller of ExecuteChunks and the pool tasks it spawns,
+// which may start after all chunks are done
+struct ChunkExecutionState {
+  ChunkExecutionState(MemoryPool* pool, int num_chunks, ChunkFunction func)
+      : pool(pool),
+        num_chunks(num_chunks),
+        func(std::move(func)),
+        statuses(num_chunks),
+        next_chunk(0),
+        failed(false) {}
+
+  // Process chunks until there are none left
+  void Work() {
+    FunctionContext chunk_ctx(pool);
+    int num_done = 0;
+    int i;
+    while ((i = next_chunk.fetch_add(1)) < num_chunks) {
+      if (!failed.load()) {
+        Status st = func(&chunk_ctx, i);
+        if (st.ok() && chunk_ctx.HasError()) {
+          st = chunk_ctx.status();
+        }
+        chunk_ctx.ResetStatus();
+        if (!st.ok()) {
+          statuses[i] = std::move(st);
+          failed.store(true);
+        }
+      }
+      ++num_done;
+    }
+    if (num_done > 0) {
+      std::lock_guard<std::mutex> lock(mutex);
+      num_finished += num_done;
+      if (num_finished == num_chunks) {
+        cv.notify_one();
+      }
+    }
+  }
+
+  MemoryPool* pool;
+  const int num_chunks;
+  // Only called for claimed chunks, i.e. while the caller waits
+  ChunkFunction func;
+  std::vector<Status> statuses;
+  std::atomic<int> next_chunk;
+  std::atomic<bool> failed;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  int num_finished = 0;
+};
+
+// Call func(ctx, i) for each chunk index i, in parallel on the CPU thread
+// pool if allowed, and return the error of the first failing chunk.
+//
+// The calling thread processes chunks too and only waits for chunks, not for
+// pool tasks, so that this can't deadlock when called from a pool thread.
+Status ExecuteChunks(FunctionContext* ctx, int num_chunks, bool parallelizable,
+                     ChunkFunction func) {
+  if (!parallelizable || !ctx->use_threads() || num_chunks <= 1) {
+    for (int i = 0; i < num_chunks; i++) {
+      RETURN_NOT_OK(func(ctx, i));
+    }
+    return Status::OK();
+  }
+
+  auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+  int parallelism = ctx->max_parallelism();
+  if (parallelism <= 0) {
+    parallelism = thread_pool->GetCapacity();
+  }
+  parallelism = std::min(parallelism, num_chunks);
+
+  auto state =
+      std::make_shared<ChunkExecutionState>(ctx->memory_pool(), num_chunks, func);
+  for (int i = 1; i < parallelism; i++) {
+    RETURN_NOT_OK(thread_pool->Spawn([state]() { state->Work(); }));
+  }
+  state->Work();
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&]() { return state->num_finished == num_chunks; });
+  }
+  for (const auto& st : state->statuses) {
+    RETURN_NOT_OK(st);
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
-                              const Datum& value, std::vector<Datum>* outputs) {
+                              const Datum& value, std::vector<Datum>* outputs,
+                              bool parallelizable) {
   if (value.kind() == Datum::ARRAY) {
     Datum out;
     out.value = ArrayData::Make(kernel->out_type(), value.array()->length);
@@ -85,12 +182,15 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
     outputs->push_back(out);
   } else if (value.kind() == Datum::CHUNKED_ARRAY) {
     const ChunkedArray& array = *value.chunked_array();
-    for (int i = 0; i < array.num_chunks(); i++) {
-      Datum out;
-      out.value = ArrayData::Make(kernel->out_type(), array.chunk(i)->length());
-      RETURN_NOT_OK(kernel->Call(ctx, array.chunk(i), &out));
-      outputs->push_back(out);
-    }
+    std::vector<Datum> chunk_outputs(array.num_chunks());
+    RETURN_NOT_OK(ExecuteChunks(
+        ctx, array.num_chunks(), parallelizable,
+        [&](FunctionContext* chunk_ctx, int i) {
+          Datum& out = chunk_outputs[i];
+          out.value = ArrayData::Make(kernel->out_type(), array.chunk(i)->length());
+          return kernel->Call(chunk_ctx, array.chunk(i), &out);
+        }));
+    outputs->insert(outputs->end(), chunk_outputs.begin(), chunk_outputs.end());
   } else {
     return Status::Invalid("Input Datum was not array-like");
   }
@@ -99,7 +199,7 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
 
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
-                               std::vector<Datum>* outputs) {
+                               std::vector<Datum>* outputs, bool parallelizable) {
   int64_t left_length;
   std::vector<std::shared_ptr<Array>> left_arrays;
   if (left.kind() == Datum::ARRAY) {
@@ -133,19 +233,16 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
   int right_chunk_idx = 0;
   int64_t right_start_idx = 0;
 
+  // Slice both sides into chunks of common length
+  std::vector<std::shared_ptr<Array>> left_ops, right_ops;
   int64_t elements_compared = 0;
   do {
     const std::shared_ptr<Array> left_array = left_arrays[left_chunk_idx];
     const std::shared_ptr<Array> right_array = right_arrays[right_chunk_idx];
     int64_t common_length = std::min(left_array->length() - left_start_idx,
                                      right_array->length() - right_start_idx);
-    std::shared_ptr<Array> left_op = left_array->Slice(left_start_idx, common_length);
-    std::shared_ptr<Array> right_op = right_array->Slice(right_start_idx, common_length);
-
-    Datum output;
-    output.value = ArrayData::Make(kernel->out_type(), common_length);
-    RETURN_NOT_OK(kernel->Call(ctx, left_op, right_op, &output));
-    outputs->push_back(output);
+    left_ops.push_back(left_array->Slice(left_start_idx, common_length));
+    right_ops.push_back(right_array->Slice(right_start_idx, common_length));
 
     elements_compared += common_length;
     // If we have exhausted the current chunk, proceed to the next one individually.
@@ -163,13 +260,25 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
       right_start_idx += common_length;
     }
   } while (elements_compared < left_length);
+
+  const int num_chunks = static_cast<int>(left_ops.size());
+  std::vector<Datum> chunk_outputs(num_chunks);
+  RETURN_NOT_OK(ExecuteChunks(
+      ctx, num_chunks, parallelizable, [&](FunctionContext* chunk_ctx, int i) {
+        Datum& output = chunk_outputs[i];
+        output.value = ArrayData::Make(kernel->out_type(), left_ops[i]->length());
+        return kernel->Call(chunk_ctx, left_ops[i], right_ops[i], &output);
+      }));
+  outputs->insert(outputs->end(), chunk_outputs.begin(), chunk_outputs.end());
   return Status::OK();
 }
 
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
-                               const Datum& left, const Datum& right, Datum* output) {
+                               const Datum& left, const Datum& right, Datum* output,
+                               bool parallelizable) {
   std::vector<Datum> result;
-  RETURN_NOT_OK(InvokeBinaryArrayKernel(ctx, kernel, left, right, &result));
+  RETURN_NOT_OK(
+      InvokeBinaryArrayKernel(ctx, kernel, left, right, &result, parallelizable));
   *output = detail::WrapDatumsLike(left, result);
   return Status::OK();
 }
@@ -205,6 +314,142 @@ Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums) {
   }
 }
 
+namespace {
+
+// Lookup codes of the dictionary results
+constexpr uint8_t kLookupTrue = 1;
+constexpr uint8_t kLookupValid = 2;
+
+template <typename IndexCType>
+Status LookupIndices(const ArrayData& indices, const std::vector<uint8_t>& lookup,
+                     uint8_t null_index_code, uint8_t* values, uint8_t* validity,
+                     int64_t* null_count) {
+  const IndexCType* raw_indices = indices.GetValues<IndexCType>(1);
+  const int64_t dictionary_length = static_cast<int64_t>(lookup.size());
+  const uint8_t* indices_validity =
+      indices.GetNullCount() != 0 ? indices.buffers[0]->data() : nullptr;
+
+  internal::FirstTimeBitmapWriter values_writer(values, 0, indices.length);
+  internal::FirstTimeBitmapWriter validity_writer(validity, 0,
+                                                  validity ? indices.length : 0);
+  for (int64_t i = 0; i < indices.length; ++i) {
+    uint8_t code = null_index_code;
+    if (indices_validity == nullptr ||
+        BitUtil::GetBit(indices_validity, indices.offset + i)) {
+      const auto index = static_cast<int64_t>(raw_indices[i]);
+      if (index < 0 || index >= dictionary_length) {
+        return Status::IndexError("dictionary index ", index, " out of bounds");
+      }
+      code = lookup[index];
+    }
+    if (code & kLookupTrue) {
+      values_writer.Set();
+    }
+    values_writer.Next();
+    if (validity != nullptr) {
+      if (code & kLookupValid) {
+        validity_writer.Set();
+      } else {
+        ++*null_count;
+      }
+      validity_writer.Next();
+    }
+  }
+  values_writer.Finish();
+  validity_writer.Finish();
+  return Status::OK();
+}
+
+}  // namespace
+
+Status LookupDictionaryIndices(FunctionContext* ctx, const ArrayData& indices,
+                               const BooleanArray& dictionary_result,
+                               const BooleanScalar& null_index_result,
+                               std::shared_ptr<ArrayData>* out) {
+  std::vector<uint8_t> lookup(dictionary_result.length());
+  for (int64_t i = 0; i < dictionary_result.length(); ++i) {
+    if (dictionary_result.IsValid(i)) {
+      lookup[i] = kLookupValid | (dictionary_result.Value(i) ? kLookupTrue : 0);
+    }
+  }
+  const uint8_t null_index_code =
+      null_index_result.is_valid
+          ? (kLookupValid | (null_index_result.value ? kLookupTrue : 0))
+          : 0;
+
+  const int64_t length = indices.length;
+  std::shared_ptr<Buffer> values, validity;
+  RETURN_NOT_OK(AllocateBitmap(ctx->memory_pool(), length, &values));
+  if (dictionary_result.null_count() != 0 ||
+      (indices.GetNullCount() != 0 && !null_index_result.is_valid)) {
+    RETURN_NOT_OK(AllocateBitmap(ctx->memory_pool(), length, &validity));
+  }
+  uint8_t* validity_data = validity ? validity->mutable_data() : nullptr;
+
+  int64_t null_count = 0;
+  Status status;
+  switch (indices.type->id()) {
+    case Type::INT8:
+      status = LookupIndices<int8_t>(indices, lookup, null_index_code,
+                                     values->mutable_data(), validity_data, &null_count);
+      break;
+    case Type::INT16:
+      status = LookupIndices<int16_t>(indices, lookup, null_index_code,
+                                      values->mutable_data(), validity_data, &null_count);
+      break;
+    case Type::INT32:
+      status = LookupIndices<int32_t>(indices, lookup, null_index_code,
+                                      values->mutable_data(), validity_data, &null_count);
+      break;
+    case Type::INT64:
+      status = LookupIndices<int64_t>(indices, lookup, null_index_code,
+                                      values->mutable_data(), validity_data, &null_count);
+      break;
+    default:
+      return Status::TypeError("dictionary indices must be signed integers, got ",
+                               *indices.type);
+  }
+  RETURN_NOT_OK(status);
+
+  *out = ArrayData::Make(boolean(), length, {null_count ? validity : nullptr, values},
+                         null_count);
+  return Status::OK();
+}
+
+Status EvaluateOnDictionary(FunctionContext* ctx, const Datum& value,
+                            const DictionaryFunction& func,
+                            const BooleanScalar& null_index_result, Datum* out) {
+  std::vector<std::shared_ptr<Array>> chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.make_array());
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = value.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("Expected array-like input");
+  }
+
+  std::shared_ptr<Array> dictionary, dictionary_result;
+  std::vector<std::shared_ptr<Array>> results;
+  for (const auto& chunk : chunks) {
+    const auto& dict_array = checked_cast<const DictionaryArray&>(*chunk);
+    // Chunks usually share their dictionary
+    if (dictionary == nullptr || (dict_array.dictionary() != dictionary &&
+                                  !dict_array.dictionary()->Equals(*dictionary))) {
+      dictionary = dict_array.dictionary();
+      RETURN_NOT_OK(func(*dictionary, &dictionary_result));
+      DCHECK_EQ(dictionary_result->length(), dictionary->length());
+    }
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(LookupDictionaryIndices(
+        ctx, *dict_array.indices()->data(),
+        checked_cast<const BooleanArray&>(*dictionary_result), null_index_result,
+        &result));
+    results.push_back(MakeArray(result));
+  }
+  *out = WrapArraysLike(value, results);
+  return Status::OK();
+}
+
 PrimitiveAllocatingUnaryKernel::PrimitiveAllocatingUnaryKernel(UnaryKernel* delegate)
     : delegate_(delegate) {}
 
@@ -268,7 +513,15 @@ Status AssignNullIntersection(FunctionContext* ctx, const ArrayData& left,
     output->buffers.resize(1);
   }
 
-  if (left.GetNullCount() > 0 && right.GetNullCount() > 0) {
+  // An all-null side decides the result: don't intersect nor recount
+  if (left.GetNullCount() == left.length && left.length > 0) {
+    return PropagateNulls(ctx, left, output);
+  }
+  if (right.GetNullCount() == right.length && right.length > 0) {
+    return PropagateNulls(ctx, right, output);
+  }
+
+  if (left.null_count > 0 && right.null_count > 0) {
     RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left.buffers[0]->data(), left.offset,
                             right.buffers[0]->data(), right.offset, right.length, 0,
                             &(output->buffers[0])));
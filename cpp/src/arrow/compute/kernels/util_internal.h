@@ -18,12 +18,14 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -50,17 +52,27 @@ namespace detail {
 /// \param[in,out] kernel The kernel to execute.
 /// \param[in] value The input value to execute the kernel with.
 /// \param[out] outputs One ArrayData datum for each ArrayData available in value.
+/// \param[in] parallelizable Whether kernel->Call() may be invoked from several
+/// threads at once.  If so and ctx->use_threads() is true, the chunks of a
+/// ChunkedArray value are processed on the CPU thread pool, each with its own
+/// FunctionContext.  Outputs keep the chunk order.
 ARROW_EXPORT
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
-                              const Datum& value, std::vector<Datum>* outputs);
+                              const Datum& value, std::vector<Datum>* outputs,
+                              bool parallelizable = false);
 
+/// \brief Invoke the kernel on the aligned chunks of left and right.
+///
+/// See InvokeUnaryArrayKernel for `parallelizable`.
 ARROW_EXPORT
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
-                               std::vector<Datum>* outputs);
+                               std::vector<Datum>* outputs,
+                               bool parallelizable = false);
 ARROW_EXPORT
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
-                               const Datum& left, const Datum& right, Datum* output);
+                               const Datum& left, const Datum& right, Datum* output,
+                               bool parallelizable = false);
 
 /// \brief Assign validity bitmap to output, copying bitmap if necessary, but
 /// zero-copy otherwise, so that the same value slots are valid/not-null in the
@@ -110,6 +122,40 @@ Datum WrapArraysLike(const Datum& value,
 ARROW_EXPORT
 Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums);
 
+/// \brief Look up the boolean result of each index of a DictionaryArray.
+///
+/// \param[in] ctx the kernel FunctionContext
+/// \param[in] indices the dictionary indices, of a signed integer type
+/// \param[in] dictionary_result a BooleanArray with one slot per dictionary value,
+/// e.g. a predicate evaluated on each value of the dictionary
+/// \param[in] null_index_result the result for null indices
+/// \param[out] out the resulting BooleanArray, as long as indices
+ARROW_EXPORT
+Status LookupDictionaryIndices(FunctionContext* ctx, const ArrayData& indices,
+                               const BooleanArray& dictionary_result,
+                               const BooleanScalar& null_index_result,
+                               std::shared_ptr<ArrayData>* out);
+
+using DictionaryFunction =
+    std::function<Status(const Array& dictionary, std::shared_ptr<Array>* out)>;
+
+/// \brief Evaluate a boolean function of the values of a dictionary-encoded
+/// Array or ChunkedArray without decoding it.
+///
+/// `func` computes a BooleanArray with one slot per dictionary value.  It is
+/// called once per distinct dictionary rather than once per chunk, then its
+/// results are looked up by index with LookupDictionaryIndices.
+///
+/// \param[in] ctx the kernel FunctionContext
+/// \param[in] value the dictionary-encoded input
+/// \param[in] func the function evaluated on dictionaries
+/// \param[in] null_index_result the result for null indices
+/// \param[out] out the resulting Array or ChunkedArray, like value
+ARROW_EXPORT
+Status EvaluateOnDictionary(FunctionContext* ctx, const Datum& value,
+                            const DictionaryFunction& func,
+                            const BooleanScalar& null_index_result, Datum* out);
+
 /// \brief Kernel used to preallocate outputs for primitive types. This
 /// does not include allocations for the validity bitmap (PropagateNulls
 /// should be used for that).
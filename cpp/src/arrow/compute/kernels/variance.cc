@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/compute/kernels/variance.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+struct VarianceState {
+  // Merge the moments of another set of values (Chan et al.)
+  void MergeFrom(const VarianceState& other) {
+    if (other.count == 0) {
+      return;
+    }
+    if (this->count == 0) {
+      *this = other;
+      return;
+    }
+    const double count = static_cast<double>(this->count + other.count);
+    const double delta = other.mean - this->mean;
+    this->mean += delta * static_cast<double>(other.count) / count;
+    this->m2 += other.m2 + delta * delta * static_cast<double>(this->count) *
+                               static_cast<double>(other.count) / count;
+    this->count += other.count;
+  }
+
+  int64_t count = 0;
+  double mean = 0;
+  // The sum of the squared deviations from the mean
+  double m2 = 0;
+};
+
+template <typename ArrowType>
+class VarianceAggregateFunction final
+    : public AggregateFunctionStaticState<VarianceState> {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  // The number of values of a block, small enough for a block to stay in the
+  // L1 cache between its two passes
+  static constexpr int64_t kBlockSize = 2048;
+
+ public:
+  VarianceAggregateFunction(const VarianceOptions& options, bool standard_deviation)
+      : options_(options), standard_deviation_(standard_deviation) {}
+
+  Status Consume(const Array& input, VarianceState* state) const override {
+    const auto& array = checked_cast<const ArrayType&>(input);
+
+    *state = VarianceState();
+    const int64_t length = array.length();
+    const int64_t null_count = array.null_count();
+    if (null_count == length) {
+      return Status::OK();
+    }
+    const CType* values = array.raw_values();
+    for (int64_t start = 0; start < length; start += kBlockSize) {
+      const int64_t block_length = std::min(kBlockSize, length - start);
+      state->MergeFrom(null_count == 0
+                           ? ConsumeDense(values + start, block_length)
+                           : ConsumeSparse(values + start, array.null_bitmap_data(),
+                                           array.offset() + start, block_length));
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const VarianceState& src, VarianceState* dst) const override {
+    dst->MergeFrom(src);
+    return Status::OK();
+  }
+
+  Status Finalize(const VarianceState& src, Datum* output) const override {
+    const bool is_valid = src.count > options_.ddof;
+    double result = 0;
+    if (is_valid) {
+      result = src.m2 / static_cast<double>(src.count - options_.ddof);
+      if (standard_deviation_) {
+        result = std::sqrt(result);
+      }
+    }
+    *output = Datum(std::make_shared<DoubleScalar>(result, is_valid));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  static VarianceState ConsumeDense(const CType* values, int64_t length) {
+    VarianceState block;
+    double sum = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      sum += static_cast<double>(values[i]);
+    }
+    block.count = length;
+    block.mean = sum / static_cast<double>(length);
+    for (int64_t i = 0; i < length; ++i) {
+      const double deviation = static_cast<double>(values[i]) - block.mean;
+      block.m2 += deviation * deviation;
+    }
+    return block;
+  }
+
+  // Null values are masked rather than branched over, as in the sum kernel
+  static VarianceState ConsumeSparse(const CType* values, const uint8_t* bitmap,
+                                     int64_t bitmap_offset, int64_t length) {
+    VarianceState block;
+    block.count = internal::CountSetBits(bitmap, bitmap_offset, length);
+    if (block.count == 0) {
+      return block;
+    }
+    double sum = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      const bool valid = BitUtil::GetBit(bitmap, bitmap_offset + i);
+      sum += valid ? static_cast<double>(values[i]) : 0.0;
+    }
+    block.mean = sum / static_cast<double>(block.count);
+    for (int64_t i = 0; i < length; ++i) {
+      const bool valid = BitUtil::GetBit(bitmap, bitmap_offset + i);
+      const double deviation = static_cast<double>(values[i]) - block.mean;
+      block.m2 += valid ? deviation * deviation : 0.0;
+    }
+    return block;
+  }
+
+  VarianceOptions options_;
+  bool standard_deviation_;
+};
+
+#define VARIANCE_AGG_FN_CASE(T)                         \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<VarianceAggregateFunction<T>>(options, standard_deviation));
+
+std::shared_ptr<AggregateFunction> MakeVarianceAggregateFunction(
+    const DataType& type, const VarianceOptions& options, bool standard_deviation,
+    FunctionContext* ctx) {
+  switch (type.id()) {
+    VARIANCE_AGG_FN_CASE(UInt8Type);
+    VARIANCE_AGG_FN_CASE(Int8Type);
+    VARIANCE_AGG_FN_CASE(UInt16Type);
+    VARIANCE_AGG_FN_CASE(Int16Type);
+    VARIANCE_AGG_FN_CASE(UInt32Type);
+    VARIANCE_AGG_FN_CASE(Int32Type);
+    VARIANCE_AGG_FN_CASE(UInt64Type);
+    VARIANCE_AGG_FN_CASE(Int64Type);
+    VARIANCE_AGG_FN_CASE(FloatType);
+    VARIANCE_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef VARIANCE_AGG_FN_CASE
+}
+
+static Status VarianceCommon(FunctionContext* ctx, const VarianceOptions& options,
+                             bool standard_deviation, const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  if (options.ddof < 0) {
+    return Status::Invalid("Variance ddof must not be negative, got ", options.ddof);
+  }
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeVarianceAggregateFunction(*data_type, options, standard_deviation, ctx);
+  if (!aggregate) {
+    return Status::Invalid("No variance for type ", *data_type);
+  }
+  AggregateUnaryKernel kernel(aggregate);
+  return kernel.Call(ctx, value, out);
+}
+
+Status Variance(FunctionContext* ctx, const VarianceOptions& options, const Datum& value,
+                Datum* out) {
+  return VarianceCommon(ctx, options, false, value, out);
+}
+
+Status StandardDeviation(FunctionContext* ctx, const VarianceOptions& options,
+                         const Datum& value, Datum* out) {
+  return VarianceCommon(ctx, options, true, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
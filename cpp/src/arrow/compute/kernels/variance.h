@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \brief Options for the Variance and StandardDeviation kernels
+struct ARROW_EXPORT VarianceOptions {
+  explicit VarianceOptions(int ddof = 0) : ddof(ddof) {}
+
+  /// The delta degrees of freedom: the divisor of the sum of squared
+  /// deviations is N - ddof, N being the number of non-null values.  0 gives
+  /// the population variance and 1 the sample variance.
+  int ddof;
+};
+
+/// \brief Return a Variance aggregate function for a numeric type, or null
+///
+/// \param[in] type required to specialize the kernel
+/// \param[in] options the delta degrees of freedom
+/// \param[in] standard_deviation finalize into the square root of the variance
+/// \param[in] context the FunctionContext
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeVarianceAggregateFunction(
+    const DataType& type, const VarianceOptions& options, bool standard_deviation,
+    FunctionContext* context);
+
+/// \brief Compute the variance of a numeric array
+///
+/// The values are consumed in blocks, each of which has its mean and sum of
+/// squared deviations computed in two vectorizable passes.  The blocks, and
+/// the slices consumed in parallel if the context uses threads, are then
+/// merged pairwise (Chan et al.), which keeps the result accurate for values
+/// with a large mean.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the delta degrees of freedom
+/// \param[in] value datum to compute the variance, expecting Array or
+/// ChunkedArray
+/// \param[out] out datum of the variance as a DoubleScalar, null if there are
+/// no more than ddof non-null values
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Variance(FunctionContext* context, const VarianceOptions& options,
+                const Datum& value, Datum* out);
+
+/// \brief Compute the standard deviation of a numeric array
+///
+/// \param[in] context the FunctionContext
+/// \param[in] options the delta degrees of freedom
+/// \param[in] value datum to compute the standard deviation, expecting Array
+/// or ChunkedArray
+/// \param[out] out datum of the standard deviation as a DoubleScalar, null if
+/// there are no more than ddof non-null values
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StandardDeviation(FunctionContext* context, const VarianceOptions& options,
+                         const Datum& value, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,599 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/window.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+using ArrayDataVector = std::vector<std::shared_ptr<ArrayData>>;
+
+// Integer arithmetic wraps around, without the undefined behaviour of signed
+// overflow
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type WrappingAdd(T a, T b) {
+  return static_cast<T>(static_cast<uint64_t>(a) + static_cast<uint64_t>(b));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type WrappingSubtract(T a,
+                                                                               T b) {
+  return static_cast<T>(static_cast<uint64_t>(a) - static_cast<uint64_t>(b));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value, T>::type WrappingMultiply(T a,
+                                                                               T b) {
+  return static_cast<T>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b));
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type WrappingAdd(T a,
+                                                                                T b) {
+  return a + b;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type WrappingSubtract(
+    T a, T b) {
+  return a - b;
+}
+
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, T>::type WrappingMultiply(
+    T a, T b) {
+  return a * b;
+}
+
+template <typename T>
+bool IsNaN(T value) {
+  return std::is_floating_point<T>::value && value != value;
+}
+
+// NaN for floating-point types, zero otherwise
+template <typename T>
+T NaN() {
+  return std::numeric_limits<T>::quiet_NaN();
+}
+
+// The cumulative operators: Identity() is the aggregate of no values and
+// Call() folds a value into an aggregate.  The floating-point identity of MIN
+// and MAX is NaN, which any value replaces, and the comparisons are false for
+// NaN values, which are therefore ignored.
+template <typename T>
+struct CumulativeSum {
+  static T Identity() { return 0; }
+  static T Call(T acc, T value) { return WrappingAdd(acc, value); }
+};
+
+template <typename T>
+struct CumulativeProduct {
+  static T Identity() { return 1; }
+  static T Call(T acc, T value) { return WrappingMultiply(acc, value); }
+};
+
+template <typename T>
+struct CumulativeMin {
+  static T Identity() {
+    return std::is_floating_point<T>::value ? NaN<T>() : std::numeric_limits<T>::max();
+  }
+  static T Call(T acc, T value) { return value < acc || IsNaN(acc) ? value : acc; }
+};
+
+template <typename T>
+struct CumulativeMax {
+  static T Identity() {
+    return std::is_floating_point<T>::value ? NaN<T>() : std::numeric_limits<T>::lowest();
+  }
+  static T Call(T acc, T value) { return value > acc || IsNaN(acc) ? value : acc; }
+};
+
+// Allocate an output of the given type, with the validity bitmap of input
+Status MakeOutput(FunctionContext* ctx, const ArrayData& input,
+                  const std::shared_ptr<DataType>& type, int64_t value_size,
+                  std::shared_ptr<ArrayData>* out) {
+  auto output = ArrayData::Make(type, input.length);
+  RETURN_NOT_OK(detail::PropagateNulls(ctx, input, output.get()));
+  output->buffers.resize(2);
+  RETURN_NOT_OK(ctx->Allocate(input.length * value_size, &output->buffers[1]));
+  *out = std::move(output);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Cumulative
+
+// Scan a chunk into out, returning the aggregate of all its values.  Null
+// slots of out hold the aggregate of the values preceding them.
+template <typename T, typename Op>
+T ScanChunk(const ArrayData& input, T* out) {
+  const T* values = input.GetValues<T>(1);
+  T acc = Op::Identity();
+  if (input.GetNullCount() == 0) {
+    for (int64_t i = 0; i < input.length; ++i) {
+      acc = Op::Call(acc, values[i]);
+      out[i] = acc;
+    }
+    return acc;
+  }
+  ::arrow::internal::BitmapReader valid(input.buffers[0]->data(), input.offset,
+                                        input.length);
+  for (int64_t i = 0; i < input.length; ++i) {
+    // Select rather than branch, nulls are the identity
+    const T value = valid.IsSet() ? values[i] : Op::Identity();
+    acc = Op::Call(acc, value);
+    out[i] = acc;
+    valid.Next();
+  }
+  return acc;
+}
+
+template <typename T, typename Op>
+Status CumulativeChunks(FunctionContext* ctx, const ArrayDataVector& chunks,
+                        ArrayDataVector* out) {
+  const int num_chunks = static_cast<int>(chunks.size());
+  out->resize(num_chunks);
+  std::vector<T> aggregates(num_chunks);
+
+  auto scan_chunk = [&](int i) -> Status {
+    RETURN_NOT_OK(MakeOutput(ctx, *chunks[i], chunks[i]->type, sizeof(T), &(*out)[i]));
+    aggregates[i] = ScanChunk<T, Op>(*chunks[i], (*out)[i]->GetMutableValues<T>(1));
+    return Status::OK();
+  };
+  // The aggregate of all the chunks preceding each chunk
+  std::vector<T> carries(num_chunks, Op::Identity());
+  auto fix_up_chunk = [&](int i) -> Status {
+    const T carry = carries[i];
+    T* values = (*out)[i]->GetMutableValues<T>(1);
+    for (int64_t j = 0; j < (*out)[i]->length; ++j) {
+      values[j] = Op::Call(carry, values[j]);
+    }
+    return Status::OK();
+  };
+
+  if (ctx->use_threads() && num_chunks > 1) {
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(num_chunks, scan_chunk));
+    for (int i = 1; i < num_chunks; ++i) {
+      carries[i] = Op::Call(carries[i - 1], aggregates[i - 1]);
+    }
+    // The first chunk has nothing to fix up
+    return ::arrow::internal::ParallelFor(num_chunks - 1, [&](int i) {
+      return fix_up_chunk(i + 1);
+    });
+  }
+  // Serially, the carry is the initial aggregate of each chunk
+  for (int i = 0; i < num_chunks; ++i) {
+    RETURN_NOT_OK(scan_chunk(i));
+    if (i > 0) {
+      carries[i] = Op::Call(carries[i - 1], aggregates[i - 1]);
+      RETURN_NOT_OK(fix_up_chunk(i));
+    }
+  }
+  return Status::OK();
+}
+
+template <typename T>
+Status CumulativeTyped(FunctionContext* ctx, const ArrayDataVector& chunks,
+                       const CumulativeOptions& options, ArrayDataVector* out) {
+  switch (options.op) {
+    case CumulativeOptions::SUM:
+      return CumulativeChunks<T, CumulativeSum<T>>(ctx, chunks, out);
+    case CumulativeOptions::PRODUCT:
+      return CumulativeChunks<T, CumulativeProduct<T>>(ctx, chunks, out);
+    case CumulativeOptions::MIN:
+      return CumulativeChunks<T, CumulativeMin<T>>(ctx, chunks, out);
+    case CumulativeOptions::MAX:
+      return CumulativeChunks<T, CumulativeMax<T>>(ctx, chunks, out);
+  }
+  return Status::Invalid("Unknown cumulative operator");
+}
+
+// ----------------------------------------------------------------------
+// Rolling
+
+// Iterate over the values of consecutive chunks, from a global position
+template <typename T>
+class ValueCursor {
+ public:
+  ValueCursor(const ArrayDataVector& chunks, int64_t position) : chunks_(chunks) {
+    while (chunk_ < chunks_.size() && position >= chunks_[chunk_]->length) {
+      position -= chunks_[chunk_]->length;
+      ++chunk_;
+    }
+    index_ = position;
+    LoadChunk();
+  }
+
+  bool valid() const {
+    return bitmap_ == NULLPTR || BitUtil::GetBit(bitmap_, offset_ + index_);
+  }
+
+  T value() const { return values_[index_]; }
+
+  void Next() {
+    if (++index_ == length_) {
+      ++chunk_;
+      index_ = 0;
+      LoadChunk();
+    }
+  }
+
+ private:
+  void LoadChunk() {
+    // Skip empty chunks
+    while (chunk_ < chunks_.size() && chunks_[chunk_]->length == 0) {
+      ++chunk_;
+    }
+    if (chunk_ >= chunks_.size()) {
+      return;
+    }
+    const ArrayData& data = *chunks_[chunk_];
+    values_ = data.GetValues<T>(1);
+    bitmap_ = data.GetNullCount() > 0 ? data.buffers[0]->data() : NULLPTR;
+    offset_ = data.offset;
+    length_ = data.length;
+  }
+
+  const ArrayDataVector& chunks_;
+  size_t chunk_ = 0;
+  int64_t index_ = 0;
+  const T* values_ = NULLPTR;
+  const uint8_t* bitmap_ = NULLPTR;
+  int64_t offset_ = 0;
+  int64_t length_ = 0;
+};
+
+// The accumulator of rolling sums: 64-bit integers or double
+template <typename T>
+using RollingSumType = typename std::conditional<
+    std::is_floating_point<T>::value, double,
+    typename std::conditional<std::is_signed<T>::value, int64_t, uint64_t>::type>::type;
+
+template <typename T>
+std::shared_ptr<DataType> RollingSumDataType() {
+  return TypeTraits<typename CTypeTraits<RollingSumType<T>>::ArrowType>::type_singleton();
+}
+
+// Compute the outputs of the global positions [start, start + length),
+// reading the window - 1 values preceding start first
+template <typename T>
+class RollingSumAggregator {
+ public:
+  using OutType = RollingSumType<T>;
+
+  RollingSumAggregator(const RollingOptions& options, bool mean)
+      : options_(options), mean_(mean) {}
+
+  std::shared_ptr<DataType> out_type() const {
+    return mean_ ? float64() : RollingSumDataType<T>();
+  }
+
+  int64_t out_size() const { return mean_ ? sizeof(double) : sizeof(OutType); }
+
+  void Run(const ArrayDataVector& chunks, int64_t start, int64_t length,
+           ArrayData* out) {
+    const int64_t begin = std::max<int64_t>(0, start - options_.window + 1);
+    ValueCursor<T> head(chunks, begin);
+    ValueCursor<T> tail(chunks, begin);
+    uint8_t* out_valid = out->buffers[0]->mutable_data();
+    OutType* out_sums = out->GetMutableValues<OutType>(1);
+    double* out_means = out->GetMutableValues<double>(1);
+
+    OutType sum = 0;
+    int64_t count = 0;
+    // NaN values are counted rather than summed, so that the sum recovers
+    // once they leave the window
+    int64_t nan_count = 0;
+    for (int64_t i = begin; i < start + length; ++i, head.Next()) {
+      if (head.valid()) {
+        const T value = head.value();
+        if (IsNaN(value)) {
+          ++nan_count;
+        } else {
+          sum = WrappingAdd(sum, static_cast<OutType>(value));
+        }
+        ++count;
+      }
+      if (i - options_.window >= begin) {
+        if (tail.valid()) {
+          const T value = tail.value();
+          if (IsNaN(value)) {
+            --nan_count;
+          } else {
+            sum = WrappingSubtract(sum, static_cast<OutType>(value));
+          }
+          --count;
+        }
+        tail.Next();
+      }
+      if (i < start) {
+        continue;
+      }
+      const int64_t j = i - start;
+      const bool valid = count >= options_.min_periods && count > 0;
+      BitUtil::SetBitTo(out_valid, j, valid);
+      const OutType result = nan_count > 0 ? NaN<OutType>() : sum;
+      if (mean_) {
+        out_means[j] = valid ? static_cast<double>(result) / count : 0;
+      } else {
+        out_sums[j] = valid ? result : 0;
+      }
+    }
+  }
+
+ private:
+  const RollingOptions& options_;
+  const bool mean_;
+};
+
+template <typename T>
+class RollingMinMaxAggregator {
+ public:
+  RollingMinMaxAggregator(const RollingOptions& options, std::shared_ptr<DataType> type,
+                          bool is_max)
+      : options_(options), type_(std::move(type)), is_max_(is_max) {}
+
+  std::shared_ptr<DataType> out_type() const { return type_; }
+
+  int64_t out_size() const { return sizeof(T); }
+
+  void Run(const ArrayDataVector& chunks, int64_t start, int64_t length,
+           ArrayData* out) {
+    if (is_max_) {
+      RunWith(chunks, start, length, out, [](T a, T b) { return a <= b; });
+    } else {
+      RunWith(chunks, start, length, out, [](T a, T b) { return a >= b; });
+    }
+  }
+
+ private:
+  // The deque holds the positions and values of the window which may still
+  // become its extremum, the extremum at the front.  A value is dropped from
+  // the back when `dominated(back, value)`, i.e. a newer value is as extreme.
+  template <typename DominatedFunc>
+  void RunWith(const ArrayDataVector& chunks, int64_t start, int64_t length,
+               ArrayData* out, DominatedFunc&& dominated) {
+    const int64_t begin = std::max<int64_t>(0, start - options_.window + 1);
+    ValueCursor<T> head(chunks, begin);
+    ValueCursor<T> tail(chunks, begin);
+    uint8_t* out_valid = out->buffers[0]->mutable_data();
+    T* out_values = out->GetMutableValues<T>(1);
+
+    std::deque<std::pair<int64_t, T>> candidates;
+    int64_t count = 0;
+    for (int64_t i = begin; i < start + length; ++i, head.Next()) {
+      if (head.valid()) {
+        const T value = head.value();
+        if (!IsNaN(value)) {
+          while (!candidates.empty() && dominated(candidates.back().second, value)) {
+            candidates.pop_back();
+          }
+          candidates.emplace_back(i, value);
+        }
+        ++count;
+      }
+      if (i - options_.window >= begin) {
+        count -= tail.valid();
+        tail.Next();
+      }
+      while (!candidates.empty() && candidates.front().first <= i - options_.window) {
+        candidates.pop_front();
+      }
+      if (i < start) {
+        continue;
+      }
+      const int64_t j = i - start;
+      const bool valid = count >= options_.min_periods && count > 0;
+      BitUtil::SetBitTo(out_valid, j, valid);
+      if (!valid) {
+        out_values[j] = 0;
+      } else if (candidates.empty()) {
+        // Only NaN values in the window
+        out_values[j] = NaN<T>();
+      } else {
+        out_values[j] = candidates.front().second;
+      }
+    }
+  }
+
+  const RollingOptions& options_;
+  std::shared_ptr<DataType> type_;
+  const bool is_max_;
+};
+
+template <typename Aggregator>
+Status RollingChunks(FunctionContext* ctx, const ArrayDataVector& chunks,
+                     Aggregator&& aggregator, std::shared_ptr<DataType>* out_type,
+                     ArrayDataVector* out) {
+  const int num_chunks = static_cast<int>(chunks.size());
+  *out_type = aggregator.out_type();
+  out->resize(num_chunks);
+  std::vector<int64_t> starts(num_chunks, 0);
+  for (int i = 1; i < num_chunks; ++i) {
+    starts[i] = starts[i - 1] + chunks[i - 1]->length;
+  }
+
+  auto run_chunk = [&](int i) -> Status {
+    const int64_t length = chunks[i]->length;
+    std::shared_ptr<Buffer> validity, values;
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &validity));
+    RETURN_NOT_OK(ctx->Allocate(length * aggregator.out_size(), &values));
+    auto output = ArrayData::Make(*out_type, length, {validity, values});
+    aggregator.Run(chunks, starts[i], length, output.get());
+    output->null_count = kUnknownNullCount;
+    (*out)[i] = std::move(output);
+    return Status::OK();
+  };
+
+  if (ctx->use_threads() && num_chunks > 1) {
+    return ::arrow::internal::ParallelFor(num_chunks, run_chunk);
+  }
+  for (int i = 0; i < num_chunks; ++i) {
+    RETURN_NOT_OK(run_chunk(i));
+  }
+  return Status::OK();
+}
+
+template <typename T>
+Status RollingTyped(FunctionContext* ctx, const ArrayDataVector& chunks,
+                    const std::shared_ptr<DataType>& type, const RollingOptions& options,
+                    std::shared_ptr<DataType>* out_type, ArrayDataVector* out) {
+  switch (options.op) {
+    case RollingOptions::SUM:
+      return RollingChunks(ctx, chunks, RollingSumAggregator<T>(options, false),
+                           out_type, out);
+    case RollingOptions::MEAN:
+      return RollingChunks(ctx, chunks, RollingSumAggregator<T>(options, true), out_type,
+                           out);
+    case RollingOptions::MIN:
+      return RollingChunks(ctx, chunks, RollingMinMaxAggregator<T>(options, type, false),
+                           out_type, out);
+    case RollingOptions::MAX:
+      return RollingChunks(ctx, chunks, RollingMinMaxAggregator<T>(options, type, true),
+                           out_type, out);
+  }
+  return Status::Invalid("Unknown rolling operator");
+}
+
+// ----------------------------------------------------------------------
+// Dispatch
+
+#define WINDOW_NUMERIC_TYPES(PROCESS) \
+  PROCESS(UInt8Type)                  \
+  PROCESS(Int8Type)                   \
+  PROCESS(UInt16Type)                 \
+  PROCESS(Int16Type)                  \
+  PROCESS(UInt32Type)                 \
+  PROCESS(Int32Type)                  \
+  PROCESS(UInt64Type)                 \
+  PROCESS(Int64Type)                  \
+  PROCESS(FloatType)                  \
+  PROCESS(DoubleType)
+
+// Split values into chunks, and wrap the output chunks alike
+Status GetChunks(const Datum& values, const char* kernel_name, ArrayDataVector* out) {
+  switch (values.kind()) {
+    case Datum::ARRAY:
+      out->push_back(values.array());
+      return Status::OK();
+    case Datum::CHUNKED_ARRAY:
+      for (const auto& chunk : values.chunked_array()->chunks()) {
+        out->push_back(chunk->data());
+      }
+      return Status::OK();
+    default:
+      break;
+  }
+  return Status::Invalid(kernel_name, " expects an Array or ChunkedArray");
+}
+
+Datum WrapChunks(const Datum& values, const std::shared_ptr<DataType>& type,
+                 const ArrayDataVector& chunks) {
+  if (values.kind() == Datum::ARRAY) {
+    return Datum(chunks[0]);
+  }
+  ArrayVector arrays;
+  for (const auto& chunk : chunks) {
+    arrays.push_back(MakeArray(chunk));
+  }
+  return Datum(std::make_shared<ChunkedArray>(std::move(arrays), type));
+}
+
+}  // namespace
+
+Status Cumulative(FunctionContext* ctx, const Datum& values,
+                  const CumulativeOptions& options, Datum* out) {
+  ArrayDataVector chunks;
+  RETURN_NOT_OK(GetChunks(values, "Cumulative", &chunks));
+  const auto type = values.type();
+  ArrayDataVector out_chunks;
+  switch (type->id()) {
+#define PROCESS(InType)                                                          \
+  case InType::type_id:                                                          \
+    RETURN_NOT_OK(CumulativeTyped<typename InType::c_type>(ctx, chunks, options, \
+                                                           &out_chunks));        \
+    break;
+
+    WINDOW_NUMERIC_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      return Status::NotImplemented("Cumulative not implemented for type ",
+                                    type->ToString());
+  }
+  *out = WrapChunks(values, type, out_chunks);
+  return Status::OK();
+}
+
+Status Rolling(FunctionContext* ctx, const Datum& values, const RollingOptions& options,
+               Datum* out) {
+  if (options.window < 1) {
+    return Status::Invalid("Rolling window must hold at least one value, got ",
+                           options.window);
+  }
+  if (options.min_periods < 0 || options.min_periods > options.window) {
+    return Status::Invalid("Rolling min_periods must be between 0 and the window (",
+                           options.window, "), got ", options.min_periods);
+  }
+  ArrayDataVector chunks;
+  RETURN_NOT_OK(GetChunks(values, "Rolling", &chunks));
+  const auto type = values.type();
+  std::shared_ptr<DataType> out_type;
+  ArrayDataVector out_chunks;
+  switch (type->id()) {
+#define PROCESS(InType)                                                             \
+  case InType::type_id:                                                             \
+    RETURN_NOT_OK(RollingTyped<typename InType::c_type>(ctx, chunks, type, options, \
+                                                        &out_type, &out_chunks));   \
+    break;
+
+    WINDOW_NUMERIC_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      return Status::NotImplemented("Rolling not implemented for type ",
+                                    type->ToString());
+  }
+  *out = WrapChunks(values, out_type, out_chunks);
+  return Status::OK();
+}
+
+#undef WINDOW_NUMERIC_TYPES
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,120 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Options for the Cumulative kernel
+struct ARROW_EXPORT CumulativeOptions {
+  enum Operator {
+    SUM,
+    PRODUCT,
+    MIN,
+    MAX,
+  };
+
+  explicit CumulativeOptions(Operator op) : op(op) {}
+
+  Operator op;
+};
+
+/// \brief Compute the running aggregate of the values of a numeric array
+///
+/// Output slot i holds the aggregate of the non-null input values up to and
+/// including slot i.  Null inputs yield null outputs and are otherwise
+/// skipped.  The result has the type of the input: integer sums and products
+/// wrap around on overflow.  NaN values propagate through SUM and PRODUCT and
+/// are ignored by MIN and MAX.
+///
+/// The chunks of a ChunkedArray are scanned in parallel if
+/// context->use_threads(), then the aggregate of the preceding chunks is
+/// folded into each chunk.  Floating-point sums and products may then differ
+/// in rounding from a sequential scan.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the Array or ChunkedArray to scan
+/// \param[in] options the aggregate to compute
+/// \param[out] out the running aggregates, of the same shape as values
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Cumulative(FunctionContext* context, const Datum& values,
+                  const CumulativeOptions& options, Datum* out);
+
+/// \brief Options for the Rolling kernel
+struct ARROW_EXPORT RollingOptions {
+  enum Operator {
+    SUM,
+    MEAN,
+    MIN,
+    MAX,
+  };
+
+  RollingOptions(Operator op, int64_t window)
+      : op(op), window(window), min_periods(window) {}
+
+  Operator op;
+  /// The number of slots of each window, ending at the output slot
+  int64_t window;
+  /// The minimum number of non-null values a window needs for its output
+  /// to be non-null, at most `window`
+  int64_t min_periods;
+};
+
+/// \brief Compute an aggregate over a fixed-size window sliding over the
+/// values of a numeric array
+///
+/// Output slot i holds the aggregate of the non-null input values in slots
+/// `[i - window + 1, i]`, or null if there are fewer than `min_periods` of
+/// them or none at all.  Windows span chunk boundaries.
+///
+/// SUM yields int64 for signed integers, uint64 for unsigned integers and
+/// double for floating-point values, MEAN yields double, MIN and MAX yield
+/// the type of the input.  Sums are updated incrementally as values enter
+/// and leave the window, and MIN and MAX keep the candidate values of the
+/// window in a monotonic deque, so that each input value is visited a
+/// constant number of times whatever the window size.  NaN values propagate
+/// through SUM and MEAN and are ignored by MIN and MAX.
+///
+/// The chunks of a ChunkedArray are computed in parallel if
+/// context->use_threads(), each first reading the `window - 1` values
+/// preceding it.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values the Array or ChunkedArray to aggregate
+/// \param[in] options the aggregate and the window size
+/// \param[out] out the aggregates, of the same shape as values
+///
+/// \since 0.15.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Rolling(FunctionContext* context, const Datum& values,
+               const RollingOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
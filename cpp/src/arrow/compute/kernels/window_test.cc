@@ -0,0 +1,237 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/window.h"
+#include "arrow/compute/test_util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestWindow : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertCumulative(const std::shared_ptr<DataType>& type,
+                        CumulativeOptions::Operator op, const std::string& values,
+                        const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Cumulative(&this->ctx_, ArrayFromJSON(type, values), CumulativeOptions(op),
+                         &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    ASSERT_OK(out.make_array()->Validate());
+    AssertWindowEqual(*ArrayFromJSON(type, expected), *out.make_array());
+  }
+
+  void AssertRolling(const std::shared_ptr<DataType>& type, const RollingOptions& options,
+                     const std::string& values,
+                     const std::shared_ptr<DataType>& expected_type,
+                     const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Rolling(&this->ctx_, ArrayFromJSON(type, values), options, &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    ASSERT_OK(out.make_array()->Validate());
+    AssertWindowEqual(*ArrayFromJSON(expected_type, expected), *out.make_array());
+  }
+
+  // Compare the values one by one, so that NaN equals NaN
+  void AssertWindowEqual(const Array& expected, const Array& actual) {
+    if (expected.type_id() != Type::DOUBLE) {
+      AssertArraysEqual(expected, actual);
+      return;
+    }
+    ASSERT_TRUE(expected.type()->Equals(actual.type()));
+    ASSERT_EQ(expected.length(), actual.length());
+    const auto& expected_values = internal::checked_cast<const DoubleArray&>(expected);
+    const auto& actual_values = internal::checked_cast<const DoubleArray&>(actual);
+    for (int64_t i = 0; i < expected.length(); ++i) {
+      ASSERT_EQ(expected.IsNull(i), actual.IsNull(i)) << "at " << i;
+      if (expected.IsValid(i) && !std::isnan(expected_values.Value(i))) {
+        ASSERT_EQ(expected_values.Value(i), actual_values.Value(i)) << "at " << i;
+      } else if (expected.IsValid(i)) {
+        ASSERT_TRUE(std::isnan(actual_values.Value(i))) << "at " << i;
+      }
+    }
+  }
+
+  // Split values into chunks of the given lengths
+  std::shared_ptr<ChunkedArray> Chunk(const std::shared_ptr<Array>& values,
+                                      const std::vector<int64_t>& lengths) {
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (int64_t length : lengths) {
+      chunks.push_back(values->Slice(offset, length));
+      offset += length;
+    }
+    return std::make_shared<ChunkedArray>(chunks, values->type());
+  }
+
+  // Check that the chunked output, with and without threads, matches the
+  // output of the concatenated chunks
+  template <typename Kernel>
+  void CheckChunked(const std::shared_ptr<Array>& values,
+                    const std::vector<int64_t>& lengths, Kernel&& kernel) {
+    Datum expected;
+    this->ctx_.set_use_threads(false);
+    ASSERT_OK(kernel(Datum(values), &expected));
+    auto chunked = Chunk(values, lengths);
+    for (bool use_threads : {false, true}) {
+      this->ctx_.set_use_threads(use_threads);
+      Datum out;
+      ASSERT_OK(kernel(Datum(chunked), &out));
+      ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+      const auto& out_chunks = *out.chunked_array();
+      ASSERT_EQ(chunked->num_chunks(), out_chunks.num_chunks());
+      for (int i = 0; i < chunked->num_chunks(); ++i) {
+        ASSERT_EQ(chunked->chunk(i)->length(), out_chunks.chunk(i)->length());
+      }
+      ChunkedArray expected_chunks({expected.make_array()});
+      AssertChunkedEqual(expected_chunks, out_chunks);
+    }
+  }
+};
+
+TEST_F(TestWindow, Cumulative) {
+  AssertCumulative(int32(), CumulativeOptions::SUM, "[]", "[]");
+  AssertCumulative(int32(), CumulativeOptions::SUM, "[1, 2, null, 4, -3]",
+                   "[1, 3, null, 7, 4]");
+  AssertCumulative(int64(), CumulativeOptions::PRODUCT, "[null, 2, 3, null, -4]",
+                   "[null, 2, 6, null, -24]");
+  AssertCumulative(uint8(), CumulativeOptions::MIN, "[5, 7, null, 3, 4]",
+                   "[5, 5, null, 3, 3]");
+  AssertCumulative(int16(), CumulativeOptions::MAX, "[-5, -7, null, 3, 2]",
+                   "[-5, -5, null, 3, 3]");
+  AssertCumulative(float64(), CumulativeOptions::SUM, "[1.5, null, 2.5, NaN, 1]",
+                   "[1.5, null, 4, NaN, NaN]");
+  AssertCumulative(float32(), CumulativeOptions::MIN, "[2, NaN, 1, null, 3]",
+                   "[2, 2, 1, null, 1]");
+  AssertCumulative(float64(), CumulativeOptions::MAX, "[NaN, null, 2, 1, NaN, 3]",
+                   "[NaN, null, 2, 2, 2, 3]");
+
+  // Integers wrap around
+  AssertCumulative(int8(), CumulativeOptions::SUM, "[127, 1, 1]", "[127, -128, -127]");
+  AssertCumulative(uint16(), CumulativeOptions::PRODUCT, "[256, 256, 3]", "[256, 0, 0]");
+
+  // Sliced input
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[100, 1, null, 2, 3, 100]")->Slice(1, 4);
+  ASSERT_OK(Cumulative(&this->ctx_, values, CumulativeOptions(CumulativeOptions::SUM),
+                       &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, null, 3, 6]"), *out.make_array());
+}
+
+TEST_F(TestWindow, Rolling) {
+  RollingOptions sum(RollingOptions::SUM, 3);
+  AssertRolling(int32(), sum, "[]", int64(), "[]");
+  AssertRolling(int32(), sum, "[1, 2, 3, 4, 5]", int64(), "[null, null, 6, 9, 12]");
+  AssertRolling(uint8(), sum, "[1, 2, 3, 4, 5]", uint64(), "[null, null, 6, 9, 12]");
+  AssertRolling(int32(), sum, "[1, 2, null, 4, 5, 6]", int64(),
+                "[null, null, null, null, null, 15]");
+
+  RollingOptions partial_sum(RollingOptions::SUM, 3);
+  partial_sum.min_periods = 1;
+  AssertRolling(int32(), partial_sum, "[1, 2, null, 4, null, null, null, 8]", int64(),
+                "[1, 3, 3, 6, 4, 4, null, 8]");
+  AssertRolling(float64(), partial_sum, "[1, NaN, 2, 3, 4, null]", float64(),
+                "[1, NaN, NaN, NaN, 9, 7]");
+
+  RollingOptions mean(RollingOptions::MEAN, 2);
+  mean.min_periods = 1;
+  AssertRolling(int16(), mean, "[1, 2, null, 5, 6]", float64(),
+                "[1, 1.5, 2, 5, 5.5]");
+
+  RollingOptions min(RollingOptions::MIN, 3);
+  min.min_periods = 1;
+  AssertRolling(int32(), min, "[5, 3, 4, 6, 7, null, 2, 8]", int32(),
+                "[5, 3, 3, 3, 4, 6, 2, 2]");
+  AssertRolling(float64(), min, "[NaN, 3, NaN, NaN, NaN, 1]", float64(),
+                "[NaN, 3, 3, 3, NaN, 1]");
+
+  RollingOptions max(RollingOptions::MAX, 2);
+  AssertRolling(uint32(), max, "[5, 3, 4, 4, 1, null, 2]", uint32(),
+                "[null, 5, 4, 4, 4, null, null]");
+
+  RollingOptions one(RollingOptions::MAX, 1);
+  AssertRolling(int8(), one, "[1, null, -3]", int8(), "[1, null, -3]");
+}
+
+TEST_F(TestWindow, Chunked) {
+  auto rand = random::RandomArrayGenerator(0x2b5e1c);
+  const int64_t length = 500;
+  auto ints = rand.Int32(length, -1000, 1000, /*null_probability=*/0.1);
+  auto doubles = rand.Float64(length, -10, 10, /*null_probability=*/0.1);
+  const std::vector<int64_t> lengths = {0, 7, 1, 0, 150, 3, 2, 337, 0};
+
+  for (auto op : {CumulativeOptions::SUM, CumulativeOptions::MIN,
+                  CumulativeOptions::MAX}) {
+    auto kernel = [&](const Datum& values, Datum* out) {
+      return Cumulative(&this->ctx_, values, CumulativeOptions(op), out);
+    };
+    CheckChunked(ints, lengths, kernel);
+    CheckChunked(doubles->Slice(0, 40), {5, 0, 35}, kernel);
+  }
+
+  for (auto op : {RollingOptions::SUM, RollingOptions::MEAN, RollingOptions::MIN,
+                  RollingOptions::MAX}) {
+    for (int64_t window : {1, 2, 5, 160}) {
+      RollingOptions options(op, window);
+      options.min_periods = window / 2;
+      auto kernel = [&](const Datum& values, Datum* out) {
+        return Rolling(&this->ctx_, values, options, out);
+      };
+      CheckChunked(ints, lengths, kernel);
+      if (op != RollingOptions::SUM && op != RollingOptions::MEAN) {
+        // Floating-point sums depend on the order of additions
+        CheckChunked(doubles, lengths, kernel);
+      }
+    }
+  }
+}
+
+TEST_F(TestWindow, Errors) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  Datum out;
+  RollingOptions options(RollingOptions::SUM, 0);
+  ASSERT_RAISES(Invalid, Rolling(&this->ctx_, values, options, &out));
+  options.window = 2;
+  options.min_periods = 3;
+  ASSERT_RAISES(Invalid, Rolling(&this->ctx_, values, options, &out));
+  options.min_periods = -1;
+  ASSERT_RAISES(Invalid, Rolling(&this->ctx_, values, options, &out));
+
+  auto strings = ArrayFromJSON(utf8(), R"(["a"])");
+  CumulativeOptions cumulative(CumulativeOptions::SUM);
+  ASSERT_RAISES(NotImplemented, Cumulative(&this->ctx_, strings, cumulative, &out));
+  options.min_periods = 1;
+  ASSERT_RAISES(NotImplemented, Rolling(&this->ctx_, strings, options, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/operations/boolean.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+
+BooleanOperation::BooleanOperation(std::vector<std::shared_ptr<Expr>> args)
+    : args_(std::move(args)) {}
+
+Status BooleanOperation::ToExpr(std::shared_ptr<Expr>* out) const {
+  auto bool_ty = type::boolean();
+  bool any_array = false;
+  for (const auto& arg : args_) {
+    if (!bool_ty->IsInstance(*arg)) {
+      return Status::TypeError("Logical operations only apply to boolean expressions");
+    }
+    any_array |= static_cast<const ValueExpr&>(*arg).rank() == ValueRank::ARRAY;
+  }
+
+  auto op = shared_from_this();
+  if (any_array) {
+    return GetArrayExpr(op, bool_ty, out);
+  } else {
+    return GetScalarExpr(op, bool_ty, out);
+  }
+}
+
+And::And(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right)
+    : BooleanOperation({std::move(left), std::move(right)}) {}
+
+Or::Or(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right)
+    : BooleanOperation({std::move(left), std::move(right)}) {}
+
+Not::Not(std::shared_ptr<Expr> value) : BooleanOperation({std::move(value)}) {}
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/operation.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+
+/// \brief Base class for the element-wise logical operations, which create a
+/// boolean expression from boolean expressions. The result is an array if any
+/// input is, and null where any input is null
+class ARROW_EXPORT BooleanOperation : public Operation {
+ public:
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+  std::vector<std::shared_ptr<Expr>> input_args() const override { return args_; }
+
+ protected:
+  explicit BooleanOperation(std::vector<std::shared_ptr<Expr>> args);
+
+  std::vector<std::shared_ptr<Expr>> args_;
+};
+
+/// \brief Logical and of two boolean expressions
+class ARROW_EXPORT And : public BooleanOperation {
+ public:
+  And(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right);
+};
+
+/// \brief Logical or of two boolean expressions
+class ARROW_EXPORT Or : public BooleanOperation {
+ public:
+  Or(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right);
+};
+
+/// \brief Logical negation of a boolean expression
+class ARROW_EXPORT Not : public BooleanOperation {
+ public:
+  explicit Not(std::shared_ptr<Expr> value);
+};
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
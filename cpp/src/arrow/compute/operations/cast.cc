@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
@@ -48,6 +49,8 @@ Status Cast::ToExpr(std::shared_ptr<Expr>* out) const {
   }
 }
 
+std::vector<std::shared_ptr<Expr>> Cast::input_args() const { return {value_}; }
+
 }  // namespace ops
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/operations/compare.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+
+Compare::Compare(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right,
+                 CompareOperator op)
+    : left_(std::move(left)), right_(std::move(right)), op_(op) {}
+
+Status Compare::ToExpr(std::shared_ptr<Expr>* out) const {
+  auto value_ty = type::any();
+  if (!value_ty->IsInstance(*left_) || !value_ty->IsInstance(*right_)) {
+    return Status::Invalid("Compare only applies to value expressions");
+  }
+  const auto& left_expr = static_cast<const ValueExpr&>(*left_);
+  const auto& right_expr = static_cast<const ValueExpr&>(*right_);
+  if (left_expr.type()->id() != right_expr.type()->id()) {
+    return Status::TypeError("Cannot compare ", left_expr.type()->ToString(), " to ",
+                             right_expr.type()->ToString());
+  }
+
+  auto op = shared_from_this();
+  if (left_expr.rank() == ValueRank::SCALAR && right_expr.rank() == ValueRank::SCALAR) {
+    return GetScalarExpr(op, type::boolean(), out);
+  } else {
+    return GetArrayExpr(op, type::boolean(), out);
+  }
+}
+
+std::vector<std::shared_ptr<Expr>> Compare::input_args() const {
+  return {left_, right_};
+}
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
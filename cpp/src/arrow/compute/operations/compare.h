@@ -0,0 +1,51 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/operation.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+namespace ops {
+
+/// \brief A comparison operation creates a boolean expression from two value
+/// expressions of the same type. The result is an array if either input is
+class ARROW_EXPORT Compare : public Operation {
+ public:
+  Compare(std::shared_ptr<Expr> left, std::shared_ptr<Expr> right, CompareOperator op);
+  Status ToExpr(std::shared_ptr<Expr>* out) const override;
+  std::vector<std::shared_ptr<Expr>> input_args() const override;
+
+  const std::shared_ptr<Expr>& left() const { return left_; }
+  const std::shared_ptr<Expr>& right() const { return right_; }
+  CompareOperator op() const { return op_; }
+
+ private:
+  std::shared_ptr<Expr> left_;
+  std::shared_ptr<Expr> right_;
+  CompareOperator op_;
+};
+
+}  // namespace ops
+}  // namespace compute
+}  // namespace arrow
@@ -32,7 +32,10 @@
 #include "arrow/compute/expression.h"
 #include "arrow/compute/logical_type.h"
 #include "arrow/compute/operation.h"
+#include "arrow/compute/operations/boolean.h"
 #include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/compare.h"
+#include "arrow/compute/operations/field_ref.h"
 #include "arrow/compute/operations/literal.h"
 
 namespace arrow {
@@ -60,5 +63,39 @@ TEST(Cast, Basics) {
   ASSERT_TRUE(InheritsFrom<array::Float64>(*out_expr));
 }
 
+TEST(FieldRef, Basics) {
+  std::shared_ptr<Expr> expr;
+  ASSERT_OK(std::make_shared<ops::FieldRef>("f0", type::int16())->ToExpr(&expr));
+  ASSERT_TRUE(InheritsFrom<array::Int16>(*expr));
+}
+
+TEST(Compare, Basics) {
+  auto dummy_op = std::make_shared<DummyOp>();
+  std::shared_ptr<Expr> literal, out_expr;
+  ASSERT_OK(std::make_shared<ops::Literal>(std::make_shared<Int32Scalar>(1))
+                ->ToExpr(&literal));
+  ASSERT_OK(std::make_shared<ops::Compare>(array::int32(dummy_op), literal, LESS)
+                ->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Bool>(*out_expr));
+  ASSERT_OK(std::make_shared<ops::Compare>(literal, literal, EQUAL)->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<scalar::Bool>(*out_expr));
+  ASSERT_RAISES(TypeError,
+                std::make_shared<ops::Compare>(array::int64(dummy_op), literal, EQUAL)
+                    ->ToExpr(&out_expr));
+}
+
+TEST(Boolean, Basics) {
+  auto dummy_op = std::make_shared<DummyOp>();
+  auto left = array::boolean(dummy_op);
+  auto right = scalar::boolean(dummy_op);
+  std::shared_ptr<Expr> out_expr;
+  ASSERT_OK(std::make_shared<ops::And>(left, right)->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<array::Bool>(*out_expr));
+  ASSERT_OK(std::make_shared<ops::Not>(right)->ToExpr(&out_expr));
+  ASSERT_TRUE(InheritsFrom<scalar::Bool>(*out_expr));
+  auto other = array::int8(dummy_op);
+  ASSERT_RAISES(TypeError, std::make_shared<ops::Or>(left, other)->ToExpr(&out_expr));
+}
+
 }  // namespace compute
 }  // namespace arrow
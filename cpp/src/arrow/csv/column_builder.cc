@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -36,6 +37,7 @@
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/task_group.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace csv {
@@ -179,6 +181,8 @@ void TypedColumnBuilder::Insert(int64_t block_index,
 
   // We're careful that all references in the closure outlive the Append() call
   task_group_->Append([=]() -> Status {
+    ARROW_TRACE_SPAN(span, "csv", "Convert");
+    ScopedMemoryTag memory_tag("csv.convert");
     std::shared_ptr<Array> res;
     RETURN_NOT_OK(WrapConversionError(converter_->Convert(*parser, col_index_, &res)));
 
@@ -214,7 +218,12 @@ class InferringColumnBuilder : public ColumnBuilder {
       : ColumnBuilder(task_group),
         col_index_(col_index),
         options_(options),
-        pool_(pool) {}
+        inference_options_(options),
+        pool_(pool),
+        num_sample_chunks_(static_cast<size_t>(std::max(options.inference_blocks, 0))) {
+    // Inference relies on failing to convert invalid values
+    inference_options_.invalid_values_as_null = false;
+  }
 
   Status Init();
 
@@ -228,13 +237,30 @@ class InferringColumnBuilder : public ColumnBuilder {
   // This must be called unlocked!
   void ScheduleConvertChunk(size_t chunk_index);
 
+  bool IsSampleChunk(size_t chunk_index) const {
+    return num_sample_chunks_ == 0 || chunk_index < num_sample_chunks_;
+  }
+  // Fix the type once the sample chunks are converted.  We are locked
+  Status MaybeFixType(std::vector<size_t>* chunks_to_convert);
+  Status ConvertFixedChunk(size_t chunk_index);
+  // This must be called unlocked!
+  void ScheduleConvertFixedChunk(size_t chunk_index);
+
   std::mutex mutex_;
 
   int32_t col_index_;
   ConvertOptions options_;
+  ConvertOptions inference_options_;
   MemoryPool* pool_;
   std::shared_ptr<Converter> converter_;
 
+  // The number of chunks the type is inferred from, or 0 to infer it from all
+  const size_t num_sample_chunks_;
+  // The converter to the type fixed after the sample chunks, if it is
+  std::shared_ptr<Converter> fixed_converter_;
+  // The chunks after the sample ones which wait for the type to be fixed
+  std::vector<size_t> pending_chunks_;
+
   // Current inference status
   enum class InferKind { Null, Integer, Boolean, Real, Timestamp, Text, Binary };
 
@@ -314,7 +340,56 @@ Status InferringColumnBuilder::UpdateType() {
       can_loosen_type_ = false;
       break;
   }
-  return Converter::Make(infer_type_, options_, pool_, &converter_);
+  return Converter::Make(infer_type_, inference_options_, pool_, &converter_);
+}
+
+Status InferringColumnBuilder::MaybeFixType(std::vector<size_t>* chunks_to_convert) {
+  // We are locked
+
+  if (num_sample_chunks_ == 0 || fixed_converter_ != nullptr ||
+      chunks_.size() < num_sample_chunks_) {
+    return Status::OK();
+  }
+  for (size_t i = 0; i < num_sample_chunks_; ++i) {
+    if (chunks_[i] == nullptr) {
+      return Status::OK();
+    }
+  }
+  // All the sample chunks are converted to the inferred type, which is final
+  RETURN_NOT_OK(Converter::Make(infer_type_, options_, pool_, &fixed_converter_));
+  for (size_t i = 0; i < num_sample_chunks_; ++i) {
+    parsers_[i].reset();
+  }
+  *chunks_to_convert = std::move(pending_chunks_);
+  pending_chunks_.clear();
+  return Status::OK();
+}
+
+void InferringColumnBuilder::ScheduleConvertFixedChunk(size_t chunk_index) {
+  // We're careful that all values in the closure outlive the Append() call
+  task_group_->Append([=]() { return ConvertFixedChunk(chunk_index); });
+}
+
+Status InferringColumnBuilder::ConvertFixedChunk(size_t chunk_index) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  std::shared_ptr<Converter> converter = fixed_converter_;
+  std::shared_ptr<BlockParser> parser = std::move(parsers_[chunk_index]);
+  DCHECK_NE(converter, nullptr);
+  DCHECK_NE(parser, nullptr);
+
+  lock.unlock();
+  ARROW_TRACE_SPAN(span, "csv", "Convert");
+  ScopedMemoryTag memory_tag("csv.convert");
+  std::shared_ptr<Array> res;
+  Status st = converter->Convert(*parser, col_index_, &res);
+  if (!st.ok()) {
+    std::stringstream ss;
+    ss << "In CSV column #" << col_index_ << ": " << st.message();
+    return st.WithMessage(ss.str());
+  }
+  lock.lock();
+  chunks_[chunk_index] = std::move(res);
+  return Status::OK();
 }
 
 void InferringColumnBuilder::ScheduleConvertChunk(size_t chunk_index) {
@@ -332,7 +407,12 @@ Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
   DCHECK_NE(parser, nullptr);
 
   lock.unlock();
-  Status st = converter->Convert(*parser, col_index_, &res);
+  Status st;
+  {
+    ARROW_TRACE_SPAN(span, "csv", "Convert");
+    ScopedMemoryTag memory_tag("csv.convert");
+    st = converter->Convert(*parser, col_index_, &res);
+  }
   lock.lock();
 
   if (kind != infer_kind_) {
@@ -349,6 +429,12 @@ Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
       // We won't try to reconvert anymore
       parsers_[chunk_index].reset();
     }
+    std::vector<size_t> chunks_to_convert;
+    RETURN_NOT_OK(MaybeFixType(&chunks_to_convert));
+    lock.unlock();
+    for (size_t i : chunks_to_convert) {
+      ScheduleConvertFixedChunk(i);
+    }
     return Status::OK();
   } else if (can_loosen_type_) {
     // Conversion failed, try another type
@@ -396,9 +482,19 @@ void InferringColumnBuilder::Insert(int64_t block_index,
     // Should not insert an already converting chunk
     DCHECK_EQ(parsers_[chunk_index], nullptr);
     parsers_[chunk_index] = parser;
+
+    if (!IsSampleChunk(chunk_index) && fixed_converter_ == nullptr) {
+      // Convert once the type is fixed
+      pending_chunks_.push_back(chunk_index);
+      return;
+    }
   }
 
-  ScheduleConvertChunk(chunk_index);
+  if (IsSampleChunk(chunk_index)) {
+    ScheduleConvertChunk(chunk_index);
+  } else {
+    ScheduleConvertFixedChunk(chunk_index);
+  }
 }
 
 Status InferringColumnBuilder::Finish(std::shared_ptr<ChunkedArray>* out) {
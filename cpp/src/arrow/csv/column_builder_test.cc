@@ -451,5 +451,55 @@ TEST(InferringColumnBuilder, MultipleChunkIntegerParallel) {
   AssertChunkedEqual(*actual, *expected);
 }
 
+TEST(InferringColumnBuilder, InferenceBlocks) {
+  auto options = ConvertOptions::Defaults();
+  options.inference_blocks = 2;
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual, expected;
+
+  // The type is loosened from the sample blocks
+  ASSERT_OK(ColumnBuilder::Make(default_memory_pool(), 0, options, tg, &builder));
+  AssertBuilding(builder, {{"1"}, {"2.5"}, {"3"}}, &actual);
+  ChunkedArrayFromVector<DoubleType>({{1.0}, {2.5}, {3.0}}, &expected);
+  AssertChunkedEqual(*expected, *actual);
+
+  // But not from the blocks after them
+  tg = TaskGroup::MakeSerial();
+  ASSERT_OK(ColumnBuilder::Make(default_memory_pool(), 0, options, tg, &builder));
+  for (const auto& chunk : std::vector<std::vector<std::string>>{{"1"}, {"2"}, {"x"}}) {
+    std::shared_ptr<BlockParser> parser;
+    MakeColumnParser(chunk, &parser);
+    builder->Append(parser);
+  }
+  ASSERT_RAISES(Invalid, tg->Finish());
+
+  // Unless invalid values are converted to nulls
+  options.invalid_values_as_null = true;
+  tg = TaskGroup::MakeSerial();
+  ASSERT_OK(ColumnBuilder::Make(default_memory_pool(), 0, options, tg, &builder));
+  AssertBuilding(builder, {{"1"}, {"2"}, {"x", "4"}}, &actual);
+  ChunkedArrayFromVector<Int64Type>({{true}, {true}, {false, true}}, {{1}, {2}, {0, 4}},
+                                    &expected);
+  AssertChunkedEqual(*expected, *actual);
+}
+
+TEST(InferringColumnBuilder, InferenceBlocksParallel) {
+  auto options = ConvertOptions::Defaults();
+  options.inference_blocks = 2;
+  options.invalid_values_as_null = true;
+  auto tg = TaskGroup::MakeThreaded(GetCpuThreadPool());
+  std::shared_ptr<ColumnBuilder> builder;
+  ASSERT_OK(ColumnBuilder::Make(default_memory_pool(), 0, options, tg, &builder));
+
+  std::shared_ptr<ChunkedArray> actual;
+  AssertBuilding(builder, {{"1", "2"}, {"3.5"}, {"4", "x"}, {"6", "7"}}, &actual);
+
+  std::shared_ptr<ChunkedArray> expected;
+  ChunkedArrayFromVector<DoubleType>({{true, true}, {true}, {true, false}, {true, true}},
+                                     {{1, 2}, {3.5}, {4, 0}, {6, 7}}, &expected);
+  AssertChunkedEqual(*expected, *actual);
+}
+
 }  // namespace csv
 }  // namespace arrow
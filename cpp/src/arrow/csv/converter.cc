@@ -17,12 +17,14 @@
 
 #include "arrow/csv/converter.h"
 
+#include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/csv/parser.h"
 #include "arrow/memory_pool.h"
@@ -30,6 +32,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 #include "arrow/util/trie.h"
 #include "arrow/util/utf8.h"
@@ -96,10 +99,21 @@ class ConcreteConverter : public Converter {
   Status Initialize() override;
   inline bool IsNull(const uint8_t* data, uint32_t size, bool quoted);
 
+  static uint32_t LengthBit(uint32_t size) { return 1U << std::min<uint32_t>(size, 31); }
+
   Trie null_trie_;
+  // For each first character, the bits of the lengths of the null spellings
+  // starting with it, so that most values need not be looked up in the trie
+  uint32_t null_lengths_by_first_char_[256] = {};
 };
 
 Status ConcreteConverter::Initialize() {
+  for (const auto& s : options_.null_values) {
+    if (!s.empty()) {
+      null_lengths_by_first_char_[static_cast<uint8_t>(s[0])] |=
+          LengthBit(static_cast<uint32_t>(s.size()));
+    }
+  }
   // TODO no need to build a separate Trie for each Converter instance
   return InitializeTrie(options_.null_values, &null_trie_);
 }
@@ -108,6 +122,9 @@ bool ConcreteConverter::IsNull(const uint8_t* data, uint32_t size, bool quoted)
   if (quoted) {
     return false;
   }
+  if (size > 0 && (null_lengths_by_first_char_[data[0]] & LengthBit(size)) == 0) {
+    return false;
+  }
   return null_trie_.Find(util::string_view(reinterpret_cast<const char*>(data), size)) >=
          0;
 }
@@ -128,7 +145,8 @@ Status NullConverter::Convert(const BlockParser& parser, int32_t col_index,
   NullBuilder builder(pool_);
 
   auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-    if (ARROW_PREDICT_TRUE(IsNull(data, size, quoted))) {
+    if (ARROW_PREDICT_TRUE(IsNull(data, size, quoted)) ||
+        options_.invalid_values_as_null) {
       return builder.AppendNull();
     } else {
       return GenericConversionError(type_, data, size);
@@ -150,11 +168,23 @@ class VarSizeBinaryConverter : public ConcreteConverter {
 
   Status Convert(const BlockParser& parser, int32_t col_index,
                  std::shared_ptr<Array>* out) override {
+    if (parser.num_cols() == 1 && parser.parsed_buffer() != nullptr) {
+      bool shared;
+      RETURN_NOT_OK(ConvertSharingParsedData(parser, &shared, out));
+      if (shared) {
+        return Status::OK();
+      }
+    }
+
     using BuilderType = typename TypeTraits<T>::BuilderType;
     BuilderType builder(pool_);
 
     auto visit_non_null = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
       if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
+        if (options_.invalid_values_as_null) {
+          builder.UnsafeAppendNull();
+          return Status::OK();
+        }
         return Status::Invalid("CSV conversion error to ", type_->ToString(),
                                ": invalid UTF8 data");
       }
@@ -162,8 +192,15 @@ class VarSizeBinaryConverter : public ConcreteConverter {
       return Status::OK();
     };
 
+    // Reserve the size of this column's values rather than that of the block,
+    // which every string column of the block would reserve otherwise
+    int64_t data_size = 0;
+    RETURN_NOT_OK(parser.VisitColumn(col_index, [&](const uint8_t*, uint32_t size, bool) {
+      data_size += size;
+      return Status::OK();
+    }));
     RETURN_NOT_OK(builder.Resize(parser.num_rows()));
-    RETURN_NOT_OK(builder.ReserveData(parser.num_bytes()));
+    RETURN_NOT_OK(builder.ReserveData(data_size));
 
     if (options_.strings_can_be_null) {
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
@@ -185,6 +222,63 @@ class VarSizeBinaryConverter : public ConcreteConverter {
   }
 
  protected:
+  // The values of a single column are contiguous in the parsed buffer, which
+  // the array can point into instead of copying them, unless a null slot
+  // would have to be non-empty.  *shared is false in that case.
+  Status ConvertSharingParsedData(const BlockParser& parser, bool* shared,
+                                  std::shared_ptr<Array>* out) {
+    using offset_type = typename T::offset_type;
+
+    const auto& data_buffer = parser.parsed_buffer();
+    const uint8_t* base = data_buffer->data();
+    const int64_t length = parser.num_rows();
+
+    TypedBufferBuilder<offset_type> offsets_builder(pool_);
+    TypedBufferBuilder<bool> validity_builder(pool_);
+    RETURN_NOT_OK(offsets_builder.Resize(length + 1));
+    RETURN_NOT_OK(validity_builder.Resize(length));
+    offsets_builder.UnsafeAppend(0);
+
+    *shared = true;
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (!*shared) {
+        return Status::OK();
+      }
+      DCHECK_EQ(data - base, offsets_builder.data()[offsets_builder.length() - 1]);
+      bool is_valid = true;
+      if (options_.strings_can_be_null && IsNull(data, size, false /* quoted */)) {
+        is_valid = false;
+      } else if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
+        if (!options_.invalid_values_as_null) {
+          return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                                 ": invalid UTF8 data");
+        }
+        is_valid = false;
+      }
+      if (!is_valid && size > 0) {
+        *shared = false;
+        return Status::OK();
+      }
+      validity_builder.UnsafeAppend(is_valid);
+      offsets_builder.UnsafeAppend(static_cast<offset_type>(data + size - base));
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(0, visit));
+    if (!*shared) {
+      return Status::OK();
+    }
+
+    const int64_t null_count = validity_builder.false_count();
+    std::shared_ptr<Buffer> offsets, validity;
+    RETURN_NOT_OK(offsets_builder.Finish(&offsets));
+    if (null_count > 0) {
+      RETURN_NOT_OK(validity_builder.Finish(&validity));
+    }
+    *out = MakeArray(
+        ArrayData::Make(type_, length, {validity, offsets, data_buffer}, null_count));
+    return Status::OK();
+  }
+
   Status Initialize() override {
     util::InitializeUTF8();
     return ConcreteConverter::Initialize();
@@ -211,6 +305,9 @@ Status FixedSizeBinaryConverter::Convert(const BlockParser& parser, int32_t col_
 
   auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
     if (ARROW_PREDICT_FALSE(size != byte_width)) {
+      if (options_.invalid_values_as_null) {
+        return builder.AppendNull();
+      }
       return Status::Invalid("CSV conversion error to ", type_->ToString(), ": got a ",
                              size, "-byte long string");
     }
@@ -265,6 +362,10 @@ Status BooleanConverter::Convert(const BlockParser& parser, int32_t col_index,
       builder.UnsafeAppend(true);
       return Status::OK();
     }
+    if (options_.invalid_values_as_null) {
+      builder.UnsafeAppendNull();
+      return Status::OK();
+    }
     return GenericConversionError(type_, data, size);
   };
   RETURN_NOT_OK(builder.Resize(parser.num_rows()));
@@ -307,6 +408,10 @@ Status NumericConverter<T>::Convert(const BlockParser& parser, int32_t col_index
     }
     if (ARROW_PREDICT_FALSE(
             !converter(reinterpret_cast<const char*>(data), size, &value))) {
+      if (options_.invalid_values_as_null) {
+        builder.UnsafeAppendNull();
+        return Status::OK();
+      }
       return GenericConversionError(type_, data, size);
     }
     builder.UnsafeAppend(value);
@@ -341,6 +446,10 @@ class TimestampConverter : public ConcreteConverter {
       }
       if (ARROW_PREDICT_FALSE(
               !converter(reinterpret_cast<const char*>(data), size, &value))) {
+        if (options_.invalid_values_as_null) {
+          builder.UnsafeAppendNull();
+          return Status::OK();
+        }
         return GenericConversionError(type_, data, size);
       }
       builder.UnsafeAppend(value);
@@ -371,23 +480,13 @@ class DecimalConverter : public ConcreteConverter {
         return Status::OK();
       }
       TrimWhiteSpace(&data, &size);
-      Decimal128 decimal;
-      int32_t precision, scale;
       util::string_view view(reinterpret_cast<const char*>(data), size);
-      RETURN_NOT_OK(Decimal128::FromString(view, &decimal, &precision, &scale));
-      DecimalType& type = *internal::checked_cast<DecimalType*>(type_.get());
-      if (precision > type.precision()) {
-        return Status::Invalid("Error converting ", view, " to ", type_->ToString(),
-                               " precision not supported by type.");
-      }
-      if (scale != type.scale()) {
-        Decimal128 scaled;
-        RETURN_NOT_OK(decimal.Rescale(scale, type.scale(), &scaled));
-        builder.UnsafeAppend(scaled);
-      } else {
-        builder.UnsafeAppend(decimal);
+      Status st = AppendDecimal(view, &builder);
+      if (ARROW_PREDICT_FALSE(!st.ok()) && options_.invalid_values_as_null) {
+        builder.UnsafeAppendNull();
+        return Status::OK();
       }
-      return Status::OK();
+      return st;
     };
     RETURN_NOT_OK(builder.Resize(parser.num_rows()));
     RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
@@ -395,6 +494,26 @@ class DecimalConverter : public ConcreteConverter {
 
     return Status::OK();
   }
+
+ protected:
+  Status AppendDecimal(util::string_view view, Decimal128Builder* builder) {
+    Decimal128 decimal;
+    int32_t precision, scale;
+    RETURN_NOT_OK(Decimal128::FromString(view, &decimal, &precision, &scale));
+    DecimalType& type = *internal::checked_cast<DecimalType*>(type_.get());
+    if (precision > type.precision()) {
+      return Status::Invalid("Error converting ", view, " to ", type_->ToString(),
+                             " precision not supported by type.");
+    }
+    if (scale != type.scale()) {
+      Decimal128 scaled;
+      RETURN_NOT_OK(decimal.Rescale(scale, type.scale(), &scaled));
+      builder->UnsafeAppend(scaled);
+    } else {
+      builder->UnsafeAppend(decimal);
+    }
+    return Status::OK();
+  }
 };
 
 }  // namespace
@@ -42,6 +42,19 @@ static std::shared_ptr<BlockParser> BuildInt64Data(int32_t num_rows) {
   return result;
 }
 
+static std::shared_ptr<BlockParser> BuildWideInt64Data(int32_t num_rows) {
+  const std::vector<std::string> base_rows = {"1234567890\n", "-31700555712345\n",
+                                              "\n", "987654321098765432\n", "N/A\n"};
+  std::vector<std::string> rows;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    rows.push_back(base_rows[i % base_rows.size()]);
+  }
+
+  std::shared_ptr<BlockParser> result;
+  MakeCSVParser(rows, &result);
+  return result;
+}
+
 static std::shared_ptr<BlockParser> BuildFloatData(int32_t num_rows) {
   const std::vector<std::string> base_rows = {"0\n", "123.456\n", "-3170.55766\n", "\n",
                                               "N/A\n"};
@@ -96,6 +109,13 @@ static void Int64Conversion(benchmark::State& state) {  // NOLINT non-const refe
   BenchmarkConversion(state, *parser, int64(), options);
 }
 
+static void WideInt64Conversion(benchmark::State& state) {  // NOLINT non-const reference
+  auto parser = BuildWideInt64Data(num_rows);
+  auto options = ConvertOptions::Defaults();
+
+  BenchmarkConversion(state, *parser, int64(), options);
+}
+
 static void FloatConversion(benchmark::State& state) {  // NOLINT non-const reference
   auto parser = BuildFloatData(num_rows);
   auto options = ConvertOptions::Defaults();
@@ -111,6 +131,7 @@ static void Decimal128Conversion(benchmark::State& state) {  // NOLINT non-const
 }
 
 BENCHMARK(Int64Conversion);
+BENCHMARK(WideInt64Conversion);
 BENCHMARK(FloatConversion);
 BENCHMARK(Decimal128Conversion);
 
@@ -170,6 +170,43 @@ TEST(StringConversion, Nulls) {
                                             {{true, false}, {false, false}}, options);
 }
 
+template <typename T>
+static void TestStringConversionSingleColumn() {
+  auto type = TypeTraits<T>::type_singleton();
+  auto options = ConvertOptions::Defaults();
+  options.strings_can_be_null = true;
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array, expected;
+
+  // The array points into the parsed data
+  MakeCSVParser({"ab\n", "\"c,dé\"\n", "\"\"\n"}, &parser);
+  ASSERT_OK(Converter::Make(type, options, &converter));
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  ASSERT_OK(array->Validate());
+  ArrayFromVector<T, std::string>(type, {true, true, false}, {"ab", "c,dé", ""},
+                                  &expected);
+  AssertArraysEqual(*expected, *array);
+  ASSERT_EQ(array->data()->buffers[2], parser->parsed_buffer());
+
+  // Unless a null slot would not be empty
+  MakeCSVParser({"ab\n", "N/A\n", "\"\"\n"}, &parser);
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  ASSERT_OK(array->Validate());
+  ArrayFromVector<T, std::string>(type, {true, false, false}, {"ab", "", ""}, &expected);
+  AssertArraysEqual(*expected, *array);
+  ASSERT_NE(array->data()->buffers[2], parser->parsed_buffer());
+
+  MakeCSVParser({"ab\n", "\xff\n"}, &parser);
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 0, &array));
+}
+
+TEST(StringConversion, SingleColumn) { TestStringConversionSingleColumn<StringType>(); }
+
+TEST(LargeStringConversion, SingleColumn) {
+  TestStringConversionSingleColumn<LargeStringType>();
+}
+
 template <typename T>
 static void TestStringConversionErrors() {
   auto type = TypeTraits<T>::type_singleton();
@@ -245,6 +282,15 @@ TEST(IntegerConversion, CustomNulls) {
                                      options);
 }
 
+TEST(IntegerConversion, InvalidValuesAsNull) {
+  auto options = ConvertOptions::Defaults();
+  options.invalid_values_as_null = true;
+
+  AssertConversion<Int8Type, int8_t>(int8(), {"12,xxx\n", "1000,-128\n"},
+                                     {{12, 0}, {0, -128}}, {{true, false}, {false, true}},
+                                     options);
+}
+
 TEST(IntegerConversion, Whitespace) {
   AssertConversion<Int32Type, int32_t>(int32(), {" 12,34 \n", " 56 ,78\n"},
                                        {{12, 56}, {34, 78}});
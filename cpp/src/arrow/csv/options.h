@@ -73,6 +73,18 @@ struct ARROW_EXPORT ConvertOptions {
   // If false, then all strings are valid string values.
   bool strings_can_be_null = false;
 
+  // Number of blocks from which the types of columns not in `column_types` are
+  // inferred.  If 0, types are inferred from the whole file, and chunks already
+  // converted are converted again whenever a type needs loosening.  Otherwise the
+  // types are fixed after that many blocks, and the remaining blocks are converted
+  // once to the fixed types.
+  int32_t inference_blocks = 0;
+  // Whether values which cannot be converted to the type of their column are read
+  // as null rather than raising an error.  This applies to the types given in
+  // `column_types` and to the types fixed after `inference_blocks`, not to the
+  // conversions through which types are inferred.
+  bool invalid_values_as_null = false;
+
   // XXX Should we have a separate FilterOptions?
 
   // If non-empty, indicates the names of columns from the CSV file that should
@@ -108,9 +120,30 @@ struct ARROW_EXPORT ReadOptions {
   // If false, column names will be read from the first CSV row after `skip_rows`.
   bool autogenerate_column_names = false;
 
+  // Maximum number of blocks a StreamingReader reads and converts ahead of
+  // the consumer, when use_threads is true.  If 0, use the CPU thread pool
+  // capacity.
+  int32_t blocks_in_flight = 0;
+
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  // Writer options
+
+  // Whether to write a first row of column names
+  bool include_header = true;
+  // Field delimiter
+  char delimiter = ',';
+  // Maximum number of rows formatted at once; also the size of the batches
+  // formatted in parallel when use_threads is true
+  int32_t batch_size = 1 << 14;
+  // Whether to use the global CPU thread pool
+  bool use_threads = true;
+
+  static WriteOptions Defaults();
+};
+
 }  // namespace csv
 }  // namespace arrow
 
@@ -19,11 +19,15 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <utility>
 
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace csv {
@@ -66,6 +70,72 @@ int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
   return skipped_rows;
 }
 
+// Finds the next of a set of up to four special characters, e.g. the
+// delimiter, newlines and the escape character in a non-quoted field, so that
+// runs of ordinary characters can be copied at once rather than going through
+// the parsing state machine one character at a time.
+class SpecialCharFinder {
+ public:
+  SpecialCharFinder(char a, char b, char c, char d)
+#ifdef ARROW_HAVE_SSE2
+      : a_(_mm_set1_epi8(a)),
+        b_(_mm_set1_epi8(b)),
+        c_(_mm_set1_epi8(c)),
+        d_(_mm_set1_epi8(d))
+#endif
+  {
+  }
+
+  // Copy the characters before the first special one, looking only at whole
+  // blocks of kBlockSize characters, and return their number.  The remaining
+  // characters are left to the state machine.  Whole blocks are stored, so
+  // out must have room for as many characters as remain in the data.
+  int64_t CopyOrdinaryRun(const char* data, const char* data_end, uint8_t* out) const {
+#ifdef ARROW_HAVE_SSE2
+    const char* p = data;
+    while (data_end - p >= kBlockSize) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + (p - data)), v);
+      const __m128i special =
+          _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, a_), _mm_cmpeq_epi8(v, b_)),
+                       _mm_or_si128(_mm_cmpeq_epi8(v, c_), _mm_cmpeq_epi8(v, d_)));
+      const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(special));
+      if (mask != 0) {
+        return (p - data) + BitUtil::CountTrailingZeros(mask);
+      }
+      p += kBlockSize;
+    }
+    return p - data;
+#else
+    return 0;
+#endif
+  }
+
+ private:
+  static constexpr int64_t kBlockSize = 16;
+
+#ifdef ARROW_HAVE_SSE2
+  __m128i a_, b_, c_, d_;
+#endif
+};
+
+// The special characters of the non-quoted and quoted parts of fields
+class BlockParser::FieldScanner {
+ public:
+  FieldScanner(const ParseOptions& options, bool escaping)
+      : field_finder(options.delimiter, '\r', '\n',
+                     // Without escaping, the escape character is replaced by
+                     // a duplicate
+                     escaping ? options.escape_char : options.delimiter),
+        quoted_field_finder(options.quote_char,
+                            escaping ? options.escape_char : options.quote_char,
+                            escaping ? options.escape_char : options.quote_char,
+                            escaping ? options.escape_char : options.quote_char) {}
+
+  const SpecialCharFinder field_finder;
+  const SpecialCharFinder quoted_field_finder;
+};
+
 template <bool Quoting, bool Escaping>
 class SpecializedOptions {
  public:
@@ -95,6 +165,18 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  // Push the run of ordinary characters at the start of the data, returning
+  // its length
+  int64_t PushOrdinaryRun(const SpecialCharFinder& finder, const char* data,
+                          const char* data_end) {
+    // Never more is parsed than the data consumed, so the rest of the data
+    // fits in the buffer
+    DCHECK_LE(parsed_size_ + (data_end - data), parsed_capacity_);
+    const int64_t length = finder.CopyOrdinaryRun(data, data_end, parsed_ + parsed_size_);
+    parsed_size_ += length;
+    return length;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -213,8 +295,9 @@ class BlockParser::PresizedValuesWriter {
 };
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                              const char* data, const char* data_end, bool is_final,
+Status BlockParser::ParseLine(const FieldScanner& scanner, ValuesWriter* values_writer,
+                              ParsedWriter* parsed_writer, const char* data,
+                              const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
   char c;
@@ -250,12 +333,16 @@ FieldStart:
   if (SpecializedOptions::quoting && ARROW_PREDICT_FALSE(*data == options_.quote_char)) {
     ++data;
     values_writer->StartField(true /* quoted */);
-    goto InQuotedField;
+    goto InQuotedFieldRun;
   } else {
     values_writer->StartField(false /* quoted */);
-    goto InField;
+    goto InFieldRun;
   }
 
+InFieldRun:
+  // Skip ahead to the next special character of a non-quoted part of a field
+  data += parsed_writer->PushOrdinaryRun(scanner.field_finder, data, data_end);
+
 InField:
   // Inside a non-quoted part of a field
   if (ARROW_PREDICT_FALSE(data == data_end)) {
@@ -288,6 +375,10 @@ InField:
   parsed_writer->PushFieldChar(c);
   goto InField;
 
+InQuotedFieldRun:
+  // Skip ahead to the next special character of a quoted part of a field
+  data += parsed_writer->PushOrdinaryRun(scanner.quoted_field_finder, data, data_end);
+
 InQuotedField:
   // Inside a quoted part of a field
   if (ARROW_PREDICT_FALSE(data == data_end)) {
@@ -313,7 +404,7 @@ InQuotedField:
     }
   }
   parsed_writer->PushFieldChar(c);
-  goto InQuotedField;
+  goto InQuotedFieldRun;
 
 FieldEnd:
   // At the end of a field
@@ -376,16 +467,17 @@ EmptyLine:
 }
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                               const char* data, const char* data_end, bool is_final,
+Status BlockParser::ParseChunk(const FieldScanner& scanner, ValuesWriter* values_writer,
+                               ParsedWriter* parsed_writer, const char* data,
+                               const char* data_end, bool is_final,
                                int32_t rows_in_chunk, const char** out_data,
                                bool* finished_parsing) {
   int32_t num_rows_deadline = num_rows_ + rows_in_chunk;
 
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK(ParseLine<SpecializedOptions>(scanner, values_writer, parsed_writer,
+                                                data, data_end, is_final, &line_end));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -419,6 +511,7 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
   bool finished_parsing = false;
 
   PresizedParsedWriter parsed_writer(pool_, size);
+  const FieldScanner scanner(options_, SpecializedOptions::escaping);
 
   if (num_cols_ == -1) {
     // Can't presize values when the number of columns is not known, first parse
@@ -427,9 +520,9 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
     ResizableValuesWriter values_writer(pool_);
     values_writer.Start(parsed_writer);
 
-    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                 data_end, is_final, rows_in_chunk, &data,
-                                                 &finished_parsing));
+    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+        scanner, &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
+        &data, &finished_parsing));
     if (num_cols_ == -1) {
       return ParseError("Empty CSV file or block: cannot infer number of columns");
     }
@@ -452,9 +545,9 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
     PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
     values_writer.Start(parsed_writer);
 
-    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                 data_end, is_final, rows_in_chunk, &data,
-                                                 &finished_parsing));
+    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+        scanner, &values_writer, &parsed_writer, data, data_end, is_final, rows_in_chunk,
+        &data, &finished_parsing));
   }
 
   parsed_writer.Finish(&parsed_buffer_);
@@ -484,6 +577,9 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
 
 Status BlockParser::DoParse(const char* start, uint32_t size, bool is_final,
                             uint32_t* out_size) {
+  ARROW_TRACE_SPAN(span, "csv", "Parse");
+  ARROW_TRACE_SPAN_BYTES(span, size);
+  ScopedMemoryTag memory_tag("csv.parse");
   if (options_.quoting) {
     if (options_.escaping) {
       return DoParseSpecialized<SpecializedOptions<true, true>>(start, size, is_final,
@@ -81,6 +81,12 @@ class ARROW_EXPORT BlockParser {
   int32_t num_cols() const { return num_cols_; }
   /// \brief Return the total size in bytes of parsed data
   uint32_t num_bytes() const { return parsed_size_; }
+  /// \brief Return the buffer of parsed data
+  ///
+  /// Values are laid out row by row, so that the values of a column are
+  /// contiguous in it only if there is a single column.  The buffer is not
+  /// reused by subsequent calls to Parse(), and can be shared by arrays.
+  const std::shared_ptr<Buffer>& parsed_buffer() const { return parsed_buffer_; }
 
   /// \brief Visit parsed values in a column
   ///
@@ -126,16 +132,19 @@ class ARROW_EXPORT BlockParser {
   Status DoParseSpecialized(const char* data, uint32_t size, bool is_final,
                             uint32_t* out_size);
 
+  class FieldScanner;
+
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-  Status ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data, bool* finished_parsing);
+  Status ParseChunk(const FieldScanner& scanner, ValuesWriter* values_writer,
+                    ParsedWriter* parsed_writer, const char* data, const char* data_end,
+                    bool is_final, int32_t rows_in_chunk, const char** out_data,
+                    bool* finished_parsing);
 
   // Parse a single line from the data pointer
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-  Status ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data);
+  Status ParseLine(const FieldScanner& scanner, ValuesWriter* values_writer,
+                   ParsedWriter* parsed_writer, const char* data, const char* data_end,
+                   bool is_final, const char** out_data);
 
   MemoryPool* pool_;
   const ParseOptions options_;
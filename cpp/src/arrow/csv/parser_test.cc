@@ -590,5 +590,34 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several blocks of characters scanned at once, with
+  // special characters at various offsets in the blocks
+  const std::string a(40, 'a');
+  const std::string b(17, 'b');
+  const std::string c(15, 'c');
+  {
+    auto csv = MakeCSVData({a + "," + b + "\n", c + "," + a + b + "\r\n"});
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a, c}, {b, a + b}});
+  }
+  {
+    auto csv = MakeCSVData({"\"" + a + "\"\"" + b + ",\"," + c + "\n"});
+    BlockParser parser(ParseOptions::Defaults());
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + "\"" + b + ","}, {c}}, {{true}, {false}} /* quoted */);
+  }
+  {
+    auto options = ParseOptions::Defaults();
+    options.escaping = true;
+    auto csv = MakeCSVData({a + "\\," + b + ",\"" + c + "\\\"" + a + "\"\n"});
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    AssertColumnsEq(parser, {{a + "," + b}, {c + "\"" + a}},
+                    {{false}, {true}} /* quoted */);
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
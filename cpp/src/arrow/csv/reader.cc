@@ -19,6 +19,8 @@
 
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -33,6 +35,8 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/io/readahead.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -65,11 +69,10 @@ static constexpr int64_t kDefaultRightPadding = 16;
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class BaseReader {
  public:
-  BaseTableReader(MemoryPool* pool, const ReadOptions& read_options,
-                  const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  BaseReader(MemoryPool* pool, const ReadOptions& read_options,
+             const ParseOptions& parse_options, const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
@@ -126,8 +129,9 @@ class BaseTableReader : public csv::TableReader {
         std::memcpy(new_data, cur_data_, cur_size_);
       } else {
         // Need to allocate bigger block and concatenate trailing + present data
-        RETURN_NOT_OK(
-            AllocateBuffer(pool_, cur_size_ + new_size + rh.right_padding, &new_block));
+        RETURN_NOT_OK(AllocateBuffer(scratch_memory_pool(pool_),
+                                     cur_size_ + new_size + rh.right_padding,
+                                     &new_block));
         std::memcpy(new_block->mutable_data(), cur_data_, cur_size_);
         std::memcpy(new_block->mutable_data() + cur_size_, new_data, new_size);
         std::memset(new_block->mutable_data() + cur_size_ + new_size, 0,
@@ -213,6 +217,7 @@ class BaseTableReader : public csv::TableReader {
       RETURN_NOT_OK(MakeCSVColumnBuilder(col_name, col_index, &builder));
       column_builders_.push_back(builder);
       builder_names_.push_back(col_name);
+      builder_col_indices_.push_back(col_index);
     }
     return Status::OK();
   }
@@ -229,9 +234,10 @@ class BaseTableReader : public csv::TableReader {
     // For each column name in include_columns, build the corresponding ColumnBuilder
     for (const auto& col_name : include_columns) {
       std::shared_ptr<ColumnBuilder> builder;
+      int32_t col_index = -1;
       auto it = col_indices.find(col_name);
       if (it != col_indices.end()) {
-        auto col_index = it->second;
+        col_index = it->second;
         RETURN_NOT_OK(MakeCSVColumnBuilder(col_name, col_index, &builder));
       } else {
         // Column not in the CSV file
@@ -245,6 +251,7 @@ class BaseTableReader : public csv::TableReader {
       }
       column_builders_.push_back(builder);
       builder_names_.push_back(col_name);
+      builder_col_indices_.push_back(col_index);
     }
     return Status::OK();
   }
@@ -324,6 +331,9 @@ class BaseTableReader : public csv::TableReader {
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
   // Names of columns, in same order as column_builders_
   std::vector<std::string> builder_names_;
+  // Indices of columns in the CSV file (-1 if missing), in same order as
+  // column_builders_
+  std::vector<int32_t> builder_col_indices_;
 
   std::shared_ptr<ReadaheadSpooler> readahead_;
   std::shared_ptr<internal::TaskGroup> task_group_;
@@ -344,12 +354,12 @@ class BaseTableReader : public csv::TableReader {
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
-class SerialTableReader : public BaseTableReader {
+class SerialTableReader : public BaseReader, public csv::TableReader {
  public:
   SerialTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                     const ReadOptions& read_options, const ParseOptions& parse_options,
                     const ConvertOptions& convert_options)
-      : BaseTableReader(pool, read_options, parse_options, convert_options) {
+      : BaseReader(pool, read_options, parse_options, convert_options) {
     // Since we're converting serially, no need to readahead more than one block
     int32_t block_queue_size = 1;
     readahead_ = std::make_shared<ReadaheadSpooler>(
@@ -357,7 +367,7 @@ class SerialTableReader : public BaseTableReader {
         kDefaultRightPadding);
   }
 
-  Status Read(std::shared_ptr<Table>* out) {
+  Status Read(std::shared_ptr<Table>* out) override {
     task_group_ = internal::TaskGroup::MakeSerial();
 
     // First block
@@ -408,13 +418,13 @@ class SerialTableReader : public BaseTableReader {
 /////////////////////////////////////////////////////////////////////////
 // Parallel TableReader implementation
 
-class ThreadedTableReader : public BaseTableReader {
+class ThreadedTableReader : public BaseReader, public csv::TableReader {
  public:
   ThreadedTableReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                       ThreadPool* thread_pool, const ReadOptions& read_options,
                       const ParseOptions& parse_options,
                       const ConvertOptions& convert_options)
-      : BaseTableReader(pool, read_options, parse_options, convert_options),
+      : BaseReader(pool, read_options, parse_options, convert_options),
         thread_pool_(thread_pool) {
     // Readahead one block per worker thread
     int32_t block_queue_size = thread_pool->GetCapacity();
@@ -426,12 +436,12 @@ class ThreadedTableReader : public BaseTableReader {
   ~ThreadedTableReader() {
     if (task_group_) {
       // In case of error, make sure all pending tasks are finished before
-      // we start destroying BaseTableReader members
+      // we start destroying BaseReader members
       ARROW_UNUSED(task_group_->Finish());
     }
   }
 
-  Status Read(std::shared_ptr<Table>* out) {
+  Status Read(std::shared_ptr<Table>* out) override {
     task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     Chunker chunker(parse_options_);
@@ -508,6 +518,260 @@ class ThreadedTableReader : public BaseTableReader {
   ThreadPool* thread_pool_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader implementation
+
+class StreamingReaderImpl : public BaseReader, public csv::StreamingReader {
+ public:
+  // If `thread_pool` is null, blocks are parsed and converted serially on
+  // the caller's thread when a batch is requested.
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      ThreadPool* thread_pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options)
+      : BaseReader(pool, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        chunker_(parse_options) {
+    max_blocks_in_flight_ = 1;
+    if (thread_pool_ != nullptr) {
+      max_blocks_in_flight_ = read_options_.blocks_in_flight > 0
+                                  ? read_options_.blocks_in_flight
+                                  : thread_pool_->GetCapacity();
+    }
+    readahead_ = std::make_shared<ReadaheadSpooler>(
+        pool_, input, read_options_.block_size, max_blocks_in_flight_,
+        kDefaultLeftPadding, kDefaultRightPadding);
+  }
+
+  ~StreamingReaderImpl() override {
+    // Make sure no pending task outlives the reader members
+    for (auto& pending : pending_blocks_) {
+      ARROW_UNUSED(pending->status.get());
+    }
+  }
+
+  // Read the header and convert the first rows with type inference.
+  // This determines the schema of all subsequent batches.
+  Status Init() {
+    task_group_ = internal::TaskGroup::MakeSerial();
+
+    RETURN_NOT_OK(ReadFirstBlock());
+    if (eof_) {
+      return Status::Invalid("Empty CSV file");
+    }
+    RETURN_NOT_OK(ProcessHeader());
+
+    std::shared_ptr<BlockParser> parser;
+    RETURN_NOT_OK(ParseNextRowsSerially(&parser));
+    if (parser != nullptr && parser->num_rows() > 0) {
+      RETURN_NOT_OK(ProcessData(parser, cur_block_index_++));
+    }
+    RETURN_NOT_OK(task_group_->Finish());
+
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(MakeTable(&table));
+    schema_ = table->schema();
+    if (table->num_rows() > 0) {
+      std::vector<std::shared_ptr<Array>> columns;
+      for (int i = 0; i < table->num_columns(); ++i) {
+        DCHECK_EQ(table->column(i)->num_chunks(), 1);
+        columns.push_back(table->column(i)->chunk(0));
+      }
+      first_batch_ = RecordBatch::Make(schema_, table->num_rows(), std::move(columns));
+    }
+    // Type inference is over, release the inferring builders
+    column_builders_.clear();
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (first_batch_) {
+      *out = std::move(first_batch_);
+      first_batch_.reset();
+      return Status::OK();
+    }
+    // Loop until we get a non-empty batch (a block might contain only
+    // ignored empty lines)
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      if (thread_pool_ == nullptr) {
+        std::shared_ptr<BlockParser> parser;
+        RETURN_NOT_OK(ParseNextRowsSerially(&parser));
+        if (parser == nullptr) {
+          // End of stream
+          *out = nullptr;
+          return Status::OK();
+        }
+        RETURN_NOT_OK(ConvertBlock(parser, &batch));
+      } else {
+        RETURN_NOT_OK(SpawnBlocks());
+        if (pending_blocks_.empty()) {
+          // End of stream
+          *out = nullptr;
+          return Status::OK();
+        }
+        std::unique_ptr<PendingBlock> pending = std::move(pending_blocks_.front());
+        pending_blocks_.pop_front();
+        RETURN_NOT_OK(pending->status.get());
+        batch = std::move(pending->batch);
+        // Keep the pipeline full while the caller consumes this batch
+        RETURN_NOT_OK(SpawnBlocks());
+      }
+      if (batch != nullptr) {
+        *out = std::move(batch);
+        return Status::OK();
+      }
+    }
+  }
+
+ protected:
+  // A block of rows being parsed and converted on the thread pool
+  struct PendingBlock {
+    std::future<Status> status;
+    std::shared_ptr<RecordBatch> batch;
+  };
+
+  // Parse the next rows from the current block, reading more data if needed.
+  // `*out` is null if there is no data left.
+  Status ParseNextRowsSerially(std::shared_ptr<BlockParser>* out) {
+    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+    auto parser =
+        std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
+    while (!eof_) {
+      uint32_t parsed_size = 0;
+      RETURN_NOT_OK(parser->Parse(reinterpret_cast<const char*>(cur_data_),
+                                  static_cast<uint32_t>(cur_size_), &parsed_size));
+      if (parser->num_rows() > 0) {
+        cur_data_ += parsed_size;
+        cur_size_ -= parsed_size;
+        *out = parser;
+        return Status::OK();
+      }
+      // Need to fetch more data to get at least one row
+      RETURN_NOT_OK(ReadNextBlock());
+    }
+    if (cur_size_ > 0) {
+      // Parse remaining data
+      uint32_t parsed_size = 0;
+      RETURN_NOT_OK(parser->ParseFinal(reinterpret_cast<const char*>(cur_data_),
+                                       static_cast<uint32_t>(cur_size_), &parsed_size));
+      cur_data_ += parsed_size;
+      cur_size_ -= parsed_size;
+      *out = parser;
+      return Status::OK();
+    }
+    *out = nullptr;
+    return Status::OK();
+  }
+
+  // Spawn parsing and conversion of blocks until `max_blocks_in_flight_`
+  // blocks are pending or the input is exhausted
+  Status SpawnBlocks() {
+    while (static_cast<int32_t>(pending_blocks_.size()) < max_blocks_in_flight_) {
+      uint32_t chunk_size = 0;
+      bool is_final = false;
+      while (chunk_size == 0) {
+        if (eof_) {
+          if (cur_size_ == 0) {
+            return Status::OK();
+          }
+          // The remaining data may not end with a line separator
+          chunk_size = static_cast<uint32_t>(cur_size_);
+          is_final = true;
+        } else {
+          RETURN_NOT_OK(chunker_.Process(reinterpret_cast<const char*>(cur_data_),
+                                         static_cast<uint32_t>(cur_size_), &chunk_size));
+          if (chunk_size == 0) {
+            // Need to fetch more data to get at least one row
+            RETURN_NOT_OK(ReadNextBlock());
+          }
+        }
+      }
+
+      std::unique_ptr<PendingBlock> pending(new PendingBlock);
+      PendingBlock* raw_pending = pending.get();
+      const uint8_t* chunk_data = cur_data_;
+      std::shared_ptr<Buffer> chunk_buffer = cur_block_;
+      // "mutable" allows to modify captured by-copy chunk_buffer
+      auto task = [=]() mutable -> Status {
+        static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+        auto parser = std::make_shared<BlockParser>(pool_, parse_options_,
+                                                    num_csv_cols_, max_num_rows);
+        uint32_t parsed_size = 0;
+        if (is_final) {
+          RETURN_NOT_OK(parser->ParseFinal(reinterpret_cast<const char*>(chunk_data),
+                                           chunk_size, &parsed_size));
+        } else {
+          RETURN_NOT_OK(parser->Parse(reinterpret_cast<const char*>(chunk_data),
+                                      chunk_size, &parsed_size));
+        }
+        if (parsed_size != chunk_size) {
+          DCHECK_EQ(parsed_size, chunk_size);
+          return Status::Invalid("Chunker and parser disagree on block size: ",
+                                 chunk_size, " vs ", parsed_size);
+        }
+        // Parsed values are copied, release the chunk buffer early
+        chunk_buffer.reset();
+        return ConvertBlock(parser, &raw_pending->batch);
+      };
+      pending->status = thread_pool_->Submit(std::move(task));
+      pending_blocks_.push_back(std::move(pending));
+
+      cur_data_ += chunk_size;
+      cur_size_ -= chunk_size;
+      cur_block_index_++;
+    }
+    return Status::OK();
+  }
+
+  // Convert a parsed block to a record batch of the inferred schema.
+  // `*out` is null if the block has no rows.
+  Status ConvertBlock(const std::shared_ptr<BlockParser>& parser,
+                      std::shared_ptr<RecordBatch>* out) const {
+    if (parser->num_rows() == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    auto task_group = internal::TaskGroup::MakeSerial();
+    std::vector<std::shared_ptr<ColumnBuilder>> builders;
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      std::shared_ptr<ColumnBuilder> builder;
+      const auto& type = schema_->field(i)->type();
+      const int32_t col_index = builder_col_indices_[i];
+      if (col_index >= 0) {
+        RETURN_NOT_OK(ColumnBuilder::Make(pool_, type, col_index, convert_options_,
+                                          task_group, &builder));
+      } else {
+        RETURN_NOT_OK(ColumnBuilder::MakeNull(pool_, type, task_group, &builder));
+      }
+      builder->Insert(0, parser);
+      builders.push_back(std::move(builder));
+    }
+    RETURN_NOT_OK(task_group->Finish());
+
+    std::vector<std::shared_ptr<Array>> columns;
+    for (const auto& builder : builders) {
+      std::shared_ptr<ChunkedArray> column;
+      RETURN_NOT_OK(builder->Finish(&column));
+      DCHECK_EQ(column->num_chunks(), 1);
+      columns.push_back(column->chunk(0));
+    }
+    *out = RecordBatch::Make(schema_, parser->num_rows(), std::move(columns));
+    return Status::OK();
+  }
+
+  ThreadPool* thread_pool_;
+  Chunker chunker_;
+  int32_t max_blocks_in_flight_;
+  std::shared_ptr<Schema> schema_;
+  // The batch converted with type inference, returned by the first ReadNext call
+  std::shared_ptr<RecordBatch> first_batch_;
+  // Blocks being converted, in stream order
+  std::deque<std::unique_ptr<PendingBlock>> pending_blocks_;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // TableReader factory function
 
@@ -530,5 +794,21 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   }
 }
 
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader factory function
+
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             const ConvertOptions& convert_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto result = std::make_shared<StreamingReaderImpl>(
+      pool, input, thread_pool, read_options, parse_options, convert_options);
+  RETURN_NOT_OK(result->Init());
+  *out = result;
+  return Status::OK();
+}
+
 }  // namespace csv
 }  // namespace arrow
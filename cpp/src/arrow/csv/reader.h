@@ -21,6 +21,7 @@
 #include <memory>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -46,6 +47,27 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A reader that converts a CSV file incrementally
+///
+/// Unlike TableReader, the file is not read entirely in memory: a record batch
+/// is yielded for each block of input data, and at most
+/// ReadOptions::blocks_in_flight blocks are read and converted ahead of the
+/// consumer.
+///
+/// Column types are inferred from the first block only (unless given in
+/// ConvertOptions::column_types).  Data in later blocks that doesn't convert
+/// to those types yields an error.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader.  This reads and converts the first block of
+  /// data, so as to know the schema.
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&, const ConvertOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 }  // namespace csv
 }  // namespace arrow
 
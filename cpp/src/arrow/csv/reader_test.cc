@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+std::shared_ptr<io::InputStream> MakeCSVInput(std::string csv) {
+  return std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+}
+
+// Generate "a,b,c" rows with an integer, a double and a string column
+std::string MakeNumericCSV(int num_rows) {
+  std::string csv = "a,b,c\n";
+  for (int i = 0; i < num_rows; ++i) {
+    csv += std::to_string(i) + "," + std::to_string(i) + ".5,s" + std::to_string(i) +
+           "\n";
+  }
+  return csv;
+}
+
+class TestStreamingReader : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    read_options_ = ReadOptions::Defaults();
+    read_options_.use_threads = GetParam();
+    // Small blocks so as to get several batches
+    read_options_.block_size = 64;
+    parse_options_ = ParseOptions::Defaults();
+    convert_options_ = ConvertOptions::Defaults();
+  }
+
+  Status MakeReader(const std::string& csv, std::shared_ptr<StreamingReader>* out) {
+    return StreamingReader::Make(default_memory_pool(), MakeCSVInput(csv), read_options_,
+                                 parse_options_, convert_options_, out);
+  }
+
+ protected:
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+};
+
+TEST_P(TestStreamingReader, MatchesTableReader) {
+  const auto csv = MakeNumericCSV(100);
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(MakeReader(csv, &reader));
+  auto expected_schema = schema({field("a", int64()), field("b", float64()),
+                                 field("c", utf8())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  ASSERT_GT(batches.size(), 1);
+  int64_t num_rows = 0;
+  for (const auto& batch : batches) {
+    ASSERT_OK(batch->Validate());
+    AssertSchemaEqual(*expected_schema, *batch->schema());
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(100, num_rows);
+
+  // Further reads signal end of stream
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+
+  std::shared_ptr<Table> actual, expected;
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual));
+  std::shared_ptr<TableReader> table_reader;
+  ASSERT_OK(TableReader::Make(default_memory_pool(), MakeCSVInput(csv), read_options_,
+                              parse_options_, convert_options_, &table_reader));
+  ASSERT_OK(table_reader->Read(&expected));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestStreamingReader, BoundedBlocksInFlight) {
+  read_options_.blocks_in_flight = 1;
+  const auto csv = MakeNumericCSV(50);
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(MakeReader(csv, &reader));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_EQ(50, table->num_rows());
+}
+
+TEST_P(TestStreamingReader, NoTrailingNewline) {
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(MakeReader("a,b\n1,x\n2,y", &reader));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_EQ(2, table->num_rows());
+  ChunkedArray expected({ArrayFromJSON(int64(), "[1, 2]")});
+  ASSERT_TRUE(table->column(0)->Equals(expected));
+}
+
+TEST_P(TestStreamingReader, HeaderOnly) {
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(MakeReader("a,b\n", &reader));
+  ASSERT_EQ(2, reader->schema()->num_fields());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(batch, nullptr);
+}
+
+TEST_P(TestStreamingReader, EmptyFile) {
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_RAISES(Invalid, MakeReader("", &reader));
+}
+
+TEST_P(TestStreamingReader, IncludeColumns) {
+  convert_options_.include_columns = {"c", "missing", "a"};
+  convert_options_.include_missing_columns = true;
+  convert_options_.column_types["missing"] = int32();
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(MakeReader(MakeNumericCSV(30), &reader));
+  auto expected_schema = schema({field("c", utf8()), field("missing", int32()),
+                                 field("a", int64())});
+  AssertSchemaEqual(*expected_schema, *reader->schema());
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(reader->ReadAll(&table));
+  ASSERT_EQ(30, table->num_rows());
+  ASSERT_EQ(30, table->column(1)->null_count());
+}
+
+TEST_P(TestStreamingReader, ConversionErrorInLaterBlock) {
+  // Types are inferred on the first block only
+  auto csv = MakeNumericCSV(20) + "xyz,1.0,s\n";
+
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(MakeReader(csv, &reader));
+  ASSERT_EQ(reader->schema()->field(0)->type()->id(), Type::INT64);
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, reader->ReadAll(&table));
+}
+
+INSTANTIATE_TEST_CASE_P(SerialAndThreaded, TestStreamingReader, ::testing::Bool());
+
+}  // namespace csv
+}  // namespace arrow
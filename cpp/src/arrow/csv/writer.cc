@@ -0,0 +1,455 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/csv/writer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/vendored/datetime.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace csv {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::ThreadPool;
+using util::string_view;
+
+namespace {
+
+// Rounding towards negative infinity, for dates and times before the epoch
+int64_t FloorDiv(int64_t value, int64_t divisor) {
+  int64_t quotient = value / divisor;
+  if (value % divisor != 0 && (value < 0) != (divisor < 0)) {
+    --quotient;
+  }
+  return quotient;
+}
+
+inline bool ReadsBack(const char* formatted, float value) {
+  return std::strtof(formatted, nullptr) == value;
+}
+
+inline bool ReadsBack(const char* formatted, double value) {
+  return std::strtod(formatted, nullptr) == value;
+}
+
+// The formatted cells of a column of a batch, one after the other
+struct FormattedColumn {
+  std::string data;
+  // The end of each cell in data
+  std::vector<int64_t> ends;
+};
+
+// Format the values of an array into a FormattedColumn.  The cells are
+// appended to a single string, so that no allocation is made per cell.
+class ColumnFormatter {
+ public:
+  ColumnFormatter(const WriteOptions& options, FormattedColumn* out)
+      : delimiter_(options.delimiter), out_(out) {}
+
+  Status Format(const Array& array) {
+    array_ = &array;
+    out_->data.clear();
+    out_->ends.clear();
+    out_->ends.reserve(static_cast<size_t>(array.length()));
+    return VisitTypeInline(*array.type(), this);
+  }
+
+  // Append a string, quoted if needed
+  void AppendString(string_view value) {
+    std::string& data = out_->data;
+    // Empty strings are quoted to tell them apart from nulls
+    bool needs_quotes = value.empty();
+    for (char c : value) {
+      if (c == delimiter_ || c == '"' || c == '\n' || c == '\r') {
+        needs_quotes = true;
+        break;
+      }
+    }
+    if (!needs_quotes) {
+      data.append(value.data(), value.size());
+      return;
+    }
+    data.push_back('"');
+    size_t run_start = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+      if (value[i] == '"') {
+        // Double the quote
+        data.append(value.data() + run_start, i + 1 - run_start);
+        data.push_back('"');
+        run_start = i + 1;
+      }
+    }
+    data.append(value.data() + run_start, value.size() - run_start);
+    data.push_back('"');
+  }
+
+  Status Visit(const NullType&) {
+    for (int64_t i = 0; i < array_->length(); ++i) {
+      EndCell();
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    const auto& array = checked_cast<const BooleanArray&>(*array_);
+    return VisitValues([&](int64_t i) {
+      if (array.Value(i)) {
+        out_->data.append("true", 4);
+      } else {
+        out_->data.append("false", 5);
+      }
+    });
+  }
+
+  template <typename T>
+  enable_if_signed_integer<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = checked_cast<const ArrayType&>(*array_);
+    return VisitValues([&](int64_t i) { AppendSigned(array.Value(i)); });
+  }
+
+  template <typename T>
+  enable_if_unsigned_integer<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = checked_cast<const ArrayType&>(*array_);
+    return VisitValues([&](int64_t i) { AppendUnsigned(array.Value(i)); });
+  }
+
+  Status Visit(const FloatType&) {
+    const auto& array = checked_cast<const FloatArray&>(*array_);
+    return VisitValues([&](int64_t i) { AppendFloatingPoint(array.Value(i)); });
+  }
+
+  Status Visit(const DoubleType&) {
+    const auto& array = checked_cast<const DoubleArray&>(*array_);
+    return VisitValues([&](int64_t i) { AppendFloatingPoint(array.Value(i)); });
+  }
+
+  template <typename T>
+  enable_if_base_binary<T, Status> Visit(const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    const auto& array = checked_cast<const ArrayType&>(*array_);
+    return VisitValues([&](int64_t i) { AppendString(array.GetView(i)); });
+  }
+
+  Status Visit(const FixedSizeBinaryType&) {
+    const auto& array = checked_cast<const FixedSizeBinaryArray&>(*array_);
+    return VisitValues([&](int64_t i) { AppendString(array.GetView(i)); });
+  }
+
+  Status Visit(const Decimal128Type& type) {
+    const auto& array = checked_cast<const Decimal128Array&>(*array_);
+    return VisitValues([&](int64_t i) {
+      out_->data += Decimal128(array.GetValue(i)).ToString(type.scale());
+    });
+  }
+
+  Status Visit(const Date32Type&) {
+    const auto& array = checked_cast<const Date32Array&>(*array_);
+    return VisitValues([&](int64_t i) { AppendDate(array.Value(i)); });
+  }
+
+  Status Visit(const Date64Type&) {
+    const auto& array = checked_cast<const Date64Array&>(*array_);
+    constexpr int64_t kMillisPerDay = 86400000LL;
+    return VisitValues(
+        [&](int64_t i) { AppendDate(FloorDiv(array.Value(i), kMillisPerDay)); });
+  }
+
+  Status Visit(const TimestampType& type) {
+    const auto& array = checked_cast<const TimestampArray&>(*array_);
+    int64_t units_per_second = 1;
+    int fraction_digits = 0;
+    switch (type.unit()) {
+      case TimeUnit::SECOND:
+        break;
+      case TimeUnit::MILLI:
+        units_per_second = 1000LL;
+        fraction_digits = 3;
+        break;
+      case TimeUnit::MICRO:
+        units_per_second = 1000000LL;
+        fraction_digits = 6;
+        break;
+      case TimeUnit::NANO:
+        units_per_second = 1000000000LL;
+        fraction_digits = 9;
+        break;
+    }
+    return VisitValues([&](int64_t i) {
+      const int64_t value = array.Value(i);
+      const int64_t seconds = FloorDiv(value, units_per_second);
+      const int64_t fraction = value - seconds * units_per_second;
+      const int64_t days = FloorDiv(seconds, 86400);
+      const int64_t second_of_day = seconds - days * 86400;
+
+      AppendDate(days);
+      out_->data.push_back(' ');
+      AppendPadded(static_cast<uint64_t>(second_of_day / 3600), 2);
+      out_->data.push_back(':');
+      AppendPadded(static_cast<uint64_t>(second_of_day / 60 % 60), 2);
+      out_->data.push_back(':');
+      AppendPadded(static_cast<uint64_t>(second_of_day % 60), 2);
+      if (fraction != 0) {
+        out_->data.push_back('.');
+        AppendPadded(static_cast<uint64_t>(fraction), fraction_digits);
+      }
+    });
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Writing CSV of type ", type.ToString());
+  }
+
+ protected:
+  template <typename AppendValue>
+  Status VisitValues(AppendValue&& append_value) {
+    const int64_t length = array_->length();
+    for (int64_t i = 0; i < length; ++i) {
+      if (array_->IsValid(i)) {
+        append_value(i);
+      }
+      EndCell();
+    }
+    return Status::OK();
+  }
+
+  void EndCell() { out_->ends.push_back(static_cast<int64_t>(out_->data.size())); }
+
+  // Append the decimal digits of a value, padded with zeros to min_digits
+  void AppendPadded(uint64_t value, int min_digits) {
+    char buffer[24];
+    char* end = buffer + sizeof(buffer);
+    char* p = end;
+    do {
+      *--p = static_cast<char>('0' + value % 10);
+      value /= 10;
+    } while (value != 0);
+    while (end - p < min_digits) {
+      *--p = '0';
+    }
+    out_->data.append(p, end - p);
+  }
+
+  void AppendUnsigned(uint64_t value) { AppendPadded(value, 1); }
+
+  void AppendSigned(int64_t value) {
+    if (value < 0) {
+      out_->data.push_back('-');
+      // Negate in unsigned arithmetic, which doesn't overflow
+      AppendUnsigned(~static_cast<uint64_t>(value) + 1);
+    } else {
+      AppendUnsigned(static_cast<uint64_t>(value));
+    }
+  }
+
+  template <typename C_TYPE>
+  void AppendFloatingPoint(C_TYPE value) {
+    // Same spellings as those parsed by the reader
+    if (std::isnan(value)) {
+      out_->data.append("nan", 3);
+      return;
+    }
+    if (std::isinf(value)) {
+      out_->data.append(value < 0 ? "-inf" : "inf");
+      return;
+    }
+    // The shortest of the two usual precisions which reads back as the same value
+    char buffer[32];
+    int size = snprintf(buffer, sizeof(buffer), "%.*g",
+                        std::numeric_limits<C_TYPE>::digits10, value);
+    if (!ReadsBack(buffer, value)) {
+      size = snprintf(buffer, sizeof(buffer), "%.*g",
+                      std::numeric_limits<C_TYPE>::max_digits10, value);
+    }
+    out_->data.append(buffer, static_cast<size_t>(size));
+  }
+
+  // Append a number of days since the epoch as YYYY-MM-DD
+  void AppendDate(int64_t days) {
+    namespace date = arrow_vendored::date;
+    const date::year_month_day ymd{date::sys_days{date::days{days}}};
+    const int year = static_cast<int>(ymd.year());
+    if (year < 0) {
+      out_->data.push_back('-');
+    }
+    AppendPadded(static_cast<uint64_t>(std::abs(year)), 4);
+    out_->data.push_back('-');
+    AppendPadded(static_cast<unsigned>(ymd.month()), 2);
+    out_->data.push_back('-');
+    AppendPadded(static_cast<unsigned>(ymd.day()), 2);
+  }
+
+  const char delimiter_;
+  FormattedColumn* out_;
+  const Array* array_ = nullptr;
+};
+
+// Format the rows of a batch, each column being formatted in turn before the
+// cells are interleaved
+Status FormatBatch(const RecordBatch& batch, const WriteOptions& options,
+                   MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  const int num_columns = batch.num_columns();
+  const int64_t num_rows = batch.num_rows();
+  std::vector<FormattedColumn> columns(num_columns);
+  // A delimiter or line separator after each cell
+  int64_t size = num_rows * num_columns;
+  for (int i = 0; i < num_columns; ++i) {
+    ColumnFormatter formatter(options, &columns[i]);
+    RETURN_NOT_OK(formatter.Format(*batch.column(i)));
+    size += static_cast<int64_t>(columns[i].data.size());
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool, size, &buffer));
+  uint8_t* data = buffer->mutable_data();
+  for (int64_t row = 0; row < num_rows; ++row) {
+    for (int i = 0; i < num_columns; ++i) {
+      const auto& column = columns[i];
+      const int64_t start = row == 0 ? 0 : column.ends[row - 1];
+      const int64_t cell_size = column.ends[row] - start;
+      std::memcpy(data, column.data.data() + start, static_cast<size_t>(cell_size));
+      data += cell_size;
+      *data++ = i + 1 < num_columns ? options.delimiter : '\n';
+    }
+  }
+  DCHECK_EQ(data, buffer->mutable_data() + size);
+  *out = std::move(buffer);
+  return Status::OK();
+}
+
+Status WriteHeader(const Schema& schema, const WriteOptions& options,
+                   io::OutputStream* output) {
+  FormattedColumn header;
+  ColumnFormatter formatter(options, &header);
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    if (i > 0) {
+      header.data.push_back(options.delimiter);
+    }
+    formatter.AppendString(schema.field(i)->name());
+  }
+  header.data.push_back('\n');
+  return output->Write(header.data.data(), static_cast<int64_t>(header.data.size()));
+}
+
+Status ValidateOptions(const WriteOptions& options) {
+  if (options.batch_size <= 0) {
+    return Status::Invalid("WriteOptions::batch_size must be positive");
+  }
+  if (options.delimiter == '"' || options.delimiter == '\n' ||
+      options.delimiter == '\r') {
+    return Status::Invalid("Invalid CSV delimiter");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  RETURN_NOT_OK(ValidateOptions(options));
+  if (options.include_header) {
+    RETURN_NOT_OK(WriteHeader(*table.schema(), options, output));
+  }
+
+  using FormatFuture = std::future<Result<std::shared_ptr<Buffer>>>;
+  ThreadPool* thread_pool = options.use_threads ? GetCpuThreadPool() : nullptr;
+  const size_t max_in_flight =
+      thread_pool ? static_cast<size_t>(std::max(thread_pool->GetCapacity(), 1)) : 1;
+  // The batches being formatted, in order
+  std::deque<FormatFuture> in_flight;
+
+  auto write_next = [&]() -> Status {
+    Result<std::shared_ptr<Buffer>> formatted = in_flight.front().get();
+    in_flight.pop_front();
+    RETURN_NOT_OK(formatted.status());
+    const auto& buffer = formatted.ValueOrDie();
+    return output->Write(buffer->data(), buffer->size());
+  };
+
+  TableBatchReader reader(table);
+  reader.set_chunksize(options.batch_size);
+  Status st;
+  while (st.ok()) {
+    std::shared_ptr<RecordBatch> batch;
+    st = reader.ReadNext(&batch);
+    if (!st.ok() || batch == nullptr) {
+      break;
+    }
+    auto task = [batch, options, pool]() -> Result<std::shared_ptr<Buffer>> {
+      std::shared_ptr<Buffer> formatted;
+      RETURN_NOT_OK(FormatBatch(*batch, options, pool, &formatted));
+      return formatted;
+    };
+    in_flight.push_back(thread_pool ? thread_pool->Submit(std::move(task))
+                                    : std::async(std::launch::deferred, task));
+    if (in_flight.size() >= max_in_flight) {
+      st = write_next();
+    }
+  }
+  while (st.ok() && !in_flight.empty()) {
+    st = write_next();
+  }
+  // Wait for the remaining tasks on error, as they use the memory pool
+  for (auto& future : in_flight) {
+    future.wait();
+  }
+  return st;
+}
+
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output) {
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns.push_back(batch.column(i));
+  }
+  auto table = Table::Make(batch.schema(), columns, batch.num_rows());
+  return WriteCSV(*table, options, pool, output);
+}
+
+}  // namespace csv
+}  // namespace arrow
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_WRITER_H
+#define ARROW_CSV_WRITER_H
+
+#include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class RecordBatch;
+class Table;
+
+namespace io {
+class OutputStream;
+}  // namespace io
+
+namespace csv {
+
+/// \brief Write a table as CSV
+///
+/// The table is formatted in batches of WriteOptions::batch_size rows, in
+/// parallel when WriteOptions::use_threads is true, and the batches are
+/// written in order.
+///
+/// Null values are written as empty fields, and empty strings as "" so as to
+/// tell them apart.  Strings are quoted if they contain the delimiter, a quote
+/// or a line separator, and their quotes are doubled.  Timestamps are written
+/// in UTC as "YYYY-MM-DD hh:mm:ss", followed by the fraction of a second if
+/// there is one.
+ARROW_EXPORT
+Status WriteCSV(const Table& table, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+/// \brief Write a record batch as CSV
+ARROW_EXPORT
+Status WriteCSV(const RecordBatch& batch, const WriteOptions& options, MemoryPool* pool,
+                io::OutputStream* output);
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_WRITER_H
@@ -0,0 +1,153 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace csv {
+
+class TestWriteCSV : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    options_ = WriteOptions::Defaults();
+    options_.use_threads = GetParam();
+  }
+
+  std::string Write(const Table& table) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    ARROW_EXPECT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+    ARROW_EXPECT_OK(WriteCSV(table, options_, default_memory_pool(), stream.get()));
+    std::shared_ptr<Buffer> buffer;
+    ARROW_EXPECT_OK(stream->Finish(&buffer));
+    return buffer->ToString();
+  }
+
+ protected:
+  WriteOptions options_;
+};
+
+TEST_P(TestWriteCSV, Basics) {
+  std::shared_ptr<Array> ints, doubles, strings, bools, nulls;
+  ArrayFromVector<Int32Type, int32_t>({true, true, false, true}, {1, -20, 0, 300}, &ints);
+  ArrayFromVector<DoubleType, double>({true, true, true, false}, {0.1, -2.5e30, 3, 0},
+                                      &doubles);
+  ArrayFromVector<StringType, std::string>({true, true, true, false},
+                                           {"a,b", "", "c\"d", ""}, &strings);
+  ArrayFromVector<BooleanType, bool>({true, false, true, true}, &bools);
+  nulls = std::make_shared<NullArray>(4);
+  auto table =
+      Table::Make(schema({field("i", int32()), field("d", float64()),
+                          field("s", utf8()), field("b", boolean()), field("n", null())}),
+                  {ints, doubles, strings, bools, nulls});
+
+  ASSERT_EQ(Write(*table),
+            "i,d,s,b,n\n"
+            "1,0.1,\"a,b\",true,\n"
+            "-20,-2.5e+30,\"\",false,\n"
+            ",3,\"c\"\"d\",true,\n"
+            "300,,,true,\n");
+
+  options_.include_header = false;
+  options_.delimiter = ';';
+  ASSERT_EQ(Write(*table->Slice(0, 1)), "1;0.1;a,b;true;\n");
+}
+
+TEST_P(TestWriteCSV, Temporal) {
+  std::shared_ptr<Array> dates, timestamps;
+  ArrayFromVector<Date32Type, int32_t>(date32(), {0, -1, 18000}, &dates);
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI),
+                                          {0, -1, 1555000000123LL}, &timestamps);
+  auto table = Table::Make(
+      schema({field("d", date32()), field("t", timestamp(TimeUnit::MILLI))}),
+      {dates, timestamps});
+
+  ASSERT_EQ(Write(*table),
+            "d,t\n"
+            "1970-01-01,1970-01-01 00:00:00\n"
+            "1969-12-31,1969-12-31 23:59:59.999\n"
+            "2019-04-14,2019-04-11 16:26:40.123\n");
+}
+
+TEST_P(TestWriteCSV, RoundTrip) {
+  // Several chunks and batches, to check that they are written in order
+  std::vector<std::shared_ptr<Array>> int_chunks, string_chunks;
+  for (int chunk = 0; chunk < 5; ++chunk) {
+    std::vector<int64_t> ints;
+    std::vector<std::string> strings;
+    for (int i = 0; i < 100; ++i) {
+      ints.push_back(chunk * 1000 + i);
+      strings.push_back("s" + std::to_string(i) + (i % 3 == 0 ? "\n," : ""));
+    }
+    std::shared_ptr<Array> array;
+    ArrayFromVector<Int64Type, int64_t>(ints, &array);
+    int_chunks.push_back(array);
+    ArrayFromVector<StringType, std::string>(strings, &array);
+    string_chunks.push_back(array);
+  }
+  auto table_schema = schema({field("i", int64()), field("s", utf8())});
+  auto table = Table::Make(table_schema, {std::make_shared<ChunkedArray>(int_chunks),
+                                          std::make_shared<ChunkedArray>(string_chunks)});
+  options_.batch_size = 30;
+  auto csv = Write(*table);
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.newlines_in_values = true;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(std::move(csv)));
+  std::shared_ptr<TableReader> reader;
+  ASSERT_OK(TableReader::Make(default_memory_pool(), input, ReadOptions::Defaults(),
+                              parse_options, ConvertOptions::Defaults(), &reader));
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(reader->Read(&actual));
+  AssertSchemaEqual(*table_schema, *actual->schema());
+  ASSERT_TRUE(actual->Equals(*table));
+}
+
+TEST_P(TestWriteCSV, Errors) {
+  std::shared_ptr<Array> halves;
+  ArrayFromVector<HalfFloatType, uint16_t>({1}, &halves);
+  auto table = Table::Make(schema({field("h", float16())}), {halves});
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+  ASSERT_RAISES(NotImplemented,
+                WriteCSV(*table, options_, default_memory_pool(), stream.get()));
+
+  options_.delimiter = '"';
+  ASSERT_RAISES(Invalid, WriteCSV(*table, options_, default_memory_pool(), stream.get()));
+}
+
+INSTANTIATE_TEST_CASE_P(TestWriteCSV, TestWriteCSV, ::testing::Values(false, true));
+
+}  // namespace csv
+}  // namespace arrow
@@ -17,9 +17,11 @@
 
 #pragma once
 
+#include "arrow/dataset/cache.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/file_csv.h"
 #include "arrow/dataset/file_feather.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/dataset/writer.h"
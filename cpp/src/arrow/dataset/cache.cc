@@ -0,0 +1,339 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/cache.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/stl.h"
+
+namespace arrow {
+namespace dataset {
+
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+
+namespace {
+
+int64_t ArrayDataSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != NULLPTR) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataSize(*child);
+  }
+  if (data.dictionary != NULLPTR) {
+    size += ArrayDataSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+int64_t BatchesSize(const RecordBatchVector& batches) {
+  int64_t size = 0;
+  for (const auto& batch : batches) {
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      size += ArrayDataSize(*batch->column_data(i));
+    }
+  }
+  return size;
+}
+
+void AppendKeyPart(const std::string& part, std::string* key) {
+  // Length-prefixed, so that the parts cannot run into each other
+  *key += std::to_string(part.size());
+  key->push_back(':');
+  *key += part;
+}
+
+/// \brief Yield the ScanTasks of a vector, which MakeVectorIterator cannot
+/// since it copies its elements
+class ScanTaskVectorIterator : public ScanTaskIterator {
+ public:
+  explicit ScanTaskVectorIterator(std::vector<std::unique_ptr<ScanTask>> tasks)
+      : tasks_(std::move(tasks)) {}
+
+  Status Next(std::unique_ptr<ScanTask>* out) override {
+    if (i_ == tasks_.size()) {
+      *out = NULLPTR;
+    } else {
+      *out = std::move(tasks_[i_++]);
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<ScanTask>> tasks_;
+  size_t i_ = 0;
+};
+
+/// \brief Gather the batches of the ScanTasks of a fragment, to cache them
+/// once every task has been scanned to completion
+class BatchCollector {
+ public:
+  BatchCollector(std::shared_ptr<FragmentCache> cache, std::string key, size_t num_tasks)
+      : cache_(std::move(cache)),
+        key_(std::move(key)),
+        batches_(num_tasks),
+        remaining_(num_tasks) {}
+
+  void Finish(size_t task_index, RecordBatchVector batches) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (failed_ || remaining_ == 0) {
+      return;
+    }
+    batches_[task_index] = std::move(batches);
+    if (--remaining_ == 0) {
+      RecordBatchVector all;
+      for (auto& task_batches : batches_) {
+        all.insert(all.end(), task_batches.begin(), task_batches.end());
+      }
+      batches_.clear();
+      cache_->Put(key_, std::move(all));
+    }
+  }
+
+  void Fail() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    failed_ = true;
+    batches_.clear();
+  }
+
+ private:
+  std::shared_ptr<FragmentCache> cache_;
+  std::string key_;
+
+  std::mutex mutex_;
+  std::vector<RecordBatchVector> batches_;
+  size_t remaining_;
+  bool failed_ = false;
+};
+
+class CollectingBatchIterator : public RecordBatchIterator {
+ public:
+  CollectingBatchIterator(std::unique_ptr<RecordBatchIterator> it,
+                          std::shared_ptr<BatchCollector> collector, size_t task_index)
+      : it_(std::move(it)), collector_(std::move(collector)), task_index_(task_index) {}
+
+  Status Next(std::shared_ptr<RecordBatch>* out) override {
+    Status st = it_->Next(out);
+    if (!st.ok()) {
+      collector_->Fail();
+      return st;
+    }
+    if (*out == NULLPTR) {
+      collector_->Finish(task_index_, std::move(batches_));
+    } else {
+      batches_.push_back(*out);
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<RecordBatchIterator> it_;
+  std::shared_ptr<BatchCollector> collector_;
+  size_t task_index_;
+  RecordBatchVector batches_;
+};
+
+class CollectingScanTask : public ScanTask {
+ public:
+  CollectingScanTask(std::unique_ptr<ScanTask> task,
+                     std::shared_ptr<BatchCollector> collector, size_t task_index)
+      : task_(std::move(task)),
+        collector_(std::move(collector)),
+        task_index_(task_index) {}
+
+  std::unique_ptr<RecordBatchIterator> Scan() override {
+    return internal::make_unique<CollectingBatchIterator>(task_->Scan(), collector_,
+                                                          task_index_);
+  }
+
+ private:
+  std::unique_ptr<ScanTask> task_;
+  std::shared_ptr<BatchCollector> collector_;
+  size_t task_index_;
+};
+
+}  // namespace
+
+Status FragmentCache::GetKey(const DataFragment& fragment, bool* cacheable,
+                             std::string* out) {
+  *cacheable = false;
+  const DataFragment* file_fragment = &fragment;
+  std::string key;
+  if (auto keyed = dynamic_cast<const PartitionKeyDataFragment*>(&fragment)) {
+    // The key is parsed from the path of the file, which is part of the key
+    file_fragment = keyed->fragment().get();
+    key += "+partition_keys";
+  }
+
+  auto file = dynamic_cast<const FileBasedDataFragment*>(file_fragment);
+  if (file == NULLPTR || file->source().type() != FileSource::PATH) {
+    return Status::OK();
+  }
+
+  const auto& source = file->source();
+  fs::FileStats stats;
+  RETURN_NOT_OK(source.filesystem()->GetTargetStats(source.path(), &stats));
+  if (stats.mtime() == fs::kNoTime) {
+    return Status::OK();
+  }
+
+  AppendKeyPart(source.path(), &key);
+  AppendKeyPart(std::to_string(reinterpret_cast<uintptr_t>(source.filesystem())), &key);
+  AppendKeyPart(file->format()->name(), &key);
+  AppendKeyPart(std::to_string(stats.mtime().time_since_epoch().count()), &key);
+  AppendKeyPart(std::to_string(stats.size()), &key);
+
+  auto options = fragment.scan_options();
+  if (options != NULLPTR) {
+    key += "+columns";
+    for (const auto& column : options->projected_columns()) {
+      AppendKeyPart(column, &key);
+    }
+    key += "+filters";
+    if (options->selector() != NULLPTR) {
+      for (const auto& filter : options->selector()->filters) {
+        auto repr = filter->ToString();
+        if (repr.empty()) {
+          return Status::OK();
+        }
+        AppendKeyPart(repr, &key);
+      }
+    }
+  }
+
+  *cacheable = true;
+  *out = std::move(key);
+  return Status::OK();
+}
+
+Status FragmentCache::Scan(const std::shared_ptr<DataFragment>& fragment,
+                           std::shared_ptr<ScanContext> scan_context,
+                           std::unique_ptr<ScanTaskIterator>* out) {
+  bool cacheable;
+  std::string key;
+  RETURN_NOT_OK(GetKey(*fragment, &cacheable, &key));
+  if (!cacheable) {
+    return fragment->Scan(std::move(scan_context), out);
+  }
+
+  RecordBatchVector batches;
+  if (Get(key, &batches)) {
+    std::vector<std::unique_ptr<ScanTask>> cached;
+    cached.push_back(internal::make_unique<SimpleScanTask>(std::move(batches)));
+    *out = internal::make_unique<ScanTaskVectorIterator>(std::move(cached));
+    return Status::OK();
+  }
+
+  // The tasks are gathered first, to know when all of them have completed
+  std::unique_ptr<ScanTaskIterator> tasks;
+  RETURN_NOT_OK(fragment->Scan(std::move(scan_context), &tasks));
+  std::vector<std::unique_ptr<ScanTask>> task_vector;
+  RETURN_NOT_OK(tasks->Visit([&task_vector](std::unique_ptr<ScanTask> task) {
+    task_vector.push_back(std::move(task));
+    return Status::OK();
+  }));
+  if (task_vector.empty()) {
+    Put(key, {});
+    *out = internal::make_unique<EmptyIterator<std::unique_ptr<ScanTask>>>();
+    return Status::OK();
+  }
+
+  auto collector =
+      std::make_shared<BatchCollector>(shared_from_this(), key, task_vector.size());
+  std::vector<std::unique_ptr<ScanTask>> wrapped;
+  for (size_t i = 0; i < task_vector.size(); ++i) {
+    wrapped.push_back(internal::make_unique<CollectingScanTask>(std::move(task_vector[i]),
+                                                                collector, i));
+  }
+
+  *out = internal::make_unique<ScanTaskVectorIterator>(std::move(wrapped));
+  return Status::OK();
+}
+
+bool FragmentCache::Get(const std::string& key, RecordBatchVector* out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    ++misses_;
+    return false;
+  }
+  ++hits_;
+  lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+  *out = it->second.batches;
+  return true;
+}
+
+void FragmentCache::Put(const std::string& key, RecordBatchVector batches) {
+  int64_t size = BatchesSize(batches);
+  if (size > capacity_) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (entries_.find(key) != entries_.end()) {
+    Evict(key);
+  }
+  while (size_ + size > capacity_) {
+    Evict(lru_.back());
+  }
+  lru_.push_front(key);
+  entries_[key] = Entry{std::move(batches), size, lru_.begin()};
+  size_ += size;
+}
+
+void FragmentCache::Evict(const std::string& key) {
+  auto it = entries_.find(key);
+  size_ -= it->second.size;
+  // Erase the entry before the key, which may be the argument
+  auto lru_position = it->second.lru_position;
+  entries_.erase(it);
+  lru_.erase(lru_position);
+}
+
+int64_t FragmentCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_;
+}
+
+int64_t FragmentCache::hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+int64_t FragmentCache::misses() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return misses_;
+}
+
+}  // namespace dataset
+}  // namespace arrow
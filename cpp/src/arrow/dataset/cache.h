@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief An in-memory cache of the RecordBatches scanned from file fragments
+///
+/// Set on a ScanContext, the cache lets scans of the same files with the same
+/// projection and filters skip reading and decoding them. An entry is keyed by
+/// the path and modification time of the file, so a rewritten file is read
+/// again. The cached batches are bounded by a budget of bytes, counted over
+/// their buffers, and the least recently used entries are evicted first.
+///
+/// The cache is safe to use from concurrent scans.
+class ARROW_DS_EXPORT FragmentCache
+    : public std::enable_shared_from_this<FragmentCache> {
+ public:
+  /// \param[in] capacity the budget of bytes of the cached batches
+  explicit FragmentCache(int64_t capacity) : capacity_(capacity) {}
+
+  /// \brief Scan a fragment, from the cache if its batches are cached
+  ///
+  /// Otherwise the ScanTasks of the fragment are returned, and once all of
+  /// them have been scanned to completion their batches are cached. Fragments
+  /// which cannot be keyed, e.g. not read from a file or scanned with a
+  /// filter without representation, are scanned as is.
+  Status Scan(const std::shared_ptr<DataFragment>& fragment,
+              std::shared_ptr<ScanContext> scan_context,
+              std::unique_ptr<ScanTaskIterator>* out);
+
+  /// \brief Look up the batches of a key, returning false if they are not cached
+  bool Get(const std::string& key, std::vector<std::shared_ptr<RecordBatch>>* out);
+
+  /// \brief Cache the batches of a key, evicting the least recently used
+  /// entries to make room. Batches larger than the capacity are not cached.
+  void Put(const std::string& key, std::vector<std::shared_ptr<RecordBatch>> batches);
+
+  /// \brief Compute the key of a fragment. Return false in cacheable if the
+  /// fragment cannot be keyed.
+  static Status GetKey(const DataFragment& fragment, bool* cacheable, std::string* out);
+
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief The bytes of the cached batches
+  int64_t size() const;
+
+  /// \brief The number of scans served from the cache, and of those which
+  /// were not
+  int64_t hits() const;
+  int64_t misses() const;
+
+ private:
+  struct Entry {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    int64_t size;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  void Evict(const std::string& key);
+
+  const int64_t capacity_;
+
+  mutable std::mutex mutex_;
+  int64_t size_ = 0;
+  int64_t hits_ = 0;
+  int64_t misses_ = 0;
+  std::unordered_map<std::string, Entry> entries_;
+  // Keys of the entries, the most recently used first
+  std::list<std::string> lru_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
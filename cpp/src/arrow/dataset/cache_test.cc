@@ -0,0 +1,232 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/cache.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace dataset {
+
+using fs::internal::MockFileSystem;
+using internal::checked_cast;
+
+/// \brief A format yielding a batch of a single row holding the contents of
+/// the file, counting the files it reads
+class ContentsFileFormat : public FileFormat {
+ public:
+  std::string name() const override { return "txt"; }
+
+  bool IsKnownExtension(const std::string& ext) const override { return ext == name(); }
+
+  Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
+                  std::shared_ptr<ScanContext> scan_context,
+                  std::unique_ptr<ScanTaskIterator>* out) const override {
+    ++files_read;
+    std::shared_ptr<io::RandomAccessFile> file;
+    RETURN_NOT_OK(source.Open(&file));
+    int64_t size;
+    RETURN_NOT_OK(file->GetSize(&size));
+    std::shared_ptr<Buffer> contents;
+    RETURN_NOT_OK(file->ReadAt(0, size, &contents));
+
+    StringBuilder builder;
+    RETURN_NOT_OK(builder.Append(contents->ToString()));
+    std::shared_ptr<Array> column;
+    RETURN_NOT_OK(builder.Finish(&column));
+    auto batch = RecordBatch::Make(schema({field("contents", utf8())}), 1, {column});
+
+    std::vector<std::shared_ptr<RecordBatch>> batches{batch};
+    auto fn = [batches](std::shared_ptr<int>) -> std::unique_ptr<ScanTask> {
+      return internal::make_unique<SimpleScanTask>(batches);
+    };
+    std::vector<std::shared_ptr<int>> placeholder{std::make_shared<int>(0)};
+    *out = MakeMapIterator(fn, MakeVectorIterator(std::move(placeholder)));
+    return Status::OK();
+  }
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override;
+
+  mutable std::atomic<int> files_read{0};
+};
+
+class ContentsFragment : public FileBasedDataFragment {
+ public:
+  ContentsFragment(const FileSource& source, std::shared_ptr<FileFormat> format,
+                   std::shared_ptr<ScanOptions> options)
+      : FileBasedDataFragment(source, std::move(format), std::move(options)) {}
+
+  bool splittable() const override { return false; }
+};
+
+Status ContentsFileFormat::MakeFragment(const FileSource& source,
+                                        std::shared_ptr<ScanOptions> opts,
+                                        std::unique_ptr<DataFragment>* out) {
+  auto format = std::make_shared<ContentsFileFormat>();
+  *out = internal::make_unique<ContentsFragment>(source, std::move(format), opts);
+  return Status::OK();
+}
+
+class FilteredScanOptions : public ScanOptions {
+ public:
+  explicit FilteredScanOptions(FilterVector filters) {
+    selector_ = std::make_shared<DataSelector>();
+    selector_->filters = std::move(filters);
+  }
+};
+
+class TestFragmentCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<MockFileSystem>(fs::TimePoint(fs::TimePoint::duration(0)));
+    format_ = std::make_shared<ContentsFileFormat>();
+    ASSERT_OK(WriteFile("a.txt", "alpha"));
+    ASSERT_OK(WriteFile("b.txt", "beta"));
+  }
+
+  Status WriteFile(const std::string& path, const std::string& contents) {
+    std::shared_ptr<io::OutputStream> stream;
+    RETURN_NOT_OK(fs_->OpenOutputStream(path, &stream));
+    RETURN_NOT_OK(stream->Write(contents.data(), static_cast<int64_t>(contents.size())));
+    return stream->Close();
+  }
+
+  std::shared_ptr<DataFragment> MakeFragment(const std::string& path,
+                                             std::shared_ptr<ScanOptions> options) {
+    return std::make_shared<ContentsFragment>(FileSource(path, fs_.get()), format_,
+                                              std::move(options));
+  }
+
+  // Scan through the cache, returning the contents read
+  std::string Scan(FragmentCache* cache, const std::shared_ptr<DataFragment>& fragment) {
+    std::unique_ptr<ScanTaskIterator> tasks;
+    std::string contents;
+    ARROW_EXPECT_OK(cache->Scan(fragment, std::make_shared<ScanContext>(), &tasks));
+    ARROW_EXPECT_OK(tasks->Visit([&contents](std::unique_ptr<ScanTask> task) {
+      return task->Scan()->Visit([&contents](std::shared_ptr<RecordBatch> batch) {
+        contents += checked_cast<const StringArray&>(*batch->column(0)).GetString(0);
+        return Status::OK();
+      });
+    }));
+    return contents;
+  }
+
+ protected:
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<ContentsFileFormat> format_;
+};
+
+TEST_F(TestFragmentCache, CachesScannedBatches) {
+  auto cache = std::make_shared<FragmentCache>(1 << 20);
+  auto fragment = MakeFragment("a.txt", NULLPTR);
+
+  ASSERT_EQ(Scan(cache.get(), fragment), "alpha");
+  ASSERT_EQ(Scan(cache.get(), fragment), "alpha");
+  ASSERT_EQ(format_->files_read, 1);
+  ASSERT_EQ(cache->hits(), 1);
+  ASSERT_EQ(cache->misses(), 1);
+  ASSERT_GT(cache->size(), 0);
+
+  // A rewritten file is read again. The clock of the mock filesystem stands
+  // still, so its size tells it apart.
+  ASSERT_OK(WriteFile("a.txt", "omega!"));
+  ASSERT_EQ(Scan(cache.get(), fragment), "omega!");
+  ASSERT_EQ(format_->files_read, 2);
+}
+
+TEST_F(TestFragmentCache, KeyedByFilters) {
+  auto cache = std::make_shared<FragmentCache>(1 << 20);
+  auto filter = std::make_shared<ComparisonFilter>(
+      "i", ComparisonFilter::LESS, std::make_shared<Int64Scalar>(3));
+  auto other_filter = std::make_shared<ComparisonFilter>(
+      "i", ComparisonFilter::LESS, std::make_shared<Int64Scalar>(4));
+
+  Scan(cache.get(), MakeFragment("a.txt", NULLPTR));
+  Scan(cache.get(), MakeFragment("a.txt", std::make_shared<FilteredScanOptions>(
+                                              FilterVector{filter})));
+  Scan(cache.get(), MakeFragment("a.txt", std::make_shared<FilteredScanOptions>(
+                                              FilterVector{other_filter})));
+  Scan(cache.get(), MakeFragment("a.txt", std::make_shared<FilteredScanOptions>(
+                                              FilterVector{filter})));
+  ASSERT_EQ(format_->files_read, 3);
+
+  // Filters without a representation are not cached
+  auto opaque = std::make_shared<Filter>(Filter::GENERIC);
+  auto options = std::make_shared<FilteredScanOptions>(FilterVector{opaque});
+  Scan(cache.get(), MakeFragment("a.txt", options));
+  Scan(cache.get(), MakeFragment("a.txt", options));
+  ASSERT_EQ(format_->files_read, 5);
+}
+
+TEST_F(TestFragmentCache, EvictsLeastRecentlyUsed) {
+  auto a = MakeFragment("a.txt", NULLPTR);
+  auto b = MakeFragment("b.txt", NULLPTR);
+
+  // Measure the size of one entry
+  auto probe = std::make_shared<FragmentCache>(1 << 20);
+  Scan(probe.get(), a);
+  auto cache = std::make_shared<FragmentCache>(probe->size() + probe->size() / 2 + 1);
+  format_->files_read = 0;
+
+  Scan(cache.get(), a);
+  Scan(cache.get(), a);
+  ASSERT_EQ(format_->files_read, 1);
+  // b evicts a, the cache having only room for one entry
+  Scan(cache.get(), b);
+  Scan(cache.get(), a);
+  ASSERT_EQ(format_->files_read, 3);
+  ASSERT_LE(cache->size(), cache->capacity());
+
+  // Nothing fits in an empty budget
+  auto empty = std::make_shared<FragmentCache>(0);
+  Scan(empty.get(), a);
+  Scan(empty.get(), a);
+  ASSERT_EQ(format_->files_read, 5);
+  ASSERT_EQ(empty->size(), 0);
+}
+
+TEST_F(TestFragmentCache, Scanner) {
+  auto ctx = std::make_shared<ScanContext>();
+  ctx->fragment_cache = std::make_shared<FragmentCache>(1 << 20);
+  auto source = std::make_shared<SimpleDataSource>(
+      DataFragmentVector{MakeFragment("a.txt", NULLPTR), MakeFragment("b.txt", NULLPTR)});
+  SimpleScanner scanner({source}, NULLPTR, ctx);
+
+  for (int i = 0; i < 3; ++i) {
+    std::shared_ptr<Table> table;
+    ASSERT_OK(scanner.ToTable(&table));
+    ASSERT_EQ(table->num_rows(), 2);
+  }
+  ASSERT_EQ(format_->files_read, 2);
+  ASSERT_EQ(ctx->fragment_cache->hits(), 4);
+}
+
+}  // namespace dataset
+}  // namespace arrow
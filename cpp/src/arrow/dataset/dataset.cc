@@ -21,11 +21,19 @@
 #include <utility>
 
 #include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
 #include "arrow/util/stl.h"
 
 namespace arrow {
 namespace dataset {
 
+Status DataFragment::CountRows(std::shared_ptr<ScanContext> scan_context,
+                               int64_t* out) {
+  std::unique_ptr<ScanTaskIterator> tasks;
+  RETURN_NOT_OK(Scan(std::move(scan_context), &tasks));
+  return CountScannedRows(tasks.get(), out);
+}
+
 SimpleDataFragment::SimpleDataFragment(
     std::vector<std::shared_ptr<RecordBatch>> record_batches)
     : record_batches_(std::move(record_batches)) {}
@@ -46,5 +54,27 @@ Status SimpleDataFragment::Scan(std::shared_ptr<ScanContext> scan_context,
   return Status::OK();
 }
 
+Status SimpleDataFragment::CountRows(std::shared_ptr<ScanContext> scan_context,
+                                     int64_t* out) {
+  int64_t num_rows = 0;
+  for (const auto& batch : record_batches_) {
+    num_rows += batch->num_rows();
+  }
+  *out = num_rows;
+  return Status::OK();
+}
+
+Dataset::Dataset(std::shared_ptr<DataSource> source, std::shared_ptr<Schema> schema)
+    : schema_(std::move(schema)), sources_{std::move(source)} {}
+
+Dataset::Dataset(const std::vector<std::shared_ptr<DataSource>>& sources,
+                 std::shared_ptr<Schema> schema)
+    : schema_(std::move(schema)), sources_(sources) {}
+
+ScannerBuilder Dataset::NewScan() const {
+  return ScannerBuilder(std::const_pointer_cast<Dataset>(shared_from_this()),
+                        std::make_shared<ScanContext>());
+}
+
 }  // namespace dataset
 }  // namespace arrow
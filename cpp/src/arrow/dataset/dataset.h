@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -51,6 +52,13 @@ class ARROW_DS_EXPORT DataFragment {
   /// scanned.
   virtual std::shared_ptr<ScanOptions> scan_options() const = 0;
 
+  /// \brief Count the rows which Scan would yield
+  ///
+  /// The default implementation scans the fragment. Fragments which can
+  /// count their rows without reading their data, e.g. from file metadata,
+  /// override it.
+  virtual Status CountRows(std::shared_ptr<ScanContext> scan_context, int64_t* out);
+
   virtual ~DataFragment() = default;
 };
 
@@ -63,6 +71,8 @@ class ARROW_DS_EXPORT SimpleDataFragment : public DataFragment {
   Status Scan(std::shared_ptr<ScanContext> scan_context,
               std::unique_ptr<ScanTaskIterator>* out) override;
 
+  Status CountRows(std::shared_ptr<ScanContext> scan_context, int64_t* out) override;
+
   bool splittable() const override { return false; }
 
   std::shared_ptr<ScanOptions> scan_options() const override { return NULLPTR; }
@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/discovery.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "arrow/dataset/partition.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace dataset {
+
+struct DirectoryWalker::Listing {
+  Status status;
+  std::vector<fs::FileStats> entries;
+};
+
+struct DirectoryWalker::State {
+  std::mutex mutex;
+  std::condition_variable cv;
+  int num_running = 0;
+  std::deque<Listing> completed;
+};
+
+DirectoryWalker::DirectoryWalker(fs::FileSystem* filesystem, std::string base_dir,
+                                 DescendPredicate descend, int max_concurrent_listings)
+    : filesystem_(filesystem),
+      descend_(std::move(descend)),
+      max_concurrent_listings_(max_concurrent_listings > 0
+                                   ? max_concurrent_listings
+                                   : GetIOThreadPoolCapacity()),
+      pending_directories_{std::move(base_dir)},
+      state_(std::make_shared<State>()) {}
+
+DirectoryWalker::~DirectoryWalker() {
+  // The listings in flight use the filesystem
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  state_->cv.wait(lock, [this] { return state_->num_running == 0; });
+}
+
+Status DirectoryWalker::Dispatch() {
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  // The completed listings not yet consumed count as in flight, which bounds
+  // the memory used by a slow consumer
+  while (!pending_directories_.empty() &&
+         state_->num_running + static_cast<int>(state_->completed.size()) <
+             max_concurrent_listings_) {
+    fs::Selector selector;
+    selector.base_dir = std::move(pending_directories_.front());
+    pending_directories_.pop_front();
+
+    ++state_->num_running;
+    auto state = state_;
+    fs::FileSystem* filesystem = filesystem_;
+    Status st = internal::GetIOThreadPool()->Spawn([state, filesystem, selector] {
+      Listing listing;
+      listing.status = filesystem->GetTargetStats(selector, &listing.entries);
+      std::lock_guard<std::mutex> lock(state->mutex);
+      state->completed.push_back(std::move(listing));
+      --state->num_running;
+      state->cv.notify_all();
+    });
+    if (!st.ok()) {
+      --state_->num_running;
+      return st;
+    }
+  }
+  return Status::OK();
+}
+
+Status DirectoryWalker::Next(std::vector<fs::FileStats>* out) {
+  out->clear();
+  RETURN_NOT_OK(status_);
+
+  while (out->empty()) {
+    status_ = Dispatch();
+    RETURN_NOT_OK(status_);
+
+    Listing listing;
+    {
+      std::unique_lock<std::mutex> lock(state_->mutex);
+      state_->cv.wait(lock, [this] {
+        return !state_->completed.empty() || state_->num_running == 0;
+      });
+      if (state_->completed.empty()) {
+        // Nothing in flight and nothing pending
+        return Status::OK();
+      }
+      listing = std::move(state_->completed.front());
+      state_->completed.pop_front();
+    }
+    status_ = listing.status;
+    RETURN_NOT_OK(status_);
+
+    for (auto& entry : listing.entries) {
+      if (entry.type() == fs::FileType::File) {
+        out->push_back(std::move(entry));
+      } else if (entry.type() == fs::FileType::Directory &&
+                 (!descend_ || descend_(entry))) {
+        pending_directories_.push_back(entry.path());
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status DiscoverSource(const std::string& path, fs::FileSystem* filesystem,
+                      const DiscoveryOptions& options, std::shared_ptr<DataSource>* out) {
+  if (options.format == NULLPTR) {
+    return Status::Invalid("A file format is required to discover a source");
+  }
+
+  fs::FileStats stats;
+  RETURN_NOT_OK(filesystem->GetTargetStats(path, &stats));
+  if (stats.type() != fs::FileType::Directory) {
+    return Status::IOError("Cannot discover a source in '", path,
+                           "' which is not a directory");
+  }
+
+  *out = std::make_shared<FileSystemPartition>(path, filesystem, options.format,
+                                               options.partition_scheme, NULLPTR,
+                                               options.max_concurrent_listings);
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
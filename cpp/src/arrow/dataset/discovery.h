@@ -21,11 +21,15 @@
 
 #pragma once
 
+#include <deque>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
@@ -34,9 +38,60 @@ namespace dataset {
 struct ARROW_DS_EXPORT DiscoveryOptions {
   std::shared_ptr<FileFormat> format = NULLPTR;
   std::shared_ptr<PartitionScheme> partition_scheme = NULLPTR;
+
+  /// \brief Maximum number of directories listed concurrently. If 0
+  /// (default), the capacity of the I/O thread pool is used.
+  int max_concurrent_listings = 0;
+};
+
+/// \brief Walk the directories beneath a base directory, listing several of
+/// them concurrently on the I/O thread pool.
+///
+/// Each directory is listed separately, so that the listing of a deep tree of
+/// partition directories on an object store is split into many small requests
+/// which run in parallel. The files are yielded as soon as their directory is
+/// listed, in the order the listings complete.
+class ARROW_DS_EXPORT DirectoryWalker {
+ public:
+  /// \brief Predicate deciding whether to walk a subdirectory, called on the
+  /// thread calling Next()
+  using DescendPredicate = std::function<bool(const fs::FileStats&)>;
+
+  /// \param[in] filesystem the filesystem to walk, which must support
+  /// concurrent listings
+  /// \param[in] base_dir the directory to start from
+  /// \param[in] descend whether to walk a subdirectory, all are walked if
+  /// empty
+  /// \param[in] max_concurrent_listings maximum number of directories listed
+  /// concurrently, 0 for the capacity of the I/O thread pool
+  DirectoryWalker(fs::FileSystem* filesystem, std::string base_dir,
+                  DescendPredicate descend = {}, int max_concurrent_listings = 0);
+
+  /// \brief Wait for the listings in flight
+  ~DirectoryWalker();
+
+  /// \brief Return the files of the next listed directory which has any, or an
+  /// empty vector when the walk is complete
+  Status Next(std::vector<fs::FileStats>* out);
+
+ private:
+  struct Listing;
+  struct State;
+
+  Status Dispatch();
+
+  fs::FileSystem* filesystem_;
+  DescendPredicate descend_;
+  int max_concurrent_listings_;
+  std::deque<std::string> pending_directories_;
+  Status status_;
+  std::shared_ptr<State> state_;
 };
 
-/// \brief Using a root directory
+/// \brief Using a root directory, create a DataSource of the files of the
+/// given format beneath it. The directories are listed when the fragments are
+/// requested, skipping the partition directories which cannot satisfy the
+/// filters of the scan.
 ARROW_DS_EXPORT
 Status DiscoverSource(const std::string& path, fs::FileSystem* filesystem,
                       const DiscoveryOptions& options, std::shared_ptr<DataSource>* out);
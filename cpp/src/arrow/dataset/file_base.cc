@@ -18,11 +18,19 @@
 #include "arrow/dataset/file_base.h"
 
 #include <algorithm>
+#include <cstring>
+#include <unordered_set>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/dataset/file_internal.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
 
 namespace arrow {
@@ -40,11 +48,32 @@ Status FileSource::Open(std::shared_ptr<arrow::io::RandomAccessFile>* out) const
   return Status::OK();
 }
 
+Status FileFormat::CountRows(const FileSource& source,
+                             std::shared_ptr<ScanOptions> scan_options,
+                             std::shared_ptr<ScanContext> scan_context,
+                             int64_t* out) const {
+  std::unique_ptr<ScanTaskIterator> tasks;
+  RETURN_NOT_OK(ScanFile(source, std::move(scan_options), std::move(scan_context),
+                         &tasks));
+  return CountScannedRows(tasks.get(), out);
+}
+
+Status FileFormat::OpenWriter(std::shared_ptr<io::OutputStream> sink,
+                              std::shared_ptr<Schema> schema, MemoryPool* pool,
+                              std::unique_ptr<FileFormatWriter>* out) const {
+  return Status::NotImplemented("Writing files of format ", name());
+}
+
 Status FileBasedDataFragment::Scan(std::shared_ptr<ScanContext> scan_context,
                                    std::unique_ptr<ScanTaskIterator>* out) {
   return format_->ScanFile(source_, scan_options_, scan_context, out);
 }
 
+Status FileBasedDataFragment::CountRows(std::shared_ptr<ScanContext> scan_context,
+                                        int64_t* out) {
+  return format_->CountRows(source_, scan_options_, std::move(scan_context), out);
+}
+
 FileSystemBasedDataSource::FileSystemBasedDataSource(
     fs::FileSystem* filesystem, const fs::Selector& selector,
     std::shared_ptr<FileFormat> format, std::shared_ptr<ScanOptions> scan_options,
@@ -108,5 +137,146 @@ std::unique_ptr<DataFragmentIterator> FileSystemBasedDataSource::GetFragments(
   return internal::make_unique<Impl>(filesystem_, format_, options, stats_);
 }
 
+// Keep room in the blocks for the partial row of the previous block
+static constexpr int64_t kDefaultLeftPadding = 2048;  // 2 kB
+
+ChunkedTextReader::ChunkedTextReader(MemoryPool* pool,
+                                     std::shared_ptr<io::InputStream> input,
+                                     int64_t block_size, ChunkFunction chunk)
+    : pool_(pool),
+      chunk_(std::move(chunk)),
+      readahead_(pool, std::move(input), block_size, /*readahead_queue_size=*/1,
+                 kDefaultLeftPadding) {}
+
+Status ChunkedTextReader::Peek(const uint8_t** data, int64_t* size) {
+  if (!started_) {
+    started_ = true;
+    RETURN_NOT_OK(ReadNextBlock());
+  }
+  *data = cur_data_;
+  *size = cur_size_;
+  return Status::OK();
+}
+
+void ChunkedTextReader::Consume(int64_t nbytes) {
+  DCHECK_LE(nbytes, cur_size_);
+  cur_data_ += nbytes;
+  cur_size_ -= nbytes;
+}
+
+Status ChunkedTextReader::Next(std::shared_ptr<Buffer>* out) {
+  const uint8_t* data;
+  int64_t size;
+  RETURN_NOT_OK(Peek(&data, &size));
+
+  while (true) {
+    int64_t chunk_size = 0;
+    if (eof_) {
+      // The remaining data, whether it ends with a delimiter or not
+      chunk_size = cur_size_;
+      if (chunk_size == 0) {
+        *out = NULLPTR;
+        return Status::OK();
+      }
+    } else if (cur_size_ > 0) {
+      RETURN_NOT_OK(chunk_(cur_data_, cur_size_, &chunk_size));
+    }
+
+    if (chunk_size > 0) {
+      *out = SliceBuffer(cur_block_, cur_data_ - cur_block_->data(), chunk_size);
+      Consume(chunk_size);
+      return Status::OK();
+    }
+    // Need more data to get at least one row
+    RETURN_NOT_OK(ReadNextBlock());
+  }
+}
+
+Status ChunkedTextReader::ReadNextBlock() {
+  if (cur_size_ > 0 && readahead_.GetLeftPadding() < cur_size_) {
+    // Growth heuristic to try and ensure sufficient left padding in
+    // subsequent reads
+    readahead_.SetLeftPadding(cur_size_ * 3 / 2);
+  }
+
+  io::internal::ReadaheadBuffer rh;
+  RETURN_NOT_OK(readahead_.Read(&rh));
+  if (rh.buffer == NULLPTR) {
+    eof_ = true;
+    return Status::OK();
+  }
+
+  std::shared_ptr<ResizableBuffer> new_block = rh.buffer;
+  uint8_t* new_data = new_block->mutable_data() + rh.left_padding;
+  int64_t new_size = new_block->size() - rh.left_padding - rh.right_padding;
+
+  if (cur_size_ > 0) {
+    if (cur_size_ <= rh.left_padding) {
+      // Left-extend the new block inside its padding area
+      new_data -= cur_size_;
+      std::memcpy(new_data, cur_data_, cur_size_);
+    } else {
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, cur_size_ + new_size, &new_block));
+      std::memcpy(new_block->mutable_data(), cur_data_, cur_size_);
+      std::memcpy(new_block->mutable_data() + cur_size_, new_data, new_size);
+      new_data = new_block->mutable_data();
+    }
+    new_size += cur_size_;
+  }
+
+  cur_block_ = std::move(new_block);
+  cur_data_ = new_data;
+  cur_size_ = new_size;
+  return Status::OK();
+}
+
+std::unique_ptr<RecordBatchIterator> ChunkScanTask::Scan() {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Status st = read_(chunk_, &batches);
+  if (!st.ok()) {
+    return internal::make_unique<EmptyIterator<std::shared_ptr<RecordBatch>>>(st);
+  }
+  return MakeVectorIterator(std::move(batches));
+}
+
+Status ChunkScanTaskIterator::Next(std::unique_ptr<ScanTask>* out) {
+  std::shared_ptr<Buffer> chunk;
+  RETURN_NOT_OK(reader_->Next(&chunk));
+  if (chunk == NULLPTR) {
+    out->reset();
+    return Status::OK();
+  }
+  if (statistics_ != NULLPTR) {
+    statistics_->bytes_read += chunk->size();
+  }
+
+  if (read_ == NULLPTR) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    RETURN_NOT_OK(infer_(chunk, &batches, &read_));
+    *out = internal::make_unique<SimpleScanTask>(std::move(batches));
+    return Status::OK();
+  }
+
+  *out = internal::make_unique<ChunkScanTask>(read_, std::move(chunk));
+  return Status::OK();
+}
+
+std::vector<std::string> ProjectedFieldNames(const std::vector<std::string>& field_names,
+                                             const ScanOptions* options) {
+  if (options == NULLPTR || options->projected_columns().empty()) {
+    return field_names;
+  }
+  const auto& projected = options->projected_columns();
+  std::unordered_set<std::string> names(projected.begin(), projected.end());
+
+  std::vector<std::string> out;
+  for (const auto& name : field_names) {
+    if (names.count(name) > 0) {
+      out.push_back(name);
+    }
+  }
+  return out;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -133,10 +133,30 @@ class ARROW_DS_EXPORT FileFormat {
                           std::shared_ptr<ScanContext> scan_context,
                           std::unique_ptr<ScanTaskIterator>* out) const = 0;
 
+  /// \brief Count the rows which ScanFile would yield
+  ///
+  /// The default implementation scans the file. Formats which record row
+  /// counts in their metadata override it.
+  virtual Status CountRows(const FileSource& source,
+                           std::shared_ptr<ScanOptions> scan_options,
+                           std::shared_ptr<ScanContext> scan_context,
+                           int64_t* out) const;
+
   /// \brief Open a fragment
   virtual Status MakeFragment(const FileSource& location,
                               std::shared_ptr<ScanOptions> opts,
                               std::unique_ptr<DataFragment>* out) = 0;
+
+  /// \brief Open a writer of files of this format
+  ///
+  /// The default implementation returns NotImplemented.
+  /// \param[in] sink the stream the file is written to
+  /// \param[in] schema the schema of the written batches
+  /// \param[in] pool memory pool for allocations made while writing
+  /// \param[out] out the writer
+  virtual Status OpenWriter(std::shared_ptr<io::OutputStream> sink,
+                            std::shared_ptr<Schema> schema, MemoryPool* pool,
+                            std::unique_ptr<FileFormatWriter>* out) const;
 };
 
 /// \brief A DataFragment that is stored in a file with a known format
@@ -151,6 +171,8 @@ class ARROW_DS_EXPORT FileBasedDataFragment : public DataFragment {
   Status Scan(std::shared_ptr<ScanContext> scan_context,
               std::unique_ptr<ScanTaskIterator>* out) override;
 
+  Status CountRows(std::shared_ptr<ScanContext> scan_context, int64_t* out) override;
+
   const FileSource& source() const { return source_; }
   std::shared_ptr<FileFormat> format() const { return format_; }
 
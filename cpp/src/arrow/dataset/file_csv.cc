@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/chunker.h"
+#include "arrow/csv/parser.h"
+#include "arrow/csv/reader.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file_internal.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/stl.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace dataset {
+
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+
+// The options for reading the chunks of a file, which hold rows of data only
+struct CsvChunkOptions {
+  MemoryPool* pool;
+  csv::ReadOptions read_options;
+  csv::ParseOptions parse_options;
+  csv::ConvertOptions convert_options;
+  // If true, the file has none of the projected columns. The first column is
+  // read for the row counts
+  bool drop_columns = false;
+
+  Status ReadTable(const std::shared_ptr<Buffer>& chunk,
+                   std::shared_ptr<Table>* out) const {
+    std::shared_ptr<csv::TableReader> reader;
+    RETURN_NOT_OK(csv::TableReader::Make(pool, std::make_shared<io::BufferReader>(chunk),
+                                         read_options, parse_options, convert_options,
+                                         &reader));
+    return reader->Read(out);
+  }
+
+  Status ToBatches(const Table& table, RecordBatchVector* out) const {
+    if (drop_columns) {
+      *out = {RecordBatch::Make(schema({}), table.num_rows(), ArrayVector{})};
+      return Status::OK();
+    }
+    TableBatchReader reader(table);
+    return reader.ReadAll(out);
+  }
+
+  Status Read(const std::shared_ptr<Buffer>& chunk, RecordBatchVector* out) const {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(ReadTable(chunk, &table));
+    return ToBatches(*table, out);
+  }
+};
+
+// Skip the initial rows and the header of the file, so that the chunks hold
+// rows of data only, and set the column names in the read options
+static Status ReadCsvHeader(ChunkedTextReader* reader, CsvChunkOptions* options) {
+  const uint8_t* data;
+  int64_t size;
+  RETURN_NOT_OK(reader->Peek(&data, &size));
+
+  const uint8_t* rows;
+  RETURN_NOT_OK(util::SkipUTF8BOM(data, size, &rows));
+  reader->Consume(rows - data);
+  size -= rows - data;
+  data = rows;
+
+  auto& read_options = options->read_options;
+  if (read_options.skip_rows) {
+    auto num_skipped_rows = csv::SkipRows(data, static_cast<uint32_t>(size),
+                                          read_options.skip_rows, &rows);
+    if (num_skipped_rows < read_options.skip_rows) {
+      return Status::Invalid(
+          "Could not skip initial ", read_options.skip_rows,
+          " rows from CSV file, "
+          "either file is too short or header is larger than block size");
+    }
+    reader->Consume(rows - data);
+    size -= rows - data;
+    data = rows;
+    read_options.skip_rows = 0;
+  }
+
+  if (!read_options.column_names.empty() || size == 0) {
+    return Status::OK();
+  }
+
+  // Parse one row (either to read column names or to know the number of columns)
+  csv::BlockParser parser(options->pool, options->parse_options, -1, 1);
+  uint32_t parsed_size = 0;
+  RETURN_NOT_OK(parser.Parse(reinterpret_cast<const char*>(data),
+                             static_cast<uint32_t>(size), &parsed_size));
+  if (parser.num_rows() != 1) {
+    return Status::Invalid(
+        "Could not read first row from CSV file, either "
+        "file is too short or header is larger than block size");
+  }
+
+  auto& column_names = read_options.column_names;
+  if (read_options.autogenerate_column_names) {
+    for (int32_t i = 0; i < parser.num_cols(); ++i) {
+      column_names.push_back("f" + std::to_string(i));
+    }
+    read_options.autogenerate_column_names = false;
+  } else {
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      column_names.emplace_back(reinterpret_cast<const char*>(data), size);
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitLastRow(visit));
+    reader->Consume(parsed_size);
+  }
+  return Status::OK();
+}
+
+static Status MakeCsvScanTaskIterator(const CsvScanOptions& format_options,
+                                      const ScanOptions* scan_options,
+                                      std::shared_ptr<ScanContext> context,
+                                      std::shared_ptr<io::InputStream> input,
+                                      std::unique_ptr<ScanTaskIterator>* out) {
+  auto options = std::make_shared<CsvChunkOptions>();
+  options->pool = context->pool;
+  options->read_options = format_options.read_options;
+  options->read_options.use_threads = false;
+  options->parse_options = format_options.parse_options;
+  options->convert_options = format_options.convert_options;
+
+  // The chunker holds no state between calls
+  auto chunker = std::make_shared<csv::Chunker>(options->parse_options);
+  auto chunk = [chunker](const uint8_t* data, int64_t size, int64_t* out_size) {
+    uint32_t chunk_size = 0;
+    RETURN_NOT_OK(chunker->Process(reinterpret_cast<const char*>(data),
+                                   static_cast<uint32_t>(size), &chunk_size));
+    *out_size = chunk_size;
+    return Status::OK();
+  };
+  auto reader = internal::make_unique<ChunkedTextReader>(
+      context->pool, std::move(input), options->read_options.block_size, chunk);
+
+  RETURN_NOT_OK(ReadCsvHeader(reader.get(), options.get()));
+
+  const auto& column_names = options->read_options.column_names;
+  if (scan_options != NULLPTR && !scan_options->projected_columns().empty() &&
+      !column_names.empty()) {
+    auto projected = ProjectedFieldNames(column_names, scan_options);
+    if (projected.empty()) {
+      projected.push_back(column_names[0]);
+      options->drop_columns = true;
+    }
+    options->convert_options.include_columns = std::move(projected);
+  }
+
+  // The following chunks are converted to the types of the first one
+  auto infer = [options](const std::shared_ptr<Buffer>& chunk,
+                         RecordBatchVector* batches,
+                         ChunkScanTask::ReadFunction* read) {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(options->ReadTable(chunk, &table));
+
+    auto typed_options = std::make_shared<CsvChunkOptions>(*options);
+    for (const auto& field : table->schema()->fields()) {
+      typed_options->convert_options.column_types[field->name()] = field->type();
+    }
+    *read = [typed_options](const std::shared_ptr<Buffer>& chunk,
+                            RecordBatchVector* out) {
+      return typed_options->Read(chunk, out);
+    };
+    return options->ToBatches(*table, batches);
+  };
+
+  *out = internal::make_unique<ChunkScanTaskIterator>(std::move(reader), infer,
+                                                      context->statistics);
+  return Status::OK();
+}
+
+Status CsvFileFormat::ScanFile(const FileSource& source,
+                               std::shared_ptr<ScanOptions> scan_options,
+                               std::shared_ptr<ScanContext> scan_context,
+                               std::unique_ptr<ScanTaskIterator>* out) const {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+
+  auto csv_options = dynamic_cast<const CsvScanOptions*>(scan_options.get());
+  return MakeCsvScanTaskIterator(csv_options ? *csv_options : CsvScanOptions(),
+                                 scan_options.get(), std::move(scan_context),
+                                 std::move(input), out);
+}
+
+Status CsvFileFormat::MakeFragment(const FileSource& source,
+                                   std::shared_ptr<ScanOptions> opts,
+                                   std::unique_ptr<DataFragment>* out) {
+  *out = internal::make_unique<CsvFragment>(source, opts);
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -36,33 +36,56 @@ class FileSystem;
 
 namespace dataset {
 
+/// \brief Options for scanning CSV files. Files scanned with options of
+/// another format use the defaults.
 class ARROW_DS_EXPORT CsvScanOptions : public FileScanOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "csv"; }
 
- private:
-  csv::ParseOptions parse_options_;
-  csv::ConvertOptions convert_options_;
-  csv::ReadOptions read_options_;
+  csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
+  /// ConvertOptions::include_columns is replaced by the projected columns
+  /// found in each file, if the scan is projected
+  csv::ConvertOptions convert_options = csv::ConvertOptions::Defaults();
+  /// Each ScanTask reads the whole rows of a ReadOptions::block_size block.
+  /// ReadOptions::use_threads is ignored: the ScanTasks are what the scan
+  /// runs in parallel
+  csv::ReadOptions read_options = csv::ReadOptions::Defaults();
 };
 
 class ARROW_DS_EXPORT CsvWriteOptions : public FileWriteOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "csv"; }
 };
 
 /// \brief A FileFormat implementation that reads from CSV files
+///
+/// The files are read sequentially and split into ScanTasks at row
+/// boundaries, each converting a block of rows. As with
+/// csv::StreamingReader, the column types are inferred from the first block
+/// of each file unless given in ConvertOptions::column_types; data in later
+/// blocks which doesn't convert to those types yields an error.
 class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
  public:
-  std::string name() const override;
+  std::string name() const override { return "csv"; }
 
   /// \brief Return true if the given file extension
-  bool IsKnownExtension(const std::string& ext) const override;
+  bool IsKnownExtension(const std::string& ext) const override { return ext == name(); }
 
   /// \brief Open a file for scanning
   Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
                   std::shared_ptr<ScanContext> scan_context,
                   std::unique_ptr<ScanTaskIterator>* out) const override;
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override;
+};
+
+class ARROW_DS_EXPORT CsvFragment : public FileBasedDataFragment {
+ public:
+  CsvFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
+      : FileBasedDataFragment(source, std::make_shared<CsvFileFormat>(), options) {}
+
+  bool splittable() const override { return true; }
 };
 
 }  // namespace dataset
@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestCsvFileFormat : public ::testing::Test {
+ public:
+  TestCsvFileFormat() : ctx_(std::make_shared<ScanContext>()) {}
+
+  std::unique_ptr<FileSource> GetFileSource(std::string csv) {
+    return internal::make_unique<FileSource>(Buffer::FromString(std::move(csv)));
+  }
+
+  // Scan the fragment, returning the number of ScanTasks and the batches
+  int Scan(DataFragment* fragment,
+           std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    std::unique_ptr<ScanTaskIterator> it;
+    ARROW_EXPECT_OK(fragment->Scan(ctx_, &it));
+    int num_tasks = 0;
+    ARROW_EXPECT_OK(it->Visit([&](std::unique_ptr<ScanTask> task) -> Status {
+      ++num_tasks;
+      return task->Scan()->Visit([&](std::shared_ptr<RecordBatch> batch) {
+        batches->push_back(std::move(batch));
+        return Status::OK();
+      });
+    }));
+    return num_tasks;
+  }
+
+ protected:
+  std::shared_ptr<ScanContext> ctx_;
+};
+
+TEST_F(TestCsvFileFormat, ScanChunks) {
+  std::string csv = "i,s\n";
+  for (int i = 0; i < 100; ++i) {
+    csv += std::to_string(i) + ",\"a\nb\"\n";
+  }
+  // Chunks end at row boundaries, not at newlines inside values
+  auto options = std::make_shared<CsvScanOptions>();
+  options->parse_options.newlines_in_values = true;
+  options->read_options.block_size = 64;
+  auto source = GetFileSource(csv);
+  CsvFragment fragment(*source, options);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_GT(Scan(&fragment, &batches), 1);
+
+  auto expected_schema = schema({field("i", int64()), field("s", utf8())});
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*batch->schema(), *expected_schema);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 100);
+  ASSERT_EQ(ctx_->statistics->bytes_read, static_cast<int64_t>(csv.size()) - 4);
+}
+
+TEST_F(TestCsvFileFormat, ScanWithProjection) {
+  auto source = GetFileSource("a,b,c\n1,2,3\n4,5,6\n");
+  auto dataset = std::make_shared<Dataset>(std::vector<std::shared_ptr<DataSource>>{});
+  ScannerBuilder builder(dataset, ctx_);
+  builder.Project({"c", "a", "d"});
+  CsvFragment fragment(*source, builder.Finish()->options());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(&fragment, &batches);
+  ASSERT_EQ(batches.size(), 1);
+  AssertSchemaEqual(*batches[0]->schema(),
+                    *schema({field("a", int64()), field("c", int64())}));
+  ASSERT_EQ(batches[0]->num_rows(), 2);
+
+  // None of the projected columns is in the file, only the rows are counted
+  builder.Project({"d"});
+  CsvFragment missing(*source, builder.Finish()->options());
+  batches.clear();
+  Scan(&missing, &batches);
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_EQ(batches[0]->num_columns(), 0);
+  ASSERT_EQ(batches[0]->num_rows(), 2);
+}
+
+class TestCsvFileSystemBasedDataSource
+    : public FileSystemBasedDataSourceMixin<CsvFileFormat> {
+  std::vector<std::string> file_names() const override {
+    return {"a/b/c.csv", "a/b/c/d.csv", "a/b.csv", "a.csv"};
+  }
+};
+
+TEST_F(TestCsvFileSystemBasedDataSource, NonRecursive) { this->NonRecursive(); }
+
+TEST_F(TestCsvFileSystemBasedDataSource, Recursive) { this->Recursive(); }
+
+TEST_F(TestCsvFileSystemBasedDataSource, DeletedFile) { this->DeletedFile(); }
+
+}  // namespace dataset
+}  // namespace arrow
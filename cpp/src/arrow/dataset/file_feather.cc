@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_feather.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file_internal.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/stl.h"
+
+namespace arrow {
+namespace dataset {
+
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+using ScanTaskPtr = std::unique_ptr<ScanTask>;
+
+// Read a record batch of the file. If drop_columns is true, the file has none
+// of the projected columns, so only the row count of the batch is kept
+static Status ReadFeatherBatch(ipc::RecordBatchFileReader* reader, int i,
+                               bool drop_columns, RecordBatchVector* out) {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(reader->ReadRecordBatch(i, &batch));
+  if (drop_columns) {
+    batch = RecordBatch::Make(schema({}), batch->num_rows(), ArrayVector{});
+  }
+  *out = {std::move(batch)};
+  return Status::OK();
+}
+
+class FeatherScanTask : public ScanTask {
+ public:
+  FeatherScanTask(std::shared_ptr<ipc::RecordBatchFileReader> reader, int batch_index,
+                  bool drop_columns)
+      : reader_(std::move(reader)),
+        batch_index_(batch_index),
+        drop_columns_(drop_columns) {}
+
+  std::unique_ptr<RecordBatchIterator> Scan() override {
+    RecordBatchVector batches;
+    Status st = ReadFeatherBatch(reader_.get(), batch_index_, drop_columns_, &batches);
+    if (!st.ok()) {
+      return internal::make_unique<EmptyIterator<std::shared_ptr<RecordBatch>>>(st);
+    }
+    return MakeVectorIterator(std::move(batches));
+  }
+
+ private:
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  int batch_index_;
+  bool drop_columns_;
+};
+
+class FeatherScanTaskIterator : public ScanTaskIterator {
+ public:
+  static Status Make(const ScanOptions* scan_options,
+                     std::shared_ptr<io::RandomAccessFile> input,
+                     std::unique_ptr<ScanTaskIterator>* out) {
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    RETURN_NOT_OK(ipc::RecordBatchFileReader::Open(input, &reader));
+
+    bool drop_columns = false;
+    auto schema = reader->schema();
+    if (scan_options != NULLPTR && !scan_options->projected_columns().empty() &&
+        schema->num_fields() > 0) {
+      // Reopen the file with the projected fields, to skip the others' buffers
+      auto options = ipc::IpcOptions::Defaults();
+      for (const auto& name : ProjectedFieldNames(schema->field_names(), scan_options)) {
+        options.included_fields.push_back(schema->GetFieldIndex(name));
+      }
+      if (options.included_fields.empty()) {
+        options.included_fields.push_back(0);
+        drop_columns = true;
+      }
+
+      int64_t footer_offset;
+      RETURN_NOT_OK(input->GetSize(&footer_offset));
+      RETURN_NOT_OK(
+          ipc::RecordBatchFileReader::Open(input, footer_offset, options, &reader));
+    }
+
+    out->reset(new FeatherScanTaskIterator(std::move(reader), drop_columns));
+    return Status::OK();
+  }
+
+  Status Next(ScanTaskPtr* out) override {
+    if (batch_index_ == reader_->num_record_batches()) {
+      out->reset();
+      return Status::OK();
+    }
+
+    if (batch_index_ == 0) {
+      // The reader reads the dictionaries of the file along with the first
+      // batch, after which the ScanTasks can read batches concurrently
+      RecordBatchVector batches;
+      RETURN_NOT_OK(ReadFeatherBatch(reader_.get(), batch_index_++, drop_columns_,
+                                     &batches));
+      *out = internal::make_unique<SimpleScanTask>(std::move(batches));
+      return Status::OK();
+    }
+
+    *out = internal::make_unique<FeatherScanTask>(reader_, batch_index_++, drop_columns_);
+    return Status::OK();
+  }
+
+ private:
+  FeatherScanTaskIterator(std::shared_ptr<ipc::RecordBatchFileReader> reader,
+                          bool drop_columns)
+      : reader_(std::move(reader)), drop_columns_(drop_columns) {}
+
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  bool drop_columns_;
+  int batch_index_ = 0;
+};
+
+Status FeatherFileFormat::ScanFile(const FileSource& source,
+                                   std::shared_ptr<ScanOptions> scan_options,
+                                   std::shared_ptr<ScanContext> scan_context,
+                                   std::unique_ptr<ScanTaskIterator>* out) const {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+  return FeatherScanTaskIterator::Make(scan_options.get(), std::move(input), out);
+}
+
+Status FeatherFileFormat::MakeFragment(const FileSource& source,
+                                       std::shared_ptr<ScanOptions> opts,
+                                       std::unique_ptr<DataFragment>* out) {
+  *out = internal::make_unique<FeatherFragment>(source, opts);
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -29,27 +29,43 @@ namespace dataset {
 
 class ARROW_DS_EXPORT FeatherScanOptions : public FileScanOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "feather"; }
 };
 
 class ARROW_DS_EXPORT FeatherWriterOptions : public FileWriteOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "feather"; }
 };
 
 /// \brief A FileFormat implementation that reads from Feather (Arrow
 /// IPC protocol) files
+///
+/// Each record batch of a file is read by its own ScanTask. Only the buffers
+/// of the projected columns are read.
 class ARROW_DS_EXPORT FeatherFileFormat : public FileFormat {
  public:
-  std::string name() const override;
+  std::string name() const override { return "feather"; }
 
   /// \brief Return true if the given file extension
-  bool IsKnownExtension(const std::string& ext) const override;
+  bool IsKnownExtension(const std::string& ext) const override {
+    return ext == name() || ext == "arrow";
+  }
 
   /// \brief Open a file for scanning
   Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
                   std::shared_ptr<ScanContext> scan_context,
                   std::unique_ptr<ScanTaskIterator>* out) const override;
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override;
+};
+
+class ARROW_DS_EXPORT FeatherFragment : public FileBasedDataFragment {
+ public:
+  FeatherFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
+      : FileBasedDataFragment(source, std::make_shared<FeatherFileFormat>(), options) {}
+
+  bool splittable() const override { return true; }
 };
 
 }  // namespace dataset
@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_feather.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestFeatherFileFormat : public ::testing::Test {
+ public:
+  TestFeatherFileFormat() : ctx_(std::make_shared<ScanContext>()) {}
+
+  // A file of num_batches batches, holding the values i and i in column "i"
+  std::unique_ptr<FileSource> GetFileSource(int num_batches) {
+    auto s = schema({field("i", int64()), field("f64", float64())});
+    std::shared_ptr<io::BufferOutputStream> sink;
+    ARROW_EXPECT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &sink));
+    auto writer = ipc::RecordBatchFileWriter::Open(sink.get(), s).ValueOrDie();
+    for (int i = 0; i < num_batches; ++i) {
+      auto value = std::to_string(i);
+      auto batch =
+          RecordBatch::Make(s, 2,
+                            {ArrayFromJSON(int64(), "[" + value + ", " + value + "]"),
+                             ArrayFromJSON(float64(), "[0.5, 1.5]")});
+      ARROW_EXPECT_OK(writer->WriteRecordBatch(*batch));
+    }
+    ARROW_EXPECT_OK(writer->Close());
+
+    std::shared_ptr<Buffer> buffer;
+    ARROW_EXPECT_OK(sink->Finish(&buffer));
+    return internal::make_unique<FileSource>(std::move(buffer));
+  }
+
+  // Scan the fragment, returning the number of ScanTasks and the batches
+  int Scan(DataFragment* fragment, std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    std::unique_ptr<ScanTaskIterator> it;
+    ARROW_EXPECT_OK(fragment->Scan(ctx_, &it));
+    int num_tasks = 0;
+    ARROW_EXPECT_OK(it->Visit([&](std::unique_ptr<ScanTask> task) -> Status {
+      ++num_tasks;
+      return task->Scan()->Visit([&](std::shared_ptr<RecordBatch> batch) {
+        batches->push_back(std::move(batch));
+        return Status::OK();
+      });
+    }));
+    return num_tasks;
+  }
+
+ protected:
+  std::shared_ptr<ScanContext> ctx_;
+};
+
+TEST_F(TestFeatherFileFormat, ScanBatches) {
+  auto source = GetFileSource(4);
+  FeatherFragment fragment(*source, std::make_shared<FeatherScanOptions>());
+
+  // A ScanTask per record batch
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_EQ(Scan(&fragment, &batches), 4);
+  ASSERT_EQ(batches.size(), 4);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_EQ(batches[i]->num_columns(), 2);
+    auto value = std::to_string(i);
+    AssertArraysEqual(*batches[i]->column(0),
+                      *ArrayFromJSON(int64(), "[" + value + ", " + value + "]"));
+  }
+}
+
+TEST_F(TestFeatherFileFormat, ScanWithProjection) {
+  auto source = GetFileSource(2);
+  auto dataset = std::make_shared<Dataset>(std::vector<std::shared_ptr<DataSource>>{});
+  ScannerBuilder builder(dataset, ctx_);
+  builder.Project({"f64", "missing"});
+  FeatherFragment fragment(*source, builder.Finish()->options());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(&fragment, &batches);
+  ASSERT_EQ(batches.size(), 2);
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*batch->schema(), *schema({field("f64", float64())}));
+  }
+
+  // None of the projected columns is in the file, only the rows are counted
+  builder.Project({"missing"});
+  FeatherFragment missing(*source, builder.Finish()->options());
+  batches.clear();
+  Scan(&missing, &batches);
+  ASSERT_EQ(batches.size(), 2);
+  for (const auto& batch : batches) {
+    ASSERT_EQ(batch->num_columns(), 0);
+    ASSERT_EQ(batch->num_rows(), 2);
+  }
+}
+
+class TestFeatherFileSystemBasedDataSource
+    : public FileSystemBasedDataSourceMixin<FeatherFileFormat> {
+  std::vector<std::string> file_names() const override {
+    return {"a/b/c.feather", "a/b/c/d.arrow", "a/b.feather", "a.arrow"};
+  }
+};
+
+TEST_F(TestFeatherFileSystemBasedDataSource, NonRecursive) { this->NonRecursive(); }
+
+TEST_F(TestFeatherFileSystemBasedDataSource, Recursive) { this->Recursive(); }
+
+TEST_F(TestFeatherFileSystemBasedDataSource, DeletedFile) { this->DeletedFile(); }
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/scanner.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/io/readahead.h"
+#include "arrow/status.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class RecordBatch;
+
+namespace dataset {
+
+/// \brief Read a text file in blocks, and carve them into chunks of whole rows
+///
+/// Text formats are scanned with a ScanTask per chunk, so that the chunks are
+/// parsed and converted in parallel while the file is read sequentially.  The
+/// trailing partial row of a block is copied to the beginning of the next one,
+/// so that the chunks are slices of the blocks.
+class ARROW_DS_EXPORT ChunkedTextReader {
+ public:
+  /// \brief Set *out_size to the size of the whole rows at the start of the
+  /// given data, 0 if there are none.  The data always starts with a row.
+  using ChunkFunction =
+      std::function<Status(const uint8_t* data, int64_t size, int64_t* out_size)>;
+
+  ChunkedTextReader(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                    int64_t block_size, ChunkFunction chunk);
+
+  /// \brief View the data which hasn't been carved into chunks yet, reading
+  /// the first block if needed.  The size is 0 at the end of the file.
+  Status Peek(const uint8_t** data, int64_t* size);
+
+  /// \brief Skip data returned by Peek(), such as the header of the file
+  void Consume(int64_t nbytes);
+
+  /// \brief Return the next chunk, or nullptr at the end of the file
+  ///
+  /// The last chunk holds the data following the last delimited row, if any.
+  Status Next(std::shared_ptr<Buffer>* out);
+
+ private:
+  // Read the next block, prefixed with the data not carved yet
+  Status ReadNextBlock();
+
+  MemoryPool* pool_;
+  ChunkFunction chunk_;
+  io::internal::ReadaheadSpooler readahead_;
+  std::shared_ptr<Buffer> cur_block_;
+  const uint8_t* cur_data_ = NULLPTR;
+  int64_t cur_size_ = 0;
+  bool started_ = false;
+  bool eof_ = false;
+};
+
+/// \brief A ScanTask converting a chunk of a text file when it is scanned
+class ARROW_DS_EXPORT ChunkScanTask : public ScanTask {
+ public:
+  using ReadFunction = std::function<Status(
+      const std::shared_ptr<Buffer>& chunk, std::vector<std::shared_ptr<RecordBatch>>*)>;
+
+  ChunkScanTask(ReadFunction read, std::shared_ptr<Buffer> chunk)
+      : read_(std::move(read)), chunk_(std::move(chunk)) {}
+
+  std::unique_ptr<RecordBatchIterator> Scan() override;
+
+ private:
+  ReadFunction read_;
+  std::shared_ptr<Buffer> chunk_;
+};
+
+/// \brief Yield a ChunkScanTask per chunk of a text file
+///
+/// The first chunk is converted right away by the given function, which
+/// returns the function converting the following chunks to the types it has
+/// inferred, so that all the batches of the file have the same schema.
+class ARROW_DS_EXPORT ChunkScanTaskIterator : public ScanTaskIterator {
+ public:
+  using InferFunction =
+      std::function<Status(const std::shared_ptr<Buffer>& chunk,
+                           std::vector<std::shared_ptr<RecordBatch>>* batches,
+                           ChunkScanTask::ReadFunction* read)>;
+
+  ChunkScanTaskIterator(std::unique_ptr<ChunkedTextReader> reader, InferFunction infer,
+                        std::shared_ptr<ScanStatistics> statistics)
+      : reader_(std::move(reader)),
+        infer_(std::move(infer)),
+        statistics_(std::move(statistics)) {}
+
+  Status Next(std::unique_ptr<ScanTask>* out) override;
+
+ private:
+  std::unique_ptr<ChunkedTextReader> reader_;
+  InferFunction infer_;
+  ChunkScanTask::ReadFunction read_;
+  std::shared_ptr<ScanStatistics> statistics_;
+};
+
+/// \brief The field names of a file which the options project, in the order
+/// of the file.  All of them if the options have no projection, none if the
+/// file has none of the projected columns.
+ARROW_DS_EXPORT std::vector<std::string> ProjectedFieldNames(
+    const std::vector<std::string>& field_names, const ScanOptions* options);
+
+}  // namespace dataset
+}  // namespace arrow
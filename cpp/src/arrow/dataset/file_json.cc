@@ -0,0 +1,154 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_json.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file_internal.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/io/memory.h"
+#include "arrow/json/chunker.h"
+#include "arrow/json/reader.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/stl.h"
+
+namespace arrow {
+namespace dataset {
+
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+
+// The options for reading the chunks of a file
+struct JsonChunkOptions {
+  MemoryPool* pool;
+  json::ReadOptions read_options;
+  json::ParseOptions parse_options;
+
+  Status ReadTable(const std::shared_ptr<Buffer>& chunk,
+                   std::shared_ptr<Table>* out) const {
+    // The reader expects the last object to be followed by a newline, which
+    // the end of the file may lack
+    std::shared_ptr<Buffer> input = chunk;
+    if (chunk->size() > 0 && chunk->data()[chunk->size() - 1] != '\n') {
+      RETURN_NOT_OK(
+          ConcatenateBuffers({chunk, std::make_shared<Buffer>("\n")}, pool, &input));
+    }
+
+    std::shared_ptr<json::TableReader> reader;
+    RETURN_NOT_OK(json::TableReader::Make(pool, std::make_shared<io::BufferReader>(input),
+                                          read_options, parse_options, &reader));
+    return reader->Read(out);
+  }
+
+  Status Read(const std::shared_ptr<Buffer>& chunk, RecordBatchVector* out) const {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(ReadTable(chunk, &table));
+    TableBatchReader reader(*table);
+    return reader.ReadAll(out);
+  }
+};
+
+static Status MakeJsonScanTaskIterator(const JsonScanOptions& format_options,
+                                       const ScanOptions* scan_options,
+                                       std::shared_ptr<ScanContext> context,
+                                       std::shared_ptr<io::InputStream> input,
+                                       std::unique_ptr<ScanTaskIterator>* out) {
+  auto options = std::make_shared<JsonChunkOptions>();
+  options->pool = context->pool;
+  options->read_options = format_options.read_options;
+  options->read_options.use_threads = false;
+  options->parse_options = format_options.parse_options;
+
+  if (scan_options != NULLPTR && !scan_options->projected_columns().empty()) {
+    auto& parse_options = options->parse_options;
+    if (parse_options.explicit_schema != NULLPTR) {
+      const auto& explicit_schema = *parse_options.explicit_schema;
+      std::vector<std::shared_ptr<Field>> fields;
+      for (const auto& name :
+           ProjectedFieldNames(explicit_schema.field_names(), scan_options)) {
+        fields.push_back(explicit_schema.GetFieldByName(name));
+      }
+      parse_options.explicit_schema = schema(std::move(fields));
+    }
+    parse_options.include_fields = scan_options->projected_columns();
+  }
+
+  // The chunker holds no state between calls
+  std::shared_ptr<json::Chunker> chunker = json::Chunker::Make(options->parse_options);
+  auto chunk = [chunker](const uint8_t* data, int64_t size, int64_t* out_size) {
+    std::shared_ptr<Buffer> whole, partial;
+    RETURN_NOT_OK(
+        chunker->Process(std::make_shared<Buffer>(data, size), &whole, &partial));
+    *out_size = whole->size();
+    return Status::OK();
+  };
+  auto reader = internal::make_unique<ChunkedTextReader>(
+      context->pool, std::move(input), options->read_options.block_size, chunk);
+
+  // The schema inferred from the first chunk is the explicit schema of the
+  // following ones
+  auto infer = [options](const std::shared_ptr<Buffer>& chunk,
+                         RecordBatchVector* batches,
+                         ChunkScanTask::ReadFunction* read) {
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(options->ReadTable(chunk, &table));
+
+    auto typed_options = std::make_shared<JsonChunkOptions>(*options);
+    typed_options->parse_options.explicit_schema = table->schema();
+    typed_options->parse_options.unexpected_field_behavior =
+        json::UnexpectedFieldBehavior::Ignore;
+    *read = [typed_options](const std::shared_ptr<Buffer>& chunk,
+                            RecordBatchVector* out) {
+      return typed_options->Read(chunk, out);
+    };
+
+    TableBatchReader batch_reader(*table);
+    return batch_reader.ReadAll(batches);
+  };
+
+  *out = internal::make_unique<ChunkScanTaskIterator>(std::move(reader), infer,
+                                                      context->statistics);
+  return Status::OK();
+}
+
+Status JsonFileFormat::ScanFile(const FileSource& source,
+                                std::shared_ptr<ScanOptions> scan_options,
+                                std::shared_ptr<ScanContext> scan_context,
+                                std::unique_ptr<ScanTaskIterator>* out) const {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+
+  auto json_options = dynamic_cast<const JsonScanOptions*>(scan_options.get());
+  return MakeJsonScanTaskIterator(json_options ? *json_options : JsonScanOptions(),
+                                  scan_options.get(), std::move(scan_context),
+                                  std::move(input), out);
+}
+
+Status JsonFileFormat::MakeFragment(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> opts,
+                                    std::unique_ptr<DataFragment>* out) {
+  *out = internal::make_unique<JsonFragment>(source, opts);
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -28,33 +28,58 @@
 namespace arrow {
 namespace dataset {
 
+/// \brief Options for scanning JSON files. Files scanned with options of
+/// another format use the defaults.
 class ARROW_DS_EXPORT JsonScanOptions : public FileScanOptions {
  public:
-  ///
-  std::string file_type() const override;
+  std::string file_type() const override { return "json"; }
 
- private:
-  json::ParseOptions parse_options_;
-  json::ReadOptions read_options_;
+  /// If the scan is projected, the unprojected fields of
+  /// ParseOptions::explicit_schema are dropped and ParseOptions::include_fields
+  /// is replaced by the projected columns
+  json::ParseOptions parse_options = json::ParseOptions::Defaults();
+  /// Each ScanTask reads the whole objects of a ReadOptions::block_size block.
+  /// ReadOptions::use_threads is ignored: the ScanTasks are what the scan
+  /// runs in parallel
+  json::ReadOptions read_options = json::ReadOptions::Defaults();
 };
 
 class ARROW_DS_EXPORT JsonWriteOptions : public FileWriteOptions {
  public:
-  std::string file_type() const override;
+  std::string file_type() const override { return "json"; }
 };
 
-/// \brief A FileFormat implementation that reads from JSON files
+/// \brief A FileFormat implementation that reads from line-delimited JSON files
+///
+/// The files are read sequentially and split into ScanTasks between objects,
+/// each converting a block of objects. The schema is inferred from the first
+/// block of each file, as the explicit schema of the following ones: their
+/// fields missing from it are ignored, and their values which don't convert
+/// to its types yield an error.
 class ARROW_DS_EXPORT JsonFileFormat : public FileFormat {
  public:
-  std::string name() const override;
+  std::string name() const override { return "json"; }
 
   /// \brief Return true if the given file extension
-  bool IsKnownExtension(const std::string& ext) const override;
+  bool IsKnownExtension(const std::string& ext) const override {
+    return ext == name() || ext == "jsonl" || ext == "ndjson";
+  }
 
   /// \brief Open a file for scanning
   Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
                   std::shared_ptr<ScanContext> scan_context,
                   std::unique_ptr<ScanTaskIterator>* out) const override;
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override;
+};
+
+class ARROW_DS_EXPORT JsonFragment : public FileBasedDataFragment {
+ public:
+  JsonFragment(const FileSource& source, std::shared_ptr<ScanOptions> options)
+      : FileBasedDataFragment(source, std::make_shared<JsonFileFormat>(), options) {}
+
+  bool splittable() const override { return true; }
 };
 
 }  // namespace dataset
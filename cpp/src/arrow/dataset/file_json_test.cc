@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_json.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace dataset {
+
+class TestJsonFileFormat : public ::testing::Test {
+ public:
+  TestJsonFileFormat() : ctx_(std::make_shared<ScanContext>()) {}
+
+  std::unique_ptr<FileSource> GetFileSource(std::string json) {
+    return internal::make_unique<FileSource>(Buffer::FromString(std::move(json)));
+  }
+
+  // Scan the fragment, returning the number of ScanTasks and the batches
+  int Scan(DataFragment* fragment, std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    std::unique_ptr<ScanTaskIterator> it;
+    ARROW_EXPECT_OK(fragment->Scan(ctx_, &it));
+    int num_tasks = 0;
+    ARROW_EXPECT_OK(it->Visit([&](std::unique_ptr<ScanTask> task) -> Status {
+      ++num_tasks;
+      return task->Scan()->Visit([&](std::shared_ptr<RecordBatch> batch) {
+        batches->push_back(std::move(batch));
+        return Status::OK();
+      });
+    }));
+    return num_tasks;
+  }
+
+ protected:
+  std::shared_ptr<ScanContext> ctx_;
+};
+
+TEST_F(TestJsonFileFormat, ScanChunks) {
+  // The last object isn't followed by a newline
+  std::string json;
+  for (int i = 0; i < 100; ++i) {
+    json += (i > 0 ? "\n" : "") + std::string("{\"i\": ") + std::to_string(i) +
+            ", \"s\": \"abc\"}";
+  }
+  auto options = std::make_shared<JsonScanOptions>();
+  options->read_options.block_size = 64;
+  auto source = GetFileSource(json);
+  JsonFragment fragment(*source, options);
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_GT(Scan(&fragment, &batches), 1);
+
+  auto expected_schema = schema({field("i", int64()), field("s", utf8())});
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    AssertSchemaEqual(*batch->schema(), *expected_schema);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 100);
+  ASSERT_EQ(ctx_->statistics->bytes_read, static_cast<int64_t>(json.size()));
+}
+
+TEST_F(TestJsonFileFormat, ScanWithProjection) {
+  auto source = GetFileSource("{\"a\": 1, \"b\": 2}\n{\"a\": 3, \"b\": 4}\n");
+  auto dataset = std::make_shared<Dataset>(std::vector<std::shared_ptr<DataSource>>{});
+  ScannerBuilder builder(dataset, ctx_);
+  builder.Project({"b", "c"});
+  JsonFragment fragment(*source, builder.Finish()->options());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  Scan(&fragment, &batches);
+  ASSERT_EQ(batches.size(), 1);
+  AssertSchemaEqual(*batches[0]->schema(), *schema({field("b", int64())}));
+  ASSERT_EQ(batches[0]->num_rows(), 2);
+}
+
+class TestJsonFileSystemBasedDataSource
+    : public FileSystemBasedDataSourceMixin<JsonFileFormat> {
+  std::vector<std::string> file_names() const override {
+    return {"a/b/c.json", "a/b/c/d.ndjson", "a/b.jsonl", "a.json"};
+  }
+};
+
+TEST_F(TestJsonFileSystemBasedDataSource, NonRecursive) { this->NonRecursive(); }
+
+TEST_F(TestJsonFileSystemBasedDataSource, Recursive) { this->Recursive(); }
+
+TEST_F(TestJsonFileSystemBasedDataSource, DeletedFile) { this->DeletedFile(); }
+
+}  // namespace dataset
+}  // namespace arrow
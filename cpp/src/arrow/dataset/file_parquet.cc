@@ -17,19 +17,36 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <string>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "arrow/util/stl.h"
 #include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/exception.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
+
 using ScanTaskPtr = std::unique_ptr<ScanTask>;
 using ParquetFileReaderPtr = std::unique_ptr<parquet::ParquetFileReader>;
 using RecordBatchReaderPtr = std::unique_ptr<RecordBatchReader>;
@@ -83,18 +100,21 @@ constexpr int64_t kDefaultRowCountPerPartition = 1U << 16;
 class ParquetRowGroupPartitioner {
  public:
   ParquetRowGroupPartitioner(std::shared_ptr<parquet::FileMetaData> metadata,
+                             RowGroupSet row_groups,
                              int64_t row_count = kDefaultRowCountPerPartition)
-      : metadata_(std::move(metadata)), row_count_(row_count), row_group_idx_(0) {
-    num_row_groups_ = metadata_->num_row_groups();
-  }
+      : metadata_(std::move(metadata)),
+        row_groups_(std::move(row_groups)),
+        row_count_(row_count),
+        row_group_idx_(0) {}
 
   RowGroupSet Next() {
     int64_t partition_size = 0;
     RowGroupSet partition;
 
-    while (row_group_idx_ < num_row_groups_ && partition_size < row_count_) {
-      partition_size += metadata_->RowGroup(row_group_idx_)->num_rows();
-      partition.push_back(row_group_idx_++);
+    while (row_group_idx_ < row_groups_.size() && partition_size < row_count_) {
+      int row_group = row_groups_[row_group_idx_++];
+      partition_size += metadata_->RowGroup(row_group)->num_rows();
+      partition.push_back(row_group);
     }
 
     return partition;
@@ -102,11 +122,127 @@ class ParquetRowGroupPartitioner {
 
  private:
   std::shared_ptr<parquet::FileMetaData> metadata_;
+  // The RowGroups to read, in file order
+  RowGroupSet row_groups_;
   int64_t row_count_;
-  int row_group_idx_;
-  int num_row_groups_;
+  size_t row_group_idx_;
 };
 
+// Convert the bounds of the statistics of a column chunk to Scalars which the
+// filters can compare, return false if the bounds are unknown or ordered in a
+// way the filters do not compare values
+bool GetStatisticsRange(const parquet::ColumnDescriptor& descr,
+                        const parquet::Statistics& statistics,
+                        std::shared_ptr<Scalar>* min, std::shared_ptr<Scalar>* max) {
+  if (!statistics.HasMinMax()) {
+    return false;
+  }
+
+  const auto& logical_type = descr.logical_type();
+  bool annotated = logical_type != NULLPTR && !logical_type->is_none();
+  switch (descr.physical_type()) {
+    case parquet::Type::INT32: {
+      if ((annotated && !logical_type->is_int()) ||
+          descr.sort_order() != parquet::SortOrder::SIGNED) {
+        return false;
+      }
+      const auto& typed = checked_cast<const parquet::Int32Statistics&>(statistics);
+      *min = std::make_shared<Int64Scalar>(typed.min());
+      *max = std::make_shared<Int64Scalar>(typed.max());
+      return true;
+    }
+    case parquet::Type::INT64: {
+      if ((annotated && !logical_type->is_int()) ||
+          descr.sort_order() != parquet::SortOrder::SIGNED) {
+        return false;
+      }
+      const auto& typed = checked_cast<const parquet::Int64Statistics&>(statistics);
+      *min = std::make_shared<Int64Scalar>(typed.min());
+      *max = std::make_shared<Int64Scalar>(typed.max());
+      return true;
+    }
+    case parquet::Type::FLOAT: {
+      if (annotated) {
+        return false;
+      }
+      const auto& typed = checked_cast<const parquet::FloatStatistics&>(statistics);
+      *min = std::make_shared<DoubleScalar>(typed.min());
+      *max = std::make_shared<DoubleScalar>(typed.max());
+      return true;
+    }
+    case parquet::Type::DOUBLE: {
+      if (annotated) {
+        return false;
+      }
+      const auto& typed = checked_cast<const parquet::DoubleStatistics&>(statistics);
+      *min = std::make_shared<DoubleScalar>(typed.min());
+      *max = std::make_shared<DoubleScalar>(typed.max());
+      return true;
+    }
+    case parquet::Type::BYTE_ARRAY: {
+      // Strings are compared bytewise
+      if (!annotated || !logical_type->is_string() ||
+          descr.sort_order() != parquet::SortOrder::UNSIGNED) {
+        return false;
+      }
+      const auto& typed = checked_cast<const parquet::ByteArrayStatistics&>(statistics);
+      auto to_scalar = [](const parquet::ByteArray& value) {
+        std::string str(reinterpret_cast<const char*>(value.ptr), value.len);
+        return std::make_shared<StringScalar>(Buffer::FromString(std::move(str)));
+      };
+      *min = to_scalar(typed.min());
+      *max = to_scalar(typed.max());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+// Return false if the statistics of a top-level column of the RowGroup show
+// that none of its rows can satisfy one of the filters
+bool RowGroupMayMatch(const parquet::RowGroupMetaData& row_group,
+                      const FilterVector& filters) {
+  const parquet::SchemaDescriptor* schema = row_group.schema();
+  for (int i = 0; i < row_group.num_columns(); ++i) {
+    const parquet::ColumnDescriptor* descr = schema->Column(i);
+    if (schema->GetColumnRoot(i) != descr->schema_node().get()) {
+      // Nested columns are not compared
+      continue;
+    }
+
+    auto column = row_group.ColumnChunk(i);
+    std::shared_ptr<Scalar> min, max;
+    if (!column->is_stats_set() ||
+        !GetStatisticsRange(*descr, *column->statistics(), &min, &max)) {
+      continue;
+    }
+    for (const auto& filter : filters) {
+      if (filter != NULLPTR && !filter->MayMatchRange(descr->name(), *min, *max)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Select the RowGroups which the statistics do not exclude
+RowGroupSet SelectRowGroups(const parquet::FileMetaData& metadata,
+                            const std::shared_ptr<ScanOptions>& options) {
+  if (options == NULLPTR || options->selector() == NULLPTR ||
+      options->selector()->filters.empty()) {
+    return internal::Iota(metadata.num_row_groups());
+  }
+
+  RowGroupSet row_groups;
+  for (int i = 0; i < metadata.num_row_groups(); ++i) {
+    if (RowGroupMayMatch(*metadata.RowGroup(i), options->selector()->filters)) {
+      row_groups.push_back(i);
+    }
+  }
+  return row_groups;
+}
+
 class ParquetScanTaskIterator : public ScanTaskIterator {
  public:
   static Status Make(std::shared_ptr<ScanOptions> options,
@@ -117,12 +253,17 @@ class ParquetScanTaskIterator : public ScanTaskIterator {
     std::vector<int> columns_projection;
     RETURN_NOT_OK(InferColumnProjection(*metadata, options, &columns_projection));
 
+    RowGroupSet row_groups = SelectRowGroups(*metadata, options);
+    if (context->statistics != NULLPTR) {
+      AccountBytes(*metadata, columns_projection, row_groups, context->statistics.get());
+    }
+
     std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
     RETURN_NOT_OK(parquet::arrow::FileReader::Make(context->pool, std::move(reader),
                                                    &arrow_reader));
 
-    out->reset(new ParquetScanTaskIterator(columns_projection, metadata,
-                                           std::move(arrow_reader)));
+    out->reset(new ParquetScanTaskIterator(columns_projection, std::move(row_groups),
+                                           metadata, std::move(arrow_reader)));
 
     return Status::OK();
   }
@@ -141,21 +282,66 @@ class ParquetScanTaskIterator : public ScanTaskIterator {
   }
 
  private:
-  // Compute the column projection out of an optional arrow::Schema
+  // Compute the column projection out of the projected column names, the
+  // leaves of a nested column are selected by the name of its top-level field
   static Status InferColumnProjection(const parquet::FileMetaData& metadata,
                                       const std::shared_ptr<ScanOptions>& options,
                                       std::vector<int>* out) {
-    // TODO(fsaintjacques): Compute intersection _and_ validity
-    *out = internal::Iota(metadata.num_columns());
+    if (options == NULLPTR || options->projected_columns().empty()) {
+      *out = internal::Iota(metadata.num_columns());
+      return Status::OK();
+    }
+
+    // TODO(fsaintjacques): Compute validity, columns missing from this file
+    // are skipped for now
+    const auto& projected = options->projected_columns();
+    std::unordered_set<std::string> names(projected.begin(), projected.end());
+    const parquet::SchemaDescriptor* schema = metadata.schema();
+    out->clear();
+    for (int i = 0; i < metadata.num_columns(); ++i) {
+      if (names.count(schema->GetColumnRoot(i)->name()) > 0) {
+        out->push_back(i);
+      }
+    }
 
     return Status::OK();
   }
 
-  ParquetScanTaskIterator(std::vector<int> columns_projection,
+  // Add the sizes of the selected and skipped column chunks to the statistics
+  // of the scan
+  static void AccountBytes(const parquet::FileMetaData& metadata,
+                           const std::vector<int>& columns_projection,
+                           const RowGroupSet& row_groups, ScanStatistics* statistics) {
+    std::vector<bool> column_selected(metadata.num_columns(), false);
+    for (int column : columns_projection) {
+      column_selected[column] = true;
+    }
+    std::vector<bool> row_group_selected(metadata.num_row_groups(), false);
+    for (int row_group : row_groups) {
+      row_group_selected[row_group] = true;
+    }
+
+    int64_t bytes_read = 0, bytes_skipped = 0;
+    for (int i = 0; i < metadata.num_row_groups(); ++i) {
+      auto row_group = metadata.RowGroup(i);
+      for (int j = 0; j < metadata.num_columns(); ++j) {
+        int64_t size = row_group->ColumnChunk(j)->total_compressed_size();
+        if (row_group_selected[i] && column_selected[j]) {
+          bytes_read += size;
+        } else {
+          bytes_skipped += size;
+        }
+      }
+    }
+    statistics->bytes_read += bytes_read;
+    statistics->bytes_skipped += bytes_skipped;
+  }
+
+  ParquetScanTaskIterator(std::vector<int> columns_projection, RowGroupSet row_groups,
                           std::shared_ptr<parquet::FileMetaData> metadata,
                           std::unique_ptr<parquet::arrow::FileReader> reader)
       : columns_projection_(columns_projection),
-        partitionner_(std::move(metadata)),
+        partitionner_(std::move(metadata), std::move(row_groups)),
         reader_(std::move(reader)) {}
 
   std::vector<int> columns_projection_;
@@ -175,6 +361,29 @@ Status ParquetFileFormat::ScanFile(const FileSource& source,
                                        out);
 }
 
+Status ParquetFileFormat::CountRows(const FileSource& source,
+                                    std::shared_ptr<ScanOptions> scan_options,
+                                    std::shared_ptr<ScanContext> scan_context,
+                                    int64_t* out) const {
+  std::shared_ptr<io::RandomAccessFile> input;
+  RETURN_NOT_OK(source.Open(&input));
+
+  // Only the footer is read: ScanFile yields every row of the RowGroups which
+  // the filters select
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  try {
+    metadata = parquet::ReadMetaData(input);
+  } catch (const parquet::ParquetException& e) {
+    return Status::IOError(e.what());
+  }
+  int64_t num_rows = 0;
+  for (int row_group : SelectRowGroups(*metadata, scan_options)) {
+    num_rows += metadata->RowGroup(row_group)->num_rows();
+  }
+  *out = num_rows;
+  return Status::OK();
+}
+
 Status ParquetFileFormat::MakeFragment(const FileSource& source,
                                        std::shared_ptr<ScanOptions> opts,
                                        std::unique_ptr<DataFragment>* out) {
@@ -183,5 +392,35 @@ Status ParquetFileFormat::MakeFragment(const FileSource& source,
   return Status::OK();
 }
 
+class ParquetFormatWriter : public FileFormatWriter {
+ public:
+  explicit ParquetFormatWriter(std::unique_ptr<parquet::arrow::FileWriter> writer)
+      : writer_(std::move(writer)) {}
+
+  Status Write(const RecordBatch& batch) override {
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      columns.push_back(batch.column(i));
+    }
+    auto table = Table::Make(batch.schema(), columns, batch.num_rows());
+    return writer_->WriteTable(*table, std::max<int64_t>(batch.num_rows(), 1));
+  }
+
+  Status Close() override { return writer_->Close(); }
+
+ private:
+  std::unique_ptr<parquet::arrow::FileWriter> writer_;
+};
+
+Status ParquetFileFormat::OpenWriter(std::shared_ptr<io::OutputStream> sink,
+                                     std::shared_ptr<Schema> schema, MemoryPool* pool,
+                                     std::unique_ptr<FileFormatWriter>* out) const {
+  std::unique_ptr<parquet::arrow::FileWriter> writer;
+  RETURN_NOT_OK(parquet::arrow::FileWriter::Open(
+      *schema, pool, sink, parquet::default_writer_properties(), &writer));
+  *out = internal::make_unique<ParquetFormatWriter>(std::move(writer));
+  return Status::OK();
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -52,8 +52,18 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
                   std::shared_ptr<ScanContext> scan_context,
                   std::unique_ptr<ScanTaskIterator>* out) const override;
 
+  /// \brief Count rows from the file metadata, without reading data pages
+  Status CountRows(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
+                   std::shared_ptr<ScanContext> scan_context,
+                   int64_t* out) const override;
+
   Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
                       std::unique_ptr<DataFragment>* out) override;
+
+  /// \brief Open a writer of Parquet files, each written batch making a row group
+  Status OpenWriter(std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<Schema> schema, MemoryPool* pool,
+                    std::unique_ptr<FileFormatWriter>* out) const override;
 };
 
 class ARROW_DS_EXPORT ParquetFragment : public FileBasedDataFragment {
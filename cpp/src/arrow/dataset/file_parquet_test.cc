@@ -17,11 +17,15 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
 #include "arrow/testing/util.h"
 #include "parquet/arrow/writer.h"
 
@@ -32,6 +36,8 @@ constexpr int64_t kBatchSize = 1UL << 15;
 constexpr int64_t kBatchRepetitions = 1 << 10;
 constexpr int64_t kNumRows = kBatchSize * kBatchRepetitions;
 
+using internal::checked_pointer_cast;
+
 using parquet::ArrowWriterProperties;
 using parquet::default_arrow_writer_properties;
 
@@ -171,6 +177,85 @@ TEST_F(TestParquetFileFormat, ScanRecordBatchReader) {
   ASSERT_EQ(row_count, kNumRows);
 }
 
+TEST_F(TestParquetFileFormat, ScanWithProjectionAndFilter) {
+  // A row group per batch, holding the values i and i in column "i"
+  auto s = schema({field("i", int64()), field("f64", float64())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < 4; ++i) {
+    auto value = std::to_string(i);
+    batches.push_back(
+        RecordBatch::Make(s, 2,
+                          {ArrayFromJSON(int64(), "[" + value + ", " + value + "]"),
+                           ArrayFromJSON(float64(), "[0.5, 1.5]")}));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+  TableBatchReader reader(*table);
+  auto source = GetFileSource(&reader);
+
+  auto dataset = std::make_shared<Dataset>(std::vector<std::shared_ptr<DataSource>>{});
+  ScannerBuilder builder(dataset, ctx_);
+  builder.Project({"i"});
+  builder.AddFilter(std::make_shared<ComparisonFilter>(
+      "i", ComparisonFilter::GREATER_EQUAL, std::make_shared<Int64Scalar>(2)));
+  auto fragment = std::make_shared<ParquetFragment>(*source, builder.Finish()->options());
+
+  std::unique_ptr<ScanTaskIterator> it;
+  ASSERT_OK(fragment->Scan(ctx_, &it));
+  int64_t row_count = 0;
+  ASSERT_OK(it->Visit([&row_count](std::unique_ptr<ScanTask> task) -> Status {
+    return task->Scan()->Visit([&row_count](std::shared_ptr<RecordBatch> batch) {
+      // Only the projected column is read, from the row groups which match
+      EXPECT_EQ(batch->num_columns(), 1);
+      EXPECT_EQ(batch->schema()->field(0)->name(), "i");
+      auto values = checked_pointer_cast<Int64Array>(batch->column(0));
+      for (int64_t i = 0; i < values->length(); ++i) {
+        EXPECT_GE(values->Value(i), 2);
+      }
+      row_count += batch->num_rows();
+      return Status::OK();
+    });
+  }));
+  ASSERT_EQ(row_count, 4);
+
+  // The unprojected column and the two first row groups are skipped
+  ASSERT_GT(ctx_->statistics->bytes_read, 0);
+  ASSERT_GT(ctx_->statistics->bytes_skipped, ctx_->statistics->bytes_read);
+}
+
+TEST_F(TestParquetFileFormat, CountRows) {
+  // A row group per batch, holding the values i and i in column "i"
+  auto s = schema({field("i", int64())});
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < 4; ++i) {
+    auto value = std::to_string(i);
+    auto values = ArrayFromJSON(int64(), "[" + value + ", " + value + "]");
+    batches.push_back(RecordBatch::Make(s, 2, {values}));
+  }
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+  TableBatchReader reader(*table);
+  auto source = GetFileSource(&reader);
+
+  int64_t num_rows;
+  ParquetFragment fragment(*source, opts_);
+  ASSERT_OK(fragment.CountRows(ctx_, &num_rows));
+  ASSERT_EQ(num_rows, 8);
+
+  // The rows of the row groups which the filter selects are counted, as
+  // they are scanned
+  auto dataset = std::make_shared<Dataset>(std::vector<std::shared_ptr<DataSource>>{});
+  ScannerBuilder builder(dataset, ctx_);
+  builder.AddFilter(std::make_shared<ComparisonFilter>(
+      "i", ComparisonFilter::GREATER_EQUAL, std::make_shared<Int64Scalar>(2)));
+  ParquetFragment filtered(*source, builder.Finish()->options());
+  ASSERT_OK(filtered.CountRows(ctx_, &num_rows));
+  ASSERT_EQ(num_rows, 4);
+
+  // No data page was read
+  ASSERT_EQ(ctx_->statistics->bytes_read, 0);
+}
+
 class TestParquetFileSystemBasedDataSource
     : public FileSystemBasedDataSourceMixin<ParquetFileFormat> {
   std::vector<std::string> file_names() const override {
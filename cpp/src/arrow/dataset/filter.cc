@@ -0,0 +1,252 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/filter.h"
+
+#include <cstdio>
+#include <string>
+
+#include "arrow/buffer.h"
+#include "arrow/dataset/partition.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parsing.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+namespace {
+
+template <typename T>
+bool ThreeWayCompare(const T& lhs, const T& rhs, int* out) {
+  // NaN is not ordered
+  if (!(lhs == lhs) || !(rhs == rhs)) {
+    return false;
+  }
+  *out = lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+  return true;
+}
+
+template <typename ArrowType, typename T>
+bool GetValue(const Scalar& scalar, T* out) {
+  *out = static_cast<T>(checked_cast<const NumericScalar<ArrowType>&>(scalar).value);
+  return true;
+}
+
+bool GetSigned(const Scalar& scalar, int64_t* out) {
+  switch (scalar.type->id()) {
+    case Type::INT8:
+      return GetValue<Int8Type>(scalar, out);
+    case Type::INT16:
+      return GetValue<Int16Type>(scalar, out);
+    case Type::INT32:
+      return GetValue<Int32Type>(scalar, out);
+    case Type::INT64:
+      return GetValue<Int64Type>(scalar, out);
+    default:
+      return false;
+  }
+}
+
+bool GetUnsigned(const Scalar& scalar, uint64_t* out) {
+  switch (scalar.type->id()) {
+    case Type::UINT8:
+      return GetValue<UInt8Type>(scalar, out);
+    case Type::UINT16:
+      return GetValue<UInt16Type>(scalar, out);
+    case Type::UINT32:
+      return GetValue<UInt32Type>(scalar, out);
+    case Type::UINT64:
+      return GetValue<UInt64Type>(scalar, out);
+    default:
+      return false;
+  }
+}
+
+bool GetFloating(const Scalar& scalar, double* out) {
+  switch (scalar.type->id()) {
+    case Type::FLOAT:
+      return GetValue<FloatType>(scalar, out);
+    case Type::DOUBLE:
+      return GetValue<DoubleType>(scalar, out);
+    default:
+      return false;
+  }
+}
+
+// Compare the values as ArrowType::c_type, into which the getter converts
+// values exactly. Strings, e.g. parsed from paths, are converted as well.
+template <typename ArrowType>
+bool CompareAs(const Scalar& lhs, const Scalar& rhs,
+               bool (*get)(const Scalar&, typename ArrowType::c_type*), int* out) {
+  typename ArrowType::c_type lhs_value, rhs_value;
+  if (!get(rhs, &rhs_value)) {
+    return false;
+  }
+  if (!get(lhs, &lhs_value)) {
+    if (lhs.type->id() != Type::STRING) {
+      return false;
+    }
+    const auto& str = checked_cast<const StringScalar&>(lhs).value;
+    internal::StringConverter<ArrowType> converter;
+    if (!converter(reinterpret_cast<const char*>(str->data()),
+                   static_cast<size_t>(str->size()), &lhs_value)) {
+      return false;
+    }
+  }
+  return ThreeWayCompare(lhs_value, rhs_value, out);
+}
+
+// Compare a value of the data, such as a partition key or a bound of the
+// statistics, with the value of a filter. Return false if they cannot be
+// compared.
+bool Compare(const Scalar& value, const Scalar& filter_value, int* out) {
+  if (!value.is_valid || !filter_value.is_valid) {
+    return false;
+  }
+
+  int64_t signed_value;
+  uint64_t unsigned_value;
+  double floating_value;
+  if (GetSigned(filter_value, &signed_value)) {
+    return CompareAs<Int64Type>(value, filter_value, GetSigned, out);
+  } else if (GetUnsigned(filter_value, &unsigned_value)) {
+    return CompareAs<UInt64Type>(value, filter_value, GetUnsigned, out);
+  } else if (GetFloating(filter_value, &floating_value)) {
+    return CompareAs<DoubleType>(value, filter_value, GetFloating, out);
+  } else if (filter_value.type->id() == Type::STRING &&
+             value.type->id() == Type::STRING) {
+    const auto& lhs = checked_cast<const StringScalar&>(value).value;
+    const auto& rhs = checked_cast<const StringScalar&>(filter_value).value;
+    return ThreeWayCompare(util::string_view(*lhs), util::string_view(*rhs), out);
+  }
+  return false;
+}
+
+}  // namespace
+
+bool ComparisonFilter::MayMatch(const PartitionKeyData& key) const {
+  if (value_ == NULLPTR) {
+    return true;
+  }
+
+  for (size_t i = 0; i < key.fields.size(); ++i) {
+    int cmp;
+    if (key.fields[i] != field_ || !Compare(*key.values[i], *value_, &cmp)) {
+      continue;
+    }
+
+    bool satisfied = true;
+    switch (op_) {
+      case EQUAL:
+        satisfied = cmp == 0;
+        break;
+      case NOT_EQUAL:
+        satisfied = cmp != 0;
+        break;
+      case LESS:
+        satisfied = cmp < 0;
+        break;
+      case LESS_EQUAL:
+        satisfied = cmp <= 0;
+        break;
+      case GREATER:
+        satisfied = cmp > 0;
+        break;
+      case GREATER_EQUAL:
+        satisfied = cmp >= 0;
+        break;
+    }
+    if (!satisfied) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ComparisonFilter::MayMatchRange(const std::string& field, const Scalar& min,
+                                     const Scalar& max) const {
+  int cmp_min, cmp_max;
+  if (value_ == NULLPTR || field != field_ || !Compare(min, *value_, &cmp_min) ||
+      !Compare(max, *value_, &cmp_max)) {
+    return true;
+  }
+
+  switch (op_) {
+    case EQUAL:
+      return cmp_min <= 0 && cmp_max >= 0;
+    case NOT_EQUAL:
+      return cmp_min != 0 || cmp_max != 0;
+    case LESS:
+      return cmp_min < 0;
+    case LESS_EQUAL:
+      return cmp_min <= 0;
+    case GREATER:
+      return cmp_max > 0;
+    case GREATER_EQUAL:
+      return cmp_max >= 0;
+  }
+  return true;
+}
+
+std::string ComparisonFilter::ToString() const {
+  static const char* kOperators[] = {"==", "!=", "<", "<=", ">", ">="};
+
+  std::string value;
+  int64_t signed_value;
+  uint64_t unsigned_value;
+  double floating_value;
+  if (!value_->is_valid) {
+    return "";
+  } else if (GetSigned(*value_, &signed_value)) {
+    value = std::to_string(signed_value);
+  } else if (GetUnsigned(*value_, &unsigned_value)) {
+    value = std::to_string(unsigned_value);
+  } else if (GetFloating(*value_, &floating_value)) {
+    // Enough digits to tell all doubles apart
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.17g", floating_value);
+    value = buffer;
+  } else if (value_->type->id() == Type::STRING) {
+    value = "\"";
+    for (char c : checked_cast<const StringScalar&>(*value_).value->ToString()) {
+      if (c == '"' || c == '\\') {
+        value.push_back('\\');
+      }
+      value.push_back(c);
+    }
+    value.push_back('"');
+  } else {
+    return "";
+  }
+  return field_ + " " + kOperators[op_] + " " + value;
+}
+
+bool KeyMayMatch(const FilterVector& filters, const PartitionKeyData& key) {
+  for (const auto& filter : filters) {
+    if (filter != NULLPTR && !filter->MayMatch(key)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace dataset
+}  // namespace arrow
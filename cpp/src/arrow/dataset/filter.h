@@ -18,7 +18,10 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <utility>
 
+#include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 
 namespace arrow {
@@ -34,7 +37,72 @@ class ARROW_DS_EXPORT Filter {
     ///
     GENERIC
   };
+
+  explicit Filter(type type_id) : type_id_(type_id) {}
+
+  virtual ~Filter() = default;
+
+  type type_id() const { return type_id_; }
+
+  /// \brief Return false if no row of a partition with the given key can
+  /// satisfy the filter, so that the partition need not be scanned. The
+  /// default implementation cannot tell and returns true.
+  virtual bool MayMatch(const PartitionKeyData& key) const { return true; }
+
+  /// \brief Return false if no row whose value of the field lies between min
+  /// and max can satisfy the filter, so that e.g. a Parquet row group with
+  /// these statistics need not be read. The default implementation cannot
+  /// tell and returns true.
+  virtual bool MayMatchRange(const std::string& field, const Scalar& min,
+                             const Scalar& max) const {
+    return true;
+  }
+
+  /// \brief A representation of the filter, such that filters with equal
+  /// representations select the same rows. The default implementation
+  /// returns an empty string, meaning that the filter has none, e.g. so that
+  /// scans using it are not cached.
+  virtual std::string ToString() const { return ""; }
+
+ protected:
+  type type_id_;
 };
 
+/// \brief Compare a field with a constant value, e.g. "date >= 2019-01-01"
+class ARROW_DS_EXPORT ComparisonFilter : public Filter {
+ public:
+  enum Operator { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+  ComparisonFilter(std::string field, Operator op, std::shared_ptr<Scalar> value)
+      : Filter(EXPRESSION), field_(std::move(field)), op_(op), value_(std::move(value)) {}
+
+  const std::string& field() const { return field_; }
+  Operator op() const { return op_; }
+  const std::shared_ptr<Scalar>& value() const { return value_; }
+
+  /// \brief Return false if the key has a value for the field which does not
+  /// satisfy the comparison. Values parsed from paths as strings are
+  /// converted to the type of the compared value, and integers are compared
+  /// regardless of their width. If the field is not part of the key or the
+  /// values cannot be compared, true is returned.
+  bool MayMatch(const PartitionKeyData& key) const override;
+
+  bool MayMatchRange(const std::string& field, const Scalar& min,
+                     const Scalar& max) const override;
+
+  /// \brief E.g. 'date >= "2019-01-01"', or an empty string if the value is
+  /// null or of a type other than integer, floating point or string
+  std::string ToString() const override;
+
+ protected:
+  std::string field_;
+  Operator op_;
+  std::shared_ptr<Scalar> value_;
+};
+
+/// \brief Return false if any of the filters cannot match the key
+ARROW_DS_EXPORT bool KeyMayMatch(const FilterVector& filters,
+                                 const PartitionKeyData& key);
+
 }  // namespace dataset
 }  // namespace arrow
@@ -0,0 +1,439 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/partition.h"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/stl.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+namespace {
+
+const FilterVector& GetFilters(const std::shared_ptr<ScanOptions>& options) {
+  static const FilterVector kNoFilters;
+  if (options == NULLPTR || options->selector() == NULLPTR) {
+    return kNoFilters;
+  }
+  return options->selector()->filters;
+}
+
+bool KeyMayMatch(const FilterVector& filters, const PartitionKey* key) {
+  if (key == NULLPTR) {
+    return true;
+  }
+  return KeyMayMatch(filters, PartitionKeyData{key->fields(), key->values()});
+}
+
+/// \brief Yield the fragments of each iterator in turn
+class ConcatenatedIterator : public DataFragmentIterator {
+ public:
+  explicit ConcatenatedIterator(std::vector<std::unique_ptr<DataFragmentIterator>> its)
+      : its_(std::move(its)) {}
+
+  Status Next(std::shared_ptr<DataFragment>* out) override {
+    for (; i_ < its_.size(); ++i_) {
+      RETURN_NOT_OK(its_[i_]->Next(out));
+      if (*out != NULLPTR) {
+        return Status::OK();
+      }
+    }
+    *out = NULLPTR;
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<DataFragmentIterator>> its_;
+  size_t i_ = 0;
+};
+
+bool IncludePartitionKeys(const std::shared_ptr<ScanOptions>& options) {
+  return options != NULLPTR && options->include_partition_keys();
+}
+
+void AppendKey(const PartitionKey* key, PartitionKeyData* out) {
+  if (key != NULLPTR) {
+    out->fields.insert(out->fields.end(), key->fields().begin(), key->fields().end());
+    out->values.insert(out->values.end(), key->values().begin(), key->values().end());
+  }
+}
+
+/// \brief Wrap the fragments of another iterator so that they append a key
+class PartitionKeyIterator : public DataFragmentIterator {
+ public:
+  PartitionKeyIterator(std::unique_ptr<DataFragmentIterator> it, PartitionKeyData key)
+      : it_(std::move(it)), key_(std::move(key)) {}
+
+  Status Next(std::shared_ptr<DataFragment>* out) override {
+    std::shared_ptr<DataFragment> fragment;
+    RETURN_NOT_OK(it_->Next(&fragment));
+    if (fragment == NULLPTR) {
+      *out = NULLPTR;
+      return Status::OK();
+    }
+    return PartitionKeyDataFragment::Make(std::move(fragment), key_, out);
+  }
+
+ private:
+  std::unique_ptr<DataFragmentIterator> it_;
+  PartitionKeyData key_;
+};
+
+template <typename ArrowType>
+Status MakeNumericDictionary(const Scalar& value, std::shared_ptr<Array>* out) {
+  const auto& scalar = checked_cast<const NumericScalar<ArrowType>&>(value);
+  NumericBuilder<ArrowType> builder;
+  RETURN_NOT_OK(builder.Append(scalar.value));
+  return builder.Finish(out);
+}
+
+/// \brief Make the one-entry dictionary of a constant key column
+Status MakeKeyDictionary(const Scalar& value, std::shared_ptr<Array>* out) {
+  if (!value.is_valid) {
+    return Status::NotImplemented("Null partition key values");
+  }
+  switch (value.type->id()) {
+    case Type::STRING: {
+      const auto& data = *checked_cast<const StringScalar&>(value).value;
+      StringBuilder builder;
+      RETURN_NOT_OK(builder.Append(data.data(), static_cast<int32_t>(data.size())));
+      return builder.Finish(out);
+    }
+    case Type::INT32:
+      return MakeNumericDictionary<Int32Type>(value, out);
+    case Type::INT64:
+      return MakeNumericDictionary<Int64Type>(value, out);
+    case Type::DOUBLE:
+      return MakeNumericDictionary<DoubleType>(value, out);
+    default:
+      break;
+  }
+  return Status::NotImplemented("Partition key values of type ", value.type->ToString());
+}
+
+using AppendKeyColumns =
+    std::function<Status(std::shared_ptr<RecordBatch>, std::shared_ptr<RecordBatch>*)>;
+
+/// \brief Yield the batches of another iterator with the key columns appended
+class PartitionKeyBatchIterator : public RecordBatchIterator {
+ public:
+  PartitionKeyBatchIterator(std::unique_ptr<RecordBatchIterator> it,
+                            AppendKeyColumns append)
+      : it_(std::move(it)), append_(std::move(append)) {}
+
+  Status Next(std::shared_ptr<RecordBatch>* out) override {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(it_->Next(&batch));
+    if (batch == NULLPTR) {
+      *out = NULLPTR;
+      return Status::OK();
+    }
+    return append_(std::move(batch), out);
+  }
+
+ private:
+  std::unique_ptr<RecordBatchIterator> it_;
+  AppendKeyColumns append_;
+};
+
+class PartitionKeyScanTask : public ScanTask {
+ public:
+  PartitionKeyScanTask(std::unique_ptr<ScanTask> task, AppendKeyColumns append)
+      : task_(std::move(task)), append_(std::move(append)) {}
+
+  std::unique_ptr<RecordBatchIterator> Scan() override {
+    return internal::make_unique<PartitionKeyBatchIterator>(task_->Scan(), append_);
+  }
+
+ private:
+  std::unique_ptr<ScanTask> task_;
+  AppendKeyColumns append_;
+};
+
+/// \brief Yield the fragments of the files beneath a directory, walking only
+/// the subdirectories whose key may satisfy the filters
+class FileSystemPartitionIterator : public DataFragmentIterator {
+ public:
+  FileSystemPartitionIterator(std::string path, fs::FileSystem* filesystem,
+                              std::shared_ptr<FileFormat> format,
+                              std::shared_ptr<PartitionScheme> partition_scheme,
+                              std::shared_ptr<ScanOptions> options,
+                              const PartitionKey* key, int max_concurrent_listings)
+      : path_(path),
+        filesystem_(filesystem),
+        format_(std::move(format)),
+        partition_scheme_(std::move(partition_scheme)),
+        options_(std::move(options)),
+        walker_(filesystem, std::move(path),
+                [this](const fs::FileStats& stats) {
+                  return DirectoryMayMatch(stats.base_name());
+                },
+                max_concurrent_listings) {
+    AppendKey(key, &key_);
+  }
+
+  Status Next(std::shared_ptr<DataFragment>* out) override {
+    while (files_.empty()) {
+      std::vector<fs::FileStats> stats;
+      RETURN_NOT_OK(walker_.Next(&stats));
+      if (stats.empty()) {
+        *out = NULLPTR;
+        return Status::OK();
+      }
+      std::sort(stats.begin(), stats.end(),
+                [](const fs::FileStats& lhs, const fs::FileStats& rhs) {
+                  return lhs.path() < rhs.path();
+                });
+      for (const auto& entry : stats) {
+        if (format_->IsKnownExtension(entry.extension())) {
+          files_.push_back(entry.path());
+        }
+      }
+    }
+
+    FileSource source(std::move(files_.front()), filesystem_);
+    files_.pop_front();
+    std::unique_ptr<DataFragment> file_fragment;
+    RETURN_NOT_OK(format_->MakeFragment(source, options_, &file_fragment));
+    std::shared_ptr<DataFragment> fragment = std::move(file_fragment);
+    if (IncludePartitionKeys(options_)) {
+      PartitionKeyData key = key_;
+      PartitionKeyData parsed;
+      if (ParseDirectoryKey(source.path(), &parsed)) {
+        key.fields.insert(key.fields.end(), parsed.fields.begin(), parsed.fields.end());
+        key.values.insert(key.values.end(), parsed.values.begin(), parsed.values.end());
+      }
+      if (!key.fields.empty()) {
+        std::shared_ptr<DataFragment> keyed;
+        RETURN_NOT_OK(PartitionKeyDataFragment::Make(fragment, std::move(key), &keyed));
+        fragment = std::move(keyed);
+      }
+    }
+    *out = std::move(fragment);
+    return Status::OK();
+  }
+
+ private:
+  // Parse the key of the directories between path_ and the file, returning
+  // false if they are not all partition directories
+  bool ParseDirectoryKey(const std::string& file, PartitionKeyData* out) const {
+    if (partition_scheme_ == NULLPTR) {
+      return false;
+    }
+    auto dir = fs::internal::GetAbstractPathParent(file).first;
+    if (!path_.empty()) {
+      auto prefix = fs::internal::EnsureTrailingSlash(path_);
+      if (dir.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+      }
+      dir = dir.substr(prefix.size());
+    }
+    return !dir.empty() && partition_scheme_->ParseKey(dir, out).ok();
+  }
+
+  bool DirectoryMayMatch(const std::string& name) const {
+    const auto& filters = GetFilters(options_);
+    if (partition_scheme_ == NULLPTR || filters.empty()) {
+      return true;
+    }
+    PartitionKeyData key;
+    if (!partition_scheme_->ParseKey(name, &key).ok()) {
+      // Not a partition directory, its files may match
+      return true;
+    }
+    return KeyMayMatch(filters, key);
+  }
+
+  std::string path_;
+  fs::FileSystem* filesystem_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<PartitionScheme> partition_scheme_;
+  std::shared_ptr<ScanOptions> options_;
+  PartitionKeyData key_;
+  // Declared after the members which its predicate uses
+  DirectoryWalker walker_;
+  std::deque<std::string> files_;
+};
+
+}  // namespace
+
+struct PartitionKeyDataFragment::KeyColumns {
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> dictionaries;
+
+  std::mutex mutex;
+  // Zero-filled indices, as long as the longest batch yet
+  std::shared_ptr<Array> zero_indices;
+
+  Status GetIndices(int64_t length, MemoryPool* pool, std::shared_ptr<Array>* out) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (zero_indices == NULLPTR || zero_indices->length() < length) {
+      int64_t capacity = length;
+      if (zero_indices != NULLPTR) {
+        capacity = std::max(capacity, 2 * zero_indices->length());
+      }
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(AllocateBuffer(pool, capacity, &buffer));
+      std::memset(buffer->mutable_data(), 0, static_cast<size_t>(capacity));
+      zero_indices = std::make_shared<Int8Array>(capacity, buffer);
+    }
+    *out = zero_indices->Slice(0, length);
+    return Status::OK();
+  }
+
+  Status Append(std::shared_ptr<RecordBatch> batch, MemoryPool* pool,
+                std::shared_ptr<RecordBatch>* out) {
+    std::shared_ptr<Array> indices;
+    for (size_t i = 0; i < fields.size(); ++i) {
+      if (batch->schema()->GetFieldIndex(fields[i]->name()) != -1) {
+        continue;
+      }
+      if (indices == NULLPTR) {
+        RETURN_NOT_OK(GetIndices(batch->num_rows(), pool, &indices));
+      }
+      auto column =
+          std::make_shared<DictionaryArray>(fields[i]->type(), indices, dictionaries[i]);
+      std::shared_ptr<RecordBatch> extended;
+      RETURN_NOT_OK(batch->AddColumn(batch->num_columns(), fields[i], column, &extended));
+      batch = std::move(extended);
+    }
+    *out = std::move(batch);
+    return Status::OK();
+  }
+};
+
+PartitionKeyDataFragment::PartitionKeyDataFragment(std::shared_ptr<DataFragment> fragment,
+                                                   PartitionKeyData key,
+                                                   std::shared_ptr<KeyColumns> columns)
+    : fragment_(std::move(fragment)),
+      key_(std::move(key)),
+      columns_(std::move(columns)) {}
+
+Status PartitionKeyDataFragment::Make(std::shared_ptr<DataFragment> fragment,
+                                      PartitionKeyData key,
+                                      std::shared_ptr<DataFragment>* out) {
+  auto columns = std::make_shared<KeyColumns>();
+  for (size_t i = 0; i < key.fields.size(); ++i) {
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(MakeKeyDictionary(*key.values[i], &values));
+    columns->fields.push_back(field(key.fields[i], dictionary(int8(), values->type())));
+    columns->dictionaries.push_back(std::move(values));
+  }
+  out->reset(new PartitionKeyDataFragment(std::move(fragment), std::move(key),
+                                          std::move(columns)));
+  return Status::OK();
+}
+
+Status PartitionKeyDataFragment::Scan(std::shared_ptr<ScanContext> scan_context,
+                                      std::unique_ptr<ScanTaskIterator>* out) {
+  std::unique_ptr<ScanTaskIterator> tasks;
+  RETURN_NOT_OK(fragment_->Scan(scan_context, &tasks));
+
+  auto columns = columns_;
+  MemoryPool* pool = scan_context->pool;
+  AppendKeyColumns append = [columns, pool](std::shared_ptr<RecordBatch> batch,
+                                            std::shared_ptr<RecordBatch>* out) {
+    return columns->Append(std::move(batch), pool, out);
+  };
+  *out = MakeMapIterator(
+      [append](std::unique_ptr<ScanTask> task) -> std::unique_ptr<ScanTask> {
+        return internal::make_unique<PartitionKeyScanTask>(std::move(task), append);
+      },
+      std::move(tasks));
+  return Status::OK();
+}
+
+bool HivePartitionScheme::PathMatchesScheme(const std::string& path) const {
+  PartitionKeyData key;
+  return ParseKey(path, &key).ok();
+}
+
+Status HivePartitionScheme::ParseKey(const std::string& path,
+                                     PartitionKeyData* out) const {
+  PartitionKeyData key;
+  for (const auto& segment : fs::internal::SplitAbstractPath(path)) {
+    auto sep = segment.find('=');
+    if (sep == std::string::npos || sep == 0) {
+      return Status::Invalid("Path segment '", segment,
+                             "' is not of the form $key=$value: ", path);
+    }
+    key.fields.push_back(segment.substr(0, sep));
+    key.values.push_back(
+        std::make_shared<StringScalar>(Buffer::FromString(segment.substr(sep + 1))));
+  }
+  if (key.fields.empty()) {
+    return Status::Invalid("Path has no $key=$value segment: ", path);
+  }
+  *out = std::move(key);
+  return Status::OK();
+}
+
+std::string Partition::type() const { return "partition"; }
+
+std::unique_ptr<DataFragmentIterator> SimplePartition::GetFragments(
+    std::shared_ptr<ScanOptions> options) {
+  std::vector<std::unique_ptr<DataFragmentIterator>> its;
+  if (KeyMayMatch(GetFilters(options), key())) {
+    its.push_back(MakeVectorIterator(data_fragments_));
+    for (const auto& subpartition : subpartitions_) {
+      its.push_back(subpartition->GetFragments(options));
+    }
+  }
+  std::unique_ptr<DataFragmentIterator> it =
+      internal::make_unique<ConcatenatedIterator>(std::move(its));
+  if (IncludePartitionKeys(options) && key() != NULLPTR) {
+    PartitionKeyData key_data;
+    AppendKey(key(), &key_data);
+    it = internal::make_unique<PartitionKeyIterator>(std::move(it), std::move(key_data));
+  }
+  return it;
+}
+
+std::unique_ptr<DataFragmentIterator> FileSystemPartition::GetFragments(
+    std::shared_ptr<ScanOptions> options) {
+  if (!KeyMayMatch(GetFilters(options), key())) {
+    return internal::make_unique<EmptyIterator<std::shared_ptr<DataFragment>>>();
+  }
+  return internal::make_unique<FileSystemPartitionIterator>(
+      path_, filesystem_, format_, partition_scheme_, std::move(options), key(),
+      max_concurrent_listings_);
+}
+
+}  // namespace dataset
+}  // namespace arrow
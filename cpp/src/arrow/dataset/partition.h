@@ -60,6 +60,10 @@ namespace dataset {
 /// keys exist and do we need to support them?
 class PartitionKey {
  public:
+  PartitionKey(std::vector<std::string> fields,
+               std::vector<std::shared_ptr<Scalar>> values)
+      : fields_(std::move(fields)), values_(std::move(values)) {}
+
   const std::vector<std::string>& fields() const { return fields_; }
   const std::vector<std::shared_ptr<Scalar>>& values() const { return values_; }
 
@@ -108,10 +112,15 @@ class ARROW_DS_EXPORT PartitionScheme {
 /// the form $key=$value in directory names
 class ARROW_DS_EXPORT HivePartitionScheme : public PartitionScheme {
  public:
-  /// \brief Return true if path
+  std::string name() const override { return "hive"; }
+
+  /// \brief Return true if every segment of the path is of the form
+  /// $key=$value
   bool PathMatchesScheme(const std::string& path) const override;
 
-  virtual Status ParseKey(const std::string& path, PartitionKeyData* out) const = 0;
+  /// \brief Parse the $key=$value segments of the path, the values are
+  /// StringScalars
+  Status ParseKey(const std::string& path, PartitionKeyData* out) const override;
 };
 
 // ----------------------------------------------------------------------
@@ -143,6 +152,54 @@ class ARROW_DS_EXPORT HivePartitionScheme : public PartitionScheme {
 // scanned, or potentially more if it is configured to split Parquet
 // files at the row group level
 
+/// \brief A DataFragment which appends the key of a partition to the batches
+/// of another fragment, as one column per key field
+///
+/// The key columns are dictionary arrays of a one-entry dictionary holding the
+/// key value. Their int8 indices are slices of a single zero-filled buffer
+/// shared by all the batches of the fragment, so a constant column costs
+/// one byte per row once, instead of a full array per batch. Kernels on
+/// dictionary arrays work on the one-entry dictionary. The key fields which a
+/// batch already has are not appended.
+class ARROW_DS_EXPORT PartitionKeyDataFragment : public DataFragment {
+ public:
+  /// \brief Create a fragment appending the key to the batches of fragment
+  ///
+  /// Returns NotImplemented if a key value cannot be represented as a
+  /// dictionary.
+  static Status Make(std::shared_ptr<DataFragment> fragment, PartitionKeyData key,
+                     std::shared_ptr<DataFragment>* out);
+
+  Status Scan(std::shared_ptr<ScanContext> scan_context,
+              std::unique_ptr<ScanTaskIterator>* out) override;
+
+  /// \brief Appending the key doesn't change the row count of the fragment
+  Status CountRows(std::shared_ptr<ScanContext> scan_context, int64_t* out) override {
+    return fragment_->CountRows(std::move(scan_context), out);
+  }
+
+  bool splittable() const override { return fragment_->splittable(); }
+
+  std::shared_ptr<ScanOptions> scan_options() const override {
+    return fragment_->scan_options();
+  }
+
+  /// \brief The fragment whose batches are extended
+  const std::shared_ptr<DataFragment>& fragment() const { return fragment_; }
+
+  const PartitionKeyData& key() const { return key_; }
+
+ private:
+  struct KeyColumns;
+
+  PartitionKeyDataFragment(std::shared_ptr<DataFragment> fragment, PartitionKeyData key,
+                           std::shared_ptr<KeyColumns> columns);
+
+  std::shared_ptr<DataFragment> fragment_;
+  PartitionKeyData key_;
+  std::shared_ptr<KeyColumns> columns_;
+};
+
 class ARROW_DS_EXPORT Partition : public DataSource {
  public:
   std::string type() const override;
@@ -150,9 +207,6 @@ class ARROW_DS_EXPORT Partition : public DataSource {
   /// \brief The key for this partition source, may be nullptr,
   /// e.g. for the top-level partitioned source container
   virtual const PartitionKey* key() const = 0;
-
-  virtual std::unique_ptr<DataFragmentIterator> GetFragments(
-      const Selector& selector) = 0;
 };
 
 /// \brief Simple implementation of Partition, which consists of a
@@ -171,13 +225,17 @@ class ARROW_DS_EXPORT SimplePartition : public Partition {
 
   int num_subpartitions() const { return static_cast<int>(subpartitions_.size()); }
 
-  int num_data_fragments() const { return static_cast<int>(data_fragments__.size()); }
+  int num_data_fragments() const { return static_cast<int>(data_fragments_.size()); }
 
   const PartitionVector& subpartitions() const { return subpartitions_; }
   const DataFragmentVector& data_fragments() const { return data_fragments_; }
 
+  /// \brief Yield the data fragments of this partition and of the
+  /// subpartitions whose key may satisfy the filters of the options. If the
+  /// options include partition keys, the fragments append the key of this
+  /// partition to their batches.
   std::unique_ptr<DataFragmentIterator> GetFragments(
-      const FilterVector& filters) override;
+      std::shared_ptr<ScanOptions> options) override;
 
  private:
   std::unique_ptr<PartitionKey> key_;
@@ -201,7 +259,7 @@ class ARROW_DS_EXPORT LazyPartition : public Partition {
   const PartitionKey* key() const override;
 
   std::unique_ptr<DataFragmentIterator> GetFragments(
-      const& DataSelector selector) override;
+      std::shared_ptr<ScanOptions> options) override;
 
   // TODO(wesm): Iterate over subpartitions
 
@@ -213,5 +271,51 @@ class ARROW_DS_EXPORT LazyPartition : public Partition {
   bool cache_manifest_ = false;
 };
 
+/// \brief A Partition of the files in a directory of a FileSystem, whose
+/// subdirectories are subpartitions with keys parsed from their names.
+///
+/// The directories are only listed when the fragments are requested, and the
+/// subdirectories whose key cannot satisfy the filters of the ScanOptions are
+/// skipped without being listed, which prunes the files beneath them. The
+/// directories are listed concurrently by a DirectoryWalker, and the fragments
+/// of a directory are yielded as soon as it is listed. If the options include
+/// partition keys, the fragments append the key of this partition and the keys
+/// parsed from the directories between it and their file.
+class ARROW_DS_EXPORT FileSystemPartition : public Partition {
+ public:
+  /// \param[in] path the directory of the partition
+  /// \param[in] filesystem the filesystem of the directory
+  /// \param[in] format the format of the files, others are ignored
+  /// \param[in] partition_scheme the scheme for parsing the names of the
+  /// subdirectories, may be nullptr in which case nothing is pruned
+  /// \param[in] partition_key the key of this partition, may be nullptr
+  /// \param[in] max_concurrent_listings maximum number of directories listed
+  /// concurrently, 0 for the capacity of the I/O thread pool
+  FileSystemPartition(std::string path, fs::FileSystem* filesystem,
+                      std::shared_ptr<FileFormat> format,
+                      std::shared_ptr<PartitionScheme> partition_scheme,
+                      std::unique_ptr<PartitionKey> partition_key = NULLPTR,
+                      int max_concurrent_listings = 0)
+      : path_(std::move(path)),
+        filesystem_(filesystem),
+        format_(std::move(format)),
+        partition_scheme_(std::move(partition_scheme)),
+        key_(std::move(partition_key)),
+        max_concurrent_listings_(max_concurrent_listings) {}
+
+  const PartitionKey* key() const override { return key_.get(); }
+
+  std::unique_ptr<DataFragmentIterator> GetFragments(
+      std::shared_ptr<ScanOptions> options) override;
+
+ private:
+  std::string path_;
+  fs::FileSystem* filesystem_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<PartitionScheme> partition_scheme_;
+  std::unique_ptr<PartitionKey> key_;
+  int max_concurrent_listings_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
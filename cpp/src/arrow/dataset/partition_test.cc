@@ -0,0 +1,383 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/partition.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+std::shared_ptr<Filter> Compare(const std::string& field, ComparisonFilter::Operator op,
+                                std::shared_ptr<Scalar> value) {
+  return std::make_shared<ComparisonFilter>(field, op, std::move(value));
+}
+
+std::shared_ptr<Scalar> Str(const std::string& value) {
+  return std::make_shared<StringScalar>(Buffer::FromString(std::string(value)));
+}
+
+TEST(HivePartitionScheme, ParseKey) {
+  HivePartitionScheme scheme;
+  PartitionKeyData key;
+  ASSERT_OK(scheme.ParseKey("date=2019-01-01/region=eu", &key));
+  ASSERT_EQ(key.fields, std::vector<std::string>({"date", "region"}));
+  ASSERT_EQ(key.values.size(), 2);
+  ASSERT_TRUE(key.values[0]->Equals(Str("2019-01-01")));
+  ASSERT_TRUE(key.values[1]->Equals(Str("eu")));
+
+  ASSERT_TRUE(scheme.PathMatchesScheme("year=2019/"));
+  ASSERT_FALSE(scheme.PathMatchesScheme("2019/month=1"));
+  ASSERT_FALSE(scheme.PathMatchesScheme("=2019"));
+  ASSERT_RAISES(Invalid, scheme.ParseKey("data", &key));
+}
+
+TEST(ComparisonFilter, MayMatch) {
+  HivePartitionScheme scheme;
+  PartitionKeyData key;
+  ASSERT_OK(scheme.ParseKey("year=2019/region=eu", &key));
+
+  ASSERT_TRUE(Compare("region", ComparisonFilter::EQUAL, Str("eu"))->MayMatch(key));
+  ASSERT_FALSE(Compare("region", ComparisonFilter::EQUAL, Str("us"))->MayMatch(key));
+  ASSERT_FALSE(Compare("region", ComparisonFilter::NOT_EQUAL, Str("eu"))->MayMatch(key));
+  ASSERT_TRUE(Compare("region", ComparisonFilter::LESS, Str("us"))->MayMatch(key));
+
+  // The values parsed from the path are converted to the compared type
+  auto year = std::make_shared<Int32Scalar>(2019);
+  ASSERT_TRUE(Compare("year", ComparisonFilter::GREATER_EQUAL, year)->MayMatch(key));
+  ASSERT_FALSE(Compare("year", ComparisonFilter::GREATER, year)->MayMatch(key));
+  auto later = std::make_shared<DoubleScalar>(2019.5);
+  ASSERT_FALSE(Compare("year", ComparisonFilter::GREATER, later)->MayMatch(key));
+
+  // Fields absent from the key and values which cannot be compared are not
+  // conclusive
+  ASSERT_TRUE(Compare("month", ComparisonFilter::EQUAL, Str("1"))->MayMatch(key));
+  ASSERT_TRUE(Compare("region", ComparisonFilter::EQUAL, year)->MayMatch(key));
+
+  ASSERT_TRUE(KeyMayMatch({}, key));
+  ASSERT_FALSE(KeyMayMatch({Compare("year", ComparisonFilter::EQUAL, year),
+                            Compare("region", ComparisonFilter::EQUAL, Str("us"))},
+                           key));
+}
+
+TEST(ComparisonFilter, MayMatchRange) {
+  Int32Scalar min(10), max(20);
+  auto may_match = [&](ComparisonFilter::Operator op, std::shared_ptr<Scalar> value) {
+    return Compare("i", op, std::move(value))->MayMatchRange("i", min, max);
+  };
+  auto value = [](int64_t v) { return std::make_shared<Int64Scalar>(v); };
+
+  ASSERT_TRUE(may_match(ComparisonFilter::EQUAL, value(10)));
+  ASSERT_FALSE(may_match(ComparisonFilter::EQUAL, value(21)));
+  ASSERT_FALSE(may_match(ComparisonFilter::LESS, value(10)));
+  ASSERT_TRUE(may_match(ComparisonFilter::LESS_EQUAL, value(10)));
+  ASSERT_FALSE(may_match(ComparisonFilter::GREATER, value(20)));
+  ASSERT_TRUE(may_match(ComparisonFilter::GREATER_EQUAL, value(20)));
+  ASSERT_TRUE(may_match(ComparisonFilter::NOT_EQUAL, value(10)));
+  ASSERT_FALSE(Compare("i", ComparisonFilter::NOT_EQUAL, value(10))
+                   ->MayMatchRange("i", min, min));
+
+  // Other fields and incomparable values are not conclusive
+  ASSERT_TRUE(
+      Compare("j", ComparisonFilter::EQUAL, value(0))->MayMatchRange("i", min, max));
+  ASSERT_TRUE(may_match(ComparisonFilter::EQUAL, Str("0")));
+  DoubleScalar nan(std::nan(""));
+  ASSERT_TRUE(Compare("i", ComparisonFilter::EQUAL, std::make_shared<DoubleScalar>(0.0))
+                  ->MayMatchRange("i", nan, nan));
+}
+
+TEST(ComparisonFilter, ToString) {
+  ASSERT_EQ(Compare("s", ComparisonFilter::GREATER_EQUAL, Str("a\"b"))->ToString(),
+            "s >= \"a\\\"b\"");
+  ASSERT_EQ(Compare("i", ComparisonFilter::NOT_EQUAL, std::make_shared<Int32Scalar>(-3))
+                ->ToString(),
+            "i != -3");
+  ASSERT_EQ(Compare("f", ComparisonFilter::LESS, std::make_shared<DoubleScalar>(0.5))
+                ->ToString(),
+            "f < 0.5");
+  ASSERT_EQ(Compare("b", ComparisonFilter::EQUAL, std::make_shared<BooleanScalar>(true))
+                ->ToString(),
+            "");
+}
+
+TEST(SimplePartition, GetFragments) {
+  auto make_partition = [](const std::string& region) -> std::shared_ptr<Partition> {
+    std::vector<std::shared_ptr<Scalar>> values{Str(region)};
+    auto key = internal::make_unique<PartitionKey>(std::vector<std::string>{"region"},
+                                                   std::move(values));
+    DataFragmentVector fragments{std::make_shared<SimpleDataFragment>(
+        std::vector<std::shared_ptr<RecordBatch>>{})};
+    return std::make_shared<SimplePartition>(std::move(key), std::move(fragments),
+                                             PartitionVector{});
+  };
+  SimplePartition root(NULLPTR, {}, {make_partition("eu"), make_partition("us")});
+
+  auto count_fragments = [&root](const FilterVector& filters) {
+    auto dataset = std::make_shared<Dataset>(std::vector<std::shared_ptr<DataSource>>{});
+    ScannerBuilder builder(dataset, std::make_shared<ScanContext>());
+    for (const auto& filter : filters) {
+      builder.AddFilter(filter);
+    }
+    auto scanner = builder.Finish();
+    int count = 0;
+    ARROW_EXPECT_OK(root.GetFragments(scanner->options())
+                  ->Visit([&count](std::shared_ptr<DataFragment>) {
+                    ++count;
+                    return Status::OK();
+                  }));
+    return count;
+  };
+  ASSERT_EQ(count_fragments({}), 2);
+  ASSERT_EQ(count_fragments({Compare("region", ComparisonFilter::EQUAL, Str("us"))}), 1);
+}
+
+TEST(SimplePartition, IncludePartitionKeys) {
+  auto schm = schema({field("i", int64())});
+  std::vector<std::shared_ptr<RecordBatch>> batches{
+      RecordBatch::Make(schm, 3, {ArrayFromJSON(int64(), "[1, 2, 3]")}),
+      RecordBatch::Make(schm, 2, {ArrayFromJSON(int64(), "[4, 5]")})};
+  std::vector<std::shared_ptr<Scalar>> values{Str("eu")};
+  auto key = internal::make_unique<PartitionKey>(std::vector<std::string>{"region"},
+                                                 std::move(values));
+  SimplePartition partition(std::move(key),
+                            {std::make_shared<SimpleDataFragment>(batches)}, {});
+
+  auto dataset = std::make_shared<Dataset>(std::vector<std::shared_ptr<DataSource>>{});
+  auto ctx = std::make_shared<ScanContext>();
+  for (bool include : {false, true}) {
+    ScannerBuilder builder(dataset, ctx);
+    builder.IncludePartitionKeys(include);
+    auto options = builder.Finish()->options();
+
+    std::vector<std::shared_ptr<RecordBatch>> scanned;
+    ASSERT_OK(partition.GetFragments(options)->Visit(
+        [&](std::shared_ptr<DataFragment> fragment) {
+          std::unique_ptr<ScanTaskIterator> tasks;
+          RETURN_NOT_OK(fragment->Scan(ctx, &tasks));
+          return tasks->Visit([&](std::unique_ptr<ScanTask> task) {
+            return task->Scan()->Visit([&](std::shared_ptr<RecordBatch> batch) {
+              scanned.push_back(std::move(batch));
+              return Status::OK();
+            });
+          });
+        }));
+    ASSERT_EQ(scanned.size(), 2);
+    if (!include) {
+      AssertBatchesEqual(*batches[0], *scanned[0]);
+      continue;
+    }
+
+    auto type = dictionary(int8(), utf8());
+    ASSERT_TRUE(scanned[0]->schema()->Equals(
+        *schema({field("i", int64()), field("region", type)})));
+    auto expected = std::make_shared<DictionaryArray>(
+        type, ArrayFromJSON(int8(), "[0, 0]"), ArrayFromJSON(utf8(), R"(["eu"])"));
+    AssertArraysEqual(*expected, *scanned[1]->column(1));
+
+    // The constant columns of all the batches share their indices
+    const auto& first = checked_cast<const DictionaryArray&>(*scanned[0]->column(1));
+    const auto& second = checked_cast<const DictionaryArray&>(*scanned[1]->column(1));
+    ASSERT_EQ(first.indices()->data()->buffers[1]->data(),
+              second.indices()->data()->buffers[1]->data());
+  }
+}
+
+/// \brief A FileSystem recording the directories which are listed
+class ListingRecorderFileSystem : public fs::SubTreeFileSystem {
+ public:
+  using fs::SubTreeFileSystem::SubTreeFileSystem;
+  using fs::SubTreeFileSystem::GetTargetStats;
+
+  Status GetTargetStats(const fs::Selector& select,
+                        std::vector<fs::FileStats>* out) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      listed_.push_back(select.base_dir);
+    }
+    return fs::SubTreeFileSystem::GetTargetStats(select, out);
+  }
+
+  /// \brief Return the sorted directories listed since the last call
+  std::vector<std::string> TakeListed() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> listed;
+    listed.swap(listed_);
+    std::sort(listed.begin(), listed.end());
+    return listed;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::string> listed_;
+};
+
+class TestFileSystemPartition : public FileSystemBasedDataSourceMixin<DummyFileFormat> {
+ public:
+  std::vector<std::string> file_names() const override {
+    return {"date=2019-01-01/region=eu/0.dummy", "date=2019-01-01/region=us/0.dummy",
+            "date=2019-01-02/region=eu/0.dummy", "date=2019-01-02/region=eu/1.dummy",
+            "date=2019-01-02/region=us/0.dummy", "date=2019-01-02/other.txt",
+            "root.dummy"};
+  }
+
+  void SetUp() override {
+    FileSystemBasedDataSourceMixin<DummyFileFormat>::SetUp();
+    recorder_ = std::make_shared<ListingRecorderFileSystem>(
+        temp_dir_->path().ToString(), local_fs_);
+
+    DiscoveryOptions options;
+    options.format = format_;
+    options.partition_scheme = std::make_shared<HivePartitionScheme>();
+    std::shared_ptr<DataSource> source;
+    ASSERT_OK(DiscoverSource("", recorder_.get(), options, &source));
+    dataset_ = std::make_shared<Dataset>(source);
+  }
+
+  // The paths of the scanned files, followed by the key which they append
+  std::vector<std::string> ScannedPaths(const FilterVector& filters,
+                                        bool include_partition_keys = false) {
+    auto builder = dataset_->NewScan();
+    builder.IncludePartitionKeys(include_partition_keys);
+    for (const auto& filter : filters) {
+      builder.AddFilter(filter);
+    }
+    auto scanner = builder.Finish();
+
+    recorder_->TakeListed();
+    std::vector<std::string> paths;
+    for (const auto& source : dataset_->sources()) {
+      ARROW_EXPECT_OK(source->GetFragments(scanner->options())
+                    ->Visit([&paths](std::shared_ptr<DataFragment> fragment) {
+                      return AppendPath(fragment, &paths);
+                    }));
+    }
+    // The directories are listed concurrently
+    std::sort(paths.begin(), paths.end());
+    return paths;
+  }
+
+  static Status AppendPath(std::shared_ptr<DataFragment> fragment,
+                           std::vector<std::string>* paths) {
+    auto keyed = std::dynamic_pointer_cast<PartitionKeyDataFragment>(fragment);
+    std::string key;
+    if (keyed != NULLPTR) {
+      fragment = keyed->fragment();
+      for (size_t i = 0; i < keyed->key().fields.size(); ++i) {
+        const auto& value = checked_cast<const StringScalar&>(*keyed->key().values[i]);
+        key += " " + keyed->key().fields[i] + ":" + value.value->ToString();
+      }
+    }
+    auto file_fragment = internal::checked_pointer_cast<FileBasedDataFragment>(fragment);
+    paths->push_back(file_fragment->source().path() + key);
+    return Status::OK();
+  }
+
+ protected:
+  std::shared_ptr<ListingRecorderFileSystem> recorder_;
+  std::shared_ptr<Dataset> dataset_;
+};
+
+TEST_F(TestFileSystemPartition, NoFilter) {
+  ASSERT_EQ(ScannedPaths({}),
+            std::vector<std::string>({"date=2019-01-01/region=eu/0.dummy",
+                                      "date=2019-01-01/region=us/0.dummy",
+                                      "date=2019-01-02/region=eu/0.dummy",
+                                      "date=2019-01-02/region=eu/1.dummy",
+                                      "date=2019-01-02/region=us/0.dummy",
+                                      "root.dummy"}));
+}
+
+TEST_F(TestFileSystemPartition, Pruning) {
+  auto paths = ScannedPaths({Compare("date", ComparisonFilter::EQUAL, Str("2019-01-02")),
+                             Compare("region", ComparisonFilter::EQUAL, Str("eu"))});
+  ASSERT_EQ(paths, std::vector<std::string>({"date=2019-01-02/region=eu/0.dummy",
+                                             "date=2019-01-02/region=eu/1.dummy",
+                                             "root.dummy"}));
+  // The directories which cannot match are not listed
+  ASSERT_EQ(recorder_->TakeListed(), std::vector<std::string>(
+                                         {"", "date=2019-01-02",
+                                          "date=2019-01-02/region=eu"}));
+}
+
+TEST_F(TestFileSystemPartition, IncludePartitionKeys) {
+  auto paths =
+      ScannedPaths({Compare("region", ComparisonFilter::EQUAL, Str("us"))}, true);
+  ASSERT_EQ(paths, std::vector<std::string>(
+                       {"date=2019-01-01/region=us/0.dummy date:2019-01-01 region:us",
+                        "date=2019-01-02/region=us/0.dummy date:2019-01-02 region:us",
+                        "root.dummy"}));
+}
+
+TEST_F(TestFileSystemPartition, DirectoryWalker) {
+  for (int max_concurrent_listings : {1, 4}) {
+    DirectoryWalker walker(
+        recorder_.get(), "",
+        [](const fs::FileStats& stats) { return stats.base_name() != "region=us"; },
+        max_concurrent_listings);
+
+    // The files come by directory
+    std::vector<std::string> paths;
+    std::vector<fs::FileStats> stats;
+    for (;;) {
+      ASSERT_OK(walker.Next(&stats));
+      if (stats.empty()) {
+        break;
+      }
+      auto parent = fs::internal::GetAbstractPathParent(stats[0].path()).first;
+      for (const auto& entry : stats) {
+        ASSERT_EQ(fs::internal::GetAbstractPathParent(entry.path()).first, parent);
+        paths.push_back(entry.path());
+      }
+    }
+    std::sort(paths.begin(), paths.end());
+    ASSERT_EQ(paths, std::vector<std::string>({"date=2019-01-01/region=eu/0.dummy",
+                                               "date=2019-01-02/other.txt",
+                                               "date=2019-01-02/region=eu/0.dummy",
+                                               "date=2019-01-02/region=eu/1.dummy",
+                                               "root.dummy"}));
+  }
+
+  DirectoryWalker walker(recorder_.get(), "missing");
+  std::vector<fs::FileStats> stats;
+  ASSERT_RAISES(IOError, walker.Next(&stats));
+  ASSERT_RAISES(IOError, walker.Next(&stats));
+}
+
+TEST_F(TestFileSystemPartition, DiscoverSource) {
+  DiscoveryOptions options;
+  std::shared_ptr<DataSource> source;
+  ASSERT_RAISES(Invalid, DiscoverSource("", recorder_.get(), options, &source));
+
+  options.format = format_;
+  ASSERT_RAISES(IOError, DiscoverSource("root.dummy", recorder_.get(), options, &source));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,518 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/pipeline.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <utility>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/expr_executor.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/operations/field_ref.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/stl.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::ThreadPool;
+
+namespace {
+
+// A context per slot: the pipeline is parallel across ScanTasks, so the
+// kernels run on the calling thread.
+Status MakeSlotContexts(MemoryPool* pool, int num_slots,
+                        std::vector<std::unique_ptr<compute::FunctionContext>>* out) {
+  out->clear();
+  for (int i = 0; i < num_slots; ++i) {
+    out->emplace_back(new compute::FunctionContext(pool));
+    out->back()->set_use_threads(false);
+  }
+  return Status::OK();
+}
+
+Status FieldIndex(const Schema& schema, const std::string& name, int* out) {
+  *out = schema.GetFieldIndex(name);
+  if (*out < 0) {
+    return Status::Invalid("No field named '", name, "' in schema ", schema.ToString());
+  }
+  return Status::OK();
+}
+
+const char* AggregateName(compute::GroupByOptions::Aggregate aggregate) {
+  switch (aggregate) {
+    case compute::GroupByOptions::COUNT:
+      return "count";
+    case compute::GroupByOptions::SUM:
+      return "sum";
+    case compute::GroupByOptions::MEAN:
+      return "mean";
+    case compute::GroupByOptions::MIN:
+      return "min";
+    case compute::GroupByOptions::MAX:
+      return "max";
+  }
+  return "unknown";
+}
+
+}  // namespace
+
+ExecNode::ExecNode(std::shared_ptr<Schema> output_schema)
+    : output_schema_(std::move(output_schema)) {}
+
+Status ExecNode::PushOutput(int slot, const std::shared_ptr<RecordBatch>& batch) {
+  if (output_ == NULLPTR) {
+    return Status::OK();
+  }
+  return output_->Push(slot, batch);
+}
+
+//
+// FilterNode
+//
+
+FilterNode::FilterNode(std::shared_ptr<Schema> schema,
+                       std::unique_ptr<compute::ExprExecutor> predicate,
+                       MemoryPool* pool)
+    : ExecNode(std::move(schema)), predicate_(std::move(predicate)), pool_(pool) {}
+
+FilterNode::~FilterNode() = default;
+
+Status FilterNode::Make(const std::shared_ptr<Schema>& input_schema,
+                        const compute::ExprPtr& predicate, MemoryPool* pool,
+                        std::shared_ptr<FilterNode>* out) {
+  std::unique_ptr<compute::ExprExecutor> executor;
+  RETURN_NOT_OK(compute::ExprExecutor::Make(input_schema, predicate, &executor));
+  if (executor->type()->id() != Type::BOOL) {
+    return Status::TypeError("Filter predicate must be boolean, got ",
+                             executor->type()->ToString());
+  }
+  out->reset(new FilterNode(input_schema, std::move(executor), pool));
+  return Status::OK();
+}
+
+Status FilterNode::Init(int num_slots) {
+  return MakeSlotContexts(pool_, num_slots, &contexts_);
+}
+
+Status FilterNode::Push(int slot, const std::shared_ptr<RecordBatch>& batch) {
+  compute::FunctionContext* ctx = contexts_[slot].get();
+  std::shared_ptr<Array> mask;
+  RETURN_NOT_OK(predicate_->Evaluate(ctx, *batch, &mask));
+
+  const int64_t length = mask->length();
+  const auto& mask_data = *mask->data();
+  std::shared_ptr<Buffer> selected = mask_data.buffers[1];
+  int64_t selected_offset = mask_data.offset;
+  if (mask->null_count() != 0) {
+    // Null is false
+    RETURN_NOT_OK(internal::BitmapAnd(pool_, selected->data(), selected_offset,
+                                      mask_data.buffers[0]->data(), selected_offset,
+                                      length, 0, &selected));
+    selected_offset = 0;
+  }
+
+  const int64_t num_selected =
+      internal::CountSetBits(selected->data(), selected_offset, length);
+  if (num_selected == length) {
+    return PushOutput(slot, batch);
+  }
+  if (num_selected == 0) {
+    return Status::OK();
+  }
+
+  // Compute the selected positions once and compact every column with them
+  std::shared_ptr<Array> indices;
+  BooleanArray filter(length, selected, NULLPTR, 0, selected_offset);
+  RETURN_NOT_OK(compute::FilterToIndices(ctx, filter, &indices));
+  std::vector<std::shared_ptr<Array>> columns(batch->num_columns());
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    RETURN_NOT_OK(compute::Take(ctx, *batch->column(i), *indices,
+                                compute::TakeOptions(), &columns[i]));
+  }
+  return PushOutput(slot,
+                    RecordBatch::Make(output_schema_, num_selected, std::move(columns)));
+}
+
+//
+// ProjectNode
+//
+
+ProjectNode::ProjectNode(std::shared_ptr<Schema> schema, MemoryPool* pool)
+    : ExecNode(std::move(schema)), pool_(pool) {}
+
+ProjectNode::~ProjectNode() = default;
+
+Status ProjectNode::Make(const std::shared_ptr<Schema>& input_schema,
+                         const std::vector<compute::ExprPtr>& exprs,
+                         const std::vector<std::string>& names, MemoryPool* pool,
+                         std::shared_ptr<ProjectNode>* out) {
+  if (exprs.size() != names.size()) {
+    return Status::Invalid("Project got ", exprs.size(), " expressions but ",
+                           names.size(), " names");
+  }
+
+  std::vector<std::unique_ptr<compute::ExprExecutor>> executors(exprs.size());
+  std::vector<int> field_indices(exprs.size(), -1);
+  std::vector<std::shared_ptr<Field>> fields(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    std::shared_ptr<DataType> type;
+    auto field_ref = dynamic_cast<const compute::ops::FieldRef*>(exprs[i]->op().get());
+    if (field_ref != NULLPTR) {
+      // Still compiled, which checks the type of the reference
+      RETURN_NOT_OK(compute::ExprExecutor::Make(input_schema, exprs[i], &executors[i]));
+      RETURN_NOT_OK(FieldIndex(*input_schema, field_ref->name(), &field_indices[i]));
+      type = executors[i]->type();
+      executors[i].reset();
+    } else {
+      RETURN_NOT_OK(compute::ExprExecutor::Make(input_schema, exprs[i], &executors[i]));
+      type = executors[i]->type();
+    }
+    fields[i] = field(names[i], type);
+  }
+
+  out->reset(new ProjectNode(schema(std::move(fields)), pool));
+  (*out)->executors_ = std::move(executors);
+  (*out)->field_indices_ = std::move(field_indices);
+  return Status::OK();
+}
+
+Status ProjectNode::Init(int num_slots) {
+  return MakeSlotContexts(pool_, num_slots, &contexts_);
+}
+
+Status ProjectNode::Push(int slot, const std::shared_ptr<RecordBatch>& batch) {
+  std::vector<std::shared_ptr<Array>> columns(executors_.size());
+  for (size_t i = 0; i < executors_.size(); ++i) {
+    if (executors_[i] == NULLPTR) {
+      columns[i] = batch->column(field_indices_[i]);
+    } else {
+      RETURN_NOT_OK(executors_[i]->Evaluate(contexts_[slot].get(), *batch, &columns[i]));
+    }
+  }
+  return PushOutput(slot, RecordBatch::Make(output_schema_, batch->num_rows(),
+                                            std::move(columns)));
+}
+
+//
+// TransformNode
+//
+
+TransformNode::TransformNode(std::shared_ptr<Schema> output_schema, TransformFunc func)
+    : ExecNode(std::move(output_schema)), func_(std::move(func)) {}
+
+Status TransformNode::Push(int slot, const std::shared_ptr<RecordBatch>& batch) {
+  std::shared_ptr<RecordBatch> out;
+  RETURN_NOT_OK(func_(slot, batch, &out));
+  if (out == NULLPTR) {
+    return Status::OK();
+  }
+  return PushOutput(slot, out);
+}
+
+//
+// HashAggregateNode
+//
+
+HashAggregateNode::HashAggregateNode(std::shared_ptr<Schema> schema,
+                                     std::unique_ptr<compute::FunctionContext> context)
+    : ExecNode(std::move(schema)), context_(std::move(context)) {}
+
+HashAggregateNode::~HashAggregateNode() = default;
+
+Status HashAggregateNode::Make(const std::shared_ptr<Schema>& input_schema,
+                               const std::vector<std::string>& keys,
+                               const std::vector<std::string>& values,
+                               const compute::GroupByOptions& options, MemoryPool* pool,
+                               std::shared_ptr<HashAggregateNode>* out) {
+  if (values.size() != options.aggregates.size()) {
+    return Status::Invalid("HashAggregate got ", values.size(), " value columns but ",
+                           options.aggregates.size(), " aggregates");
+  }
+
+  std::vector<int> field_indices;
+  std::vector<std::shared_ptr<Field>> aggregated_fields;
+  for (const auto& name : keys) {
+    int index;
+    RETURN_NOT_OK(FieldIndex(*input_schema, name, &index));
+    field_indices.push_back(index);
+    aggregated_fields.push_back(input_schema->field(index));
+  }
+  for (const auto& name : values) {
+    int index;
+    RETURN_NOT_OK(FieldIndex(*input_schema, name, &index));
+    field_indices.push_back(index);
+    aggregated_fields.push_back(input_schema->field(index));
+  }
+  auto aggregated_schema = schema(std::move(aggregated_fields));
+
+  std::unique_ptr<compute::FunctionContext> context(new compute::FunctionContext(pool));
+  context->set_use_threads(false);
+  std::unique_ptr<compute::GroupByAggregator> aggregator;
+  RETURN_NOT_OK(compute::GroupByAggregator::Make(context.get(), aggregated_schema,
+                                                 static_cast<int>(keys.size()), options,
+                                                 &aggregator));
+
+  // The output types are those of the groups of an empty state
+  std::unique_ptr<compute::GroupByAggregator::State> state;
+  std::shared_ptr<Array> groups;
+  RETURN_NOT_OK(aggregator->MakeState(&state));
+  RETURN_NOT_OK(aggregator->Finalize(state.get(), &groups));
+  const auto& struct_type = checked_cast<const StructType&>(*groups->type());
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < struct_type.num_children(); ++i) {
+    const size_t num_keys = keys.size();
+    std::string name =
+        static_cast<size_t>(i) < num_keys
+            ? keys[i]
+            : std::string(AggregateName(options.aggregates[i - num_keys])) + "_" +
+                  values[i - num_keys];
+    fields.push_back(field(std::move(name), struct_type.child(i)->type()));
+  }
+
+  out->reset(new HashAggregateNode(schema(std::move(fields)), std::move(context)));
+  (*out)->aggregator_ = std::move(aggregator);
+  (*out)->aggregated_schema_ = std::move(aggregated_schema);
+  (*out)->field_indices_ = std::move(field_indices);
+  return Status::OK();
+}
+
+Status HashAggregateNode::Init(int num_slots) {
+  states_.resize(num_slots);
+  for (auto& state : states_) {
+    RETURN_NOT_OK(aggregator_->MakeState(&state));
+  }
+  return Status::OK();
+}
+
+Status HashAggregateNode::Push(int slot, const std::shared_ptr<RecordBatch>& batch) {
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int index : field_indices_) {
+    columns.push_back(batch->column(index));
+  }
+  auto aggregated =
+      RecordBatch::Make(aggregated_schema_, batch->num_rows(), std::move(columns));
+  return aggregator_->Consume(*aggregated, states_[slot].get());
+}
+
+Status HashAggregateNode::Finish() {
+  if (states_.empty()) {
+    RETURN_NOT_OK(Init(1));
+  }
+  for (size_t i = 1; i < states_.size(); ++i) {
+    RETURN_NOT_OK(aggregator_->Merge(states_[i].get(), states_[0].get()));
+    states_[i].reset();
+  }
+
+  std::shared_ptr<Array> groups;
+  RETURN_NOT_OK(aggregator_->Finalize(states_[0].get(), &groups));
+  states_.clear();
+  const auto& struct_array = checked_cast<const StructArray&>(*groups);
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < struct_array.num_fields(); ++i) {
+    columns.push_back(struct_array.field(i));
+  }
+  auto batch = RecordBatch::Make(output_schema_, groups->length(), std::move(columns));
+
+  constexpr int64_t kMaxBatchSize = 1 << 16;
+  for (int64_t offset = 0; offset < batch->num_rows(); offset += kMaxBatchSize) {
+    RETURN_NOT_OK(PushOutput(0, batch->Slice(offset, kMaxBatchSize)));
+  }
+  return Status::OK();
+}
+
+//
+// SinkNode
+//
+
+SinkNode::SinkNode(std::shared_ptr<Schema> schema) : ExecNode(std::move(schema)) {}
+
+SinkNode::SinkNode(std::shared_ptr<Schema> schema, ConsumeFunc func)
+    : ExecNode(std::move(schema)), func_(std::move(func)) {}
+
+Status SinkNode::Push(int slot, const std::shared_ptr<RecordBatch>& batch) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (func_) {
+    return func_(batch);
+  }
+  batches_.push_back(batch);
+  return Status::OK();
+}
+
+Status SinkNode::ToTable(std::shared_ptr<Table>* out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return Table::FromRecordBatches(output_schema_, batches_, out);
+}
+
+//
+// ExecutePipeline
+//
+
+namespace {
+
+Status PushScanTask(ScanTask* task, int slot, int64_t morsel_size, ExecNode* head) {
+  return task->Scan()->Visit([&](std::shared_ptr<RecordBatch> batch) {
+    if (batch->num_rows() <= morsel_size) {
+      return head->Push(slot, batch);
+    }
+    for (int64_t offset = 0; offset < batch->num_rows(); offset += morsel_size) {
+      RETURN_NOT_OK(head->Push(slot, batch->Slice(offset, morsel_size)));
+    }
+    return Status::OK();
+  });
+}
+
+/// \brief The slots of a pipeline, taken by the running ScanTasks
+class SlotPool {
+ public:
+  explicit SlotPool(int num_slots) {
+    for (int i = num_slots - 1; i >= 0; --i) {
+      free_.push_back(i);
+    }
+  }
+
+  // Wait for a free slot and take it, or return -1 on error
+  int Take() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return !free_.empty() || !status_.ok(); });
+    if (!status_.ok()) {
+      return -1;
+    }
+    int slot = free_.back();
+    free_.pop_back();
+    return slot;
+  }
+
+  // Give a slot back, with the status of its ScanTask
+  void Release(int slot, const Status& status) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(slot);
+    if (status_.ok() && !status.ok()) {
+      status_ = status;
+    }
+    cv_.notify_all();
+  }
+
+  // Wait for all the slots to be free and return the first error
+  Status Wait(int num_slots) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return static_cast<int>(free_.size()) == num_slots; });
+    return status_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<int> free_;
+  Status status_;
+};
+
+}  // namespace
+
+Status ExecutePipeline(Scanner* scanner,
+                       const std::vector<std::shared_ptr<ExecNode>>& nodes,
+                       const ExecOptions& options) {
+  if (nodes.empty()) {
+    return Status::Invalid("Cannot execute an empty pipeline");
+  }
+  if (options.morsel_size <= 0) {
+    return Status::Invalid("Morsel size must be positive");
+  }
+
+  const auto& scan_context = scanner->context();
+  const bool use_threads = scan_context == NULLPTR || scan_context->use_threads;
+  ThreadPool* pool =
+      options.thread_pool != NULLPTR ? options.thread_pool.get() : GetCpuThreadPool();
+  int num_slots = 1;
+  if (use_threads) {
+    num_slots = options.max_tasks_in_flight > 0 ? options.max_tasks_in_flight
+                                                : pool->GetCapacity();
+    num_slots = std::max(num_slots, 1);
+  }
+
+  for (size_t i = 0; i < nodes.size(); ++i) {
+    nodes[i]->set_output(i + 1 < nodes.size() ? nodes[i + 1].get() : NULLPTR);
+    RETURN_NOT_OK(nodes[i]->Init(num_slots));
+  }
+  ExecNode* head = nodes.front().get();
+
+  std::unique_ptr<ScanTaskIterator> tasks = scanner->Scan();
+  if (!use_threads) {
+    RETURN_NOT_OK(tasks->Visit([&](std::unique_ptr<ScanTask> task) {
+      return PushScanTask(task.get(), 0, options.morsel_size, head);
+    }));
+  } else {
+    auto slots = std::make_shared<SlotPool>(num_slots);
+    const int64_t morsel_size = options.morsel_size;
+    Status dispatch_status;
+    for (;;) {
+      // Wait for a free slot before even fetching the next ScanTask, so that
+      // no scan runs ahead of the pipeline
+      int slot = slots->Take();
+      if (slot < 0) {
+        break;
+      }
+      std::unique_ptr<ScanTask> next;
+      dispatch_status = tasks->Next(&next);
+      if (!dispatch_status.ok() || next == NULLPTR) {
+        slots->Release(slot, Status::OK());
+        break;
+      }
+      std::shared_ptr<ScanTask> task(std::move(next));
+      dispatch_status = pool->Spawn([task, slot, slots, morsel_size, head]() mutable {
+        Status status = PushScanTask(task.get(), slot, morsel_size, head);
+        // The ScanTask may refer to data owned by the DataFragments, so it must
+        // not outlive the call
+        task.reset();
+        slots->Release(slot, status);
+      });
+      if (!dispatch_status.ok()) {
+        slots->Release(slot, Status::OK());
+        break;
+      }
+    }
+    // The running ScanTasks push into the nodes, which outlive them only
+    // until this returns
+    Status run_status = slots->Wait(num_slots);
+    RETURN_NOT_OK(dispatch_status);
+    RETURN_NOT_OK(run_status);
+  }
+
+  for (const auto& node : nodes) {
+    RETURN_NOT_OK(node->Finish());
+  }
+  return Status::OK();
+}
+
+}  // namespace dataset
+}  // namespace arrow
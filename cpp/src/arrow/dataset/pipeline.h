@@ -0,0 +1,274 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/compute/kernels/groupby.h"
+#include "arrow/compute/type_fwd.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+
+namespace internal {
+class ThreadPool;
+}  // namespace internal
+
+namespace compute {
+class ExprExecutor;
+class FunctionContext;
+}  // namespace compute
+
+namespace dataset {
+
+/// \brief A node of a push-based query pipeline
+///
+/// ExecutePipeline pushes the scanned batches into the first node of a
+/// pipeline, and every node pushes its output batches into the next one on the
+/// same thread.  A batch thus goes through the streaming nodes (filter,
+/// project) while it is in cache, and only the nodes which need all their
+/// input, such as a hash aggregate, hold on to data.
+///
+/// Push is called concurrently.  Each caller owns a distinct slot, between 0
+/// and the num_slots given to Init, for the duration of the call, so that
+/// nodes keep per-thread state without locking.
+class ARROW_DS_EXPORT ExecNode {
+ public:
+  virtual ~ExecNode() = default;
+
+  /// \brief The schema of the batches this node outputs
+  const std::shared_ptr<Schema>& output_schema() const { return output_schema_; }
+
+  /// \brief Set the node receiving the output batches, may be null
+  void set_output(ExecNode* output) { output_ = output; }
+
+  /// \brief Prepare for num_slots concurrent callers, before any Push
+  virtual Status Init(int num_slots) { return Status::OK(); }
+
+  /// \brief Process a batch, pushing the resulting batches to the output
+  virtual Status Push(int slot, const std::shared_ptr<RecordBatch>& batch) = 0;
+
+  /// \brief Called once after the last Push, to output any data held.  No
+  /// Push is running concurrently, and the slots are all free.
+  virtual Status Finish() { return Status::OK(); }
+
+ protected:
+  explicit ExecNode(std::shared_ptr<Schema> output_schema);
+
+  Status PushOutput(int slot, const std::shared_ptr<RecordBatch>& batch);
+
+  std::shared_ptr<Schema> output_schema_;
+  ExecNode* output_ = NULLPTR;
+};
+
+/// \brief Pass on the rows for which a boolean expression is true
+///
+/// Null counts as false.  The expression is evaluated by a
+/// compute::ExprExecutor, in morsels of its own.
+class ARROW_DS_EXPORT FilterNode : public ExecNode {
+ public:
+  ~FilterNode() override;
+
+  /// \param[in] input_schema the schema of the input batches
+  /// \param[in] predicate the boolean expression over the input fields
+  /// \param[in] pool the memory pool of the output batches
+  /// \param[out] out the node
+  static Status Make(const std::shared_ptr<Schema>& input_schema,
+                     const compute::ExprPtr& predicate, MemoryPool* pool,
+                     std::shared_ptr<FilterNode>* out);
+
+  Status Init(int num_slots) override;
+  Status Push(int slot, const std::shared_ptr<RecordBatch>& batch) override;
+
+ private:
+  FilterNode(std::shared_ptr<Schema> schema,
+             std::unique_ptr<compute::ExprExecutor> predicate, MemoryPool* pool);
+
+  std::unique_ptr<compute::ExprExecutor> predicate_;
+  MemoryPool* pool_;
+  std::vector<std::unique_ptr<compute::FunctionContext>> contexts_;
+};
+
+/// \brief Output a column per expression over the input fields
+///
+/// Expressions which are only a field reference output the input column
+/// without copying it.
+class ARROW_DS_EXPORT ProjectNode : public ExecNode {
+ public:
+  ~ProjectNode() override;
+
+  /// \param[in] input_schema the schema of the input batches
+  /// \param[in] exprs the expressions of the output columns
+  /// \param[in] names the names of the output columns
+  /// \param[in] pool the memory pool of the output batches
+  /// \param[out] out the node
+  static Status Make(const std::shared_ptr<Schema>& input_schema,
+                     const std::vector<compute::ExprPtr>& exprs,
+                     const std::vector<std::string>& names, MemoryPool* pool,
+                     std::shared_ptr<ProjectNode>* out);
+
+  Status Init(int num_slots) override;
+  Status Push(int slot, const std::shared_ptr<RecordBatch>& batch) override;
+
+ private:
+  explicit ProjectNode(std::shared_ptr<Schema> schema, MemoryPool* pool);
+
+  // For each output column, the evaluated expression, or null if it is the
+  // input column of index field_indices_[i]
+  std::vector<std::unique_ptr<compute::ExprExecutor>> executors_;
+  std::vector<int> field_indices_;
+  MemoryPool* pool_;
+  std::vector<std::unique_ptr<compute::FunctionContext>> contexts_;
+};
+
+/// \brief Apply a function to every batch
+///
+/// This plugs any batch-at-a-time computation into a pipeline, such as a
+/// Gandiva filter or projector: the slot may index per-thread state, e.g. a
+/// gandiva::SelectionVector per slot.  The function is called concurrently.
+/// It may output a null batch to drop the input.
+class ARROW_DS_EXPORT TransformNode : public ExecNode {
+ public:
+  using TransformFunc =
+      std::function<Status(int slot, const std::shared_ptr<RecordBatch>& in,
+                           std::shared_ptr<RecordBatch>* out)>;
+
+  /// \param[in] output_schema the schema of the batches the function outputs
+  /// \param[in] func the function
+  TransformNode(std::shared_ptr<Schema> output_schema, TransformFunc func);
+
+  Status Push(int slot, const std::shared_ptr<RecordBatch>& batch) override;
+
+ private:
+  TransformFunc func_;
+};
+
+/// \brief Aggregate the values of the input grouped by keys
+///
+/// Every slot aggregates its batches into a compute::GroupByAggregator state
+/// of its own.  Finish merges the states and outputs their groups, in
+/// batches of at most 64K rows.  The output columns are the keys, named as in
+/// the input, then the aggregates, named after the aggregate and the value
+/// column, e.g. "sum_price".  The groups are ordered by slot, then by first
+/// appearance in the batches of the slot, which depends on scheduling.
+class ARROW_DS_EXPORT HashAggregateNode : public ExecNode {
+ public:
+  ~HashAggregateNode() override;
+
+  /// \param[in] input_schema the schema of the input batches
+  /// \param[in] keys the names of the key columns
+  /// \param[in] values the names of the aggregated columns, a value column
+  /// may be aggregated several times
+  /// \param[in] options the aggregates, one per value column
+  /// \param[in] pool the memory pool of the aggregation state
+  /// \param[out] out the node
+  static Status Make(const std::shared_ptr<Schema>& input_schema,
+                     const std::vector<std::string>& keys,
+                     const std::vector<std::string>& values,
+                     const compute::GroupByOptions& options, MemoryPool* pool,
+                     std::shared_ptr<HashAggregateNode>* out);
+
+  Status Init(int num_slots) override;
+  Status Push(int slot, const std::shared_ptr<RecordBatch>& batch) override;
+  Status Finish() override;
+
+ private:
+  HashAggregateNode(std::shared_ptr<Schema> schema,
+                    std::unique_ptr<compute::FunctionContext> context);
+
+  std::unique_ptr<compute::FunctionContext> context_;
+  std::unique_ptr<compute::GroupByAggregator> aggregator_;
+  std::shared_ptr<Schema> aggregated_schema_;
+  // The input columns of the keys then of the values
+  std::vector<int> field_indices_;
+  std::vector<std::unique_ptr<compute::GroupByAggregator::State>> states_;
+};
+
+/// \brief Collect the batches of a pipeline, or pass them to a function
+class ARROW_DS_EXPORT SinkNode : public ExecNode {
+ public:
+  using ConsumeFunc = std::function<Status(std::shared_ptr<RecordBatch>)>;
+
+  /// \brief Collect the batches, for ToTable
+  explicit SinkNode(std::shared_ptr<Schema> schema);
+
+  /// \brief Call func with every batch, one call at a time.  As the producing
+  /// threads wait for it, a slow consumer slows the whole pipeline down.
+  SinkNode(std::shared_ptr<Schema> schema, ConsumeFunc func);
+
+  Status Push(int slot, const std::shared_ptr<RecordBatch>& batch) override;
+
+  /// \brief The batches collected, in no particular order
+  Status ToTable(std::shared_ptr<Table>* out);
+
+ private:
+  ConsumeFunc func_;
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+};
+
+/// \brief Options of ExecutePipeline
+struct ARROW_DS_EXPORT ExecOptions {
+  /// \brief The thread pool running the pipeline, by default the CPU thread
+  /// pool.  A work-stealing pool (ThreadPool::MakeWorkStealing) suits the many
+  /// short tasks of a pipeline best.
+  std::shared_ptr<internal::ThreadPool> thread_pool;
+
+  /// \brief Maximum number of ScanTasks being pushed through the pipeline at
+  /// a time, which is the number of slots.  If 0 (default), the capacity of
+  /// the thread pool.
+  int max_tasks_in_flight = 0;
+
+  /// \brief Maximum number of rows of the morsels pushed into the pipeline.
+  /// Larger scanned batches are sliced, without copying.
+  int64_t morsel_size = 1 << 16;
+};
+
+/// \brief Push the batches of a scan through a pipeline of nodes
+///
+/// Every ScanTask of the scanner runs as a task of the thread pool, which
+/// takes a free slot and pushes the batches it reads into the first node,
+/// morsel by morsel.  A new ScanTask is only started when a slot is free:
+/// data is scanned no faster than the pipeline consumes it, and the memory
+/// held is bounded by the morsels in flight and the state of the nodes.
+///
+/// Each node outputs to the next one.  Once all the batches are pushed, the
+/// nodes are finished in order.  If the ScanContext of the scanner does not
+/// use threads, the ScanTasks are run in turn on the calling thread.  On
+/// error, no new ScanTask is started and the first error is returned once the
+/// running ones are done.
+///
+/// \param[in] scanner the scanner of the input
+/// \param[in] nodes the nodes of the pipeline, usually ending with a SinkNode
+/// \param[in] options the execution options
+/// \return Status
+ARROW_DS_EXPORT
+Status ExecutePipeline(Scanner* scanner,
+                       const std::vector<std::shared_ptr<ExecNode>>& nodes,
+                       const ExecOptions& options = ExecOptions());
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,277 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/pipeline.h"
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/logical_type.h"
+#include "arrow/compute/operations/cast.h"
+#include "arrow/compute/operations/compare.h"
+#include "arrow/compute/operations/field_ref.h"
+#include "arrow/compute/operations/literal.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace dataset {
+
+namespace ops = compute::ops;
+namespace type = compute::type;
+
+compute::ExprPtr ToExpr(const std::shared_ptr<compute::Operation>& op) {
+  compute::ExprPtr out;
+  ARROW_EXPECT_OK(op->ToExpr(&out));
+  return out;
+}
+
+class TestPipeline : public DatasetFixtureMixin {
+ public:
+  void SetUp() override {
+    schema_ = schema({field("key", int32()), field("value", int64())});
+    // Every seventh value is null
+    DataFragmentVector fragments;
+    int64_t index = 0;
+    for (int i = 0; i < kNumberFragments; ++i) {
+      std::vector<std::shared_ptr<RecordBatch>> fragment_batches;
+      for (int j = 0; j < kNumberBatches; ++j) {
+        Int32Builder keys;
+        Int64Builder values;
+        for (int k = 0; k < kBatchSize; ++k, ++index) {
+          ARROW_EXPECT_OK(keys.Append(static_cast<int32_t>(index % 3)));
+          if (index % 7 == 0) {
+            ARROW_EXPECT_OK(values.AppendNull());
+          } else {
+            ARROW_EXPECT_OK(values.Append(index));
+          }
+        }
+        std::shared_ptr<Array> key_array, value_array;
+        ARROW_EXPECT_OK(keys.Finish(&key_array));
+        ARROW_EXPECT_OK(values.Finish(&value_array));
+        fragment_batches.push_back(
+            RecordBatch::Make(schema_, kBatchSize, {key_array, value_array}));
+      }
+      fragments.push_back(std::make_shared<SimpleDataFragment>(fragment_batches));
+    }
+    num_rows_ = index;
+    sources_.push_back(std::make_shared<SimpleDataSource>(fragments));
+  }
+
+  std::unique_ptr<Scanner> MakeScanner() {
+    return internal::make_unique<SimpleScanner>(sources_, options_, ctx_, schema_);
+  }
+
+  // value >= threshold
+  compute::ExprPtr Predicate(int64_t threshold) {
+    return ToExpr(std::make_shared<ops::Compare>(
+        ToExpr(std::make_shared<ops::FieldRef>("value", type::int64())),
+        ToExpr(std::make_shared<ops::Literal>(std::make_shared<Int64Scalar>(threshold))),
+        compute::CompareOperator::GREATER_EQUAL));
+  }
+
+  // SELECT key, sum(CAST(value AS double)), count(value) FROM t
+  // WHERE value >= threshold GROUP BY key
+  void MakeAggregatePipeline(int64_t threshold,
+                             std::vector<std::shared_ptr<ExecNode>>* nodes,
+                             std::shared_ptr<SinkNode>* sink) {
+    std::shared_ptr<FilterNode> filter;
+    ASSERT_OK(FilterNode::Make(schema_, Predicate(threshold), default_memory_pool(),
+                               &filter));
+
+    auto key = ToExpr(std::make_shared<ops::FieldRef>("key", type::int32()));
+    auto value = ToExpr(std::make_shared<ops::Cast>(
+        ToExpr(std::make_shared<ops::FieldRef>("value", type::int64())),
+        type::float64()));
+    std::shared_ptr<ProjectNode> project;
+    ASSERT_OK(ProjectNode::Make(filter->output_schema(), {key, value}, {"key", "x"},
+                                default_memory_pool(), &project));
+
+    std::shared_ptr<HashAggregateNode> aggregate;
+    compute::GroupByOptions options(
+        {compute::GroupByOptions::SUM, compute::GroupByOptions::COUNT});
+    ASSERT_OK(HashAggregateNode::Make(project->output_schema(), {"key"}, {"x", "x"},
+                                      options, default_memory_pool(), &aggregate));
+    AssertSchemaEqual(*schema({field("key", int32()), field("sum_x", float64()),
+                               field("count_x", int64())}),
+                      *aggregate->output_schema());
+
+    *sink = std::make_shared<SinkNode>(aggregate->output_schema());
+    *nodes = {filter, project, aggregate, *sink};
+  }
+
+  void AssertAggregates(int64_t threshold, SinkNode* sink) {
+    std::map<int32_t, std::pair<double, int64_t>> expected;
+    for (int64_t i = 0; i < num_rows_; ++i) {
+      if (i % 7 != 0 && i >= threshold) {
+        auto& group = expected[static_cast<int32_t>(i % 3)];
+        group.first += static_cast<double>(i);
+        ++group.second;
+      }
+    }
+
+    std::shared_ptr<Table> table;
+    ASSERT_OK(sink->ToTable(&table));
+    std::map<int32_t, std::pair<double, int64_t>> actual;
+    ASSERT_EQ(table->num_rows(), static_cast<int64_t>(expected.size()));
+    for (int c = 0; c < table->column(0)->num_chunks(); ++c) {
+      const auto& keys = checked_cast<const Int32Array&>(*table->column(0)->chunk(c));
+      const auto& sums = checked_cast<const DoubleArray&>(*table->column(1)->chunk(c));
+      const auto& counts = checked_cast<const Int64Array&>(*table->column(2)->chunk(c));
+      for (int64_t i = 0; i < keys.length(); ++i) {
+        ASSERT_EQ(actual.count(keys.Value(i)), 0);
+        actual[keys.Value(i)] = {sums.Value(i), counts.Value(i)};
+      }
+    }
+    ASSERT_EQ(expected, actual);
+  }
+
+ protected:
+  static constexpr int kNumberFragments = 8;
+  static constexpr int kNumberBatches = 4;
+  static constexpr int kBatchSize = 50;
+
+  std::shared_ptr<Schema> schema_;
+  int64_t num_rows_ = 0;
+  std::vector<std::shared_ptr<DataSource>> sources_;
+};
+
+TEST_F(TestPipeline, FilterProjectAggregate) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::MakeWorkStealing(3, &pool));
+
+  for (bool use_threads : {false, true}) {
+    for (int64_t morsel_size : {1 << 16, 16}) {
+      for (int64_t threshold : {0, 500, 100000}) {
+        ctx_->use_threads = use_threads;
+        std::vector<std::shared_ptr<ExecNode>> nodes;
+        std::shared_ptr<SinkNode> sink;
+        MakeAggregatePipeline(threshold, &nodes, &sink);
+
+        ExecOptions options;
+        options.thread_pool = pool;
+        options.morsel_size = morsel_size;
+        ASSERT_OK(ExecutePipeline(MakeScanner().get(), nodes, options));
+        AssertAggregates(threshold, sink.get());
+      }
+    }
+  }
+}
+
+TEST_F(TestPipeline, FilterSink) {
+  std::shared_ptr<FilterNode> filter;
+  ASSERT_OK(FilterNode::Make(schema_, Predicate(100), default_memory_pool(), &filter));
+  int64_t num_rows = 0;
+  auto sink = std::make_shared<SinkNode>(
+      schema_, [&num_rows](std::shared_ptr<RecordBatch> batch) {
+        const auto& values = checked_cast<const Int64Array&>(*batch->column(1));
+        for (int64_t i = 0; i < values.length(); ++i) {
+          EXPECT_TRUE(values.IsValid(i));
+          EXPECT_GE(values.Value(i), 100);
+        }
+        num_rows += batch->num_rows();
+        return Status::OK();
+      });
+  ASSERT_OK(ExecutePipeline(MakeScanner().get(), {filter, sink}));
+
+  int64_t expected = 0;
+  for (int64_t i = 100; i < num_rows_; ++i) {
+    expected += i % 7 != 0;
+  }
+  ASSERT_EQ(num_rows, expected);
+}
+
+TEST_F(TestPipeline, MaxTasksInFlight) {
+  std::atomic<int> max_slot(0);
+  std::atomic<int64_t> num_rows(0);
+  auto transform = std::make_shared<TransformNode>(
+      schema_, [&](int slot, const std::shared_ptr<RecordBatch>& in,
+                   std::shared_ptr<RecordBatch>* out) {
+        int current = max_slot.load();
+        while (slot > current && !max_slot.compare_exchange_weak(current, slot)) {
+        }
+        num_rows += in->num_rows();
+        // Drop the batch
+        *out = NULLPTR;
+        return Status::OK();
+      });
+  auto sink = std::make_shared<SinkNode>(schema_);
+
+  ExecOptions options;
+  options.max_tasks_in_flight = 2;
+  ASSERT_OK(ExecutePipeline(MakeScanner().get(), {transform, sink}, options));
+  ASSERT_LT(max_slot.load(), 2);
+  ASSERT_EQ(num_rows.load(), num_rows_);
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(sink->ToTable(&table));
+  ASSERT_EQ(table->num_rows(), 0);
+}
+
+TEST_F(TestPipeline, Errors) {
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    std::atomic<int> num_calls(0);
+    auto transform = std::make_shared<TransformNode>(
+        schema_, [&](int slot, const std::shared_ptr<RecordBatch>& in,
+                     std::shared_ptr<RecordBatch>* out) {
+          if (++num_calls == 5) {
+            return Status::IOError("transform failed");
+          }
+          *out = in;
+          return Status::OK();
+        });
+    auto sink = std::make_shared<SinkNode>(schema_);
+    ASSERT_RAISES(IOError, ExecutePipeline(MakeScanner().get(), {transform, sink}));
+    // No ScanTask is started after the failure
+    ASSERT_LT(num_calls.load(), kNumberFragments * kNumberBatches);
+  }
+
+  std::shared_ptr<FilterNode> filter;
+  auto key = ToExpr(std::make_shared<ops::FieldRef>("key", type::int32()));
+  ASSERT_RAISES(TypeError,
+                FilterNode::Make(schema_, key, default_memory_pool(), &filter));
+
+  std::shared_ptr<ProjectNode> project;
+  ASSERT_RAISES(Invalid,
+                ProjectNode::Make(schema_, {key}, {}, default_memory_pool(), &project));
+
+  std::shared_ptr<HashAggregateNode> aggregate;
+  compute::GroupByOptions options({compute::GroupByOptions::SUM});
+  ASSERT_RAISES(Invalid, HashAggregateNode::Make(schema_, {"missing"}, {"value"}, options,
+                                                 default_memory_pool(), &aggregate));
+  ASSERT_RAISES(Invalid, HashAggregateNode::Make(schema_, {"key"}, {"value", "value"},
+                                                 options, default_memory_pool(),
+                                                 &aggregate));
+
+  ASSERT_RAISES(Invalid, ExecutePipeline(MakeScanner().get(), {}));
+}
+
+}  // namespace dataset
+}  // namespace arrow
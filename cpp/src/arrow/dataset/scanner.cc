@@ -17,14 +17,431 @@
 
 #include "arrow/dataset/scanner.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+
+#include "arrow/dataset/cache.h"
+#include "arrow/dataset/dataset.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/table.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/stl.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::GetCpuThreadPool;
+using internal::TaskGroup;
+using internal::ThreadPool;
+
+using RecordBatchVector = std::vector<std::shared_ptr<RecordBatch>>;
+
 std::unique_ptr<RecordBatchIterator> SimpleScanTask::Scan() {
   return MakeVectorIterator(record_batches_);
 }
 
+namespace {
+
+Status CollectBatches(ScanTask* task, RecordBatchVector* out) {
+  return task->Scan()->Visit([out](std::shared_ptr<RecordBatch> batch) {
+    out->push_back(std::move(batch));
+    return Status::OK();
+  });
+}
+
+Status CountTaskRows(ScanTask* task, int64_t* out) {
+  int64_t num_rows = 0;
+  RETURN_NOT_OK(task->Scan()->Visit([&num_rows](std::shared_ptr<RecordBatch> batch) {
+    num_rows += batch->num_rows();
+    return Status::OK();
+  }));
+  *out = num_rows;
+  return Status::OK();
+}
+
+std::shared_ptr<TaskGroup> MakeTaskGroup(const ScanContext& context) {
+  return context.use_threads ? TaskGroup::MakeThreaded(GetCpuThreadPool())
+                             : TaskGroup::MakeSerial();
+}
+
+/// \brief Yield the ScanTasks of the DataFragments of each DataSource in turn
+class SimpleScanTaskIterator : public ScanTaskIterator {
+ public:
+  SimpleScanTaskIterator(std::vector<std::shared_ptr<DataSource>> sources,
+                         std::shared_ptr<ScanOptions> scan_options,
+                         std::shared_ptr<ScanContext> scan_context)
+      : sources_(std::move(sources)),
+        scan_options_(std::move(scan_options)),
+        scan_context_(std::move(scan_context)) {}
+
+  Status Next(std::unique_ptr<ScanTask>* out) override {
+    for (;;) {
+      if (tasks_ != NULLPTR) {
+        RETURN_NOT_OK(tasks_->Next(out));
+        if (*out != NULLPTR) {
+          return Status::OK();
+        }
+        tasks_.reset();
+      }
+
+      if (fragments_ != NULLPTR) {
+        std::shared_ptr<DataFragment> fragment;
+        RETURN_NOT_OK(fragments_->Next(&fragment));
+        if (fragment != NULLPTR) {
+          if (scan_context_->fragment_cache != NULLPTR) {
+            RETURN_NOT_OK(
+                scan_context_->fragment_cache->Scan(fragment, scan_context_, &tasks_));
+          } else {
+            RETURN_NOT_OK(fragment->Scan(scan_context_, &tasks_));
+          }
+          continue;
+        }
+        fragments_.reset();
+      }
+
+      if (next_source_ == sources_.size()) {
+        *out = NULLPTR;
+        return Status::OK();
+      }
+      fragments_ = sources_[next_source_++]->GetFragments(scan_options_);
+    }
+  }
+
+ private:
+  std::vector<std::shared_ptr<DataSource>> sources_;
+  std::shared_ptr<ScanOptions> scan_options_;
+  std::shared_ptr<ScanContext> scan_context_;
+  size_t next_source_ = 0;
+  std::unique_ptr<DataFragmentIterator> fragments_;
+  std::unique_ptr<ScanTaskIterator> tasks_;
+};
+
+/// \brief Yield the batches of each ScanTask in turn, on the calling thread
+class SerialScanIterator : public RecordBatchIterator {
+ public:
+  explicit SerialScanIterator(std::unique_ptr<ScanTaskIterator> tasks)
+      : tasks_(std::move(tasks)) {}
+
+  Status Next(std::shared_ptr<RecordBatch>* out) override {
+    for (;;) {
+      if (batches_ != NULLPTR) {
+        RETURN_NOT_OK(batches_->Next(out));
+        if (*out != NULLPTR) {
+          return Status::OK();
+        }
+        batches_.reset();
+      }
+
+      std::unique_ptr<ScanTask> task;
+      RETURN_NOT_OK(tasks_->Next(&task));
+      if (task == NULLPTR) {
+        *out = NULLPTR;
+        return Status::OK();
+      }
+      batches_ = task->Scan();
+    }
+  }
+
+ private:
+  std::unique_ptr<ScanTaskIterator> tasks_;
+  std::unique_ptr<RecordBatchIterator> batches_;
+};
+
+/// \brief Run ScanTasks on a thread pool and yield their batches.
+///
+/// A ScanTask stays in flight until its batches are handed to the consumer, and
+/// no more than max_in_flight ScanTasks are in flight at any time.
+class ThreadedScanIterator : public RecordBatchIterator {
+ public:
+  ThreadedScanIterator(std::unique_ptr<ScanTaskIterator> tasks, ThreadPool* pool,
+                       int max_in_flight, bool ordered)
+      : tasks_(std::move(tasks)),
+        pool_(pool),
+        max_in_flight_(max_in_flight),
+        ordered_(ordered),
+        state_(std::make_shared<State>()) {}
+
+  ~ThreadedScanIterator() override {
+    // The running ScanTasks may refer to data owned by the DataFragments
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->cv.wait(lock, [this] { return state_->num_running == 0; });
+  }
+
+  Status Next(std::shared_ptr<RecordBatch>* out) override {
+    while (batches_.empty()) {
+      RETURN_NOT_OK(status_);
+      if (finished_) {
+        *out = NULLPTR;
+        return Status::OK();
+      }
+      status_ = NextTask();
+    }
+    *out = std::move(batches_.front());
+    batches_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  struct Slot {
+    bool done = false;
+    Status status;
+    RecordBatchVector batches;
+  };
+
+  struct State {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int num_running = 0;
+  };
+
+  Status Dispatch() {
+    while (!tasks_exhausted_ && static_cast<int>(slots_.size()) < max_in_flight_) {
+      std::unique_ptr<ScanTask> next;
+      RETURN_NOT_OK(tasks_->Next(&next));
+      if (next == NULLPTR) {
+        tasks_exhausted_ = true;
+        break;
+      }
+
+      std::shared_ptr<ScanTask> task(std::move(next));
+      auto slot = std::make_shared<Slot>();
+      auto state = state_;
+      {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        ++state_->num_running;
+      }
+      Status st = pool_->Spawn([task, slot, state] {
+        RecordBatchVector batches;
+        Status status = CollectBatches(task.get(), &batches);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        slot->status = std::move(status);
+        slot->batches = std::move(batches);
+        slot->done = true;
+        --state->num_running;
+        state->cv.notify_all();
+      });
+      if (!st.ok()) {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        --state_->num_running;
+        return st;
+      }
+      slots_.push_back(std::move(slot));
+    }
+    return Status::OK();
+  }
+
+  // Wait for the next ScanTask to complete, the oldest one if ordered, and
+  // take its batches
+  Status NextTask() {
+    RETURN_NOT_OK(Dispatch());
+    if (slots_.empty()) {
+      finished_ = true;
+      return Status::OK();
+    }
+
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    auto ready = slots_.begin();
+    state_->cv.wait(lock, [this, &ready] {
+      ready = ordered_ ? slots_.begin()
+                       : std::find_if(slots_.begin(), slots_.end(),
+                                      [](const std::shared_ptr<Slot>& slot) {
+                                        return slot->done;
+                                      });
+      return ready != slots_.end() && (*ready)->done;
+    });
+    std::shared_ptr<Slot> slot = std::move(*ready);
+    slots_.erase(ready);
+    lock.unlock();
+
+    RETURN_NOT_OK(slot->status);
+    batches_.assign(slot->batches.begin(), slot->batches.end());
+    return Status::OK();
+  }
+
+  std::unique_ptr<ScanTaskIterator> tasks_;
+  ThreadPool* pool_;
+  int max_in_flight_;
+  bool ordered_;
+  bool tasks_exhausted_ = false;
+  bool finished_ = false;
+  Status status_;
+
+  std::shared_ptr<State> state_;
+  // The ScanTasks in flight, in dispatch order
+  std::deque<std::shared_ptr<Slot>> slots_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+};
+
+}  // namespace
+
+Status CountScannedRows(ScanTaskIterator* tasks, int64_t* out) {
+  int64_t num_rows = 0;
+  RETURN_NOT_OK(tasks->Visit([&num_rows](std::unique_ptr<ScanTask> task) {
+    int64_t task_rows;
+    RETURN_NOT_OK(CountTaskRows(task.get(), &task_rows));
+    num_rows += task_rows;
+    return Status::OK();
+  }));
+  *out = num_rows;
+  return Status::OK();
+}
+
+Status Scanner::ToBatches(std::unique_ptr<RecordBatchIterator>* out) {
+  if (!scan_context_->use_threads) {
+    *out = internal::make_unique<SerialScanIterator>(Scan());
+    return Status::OK();
+  }
+
+  ThreadPool* pool = GetCpuThreadPool();
+  int max_in_flight = scan_context_->max_tasks_in_flight;
+  if (max_in_flight < 0) {
+    return Status::Invalid("max_tasks_in_flight must be positive, got ", max_in_flight);
+  }
+  if (max_in_flight == 0) {
+    max_in_flight = pool->GetCapacity();
+  }
+  *out = internal::make_unique<ThreadedScanIterator>(Scan(), pool, max_in_flight,
+                                                     scan_context_->ordered);
+  return Status::OK();
+}
+
+Status Scanner::ToTable(std::shared_ptr<Table>* out) {
+  auto task_group = MakeTaskGroup(*scan_context_);
+
+  // Every ScanTask collects its batches separately, which preserves their order
+  std::vector<std::shared_ptr<RecordBatchVector>> task_batches;
+  Status st = Scan()->Visit([&](std::unique_ptr<ScanTask> next) {
+    std::shared_ptr<ScanTask> task(std::move(next));
+    auto batches = std::make_shared<RecordBatchVector>();
+    task_batches.push_back(batches);
+    task_group->Append(
+        [task, batches] { return CollectBatches(task.get(), batches.get()); });
+    return task_group->current_status();
+  });
+  // Wait for the appended tasks even when the iteration failed
+  Status finish_st = task_group->Finish();
+  RETURN_NOT_OK(st);
+  RETURN_NOT_OK(finish_st);
+
+  RecordBatchVector batches;
+  for (const auto& batches_of_task : task_batches) {
+    batches.insert(batches.end(), batches_of_task->begin(), batches_of_task->end());
+  }
+  if (schema_ != NULLPTR) {
+    return Table::FromRecordBatches(schema_, batches, out);
+  }
+  if (batches.empty()) {
+    return Status::Invalid("Cannot build a Table from an empty scan without a schema");
+  }
+  return Table::FromRecordBatches(batches, out);
+}
+
+Status Scanner::CountRows(int64_t* out) {
+  auto task_group = MakeTaskGroup(*scan_context_);
+  auto num_rows = std::make_shared<std::atomic<int64_t>>(0);
+  Status st = Scan()->Visit([&](std::unique_ptr<ScanTask> next) {
+    std::shared_ptr<ScanTask> task(std::move(next));
+    task_group->Append([task, num_rows] {
+      int64_t task_rows;
+      RETURN_NOT_OK(CountTaskRows(task.get(), &task_rows));
+      *num_rows += task_rows;
+      return Status::OK();
+    });
+    return task_group->current_status();
+  });
+  // Wait for the appended tasks even when the iteration failed
+  Status finish_st = task_group->Finish();
+  RETURN_NOT_OK(st);
+  RETURN_NOT_OK(finish_st);
+  *out = num_rows->load();
+  return Status::OK();
+}
+
+SimpleScanner::SimpleScanner(std::vector<std::shared_ptr<DataSource>> sources,
+                             std::shared_ptr<ScanOptions> scan_options,
+                             std::shared_ptr<ScanContext> scan_context,
+                             std::shared_ptr<Schema> schema)
+    : Scanner(std::move(scan_options), std::move(scan_context), std::move(schema)),
+      sources_(std::move(sources)) {}
+
+std::unique_ptr<ScanTaskIterator> SimpleScanner::Scan() {
+  return internal::make_unique<SimpleScanTaskIterator>(sources_, scan_options_,
+                                                       scan_context_);
+}
+
+Status SimpleScanner::CountRows(int64_t* out) {
+  auto task_group = MakeTaskGroup(*scan_context_);
+  auto num_rows = std::make_shared<std::atomic<int64_t>>(0);
+  auto context = scan_context_;
+  Status st;
+  for (const auto& source : sources_) {
+    st = source->GetFragments(scan_options_)
+             ->Visit([&](std::shared_ptr<DataFragment> fragment) {
+               task_group->Append([fragment, context, num_rows] {
+                 int64_t fragment_rows;
+                 RETURN_NOT_OK(fragment->CountRows(context, &fragment_rows));
+                 *num_rows += fragment_rows;
+                 return Status::OK();
+               });
+               return task_group->current_status();
+             });
+    if (!st.ok()) {
+      break;
+    }
+  }
+  // Wait for the appended tasks even when the iteration failed
+  Status finish_st = task_group->Finish();
+  RETURN_NOT_OK(st);
+  RETURN_NOT_OK(finish_st);
+  *out = num_rows->load();
+  return Status::OK();
+}
+
+ScannerBuilder::ScannerBuilder(std::shared_ptr<Dataset> dataset,
+                               std::shared_ptr<ScanContext> scan_context)
+    : dataset_(std::move(dataset)),
+      scan_context_(std::move(scan_context)),
+      include_partition_keys_(true) {}
+
+ScannerBuilder* ScannerBuilder::Project(const std::vector<std::string>& columns) {
+  project_columns_ = columns;
+  return this;
+}
+
+ScannerBuilder* ScannerBuilder::AddFilter(const std::shared_ptr<Filter>& filter) {
+  filters_.push_back(filter);
+  return this;
+}
+
+ScannerBuilder* ScannerBuilder::SetGlobalFileOptions(
+    std::shared_ptr<FileScanOptions> options) {
+  file_options_ = std::move(options);
+  return this;
+}
+
+ScannerBuilder* ScannerBuilder::IncludePartitionKeys(bool include) {
+  include_partition_keys_ = include;
+  return this;
+}
+
+std::unique_ptr<Scanner> ScannerBuilder::Finish() const {
+  std::shared_ptr<ScanOptions> options = file_options_;
+  if (options == NULLPTR) {
+    options = std::make_shared<ScanOptions>();
+  }
+  options->selector_ = std::make_shared<DataSelector>();
+  options->selector_->filters = filters_;
+  options->projected_columns_ = project_columns_;
+  options->include_partition_keys_ = include_partition_keys_;
+
+  return internal::make_unique<SimpleScanner>(dataset_->sources(), std::move(options),
+                                              scan_context_, dataset_->schema());
+}
+
 }  // namespace dataset
 }  // namespace arrow
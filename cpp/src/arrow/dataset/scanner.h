@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -25,20 +27,52 @@
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/memory_pool.h"
+#include "arrow/util/iterator.h"
 
 namespace arrow {
 namespace dataset {
 
+/// \brief Counters aggregated over a Scan operation, updated concurrently by
+/// its ScanTasks
+struct ARROW_DS_EXPORT ScanStatistics {
+  /// \brief Bytes of data selected for reading, as stored in the files
+  std::atomic<int64_t> bytes_read{0};
+
+  /// \brief Bytes of data which the projection and the filters allowed to
+  /// skip, as stored in the files
+  std::atomic<int64_t> bytes_skipped{0};
+};
+
 /// \brief Shared state for a Scan operation
 struct ARROW_DS_EXPORT ScanContext {
   MemoryPool* pool = arrow::default_memory_pool();
+
+  std::shared_ptr<ScanStatistics> statistics = std::make_shared<ScanStatistics>();
+
+  /// \brief If true (default), Scanner::ToTable and Scanner::ToBatches run
+  /// the ScanTasks on the CPU thread pool
+  bool use_threads = true;
+
+  /// \brief Maximum number of ScanTasks running or holding batches not yet
+  /// consumed. If 0 (default), the capacity of the CPU thread pool is used.
+  int max_tasks_in_flight = 0;
+
+  /// \brief If true (default), Scanner::ToBatches yields the batches in the
+  /// order of the ScanTasks. Otherwise the batches of the first completed
+  /// ScanTask come first.
+  bool ordered = true;
+
+  /// \brief If set, the batches of file fragments are scanned through this
+  /// cache, which may be shared by several scans
+  std::shared_ptr<FragmentCache> fragment_cache;
 };
 
 // TODO(wesm): API for handling of post-materialization filters. For
 // example, if the user requests [$col1 > 0, $col2 > 0] and $col1 is a
 // partition key, but $col2 is not, then the filter "$col2 > 0" must
 // be evaluated in-memory against the RecordBatch objects resulting
-// from the Scan
+// from the Scan. For now the filters only prune the partitions whose
+// keys cannot satisfy them.
 
 class ARROW_DS_EXPORT ScanOptions {
  public:
@@ -46,9 +80,22 @@ class ARROW_DS_EXPORT ScanOptions {
 
   const std::shared_ptr<DataSelector>& selector() const { return selector_; }
 
+  /// \brief The names of the columns to read, all of them if empty
+  const std::vector<std::string>& projected_columns() const {
+    return projected_columns_;
+  }
+
+  /// \brief Whether partitions append their key to the scanned batches, as
+  /// constant columns
+  bool include_partition_keys() const { return include_partition_keys_; }
+
  protected:
+  friend class ScannerBuilder;
+
   // Filters
   std::shared_ptr<DataSelector> selector_;
+  std::vector<std::string> projected_columns_;
+  bool include_partition_keys_ = false;
 };
 
 /// \brief Read record batches from a range of a single data fragment. A
@@ -64,6 +111,10 @@ class ARROW_DS_EXPORT ScanTask {
   virtual ~ScanTask() = default;
 };
 
+/// \brief Count the rows of the batches of the ScanTasks, scanning them in
+/// turn on the calling thread
+ARROW_DS_EXPORT Status CountScannedRows(ScanTaskIterator* tasks, int64_t* out);
+
 /// \brief A trivial ScanTask that yields the RecordBatch of an array.
 class ARROW_DS_EXPORT SimpleScanTask : public ScanTask {
  public:
@@ -83,7 +134,70 @@ class ARROW_DS_EXPORT Scanner {
   /// serial or parallel execution of units of scanning work
   virtual std::unique_ptr<ScanTaskIterator> Scan() = 0;
 
+  /// \brief Run the ScanTasks and return an iterator of the resulting
+  /// RecordBatches.
+  ///
+  /// When ScanContext::use_threads is set, the ScanTasks are dispatched on the
+  /// CPU thread pool, at most ScanContext::max_tasks_in_flight at a time. A
+  /// new task is only dispatched when the batches of a previous one have been
+  /// consumed, so that a slow consumer bounds the memory held by the scan.
+  Status ToBatches(std::unique_ptr<RecordBatchIterator>* out);
+
+  /// \brief Run the ScanTasks and collect the resulting RecordBatches, in
+  /// the order of the ScanTasks, into a Table
+  Status ToTable(std::shared_ptr<Table>* out);
+
+  /// \brief Count the rows which ToTable would collect
+  ///
+  /// The default implementation runs the ScanTasks, in parallel when
+  /// ScanContext::use_threads is set, and counts their batches.
+  virtual Status CountRows(int64_t* out);
+
+  /// \brief The schema of the resulting RecordBatches, may be nullptr if
+  /// unknown
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+  /// \brief The options of the scan, such as its filters, may be nullptr
+  const std::shared_ptr<ScanOptions>& options() const { return scan_options_; }
+
+  const std::shared_ptr<ScanContext>& context() const { return scan_context_; }
+
   virtual ~Scanner() = default;
+
+ protected:
+  Scanner(std::shared_ptr<ScanOptions> scan_options,
+          std::shared_ptr<ScanContext> scan_context, std::shared_ptr<Schema> schema)
+      : scan_options_(std::move(scan_options)),
+        scan_context_(std::move(scan_context)),
+        schema_(std::move(schema)) {}
+
+  std::shared_ptr<ScanOptions> scan_options_;
+  std::shared_ptr<ScanContext> scan_context_;
+  std::shared_ptr<Schema> schema_;
+};
+
+/// \brief A Scanner yielding the ScanTasks of every DataFragment of a
+/// sequence of DataSources.
+class ARROW_DS_EXPORT SimpleScanner : public Scanner {
+ public:
+  /// \param[in] sources the data sources to scan
+  /// \param[in] scan_options options for selecting the fragments, may be nullptr
+  /// \param[in] scan_context shared state of the scan
+  /// \param[in] schema the schema of the scanned batches, may be nullptr
+  SimpleScanner(std::vector<std::shared_ptr<DataSource>> sources,
+                std::shared_ptr<ScanOptions> scan_options,
+                std::shared_ptr<ScanContext> scan_context,
+                std::shared_ptr<Schema> schema = NULLPTR);
+
+  std::unique_ptr<ScanTaskIterator> Scan() override;
+
+  /// \brief Count the rows of each DataFragment with DataFragment::CountRows,
+  /// so that e.g. Parquet files are counted from their metadata. The
+  /// fragments are counted in parallel when ScanContext::use_threads is set.
+  Status CountRows(int64_t* out) override;
+
+ private:
+  std::vector<std::shared_ptr<DataSource>> sources_;
 };
 
 class ARROW_DS_EXPORT ScannerBuilder {
@@ -91,16 +205,23 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ScannerBuilder(std::shared_ptr<Dataset> dataset,
                  std::shared_ptr<ScanContext> scan_context);
 
-  /// \brief Set
+  /// \brief Set the columns to read, which formats supporting it push into
+  /// their readers
   ScannerBuilder* Project(const std::vector<std::string>& columns);
 
+  /// \brief Add a filter, which the DataSources evaluate against their
+  /// partition keys, and formats against the statistics of their files, to
+  /// skip the data whose rows cannot satisfy it
   ScannerBuilder* AddFilter(const std::shared_ptr<Filter>& filter);
 
+  /// \brief Use the given options for scanning the files. The filters are
+  /// set on them by Finish()
   ScannerBuilder* SetGlobalFileOptions(std::shared_ptr<FileScanOptions> options);
 
   /// \brief If true (default), add partition keys to the
   /// RecordBatches that the scan produces if they are not in the data
-  /// otherwise
+  /// otherwise. The key columns are one-entry dictionary arrays, whose
+  /// indices are shared between batches, see PartitionKeyDataFragment
   ScannerBuilder* IncludePartitionKeys(bool include = true);
 
   /// \brief Return the constructed now-immutable Scanner object
@@ -111,6 +232,7 @@ class ARROW_DS_EXPORT ScannerBuilder {
   std::shared_ptr<ScanContext> scan_context_;
   std::vector<std::string> project_columns_;
   FilterVector filters_;
+  std::shared_ptr<FileScanOptions> file_options_;
   bool include_partition_keys_;
 };
 
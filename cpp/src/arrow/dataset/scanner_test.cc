@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/scanner.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/test_util.h"
+#include "arrow/table.h"
+
+namespace arrow {
+namespace dataset {
+
+/// \brief A ScanTask failing when its batches are read
+class FailingScanTask : public ScanTask {
+ public:
+  std::unique_ptr<RecordBatchIterator> Scan() override {
+    return internal::make_unique<EmptyIterator<std::shared_ptr<RecordBatch>>>(
+        Status::IOError("scan task failed"));
+  }
+};
+
+class FailingDataFragment : public DataFragment {
+ public:
+  Status Scan(std::shared_ptr<ScanContext> scan_context,
+              std::unique_ptr<ScanTaskIterator>* out) override {
+    // MakeVectorIterator copies its elements, so map a vector of a single
+    // placeholder instead
+    std::vector<std::shared_ptr<int>> placeholder{std::make_shared<int>(0)};
+    auto fn = [](std::shared_ptr<int>) -> std::unique_ptr<ScanTask> {
+      return internal::make_unique<FailingScanTask>();
+    };
+    *out = MakeMapIterator(fn, MakeVectorIterator(std::move(placeholder)));
+    return Status::OK();
+  }
+
+  bool splittable() const override { return false; }
+
+  std::shared_ptr<ScanOptions> scan_options() const override { return NULLPTR; }
+};
+
+/// \brief A DataFragment whose rows are counted by scanning it
+class ScannedDataFragment : public DataFragment {
+ public:
+  explicit ScannedDataFragment(std::vector<std::shared_ptr<RecordBatch>> batches)
+      : fragment_(std::move(batches)) {}
+
+  Status Scan(std::shared_ptr<ScanContext> scan_context,
+              std::unique_ptr<ScanTaskIterator>* out) override {
+    return fragment_.Scan(std::move(scan_context), out);
+  }
+
+  bool splittable() const override { return false; }
+
+  std::shared_ptr<ScanOptions> scan_options() const override { return NULLPTR; }
+
+ private:
+  SimpleDataFragment fragment_;
+};
+
+class TestSimpleScanner : public DatasetFixtureMixin {
+ public:
+  void SetUp() override {
+    schema_ = schema({field("i32", int32())});
+    // A batch per ScanTask, each holding distinct values so that the order of
+    // the output can be checked
+    DataFragmentVector fragments;
+    for (int i = 0; i < kNumberFragments; ++i) {
+      std::vector<std::shared_ptr<RecordBatch>> fragment_batches;
+      for (int j = 0; j < kNumberBatches; ++j) {
+        auto value = std::to_string(i * kNumberBatches + j);
+        auto array = ArrayFromJSON(int32(), "[" + value + ", " + value + "]");
+        fragment_batches.push_back(RecordBatch::Make(schema_, 2, {array}));
+      }
+      batches_.insert(batches_.end(), fragment_batches.begin(), fragment_batches.end());
+      fragments.push_back(std::make_shared<SimpleDataFragment>(fragment_batches));
+    }
+    sources_.push_back(std::make_shared<SimpleDataSource>(fragments));
+  }
+
+  std::unique_ptr<Scanner> MakeScanner(std::shared_ptr<Schema> schema = NULLPTR) {
+    return internal::make_unique<SimpleScanner>(sources_, options_, ctx_, schema);
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> ReadAll(Scanner* scanner) {
+    std::unique_ptr<RecordBatchIterator> it;
+    ARROW_EXPECT_OK(scanner->ToBatches(&it));
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ARROW_EXPECT_OK(it->Visit([&batches](std::shared_ptr<RecordBatch> batch) {
+      batches.push_back(std::move(batch));
+      return Status::OK();
+    }));
+    return batches;
+  }
+
+  void AssertBatchesEqual(const std::vector<std::shared_ptr<RecordBatch>>& expected,
+                          const std::vector<std::shared_ptr<RecordBatch>>& actual) {
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ::arrow::AssertBatchesEqual(*expected[i], *actual[i]);
+    }
+  }
+
+ protected:
+  static constexpr int kNumberFragments = 8;
+  static constexpr int kNumberBatches = 4;
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  std::vector<std::shared_ptr<DataSource>> sources_;
+};
+
+TEST_F(TestSimpleScanner, ToBatches) {
+  for (int max_tasks_in_flight : {0, 1, 3}) {
+    ctx_->max_tasks_in_flight = max_tasks_in_flight;
+    auto scanner = MakeScanner();
+    AssertBatchesEqual(batches_, ReadAll(scanner.get()));
+  }
+}
+
+TEST_F(TestSimpleScanner, ToBatchesSerial) {
+  ctx_->use_threads = false;
+  auto scanner = MakeScanner();
+  AssertBatchesEqual(batches_, ReadAll(scanner.get()));
+}
+
+TEST_F(TestSimpleScanner, ToBatchesUnordered) {
+  ctx_->ordered = false;
+  auto scanner = MakeScanner();
+  auto batches = ReadAll(scanner.get());
+  ASSERT_EQ(batches.size(), batches_.size());
+  // Every batch is yielded once, in any order
+  for (const auto& expected : batches_) {
+    auto count = std::count_if(batches.begin(), batches.end(),
+                               [&expected](const std::shared_ptr<RecordBatch>& batch) {
+                                 return batch->Equals(*expected);
+                               });
+    ASSERT_EQ(count, 1);
+  }
+}
+
+TEST_F(TestSimpleScanner, ToBatchesStopEarly) {
+  ctx_->max_tasks_in_flight = 2;
+  auto scanner = MakeScanner();
+  std::unique_ptr<RecordBatchIterator> it;
+  ASSERT_OK(scanner->ToBatches(&it));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(it->Next(&batch));
+  ::arrow::AssertBatchesEqual(*batches_[0], *batch);
+  // Destroying the iterator waits for the ScanTasks in flight
+  it.reset();
+}
+
+TEST_F(TestSimpleScanner, ToTable) {
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches(batches_, &expected));
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    std::shared_ptr<Table> actual;
+    ASSERT_OK(MakeScanner()->ToTable(&actual));
+    AssertTablesEqual(*expected, *actual);
+  }
+}
+
+TEST_F(TestSimpleScanner, ToTableEmpty) {
+  sources_ = {std::make_shared<SimpleDataSource>(DataFragmentVector{})};
+
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, MakeScanner()->ToTable(&table));
+
+  ASSERT_OK(MakeScanner(schema_)->ToTable(&table));
+  ASSERT_EQ(table->num_rows(), 0);
+  AssertSchemaEqual(*schema_, *table->schema());
+}
+
+TEST_F(TestSimpleScanner, CountRows) {
+  // A fragment counted by scanning it, next to the SimpleDataFragments which
+  // count their batches
+  auto batch = RecordBatch::Make(schema_, 3, {ArrayFromJSON(int32(), "[1, 2, 3]")});
+  sources_.push_back(std::make_shared<SimpleDataSource>(DataFragmentVector{
+      std::make_shared<ScannedDataFragment>(
+          std::vector<std::shared_ptr<RecordBatch>>{batch, batch})}));
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    int64_t num_rows;
+    ASSERT_OK(MakeScanner()->CountRows(&num_rows));
+    ASSERT_EQ(num_rows, kNumberFragments * kNumberBatches * 2 + 6);
+  }
+
+  sources_ = {std::make_shared<SimpleDataSource>(DataFragmentVector{})};
+  int64_t num_rows;
+  ASSERT_OK(MakeScanner()->CountRows(&num_rows));
+  ASSERT_EQ(num_rows, 0);
+}
+
+TEST_F(TestSimpleScanner, FailingScanTask) {
+  sources_.push_back(std::make_shared<SimpleDataSource>(
+      DataFragmentVector{std::make_shared<FailingDataFragment>()}));
+
+  for (bool use_threads : {false, true}) {
+    ctx_->use_threads = use_threads;
+    std::shared_ptr<Table> table;
+    ASSERT_RAISES(IOError, MakeScanner()->ToTable(&table));
+    int64_t num_rows;
+    ASSERT_RAISES(IOError, MakeScanner()->CountRows(&num_rows));
+
+    std::unique_ptr<RecordBatchIterator> it;
+    ASSERT_OK(MakeScanner()->ToBatches(&it));
+    ASSERT_RAISES(IOError, it->Visit([](std::shared_ptr<RecordBatch>) {
+      return Status::OK();
+    }));
+  }
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -44,14 +44,18 @@ struct DiscoveryOptions;
 
 class FileBasedDataFragment;
 class FileFormat;
+class FileFormatWriter;
 class FileScanOptions;
 class FileWriteOptions;
 
+class FragmentCache;
+
 class Filter;
 using FilterVector = std::vector<std::shared_ptr<Filter>>;
 
 class Partition;
 class PartitionKey;
+struct PartitionKeyData;
 class PartitionScheme;
 using PartitionVector = std::vector<std::shared_ptr<Partition>>;
 using PartitionIterator = Iterator<std::shared_ptr<Partition>>;
@@ -64,6 +68,7 @@ class ScanTask;
 using ScanTaskIterator = Iterator<std::unique_ptr<ScanTask>>;
 
 class DatasetWriter;
+struct DatasetWriterOptions;
 class WriteContext;
 class WriteOptions;
 
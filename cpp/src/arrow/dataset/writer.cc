@@ -0,0 +1,332 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/writer.h"
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+namespace {
+
+// The directory name Hive uses for rows whose partition value is null
+const char kNullPartitionValue[] = "__HIVE_DEFAULT_PARTITION__";
+
+bool IsSupportedPartitionType(const DataType& type) {
+  return is_integer(type.id()) || type.id() == Type::BOOL || type.id() == Type::STRING;
+}
+
+template <typename ArrayType>
+Status FormatValue(const ArrayType& values, int64_t i, std::string* out) {
+  *out += std::to_string(values.Value(i));
+  return Status::OK();
+}
+
+Status FormatValue(const BooleanArray& values, int64_t i, std::string* out) {
+  *out += values.Value(i) ? "true" : "false";
+  return Status::OK();
+}
+
+Status FormatValue(const StringArray& values, int64_t i, std::string* out) {
+  auto value = values.GetString(i);
+  if (value.empty() || value.find(fs::internal::kSep) != std::string::npos) {
+    return Status::Invalid("Partition value '", value,
+                           "' cannot be used as a directory name");
+  }
+  *out += value;
+  return Status::OK();
+}
+
+// Append the "name=value" path segment of each row of a partition column to the
+// partition directory of that row
+template <typename ArrayType>
+Status AppendSegments(const std::string& name, const Array& column,
+                      std::vector<std::string>* dirs) {
+  const auto& values = checked_cast<const ArrayType&>(column);
+  for (int64_t i = 0; i < values.length(); ++i) {
+    std::string* dir = &(*dirs)[i];
+    if (!dir->empty()) {
+      dir->push_back(fs::internal::kSep);
+    }
+    *dir += name;
+    dir->push_back('=');
+    if (values.IsNull(i)) {
+      *dir += kNullPartitionValue;
+    } else {
+      RETURN_NOT_OK(FormatValue(values, i, dir));
+    }
+  }
+  return Status::OK();
+}
+
+Status AppendSegments(const std::string& name, const Array& column,
+                      std::vector<std::string>* dirs) {
+  switch (column.type_id()) {
+    case Type::BOOL:
+      return AppendSegments<BooleanArray>(name, column, dirs);
+    case Type::INT8:
+      return AppendSegments<Int8Array>(name, column, dirs);
+    case Type::INT16:
+      return AppendSegments<Int16Array>(name, column, dirs);
+    case Type::INT32:
+      return AppendSegments<Int32Array>(name, column, dirs);
+    case Type::INT64:
+      return AppendSegments<Int64Array>(name, column, dirs);
+    case Type::UINT8:
+      return AppendSegments<UInt8Array>(name, column, dirs);
+    case Type::UINT16:
+      return AppendSegments<UInt16Array>(name, column, dirs);
+    case Type::UINT32:
+      return AppendSegments<UInt32Array>(name, column, dirs);
+    case Type::UINT64:
+      return AppendSegments<UInt64Array>(name, column, dirs);
+    case Type::STRING:
+      return AppendSegments<StringArray>(name, column, dirs);
+    default:
+      break;
+  }
+  return Status::NotImplemented("Partitioning by column of type ",
+                                column.type()->ToString());
+}
+
+}  // namespace
+
+struct DatasetWriter::OpenFile {
+  std::shared_ptr<io::OutputStream> sink;
+  std::unique_ptr<FileFormatWriter> writer;
+  std::list<std::string>::iterator lru_position;
+};
+
+DatasetWriter::DatasetWriter(fs::FileSystem* filesystem, std::string base_dir,
+                             std::shared_ptr<FileFormat> format,
+                             std::shared_ptr<Schema> schema, DatasetWriterOptions options,
+                             std::vector<int> partition_indices,
+                             std::shared_ptr<Schema> file_schema)
+    : filesystem_(filesystem),
+      base_dir_(std::move(base_dir)),
+      format_(std::move(format)),
+      schema_(std::move(schema)),
+      options_(std::move(options)),
+      partition_indices_(std::move(partition_indices)),
+      file_schema_(std::move(file_schema)) {
+  for (int i = 0; i < schema_->num_fields(); ++i) {
+    if (std::find(partition_indices_.begin(), partition_indices_.end(), i) ==
+        partition_indices_.end()) {
+      file_column_indices_.push_back(i);
+    }
+  }
+}
+
+DatasetWriter::~DatasetWriter() {
+  Status st = Close();
+  if (!st.ok()) {
+    ARROW_LOG(WARNING) << "Failed to close dataset files: " << st.ToString();
+  }
+}
+
+Status DatasetWriter::Make(fs::FileSystem* filesystem, std::string base_dir,
+                           std::shared_ptr<FileFormat> format,
+                           std::shared_ptr<Schema> schema, DatasetWriterOptions options,
+                           std::unique_ptr<DatasetWriter>* out) {
+  if (options.max_open_files < 1) {
+    return Status::Invalid("max_open_files must be positive");
+  }
+
+  std::vector<int> partition_indices;
+  for (const auto& name : options.partition_columns) {
+    int i = schema->GetFieldIndex(name);
+    if (i == -1) {
+      return Status::Invalid("Partition column '", name, "' is not in schema ",
+                             schema->ToString());
+    }
+    if (!IsSupportedPartitionType(*schema->field(i)->type())) {
+      return Status::NotImplemented("Partitioning by column '", name, "' of type ",
+                                    schema->field(i)->type()->ToString());
+    }
+    partition_indices.push_back(i);
+  }
+
+  std::vector<std::shared_ptr<Field>> file_fields;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if (std::find(partition_indices.begin(), partition_indices.end(), i) ==
+        partition_indices.end()) {
+      file_fields.push_back(schema->field(i));
+    }
+  }
+  auto file_schema = ::arrow::schema(std::move(file_fields), schema->metadata());
+
+  out->reset(new DatasetWriter(filesystem, std::move(base_dir), std::move(format),
+                               std::move(schema), std::move(options),
+                               std::move(partition_indices), std::move(file_schema)));
+  return Status::OK();
+}
+
+Status DatasetWriter::Write(const RecordBatch& batch) {
+  if (!batch.schema()->Equals(*schema_, false)) {
+    return Status::Invalid("Cannot write batch with schema ", batch.schema()->ToString(),
+                           " to dataset with schema ", schema_->ToString());
+  }
+  if (batch.num_rows() == 0) {
+    return Status::OK();
+  }
+
+  std::vector<std::shared_ptr<Array>> file_columns;
+  for (int i : file_column_indices_) {
+    file_columns.push_back(batch.column(i));
+  }
+
+  if (partition_indices_.empty()) {
+    auto file_batch = RecordBatch::Make(file_schema_, batch.num_rows(), file_columns);
+    return WritePartition("", *file_batch);
+  }
+
+  // Hash the rows by partition directory, keeping the directories in order of
+  // first appearance so that files are opened deterministically
+  std::vector<std::string> row_dirs(static_cast<size_t>(batch.num_rows()));
+  for (int i : partition_indices_) {
+    RETURN_NOT_OK(AppendSegments(schema_->field(i)->name(), *batch.column(i), &row_dirs));
+  }
+
+  std::unordered_map<std::string, size_t> group_ids;
+  std::vector<std::string> group_dirs;
+  std::vector<std::vector<int64_t>> group_rows;
+  for (int64_t row = 0; row < batch.num_rows(); ++row) {
+    auto inserted = group_ids.emplace(std::move(row_dirs[row]), group_dirs.size());
+    if (inserted.second) {
+      group_dirs.push_back(inserted.first->first);
+      group_rows.emplace_back();
+    }
+    group_rows[inserted.first->second].push_back(row);
+  }
+
+  if (group_dirs.size() == 1) {
+    auto file_batch = RecordBatch::Make(file_schema_, batch.num_rows(), file_columns);
+    return WritePartition(group_dirs[0], *file_batch);
+  }
+
+  compute::FunctionContext ctx(options_.pool);
+  for (size_t group = 0; group < group_dirs.size(); ++group) {
+    Int64Builder builder(options_.pool);
+    std::shared_ptr<Array> indices;
+    RETURN_NOT_OK(builder.AppendValues(group_rows[group]));
+    RETURN_NOT_OK(builder.Finish(&indices));
+
+    std::vector<std::shared_ptr<Array>> taken(file_columns.size());
+    for (size_t i = 0; i < file_columns.size(); ++i) {
+      RETURN_NOT_OK(compute::Take(&ctx, *file_columns[i], *indices,
+                                  compute::TakeOptions(), &taken[i]));
+    }
+    auto file_batch = RecordBatch::Make(file_schema_, indices->length(), taken);
+    RETURN_NOT_OK(WritePartition(group_dirs[group], *file_batch));
+  }
+  return Status::OK();
+}
+
+Status DatasetWriter::WritePartition(const std::string& partition_dir,
+                                     const RecordBatch& batch) {
+  auto it = open_files_.find(partition_dir);
+  if (it == open_files_.end()) {
+    RETURN_NOT_OK(OpenPartitionFile(partition_dir));
+    it = open_files_.find(partition_dir);
+  } else {
+    lru_.splice(lru_.begin(), lru_, it->second->lru_position);
+  }
+
+  OpenFile* file = it->second.get();
+  RETURN_NOT_OK(file->writer->Write(batch));
+
+  int64_t size;
+  RETURN_NOT_OK(file->sink->Tell(&size));
+  if (size >= options_.max_file_size) {
+    return ClosePartitionFile(partition_dir);
+  }
+  return Status::OK();
+}
+
+Status DatasetWriter::OpenPartitionFile(const std::string& partition_dir) {
+  if (static_cast<int>(open_files_.size()) >= options_.max_open_files) {
+    RETURN_NOT_OK(ClosePartitionFile(lru_.back()));
+  }
+
+  std::string dir = base_dir_;
+  if (!partition_dir.empty()) {
+    dir = fs::internal::ConcatAbstractPath(base_dir_, partition_dir);
+  }
+  if (!dir.empty()) {
+    RETURN_NOT_OK(filesystem_->CreateDir(dir));
+  }
+
+  int index = file_counts_[partition_dir]++;
+  auto path = fs::internal::ConcatAbstractPath(
+      dir, "part-" + std::to_string(index) + "." + format_->name());
+
+  std::unique_ptr<OpenFile> file(new OpenFile);
+  RETURN_NOT_OK(filesystem_->OpenOutputStream(path, &file->sink));
+  RETURN_NOT_OK(
+      format_->OpenWriter(file->sink, file_schema_, options_.pool, &file->writer));
+  written_files_.push_back(path);
+
+  lru_.push_front(partition_dir);
+  file->lru_position = lru_.begin();
+  open_files_.emplace(partition_dir, std::move(file));
+  return Status::OK();
+}
+
+Status DatasetWriter::ClosePartitionFile(std::string partition_dir) {
+  auto it = open_files_.find(partition_dir);
+  DCHECK(it != open_files_.end());
+  std::unique_ptr<OpenFile> file = std::move(it->second);
+  lru_.erase(file->lru_position);
+  open_files_.erase(it);
+
+  RETURN_NOT_OK(file->writer->Close());
+  return file->sink->Close();
+}
+
+Status DatasetWriter::Close() {
+  Status st;
+  while (!lru_.empty()) {
+    // Close every file even if one of them fails, reporting the first error
+    Status close_st = ClosePartitionFile(lru_.back());
+    if (st.ok()) {
+      st = close_st;
+    }
+  }
+  return st;
+}
+
+}  // namespace dataset
+}  // namespace arrow
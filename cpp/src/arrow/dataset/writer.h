@@ -17,12 +17,17 @@
 
 #pragma once
 
+#include <cstdint>
+#include <list>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/memory_pool.h"
+#include "arrow/type_fwd.h"
 
 namespace arrow {
 namespace dataset {
@@ -32,5 +37,97 @@ class ARROW_DS_EXPORT WriteOptions {
   virtual ~WriteOptions() = default;
 };
 
+/// \brief Write RecordBatches of a single schema into one file of a FileFormat
+class ARROW_DS_EXPORT FileFormatWriter {
+ public:
+  virtual ~FileFormatWriter() = default;
+
+  /// \brief Append a RecordBatch to the file
+  virtual Status Write(const RecordBatch& batch) = 0;
+
+  /// \brief Write any buffered data and the file footer
+  ///
+  /// The sink the writer was opened on is not closed.
+  virtual Status Close() = 0;
+};
+
+/// \brief Options controlling the layout of the files written by a DatasetWriter
+struct ARROW_DS_EXPORT DatasetWriterOptions {
+  /// Columns whose values partition the rows into Hive style directories
+  /// "column=value". These columns are not written to the files themselves.
+  std::vector<std::string> partition_columns;
+
+  /// Maximum number of files open at once. When a new file must be opened, the
+  /// least recently written one is closed first.
+  int max_open_files = 64;
+
+  /// Once a file has grown to at least this many bytes it is closed, and the
+  /// following rows of its partition go to a new file.
+  int64_t max_file_size = static_cast<int64_t>(512) << 20;
+
+  MemoryPool* pool = default_memory_pool();
+};
+
+/// \brief Write a stream of RecordBatches as a partitioned dataset
+///
+/// Rows are grouped by the values of the partition columns of each batch, and
+/// every group is appended to the file currently open for its partition
+/// directory. Files are named "part-N.<format name>" within their directory.
+class ARROW_DS_EXPORT DatasetWriter {
+ public:
+  /// \brief Create a DatasetWriter
+  ///
+  /// \param[in] filesystem the filesystem to write to
+  /// \param[in] base_dir the directory under which partition directories are created
+  /// \param[in] format the format of the written files
+  /// \param[in] schema the schema of the batches to be written
+  /// \param[in] options layout of the written files
+  /// \param[out] out the created writer
+  static Status Make(fs::FileSystem* filesystem, std::string base_dir,
+                     std::shared_ptr<FileFormat> format, std::shared_ptr<Schema> schema,
+                     DatasetWriterOptions options, std::unique_ptr<DatasetWriter>* out);
+
+  ~DatasetWriter();
+
+  /// \brief Partition the rows of a batch and write them to their files
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Close all open files
+  Status Close();
+
+  /// \brief The paths of all the files opened so far, in order of creation
+  const std::vector<std::string>& written_files() const { return written_files_; }
+
+ private:
+  struct OpenFile;
+
+  DatasetWriter(fs::FileSystem* filesystem, std::string base_dir,
+                std::shared_ptr<FileFormat> format, std::shared_ptr<Schema> schema,
+                DatasetWriterOptions options, std::vector<int> partition_indices,
+                std::shared_ptr<Schema> file_schema);
+
+  Status WritePartition(const std::string& partition_dir, const RecordBatch& batch);
+  Status OpenPartitionFile(const std::string& partition_dir);
+  Status ClosePartitionFile(std::string partition_dir);
+
+  fs::FileSystem* filesystem_;
+  std::string base_dir_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<Schema> schema_;
+  DatasetWriterOptions options_;
+  // Indices of the partition columns in schema_, and the schema of the files
+  // written, which is schema_ without those columns
+  std::vector<int> partition_indices_;
+  std::vector<int> file_column_indices_;
+  std::shared_ptr<Schema> file_schema_;
+
+  // Open files by partition directory. lru_ lists those directories, the most
+  // recently written first.
+  std::unordered_map<std::string, std::unique_ptr<OpenFile>> open_files_;
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, int> file_counts_;
+  std::vector<std::string> written_files_;
+};
+
 }  // namespace dataset
 }  // namespace arrow
@@ -0,0 +1,194 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/writer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace dataset {
+
+using fs::internal::MockFileSystem;
+using internal::checked_cast;
+
+// Writes one line of comma separated values per row of int64 and string columns
+class CsvFormatWriter : public FileFormatWriter {
+ public:
+  explicit CsvFormatWriter(std::shared_ptr<io::OutputStream> sink)
+      : sink_(std::move(sink)) {}
+
+  Status Write(const RecordBatch& batch) override {
+    for (int64_t row = 0; row < batch.num_rows(); ++row) {
+      std::string line;
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        const auto& column = *batch.column(i);
+        line += i == 0 ? "" : ",";
+        if (column.type_id() == Type::INT64) {
+          line += std::to_string(checked_cast<const Int64Array&>(column).Value(row));
+        } else {
+          line += checked_cast<const StringArray&>(column).GetString(row);
+        }
+      }
+      line += "\n";
+      RETURN_NOT_OK(sink_->Write(line.data(), static_cast<int64_t>(line.size())));
+    }
+    return Status::OK();
+  }
+
+  Status Close() override { return Status::OK(); }
+
+ private:
+  std::shared_ptr<io::OutputStream> sink_;
+};
+
+class CsvWriteFormat : public FileFormat {
+ public:
+  std::string name() const override { return "csv"; }
+
+  bool IsKnownExtension(const std::string& ext) const override { return ext == name(); }
+
+  Status ScanFile(const FileSource& source, std::shared_ptr<ScanOptions> scan_options,
+                  std::shared_ptr<ScanContext> scan_context,
+                  std::unique_ptr<ScanTaskIterator>* out) const override {
+    return Status::NotImplemented("scanning");
+  }
+
+  Status MakeFragment(const FileSource& source, std::shared_ptr<ScanOptions> opts,
+                      std::unique_ptr<DataFragment>* out) override {
+    return Status::NotImplemented("fragments");
+  }
+
+  Status OpenWriter(std::shared_ptr<io::OutputStream> sink,
+                    std::shared_ptr<Schema> schema, MemoryPool* pool,
+                    std::unique_ptr<FileFormatWriter>* out) const override {
+    *out = internal::make_unique<CsvFormatWriter>(std::move(sink));
+    return Status::OK();
+  }
+};
+
+class TestDatasetWriter : public ::testing::Test {
+ public:
+  void SetUp() override {
+    fs_ = std::make_shared<MockFileSystem>(fs::TimePoint(fs::TimePoint::duration(0)));
+    schema_ = schema({field("region", utf8()), field("value", int64())});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::string& regions,
+                                         const std::string& values) {
+    auto region = ArrayFromJSON(utf8(), regions);
+    return RecordBatch::Make(schema_, region->length(),
+                             {region, ArrayFromJSON(int64(), values)});
+  }
+
+  void MakeWriter(DatasetWriterOptions options) {
+    ASSERT_OK(DatasetWriter::Make(fs_.get(), "base", std::make_shared<CsvWriteFormat>(),
+                                  schema_, std::move(options), &writer_));
+  }
+
+  void AssertFiles(const std::vector<std::pair<std::string, std::string>>& expected) {
+    std::vector<std::pair<std::string, std::string>> actual;
+    for (const auto& file : fs_->AllFiles()) {
+      actual.emplace_back(file.full_path, file.data);
+    }
+    ASSERT_EQ(actual, expected);
+  }
+
+ protected:
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<DatasetWriter> writer_;
+};
+
+TEST_F(TestDatasetWriter, Partitions) {
+  DatasetWriterOptions options;
+  options.partition_columns = {"region"};
+  MakeWriter(options);
+
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["eu", "us", "eu", null])", "[1, 2, 3, 4]")));
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["us"])", "[5]")));
+  ASSERT_OK(writer_->Close());
+
+  AssertFiles({{"base/region=__HIVE_DEFAULT_PARTITION__/part-0.csv", "4\n"},
+               {"base/region=eu/part-0.csv", "1\n3\n"},
+               {"base/region=us/part-0.csv", "2\n5\n"}});
+  std::vector<std::string> expected_order = {
+      "base/region=eu/part-0.csv", "base/region=us/part-0.csv",
+      "base/region=__HIVE_DEFAULT_PARTITION__/part-0.csv"};
+  ASSERT_EQ(writer_->written_files(), expected_order);
+}
+
+TEST_F(TestDatasetWriter, EvictsLeastRecentlyWritten) {
+  DatasetWriterOptions options;
+  options.partition_columns = {"region"};
+  options.max_open_files = 2;
+  MakeWriter(options);
+
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["eu", "us"])", "[1, 2]")));
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["eu"])", "[3]")));
+  // Closes the file of "us", which was written to last before that of "eu"
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["ap"])", "[4]")));
+  // Reopening "us" closes "eu", and "eu" is then reopened in its turn
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["us", "eu"])", "[5, 6]")));
+  ASSERT_OK(writer_->Close());
+
+  AssertFiles({{"base/region=ap/part-0.csv", "4\n"},
+               {"base/region=eu/part-0.csv", "1\n3\n"},
+               {"base/region=eu/part-1.csv", "6\n"},
+               {"base/region=us/part-0.csv", "2\n"},
+               {"base/region=us/part-1.csv", "5\n"}});
+}
+
+TEST_F(TestDatasetWriter, RollsOverFiles) {
+  DatasetWriterOptions options;
+  options.max_file_size = 8;
+  MakeWriter(options);
+
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["eu", "us"])", "[1, 2]")));
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["eu"])", "[3]")));
+  ASSERT_OK(writer_->Write(*MakeBatch(R"(["us"])", "[4]")));
+  ASSERT_OK(writer_->Close());
+
+  AssertFiles({{"base/part-0.csv", "eu,1\nus,2\n"}, {"base/part-1.csv", "eu,3\nus,4\n"}});
+}
+
+TEST_F(TestDatasetWriter, InvalidInput) {
+  DatasetWriterOptions options;
+  options.partition_columns = {"date"};
+  auto format = std::make_shared<CsvWriteFormat>();
+  ASSERT_RAISES(Invalid,
+                DatasetWriter::Make(fs_.get(), "", format, schema_, options, &writer_));
+
+  options.partition_columns = {"region"};
+  MakeWriter(options);
+  ASSERT_RAISES(Invalid, writer_->Write(*MakeBatch(R"(["eu/us"])", "[1]")));
+
+  auto other_schema = schema({field("region", utf8())});
+  auto batch = RecordBatch::Make(other_schema, 1, {ArrayFromJSON(utf8(), R"(["eu"])")});
+  ASSERT_RAISES(Invalid, writer_->Write(*batch));
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -17,12 +17,24 @@
 
 #include "arrow/dbi/hiveserver2/columnar_row_set.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
+#include "arrow/dbi/hiveserver2/types.h"
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
@@ -96,5 +108,264 @@ std::unique_ptr<BinaryColumn> ColumnarRowSet::GetBinaryCol(int i) const {
   return GetCol<BinaryColumn>(i);
 }
 
+// ----------------------------------------------------------------------
+// Conversion to Arrow
+
+namespace {
+
+// A buffer over the memory of a fetched result, which it keeps alive
+class FetchedBuffer : public Buffer {
+ public:
+  FetchedBuffer(std::shared_ptr<const void> owner, const uint8_t* data, int64_t size)
+      : Buffer(data, size), owner_(std::move(owner)) {}
+
+ private:
+  std::shared_ptr<const void> owner_;
+};
+
+// Null bitmaps are set for the nulls, and may be shorter than the values (see
+// HUE-2722). Returns a null validity bitmap if there are no nulls.
+Status ConvertNulls(const std::string& nulls, int64_t length, MemoryPool* pool,
+                    std::shared_ptr<Buffer>* validity, int64_t* null_count) {
+  const int64_t nbytes = BitUtil::BytesForBits(length);
+  const int64_t nulls_size = std::min(nbytes, static_cast<int64_t>(nulls.size()));
+  const uint8_t* null_bits = reinterpret_cast<const uint8_t*>(nulls.data());
+  *null_count = 0;
+  if (nulls_size > 0) {
+    *null_count = internal::CountSetBits(null_bits, 0,
+                                         std::min(length, nulls_size * 8));
+  }
+  if (*null_count == 0) {
+    *validity = nullptr;
+    return Status::OK();
+  }
+  RETURN_NOT_OK(AllocateBuffer(pool, nbytes, validity));
+  uint8_t* out = (*validity)->mutable_data();
+  for (int64_t i = 0; i < nulls_size; ++i) {
+    out[i] = static_cast<uint8_t>(~null_bits[i]);
+  }
+  std::memset(out + nulls_size, 0xFF, nbytes - nulls_size);
+  return Status::OK();
+}
+
+template <typename T>
+Status ConvertValues(const std::shared_ptr<const void>& owner,
+                     const std::vector<T>& values, std::shared_ptr<Buffer>* out) {
+  *out = std::make_shared<FetchedBuffer>(
+      owner, reinterpret_cast<const uint8_t*>(values.data()),
+      static_cast<int64_t>(values.size() * sizeof(T)));
+  return Status::OK();
+}
+
+Status ConvertBooleans(const std::vector<bool>& values, MemoryPool* pool,
+                       std::shared_ptr<Buffer>* out) {
+  const int64_t length = static_cast<int64_t>(values.size());
+  RETURN_NOT_OK(AllocateBuffer(pool, BitUtil::BytesForBits(length), out));
+  internal::FirstTimeBitmapWriter writer((*out)->mutable_data(), 0, length);
+  for (bool value : values) {
+    if (value) {
+      writer.Set();
+    }
+    writer.Next();
+  }
+  writer.Finish();
+  return Status::OK();
+}
+
+Status ConvertStrings(const std::vector<std::string>& values, MemoryPool* pool,
+                      std::shared_ptr<Buffer>* offsets, std::shared_ptr<Buffer>* data) {
+  int64_t data_size = 0;
+  for (const auto& value : values) {
+    data_size += static_cast<int64_t>(value.size());
+  }
+  if (data_size > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Fetched string column of ", data_size,
+                                 " bytes is too large for an Arrow string array");
+  }
+  RETURN_NOT_OK(AllocateBuffer(pool, (values.size() + 1) * sizeof(int32_t), offsets));
+  RETURN_NOT_OK(AllocateBuffer(pool, data_size, data));
+  int32_t* out_offsets = reinterpret_cast<int32_t*>((*offsets)->mutable_data());
+  uint8_t* out_data = (*data)->mutable_data();
+  int32_t offset = 0;
+  out_offsets[0] = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    std::memcpy(out_data + offset, values[i].data(), values[i].size());
+    offset += static_cast<int32_t>(values[i].size());
+    out_offsets[i + 1] = offset;
+  }
+  return Status::OK();
+}
+
+template <typename ThriftColumn>
+Status ConvertColumn(const ThriftColumn& column, const std::shared_ptr<const void>& owner,
+                     const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                     std::shared_ptr<ArrayData>* out) {
+  const int64_t length = static_cast<int64_t>(column.values.size());
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count;
+  RETURN_NOT_OK(ConvertNulls(column.nulls, length, pool, &validity, &null_count));
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(ConvertValues(owner, column.values, &values));
+  *out = ArrayData::Make(type, length, {validity, values}, null_count);
+  return Status::OK();
+}
+
+}  // namespace
+
+int64_t ColumnarRowSet::num_rows() const {
+  const auto& columns = impl_->resp.results.columns;
+  if (columns.empty()) {
+    return 0;
+  }
+  const hs2::TColumn& col = columns[0];
+  if (col.__isset.boolVal) return static_cast<int64_t>(col.boolVal.values.size());
+  if (col.__isset.byteVal) return static_cast<int64_t>(col.byteVal.values.size());
+  if (col.__isset.i16Val) return static_cast<int64_t>(col.i16Val.values.size());
+  if (col.__isset.i32Val) return static_cast<int64_t>(col.i32Val.values.size());
+  if (col.__isset.i64Val) return static_cast<int64_t>(col.i64Val.values.size());
+  if (col.__isset.doubleVal) return static_cast<int64_t>(col.doubleVal.values.size());
+  if (col.__isset.binaryVal) return static_cast<int64_t>(col.binaryVal.values.size());
+  return static_cast<int64_t>(col.stringVal.values.size());
+}
+
+Status ColumnarRowSet::ToRecordBatch(const std::shared_ptr<Schema>& schema,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatch>* out) const {
+  const auto& columns = impl_->resp.results.columns;
+  if (static_cast<int>(columns.size()) != schema->num_fields()) {
+    return Status::Invalid("Fetched ", columns.size(), " columns for a schema of ",
+                           schema->num_fields(), " fields");
+  }
+  std::shared_ptr<const void> owner = impl_;
+  const int64_t length = num_rows();
+
+  std::vector<std::shared_ptr<ArrayData>> arrays(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const hs2::TColumn& col = columns[i];
+    const auto& type = schema->field(static_cast<int>(i))->type();
+    std::shared_ptr<ArrayData>* array = &arrays[i];
+    bool converted = true;
+    switch (type->id()) {
+      case Type::BOOL:
+        if (col.__isset.boolVal) {
+          const auto& values = col.boolVal.values;
+          std::shared_ptr<Buffer> validity, bits;
+          int64_t null_count;
+          RETURN_NOT_OK(ConvertNulls(col.boolVal.nulls, values.size(), pool, &validity,
+                                     &null_count));
+          RETURN_NOT_OK(ConvertBooleans(values, pool, &bits));
+          *array = ArrayData::Make(type, values.size(), {validity, bits}, null_count);
+        } else {
+          converted = false;
+        }
+        break;
+      case Type::INT8:
+        converted = col.__isset.byteVal;
+        if (converted) {
+          RETURN_NOT_OK(ConvertColumn(col.byteVal, owner, type, pool, array));
+        }
+        break;
+      case Type::INT16:
+        converted = col.__isset.i16Val;
+        if (converted) {
+          RETURN_NOT_OK(ConvertColumn(col.i16Val, owner, type, pool, array));
+        }
+        break;
+      case Type::INT32:
+        converted = col.__isset.i32Val;
+        if (converted) {
+          RETURN_NOT_OK(ConvertColumn(col.i32Val, owner, type, pool, array));
+        }
+        break;
+      case Type::INT64:
+        converted = col.__isset.i64Val;
+        if (converted) {
+          RETURN_NOT_OK(ConvertColumn(col.i64Val, owner, type, pool, array));
+        }
+        break;
+      case Type::DOUBLE:
+        converted = col.__isset.doubleVal;
+        if (converted) {
+          RETURN_NOT_OK(ConvertColumn(col.doubleVal, owner, type, pool, array));
+        }
+        break;
+      case Type::STRING:
+      case Type::BINARY: {
+        // Some servers return binary columns as strings
+        const hs2::TStringColumn* strings =
+            col.__isset.stringVal ? &col.stringVal : nullptr;
+        const hs2::TBinaryColumn* binaries =
+            col.__isset.binaryVal ? &col.binaryVal : nullptr;
+        if (strings == nullptr && binaries == nullptr) {
+          converted = false;
+          break;
+        }
+        const auto& values = strings ? strings->values : binaries->values;
+        const auto& nulls = strings ? strings->nulls : binaries->nulls;
+        std::shared_ptr<Buffer> validity, offsets, data;
+        int64_t null_count;
+        RETURN_NOT_OK(
+            ConvertNulls(nulls, values.size(), pool, &validity, &null_count));
+        RETURN_NOT_OK(ConvertStrings(values, pool, &offsets, &data));
+        *array =
+            ArrayData::Make(type, values.size(), {validity, offsets, data}, null_count);
+        break;
+      }
+      default:
+        converted = false;
+        break;
+    }
+    if (!converted) {
+      return Status::TypeError("Cannot convert fetched column ", i, " to ",
+                               type->ToString());
+    }
+    if ((*array)->length != length) {
+      return Status::Invalid("Fetched column ", i, " has ", (*array)->length,
+                             " values rather than ", length);
+    }
+  }
+  *out = RecordBatch::Make(schema, length, std::move(arrays));
+  return Status::OK();
+}
+
+Status ColumnDescsToSchema(const std::vector<ColumnDesc>& column_descs,
+                           std::shared_ptr<Schema>* out) {
+  std::vector<std::shared_ptr<Field>> fields;
+  fields.reserve(column_descs.size());
+  for (const ColumnDesc& desc : column_descs) {
+    std::shared_ptr<DataType> type;
+    switch (desc.type()->type_id()) {
+      case ColumnType::TypeId::BOOLEAN:
+        type = boolean();
+        break;
+      case ColumnType::TypeId::TINYINT:
+        type = int8();
+        break;
+      case ColumnType::TypeId::SMALLINT:
+        type = int16();
+        break;
+      case ColumnType::TypeId::INT:
+        type = int32();
+        break;
+      case ColumnType::TypeId::BIGINT:
+        type = int64();
+        break;
+      case ColumnType::TypeId::FLOAT:
+      case ColumnType::TypeId::DOUBLE:
+        type = float64();
+        break;
+      case ColumnType::TypeId::BINARY:
+        type = binary();
+        break;
+      default:
+        type = utf8();
+        break;
+    }
+    fields.push_back(field(desc.column_name(), type));
+  }
+  *out = ::arrow::schema(fields);
+  return Status::OK();
+}
+
 }  // namespace hiveserver2
 }  // namespace arrow
@@ -22,12 +22,18 @@
 #include <string>
 #include <vector>
 
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class Status;
+
 namespace hiveserver2 {
 
+class ColumnDesc;
+
 // The Column class is used to access data that was fetched in columnar format.
 // The contents of the data can be accessed through the data() fn, which returns
 // a ptr to a vector containing the contents of this column in the fetched
@@ -137,6 +143,16 @@ class ARROW_EXPORT ColumnarRowSet {
   template <typename T>
   std::unique_ptr<T> GetCol(int i) const;
 
+  // Returns the number of rows of the fetched columns.
+  int64_t num_rows() const;
+
+  // Converts the fetched columns to a record batch of the given schema, as made by
+  // ColumnDescsToSchema() from the metadata of the operation. The values of integer and
+  // double columns are not copied: the arrays share the memory of this ColumnarRowSet,
+  // which they keep alive. Null bitmaps, booleans and strings are converted.
+  Status ToRecordBatch(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+                       std::shared_ptr<RecordBatch>* out) const;
+
  private:
   // Hides Thrift objects from the header.
   struct ColumnarRowSetImpl;
@@ -148,8 +164,16 @@ class ARROW_EXPORT ColumnarRowSet {
 
   explicit ColumnarRowSet(ColumnarRowSetImpl* impl);
 
-  std::unique_ptr<ColumnarRowSetImpl> impl_;
+  std::shared_ptr<ColumnarRowSetImpl> impl_;
 };
 
+// Makes the Arrow schema of the record batches converted from the results of the
+// columns described by column_descs. Integers map to the Arrow integer type of the same
+// width, FLOAT and DOUBLE to float64 and BINARY to binary. All the other types are
+// returned as strings by HiveServer2 and map to utf8.
+ARROW_EXPORT
+Status ColumnDescsToSchema(const std::vector<ColumnDesc>& column_descs,
+                           std::shared_ptr<Schema>* out);
+
 }  // namespace hiveserver2
 }  // namespace arrow
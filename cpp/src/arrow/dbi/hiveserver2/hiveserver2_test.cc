@@ -28,8 +28,12 @@
 #include "arrow/dbi/hiveserver2/session.h"
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
 
 namespace arrow {
 namespace hiveserver2 {
@@ -249,6 +253,47 @@ TEST_F(OperationTest, TestFetch) {
   ASSERT_OK(select_op->Close());
 }
 
+TEST_F(OperationTest, TestRecordBatchReader) {
+  CreateTestTable();
+  InsertIntoTestTable(std::vector<int>({1, 2, 3, 4, NULL_INT_VALUE}),
+                      std::vector<string>({"a", "b", "c", "d", "e"}));
+
+  std::unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+  ASSERT_OK(Wait(select_op));
+
+  // Fetch the results in batches of 2 rows, the next batch being prefetched while
+  // the current one is returned.
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(select_op->GetRecordBatchReader(2, &reader));
+  auto expected_schema = schema({field("int_col", int32()), field("string_col", utf8())});
+  ASSERT_TRUE(reader->schema()->Equals(*expected_schema));
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(reader->ReadNext(&batch));
+    if (batch == nullptr) break;
+    ASSERT_OK(batch->Validate());
+    batches.push_back(batch);
+  }
+  ASSERT_EQ(batches.size(), 3u);
+  ASSERT_EQ(batches[0]->num_rows(), 2);
+  ASSERT_EQ(batches[2]->num_rows(), 1);
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(batches, &table));
+  ASSERT_OK(table->CombineChunks(default_memory_pool(), &table));
+  auto expected_ints = ArrayFromJSON(int32(), "[1, 2, 3, 4, null]");
+  auto expected_strings = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e"])");
+  AssertArraysEqual(*expected_ints, *table->column(0)->chunk(0));
+  AssertArraysEqual(*expected_strings, *table->column(1)->chunk(0));
+
+  reader.reset();
+  ASSERT_OK(select_op->Close());
+}
+
 TEST_F(OperationTest, TestIsNull) {
   CreateTestTable();
   // Insert some NULLs and ensure Column::IsNull() is correct.
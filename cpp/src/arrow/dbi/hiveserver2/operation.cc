@@ -17,14 +17,20 @@
 
 #include "arrow/dbi/hiveserver2/operation.h"
 
+#include <future>
+#include <utility>
+
 #include "arrow/dbi/hiveserver2/thrift_internal.h"
 
 #include "arrow/dbi/hiveserver2/ImpalaService_types.h"
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
 using std::unique_ptr;
@@ -113,6 +119,73 @@ Status Operation::Fetch(int max_rows, FetchOrientation orientation,
   return status;
 }
 
+namespace {
+
+// Fetches the next batch of results while the current one is returned
+class PrefetchingRecordBatchReader : public RecordBatchReader {
+ public:
+  PrefetchingRecordBatchReader(const Operation* operation, int max_rows,
+                               std::shared_ptr<Schema> schema)
+      : operation_(operation), max_rows_(max_rows), schema_(std::move(schema)) {}
+
+  ~PrefetchingRecordBatchReader() override {
+    // The pending fetch refers to this reader
+    if (pending_.valid()) {
+      pending_.wait();
+    }
+  }
+
+  void StartFetch() {
+    pending_ = internal::GetIOThreadPool()->Submit([this]() {
+      return operation_->Fetch(max_rows_, FetchOrientation::NEXT, &fetched_,
+                               &has_more_rows_);
+    });
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    while (pending_.valid()) {
+      RETURN_NOT_OK(pending_.get());
+      std::unique_ptr<ColumnarRowSet> results = std::move(fetched_);
+      if (has_more_rows_) {
+        StartFetch();
+      }
+      // Empty batches are skipped, the server may return some before the end
+      if (results->num_rows() > 0) {
+        return results->ToRecordBatch(schema_, default_memory_pool(), batch);
+      }
+    }
+    // End of the results
+    batch->reset();
+    return Status::OK();
+  }
+
+ private:
+  const Operation* operation_;
+  const int max_rows_;
+  std::shared_ptr<Schema> schema_;
+
+  std::future<Status> pending_;
+  std::unique_ptr<ColumnarRowSet> fetched_;
+  bool has_more_rows_ = false;
+};
+
+}  // namespace
+
+Status Operation::GetRecordBatchReader(int max_rows,
+                                       std::shared_ptr<RecordBatchReader>* out) const {
+  std::vector<ColumnDesc> column_descs;
+  RETURN_NOT_OK(GetResultSetMetadata(&column_descs));
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(ColumnDescsToSchema(column_descs, &schema));
+
+  auto reader = std::make_shared<PrefetchingRecordBatchReader>(this, max_rows, schema);
+  reader->StartFetch();
+  *out = reader;
+  return Status::OK();
+}
+
 Status Operation::Cancel() const {
   hs2::TCancelOperationReq req;
   req.__set_operationHandle(impl_->handle);
@@ -29,6 +29,7 @@
 
 namespace arrow {
 
+class RecordBatchReader;
 class Status;
 
 namespace hiveserver2 {
@@ -91,6 +92,16 @@ class ARROW_EXPORT Operation {
   Status Fetch(int max_rows, FetchOrientation orientation,
                std::unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const;
 
+  // Returns a reader of the results of this operation as Arrow record batches, fetched
+  // max_rows at a time. The schema of the batches is made by ColumnDescsToSchema from
+  // the result set metadata. While a batch is returned, the next one is fetched in the
+  // background on the IO thread pool, so that converting or processing a batch
+  // overlaps the FetchResults rpc of the next one. No other calls may be made on this
+  // operation or its session while the reader is alive, and the reader must be
+  // destroyed before this operation is closed.
+  Status GetRecordBatchReader(int max_rows,
+                              std::shared_ptr<RecordBatchReader>* out) const;
+
   // May be called after successfully creating the operation and before calling Close.
   Status Cancel() const;
 
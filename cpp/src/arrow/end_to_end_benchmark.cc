@@ -0,0 +1,277 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// An end-to-end suite over one table of mixed columns: CSV and IPC
+// round trips and common compute kernels.  Its benchmarks are named
+// Regression* so that archery runs and compares them, and report both bytes
+// and rows (items) per second.
+
+#include "benchmark/benchmark.h"
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/sort_to_indices.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/csv/writer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+constexpr auto kSeed = 0x0ff1ce;
+constexpr int64_t kNumRows = 1 << 16;
+
+// A table with a few nulls, repeated keys and skewed string lengths, as is
+// typical of business data
+static std::shared_ptr<RecordBatch> MakeSuiteBatch() {
+  random::RandomArrayGenerator gen(kSeed);
+  random::ArrayShape shape;
+  shape.null_probability = 0.05;
+
+  random::ArrayShape keys = shape;
+  keys.cardinality = 1000;
+  keys.mean_run_length = 4;
+
+  random::ArrayShape labels = shape;
+  labels.cardinality = 100;
+  labels.min_length = 4;
+  labels.max_length = 64;
+  labels.length_distribution = random::ArrayShape::GEOMETRIC;
+
+  auto schema = arrow::schema({field("id", int64()), field("key", int32()),
+                               field("label", utf8()), field("price", float64()),
+                               field("flag", boolean()),
+                               field("time", timestamp(TimeUnit::SECOND))});
+  ArrayVector columns = {gen.ArrayOf(int64(), kNumRows, shape),
+                         gen.ArrayOf(int32(), kNumRows, keys),
+                         gen.ArrayOf(utf8(), kNumRows, labels),
+                         gen.ArrayOf(float64(), kNumRows, shape),
+                         gen.ArrayOf(boolean(), kNumRows, shape),
+                         gen.ArrayOf(timestamp(TimeUnit::SECOND), kNumRows, shape)};
+  return RecordBatch::Make(schema, kNumRows, columns);
+}
+
+static const std::shared_ptr<RecordBatch>& SuiteBatch() {
+  static const auto batch = MakeSuiteBatch();
+  return batch;
+}
+
+static int64_t BufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    size += buffer ? buffer->size() : 0;
+  }
+  for (const auto& child : data.child_data) {
+    size += BufferSize(*child);
+  }
+  return size;
+}
+
+static int64_t BufferSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    size += BufferSize(*batch.column_data(i));
+  }
+  return size;
+}
+
+static void SetProcessed(benchmark::State& state, int64_t bytes, int64_t rows) {
+  state.SetBytesProcessed(state.iterations() * bytes);
+  state.SetItemsProcessed(state.iterations() * rows);
+}
+
+static std::shared_ptr<Buffer> WriteSuiteCSV() {
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ABORT_NOT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+  auto options = csv::WriteOptions::Defaults();
+  options.use_threads = false;
+  ABORT_NOT_OK(
+      csv::WriteCSV(*SuiteBatch(), options, default_memory_pool(), stream.get()));
+  std::shared_ptr<Buffer> csv;
+  ABORT_NOT_OK(stream->Finish(&csv));
+  return csv;
+}
+
+static std::shared_ptr<Buffer> WriteSuiteIpc() {
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ABORT_NOT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  ABORT_NOT_OK(
+      ipc::RecordBatchStreamWriter::Open(stream.get(), SuiteBatch()->schema(), &writer));
+  ABORT_NOT_OK(writer->WriteRecordBatch(*SuiteBatch()));
+  ABORT_NOT_OK(writer->Close());
+  std::shared_ptr<Buffer> ipc;
+  ABORT_NOT_OK(stream->Finish(&ipc));
+  return ipc;
+}
+
+// ----------------------------------------------------------------------
+// CSV
+
+static void RegressionCsvRead(benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = WriteSuiteCSV();
+  auto read_options = csv::ReadOptions::Defaults();
+  read_options.use_threads = false;
+  auto convert_options = csv::ConvertOptions::Defaults();
+  for (const auto& field : SuiteBatch()->schema()->fields()) {
+    convert_options.column_types[field->name()] = field->type();
+  }
+
+  for (auto _ : state) {
+    std::shared_ptr<csv::TableReader> reader;
+    ABORT_NOT_OK(csv::TableReader::Make(default_memory_pool(),
+                                        std::make_shared<io::BufferReader>(csv),
+                                        read_options, csv::ParseOptions::Defaults(),
+                                        convert_options, &reader));
+    std::shared_ptr<Table> table;
+    ABORT_NOT_OK(reader->Read(&table));
+    benchmark::DoNotOptimize(table);
+  }
+  SetProcessed(state, csv->size(), kNumRows);
+}
+
+static void RegressionCsvWrite(benchmark::State& state) {  // NOLINT non-const reference
+  int64_t size = 0;
+  for (auto _ : state) {
+    size = WriteSuiteCSV()->size();
+  }
+  SetProcessed(state, size, kNumRows);
+}
+
+// ----------------------------------------------------------------------
+// IPC
+
+static void RegressionIpcWrite(benchmark::State& state) {  // NOLINT non-const reference
+  int64_t size = 0;
+  for (auto _ : state) {
+    size = WriteSuiteIpc()->size();
+  }
+  SetProcessed(state, size, kNumRows);
+}
+
+static void RegressionIpcRead(benchmark::State& state) {  // NOLINT non-const reference
+  auto ipc = WriteSuiteIpc();
+  for (auto _ : state) {
+    io::BufferReader input(ipc);
+    std::shared_ptr<RecordBatchReader> reader;
+    ABORT_NOT_OK(ipc::RecordBatchStreamReader::Open(&input, &reader));
+    std::shared_ptr<RecordBatch> batch;
+    ABORT_NOT_OK(reader->ReadNext(&batch));
+    benchmark::DoNotOptimize(batch);
+  }
+  SetProcessed(state, ipc->size(), kNumRows);
+}
+
+// ----------------------------------------------------------------------
+// Compute
+
+// Select the rows of the suite batch whose key is below the median
+static void RegressionComputeFilter(benchmark::State& state) {  // NOLINT
+  const auto& batch = *SuiteBatch();
+  compute::FunctionContext ctx;
+  const Datum threshold(std::make_shared<Int32Scalar>(0));
+
+  for (auto _ : state) {
+    Datum mask;
+    ABORT_NOT_OK(compute::Compare(&ctx, batch.column(1), threshold,
+                                  compute::CompareOptions(compute::CompareOperator::LESS),
+                                  &mask));
+    const auto selection = mask.make_array();
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      std::shared_ptr<Array> filtered;
+      ABORT_NOT_OK(compute::Filter(&ctx, *batch.column(i), *selection, &filtered));
+      benchmark::DoNotOptimize(filtered);
+    }
+  }
+  SetProcessed(state, BufferSize(batch), kNumRows);
+}
+
+static void RegressionComputeSort(benchmark::State& state) {  // NOLINT
+  const auto& values = *SuiteBatch()->column(0);
+  compute::FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> indices;
+    ABORT_NOT_OK(compute::SortToIndices(&ctx, values, &indices));
+    benchmark::DoNotOptimize(indices);
+  }
+  SetProcessed(state, BufferSize(*values.data()), kNumRows);
+}
+
+static void RegressionComputeDictionaryEncode(benchmark::State& state) {  // NOLINT
+  const auto values = SuiteBatch()->column(2);
+  compute::FunctionContext ctx;
+  for (auto _ : state) {
+    Datum encoded;
+    ABORT_NOT_OK(compute::DictionaryEncode(&ctx, values, &encoded));
+    benchmark::DoNotOptimize(encoded);
+  }
+  SetProcessed(state, BufferSize(*values->data()), kNumRows);
+}
+
+static void RegressionComputeSum(benchmark::State& state) {  // NOLINT non-const reference
+  const auto& values = *SuiteBatch()->column(3);
+  compute::FunctionContext ctx;
+  for (auto _ : state) {
+    Datum sum;
+    ABORT_NOT_OK(compute::Sum(&ctx, values, &sum));
+    benchmark::DoNotOptimize(sum);
+  }
+  SetProcessed(state, BufferSize(*values.data()), kNumRows);
+}
+
+static void RegressionComputeCast(benchmark::State& state) {  // NOLINT
+  const auto& values = *SuiteBatch()->column(1);
+  compute::FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> cast;
+    ABORT_NOT_OK(compute::Cast(&ctx, values, float64(), compute::CastOptions(), &cast));
+    benchmark::DoNotOptimize(cast);
+  }
+  SetProcessed(state, BufferSize(*values.data()), kNumRows);
+}
+
+BENCHMARK(RegressionCsvRead);
+BENCHMARK(RegressionCsvWrite);
+BENCHMARK(RegressionIpcWrite);
+BENCHMARK(RegressionIpcRead);
+BENCHMARK(RegressionComputeFilter);
+BENCHMARK(RegressionComputeSort);
+BENCHMARK(RegressionComputeDictionaryEncode);
+BENCHMARK(RegressionComputeSum);
+BENCHMARK(RegressionComputeCast);
+
+}  // namespace arrow
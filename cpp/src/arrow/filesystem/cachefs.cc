@@ -0,0 +1,556 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachefs.h"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace fs {
+
+using internal::ConcatAbstractPath;
+using internal::EnsureTrailingSlash;
+
+constexpr int64_t CachingFileSystemOptions::kDefaultBlockSize;
+constexpr int64_t CachingFileSystemOptions::kDefaultCapacity;
+
+namespace {
+
+// Whether path is base itself or lies under it
+bool IsAtOrUnder(const std::string& base, const std::string& path) {
+  if (base.empty()) {
+    return true;
+  }
+  const std::string prefix = EnsureTrailingSlash(base);
+  return path == base || path.compare(0, prefix.size(), prefix) == 0;
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Cache index
+
+// Each version of a file seen by OpenInputFile() gets its own id, and its
+// blocks are stored in the cache directory as files named "<id>_<index>".
+// Blocks are written to a temporary file and renamed once complete, so that
+// a block file in the index always holds the whole block.
+class CachingFileSystem::Impl {
+ public:
+  explicit Impl(const CachingFileSystemOptions& options) : options_(options) {}
+
+  ~Impl() {
+    if (initialized_) {
+      ARROW_UNUSED(local_fs_.DeleteDirContents(options_.cache_dir));
+    }
+  }
+
+  Status Init() {
+    if (options_.cache_dir.empty()) {
+      return Status::Invalid("CachingFileSystem needs a cache directory");
+    }
+    if (options_.block_size <= 0) {
+      return Status::Invalid("Cache block size must be positive");
+    }
+    RETURN_NOT_OK(local_fs_.CreateDir(options_.cache_dir));
+    RETURN_NOT_OK(local_fs_.DeleteDirContents(options_.cache_dir));
+    initialized_ = true;
+    return Status::OK();
+  }
+
+  int64_t block_size() const { return options_.block_size; }
+
+  int64_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+  // Return the id under which the blocks of the file at path are cached,
+  // dropping the blocks of any other version of the file
+  int64_t GetFileId(const std::string& path, const FileStats& st) {
+    std::vector<std::string> evicted;
+    int64_t id;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = files_.find(path);
+      if (it != files_.end()) {
+        if (it->second.mtime == st.mtime() && it->second.size == st.size()) {
+          return it->second.id;
+        }
+        DropBlocksUnlocked(it->second.id, &evicted);
+      }
+      id = next_file_id_++;
+      files_[path] = CachedFile{id, st.mtime(), st.size()};
+    }
+    DeleteLocalFiles(evicted);
+    return id;
+  }
+
+  // Drop the cached blocks of the files at or under path
+  void Invalidate(const std::string& path) {
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = files_.begin(); it != files_.end();) {
+        if (IsAtOrUnder(path, it->first)) {
+          DropBlocksUnlocked(it->second.id, &evicted);
+          it = files_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    DeleteLocalFiles(evicted);
+  }
+
+  // Copy nbytes at offset in a cached block to out.  Return false if the
+  // block isn't cached.
+  bool ReadCachedBlock(int64_t file_id, int64_t index, int64_t offset, int64_t nbytes,
+                       uint8_t* out) {
+    const std::string name = BlockName(file_id, index);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = blocks_.find(name);
+      if (it == blocks_.end()) {
+        return false;
+      }
+      lru_.splice(lru_.begin(), lru_, it->second);
+    }
+    // The block may be evicted in the meantime, then it is read again
+    std::shared_ptr<io::RandomAccessFile> file;
+    int64_t bytes_read;
+    return local_fs_.OpenInputFile(LocalPath(name), &file).ok() &&
+           file->ReadAt(offset, nbytes, &bytes_read, out).ok() && bytes_read == nbytes;
+  }
+
+  // Add a block of the file at path to the cache, evicting the least
+  // recently used blocks as necessary
+  Status StoreBlock(const std::string& path, int64_t file_id, int64_t index,
+                    const Buffer& data) {
+    if (data.size() > options_.capacity) {
+      return Status::OK();
+    }
+    const std::string name = BlockName(file_id, index);
+    std::string temp_path;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (blocks_.count(name) > 0 || !IsCurrentUnlocked(path, file_id)) {
+        return Status::OK();
+      }
+      temp_path = LocalPath(name + ".tmp" + std::to_string(next_temp_id_++));
+    }
+
+    std::shared_ptr<io::OutputStream> stream;
+    RETURN_NOT_OK(local_fs_.OpenOutputStream(temp_path, &stream));
+    Status st = stream->Write(data.data(), data.size());
+    st &= stream->Close();
+
+    std::vector<std::string> evicted;
+    if (st.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (blocks_.count(name) > 0 || !IsCurrentUnlocked(path, file_id)) {
+        // Filled concurrently, or invalidated
+        evicted.push_back(temp_path);
+      } else {
+        st = local_fs_.Move(temp_path, LocalPath(name));
+      }
+      if (st.ok() && evicted.empty()) {
+        lru_.push_front(Block{name, file_id, data.size()});
+        blocks_[name] = lru_.begin();
+        cached_bytes_ += data.size();
+        while (cached_bytes_ > options_.capacity) {
+          const Block& victim = lru_.back();
+          evicted.push_back(LocalPath(victim.name));
+          cached_bytes_ -= victim.size;
+          blocks_.erase(victim.name);
+          lru_.pop_back();
+        }
+      }
+    }
+    if (!st.ok()) {
+      evicted.push_back(temp_path);
+    }
+    DeleteLocalFiles(evicted);
+    return st;
+  }
+
+ private:
+  struct CachedFile {
+    int64_t id;
+    TimePoint mtime;
+    int64_t size;
+  };
+
+  struct Block {
+    std::string name;
+    int64_t file_id;
+    int64_t size;
+  };
+
+  static std::string BlockName(int64_t file_id, int64_t index) {
+    return std::to_string(file_id) + "_" + std::to_string(index);
+  }
+
+  std::string LocalPath(const std::string& name) const {
+    return ConcatAbstractPath(options_.cache_dir, name);
+  }
+
+  bool IsCurrentUnlocked(const std::string& path, int64_t file_id) const {
+    auto it = files_.find(path);
+    return it != files_.end() && it->second.id == file_id;
+  }
+
+  void DropBlocksUnlocked(int64_t file_id, std::vector<std::string>* evicted) {
+    for (auto it = lru_.begin(); it != lru_.end();) {
+      if (it->file_id == file_id) {
+        evicted->push_back(LocalPath(it->name));
+        cached_bytes_ -= it->size;
+        blocks_.erase(it->name);
+        it = lru_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  void DeleteLocalFiles(const std::vector<std::string>& paths) {
+    for (const auto& path : paths) {
+      Status st = local_fs_.DeleteFile(path);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to delete cache file: " << st.ToString();
+      }
+    }
+  }
+
+  const CachingFileSystemOptions options_;
+  LocalFileSystem local_fs_;
+  bool initialized_ = false;
+
+  mutable std::mutex mutex_;
+  // The version of each file whose blocks are cached, by path
+  std::unordered_map<std::string, CachedFile> files_;
+  // The cached blocks, most recently used first, and their index by name
+  std::list<Block> lru_;
+  std::unordered_map<std::string, std::list<Block>::iterator> blocks_;
+  int64_t cached_bytes_ = 0;
+  int64_t next_file_id_ = 0;
+  int64_t next_temp_id_ = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Cached file implementation
+
+namespace {
+
+// A RandomAccessFile which serves reads from the cached blocks of a file and
+// fetches the missing blocks from the base filesystem
+class CachedInputFile : public io::RandomAccessFile {
+ public:
+  CachedInputFile(std::shared_ptr<FileSystem> base_fs,
+                  std::shared_ptr<CachingFileSystem::Impl> cache, const std::string& path,
+                  int64_t file_id, int64_t size)
+      : base_fs_(std::move(base_fs)),
+        cache_(std::move(cache)),
+        path_(path),
+        file_id_(file_id),
+        size_(size) {}
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    return Status::OK();
+  }
+
+  Status CheckPosition(int64_t position, const char* action) const {
+    if (position < 0) {
+      return Status::Invalid("Cannot ", action, " from negative position");
+    }
+    if (position > size_) {
+      return Status::IOError("Cannot ", action, " past end of file");
+    }
+    return Status::OK();
+  }
+
+  // RandomAccessFile APIs
+
+  Status Close() override {
+    closed_ = true;
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Status Tell(int64_t* position) const override {
+    RETURN_NOT_OK(CheckClosed());
+
+    *position = pos_;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) override {
+    RETURN_NOT_OK(CheckClosed());
+
+    *size = size_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "seek"));
+
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, size_ - position);
+    *bytes_read = 0;
+    if (nbytes <= 0) {
+      return Status::OK();
+    }
+
+    const int64_t block_size = cache_->block_size();
+    auto dest = reinterpret_cast<uint8_t*>(out);
+    std::vector<int64_t> missing;
+    for (int64_t index = position / block_size; index * block_size < position + nbytes;
+         ++index) {
+      const int64_t begin = std::max(position, index * block_size);
+      const int64_t end = std::min(position + nbytes, (index + 1) * block_size);
+      if (!cache_->ReadCachedBlock(file_id_, index, begin - index * block_size,
+                                   end - begin, dest + (begin - position))) {
+        missing.push_back(index);
+      }
+    }
+    if (!missing.empty()) {
+      RETURN_NOT_OK(FillBlocks(missing, position, nbytes, dest));
+    }
+    *bytes_read = nbytes;
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    // No need to allocate more than the remaining number of bytes
+    nbytes = std::min(nbytes, size_ - position);
+
+    std::shared_ptr<ResizableBuffer> buf;
+    int64_t bytes_read;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buf));
+    if (nbytes > 0) {
+      RETURN_NOT_OK(ReadAt(position, nbytes, &bytes_read, buf->mutable_data()));
+      DCHECK_LE(bytes_read, nbytes);
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+    }
+    *out = std::move(buf);
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    RETURN_NOT_OK(ReadAt(pos_, nbytes, bytes_read, out));
+    pos_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(ReadAt(pos_, nbytes, out));
+    pos_ += (*out)->size();
+    return Status::OK();
+  }
+
+ protected:
+  // The base file is only opened on the first cache miss, so that reads served
+  // from the cache don't issue any request
+  Status GetBaseFile(std::shared_ptr<io::RandomAccessFile>* out) {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (!base_file_) {
+      RETURN_NOT_OK(base_fs_->OpenInputFile(path_, &base_file_));
+    }
+    *out = base_file_;
+    return Status::OK();
+  }
+
+  // Read the given blocks from the base file, copy their part within
+  // [position, position + nbytes) to dest and cache them
+  Status FillBlocks(const std::vector<int64_t>& indices, int64_t position,
+                    int64_t nbytes, uint8_t* dest) {
+    std::shared_ptr<io::RandomAccessFile> base_file;
+    RETURN_NOT_OK(GetBaseFile(&base_file));
+
+    auto fill = [this, base_file, position, nbytes, dest](int64_t index) -> Status {
+      const int64_t block_size = cache_->block_size();
+      const int64_t block_start = index * block_size;
+      const int64_t block_length = std::min(block_size, size_ - block_start);
+      std::shared_ptr<Buffer> block;
+      RETURN_NOT_OK(base_file->ReadAt(block_start, block_length, &block));
+      if (block->size() != block_length) {
+        return Status::IOError("File '", path_, "' is shorter than expected");
+      }
+      const int64_t begin = std::max(position, block_start);
+      const int64_t end = std::min(position + nbytes, block_start + block_length);
+      std::memcpy(dest + (begin - position), block->data() + (begin - block_start),
+                  end - begin);
+      // Failing to cache a block doesn't fail the read
+      Status st = cache_->StoreBlock(path_, file_id_, index, *block);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to cache a block of '" << path_
+                           << "': " << st.ToString();
+      }
+      return Status::OK();
+    };
+
+    // Fetch the blocks concurrently, the first one on this thread
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    std::vector<std::future<Status>> futures;
+    for (size_t i = 1; i < indices.size(); ++i) {
+      futures.push_back(pool->Submit(fill, indices[i]));
+    }
+    Status st = fill(indices[0]);
+    for (auto& fut : futures) {
+      st &= fut.get();
+    }
+    return st;
+  }
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<CachingFileSystem::Impl> cache_;
+  const std::string path_;
+  const int64_t file_id_;
+  const int64_t size_;
+  bool closed_ = false;
+  int64_t pos_ = 0;
+
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+};
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// CachingFileSystem implementation
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     const CachingFileSystemOptions& options)
+    : base_fs_(std::move(base_fs)), impl_(std::make_shared<Impl>(options)) {}
+
+CachingFileSystem::~CachingFileSystem() {}
+
+Status CachingFileSystem::Make(std::shared_ptr<FileSystem> base_fs,
+                               const CachingFileSystemOptions& options,
+                               std::shared_ptr<CachingFileSystem>* out) {
+  std::shared_ptr<CachingFileSystem> fs(
+      new CachingFileSystem(std::move(base_fs), options));
+  RETURN_NOT_OK(fs->impl_->Init());
+  *out = std::move(fs);
+  return Status::OK();
+}
+
+int64_t CachingFileSystem::cached_bytes() const { return impl_->cached_bytes(); }
+
+Status CachingFileSystem::GetTargetStats(const std::string& path, FileStats* out) {
+  return base_fs_->GetTargetStats(path, out);
+}
+
+Status CachingFileSystem::GetTargetStats(const Selector& select,
+                                         std::vector<FileStats>* out) {
+  return base_fs_->GetTargetStats(select, out);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  impl_->Invalidate(path);
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  impl_->Invalidate(path);
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  impl_->Invalidate(path);
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  impl_->Invalidate(src);
+  impl_->Invalidate(dest);
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  impl_->Invalidate(dest);
+  return base_fs_->CopyFile(src, dest);
+}
+
+Status CachingFileSystem::OpenInputStream(const std::string& path,
+                                          std::shared_ptr<io::InputStream>* out) {
+  std::shared_ptr<io::RandomAccessFile> file;
+  RETURN_NOT_OK(OpenInputFile(path, &file));
+  *out = std::move(file);
+  return Status::OK();
+}
+
+Status CachingFileSystem::OpenInputFile(const std::string& path,
+                                        std::shared_ptr<io::RandomAccessFile>* out) {
+  FileStats st;
+  RETURN_NOT_OK(base_fs_->GetTargetStats(path, &st));
+  if (st.type() != FileType::File || st.mtime() == kNoTime || st.size() == kNoSize) {
+    // Let the base filesystem report errors, and read uncacheable files directly
+    return base_fs_->OpenInputFile(path, out);
+  }
+  const int64_t file_id = impl_->GetFileId(path, st);
+  *out = std::make_shared<CachedInputFile>(base_fs_, impl_, path, file_id, st.size());
+  return Status::OK();
+}
+
+Status CachingFileSystem::OpenOutputStream(const std::string& path,
+                                           std::shared_ptr<io::OutputStream>* out) {
+  impl_->Invalidate(path);
+  return base_fs_->OpenOutputStream(path, out);
+}
+
+Status CachingFileSystem::OpenAppendStream(const std::string& path,
+                                           std::shared_ptr<io::OutputStream>* out) {
+  impl_->Invalidate(path);
+  return base_fs_->OpenAppendStream(path, out);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// \brief EXPERIMENTAL: options for a CachingFileSystem
+struct ARROW_EXPORT CachingFileSystemOptions {
+  static constexpr int64_t kDefaultBlockSize = 4 * 1024 * 1024;
+  static constexpr int64_t kDefaultCapacity = INT64_C(8) * 1024 * 1024 * 1024;
+
+  /// The local directory holding the cached blocks.  It is created if it
+  /// doesn't exist, and must not be used for anything else: its contents are
+  /// deleted when the filesystem is made and destroyed.
+  std::string cache_dir;
+  /// Files are read from the base filesystem and cached in blocks of this size
+  int64_t block_size = kDefaultBlockSize;
+  /// The least recently used blocks are evicted once the cached blocks take
+  /// more than this many bytes
+  int64_t capacity = kDefaultCapacity;
+};
+
+/// \brief EXPERIMENTAL: a FileSystem implementation that delegates to another
+/// implementation and caches the contents of the files it reads on local disk.
+///
+/// This is useful in front of a remote filesystem such as S3FileSystem, when
+/// the same files are read repeatedly.  Files opened with OpenInputFile() or
+/// OpenInputStream() serve the blocks they have in the cache from the local
+/// disk.  The missing blocks of a read are fetched from the base filesystem
+/// concurrently, on the I/O thread pool, then added to the cache.
+///
+/// The cached blocks of a file are keyed on its path, size and modification
+/// time, which are checked against the base filesystem whenever the file is
+/// opened.  Files without a modification time are not cached.  Writes,
+/// moves and deletions through this filesystem drop the cached blocks of the
+/// paths they affect.
+///
+/// The index of the cache is kept in memory, so a new instance starts with an
+/// empty cache.  The base filesystem's files must support concurrent ReadAt()
+/// calls.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// \brief Create a CachingFileSystem in front of base_fs
+  static Status Make(std::shared_ptr<FileSystem> base_fs,
+                     const CachingFileSystemOptions& options,
+                     std::shared_ptr<CachingFileSystem>* out);
+
+  using FileSystem::GetTargetStats;
+  Status GetTargetStats(const std::string& path, FileStats* out) override;
+  Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Status OpenInputStream(const std::string& path,
+                         std::shared_ptr<io::InputStream>* out) override;
+
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<io::RandomAccessFile>* out) override;
+
+  Status OpenOutputStream(const std::string& path,
+                          std::shared_ptr<io::OutputStream>* out) override;
+
+  Status OpenAppendStream(const std::string& path,
+                          std::shared_ptr<io::OutputStream>* out) override;
+
+  /// \brief The number of bytes taken by the cached blocks
+  int64_t cached_bytes() const;
+
+  class Impl;
+
+ protected:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                    const CachingFileSystemOptions& options);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace fs
+}  // namespace arrow
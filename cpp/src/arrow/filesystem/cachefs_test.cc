@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachefs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+using ::arrow::internal::TemporaryDir;
+
+class CachingFSTestMixin {
+ public:
+  void MakeFileSystems(int64_t block_size = 4, int64_t capacity = 1024) {
+    ASSERT_OK(TemporaryDir::Make("test-cachefs-", &temp_dir_));
+    base_fs_ = std::make_shared<MockFileSystem>(TimePoint(TimePoint::duration(42)));
+    CachingFileSystemOptions options;
+    options.cache_dir = temp_dir_->path().ToString();
+    options.block_size = block_size;
+    options.capacity = capacity;
+    ASSERT_OK(CachingFileSystem::Make(base_fs_, options, &fs_));
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::shared_ptr<MockFileSystem> base_fs_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+////////////////////////////////////////////////////////////////////////////
+// Generic CachingFileSystem tests
+
+class TestCachingFSGeneric : public ::testing::Test,
+                             public CachingFSTestMixin,
+                             public GenericFileSystemTest {
+ public:
+  void SetUp() override { MakeFileSystems(); }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return fs_; }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSGeneric);
+
+////////////////////////////////////////////////////////////////////////////
+// Concrete CachingFileSystem tests
+
+class TestCachingFS : public ::testing::Test, public CachingFSTestMixin {
+ public:
+  void SetUp() override {
+    MakeFileSystems();
+    ASSERT_OK(base_fs_->CreateDir("AB"));
+  }
+
+  void AssertReadAt(const std::string& path, int64_t position, int64_t nbytes,
+                    const std::string& expected) {
+    std::shared_ptr<io::RandomAccessFile> file;
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(fs_->OpenInputFile(path, &file));
+    ASSERT_OK(file->ReadAt(position, nbytes, &buffer));
+    AssertBufferEqual(*buffer, expected);
+  }
+};
+
+TEST_F(TestCachingFS, ReadAt) {
+  CreateFile(base_fs_.get(), "AB/abc", "some other data");
+
+  AssertReadAt("AB/abc", 3, 7, "e other");
+  // Blocks 0 to 2 are cached
+  ASSERT_EQ(fs_->cached_bytes(), 12);
+  AssertReadAt("AB/abc", 0, 20, "some other data");
+  ASSERT_EQ(fs_->cached_bytes(), 15);
+  AssertReadAt("AB/abc", 15, 1, "");
+  AssertReadAt("AB/abc", 13, 5, "ta");
+
+  std::shared_ptr<io::InputStream> stream;
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(fs_->OpenInputStream("AB/abc", &stream));
+  ASSERT_OK(stream->Read(6, &buffer));
+  AssertBufferEqual(*buffer, "some o");
+  ASSERT_OK(stream->Read(20, &buffer));
+  AssertBufferEqual(*buffer, "ther data");
+}
+
+TEST_F(TestCachingFS, ServesCachedBlocks) {
+  CreateFile(base_fs_.get(), "AB/abc", "some data");
+  AssertReadAt("AB/abc", 0, 9, "some data");
+
+  // The mock filesystem gives all files the same modification time, so a
+  // file of the same size rewritten behind the cache's back isn't noticed
+  CreateFile(base_fs_.get(), "AB/abc", "new stuff");
+  AssertReadAt("AB/abc", 0, 9, "some data");
+  // ... but only the cached blocks are served from the cache
+  ASSERT_OK(fs_->DeleteDirContents("AB"));
+  CreateFile(base_fs_.get(), "AB/abc", "some data");
+  AssertReadAt("AB/abc", 2, 4, "me d");
+  CreateFile(base_fs_.get(), "AB/abc", "new stuff");
+  AssertReadAt("AB/abc", 0, 9, "some datf");
+}
+
+TEST_F(TestCachingFS, Invalidation) {
+  CreateFile(base_fs_.get(), "AB/abc", "some data");
+  CreateFile(base_fs_.get(), "AB/def", "more data");
+  AssertReadAt("AB/abc", 0, 9, "some data");
+  AssertReadAt("AB/def", 0, 9, "more data");
+  ASSERT_EQ(fs_->cached_bytes(), 18);
+
+  // A file whose size changed is read again
+  CreateFile(base_fs_.get(), "AB/abc", "other data");
+  AssertReadAt("AB/abc", 0, 10, "other data");
+  ASSERT_EQ(fs_->cached_bytes(), 19);
+
+  // Writes through the caching filesystem drop the cached blocks
+  CreateFile(fs_.get(), "AB/abc", "more stuff");
+  ASSERT_EQ(fs_->cached_bytes(), 9);
+  AssertReadAt("AB/abc", 0, 10, "more stuff");
+
+  ASSERT_OK(fs_->Move("AB/def", "AB/abc"));
+  ASSERT_EQ(fs_->cached_bytes(), 0);
+  AssertReadAt("AB/abc", 0, 10, "more data");
+
+  ASSERT_OK(fs_->DeleteDir("AB"));
+  ASSERT_EQ(fs_->cached_bytes(), 0);
+}
+
+TEST_F(TestCachingFS, Eviction) {
+  MakeFileSystems(/*block_size=*/4, /*capacity=*/10);
+  CreateFile(base_fs_.get(), "abc", "0123456789abcdefghij");
+
+  const std::string data = "0123456789abcdefghij";
+  for (int64_t i = 0; i < 5; ++i) {
+    AssertReadAt("abc", i * 4, 4, data.substr(i * 4, 4));
+  }
+  ASSERT_EQ(fs_->cached_bytes(), 8);
+  // Only the last two blocks read are still cached
+  CreateFile(base_fs_.get(), "abc", "ABCDEFGHIJKLMNOPQRST");
+  AssertReadAt("abc", 0, 20, "ABCDEFGHIJKLcdefghij");
+  ASSERT_EQ(fs_->cached_bytes(), 8);
+}
+
+TEST_F(TestCachingFS, BlocksLargerThanCapacity) {
+  MakeFileSystems(/*block_size=*/16, /*capacity=*/8);
+  CreateFile(base_fs_.get(), "abc", "some data");
+
+  AssertReadAt("abc", 0, 9, "some data");
+  ASSERT_EQ(fs_->cached_bytes(), 0);
+}
+
+TEST_F(TestCachingFS, InvalidOptions) {
+  std::shared_ptr<CachingFileSystem> fs;
+  CachingFileSystemOptions options;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options, &fs));
+  options.cache_dir = temp_dir_->path().ToString();
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options, &fs));
+}
+
+}  // namespace internal
+}  // namespace fs
+}  // namespace arrow
@@ -15,13 +15,18 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <chrono>
 #include <cstring>
+#include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #ifdef _WIN32
 #include "arrow/util/windows_compatibility.h"
 #else
+#include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <stdio.h>
@@ -35,6 +40,9 @@
 #include "arrow/io/file.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -43,6 +51,7 @@ namespace bfs = ::boost::filesystem;
 
 using ::arrow::internal::NativePathString;
 using ::arrow::internal::PlatformFilename;
+using ::arrow::internal::TaskGroup;
 
 namespace {
 
@@ -167,9 +176,9 @@ FileStats StatToFileStat(const struct stat& s) {
   return st;
 }
 
-Status StatFile(const std::string& path, FileStats* out) {
-  struct stat s;
-  int r = stat(path.c_str(), &s);
+// Fill out from the result r of a stat() call on path
+Status StatToFileStats(int r, const struct stat& s, const std::string& path,
+                       FileStats* out) {
   if (r == -1) {
     if (errno == ENOENT || errno == ENOTDIR || errno == ELOOP) {
       out->set_type(FileType::NonExistent);
@@ -185,6 +194,186 @@ Status StatFile(const std::string& path, FileStats* out) {
   return Status::OK();
 }
 
+Status StatFile(const std::string& path, FileStats* out) {
+  struct stat s;
+  int r = stat(path.c_str(), &s);
+  return StatToFileStats(r, s, path, out);
+}
+
+#endif
+
+// The entries of a directory, in listing order, and the listing of each
+// entry which is a directory, if the walk is recursive.  Entries removed
+// during the walk are left NonExistent.
+struct DirectoryListing {
+  std::vector<FileStats> entries;
+  std::vector<std::unique_ptr<DirectoryListing>> children;
+};
+
+// Append the entries of listing and of its children to out, each directory
+// followed by its own entries
+void FlattenListing(const DirectoryListing& listing, std::vector<FileStats>* out) {
+  for (size_t i = 0; i < listing.entries.size(); ++i) {
+    if (listing.entries[i].type() != FileType::NonExistent) {
+      out->push_back(listing.entries[i]);
+    }
+    if (listing.children[i]) {
+      FlattenListing(*listing.children[i], out);
+    }
+  }
+}
+
+// Walks a directory tree with directories listed, and large directories
+// stat'ed, concurrently on the I/O thread pool.  On network filesystems every
+// stat is a round trip to the server, so a sequential walk of a large tree
+// mostly waits.
+class DirectoryWalker {
+ public:
+  explicit DirectoryWalker(bool recursive)
+      : recursive_(recursive),
+        task_group_(TaskGroup::MakeThreaded(::arrow::internal::GetIOThreadPool())) {}
+
+  Status Walk(const NativePathString& path, std::vector<FileStats>* out) {
+    DirectoryListing root;
+    // The tasks write to the listings, so wait for them even on error
+    Status st = VisitDirectory(path, /*is_root=*/true, &root);
+    st &= task_group_->Finish();
+    RETURN_NOT_OK(st);
+    FlattenListing(root, out);
+    return Status::OK();
+  }
+
+ private:
+  void SpawnVisit(const NativePathString& path, DirectoryListing* listing) {
+    task_group_->Append(
+        [this, path, listing]() { return VisitDirectory(path, false, listing); });
+  }
+
+  Status VisitDirectory(const NativePathString& path, bool is_root,
+                        DirectoryListing* listing);
+
+#ifndef _WIN32
+  static constexpr size_t kStatBatchSize = 256;
+
+  Status StatEntries(DIR* dir, const std::vector<std::string>& names,
+                     const std::string& path, size_t begin, size_t end,
+                     DirectoryListing* listing);
+#endif
+
+  const bool recursive_;
+  std::shared_ptr<TaskGroup> task_group_;
+};
+
+#ifdef _WIN32
+
+Status DirectoryWalker::VisitDirectory(const NativePathString& path, bool is_root,
+                                       DirectoryListing* listing) {
+  ARROW_UNUSED(is_root);
+  BOOST_FILESYSTEM_TRY
+  for (const auto& entry : bfs::directory_iterator(bfs::path(path))) {
+    FileStats st;
+    NativePathString ns = entry.path().native();
+    RETURN_NOT_OK(StatFile(ns, &st));
+    std::unique_ptr<DirectoryListing> child;
+    if (recursive_ && st.type() == FileType::Directory) {
+      child.reset(new DirectoryListing);
+      SpawnVisit(ns, child.get());
+    }
+    listing->entries.push_back(std::move(st));
+    listing->children.push_back(std::move(child));
+  }
+  BOOST_FILESYSTEM_CATCH
+  return Status::OK();
+}
+
+#else  // POSIX systems
+
+constexpr size_t DirectoryWalker::kStatBatchSize;
+
+std::string JoinPath(const std::string& dir, const std::string& name) {
+  if (dir.empty() || dir.back() == '/') {
+    return dir + name;
+  }
+  return dir + "/" + name;
+}
+
+Status DirectoryWalker::VisitDirectory(const std::string& path, bool is_root,
+                                       DirectoryListing* listing) {
+  DIR* raw_dir = opendir(path.c_str());
+  if (raw_dir == nullptr) {
+    if (!is_root && errno == ENOENT) {
+      // Removed during the walk
+      return Status::OK();
+    }
+    return ErrnoToStatus("Cannot list directory '", path, "'");
+  }
+  std::shared_ptr<DIR> dir(raw_dir, closedir);
+
+  auto names = std::make_shared<std::vector<std::string>>();
+  std::vector<bool> known_dirs;
+  while (true) {
+    errno = 0;
+    struct dirent* entry = readdir(raw_dir);
+    if (entry == nullptr) {
+      if (errno != 0) {
+        return ErrnoToStatus("Cannot list directory '", path, "'");
+      }
+      break;
+    }
+    if (std::strcmp(entry->d_name, ".") == 0 || std::strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    names->emplace_back(entry->d_name);
+#ifdef DT_DIR
+    known_dirs.push_back(entry->d_type == DT_DIR);
+#else
+    known_dirs.push_back(false);
+#endif
+  }
+
+  const size_t num_entries = names->size();
+  listing->entries.resize(num_entries);
+  listing->children.resize(num_entries);
+  // Subdirectories known from their directory entry are walked right away,
+  // the others once stat'ed
+  if (recursive_) {
+    for (size_t i = 0; i < num_entries; ++i) {
+      if (known_dirs[i]) {
+        listing->children[i].reset(new DirectoryListing);
+        SpawnVisit(JoinPath(path, (*names)[i]), listing->children[i].get());
+      }
+    }
+  }
+  for (size_t begin = kStatBatchSize; begin < num_entries; begin += kStatBatchSize) {
+    const size_t end = std::min(num_entries, begin + kStatBatchSize);
+    task_group_->Append([this, dir, names, path, begin, end, listing]() {
+      return StatEntries(dir.get(), *names, path, begin, end, listing);
+    });
+  }
+  return StatEntries(raw_dir, *names, path, 0, std::min(num_entries, kStatBatchSize),
+                     listing);
+}
+
+Status DirectoryWalker::StatEntries(DIR* dir, const std::vector<std::string>& names,
+                                    const std::string& path, size_t begin, size_t end,
+                                    DirectoryListing* listing) {
+  // Stat relative to the directory, which spares resolving the whole path
+  const int dir_fd = dirfd(dir);
+  for (size_t i = begin; i < end; ++i) {
+    const std::string entry_path = JoinPath(path, names[i]);
+    struct stat s;
+    int r = fstatat(dir_fd, names[i].c_str(), &s, 0);
+    FileStats* st = &listing->entries[i];
+    RETURN_NOT_OK(StatToFileStats(r, s, entry_path, st));
+    if (recursive_ && st->type() == FileType::Directory && !listing->children[i]) {
+      // E.g. a symlink to a directory
+      listing->children[i].reset(new DirectoryListing);
+      SpawnVisit(entry_path, listing->children[i].get());
+    }
+  }
+  return Status::OK();
+}
+
 #endif
 
 Status StatSelector(const NativePathString& path, const Selector& select,
@@ -201,21 +390,8 @@ Status StatSelector(const NativePathString& path, const Selector& select,
     }
   }
 
-  BOOST_FILESYSTEM_TRY
-  for (const auto& entry : bfs::directory_iterator(p)) {
-    FileStats st;
-    NativePathString ns = entry.path().native();
-    RETURN_NOT_OK(StatFile(ns, &st));
-    if (st.type() != FileType::NonExistent) {
-      out->push_back(std::move(st));
-    }
-    if (select.recursive && st.type() == FileType::Directory) {
-      RETURN_NOT_OK(StatSelector(ns, select, out));
-    }
-  }
-  BOOST_FILESYSTEM_CATCH
-
-  return Status::OK();
+  DirectoryWalker walker(select.recursive);
+  return walker.Walk(path, out);
 }
 
 }  // namespace
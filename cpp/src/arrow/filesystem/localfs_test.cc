@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -25,6 +26,7 @@
 
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
@@ -168,6 +170,47 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - stats[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, GetTargetStatsSelectorLargeTree) {
+  // Enough entries for the stats of a directory to be split between tasks
+  std::vector<std::string> expected = {"AB", "AB/CD", "AB/CD/EF", "xyz"};
+  ASSERT_OK(this->fs_->CreateDir("AB/CD/EF"));
+  CreateFile(this->fs_.get(), "xyz", "");
+  for (int i = 0; i < 600; ++i) {
+    const std::string path = "AB/" + std::to_string(i);
+    CreateFile(this->fs_.get(), path, "data");
+    expected.push_back(path);
+  }
+  for (int i = 0; i < 20; ++i) {
+    const std::string path = "AB/CD/EF/" + std::to_string(i);
+    CreateFile(this->fs_.get(), path, "");
+    expected.push_back(path);
+  }
+  std::sort(expected.begin(), expected.end());
+
+  Selector s;
+  s.recursive = true;
+  std::vector<FileStats> stats;
+  ASSERT_OK(this->fs_->GetTargetStats(s, &stats));
+  ASSERT_EQ(stats.size(), expected.size());
+  // Each directory comes before its entries
+  std::vector<std::string> seen_dirs = {""};
+  for (const auto& st : stats) {
+    const auto parent = GetAbstractPathParent(st.path()).first;
+    ASSERT_NE(std::find(seen_dirs.begin(), seen_dirs.end(), parent), seen_dirs.end())
+        << st.path();
+    if (st.type() == FileType::Directory) {
+      seen_dirs.push_back(st.path());
+    } else {
+      // Only the files directly in AB have data
+      ASSERT_EQ(st.size(), parent == "AB" ? 4 : 0) << st.path();
+    }
+  }
+  SortStats(&stats);
+  for (size_t i = 0; i < stats.size(); ++i) {
+    ASSERT_EQ(stats[i].path(), expected[i]);
+  }
+}
+
 // TODO Should we test backslash paths on Windows?
 // SubTreeFileSystem isn't compatible with them.
 
@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
+#include <cstring>
 #include <mutex>
 #include <sstream>
 #include <utility>
@@ -61,9 +63,12 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/s3_internal.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace fs {
@@ -223,6 +228,8 @@ std::string FormatRange(int64_t start, int64_t length) {
 
 Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t start,
                       int64_t length, S3Model::GetObjectResult* out) {
+  ARROW_TRACE_SPAN(span, "s3", "GetObject");
+  ARROW_TRACE_SPAN_BYTES(span, length);
   S3Model::GetObjectRequest req;
   req.SetBucket(ToAwsString(path.bucket));
   req.SetKey(ToAwsString(path.key));
@@ -244,6 +251,7 @@ class ObjectInputFile : public io::RandomAccessFile {
     req.SetBucket(ToAwsString(path_.bucket));
     req.SetKey(ToAwsString(path_.key));
 
+    ARROW_TRACE_SPAN(span, "s3", "HeadObject");
     auto outcome = client_->HeadObject(req);
     if (!outcome.IsSuccess()) {
       if (IsNotFound(outcome.GetError())) {
@@ -361,6 +369,90 @@ class ObjectInputFile : public io::RandomAccessFile {
   int64_t content_length_ = -1;
 };
 
+// A RandomAccessFile which serves reads from ranges prefetched by WillNeed().
+// Prefetched ranges are coalesced and fetched with concurrent GET requests
+// on the I/O thread pool.  Other reads are forwarded to the ObjectInputFile.
+class PrefetchingObjectInputFile : public io::RandomAccessFile {
+ public:
+  explicit PrefetchingObjectInputFile(std::shared_ptr<ObjectInputFile> raw)
+      : raw_(raw),
+        cache_(std::move(raw), io::CacheOptions::Defaults(),
+               ::arrow::internal::GetIOThreadPool()) {}
+
+  Status Close() override { return raw_->Close(); }
+
+  bool closed() const override { return raw_->closed(); }
+
+  Status Tell(int64_t* position) const override { return raw_->Tell(position); }
+
+  Status GetSize(int64_t* size) override { return raw_->GetSize(size); }
+
+  Status Seek(int64_t position) override { return raw_->Seek(position); }
+
+  Status WillNeed(const std::vector<io::ReadRange>& ranges) override {
+    RETURN_NOT_OK(raw_->CheckClosed());
+    int64_t size;
+    RETURN_NOT_OK(raw_->GetSize(&size));
+    // GETs past the end of the object would fail, so clamp the ranges
+    std::vector<io::ReadRange> clamped;
+    clamped.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      if (range.offset < 0 || range.length < 0) {
+        return Status::Invalid("Invalid read range: offset ", range.offset, ", length ",
+                               range.length);
+      }
+      if (range.offset < size) {
+        clamped.push_back({range.offset, std::min(range.length, size - range.offset)});
+      }
+    }
+    return cache_.Cache(clamped);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override {
+    RETURN_NOT_OK(raw_->CheckClosed());
+    std::shared_ptr<Buffer> buffer;
+    if (nbytes >= 0) {
+      RETURN_NOT_OK(cache_.Read({position, nbytes}, &buffer));
+    }
+    if (buffer != nullptr) {
+      std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+      *bytes_read = buffer->size();
+      return Status::OK();
+    }
+    return raw_->ReadAt(position, nbytes, bytes_read, out);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(raw_->CheckClosed());
+    if (nbytes >= 0) {
+      RETURN_NOT_OK(cache_.Read({position, nbytes}, out));
+      if (*out != nullptr) {
+        return Status::OK();
+      }
+    }
+    return raw_->ReadAt(position, nbytes, out);
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    int64_t position;
+    RETURN_NOT_OK(raw_->Tell(&position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, bytes_read, out));
+    return raw_->Seek(position + *bytes_read);
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    int64_t position;
+    RETURN_NOT_OK(raw_->Tell(&position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, out));
+    return raw_->Seek(position + (*out)->size());
+  }
+
+ protected:
+  std::shared_ptr<ObjectInputFile> raw_;
+  io::internal::ReadRangeCache cache_;
+};
+
 // A non-copying istream.
 // See https://stackoverflow.com/questions/35322033/aws-c-sdk-uploadpart-times-out
 // https://stackoverflow.com/questions/13059091/creating-an-input-stream-from-constant-memory
@@ -383,8 +475,13 @@ static constexpr int64_t kMinimumPartUpload = 5 * 1024 * 1024;
 // An OutputStream that writes to a S3 object
 class ObjectOutputStream : public io::OutputStream {
  public:
-  ObjectOutputStream(Aws::S3::S3Client* client, const S3Path& path)
-      : client_(client), path_(path) {}
+  ObjectOutputStream(Aws::S3::S3Client* client, const S3Path& path,
+                     const S3Options& options)
+      : client_(client),
+        path_(path),
+        background_writes_(options.background_writes),
+        max_pending_uploads_(std::max(1, options.max_pending_uploads)),
+        upload_state_(std::make_shared<UploadState>()) {}
 
   ~ObjectOutputStream() override {
     if (!closed_) {
@@ -411,6 +508,9 @@ class ObjectOutputStream : public io::OutputStream {
   }
 
   Status Abort() {
+    // Background uploads reference the upload id, let them finish first
+    WaitForPendingUploads();
+
     S3Model::AbortMultipartUploadRequest req;
     req.SetBucket(ToAwsString(path_.bucket));
     req.SetKey(ToAwsString(path_.key));
@@ -438,9 +538,17 @@ class ObjectOutputStream : public io::OutputStream {
     }
 
     // S3 mandates at least one part, upload an empty one if necessary
-    if (completed_upload_.GetParts().empty()) {
+    if (part_number_ == 1) {
       RETURN_NOT_OK(UploadPart("", 0));
     }
+
+    // Wait for background uploads and gather the parts, in order
+    WaitForPendingUploads();
+    {
+      std::lock_guard<std::mutex> lock(upload_state_->mutex);
+      RETURN_NOT_OK(upload_state_->status);
+      completed_upload_.SetParts(upload_state_->completed_parts);
+    }
     DCHECK(completed_upload_.PartsHasBeenSet());
 
     S3Model::CompleteMultipartUploadRequest req;
@@ -449,6 +557,7 @@ class ObjectOutputStream : public io::OutputStream {
     req.SetUploadId(upload_id_);
     req.SetMultipartUpload(completed_upload_);
 
+    ARROW_TRACE_SPAN(span, "s3", "CompleteMultipartUpload");
     auto outcome = client_->CompleteMultipartUpload(req);
     if (!outcome.IsSuccess()) {
       return ErrorToStatus(outcome.GetError());
@@ -490,6 +599,7 @@ class ObjectOutputStream : public io::OutputStream {
 
     if (!current_part_ && nbytes >= part_upload_threshold_) {
       // No current part and data large enough, upload it directly without copying
+      // (unless uploading in the background, as the caller's data must be copied)
       RETURN_NOT_OK(UploadPart(data, nbytes));
       pos_ += nbytes;
       return Status::OK();
@@ -524,37 +634,131 @@ class ObjectOutputStream : public io::OutputStream {
     RETURN_NOT_OK(current_part_->Finish(&buf));
     current_part_.reset();
     current_part_size_ = 0;
-    return UploadPart(buf->data(), buf->size());
+    return UploadPart(buf->data(), buf->size(), buf);
+  }
+
+  // Upload a part.  If `owned_buffer` is given, it holds the data and
+  // background uploads can use it without copying.
+  Status UploadPart(const void* data, int64_t nbytes,
+                    std::shared_ptr<Buffer> owned_buffer = NULLPTR) {
+    const int32_t part_number = part_number_;
+
+    if (!background_writes_) {
+      RETURN_NOT_OK(DoUploadPart(client_, path_, upload_id_, part_number, data, nbytes,
+                                 upload_state_.get()));
+      ++part_number_;
+      return Status::OK();
+    }
+
+    // Wait for a slot, so that at most max_pending_uploads_ parts are in flight
+    // (and in memory) at any time
+    {
+      std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      upload_state_->cv.wait(lock, [this]() {
+        return upload_state_->pending_uploads < max_pending_uploads_;
+      });
+      // Report errors from previous uploads as early as possible
+      RETURN_NOT_OK(upload_state_->status);
+      ++upload_state_->pending_uploads;
+    }
+
+    if (!owned_buffer) {
+      std::shared_ptr<Buffer> copy;
+      Status st = AllocateBuffer(nbytes, &copy);
+      if (!st.ok()) {
+        UploadFinished(upload_state_.get(), st);
+        return st;
+      }
+      if (nbytes > 0) {
+        memcpy(copy->mutable_data(), data, static_cast<size_t>(nbytes));
+      }
+      owned_buffer = std::move(copy);
+    }
+
+    auto client = client_;
+    auto path = path_;
+    auto upload_id = upload_id_;
+    auto state = upload_state_;
+    Status st = ::arrow::internal::GetIOThreadPool()->Spawn(
+        [client, path, upload_id, part_number, owned_buffer, state]() {
+          Status upload_status =
+              DoUploadPart(client, path, upload_id, part_number, owned_buffer->data(),
+                           owned_buffer->size(), state.get());
+          UploadFinished(state.get(), upload_status);
+        });
+    if (!st.ok()) {
+      UploadFinished(upload_state_.get(), st);
+      return st;
+    }
+    ++part_number_;
+    return Status::OK();
   }
 
-  Status UploadPart(const void* data, int64_t nbytes) {
+ protected:
+  // Shared between the stream and its background uploads
+  struct UploadState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    // Indexed by part number - 1
+    Aws::Vector<S3Model::CompletedPart> completed_parts;
+    int pending_uploads = 0;
+    // The first error from any upload
+    Status status;
+  };
+
+  static Status DoUploadPart(Aws::S3::S3Client* client, const S3Path& path,
+                             const Aws::String& upload_id, int32_t part_number,
+                             const void* data, int64_t nbytes, UploadState* state) {
     S3Model::UploadPartRequest req;
-    req.SetBucket(ToAwsString(path_.bucket));
-    req.SetKey(ToAwsString(path_.key));
-    req.SetUploadId(upload_id_);
-    req.SetPartNumber(part_number_);
+    req.SetBucket(ToAwsString(path.bucket));
+    req.SetKey(ToAwsString(path.key));
+    req.SetUploadId(upload_id);
+    req.SetPartNumber(part_number);
     req.SetContentLength(nbytes);
     req.SetBody(std::make_shared<StringViewStream>(data, nbytes));
 
-    auto outcome = client_->UploadPart(req);
+    ARROW_TRACE_SPAN(span, "s3", "UploadPart");
+    ARROW_TRACE_SPAN_BYTES(span, nbytes);
+    auto outcome = client->UploadPart(req);
     if (!outcome.IsSuccess()) {
       return ErrorToStatus(outcome.GetError());
     }
-    // Append ETag and part number for this uploaded part
+    // Record ETag and part number for this uploaded part
     // (will be needed for upload completion in Close())
     S3Model::CompletedPart part;
-    part.SetPartNumber(part_number_);
+    part.SetPartNumber(part_number);
     part.SetETag(outcome.GetResult().GetETag());
-    completed_upload_.AddParts(std::move(part));
-    ++part_number_;
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->completed_parts.size() < static_cast<size_t>(part_number)) {
+      state->completed_parts.resize(part_number);
+    }
+    state->completed_parts[part_number - 1] = std::move(part);
     return Status::OK();
   }
 
- protected:
+  static void UploadFinished(UploadState* state, const Status& st) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (!st.ok() && state->status.ok()) {
+      state->status = st;
+    }
+    --state->pending_uploads;
+    state->cv.notify_all();
+  }
+
+  void WaitForPendingUploads() {
+    std::unique_lock<std::mutex> lock(upload_state_->mutex);
+    upload_state_->cv.wait(lock,
+                           [this]() { return upload_state_->pending_uploads == 0; });
+  }
+
   Aws::S3::S3Client* client_;
   S3Path path_;
+  const bool background_writes_;
+  const int max_pending_uploads_;
   Aws::String upload_id_;
   S3Model::CompletedMultipartUpload completed_upload_;
+  std::shared_ptr<UploadState> upload_state_;
   bool closed_ = true;
   int64_t pos_ = 0;
   int32_t part_number_ = 1;
@@ -717,6 +921,7 @@ class S3FileSystem::Impl {
     req.SetMaxKeys(kListObjectsMaxKeys);
 
     while (true) {
+      ARROW_TRACE_SPAN(span, "s3", "ListObjectsV2");
       auto outcome = client_->ListObjectsV2(req);
       if (!outcome.IsSuccess()) {
         return error_callable(outcome.GetError());
@@ -1189,7 +1394,7 @@ Status S3FileSystem::OpenInputFile(const std::string& s,
 
   auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
   RETURN_NOT_OK(ptr->Init());
-  *out = std::move(ptr);
+  *out = std::make_shared<PrefetchingObjectInputFile>(std::move(ptr));
   return Status::OK();
 }
 
@@ -1199,7 +1404,8 @@ Status S3FileSystem::OpenOutputStream(const std::string& s,
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectOutputStream>(impl_->client_.get(), path);
+  auto ptr =
+      std::make_shared<ObjectOutputStream>(impl_->client_.get(), path, impl_->options_);
   RETURN_NOT_OK(ptr->Init());
   *out = std::move(ptr);
   return Status::OK();
@@ -41,6 +41,13 @@ struct ARROW_EXPORT S3Options {
 
   std::string access_key;
   std::string secret_key;
+
+  // Whether output streams upload parts in the background (default false).
+  // Memory use is then bounded by max_pending_uploads times the part size.
+  bool background_writes = false;
+  // Maximum number of parts uploaded concurrently by an output stream, when
+  // background_writes is true.  Writes block when this limit is reached.
+  int max_pending_uploads = 4;
 };
 
 /// S3-backed FileSystem implementation.
@@ -77,16 +84,21 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
 
   /// Create a random access file for reading from a S3 object.
   ///
-  /// See OpenInputStream for performance notes.
+  /// See OpenInputStream for performance notes.  In addition, the file
+  /// supports RandomAccessFile::WillNeed(): the given ranges are coalesced
+  /// and fetched in the background with concurrent requests, and ReadAt()
+  /// calls within them are then served from memory.
   Status OpenInputFile(const std::string& path,
                        std::shared_ptr<io::RandomAccessFile>* out) override;
 
   /// Create a sequential output stream for writing to a S3 object.
   ///
-  /// NOTE: Writes to the stream will be buffered but synchronous (i.e.
-  /// when a buffer is implicitly flushed, it waits for the upload to
-  /// complete and the server to respond).  You may want to issue writes
-  /// in the background to avoid idle waits.
+  /// NOTE: Writes to the stream will be buffered but, by default, synchronous
+  /// (i.e. when a buffer is implicitly flushed, it waits for the upload to
+  /// complete and the server to respond).  If S3Options::background_writes
+  /// is enabled, parts are instead uploaded on the I/O thread pool, up to
+  /// S3Options::max_pending_uploads at a time, and Close() waits for the
+  /// remaining uploads.
   Status OpenOutputStream(const std::string& path,
                           std::shared_ptr<io::OutputStream>* out) override;
 
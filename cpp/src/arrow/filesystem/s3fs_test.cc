@@ -283,6 +283,70 @@ class TestS3FS : public S3TestMixin {
   }
 
  protected:
+  void TestOpenOutputStream() {
+    std::shared_ptr<io::OutputStream> stream;
+
+    // Non-existent
+    ASSERT_RAISES(IOError,
+                  fs_->OpenOutputStream("non-existent-bucket/somefile", &stream));
+
+    // Create new empty file
+    ASSERT_OK(fs_->OpenOutputStream("bucket/newfile1", &stream));
+    ASSERT_OK(stream->Close());
+    AssertObjectContents(client_.get(), "bucket", "newfile1", "");
+
+    // Create new file with 1 small write
+    ASSERT_OK(fs_->OpenOutputStream("bucket/newfile2", &stream));
+    ASSERT_OK(stream->Write("some data"));
+    ASSERT_OK(stream->Close());
+    AssertObjectContents(client_.get(), "bucket", "newfile2", "some data");
+
+    // Create new file with 3 small writes
+    ASSERT_OK(fs_->OpenOutputStream("bucket/newfile3", &stream));
+    ASSERT_OK(stream->Write("some "));
+    ASSERT_OK(stream->Write(""));
+    ASSERT_OK(stream->Write("new data"));
+    ASSERT_OK(stream->Close());
+    AssertObjectContents(client_.get(), "bucket", "newfile3", "some new data");
+
+    // Create new file with some large writes
+    std::string s1, s2, s3, s4, s5;
+    // More than the 5 MB minimum part upload
+    s1 = random_string(6000000, /*seed =*/42);
+    s2 = "xxx";
+    s3 = random_string(6000000, 43);
+    s4 = "zzz";
+    s5 = random_string(600000, 44);
+    ASSERT_OK(fs_->OpenOutputStream("bucket/newfile4", &stream));
+    ASSERT_OK(stream->Write(s1));
+    ASSERT_OK(stream->Write(s2));
+    ASSERT_OK(stream->Write(s3));
+    ASSERT_OK(stream->Write(s4));
+    ASSERT_OK(stream->Write(s5));
+    ASSERT_OK(stream->Close());
+    AssertObjectContents(client_.get(), "bucket", "newfile4", s1 + s2 + s3 + s4 + s5);
+
+    // Overwrite
+    ASSERT_OK(fs_->OpenOutputStream("bucket/newfile1", &stream));
+    ASSERT_OK(stream->Write("overwritten data"));
+    ASSERT_OK(stream->Close());
+    AssertObjectContents(client_.get(), "bucket", "newfile1", "overwritten data");
+
+    // Overwrite and make empty
+    ASSERT_OK(fs_->OpenOutputStream("bucket/newfile1", &stream));
+    ASSERT_OK(stream->Close());
+    AssertObjectContents(client_.get(), "bucket", "newfile1", "");
+  }
+
+  void TestOpenOutputStreamAbort() {
+    std::shared_ptr<io::OutputStream> stream;
+    ASSERT_OK(fs_->OpenOutputStream("bucket/somefile", &stream));
+    ASSERT_OK(stream->Write("new data"));
+    // Destructor implicitly aborts stream and the underlying multipart upload.
+    stream.reset();
+    AssertObjectContents(client_.get(), "bucket", "somefile", "some data");
+  }
+
   S3Options options_;
   std::shared_ptr<S3FileSystem> fs_;
 };
@@ -626,66 +690,50 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
-TEST_F(TestS3FS, OpenOutputStream) {
-  std::shared_ptr<io::OutputStream> stream;
+TEST_F(TestS3FS, OpenInputFileWillNeed) {
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+  int64_t nbytes = -1, pos = -1;
 
-  // Non-existent
-  ASSERT_RAISES(IOError, fs_->OpenOutputStream("non-existent-bucket/somefile", &stream));
-
-  // Create new empty file
-  ASSERT_OK(fs_->OpenOutputStream("bucket/newfile1", &stream));
-  ASSERT_OK(stream->Close());
-  AssertObjectContents(client_.get(), "bucket", "newfile1", "");
-
-  // Create new file with 1 small write
-  ASSERT_OK(fs_->OpenOutputStream("bucket/newfile2", &stream));
-  ASSERT_OK(stream->Write("some data"));
-  ASSERT_OK(stream->Close());
-  AssertObjectContents(client_.get(), "bucket", "newfile2", "some data");
-
-  // Create new file with 3 small writes
-  ASSERT_OK(fs_->OpenOutputStream("bucket/newfile3", &stream));
-  ASSERT_OK(stream->Write("some "));
-  ASSERT_OK(stream->Write(""));
-  ASSERT_OK(stream->Write("new data"));
-  ASSERT_OK(stream->Close());
-  AssertObjectContents(client_.get(), "bucket", "newfile3", "some new data");
-
-  // Create new file with some large writes
-  std::string s1, s2, s3, s4, s5;
-  s1 = random_string(6000000, /*seed =*/42);  // More than the 5 MB minimum part upload
-  s2 = "xxx";
-  s3 = random_string(6000000, 43);
-  s4 = "zzz";
-  s5 = random_string(600000, 44);
-  ASSERT_OK(fs_->OpenOutputStream("bucket/newfile4", &stream));
-  ASSERT_OK(stream->Write(s1));
-  ASSERT_OK(stream->Write(s2));
-  ASSERT_OK(stream->Write(s3));
-  ASSERT_OK(stream->Write(s4));
-  ASSERT_OK(stream->Write(s5));
-  ASSERT_OK(stream->Close());
-  AssertObjectContents(client_.get(), "bucket", "newfile4", s1 + s2 + s3 + s4 + s5);
+  ASSERT_OK(fs_->OpenInputFile("bucket/somefile", &file));
+  // Ranges past the end of the object are clamped
+  ASSERT_OK(file->WillNeed({{0, 2}, {5, 10}, {20, 5}}));
+  ASSERT_RAISES(Invalid, file->WillNeed({{-1, 2}}));
 
-  // Overwrite
-  ASSERT_OK(fs_->OpenOutputStream("bucket/newfile1", &stream));
-  ASSERT_OK(stream->Write("overwritten data"));
-  ASSERT_OK(stream->Close());
-  AssertObjectContents(client_.get(), "bucket", "newfile1", "overwritten data");
-
-  // Overwrite and make empty
-  ASSERT_OK(fs_->OpenOutputStream("bucket/newfile1", &stream));
-  ASSERT_OK(stream->Close());
-  AssertObjectContents(client_.get(), "bucket", "newfile1", "");
+  ASSERT_OK(file->ReadAt(0, 2, &buf));
+  AssertBufferEqual(*buf, "so");
+  ASSERT_OK(file->ReadAt(5, 4, &buf));
+  AssertBufferEqual(*buf, "data");
+  // Reads outside of the prefetched ranges work too
+  ASSERT_OK(file->ReadAt(2, 5, &buf));
+  AssertBufferEqual(*buf, "me da");
+  char out[4];
+  ASSERT_OK(file->ReadAt(6, 4, &nbytes, out));
+  ASSERT_EQ(nbytes, 3);
+  ASSERT_EQ(std::string(out, 3), "ata");
+
+  ASSERT_OK(file->Seek(5));
+  ASSERT_OK(file->Read(2, &buf));
+  AssertBufferEqual(*buf, "da");
+  ASSERT_OK(file->Tell(&pos));
+  ASSERT_EQ(pos, 7);
+  ASSERT_RAISES(IOError, file->ReadAt(10, 20, &buf));
+
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 2, &buf));
+  ASSERT_RAISES(Invalid, file->WillNeed({{0, 2}}));
 }
 
-TEST_F(TestS3FS, OpenOutputStreamAbort) {
-  std::shared_ptr<io::OutputStream> stream;
-  ASSERT_OK(fs_->OpenOutputStream("bucket/somefile", &stream));
-  ASSERT_OK(stream->Write("new data"));
-  // Destructor implicitly aborts stream and the underlying multipart upload.
-  stream.reset();
-  AssertObjectContents(client_.get(), "bucket", "somefile", "some data");
+TEST_F(TestS3FS, OpenOutputStream) { TestOpenOutputStream(); }
+
+TEST_F(TestS3FS, OpenOutputStreamAbort) { TestOpenOutputStreamAbort(); }
+
+TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) {
+  options_.background_writes = true;
+  options_.max_pending_uploads = 2;
+  ASSERT_OK(S3FileSystem::Make(options_, &fs_));
+  TestOpenOutputStream();
+  TestOpenOutputStreamAbort();
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -20,11 +20,18 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #ifdef GRPCPP_PP_INCLUDE
 #include <grpcpp/grpcpp.h>
@@ -45,6 +52,7 @@
 #include "arrow/flight/client_auth.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 namespace pb = arrow::flight::protocol;
@@ -139,35 +147,54 @@ class GrpcClientAuthReader : public ClientAuthReader {
 // additional method to get both the record batch and application
 // metadata.
 
+template <typename Stream>
 class GrpcIpcMessageReader;
 class GrpcStreamReader : public FlightStreamReader {
  public:
   GrpcStreamReader();
 
-  static Status Open(std::unique_ptr<ClientRpc> rpc,
-                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
+  /// \brief Open a reader over the stream of a DoGet or DoExchange call
+  ///
+  /// If lazy is true, the schema is read on the first call to schema() or
+  /// Next() instead, so that a DoExchange client can write to the server
+  /// first.
+  template <typename Stream>
+  static Status Open(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream,
+                     std::shared_ptr<internal::SharedMemoryRing> ring, bool lazy,
                      std::unique_ptr<GrpcStreamReader>* out);
   std::shared_ptr<Schema> schema() const override;
   Status Next(FlightStreamChunk* out) override;
   void Cancel() override;
 
  private:
+  template <typename Stream>
   friend class GrpcIpcMessageReader;
-  std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
+
+  Status EnsureOpen() const;
+
+  // Only set until the batch reader is opened
+  mutable std::unique_ptr<ipc::MessageReader> message_reader_;
+  mutable std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
+  mutable Status open_status_;
   std::shared_ptr<Buffer> last_app_metadata_;
   std::shared_ptr<ClientRpc> rpc_;
 };
 
+template <typename Stream>
 class GrpcIpcMessageReader : public ipc::MessageReader {
  public:
   GrpcIpcMessageReader(GrpcStreamReader* reader, std::shared_ptr<ClientRpc> rpc,
-                       std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream)
+                       std::shared_ptr<Stream> stream,
+                       std::shared_ptr<internal::SharedMemoryRing> ring)
       : flight_reader_(reader),
         rpc_(rpc),
         stream_(std::move(stream)),
-        stream_finished_(false) {}
+        stream_finished_(false),
+        ring_(std::move(ring)),
+        ring_checked_(false) {}
 
   Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
+    ScopedMemoryTag memory_tag("flight.recv");
     if (stream_finished_) {
       *out = nullptr;
       flight_reader_->last_app_metadata_ = nullptr;
@@ -181,8 +208,23 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
       flight_reader_->last_app_metadata_ = nullptr;
       return OverrideWithServerError(Status::OK());
     }
+    if (ring_ && !ring_checked_) {
+      // The server accepts the shared memory segment in its initial
+      // metadata, received along with its first message
+      ring_checked_ = true;
+      const auto& server_metadata = rpc_->context.GetServerInitialMetadata();
+      if (server_metadata.find(internal::kSharedMemoryAcceptedHeader) ==
+          server_metadata.end()) {
+        ring_.reset();
+      } else {
+        ring_->Unlink();
+      }
+    }
     // Validate IPC message
     auto st = data.OpenMessage(out);
+    if (st.ok() && ring_) {
+      st = ReadSharedMemoryBody(out);
+    }
     if (!st.ok()) {
       flight_reader_->last_app_metadata_ = nullptr;
       return OverrideWithServerError(std::move(st));
@@ -198,33 +240,68 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
     return std::move(st);
   }
 
+  // Replace a body descriptor with the body it describes in shared memory
+  Status ReadSharedMemoryBody(std::unique_ptr<ipc::Message>* message) {
+    // Descriptors are shorter than the body length in the IPC metadata
+    if ((*message)->body_length() <= internal::kSharedMemoryDescriptorSize) {
+      return Status::OK();
+    }
+    auto body_reader = (*message)->body_reader();
+    int64_t size;
+    RETURN_NOT_OK(body_reader->GetSize(&size));
+    if (size != internal::kSharedMemoryDescriptorSize) {
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> descriptor, body;
+    RETURN_NOT_OK(body_reader->ReadAt(0, size, &descriptor));
+    RETURN_NOT_OK(ring_->Read(*descriptor, &body));
+    return ipc::Message::Open((*message)->metadata(), body, message);
+  }
+
  private:
   GrpcStreamReader* flight_reader_;
   // The RPC context lifetime must be coupled to the ClientReader
   std::shared_ptr<ClientRpc> rpc_;
-  std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
+  std::shared_ptr<Stream> stream_;
   bool stream_finished_;
+  // The shared memory segment offered to the server, if any
+  std::shared_ptr<internal::SharedMemoryRing> ring_;
+  bool ring_checked_;
 };
 
 GrpcStreamReader::GrpcStreamReader() {}
 
-Status GrpcStreamReader::Open(std::unique_ptr<ClientRpc> rpc,
-                              std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                              std::unique_ptr<GrpcStreamReader>* out) {
+template <typename Stream>
+Status GrpcStreamReader::Open(std::shared_ptr<ClientRpc> rpc,
+                              std::shared_ptr<Stream> stream,
+                              std::shared_ptr<internal::SharedMemoryRing> ring,
+                              bool lazy, std::unique_ptr<GrpcStreamReader>* out) {
   *out = std::unique_ptr<GrpcStreamReader>(new GrpcStreamReader);
   out->get()->rpc_ = std::move(rpc);
-  std::unique_ptr<GrpcIpcMessageReader> message_reader(
-      new GrpcIpcMessageReader(out->get(), out->get()->rpc_, std::move(stream)));
-  return ipc::RecordBatchStreamReader::Open(std::move(message_reader),
-                                            &(*out)->batch_reader_);
+  out->get()->message_reader_.reset(new GrpcIpcMessageReader<Stream>(
+      out->get(), out->get()->rpc_, std::move(stream), std::move(ring)));
+  return lazy ? Status::OK() : (*out)->EnsureOpen();
+}
+
+Status GrpcStreamReader::EnsureOpen() const {
+  if (message_reader_) {
+    open_status_ = ipc::RecordBatchStreamReader::Open(std::move(message_reader_),
+                                                      &batch_reader_);
+    message_reader_.reset();
+  }
+  return open_status_;
 }
 
 std::shared_ptr<Schema> GrpcStreamReader::schema() const {
+  if (!EnsureOpen().ok()) {
+    return nullptr;
+  }
   return batch_reader_->schema();
 }
 
 Status GrpcStreamReader::Next(FlightStreamChunk* out) {
   out->app_metadata = nullptr;
+  RETURN_NOT_OK(EnsureOpen());
   RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
   out->app_metadata = std::move(last_app_metadata_);
   return Status::OK();
@@ -234,26 +311,33 @@ void GrpcStreamReader::Cancel() { rpc_->context.TryCancel(); }
 
 // Similarly, the next two classes are intertwined. In order to get
 // application-specific metadata to the IpcPayloadWriter,
-// DoPutPayloadWriter takes a pointer to
+// GrpcPayloadWriter takes a pointer to
 // GrpcStreamWriter. GrpcStreamWriter updates a metadata field on
-// write; DoPutPayloadWriter reads that metadata field to determine
+// write; GrpcPayloadWriter reads that metadata field to determine
 // what to write.
+//
+// Both are parameterized on the messages read back from the server: PutResult
+// for a DoPut call, FlightData for a DoExchange call.
 
-class DoPutPayloadWriter;
+template <typename ProtoReadT>
+using ClientWriteStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
+
+template <typename ProtoReadT>
+class GrpcPayloadWriter;
+template <typename ProtoReadT>
 class GrpcStreamWriter : public FlightStreamWriter {
  public:
   ~GrpcStreamWriter() override = default;
 
-  explicit GrpcStreamWriter(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer)
+  explicit GrpcStreamWriter(std::shared_ptr<ClientWriteStream<ProtoReadT>> writer)
       : app_metadata_(nullptr), batch_writer_(nullptr), writer_(writer) {}
 
-  static Status Open(
-      const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-      std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-      std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+  static Status Open(const FlightDescriptor& descriptor,
+                     const std::shared_ptr<Schema>& schema,
+                     std::shared_ptr<ClientRpc> rpc,
+                     std::shared_ptr<std::mutex> read_mutex,
+                     std::shared_ptr<ClientWriteStream<ProtoReadT>> writer,
+                     std::unique_ptr<FlightStreamWriter>* out);
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteWithMetadata(batch, nullptr);
@@ -279,30 +363,30 @@ class GrpcStreamWriter : public FlightStreamWriter {
   Status Close() override { return batch_writer_->Close(); }
 
  private:
-  friend class DoPutPayloadWriter;
+  friend class GrpcPayloadWriter<ProtoReadT>;
   std::shared_ptr<Buffer> app_metadata_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<ClientWriteStream<ProtoReadT>> writer_;
   bool done_writing_ = false;
 };
 
-/// A IpcPayloadWriter implementation that writes to a DoPut stream
-class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
+/// A IpcPayloadWriter implementation that writes to a DoPut or DoExchange
+/// stream
+template <typename ProtoReadT>
+class GrpcPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
-  DoPutPayloadWriter(
-      const FlightDescriptor& descriptor, std::unique_ptr<ClientRpc> rpc,
-      std::unique_ptr<pb::PutResult> response, std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      GrpcStreamWriter* stream_writer)
+  GrpcPayloadWriter(const FlightDescriptor& descriptor, std::shared_ptr<ClientRpc> rpc,
+                    std::shared_ptr<std::mutex> read_mutex,
+                    std::shared_ptr<ClientWriteStream<ProtoReadT>> writer,
+                    GrpcStreamWriter<ProtoReadT>* stream_writer)
       : descriptor_(descriptor),
         rpc_(std::move(rpc)),
-        response_(std::move(response)),
         read_mutex_(read_mutex),
         writer_(std::move(writer)),
         first_payload_(true),
         stream_writer_(stream_writer) {}
 
-  ~DoPutPayloadWriter() override = default;
+  ~GrpcPayloadWriter() override = default;
 
   Status Start() override { return Status::OK(); }
 
@@ -336,44 +420,57 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
     return Status::OK();
   }
 
-  Status Close() override {
-    bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
-    // Drain the read side to avoid hanging
-    std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
-    if (!guard.owns_lock()) {
-      return Status::IOError("Cannot close stream with pending read operation.");
-    }
-    pb::PutResult message;
-    while (writer_->Read(&message)) {
-    }
-    RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish()));
-    if (!finished_writes) {
-      return Status::UnknownError(
-          "Could not finish writing record batches before closing");
-    }
-    return Status::OK();
-  }
+  Status Close() override;
 
  protected:
   // TODO: there isn't a way to access this as a user.
   const FlightDescriptor descriptor_;
-  std::unique_ptr<ClientRpc> rpc_;
-  std::unique_ptr<pb::PutResult> response_;
+  std::shared_ptr<ClientRpc> rpc_;
   std::shared_ptr<std::mutex> read_mutex_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<ClientWriteStream<ProtoReadT>> writer_;
   bool first_payload_;
-  GrpcStreamWriter* stream_writer_;
+  GrpcStreamWriter<ProtoReadT>* stream_writer_;
 };
 
-Status GrpcStreamWriter::Open(
+template <>
+Status GrpcPayloadWriter<pb::PutResult>::Close() {
+  bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
+  // Drain the read side to avoid hanging
+  std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
+  if (!guard.owns_lock()) {
+    return Status::IOError("Cannot close stream with pending read operation.");
+  }
+  pb::PutResult message;
+  while (writer_->Read(&message)) {
+  }
+  RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish()));
+  if (!finished_writes) {
+    return Status::UnknownError("Could not finish writing record batches before closing");
+  }
+  return Status::OK();
+}
+
+// The read side of a DoExchange call belongs to its FlightStreamReader, which
+// gets the final status of the call once it has read the whole stream
+template <>
+Status GrpcPayloadWriter<pb::FlightData>::Close() {
+  bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
+  if (!finished_writes) {
+    return rpc_->IOError("Could not finish writing record batches before closing: ");
+  }
+  return Status::OK();
+}
+
+template <typename ProtoReadT>
+Status GrpcStreamWriter<ProtoReadT>::Open(
     const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-    std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-    std::shared_ptr<std::mutex> read_mutex,
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
+    std::shared_ptr<ClientRpc> rpc, std::shared_ptr<std::mutex> read_mutex,
+    std::shared_ptr<ClientWriteStream<ProtoReadT>> writer,
     std::unique_ptr<FlightStreamWriter>* out) {
   std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
-  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(new DoPutPayloadWriter(
-      descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get()));
+  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+      new GrpcPayloadWriter<ProtoReadT>(descriptor, std::move(rpc), read_mutex, writer,
+                                        result.get()));
   RETURN_NOT_OK(ipc::internal::OpenRecordBatchWriter(std::move(payload_writer), schema,
                                                      &result->batch_writer_));
   *out = std::move(result);
@@ -444,6 +541,7 @@ class FlightClient::FlightClientImpl {
 
     stub_ = pb::FlightService::NewStub(
         grpc::CreateCustomChannel(grpc_uri.str(), creds, args));
+    shared_memory_capacity_ = options.shared_memory_capacity;
     return Status::OK();
   }
 
@@ -575,11 +673,24 @@ class FlightClient::FlightClientImpl {
 
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
+    std::shared_ptr<internal::SharedMemoryRing> ring;
+    if (shared_memory_capacity_ > 0) {
+      Status st = internal::SharedMemoryRing::Create(shared_memory_capacity_, &ring);
+      if (st.ok()) {
+        rpc->context.AddMetadata(internal::kSharedMemorySegmentHeader, ring->name());
+      } else {
+        // Read through gRPC only
+        ARROW_LOG(WARNING) << "Could not offer shared memory to the server: "
+                           << st.ToString();
+        ring.reset();
+      }
+    }
+    std::shared_ptr<grpc::ClientReader<pb::FlightData>> stream(
         stub_->DoGet(&rpc->context, pb_ticket));
 
     std::unique_ptr<GrpcStreamReader> reader;
-    RETURN_NOT_OK(GrpcStreamReader::Open(std::move(rpc), std::move(stream), &reader));
+    RETURN_NOT_OK(GrpcStreamReader::Open(std::move(rpc), std::move(stream),
+                                         std::move(ring), /*lazy=*/false, &reader));
     *out = std::move(reader);
     return Status::OK();
   }
@@ -590,22 +701,260 @@ class FlightClient::FlightClientImpl {
                std::unique_ptr<FlightMetadataReader>* reader) {
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<pb::PutResult> response(new pb::PutResult);
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer(
+    std::shared_ptr<ClientWriteStream<pb::PutResult>> writer(
         stub_->DoPut(&rpc->context));
 
     std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
     *reader =
         std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(writer, read_mutex));
-    return GrpcStreamWriter::Open(descriptor, schema, std::move(rpc), std::move(response),
-                                  read_mutex, writer, out);
+    return GrpcStreamWriter<pb::PutResult>::Open(descriptor, schema, std::move(rpc),
+                                                 read_mutex, writer, out);
+  }
+
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    std::shared_ptr<ClientRpc> rpc(new ClientRpc(options));
+    RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    std::shared_ptr<ClientWriteStream<pb::FlightData>> stream(
+        stub_->DoExchange(&rpc->context));
+
+    // The server only answers once it has read the schema, which the writer
+    // sends with the first record batch: read the answer lazily
+    std::unique_ptr<GrpcStreamReader> stream_reader;
+    RETURN_NOT_OK(GrpcStreamReader::Open(rpc, stream, /*ring=*/nullptr, /*lazy=*/true,
+                                         &stream_reader));
+    *reader = std::move(stream_reader);
+    return GrpcStreamWriter<pb::FlightData>::Open(descriptor, schema, std::move(rpc),
+                                                  /*read_mutex=*/nullptr, stream, writer);
   }
 
  private:
   std::unique_ptr<pb::FlightService::Stub> stub_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
+  int64_t shared_memory_capacity_ = 0;
 };
 
+// ----------------------------------------------------------------------
+// Reading the endpoints of a flight concurrently
+
+// The clients through which the endpoints of a flight are read, one per
+// location
+class EndpointClients {
+ public:
+  EndpointClients(FlightClient* default_client, const FlightClientOptions& options)
+      : default_client_(default_client), options_(options) {}
+
+  Status Get(const FlightEndpoint& endpoint, FlightClient** out) {
+    if (endpoint.locations.empty()) {
+      *out = default_client_;
+      return Status::OK();
+    }
+    const Location& location = endpoint.locations[0];
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::unique_ptr<FlightClient>& client = clients_[location.ToString()];
+    if (client == nullptr) {
+      RETURN_NOT_OK(FlightClient::Connect(location, options_, &client));
+    }
+    *out = client.get();
+    return Status::OK();
+  }
+
+ private:
+  FlightClient* default_client_;
+  FlightClientOptions options_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<FlightClient>> clients_;
+};
+
+// Reads the streams of the endpoints on worker threads, which queue the
+// batches for ReadNext
+class EndpointsReader : public RecordBatchReader {
+ public:
+  using OpenStream = std::function<Status(const FlightEndpoint&,
+                                          std::unique_ptr<FlightStreamReader>*)>;
+
+  EndpointsReader(std::shared_ptr<Schema> schema, std::vector<FlightEndpoint> endpoints,
+                  const FlightEndpointsReadOptions& options, OpenStream open_stream)
+      : schema_(std::move(schema)),
+        endpoints_(std::move(endpoints)),
+        open_stream_(std::move(open_stream)),
+        max_queued_batches_(std::max(1, options.max_queued_batches)),
+        ordered_(options.ordered),
+        queues_(ordered_ ? endpoints_.size() : 1),
+        streams_(endpoints_.size(), nullptr),
+        finished_(endpoints_.size(), false),
+        next_endpoint_(0),
+        current_endpoint_(0),
+        num_finished_(0),
+        num_queued_(0),
+        cancelled_(false) {
+    const size_t parallelism = static_cast<size_t>(std::max(1, options.parallelism));
+    const size_t num_workers = std::min(parallelism, endpoints_.size());
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers_.emplace_back(&EndpointsReader::ReadEndpoints, this);
+    }
+  }
+
+  ~EndpointsReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cancelled_ = true;
+      CancelStreams();
+    }
+    space_available_.notify_all();
+    for (std::thread& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(status_);
+      if (ordered_) {
+        // Move on to the next endpoint once this one is drained, which lets
+        // its worker queue batches past the bound (see QueueBatch)
+        while (current_endpoint_ < endpoints_.size() &&
+               finished_[current_endpoint_] && queues_[current_endpoint_].empty()) {
+          ++current_endpoint_;
+          space_available_.notify_all();
+        }
+        if (current_endpoint_ == endpoints_.size()) {
+          out->reset();
+          return Status::OK();
+        }
+      } else if (queues_[0].empty() && num_finished_ == endpoints_.size()) {
+        out->reset();
+        return Status::OK();
+      }
+      std::deque<std::shared_ptr<RecordBatch>>& queue =
+          queues_[ordered_ ? current_endpoint_ : 0];
+      if (!queue.empty()) {
+        *out = std::move(queue.front());
+        queue.pop_front();
+        --num_queued_;
+        space_available_.notify_all();
+        return Status::OK();
+      }
+      batch_available_.wait(lock);
+    }
+  }
+
+ private:
+  // Worker thread: read endpoints in turn until none are left
+  void ReadEndpoints() {
+    while (true) {
+      size_t index;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (cancelled_ || !status_.ok() || next_endpoint_ == endpoints_.size()) {
+          return;
+        }
+        index = next_endpoint_++;
+      }
+      Status st = ReadEndpoint(index);
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!st.ok() && status_.ok() && !cancelled_) {
+        status_ = st;
+        CancelStreams();
+        space_available_.notify_all();
+      }
+      finished_[index] = true;
+      ++num_finished_;
+      batch_available_.notify_all();
+    }
+  }
+
+  Status ReadEndpoint(size_t index) {
+    std::unique_ptr<FlightStreamReader> stream;
+    RETURN_NOT_OK(open_stream_(endpoints_[index], &stream));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cancelled_ || !status_.ok()) {
+        return Status::OK();
+      }
+      streams_[index] = stream.get();
+    }
+    Status st = ReadStream(index, stream.get());
+    std::lock_guard<std::mutex> lock(mutex_);
+    streams_[index] = nullptr;
+    // A cancelled call fails, which isn't an error of the reader
+    return cancelled_ ? Status::OK() : st;
+  }
+
+  Status ReadStream(size_t index, FlightStreamReader* stream) {
+    FlightStreamChunk chunk;
+    while (true) {
+      RETURN_NOT_OK(stream->Next(&chunk));
+      if (chunk.data == nullptr) {
+        return Status::OK();
+      }
+      if (!QueueBatch(index, std::move(chunk.data))) {
+        return Status::OK();
+      }
+    }
+  }
+
+  // Wait for room in the queues, then queue the batch. Returns false if the
+  // reader was cancelled or failed meanwhile
+  bool QueueBatch(size_t index, std::shared_ptr<RecordBatch> batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // When ordered, the batches of the endpoint being returned aren't bounded:
+    // the queues may be full of batches of later endpoints, which ReadNext
+    // only returns after this one
+    while (!cancelled_ && status_.ok() && num_queued_ >= max_queued_batches_ &&
+           !(ordered_ && index == current_endpoint_)) {
+      space_available_.wait(lock);
+    }
+    if (cancelled_ || !status_.ok()) {
+      return false;
+    }
+    queues_[ordered_ ? index : 0].push_back(std::move(batch));
+    ++num_queued_;
+    batch_available_.notify_all();
+    return true;
+  }
+
+  void CancelStreams() {
+    for (FlightStreamReader* stream : streams_) {
+      if (stream != nullptr) {
+        stream->Cancel();
+      }
+    }
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<FlightEndpoint> endpoints_;
+  OpenStream open_stream_;
+  const int max_queued_batches_;
+  const bool ordered_;
+
+  std::mutex mutex_;
+  std::condition_variable batch_available_;
+  std::condition_variable space_available_;
+  // One queue per endpoint when ordered, a single one otherwise
+  std::vector<std::deque<std::shared_ptr<RecordBatch>>> queues_;
+  // The streams being read, to cancel them
+  std::vector<FlightStreamReader*> streams_;
+  std::vector<bool> finished_;
+  size_t next_endpoint_;
+  size_t current_endpoint_;
+  size_t num_finished_;
+  int num_queued_;
+  bool cancelled_;
+  Status status_;
+  std::vector<std::thread> workers_;
+};
+
+FlightClientOptions::FlightClientOptions() : shared_memory_capacity(0) {}
+
+FlightEndpointsReadOptions::FlightEndpointsReadOptions()
+    : parallelism(8), max_queued_batches(16), ordered(false) {}
+
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
 
 FlightClient::~FlightClient() {}
@@ -663,6 +1012,25 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGetEndpoints(const FlightInfo& info,
+                                    const FlightEndpointsReadOptions& options,
+                                    std::unique_ptr<RecordBatchReader>* reader) {
+  std::shared_ptr<Schema> schema;
+  ipc::DictionaryMemo dictionary_memo;
+  RETURN_NOT_OK(info.GetSchema(&dictionary_memo, &schema));
+
+  auto clients = std::make_shared<EndpointClients>(this, options.client_options);
+  const FlightCallOptions call_options = options.call_options;
+  auto open_stream = [clients, call_options](const FlightEndpoint& endpoint,
+                                             std::unique_ptr<FlightStreamReader>* out) {
+    FlightClient* client;
+    RETURN_NOT_OK(clients->Get(endpoint, &client));
+    return client->DoGet(call_options, endpoint.ticket, out);
+  };
+  reader->reset(new EndpointsReader(schema, info.endpoints(), options, open_stream));
+  return Status::OK();
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -671,5 +1039,13 @@ Status FlightClient::DoPut(const FlightCallOptions& options,
   return impl_->DoPut(options, descriptor, schema, stream, reader);
 }
 
+Status FlightClient::DoExchange(const FlightCallOptions& options,
+                                const FlightDescriptor& descriptor,
+                                const std::shared_ptr<Schema>& schema,
+                                std::unique_ptr<FlightStreamWriter>* writer,
+                                std::unique_ptr<FlightStreamReader>* reader) {
+  return impl_->DoExchange(options, descriptor, schema, writer, reader);
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -59,11 +59,43 @@ class ARROW_FLIGHT_EXPORT FlightCallOptions {
 
 class ARROW_FLIGHT_EXPORT FlightClientOptions {
  public:
+  /// Create a default set of options.
+  FlightClientOptions();
+
   /// \brief Root certificates to use for validating server
   /// certificates.
   std::string tls_root_certs;
   /// \brief Override the hostname checked by TLS. Use with caution.
   std::string override_hostname;
+  /// \brief If positive, DoGet offers the server a shared memory segment
+  /// of this many bytes to pass message bodies through, instead of
+  /// sending them over gRPC. Only servers on the same host allowing it
+  /// (see FlightServerOptions::allow_shared_memory) use it; others are
+  /// read as usual. Message bodies not fitting in the free space of the
+  /// segment are sent over gRPC. Not supported on Windows.
+  int64_t shared_memory_capacity;
+};
+
+/// \brief Options for reading all endpoints of a flight with
+/// FlightClient::DoGetEndpoints.
+class ARROW_FLIGHT_EXPORT FlightEndpointsReadOptions {
+ public:
+  /// Create a default set of options.
+  FlightEndpointsReadOptions();
+
+  /// \brief The maximum number of endpoints read at the same time, each
+  /// on its own thread.
+  int parallelism;
+  /// \brief The maximum number of record batches received but not yet
+  /// returned, across all endpoints.
+  int max_queued_batches;
+  /// \brief Whether to return the batches of each endpoint in turn, in the
+  /// order of the endpoints, rather than as they arrive.
+  bool ordered;
+  /// \brief Per-RPC options for the DoGet calls.
+  FlightCallOptions call_options;
+  /// \brief Options for connecting to the locations of the endpoints.
+  FlightClientOptions client_options;
 };
 
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
@@ -74,31 +106,6 @@ class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader
   virtual void Cancel() = 0;
 };
 
-// Silence warning
-// "non dll-interface class RecordBatchReader used as base for dll-interface class"
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4275)
-#endif
-
-/// \brief A RecordBatchWriter that also allows sending
-/// application-defined metadata via the Flight protocol.
-class ARROW_FLIGHT_EXPORT FlightStreamWriter : public ipc::RecordBatchWriter {
- public:
-  virtual Status WriteWithMetadata(const RecordBatch& batch,
-                                   std::shared_ptr<Buffer> app_metadata) = 0;
-  /// \brief Indicate that the application is done writing to this stream.
-  ///
-  /// The application may not write to this stream after calling
-  /// this. This differs from closing the stream because this writer
-  /// may represent only one half of a readable and writable stream.
-  virtual Status DoneWriting() = 0;
-};
-
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
-
 /// \brief A reader for application-specific metadata sent back to the
 /// client during an upload.
 class ARROW_FLIGHT_EXPORT FlightMetadataReader {
@@ -212,6 +219,24 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Read the streams of all endpoints of a flight concurrently,
+  /// as a single reader of batches with the schema of the flight.
+  ///
+  /// Endpoints without a location are read through this client, which
+  /// must outlive the reader. Endpoints elsewhere are read through a new
+  /// client connected to their first location, shared by all endpoints at
+  /// that location. Destroying the reader cancels the remaining calls.
+  /// \param[in] info the flight to read
+  /// \param[in] options parallelism, buffering and ordering options
+  /// \param[out] reader the returned RecordBatchReader
+  /// \return Status
+  Status DoGetEndpoints(const FlightInfo& info, const FlightEndpointsReadOptions& options,
+                        std::unique_ptr<RecordBatchReader>* reader);
+  Status DoGetEndpoints(const FlightInfo& info,
+                        std::unique_ptr<RecordBatchReader>* reader) {
+    return DoGetEndpoints(info, {}, reader);
+  }
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -236,6 +261,32 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoPut({}, descriptor, schema, stream, reader);
   }
 
+  /// \brief Send record batches to the server and read back the record
+  /// batches it computes from them, on a single bidirectional call
+  ///
+  /// The server starts answering once it has received the schema, which is
+  /// sent along with the first record batch written (or when the writer is
+  /// closed), so the reader blocks until then. The final status of the call
+  /// is returned by the reader once the server's stream is exhausted; close
+  /// the writer (or call \a DoneWriting) before that.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the stream
+  /// \param[in] schema the schema for the data to send
+  /// \param[out] writer a writer to write record batches to
+  /// \param[out] reader a reader for the record batches computed by the server
+  /// \return Status
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader);
+  Status DoExchange(const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    return DoExchange({}, descriptor, schema, writer, reader);
+  }
+
  private:
   FlightClient();
   class FlightClientImpl;
@@ -15,7 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iomanip>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -40,11 +46,22 @@ DEFINE_string(server_host, "",
               "one automatically)");
 DEFINE_int32(server_port, 31337, "The port to connect to");
 DEFINE_int32(num_servers, 1, "Number of performance servers to run");
-DEFINE_int32(num_streams, 4, "Number of streams for each server");
-DEFINE_int32(num_threads, 4, "Number of concurrent gets");
+DEFINE_int32(num_streams, 4,
+             "Number of streams for each server (raised to the number of concurrent "
+             "streams if lower)");
+DEFINE_string(num_threads, "4",
+              "Number of concurrent streams, or a comma-separated list to sweep");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
-DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
-DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_string(records_per_batch, "4096",
+              "Total records per batch within stream, or a comma-separated list to "
+              "sweep");
+DEFINE_string(column_types, "int64",
+              "Comma-separated types of the four columns to benchmark: int64, float64 "
+              "or string");
+DEFINE_string(methods, "DoGet",
+              "Comma-separated methods to benchmark: DoGet, DoPut or DoAction");
+DEFINE_bool(test_put, false, "Test DoPut instead of DoGet (same as --methods=DoPut)");
+DEFINE_int32(actions_per_stream, 10000, "Number of DoAction calls per stream");
 
 namespace perf = arrow::flight::perf;
 
@@ -58,6 +75,9 @@ namespace flight {
 struct PerformanceResult {
   int64_t num_records;
   int64_t num_bytes;
+  // Time to read or write each batch, or to complete each action, in
+  // nanoseconds
+  std::vector<int64_t> latencies;
 };
 
 struct PerformanceStats {
@@ -65,14 +85,25 @@ struct PerformanceStats {
   std::mutex mutex;
   int64_t total_records;
   int64_t total_bytes;
+  std::vector<int64_t> latencies;
 
-  void Update(const int64_t total_records, const int64_t total_bytes) {
+  void Update(const PerformanceResult& result) {
     std::lock_guard<std::mutex> lock(this->mutex);
-    this->total_records += total_records;
-    this->total_bytes += total_bytes;
+    this->total_records += result.num_records;
+    this->total_bytes += result.num_bytes;
+    this->latencies.insert(this->latencies.end(), result.latencies.begin(),
+                           result.latencies.end());
   }
 };
 
+// A benchmarked configuration
+struct PerformanceCase {
+  std::string method;
+  std::string column_type;
+  int32_t records_per_batch;
+  int num_threads;
+};
+
 Status WaitForReady(FlightClient* client) {
   Action action{"ping", nullptr};
   for (int attempt = 0; attempt < 10; attempt++) {
@@ -85,6 +116,38 @@ Status WaitForReady(FlightClient* client) {
   return Status::IOError("Server was not available after 10 attempts");
 }
 
+// CPU time of this process, in seconds
+double GetClientCpuTime() {
+  return static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+}
+
+// CPU time of the server process, in seconds
+Status GetServerCpuTime(FlightClient* client, double* out) {
+  Action action{"get-cpu-time", nullptr};
+  std::unique_ptr<ResultStream> stream;
+  RETURN_NOT_OK(client->DoAction(action, &stream));
+  std::unique_ptr<Result> result;
+  RETURN_NOT_OK(stream->Next(&result));
+  if (result == nullptr) {
+    return Status::IOError("Server did not return its CPU time");
+  }
+  *out = std::stod(result->body->ToString());
+  return Status::OK();
+}
+
+// The size of the column buffers of a batch
+int64_t GetBatchBytes(const RecordBatch& batch) {
+  int64_t num_bytes = 0;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    for (const auto& buffer : batch.column_data(i)->buffers) {
+      if (buffer) {
+        num_bytes += buffer->size();
+      }
+    }
+  }
+  return num_bytes;
+}
+
 arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
                                               const perf::Token& token,
                                               const FlightEndpoint& endpoint) {
@@ -93,23 +156,23 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
   FlightStreamChunk batch;
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
   // This must also be set in perf_server.cc
   const bool verify = false;
 
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
+  PerformanceResult result{0, 0, {}};
+  StopWatch timer;
   while (true) {
+    timer.Start();
     RETURN_NOT_OK(reader->Next(&batch));
+    const int64_t latency = static_cast<int64_t>(timer.Stop());
     if (!batch.data) {
       break;
     }
+    result.latencies.push_back(latency);
 
-    if (verify) {
+    if (verify && batch.data->column(0)->type_id() == Type::INT64) {
       auto values = batch.data->column_data(0)->GetValues<int64_t>(1);
-      const int64_t start = token.start() + num_records;
+      const int64_t start = token.start() + result.num_records;
       for (int64_t i = 0; i < batch.data->num_rows(); ++i) {
         if (values[i] != start + i) {
           return Status::Invalid("verification failure");
@@ -117,76 +180,80 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
       }
     }
 
-    num_records += batch.data->num_rows();
-
-    // Hard-coded
-    num_bytes += batch.data->num_rows() * bytes_per_record;
+    result.num_records += batch.data->num_rows();
+    result.num_bytes += GetBatchBytes(*batch.data);
   }
-  return PerformanceResult{num_records, num_bytes};
+  return result;
 }
 
 arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
                                               const perf::Token& token,
-                                              const FlightEndpoint& endpoint) {
+                                              const std::shared_ptr<RecordBatch>& batch) {
   std::unique_ptr<FlightStreamWriter> writer;
   std::unique_ptr<FlightMetadataReader> reader;
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
-  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
-
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
+  RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, batch->schema(), &writer, &reader));
 
-  int64_t num_bytes = 0;
-  int64_t num_records = 0;
-
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
-
-  const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
+  const int64_t length = batch->num_rows();
+  const int64_t batch_bytes = GetBatchBytes(*batch);
 
-  std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
-
-  int records_sent = 0;
-  const int total_records = token.definition().records_per_stream();
-  while (records_sent < total_records) {
-    if (records_sent + length > total_records) {
-      const int last_length = total_records - records_sent;
-      RETURN_NOT_OK(writer->WriteRecordBatch(*(batch->Slice(0, last_length))));
-      num_records += last_length;
-      // Hard-coded
-      num_bytes += last_length * bytes_per_record;
-      records_sent += last_length;
+  PerformanceResult result{0, 0, {}};
+  StopWatch timer;
+  const int64_t total_records = token.definition().records_per_stream();
+  while (result.num_records < total_records) {
+    const int64_t batch_length = std::min(length, total_records - result.num_records);
+    timer.Start();
+    if (batch_length < length) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*(batch->Slice(0, batch_length))));
     } else {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
-      num_records += length;
-      // Hard-coded
-      num_bytes += length * bytes_per_record;
-      records_sent += length;
     }
+    result.latencies.push_back(static_cast<int64_t>(timer.Stop()));
+    result.num_records += batch_length;
+    // Prorated for the last partial batch
+    result.num_bytes += batch_bytes * batch_length / length;
   }
 
   RETURN_NOT_OK(writer->Close());
-  return PerformanceResult{num_records, num_bytes};
+  return result;
 }
 
-Status RunPerformanceTest(FlightClient* client, bool test_put) {
+arrow::Result<PerformanceResult> RunDoActionTest(FlightClient* client) {
+  Action action{"ping", nullptr};
+  PerformanceResult result{0, 0, {}};
+  StopWatch timer;
+  for (int i = 0; i < FLAGS_actions_per_stream; ++i) {
+    timer.Start();
+    std::unique_ptr<ResultStream> stream;
+    RETURN_NOT_OK(client->DoAction(action, &stream));
+    std::unique_ptr<Result> action_result;
+    do {
+      RETURN_NOT_OK(stream->Next(&action_result));
+    } while (action_result != nullptr);
+    result.latencies.push_back(static_cast<int64_t>(timer.Stop()));
+  }
+  return result;
+}
+
+// The q-quantile of sorted latencies, in microseconds
+double GetPercentile(const std::vector<int64_t>& sorted_latencies, double q) {
+  if (sorted_latencies.empty()) {
+    return 0;
+  }
+  const auto rank = static_cast<size_t>(std::ceil(q * sorted_latencies.size()));
+  const size_t index = std::min(std::max<size_t>(rank, 1), sorted_latencies.size()) - 1;
+  return static_cast<double>(sorted_latencies[index]) / 1000.0;
+}
+
+Status RunPerformanceTest(FlightClient* client, const PerformanceCase& test_case) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
 
   // schema not needed
   perf::Perf perf;
-  perf.set_stream_count(FLAGS_num_streams);
+  perf.set_stream_count(std::max(FLAGS_num_streams, test_case.num_threads));
   perf.set_records_per_stream(FLAGS_records_per_stream);
-  perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_records_per_batch(test_case.records_per_batch);
+  perf.set_column_type(test_case.column_type);
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -201,8 +268,32 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   ipc::DictionaryMemo dict_memo;
   RETURN_NOT_OK(plan->GetSchema(&dict_memo, &schema));
 
+  // The batch written by DoPut, made up front to leave it out of the timings
+  std::shared_ptr<RecordBatch> put_batch;
+  if (test_case.method == "DoPut") {
+    RETURN_NOT_OK(
+        MakePerfBatch(test_case.column_type, test_case.records_per_batch, &put_batch));
+  }
+
+  using TestLoop = std::function<arrow::Result<PerformanceResult>(
+      FlightClient*, const perf::Token&, const FlightEndpoint&)>;
+  TestLoop test_loop;
+  if (test_case.method == "DoGet") {
+    test_loop = &RunDoGetTest;
+  } else if (test_case.method == "DoPut") {
+    test_loop = [put_batch](FlightClient* client, const perf::Token& token,
+                            const FlightEndpoint&) {
+      return RunDoPutTest(client, token, put_batch);
+    };
+  } else if (test_case.method == "DoAction") {
+    test_loop = [](FlightClient* client, const perf::Token&, const FlightEndpoint&) {
+      return RunDoActionTest(client);
+    };
+  } else {
+    return Status::Invalid("Unknown method: ", test_case.method);
+  }
+
   PerformanceStats stats;
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
   auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
     std::unique_ptr<FlightClient> client;
@@ -213,12 +304,15 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
 
     const auto& result = test_loop(client.get(), token, endpoint);
     if (result.ok()) {
-      const PerformanceResult& perf = result.ValueOrDie();
-      stats.Update(perf.num_records, perf.num_bytes);
+      stats.Update(result.ValueOrDie());
     }
     return result.status();
   };
 
+  double server_cpu_start, server_cpu_end;
+  RETURN_NOT_OK(GetServerCpuTime(client, &server_cpu_start));
+  const double client_cpu_start = GetClientCpuTime();
+
   StopWatch timer;
   timer.Start();
 
@@ -228,7 +322,7 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   // }
 
   std::shared_ptr<ThreadPool> pool;
-  RETURN_NOT_OK(ThreadPool::Make(FLAGS_num_threads, &pool));
+  RETURN_NOT_OK(ThreadPool::Make(test_case.num_threads, &pool));
   std::vector<std::future<Status>> tasks;
   for (const auto& endpoint : plan->endpoints()) {
     tasks.emplace_back(pool->Submit(ConsumeStream, endpoint));
@@ -244,18 +338,105 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   double time_elapsed =
       static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
 
+  const double client_cpu = GetClientCpuTime() - client_cpu_start;
+  RETURN_NOT_OK(GetServerCpuTime(client, &server_cpu_end));
+  const double server_cpu = server_cpu_end - server_cpu_start;
+
   constexpr double kMegabyte = static_cast<double>(1 << 20);
+  constexpr double kGigabyte = static_cast<double>(1 << 30);
 
   // Check that number of rows read is as expected
-  if (stats.total_records != static_cast<int64_t>(plan->total_records())) {
+  if (test_case.method != "DoAction" &&
+      stats.total_records != static_cast<int64_t>(plan->total_records())) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
-  std::cout << "Bytes read: " << stats.total_bytes << std::endl;
-  std::cout << "Nanos: " << elapsed_nanos << std::endl;
-  std::cout << "Speed: "
-            << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
-            << " MB/s" << std::endl;
+  std::sort(stats.latencies.begin(), stats.latencies.end());
+  const auto num_calls = static_cast<double>(stats.latencies.size());
+
+  std::cout << std::fixed << std::setprecision(1) << test_case.method;
+  if (test_case.method == "DoAction") {
+    std::cout << ", streams: " << test_case.num_threads << std::endl
+              << "  Speed: " << (num_calls / time_elapsed) << " calls/s" << std::endl;
+  } else {
+    std::cout << ", columns: " << test_case.column_type
+              << ", records per batch: " << test_case.records_per_batch
+              << ", streams: " << test_case.num_threads << std::endl
+              << "  Bytes: " << stats.total_bytes << std::endl
+              << "  Speed: "
+              << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
+              << " MB/s, " << (num_calls / time_elapsed) << " batches/s" << std::endl;
+  }
+  std::cout << "  Nanos: " << elapsed_nanos << std::endl
+            << "  Latency (us): p50 " << GetPercentile(stats.latencies, 0.5) << ", p99 "
+            << GetPercentile(stats.latencies, 0.99) << ", p999 "
+            << GetPercentile(stats.latencies, 0.999) << std::endl
+            << std::setprecision(3);
+  if (test_case.method == "DoAction") {
+    std::cout << "  CPU time per call (us): client " << (client_cpu * 1e6 / num_calls)
+              << ", server " << (server_cpu * 1e6 / num_calls) << std::endl;
+  } else {
+    const double gigabytes = static_cast<double>(stats.total_bytes) / kGigabyte;
+    std::cout << "  CPU time per GB (s): client " << (client_cpu / gigabytes)
+              << ", server " << (server_cpu / gigabytes) << std::endl;
+  }
+  return Status::OK();
+}
+
+// The items of a comma-separated flag
+std::vector<std::string> SplitFlag(const std::string& flag) {
+  std::vector<std::string> items;
+  std::stringstream ss(flag);
+  std::string item;
+  while (std::getline(ss, item, ',')) {
+    if (!item.empty()) {
+      items.push_back(item);
+    }
+  }
+  return items;
+}
+
+Status ParseIntFlag(const std::string& name, const std::string& flag,
+                    std::vector<int>* out) {
+  for (const auto& item : SplitFlag(flag)) {
+    char* end = nullptr;
+    const long value = std::strtol(item.c_str(), &end, 10);  // NOLINT
+    if (*end != '\0' || value <= 0) {
+      return Status::Invalid("Invalid value for --", name, ": ", item);
+    }
+    out->push_back(static_cast<int>(value));
+  }
+  if (out->empty()) {
+    return Status::Invalid("No value for --", name);
+  }
+  return Status::OK();
+}
+
+// All the configurations to benchmark. DoAction doesn't depend on the
+// batches
+Status GetPerformanceCases(std::vector<PerformanceCase>* out) {
+  std::vector<int> thread_counts, batch_sizes;
+  RETURN_NOT_OK(ParseIntFlag("num_threads", FLAGS_num_threads, &thread_counts));
+  RETURN_NOT_OK(
+      ParseIntFlag("records_per_batch", FLAGS_records_per_batch, &batch_sizes));
+  const auto methods =
+      FLAGS_test_put ? std::vector<std::string>{"DoPut"} : SplitFlag(FLAGS_methods);
+
+  for (const auto& method : methods) {
+    if (method == "DoAction") {
+      for (int num_threads : thread_counts) {
+        out->push_back({method, "int64", batch_sizes[0], num_threads});
+      }
+      continue;
+    }
+    for (const auto& column_type : SplitFlag(FLAGS_column_types)) {
+      for (int records_per_batch : batch_sizes) {
+        for (int num_threads : thread_counts) {
+          out->push_back({method, column_type, records_per_batch, num_threads});
+        }
+      }
+    }
+  }
   return Status::OK();
 }
 
@@ -277,14 +458,6 @@ int main(int argc, char** argv) {
     hostname = FLAGS_server_host;
   }
 
-  std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
-    std::cout << "DoPut";
-  } else {
-    std::cout << "DoGet";
-  }
-  std::cout << std::endl;
-
   std::cout << "Server host: " << hostname << std::endl
             << "Server port: " << FLAGS_server_port << std::endl;
 
@@ -295,7 +468,12 @@ int main(int argc, char** argv) {
   ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
   ABORT_NOT_OK(arrow::flight::WaitForReady(client.get()));
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put);
+  std::vector<arrow::flight::PerformanceCase> test_cases;
+  arrow::Status s = arrow::flight::GetPerformanceCases(&test_cases);
+  for (const auto& test_case : test_cases) {
+    if (!s.ok()) break;
+    s = arrow::flight::RunPerformanceTest(client.get(), test_case);
+  }
 
   if (server) {
     server->Stop();
@@ -257,6 +257,115 @@ TEST(TestFlight, RoundtripStatus) {
   ASSERT_EQ(FlightStatusCode::Unavailable, detail->code());
 }
 
+// A FlightDataStream failing after a number of payloads
+class FailingStream : public FlightDataStream {
+ public:
+  FailingStream(std::unique_ptr<FlightDataStream> stream, int num_payloads)
+      : stream_(std::move(stream)), num_payloads_(num_payloads) {}
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+  Status GetSchemaPayload(FlightPayload* payload) override {
+    return stream_->GetSchemaPayload(payload);
+  }
+  Status Next(FlightPayload* payload) override {
+    if (num_payloads_-- == 0) {
+      return Status::IOError("Stream failed");
+    }
+    return stream_->Next(payload);
+  }
+
+ private:
+  std::unique_ptr<FlightDataStream> stream_;
+  int num_payloads_;
+};
+
+TEST(TestAsyncFlightDataStream, Payloads) {
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  auto schema = batches[0]->schema();
+
+  for (const int64_t high_watermark : {0, 1 << 10, 1 << 20}) {
+    SCOPED_TRACE("high_watermark = " + std::to_string(high_watermark));
+    AsyncFlightDataStreamOptions options;
+    options.high_watermark = high_watermark;
+    options.low_watermark = high_watermark / 2;
+    RecordBatchStream expected(std::make_shared<BatchIterator>(schema, batches));
+    AsyncFlightDataStream stream(std::unique_ptr<FlightDataStream>(new RecordBatchStream(
+                                     std::make_shared<BatchIterator>(schema, batches))),
+                                 options);
+
+    FlightPayload expected_payload, payload;
+    ASSERT_OK(expected.GetSchemaPayload(&expected_payload));
+    ASSERT_OK(stream.GetSchemaPayload(&payload));
+    ASSERT_TRUE(
+        payload.ipc_message.metadata->Equals(*expected_payload.ipc_message.metadata));
+    int num_payloads = 0;
+    do {
+      ASSERT_OK(expected.Next(&expected_payload));
+      ASSERT_OK(stream.Next(&payload));
+      if (expected_payload.ipc_message.metadata == nullptr) {
+        ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+        break;
+      }
+      ++num_payloads;
+      ASSERT_EQ(expected_payload.ipc_message.type, payload.ipc_message.type);
+      ASSERT_EQ(expected_payload.ipc_message.body_length,
+                payload.ipc_message.body_length);
+      ASSERT_TRUE(
+          payload.ipc_message.metadata->Equals(*expected_payload.ipc_message.metadata));
+    } while (true);
+    // Dictionaries and batches
+    ASSERT_GT(num_payloads, static_cast<int>(batches.size()));
+
+    // The end of the stream is sticky
+    ASSERT_OK(stream.Next(&payload));
+    ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+  }
+}
+
+TEST(TestAsyncFlightDataStream, Errors) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto schema = batches[0]->schema();
+
+  std::unique_ptr<FlightDataStream> failing(new FailingStream(
+      std::unique_ptr<FlightDataStream>(
+          new RecordBatchStream(std::make_shared<BatchIterator>(schema, batches))),
+      2));
+  AsyncFlightDataStream stream(std::move(failing));
+
+  // Payloads produced before the error are returned first
+  FlightPayload payload;
+  ASSERT_OK(stream.GetSchemaPayload(&payload));
+  ASSERT_OK(stream.Next(&payload));
+  ASSERT_NE(nullptr, payload.ipc_message.metadata);
+  ASSERT_OK(stream.Next(&payload));
+  ASSERT_NE(nullptr, payload.ipc_message.metadata);
+  ASSERT_RAISES(IOError, stream.Next(&payload));
+  ASSERT_RAISES(IOError, stream.Next(&payload));
+}
+
+TEST(TestAsyncFlightDataStream, DestroyWhileProducing) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  auto schema = batches[0]->schema();
+
+  AsyncFlightDataStreamOptions options;
+  options.high_watermark = 0;
+  options.low_watermark = 0;
+  for (int i = 0; i < 20; ++i) {
+    AsyncFlightDataStream stream(
+        std::unique_ptr<FlightDataStream>(
+            new RecordBatchStream(std::make_shared<BatchIterator>(schema, batches))),
+        options);
+    FlightPayload payload;
+    ASSERT_OK(stream.GetSchemaPayload(&payload));
+    if (i % 2 == 0) {
+      ASSERT_OK(stream.Next(&payload));
+    }
+  }
+}
+
 // ----------------------------------------------------------------------
 // Client tests
 
@@ -390,6 +499,24 @@ class MetadataTestServer : public FlightServerBase {
   }
 };
 
+// Sends each record batch back to the client along with its metadata
+class ExchangeTestServer : public FlightServerBase {
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightStreamWriter> writer) override {
+    if (!reader->descriptor().Equals(FlightDescriptor::Command("echo"))) {
+      return Status::Invalid("Unknown exchange: ", reader->descriptor().ToString());
+    }
+    FlightStreamChunk chunk;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == nullptr) break;
+      RETURN_NOT_OK(writer->WriteWithMetadata(*chunk.data, chunk.app_metadata));
+    }
+    return writer->Close();
+  }
+};
+
 template <typename T>
 class InsecureTestServer : public ::testing::Test {
  public:
@@ -417,6 +544,7 @@ class InsecureTestServer : public ::testing::Test {
 };
 
 using TestMetadata = InsecureTestServer<MetadataTestServer>;
+using TestDoExchange = InsecureTestServer<ExchangeTestServer>;
 
 class TestAuthHandler : public ::testing::Test {
  public:
@@ -528,6 +656,53 @@ class TestTls : public ::testing::Test {
   std::unique_ptr<InProcessTestServer> server_;
 };
 
+class TestSharedMemory : public ::testing::Test {
+ public:
+  void SetUp() {
+    Location location;
+    std::unique_ptr<FlightServerBase> server = ExampleTestServer();
+
+    ASSERT_OK(Location::ForGrpcTcp("localhost", ::arrow::GetListenPort(), &location));
+    FlightServerOptions options(location);
+    options.allow_shared_memory = true;
+    ASSERT_OK(server->Init(options));
+
+    server_.reset(new InProcessTestServer(std::move(server), location));
+    ASSERT_OK(server_->Start());
+  }
+
+  void TearDown() { server_->Stop(); }
+
+  Status ConnectClient(int64_t shared_memory_capacity) {
+    auto options = FlightClientOptions();
+    options.shared_memory_capacity = shared_memory_capacity;
+    return FlightClient::Connect(server_->location(), options, &client_);
+  }
+
+  // Read the whole stream before comparing, so that the batches hold on to
+  // their ring space
+  void CheckDoGet(const Ticket& ticket, const BatchVector& expected_batches) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(ticket, &stream));
+
+    BatchVector batches;
+    FlightStreamChunk chunk;
+    while (true) {
+      ASSERT_OK(stream->Next(&chunk));
+      if (chunk.data == nullptr) break;
+      batches.push_back(chunk.data);
+    }
+    ASSERT_EQ(expected_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<InProcessTestServer> server_;
+};
+
 TEST_F(TestFlightClient, ListFlights) {
   std::unique_ptr<FlightListing> listing;
   ASSERT_OK(client_->ListFlights(&listing));
@@ -607,6 +782,63 @@ TEST_F(TestFlightClient, DoGetDicts) {
   CheckDoGet(descr, expected_batches, check_endpoints);
 }
 
+TEST_F(TestFlightClient, DoGetEndpoints) {
+  BatchVector int_batches;
+  ASSERT_OK(ExampleIntBatches(&int_batches));
+  const int num_endpoints = 4;
+
+  // Endpoints without a location are read from the server of the client
+  FlightInfo::Data data;
+  std::vector<FlightEndpoint> endpoints(num_endpoints, {{"ticket-ints-1"}, {}});
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"examples"}),
+                           endpoints, -1, -1, &data));
+  FlightInfo info(data);
+
+  FlightEndpointsReadOptions options;
+  options.parallelism = 3;
+  options.max_queued_batches = 2;
+  for (bool ordered : {true, false}) {
+    options.ordered = ordered;
+    std::unique_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGetEndpoints(info, options, &reader));
+    AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+
+    BatchVector batches;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      batches.push_back(batch);
+    }
+    ASSERT_EQ(num_endpoints * int_batches.size(), batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      if (ordered) {
+        ASSERT_BATCHES_EQUAL(*int_batches[i % int_batches.size()], *batches[i]);
+      } else {
+        // The example batches have distinct lengths
+        const auto& expected = int_batches[batches[i]->num_rows() - 10];
+        ASSERT_BATCHES_EQUAL(*expected, *batches[i]);
+      }
+    }
+  }
+
+  // An error in any endpoint fails the reader
+  endpoints[2].ticket.ticket = "ARROW-5095-fail";
+  ASSERT_OK(MakeFlightInfo(*ExampleIntSchema(), FlightDescriptor::Path({"examples"}),
+                           endpoints, -1, -1, &data));
+  std::unique_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->DoGetEndpoints(FlightInfo(data), options, &reader));
+  std::shared_ptr<RecordBatch> batch;
+  Status st;
+  do {
+    st = reader->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(UnknownError, st);
+  ASSERT_THAT(st.message(), ::testing::HasSubstr("Server-side error"));
+}
+
 TEST_F(TestFlightClient, ListActions) {
   std::vector<ActionType> actions;
   ASSERT_OK(client_->ListActions(&actions));
@@ -727,6 +959,62 @@ TEST_F(TestDoPut, DoPutDicts) {
   CheckDoPut(descr, schema, batches);
 }
 
+TEST_F(TestDoPut, DoExchangeNotImplemented) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), batches[0]->schema(),
+                                &writer, &reader));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[0]));
+  ASSERT_OK(writer->DoneWriting());
+  FlightStreamChunk chunk;
+  ASSERT_RAISES(NotImplemented, reader->Next(&chunk));
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, Echo) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), batches[0]->schema(),
+                                &writer, &reader));
+  for (size_t i = 0; i < batches.size(); ++i) {
+    auto metadata = Buffer::FromString(std::to_string(i));
+    ASSERT_OK(writer->WriteWithMetadata(*batches[i], metadata));
+  }
+  ASSERT_OK(writer->DoneWriting());
+
+  ASSERT_TRUE(reader->schema()->Equals(*batches[0]->schema()));
+  FlightStreamChunk chunk;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*batches[i], *chunk.data);
+    ASSERT_NE(nullptr, chunk.app_metadata);
+    ASSERT_EQ(std::to_string(i), chunk.app_metadata->ToString());
+  }
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, UnknownDescriptor) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("sort"), batches[0]->schema(),
+                                &writer, &reader));
+  ASSERT_OK(writer->Close());
+  FlightStreamChunk chunk;
+  ASSERT_RAISES(Invalid, reader->Next(&chunk));
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
@@ -926,5 +1214,47 @@ TEST_F(TestMetadata, DoPutReadMetadata) {
   ASSERT_OK(writer->Close());
 }
 
+TEST_F(TestSharedMemory, DoGet) {
+  BatchVector int_batches, dict_batches;
+  ASSERT_OK(ExampleIntBatches(&int_batches));
+  ASSERT_OK(ExampleDictBatches(&dict_batches));
+
+  ASSERT_OK(ConnectClient(1 << 20));
+  CheckDoGet(Ticket{"ticket-ints-1"}, int_batches);
+  CheckDoGet(Ticket{"ticket-dicts-1"}, dict_batches);
+}
+
+TEST_F(TestSharedMemory, RingFull) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  // Bodies not fitting in the ring, or in what is left of it, go inline
+  for (int64_t capacity : {64, 1024, 4096}) {
+    SCOPED_TRACE("capacity = " + std::to_string(capacity));
+    ASSERT_OK(ConnectClient(capacity));
+    CheckDoGet(Ticket{"ticket-ints-1"}, batches);
+  }
+}
+
+TEST_F(TestFlightClient, DoGetSharedMemoryNotAllowed) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+
+  auto options = FlightClientOptions();
+  options.shared_memory_capacity = 1 << 20;
+  ASSERT_OK(FlightClient::Connect(server_->location(), options, &client_));
+
+  std::unique_ptr<FlightStreamReader> stream;
+  ASSERT_OK(client_->DoGet(Ticket{"ticket-ints-1"}, &stream));
+  FlightStreamChunk chunk;
+  for (const auto& batch : batches) {
+    ASSERT_OK(stream->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*batch, *chunk.data);
+  }
+  ASSERT_OK(stream->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <signal.h>
 #include <cstdint>
+#include <ctime>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -53,23 +54,19 @@ namespace flight {
     }                                                  \
   } while (0)
 
-using ArrayVector = std::vector<std::shared_ptr<Array>>;
-
 // Create record batches with a unique "a" column so we can verify on the
 // client side that the results are correct
 class PerfDataStream : public FlightDataStream {
  public:
   PerfDataStream(bool verify, const int64_t start, const int64_t total_records,
-                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays)
+                 const std::shared_ptr<RecordBatch>& batch)
       : start_(start),
-        verify_(verify),
-        batch_length_(arrays[0]->length()),
+        verify_(verify && batch->column(0)->type_id() == Type::INT64),
+        batch_length_(batch->num_rows()),
         total_records_(total_records),
         records_sent_(0),
-        schema_(schema),
-        arrays_(arrays) {
-    batch_ = RecordBatch::Make(schema, batch_length_, arrays_);
-  }
+        schema_(batch->schema()),
+        batch_(batch) {}
 
   std::shared_ptr<Schema> schema() override { return schema_; }
 
@@ -88,7 +85,7 @@ class PerfDataStream : public FlightDataStream {
     if (verify_) {
       // mutate first array
       auto data =
-          reinterpret_cast<int64_t*>(arrays_[0]->data()->buffers[1]->mutable_data());
+          reinterpret_cast<int64_t*>(batch_->column_data(0)->buffers[1]->mutable_data());
       for (int64_t i = 0; i < batch_length_; ++i) {
         data[i] = start_ + records_sent_ + i;
       }
@@ -117,26 +114,20 @@ class PerfDataStream : public FlightDataStream {
   ipc::DictionaryMemo dictionary_memo_;
   ipc::IpcOptions ipc_options_;
   std::shared_ptr<RecordBatch> batch_;
-  ArrayVector arrays_;
 };
 
-Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
-                      bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
-
-  const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
+std::string GetColumnType(const perf::Perf& definition) {
+  return definition.column_type().empty() ? "int64" : definition.column_type();
+}
 
-  *data_stream = std::unique_ptr<FlightDataStream>(
-      new PerfDataStream(use_verifier, token.start(),
-                         token.definition().records_per_stream(), schema, arrays));
+Status GetPerfBatches(const perf::Token& token, bool use_verifier,
+                      std::unique_ptr<FlightDataStream>* data_stream) {
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(MakePerfBatch(GetColumnType(token.definition()),
+                              token.definition().records_per_batch(), &batch));
+
+  *data_stream = std::unique_ptr<FlightDataStream>(new PerfDataStream(
+      use_verifier, token.start(), token.definition().records_per_stream(), batch));
   return Status::OK();
 }
 
@@ -144,8 +135,6 @@ class FlightPerfServer : public FlightServerBase {
  public:
   FlightPerfServer() : location_() {
     DCHECK_OK(Location::ForGrpcTcp("localhost", FLAGS_port, &location_));
-    perf_schema_ = schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                           field("d", int64())});
   }
 
   Status GetFlightInfo(const ServerCallContext& context, const FlightDescriptor& request,
@@ -153,6 +142,9 @@ class FlightPerfServer : public FlightServerBase {
     perf::Perf perf_request;
     CHECK_PARSE(perf_request.ParseFromString(request.cmd));
 
+    std::shared_ptr<RecordBatch> schema_batch;
+    RETURN_NOT_OK(MakePerfBatch(GetColumnType(perf_request), 0, &schema_batch));
+
     perf::Token token;
     token.mutable_definition()->CopyFrom(perf_request);
 
@@ -172,8 +164,8 @@ class FlightPerfServer : public FlightServerBase {
         perf_request.stream_count() * perf_request.records_per_stream();
 
     FlightInfo::Data data;
-    RETURN_NOT_OK(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, &data));
+    RETURN_NOT_OK(MakeFlightInfo(*schema_batch->schema(), request, endpoints,
+                                 total_records, -1, &data));
     *info = std::unique_ptr<FlightInfo>(new FlightInfo(data));
     return Status::OK();
   }
@@ -182,7 +174,7 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
-    return GetPerfBatches(token, perf_schema_, false, data_stream);
+    return GetPerfBatches(token, false, data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -205,13 +197,20 @@ class FlightPerfServer : public FlightServerBase {
       std::shared_ptr<Buffer> buf = Buffer::FromString("ok");
       *result = std::unique_ptr<ResultStream>(new SimpleResultStream({Result{buf}}));
       return Status::OK();
+    } else if (action.type == "get-cpu-time") {
+      // Process CPU time in seconds, for the benchmark to report the server
+      // CPU time per GB
+      const double cpu_seconds =
+          static_cast<double>(std::clock()) / static_cast<double>(CLOCKS_PER_SEC);
+      std::shared_ptr<Buffer> buf = Buffer::FromString(std::to_string(cpu_seconds));
+      *result = std::unique_ptr<ResultStream>(new SimpleResultStream({Result{buf}}));
+      return Status::OK();
     }
     return Status::NotImplemented(action.type);
   }
 
  private:
   Location location_;
-  std::shared_ptr<Schema> perf_schema_;
 };
 
 }  // namespace flight
@@ -17,6 +17,7 @@
 
 #include "arrow/flight/serialization_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <string>
@@ -55,21 +56,10 @@ using arrow::ipc::internal::IpcPayload;
 
 using google::protobuf::internal::WireFormatLite;
 using google::protobuf::io::ArrayOutputStream;
-using google::protobuf::io::CodedInputStream;
 using google::protobuf::io::CodedOutputStream;
 
 using grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  *out = SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  return input->Skip(static_cast<int>(length));
-}
-
 // Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
@@ -84,7 +74,8 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+  // Expose the contents of a ByteBuffer as one buffer per gRPC slice
+  static Status Wrap(ByteBuffer* cpp_buf, BufferVector* out) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
 
@@ -93,15 +84,17 @@ class GrpcBuffer : public MutableBuffer {
     // This part below is based on the Flatbuffers gRPC SerializationTraits in
     // flatbuffers/grpc.h
 
-    // Check if this is a single uncompressed slice.
+    out->clear();
+    // Check if this is uncompressed data.
     if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      // Increment reference count so this memory remains valid
-      *out = std::make_shared<GrpcBuffer>(slice, true);
+        (buffer->data.raw.compression == GRPC_COMPRESS_NONE)) {
+      // If it is, then we can reference each `grpc_slice` directly. Large
+      // messages are usually received in several slices.
+      const grpc_slice_buffer& slices = buffer->data.raw.slice_buffer;
+      for (size_t i = 0; i < slices.count; ++i) {
+        // Increment reference count so this memory remains valid
+        out->push_back(std::make_shared<GrpcBuffer>(slices.slices[i], true));
+      }
     } else {
       // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
       // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
@@ -114,7 +107,7 @@ class GrpcBuffer : public MutableBuffer {
       grpc_byte_buffer_reader_destroy(&reader);
 
       // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
+      out->push_back(std::make_shared<GrpcBuffer>(slice, false));
     }
 
     return Status::OK();
@@ -124,6 +117,88 @@ class GrpcBuffer : public MutableBuffer {
   grpc_slice slice_;
 };
 
+// Reads protobuf wire format from the slices of a gRPC message, so that bytes
+// fields can reference the slices rather than a contiguous copy of the message
+class SliceReader {
+ public:
+  explicit SliceReader(const BufferVector& slices)
+      : slices_(slices), slice_index_(0), position_(0) {
+    SkipExhaustedSlices();
+  }
+
+  bool done() const { return slice_index_ == slices_.size(); }
+
+  bool ReadVarint(uint64_t* out) {
+    uint64_t result = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (done()) {
+        return false;
+      }
+      const uint8_t byte = slices_[slice_index_]->data()[position_];
+      Advance(1);
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        *out = result;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Read a length-prefixed bytes field, as one zero-copy piece per slice it
+  // spans
+  bool ReadBytes(BufferVector* out) {
+    uint64_t length;
+    if (!ReadVarint(&length)) {
+      return false;
+    }
+    out->clear();
+    while (length > 0) {
+      if (done()) {
+        return false;
+      }
+      const std::shared_ptr<Buffer>& slice = slices_[slice_index_];
+      const auto available = static_cast<uint64_t>(slice->size() - position_);
+      const auto nbytes = static_cast<int64_t>(std::min(length, available));
+      out->push_back(SliceBuffer(slice, position_, nbytes));
+      Advance(nbytes);
+      length -= static_cast<uint64_t>(nbytes);
+    }
+    return true;
+  }
+
+  // Read a length-prefixed bytes field into a single buffer, only copying it
+  // if it spans several slices
+  bool ReadContiguousBytes(std::shared_ptr<Buffer>* out) {
+    BufferVector pieces;
+    if (!ReadBytes(&pieces)) {
+      return false;
+    }
+    if (pieces.size() == 1) {
+      *out = pieces[0];
+      return true;
+    }
+    return ConcatenateBuffers(pieces, default_memory_pool(), out).ok();
+  }
+
+ private:
+  void Advance(int64_t nbytes) {
+    position_ += nbytes;
+    SkipExhaustedSlices();
+  }
+
+  void SkipExhaustedSlices() {
+    while (!done() && position_ == slices_[slice_index_]->size()) {
+      ++slice_index_;
+      position_ = 0;
+    }
+  }
+
+  const BufferVector& slices_;
+  size_t slice_index_;
+  int64_t position_;
+};
+
 // Destructor callback for grpc::Slice
 static void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -173,12 +248,15 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
     header_size += 1 + WireFormatLite::LengthDelimitedSize(app_metadata_size);
   }
 
+  size_t num_body_slices = 0;
   for (const auto& buffer : ipc_msg.body_buffers) {
     // Buffer may be null when the row length is zero, or when all
     // entries are invalid.
-    if (!buffer) continue;
+    if (!buffer || buffer->size() == 0) continue;
 
     body_size += static_cast<size_t>(BitUtil::RoundUpToMultipleOf8(buffer->size()));
+    // The buffer and its padding
+    num_body_slices += 2;
   }
 
   bool has_body = ipc::Message::HasBody(ipc_msg.type);
@@ -198,6 +276,7 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
 
   // Allocate and initialize slices
   std::vector<grpc::Slice> slices;
+  slices.reserve(1 + num_body_slices);
   grpc::Slice header_slice(header_size);
   slices.push_back(header_slice);
 
@@ -242,16 +321,18 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
     // Enqueue body buffers for writing, without copying
     for (const auto& buffer : ipc_msg.body_buffers) {
       // Buffer may be null when the row length is zero, or when all
-      // entries are invalid.
-      if (!buffer) continue;
+      // entries are invalid.  Empty buffers don't need a slice.
+      if (!buffer || buffer->size() == 0) continue;
 
       slices.push_back(SliceFromBuffer(buffer));
 
-      // Write padding if not multiple of 8
+      // Write padding if not multiple of 8, from static memory rather than a
+      // new slice
       const auto remainder = static_cast<int>(
           BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
       if (remainder) {
-        slices.push_back(grpc::Slice(kPaddingBytes, remainder));
+        slices.push_back(
+            grpc::Slice(kPaddingBytes, remainder, grpc::Slice::STATIC_SLICE));
       }
     }
   }
@@ -271,32 +352,27 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
     return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
   }
 
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  BufferVector slices;
+  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &slices));
 
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
-
-  // TODO(wesm): The 2-parameter version of this function is deprecated
-  pb_stream.SetTotalBytesLimit(buffer_length, -1 /* no threshold */);
-
-  // This is the bytes remaining when using CodedInputStream like this
-  while (pb_stream.BytesUntilTotalBytesLimit()) {
-    const uint32_t tag = pb_stream.ReadTag();
-    const int field_number = WireFormatLite::GetTagFieldNumber(tag);
+  SliceReader reader(slices);
+  while (!reader.done()) {
+    uint64_t tag;
+    if (!reader.ReadVarint(&tag)) {
+      return grpc::Status(grpc::StatusCode::INTERNAL, "Unable to read FlightData tag");
+    }
+    const int field_number =
+        WireFormatLite::GetTagFieldNumber(static_cast<uint32_t>(tag));
     switch (field_number) {
       case pb::FlightData::kFlightDescriptorFieldNumber: {
         pb::FlightDescriptor pb_descriptor;
-        uint32_t length;
-        if (!pb_stream.ReadVarint32(&length)) {
+        std::shared_ptr<Buffer> serialized;
+        if (!reader.ReadContiguousBytes(&serialized)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to parse length of FlightDescriptor");
+                              "Unable to read FlightDescriptor");
         }
-        // Can't use ParseFromCodedStream as this reads the entire
-        // rest of the stream into the descriptor command field.
-        std::string buffer;
-        pb_stream.ReadString(&buffer, length);
-        if (!pb_descriptor.ParseFromString(buffer)) {
+        if (!pb_descriptor.ParseFromArray(serialized->data(),
+                                          static_cast<int>(serialized->size()))) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to parse FlightDescriptor");
         }
@@ -306,19 +382,21 @@ grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
         out->descriptor.reset(new arrow::flight::FlightDescriptor(descriptor));
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!reader.ReadContiguousBytes(&out->metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData metadata");
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!reader.ReadContiguousBytes(&out->app_metadata)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData application metadata");
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        // The body stays split along slice boundaries; the IPC reader only
+        // copies the Arrow buffers that straddle one
+        if (!reader.ReadBytes(&out->body)) {
           return grpc::Status(grpc::StatusCode::INTERNAL,
                               "Unable to read FlightData body");
         }
@@ -361,6 +439,13 @@ bool WritePayload(const FlightPayload& payload,
                        grpc::WriteOptions());
 }
 
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                       grpc::WriteOptions());
+}
+
 bool WritePayload(const FlightPayload& payload,
                   grpc::ServerWriter<pb::FlightData>* writer) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
@@ -368,17 +453,36 @@ bool WritePayload(const FlightPayload& payload,
                        grpc::WriteOptions());
 }
 
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                       grpc::WriteOptions());
+}
+
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
 }
 
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}
+
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
                  FlightData* data) {
   // Pretend to be pb::FlightData and intercept in SerializationTraits
   return reader->Read(reinterpret_cast<pb::FlightData*>(data));
 }
 
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data) {
+  // Pretend to be pb::FlightData and intercept in SerializationTraits
+  return reader->Read(reinterpret_cast<pb::FlightData*>(data));
+}
+
 #ifndef _WIN32
 #pragma GCC diagnostic pop
 #endif
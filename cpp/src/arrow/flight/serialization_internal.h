@@ -22,15 +22,13 @@
 
 #include <memory>
 
+#include "arrow/buffer.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/types.h"
 #include "arrow/ipc/message.h"
 #include "arrow/status.h"
 
 namespace arrow {
-
-class Buffer;
-
 namespace flight {
 namespace internal {
 
@@ -46,8 +44,8 @@ struct FlightData {
   /// Application-defined metadata
   std::shared_ptr<Buffer> app_metadata;
 
-  /// Message body
-  std::shared_ptr<Buffer> body;
+  /// Message body, as one buffer per gRPC slice it was received in
+  BufferVector body;
 
   /// Open IPC message from the metadata and body
   Status OpenMessage(std::unique_ptr<ipc::Message>* message);
@@ -57,14 +55,22 @@ struct FlightData {
 /// True is returned on success, false if some error occurred (connection closed?).
 bool WritePayload(const FlightPayload& payload,
                   grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* writer);
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* writer);
 bool WritePayload(const FlightPayload& payload,
                   grpc::ServerWriter<pb::FlightData>* writer);
+bool WritePayload(const FlightPayload& payload,
+                  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer);
 
 /// Read Flight message from gRPC stream with zero-copy optimizations.
 /// True is returned on success, false if stream ended.
 bool ReadPayload(grpc::ClientReader<pb::FlightData>* reader, FlightData* data);
+bool ReadPayload(grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data);
 bool ReadPayload(grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
                  FlightData* data);
+bool ReadPayload(grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* reader,
+                 FlightData* data);
 
 }  // namespace internal
 }  // namespace flight
@@ -22,8 +22,11 @@
 
 #include <signal.h>
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -45,11 +48,13 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/server_auth.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 using FlightService = arrow::flight::protocol::FlightService;
@@ -70,15 +75,16 @@ namespace flight {
 
 namespace {
 
-// A MessageReader implementation that reads from a gRPC ServerReader
+// A MessageReader implementation that reads from a gRPC ServerReaderWriter,
+// the stream of a DoPut or a DoExchange call
+template <typename Stream>
 class FlightIpcMessageReader : public ipc::MessageReader {
  public:
-  explicit FlightIpcMessageReader(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
-      std::shared_ptr<Buffer>* last_metadata)
+  explicit FlightIpcMessageReader(Stream* reader, std::shared_ptr<Buffer>* last_metadata)
       : reader_(reader), app_metadata_(last_metadata) {}
 
   Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
+    ScopedMemoryTag memory_tag("flight.recv");
     if (stream_finished_) {
       *out = nullptr;
       *app_metadata_ = nullptr;
@@ -99,7 +105,7 @@ class FlightIpcMessageReader : public ipc::MessageReader {
 
     if (first_message_) {
       if (!data.descriptor) {
-        return Status::Invalid("DoPut must start with non-null descriptor");
+        return Status::Invalid("Stream must start with non-null descriptor");
       }
       descriptor_ = *data.descriptor;
       first_message_ = false;
@@ -113,21 +119,20 @@ class FlightIpcMessageReader : public ipc::MessageReader {
   const FlightDescriptor& descriptor() const { return descriptor_; }
 
  protected:
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
+  Stream* reader_;
   bool stream_finished_ = false;
   bool first_message_ = true;
   FlightDescriptor descriptor_;
   std::shared_ptr<Buffer>* app_metadata_;
 };
 
+template <typename Stream>
 class FlightMessageReaderImpl : public FlightMessageReader {
  public:
-  explicit FlightMessageReaderImpl(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader)
-      : reader_(reader) {}
+  explicit FlightMessageReaderImpl(Stream* reader) : reader_(reader) {}
 
   Status Init() {
-    message_reader_ = new FlightIpcMessageReader(reader_, &last_metadata_);
+    message_reader_ = new FlightIpcMessageReader<Stream>(reader_, &last_metadata_);
     return ipc::RecordBatchStreamReader::Open(
         std::unique_ptr<ipc::MessageReader>(message_reader_), &batch_reader_);
   }
@@ -148,17 +153,106 @@ class FlightMessageReaderImpl : public FlightMessageReader {
  private:
   std::shared_ptr<Schema> schema_;
   std::unique_ptr<ipc::DictionaryMemo> dictionary_memo_;
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
-  FlightIpcMessageReader* message_reader_;
+  Stream* reader_;
+  FlightIpcMessageReader<Stream>* message_reader_;
   std::shared_ptr<Buffer> last_metadata_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
 };
 
+using DoPutStream = grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>;
+using DoExchangeStream = grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>;
+
+// The next two classes are intertwined, like their counterparts in the
+// client: the IpcPayloadWriter takes the application metadata to send with
+// the next record batch from the FlightStreamWriter.
+class GrpcServerStreamWriter;
+
+/// A IpcPayloadWriter implementation that writes to a DoExchange stream
+class DoExchangePayloadWriter : public ipc::internal::IpcPayloadWriter {
+ public:
+  DoExchangePayloadWriter(DoExchangeStream* stream, GrpcServerStreamWriter* stream_writer)
+      : stream_(stream), stream_writer_(stream_writer) {}
+
+  Status WritePayload(const ipc::internal::IpcPayload& ipc_payload) override;
+
+  // The stream is finished when the RPC handler returns
+  Status Close() override { return Status::OK(); }
+
+ private:
+  DoExchangeStream* stream_;
+  GrpcServerStreamWriter* stream_writer_;
+};
+
+// A FlightStreamWriter sending record batches back to the client of a
+// DoExchange call.  The schema is taken from the first record batch written.
+class GrpcServerStreamWriter : public FlightStreamWriter {
+ public:
+  explicit GrpcServerStreamWriter(DoExchangeStream* stream) : stream_(stream) {}
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    return WriteWithMetadata(batch, nullptr);
+  }
+
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override {
+    if (done_writing_) {
+      return Status::Invalid("Cannot write after DoneWriting()");
+    }
+    if (!batch_writer_) {
+      std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+          new DoExchangePayloadWriter(stream_, this));
+      RETURN_NOT_OK(ipc::internal::OpenRecordBatchWriter(
+          std::move(payload_writer), batch.schema(), &batch_writer_));
+      if (pool_ != nullptr) {
+        batch_writer_->set_memory_pool(pool_);
+      }
+    }
+    app_metadata_ = std::move(app_metadata);
+    return batch_writer_->WriteRecordBatch(batch);
+  }
+
+  Status DoneWriting() override {
+    done_writing_ = true;
+    return Status::OK();
+  }
+
+  void set_memory_pool(MemoryPool* pool) override {
+    pool_ = pool;
+    if (batch_writer_) {
+      batch_writer_->set_memory_pool(pool);
+    }
+  }
+
+  Status Close() override {
+    done_writing_ = true;
+    return batch_writer_ ? batch_writer_->Close() : Status::OK();
+  }
+
+ private:
+  friend class DoExchangePayloadWriter;
+  DoExchangeStream* stream_;
+  std::shared_ptr<Buffer> app_metadata_;
+  std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
+  MemoryPool* pool_ = nullptr;
+  bool done_writing_ = false;
+};
+
+Status DoExchangePayloadWriter::WritePayload(
+    const ipc::internal::IpcPayload& ipc_payload) {
+  FlightPayload payload;
+  payload.ipc_message = ipc_payload;
+  if (ipc_payload.type == ipc::Message::RECORD_BATCH && stream_writer_->app_metadata_) {
+    payload.app_metadata = std::move(stream_writer_->app_metadata_);
+  }
+  if (!internal::WritePayload(payload, stream_)) {
+    return Status::IOError("Could not write record batch to stream");
+  }
+  return Status::OK();
+}
+
 class GrpcMetadataWriter : public FlightMetadataWriter {
  public:
-  explicit GrpcMetadataWriter(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer)
-      : writer_(writer) {}
+  explicit GrpcMetadataWriter(DoPutStream* writer) : writer_(writer) {}
 
   Status WriteMetadata(const Buffer& buffer) override {
     pb::PutResult message{};
@@ -170,7 +264,7 @@ class GrpcMetadataWriter : public FlightMetadataWriter {
   }
 
  private:
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* writer_;
+  DoPutStream* writer_;
 };
 
 class GrpcServerAuthReader : public ServerAuthReader {
@@ -225,9 +319,11 @@ class GrpcServerCallContext : public ServerCallContext {
 // gRPC service definition, so the latter is not exposed in the public API
 class FlightServiceImpl : public FlightService::Service {
  public:
-  explicit FlightServiceImpl(std::shared_ptr<ServerAuthHandler> auth_handler,
-                             FlightServerBase* server)
-      : auth_handler_(auth_handler), server_(server) {}
+  FlightServiceImpl(std::shared_ptr<ServerAuthHandler> auth_handler,
+                    FlightServerBase* server, bool allow_shared_memory)
+      : auth_handler_(auth_handler),
+        server_(server),
+        allow_shared_memory_(allow_shared_memory) {}
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -277,7 +373,7 @@ class FlightServiceImpl : public FlightService::Service {
       return grpc::Status::OK;
     }
 
-    const auto client_metadata = context->client_metadata();
+    const auto& client_metadata = context->client_metadata();
     const auto auth_header = client_metadata.find(internal::kGrpcAuthHeader);
     std::string token;
     if (auth_header == client_metadata.end()) {
@@ -289,6 +385,27 @@ class FlightServiceImpl : public FlightService::Service {
     return grpc::Status::OK;
   }
 
+  // Map the shared memory segment offered by the client, if allowed and
+  // possible, and accept it in the initial metadata of the call
+  std::shared_ptr<internal::SharedMemoryRing> OpenSharedMemory(ServerContext* context) {
+    if (!allow_shared_memory_) {
+      return nullptr;
+    }
+    const auto client_metadata = context->client_metadata();
+    const auto header = client_metadata.find(internal::kSharedMemorySegmentHeader);
+    if (header == client_metadata.end()) {
+      return nullptr;
+    }
+    std::shared_ptr<internal::SharedMemoryRing> ring;
+    const std::string name(header->second.data(), header->second.length());
+    // e.g. the client runs on another host
+    if (!internal::SharedMemoryRing::Open(name, &ring).ok()) {
+      return nullptr;
+    }
+    context->AddInitialMetadata(internal::kSharedMemoryAcceptedHeader, "1");
+    return ring;
+  }
+
   grpc::Status Handshake(
       ServerContext* context,
       grpc::ServerReaderWriter<pb::HandshakeResponse, pb::HandshakeRequest>* stream) {
@@ -381,6 +498,8 @@ class FlightServiceImpl : public FlightService::Service {
       return grpc::Status(grpc::StatusCode::NOT_FOUND, "No data in this flight");
     }
 
+    std::shared_ptr<internal::SharedMemoryRing> ring = OpenSharedMemory(context);
+
     // Write the schema as the first message in the stream
     FlightPayload schema_payload;
     GRPC_RETURN_NOT_OK(data_stream->GetSchemaPayload(&schema_payload));
@@ -393,6 +512,16 @@ class FlightServiceImpl : public FlightService::Service {
     while (true) {
       FlightPayload payload;
       GRPC_RETURN_NOT_OK(data_stream->Next(&payload));
+      if (payload.ipc_message.metadata != nullptr && ring &&
+          ring->CanWrite(payload.ipc_message)) {
+        // Send the body through shared memory, and its descriptor in its place
+        std::shared_ptr<Buffer> descriptor;
+        GRPC_RETURN_NOT_OK(ring->Write(payload.ipc_message, &descriptor));
+        if (descriptor) {
+          payload.ipc_message.body_buffers = {descriptor};
+          payload.ipc_message.body_length = descriptor->size();
+        }
+      }
       if (payload.ipc_message.metadata == nullptr ||
           !internal::WritePayload(payload, writer))
         // No more messages to write, or connection terminated for some other
@@ -402,13 +531,12 @@ class FlightServiceImpl : public FlightService::Service {
     return grpc::Status::OK;
   }
 
-  grpc::Status DoPut(ServerContext* context,
-                     grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader) {
+  grpc::Status DoPut(ServerContext* context, DoPutStream* reader) {
     GrpcServerCallContext flight_context;
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(context, flight_context));
 
-    auto message_reader =
-        std::unique_ptr<FlightMessageReaderImpl>(new FlightMessageReaderImpl(reader));
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<DoPutStream>>(
+        new FlightMessageReaderImpl<DoPutStream>(reader));
     GRPC_RETURN_NOT_OK(message_reader->Init());
     auto metadata_writer =
         std::unique_ptr<FlightMetadataWriter>(new GrpcMetadataWriter(reader));
@@ -416,6 +544,19 @@ class FlightServiceImpl : public FlightService::Service {
         flight_context, std::move(message_reader), std::move(metadata_writer)));
   }
 
+  grpc::Status DoExchange(ServerContext* context, DoExchangeStream* stream) {
+    GrpcServerCallContext flight_context;
+    GRPC_RETURN_NOT_GRPC_OK(CheckAuth(context, flight_context));
+
+    auto message_reader = std::unique_ptr<FlightMessageReaderImpl<DoExchangeStream>>(
+        new FlightMessageReaderImpl<DoExchangeStream>(stream));
+    GRPC_RETURN_NOT_OK(message_reader->Init());
+    auto stream_writer =
+        std::unique_ptr<FlightStreamWriter>(new GrpcServerStreamWriter(stream));
+    return internal::ToGrpcStatus(server_->DoExchange(
+        flight_context, std::move(message_reader), std::move(stream_writer)));
+  }
+
   grpc::Status ListActions(ServerContext* context, const pb::Empty* request,
                            ServerWriter<pb::ActionType>* writer) {
     GrpcServerCallContext flight_context;
@@ -461,6 +602,7 @@ class FlightServiceImpl : public FlightService::Service {
  private:
   std::shared_ptr<ServerAuthHandler> auth_handler_;
   FlightServerBase* server_;
+  bool allow_shared_memory_;
 };
 
 }  // namespace
@@ -517,7 +659,10 @@ thread_local std::atomic<FlightServerBase::Impl*>
 #endif
 
 FlightServerOptions::FlightServerOptions(const Location& location_)
-    : location(location_), auth_handler(nullptr), tls_certificates() {}
+    : location(location_),
+      auth_handler(nullptr),
+      tls_certificates(),
+      allow_shared_memory(false) {}
 
 FlightServerBase::FlightServerBase() { impl_.reset(new Impl); }
 
@@ -525,7 +670,8 @@ FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(FlightServerOptions& options) {
   std::shared_ptr<ServerAuthHandler> handler = std::move(options.auth_handler);
-  impl_->service_.reset(new FlightServiceImpl(handler, this));
+  impl_->service_.reset(
+      new FlightServiceImpl(handler, this, options.allow_shared_memory));
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
@@ -638,6 +784,12 @@ Status FlightServerBase::DoPut(const ServerCallContext& context,
   return Status::NotImplemented("NYI");
 }
 
+Status FlightServerBase::DoExchange(const ServerCallContext& context,
+                                    std::unique_ptr<FlightMessageReader> reader,
+                                    std::unique_ptr<FlightStreamWriter> writer) {
+  return Status::NotImplemented("NYI");
+}
+
 Status FlightServerBase::DoAction(const ServerCallContext& context, const Action& action,
                                   std::unique_ptr<ResultStream>* result) {
   return Status::NotImplemented("NYI");
@@ -668,7 +820,10 @@ class RecordBatchStream::RecordBatchStreamImpl {
 
   RecordBatchStreamImpl(const std::shared_ptr<RecordBatchReader>& reader,
                         MemoryPool* pool)
-      : pool_(pool), reader_(reader), ipc_options_(ipc::IpcOptions::Defaults()) {}
+      : pool_(pool),
+        reader_(reader),
+        ipc_options_(ipc::IpcOptions::Defaults()),
+        batch_payload_builder_(ipc_options_, pool) {}
 
   std::shared_ptr<Schema> schema() { return reader_->schema(); }
 
@@ -692,8 +847,7 @@ class RecordBatchStream::RecordBatchStreamImpl {
     if (stage_ == Stage::DICTIONARY) {
       if (dictionary_index_ == static_cast<int>(dictionaries_.size())) {
         stage_ = Stage::RECORD_BATCH;
-        return ipc::internal::GetRecordBatchPayload(*current_batch_, ipc_options_, pool_,
-                                                    &payload->ipc_message);
+        return batch_payload_builder_.Build(*current_batch_, &payload->ipc_message);
       } else {
         return GetNextDictionary(payload);
       }
@@ -707,8 +861,7 @@ class RecordBatchStream::RecordBatchStreamImpl {
       payload->ipc_message.metadata = nullptr;
       return Status::OK();
     } else {
-      return ipc::internal::GetRecordBatchPayload(*current_batch_, ipc_options_, pool_,
-                                                  &payload->ipc_message);
+      return batch_payload_builder_.Build(*current_batch_, &payload->ipc_message);
     }
   }
 
@@ -732,6 +885,8 @@ class RecordBatchStream::RecordBatchStreamImpl {
   std::shared_ptr<RecordBatchReader> reader_;
   ipc::DictionaryMemo dictionary_memo_;
   ipc::IpcOptions ipc_options_;
+  // Reuses the metadata of the previous record batch
+  ipc::internal::RecordBatchPayloadBuilder batch_payload_builder_;
   std::shared_ptr<RecordBatch> current_batch_;
   std::vector<std::pair<int64_t, std::shared_ptr<Array>>> dictionaries_;
 
@@ -756,5 +911,156 @@ Status RecordBatchStream::GetSchemaPayload(FlightPayload* payload) {
 
 Status RecordBatchStream::Next(FlightPayload* payload) { return impl_->Next(payload); }
 
+// ----------------------------------------------------------------------
+// Implement AsyncFlightDataStream
+
+class AsyncFlightDataStream::AsyncFlightDataStreamImpl
+    : public std::enable_shared_from_this<AsyncFlightDataStreamImpl> {
+ public:
+  AsyncFlightDataStreamImpl(std::unique_ptr<FlightDataStream> stream,
+                            const AsyncFlightDataStreamOptions& options)
+      : stream_(std::move(stream)), options_(options) {}
+
+  std::shared_ptr<Schema> schema() { return stream_->schema(); }
+
+  Status GetSchemaPayload(FlightPayload* payload) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (started_) {
+        return Status::Invalid("GetSchemaPayload called after Next");
+      }
+    }
+    RETURN_NOT_OK(stream_->GetSchemaPayload(payload));
+    std::lock_guard<std::mutex> lock(mutex_);
+    StartLocked();
+    return status_;
+  }
+
+  Status Next(FlightPayload* payload) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    StartLocked();
+    cv_.wait(lock, [this] { return !queue_.empty() || finished_ || !status_.ok(); });
+    if (queue_.empty()) {
+      RETURN_NOT_OK(status_);
+      // Signal that iteration is over
+      payload->ipc_message.metadata = nullptr;
+      return Status::OK();
+    }
+
+    *payload = std::move(queue_.front());
+    queue_.pop_front();
+    queued_bytes_ -= PayloadSize(*payload);
+    if (paused_ && (queued_bytes_ <= options_.low_watermark || queue_.empty())) {
+      paused_ = false;
+      SpawnProducerLocked();
+    }
+    return Status::OK();
+  }
+
+  void Stop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    stopped_ = true;
+    cv_.wait(lock, [this] { return !producing_; });
+  }
+
+ private:
+  static int64_t PayloadSize(const FlightPayload& payload) {
+    int64_t size = payload.ipc_message.body_length;
+    if (payload.ipc_message.metadata) {
+      size += payload.ipc_message.metadata->size();
+    }
+    if (payload.app_metadata) {
+      size += payload.app_metadata->size();
+    }
+    return size;
+  }
+
+  void StartLocked() {
+    if (!started_) {
+      started_ = true;
+      SpawnProducerLocked();
+    }
+  }
+
+  void SpawnProducerLocked() {
+    producing_ = true;
+    auto self = shared_from_this();
+    Status st = options_.executor->Spawn([self]() { self->Produce(); });
+    if (!st.ok()) {
+      producing_ = false;
+      status_ = st;
+    }
+  }
+
+  // Produce payloads until the queue reaches the high watermark, the stream
+  // ends or fails, or the AsyncFlightDataStream is destroyed
+  void Produce() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (stopped_) {
+        break;
+      }
+      if (!queue_.empty() && queued_bytes_ >= options_.high_watermark) {
+        // Next() spawns a new producer once the queue has drained
+        paused_ = true;
+        break;
+      }
+
+      FlightPayload payload;
+      lock.unlock();
+      Status st = stream_->Next(&payload);
+      lock.lock();
+      if (!st.ok()) {
+        status_ = st;
+        break;
+      }
+      if (payload.ipc_message.metadata == nullptr) {
+        finished_ = true;
+        break;
+      }
+      queued_bytes_ += PayloadSize(payload);
+      queue_.push_back(std::move(payload));
+      cv_.notify_all();
+    }
+    producing_ = false;
+    cv_.notify_all();
+  }
+
+  std::unique_ptr<FlightDataStream> stream_;
+  AsyncFlightDataStreamOptions options_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<FlightPayload> queue_;
+  int64_t queued_bytes_ = 0;
+  Status status_;
+  bool started_ = false;
+  bool producing_ = false;
+  bool paused_ = false;
+  bool finished_ = false;
+  bool stopped_ = false;
+};
+
+AsyncFlightDataStreamOptions::AsyncFlightDataStreamOptions()
+    : executor(::arrow::internal::GetCpuThreadPool()),
+      high_watermark(64 << 20),
+      low_watermark(16 << 20) {}
+
+AsyncFlightDataStream::AsyncFlightDataStream(std::unique_ptr<FlightDataStream> stream,
+                                             const AsyncFlightDataStreamOptions& options)
+    : impl_(std::make_shared<AsyncFlightDataStreamImpl>(std::move(stream), options)) {}
+
+AsyncFlightDataStream::~AsyncFlightDataStream() { impl_->Stop(); }
+
+std::shared_ptr<Schema> AsyncFlightDataStream::schema() { return impl_->schema(); }
+
+Status AsyncFlightDataStream::GetSchemaPayload(FlightPayload* payload) {
+  return impl_->GetSchemaPayload(payload);
+}
+
+Status AsyncFlightDataStream::Next(FlightPayload* payload) {
+  return impl_->Next(payload);
+}
+
 }  // namespace flight
 }  // namespace arrow
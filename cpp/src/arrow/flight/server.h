@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -37,6 +38,12 @@ class MemoryPool;
 class Schema;
 class Status;
 
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace flight {
 
 /// \brief Interface that produces a sequence of IPC payloads to be sent in
@@ -74,6 +81,51 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief Options for AsyncFlightDataStream
+class ARROW_FLIGHT_EXPORT AsyncFlightDataStreamOptions {
+ public:
+  /// Create a default set of options.
+  AsyncFlightDataStreamOptions();
+
+  /// \brief The thread pool producing the payloads, by default the CPU
+  /// thread pool.
+  ::arrow::internal::ThreadPool* executor;
+  /// \brief Production pauses once the payloads produced but not yet
+  /// written hold this many bytes.
+  int64_t high_watermark;
+  /// \brief Paused production resumes once the queued payloads hold at most
+  /// this many bytes.
+  int64_t low_watermark;
+};
+
+/// \brief A FlightDataStream producing the payloads of another stream ahead
+/// of the gRPC writer, on a thread pool.
+///
+/// Payloads are queued until the writer takes them. Above the high
+/// watermark, the producer returns its thread to the pool until the writer
+/// has drained the queue to the low watermark, so that neither slow
+/// consumers nor slow producers hold a pool thread while waiting.
+class ARROW_FLIGHT_EXPORT AsyncFlightDataStream : public FlightDataStream {
+ public:
+  /// \param[in] stream the stream producing the payloads. Its Next() is
+  /// only called from the thread pool, one payload at a time
+  /// \param[in] options the thread pool and watermarks to use
+  explicit AsyncFlightDataStream(std::unique_ptr<FlightDataStream> stream,
+                                 const AsyncFlightDataStreamOptions& options = {});
+  /// \brief Stop producing payloads, waiting for a running producer
+  ~AsyncFlightDataStream() override;
+
+  std::shared_ptr<Schema> schema() override;
+  /// \brief Get the schema payload of the wrapped stream and start
+  /// producing the next payloads
+  Status GetSchemaPayload(FlightPayload* payload) override;
+  Status Next(FlightPayload* payload) override;
+
+ private:
+  class AsyncFlightDataStreamImpl;
+  std::shared_ptr<AsyncFlightDataStreamImpl> impl_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
@@ -106,6 +158,10 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   Location location;
   std::unique_ptr<ServerAuthHandler> auth_handler;
   std::vector<CertKeyPair> tls_certificates;
+  /// \brief Whether DoGet may pass message bodies through a shared memory
+  /// segment offered by a client on the same host (see
+  /// FlightClientOptions::shared_memory_capacity).
+  bool allow_shared_memory;
 };
 
 /// \brief Skeleton RPC server implementation which can be used to create
@@ -192,6 +248,21 @@ class ARROW_FLIGHT_EXPORT FlightServerBase {
                        std::unique_ptr<FlightMessageReader> reader,
                        std::unique_ptr<FlightMetadataWriter> writer);
 
+  /// \brief Process a bidirectional stream of IPC payloads, e.g. to run a
+  /// computation on the record batches sent by a client
+  ///
+  /// The reader starts at the schema of the client's stream, so the client
+  /// must write (or close) its stream before expecting any results.  The
+  /// schema of the results is that of the first record batch written.
+  ///
+  /// \param[in] context The call context.
+  /// \param[in] reader a sequence of record batches sent by the client
+  /// \param[in] writer send record batches back to the client
+  /// \return Status
+  virtual Status DoExchange(const ServerCallContext& context,
+                            std::unique_ptr<FlightMessageReader> reader,
+                            std::unique_ptr<FlightStreamWriter> writer);
+
   /// \brief Execute an action, return stream of zero or more results
   /// \param[in] context The call context.
   /// \param[in] action the action to execute, with type and body
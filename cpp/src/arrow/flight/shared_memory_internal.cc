@@ -0,0 +1,312 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shared_memory_internal.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <random>
+#include <sstream>
+
+#include "arrow/buffer.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+const char* kSharedMemorySegmentHeader = "arrow-flight-shm-segment";
+const char* kSharedMemoryAcceptedHeader = "arrow-flight-shm-accepted";
+
+namespace {
+
+constexpr uint64_t kMagic = 0x4d4853544847494cULL;  // "LIGHTSHM"
+
+// The header is followed by the ring, aligned like IPC bodies
+constexpr int64_t kHeaderSize = 64;
+
+// Bodies start on 64-byte boundaries in the ring
+constexpr int64_t kBodyAlignment = 64;
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2,
+              "Shared memory rings need lock-free 64-bit atomics");
+
+}  // namespace
+
+struct SharedMemoryRing::Header {
+  uint64_t magic;
+  int64_t capacity;
+  // End of the bodies released by the reader, only written by the reader;
+  // positions grow monotonically and are taken modulo the capacity
+  std::atomic<int64_t> released;
+};
+
+// A body in the ring, released back to it on destruction
+class SharedMemoryRing::RingBuffer : public Buffer {
+ public:
+  RingBuffer(std::shared_ptr<SharedMemoryRing> ring, const uint8_t* data, int64_t size,
+             int64_t end)
+      : Buffer(data, size), ring_(std::move(ring)), end_(end) {}
+
+  ~RingBuffer() override { ring_->Release(end_); }
+
+ private:
+  std::shared_ptr<SharedMemoryRing> ring_;
+  int64_t end_;
+};
+
+SharedMemoryRing::SharedMemoryRing(std::string name, bool owner, uint8_t* mapping,
+                                   int64_t mapping_size)
+    : name_(std::move(name)),
+      owner_(owner),
+      mapping_(mapping),
+      mapping_size_(mapping_size),
+      header_(reinterpret_cast<Header*>(mapping)),
+      data_(mapping + kHeaderSize),
+      capacity_(mapping_size - kHeaderSize),
+      write_position_(0) {
+  static_assert(sizeof(Header) <= kHeaderSize, "Shared memory ring header too large");
+}
+
+#ifdef _WIN32
+
+SharedMemoryRing::~SharedMemoryRing() {}
+
+Status SharedMemoryRing::Create(int64_t capacity,
+                                std::shared_ptr<SharedMemoryRing>* out) {
+  return Status::NotImplemented("Shared memory transport is not supported on Windows");
+}
+
+Status SharedMemoryRing::Open(const std::string& name,
+                              std::shared_ptr<SharedMemoryRing>* out) {
+  return Status::NotImplemented("Shared memory transport is not supported on Windows");
+}
+
+void SharedMemoryRing::Unlink() {}
+
+#else
+
+SharedMemoryRing::~SharedMemoryRing() {
+  Unlink();
+  if (munmap(mapping_, static_cast<size_t>(mapping_size_)) != 0) {
+    ARROW_LOG(WARNING) << "Failed to unmap shared memory segment " << name_ << ": "
+                       << std::strerror(errno);
+  }
+}
+
+static Status MapSegment(int fd, int64_t size, uint8_t** out) {
+  void* mapping =
+      mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (mapping == MAP_FAILED) {
+    return Status::IOError("Failed to map shared memory segment: ", std::strerror(errno));
+  }
+  *out = reinterpret_cast<uint8_t*>(mapping);
+  return Status::OK();
+}
+
+Status SharedMemoryRing::Create(int64_t capacity,
+                                std::shared_ptr<SharedMemoryRing>* out) {
+  if (capacity <= 0) {
+    return Status::Invalid("Shared memory capacity must be positive");
+  }
+  capacity = BitUtil::RoundUpToMultipleOf64(capacity);
+  const int64_t mapping_size = kHeaderSize + capacity;
+
+  // Names are kept short for platforms limiting them to 31 characters
+  std::random_device random_device;
+  std::string name;
+  int fd = -1;
+  for (int attempt = 0; fd < 0 && attempt < 16; ++attempt) {
+    std::stringstream ss;
+    ss << "/arrow-flight-" << getpid() << "-" << std::hex << random_device();
+    name = ss.str();
+    fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0 && errno != EEXIST) {
+      break;
+    }
+  }
+  if (fd < 0) {
+    return Status::IOError("Failed to create shared memory segment: ",
+                           std::strerror(errno));
+  }
+
+  uint8_t* mapping = nullptr;
+  Status st;
+  if (ftruncate(fd, static_cast<off_t>(mapping_size)) != 0) {
+    st = Status::IOError("Failed to size shared memory segment: ", std::strerror(errno));
+  } else {
+    st = MapSegment(fd, mapping_size, &mapping);
+  }
+  close(fd);
+  if (!st.ok()) {
+    shm_unlink(name.c_str());
+    return st;
+  }
+
+  auto header = reinterpret_cast<Header*>(mapping);
+  header->magic = kMagic;
+  header->capacity = capacity;
+  new (&header->released) std::atomic<int64_t>(0);
+  out->reset(new SharedMemoryRing(name, true, mapping, mapping_size));
+  return Status::OK();
+}
+
+Status SharedMemoryRing::Open(const std::string& name,
+                              std::shared_ptr<SharedMemoryRing>* out) {
+  int fd = shm_open(name.c_str(), O_RDWR, 0600);
+  if (fd < 0) {
+    return Status::IOError("Failed to open shared memory segment ", name, ": ",
+                           std::strerror(errno));
+  }
+  struct stat file_stat;
+  uint8_t* mapping = nullptr;
+  Status st;
+  if (fstat(fd, &file_stat) != 0) {
+    st = Status::IOError("Failed to stat shared memory segment: ", std::strerror(errno));
+  } else if (file_stat.st_size <= kHeaderSize) {
+    st = Status::Invalid("Shared memory segment ", name, " is too small");
+  } else {
+    st = MapSegment(fd, file_stat.st_size, &mapping);
+  }
+  close(fd);
+  RETURN_NOT_OK(st);
+
+  const int64_t mapping_size = file_stat.st_size;
+  auto header = reinterpret_cast<Header*>(mapping);
+  if (header->magic != kMagic || header->capacity != mapping_size - kHeaderSize) {
+    munmap(mapping, static_cast<size_t>(mapping_size));
+    return Status::Invalid("Invalid shared memory segment ", name);
+  }
+  out->reset(new SharedMemoryRing(name, false, mapping, mapping_size));
+  return Status::OK();
+}
+
+void SharedMemoryRing::Unlink() {
+  if (owner_) {
+    owner_ = false;
+    if (shm_unlink(name_.c_str()) != 0) {
+      ARROW_LOG(WARNING) << "Failed to unlink shared memory segment " << name_ << ": "
+                         << std::strerror(errno);
+    }
+  }
+}
+
+#endif  // _WIN32
+
+bool SharedMemoryRing::CanWrite(const ipc::internal::IpcPayload& payload) const {
+  return payload.body_length > kSharedMemoryDescriptorSize &&
+         BitUtil::RoundUpToPowerOf2(payload.body_length, kBodyAlignment) <= capacity_;
+}
+
+Status SharedMemoryRing::Write(const ipc::internal::IpcPayload& payload,
+                               std::shared_ptr<Buffer>* descriptor) {
+  static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  DCHECK(CanWrite(payload));
+
+  const int64_t length = payload.body_length;
+  const int64_t padded_length = BitUtil::RoundUpToPowerOf2(length, kBodyAlignment);
+  // Bodies are contiguous in the ring, so skip its tail if too short
+  int64_t position = write_position_;
+  const int64_t offset = position % capacity_;
+  if (offset + padded_length > capacity_) {
+    position += capacity_ - offset;
+  }
+  const int64_t end = position + padded_length;
+
+  if (end - header_->released.load(std::memory_order_acquire) > capacity_) {
+    descriptor->reset();
+    return Status::OK();
+  }
+
+  // Lay out the body buffers as gRPC would, padded to 8 bytes
+  uint8_t* out = data_ + (position % capacity_);
+  int64_t written = 0;
+  for (const auto& buffer : payload.body_buffers) {
+    if (!buffer) continue;
+    const int64_t size = buffer->size();
+    const int64_t padding = BitUtil::RoundUpToMultipleOf8(size) - size;
+    if (written + size + padding > length) {
+      return Status::Invalid("IPC payload body exceeds its length");
+    }
+    std::memcpy(out + written, buffer->data(), static_cast<size_t>(size));
+    std::memcpy(out + written + size, kPaddingBytes, static_cast<size_t>(padding));
+    written += size + padding;
+  }
+  std::memset(out + written, 0, static_cast<size_t>(length - written));
+  write_position_ = end;
+
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(kSharedMemoryDescriptorSize, &result));
+  std::memcpy(result->mutable_data(), &position, sizeof(int64_t));
+  std::memcpy(result->mutable_data() + sizeof(int64_t), &length, sizeof(int64_t));
+  *descriptor = std::move(result);
+  return Status::OK();
+}
+
+Status SharedMemoryRing::Read(const Buffer& descriptor, std::shared_ptr<Buffer>* out) {
+  if (descriptor.size() != kSharedMemoryDescriptorSize) {
+    return Status::Invalid("Invalid shared memory body descriptor");
+  }
+  int64_t position, length;
+  std::memcpy(&position, descriptor.data(), sizeof(int64_t));
+  std::memcpy(&length, descriptor.data() + sizeof(int64_t), sizeof(int64_t));
+  if (position < 0 || length < 0 || position % capacity_ + length > capacity_) {
+    return Status::Invalid("Shared memory body descriptor out of bounds");
+  }
+
+  const int64_t end = position + BitUtil::RoundUpToPowerOf2(length, kBodyAlignment);
+  {
+    std::lock_guard<std::mutex> lock(release_mutex_);
+    read_bodies_.emplace_back(end, false);
+  }
+  *out = std::make_shared<RingBuffer>(shared_from_this(), data_ + position % capacity_,
+                                      length, end);
+  return Status::OK();
+}
+
+void SharedMemoryRing::Release(int64_t end) {
+  std::lock_guard<std::mutex> lock(release_mutex_);
+  for (auto& body : read_bodies_) {
+    if (body.first == end) {
+      body.second = true;
+      break;
+    }
+  }
+  // The writer may only reuse space once every earlier body is released
+  int64_t released = -1;
+  while (!read_bodies_.empty() && read_bodies_.front().second) {
+    released = read_bodies_.front().first;
+    read_bodies_.pop_front();
+  }
+  if (released >= 0) {
+    header_->released.store(released, std::memory_order_release);
+  }
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Shared memory transport of DoGet message bodies between a client and a
+// server on the same host.
+//
+// The client creates a named shared memory segment and passes its name in
+// the kSharedMemorySegmentHeader metadata of the call. A server allowing
+// shared memory maps the segment and acknowledges it with the
+// kSharedMemoryAcceptedHeader initial metadata. It then copies the bodies
+// of the following messages into a ring in the segment and sends a
+// kSharedMemoryDescriptorSize-byte descriptor in place of each of them.
+// Bodies of at most that size, or too large for the ring, are still sent
+// inline; a client tells them apart as a descriptor is shorter than the
+// body length announced in the IPC metadata.
+//
+// The client releases ring space in order as the buffers referencing it are
+// destroyed. Bodies not fitting in the free space are sent inline too, so
+// that a client holding on to its batches never stalls the stream.
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "arrow/flight/visibility.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace flight {
+namespace internal {
+
+/// Client metadata naming the segment offered by the client
+ARROW_FLIGHT_EXPORT
+extern const char* kSharedMemorySegmentHeader;
+
+/// Server initial metadata accepting the offered segment
+ARROW_FLIGHT_EXPORT
+extern const char* kSharedMemoryAcceptedHeader;
+
+/// Size of the descriptor (position and length) sent in place of a body
+constexpr int64_t kSharedMemoryDescriptorSize = 16;
+
+/// A ring of message bodies in a shared memory segment
+class ARROW_FLIGHT_EXPORT SharedMemoryRing
+    : public std::enable_shared_from_this<SharedMemoryRing> {
+ public:
+  ~SharedMemoryRing();
+
+  /// \brief Create a new segment with room for capacity bytes of bodies
+  static Status Create(int64_t capacity, std::shared_ptr<SharedMemoryRing>* out);
+
+  /// \brief Map the segment created by a client
+  static Status Open(const std::string& name, std::shared_ptr<SharedMemoryRing>* out);
+
+  const std::string& name() const { return name_; }
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief Remove the name of a segment created by this process. Mappings
+  /// stay valid
+  void Unlink();
+
+  /// \brief Whether the body of the payload should be sent through the ring
+  bool CanWrite(const ipc::internal::IpcPayload& payload) const;
+
+  /// \brief Copy the body of a payload into the ring and return the
+  /// descriptor to send in its place
+  ///
+  /// \param[in] payload the payload, for which CanWrite() must be true
+  /// \param[out] descriptor the descriptor of the body in the ring, or null
+  /// if the ring has no room for it at the moment
+  Status Write(const ipc::internal::IpcPayload& payload,
+               std::shared_ptr<Buffer>* descriptor);
+
+  /// \brief Reference the body described by a descriptor. Its ring space is
+  /// released when the returned buffer and all its slices are destroyed
+  Status Read(const Buffer& descriptor, std::shared_ptr<Buffer>* out);
+
+ private:
+  class RingBuffer;
+  struct Header;
+
+  SharedMemoryRing(std::string name, bool owner, uint8_t* mapping, int64_t mapping_size);
+
+  // Release the ring space of a body read by Read()
+  void Release(int64_t end);
+
+  std::string name_;
+  bool owner_;
+  uint8_t* mapping_;
+  int64_t mapping_size_;
+  Header* header_;
+  uint8_t* data_;
+  int64_t capacity_;
+
+  // Writer side: the end of the last body written
+  int64_t write_position_;
+
+  // Reader side: ends of the bodies read, in order, and whether they have
+  // been released
+  std::mutex release_mutex_;
+  std::deque<std::pair<int64_t, bool>> read_bodies_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SharedMemoryRing);
+};
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
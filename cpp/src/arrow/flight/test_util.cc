@@ -23,6 +23,7 @@
 #endif
 
 #include <cstdlib>
+#include <limits>
 #include <sstream>
 
 #include <boost/filesystem.hpp>
@@ -32,6 +33,7 @@
 
 #include "arrow/ipc/test_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/flight/api.h"
@@ -358,6 +360,30 @@ Status ExampleDictBatches(BatchVector* out) {
   return Status::OK();
 }
 
+Status MakePerfBatch(const std::string& column_type, int64_t num_rows,
+                     std::shared_ptr<RecordBatch>* out) {
+  random::RandomArrayGenerator rng(0);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (const char* name : {"a", "b", "c", "d"}) {
+    std::shared_ptr<Array> array;
+    if (column_type == "int64") {
+      array = rng.Int64(num_rows, 0, std::numeric_limits<int64_t>::max());
+    } else if (column_type == "float64") {
+      array = rng.Float64(num_rows, 0, 1);
+    } else if (column_type == "string") {
+      array = rng.String(num_rows, 0, 32);
+    } else {
+      return Status::Invalid("Unknown column type for performance batches: ",
+                             column_type);
+    }
+    fields.push_back(field(name, array->type()));
+    arrays.push_back(array);
+  }
+  *out = RecordBatch::Make(::arrow::schema(fields), num_rows, arrays);
+  return Status::OK();
+}
+
 std::vector<ActionType> ExampleActionTypes() {
   return {{"drop", "drop a dataset"}, {"cache", "cache a dataset"}};
 }
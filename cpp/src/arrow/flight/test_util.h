@@ -160,6 +160,12 @@ Status ExampleIntBatches(BatchVector* out);
 ARROW_FLIGHT_EXPORT
 Status ExampleDictBatches(BatchVector* out);
 
+/// \brief Generate a batch of four random columns "a" to "d" of the given
+/// type ("int64", "float64" or "string"), for the performance benchmarks
+ARROW_FLIGHT_EXPORT
+Status MakePerfBatch(const std::string& column_type, int64_t num_rows,
+                     std::shared_ptr<RecordBatch>* out);
+
 ARROW_FLIGHT_EXPORT
 std::vector<FlightInfo> ExampleFlightInfo();
 
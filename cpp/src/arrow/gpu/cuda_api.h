@@ -19,6 +19,7 @@
 #define ARROW_GPU_CUDA_API_H
 
 #include "arrow/gpu/cuda_arrow_ipc.h"
+#include "arrow/gpu/cuda_compute.h"
 #include "arrow/gpu/cuda_context.h"
 #include "arrow/gpu/cuda_memory.h"
 #include "arrow/gpu/cuda_version.h"
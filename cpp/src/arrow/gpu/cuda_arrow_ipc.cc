@@ -17,11 +17,14 @@
 
 #include "arrow/gpu/cuda_arrow_ipc.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/dictionary.h"
@@ -47,7 +50,7 @@ Status SerializeRecordBatch(const RecordBatch& batch, CudaContext* ctx,
   RETURN_NOT_OK(ipc::GetRecordBatchSize(batch, &size));
 
   std::shared_ptr<CudaBuffer> buffer;
-  RETURN_NOT_OK(ctx->Allocate(size, &buffer));
+  RETURN_NOT_OK(ctx->memory_pool()->Allocate(size, &buffer));
 
   CudaBufferWriter stream(buffer);
 
@@ -107,5 +110,204 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   return ipc::ReadRecordBatch(*message, schema, &unused_memo, out);
 }
 
+// ----------------------------------------------------------------------
+// Record batch copies
+
+namespace {
+
+// The copies of a batch are spread over this many streams
+constexpr int kNumCopyStreams = 2;
+
+// The size of each pinned staging buffer
+constexpr int64_t kStagingBufferSize = 1 << 23;
+
+bool IsPinnedHostBuffer(std::shared_ptr<Buffer> buffer) {
+  // The CudaHostBuffer may have been wrapped in another Buffer
+  while (buffer) {
+    if (std::dynamic_pointer_cast<CudaHostBuffer>(buffer)) {
+      return true;
+    }
+    buffer = buffer->parent();
+  }
+  return false;
+}
+
+// Rebuilds a record batch with each of its buffers copied by CopyBuffer
+class RecordBatchCopier {
+ public:
+  explicit RecordBatchCopier(CudaContext* ctx) : ctx_(ctx) {}
+
+  virtual ~RecordBatchCopier() = default;
+
+  virtual Status Init() {
+    streams_.resize(kNumCopyStreams);
+    for (auto& stream : streams_) {
+      RETURN_NOT_OK(ctx_->CreateStream(&stream));
+    }
+    return Status::OK();
+  }
+
+  Status Copy(const RecordBatch& batch, std::shared_ptr<RecordBatch>* out) {
+    std::vector<std::shared_ptr<ArrayData>> columns(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      RETURN_NOT_OK(CopyArrayData(*batch.column_data(i), &columns[i]));
+    }
+    for (const auto& stream : streams_) {
+      RETURN_NOT_OK(stream->Synchronize());
+    }
+    *out = RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+    return Status::OK();
+  }
+
+ protected:
+  virtual Status CopyBuffer(const std::shared_ptr<Buffer>& buffer,
+                            std::shared_ptr<Buffer>* out) = 0;
+
+  CudaStream* NextStream() {
+    next_stream_ = (next_stream_ + 1) % kNumCopyStreams;
+    return streams_[next_stream_].get();
+  }
+
+  CudaContext* ctx_;
+  std::vector<std::shared_ptr<CudaStream>> streams_;
+  int next_stream_ = 0;
+
+ private:
+  Status CopyArrayData(const ArrayData& data, std::shared_ptr<ArrayData>* out) {
+    auto result = std::make_shared<ArrayData>(data);
+    for (auto& buffer : result->buffers) {
+      if (buffer) {
+        std::shared_ptr<Buffer> source = buffer;
+        RETURN_NOT_OK(CopyBuffer(source, &buffer));
+      }
+    }
+    for (auto& child : result->child_data) {
+      std::shared_ptr<ArrayData> source = child;
+      RETURN_NOT_OK(CopyArrayData(*source, &child));
+    }
+    if (result->dictionary) {
+      std::shared_ptr<ArrayData> dictionary;
+      RETURN_NOT_OK(CopyArrayData(*result->dictionary->data(), &dictionary));
+      result->dictionary = MakeArray(dictionary);
+    }
+    *out = std::move(result);
+    return Status::OK();
+  }
+};
+
+class DeviceCopier : public RecordBatchCopier {
+ public:
+  DeviceCopier(CudaContext* ctx, CudaHostMemoryPool* staging_pool)
+      : RecordBatchCopier(ctx), staging_pool_(staging_pool) {}
+
+  Status Init() override {
+    RETURN_NOT_OK(RecordBatchCopier::Init());
+    staging_.resize(kNumCopyStreams);
+    for (auto& staging : staging_) {
+      RETURN_NOT_OK(AllocateBuffer(staging_pool_, kStagingBufferSize, &staging.buffer));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status CopyBuffer(const std::shared_ptr<Buffer>& buffer,
+                    std::shared_ptr<Buffer>* out) override {
+    // The buffers of a batch are many and often small, so are best pooled.
+    // All the transfers are completed by the time the batch is returned, so
+    // the memory is not tied to a stream.
+    std::shared_ptr<CudaBuffer> device_buffer;
+    RETURN_NOT_OK(ctx_->memory_pool()->Allocate(buffer->size(), &device_buffer));
+    if (IsPinnedHostBuffer(buffer)) {
+      std::shared_ptr<CudaEvent> unused_event;
+      RETURN_NOT_OK(device_buffer->CopyFromHostAsync(0, buffer->data(), buffer->size(),
+                                                     streams_[next_stream_].get(),
+                                                     &unused_event));
+      *out = device_buffer;
+      return Status::OK();
+    }
+    // Small buffers share a staging buffer, large ones span several
+    int64_t position = 0;
+    while (position < buffer->size()) {
+      if (staging_[next_stream_].used == kStagingBufferSize) {
+        RETURN_NOT_OK(NextStagingBuffer());
+      }
+      Staging& staging = staging_[next_stream_];
+      const int64_t nbytes =
+          std::min(buffer->size() - position, kStagingBufferSize - staging.used);
+      uint8_t* staged = staging.buffer->mutable_data() + staging.used;
+      std::memcpy(staged, buffer->data() + position, static_cast<size_t>(nbytes));
+      RETURN_NOT_OK(device_buffer->CopyFromHostAsync(
+          position, staged, nbytes, streams_[next_stream_].get(), &staging.event));
+      staging.used += nbytes;
+      position += nbytes;
+    }
+    *out = device_buffer;
+    return Status::OK();
+  }
+
+ private:
+  // A staging buffer, transferred on the stream of the same index
+  struct Staging {
+    std::shared_ptr<Buffer> buffer;
+    int64_t used = 0;
+    // Completed once the transfers out of the buffer are
+    std::shared_ptr<CudaEvent> event;
+  };
+
+  Status NextStagingBuffer() {
+    NextStream();
+    Staging& staging = staging_[next_stream_];
+    if (staging.event) {
+      RETURN_NOT_OK(staging.event->Wait());
+      staging.event.reset();
+    }
+    staging.used = 0;
+    return Status::OK();
+  }
+
+  CudaHostMemoryPool* staging_pool_;
+  std::vector<Staging> staging_;
+};
+
+class HostCopier : public RecordBatchCopier {
+ public:
+  HostCopier(CudaContext* ctx, MemoryPool* pool) : RecordBatchCopier(ctx), pool_(pool) {}
+
+ protected:
+  Status CopyBuffer(const std::shared_ptr<Buffer>& buffer,
+                    std::shared_ptr<Buffer>* out) override {
+    std::shared_ptr<CudaBuffer> device_buffer;
+    RETURN_NOT_OK(CudaBuffer::FromBuffer(buffer, &device_buffer));
+    std::shared_ptr<Buffer> host_buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, buffer->size(), &host_buffer));
+    std::shared_ptr<CudaEvent> unused_event;
+    RETURN_NOT_OK(device_buffer->CopyToHostAsync(0, buffer->size(),
+                                                 host_buffer->mutable_data(),
+                                                 NextStream(), &unused_event));
+    *out = host_buffer;
+    return Status::OK();
+  }
+
+ private:
+  MemoryPool* pool_;
+};
+
+}  // namespace
+
+Status CopyRecordBatchToDevice(const RecordBatch& batch, CudaContext* ctx,
+                               CudaHostMemoryPool* staging_pool,
+                               std::shared_ptr<RecordBatch>* out) {
+  DeviceCopier copier(ctx, staging_pool);
+  RETURN_NOT_OK(copier.Init());
+  return copier.Copy(batch, out);
+}
+
+Status CopyRecordBatchToHost(const RecordBatch& batch, CudaContext* ctx,
+                             MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
+  HostCopier copier(ctx, pool);
+  RETURN_NOT_OK(copier.Init());
+  return copier.Copy(batch, out);
+}
+
 }  // namespace cuda
 }  // namespace arrow
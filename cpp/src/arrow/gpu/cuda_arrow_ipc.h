@@ -43,7 +43,8 @@ namespace cuda {
 
 /// \brief Write record batch message to GPU device memory
 /// \param[in] batch record batch to write
-/// \param[in] ctx CudaContext to allocate device memory from
+/// \param[in] ctx CudaContext to allocate device memory from, through its
+/// memory pool
 /// \param[out] out the returned device buffer which contains the record batch message
 /// \return Status
 ARROW_EXPORT
@@ -71,6 +72,37 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
                        const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool,
                        std::shared_ptr<RecordBatch>* out);
 
+/// \brief Copy the buffers of a record batch to GPU device memory
+/// \param[in] batch record batch in CPU memory
+/// \param[in] ctx CudaContext to allocate device memory from, through its
+/// memory pool
+/// \param[in] staging_pool pinned memory to stage the copies through
+/// \param[out] out the record batch with the same layout, with device pointers
+/// \return Status
+///
+/// The buffers are copied into pinned staging buffers used in turn, each on
+/// its own stream, so that copying into one overlaps with the transfers out
+/// of the others.  Buffers already pinned (CudaHostBuffer) are transferred
+/// directly.  Returns once all the transfers are completed.
+ARROW_EXPORT
+Status CopyRecordBatchToDevice(const RecordBatch& batch, CudaContext* ctx,
+                               CudaHostMemoryPool* staging_pool,
+                               std::shared_ptr<RecordBatch>* out);
+
+/// \brief Copy the buffers of a record batch on GPU device to CPU memory
+/// \param[in] batch record batch with device pointers in the context
+/// \param[in] ctx the CudaContext of the device memory
+/// \param[in] pool a MemoryPool to allocate CPU memory from
+/// \param[out] out the record batch in CPU memory
+/// \return Status
+///
+/// The transfers are queued on several streams at once, and only overlap if
+/// the pool allocates pinned memory, such as a CudaHostMemoryPool.  Returns
+/// once all the transfers are completed.
+ARROW_EXPORT
+Status CopyRecordBatchToHost(const RecordBatch& batch, CudaContext* ctx,
+                             MemoryPool* pool, std::shared_ptr<RecordBatch>* out);
+
 }  // namespace cuda
 }  // namespace arrow
 
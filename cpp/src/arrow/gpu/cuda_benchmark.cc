@@ -19,10 +19,17 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/filter.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 
@@ -90,5 +97,148 @@ BENCHMARK(Writer_Unbuffered)
     ->Range(1 << 8, 1 << 16)
     ->UseRealTime();
 
+// A batch of 16 int64 columns of 1M values, 128MB in total
+static std::shared_ptr<RecordBatch> MakeUploadBatch() {
+  const int64_t kLength = 1 << 20;
+  const int kNumColumns = 16;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < kNumColumns; ++i) {
+    std::shared_ptr<ResizableBuffer> values;
+    ABORT_NOT_OK(MakeRandomByteBuffer(kLength * sizeof(int64_t), default_memory_pool(),
+                                      &values, i));
+    fields.push_back(field("f" + std::to_string(i), int64()));
+    columns.push_back(std::make_shared<Int64Array>(kLength, values));
+  }
+  return RecordBatch::Make(schema(fields), kLength, columns);
+}
+
+// Each buffer copied synchronously from pageable memory
+static void UploadBatch_Synchronous(benchmark::State& state) {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber, &context));
+  auto batch = MakeUploadBatch();
+
+  int64_t total_bytes = 0;
+  while (state.KeepRunning()) {
+    total_bytes = 0;
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      const auto& values = batch->column_data(i)->buffers[1];
+      std::shared_ptr<CudaBuffer> device_buffer;
+      ABORT_NOT_OK(context->Allocate(values->size(), &device_buffer));
+      ABORT_NOT_OK(device_buffer->CopyFromHost(0, values->data(), values->size()));
+      total_bytes += values->size();
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * total_bytes);
+}
+
+// Buffers staged through pinned memory, overlapping the copies
+static void UploadBatch_Staged(benchmark::State& state) {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber, &context));
+  std::shared_ptr<CudaHostMemoryPool> staging_pool;
+  ABORT_NOT_OK(CudaHostMemoryPool::Make(kGpuNumber, &staging_pool));
+  auto batch = MakeUploadBatch();
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> device_batch;
+    ABORT_NOT_OK(CopyRecordBatchToDevice(*batch, context.get(), staging_pool.get(),
+                                         &device_batch));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * batch->num_columns() *
+                          batch->num_rows() * sizeof(int64_t));
+}
+
+// Allocating and freeing many small buffers, as for the buffers of a batch
+static void AllocateSmallBuffers(benchmark::State& state, bool use_pool) {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber, &context));
+
+  const int kNumBuffers = 1000;
+  std::vector<std::shared_ptr<CudaBuffer>> buffers(kNumBuffers);
+  while (state.KeepRunning()) {
+    for (int i = 0; i < kNumBuffers; ++i) {
+      const int64_t size = 64 * (i % 64 + 1);
+      if (use_pool) {
+        ABORT_NOT_OK(context->memory_pool()->Allocate(size, &buffers[i]));
+      } else {
+        ABORT_NOT_OK(context->Allocate(size, &buffers[i]));
+      }
+    }
+    for (auto& buffer : buffers) {
+      buffer.reset();
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kNumBuffers);
+}
+
+// Filtering a column by a predicate on another, on the device or after
+// copying both columns back to the host
+static void FilterColumn(benchmark::State& state, bool on_device) {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber, &context));
+  std::shared_ptr<CudaHostMemoryPool> staging_pool;
+  ABORT_NOT_OK(CudaHostMemoryPool::Make(kGpuNumber, &staging_pool));
+  auto upload_batch = MakeUploadBatch();
+  auto batch = RecordBatch::Make(
+      schema({upload_batch->schema()->field(0), upload_batch->schema()->field(1)}),
+      upload_batch->num_rows(), {upload_batch->column(0), upload_batch->column(1)});
+  std::shared_ptr<RecordBatch> device_batch;
+  ABORT_NOT_OK(CopyRecordBatchToDevice(*batch, context.get(), staging_pool.get(),
+                                       &device_batch));
+
+  std::shared_ptr<Scalar> zero = std::make_shared<Int64Scalar>(0);
+  compute::CompareOptions options(compute::CompareOperator::GREATER);
+  compute::FunctionContext ctx;
+  while (state.KeepRunning()) {
+    std::shared_ptr<Array> filtered;
+    if (on_device) {
+      std::shared_ptr<Array> filter;
+      ABORT_NOT_OK(Compare(*device_batch->column(0), *zero, options, &filter));
+      ABORT_NOT_OK(Filter(*device_batch->column(1), *filter, &filtered));
+    } else {
+      std::shared_ptr<RecordBatch> cpu_batch;
+      ABORT_NOT_OK(CopyRecordBatchToHost(*device_batch, context.get(), staging_pool.get(),
+                                         &cpu_batch));
+      compute::Datum filter;
+      ABORT_NOT_OK(compute::Compare(&ctx, cpu_batch->column(0), zero, options, &filter));
+      ABORT_NOT_OK(
+          compute::Filter(&ctx, *cpu_batch->column(1), *filter.make_array(), &filtered));
+    }
+    benchmark::DoNotOptimize(filtered);
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * batch->num_rows());
+}
+
+static void FilterColumn_Device(benchmark::State& state) { FilterColumn(state, true); }
+
+static void FilterColumn_Download(benchmark::State& state) {
+  FilterColumn(state, false);
+}
+
+static void AllocateSmallBuffers_Driver(benchmark::State& state) {
+  AllocateSmallBuffers(state, false);
+}
+
+static void AllocateSmallBuffers_Pool(benchmark::State& state) {
+  AllocateSmallBuffers(state, true);
+}
+
+BENCHMARK(AllocateSmallBuffers_Driver)->UseRealTime();
+BENCHMARK(AllocateSmallBuffers_Pool)->UseRealTime();
+BENCHMARK(UploadBatch_Synchronous)->UseRealTime();
+BENCHMARK(UploadBatch_Staged)->UseRealTime();
+BENCHMARK(FilterColumn_Device)->UseRealTime();
+BENCHMARK(FilterColumn_Download)->UseRealTime();
+
 }  // namespace cuda
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #define ARROW_GPU_CUDA_COMMON_H
 
 #include <cuda.h>
+#include <cuda_runtime.h>
 
 namespace arrow {
 namespace cuda {
@@ -34,6 +35,26 @@ namespace cuda {
     }                                                                           \
   } while (0)
 
+#define CUDA_RT_RETURN_NOT_OK(STMT)                                               \
+  do {                                                                           \
+    cudaError_t ret = (STMT);                                                    \
+    if (ret != cudaSuccess) {                                                    \
+      return Status::IOError("Cuda Runtime API call in ", __FILE__, " at line ", \
+                             __LINE__, " failed with code ", ret, ": ",          \
+                             cudaGetErrorString(ret));                           \
+    }                                                                            \
+  } while (0)
+
+/// \brief Make a CUDA context current for the lifetime of the saver
+class ContextSaver {
+ public:
+  explicit ContextSaver(CUcontext new_context) { cuCtxPushCurrent(new_context); }
+  ~ContextSaver() {
+    CUcontext unused;
+    cuCtxPopCurrent(&unused);
+  }
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
@@ -0,0 +1,506 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <cuda.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/gpu/cuda_common.h"
+#include "arrow/gpu/cuda_compute_internal.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_memory.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace cuda {
+
+namespace {
+
+using internal::BitmapOp;
+using internal::CompareOp;
+
+// The kernels write bitmaps as 32-bit words
+int64_t DeviceBitmapSize(int64_t length) {
+  return BitUtil::CeilDiv(length, 32) * static_cast<int64_t>(sizeof(uint32_t));
+}
+
+template <typename T>
+T* DeviceData(const std::shared_ptr<CudaBuffer>& buffer) {
+  return reinterpret_cast<T*>(buffer->mutable_data());
+}
+
+// The validity bitmap of an array, or null if it has no nulls
+const uint8_t* ValidityBitmap(const ArrayData& data) {
+  if (data.buffers[0] == nullptr || data.null_count == 0) {
+    return nullptr;
+  }
+  return data.buffers[0]->data();
+}
+
+// The context, stream and scratch memory of a kernel call
+class DeviceCall {
+ public:
+  // Find the context of the inputs and make it current
+  Status Init(const std::vector<const ArrayData*>& inputs) {
+    for (const ArrayData* data : inputs) {
+      for (const auto& buffer : data->buffers) {
+        if (buffer == nullptr) {
+          continue;
+        }
+        std::shared_ptr<CudaBuffer> cuda_buffer;
+        RETURN_NOT_OK(CudaBuffer::FromBuffer(buffer, &cuda_buffer));
+        if (context_ == nullptr) {
+          context_ = cuda_buffer->context();
+        } else if (cuda_buffer->context()->handle() != context_->handle()) {
+          return Status::Invalid("Buffers are not on the same CUDA context");
+        }
+      }
+    }
+    if (context_ == nullptr) {
+      return Status::Invalid("Array has no CUDA buffer");
+    }
+    RETURN_NOT_OK(context_->CreateStream(&stream_));
+    saver_.reset(new ContextSaver(reinterpret_cast<CUcontext>(context_->handle())));
+    return Status::OK();
+  }
+
+  Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+    return context_->memory_pool()->Allocate(nbytes, out);
+  }
+
+  // Allocate scratch memory, only used by this call's stream
+  Status AllocateScratch(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+    return context_->memory_pool()->Allocate(nbytes, stream_, out);
+  }
+
+  Status AllocateZeroed(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+    RETURN_NOT_OK(Allocate(nbytes, out));
+    CUDA_RT_RETURN_NOT_OK(cudaMemsetAsync((*out)->mutable_data(), 0, nbytes, stream()));
+    return Status::OK();
+  }
+
+  // Allocate a zeroed device counter
+  Status AllocateCounter(std::shared_ptr<CudaBuffer>* out) {
+    RETURN_NOT_OK(AllocateScratch(sizeof(unsigned long long), out));
+    CUDA_RT_RETURN_NOT_OK(
+        cudaMemsetAsync((*out)->mutable_data(), 0, sizeof(unsigned long long), stream()));
+    return Status::OK();
+  }
+
+  // Wait for the kernels of the call to complete
+  Status Synchronize() { return stream_->Synchronize(); }
+
+  cudaStream_t stream() const {
+    return reinterpret_cast<cudaStream_t>(stream_->handle());
+  }
+
+ private:
+  std::shared_ptr<CudaContext> context_;
+  std::shared_ptr<CudaStream> stream_;
+  std::unique_ptr<ContextSaver> saver_;
+};
+
+// Read a device value back, once the kernels writing it have completed
+template <typename T>
+Status ReadValue(const std::shared_ptr<CudaBuffer>& buffer, int64_t index, T* out) {
+  return buffer->CopyToHost(index * static_cast<int64_t>(sizeof(T)), sizeof(T), out);
+}
+
+// Compute the validity of the result of an element-wise kernel, null where
+// any input is null.  The number of non-null values is added to the counter.
+Status PropagateNulls(DeviceCall* call, const ArrayData& left, const ArrayData* right,
+                      const std::shared_ptr<CudaBuffer>& counter,
+                      std::shared_ptr<Buffer>* out) {
+  const uint8_t* left_validity = ValidityBitmap(left);
+  const uint8_t* right_validity = right ? ValidityBitmap(*right) : nullptr;
+  if (left_validity == nullptr && right_validity == nullptr) {
+    *out = nullptr;
+    return Status::OK();
+  }
+  std::shared_ptr<CudaBuffer> validity;
+  RETURN_NOT_OK(call->Allocate(DeviceBitmapSize(left.length), &validity));
+  auto set_count = DeviceData<unsigned long long>(counter);
+  if (left_validity != nullptr && right_validity != nullptr) {
+    CUDA_RT_RETURN_NOT_OK(internal::LaunchBitmapOp(
+        BitmapOp::AND, left_validity, left.offset, right_validity, right->offset,
+        left.length, DeviceData<uint32_t>(validity), set_count, call->stream()));
+  } else if (left_validity != nullptr) {
+    CUDA_RT_RETURN_NOT_OK(internal::LaunchBitmapOp(
+        BitmapOp::COPY, left_validity, left.offset, nullptr, 0, left.length,
+        DeviceData<uint32_t>(validity), set_count, call->stream()));
+  } else {
+    CUDA_RT_RETURN_NOT_OK(internal::LaunchBitmapOp(
+        BitmapOp::COPY, right_validity, right->offset, nullptr, 0, left.length,
+        DeviceData<uint32_t>(validity), set_count, call->stream()));
+  }
+  *out = validity;
+  return Status::OK();
+}
+
+// Wait for the call and compute the null count from the counter of
+// PropagateNulls
+Status FinishNulls(DeviceCall* call, int64_t length,
+                   const std::shared_ptr<Buffer>& validity, const std::shared_ptr<CudaBuffer>& counter, int64_t* null_count) {
+  RETURN_NOT_OK(call->Synchronize());
+  if (validity == nullptr) {
+    *null_count = 0;
+    return Status::OK();
+  }
+  unsigned long long valid_count = 0;
+  RETURN_NOT_OK(ReadValue(counter, 0, &valid_count));
+  *null_count = length - static_cast<int64_t>(valid_count);
+  return Status::OK();
+}
+
+CompareOp GetCompareOp(compute::CompareOperator op) {
+  switch (op) {
+    case compute::CompareOperator::EQUAL:
+      return CompareOp::EQUAL;
+    case compute::CompareOperator::NOT_EQUAL:
+      return CompareOp::NOT_EQUAL;
+    case compute::CompareOperator::GREATER:
+      return CompareOp::GREATER;
+    case compute::CompareOperator::GREATER_EQUAL:
+      return CompareOp::GREATER_EQUAL;
+    case compute::CompareOperator::LESS:
+      return CompareOp::LESS;
+    case compute::CompareOperator::LESS_EQUAL:
+      return CompareOp::LESS_EQUAL;
+  }
+  return CompareOp::EQUAL;
+}
+
+#define CUDA_NUMERIC_TYPE_CASES(FUNCTOR, ...)      \
+  case Type::INT8:                                 \
+    return FUNCTOR<Int8Type>::Exec(__VA_ARGS__);   \
+  case Type::INT16:                                \
+    return FUNCTOR<Int16Type>::Exec(__VA_ARGS__);  \
+  case Type::INT32:                                \
+    return FUNCTOR<Int32Type>::Exec(__VA_ARGS__);  \
+  case Type::INT64:                                \
+    return FUNCTOR<Int64Type>::Exec(__VA_ARGS__);  \
+  case Type::UINT8:                                \
+    return FUNCTOR<UInt8Type>::Exec(__VA_ARGS__);  \
+  case Type::UINT16:                               \
+    return FUNCTOR<UInt16Type>::Exec(__VA_ARGS__); \
+  case Type::UINT32:                               \
+    return FUNCTOR<UInt32Type>::Exec(__VA_ARGS__); \
+  case Type::UINT64:                               \
+    return FUNCTOR<UInt64Type>::Exec(__VA_ARGS__); \
+  case Type::FLOAT:                                \
+    return FUNCTOR<FloatType>::Exec(__VA_ARGS__);  \
+  case Type::DOUBLE:                               \
+    return FUNCTOR<DoubleType>::Exec(__VA_ARGS__);
+
+template <typename ArrowType>
+struct CompareImpl {
+  using CType = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  static Status Exec(const ArrayData& data, const Scalar& scalar, CompareOp op,
+                     uint32_t* out, cudaStream_t stream) {
+    const CType value = checked_cast<const ScalarType&>(scalar).value;
+    CUDA_RT_RETURN_NOT_OK(internal::LaunchCompareScalar<CType>(
+        op, data.GetValues<CType>(1), data.length, value, out, stream));
+    return Status::OK();
+  }
+};
+
+Status LaunchCompare(const ArrayData& data, const Scalar& scalar, CompareOp op,
+                     uint32_t* out, cudaStream_t stream) {
+  switch (data.type->id()) {
+    CUDA_NUMERIC_TYPE_CASES(CompareImpl, data, scalar, op, out, stream)
+    default:
+      break;
+  }
+  return Status::NotImplemented("Device comparison of ", data.type->ToString());
+}
+
+// The type values are summed as, as with compute::Sum
+template <typename ArrowType, typename Enable = void>
+struct SumTypeTraits {};
+
+template <typename ArrowType>
+struct SumTypeTraits<ArrowType, enable_if_signed_integer<ArrowType>> {
+  using Type = Int64Type;
+};
+
+template <typename ArrowType>
+struct SumTypeTraits<ArrowType, enable_if_unsigned_integer<ArrowType>> {
+  using Type = UInt64Type;
+};
+
+template <typename ArrowType>
+struct SumTypeTraits<ArrowType, enable_if_floating_point<ArrowType>> {
+  using Type = DoubleType;
+};
+
+template <typename ArrowType>
+struct SumImpl {
+  using CType = typename ArrowType::c_type;
+  using SumType = typename SumTypeTraits<ArrowType>::Type;
+  using Acc = typename SumType::c_type;
+  using SumScalar = typename TypeTraits<SumType>::ScalarType;
+
+  static Status Exec(const ArrayData& data, std::shared_ptr<Scalar>* out) {
+    if (data.length == 0) {
+      *out = std::make_shared<SumScalar>(0, false);
+      return Status::OK();
+    }
+    DeviceCall call;
+    RETURN_NOT_OK(call.Init({&data}));
+    const int num_blocks = internal::SumNumBlocks(data.length);
+    // The partial sums and counts, then the total sum and count
+    std::shared_ptr<CudaBuffer> sums, counts;
+    RETURN_NOT_OK(call.AllocateScratch((num_blocks + 1) * sizeof(Acc), &sums));
+    RETURN_NOT_OK(
+        call.AllocateScratch((num_blocks + 1) * sizeof(unsigned long long), &counts));
+    auto sums_data = DeviceData<Acc>(sums);
+    auto counts_data = DeviceData<unsigned long long>(counts);
+    CUDA_RT_RETURN_NOT_OK(internal::LaunchSum(
+        data.GetValues<CType>(1), ValidityBitmap(data), data.offset, data.length,
+        sums_data, counts_data, sums_data + num_blocks, counts_data + num_blocks,
+        call.stream()));
+    RETURN_NOT_OK(call.Synchronize());
+
+    Acc sum = 0;
+    unsigned long long count = 0;
+    RETURN_NOT_OK(ReadValue(sums, num_blocks, &sum));
+    RETURN_NOT_OK(ReadValue(counts, num_blocks, &count));
+    *out = std::make_shared<SumScalar>(sum, count != 0);
+    return Status::OK();
+  }
+};
+
+Status CheckBoolean(const Array& values) {
+  if (values.type_id() != Type::BOOL) {
+    return Status::TypeError("Expected a boolean array, got ", values.type()->ToString());
+  }
+  return Status::OK();
+}
+
+Status ExecBitmapOp(BitmapOp op, const Array& left, const Array* right,
+                    std::shared_ptr<Array>* out) {
+  RETURN_NOT_OK(CheckBoolean(left));
+  const ArrayData& left_data = *left.data();
+  std::vector<const ArrayData*> inputs = {&left_data};
+  if (right != nullptr) {
+    RETURN_NOT_OK(CheckBoolean(*right));
+    if (right->length() != left.length()) {
+      return Status::Invalid("Boolean arrays of different lengths");
+    }
+    inputs.push_back(right->data().get());
+  }
+  const ArrayData* right_data = right ? right->data().get() : nullptr;
+  const int64_t length = left.length();
+  if (length == 0) {
+    *out = left.Slice(0, 0);
+    return Status::OK();
+  }
+
+  DeviceCall call;
+  RETURN_NOT_OK(call.Init(inputs));
+  std::shared_ptr<CudaBuffer> bits, counter;
+  std::shared_ptr<Buffer> validity;
+  RETURN_NOT_OK(call.Allocate(DeviceBitmapSize(length), &bits));
+  CUDA_RT_RETURN_NOT_OK(internal::LaunchBitmapOp(
+      op, left_data.buffers[1]->data(), left_data.offset,
+      right_data ? right_data->buffers[1]->data() : nullptr,
+      right_data ? right_data->offset : 0, length, DeviceData<uint32_t>(bits), nullptr,
+      call.stream()));
+  RETURN_NOT_OK(call.AllocateCounter(&counter));
+  RETURN_NOT_OK(PropagateNulls(&call, left_data, right_data, counter, &validity));
+
+  int64_t null_count = 0;
+  RETURN_NOT_OK(FinishNulls(&call, length, validity, counter, &null_count));
+  *out = MakeArray(
+      ArrayData::Make(boolean(), length, {validity, std::move(bits)}, null_count));
+  return Status::OK();
+}
+
+}  // namespace
+
+Status Compare(const Array& values, const Scalar& scalar,
+               const compute::CompareOptions& options, std::shared_ptr<Array>* out) {
+  if (!is_integer(values.type_id()) && !is_floating(values.type_id())) {
+    return Status::NotImplemented("Device comparison of ", values.type()->ToString());
+  }
+  if (!scalar.type->Equals(*values.type())) {
+    return Status::TypeError("Cannot compare ", values.type()->ToString(), " to a ",
+                             scalar.type->ToString(), " scalar");
+  }
+  if (!scalar.is_valid) {
+    return Status::NotImplemented("Device comparison to a null scalar");
+  }
+  const ArrayData& data = *values.data();
+  const int64_t length = values.length();
+  if (length == 0) {
+    *out = MakeArray(ArrayData::Make(boolean(), 0, {nullptr, nullptr}, 0));
+    return Status::OK();
+  }
+
+  DeviceCall call;
+  RETURN_NOT_OK(call.Init({&data}));
+  std::shared_ptr<CudaBuffer> bits, counter;
+  std::shared_ptr<Buffer> validity;
+  RETURN_NOT_OK(call.Allocate(DeviceBitmapSize(length), &bits));
+  const CompareOp op = GetCompareOp(options.op);
+  auto out_bits = DeviceData<uint32_t>(bits);
+  RETURN_NOT_OK(LaunchCompare(data, scalar, op, out_bits, call.stream()));
+  RETURN_NOT_OK(call.AllocateCounter(&counter));
+  RETURN_NOT_OK(PropagateNulls(&call, data, nullptr, counter, &validity));
+
+  int64_t null_count = 0;
+  RETURN_NOT_OK(FinishNulls(&call, length, validity, counter, &null_count));
+  *out = MakeArray(
+      ArrayData::Make(boolean(), length, {validity, std::move(bits)}, null_count));
+  return Status::OK();
+}
+
+Status Invert(const Array& values, std::shared_ptr<Array>* out) {
+  return ExecBitmapOp(BitmapOp::INVERT, values, nullptr, out);
+}
+
+Status And(const Array& left, const Array& right, std::shared_ptr<Array>* out) {
+  return ExecBitmapOp(BitmapOp::AND, left, &right, out);
+}
+
+Status Or(const Array& left, const Array& right, std::shared_ptr<Array>* out) {
+  return ExecBitmapOp(BitmapOp::OR, left, &right, out);
+}
+
+Status Xor(const Array& left, const Array& right, std::shared_ptr<Array>* out) {
+  return ExecBitmapOp(BitmapOp::XOR, left, &right, out);
+}
+
+Status Filter(const Array& values, const Array& filter, std::shared_ptr<Array>* out) {
+  RETURN_NOT_OK(CheckBoolean(filter));
+  if (filter.length() != values.length()) {
+    return Status::Invalid("Filter of length ", filter.length(), " for values of length ",
+                           values.length());
+  }
+  const auto fixed_width = dynamic_cast<const FixedWidthType*>(values.type().get());
+  const int bit_width = fixed_width ? fixed_width->bit_width() : 0;
+  if (bit_width != 8 && bit_width != 16 && bit_width != 32 && bit_width != 64) {
+    return Status::NotImplemented("Device filter of ", values.type()->ToString());
+  }
+  const ArrayData& data = *values.data();
+  const ArrayData& filter_data = *filter.data();
+  const int64_t length = values.length();
+  if (length == 0) {
+    *out = values.Slice(0, 0);
+    return Status::OK();
+  }
+
+  DeviceCall call;
+  RETURN_NOT_OK(call.Init({&data, &filter_data}));
+  const uint8_t* filter_validity = ValidityBitmap(filter_data);
+  const uint8_t* filter_bits = filter_data.buffers[1]->data();
+
+  // Count the selected values of each block, and wait for their total to
+  // allocate the result
+  const int64_t num_blocks = internal::FilterNumBlocks(length);
+  std::shared_ptr<CudaBuffer> block_offsets;
+  RETURN_NOT_OK(
+      call.AllocateScratch((num_blocks + 1) * sizeof(int64_t), &block_offsets));
+  CUDA_RT_RETURN_NOT_OK(internal::LaunchFilterCount(
+      filter_validity, filter_bits, filter_data.offset, length,
+      DeviceData<int64_t>(block_offsets), call.stream()));
+  RETURN_NOT_OK(call.Synchronize());
+  int64_t out_length = 0;
+  RETURN_NOT_OK(ReadValue(block_offsets, num_blocks, &out_length));
+
+  const int byte_width = bit_width / 8;
+  const uint8_t* validity = ValidityBitmap(data);
+  std::shared_ptr<CudaBuffer> out_values, out_validity, null_counter;
+  RETURN_NOT_OK(call.Allocate(out_length * byte_width, &out_values));
+  if (validity != nullptr) {
+    RETURN_NOT_OK(call.AllocateZeroed(DeviceBitmapSize(out_length), &out_validity));
+    RETURN_NOT_OK(call.AllocateCounter(&null_counter));
+  }
+  auto out_validity_data = out_validity ? DeviceData<uint32_t>(out_validity) : nullptr;
+  auto null_count_data =
+      null_counter ? DeviceData<unsigned long long>(null_counter) : nullptr;
+
+#define LAUNCH_FILTER_SCATTER(T)                                                   \
+  internal::LaunchFilterScatter<T>(                                                \
+      filter_validity, filter_bits, filter_data.offset,                            \
+      reinterpret_cast<const T*>(data.buffers[1]->data()) + data.offset, validity, \
+      data.offset, length, DeviceData<int64_t>(block_offsets),                     \
+      DeviceData<T>(out_values), out_validity_data, null_count_data, call.stream())
+
+  switch (byte_width) {
+    case 1:
+      CUDA_RT_RETURN_NOT_OK(LAUNCH_FILTER_SCATTER(uint8_t));
+      break;
+    case 2:
+      CUDA_RT_RETURN_NOT_OK(LAUNCH_FILTER_SCATTER(uint16_t));
+      break;
+    case 4:
+      CUDA_RT_RETURN_NOT_OK(LAUNCH_FILTER_SCATTER(uint32_t));
+      break;
+    default:
+      CUDA_RT_RETURN_NOT_OK(LAUNCH_FILTER_SCATTER(uint64_t));
+      break;
+  }
+
+#undef LAUNCH_FILTER_SCATTER
+
+  RETURN_NOT_OK(call.Synchronize());
+  int64_t null_count = 0;
+  if (null_counter != nullptr) {
+    unsigned long long count = 0;
+    RETURN_NOT_OK(ReadValue(null_counter, 0, &count));
+    null_count = static_cast<int64_t>(count);
+  }
+  std::shared_ptr<Buffer> out_validity_buffer;
+  if (null_count != 0) {
+    out_validity_buffer = std::move(out_validity);
+  }
+  *out = MakeArray(ArrayData::Make(values.type(), out_length,
+                                   {out_validity_buffer, std::move(out_values)},
+                                   null_count));
+  return Status::OK();
+}
+
+Status Sum(const Array& values, std::shared_ptr<Scalar>* out) {
+  const ArrayData& data = *values.data();
+  switch (values.type_id()) {
+    CUDA_NUMERIC_TYPE_CASES(SumImpl, data, out)
+    default:
+      break;
+  }
+  return Status::NotImplemented("Device sum of ", values.type()->ToString());
+}
+
+}  // namespace cuda
+}  // namespace arrow
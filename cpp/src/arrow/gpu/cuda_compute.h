@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_GPU_CUDA_COMPUTE_H
+#define ARROW_GPU_CUDA_COMPUTE_H
+
+#include <memory>
+
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class Scalar;
+
+namespace cuda {
+
+// Kernels on arrays whose buffers live on a GPU, as returned by
+// ReadRecordBatch() of cuda_arrow_ipc.h or CopyRecordBatchToDevice().
+//
+// All the buffers of the inputs must be CudaBuffers of the same context, on
+// which the kernels run.  Results are allocated from the memory pool of that
+// context.  The kernels run on a stream of their own and have completed
+// when the functions return.
+
+/// \brief Compare each value of a numeric array to a scalar of its type
+///
+/// \param[in] values the device array
+/// \param[in] scalar the host scalar to compare to
+/// \param[in] options the comparison operator
+/// \param[out] out the device boolean array, null where values is null
+/// \return Status
+ARROW_EXPORT
+Status Compare(const Array& values, const Scalar& scalar,
+               const compute::CompareOptions& options, std::shared_ptr<Array>* out);
+
+/// \brief Invert a boolean array
+ARROW_EXPORT
+Status Invert(const Array& values, std::shared_ptr<Array>* out);
+
+/// \brief And two boolean arrays of the same length, null where either is
+ARROW_EXPORT
+Status And(const Array& left, const Array& right, std::shared_ptr<Array>* out);
+
+/// \brief Or two boolean arrays of the same length, null where either is
+ARROW_EXPORT
+Status Or(const Array& left, const Array& right, std::shared_ptr<Array>* out);
+
+/// \brief Xor two boolean arrays of the same length, null where either is
+ARROW_EXPORT
+Status Xor(const Array& left, const Array& right, std::shared_ptr<Array>* out);
+
+/// \brief Select the values for which a boolean filter is true
+///
+/// Null filter slots drop their value.  The values must be of a fixed-width
+/// type of 8, 16, 32 or 64 bits.  The selected values are counted before the
+/// result is allocated, so this synchronizes once more than the other
+/// kernels.
+///
+/// \param[in] values the device array to filter
+/// \param[in] filter the device boolean array, of the same length
+/// \param[out] out the device array of the selected values
+/// \return Status
+ARROW_EXPORT
+Status Filter(const Array& values, const Array& filter, std::shared_ptr<Array>* out);
+
+/// \brief Sum the non-null values of a numeric array
+///
+/// As with compute::Sum, integers are summed as int64 or uint64 and floating
+/// point values as double.
+///
+/// \param[in] values the device array
+/// \param[out] out the host scalar, null if there is no non-null value
+/// \return Status
+ARROW_EXPORT
+Status Sum(const Array& values, std::shared_ptr<Scalar>* out);
+
+}  // namespace cuda
+}  // namespace arrow
+
+#endif  // ARROW_GPU_CUDA_COMPUTE_H
@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Non-public header
+//
+// Launchers of the device kernels of cuda_compute_kernels.cu, which is
+// compiled by nvcc.  Only plain types cross this boundary.  All launches are
+// asynchronous on the given stream, and all pointers but scalars are device
+// pointers.  Bitmaps are written as 32-bit words, so their buffers must be
+// padded to a multiple of 4 bytes.
+
+#ifndef ARROW_GPU_CUDA_COMPUTE_INTERNAL_H
+#define ARROW_GPU_CUDA_COMPUTE_INTERNAL_H
+
+#include <cstdint>
+
+#include <cuda_runtime.h>
+
+namespace arrow {
+namespace cuda {
+namespace internal {
+
+enum class CompareOp { EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL };
+
+enum class BitmapOp { COPY, INVERT, AND, OR, XOR };
+
+/// Bit i of out is op(bit left_offset + i of left, bit right_offset + i of
+/// right), right being ignored by COPY and INVERT.  If set_count isn't null,
+/// the number of set bits is added to it.
+cudaError_t LaunchBitmapOp(BitmapOp op, const uint8_t* left, int64_t left_offset,
+                           const uint8_t* right, int64_t right_offset, int64_t length,
+                           uint32_t* out, unsigned long long* set_count,
+                           cudaStream_t stream);
+
+/// Bit i of out is op(values[i], scalar)
+template <typename T>
+cudaError_t LaunchCompareScalar(CompareOp op, const T* values, int64_t length, T scalar,
+                                uint32_t* out, cudaStream_t stream);
+
+/// The number of blocks of a filter of the given length
+int64_t FilterNumBlocks(int64_t length);
+
+/// Write the exclusive prefix sum of the number of selected slots of each
+/// block to block_offsets, of FilterNumBlocks(length) + 1 entries, the last one
+/// being the number of selected slots.  Null filter slots are not selected.
+/// filter_validity may be null.
+cudaError_t LaunchFilterCount(const uint8_t* filter_validity, const uint8_t* filter,
+                              int64_t filter_offset, int64_t length,
+                              int64_t* block_offsets, cudaStream_t stream);
+
+/// Write the selected values to out, given the block offsets of
+/// LaunchFilterCount.  If validity isn't null, the validity of the selected
+/// values is or'ed into out_validity, which must be zeroed, and their number
+/// of nulls added to out_null_count.  T is an unsigned integer of the width
+/// of the values.
+template <typename T>
+cudaError_t LaunchFilterScatter(const uint8_t* filter_validity, const uint8_t* filter,
+                                int64_t filter_offset, const T* values,
+                                const uint8_t* validity, int64_t validity_offset,
+                                int64_t length, const int64_t* block_offsets, T* out,
+                                uint32_t* out_validity,
+                                unsigned long long* out_null_count, cudaStream_t stream);
+
+/// The number of partial sums of LaunchSum
+int SumNumBlocks(int64_t length);
+
+/// Write the sum and the number of the non-null values to sum[0] and
+/// count[0], through SumNumBlocks(length) partial sums and counts.  validity
+/// may be null.
+template <typename T, typename Acc>
+cudaError_t LaunchSum(const T* values, const uint8_t* validity, int64_t validity_offset,
+                      int64_t length, Acc* partial_sums,
+                      unsigned long long* partial_counts, Acc* sum,
+                      unsigned long long* count, cudaStream_t stream);
+
+}  // namespace internal
+}  // namespace cuda
+}  // namespace arrow
+
+#endif  // ARROW_GPU_CUDA_COMPUTE_INTERNAL_H
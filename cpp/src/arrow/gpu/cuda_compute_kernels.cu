@@ -0,0 +1,508 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute_internal.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace arrow {
+namespace cuda {
+namespace internal {
+
+namespace {
+
+constexpr int kWarpSize = 32;
+constexpr int kBlockSize = 256;
+constexpr int kWarpsPerBlock = kBlockSize / kWarpSize;
+constexpr int kScanBlockSize = 1024;
+// The grid size of the grid-stride kernels is capped to this
+constexpr int64_t kMaxBlocks = 1024;
+constexpr unsigned kFullMask = 0xFFFFFFFFu;
+
+int GridSize(int64_t length) {
+  const int64_t blocks = (length + kBlockSize - 1) / kBlockSize;
+  return static_cast<int>(std::max<int64_t>(1, std::min(kMaxBlocks, blocks)));
+}
+
+__device__ inline bool GetBit(const uint8_t* bits, int64_t i) {
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+__device__ inline int LaneId() { return threadIdx.x & (kWarpSize - 1); }
+
+__device__ inline int64_t GlobalThreadId() {
+  return static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+}
+
+__device__ inline int64_t GridStride() {
+  return static_cast<int64_t>(gridDim.x) * blockDim.x;
+}
+
+// Grid-stride loops writing bitmaps run to the length rounded up to a whole
+// warp, so that a warp always writes whole 32-bit words
+__device__ inline int64_t WarpPaddedLength(int64_t length) {
+  return (length + kWarpSize - 1) & ~static_cast<int64_t>(kWarpSize - 1);
+}
+
+// ----------------------------------------------------------------------
+// Bitmap operations
+
+struct CopyBits {
+  __device__ static bool Call(bool left, bool) { return left; }
+};
+
+struct InvertBits {
+  __device__ static bool Call(bool left, bool) { return !left; }
+};
+
+struct AndBits {
+  __device__ static bool Call(bool left, bool right) { return left && right; }
+};
+
+struct OrBits {
+  __device__ static bool Call(bool left, bool right) { return left || right; }
+};
+
+struct XorBits {
+  __device__ static bool Call(bool left, bool right) { return left != right; }
+};
+
+template <typename Op>
+__global__ void BitmapOpKernel(const uint8_t* left, int64_t left_offset,
+                               const uint8_t* right, int64_t right_offset,
+                               int64_t length, uint32_t* out,
+                               unsigned long long* set_count) {
+  unsigned long long warp_count = 0;
+  const int64_t padded_length = WarpPaddedLength(length);
+  for (int64_t i = GlobalThreadId(); i < padded_length; i += GridStride()) {
+    bool bit = false;
+    if (i < length) {
+      const bool right_bit = right != nullptr && GetBit(right, right_offset + i);
+      bit = Op::Call(GetBit(left, left_offset + i), right_bit);
+    }
+    const uint32_t word = __ballot_sync(kFullMask, bit);
+    if (LaneId() == 0) {
+      out[i / kWarpSize] = word;
+      warp_count += __popc(word);
+    }
+  }
+  if (set_count != nullptr && LaneId() == 0) {
+    atomicAdd(set_count, warp_count);
+  }
+}
+
+template <typename Op>
+cudaError_t LaunchBitmapOpKernel(const uint8_t* left, int64_t left_offset,
+                                 const uint8_t* right, int64_t right_offset,
+                                 int64_t length, uint32_t* out,
+                                 unsigned long long* set_count, cudaStream_t stream) {
+  BitmapOpKernel<Op><<<GridSize(length), kBlockSize, 0, stream>>>(
+      left, left_offset, right, right_offset, length, out, set_count);
+  return cudaGetLastError();
+}
+
+// ----------------------------------------------------------------------
+// Comparisons
+
+struct Equal {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left == right;
+  }
+};
+
+struct NotEqual {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left != right;
+  }
+};
+
+struct Greater {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqual {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left >= right;
+  }
+};
+
+struct Less {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left < right;
+  }
+};
+
+struct LessEqual {
+  template <typename T>
+  __device__ static bool Call(T left, T right) {
+    return left <= right;
+  }
+};
+
+template <typename T, typename Op>
+__global__ void CompareScalarKernel(const T* values, int64_t length, T scalar,
+                                    uint32_t* out) {
+  const int64_t padded_length = WarpPaddedLength(length);
+  for (int64_t i = GlobalThreadId(); i < padded_length; i += GridStride()) {
+    const bool bit = i < length && Op::template Call<T>(values[i], scalar);
+    const uint32_t word = __ballot_sync(kFullMask, bit);
+    if (LaneId() == 0) {
+      out[i / kWarpSize] = word;
+    }
+  }
+}
+
+template <typename T, typename Op>
+cudaError_t LaunchCompareScalarKernel(const T* values, int64_t length, T scalar,
+                                      uint32_t* out, cudaStream_t stream) {
+  CompareScalarKernel<T, Op>
+      <<<GridSize(length), kBlockSize, 0, stream>>>(values, length, scalar, out);
+  return cudaGetLastError();
+}
+
+// ----------------------------------------------------------------------
+// Filter
+//
+// Each block handles kBlockSize filter slots.  A first kernel counts the
+// selected slots of each block, a single-block kernel turns the counts into
+// offsets, and a last kernel writes the selected values of each warp at the
+// offset of its block plus the selected slots of the warps before it.
+
+__device__ inline bool IsSelected(const uint8_t* filter_validity, const uint8_t* filter,
+                                  int64_t filter_offset, int64_t i, int64_t length) {
+  return i < length &&
+         (filter_validity == nullptr || GetBit(filter_validity, filter_offset + i)) &&
+         GetBit(filter, filter_offset + i);
+}
+
+__global__ void FilterCountKernel(const uint8_t* filter_validity, const uint8_t* filter,
+                                  int64_t filter_offset, int64_t length,
+                                  int64_t* block_counts) {
+  __shared__ int warp_counts[kWarpsPerBlock];
+  const int64_t i = GlobalThreadId();
+  const bool selected = IsSelected(filter_validity, filter, filter_offset, i, length);
+  const uint32_t selected_mask = __ballot_sync(kFullMask, selected);
+  if (LaneId() == 0) {
+    warp_counts[threadIdx.x / kWarpSize] = __popc(selected_mask);
+  }
+  __syncthreads();
+  if (threadIdx.x == 0) {
+    int64_t count = 0;
+    for (int warp = 0; warp < kWarpsPerBlock; ++warp) {
+      count += warp_counts[warp];
+    }
+    block_counts[blockIdx.x] = count;
+  }
+}
+
+// Replace the n first values by their exclusive prefix sum, and write their
+// total to values[n].  Runs as a single block, a chunk of kScanBlockSize
+// values at a time.
+__global__ void ExclusiveScanKernel(int64_t* values, int64_t n) {
+  __shared__ int64_t chunk[kScanBlockSize];
+  const int tid = threadIdx.x;
+  int64_t carry = 0;
+  for (int64_t base = 0; base < n; base += kScanBlockSize) {
+    const int64_t i = base + tid;
+    const int64_t value = i < n ? values[i] : 0;
+    chunk[tid] = value;
+    __syncthreads();
+    for (int stride = 1; stride < kScanBlockSize; stride *= 2) {
+      const int64_t addend = tid >= stride ? chunk[tid - stride] : 0;
+      __syncthreads();
+      chunk[tid] += addend;
+      __syncthreads();
+    }
+    if (i < n) {
+      values[i] = carry + chunk[tid] - value;
+    }
+    carry += chunk[kScanBlockSize - 1];
+    __syncthreads();
+  }
+  if (tid == 0) {
+    values[n] = carry;
+  }
+}
+
+template <typename T>
+__global__ void FilterScatterKernel(const uint8_t* filter_validity, const uint8_t* filter,
+                                    int64_t filter_offset, const T* values,
+                                    const uint8_t* validity, int64_t validity_offset,
+                                    int64_t length, const int64_t* block_offsets, T* out,
+                                    uint32_t* out_validity,
+                                    unsigned long long* out_null_count) {
+  __shared__ int warp_offsets[kWarpsPerBlock];
+  const int64_t i = GlobalThreadId();
+  const int warp = threadIdx.x / kWarpSize;
+  const int lane = LaneId();
+
+  const bool selected = IsSelected(filter_validity, filter, filter_offset, i, length);
+  const uint32_t selected_mask = __ballot_sync(kFullMask, selected);
+  const bool valid =
+      selected && (validity == nullptr || GetBit(validity, validity_offset + i));
+  const uint32_t valid_mask = __ballot_sync(kFullMask, valid);
+  if (lane == 0) {
+    warp_offsets[warp] = __popc(selected_mask);
+  }
+  __syncthreads();
+  if (threadIdx.x == 0) {
+    int offset = 0;
+    for (int w = 0; w < kWarpsPerBlock; ++w) {
+      const int count = warp_offsets[w];
+      warp_offsets[w] = offset;
+      offset += count;
+    }
+  }
+  __syncthreads();
+
+  const int64_t warp_base = block_offsets[blockIdx.x] + warp_offsets[warp];
+  if (selected) {
+    const int rank = __popc(selected_mask & ((1u << lane) - 1));
+    out[warp_base + rank] = values[i];
+  }
+  if (validity != nullptr && lane == 0 && selected_mask != 0) {
+    // The selected slots of the warp land on consecutive output bits: gather
+    // their validity into a run of bits and or it into at most two words
+    uint32_t run = 0;
+    int run_length = 0;
+    for (uint32_t remaining = selected_mask; remaining != 0; remaining &= remaining - 1) {
+      const int slot = __ffs(remaining) - 1;
+      run |= ((valid_mask >> slot) & 1u) << run_length;
+      ++run_length;
+    }
+    const int shift = static_cast<int>(warp_base % kWarpSize);
+    const int64_t word = warp_base / kWarpSize;
+    atomicOr(&out_validity[word], run << shift);
+    if (shift != 0 && shift + run_length > kWarpSize) {
+      atomicOr(&out_validity[word + 1], run >> (kWarpSize - shift));
+    }
+    const int null_count = run_length - __popc(valid_mask);
+    if (null_count != 0) {
+      atomicAdd(out_null_count, static_cast<unsigned long long>(null_count));
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// Sum
+
+// Reduce the values of a block held in shared memory, leaving the total in
+// the first slot
+template <typename Acc>
+__device__ void BlockReduce(Acc* sums, unsigned long long* counts) {
+  const int tid = threadIdx.x;
+  __syncthreads();
+  for (int stride = kBlockSize / 2; stride > 0; stride /= 2) {
+    if (tid < stride) {
+      sums[tid] += sums[tid + stride];
+      counts[tid] += counts[tid + stride];
+    }
+    __syncthreads();
+  }
+}
+
+template <typename T, typename Acc>
+__global__ void PartialSumKernel(const T* values, const uint8_t* validity,
+                                 int64_t validity_offset, int64_t length,
+                                 Acc* partial_sums, unsigned long long* partial_counts) {
+  __shared__ Acc sums[kBlockSize];
+  __shared__ unsigned long long counts[kBlockSize];
+  Acc sum = 0;
+  unsigned long long count = 0;
+  for (int64_t i = GlobalThreadId(); i < length; i += GridStride()) {
+    if (validity == nullptr || GetBit(validity, validity_offset + i)) {
+      sum += static_cast<Acc>(values[i]);
+      ++count;
+    }
+  }
+  sums[threadIdx.x] = sum;
+  counts[threadIdx.x] = count;
+  BlockReduce(sums, counts);
+  if (threadIdx.x == 0) {
+    partial_sums[blockIdx.x] = sums[0];
+    partial_counts[blockIdx.x] = counts[0];
+  }
+}
+
+template <typename Acc>
+__global__ void FinalSumKernel(const Acc* partial_sums,
+                               const unsigned long long* partial_counts, int n, Acc* sum,
+                               unsigned long long* count) {
+  __shared__ Acc sums[kBlockSize];
+  __shared__ unsigned long long counts[kBlockSize];
+  Acc thread_sum = 0;
+  unsigned long long thread_count = 0;
+  for (int i = threadIdx.x; i < n; i += kBlockSize) {
+    thread_sum += partial_sums[i];
+    thread_count += partial_counts[i];
+  }
+  sums[threadIdx.x] = thread_sum;
+  counts[threadIdx.x] = thread_count;
+  BlockReduce(sums, counts);
+  if (threadIdx.x == 0) {
+    *sum = sums[0];
+    *count = counts[0];
+  }
+}
+
+}  // namespace
+
+cudaError_t LaunchBitmapOp(BitmapOp op, const uint8_t* left, int64_t left_offset,
+                           const uint8_t* right, int64_t right_offset, int64_t length,
+                           uint32_t* out, unsigned long long* set_count,
+                           cudaStream_t stream) {
+  switch (op) {
+    case BitmapOp::COPY:
+      return LaunchBitmapOpKernel<CopyBits>(left, left_offset, nullptr, 0, length, out,
+                                            set_count, stream);
+    case BitmapOp::INVERT:
+      return LaunchBitmapOpKernel<InvertBits>(left, left_offset, nullptr, 0, length, out,
+                                              set_count, stream);
+    case BitmapOp::AND:
+      return LaunchBitmapOpKernel<AndBits>(left, left_offset, right, right_offset, length,
+                                           out, set_count, stream);
+    case BitmapOp::OR:
+      return LaunchBitmapOpKernel<OrBits>(left, left_offset, right, right_offset, length,
+                                          out, set_count, stream);
+    case BitmapOp::XOR:
+      return LaunchBitmapOpKernel<XorBits>(left, left_offset, right, right_offset, length,
+                                           out, set_count, stream);
+  }
+  return cudaErrorInvalidValue;
+}
+
+template <typename T>
+cudaError_t LaunchCompareScalar(CompareOp op, const T* values, int64_t length, T scalar,
+                                uint32_t* out, cudaStream_t stream) {
+  switch (op) {
+    case CompareOp::EQUAL:
+      return LaunchCompareScalarKernel<T, Equal>(values, length, scalar, out, stream);
+    case CompareOp::NOT_EQUAL:
+      return LaunchCompareScalarKernel<T, NotEqual>(values, length, scalar, out, stream);
+    case CompareOp::GREATER:
+      return LaunchCompareScalarKernel<T, Greater>(values, length, scalar, out, stream);
+    case CompareOp::GREATER_EQUAL:
+      return LaunchCompareScalarKernel<T, GreaterEqual>(values, length, scalar, out,
+                                                        stream);
+    case CompareOp::LESS:
+      return LaunchCompareScalarKernel<T, Less>(values, length, scalar, out, stream);
+    case CompareOp::LESS_EQUAL:
+      return LaunchCompareScalarKernel<T, LessEqual>(values, length, scalar, out, stream);
+  }
+  return cudaErrorInvalidValue;
+}
+
+int64_t FilterNumBlocks(int64_t length) { return (length + kBlockSize - 1) / kBlockSize; }
+
+cudaError_t LaunchFilterCount(const uint8_t* filter_validity, const uint8_t* filter,
+                              int64_t filter_offset, int64_t length,
+                              int64_t* block_offsets, cudaStream_t stream) {
+  const int64_t num_blocks = FilterNumBlocks(length);
+  if (num_blocks > 0) {
+    FilterCountKernel<<<static_cast<unsigned int>(num_blocks), kBlockSize, 0, stream>>>(
+        filter_validity, filter, filter_offset, length, block_offsets);
+  }
+  ExclusiveScanKernel<<<1, kScanBlockSize, 0, stream>>>(block_offsets, num_blocks);
+  return cudaGetLastError();
+}
+
+template <typename T>
+cudaError_t LaunchFilterScatter(const uint8_t* filter_validity, const uint8_t* filter,
+                                int64_t filter_offset, const T* values,
+                                const uint8_t* validity, int64_t validity_offset,
+                                int64_t length, const int64_t* block_offsets, T* out,
+                                uint32_t* out_validity,
+                                unsigned long long* out_null_count,
+                                cudaStream_t stream) {
+  const int64_t num_blocks = FilterNumBlocks(length);
+  if (num_blocks == 0) {
+    return cudaSuccess;
+  }
+  const auto grid_size = static_cast<unsigned int>(num_blocks);
+  FilterScatterKernel<T><<<grid_size, kBlockSize, 0, stream>>>(
+      filter_validity, filter, filter_offset, values, validity, validity_offset, length,
+      block_offsets, out, out_validity, out_null_count);
+  return cudaGetLastError();
+}
+
+int SumNumBlocks(int64_t length) { return GridSize(length); }
+
+template <typename T, typename Acc>
+cudaError_t LaunchSum(const T* values, const uint8_t* validity, int64_t validity_offset,
+                      int64_t length, Acc* partial_sums,
+                      unsigned long long* partial_counts, Acc* sum,
+                      unsigned long long* count, cudaStream_t stream) {
+  const int num_blocks = SumNumBlocks(length);
+  PartialSumKernel<T, Acc><<<num_blocks, kBlockSize, 0, stream>>>(
+      values, validity, validity_offset, length, partial_sums, partial_counts);
+  FinalSumKernel<Acc><<<1, kBlockSize, 0, stream>>>(partial_sums, partial_counts,
+                                                    num_blocks, sum, count);
+  return cudaGetLastError();
+}
+
+#define INSTANTIATE_COMPARE(T)                                                       \
+  template cudaError_t LaunchCompareScalar<T>(CompareOp, const T*, int64_t, T,       \
+                                              uint32_t*, cudaStream_t);
+
+INSTANTIATE_COMPARE(int8_t)
+INSTANTIATE_COMPARE(int16_t)
+INSTANTIATE_COMPARE(int32_t)
+INSTANTIATE_COMPARE(int64_t)
+INSTANTIATE_COMPARE(uint8_t)
+INSTANTIATE_COMPARE(uint16_t)
+INSTANTIATE_COMPARE(uint32_t)
+INSTANTIATE_COMPARE(uint64_t)
+INSTANTIATE_COMPARE(float)
+INSTANTIATE_COMPARE(double)
+
+#define INSTANTIATE_FILTER(T)                                                          \
+  template cudaError_t LaunchFilterScatter<T>(                                         \
+      const uint8_t*, const uint8_t*, int64_t, const T*, const uint8_t*, int64_t,      \
+      int64_t, const int64_t*, T*, uint32_t*, unsigned long long*, cudaStream_t);
+
+INSTANTIATE_FILTER(uint8_t)
+INSTANTIATE_FILTER(uint16_t)
+INSTANTIATE_FILTER(uint32_t)
+INSTANTIATE_FILTER(uint64_t)
+
+#define INSTANTIATE_SUM(T, ACC)                                                      \
+  template cudaError_t LaunchSum<T, ACC>(const T*, const uint8_t*, int64_t, int64_t, \
+                                         ACC*, unsigned long long*, ACC*,            \
+                                         unsigned long long*, cudaStream_t);
+
+INSTANTIATE_SUM(int8_t, int64_t)
+INSTANTIATE_SUM(int16_t, int64_t)
+INSTANTIATE_SUM(int32_t, int64_t)
+INSTANTIATE_SUM(int64_t, int64_t)
+INSTANTIATE_SUM(uint8_t, uint64_t)
+INSTANTIATE_SUM(uint16_t, uint64_t)
+INSTANTIATE_SUM(uint32_t, uint64_t)
+INSTANTIATE_SUM(uint64_t, uint64_t)
+INSTANTIATE_SUM(float, double)
+INSTANTIATE_SUM(double, double)
+
+}  // namespace internal
+}  // namespace cuda
+}  // namespace arrow
@@ -17,16 +17,23 @@
 
 #include "arrow/gpu/cuda_context.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <cuda.h>
 
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
 #include "arrow/gpu/cuda_common.h"
 #include "arrow/gpu/cuda_memory.h"
 
@@ -39,15 +46,6 @@ struct CudaDevice {
   int64_t total_memory;
 };
 
-class ContextSaver {
- public:
-  explicit ContextSaver(CUcontext new_context) { cuCtxPushCurrent(new_context); }
-  ~ContextSaver() {
-    CUcontext unused;
-    cuCtxPopCurrent(&unused);
-  }
-};
-
 class CudaContext::CudaContextImpl {
  public:
   CudaContextImpl() : bytes_allocated_(0) {}
@@ -105,6 +103,32 @@ class CudaContext::CudaContextImpl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               CudaStream* stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK(cuMemcpyHtoDAsync(reinterpret_cast<CUdeviceptr>(dst), src,
+                                       static_cast<size_t>(nbytes),
+                                       reinterpret_cast<CUstream>(stream->handle())));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               CudaStream* stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK(cuMemcpyDtoHAsync(dst, reinterpret_cast<const CUdeviceptr>(src),
+                                       static_cast<size_t>(nbytes),
+                                       reinterpret_cast<CUstream>(stream->handle())));
+    return Status::OK();
+  }
+
+  Status CreateStream(CUstream* out) {
+    ContextSaver set_temporary(context_);
+    // Non-blocking, so as not to synchronize with the legacy default stream
+    // used by the synchronous copies
+    CU_RETURN_NOT_OK(cuStreamCreate(out, CU_STREAM_NON_BLOCKING));
+    return Status::OK();
+  }
+
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK(cuMemcpyDtoD(reinterpret_cast<CUdeviceptr>(dst),
@@ -285,7 +309,10 @@ int CudaDeviceManager::num_devices() const { return impl_->num_devices(); }
 // ----------------------------------------------------------------------
 // CudaContext public API
 
-CudaContext::CudaContext() { impl_.reset(new CudaContextImpl()); }
+CudaContext::CudaContext() {
+  impl_.reset(new CudaContextImpl());
+  memory_pool_.reset(new CudaMemoryPool(this));
+}
 
 CudaContext::~CudaContext() {}
 
@@ -315,6 +342,23 @@ Status CudaContext::CopyDeviceToHost(void* dst, const void* src, int64_t nbytes)
   return impl_->CopyDeviceToHost(dst, src, nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                                          CudaStream* stream) {
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes, stream);
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                                          CudaStream* stream) {
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes, stream);
+}
+
+Status CudaContext::CreateStream(std::shared_ptr<CudaStream>* out) {
+  CUstream stream;
+  RETURN_NOT_OK(impl_->CreateStream(&stream));
+  *out = std::shared_ptr<CudaStream>(new CudaStream(this->shared_from_this(), stream));
+  return Status::OK();
+}
+
 Status CudaContext::CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes) {
   return impl_->CopyDeviceToDevice(dst, src, nbytes);
 }
@@ -327,7 +371,12 @@ Status CudaContext::CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>
 
 Status CudaContext::Synchronize(void) { return impl_->Synchronize(); }
 
-Status CudaContext::Close() { return impl_->Close(); }
+Status CudaContext::Close() {
+  RETURN_NOT_OK(memory_pool_->ReleaseCached());
+  return impl_->Close();
+}
+
+CudaMemoryPool* CudaContext::memory_pool() { return memory_pool_.get(); }
 
 Status CudaContext::Free(void* device_ptr, int64_t nbytes) {
   return impl_->Free(device_ptr, nbytes);
@@ -374,5 +423,316 @@ Status CudaContext::GetDeviceAddress(uint8_t* addr, uint8_t** devaddr) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// CudaMemoryPool
+
+namespace {
+
+constexpr int64_t kMinPoolSizeClass = 512;
+constexpr int64_t kLargePoolSizeClass = 1 << 20;
+
+int64_t PoolSizeClass(int64_t nbytes) {
+  if (nbytes <= kLargePoolSizeClass) {
+    return std::max(kMinPoolSizeClass, BitUtil::NextPower2(nbytes));
+  }
+  return BitUtil::RoundUp(nbytes, kLargePoolSizeClass);
+}
+
+}  // namespace
+
+constexpr int64_t CudaMemoryPool::kDefaultMaxCachedBytes;
+
+class CudaMemoryPool::CudaMemoryPoolImpl {
+ public:
+  // A buffer returning its memory to the pool when destroyed
+  class PoolBuffer : public CudaBuffer {
+   public:
+    PoolBuffer(uint8_t* data, int64_t size, const std::shared_ptr<CudaContext>& context,
+               CudaMemoryPoolImpl* pool, const std::shared_ptr<CudaStream>& stream)
+        : CudaBuffer(data, size, context), pool_(pool), stream_(stream) {}
+
+    ~PoolBuffer() override {
+      if (pool_ != nullptr) {
+        pool_->Free(mutable_data_, size_, stream_);
+      }
+    }
+
+    Status ExportForIpc(std::shared_ptr<CudaIpcMemHandle>* handle) override {
+      RETURN_NOT_OK(CudaBuffer::ExportForIpc(handle));
+      // Exported memory may be mapped by other processes, so is never
+      // reused nor freed, like that of exported non-pool buffers
+      if (pool_ != nullptr) {
+        pool_->Forget(size_);
+        pool_ = nullptr;
+      }
+      return Status::OK();
+    }
+
+   private:
+    CudaMemoryPoolImpl* pool_;
+    std::shared_ptr<CudaStream> stream_;
+  };
+
+  explicit CudaMemoryPoolImpl(CudaContext* context)
+      : context_(context),
+        max_cached_bytes_(kDefaultMaxCachedBytes),
+        bytes_allocated_(0),
+        max_memory_(0),
+        bytes_cached_(0) {}
+
+  ~CudaMemoryPoolImpl() { DCHECK_OK(ReleaseCached()); }
+
+  CudaContext* context() const { return context_; }
+
+  Status Allocate(int64_t nbytes, const std::shared_ptr<CudaStream>& stream,
+                  uint8_t** out) {
+    if (nbytes < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (nbytes == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    const int64_t size_class = PoolSizeClass(nbytes);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (TakeCached(size_class, stream, out)) {
+        TrackAllocation(nbytes);
+        return Status::OK();
+      }
+    }
+    if (!context_->impl_->Allocate(size_class, out).ok()) {
+      // The device may be out of memory because of the cache
+      RETURN_NOT_OK(ReleaseCached());
+      RETURN_NOT_OK(context_->impl_->Allocate(size_class, out));
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    TrackAllocation(nbytes);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* data, int64_t nbytes, const std::shared_ptr<CudaStream>& stream) {
+    if (data == nullptr) {
+      return;
+    }
+    const int64_t size_class = PoolSizeClass(nbytes);
+    CachedBlock block{data, stream, nullptr};
+    // The memory may only be reused off the stream once the work queued on
+    // the stream so far is completed
+    const bool cacheable = !stream || stream->RecordEvent(&block.event).ok();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_allocated_ -= nbytes;
+      if (cacheable && bytes_cached_ + size_class <= max_cached_bytes_) {
+        cached_[size_class].push_back(std::move(block));
+        bytes_cached_ += size_class;
+        return;
+      }
+    }
+    DCHECK_OK(context_->impl_->Free(data, size_class));
+  }
+
+  // Stop tracking a buffer whose memory is no longer owned by the pool
+  void Forget(int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bytes_allocated_ -= nbytes;
+  }
+
+  Status SetMaxCachedBytes(int64_t max_cached_bytes) {
+    bool release;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      max_cached_bytes_ = max_cached_bytes;
+      release = bytes_cached_ > max_cached_bytes_;
+    }
+    return release ? ReleaseCached() : Status::OK();
+  }
+
+  Status ReleaseCached() {
+    std::map<int64_t, std::vector<CachedBlock>> released;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      released.swap(cached_);
+      bytes_cached_ = 0;
+    }
+    Status status;
+    for (const auto& size_class_blocks : released) {
+      for (const auto& block : size_class_blocks.second) {
+        const Status st = context_->impl_->Free(block.data, size_class_blocks.first);
+        if (status.ok()) {
+          status = st;
+        }
+      }
+    }
+    return status;
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_allocated_;
+  }
+
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_memory_;
+  }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_cached_;
+  }
+
+ private:
+  struct CachedBlock {
+    uint8_t* data;
+    // The stream the memory was last used on, if any
+    std::shared_ptr<CudaStream> stream;
+    // Completed once the work on the stream is
+    std::shared_ptr<CudaEvent> event;
+  };
+
+  static bool IsReusable(const CachedBlock& block,
+                         const std::shared_ptr<CudaStream>& stream) {
+    if (!block.event || (stream && stream->handle() == block.stream->handle())) {
+      return true;
+    }
+    bool completed = false;
+    return block.event->Query(&completed).ok() && completed;
+  }
+
+  // Must be called with the lock held
+  bool TakeCached(int64_t size_class, const std::shared_ptr<CudaStream>& stream,
+                  uint8_t** out) {
+    auto it = cached_.find(size_class);
+    if (it == cached_.end()) {
+      return false;
+    }
+    auto& blocks = it->second;
+    // The most recently freed memory first
+    for (auto block = blocks.rbegin(); block != blocks.rend(); ++block) {
+      if (IsReusable(*block, stream)) {
+        *out = block->data;
+        blocks.erase(std::next(block).base());
+        bytes_cached_ -= size_class;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Must be called with the lock held
+  void TrackAllocation(int64_t nbytes) {
+    bytes_allocated_ += nbytes;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+  }
+
+  CudaContext* context_;
+
+  mutable std::mutex mutex_;
+  int64_t max_cached_bytes_;
+  // Cached memory, by size class
+  std::map<int64_t, std::vector<CachedBlock>> cached_;
+  int64_t bytes_allocated_;
+  int64_t max_memory_;
+  int64_t bytes_cached_;
+};
+
+CudaMemoryPool::CudaMemoryPool(CudaContext* context)
+    : impl_(new CudaMemoryPoolImpl(context)) {}
+
+CudaMemoryPool::~CudaMemoryPool() {}
+
+Status CudaMemoryPool::Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out) {
+  return Allocate(nbytes, nullptr, out);
+}
+
+Status CudaMemoryPool::Allocate(int64_t nbytes, const std::shared_ptr<CudaStream>& stream,
+                                std::shared_ptr<CudaBuffer>* out) {
+  CudaContext* context = impl_->context();
+  if (stream && stream->context()->handle() != context->handle()) {
+    return Status::Invalid("Stream belongs to another CUDA context than the pool");
+  }
+  uint8_t* data = nullptr;
+  RETURN_NOT_OK(impl_->Allocate(nbytes, stream, &data));
+  *out = std::make_shared<CudaMemoryPoolImpl::PoolBuffer>(
+      data, nbytes, context->shared_from_this(), impl_.get(), stream);
+  return Status::OK();
+}
+
+int64_t CudaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CudaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t CudaMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+Status CudaMemoryPool::SetMaxCachedBytes(int64_t max_cached_bytes) {
+  return impl_->SetMaxCachedBytes(max_cached_bytes);
+}
+
+Status CudaMemoryPool::ReleaseCached() { return impl_->ReleaseCached(); }
+
+// ----------------------------------------------------------------------
+// CudaEvent and CudaStream
+
+CudaEvent::CudaEvent(const std::shared_ptr<CudaContext>& context, void* handle)
+    : context_(context), handle_(handle) {}
+
+CudaEvent::~CudaEvent() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CUresult ret = cuEventDestroy(reinterpret_cast<CUevent>(handle_));
+  DCHECK_EQ(CUDA_SUCCESS, ret);
+  ARROW_UNUSED(ret);
+}
+
+Status CudaEvent::Wait() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CU_RETURN_NOT_OK(cuEventSynchronize(reinterpret_cast<CUevent>(handle_)));
+  return Status::OK();
+}
+
+Status CudaEvent::Query(bool* completed) const {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CUresult ret = cuEventQuery(reinterpret_cast<CUevent>(handle_));
+  *completed = ret == CUDA_SUCCESS;
+  if (ret != CUDA_ERROR_NOT_READY) {
+    CU_RETURN_NOT_OK(ret);
+  }
+  return Status::OK();
+}
+
+CudaStream::CudaStream(const std::shared_ptr<CudaContext>& context, void* handle)
+    : context_(context), handle_(handle) {}
+
+CudaStream::~CudaStream() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CUresult ret = cuStreamDestroy(reinterpret_cast<CUstream>(handle_));
+  DCHECK_EQ(CUDA_SUCCESS, ret);
+  ARROW_UNUSED(ret);
+}
+
+Status CudaStream::Synchronize() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CU_RETURN_NOT_OK(cuStreamSynchronize(reinterpret_cast<CUstream>(handle_)));
+  return Status::OK();
+}
+
+Status CudaStream::RecordEvent(std::shared_ptr<CudaEvent>* out) {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CUevent event;
+  // Timing is not needed, and makes waiting for events slower
+  CU_RETURN_NOT_OK(cuEventCreate(&event, CU_EVENT_DISABLE_TIMING));
+  std::shared_ptr<CudaEvent> result(new CudaEvent(context_, event));
+  CU_RETURN_NOT_OK(cuEventRecord(event, reinterpret_cast<CUstream>(handle_)));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status CudaStream::WaitEvent(const CudaEvent& event) {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CU_RETURN_NOT_OK(cuStreamWaitEvent(reinterpret_cast<CUstream>(handle_),
+                                     reinterpret_cast<CUevent>(event.handle()), 0));
+  return Status::OK();
+}
+
 }  // namespace cuda
 }  // namespace arrow
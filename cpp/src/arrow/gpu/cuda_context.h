@@ -31,6 +31,8 @@ namespace cuda {
 
 // Forward declaration
 class CudaContext;
+class CudaMemoryPool;
+class CudaStream;
 
 class ARROW_EXPORT CudaDeviceManager {
  public:
@@ -83,8 +85,15 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \param[in] nbytes number of bytes
   /// \param[out] out the allocated buffer
   /// \return Status
+  ///
+  /// \note Each call goes to the driver allocator, which is slow and
+  /// synchronizes the device.  Prefer memory_pool() for many or short-lived
+  /// buffers.
   Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out);
 
+  /// \brief The caching allocator of device memory of this context
+  CudaMemoryPool* memory_pool();
+
   /// \brief Create a view of CUDA memory on GPU device of this context
   /// \param[in] data the starting device address
   /// \param[in] nbytes number of bytes
@@ -108,6 +117,11 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \return Status
   Status CloseIpcBuffer(CudaBuffer* buffer);
 
+  /// \brief Create a stream to queue asynchronous work on the device
+  /// \param[out] out the new stream
+  /// \return Status
+  Status CreateStream(std::shared_ptr<CudaStream>* out);
+
   /// \brief Block until the all device tasks are completed.
   Status Synchronize(void);
 
@@ -146,14 +160,20 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
                          std::shared_ptr<CudaIpcMemHandle>* handle);
   Status CopyHostToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               CudaStream* stream);
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               CudaStream* stream);
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx, void* dst,
                                    const void* src, int64_t nbytes);
 
   class CudaContextImpl;
   std::unique_ptr<CudaContextImpl> impl_;
+  std::unique_ptr<CudaMemoryPool> memory_pool_;
 
   friend CudaBuffer;
+  friend CudaMemoryPool;
   friend CudaBufferReader;
   friend CudaBufferWriter;
   /// \cond FALSE
@@ -162,6 +182,128 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \endcond
 };
 
+/// \class CudaMemoryPool
+/// \brief A caching allocator of device memory for a CudaContext
+///
+/// Allocations are rounded up to a size class: a power of two of at least
+/// 512 bytes up to 1MB, and a multiple of 1MB beyond.  Buffers return their
+/// memory to the pool when destroyed, where it is cached by size class for
+/// later allocations, holding at most max_cached_bytes.
+///
+/// Memory of a buffer allocated for a stream may still be used by work
+/// queued on the stream when the buffer is destroyed.  It is reused at once
+/// for allocations on the same stream, which are ordered after that work,
+/// and for others once the work is completed.
+class ARROW_EXPORT CudaMemoryPool {
+ public:
+  static constexpr int64_t kDefaultMaxCachedBytes = 1LL << 30;
+
+  ~CudaMemoryPool();
+
+  /// \brief Allocate device memory, reusing cached memory if possible
+  /// \param[in] nbytes number of bytes
+  /// \param[out] out the allocated buffer
+  /// \return Status
+  Status Allocate(int64_t nbytes, std::shared_ptr<CudaBuffer>* out);
+
+  /// \brief Allocate device memory for use on a stream, reusing cached
+  /// memory if possible
+  /// \param[in] nbytes number of bytes
+  /// \param[in] stream the stream the buffer is used on
+  /// \param[out] out the allocated buffer
+  /// \return Status
+  Status Allocate(int64_t nbytes, const std::shared_ptr<CudaStream>& stream,
+                  std::shared_ptr<CudaBuffer>* out);
+
+  /// \brief The number of bytes of the live buffers of the pool
+  int64_t bytes_allocated() const;
+
+  /// \brief The peak of bytes_allocated()
+  int64_t max_memory() const;
+
+  /// \brief The number of bytes of device memory cached for reuse
+  int64_t bytes_cached() const;
+
+  /// \brief Set the maximum number of bytes to cache, releasing the cached
+  /// memory if it is above
+  Status SetMaxCachedBytes(int64_t max_cached_bytes);
+
+  /// \brief Return the cached memory to the driver
+  Status ReleaseCached();
+
+ private:
+  explicit CudaMemoryPool(CudaContext* context);
+
+  class CudaMemoryPoolImpl;
+  std::unique_ptr<CudaMemoryPoolImpl> impl_;
+
+  friend CudaContext;
+};
+
+/// \class CudaEvent
+/// \brief A marker in a CudaStream, completed once the work queued on the
+/// stream before it is
+class ARROW_EXPORT CudaEvent {
+ public:
+  ~CudaEvent();
+
+  /// \brief Block until the event is completed
+  Status Wait();
+
+  /// \brief Check whether the event is completed, without blocking
+  /// \param[out] completed whether the event is completed
+  /// \return Status
+  Status Query(bool* completed) const;
+
+  /// \brief Expose the CUevent handle to other libraries
+  void* handle() const { return handle_; }
+
+ private:
+  CudaEvent(const std::shared_ptr<CudaContext>& context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  void* handle_;
+
+  friend CudaStream;
+};
+
+/// \class CudaStream
+/// \brief A queue of asynchronous work on the device of a CudaContext
+///
+/// Work on a stream is executed in order, while work on different streams,
+/// such as copies in opposite directions or copies and kernels, may overlap.
+class ARROW_EXPORT CudaStream {
+ public:
+  ~CudaStream();
+
+  /// \brief Block until all the work queued on the stream is completed
+  Status Synchronize();
+
+  /// \brief Record an event completed once the work queued so far is
+  /// \param[out] out the recorded event
+  /// \return Status
+  Status RecordEvent(std::shared_ptr<CudaEvent>* out);
+
+  /// \brief Make the work queued from now on wait for an event, possibly
+  /// recorded on another stream
+  /// \param[in] event the event to wait for
+  /// \return Status
+  Status WaitEvent(const CudaEvent& event);
+
+  std::shared_ptr<CudaContext> context() const { return context_; }
+
+  /// \brief Expose the CUstream handle to other libraries
+  void* handle() const { return handle_; }
+
+ private:
+  CudaStream(const std::shared_ptr<CudaContext>& context, void* handle);
+
+  std::shared_ptr<CudaContext> context_;
+  void* handle_;
+
+  friend CudaContext;
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
@@ -20,15 +20,19 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include <cuda.h>
 
 #include "arrow/buffer.h"
 #include "arrow/io/memory.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
 
 #include "arrow/gpu/cuda_common.h"
 #include "arrow/gpu/cuda_context.h"
@@ -159,6 +163,37 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+// Async copies must be queued on a stream of the buffer's context
+static Status CheckStreamContext(const CudaContext& context, const CudaStream& stream) {
+  if (stream.context()->handle() != context.handle()) {
+    return Status::Invalid("Stream belongs to another CUDA context than the buffer");
+  }
+  return Status::OK();
+}
+
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, CudaStream* stream,
+                                   std::shared_ptr<CudaEvent>* event) const {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  RETURN_NOT_OK(CheckStreamContext(*context_, *stream));
+  RETURN_NOT_OK(context_->CopyDeviceToHostAsync(out, data_ + position, nbytes, stream));
+  return stream->RecordEvent(event);
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, CudaStream* stream,
+                                     std::shared_ptr<CudaEvent>* event) {
+  if (nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  RETURN_NOT_OK(CheckStreamContext(*context_, *stream));
+  RETURN_NOT_OK(
+      context_->CopyHostToDeviceAsync(mutable_data_ + position, data, nbytes, stream));
+  return stream->RecordEvent(event);
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   if (nbytes > size_ - position) {
@@ -192,6 +227,204 @@ CudaHostBuffer::~CudaHostBuffer() {
   ARROW_CHECK_OK(manager->FreeHost(mutable_data_, size_));
 }
 
+// ----------------------------------------------------------------------
+// CudaHostMemoryPool
+
+namespace {
+
+// Returned for zero-sized allocations, like the default memory pools do
+alignas(64) uint8_t zero_size_area[1];
+
+// The smallest size class, being a page
+constexpr int kMinSizeClass = 12;
+
+}  // namespace
+
+constexpr int64_t CudaHostMemoryPool::kDefaultMaxCachedBytes;
+
+class CudaHostMemoryPool::CudaHostMemoryPoolImpl {
+ public:
+  CudaHostMemoryPoolImpl(const std::shared_ptr<CudaContext>& context,
+                         int64_t max_cached_bytes)
+      : context_(context),
+        max_cached_bytes_(max_cached_bytes),
+        free_lists_(64),
+        bytes_allocated_(0),
+        max_memory_(0),
+        bytes_cached_(0) {}
+
+  ~CudaHostMemoryPoolImpl() { DCHECK_OK(ReleaseCached()); }
+
+  // Allocations are rounded up to 2 ** size class bytes
+  static int SizeClass(int64_t size) {
+    return std::max(kMinSizeClass, BitUtil::Log2(static_cast<uint64_t>(size)));
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    const int size_class = SizeClass(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& free_list = free_lists_[size_class];
+      if (!free_list.empty()) {
+        *out = free_list.back();
+        free_list.pop_back();
+        bytes_cached_ -= int64_t(1) << size_class;
+        TrackAllocation(size);
+        return Status::OK();
+      }
+    }
+    // Pin outside of the lock, as it is slow
+    ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+    void* data = nullptr;
+    CU_RETURN_NOT_OK(cuMemHostAlloc(&data, static_cast<size_t>(1) << size_class,
+                                    CU_MEMHOSTALLOC_PORTABLE));
+    *out = reinterpret_cast<uint8_t*>(data);
+    std::lock_guard<std::mutex> lock(mutex_);
+    TrackAllocation(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (old_size > 0 && new_size > 0 && SizeClass(old_size) == SizeClass(new_size)) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_allocated_ -= old_size;
+      TrackAllocation(new_size);
+      return Status::OK();
+    }
+    uint8_t* data = nullptr;
+    RETURN_NOT_OK(Allocate(new_size, &data));
+    std::memcpy(data, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = data;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (buffer == zero_size_area) {
+      return;
+    }
+    const int size_class = SizeClass(size);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_allocated_ -= size;
+      const int64_t class_size = int64_t(1) << size_class;
+      if (bytes_cached_ + class_size <= max_cached_bytes_) {
+        free_lists_[size_class].push_back(buffer);
+        bytes_cached_ += class_size;
+        return;
+      }
+    }
+    ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+    CUresult ret = cuMemFreeHost(buffer);
+    DCHECK_EQ(CUDA_SUCCESS, ret);
+    ARROW_UNUSED(ret);
+  }
+
+  Status ReleaseCached() {
+    std::vector<uint8_t*> released;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto& free_list : free_lists_) {
+        released.insert(released.end(), free_list.begin(), free_list.end());
+        free_list.clear();
+      }
+      bytes_cached_ = 0;
+    }
+    ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+    for (uint8_t* data : released) {
+      CU_RETURN_NOT_OK(cuMemFreeHost(data));
+    }
+    return Status::OK();
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_allocated_;
+  }
+
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_memory_;
+  }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_cached_;
+  }
+
+ private:
+  // Must be called with the lock held
+  void TrackAllocation(int64_t size) {
+    bytes_allocated_ += size;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+  }
+
+  std::shared_ptr<CudaContext> context_;
+  const int64_t max_cached_bytes_;
+
+  mutable std::mutex mutex_;
+  // Freed allocations, by size class
+  std::vector<std::vector<uint8_t*>> free_lists_;
+  int64_t bytes_allocated_;
+  int64_t max_memory_;
+  int64_t bytes_cached_;
+};
+
+CudaHostMemoryPool::CudaHostMemoryPool() {}
+
+CudaHostMemoryPool::~CudaHostMemoryPool() {}
+
+Status CudaHostMemoryPool::Make(int device_number, int64_t max_cached_bytes,
+                                std::shared_ptr<CudaHostMemoryPool>* out) {
+  CudaDeviceManager* manager = nullptr;
+  RETURN_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  if (device_number < 0 || device_number >= manager->num_devices()) {
+    return Status::Invalid("Invalid CUDA device number ", device_number);
+  }
+  std::shared_ptr<CudaContext> context;
+  RETURN_NOT_OK(manager->GetContext(device_number, &context));
+  std::shared_ptr<CudaHostMemoryPool> pool(new CudaHostMemoryPool());
+  pool->impl_.reset(new CudaHostMemoryPoolImpl(context, max_cached_bytes));
+  *out = std::move(pool);
+  return Status::OK();
+}
+
+Status CudaHostMemoryPool::Make(int device_number,
+                                std::shared_ptr<CudaHostMemoryPool>* out) {
+  return Make(device_number, kDefaultMaxCachedBytes, out);
+}
+
+Status CudaHostMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status CudaHostMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void CudaHostMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t CudaHostMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CudaHostMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t CudaHostMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+Status CudaHostMemoryPool::ReleaseCached() { return impl_->ReleaseCached(); }
+
 // ----------------------------------------------------------------------
 // CudaBufferReader
 
@@ -30,7 +30,9 @@ namespace arrow {
 namespace cuda {
 
 class CudaContext;
+class CudaEvent;
 class CudaIpcMemHandle;
+class CudaStream;
 
 /// \class CudaBuffer
 /// \brief An Arrow buffer located on a GPU device
@@ -70,6 +72,33 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Queue a copy of memory from GPU device to CPU host on a stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the stream to queue the copy on
+  /// \param[out] event completed once the copy is
+  /// \return Status
+  ///
+  /// \note The copy is only asynchronous if the host memory is pinned, such
+  /// as memory from a CudaHostMemoryPool or a CudaHostBuffer.
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         CudaStream* stream, std::shared_ptr<CudaEvent>* event) const;
+
+  /// \brief Queue a copy of memory to device at position on a stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy, which must be left unchanged
+  /// until the copy is completed
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the stream to queue the copy on
+  /// \param[out] event completed once the copy is
+  /// \return Status
+  ///
+  /// \note The copy is only asynchronous if the host memory is pinned, such
+  /// as memory from a CudaHostMemoryPool or a CudaHostBuffer.
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           CudaStream* stream, std::shared_ptr<CudaEvent>* event);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -115,6 +144,54 @@ class ARROW_EXPORT CudaHostBuffer : public MutableBuffer {
   ~CudaHostBuffer();
 };
 
+/// \class CudaHostMemoryPool
+/// \brief A MemoryPool of pinned (page-locked) CPU memory, for staging
+/// asynchronous copies to and from GPU devices
+///
+/// Pinning memory is much more expensive than allocating it, so freed
+/// allocations are cached for reuse rather than returned to the driver.
+/// Allocations are rounded up to a power of two of at least 4KB and the
+/// cache keeps free lists by size, holding at most max_cached_bytes.
+class ARROW_EXPORT CudaHostMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMaxCachedBytes = 1LL << 30;
+
+  /// \brief Create a pool of memory pinned for a GPU device
+  /// \param[in] device_number device to expose host memory
+  /// \param[in] max_cached_bytes the maximum number of freed bytes to keep
+  /// \param[out] out the new pool
+  /// \return Status
+  static Status Make(int device_number, int64_t max_cached_bytes,
+                     std::shared_ptr<CudaHostMemoryPool>* out);
+
+  /// \brief Create a pool of memory pinned for a GPU device, with the
+  /// default limit of cached bytes
+  static Status Make(int device_number, std::shared_ptr<CudaHostMemoryPool>* out);
+
+  ~CudaHostMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The number of freed bytes kept pinned for reuse
+  int64_t bytes_cached() const;
+
+  /// \brief Return the cached memory to the driver
+  Status ReleaseCached();
+
+ private:
+  CudaHostMemoryPool();
+
+  class CudaHostMemoryPoolImpl;
+  std::unique_ptr<CudaHostMemoryPoolImpl> impl_;
+};
+
 /// \class CudaIpcHandle
 /// \brief A container for a CUDA IPC handle
 class ARROW_EXPORT CudaIpcMemHandle {
@@ -21,11 +21,19 @@
 
 #include "gtest/gtest.h"
 
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/kernels/sum.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/test_common.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 
 #include "arrow/gpu/cuda_api.h"
@@ -68,6 +76,14 @@ void AssertCudaBufferEquals(const CudaBuffer& buffer, const uint8_t* host_data,
   ASSERT_EQ(0, std::memcmp(result->data(), host_data, nbytes));
 }
 
+// Round-trip random bytes through a device buffer
+void AssertCudaBufferCopies(CudaBuffer* buffer) {
+  std::shared_ptr<ResizableBuffer> host_buffer;
+  ASSERT_OK(MakeRandomByteBuffer(buffer->size(), default_memory_pool(), &host_buffer));
+  ASSERT_OK(buffer->CopyFromHost(0, host_buffer->data(), buffer->size()));
+  AssertCudaBufferEquals(*buffer, host_buffer->data(), buffer->size());
+}
+
 TEST_F(TestCudaBuffer, CopyFromHost) {
   const int64_t kSize = 1000;
   std::shared_ptr<CudaBuffer> device_buffer;
@@ -125,6 +141,58 @@ TEST_F(TestCudaBuffer, FromBuffer) {
   AssertCudaBufferEquals(*result, host_buffer->data() + 11, kSize - 20);
 }
 
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+
+  std::shared_ptr<CudaHostBuffer> host_buffer, result;
+  ASSERT_OK(AllocateCudaHostBuffer(kGpuNumber, kSize, &host_buffer));
+  ASSERT_OK(AllocateCudaHostBuffer(kGpuNumber, kSize, &result));
+  random_bytes(kSize, 0, host_buffer->mutable_data());
+
+  std::shared_ptr<CudaStream> stream;
+  ASSERT_OK(context_->CreateStream(&stream));
+  std::shared_ptr<CudaEvent> event;
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, host_buffer->data(), 500, stream.get(),
+                                             &event));
+  ASSERT_OK(device_buffer->CopyFromHostAsync(500, host_buffer->data() + 500,
+                                             kSize - 500, stream.get(), &event));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, result->mutable_data(),
+                                           stream.get(), &event));
+  ASSERT_OK(event->Wait());
+  bool completed = false;
+  ASSERT_OK(event->Query(&completed));
+  ASSERT_TRUE(completed);
+  ASSERT_EQ(0, std::memcmp(result->data(), host_buffer->data(), kSize));
+
+  ASSERT_RAISES(Invalid, device_buffer->CopyFromHostAsync(1, host_buffer->data(), kSize,
+                                                          stream.get(), &event));
+}
+
+TEST_F(TestCudaBuffer, StreamEvents) {
+  const int64_t kSize = 1 << 20;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+  std::shared_ptr<CudaHostBuffer> host_buffer, result;
+  ASSERT_OK(AllocateCudaHostBuffer(kGpuNumber, kSize, &host_buffer));
+  ASSERT_OK(AllocateCudaHostBuffer(kGpuNumber, kSize, &result));
+  random_bytes(kSize, 1, host_buffer->mutable_data());
+
+  // The copy back on the second stream waits for the upload on the first
+  std::shared_ptr<CudaStream> upload_stream, download_stream;
+  ASSERT_OK(context_->CreateStream(&upload_stream));
+  ASSERT_OK(context_->CreateStream(&download_stream));
+  std::shared_ptr<CudaEvent> uploaded, downloaded;
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, host_buffer->data(), kSize,
+                                             upload_stream.get(), &uploaded));
+  ASSERT_OK(download_stream->WaitEvent(*uploaded));
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, result->mutable_data(),
+                                           download_stream.get(), &downloaded));
+  ASSERT_OK(download_stream->Synchronize());
+  ASSERT_EQ(0, std::memcmp(result->data(), host_buffer->data(), kSize));
+}
+
 // IPC only supported on Linux
 #if defined(__linux)
 
@@ -346,6 +414,324 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+TEST_F(TestCudaArrowIpc, CopyRecordBatch) {
+  std::shared_ptr<CudaHostMemoryPool> staging_pool;
+  ASSERT_OK(CudaHostMemoryPool::Make(kGpuNumber, &staging_pool));
+
+  using MakeBatch = Status (*)(std::shared_ptr<RecordBatch>*);
+  for (MakeBatch make_batch :
+       {&ipc::test::MakeIntRecordBatch, &ipc::test::MakeStringTypesRecordBatchWithNulls,
+        &ipc::test::MakeListRecordBatch, &ipc::test::MakeDictionary}) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(make_batch(&batch));
+
+    std::shared_ptr<RecordBatch> device_batch;
+    ASSERT_OK(CopyRecordBatchToDevice(*batch, context_.get(), staging_pool.get(),
+                                      &device_batch));
+    std::shared_ptr<CudaBuffer> device_buffer;
+    ASSERT_OK(CudaBuffer::FromBuffer(device_batch->column_data(0)->buffers[1],
+                                     &device_buffer));
+
+    // Copy back to pageable and to pinned memory
+    std::shared_ptr<RecordBatch> cpu_batch;
+    ASSERT_OK(CopyRecordBatchToHost(*device_batch, context_.get(), pool_, &cpu_batch));
+    CompareBatch(*batch, *cpu_batch);
+    ASSERT_OK(CopyRecordBatchToHost(*device_batch, context_.get(), staging_pool.get(),
+                                    &cpu_batch));
+    CompareBatch(*batch, *cpu_batch);
+  }
+}
+
+class TestCudaHostMemoryPool : public TestCudaBufferBase {
+ public:
+  void SetUp() { TestCudaBufferBase::SetUp(); }
+};
+
+TEST_F(TestCudaHostMemoryPool, Basics) {
+  std::shared_ptr<CudaHostMemoryPool> pool;
+  ASSERT_OK(CudaHostMemoryPool::Make(kGpuNumber, 1 << 16, &pool));
+
+  uint8_t* data = nullptr;
+  ASSERT_OK(pool->Allocate(5000, &data));
+  ASSERT_EQ(5000, pool->bytes_allocated());
+  // The memory is pinned
+  uint8_t* devptr = nullptr;
+  ASSERT_OK(context_->GetDeviceAddress(data, &devptr));
+
+  // Freed memory is reused for allocations of the same size class
+  pool->Free(data, 5000);
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(8192, pool->bytes_cached());
+  uint8_t* reused = nullptr;
+  ASSERT_OK(pool->Allocate(8000, &reused));
+  ASSERT_EQ(data, reused);
+  ASSERT_EQ(0, pool->bytes_cached());
+
+  // Growing within the size class keeps the allocation
+  ASSERT_OK(pool->Reallocate(8000, 8192, &reused));
+  ASSERT_EQ(data, reused);
+  ASSERT_OK(pool->Reallocate(8192, 100000, &reused));
+  ASSERT_EQ(100000, pool->bytes_allocated());
+  ASSERT_EQ(8192, pool->bytes_cached());
+  ASSERT_EQ(100000, pool->max_memory());
+
+  // Beyond the cache limit, memory is returned to the driver
+  pool->Free(reused, 100000);
+  ASSERT_EQ(8192, pool->bytes_cached());
+  ASSERT_OK(pool->ReleaseCached());
+  ASSERT_EQ(0, pool->bytes_cached());
+
+  ASSERT_OK(pool->Allocate(0, &data));
+  pool->Free(data, 0);
+  ASSERT_RAISES(Invalid, CudaHostMemoryPool::Make(-1, &pool));
+}
+
+class TestCudaMemoryPool : public TestCudaBufferBase {
+ public:
+  void SetUp() { TestCudaBufferBase::SetUp(); }
+};
+
+TEST_F(TestCudaMemoryPool, Basics) {
+  CudaMemoryPool* pool = context_->memory_pool();
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(pool->Allocate(1000, &buffer));
+  ASSERT_EQ(1000, buffer->size());
+  ASSERT_EQ(1000, pool->bytes_allocated());
+  // Rounded up to the size class
+  ASSERT_EQ(1024, context_->bytes_allocated());
+  AssertCudaBufferCopies(buffer.get());
+
+  // Destroyed buffers return their memory to the pool for reuse
+  const uint8_t* data = buffer->data();
+  buffer.reset();
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_EQ(1024, pool->bytes_cached());
+  ASSERT_OK(pool->Allocate(600, &buffer));
+  ASSERT_EQ(data, buffer->data());
+  ASSERT_EQ(0, pool->bytes_cached());
+  ASSERT_EQ(1024, context_->bytes_allocated());
+
+  std::shared_ptr<CudaBuffer> large;
+  ASSERT_OK(pool->Allocate((1 << 20) + 1, &large));
+  ASSERT_EQ(1024 + (2 << 20), context_->bytes_allocated());
+  ASSERT_EQ(600 + (1 << 20) + 1, pool->max_memory());
+
+  // Beyond the cache limit, memory is returned to the driver
+  ASSERT_OK(pool->SetMaxCachedBytes(1 << 20));
+  large.reset();
+  buffer.reset();
+  ASSERT_EQ(1024, pool->bytes_cached());
+  ASSERT_EQ(1024, context_->bytes_allocated());
+  ASSERT_OK(pool->ReleaseCached());
+  ASSERT_EQ(0, pool->bytes_cached());
+  ASSERT_EQ(0, context_->bytes_allocated());
+
+  ASSERT_OK(pool->Allocate(0, &buffer));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestCudaMemoryPool, Streams) {
+  CudaMemoryPool* pool = context_->memory_pool();
+  std::shared_ptr<CudaStream> stream, other_stream;
+  ASSERT_OK(context_->CreateStream(&stream));
+  ASSERT_OK(context_->CreateStream(&other_stream));
+
+  const int64_t kSize = 1 << 20;
+  std::shared_ptr<CudaHostBuffer> host_buffer;
+  ASSERT_OK(AllocateCudaHostBuffer(kGpuNumber, kSize, &host_buffer));
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(pool->Allocate(kSize, stream, &buffer));
+  std::shared_ptr<CudaEvent> event;
+  ASSERT_OK(buffer->CopyToHostAsync(0, kSize, host_buffer->mutable_data(), stream.get(),
+                                    &event));
+  const uint8_t* data = buffer->data();
+  buffer.reset();
+
+  // The same stream reuses the memory at once, being ordered after the copy
+  ASSERT_OK(pool->Allocate(kSize, stream, &buffer));
+  ASSERT_EQ(data, buffer->data());
+  buffer.reset();
+
+  // Other streams reuse it once the copy is completed
+  ASSERT_OK(stream->Synchronize());
+  ASSERT_OK(pool->Allocate(kSize, other_stream, &buffer));
+  ASSERT_EQ(data, buffer->data());
+}
+
+class TestCudaCompute : public TestCudaBufferBase {
+ public:
+  void SetUp() {
+    TestCudaBufferBase::SetUp();
+    ASSERT_OK(CudaHostMemoryPool::Make(kGpuNumber, &staging_pool_));
+  }
+
+ protected:
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<Array>& values) {
+    auto batch = RecordBatch::Make(schema({field("f", values->type())}),
+                                   values->length(), {values});
+    std::shared_ptr<RecordBatch> device_batch;
+    ABORT_NOT_OK(CopyRecordBatchToDevice(*batch, context_.get(), staging_pool_.get(),
+                                         &device_batch));
+    return device_batch->column(0);
+  }
+
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<DataType>& type,
+                                  const std::string& json) {
+    return ToDevice(ArrayFromJSON(type, json));
+  }
+
+  void AssertDeviceArraysEqual(const Array& expected,
+                               const std::shared_ptr<Array>& device_values) {
+    auto batch = RecordBatch::Make(schema({field("f", device_values->type())}),
+                                   device_values->length(), {device_values});
+    std::shared_ptr<RecordBatch> cpu_batch;
+    ASSERT_OK(CopyRecordBatchToHost(*batch, context_.get(), default_memory_pool(),
+                                    &cpu_batch));
+    ASSERT_OK(cpu_batch->column(0)->Validate());
+    AssertArraysEqual(expected, *cpu_batch->column(0));
+  }
+
+  void AssertDeviceArraysEqual(const std::string& expected_json,
+                               const std::shared_ptr<Array>& device_values) {
+    AssertDeviceArraysEqual(*ArrayFromJSON(device_values->type(), expected_json),
+                            device_values);
+  }
+
+  std::shared_ptr<CudaHostMemoryPool> staging_pool_;
+};
+
+TEST_F(TestCudaCompute, CompareScalar) {
+  using compute::CompareOperator;
+  using compute::CompareOptions;
+
+  auto values = ToDevice(int32(), "[1, 5, null, 3, 7, -2]");
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Compare(*values, Int32Scalar(3), CompareOptions(CompareOperator::GREATER),
+                    &out));
+  AssertDeviceArraysEqual("[false, true, null, false, true, false]", out);
+  ASSERT_EQ(1, out->null_count());
+  ASSERT_OK(
+      Compare(*values, Int32Scalar(3), CompareOptions(CompareOperator::EQUAL), &out));
+  AssertDeviceArraysEqual("[false, false, null, true, false, false]", out);
+  ASSERT_OK(Compare(*values->Slice(1, 4), Int32Scalar(5),
+                    CompareOptions(CompareOperator::LESS_EQUAL), &out));
+  AssertDeviceArraysEqual("[true, null, true, false]", out);
+
+  ASSERT_OK(Compare(*ToDevice(float64(), "[0.5, 1.5, 2.5]"), DoubleScalar(1.5),
+                    CompareOptions(CompareOperator::GREATER_EQUAL), &out));
+  AssertDeviceArraysEqual("[false, true, true]", out);
+
+  ASSERT_RAISES(TypeError, Compare(*values, Int64Scalar(3),
+                                   CompareOptions(CompareOperator::EQUAL), &out));
+  // Host arrays are rejected
+  ASSERT_RAISES(TypeError, Compare(*ArrayFromJSON(int32(), "[1]"), Int32Scalar(3),
+                                   CompareOptions(CompareOperator::EQUAL), &out));
+}
+
+TEST_F(TestCudaCompute, CompareScalarRandom) {
+  compute::FunctionContext ctx;
+  random::RandomArrayGenerator rand(0x5eed);
+  auto values = rand.Int32(100003, -100, 100, 0.1);
+  compute::CompareOptions options(compute::CompareOperator::LESS);
+
+  compute::Datum expected;
+  std::shared_ptr<Scalar> scalar = std::make_shared<Int32Scalar>(10);
+  ASSERT_OK(compute::Compare(&ctx, values, scalar, options, &expected));
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Compare(*ToDevice(values), *scalar, options, &out));
+  AssertDeviceArraysEqual(*expected.make_array(), out);
+}
+
+TEST_F(TestCudaCompute, BooleanOps) {
+  auto left = ToDevice(boolean(), "[true, false, null, true, false]");
+  auto right = ToDevice(boolean(), "[true, true, false, null, false]");
+  std::shared_ptr<Array> out;
+  ASSERT_OK(And(*left, *right, &out));
+  AssertDeviceArraysEqual("[true, false, null, null, false]", out);
+  ASSERT_OK(Or(*left, *right, &out));
+  AssertDeviceArraysEqual("[true, true, null, null, false]", out);
+  ASSERT_OK(Xor(*left, *right, &out));
+  AssertDeviceArraysEqual("[false, true, null, null, false]", out);
+  ASSERT_OK(Invert(*left, &out));
+  AssertDeviceArraysEqual("[false, true, null, false, true]", out);
+  ASSERT_EQ(1, out->null_count());
+
+  // Differently offset inputs
+  ASSERT_OK(And(*left->Slice(2, 3), *right->Slice(1, 3), &out));
+  AssertDeviceArraysEqual("[null, false, null]", out);
+
+  ASSERT_RAISES(Invalid, And(*left, *right->Slice(1), &out));
+  ASSERT_RAISES(TypeError, Invert(*ToDevice(int8(), "[1]"), &out));
+}
+
+TEST_F(TestCudaCompute, Filter) {
+  auto values = ToDevice(int16(), "[1, 2, null, 4, 5, 6]");
+  auto filter = ToDevice(boolean(), "[true, false, true, null, true, false]");
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Filter(*values, *filter, &out));
+  AssertDeviceArraysEqual("[1, null, 5]", out);
+  ASSERT_EQ(1, out->null_count());
+  ASSERT_OK(Filter(*values->Slice(3), *filter->Slice(3), &out));
+  AssertDeviceArraysEqual("[5]", out);
+  ASSERT_EQ(0, out->null_count());
+
+  ASSERT_OK(Filter(*values, *ToDevice(boolean(), "[false, false, false, false, "
+                                                 "false, false]"),
+                   &out));
+  ASSERT_EQ(0, out->length());
+
+  ASSERT_RAISES(Invalid, Filter(*values, *filter->Slice(1), &out));
+  ASSERT_RAISES(NotImplemented, Filter(*ToDevice(utf8(), R"(["a"])"),
+                                       *ToDevice(boolean(), "[true]"), &out));
+}
+
+TEST_F(TestCudaCompute, FilterRandom) {
+  compute::FunctionContext ctx;
+  random::RandomArrayGenerator rand(0x5eed);
+  const int64_t length = 100003;
+  for (const auto& values :
+       {rand.Int32(length, -100, 100, 0.1), rand.Float64(length, 0, 1, 0)}) {
+    auto filter = rand.Boolean(length, 0.3);
+    auto device_values = ToDevice(values);
+    auto device_filter = ToDevice(filter);
+    for (int64_t offset : {0, 3}) {
+      std::shared_ptr<Array> expected, out;
+      ASSERT_OK(compute::Filter(&ctx, *values->Slice(offset), *filter->Slice(offset),
+                                &expected));
+      ASSERT_OK(Filter(*device_values->Slice(offset), *device_filter->Slice(offset),
+                       &out));
+      AssertDeviceArraysEqual(*expected, out);
+    }
+  }
+}
+
+TEST_F(TestCudaCompute, Sum) {
+  std::shared_ptr<Scalar> out;
+  ASSERT_OK(Sum(*ToDevice(int8(), "[1, 2, null, 100, 100]"), &out));
+  ASSERT_TRUE(out->Equals(Int64Scalar(203)));
+  ASSERT_OK(Sum(*ToDevice(uint32(), "[4000000000, 4000000000]"), &out));
+  ASSERT_TRUE(out->Equals(UInt64Scalar(8000000000ULL)));
+  ASSERT_OK(Sum(*ToDevice(float32(), "[0.5, null, 1.25]"), &out));
+  ASSERT_TRUE(out->Equals(DoubleScalar(1.75)));
+
+  ASSERT_OK(Sum(*ToDevice(int32(), "[null, null]"), &out));
+  ASSERT_FALSE(out->is_valid);
+  ASSERT_OK(Sum(*ToDevice(int32(), "[]"), &out));
+  ASSERT_FALSE(out->is_valid);
+  ASSERT_RAISES(NotImplemented, Sum(*ToDevice(boolean(), "[true]"), &out));
+}
+
+TEST_F(TestCudaCompute, SumRandom) {
+  compute::FunctionContext ctx;
+  random::RandomArrayGenerator rand(0x5eed);
+  auto values = rand.Int32(1000003, -1000, 1000, 0.1);
+  compute::Datum expected;
+  ASSERT_OK(compute::Sum(&ctx, values, &expected));
+  std::shared_ptr<Scalar> out;
+  ASSERT_OK(Sum(*ToDevice(values), &out));
+  ASSERT_TRUE(out->Equals(*expected.scalar()));
+}
+
 class TestCudaContext : public TestCudaBufferBase {
  public:
   void SetUp() { TestCudaBufferBase::SetUp(); }
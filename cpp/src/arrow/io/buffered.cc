@@ -22,6 +22,7 @@
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
@@ -135,6 +136,36 @@ class BufferedOutputStream::Impl : public BufferedBase {
     return Status::OK();
   }
 
+  Status WriteV(const std::vector<WriteRegion>& regions) {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t nbytes = 0;
+    for (const auto& region : regions) {
+      if (region.nbytes < 0) {
+        return Status::Invalid("write count should be >= 0");
+      }
+      nbytes += region.nbytes;
+    }
+    if (nbytes + buffer_pos_ < buffer_size_) {
+      for (const auto& region : regions) {
+        AppendToBuffer(region.data, region.nbytes);
+      }
+      return Status::OK();
+    }
+    // Hand the buffered bytes and the regions to the raw stream in one call
+    // rather than copying the regions into the buffer
+    std::vector<WriteRegion> raw_regions;
+    raw_regions.reserve(regions.size() + 1);
+    if (buffer_pos_ > 0) {
+      raw_regions.push_back({buffer_data_, buffer_pos_});
+    }
+    raw_regions.insert(raw_regions.end(), regions.begin(), regions.end());
+    // Invalidate cached raw pos
+    raw_pos_ = -1;
+    RETURN_NOT_OK(raw_->WriteV(raw_regions));
+    buffer_pos_ = 0;
+    return Status::OK();
+  }
+
   Status FlushUnlocked() {
     if (buffer_pos_ > 0) {
       // Invalidate cached raw pos
@@ -215,6 +246,10 @@ Status BufferedOutputStream::Write(const void* data, int64_t nbytes) {
   return impl_->Write(data, nbytes);
 }
 
+Status BufferedOutputStream::WriteV(const std::vector<WriteRegion>& regions) {
+  return impl_->WriteV(regions);
+}
+
 Status BufferedOutputStream::Flush() { return impl_->Flush(); }
 
 std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->raw(); }
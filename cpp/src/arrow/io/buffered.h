@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/string_view.h"
@@ -74,6 +75,10 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Write regions to the stream, passing them on to the raw stream in a
+  // single WriteV() call when they don't fit in the buffer. Thread-safe
+  Status WriteV(const std::vector<WriteRegion>& regions) override;
+
   Status Flush() override;
 
   /// \brief Return the underlying raw output stream.
@@ -228,6 +228,30 @@ TEST_F(TestBufferedOutputStream, LargeWrites) {
   AssertFileContents(path_, data);
 }
 
+TEST_F(TestBufferedOutputStream, WriteV) {
+  OpenBuffered(100);
+
+  const std::string data = GenerateRandomData(1000);
+  // Fits in the buffer
+  ASSERT_OK(buffered_->WriteV({{data.data(), 10}, {data.data() + 10, 20}}));
+  AssertTell(30);
+  AssertFileContents(path_, "");
+
+  // Doesn't fit, written along with the buffered bytes
+  ASSERT_OK(buffered_->WriteV(
+      {{data.data() + 30, 0}, {data.data() + 30, 50}, {data.data() + 80, 500}}));
+  AssertTell(580);
+  AssertFileContents(path_, data.substr(0, 580));
+
+  ASSERT_OK(buffered_->Write(data.data() + 580, 20));
+  ASSERT_OK(buffered_->WriteV({{data.data() + 600, 400}}));
+  AssertTell(1000);
+  ASSERT_RAISES(Invalid, buffered_->WriteV({{data.data(), -1}}));
+  ASSERT_OK(buffered_->Close());
+
+  AssertFileContents(path_, data);
+}
+
 TEST_F(TestBufferedOutputStream, Flush) {
   OpenBuffered();
 
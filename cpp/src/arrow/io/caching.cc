@@ -0,0 +1,187 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/caching.h"
+
+#include <algorithm>
+#include <future>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace io {
+
+constexpr int64_t CacheOptions::kDefaultHoleSizeLimit;
+constexpr int64_t CacheOptions::kDefaultRangeSizeLimit;
+
+CacheOptions CacheOptions::Defaults() { return CacheOptions(); }
+
+namespace internal {
+
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit) {
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                              [](const ReadRange& range) { return range.length <= 0; }),
+               ranges.end());
+  std::sort(ranges.begin(), ranges.end(), [](const ReadRange& a, const ReadRange& b) {
+    return a.offset < b.offset;
+  });
+
+  std::vector<ReadRange> coalesced;
+  for (const auto& range : ranges) {
+    if (!coalesced.empty()) {
+      ReadRange& last = coalesced.back();
+      const int64_t last_end = last.offset + last.length;
+      const int64_t end = range.offset + range.length;
+      const bool overlaps = range.offset < last_end;
+      const bool close_enough = range.offset - last_end <= hole_size_limit &&
+                                end - last.offset <= range_size_limit;
+      if (overlaps || close_enough) {
+        last.length = std::max(last_end, end) - last.offset;
+        continue;
+      }
+    }
+    coalesced.push_back(range);
+  }
+  return coalesced;
+}
+
+namespace {
+
+struct RangeCacheEntry {
+  ReadRange range;
+  std::shared_future<Result<std::shared_ptr<Buffer>>> future;
+};
+
+bool Contains(const ReadRange& outer, const ReadRange& inner) {
+  return inner.offset >= outer.offset &&
+         inner.offset + inner.length <= outer.offset + outer.length;
+}
+
+}  // namespace
+
+struct ReadRangeCache::Impl {
+  std::shared_ptr<RandomAccessFile> file;
+  CacheOptions options;
+  ::arrow::internal::ThreadPool* executor;
+
+  std::mutex mutex;
+  // Sorted by offset.  Entries from different Cache() calls may overlap.
+  std::vector<RangeCacheEntry> entries;
+
+  // Return the entry containing the range, or null.  Requires the mutex.
+  const RangeCacheEntry* Find(const ReadRange& range) const {
+    auto it = std::upper_bound(
+        entries.begin(), entries.end(), range.offset,
+        [](int64_t offset, const RangeCacheEntry& entry) {
+          return offset < entry.range.offset;
+        });
+    while (it != entries.begin()) {
+      --it;
+      if (Contains(it->range, range)) {
+        return &*it;
+      }
+    }
+    return nullptr;
+  }
+};
+
+ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> file,
+                               CacheOptions options,
+                               ::arrow::internal::ThreadPool* executor)
+    : impl_(new Impl()) {
+  impl_->file = std::move(file);
+  impl_->options = options;
+  impl_->executor = executor;
+}
+
+ReadRangeCache::~ReadRangeCache() {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  for (const auto& entry : impl_->entries) {
+    entry.future.wait();
+  }
+}
+
+Status ReadRangeCache::Cache(const std::vector<ReadRange>& ranges) {
+  for (const auto& range : ranges) {
+    if (range.offset < 0 || range.length < 0) {
+      return Status::Invalid("Invalid read range: offset ", range.offset, ", length ",
+                             range.length);
+    }
+  }
+  std::vector<ReadRange> coalesced = CoalesceReadRanges(
+      ranges, impl_->options.hole_size_limit, impl_->options.range_size_limit);
+
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  for (const auto& range : coalesced) {
+    if (impl_->Find(range) != nullptr) {
+      continue;
+    }
+    RangeCacheEntry entry;
+    entry.range = range;
+    std::shared_ptr<RandomAccessFile> file = impl_->file;
+    entry.future = impl_->executor
+                       ->Submit([file, range]() -> Result<std::shared_ptr<Buffer>> {
+                         std::shared_ptr<Buffer> buffer;
+                         RETURN_NOT_OK(file->ReadAt(range.offset, range.length, &buffer));
+                         return buffer;
+                       })
+                       .share();
+    auto it = std::upper_bound(impl_->entries.begin(), impl_->entries.end(), entry,
+                               [](const RangeCacheEntry& a, const RangeCacheEntry& b) {
+                                 return a.range.offset < b.range.offset;
+                               });
+    impl_->entries.insert(it, std::move(entry));
+  }
+  return Status::OK();
+}
+
+Status ReadRangeCache::Read(ReadRange range, std::shared_ptr<Buffer>* out) {
+  std::shared_future<Result<std::shared_ptr<Buffer>>> future;
+  ReadRange cached_range;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    const RangeCacheEntry* entry = impl_->Find(range);
+    if (entry == nullptr) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    future = entry->future;
+    cached_range = entry->range;
+  }
+
+  const Result<std::shared_ptr<Buffer>>& result = future.get();
+  RETURN_NOT_OK(result.status());
+  const std::shared_ptr<Buffer>& buffer = result.ValueOrDie();
+  // The cached buffer may be truncated at the end of the file
+  const int64_t slice_offset = std::min(range.offset - cached_range.offset,
+                                        buffer->size());
+  const int64_t slice_length = std::min(range.length, buffer->size() - slice_offset);
+  *out = SliceBuffer(buffer, slice_offset, slice_length);
+  return Status::OK();
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
+namespace io {
+
+struct ARROW_EXPORT CacheOptions {
+  static constexpr int64_t kDefaultHoleSizeLimit = 8192;
+  static constexpr int64_t kDefaultRangeSizeLimit = 32 * 1024 * 1024;
+
+  /// Ranges separated by at most this many bytes are read with a single
+  /// request, together with the bytes in between
+  int64_t hole_size_limit = kDefaultHoleSizeLimit;
+  /// Ranges are not coalesced past this size.  Overlapping ranges are always
+  /// merged, and larger ranges are read as they are.
+  int64_t range_size_limit = kDefaultRangeSizeLimit;
+
+  static CacheOptions Defaults();
+};
+
+namespace internal {
+
+/// \brief Sort the given ranges and merge the ones which overlap or are
+/// close enough to each other, according to the given limits. Empty ranges
+/// are dropped.
+ARROW_EXPORT
+std::vector<ReadRange> CoalesceReadRanges(std::vector<ReadRange> ranges,
+                                          int64_t hole_size_limit,
+                                          int64_t range_size_limit);
+
+/// \brief EXPERIMENTAL: A cache of file ranges read in the background.
+///
+/// Cache() coalesces the given ranges and issues one ReadAt() call per
+/// coalesced range on the executor.  Read() then serves any range which lies
+/// within a single cached range, waiting for it to arrive if necessary.
+/// Cached data is kept until the cache is destroyed.
+///
+/// This class is thread-safe.  The file must support concurrent ReadAt()
+/// calls and outlive the cache.
+class ARROW_EXPORT ReadRangeCache {
+ public:
+  ReadRangeCache(std::shared_ptr<RandomAccessFile> file, CacheOptions options,
+                 ::arrow::internal::ThreadPool* executor);
+
+  /// Waits for all outstanding reads
+  ~ReadRangeCache();
+
+  /// \brief Start reading the given ranges in the background
+  Status Cache(const std::vector<ReadRange>& ranges);
+
+  /// \brief Read a range from the cache
+  ///
+  /// If the range is not within a single cached range, *out is set to null
+  /// and the caller should read it from the file itself.  The returned
+  /// buffer is shorter than requested if the range extends past the end of
+  /// the file.
+  /// \return the error of the background read, if any
+  Status Read(ReadRange range, std::shared_ptr<Buffer>* out);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace io {
+namespace internal {
+
+// A BufferReader which counts ReadAt() calls and can be made to fail them
+class CountingBufferReader : public BufferReader {
+ public:
+  explicit CountingBufferReader(const std::shared_ptr<Buffer>& buffer)
+      : BufferReader(buffer) {}
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads;
+    if (fail) {
+      return Status::IOError("Read failed");
+    }
+    return BufferReader::ReadAt(position, nbytes, out);
+  }
+
+  std::atomic<int> num_reads{0};
+  std::atomic<bool> fail{false};
+};
+
+void AssertRangesEqual(const std::vector<ReadRange>& expected,
+                       const std::vector<ReadRange>& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i].offset, actual[i].offset) << "range " << i;
+    ASSERT_EQ(expected[i].length, actual[i].length) << "range " << i;
+  }
+}
+
+TEST(CoalesceReadRanges, Basics) {
+  auto check = [](std::vector<ReadRange> ranges, std::vector<ReadRange> expected) {
+    AssertRangesEqual(expected, CoalesceReadRanges(ranges, /*hole_size_limit=*/10,
+                                                   /*range_size_limit=*/100));
+  };
+
+  check({}, {});
+  // Empty ranges are dropped
+  check({{110, 0}, {120, 0}}, {});
+  // Ranges are sorted
+  check({{110, 10}, {0, 10}}, {{0, 10}, {110, 10}});
+  // Small holes are filled
+  check({{0, 10}, {15, 5}, {30, 10}}, {{0, 40}});
+  check({{0, 10}, {21, 5}}, {{0, 10}, {21, 5}});
+  check({{0, 10}, {20, 5}}, {{0, 25}});
+  // Overlapping and adjacent ranges are merged
+  check({{0, 50}, {10, 10}, {50, 10}}, {{0, 60}});
+  // Coalesced ranges don't grow past the size limit...
+  check({{0, 60}, {65, 40}}, {{0, 60}, {65, 40}});
+  check({{0, 60}, {65, 35}}, {{0, 100}});
+  // ...unless the ranges overlap
+  check({{0, 60}, {50, 100}}, {{0, 150}});
+  // Large ranges are kept as they are
+  check({{0, 500}, {1000, 200}}, {{0, 500}, {1000, 200}});
+}
+
+class TestReadRangeCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    std::string data;
+    for (int i = 0; i < 1000; ++i) {
+      data.push_back(static_cast<char>(i % 251));
+    }
+    buffer_ = Buffer::FromString(std::move(data));
+    file_ = std::make_shared<CountingBufferReader>(buffer_);
+    options_.hole_size_limit = 10;
+    options_.range_size_limit = 100;
+  }
+
+  void AssertCached(ReadRangeCache* cache, ReadRange range) {
+    std::shared_ptr<Buffer> out;
+    ASSERT_OK(cache->Read(range, &out));
+    ASSERT_NE(out, nullptr);
+    AssertBufferEqual(*SliceBuffer(buffer_, range.offset, range.length), *out);
+  }
+
+  void AssertNotCached(ReadRangeCache* cache, ReadRange range) {
+    std::shared_ptr<Buffer> out;
+    ASSERT_OK(cache->Read(range, &out));
+    ASSERT_EQ(out, nullptr);
+  }
+
+ protected:
+  std::shared_ptr<Buffer> buffer_;
+  std::shared_ptr<CountingBufferReader> file_;
+  CacheOptions options_;
+};
+
+TEST_F(TestReadRangeCache, Basics) {
+  ReadRangeCache cache(file_, options_, ::arrow::internal::GetIOThreadPool());
+  ASSERT_OK(cache.Cache({{1, 2}, {3, 2}, {8, 2}, {22, 2}, {25, 0}, {500, 50}}));
+  // {1, 9}, {22, 2} and {500, 50}
+  AssertCached(&cache, {1, 2});
+  AssertCached(&cache, {3, 2});
+  AssertCached(&cache, {8, 2});
+  AssertCached(&cache, {22, 2});
+  AssertCached(&cache, {500, 50});
+  AssertCached(&cache, {510, 2});
+  // Hole bytes are available too
+  AssertCached(&cache, {2, 7});
+  AssertCached(&cache, {5, 0});
+  ASSERT_EQ(3, file_->num_reads);
+
+  AssertNotCached(&cache, {0, 2});
+  AssertNotCached(&cache, {8, 3});
+  AssertNotCached(&cache, {21, 3});
+  AssertNotCached(&cache, {300, 10});
+  AssertNotCached(&cache, {549, 2});
+
+  // Ranges already cached are not read again
+  ASSERT_OK(cache.Cache({{2, 4}, {520, 10}}));
+  ASSERT_EQ(3, file_->num_reads);
+  ASSERT_OK(cache.Cache({{2, 4}, {300, 10}}));
+  ASSERT_EQ(4, file_->num_reads);
+  AssertCached(&cache, {300, 10});
+
+  ASSERT_RAISES(Invalid, cache.Cache({{-1, 10}}));
+}
+
+TEST_F(TestReadRangeCache, PastEndOfFile) {
+  ReadRangeCache cache(file_, options_, ::arrow::internal::GetIOThreadPool());
+  ASSERT_OK(cache.Cache({{990, 20}}));
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(cache.Read({995, 10}, &out));
+  AssertBufferEqual(*SliceBuffer(buffer_, 995, 5), *out);
+  ASSERT_OK(cache.Read({1005, 5}, &out));
+  ASSERT_EQ(0, out->size());
+}
+
+TEST_F(TestReadRangeCache, ReadError) {
+  file_->fail = true;
+  ReadRangeCache cache(file_, options_, ::arrow::internal::GetIOThreadPool());
+  ASSERT_OK(cache.Cache({{0, 10}}));
+  std::shared_ptr<Buffer> out;
+  ASSERT_RAISES(IOError, cache.Read({0, 5}, &out));
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
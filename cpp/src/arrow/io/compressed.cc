@@ -19,6 +19,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -26,12 +28,15 @@
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
+using internal::ThreadPool;
 using util::Codec;
 using util::Compressor;
 using util::Decompressor;
@@ -224,6 +229,237 @@ Status CompressedOutputStream::Flush() { return impl_->Flush(); }
 
 std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_->raw(); }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedOutputStream implementation
+
+namespace {
+
+constexpr int64_t kDefaultCompressionBlockSize = 1024 * 1024;
+
+// Compress a block of data as a complete member
+Status CompressMember(MemoryPool* pool, Codec* codec, const Buffer& block,
+                      std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<Compressor> compressor;
+  RETURN_NOT_OK(codec->MakeCompressor(&compressor));
+  std::shared_ptr<ResizableBuffer> compressed;
+  RETURN_NOT_OK(AllocateResizableBuffer(
+      pool, std::max<int64_t>(4096, codec->MaxCompressedLen(block.size(), block.data())),
+      &compressed));
+
+  int64_t input_pos = 0;
+  int64_t compressed_pos = 0;
+  while (input_pos < block.size()) {
+    int64_t bytes_read, bytes_written;
+    RETURN_NOT_OK(compressor->Compress(
+        block.size() - input_pos, block.data() + input_pos,
+        compressed->size() - compressed_pos, compressed->mutable_data() + compressed_pos,
+        &bytes_read, &bytes_written));
+    input_pos += bytes_read;
+    compressed_pos += bytes_written;
+    if (bytes_read == 0) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+    }
+  }
+  while (true) {
+    int64_t bytes_written;
+    bool should_retry;
+    RETURN_NOT_OK(compressor->End(compressed->size() - compressed_pos,
+                                  compressed->mutable_data() + compressed_pos,
+                                  &bytes_written, &should_retry));
+    compressed_pos += bytes_written;
+    if (!should_retry) {
+      break;
+    }
+    RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+  }
+  RETURN_NOT_OK(compressed->Resize(compressed_pos));
+  *out = std::move(compressed);
+  return Status::OK();
+}
+
+}  // namespace
+
+class ParallelCompressedOutputStream::Impl {
+ public:
+  Impl(MemoryPool* pool, Codec* codec, std::shared_ptr<OutputStream> raw,
+       ThreadPool* executor, int64_t block_size)
+      : pool_(pool),
+        codec_(codec),
+        raw_(std::move(raw)),
+        executor_(executor),
+        block_size_(block_size),
+        max_pending_(std::max(1, executor->GetCapacity())) {}
+
+  ~Impl() { ARROW_CHECK_OK(Close()); }
+
+  Status Tell(int64_t* position) const {
+    return Status::NotImplemented("Cannot tell() a compressed stream");
+  }
+
+  std::shared_ptr<OutputStream> raw() const { return raw_; }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      if (!block_) {
+        RETURN_NOT_OK(AllocateResizableBuffer(pool_, block_size_, &block_));
+        block_pos_ = 0;
+      }
+      const int64_t copy_bytes = std::min(nbytes, block_size_ - block_pos_);
+      std::memcpy(block_->mutable_data() + block_pos_, input, copy_bytes);
+      block_pos_ += copy_bytes;
+      input += copy_bytes;
+      nbytes -= copy_bytes;
+      if (block_pos_ == block_size_) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(FlushPending());
+    return raw_->Flush();
+  }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!is_open_) {
+      return Status::OK();
+    }
+    is_open_ = false;
+    if (!wrote_member_ && !block_) {
+      // Write an empty member, as CompressedOutputStream does
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, 0, &block_));
+      block_pos_ = 0;
+    }
+    Status st = FlushPending();
+    // The blocks being compressed may use the codec
+    for (auto& pending : pending_) {
+      pending.wait();
+    }
+    pending_.clear();
+    return st & raw_->Close();
+  }
+
+  bool closed() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !is_open_;
+  }
+
+ private:
+  using CompressFuture = std::future<Result<std::shared_ptr<Buffer>>>;
+
+  // Start compressing the current block, after writing out the oldest
+  // compressed blocks if too many are in flight
+  Status SubmitBlock() {
+    while (static_cast<int>(pending_.size()) >= max_pending_) {
+      RETURN_NOT_OK(WriteOldest());
+    }
+    RETURN_NOT_OK(block_->Resize(block_pos_));
+    std::shared_ptr<Buffer> block = std::move(block_);
+    block_.reset();
+    MemoryPool* pool = pool_;
+    Codec* codec = codec_;
+    pending_.push_back(
+        executor_->Submit([pool, codec, block]() -> Result<std::shared_ptr<Buffer>> {
+          std::shared_ptr<Buffer> compressed;
+          RETURN_NOT_OK(CompressMember(pool, codec, *block, &compressed));
+          return compressed;
+        }));
+    return Status::OK();
+  }
+
+  Status WriteOldest() {
+    auto result = pending_.front().get();
+    pending_.pop_front();
+    RETURN_NOT_OK(result.status());
+    wrote_member_ = true;
+    return raw_->Write(result.ValueOrDie()->data(), result.ValueOrDie()->size());
+  }
+
+  // Compress the current block, and write out all compressed blocks
+  Status FlushPending() {
+    if (block_) {
+      RETURN_NOT_OK(SubmitBlock());
+    }
+    while (!pending_.empty()) {
+      RETURN_NOT_OK(WriteOldest());
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  Codec* codec_;
+  std::shared_ptr<OutputStream> raw_;
+  ThreadPool* executor_;
+  const int64_t block_size_;
+  const int max_pending_;
+  bool is_open_ = true;
+  bool wrote_member_ = false;
+
+  std::shared_ptr<ResizableBuffer> block_;
+  int64_t block_pos_ = 0;
+  // The blocks being compressed, in order
+  std::deque<CompressFuture> pending_;
+
+  mutable std::mutex lock_;
+};
+
+Status ParallelCompressedOutputStream::Make(
+    Codec* codec, const std::shared_ptr<OutputStream>& raw,
+    std::shared_ptr<ParallelCompressedOutputStream>* out) {
+  return Make(default_memory_pool(), codec, raw, NULLPTR, kDefaultCompressionBlockSize,
+              out);
+}
+
+Status ParallelCompressedOutputStream::Make(
+    MemoryPool* pool, Codec* codec, const std::shared_ptr<OutputStream>& raw,
+    ThreadPool* executor, int64_t block_size,
+    std::shared_ptr<ParallelCompressedOutputStream>* out) {
+  // CAUTION: codec is not owned
+  if (std::string(codec->name()) == "brotli") {
+    return Status::NotImplemented("Brotli streams cannot be compressed in parallel");
+  }
+  if (block_size <= 0) {
+    return Status::Invalid("Compression block size must be positive");
+  }
+  // Fail early if the codec doesn't support streaming compression
+  std::shared_ptr<Compressor> compressor;
+  RETURN_NOT_OK(codec->MakeCompressor(&compressor));
+
+  std::shared_ptr<ParallelCompressedOutputStream> res(new ParallelCompressedOutputStream);
+  if (executor == NULLPTR) {
+    executor = internal::GetCpuThreadPool();
+  }
+  res->impl_.reset(new Impl(pool, codec, raw, executor, block_size));
+  *out = res;
+  return Status::OK();
+}
+
+ParallelCompressedOutputStream::~ParallelCompressedOutputStream() {}
+
+Status ParallelCompressedOutputStream::Close() { return impl_->Close(); }
+
+bool ParallelCompressedOutputStream::closed() const { return impl_->closed(); }
+
+Status ParallelCompressedOutputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status ParallelCompressedOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+Status ParallelCompressedOutputStream::Flush() { return impl_->Flush(); }
+
+std::shared_ptr<OutputStream> ParallelCompressedOutputStream::raw() const {
+  return impl_->raw();
+}
+
 // ----------------------------------------------------------------------
 // CompressedInputStream implementation
 
@@ -446,5 +682,412 @@ Status CompressedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out)
 
 std::shared_ptr<InputStream> CompressedInputStream::raw() const { return impl_->raw(); }
 
+// ----------------------------------------------------------------------
+// ParallelCompressedInputStream implementation
+
+namespace {
+
+// Read 1 MB compressed data at a time
+constexpr int64_t kMemberChunkSize = 1024 * 1024;
+// Beyond this size, a member is not worth buffering whole
+constexpr int64_t kMaxMemberSize = 64 * 1024 * 1024;
+// Decompress into 1 MB at least
+constexpr int64_t kMinMemberDecompressSize = 1024 * 1024;
+
+enum class MemberSearch { FOUND, NEED_MORE_DATA, UNDELIMITED };
+
+uint32_t LoadLittleEndian(const uint8_t* data, int num_bytes) {
+  uint32_t value = 0;
+  for (int i = num_bytes - 1; i >= 0; --i) {
+    value = (value << 8) | data[i];
+  }
+  return value;
+}
+
+// A gzip member is delimited by the "BC" extra subfield written by bgzip,
+// holding the size of the member minus one
+MemberSearch FindGZipMember(const uint8_t* data, int64_t size, int64_t* member_size) {
+  static constexpr uint8_t kExtraFlag = 4;
+  if (size < 12) {
+    return MemberSearch::NEED_MORE_DATA;
+  }
+  if (data[2] != 8 || (data[3] & kExtraFlag) == 0) {
+    return MemberSearch::UNDELIMITED;
+  }
+  const int64_t extra_end = 12 + LoadLittleEndian(data + 10, 2);
+  if (size < extra_end) {
+    return MemberSearch::NEED_MORE_DATA;
+  }
+  for (int64_t pos = 12; pos + 4 <= extra_end;) {
+    const int64_t subfield_size = LoadLittleEndian(data + pos + 2, 2);
+    if (data[pos] == 'B' && data[pos + 1] == 'C' && subfield_size == 2 &&
+        pos + 6 <= extra_end) {
+      *member_size = LoadLittleEndian(data + pos + 4, 2) + 1;
+      return *member_size <= size ? MemberSearch::FOUND : MemberSearch::NEED_MORE_DATA;
+    }
+    pos += 4 + subfield_size;
+  }
+  return MemberSearch::UNDELIMITED;
+}
+
+// A zstd frame is delimited by walking its block headers
+MemberSearch FindZSTDFrame(const uint8_t* data, int64_t size, int64_t* member_size) {
+  if (size < 8) {
+    return MemberSearch::NEED_MORE_DATA;
+  }
+  const uint32_t magic = LoadLittleEndian(data, 4);
+  if ((magic & 0xFFFFFFF0U) == 0x184D2A50U) {
+    // Skippable frame
+    *member_size = 8 + static_cast<int64_t>(LoadLittleEndian(data + 4, 4));
+    return *member_size <= size ? MemberSearch::FOUND : MemberSearch::NEED_MORE_DATA;
+  }
+  const uint8_t descriptor = data[4];
+  const int content_size_flag = descriptor >> 6;
+  const bool single_segment = (descriptor >> 5) & 1;
+  const bool has_checksum = (descriptor >> 2) & 1;
+  static constexpr int kDictionaryIdSizes[] = {0, 1, 2, 4};
+  static constexpr int kContentSizeSizes[] = {0, 2, 4, 8};
+  int64_t pos = 5 + (single_segment ? 0 : 1) + kDictionaryIdSizes[descriptor & 3] +
+                ((content_size_flag == 0 && single_segment)
+                     ? 1
+                     : kContentSizeSizes[content_size_flag]);
+  while (true) {
+    if (size < pos + 3) {
+      return MemberSearch::NEED_MORE_DATA;
+    }
+    const uint32_t header = LoadLittleEndian(data + pos, 3);
+    const bool last_block = header & 1;
+    const int block_type = (header >> 1) & 3;
+    if (block_type == 3) {
+      // Reserved, leave the error to the decompressor
+      return MemberSearch::UNDELIMITED;
+    }
+    // RLE blocks hold a single byte
+    pos += 3 + (block_type == 1 ? 1 : (header >> 3));
+    if (last_block) {
+      break;
+    }
+  }
+  *member_size = pos + (has_checksum ? 4 : 0);
+  return *member_size <= size ? MemberSearch::FOUND : MemberSearch::NEED_MORE_DATA;
+}
+
+MemberSearch FindMember(const uint8_t* data, int64_t size, int64_t* member_size) {
+  if (size < 4) {
+    return MemberSearch::NEED_MORE_DATA;
+  }
+  if (data[0] == 0x1F && data[1] == 0x8B) {
+    return FindGZipMember(data, size, member_size);
+  }
+  const uint32_t magic = LoadLittleEndian(data, 4);
+  if (magic == 0xFD2FB528U || (magic & 0xFFFFFFF0U) == 0x184D2A50U) {
+    return FindZSTDFrame(data, size, member_size);
+  }
+  return MemberSearch::UNDELIMITED;
+}
+
+Status DecompressMember(MemoryPool* pool, Codec* codec, const Buffer& member,
+                        std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<Decompressor> decompressor;
+  RETURN_NOT_OK(codec->MakeDecompressor(&decompressor));
+  std::shared_ptr<ResizableBuffer> decompressed;
+  RETURN_NOT_OK(AllocateResizableBuffer(
+      pool, std::max(kMinMemberDecompressSize, member.size() * 4), &decompressed));
+
+  int64_t compressed_pos = 0;
+  int64_t decompressed_pos = 0;
+  while (!decompressor->IsFinished()) {
+    bool need_more_output;
+    int64_t bytes_read, bytes_written;
+    RETURN_NOT_OK(decompressor->Decompress(
+        member.size() - compressed_pos, member.data() + compressed_pos,
+        decompressed->size() - decompressed_pos,
+        decompressed->mutable_data() + decompressed_pos, &bytes_read, &bytes_written,
+        &need_more_output));
+    compressed_pos += bytes_read;
+    decompressed_pos += bytes_written;
+    if (decompressor->IsFinished()) {
+      break;
+    }
+    if (decompressed_pos == decompressed->size() ||
+        (need_more_output && compressed_pos < member.size())) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(decompressed->Resize(decompressed->size() * 2));
+    } else if (compressed_pos == member.size()) {
+      return Status::IOError("Truncated compressed stream");
+    }
+  }
+  RETURN_NOT_OK(decompressed->Resize(decompressed_pos));
+  *out = std::move(decompressed);
+  return Status::OK();
+}
+
+// Yields the data of a buffer, then that of a stream
+class PrefixedInputStream : public InputStream {
+ public:
+  PrefixedInputStream(std::shared_ptr<Buffer> prefix, std::shared_ptr<InputStream> raw)
+      : prefix_(std::move(prefix)), raw_(std::move(raw)) {}
+
+  Status Close() override { return raw_->Close(); }
+
+  bool closed() const override { return raw_->closed(); }
+
+  Status Tell(int64_t* position) const override {
+    return Status::NotImplemented("Cannot tell() a prefixed stream");
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    const int64_t from_prefix = std::min(nbytes, prefix_->size() - prefix_pos_);
+    std::memcpy(out, prefix_->data() + prefix_pos_, from_prefix);
+    prefix_pos_ += from_prefix;
+    int64_t from_raw = 0;
+    if (from_prefix < nbytes) {
+      RETURN_NOT_OK(raw_->Read(nbytes - from_prefix, &from_raw,
+                               reinterpret_cast<uint8_t*>(out) + from_prefix));
+    }
+    *bytes_read = from_prefix + from_raw;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buf));
+    int64_t bytes_read;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    *out = std::move(buf);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Buffer> prefix_;
+  int64_t prefix_pos_ = 0;
+  std::shared_ptr<InputStream> raw_;
+};
+
+}  // namespace
+
+class ParallelCompressedInputStream::Impl {
+ public:
+  Impl(MemoryPool* pool, Codec* codec, std::shared_ptr<InputStream> raw,
+       ThreadPool* executor)
+      : pool_(pool),
+        codec_(codec),
+        raw_(std::move(raw)),
+        executor_(executor),
+        max_pending_(std::max(1, executor->GetCapacity())) {}
+
+  ~Impl() { ARROW_CHECK_OK(Close()); }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (!is_open_) {
+      return Status::OK();
+    }
+    is_open_ = false;
+    // The members being decompressed may use the codec
+    for (auto& pending : pending_) {
+      pending.wait();
+    }
+    pending_.clear();
+    return raw_->Close();
+  }
+
+  bool closed() {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !is_open_;
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t total_read = 0;
+
+    while (total_read < nbytes) {
+      if (decompressed_ && decompressed_pos_ < decompressed_->size()) {
+        const int64_t read_bytes =
+            std::min(nbytes - total_read, decompressed_->size() - decompressed_pos_);
+        std::memcpy(out_data + total_read, decompressed_->data() + decompressed_pos_,
+                    read_bytes);
+        decompressed_pos_ += read_bytes;
+        total_read += read_bytes;
+        continue;
+      }
+      decompressed_.reset();
+      RETURN_NOT_OK(ScheduleMembers());
+      if (!pending_.empty()) {
+        auto result = pending_.front().get();
+        pending_.pop_front();
+        RETURN_NOT_OK(result.status());
+        decompressed_ = std::move(result).ValueOrDie();
+        decompressed_pos_ = 0;
+        continue;
+      }
+      if (serial_) {
+        int64_t serial_read;
+        RETURN_NOT_OK(
+            serial_->Read(nbytes - total_read, &serial_read, out_data + total_read));
+        total_read += serial_read;
+      }
+      // End of stream
+      break;
+    }
+
+    *bytes_read = total_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buf));
+    int64_t bytes_read;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buf->mutable_data()));
+    RETURN_NOT_OK(buf->Resize(bytes_read));
+    *out = buf;
+    return Status::OK();
+  }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  using DecompressFuture = std::future<Result<std::shared_ptr<Buffer>>>;
+
+  // Start decompressing the next members, until enough are in flight
+  Status ScheduleMembers() {
+    while (!serial_ && static_cast<int>(pending_.size()) < max_pending_) {
+      std::shared_ptr<Buffer> member;
+      RETURN_NOT_OK(NextMember(&member));
+      if (!member) {
+        break;
+      }
+      MemoryPool* pool = pool_;
+      Codec* codec = codec_;
+      pending_.push_back(
+          executor_->Submit([pool, codec, member]() -> Result<std::shared_ptr<Buffer>> {
+            std::shared_ptr<Buffer> decompressed;
+            RETURN_NOT_OK(DecompressMember(pool, codec, *member, &decompressed));
+            return decompressed;
+          }));
+    }
+    return Status::OK();
+  }
+
+  // Delimit the next member of the compressed data, or return null at the
+  // end of the data or once it cannot be delimited anymore
+  Status NextMember(std::shared_ptr<Buffer>* out) {
+    *out = nullptr;
+    while (true) {
+      const int64_t available = compressed_ ? compressed_->size() - compressed_pos_ : 0;
+      if (available > 0) {
+        int64_t member_size = 0;
+        auto search = FindMember(compressed_->data() + compressed_pos_, available,
+                                 &member_size);
+        if (search == MemberSearch::FOUND) {
+          *out = SliceBuffer(compressed_, compressed_pos_, member_size);
+          compressed_pos_ += member_size;
+          return Status::OK();
+        }
+        if (search == MemberSearch::UNDELIMITED || available > kMaxMemberSize) {
+          return StartSerial();
+        }
+      }
+      if (raw_eof_) {
+        // A truncated member is left for the serial decompressor to report
+        return available > 0 ? StartSerial() : Status::OK();
+      }
+      RETURN_NOT_OK(ReadCompressed(std::max(kMemberChunkSize, available)));
+    }
+  }
+
+  // Read more compressed data after the data not consumed yet
+  Status ReadCompressed(int64_t nbytes) {
+    const int64_t available = compressed_ ? compressed_->size() - compressed_pos_ : 0;
+    std::shared_ptr<ResizableBuffer> buf;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, available + nbytes, &buf));
+    if (available > 0) {
+      std::memcpy(buf->mutable_data(), compressed_->data() + compressed_pos_, available);
+    }
+    int64_t bytes_read;
+    RETURN_NOT_OK(raw_->Read(nbytes, &bytes_read, buf->mutable_data() + available));
+    RETURN_NOT_OK(buf->Resize(available + bytes_read));
+    raw_eof_ = bytes_read == 0;
+    compressed_ = std::move(buf);
+    compressed_pos_ = 0;
+    return Status::OK();
+  }
+
+  // Decompress the rest of the data serially
+  Status StartSerial() {
+    auto rest = compressed_ ? SliceBuffer(compressed_, compressed_pos_,
+                                          compressed_->size() - compressed_pos_)
+                            : std::make_shared<Buffer>(nullptr, 0);
+    compressed_.reset();
+    return CompressedInputStream::Make(
+        pool_, codec_, std::make_shared<PrefixedInputStream>(std::move(rest), raw_),
+        &serial_);
+  }
+
+  MemoryPool* pool_;
+  Codec* codec_;
+  std::shared_ptr<InputStream> raw_;
+  ThreadPool* executor_;
+  const int max_pending_;
+  bool is_open_ = true;
+
+  std::shared_ptr<Buffer> compressed_;
+  int64_t compressed_pos_ = 0;
+  bool raw_eof_ = false;
+  // The members being decompressed, in order
+  std::deque<DecompressFuture> pending_;
+  std::shared_ptr<Buffer> decompressed_;
+  int64_t decompressed_pos_ = 0;
+  std::shared_ptr<CompressedInputStream> serial_;
+
+  mutable std::mutex lock_;
+};
+
+Status ParallelCompressedInputStream::Make(
+    Codec* codec, const std::shared_ptr<InputStream>& raw,
+    std::shared_ptr<ParallelCompressedInputStream>* out) {
+  return Make(default_memory_pool(), codec, raw, NULLPTR, out);
+}
+
+Status ParallelCompressedInputStream::Make(
+    MemoryPool* pool, Codec* codec, const std::shared_ptr<InputStream>& raw,
+    ThreadPool* executor, std::shared_ptr<ParallelCompressedInputStream>* out) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<ParallelCompressedInputStream> res(new ParallelCompressedInputStream);
+  if (executor == NULLPTR) {
+    executor = internal::GetCpuThreadPool();
+  }
+  res->impl_.reset(new Impl(pool, codec, raw, executor));
+  *out = res;
+  return Status::OK();
+}
+
+ParallelCompressedInputStream::~ParallelCompressedInputStream() {}
+
+Status ParallelCompressedInputStream::Close() { return impl_->Close(); }
+
+bool ParallelCompressedInputStream::closed() const { return impl_->closed(); }
+
+Status ParallelCompressedInputStream::Tell(int64_t* position) const {
+  return Status::NotImplemented("Cannot tell() a compressed stream");
+}
+
+Status ParallelCompressedInputStream::Read(int64_t nbytes, int64_t* bytes_read,
+                                           void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status ParallelCompressedInputStream::Read(int64_t nbytes,
+                                           std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+std::shared_ptr<InputStream> ParallelCompressedInputStream::raw() const {
+  return impl_->raw();
+}
+
 }  // namespace io
 }  // namespace arrow
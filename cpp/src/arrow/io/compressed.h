@@ -31,6 +31,12 @@ namespace arrow {
 class MemoryPool;
 class Status;
 
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace util {
 
 class Codec;
@@ -74,6 +80,58 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief An output stream compressing blocks of its data in parallel
+///
+/// The data is cut into blocks which are compressed concurrently on a thread
+/// pool, each as an independent member of the compressed data (a zstd or LZ4
+/// frame, a gzip or bzip2 member), and written in order.  The result is read
+/// back with CompressedInputStream, and zstd frames are decompressed in
+/// parallel by ParallelCompressedInputStream.  As many blocks as the capacity
+/// of the executor are compressed at a time, which bounds memory use.
+///
+/// Brotli streams cannot be concatenated, and so are not supported.
+class ARROW_EXPORT ParallelCompressedOutputStream : public OutputStream {
+ public:
+  ~ParallelCompressedOutputStream() override;
+
+  /// \brief Create a compressed output stream wrapping the given output
+  /// stream, compressing 1 MB blocks on the CPU thread pool.
+  static Status Make(util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+                     std::shared_ptr<ParallelCompressedOutputStream>* out);
+  /// \brief Create a compressed output stream wrapping the given output stream.
+  ///
+  /// A null executor stands for the CPU thread pool.
+  static Status Make(MemoryPool* pool, util::Codec* codec,
+                     const std::shared_ptr<OutputStream>& raw,
+                     internal::ThreadPool* executor, int64_t block_size,
+                     std::shared_ptr<ParallelCompressedOutputStream>* out);
+
+  // OutputStream interface
+
+  /// \brief Close the compressed output stream.  This implicitly closes the
+  /// underlying raw output stream.
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+  /// \brief Compress the data written so far as a member of its own, and
+  /// write it out.
+  Status Flush() override;
+
+  /// \brief Return the underlying raw output stream.
+  std::shared_ptr<OutputStream> raw() const;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedOutputStream);
+
+  ParallelCompressedOutputStream() = default;
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 class ARROW_EXPORT CompressedInputStream : public InputStream {
  public:
   ~CompressedInputStream() override;
@@ -109,6 +167,56 @@ class ARROW_EXPORT CompressedInputStream : public InputStream {
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief An input stream decompressing the members of its input in parallel
+///
+/// Compressed data made of independent members, i.e. zstd frames or gzip
+/// members recording their compressed size in a "BC" extra subfield (as
+/// written by bgzip), is decompressed several members at a time on a thread
+/// pool, ahead of the reads.  The data is read in the same order as with
+/// CompressedInputStream.  Once a member which cannot be delimited is met,
+/// e.g. a gzip member without compressed size, the rest of the data is
+/// decompressed serially.
+class ARROW_EXPORT ParallelCompressedInputStream : public InputStream {
+ public:
+  ~ParallelCompressedInputStream() override;
+
+  /// \brief Create a compressed input stream wrapping the given input stream,
+  /// decompressing on the CPU thread pool.
+  static Status Make(util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+                     std::shared_ptr<ParallelCompressedInputStream>* out);
+  /// \brief Create a compressed input stream wrapping the given input stream.
+  ///
+  /// As many members as the capacity of the executor are decompressed ahead
+  /// of the reads.  A null executor stands for the CPU thread pool.
+  static Status Make(MemoryPool* pool, util::Codec* codec,
+                     const std::shared_ptr<InputStream>& raw,
+                     internal::ThreadPool* executor,
+                     std::shared_ptr<ParallelCompressedInputStream>* out);
+
+  // InputStream interface
+
+  /// \brief Close the compressed input stream.  This implicitly closes the
+  /// underlying raw input stream.
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Return the underlying raw input stream.
+  std::shared_ptr<InputStream> raw() const;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ParallelCompressedInputStream);
+
+  ParallelCompressedInputStream() = default;
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
 
@@ -33,6 +33,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -80,13 +81,31 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
   return std::move(compressed);
 }
 
-Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                std::vector<uint8_t>* out) {
-  // Create compressed input stream
-  auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  std::shared_ptr<CompressedInputStream> stream;
-  RETURN_NOT_OK(CompressedInputStream::Make(codec, buffer_reader, &stream));
+// Compress data into gzip members of block_size bytes, each recording its
+// compressed size in a "BC" extra subfield like bgzip does
+std::shared_ptr<Buffer> CompressBlockedGZipData(Codec* codec,
+                                                const std::vector<uint8_t>& data,
+                                                size_t block_size) {
+  std::string blocked;
+  for (size_t offset = 0; offset < data.size(); offset += block_size) {
+    std::vector<uint8_t> block(data.begin() + offset,
+                               data.begin() + std::min(data.size(), offset + block_size));
+    auto member = CompressDataOneShot(codec, block);
+    // Insert the extra field after the 10 bytes of the fixed header
+    std::string header(reinterpret_cast<const char*>(member->data()), 10);
+    header[3] |= 4;
+    const int64_t block_size_minus_one = member->size() + 8 - 1;
+    header += std::string{6, 0, 'B', 'C', 2, 0};
+    header.push_back(static_cast<char>(block_size_minus_one & 0xFF));
+    header.push_back(static_cast<char>(block_size_minus_one >> 8));
+    blocked += header;
+    blocked.append(reinterpret_cast<const char*>(member->data()) + 10,
+                   member->size() - 10);
+  }
+  return Buffer::FromString(std::move(blocked));
+}
 
+Status ReadAll(InputStream* stream, std::vector<uint8_t>* out) {
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
   const int64_t chunk_size = 1111;
@@ -105,6 +124,27 @@ Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed
   return Status::OK();
 }
 
+Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                std::vector<uint8_t>* out) {
+  // Create compressed input stream
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<CompressedInputStream> stream;
+  RETURN_NOT_OK(CompressedInputStream::Make(codec, buffer_reader, &stream));
+  return ReadAll(stream.get(), out);
+}
+
+Status RunParallelCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                        std::vector<uint8_t>* out) {
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<internal::ThreadPool> pool;
+  RETURN_NOT_OK(internal::ThreadPool::Make(3, &pool));
+  std::shared_ptr<ParallelCompressedInputStream> stream;
+  RETURN_NOT_OK(ParallelCompressedInputStream::Make(default_memory_pool(), codec,
+                                                    buffer_reader, pool.get(), &stream));
+  RETURN_NOT_OK(ReadAll(stream.get(), out));
+  return stream->Close();
+}
+
 void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
   // Create compressed data
   auto compressed = CompressDataOneShot(codec, data);
@@ -147,6 +187,42 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+void CheckParallelCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                         bool do_flush) {
+  std::shared_ptr<BufferOutputStream> buffer_writer;
+  ASSERT_OK(BufferOutputStream::Create(1024, default_memory_pool(), &buffer_writer));
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(3, &pool));
+  std::shared_ptr<ParallelCompressedOutputStream> stream;
+  ASSERT_OK(ParallelCompressedOutputStream::Make(default_memory_pool(), codec,
+                                                 buffer_writer, pool.get(),
+                                                 100000 /* block_size */, &stream));
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 77777;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    ASSERT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (do_flush) {
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  ASSERT_OK(stream->Close());
+  ASSERT_TRUE(stream->closed());
+
+  // The members are read back in order
+  std::shared_ptr<Buffer> compressed;
+  ASSERT_OK(buffer_writer->Finish(&compressed));
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+  ASSERT_OK(RunParallelCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -215,6 +291,55 @@ TEST_P(CompressedInputStreamTest, ConcatenatedStreams) {
   ASSERT_EQ(decompressed, expected);
 }
 
+TEST_P(CompressedInputStreamTest, ParallelConcatenatedStreams) {
+  // zstd frames are decompressed in parallel, other members serially
+  auto codec = MakeCodec();
+  std::vector<std::shared_ptr<Buffer>> members;
+  std::vector<uint8_t> expected;
+  for (int i = 0; i < 10; ++i) {
+    auto data = i % 2 ? MakeRandomData(20000 + i) : MakeCompressibleData(300000 + i);
+    members.push_back(CompressDataOneShot(codec.get(), data));
+    std::copy(data.begin(), data.end(), std::back_inserter(expected));
+  }
+
+  std::shared_ptr<Buffer> concatenated;
+  ASSERT_OK(ConcatenateBuffers(members, default_memory_pool(), &concatenated));
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunParallelCompressedInputStream(codec.get(), concatenated, &decompressed));
+  ASSERT_EQ(decompressed.size(), expected.size());
+  ASSERT_EQ(decompressed, expected);
+
+  auto truncated = SliceBuffer(concatenated, 0, concatenated->size() - 3);
+  ASSERT_RAISES(IOError,
+                RunParallelCompressedInputStream(codec.get(), truncated, &decompressed));
+}
+
+TEST(TestParallelCompressedInputStream, BlockedGZip) {
+  std::unique_ptr<Codec> codec;
+  ASSERT_OK(Codec::Create(Compression::GZIP, &codec));
+  auto data = MakeRandomData(RANDOM_DATA_SIZE / 4);
+  auto blocked = CompressBlockedGZipData(codec.get(), data, 20000);
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunParallelCompressedInputStream(codec.get(), blocked, &decompressed));
+  ASSERT_EQ(decompressed.size(), data.size());
+  ASSERT_EQ(decompressed, data);
+
+  // A member without compressed size is decompressed serially after the others
+  auto tail = MakeCompressibleData(100000);
+  std::shared_ptr<Buffer> mixed;
+  ASSERT_OK(ConcatenateBuffers({blocked, CompressDataOneShot(codec.get(), tail)},
+                               default_memory_pool(), &mixed));
+  ASSERT_OK(RunParallelCompressedInputStream(codec.get(), mixed, &decompressed));
+  auto expected = data;
+  std::copy(tail.begin(), tail.end(), std::back_inserter(expected));
+  ASSERT_EQ(decompressed, expected);
+
+  auto truncated = SliceBuffer(blocked, 0, blocked->size() - 3);
+  ASSERT_RAISES(IOError,
+                RunParallelCompressedInputStream(codec.get(), truncated, &decompressed));
+}
+
 // NOTE: Snappy doesn't support streaming decompression
 
 // NOTE: BZ2 doesn't support one-shot compression
@@ -269,6 +394,23 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, Parallel) {
+  auto codec = MakeCodec();
+  if (GetCompression() == Compression::BROTLI) {
+    std::shared_ptr<OutputStream> raw = std::make_shared<MockOutputStream>();
+    std::shared_ptr<ParallelCompressedOutputStream> stream;
+    ASSERT_RAISES(NotImplemented,
+                  ParallelCompressedOutputStream::Make(codec.get(), raw, &stream));
+    return;
+  }
+
+  CheckParallelCompressedOutputStream(codec.get(), MakeCompressibleData(1000000),
+                                      false /* do_flush */);
+  CheckParallelCompressedOutputStream(codec.get(), MakeRandomData(200000),
+                                      true /* do_flush */);
+  CheckParallelCompressedOutputStream(codec.get(), {}, false /* do_flush */);
+}
+
 INSTANTIATE_TEST_CASE_P(TestGZipOutputStream, CompressedOutputStreamTest,
                         ::testing::Values(Compression::GZIP));
 
@@ -26,19 +26,29 @@
 #undef Realloc
 #undef Free
 #else
+#include <fcntl.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>  // IWYU pragma: keep
 #endif
 
+#ifdef ARROW_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <climits>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -51,10 +61,217 @@
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
 
 namespace arrow {
 namespace io {
 
+namespace {
+
+// A read of the file into memory, resumed with pread() where the batched
+// read left off
+struct RangeRead {
+  int64_t offset;
+  int64_t length;
+  uint8_t* data;
+  int64_t bytes_read;
+};
+
+}  // namespace
+
+#ifdef ARROW_HAVE_IO_URING
+
+// A minimal io_uring submission and completion ring, issuing the system
+// calls directly rather than depending on liburing.  Not thread-safe.
+class IoUring {
+ public:
+  static constexpr unsigned kEntries = 64;
+
+  ~IoUring() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+      munmap(cq_ptr_, cq_size_);
+    }
+    if (sq_ptr_ != nullptr) {
+      munmap(sq_ptr_, sq_size_);
+    }
+    if (ring_fd_ != -1) {
+      close(ring_fd_);
+    }
+  }
+
+  // Fails where the kernel does not support io_uring or forbids its use
+  static Status Make(std::unique_ptr<IoUring>* out) {
+    std::unique_ptr<IoUring> ring(new IoUring());
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring->ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kEntries, &params));
+    if (ring->ring_fd_ < 0) {
+      ring->ring_fd_ = -1;
+      return Status::IOError("io_uring_setup failed: ", std::strerror(errno));
+    }
+
+    ring->sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      ring->sq_size_ = ring->cq_size_ = std::max(ring->sq_size_, ring->cq_size_);
+    }
+    RETURN_NOT_OK(ring->Map(ring->sq_size_, IORING_OFF_SQ_RING, &ring->sq_ptr_));
+    if (single_mmap) {
+      ring->cq_ptr_ = ring->sq_ptr_;
+    } else {
+      RETURN_NOT_OK(ring->Map(ring->cq_size_, IORING_OFF_CQ_RING, &ring->cq_ptr_));
+    }
+    ring->sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    void* sqes;
+    RETURN_NOT_OK(ring->Map(ring->sqes_size_, IORING_OFF_SQES, &sqes));
+    ring->sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    auto sq = static_cast<uint8_t*>(ring->sq_ptr_);
+    ring->sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    ring->sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    ring->sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    ring->sq_entries_ = params.sq_entries;
+    auto cq = static_cast<uint8_t*>(ring->cq_ptr_);
+    ring->cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    ring->cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    ring->cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    ring->cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+
+    *out = std::move(ring);
+    return Status::OK();
+  }
+
+  // Submit the reads in batches of the ring size, waiting for each batch to
+  // complete.  Failed reads are left with no bytes read.
+  Status Read(int fd, std::vector<RangeRead>* reads) {
+    std::vector<struct iovec> iovecs(sq_entries_);
+    for (size_t start = 0; start < reads->size(); start += sq_entries_) {
+      const unsigned batch_size =
+          static_cast<unsigned>(std::min<size_t>(sq_entries_, reads->size() - start));
+
+      unsigned tail = *sq_tail_;
+      for (unsigned i = 0; i < batch_size; ++i) {
+        const RangeRead& read = (*reads)[start + i];
+        iovecs[i].iov_base = read.data;
+        iovecs[i].iov_len = static_cast<size_t>(read.length);
+
+        const unsigned index = tail & sq_mask_;
+        io_uring_sqe* sqe = &sqes_[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_READV;
+        sqe->fd = fd;
+        sqe->addr = reinterpret_cast<uint64_t>(&iovecs[i]);
+        sqe->len = 1;
+        sqe->off = static_cast<uint64_t>(read.offset);
+        sqe->user_data = start + i;
+        sq_array_[index] = index;
+        ++tail;
+      }
+      __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+
+      unsigned to_submit = batch_size;
+      unsigned completed = 0;
+      while (completed < batch_size) {
+        const int ret = static_cast<int>(syscall(__NR_io_uring_enter, ring_fd_, to_submit,
+                                                 1, IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (ret < 0) {
+          if (errno == EINTR || errno == EAGAIN || errno == EBUSY) {
+            continue;
+          }
+          // Reads already submitted could still write into the buffers
+          ARROW_CHECK_EQ(completed + to_submit, batch_size)
+              << "io_uring_enter failed with reads in flight";
+          return Status::IOError("io_uring_enter failed: ", std::strerror(errno));
+        }
+        to_submit -= static_cast<unsigned>(ret);
+
+        unsigned head = *cq_head_;
+        const unsigned cq_tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (; head != cq_tail; ++head) {
+          const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+          (*reads)[cqe.user_data].bytes_read = cqe.res > 0 ? cqe.res : 0;
+          ++completed;
+        }
+        __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  IoUring() = default;
+
+  Status Map(size_t size, off_t offset, void** out) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                     ring_fd_, offset);
+    if (ptr == MAP_FAILED) {
+      return Status::IOError("io_uring mmap failed: ", std::strerror(errno));
+    }
+    *out = ptr;
+    return Status::OK();
+  }
+
+  int ring_fd_ = -1;
+  void* sq_ptr_ = nullptr;
+  size_t sq_size_ = 0;
+  void* cq_ptr_ = nullptr;
+  size_t cq_size_ = 0;
+  io_uring_sqe* sqes_ = nullptr;
+  size_t sqes_size_ = 0;
+
+  unsigned* sq_tail_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_entries_ = 0;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  io_uring_cqe* cqes_ = nullptr;
+};
+
+#endif  // ARROW_HAVE_IO_URING
+
+#ifndef _WIN32
+
+#ifdef IOV_MAX
+static constexpr size_t kMaxIovecs = IOV_MAX;
+#else
+static constexpr size_t kMaxIovecs = 1024;
+#endif
+
+// Some platforms fail gather writes of more than INT32_MAX bytes
+static constexpr int64_t kMaxWriteVBytes = std::numeric_limits<int32_t>::max();
+
+// Write all of the iovecs, resuming after partial writes
+static Status WriteIovecs(int fd, std::vector<struct iovec>* iovecs) {
+  size_t next = 0;
+  while (next < iovecs->size()) {
+    const ssize_t ret = writev(fd, iovecs->data() + next,
+                               static_cast<int>(iovecs->size() - next));
+    if (ret == -1) {
+      return Status::IOError("Error writing bytes to file: ",
+                             internal::ErrnoMessage(errno));
+    }
+    size_t written = static_cast<size_t>(ret);
+    while (next < iovecs->size() && written >= (*iovecs)[next].iov_len) {
+      written -= (*iovecs)[next].iov_len;
+      ++next;
+    }
+    if (written > 0) {
+      struct iovec& partial = (*iovecs)[next];
+      partial.iov_base = reinterpret_cast<uint8_t*>(partial.iov_base) + written;
+      partial.iov_len -= written;
+    }
+  }
+  return Status::OK();
+}
+
+#endif  // _WIN32
+
 class OSFile {
  public:
   OSFile() : fd_(-1), is_open_(false), size_(-1), need_seeking_(false) {}
@@ -176,6 +393,50 @@ class OSFile {
     return internal::FileWrite(fd_, reinterpret_cast<const uint8_t*>(data), length);
   }
 
+  Status WriteV(const std::vector<WriteRegion>& regions) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckPositioned());
+    for (const auto& region : regions) {
+      if (region.nbytes < 0) {
+        return Status::IOError("Length must be non-negative");
+      }
+    }
+#ifdef _WIN32
+    for (const auto& region : regions) {
+      RETURN_NOT_OK(internal::FileWrite(
+          fd_, reinterpret_cast<const uint8_t*>(region.data), region.nbytes));
+    }
+    return Status::OK();
+#else
+    std::vector<struct iovec> iovecs;
+    iovecs.reserve(std::min(regions.size(), kMaxIovecs));
+    int64_t iovecs_bytes = 0;
+    for (const auto& region : regions) {
+      if (region.nbytes == 0) {
+        continue;
+      }
+      if (iovecs.size() == kMaxIovecs || iovecs_bytes + region.nbytes > kMaxWriteVBytes) {
+        RETURN_NOT_OK(WriteIovecs(fd_, &iovecs));
+        iovecs.clear();
+        iovecs_bytes = 0;
+      }
+      if (region.nbytes > kMaxWriteVBytes) {
+        RETURN_NOT_OK(internal::FileWrite(
+            fd_, reinterpret_cast<const uint8_t*>(region.data), region.nbytes));
+        continue;
+      }
+      struct iovec iov;
+      iov.iov_base = const_cast<void*>(region.data);
+      iov.iov_len = static_cast<size_t>(region.nbytes);
+      iovecs.push_back(iov);
+      iovecs_bytes += region.nbytes;
+    }
+    return WriteIovecs(fd_, &iovecs);
+#endif
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -223,14 +484,62 @@ class OSFile {
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
+ReadableFileOptions ReadableFileOptions::Defaults() { return ReadableFileOptions(); }
+
 class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
 
-  Status Open(const std::string& path) { return OpenReadable(path); }
+  Status Open(const std::string& path, const ReadableFileOptions& options) {
+    RETURN_NOT_OK(OpenReadable(path));
+    if (options.direct_io) {
+#ifdef O_DIRECT
+      const int flags = fcntl(fd_, F_GETFL);
+      if (flags == -1 || fcntl(fd_, F_SETFL, flags | O_DIRECT) == -1) {
+        return Status::IOError("Failed to enable direct I/O on file: ",
+                               std::strerror(errno));
+      }
+      direct_io_ = true;
+#else
+      return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+    }
+    return Status::OK();
+  }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    if (!direct_io_) {
+      return OSFile::Read(nbytes, bytes_read, out);
+    }
+    // Direct reads must be aligned, so read at the current position instead
+    RETURN_NOT_OK(CheckPositioned());
+    int64_t position;
+    RETURN_NOT_OK(Tell(&position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, bytes_read, out));
+    return Seek(position + *bytes_read);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    if (!direct_io_) {
+      return OSFile::ReadAt(position, nbytes, bytes_read, out);
+    }
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(ReadBufferAt(position, nbytes, &buffer));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    *bytes_read = buffer->size();
+    return Status::OK();
+  }
+
   Status ReadBuffer(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (direct_io_) {
+      RETURN_NOT_OK(CheckPositioned());
+      int64_t position;
+      RETURN_NOT_OK(Tell(&position));
+      RETURN_NOT_OK(ReadBufferAt(position, nbytes, out));
+      return Seek(position + (*out)->size());
+    }
+
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -245,6 +554,13 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Status ReadBufferAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (direct_io_) {
+      std::vector<std::shared_ptr<Buffer>> buffers;
+      RETURN_NOT_OK(ReadRanges({{position, nbytes}}, &buffers));
+      *out = std::move(buffers[0]);
+      return Status::OK();
+    }
+
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -258,8 +574,97 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    std::vector<std::shared_ptr<Buffer>>* out) {
+    RETURN_NOT_OK(CheckClosed());
+    for (const auto& range : ranges) {
+      if (range.offset < 0 || range.length < 0) {
+        return Status::Invalid("Invalid read range: offset ", range.offset, ", length ",
+                               range.length);
+      }
+    }
+    // ReadAt() leaves the file position undefined
+    need_seeking_.store(true);
+
+    const int64_t alignment = this->alignment();
+    std::vector<RangeRead> reads;
+    std::vector<std::shared_ptr<ResizableBuffer>> buffers;
+    std::vector<int64_t> skips;
+    reads.reserve(ranges.size());
+    for (const auto& range : ranges) {
+      // Widen the read to the alignment, and align its start in memory
+      const int64_t offset = range.offset - range.offset % alignment;
+      const int64_t end = range.offset + range.length;
+      const int64_t length = end - offset + (alignment - end % alignment) % alignment;
+      std::shared_ptr<ResizableBuffer> buffer;
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, length + alignment - 1, &buffer));
+      const auto address = reinterpret_cast<uintptr_t>(buffer->mutable_data());
+      const auto padding = static_cast<int64_t>(
+          (alignment - static_cast<int64_t>(address % alignment)) % alignment);
+      reads.push_back({offset, length, buffer->mutable_data() + padding, 0});
+      buffers.push_back(std::move(buffer));
+      skips.push_back(padding + range.offset - offset);
+    }
+
+    RETURN_NOT_OK(ReadAll(&reads));
+
+    out->clear();
+    out->reserve(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      const int64_t head = ranges[i].offset - reads[i].offset;
+      const int64_t available = std::max<int64_t>(0, reads[i].bytes_read - head);
+      const int64_t length = std::min(ranges[i].length, available);
+      if (alignment == 1) {
+        RETURN_NOT_OK(buffers[i]->Resize(length));
+        buffers[i]->ZeroPadding();
+        out->push_back(std::move(buffers[i]));
+      } else {
+        out->push_back(SliceBuffer(buffers[i], skips[i], length));
+      }
+    }
+    return Status::OK();
+  }
+
  private:
+  // Batch the reads through io_uring if possible, then complete them with
+  // pread(), which also covers reads the ring failed or cut short
+  Status ReadAll(std::vector<RangeRead>* reads) {
+#ifdef ARROW_HAVE_IO_URING
+    if (reads->size() > 1 || direct_io_) {
+      std::lock_guard<std::mutex> guard(ring_lock_);
+      if (ring_ == nullptr && !ring_unavailable_) {
+        ring_unavailable_ = !IoUring::Make(&ring_).ok();
+      }
+      if (ring_ != nullptr) {
+        RETURN_NOT_OK(ring_->Read(fd_, reads));
+      }
+    }
+#endif
+    for (auto& read : *reads) {
+      // A direct read cut short off the alignment reached the end of the file
+      if (read.bytes_read == read.length || read.bytes_read % alignment() != 0) {
+        continue;
+      }
+      int64_t bytes_read;
+      RETURN_NOT_OK(internal::FileReadAt(fd_, read.data + read.bytes_read,
+                                         read.offset + read.bytes_read,
+                                         read.length - read.bytes_read, &bytes_read));
+      read.bytes_read += bytes_read;
+    }
+    return Status::OK();
+  }
+
+  int64_t alignment() const {
+    return direct_io_ ? ReadableFileOptions::kDirectIOAlignment : 1;
+  }
+
   MemoryPool* pool_;
+  bool direct_io_ = false;
+#ifdef ARROW_HAVE_IO_URING
+  std::mutex ring_lock_;
+  std::unique_ptr<IoUring> ring_;
+  bool ring_unavailable_ = false;
+#endif
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -272,8 +677,14 @@ Status ReadableFile::Open(const std::string& path, std::shared_ptr<ReadableFile>
 
 Status ReadableFile::Open(const std::string& path, MemoryPool* memory_pool,
                           std::shared_ptr<ReadableFile>* file) {
+  return Open(path, memory_pool, ReadableFileOptions::Defaults(), file);
+}
+
+Status ReadableFile::Open(const std::string& path, MemoryPool* memory_pool,
+                          const ReadableFileOptions& options,
+                          std::shared_ptr<ReadableFile>* file) {
   *file = std::shared_ptr<ReadableFile>(new ReadableFile(memory_pool));
-  return (*file)->impl_->Open(path);
+  return (*file)->impl_->Open(path, options);
 }
 
 Status ReadableFile::Open(int fd, MemoryPool* memory_pool,
@@ -312,6 +723,11 @@ Status ReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return impl_->ReadBuffer(nbytes, out);
 }
 
+Status ReadableFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                std::vector<std::shared_ptr<Buffer>>* out) {
+  return impl_->ReadRanges(ranges, out);
+}
+
 Status ReadableFile::GetSize(int64_t* size) {
   *size = impl_->size();
   return Status::OK();
@@ -383,6 +799,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::WriteV(const std::vector<WriteRegion>& regions) {
+  return impl_->WriteV(regions);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -630,6 +1050,21 @@ Status MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes,
   return Status::OK();
 }
 
+Status MemoryMappedFile::MutableSliceAt(int64_t position, int64_t nbytes,
+                                        std::shared_ptr<Buffer>* out) {
+  std::lock_guard<std::mutex> guard_resize(memory_map_->resize_lock());
+  if (!memory_map_->opened() || !memory_map_->writable()) {
+    return Status::IOError("Memory map is not writable");
+  }
+  if (position < 0 || nbytes < 0 || position + nbytes > memory_map_->size()) {
+    return Status::Invalid("Slice of ", nbytes, " bytes at ", position,
+                           " past end of memory map of ", memory_map_->size(),
+                           " bytes");
+  }
+  *out = SliceMutableBuffer(memory_map_, position, nbytes);
+  return Status::OK();
+}
+
 Status MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* out) {
   auto guard_resize = memory_map_->writable()
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -95,6 +96,9 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  // Write regions of memory with writev(). Thread-safe
+  Status WriteV(const std::vector<WriteRegion>& regions) override;
+
   using Writable::Write;
 
   int file_descriptor() const;
@@ -107,6 +111,17 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
 };
 
 // Operating system file
+struct ARROW_EXPORT ReadableFileOptions {
+  /// Read with O_DIRECT, bypassing the page cache (Linux only).  Reads are
+  /// then widened to kDirectIOAlignment boundaries, into buffers aligned
+  /// within allocations from the memory pool.
+  bool direct_io = false;
+
+  static constexpr int64_t kDirectIOAlignment = 4096;
+
+  static ReadableFileOptions Defaults();
+};
+
 class ARROW_EXPORT ReadableFile : public RandomAccessFile {
  public:
   ~ReadableFile() override;
@@ -125,6 +140,15 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   static Status Open(const std::string& path, MemoryPool* pool,
                      std::shared_ptr<ReadableFile>* file);
 
+  /// \brief Open a local file for reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \param[in] options how to read the file
+  /// \param[out] file ReadableFile instance
+  static Status Open(const std::string& path, MemoryPool* pool,
+                     const ReadableFileOptions& options,
+                     std::shared_ptr<ReadableFile>* file);
+
   /// \brief Open a local file for reading
   /// \param[in] fd file descriptor
   /// \param[out] file ReadableFile instance
@@ -159,6 +183,15 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   /// \brief Thread-safe implementation of ReadAt
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
+  /// \brief Read several ranges of the file at once.  Thread-safe
+  ///
+  /// On Linux, the reads are submitted together through io_uring, waiting
+  /// once for all of them.  Where io_uring is not available, they are read
+  /// one after the other.  Buffers are shorter than requested for ranges
+  /// past the end of the file.
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    std::vector<std::shared_ptr<Buffer>>* out);
+
   Status GetSize(int64_t* size) override;
   Status Seek(int64_t position) override;
 
@@ -219,6 +252,13 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   bool supports_zero_copy() const override;
 
+  /// \brief Zero-copy writable slice of a file opened in a writable mode, for
+  /// data to be produced in place. Leaves position unchanged. Like the
+  /// buffers returned by ReadAt, the slice prevents resizing the map while it
+  /// is alive. Is thread-safe.
+  Status MutableSliceAt(int64_t position, int64_t nbytes,
+                        std::shared_ptr<Buffer>* out);
+
   /// Write data at the current position in the file. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
@@ -203,6 +203,32 @@ TEST_F(TestFileOutputStream, InvalidWrites) {
   ASSERT_RAISES(IOError, stream_->Write(data, -1));
 }
 
+TEST_F(TestFileOutputStream, WriteV) {
+  OpenFile();
+
+  // More regions than a single writev() call accepts, some of them empty
+  std::string data;
+  for (int i = 0; i < 3000; ++i) {
+    data += std::string(i % 7, static_cast<char>('a' + i % 26));
+  }
+  std::vector<WriteRegion> regions;
+  int64_t position = 0;
+  for (int i = 0; i < 3000; ++i) {
+    regions.push_back({data.data() + position, i % 7});
+    position += i % 7;
+  }
+  ASSERT_OK(file_->WriteV(regions));
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), position);
+
+  ASSERT_OK(file_->WriteV({}));
+  ASSERT_RAISES(IOError, file_->WriteV({{data.data(), -1}}));
+  ASSERT_OK(file_->Close());
+  AssertFileContents(path_, data);
+
+  ASSERT_RAISES(Invalid, file_->WriteV(regions));
+}
+
 TEST_F(TestFileOutputStream, Tell) {
   OpenFile();
 
@@ -513,6 +539,75 @@ TEST_F(TestReadableFile, CustomMemoryPool) {
   ASSERT_EQ(2, pool.num_allocations());
 }
 
+TEST_F(TestReadableFile, ReadRanges) {
+  MakeTestFile();
+  OpenFile();
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file_->ReadRanges({{4, 4}, {0, 4}, {2, 0}, {6, 10}, {20, 5}}, &buffers));
+  ASSERT_EQ(buffers.size(), 5);
+  ASSERT_EQ(buffers[0]->ToString(), "data");
+  ASSERT_EQ(buffers[1]->ToString(), "test");
+  ASSERT_EQ(buffers[2]->size(), 0);
+  ASSERT_EQ(buffers[3]->ToString(), "ta");
+  ASSERT_EQ(buffers[4]->size(), 0);
+
+  // More ranges than fit in a single batch
+  std::vector<ReadRange> ranges;
+  for (int64_t i = 0; i < 200; ++i) {
+    ranges.push_back({i % 8, 1});
+  }
+  ASSERT_OK(file_->ReadRanges(ranges, &buffers));
+  ASSERT_EQ(buffers.size(), 200);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    ASSERT_EQ(buffers[i]->ToString(), std::string(1, "testdata"[i % 8]));
+  }
+
+  ASSERT_RAISES(Invalid, file_->ReadRanges({{-1, 2}}, &buffers));
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadRanges({{0, 2}}, &buffers));
+}
+
+TEST_F(TestReadableFile, DirectIO) {
+  std::string data;
+  for (int i = 0; i < 10000; ++i) {
+    data.push_back(static_cast<char>('a' + i % 26));
+  }
+  {
+    std::ofstream stream(path_.c_str());
+    stream << data;
+  }
+
+  ReadableFileOptions options;
+  options.direct_io = true;
+  Status st = ReadableFile::Open(path_, default_memory_pool(), options, &file_);
+  if (!st.ok()) {
+    // Not every platform and filesystem supports direct I/O
+    return;
+  }
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file_->ReadRanges({{1, 5}, {4090, 20}, {9000, 2000}}, &buffers));
+  ASSERT_EQ(buffers[0]->ToString(), data.substr(1, 5));
+  ASSERT_EQ(buffers[1]->ToString(), data.substr(4090, 20));
+  ASSERT_EQ(buffers[2]->ToString(), data.substr(9000));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(4095, 3, &buffer));
+  ASSERT_EQ(buffer->ToString(), data.substr(4095, 3));
+
+  ASSERT_OK(file_->Seek(3));
+  ASSERT_OK(file_->Read(4, &buffer));
+  ASSERT_EQ(buffer->ToString(), data.substr(3, 4));
+  uint8_t out[4];
+  int64_t bytes_read;
+  ASSERT_OK(file_->Read(4, &bytes_read, out));
+  ASSERT_EQ(std::string(reinterpret_cast<char*>(out), 4), data.substr(7, 4));
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(position, 11);
+}
+
 TEST_F(TestReadableFile, ThreadSafety) {
   std::string data = "foobar";
   {
@@ -976,6 +1071,38 @@ TEST_F(TestMemoryMappedFile, WriteAtBeyondEnd) {
   ASSERT_EQ(position, 0);
 }
 
+TEST_F(TestMemoryMappedFile, MutableSliceAt) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-mutable-slice-test";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+
+  std::shared_ptr<Buffer> slice;
+  ASSERT_OK(result->MutableSliceAt(100, 200, &slice));
+  ASSERT_TRUE(slice->is_mutable());
+  ASSERT_EQ(200, slice->size());
+  memcpy(slice->mutable_data(), buffer.data(), 200);
+
+  // The position is unchanged and the slice prevents resizing
+  int64_t position;
+  ASSERT_OK(result->Tell(&position));
+  ASSERT_EQ(0, position);
+  ASSERT_RAISES(IOError, result->Resize(2 * buffer_size));
+  slice.reset();
+
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(result->ReadAt(100, 200, &out_buffer));
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data(), 200));
+
+  ASSERT_RAISES(Invalid, result->MutableSliceAt(buffer_size - 1, 2, &slice));
+  ASSERT_OK(result->Close());
+  ASSERT_OK(MemoryMappedFile::Open(path, FileMode::READ, &result));
+  ASSERT_RAISES(IOError, result->MutableSliceAt(0, 1, &slice));
+}
+
 TEST_F(TestMemoryMappedFile, GetSize) {
   std::string path = "io-memory-map-get-size";
   std::shared_ptr<MemoryMappedFile> result;
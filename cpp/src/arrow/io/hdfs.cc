@@ -20,8 +20,10 @@
 #include <errno.h>
 #include <algorithm>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -120,16 +122,61 @@ Status GetPathInfoFailed(const std::string& path) {
 
 }  // namespace
 
+// A handle of the read pool of a file, closed with its last reference, which
+// may be held by a zero-copy buffer read through it
+class HdfsReadHandle {
+ public:
+  HdfsReadHandle(internal::LibHdfsShim* driver, hdfsFS fs, hdfsFile file)
+      : driver_(driver), fs_(fs), file_(file) {}
+
+  ~HdfsReadHandle() { driver_->CloseFile(fs_, file_); }
+
+  hdfsFile file() const { return file_; }
+
+ private:
+  internal::LibHdfsShim* driver_;
+  hdfsFS fs_;
+  hdfsFile file_;
+};
+
+// The result of a zero-copy read, released to the handle it was read with
+class HdfsZeroCopyBuffer : public Buffer {
+ public:
+  HdfsZeroCopyBuffer(internal::LibHdfsShim* driver,
+                     std::shared_ptr<HdfsReadHandle> handle, hadoopRzBuffer* buffer)
+      : Buffer(reinterpret_cast<const uint8_t*>(driver->RzBufferGet(buffer)),
+               driver->RzBufferLength(buffer)),
+        driver_(driver),
+        handle_(std::move(handle)),
+        buffer_(buffer) {}
+
+  ~HdfsZeroCopyBuffer() override { driver_->RzBufferFree(handle_->file(), buffer_); }
+
+ private:
+  internal::LibHdfsShim* driver_;
+  std::shared_ptr<HdfsReadHandle> handle_;
+  hadoopRzBuffer* buffer_;
+};
+
 // Private implementation for read-only files
 class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
   explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
 
+  ~HdfsReadableFileImpl() {
+    if (rz_options_ != nullptr) {
+      driver_->RzOptionsFree(rz_options_);
+    }
+  }
+
   Status Close() {
     if (is_open_) {
       int ret = driver_->CloseFile(fs_, file_);
       CHECK_FAILURE(ret, "CloseFile");
       is_open_ = false;
+
+      std::lock_guard<std::mutex> guard(pool_lock_);
+      idle_handles_.clear();
     }
     return Status::OK();
   }
@@ -137,21 +184,26 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   bool closed() const { return !is_open_; }
 
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* buffer) {
-    tSize ret;
-    if (driver_->HasPread()) {
-      ret = driver_->Pread(fs_, file_, static_cast<tOffset>(position),
-                           reinterpret_cast<void*>(buffer), static_cast<tSize>(nbytes));
-    } else {
+    if (use_read_pool_) {
+      std::shared_ptr<HdfsReadHandle> handle;
+      RETURN_NOT_OK(AcquireHandle(&handle));
+      Status st = PositionalRead(handle->file(), position, nbytes, bytes_read, buffer);
+      ReleaseHandle(std::move(handle));
+      return st;
+    }
+    if (!driver_->HasPread()) {
       std::lock_guard<std::mutex> guard(lock_);
       RETURN_NOT_OK(Seek(position));
       return Read(nbytes, bytes_read, buffer);
     }
-    CHECK_FAILURE(ret, "read");
-    *bytes_read = ret;
-    return Status::OK();
+    return PositionalRead(file_, position, nbytes, bytes_read, buffer);
   }
 
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (rz_options_ != nullptr) {
+      return ZeroCopyReadAt(position, nbytes, out);
+    }
+
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -168,20 +220,7 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) {
-    int64_t total_bytes = 0;
-    while (total_bytes < nbytes) {
-      tSize ret = driver_->Read(
-          fs_, file_, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
-          static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
-      CHECK_FAILURE(ret, "read");
-      total_bytes += ret;
-      if (ret == 0) {
-        break;
-      }
-    }
-
-    *bytes_read = total_bytes;
-    return Status::OK();
+    return StreamRead(file_, nbytes, bytes_read, buffer);
   }
 
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
@@ -211,13 +250,179 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
 
   void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
 
-  void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
+  Status set_read_options(const HdfsReadOptions& options) {
+    buffer_size_ = options.buffer_size;
+    max_read_handles_ = std::max(1, options.max_read_handles);
+    use_read_pool_ = options.max_read_handles > 1;
+    if (options.zero_copy && driver_->HasReadZero()) {
+      // Zero-copy reads move the position of their handle, so they always
+      // go through the pool
+      use_read_pool_ = true;
+      rz_options_ = driver_->RzOptionsAlloc();
+      if (rz_options_ == nullptr) {
+        return Status::IOError("HDFS zero-copy read options allocation failed, errno: ",
+                               TranslateErrno(errno));
+      }
+      int ret = driver_->RzOptionsSetSkipChecksum(
+          rz_options_, static_cast<int>(options.zero_copy_skip_checksum));
+      CHECK_FAILURE(ret, "zero-copy read options");
+    }
+    return Status::OK();
+  }
 
  private:
+  Status StreamRead(hdfsFile file, int64_t nbytes, int64_t* bytes_read, void* buffer) {
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      tSize ret = driver_->Read(
+          fs_, file, reinterpret_cast<uint8_t*>(buffer) + total_bytes,
+          static_cast<tSize>(std::min<int64_t>(buffer_size_, nbytes - total_bytes)));
+      CHECK_FAILURE(ret, "read");
+      total_bytes += ret;
+      if (ret == 0) {
+        break;
+      }
+    }
+
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  // Read with pread if possible, else by seeking the handle, which must then
+  // not be shared.  Loops over short reads, which hdfsPread returns at block
+  // boundaries.
+  Status PositionalRead(hdfsFile file, int64_t position, int64_t nbytes,
+                        int64_t* bytes_read, void* buffer) {
+    if (!driver_->HasPread()) {
+      int ret = driver_->Seek(fs_, file, static_cast<tOffset>(position));
+      CHECK_FAILURE(ret, "seek");
+      return StreamRead(file, nbytes, bytes_read, buffer);
+    }
+    int64_t total_bytes = 0;
+    while (total_bytes < nbytes) {
+      tSize ret = driver_->Pread(
+          fs_, file, static_cast<tOffset>(position + total_bytes),
+          reinterpret_cast<uint8_t*>(buffer) + total_bytes,
+          static_cast<tSize>(std::min<int64_t>(kMaxHdfsReadSize, nbytes - total_bytes)));
+      CHECK_FAILURE(ret, "read");
+      total_bytes += ret;
+      if (ret == 0) {
+        break;
+      }
+    }
+    *bytes_read = total_bytes;
+    return Status::OK();
+  }
+
+  // Read a buffer of the client if it can map the data at position, which
+  // it can't when the block isn't local.  The data past the first mapped
+  // block, or all of it if none could be mapped, is copied.
+  Status ZeroCopyReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<HdfsReadHandle> handle;
+    RETURN_NOT_OK(AcquireHandle(&handle));
+    Status st = ZeroCopyReadAt(handle, position, nbytes, out);
+    ReleaseHandle(std::move(handle));
+    return st;
+  }
+
+  Status ZeroCopyReadAt(const std::shared_ptr<HdfsReadHandle>& handle, int64_t position,
+                        int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    int ret = driver_->Seek(fs_, handle->file(), static_cast<tOffset>(position));
+    CHECK_FAILURE(ret, "seek");
+
+    std::shared_ptr<Buffer> mapped;
+    errno = 0;
+    hadoopRzBuffer* rz_buffer = driver_->ReadZero(
+        handle->file(), rz_options_,
+        static_cast<int32_t>(std::min<int64_t>(kMaxHdfsReadSize, nbytes)));
+    if (rz_buffer != nullptr) {
+      mapped = std::make_shared<HdfsZeroCopyBuffer>(driver_, handle, rz_buffer);
+      if (mapped->data() == nullptr || mapped->size() == nbytes) {
+        // At EOF, or all of the data
+        *out = mapped->data() == nullptr ? std::make_shared<Buffer>(nullptr, 0) : mapped;
+        return Status::OK();
+      }
+    } else if (errno != EOPNOTSUPP) {
+      return Status::IOError("HDFS zero-copy read failed, errno: ",
+                             TranslateErrno(errno));
+    }
+
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t copied = 0;
+    if (mapped != nullptr) {
+      copied = mapped->size();
+      std::memcpy(buffer->mutable_data(), mapped->data(), copied);
+      mapped.reset();
+    }
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(PositionalRead(handle->file(), position + copied, nbytes - copied,
+                                 &bytes_read, buffer->mutable_data() + copied));
+    if (copied + bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(copied + bytes_read));
+      buffer->ZeroPadding();
+    }
+    *out = buffer;
+    return Status::OK();
+  }
+
+  // Take an idle handle of the pool, opening one unless there are already
+  // max_read_handles_, in which case wait for one to be released
+  Status AcquireHandle(std::shared_ptr<HdfsReadHandle>* out) {
+    std::unique_lock<std::mutex> guard(pool_lock_);
+    pool_cv_.wait(guard, [this] {
+      return !idle_handles_.empty() || num_handles_ < max_read_handles_;
+    });
+    if (!idle_handles_.empty()) {
+      *out = std::move(idle_handles_.back());
+      idle_handles_.pop_back();
+      return Status::OK();
+    }
+    ++num_handles_;
+    guard.unlock();
+
+    hdfsFile file = driver_->OpenFile(fs_, path_.c_str(), O_RDONLY, buffer_size_, 0, 0);
+    if (file == nullptr) {
+      guard.lock();
+      --num_handles_;
+      pool_cv_.notify_one();
+      return Status::IOError("HDFS opening read handle failed for ", path_,
+                             ", errno: ", TranslateErrno(errno));
+    }
+    *out = std::make_shared<HdfsReadHandle>(driver_, fs_, file);
+    return Status::OK();
+  }
+
+  void ReleaseHandle(std::shared_ptr<HdfsReadHandle> handle) {
+    std::lock_guard<std::mutex> guard(pool_lock_);
+    if (is_open_) {
+      idle_handles_.push_back(std::move(handle));
+    } else {
+      --num_handles_;
+    }
+    pool_cv_.notify_one();
+  }
+
+  // The limit of the tSize length of a single libhdfs read
+  static constexpr int64_t kMaxHdfsReadSize = std::numeric_limits<int32_t>::max();
+
   MemoryPool* pool_;
-  int32_t buffer_size_;
+  int32_t buffer_size_ = kDefaultHdfsBufferSize;
+
+  // The pool of handles of ReadAt
+  bool use_read_pool_ = false;
+  int max_read_handles_ = 1;
+  int num_handles_ = 0;
+  std::vector<std::shared_ptr<HdfsReadHandle>> idle_handles_;
+  std::mutex pool_lock_;
+  std::condition_variable pool_cv_;
+
+  // Non-null if ReadAt is zero-copy
+  hadoopRzOptions* rz_options_ = nullptr;
 };
 
+constexpr int64_t HdfsReadableFile::HdfsReadableFileImpl::kMaxHdfsReadSize;
+
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
   if (pool == nullptr) {
     pool = default_memory_pool();
@@ -358,6 +563,19 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
 
+    if (!config->domain_socket_path.empty()) {
+      RETURN_NOT_OK(SetConf(builder, "dfs.client.read.shortcircuit", "true"));
+      RETURN_NOT_OK(
+          SetConf(builder, "dfs.domain.socket.path", config->domain_socket_path));
+    }
+    if (config->hedged_read_threadpool_size > 0) {
+      RETURN_NOT_OK(SetConf(builder, "dfs.client.hedged.read.threadpool.size",
+                            std::to_string(config->hedged_read_threadpool_size)));
+      RETURN_NOT_OK(SetConf(builder, "dfs.client.hedged.read.threshold.millis",
+                            std::to_string(config->hedged_read_threshold_ms)));
+    }
+
+    // Set last, to take precedence over the above
     for (auto& kv : config->extra_conf) {
       int ret = driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
       CHECK_FAILURE(ret, "confsetstr");
@@ -377,6 +595,12 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     return Status::OK();
   }
 
+  Status SetConf(hdfsBuilder* builder, const char* key, const std::string& value) {
+    int ret = driver_->BuilderConfSetStr(builder, key, value.c_str());
+    CHECK_FAILURE(ret, "confsetstr");
+    return Status::OK();
+  }
+
   Status MakeDirectory(const std::string& path) {
     int ret = driver_->MakeDirectory(fs_, path.c_str());
     CHECK_FAILURE(ret, "create directory");
@@ -483,9 +707,10 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     return Status::OK();
   }
 
-  Status OpenReadable(const std::string& path, int32_t buffer_size,
+  Status OpenReadable(const std::string& path, const HdfsReadOptions& options,
                       std::shared_ptr<HdfsReadableFile>* file) {
-    hdfsFile handle = driver_->OpenFile(fs_, path.c_str(), O_RDONLY, buffer_size, 0, 0);
+    hdfsFile handle =
+        driver_->OpenFile(fs_, path.c_str(), O_RDONLY, options.buffer_size, 0, 0);
 
     if (handle == nullptr) {
       const char* msg = !Exists(path) ? "HDFS file does not exist: "
@@ -496,7 +721,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     // std::make_shared does not work with private ctors
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
-    (*file)->impl_->set_buffer_size(buffer_size);
+    return (*file)->impl_->set_read_options(options);
 
     return Status::OK();
   }
@@ -609,7 +834,9 @@ Status HadoopFileSystem::ListDirectory(const std::string& path,
 
 Status HadoopFileSystem::OpenReadable(const std::string& path, int32_t buffer_size,
                                       std::shared_ptr<HdfsReadableFile>* file) {
-  return impl_->OpenReadable(path, buffer_size, file);
+  HdfsReadOptions options;
+  options.buffer_size = buffer_size;
+  return impl_->OpenReadable(path, options, file);
 }
 
 Status HadoopFileSystem::OpenReadable(const std::string& path,
@@ -617,6 +844,12 @@ Status HadoopFileSystem::OpenReadable(const std::string& path,
   return OpenReadable(path, kDefaultHdfsBufferSize, file);
 }
 
+Status HadoopFileSystem::OpenReadable(const std::string& path,
+                                      const HdfsReadOptions& options,
+                                      std::shared_ptr<HdfsReadableFile>* file) {
+  return impl_->OpenReadable(path, options, file);
+}
+
 Status HadoopFileSystem::OpenWritable(const std::string& path, bool append,
                                       int32_t buffer_size, int16_t replication,
                                       int64_t default_block_size,
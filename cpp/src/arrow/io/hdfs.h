@@ -66,6 +66,37 @@ struct HdfsConnectionConfig {
   std::string kerb_ticket;
   std::unordered_map<std::string, std::string> extra_conf;
   HdfsDriver driver;
+
+  // The domain socket through which the client reads the blocks stored on the
+  // local DataNode directly from its disks (short-circuit local reads).
+  // Empty to read through the DataNode.
+  std::string domain_socket_path;
+
+  // The number of threads of the client's hedged reads: a block read taking
+  // longer than hedged_read_threshold_ms is also sent to another replica, and
+  // the first response is used.  0 to disable hedged reads.
+  int hedged_read_threadpool_size = 0;
+  int64_t hedged_read_threshold_ms = 500;
+};
+
+// Options of HadoopFileSystem::OpenReadable
+struct HdfsReadOptions {
+  // The buffer size of the file handles
+  int32_t buffer_size = 1 << 16;
+
+  // The number of handles to the file that concurrent ReadAt calls can use.
+  // With 1, ReadAt shares the handle of Read and Seek, without serializing
+  // only if the driver supports positional reads.  With more, each ReadAt
+  // call takes a handle of its own from a pool, opening it on first use.
+  int max_read_handles = 1;
+
+  // Make ReadAt return buffers mapping the data of the client, without
+  // copying, when it supports it (libhdfs with short-circuit local reads).
+  // Such a buffer keeps a handle of the pool open until released.
+  bool zero_copy = false;
+
+  // Skip the verification of checksums in zero-copy reads
+  bool zero_copy_skip_checksum = false;
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -151,6 +182,9 @@ class ARROW_EXPORT HadoopFileSystem : public FileSystem {
 
   Status OpenReadable(const std::string& path, std::shared_ptr<HdfsReadableFile>* file);
 
+  Status OpenReadable(const std::string& path, const HdfsReadOptions& options,
+                      std::shared_ptr<HdfsReadableFile>* file);
+
   // FileMode::WRITE options
   // @param path complete file path
   // @param buffer_size, 0 for default
@@ -194,7 +228,9 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
   Status GetSize(int64_t* size) override;
 
   // NOTE: If you wish to read a particular range of a file in a multithreaded
-  // context, you may prefer to use ReadAt to avoid locking issues
+  // context, you may prefer to use ReadAt to avoid locking issues, opening the
+  // file with HdfsReadOptions::max_read_handles > 1 if the driver does not
+  // support positional reads
   Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override;
 
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
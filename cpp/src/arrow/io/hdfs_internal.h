@@ -90,6 +90,16 @@ struct LibHdfsShim {
   int (*hdfsChmod)(hdfsFS fs, const char* path, short mode);  // NOLINT
   int (*hdfsUtime)(hdfsFS fs, const char* path, tTime mtime, tTime atime);
 
+  // Zero-copy reads, only in libhdfs
+  hadoopRzOptions* (*hadoopRzOptionsAlloc)(void);
+  int (*hadoopRzOptionsSetSkipChecksum)(hadoopRzOptions* opts, int skip);
+  void (*hadoopRzOptionsFree)(hadoopRzOptions* opts);
+  hadoopRzBuffer* (*hadoopReadZero)(hdfsFile file, hadoopRzOptions* opts,
+                                    int32_t maxLength);
+  int32_t (*hadoopRzBufferLength)(const hadoopRzBuffer* buffer);
+  const void* (*hadoopRzBufferGet)(const hadoopRzBuffer* buffer);
+  void (*hadoopRzBufferFree)(hdfsFile file, hadoopRzBuffer* buffer);
+
   void Initialize() {
     this->handle = nullptr;
     this->hdfsNewBuilder = nullptr;
@@ -130,6 +140,13 @@ struct LibHdfsShim {
     this->hdfsChown = nullptr;
     this->hdfsChmod = nullptr;
     this->hdfsUtime = nullptr;
+    this->hadoopRzOptionsAlloc = nullptr;
+    this->hadoopRzOptionsSetSkipChecksum = nullptr;
+    this->hadoopRzOptionsFree = nullptr;
+    this->hadoopReadZero = nullptr;
+    this->hadoopRzBufferLength = nullptr;
+    this->hadoopRzBufferGet = nullptr;
+    this->hadoopRzBufferFree = nullptr;
   }
 
   hdfsBuilder* NewBuilder(void);
@@ -210,6 +227,22 @@ struct LibHdfsShim {
 
   int Utime(hdfsFS fs, const char* path, tTime mtime, tTime atime);
 
+  bool HasReadZero();
+
+  hadoopRzOptions* RzOptionsAlloc();
+
+  int RzOptionsSetSkipChecksum(hadoopRzOptions* opts, int skip);
+
+  void RzOptionsFree(hadoopRzOptions* opts);
+
+  hadoopRzBuffer* ReadZero(hdfsFile file, hadoopRzOptions* opts, int32_t maxLength);
+
+  int32_t RzBufferLength(const hadoopRzBuffer* buffer);
+
+  const void* RzBufferGet(const hadoopRzBuffer* buffer);
+
+  void RzBufferFree(hdfsFile file, hadoopRzBuffer* buffer);
+
   Status GetRequiredSymbols();
 };
 
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdlib>
@@ -506,5 +507,55 @@ TYPED_TEST(TestHadoopFileSystem, ThreadSafety) {
   ASSERT_EQ(niter * 4, correct_count);
 }
 
+TYPED_TEST(TestHadoopFileSystem, ReadAtWithHandlePool) {
+  SKIP_IF_NO_DRIVER();
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("handle-pool");
+  const int size = 1000000;
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  for (bool zero_copy : {false, true}) {
+    HdfsReadOptions options;
+    options.max_read_handles = 3;
+    options.zero_copy = zero_copy;
+    std::shared_ptr<HdfsReadableFile> file;
+    ASSERT_OK(this->client_->OpenReadable(path, options, &file));
+
+    std::atomic<int> correct_count(0);
+    const int niter = 100;
+    auto ReadData = [&](int thread_index) {
+      for (int i = 0; i < niter; ++i) {
+        const int64_t position = (thread_index * 7919 + i * 104729) % size;
+        std::shared_ptr<Buffer> buffer;
+        ASSERT_OK(file->ReadAt(position, 5000, &buffer));
+        const int64_t expected_size = std::min<int64_t>(5000, size - position);
+        if (buffer->size() == expected_size &&
+            0 == memcmp(data.data() + position, buffer->data(), expected_size)) {
+          correct_count += 1;
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 5; ++i) {
+      threads.emplace_back(ReadData, i);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(niter * 5, correct_count);
+
+    // The stream position is independent of the handles of ReadAt
+    uint8_t buffer[10];
+    int64_t bytes_read = 0;
+    ASSERT_OK(file->Read(10, &bytes_read, buffer));
+    ASSERT_EQ(10, bytes_read);
+    ASSERT_EQ(0, std::memcmp(buffer, data.data(), 10));
+    ASSERT_OK(file->Close());
+  }
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -68,10 +68,22 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+Status RandomAccessFile::WillNeed(
+    const std::vector<ReadRange>& ARROW_ARG_UNUSED(ranges)) {
+  return Status::OK();
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
 
+Status Writable::WriteV(const std::vector<WriteRegion>& regions) {
+  for (const auto& region : regions) {
+    RETURN_NOT_OK(Write(region.data, region.nbytes));
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 class FileSegmentReader : public InputStream {
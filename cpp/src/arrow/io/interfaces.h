@@ -42,6 +42,23 @@ struct ObjectType {
   enum type { FILE, DIRECTORY };
 };
 
+/// \brief A contiguous range of bytes in a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+
+  bool operator==(const ReadRange& other) const {
+    return offset == other.offset && length == other.length;
+  }
+  bool operator!=(const ReadRange& other) const { return !(*this == other); }
+};
+
+/// \brief A contiguous region of memory to write
+struct ARROW_EXPORT WriteRegion {
+  const void* data;
+  int64_t nbytes;
+};
+
 struct ARROW_EXPORT FileStatistics {
   /// Size of file, -1 if finding length is unsupported
   int64_t size;
@@ -94,6 +111,12 @@ class ARROW_EXPORT Writable {
 
   virtual Status Write(const void* data, int64_t nbytes) = 0;
 
+  /// \brief Write several regions of memory, in order
+  ///
+  /// Equivalent to calling Write() on each region. Streams over a file
+  /// descriptor write them with as few gather system calls as possible.
+  virtual Status WriteV(const std::vector<WriteRegion>& regions);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -179,6 +202,16 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// retrieved by calling Buffer::size().
   virtual Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out);
 
+  /// \brief Inform the file that the given ranges will be read soon.
+  ///
+  /// Implementations for high-latency storage may start fetching the ranges
+  /// in the background, so that later ReadAt() calls within them do not
+  /// wait. The default implementation does nothing.
+  ///
+  /// \param[in] ranges The ranges, in any order
+  /// \return Status
+  virtual Status WillNeed(const std::vector<ReadRange>& ranges);
+
  protected:
   RandomAccessFile();
 
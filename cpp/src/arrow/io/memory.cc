@@ -380,5 +380,133 @@ Status BufferReader::Seek(int64_t position) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// In-memory reader over a sequence of buffers
+
+ChunkedBufferReader::ChunkedBufferReader(const BufferVector& chunks, MemoryPool* pool)
+    : pool_(pool), size_(0), position_(0), is_open_(true) {
+  for (const auto& chunk : chunks) {
+    // Empty chunks would make FindChunk ambiguous
+    if (chunk->size() > 0) {
+      chunks_.push_back(chunk);
+      chunk_offsets_.push_back(size_);
+      size_ += chunk->size();
+    }
+  }
+}
+
+Status ChunkedBufferReader::Close() {
+  is_open_ = false;
+  return Status::OK();
+}
+
+bool ChunkedBufferReader::closed() const { return !is_open_; }
+
+Status ChunkedBufferReader::CheckClosed() const {
+  if (!is_open_) {
+    return Status::Invalid("Operation forbidden on closed ChunkedBufferReader");
+  }
+  return Status::OK();
+}
+
+size_t ChunkedBufferReader::FindChunk(int64_t position) const {
+  auto it = std::upper_bound(chunk_offsets_.begin(), chunk_offsets_.end(), position);
+  return static_cast<size_t>(it - chunk_offsets_.begin()) - 1;
+}
+
+Status ChunkedBufferReader::Tell(int64_t* position) const {
+  RETURN_NOT_OK(CheckClosed());
+  *position = position_;
+  return Status::OK();
+}
+
+bool ChunkedBufferReader::supports_zero_copy() const { return true; }
+
+Status ChunkedBufferReader::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                                   void* buffer) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (nbytes < 0) {
+    return Status::IOError(
+        "Cannot read a negative number of bytes from ChunkedBufferReader.");
+  }
+  *bytes_read = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+  if (*bytes_read == 0) {
+    return Status::OK();
+  }
+  auto out = reinterpret_cast<uint8_t*>(buffer);
+  int64_t remaining = *bytes_read;
+  for (size_t i = FindChunk(position); remaining > 0; ++i) {
+    const int64_t chunk_position = position - chunk_offsets_[i];
+    const int64_t length = std::min(remaining, chunks_[i]->size() - chunk_position);
+    memcpy(out, chunks_[i]->data() + chunk_position, static_cast<size_t>(length));
+    out += length;
+    position += length;
+    remaining -= length;
+  }
+  return Status::OK();
+}
+
+Status ChunkedBufferReader::ReadAt(int64_t position, int64_t nbytes,
+                                   std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (nbytes < 0) {
+    return Status::IOError(
+        "Cannot read a negative number of bytes from ChunkedBufferReader.");
+  }
+  const int64_t size = std::max<int64_t>(0, std::min(nbytes, size_ - position));
+  if (size == 0) {
+    *out = std::make_shared<Buffer>(nullptr, 0);
+    return Status::OK();
+  }
+
+  const size_t i = FindChunk(position);
+  const int64_t chunk_position = position - chunk_offsets_[i];
+  if (chunk_position + size <= chunks_[i]->size()) {
+    *out = SliceBuffer(chunks_[i], chunk_position, size);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(pool_, size, &buffer));
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(ReadAt(position, size, &bytes_read, buffer->mutable_data()));
+  DCHECK_EQ(bytes_read, size);
+  *out = std::move(buffer);
+  return Status::OK();
+}
+
+Status ChunkedBufferReader::Read(int64_t nbytes, int64_t* bytes_read, void* buffer) {
+  RETURN_NOT_OK(CheckClosed());
+  RETURN_NOT_OK(ReadAt(position_, nbytes, bytes_read, buffer));
+  position_ += *bytes_read;
+  return Status::OK();
+}
+
+Status ChunkedBufferReader::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(CheckClosed());
+  RETURN_NOT_OK(ReadAt(position_, nbytes, out));
+  position_ += (*out)->size();
+  return Status::OK();
+}
+
+Status ChunkedBufferReader::GetSize(int64_t* size) {
+  RETURN_NOT_OK(CheckClosed());
+  *size = size_;
+  return Status::OK();
+}
+
+Status ChunkedBufferReader::Seek(int64_t position) {
+  RETURN_NOT_OK(CheckClosed());
+
+  if (position < 0 || position > size_) {
+    return Status::IOError("Seek out of bounds");
+  }
+
+  position_ = position;
+  return Status::OK();
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
@@ -168,5 +169,49 @@ class ARROW_EXPORT BufferReader : public RandomAccessFile {
   bool is_open_;
 };
 
+/// \brief Random access reads on a sequence of buffers, as if they were
+/// concatenated.
+///
+/// Reads are zero-copy when they fall within a single buffer; only reads
+/// spanning several buffers are copied into a new allocation
+class ARROW_EXPORT ChunkedBufferReader : public RandomAccessFile {
+ public:
+  explicit ChunkedBufferReader(const BufferVector& chunks,
+                               MemoryPool* pool = default_memory_pool());
+
+  Status Close() override;
+  bool closed() const override;
+  Status Tell(int64_t* position) const override;
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override;
+  // Zero copy read, unless the range spans several chunks
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  bool supports_zero_copy() const override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status GetSize(int64_t* size) override;
+  Status Seek(int64_t position) override;
+
+  const BufferVector& chunks() const { return chunks_; }
+
+ protected:
+  inline Status CheckClosed() const;
+
+  // Index of the chunk holding the given position, which must be less than
+  // the total size
+  size_t FindChunk(int64_t position) const;
+
+  BufferVector chunks_;
+  // chunk_offsets_[i] is the position of the first byte of chunks_[i]
+  std::vector<int64_t> chunk_offsets_;
+  MemoryPool* pool_;
+  int64_t size_;
+  int64_t position_;
+  bool is_open_;
+};
+
 }  // namespace io
 }  // namespace arrow
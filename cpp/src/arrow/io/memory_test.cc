@@ -218,6 +218,63 @@ TEST(TestBufferReader, RetainParentReference) {
   ASSERT_EQ(0, std::memcmp(slice2->data(), data.c_str() + 4, 6));
 }
 
+TEST(TestChunkedBufferReader, ReadAt) {
+  std::string data = "data1data2data3";
+  auto buffer = std::make_shared<Buffer>(data);
+  BufferVector chunks = {SliceBuffer(buffer, 0, 5), SliceBuffer(buffer, 5, 0),
+                         SliceBuffer(buffer, 5, 3), SliceBuffer(buffer, 8, 7)};
+
+  ChunkedBufferReader reader(chunks);
+  int64_t size;
+  ASSERT_OK(reader.GetSize(&size));
+  ASSERT_EQ(static_cast<int64_t>(data.size()), size);
+
+  // Ranges within a chunk are zero-copy
+  std::shared_ptr<Buffer> piece;
+  ASSERT_OK(reader.ReadAt(1, 3, &piece));
+  ASSERT_EQ(chunks[0]->data() + 1, piece->data());
+  ASSERT_EQ("ata", piece->ToString());
+  ASSERT_OK(reader.ReadAt(5, 3, &piece));
+  ASSERT_EQ(chunks[2]->data(), piece->data());
+
+  // Ranges spanning chunks are copied
+  ASSERT_OK(reader.ReadAt(3, 9, &piece));
+  ASSERT_EQ(data.substr(3, 9), piece->ToString());
+  ASSERT_OK(reader.ReadAt(12, 10, &piece));
+  ASSERT_EQ(data.substr(12), piece->ToString());
+  ASSERT_OK(reader.ReadAt(15, 1, &piece));
+  ASSERT_EQ(0, piece->size());
+
+  char out[16];
+  int64_t bytes_read;
+  ASSERT_OK(reader.ReadAt(0, 16, &bytes_read, out));
+  ASSERT_EQ(15, bytes_read);
+  ASSERT_EQ(data, std::string(out, 15));
+}
+
+TEST(TestChunkedBufferReader, Read) {
+  std::string data = "data1data2data3";
+  auto buffer = std::make_shared<Buffer>(data);
+  ChunkedBufferReader reader({SliceBuffer(buffer, 0, 7), SliceBuffer(buffer, 7, 8)});
+
+  std::shared_ptr<Buffer> piece;
+  ASSERT_OK(reader.Read(4, &piece));
+  ASSERT_EQ("data", piece->ToString());
+  ASSERT_OK(reader.Read(6, &piece));
+  ASSERT_EQ("1data2", piece->ToString());
+
+  int64_t pos;
+  ASSERT_OK(reader.Tell(&pos));
+  ASSERT_EQ(10, pos);
+  ASSERT_RAISES(IOError, reader.Seek(16));
+  ASSERT_OK(reader.Seek(15));
+  ASSERT_OK(reader.Read(4, &piece));
+  ASSERT_EQ(0, piece->size());
+
+  ASSERT_OK(reader.Close());
+  ASSERT_RAISES(Invalid, reader.Read(4, &piece));
+}
+
 TEST(TestRandomAccessFile, GetStream) {
   std::string data = "data1data2data3data4data5";
 
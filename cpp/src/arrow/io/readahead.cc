@@ -17,20 +17,23 @@
 
 #include "arrow/io/readahead.h"
 
+#include <algorithm>
 #include <condition_variable>
 #include <cstring>
 #include <deque>
+#include <future>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <utility>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
+#include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -43,7 +46,8 @@ class ReadaheadSpooler::Impl {
  public:
   Impl(MemoryPool* pool, std::shared_ptr<InputStream> raw, int64_t read_size,
        int32_t readahead_queue_size, int64_t left_padding, int64_t right_padding)
-      : pool_(pool),
+      // Blocks of read_size are allocated and freed in a steady stream
+      : pool_(scratch_memory_pool(pool)),
         raw_(raw),
         read_size_(read_size),
         readahead_queue_size_(readahead_queue_size),
@@ -52,7 +56,8 @@ class ReadaheadSpooler::Impl {
     DCHECK_NE(raw, nullptr);
     DCHECK_GT(read_size, 0);
     DCHECK_GT(readahead_queue_size, 0);
-    io_worker_ = std::thread([&]() { WorkerLoop(); });
+    std::unique_lock<std::mutex> lock(mutex_);
+    ScheduleReadsUnlocked();
   }
 
   ~Impl() { ARROW_UNUSED(Close()); }
@@ -60,13 +65,10 @@ class ReadaheadSpooler::Impl {
   Status Close() {
     std::unique_lock<std::mutex> lock(mutex_);
     please_close_ = true;
-    io_wakeup_.notify_one();
-    // Wait for IO thread to finish
-    if (io_worker_.joinable()) {
-      lock.unlock();
-      io_worker_.join();
-      lock.lock();
-    }
+    // Wait for the background reads to finish
+    io_progress_.wait(lock, [this]() { return !reading_; });
+    eof_ = true;
+    io_progress_.notify_all();
     return Status::OK();
   }
 
@@ -79,7 +81,7 @@ class ReadaheadSpooler::Impl {
         DCHECK_NE(out->buffer, nullptr);
         buffer_queue_.pop_front();
         // Need to fill up queue again
-        io_wakeup_.notify_one();
+        ScheduleReadsUnlocked();
         return Status::OK();
       }
       if (!read_status_.ok()) {
@@ -116,44 +118,50 @@ class ReadaheadSpooler::Impl {
   }
 
  protected:
-  // The background thread's main function
-  void WorkerLoop() {
-    std::unique_lock<std::mutex> lock(mutex_);
-    Status st;
+  // Start filling up the readahead queue on the I/O thread pool, unless it is
+  // already being filled.  Requires the mutex.
+  void ScheduleReadsUnlocked() {
+    if (reading_ || please_close_ || eof_ || !read_status_.ok() ||
+        buffer_queue_.size() >= static_cast<size_t>(readahead_queue_size_)) {
+      return;
+    }
+    reading_ = true;
+    Status st = ::arrow::internal::GetIOThreadPool()->Spawn([this]() { ReadTask(); });
+    if (!st.ok()) {
+      reading_ = false;
+      read_status_ = st;
+      io_progress_.notify_all();
+    }
+  }
 
-    while (true) {
+  // The background task, reading until the queue is full.  It never waits
+  // for Read() calls, so as not to hold up a worker of the shared pool.
+  void ReadTask() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (buffer_queue_.size() < static_cast<size_t>(readahead_queue_size_)) {
       if (please_close_) {
-        goto eof;
+        eof_ = true;
+        break;
       }
-      // Fill up readahead queue until desired size
-      while (buffer_queue_.size() < static_cast<size_t>(readahead_queue_size_)) {
-        ReadaheadBuffer buf = {nullptr, left_padding_, right_padding_};
-        lock.unlock();
-        Status st = ReadOneBufferUnlocked(&buf);
-        lock.lock();
-        if (!st.ok()) {
-          read_status_ = st;
-          goto error;
-        }
-        // Close() could have been called while unlocked above
-        if (please_close_) {
-          goto eof;
-        }
-        // Got empty read?
-        if (buf.buffer->size() == buf.left_padding + buf.right_padding) {
-          goto eof;
-        }
-        buffer_queue_.push_back(std::move(buf));
-        io_progress_.notify_one();
+      ReadaheadBuffer buf = {nullptr, left_padding_, right_padding_};
+      lock.unlock();
+      Status st = ReadOneBufferUnlocked(&buf);
+      lock.lock();
+      if (!st.ok()) {
+        read_status_ = st;
+        break;
       }
-      // Wait for Close() or Read() call
-      io_wakeup_.wait(lock);
+      // Close() could have been called while unlocked above, or got empty read
+      if (please_close_ || buf.buffer->size() == buf.left_padding + buf.right_padding) {
+        eof_ = true;
+        break;
+      }
+      buffer_queue_.push_back(std::move(buf));
+      io_progress_.notify_all();
     }
-  eof:
-    eof_ = true;
-  error:
-    // Make sure any pending Read() doesn't block indefinitely
-    io_progress_.notify_one();
+    reading_ = false;
+    // Make sure any pending Read() or Close() doesn't block indefinitely
+    io_progress_.notify_all();
   }
 
   Status ReadOneBufferUnlocked(ReadaheadBuffer* buf) {
@@ -166,8 +174,9 @@ class ReadaheadSpooler::Impl {
     RETURN_NOT_OK(
         raw_->Read(read_size_, &bytes_read, buffer->mutable_data() + buf->left_padding));
     if (bytes_read < read_size_) {
-      // Got a short read
-      RETURN_NOT_OK(buffer->Resize(bytes_read + buf->left_padding + buf->right_padding));
+      // Got a short read, keep the region so that it can be recycled as is
+      RETURN_NOT_OK(buffer->Resize(bytes_read + buf->left_padding + buf->right_padding,
+                                   /*shrink_to_fit=*/false));
       DCHECK_NE(buffer->mutable_data(), nullptr);
     }
     // Zero padding areas
@@ -186,9 +195,8 @@ class ReadaheadSpooler::Impl {
   int64_t right_padding_ = 0;
 
   std::mutex mutex_;
-  std::condition_variable io_wakeup_;
   std::condition_variable io_progress_;
-  std::thread io_worker_;
+  bool reading_ = false;
   bool please_close_ = false;
   bool eof_ = false;
   std::deque<ReadaheadBuffer> buffer_queue_;
@@ -222,5 +230,233 @@ Status ReadaheadSpooler::Read(ReadaheadBuffer* out) { return impl_->Read(out); }
 ReadaheadSpooler::~ReadaheadSpooler() {}
 
 }  // namespace internal
+
+// ----------------------------------------------------------------------
+// AdaptiveReadaheadFile implementation
+
+AdaptiveReadaheadOptions AdaptiveReadaheadOptions::Defaults() {
+  return AdaptiveReadaheadOptions();
+}
+
+class AdaptiveReadaheadFile::Impl {
+ public:
+  Impl(std::shared_ptr<RandomAccessFile> raw, AdaptiveReadaheadOptions options,
+       ::arrow::internal::ThreadPool* executor)
+      : raw_(std::move(raw)),
+        options_(options),
+        executor_(executor),
+        window_(options.initial_window) {}
+
+  ~Impl() { DiscardPending(); }
+
+  Status Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DiscardPending();
+    buffer_.reset();
+    return raw_->Close();
+  }
+
+  bool closed() const { return raw_->closed(); }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    if (position < 0) {
+      return Status::Invalid("Cannot seek to negative position ", position);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer_ == nullptr || position < buffer_offset_ ||
+        position > buffer_offset_ + buffer_->size()) {
+      // Random access: the read ahead data is of no use
+      DiscardPending();
+      buffer_.reset();
+      window_ = options_.initial_window;
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return DoRead(nbytes, bytes_read, static_cast<uint8_t*>(out));
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (buffer_ != nullptr && position_ >= buffer_offset_ &&
+        position_ + nbytes <= buffer_offset_ + buffer_->size()) {
+      // Entirely within the current window
+      *out = SliceBuffer(buffer_, position_ - buffer_offset_, nbytes);
+      position_ += nbytes;
+      return Status::OK();
+    }
+
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buffer));
+    int64_t bytes_read;
+    RETURN_NOT_OK(DoRead(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = std::move(buffer);
+    return Status::OK();
+  }
+
+  RandomAccessFile* raw() const { return raw_.get(); }
+
+  int64_t window_size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return window_;
+  }
+
+ private:
+  using ReadFuture = std::future<Result<std::shared_ptr<Buffer>>>;
+
+  // Copy out of the windows until nbytes are read or the end of the file is
+  // reached.  Requires the mutex.
+  Status DoRead(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    *bytes_read = 0;
+    while (*bytes_read < nbytes) {
+      const int64_t buffer_end =
+          buffer_ == nullptr ? buffer_offset_ : buffer_offset_ + buffer_->size();
+      if (buffer_ == nullptr || position_ >= buffer_end) {
+        RETURN_NOT_OK(NextWindow());
+        if (buffer_->size() == 0) {
+          break;
+        }
+        continue;
+      }
+      const int64_t chunk = std::min(nbytes - *bytes_read, buffer_end - position_);
+      std::memcpy(out + *bytes_read, buffer_->data() + position_ - buffer_offset_,
+                  static_cast<size_t>(chunk));
+      *bytes_read += chunk;
+      position_ += chunk;
+    }
+    return Status::OK();
+  }
+
+  // Make the window at the current position current, and start reading the
+  // one after it.  Requires the mutex.
+  Status NextWindow() {
+    int64_t requested;
+    if (pending_.valid() && pending_offset_ == position_) {
+      // Sequential access: the window was read ahead
+      requested = pending_length_;
+      Result<std::shared_ptr<Buffer>> result = pending_.get();
+      RETURN_NOT_OK(result.status());
+      buffer_ = result.ValueOrDie();
+      window_ = std::min(window_ * options_.growth_factor, options_.max_window);
+    } else {
+      DiscardPending();
+      requested = window_;
+      RETURN_NOT_OK(raw_->ReadAt(position_, requested, &buffer_));
+    }
+    buffer_offset_ = position_;
+    pending_length_ = 0;
+    if (buffer_->size() < requested) {
+      // Short read: the end of the file was reached
+      return Status::OK();
+    }
+
+    pending_offset_ = buffer_offset_ + buffer_->size();
+    pending_length_ = window_;
+    std::shared_ptr<RandomAccessFile> raw = raw_;
+    const int64_t offset = pending_offset_;
+    const int64_t length = pending_length_;
+    pending_ =
+        executor_->Submit([raw, offset, length]() -> Result<std::shared_ptr<Buffer>> {
+          std::shared_ptr<Buffer> buffer;
+          RETURN_NOT_OK(raw->ReadAt(offset, length, &buffer));
+          return buffer;
+        });
+    return Status::OK();
+  }
+
+  // Wait for the background read, if any, and drop its result.  Requires the
+  // mutex.
+  void DiscardPending() {
+    if (pending_.valid()) {
+      pending_.wait();
+      pending_ = ReadFuture();
+    }
+    pending_length_ = 0;
+  }
+
+  std::shared_ptr<RandomAccessFile> raw_;
+  const AdaptiveReadaheadOptions options_;
+  ::arrow::internal::ThreadPool* executor_;
+
+  mutable std::mutex mutex_;
+  int64_t position_ = 0;
+  int64_t window_;
+  // The current window, starting at buffer_offset_
+  std::shared_ptr<Buffer> buffer_;
+  int64_t buffer_offset_ = 0;
+  // The window being read in the background
+  ReadFuture pending_;
+  int64_t pending_offset_ = 0;
+  int64_t pending_length_ = 0;
+};
+
+AdaptiveReadaheadFile::AdaptiveReadaheadFile() {}
+
+AdaptiveReadaheadFile::~AdaptiveReadaheadFile() {}
+
+Status AdaptiveReadaheadFile::Open(std::shared_ptr<RandomAccessFile> raw,
+                                   AdaptiveReadaheadOptions options,
+                                   ::arrow::internal::ThreadPool* executor,
+                                   std::shared_ptr<AdaptiveReadaheadFile>* out) {
+  if (options.initial_window <= 0 || options.max_window < options.initial_window ||
+      options.growth_factor < 1) {
+    return Status::Invalid("Invalid readahead windows: initial ",
+                           options.initial_window, ", max ", options.max_window,
+                           ", growth factor ", options.growth_factor);
+  }
+  if (executor == nullptr) {
+    executor = ::arrow::internal::GetIOThreadPool();
+  }
+  out->reset(new AdaptiveReadaheadFile());
+  (*out)->impl_.reset(new Impl(std::move(raw), options, executor));
+  return Status::OK();
+}
+
+Status AdaptiveReadaheadFile::Close() { return impl_->Close(); }
+
+bool AdaptiveReadaheadFile::closed() const { return impl_->closed(); }
+
+Status AdaptiveReadaheadFile::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status AdaptiveReadaheadFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+Status AdaptiveReadaheadFile::GetSize(int64_t* size) {
+  return impl_->raw()->GetSize(size);
+}
+
+Status AdaptiveReadaheadFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status AdaptiveReadaheadFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status AdaptiveReadaheadFile::ReadAt(int64_t position, int64_t nbytes,
+                                     int64_t* bytes_read, void* out) {
+  return impl_->raw()->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status AdaptiveReadaheadFile::ReadAt(int64_t position, int64_t nbytes,
+                                     std::shared_ptr<Buffer>* out) {
+  return impl_->raw()->ReadAt(position, nbytes, out);
+}
+
+int64_t AdaptiveReadaheadFile::window_size() const { return impl_->window_size(); }
+
 }  // namespace io
 }  // namespace arrow
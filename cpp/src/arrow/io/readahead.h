@@ -21,17 +21,91 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
 
+class Buffer;
 class MemoryPool;
 class ResizableBuffer;
 class Status;
 
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace io {
 
-class InputStream;
+struct ARROW_EXPORT AdaptiveReadaheadOptions {
+  static constexpr int64_t kDefaultInitialWindow = 64 * 1024;
+  static constexpr int64_t kDefaultMaxWindow = 16 * 1024 * 1024;
+
+  /// The size of the first read, and of the first read after a seek
+  int64_t initial_window = kDefaultInitialWindow;
+  /// The window does not grow past this size
+  int64_t max_window = kDefaultMaxWindow;
+  /// The window is multiplied by this factor for each window read sequentially
+  int64_t growth_factor = 2;
+
+  static AdaptiveReadaheadOptions Defaults();
+};
+
+/// \brief EXPERIMENTAL: A file reading ahead of its position in windows which
+/// adapt to the access pattern.
+///
+/// Read() serves data from the current window, while the next window is read
+/// in the background on an executor.  Each window consumed sequentially grows
+/// the next one, up to a maximum, so that long scans issue few large requests
+/// regardless of the latency of the underlying device.  A Seek() outside the
+/// current window discards the read ahead data and collapses the window to its
+/// initial size.
+///
+/// ReadAt() is forwarded to the underlying file, without reading ahead.  The
+/// underlying file must support concurrent ReadAt() calls.
+class ARROW_EXPORT AdaptiveReadaheadFile : public RandomAccessFile {
+ public:
+  ~AdaptiveReadaheadFile() override;
+
+  /// \brief Wrap a file for reading ahead
+  ///
+  /// \param[in] raw the underlying file
+  /// \param[in] options the window sizes
+  /// \param[in] executor the executor of the background reads, or null for the
+  /// I/O thread pool
+  /// \param[out] out the created file
+  static Status Open(std::shared_ptr<RandomAccessFile> raw,
+                     AdaptiveReadaheadOptions options,
+                     ::arrow::internal::ThreadPool* executor,
+                     std::shared_ptr<AdaptiveReadaheadFile>* out);
+
+  /// \brief Close the file, waiting for the background read.  This implicitly
+  /// closes the underlying file.
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief The size of the next window to be read
+  int64_t window_size() const;
+
+ private:
+  AdaptiveReadaheadFile();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
 
 namespace internal {
 
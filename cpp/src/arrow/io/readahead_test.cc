@@ -273,5 +273,156 @@ TEST(ReadaheadSpooler, StressReads) {
 }
 
 }  // namespace internal
+
+using ReadRanges = std::vector<std::pair<int64_t, int64_t>>;
+
+// Record the ranges read from a buffer
+class RecordingFile : public RandomAccessFile {
+ public:
+  explicit RecordingFile(const std::string& data)
+      : reader_(std::make_shared<BufferReader>(Buffer::FromString(std::string(data)))) {}
+
+  Status Close() override { return reader_->Close(); }
+  bool closed() const override { return reader_->closed(); }
+  Status Tell(int64_t* position) const override { return reader_->Tell(position); }
+  Status Seek(int64_t position) override { return reader_->Seek(position); }
+  Status GetSize(int64_t* size) override { return reader_->GetSize(size); }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    return reader_->Read(nbytes, bytes_read, out);
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    return reader_->Read(nbytes, out);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override {
+    Record(position, nbytes);
+    return reader_->ReadAt(position, nbytes, bytes_read, out);
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    Record(position, nbytes);
+    return reader_->ReadAt(position, nbytes, out);
+  }
+
+  ReadRanges ranges() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ranges_;
+  }
+
+ private:
+  void Record(int64_t position, int64_t nbytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ranges_.emplace_back(position, nbytes);
+  }
+
+  std::shared_ptr<BufferReader> reader_;
+  mutable std::mutex mutex_;
+  ReadRanges ranges_;
+};
+
+class TestAdaptiveReadaheadFile : public ::testing::Test {
+ public:
+  void SetUp() override {
+    for (int i = 0; i < 1000; ++i) {
+      data_.push_back(static_cast<char>('a' + i % 26));
+    }
+    raw_ = std::make_shared<RecordingFile>(data_);
+    options_.initial_window = 16;
+    options_.max_window = 64;
+    ASSERT_OK(AdaptiveReadaheadFile::Open(raw_, options_, nullptr, &file_));
+  }
+
+  std::string Read(int64_t nbytes) {
+    std::string out(static_cast<size_t>(nbytes), '\0');
+    int64_t bytes_read;
+    ARROW_EXPECT_OK(file_->Read(nbytes, &bytes_read, &out[0]));
+    out.resize(static_cast<size_t>(bytes_read));
+    return out;
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<RecordingFile> raw_;
+  AdaptiveReadaheadOptions options_;
+  std::shared_ptr<AdaptiveReadaheadFile> file_;
+};
+
+TEST_F(TestAdaptiveReadaheadFile, SequentialReadsGrowWindow) {
+  std::string contents;
+  std::string chunk;
+  do {
+    chunk = Read(10);
+    contents += chunk;
+  } while (!chunk.empty());
+  ASSERT_EQ(contents, data_);
+  ASSERT_EQ(file_->window_size(), 64);
+
+  auto ranges = raw_->ranges();
+  ASSERT_GE(ranges.size(), 5);
+  ReadRanges expected = {{0, 16}, {16, 16}, {32, 32}, {64, 64}, {128, 64}};
+  ASSERT_EQ(ReadRanges(ranges.begin(), ranges.begin() + 5), expected);
+  ASSERT_OK(file_->Close());
+}
+
+TEST_F(TestAdaptiveReadaheadFile, SeekCollapsesWindow) {
+  ASSERT_EQ(Read(100), data_.substr(0, 100));
+  ASSERT_EQ(file_->window_size(), 64);
+
+  // Within the current window
+  ASSERT_OK(file_->Seek(97));
+  ASSERT_EQ(file_->window_size(), 64);
+  ASSERT_EQ(Read(3), data_.substr(97, 3));
+
+  ASSERT_OK(file_->Seek(500));
+  ASSERT_EQ(file_->window_size(), 16);
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(position, 500);
+  auto num_ranges = raw_->ranges().size();
+  ASSERT_EQ(Read(5), data_.substr(500, 5));
+  ASSERT_EQ(raw_->ranges()[num_ranges].first, 500);
+  ASSERT_EQ(raw_->ranges()[num_ranges].second, 16);
+
+  ASSERT_OK(file_->Seek(995));
+  ASSERT_EQ(Read(10), data_.substr(995));
+  ASSERT_EQ(Read(10), "");
+  ASSERT_RAISES(Invalid, file_->Seek(-1));
+}
+
+TEST_F(TestAdaptiveReadaheadFile, ReadBuffers) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Read(4, &buffer));
+  ASSERT_EQ(buffer->ToString(), data_.substr(0, 4));
+  // Spans several windows
+  ASSERT_OK(file_->Read(100, &buffer));
+  ASSERT_EQ(buffer->ToString(), data_.substr(4, 100));
+
+  // ReadAt does not move the position
+  ASSERT_OK(file_->ReadAt(900, 200, &buffer));
+  ASSERT_EQ(buffer->ToString(), data_.substr(900));
+  ASSERT_OK(file_->Read(4, &buffer));
+  ASSERT_EQ(buffer->ToString(), data_.substr(104, 4));
+
+  int64_t size;
+  ASSERT_OK(file_->GetSize(&size));
+  ASSERT_EQ(size, 1000);
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+}
+
+TEST(AdaptiveReadaheadFile, InvalidOptions) {
+  auto raw = std::make_shared<RecordingFile>("abc");
+  std::shared_ptr<AdaptiveReadaheadFile> file;
+  AdaptiveReadaheadOptions options;
+  options.initial_window = 0;
+  ASSERT_RAISES(Invalid, AdaptiveReadaheadFile::Open(raw, options, nullptr, &file));
+  options = AdaptiveReadaheadOptions::Defaults();
+  options.max_window = options.initial_window - 1;
+  ASSERT_RAISES(Invalid, AdaptiveReadaheadFile::Open(raw, options, nullptr, &file));
+}
+
 }  // namespace io
 }  // namespace arrow
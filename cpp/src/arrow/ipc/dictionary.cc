@@ -24,6 +24,7 @@
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -134,11 +135,39 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  std::shared_ptr<Array> dictionary;
+  RETURN_NOT_OK(GetDictionary(id, &dictionary));
+  if (!delta->type()->Equals(*dictionary->type())) {
+    return Status::TypeError("Delta for dictionary with id ", id, " has type ",
+                             delta->type()->ToString(), " and not ",
+                             dictionary->type()->ToString());
+  }
+  // Batches read earlier keep referencing the previous dictionary
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(Concatenate({dictionary, delta}, pool, &combined));
+  id_to_dictionary_[id] = combined;
+  return Status::OK();
+}
+
+Status DictionaryMemo::UpdateDictionary(int64_t id,
+                                        const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("Dictionary with id ", id, " not found");
+  }
+  it->second = dictionary;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CollectDictionaries implementation
 
 struct DictionaryCollector {
   DictionaryMemo* dictionary_memo_;
+  // If not null, the dictionaries are gathered here rather than in the memo
+  DictionaryMap* dictionaries_;
 
   Status WalkChildren(const DataType& type, const Array& array) {
     for (int i = 0; i < type.num_children(); ++i) {
@@ -155,7 +184,11 @@ struct DictionaryCollector {
       auto dictionary = dict_array.dictionary();
       int64_t id = -1;
       RETURN_NOT_OK(dictionary_memo_->GetOrAssignId(field, &id));
-      RETURN_NOT_OK(dictionary_memo_->AddDictionary(id, dictionary));
+      if (dictionaries_ != nullptr) {
+        (*dictionaries_)[id] = dictionary;
+      } else {
+        RETURN_NOT_OK(dictionary_memo_->AddDictionary(id, dictionary));
+      }
 
       // Traverse the dictionary to gather any nested dictionaries
       const auto& dict_type = static_cast<const DictionaryType&>(*type);
@@ -176,7 +209,13 @@ struct DictionaryCollector {
 };
 
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo) {
-  DictionaryCollector collector{memo};
+  DictionaryCollector collector{memo, nullptr};
+  return collector.Collect(batch);
+}
+
+Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo,
+                           DictionaryMap* out) {
+  DictionaryCollector collector{memo, out};
   return collector.Collect(batch);
 }
 
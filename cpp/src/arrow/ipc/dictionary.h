@@ -33,6 +33,7 @@ namespace arrow {
 class Array;
 class DataType;
 class Field;
+class MemoryPool;
 class RecordBatch;
 
 namespace ipc {
@@ -77,6 +78,15 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Append the entries of a delta dictionary batch to the dictionary
+  /// with a particular id. Returns KeyError if that dictionary doesn't exist
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                            MemoryPool* pool);
+
+  /// \brief Replace the dictionary with a particular id. Returns KeyError if
+  /// that dictionary doesn't exist
+  Status UpdateDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of fields tracked in the memo
@@ -100,6 +110,12 @@ class ARROW_EXPORT DictionaryMemo {
 ARROW_EXPORT
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo);
 
+/// \brief Gather the dictionaries of a batch by id, without adding them to
+/// the memo. Ids are looked up in the memo, or assigned for new fields
+ARROW_EXPORT
+Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo,
+                           DictionaryMap* out);
+
 }  // namespace ipc
 }  // namespace arrow
 
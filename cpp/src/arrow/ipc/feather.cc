@@ -17,6 +17,7 @@
 
 #include "arrow/ipc/feather.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -32,7 +33,11 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/feather_generated.h"
 #include "arrow/ipc/feather_internal.h"
+#include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/util.h"  // IWYU pragma: keep
+#include "arrow/ipc/writer.h"
 #include "arrow/status.h"
 #include "arrow/table.h"  // IWYU pragma: keep
 #include "arrow/type.h"
@@ -288,7 +293,12 @@ class TableReader::TableReaderImpl {
     }
 
     std::shared_ptr<Buffer> buffer;
-    RETURN_NOT_OK(source->ReadAt(0, magic_size, &buffer));
+    const int arrow_magic_size = static_cast<int>(strlen(internal::kArrowMagicBytes));
+    RETURN_NOT_OK(source->ReadAt(0, arrow_magic_size, &buffer));
+    if (buffer->size() == arrow_magic_size &&
+        !memcmp(buffer->data(), internal::kArrowMagicBytes, arrow_magic_size)) {
+      return OpenV2();
+    }
 
     if (memcmp(buffer->data(), kFeatherMagicBytes, magic_size)) {
       return Status::Invalid("Not a feather file");
@@ -312,6 +322,12 @@ class TableReader::TableReaderImpl {
     return metadata_->Open(buffer);
   }
 
+  // Feather V2 files are read through the IPC file reader
+  Status OpenV2() {
+    RETURN_NOT_OK(RecordBatchFileReader::Open(source_, &file_reader_));
+    return file_reader_->CountRows(&num_rows_);
+  }
+
   Status GetDataType(const fbs::PrimitiveArray* values, fbs::TypeMetadata metadata_type,
                      const void* metadata, std::shared_ptr<DataType>* out,
                      std::shared_ptr<Array>* out_dictionary = nullptr) {
@@ -427,20 +443,33 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
-  bool HasDescription() const { return metadata_->HasDescription(); }
+  bool HasDescription() const { return !file_reader_ && metadata_->HasDescription(); }
 
-  std::string GetDescription() const { return metadata_->GetDescription(); }
+  std::string GetDescription() const {
+    return file_reader_ ? std::string() : metadata_->GetDescription();
+  }
 
-  int version() const { return metadata_->version(); }
-  int64_t num_rows() const { return metadata_->num_rows(); }
-  int64_t num_columns() const { return metadata_->num_columns(); }
+  int version() const { return file_reader_ ? kFeatherV2Version : metadata_->version(); }
+  int64_t num_rows() const { return file_reader_ ? num_rows_ : metadata_->num_rows(); }
+  int64_t num_columns() const {
+    return file_reader_ ? file_reader_->schema()->num_fields() : metadata_->num_columns();
+  }
 
   std::string GetColumnName(int i) const {
+    if (file_reader_) {
+      return file_reader_->schema()->field(i)->name();
+    }
     const fbs::Column* col_meta = metadata_->column(i);
     return col_meta->name()->str();
   }
 
   Status GetColumn(int i, std::shared_ptr<ChunkedArray>* out) {
+    if (file_reader_) {
+      std::shared_ptr<Table> table;
+      RETURN_NOT_OK(file_reader_->ReadRows(0, num_rows_, {i}, &table));
+      *out = table->column(0);
+      return Status::OK();
+    }
     const fbs::Column* col_meta = metadata_->column(i);
 
     // auto user_meta = column->user_metadata();
@@ -454,6 +483,9 @@ class TableReader::TableReaderImpl {
   }
 
   Status Read(std::shared_ptr<Table>* out) {
+    if (file_reader_) {
+      return file_reader_->ReadRows(0, num_rows_, out);
+    }
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
     for (int i = 0; i < num_columns(); ++i) {
@@ -467,6 +499,9 @@ class TableReader::TableReaderImpl {
   }
 
   Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+    if (file_reader_) {
+      return file_reader_->ReadRows(0, num_rows_, indices, out);
+    }
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
     for (int i = 0; i < num_columns(); ++i) {
@@ -490,6 +525,15 @@ class TableReader::TableReaderImpl {
   }
 
   Status Read(const std::vector<std::string>& names, std::shared_ptr<Table>* out) {
+    if (file_reader_) {
+      std::vector<int> indices;
+      for (int i = 0; i < num_columns(); ++i) {
+        if (std::find(names.begin(), names.end(), GetColumnName(i)) != names.end()) {
+          indices.push_back(i);
+        }
+      }
+      return file_reader_->ReadRows(0, num_rows_, indices, out);
+    }
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<ChunkedArray>> columns;
     for (int i = 0; i < num_columns(); ++i) {
@@ -518,6 +562,10 @@ class TableReader::TableReaderImpl {
   std::unique_ptr<TableMetadata> metadata_;
 
   std::shared_ptr<Schema> schema_;
+
+  // Feather V2 files only
+  std::shared_ptr<RecordBatchFileReader> file_reader_;
+  int64_t num_rows_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -890,6 +938,59 @@ Status TableWriter::Write(const Table& table) { return impl_->Write(table); }
 
 Status TableWriter::Finalize() { return impl_->Finalize(); }
 
+// ----------------------------------------------------------------------
+// WriteTable
+
+WriteProperties WriteProperties::Defaults() { return WriteProperties(); }
+
+static Status WriteFeatherV1(const Table& table, io::OutputStream* dst) {
+  // TableWriter only writes to the stream, which the caller keeps ownership of
+  std::shared_ptr<io::OutputStream> stream(std::shared_ptr<io::OutputStream>(), dst);
+  std::unique_ptr<TableWriter> writer;
+  RETURN_NOT_OK(TableWriter::Open(stream, &writer));
+  RETURN_NOT_OK(writer->Write(table));
+  return writer->Finalize();
+}
+
+static Status WriteFeatherV2(const Table& table, io::OutputStream* dst,
+                             const WriteProperties& properties) {
+  if (properties.chunksize <= 0) {
+    return Status::Invalid("Feather chunksize must be positive");
+  }
+  auto options = IpcOptions::Defaults();
+  options.compression = properties.compression;
+  std::shared_ptr<RecordBatchWriter> writer;
+  ARROW_ASSIGN_OR_RAISE(writer,
+                        RecordBatchFileWriter::Open(dst, table.schema(), options));
+
+  TableBatchReader batch_reader(table);
+  batch_reader.set_chunksize(properties.chunksize);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(batch_reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+Status WriteTable(const Table& table, io::OutputStream* dst,
+                  const WriteProperties& properties) {
+  switch (properties.version) {
+    case kFeatherV1Version:
+      if (properties.compression != Compression::UNCOMPRESSED) {
+        return Status::Invalid("Feather V1 files do not support compression");
+      }
+      return WriteFeatherV1(table, dst);
+    case kFeatherV2Version:
+      return WriteFeatherV2(table, dst, properties);
+    default:
+      return Status::Invalid("Unsupported Feather version: ", properties.version);
+  }
+}
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
@@ -26,6 +26,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -47,11 +48,20 @@ namespace feather {
 
 static constexpr const int kFeatherVersion = 2;
 
+/// Version of the legacy Feather files written by TableWriter
+static constexpr const int kFeatherV1Version = kFeatherVersion;
+
+/// Version of Feather files stored in the Arrow IPC file format
+static constexpr const int kFeatherV2Version = 3;
+
 // ----------------------------------------------------------------------
 // Metadata accessor classes
 
 /// \class TableReader
 /// \brief An interface for reading columns from Feather files
+///
+/// Both the legacy format and Feather V2 files are supported. The columns of
+/// V2 files are read as chunked arrays with one chunk per record batch
 class ARROW_EXPORT TableReader {
  public:
   TableReader();
@@ -73,7 +83,8 @@ class ARROW_EXPORT TableReader {
   /// \brief Return true if the table has a description field populated
   bool HasDescription() const;
 
-  /// \brief Return the version number of the Feather file
+  /// \brief Return the version number of the Feather file, kFeatherV2Version
+  /// for Feather V2 files
   int version() const;
 
   /// \brief Return the number of rows in the file
@@ -166,6 +177,36 @@ class ARROW_EXPORT TableWriter {
   std::unique_ptr<TableWriterImpl> impl_;
 };
 
+/// \brief Properties of the Feather files written by WriteTable
+struct ARROW_EXPORT WriteProperties {
+  static WriteProperties Defaults();
+
+  /// Format version, kFeatherV2Version or kFeatherV1Version for files
+  /// readable by older Feather implementations
+  int version = kFeatherV2Version;
+
+  /// Maximum number of rows in each record batch of a V2 file
+  int64_t chunksize = 1LL << 16;
+
+  /// Compression of the buffers of V2 files: Compression::UNCOMPRESSED,
+  /// Compression::LZ4 or Compression::ZSTD. Each buffer is compressed
+  /// separately, so that the columns read are the only ones decompressed
+  Compression::type compression = Compression::UNCOMPRESSED;
+};
+
+/// \brief Write a table to a Feather file
+///
+/// Feather V2 files are Arrow IPC files: buffers are 8-byte aligned and can
+/// be read in place from a memory map when uncompressed
+///
+/// \param[in] table the table to write
+/// \param[in] dst the output stream
+/// \param[in] properties the format version and options of the file
+/// \return Status
+ARROW_EXPORT
+Status WriteTable(const Table& table, io::OutputStream* dst,
+                  const WriteProperties& properties = WriteProperties::Defaults());
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
@@ -564,6 +564,105 @@ INSTANTIATE_TEST_CASE_P(TestTableWriterSliceOffsets, TestTableWriterSlice,
                                                              304, 305, 306, 307),
                                            ::testing::Values(0, 1, 7, 8, 30, 32, 100)));
 
+// ----------------------------------------------------------------------
+// Feather V2, i.e. the Arrow IPC file format
+
+class TestFeatherV2 : public ::testing::Test {
+ public:
+  void SetUp() override {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(ipc::test::MakeIntBatchSized(10, &batch));
+    ASSERT_OK(Table::FromRecordBatches({batch}, &table_));
+    properties_ = WriteProperties::Defaults();
+    properties_.chunksize = 3;
+  }
+
+  Status WriteAndOpen() {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    RETURN_NOT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+    RETURN_NOT_OK(WriteTable(*table_, stream.get(), properties_));
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(stream->Finish(&buffer));
+    return TableReader::Open(std::make_shared<io::BufferReader>(buffer), &reader_);
+  }
+
+  void CheckRoundTrip() {
+    ASSERT_OK(WriteAndOpen());
+    ASSERT_EQ(properties_.version, reader_->version());
+    ASSERT_EQ(table_->num_rows(), reader_->num_rows());
+    ASSERT_EQ(table_->num_columns(), reader_->num_columns());
+    ASSERT_EQ("f0", reader_->GetColumnName(0));
+    ASSERT_EQ("f1", reader_->GetColumnName(1));
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader_->Read(&result));
+    AssertTablesEqual(*table_, *result, /*same_chunk_layout=*/false);
+  }
+
+ protected:
+  std::shared_ptr<Table> table_;
+  WriteProperties properties_;
+  std::unique_ptr<TableReader> reader_;
+};
+
+TEST_F(TestFeatherV2, RoundTrip) {
+  CheckRoundTrip();
+  ASSERT_EQ("", reader_->GetDescription());
+
+  // One record batch per chunksize rows
+  std::shared_ptr<ChunkedArray> column;
+  ASSERT_OK(reader_->GetColumn(1, &column));
+  ASSERT_EQ(4, column->num_chunks());
+  ASSERT_TRUE(table_->column(1)->Equals(*column));
+}
+
+TEST_F(TestFeatherV2, ReadSubset) {
+  ASSERT_OK(WriteAndOpen());
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(table_->RemoveColumn(0, &expected));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->Read(std::vector<int>{1}, &result));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+
+  ASSERT_OK(reader_->Read(std::vector<std::string>{"f1"}, &result));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+}
+
+TEST_F(TestFeatherV2, Compression) {
+  std::vector<Compression::type> codecs;
+#ifdef ARROW_WITH_LZ4
+  codecs.push_back(Compression::LZ4_FRAME);
+#endif
+#ifdef ARROW_WITH_ZSTD
+  codecs.push_back(Compression::ZSTD);
+#endif
+  for (auto codec : codecs) {
+    properties_.compression = codec;
+    CheckRoundTrip();
+  }
+}
+
+TEST_F(TestFeatherV2, WriteV1) {
+  properties_.version = kFeatherV1Version;
+  CheckRoundTrip();
+}
+
+TEST_F(TestFeatherV2, InvalidProperties) {
+  properties_.chunksize = 0;
+  ASSERT_RAISES(Invalid, WriteAndOpen());
+
+  properties_ = WriteProperties::Defaults();
+  properties_.version = 1;
+  ASSERT_RAISES(Invalid, WriteAndOpen());
+
+  properties_ = WriteProperties::Defaults();
+  properties_.version = kFeatherV1Version;
+  properties_.compression = Compression::ZSTD;
+  ASSERT_RAISES(Invalid, WriteAndOpen());
+}
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
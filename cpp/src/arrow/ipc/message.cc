@@ -20,18 +20,22 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 
 #include "arrow/buffer.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace ipc {
@@ -42,6 +46,15 @@ class Message::MessageImpl {
                        const std::shared_ptr<Buffer>& body)
       : metadata_(metadata), message_(nullptr), body_(body) {}
 
+  MessageImpl(const std::shared_ptr<Buffer>& metadata, const BufferVector& body_chunks)
+      : metadata_(metadata), message_(nullptr) {
+    if (body_chunks.size() == 1) {
+      body_ = body_chunks[0];
+    } else if (body_chunks.size() > 1) {
+      body_chunks_ = body_chunks;
+    }
+  }
+
   Status Open() {
     RETURN_NOT_OK(
         internal::VerifyMessage(metadata_->data(), metadata_->size(), &message_));
@@ -79,7 +92,41 @@ class Message::MessageImpl {
 
   int64_t body_length() const { return message_->bodyLength(); }
 
-  std::shared_ptr<Buffer> body() const { return body_; }
+  std::shared_ptr<Buffer> body() const {
+    std::lock_guard<std::mutex> lock(body_mutex_);
+    if (!body_ && !body_chunks_.empty()) {
+      Status st = ConcatenateBuffers(body_chunks_, default_memory_pool(), &body_);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed to concatenate message body: " << st.ToString();
+        return nullptr;
+      }
+    }
+    return body_;
+  }
+
+  bool has_body() const {
+    std::lock_guard<std::mutex> lock(body_mutex_);
+    return body_ != nullptr || !body_chunks_.empty();
+  }
+
+  std::shared_ptr<io::RandomAccessFile> body_reader() const {
+    std::lock_guard<std::mutex> lock(body_mutex_);
+    if (body_) {
+      return std::make_shared<io::BufferReader>(body_);
+    } else if (!body_chunks_.empty()) {
+      return std::make_shared<io::ChunkedBufferReader>(body_chunks_);
+    }
+    return std::make_shared<io::BufferReader>(nullptr, 0);
+  }
+
+  // The pieces of the message body, for writing it without concatenating
+  BufferVector body_pieces() const {
+    std::lock_guard<std::mutex> lock(body_mutex_);
+    if (body_) {
+      return {body_};
+    }
+    return body_chunks_;
+  }
 
   std::shared_ptr<Buffer> metadata() const { return metadata_; }
 
@@ -88,8 +135,11 @@ class Message::MessageImpl {
   std::shared_ptr<Buffer> metadata_;
   const flatbuf::Message* message_;
 
-  // The message body, if any
-  std::shared_ptr<Buffer> body_;
+  // The message body, if any. A body received in several pieces is kept in
+  // body_chunks_ and only concatenated into body_ if body() is called
+  mutable std::shared_ptr<Buffer> body_;
+  BufferVector body_chunks_;
+  mutable std::mutex body_mutex_;
 };
 
 Message::Message(const std::shared_ptr<Buffer>& metadata,
@@ -97,16 +147,33 @@ Message::Message(const std::shared_ptr<Buffer>& metadata,
   impl_.reset(new MessageImpl(metadata, body));
 }
 
+Message::Message(const std::shared_ptr<Buffer>& metadata,
+                 const BufferVector& body_chunks) {
+  impl_.reset(new MessageImpl(metadata, body_chunks));
+}
+
 Status Message::Open(const std::shared_ptr<Buffer>& metadata,
                      const std::shared_ptr<Buffer>& body, std::unique_ptr<Message>* out) {
   out->reset(new Message(metadata, body));
   return (*out)->impl_->Open();
 }
 
+Status Message::Open(const std::shared_ptr<Buffer>& metadata,
+                     const BufferVector& body_chunks, std::unique_ptr<Message>* out) {
+  out->reset(new Message(metadata, body_chunks));
+  return (*out)->impl_->Open();
+}
+
 Message::~Message() {}
 
 std::shared_ptr<Buffer> Message::body() const { return impl_->body(); }
 
+bool Message::has_body() const { return impl_->has_body(); }
+
+std::shared_ptr<io::RandomAccessFile> Message::body_reader() const {
+  return impl_->body_reader();
+}
+
 int64_t Message::body_length() const { return impl_->body_length(); }
 
 std::shared_ptr<Buffer> Message::metadata() const { return impl_->metadata(); }
@@ -191,14 +258,18 @@ Status Message::SerializeTo(io::OutputStream* stream, int32_t alignment,
 
   *output_length = metadata_length;
 
-  auto body_buffer = body();
-  if (body_buffer) {
-    RETURN_NOT_OK(stream->Write(body_buffer->data(), body_buffer->size()));
-    *output_length += body_buffer->size();
+  BufferVector body_pieces = impl_->body_pieces();
+  if (!body_pieces.empty()) {
+    int64_t body_size = 0;
+    for (const auto& piece : body_pieces) {
+      RETURN_NOT_OK(stream->Write(piece->data(), piece->size()));
+      body_size += piece->size();
+    }
+    *output_length += body_size;
 
-    DCHECK_GE(this->body_length(), body_buffer->size());
+    DCHECK_GE(this->body_length(), body_size);
 
-    int64_t remainder = this->body_length() - body_buffer->size();
+    int64_t remainder = this->body_length() - body_size;
     RETURN_NOT_OK(WritePadding(stream, remainder));
     *output_length += remainder;
   }
@@ -226,6 +297,7 @@ std::string FormatMessageType(Message::Type type) {
 
 Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
                    std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN(span, "ipc", "ReadMessage");
   ARROW_CHECK_GT(static_cast<size_t>(metadata_length), sizeof(int32_t))
       << "metadata_length should be at least 4";
 
@@ -276,6 +348,7 @@ Status CheckAligned(io::FileInterface* stream, int32_t alignment) {
 }
 
 Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* message) {
+  ARROW_TRACE_SPAN(span, "ipc", "ReadMessage");
   int32_t message_length = 0;
   int64_t bytes_read = 0;
   RETURN_NOT_OK(file->Read(sizeof(int32_t), &bytes_read,
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/ipc/options.h"
 #include "arrow/status.h"
@@ -73,6 +74,11 @@ class ARROW_EXPORT Message {
   /// Use at your own risk; Message::Open has more metadata validation
   Message(const std::shared_ptr<Buffer>& metadata, const std::shared_ptr<Buffer>& body);
 
+  /// \brief Construct message with a body made of several buffers, but do
+  /// not validate
+  Message(const std::shared_ptr<Buffer>& metadata,
+          const std::vector<std::shared_ptr<Buffer>>& body_chunks);
+
   ~Message();
 
   /// \brief Create and validate a Message instance from two buffers
@@ -84,6 +90,20 @@ class ARROW_EXPORT Message {
   static Status Open(const std::shared_ptr<Buffer>& metadata,
                      const std::shared_ptr<Buffer>& body, std::unique_ptr<Message>* out);
 
+  /// \brief Create and validate a Message instance from a body received in
+  /// several pieces, e.g. from a network transport, without concatenating them
+  ///
+  /// Reads through body_reader() are only copied where a body buffer spans
+  /// several pieces
+  ///
+  /// \param[in] metadata a buffer containing the Flatbuffer metadata
+  /// \param[in] body_chunks the pieces of the message body, in order
+  /// \param[out] out the created message
+  /// \return Status
+  static Status Open(const std::shared_ptr<Buffer>& metadata,
+                     const std::vector<std::shared_ptr<Buffer>>& body_chunks,
+                     std::unique_ptr<Message>* out);
+
   /// \brief Read message body and create Message given Flatbuffer metadata
   /// \param[in] metadata containing a serialized Message flatbuffer
   /// \param[in] stream an InputStream
@@ -120,8 +140,20 @@ class ARROW_EXPORT Message {
   /// \brief the Message body, if any
   ///
   /// \return buffer is null if no body
+  ///
+  /// \note A body made of several pieces is concatenated on first access;
+  /// prefer body_reader() to read it. The buffer is null if that fails
   std::shared_ptr<Buffer> body() const;
 
+  /// \brief Whether the Message has a body, which may be empty
+  bool has_body() const;
+
+  /// \brief A new reader over the Message body, empty if there is no body
+  ///
+  /// Reads are zero-copy, except for ranges spanning several pieces of a
+  /// body that was not received contiguously
+  std::shared_ptr<io::RandomAccessFile> body_reader() const;
+
   /// \brief The expected body length according to the metadata, for
   /// verification purposes
   int64_t body_length() const;
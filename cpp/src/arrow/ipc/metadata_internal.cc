@@ -892,17 +892,42 @@ static Status WriteBuffers(FBB& fbb, const std::vector<BufferMetadata>& buffers,
   return Status::OK();
 }
 
+static Status WriteBodyCompression(FBB& fbb, Compression::type compression,
+                                   flatbuffers::Offset<flatbuf::BodyCompression>* out) {
+  flatbuf::CompressionType codec;
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      // Leave the table unset
+      return Status::OK();
+    case Compression::LZ4:
+      codec = flatbuf::CompressionType_LZ4;
+      break;
+    case Compression::ZSTD:
+      codec = flatbuf::CompressionType_ZSTD;
+      break;
+    default:
+      return Status::Invalid("Unsupported IPC body compression: ",
+                             util::Codec::GetCodecAsString(compression));
+  }
+  *out =
+      flatbuf::CreateBodyCompression(fbb, codec, flatbuf::BodyCompressionMethod_BUFFER);
+  return Status::OK();
+}
+
 static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               RecordBatchOffset* offset) {
   FieldNodeVector fb_nodes;
   BufferVector fb_buffers;
+  flatbuffers::Offset<flatbuf::BodyCompression> fb_compression;
 
   RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &fb_nodes));
   RETURN_NOT_OK(WriteBuffers(fbb, buffers, &fb_buffers));
+  RETURN_NOT_OK(WriteBodyCompression(fbb, compression, &fb_compression));
 
-  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers);
+  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers, fb_compression);
   return Status::OK();
 }
 
@@ -916,13 +941,39 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
   return WriteFBMessage(fbb, flatbuf::MessageHeader_Schema, fb_schema.Union(), 0, out);
 }
 
+Status GetCompression(const flatbuf::RecordBatch* batch, Compression::type* out) {
+  const flatbuf::BodyCompression* compression = batch->compression();
+  if (compression == nullptr) {
+    *out = Compression::UNCOMPRESSED;
+    return Status::OK();
+  }
+  if (compression->method() != flatbuf::BodyCompressionMethod_BUFFER) {
+    return Status::Invalid("Unsupported IPC body compression method: ",
+                           static_cast<int>(compression->method()));
+  }
+  switch (compression->codec()) {
+    case flatbuf::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      break;
+    case flatbuf::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      break;
+    default:
+      return Status::Invalid("Unrecognized IPC body compression codec: ",
+                             static_cast<int>(compression->codec()));
+  }
+  return Status::OK();
+}
+
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
                         body_length, out);
 }
@@ -988,6 +1039,53 @@ Status MakeSparseMatrixIndexCSR(FBB& fbb, const SparseCSRIndex& sparse_index,
   return Status::OK();
 }
 
+Status MakeSparseMatrixIndexCSC(FBB& fbb, const SparseCSCIndex& sparse_index,
+                                const std::vector<BufferMetadata>& buffers,
+                                flatbuf::SparseTensorIndex* fb_sparse_index_type,
+                                Offset* fb_sparse_index, size_t* num_buffers) {
+  *fb_sparse_index_type = flatbuf::SparseTensorIndex_SparseMatrixIndexCSC;
+  const BufferMetadata& indptr_metadata = buffers[0];
+  const BufferMetadata& indices_metadata = buffers[1];
+  flatbuf::Buffer indptr(indptr_metadata.offset, indptr_metadata.length);
+  flatbuf::Buffer indices(indices_metadata.offset, indices_metadata.length);
+  *fb_sparse_index = flatbuf::CreateSparseMatrixIndexCSC(fbb, &indptr, &indices).Union();
+  *num_buffers = 2;
+  return Status::OK();
+}
+
+Status MakeSparseTensorIndexCSF(FBB& fbb, const SparseCSFIndex& sparse_index,
+                                const std::vector<BufferMetadata>& buffers,
+                                flatbuf::SparseTensorIndex* fb_sparse_index_type,
+                                Offset* fb_sparse_index, size_t* num_buffers) {
+  *fb_sparse_index_type = flatbuf::SparseTensorIndex_SparseTensorIndexCSF;
+  const size_t num_indptr = sparse_index.indptr().size();
+  const size_t num_indices = sparse_index.indices().size();
+
+  // The writer emits the indptr buffers, then the indices buffers
+  std::vector<flatbuf::Buffer> indptr;
+  for (size_t i = 0; i < num_indptr; ++i) {
+    indptr.emplace_back(buffers[i].offset, buffers[i].length);
+  }
+  std::vector<flatbuf::Buffer> indices;
+  for (size_t i = 0; i < num_indices; ++i) {
+    indices.emplace_back(buffers[num_indptr + i].offset, buffers[num_indptr + i].length);
+  }
+  std::vector<int32_t> axis_order(sparse_index.axis_order().begin(),
+                                  sparse_index.axis_order().end());
+
+  auto fb_indptr = fbb.CreateVectorOfStructs(util::MakeNonNull(indptr.data()),
+                                             indptr.size());
+  auto fb_indices = fbb.CreateVectorOfStructs(util::MakeNonNull(indices.data()),
+                                              indices.size());
+  auto fb_axis_order =
+      fbb.CreateVector(util::MakeNonNull(axis_order.data()), axis_order.size());
+  *fb_sparse_index =
+      flatbuf::CreateSparseTensorIndexCSF(fbb, fb_indptr, fb_indices, fb_axis_order)
+          .Union();
+  *num_buffers = num_indptr + num_indices;
+  return Status::OK();
+}
+
 Status MakeSparseTensorIndex(FBB& fbb, const SparseIndex& sparse_index,
                              const std::vector<BufferMetadata>& buffers,
                              flatbuf::SparseTensorIndex* fb_sparse_index_type,
@@ -1005,6 +1103,18 @@ Status MakeSparseTensorIndex(FBB& fbb, const SparseIndex& sparse_index,
           fb_sparse_index_type, fb_sparse_index, num_buffers));
       break;
 
+    case SparseTensorFormat::CSC:
+      RETURN_NOT_OK(MakeSparseMatrixIndexCSC(
+          fbb, checked_cast<const SparseCSCIndex&>(sparse_index), buffers,
+          fb_sparse_index_type, fb_sparse_index, num_buffers));
+      break;
+
+    case SparseTensorFormat::CSF:
+      RETURN_NOT_OK(MakeSparseTensorIndexCSF(
+          fbb, checked_cast<const SparseCSFIndex&>(sparse_index), buffers,
+          fb_sparse_index_type, fb_sparse_index, num_buffers));
+      break;
+
     default:
       std::stringstream ss;
       ss << "Unsupporoted sparse tensor format:: " << sparse_index.ToString()
@@ -1062,14 +1172,18 @@ Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_
                         fb_sparse_tensor.Union(), body_length, out);
 }
 
-Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
+Status WriteDictionaryMessage(int64_t id, bool is_delta, int64_t length,
+                              int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
                         body_length, out);
 }
@@ -1226,6 +1340,14 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
       *sparse_tensor_format_id = SparseTensorFormat::CSR;
       break;
 
+    case flatbuf::SparseTensorIndex_SparseMatrixIndexCSC:
+      *sparse_tensor_format_id = SparseTensorFormat::CSC;
+      break;
+
+    case flatbuf::SparseTensorIndex_SparseTensorIndexCSF:
+      *sparse_tensor_format_id = SparseTensorFormat::CSF;
+      break;
+
     default:
       return Status::Invalid("Unrecognized sparse index type");
   }
@@ -1243,6 +1365,14 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
 
 Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream* file,
                     int32_t* message_length) {
+  int32_t prefix;
+  std::vector<io::WriteRegion> regions;
+  GetMessageRegions(message, alignment, &prefix, message_length, &regions);
+  return file->WriteV(regions);
+}
+
+void GetMessageRegions(const Buffer& message, int32_t alignment, int32_t* prefix,
+                       int32_t* message_length, std::vector<io::WriteRegion>* regions) {
   // ARROW-3212: We do not make assumptions that the output stream is aligned
   int32_t padded_message_length = static_cast<int32_t>(message.size()) + 4;
   const int32_t remainder = padded_message_length % alignment;
@@ -1254,20 +1384,18 @@ Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream*
   // plus padding
   *message_length = padded_message_length;
 
-  // Write the flatbuffer size prefix including padding
-  int32_t flatbuffer_size = padded_message_length - 4;
-  RETURN_NOT_OK(file->Write(&flatbuffer_size, sizeof(int32_t)));
+  // The flatbuffer size prefix including padding
+  *prefix = padded_message_length - 4;
+  regions->push_back({prefix, sizeof(int32_t)});
 
-  // Write the flatbuffer
-  RETURN_NOT_OK(file->Write(message.data(), message.size()));
+  // The flatbuffer
+  regions->push_back({message.data(), message.size()});
 
-  // Write any padding
+  // Any padding
   int32_t padding = padded_message_length - static_cast<int32_t>(message.size()) - 4;
   if (padding > 0) {
-    RETURN_NOT_OK(file->Write(kPaddingBytes, padding));
+    regions->push_back({kPaddingBytes, padding});
   }
-
-  return Status::OK();
 }
 
 }  // namespace internal
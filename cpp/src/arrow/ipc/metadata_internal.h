@@ -29,6 +29,7 @@
 #include <flatbuffers/flatbuffers.h>
 
 #include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/dictionary.h"  // IYWU pragma: keep
@@ -36,6 +37,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
@@ -135,6 +137,18 @@ static inline Status VerifyMessage(const uint8_t* data, int64_t size,
 Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream* file,
                     int32_t* message_length);
 
+/// Append the regions written by WriteMessage to regions, to write them along
+/// with others in a single io::Writable::WriteV call
+///
+/// \param[in] message a buffer containing the metadata to write
+/// \param[in] alignment as in WriteMessage
+/// \param[out] prefix storage for the length prefix, which must remain valid
+/// until the regions are written
+/// \param[out] message_length the total size of the regions appended
+/// \param[in,out] regions the regions to write
+void GetMessageRegions(const Buffer& message, int32_t alignment, int32_t* prefix,
+                       int32_t* message_length, std::vector<io::WriteRegion>* regions);
+
 // Serialize arrow::Schema as a Flatbuffer
 //
 // \param[in] schema a Schema instance
@@ -145,9 +159,14 @@ Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream*
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
                           std::shared_ptr<Buffer>* out);
 
+// Retrieve the body compression codec of a record batch, or
+// Compression::UNCOMPRESSED if the body buffers are stored as-is
+Status GetCompression(const flatbuf::RecordBatch* batch, Compression::type* out);
+
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
@@ -161,10 +180,11 @@ Status WriteFileFooter(const Schema& schema, const std::vector<FileBlock>& dicti
                        const std::vector<FileBlock>& record_batches,
                        io::OutputStream* out);
 
-Status WriteDictionaryMessage(const int64_t id, const int64_t length,
+Status WriteDictionaryMessage(const int64_t id, const bool is_delta, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression,
                               std::shared_ptr<Buffer>* out);
 
 static inline Status WriteFlatbufferBuilder(flatbuffers::FlatBufferBuilder& fbb,
@@ -18,7 +18,9 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -35,6 +37,27 @@ struct ARROW_EXPORT IpcOptions {
   bool allow_64bit = false;
   // The maximum permitted schema nesting depth.
   int max_recursion_depth = kMaxNestingDepth;
+  // Compression codec for record batch and dictionary body buffers.
+  // Only Compression::LZ4 and Compression::ZSTD are supported; readers
+  // decompress transparently based on the message metadata.
+  Compression::type compression = Compression::UNCOMPRESSED;
+  // If true, compress body buffers in parallel on the CPU thread pool, and
+  // decompress them in parallel when reading.
+  bool use_threads = true;
+  // If true, the stream writer sends the entries appended to a dictionary
+  // since the previous record batch as a delta dictionary batch. Otherwise
+  // only the dictionaries of the first record batch are written. Not
+  // supported by the file format.
+  bool emit_dictionary_deltas = false;
+  // Indices of the top-level schema fields to read, all of them if empty.
+  // Record batches are read with these fields only, in schema order, and
+  // the buffers of the other fields are not read. Ignored by writers.
+  std::vector<int> included_fields;
+  // Number of record batches the stream reader reads and decodes ahead on
+  // the I/O thread pool, bounding the memory held by read-ahead. If 0,
+  // batches are read on the caller's thread when requested. Ignored by
+  // writers and by the file reader.
+  int prefetch_messages = 0;
 
   static IpcOptions Defaults();
 };
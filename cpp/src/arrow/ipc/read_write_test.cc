@@ -21,6 +21,8 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 #include <gtest/gtest.h>
@@ -41,6 +43,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -48,6 +51,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/key_value_metadata.h"
 
 namespace arrow {
@@ -137,6 +141,50 @@ TEST(TestMessage, Verify) {
   ASSERT_FALSE(message.Verify());
 }
 
+TEST(TestMessage, ChunkedBody) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  std::shared_ptr<Buffer> serialized;
+  ASSERT_OK(SerializeRecordBatch(*batch, default_memory_pool(), &serialized));
+  io::BufferReader buf_reader(serialized);
+  std::unique_ptr<Message> message;
+  ASSERT_OK(ReadMessage(&buf_reader, &message));
+
+  // Split the body at offsets that don't line up with its buffers
+  auto body = message->body();
+  const int64_t split1 = 7;
+  const int64_t split2 = body->size() / 2 + 3;
+  BufferVector chunks = {SliceBuffer(body, 0, split1),
+                         SliceBuffer(body, split1, split2 - split1),
+                         SliceBuffer(body, split2, body->size() - split2)};
+
+  std::unique_ptr<Message> chunked;
+  ASSERT_OK(Message::Open(message->metadata(), chunks, &chunked));
+  ASSERT_TRUE(chunked->has_body());
+  ASSERT_TRUE(chunked->Equals(*message));
+
+  DictionaryMemo dictionary_memo;
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(ReadRecordBatch(*chunked, batch->schema(), &dictionary_memo, &result));
+  CompareBatch(*batch, *result);
+
+  int64_t output_length = 0;
+  int64_t chunked_output_length = 0;
+  std::shared_ptr<io::BufferOutputStream> stream;
+  std::shared_ptr<io::BufferOutputStream> chunked_stream;
+  ASSERT_OK(io::BufferOutputStream::Create(1 << 10, default_memory_pool(), &stream));
+  ASSERT_OK(
+      io::BufferOutputStream::Create(1 << 10, default_memory_pool(), &chunked_stream));
+  ASSERT_OK(message->SerializeTo(stream.get(), 8, &output_length));
+  ASSERT_OK(chunked->SerializeTo(chunked_stream.get(), 8, &chunked_output_length));
+  ASSERT_EQ(output_length, chunked_output_length);
+  std::shared_ptr<Buffer> out, chunked_out;
+  ASSERT_OK(stream->Finish(&out));
+  ASSERT_OK(chunked_stream->Finish(&chunked_out));
+  AssertBufferEqual(*out, *chunked_out);
+}
+
 class TestSchemaMetadata : public ::testing::Test {
  public:
   void SetUp() {}
@@ -403,6 +451,35 @@ TEST_P(TestIpcRoundTrip, ZeroLengthArrays) {
   CheckRoundtrip(bin_array2, 1 << 20);
 }
 
+TEST_P(TestIpcRoundTrip, CompressedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  std::vector<Compression::type> codecs;
+#ifdef ARROW_WITH_LZ4
+  codecs.push_back(Compression::LZ4);
+#endif
+#ifdef ARROW_WITH_ZSTD
+  codecs.push_back(Compression::ZSTD);
+#endif
+  for (auto codec : codecs) {
+    options_.compression = codec;
+    CheckRoundtrip(*batch, 1 << 20);
+  }
+}
+
+TEST_F(TestWriteRecordBatch, UnsupportedCompression) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(1 << 16, "test-bad-compression", &mmap_));
+
+  int32_t metadata_length;
+  int64_t body_length;
+  options_.compression = Compression::BROTLI;
+  ASSERT_RAISES(Invalid, WriteRecordBatch(*batch, 0, mmap_.get(), &metadata_length,
+                                          &body_length, options_, pool_));
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -862,6 +939,347 @@ TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
+class TestDictionaryDeltas : public ::testing::Test {
+ public:
+  void SetUp() {
+    type_ = dictionary(int8(), utf8());
+    schema_ = ::arrow::schema({field("f0", type_)});
+  }
+
+  std::shared_ptr<RecordBatch> MakeBatch(const std::shared_ptr<Array>& dictionary,
+                                         const std::string& indices_json) {
+    std::shared_ptr<Array> array;
+    ABORT_NOT_OK(DictionaryArray::FromArrays(type_, ArrayFromJSON(int8(), indices_json),
+                                             dictionary, &array));
+    return RecordBatch::Make(schema_, array->length(), {array});
+  }
+
+  Status WriteStream(const BatchVector& batches, std::shared_ptr<Buffer>* out) {
+    auto options = IpcOptions::Defaults();
+    options.emit_dictionary_deltas = true;
+
+    std::shared_ptr<io::BufferOutputStream> sink;
+    RETURN_NOT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &sink));
+    std::shared_ptr<RecordBatchWriter> writer;
+    ARROW_ASSIGN_OR_RAISE(writer,
+                          RecordBatchStreamWriter::Open(sink.get(), schema_, options));
+    for (const auto& batch : batches) {
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    RETURN_NOT_OK(writer->Close());
+    return sink->Finish(out);
+  }
+
+ protected:
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Schema> schema_;
+};
+
+TEST_F(TestDictionaryDeltas, StreamRoundTrip) {
+  auto dict1 = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])");
+  // Equal to dict2, but another array
+  auto dict3 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])");
+  BatchVector batches = {MakeBatch(dict1, "[0, 1, null]"), MakeBatch(dict2, "[2, 3]"),
+                         MakeBatch(dict2, "[3, 0]"), MakeBatch(dict3, "[1]")};
+
+  std::shared_ptr<Buffer> stream;
+  ASSERT_OK(WriteStream(batches, &stream));
+
+  // One dictionary batch and one delta holding the two new entries
+  io::BufferReader buffer_reader(stream);
+  std::unique_ptr<MessageReader> message_reader = MessageReader::Open(&buffer_reader);
+  std::unique_ptr<Message> message;
+  std::vector<int64_t> dictionary_lengths;
+  while (true) {
+    ASSERT_OK(message_reader->ReadNextMessage(&message));
+    if (!message) break;
+    if (message->type() == Message::DICTIONARY_BATCH) {
+      auto fb_message = flatbuf::GetMessage(message->metadata()->data());
+      auto dictionary_batch = fb_message->header_as_DictionaryBatch();
+      ASSERT_EQ(dictionary_lengths.size() > 0, dictionary_batch->isDelta());
+      dictionary_lengths.push_back(dictionary_batch->data()->length());
+    }
+  }
+  ASSERT_EQ(std::vector<int64_t>({2, 2}), dictionary_lengths);
+
+  auto stream_reader = std::make_shared<io::BufferReader>(stream);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(stream_reader, &reader));
+  BatchVector out_batches;
+  ASSERT_OK(reader->ReadAll(&out_batches));
+  ASSERT_EQ(batches.size(), out_batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    CompareBatch(*batches[i], *out_batches[i]);
+  }
+}
+
+TEST_F(TestDictionaryDeltas, StreamRoundTripPrefetched) {
+  auto dict1 = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux"])");
+  auto dict3 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux", "x", "y"])");
+  BatchVector batches = {MakeBatch(dict1, "[0, 1, null]"), MakeBatch(dict2, "[2, 3]"),
+                         MakeBatch(dict2, "[3, 0]"), MakeBatch(dict3, "[5, 4]"),
+                         MakeBatch(dict3, "[1]")};
+
+  std::shared_ptr<Buffer> stream;
+  ASSERT_OK(WriteStream(batches, &stream));
+
+  for (int prefetch_messages : {1, 2, 10}) {
+    auto options = IpcOptions::Defaults();
+    options.prefetch_messages = prefetch_messages;
+    auto stream_reader = std::make_shared<io::BufferReader>(stream);
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(RecordBatchStreamReader::Open(stream_reader, options, &reader));
+    BatchVector out_batches;
+    ASSERT_OK(reader->ReadAll(&out_batches));
+    ASSERT_EQ(batches.size(), out_batches.size());
+    for (size_t i = 0; i < batches.size(); ++i) {
+      CompareBatch(*batches[i], *out_batches[i]);
+    }
+    // The end of stream is sticky
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_EQ(nullptr, batch);
+  }
+
+  // Destroying the reader stops reading ahead
+  auto options = IpcOptions::Defaults();
+  options.prefetch_messages = 2;
+  auto stream_reader = std::make_shared<io::BufferReader>(stream);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(stream_reader, options, &reader));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  CompareBatch(*batches[0], *batch);
+  reader.reset();
+}
+
+TEST_F(TestDictionaryDeltas, PrefetchedTruncatedStream) {
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  std::shared_ptr<Buffer> stream;
+  ASSERT_OK(WriteStream({MakeBatch(dict, "[0, 1]"), MakeBatch(dict, "[1]")}, &stream));
+  // Cut the last record batch short
+  auto truncated = SliceBuffer(stream, 0, stream->size() - 16);
+
+  auto options = IpcOptions::Defaults();
+  options.prefetch_messages = 4;
+  auto stream_reader = std::make_shared<io::BufferReader>(truncated);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(stream_reader, options, &reader));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(nullptr, batch);
+  Status st = reader->ReadNext(&batch);
+  ASSERT_FALSE(st.ok());
+  // The error is returned again
+  ASSERT_EQ(st.code(), reader->ReadNext(&batch).code());
+}
+
+TEST_F(TestDictionaryDeltas, DictionaryNotExtended) {
+  auto dict1 = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto dict2 = ArrayFromJSON(utf8(), R"(["bar", "foo", "baz"])");
+  std::shared_ptr<Buffer> stream;
+  ASSERT_RAISES(Invalid,
+                WriteStream({MakeBatch(dict1, "[0]"), MakeBatch(dict2, "[0]")}, &stream));
+}
+
+TEST_F(TestDictionaryDeltas, FileFormatUnsupported) {
+  auto options = IpcOptions::Defaults();
+  options.emit_dictionary_deltas = true;
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(0, default_memory_pool(), &sink));
+  ASSERT_RAISES(Invalid, RecordBatchFileWriter::Open(sink.get(), schema_, options));
+}
+
+class TestReadRows : public ::testing::Test {
+ public:
+  void SetUp() {
+    auto dict_type = dictionary(int8(), utf8());
+    schema_ = ::arrow::schema(
+        {field("f0", int32()), field("f1", dict_type), field("f2", utf8())});
+    auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+
+    // Batches of 3, 0, 4 and 2 rows
+    const std::vector<std::string> ints = {"[0, 1, 2]", "[]", "[3, 4, null, 6]",
+                                           "[7, 8]"};
+    const std::vector<std::string> indices = {"[0, 1, 0]", "[]", "[1, 1, null, 0]",
+                                              "[0, 1]"};
+    const std::vector<std::string> strings = {R"(["a", "b", "c"])", "[]",
+                                              R"(["d", null, "f", "g"])",
+                                              R"(["h", "i"])"};
+    for (size_t i = 0; i < ints.size(); ++i) {
+      std::shared_ptr<Array> dict_array;
+      ABORT_NOT_OK(DictionaryArray::FromArrays(
+          dict_type, ArrayFromJSON(int8(), indices[i]), dict, &dict_array));
+      auto int_array = ArrayFromJSON(int32(), ints[i]);
+      batches_.push_back(RecordBatch::Make(
+          schema_, int_array->length(),
+          {int_array, dict_array, ArrayFromJSON(utf8(), strings[i])}));
+    }
+    ABORT_NOT_OK(Table::FromRecordBatches(batches_, &table_));
+
+    ABORT_NOT_OK(helper_.Init(schema_));
+    for (const auto& batch : batches_) {
+      ABORT_NOT_OK(helper_.WriteBatch(batch));
+    }
+    ABORT_NOT_OK(helper_.Finish());
+
+    auto buf_reader = std::make_shared<io::BufferReader>(helper_.buffer_);
+    ABORT_NOT_OK(
+        RecordBatchFileReader::Open(buf_reader, helper_.footer_offset_, &reader_));
+  }
+
+  // Whether the table only references the file
+  void AssertZeroCopy(const Table& table) {
+    const uint8_t* file_start = helper_.buffer_->data();
+    const uint8_t* file_end = file_start + helper_.buffer_->size();
+    for (int i = 0; i < table.num_columns(); ++i) {
+      for (const auto& chunk : table.column(i)->chunks()) {
+        for (const auto& buffer : chunk->data()->buffers) {
+          if (buffer && buffer->size() > 0) {
+            ASSERT_GE(buffer->data(), file_start);
+            ASSERT_LE(buffer->data() + buffer->size(), file_end);
+          }
+        }
+      }
+    }
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  BatchVector batches_;
+  std::shared_ptr<Table> table_;
+  FileWriterHelper helper_;
+  std::shared_ptr<RecordBatchFileReader> reader_;
+};
+
+TEST_F(TestReadRows, CountRows) {
+  int64_t num_rows = 0;
+  ASSERT_OK(reader_->CountRows(&num_rows));
+  ASSERT_EQ(9, num_rows);
+}
+
+TEST_F(TestReadRows, RowRanges) {
+  const std::vector<std::pair<int64_t, int64_t>> ranges = {
+      {0, 9}, {0, 3}, {1, 1}, {2, 5}, {3, 4}, {5, 4}, {8, 1}, {3, 0}, {9, 0}};
+  for (const auto& range : ranges) {
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader_->ReadRows(range.first, range.second, &result));
+    ASSERT_OK(result->Validate());
+    AssertTablesEqual(*table_->Slice(range.first, range.second), *result,
+                      /*same_chunk_layout=*/false);
+    AssertZeroCopy(*result);
+  }
+
+  // Only overlapping batches are returned
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->ReadRows(2, 5, &result));
+  ASSERT_EQ(2, result->column(0)->num_chunks());
+  ASSERT_OK(reader_->ReadRows(3, 4, &result));
+  ASSERT_EQ(1, result->column(0)->num_chunks());
+
+  // Truncated at the end of the file
+  ASSERT_OK(reader_->ReadRows(7, 100, &result));
+  AssertTablesEqual(*table_->Slice(7), *result, /*same_chunk_layout=*/false);
+
+  ASSERT_RAISES(Invalid, reader_->ReadRows(10, 1, &result));
+  ASSERT_RAISES(Invalid, reader_->ReadRows(-1, 1, &result));
+  ASSERT_RAISES(Invalid, reader_->ReadRows(0, -1, &result));
+}
+
+TEST_F(TestReadRows, FieldSubset) {
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->ReadRows(1, 7, {2, 0}, &result));
+  ASSERT_OK(result->Validate());
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(table_->Slice(1, 7)->RemoveColumn(1, &expected));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+  AssertZeroCopy(*result);
+
+  ASSERT_OK(reader_->ReadRows(0, 9, {1}, &result));
+  std::shared_ptr<Table> without_f2;
+  ASSERT_OK(table_->RemoveColumn(2, &without_f2));
+  ASSERT_OK(without_f2->RemoveColumn(0, &expected));
+  AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+
+  ASSERT_RAISES(Invalid, reader_->ReadRows(0, 1, {3}, &result));
+}
+
+// A BufferReader which counts the bytes returned by ReadAt()
+class CountingBufferReader : public io::BufferReader {
+ public:
+  explicit CountingBufferReader(const std::shared_ptr<Buffer>& buffer)
+      : io::BufferReader(buffer) {}
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(io::BufferReader::ReadAt(position, nbytes, out));
+    bytes_read += (*out)->size();
+    return Status::OK();
+  }
+
+  int64_t bytes_read = 0;
+};
+
+TEST_F(TestReadRows, IncludedFieldsOption) {
+  auto options = IpcOptions::Defaults();
+  options.included_fields = {2, 0};
+  auto file = std::make_shared<CountingBufferReader>(helper_.buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(
+      RecordBatchFileReader::Open(file, helper_.footer_offset_, options, &reader));
+  ASSERT_EQ(3, reader->schema()->num_fields());
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(table_->RemoveColumn(1, &expected));
+  BatchVector out_batches;
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadRecordBatch(i, &batch));
+    ASSERT_OK(batch->Validate());
+    out_batches.push_back(batch);
+  }
+  std::shared_ptr<Table> result;
+  ASSERT_OK(Table::FromRecordBatches(out_batches, &result));
+  AssertTablesEqual(*expected, *result);
+
+  ASSERT_OK(reader->ReadRows(1, 7, &result));
+  AssertTablesEqual(*expected->Slice(1, 7), *result, /*same_chunk_layout=*/false);
+
+  // Explicit field indices take precedence
+  ASSERT_OK(reader->ReadRows(0, 9, {1}, &result));
+  ASSERT_EQ(1, result->num_columns());
+  ASSERT_EQ("f1", result->schema()->field(0)->name());
+
+  options.included_fields = {3};
+  ASSERT_RAISES(Invalid, RecordBatchFileReader::Open(file, helper_.footer_offset_,
+                                                     options, &reader));
+}
+
+TEST_F(TestReadRows, IncludedFieldsSkipBuffers) {
+  auto ReadBytes = [&](const std::vector<int>& included_fields, int64_t* out) {
+    auto options = IpcOptions::Defaults();
+    options.included_fields = included_fields;
+    auto file = std::make_shared<CountingBufferReader>(helper_.buffer_);
+    std::shared_ptr<RecordBatchFileReader> reader;
+    ASSERT_OK(
+        RecordBatchFileReader::Open(file, helper_.footer_offset_, options, &reader));
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(reader->ReadRecordBatch(0, &batch));
+    const int64_t before = file->bytes_read;
+    ASSERT_OK(reader->ReadRecordBatch(2, &batch));
+    *out = file->bytes_read - before;
+  };
+
+  int64_t all_bytes, int_bytes, string_bytes;
+  ReadBytes({}, &all_bytes);
+  ReadBytes({0}, &int_bytes);
+  ReadBytes({2}, &string_bytes);
+  ASSERT_LT(int_bytes, string_bytes);
+  ASSERT_LT(string_bytes, all_bytes);
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
@@ -885,6 +1303,46 @@ TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   ASSERT_EQ(nullptr, batch);
 }
 
+TEST(TestRecordBatchPayloadBuilder, ReusesMetadata) {
+  auto schema = arrow::schema({field("f0", int32()), field("f1", utf8())});
+  auto MakeBatch = [&](const std::string& ints, const std::string& strings) {
+    auto f0 = ArrayFromJSON(int32(), ints);
+    return RecordBatch::Make(schema, f0->length(), {f0, ArrayFromJSON(utf8(), strings)});
+  };
+  BatchVector batches = {MakeBatch("[1, 2, null]", R"(["a", null, "bc"])"),
+                         MakeBatch("[3]", R"(["defgh"])"),
+                         MakeBatch("[4, 5]", R"(["i", "jk"])")};
+  auto other_schema = arrow::schema({field("f0", int32())});
+  auto other_array = ArrayFromJSON(int32(), "[6, 7, 8, 9]");
+  batches.push_back(RecordBatch::Make(other_schema, 4, {other_array}));
+
+  auto options = IpcOptions::Defaults();
+  internal::RecordBatchPayloadBuilder builder(options, default_memory_pool());
+  std::vector<internal::IpcPayload> payloads(batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_OK(builder.Build(*batches[i], &payloads[i]));
+
+    internal::IpcPayload expected;
+    ASSERT_OK(internal::GetRecordBatchPayload(*batches[i], options, default_memory_pool(),
+                                              &expected));
+    ASSERT_EQ(Message::RECORD_BATCH, payloads[i].type);
+    ASSERT_EQ(expected.body_length, payloads[i].body_length);
+    ASSERT_EQ(expected.body_buffers.size(), payloads[i].body_buffers.size());
+    AssertBufferEqual(*expected.metadata, *payloads[i].metadata);
+  }
+  // The previous metadata was still held by its payload
+  ASSERT_NE(payloads[0].metadata->data(), payloads[1].metadata->data());
+
+  // Once released, the metadata is reused
+  internal::IpcPayload payload;
+  ASSERT_OK(builder.Build(*batches[0], &payload));
+  const uint8_t* released_data = payload.metadata->data();
+  payload = internal::IpcPayload();
+  ASSERT_OK(builder.Build(*batches[1], &payload));
+  ASSERT_EQ(released_data, payload.metadata->data());
+  AssertBufferEqual(*payloads[1].metadata, *payload.metadata);
+}
+
 // Delimit IPC stream messages and reassemble with the indicated messages
 // included. This way we can remove messages from an IPC stream to test
 // different failure modes or other difficult-to-test behaviors
@@ -1043,6 +1501,84 @@ TEST_F(TestTensorRoundTrip, NonContiguous) {
   CheckTensorRoundTrip(tensor);
 }
 
+TEST_F(TestTensorRoundTrip, NonContiguousParallel) {
+  std::string path = "test-write-tensor-strided-parallel";
+  constexpr int64_t kBufferSize = 1 << 22;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> values;
+  randint(2 * 300 * 400, 0, 100, &values);
+  auto data = Buffer::Wrap(values);
+
+  // Every other element along the last dimension, and column-major
+  Tensor strided(int64(), data, {300, 200}, {3200, 16}, {"foo", "bar"});
+  Tensor column_major(int64(), data, {400, 300}, {8, 3200});
+  Tensor transposed(int64(), data, {20, 300, 40}, {320, 6400, 8});
+  for (const Tensor* tensor : {&strided, &column_major, &transposed}) {
+    CheckTensorRoundTrip(*tensor);
+
+    int32_t metadata_length;
+    int64_t body_length;
+    ASSERT_OK(mmap_->Seek(0));
+    ASSERT_OK(WriteTensor(*tensor, mmap_.get(), &metadata_length, &body_length,
+                          /*use_threads=*/false));
+    ASSERT_OK(mmap_->Seek(0));
+    std::shared_ptr<Tensor> result;
+    ASSERT_OK(ReadTensor(mmap_.get(), &result));
+    ASSERT_TRUE(tensor->Equals(*result));
+  }
+
+  // The map isn't resized for tensors which don't fit
+  Tensor too_large(int64(), data, {2 * 300 * 400});
+  int32_t metadata_length;
+  int64_t body_length;
+  ASSERT_OK(mmap_->Seek(kBufferSize - 1024));
+  ASSERT_RAISES(Invalid,
+                WriteTensor(too_large, mmap_.get(), &metadata_length, &body_length));
+  int64_t position;
+  ASSERT_OK(mmap_->Tell(&position));
+  ASSERT_EQ(kBufferSize - 1024, position);
+}
+
+TEST_F(TestTensorRoundTrip, ReserveTensor) {
+  std::string path = "test-reserve-tensor";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> shape = {4, 6};
+  std::vector<std::string> dim_names = {"foo", "bar"};
+  int32_t metadata_length;
+  std::shared_ptr<Tensor> reserved;
+  ASSERT_OK(mmap_->Seek(0));
+  ASSERT_OK(ReserveTensor(int32(), shape, dim_names, mmap_.get(), &metadata_length,
+                          &reserved));
+  ASSERT_TRUE(reserved->is_mutable());
+  ASSERT_TRUE(reserved->is_row_major());
+  ASSERT_EQ(dim_names, reserved->dim_names());
+
+  // The position is past the body of the message
+  int64_t position;
+  ASSERT_OK(mmap_->Tell(&position));
+  ASSERT_EQ(metadata_length + 24 * static_cast<int64_t>(sizeof(int32_t)), position);
+
+  auto values = reinterpret_cast<int32_t*>(reserved->raw_mutable_data());
+  for (int32_t i = 0; i < 24; ++i) {
+    values[i] = i * i;
+  }
+
+  ASSERT_OK(mmap_->Seek(0));
+  std::shared_ptr<Tensor> result;
+  ASSERT_OK(ReadTensor(mmap_.get(), &result));
+  ASSERT_TRUE(reserved->Equals(*result));
+  ASSERT_EQ(dim_names, result->dim_names());
+
+  ASSERT_RAISES(TypeError, ReserveTensor(utf8(), shape, {}, mmap_.get(),
+                                         &metadata_length, &reserved));
+  ASSERT_OK(mmap_->Seek(kBufferSize - 64));
+  ASSERT_RAISES(Invalid, ReserveTensor(int32(), shape, {}, mmap_.get(),
+                                       &metadata_length, &reserved));
+}
+
 class TestSparseTensorRoundTrip : public ::testing::Test, public IpcTestFixture {
  public:
   void SetUp() { IpcTestFixture::SetUp(); }
@@ -1120,6 +1656,71 @@ void TestSparseTensorRoundTrip::CheckSparseTensorRoundTrip<SparseCSRIndex>(
   ASSERT_TRUE(result->Equals(*result));
 }
 
+template <>
+void TestSparseTensorRoundTrip::CheckSparseTensorRoundTrip<SparseCSCIndex>(
+    const SparseTensorImpl<SparseCSCIndex>& tensor) {
+  const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+  const int elem_size = type.bit_width() / 8;
+
+  int32_t metadata_length;
+  int64_t body_length;
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  ASSERT_OK(WriteSparseTensor(tensor, mmap_.get(), &metadata_length, &body_length,
+                              default_memory_pool()));
+
+  const auto& sparse_index = checked_cast<const SparseCSCIndex&>(*tensor.sparse_index());
+  const int64_t indptr_length = elem_size * sparse_index.indptr()->size();
+  const int64_t indices_length = elem_size * sparse_index.indices()->size();
+  const int64_t data_length = elem_size * tensor.non_zero_length();
+  const int64_t expected_body_length = indptr_length + indices_length + data_length;
+  ASSERT_EQ(expected_body_length, body_length);
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  std::shared_ptr<SparseTensor> result;
+  ASSERT_OK(ReadSparseTensor(mmap_.get(), &result));
+  ASSERT_EQ(SparseTensorFormat::CSC, result->format_id());
+  ASSERT_TRUE(result->Equals(tensor));
+}
+
+template <>
+void TestSparseTensorRoundTrip::CheckSparseTensorRoundTrip<SparseCSFIndex>(
+    const SparseTensorImpl<SparseCSFIndex>& tensor) {
+  const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+  const int elem_size = type.bit_width() / 8;
+
+  int32_t metadata_length;
+  int64_t body_length;
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  ASSERT_OK(WriteSparseTensor(tensor, mmap_.get(), &metadata_length, &body_length,
+                              default_memory_pool()));
+
+  const auto& sparse_index = checked_cast<const SparseCSFIndex&>(*tensor.sparse_index());
+  int64_t expected_body_length = elem_size * tensor.non_zero_length();
+  for (const auto& indptr : sparse_index.indptr()) {
+    expected_body_length += elem_size * indptr->size();
+  }
+  for (const auto& indices : sparse_index.indices()) {
+    expected_body_length += elem_size * indices->size();
+  }
+  ASSERT_EQ(expected_body_length, body_length);
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  std::shared_ptr<SparseTensor> result;
+  ASSERT_OK(ReadSparseTensor(mmap_.get(), &result));
+  ASSERT_EQ(SparseTensorFormat::CSF, result->format_id());
+  ASSERT_TRUE(result->Equals(tensor));
+
+  const auto& resulted_sparse_index =
+      checked_cast<const SparseCSFIndex&>(*result->sparse_index());
+  ASSERT_EQ(sparse_index.axis_order(), resulted_sparse_index.axis_order());
+}
+
 TEST_F(TestSparseTensorRoundTrip, WithSparseCOOIndex) {
   std::string path = "test-write-sparse-coo-tensor";
   constexpr int64_t kBufferSize = 1 << 20;
@@ -1154,6 +1755,40 @@ TEST_F(TestSparseTensorRoundTrip, WithSparseCSRIndex) {
   CheckSparseTensorRoundTrip(st);
 }
 
+TEST_F(TestSparseTensorRoundTrip, WithSparseCSCIndex) {
+  std::string path = "test-write-sparse-csc-matrix";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> shape = {4, 6};
+  std::vector<std::string> dim_names = {"foo", "bar"};
+  std::vector<int64_t> values = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                 0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+
+  auto data = Buffer::Wrap(values);
+  NumericTensor<Int64Type> t(data, shape, {}, dim_names);
+  SparseTensorImpl<SparseCSCIndex> st(t);
+
+  CheckSparseTensorRoundTrip(st);
+}
+
+TEST_F(TestSparseTensorRoundTrip, WithSparseCSFIndex) {
+  std::string path = "test-write-sparse-csf-tensor";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> shape = {2, 3, 4};
+  std::vector<std::string> dim_names = {"foo", "bar", "baz"};
+  std::vector<int64_t> values = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                 0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+
+  auto data = Buffer::Wrap(values);
+  NumericTensor<Int64Type> t(data, shape, {}, dim_names);
+  SparseTensorImpl<SparseCSFIndex> st(t);
+
+  CheckSparseTensorRoundTrip(st);
+}
+
 TEST(TestRecordBatchStreamReader, MalformedInput) {
   const std::string empty_str = "";
   const std::string garbage_str = "12345678";
@@ -1208,6 +1843,30 @@ TEST(TestDictionaryMemo, ReusedDictionaries) {
   ASSERT_EQ(0, returned_id);
 }
 
+TEST(TestDictionaryMemo, DictionaryDeltas) {
+  DictionaryMemo memo;
+  std::shared_ptr<Field> field1 = field("a", dictionary(int8(), utf8()));
+  ASSERT_OK(memo.AddField(0, field1));
+
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+  auto delta = ArrayFromJSON(utf8(), R"(["baz"])");
+  ASSERT_RAISES(KeyError, memo.AddDictionaryDelta(0, delta, default_memory_pool()));
+  ASSERT_RAISES(KeyError, memo.UpdateDictionary(0, dict));
+
+  ASSERT_OK(memo.AddDictionary(0, dict));
+  ASSERT_OK(memo.AddDictionaryDelta(0, delta, default_memory_pool()));
+  std::shared_ptr<Array> result;
+  ASSERT_OK(memo.GetDictionary(0, &result));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])"), *result);
+
+  ASSERT_RAISES(TypeError, memo.AddDictionaryDelta(0, ArrayFromJSON(int32(), "[1]"),
+                                                   default_memory_pool()));
+
+  ASSERT_OK(memo.UpdateDictionary(0, dict));
+  ASSERT_OK(memo.GetDictionary(0, &result));
+  ASSERT_EQ(dict.get(), result.get());
+}
+
 }  // namespace test
 }  // namespace ipc
 }  // namespace arrow
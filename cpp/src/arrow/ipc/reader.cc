@@ -17,8 +17,12 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -37,13 +41,20 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor_inline.h"
 
 using arrow::internal::checked_pointer_cast;
@@ -73,7 +84,7 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 
 #define CHECK_HAS_BODY(message)                                       \
   do {                                                                \
-    if ((message).body() == nullptr) {                                \
+    if (!(message).has_body()) {                                      \
       return Status::IOError("Expected body in IPC message of type ", \
                              FormatMessageType((message).type()));    \
     }                                                                 \
@@ -95,10 +106,40 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     util::Codec* codec = NULLPTR, int64_t body_offset = 0)
+      : metadata_(metadata), file_(file), codec_(codec), body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (!decompressed_buffers_.empty()) {
+      if (buffer_index >= static_cast<int>(decompressed_buffers_.size())) {
+        return Status::IOError("buffer_index out of range.");
+      }
+      *out = std::move(decompressed_buffers_[buffer_index]);
+      return Status::OK();
+    }
+    return ReadBuffer(buffer_index, out);
+  }
+
+  // Read and decompress all body buffers up front, in parallel on the CPU
+  // thread pool. GetBuffer() then returns them without further work
+  Status DecompressAllBuffers() {
+    DCHECK_NE(codec_, nullptr);
+    auto buffers = metadata_->buffers();
+    if (buffers == nullptr) {
+      return Status::IOError(
+          "Buffers-pointer of flatbuffer-encoded RecordBatch is null.");
+    }
+    const int num_buffers = static_cast<int>(buffers->size());
+    std::vector<std::shared_ptr<Buffer>> decompressed(num_buffers);
+    // One-shot decompression is stateless, so the codec can be shared
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_buffers, [&](int i) { return ReadBuffer(i, &decompressed[i]); }));
+    decompressed_buffers_ = std::move(decompressed);
+    return Status::OK();
+  }
+
+  Status ReadBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     auto buffers = metadata_->buffers();
     if (buffers == nullptr) {
       return Status::IOError(
@@ -118,10 +159,45 @@ class IpcComponentSource {
             "Buffer ", buffer_index,
             " did not start on 8-byte aligned offset: ", buffer->offset());
       }
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      const int64_t offset = body_offset_ + buffer->offset();
+      if (codec_ == nullptr) {
+        return file_->ReadAt(offset, buffer->length(), out);
+      }
+      std::shared_ptr<Buffer> compressed;
+      RETURN_NOT_OK(file_->ReadAt(offset, buffer->length(), &compressed));
+      return DecompressBuffer(*compressed, out);
     }
   }
 
+  // Decompress a buffer prefixed with its uncompressed length
+  Status DecompressBuffer(const Buffer& compressed, std::shared_ptr<Buffer>* out) {
+    const int64_t prefix_length = static_cast<int64_t>(sizeof(int64_t));
+    if (compressed.size() < prefix_length) {
+      return Status::IOError("Compressed IPC buffer is too short: ", compressed.size(),
+                             " bytes");
+    }
+    int64_t uncompressed_length;
+    std::memcpy(&uncompressed_length, compressed.data(), prefix_length);
+    uncompressed_length = BitUtil::FromLittleEndian(uncompressed_length);
+    if (uncompressed_length < 0) {
+      return Status::IOError("Invalid uncompressed length in compressed IPC buffer");
+    }
+
+    std::shared_ptr<Buffer> result;
+    RETURN_NOT_OK(AllocateBuffer(default_memory_pool(), uncompressed_length, &result));
+    int64_t actual_length;
+    RETURN_NOT_OK(codec_->Decompress(compressed.size() - prefix_length,
+                                     compressed.data() + prefix_length,
+                                     uncompressed_length, result->mutable_data(),
+                                     &actual_length));
+    if (actual_length != uncompressed_length) {
+      return Status::IOError("Decompressed IPC buffer has ", actual_length,
+                             " bytes, expected ", uncompressed_length);
+    }
+    *out = std::move(result);
+    return Status::OK();
+  }
+
   Status GetFieldMetadata(int field_index, ArrayData* out) {
     auto nodes = metadata_->nodes();
     if (nodes == nullptr) {
@@ -142,6 +218,11 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  util::Codec* codec_;
+  // Position of the message body in file_
+  int64_t body_offset_;
+  // Filled by DecompressAllBuffers()
+  std::vector<std::shared_ptr<Buffer>> decompressed_buffers_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -155,6 +236,9 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // Whether to only consume the metadata of the field being loaded, without
+  // reading its buffers
+  bool skip_buffers;
 };
 
 static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out);
@@ -175,6 +259,10 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_buffers) {
+      *out = nullptr;
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -322,6 +410,9 @@ class ArrayLoader {
   Status Visit(const DictionaryType& type) {
     RETURN_NOT_OK(
         LoadArray(*::arrow::field("indices", type.index_type()), context_, out_));
+    if (context_->skip_buffers) {
+      return Status::OK();
+    }
 
     // Look up dictionary
     int64_t id = -1;
@@ -361,46 +452,117 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
   CHECK_MESSAGE_TYPE(message.type(), Message::RECORD_BATCH);
   CHECK_HAS_BODY(message);
   auto options = IpcOptions::Defaults();
-  io::BufferReader reader(message.body());
-  return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options, &reader,
-                         out);
+  auto reader = message.body_reader();
+  return ReadRecordBatch(*message.metadata(), schema, dictionary_memo, options,
+                         reader.get(), out);
 }
 
 // ----------------------------------------------------------------------
 // Array loading
 
+// Flag the fields of schema selected by their indices
+static Status GetIncludedFields(const Schema& schema,
+                                const std::vector<int>& field_indices,
+                                std::vector<bool>* out) {
+  out->assign(schema.num_fields(), false);
+  for (int index : field_indices) {
+    if (index < 0 || index >= schema.num_fields()) {
+      return Status::Invalid("Field index ", index, " out of range for a schema of ",
+                             schema.num_fields(), " fields");
+    }
+    (*out)[index] = true;
+  }
+  return Status::OK();
+}
+
+// The schema of the fields flagged in included_fields, or all fields if null
+static std::shared_ptr<Schema> GetIncludedSchema(
+    const std::shared_ptr<Schema>& schema, const std::vector<bool>* included_fields) {
+  if (included_fields == nullptr) {
+    return schema;
+  }
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    if ((*included_fields)[i]) {
+      fields.push_back(schema->field(i));
+    }
+  }
+  return std::make_shared<Schema>(fields, schema->metadata());
+}
+
+// Load the fields of a record batch, or only those flagged in included_fields
+// if not null. The buffers of the other fields are not read
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
+                                        const std::vector<bool>* included_fields,
                                         int64_t num_rows, int max_recursion_depth,
                                         IpcComponentSource* source,
                                         const DictionaryMemo* dictionary_memo,
                                         std::shared_ptr<RecordBatch>* out) {
   ArrayLoaderContext context{source, dictionary_memo, /*field_index=*/0,
-                             /*buffer_index=*/0, max_recursion_depth};
+                             /*buffer_index=*/0, max_recursion_depth,
+                             /*skip_buffers=*/false};
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
+  std::vector<std::shared_ptr<ArrayData>> arrays;
   for (int i = 0; i < schema->num_fields(); ++i) {
+    const bool included = included_fields == nullptr || (*included_fields)[i];
+    context.skip_buffers = !included;
     auto arr = std::make_shared<ArrayData>();
     RETURN_NOT_OK(LoadArray(*schema->field(i), &context, arr.get()));
     if (num_rows != arr->length) {
       return Status::IOError("Array length did not match record batch length");
     }
-    arrays[i] = std::move(arr);
+    if (included) {
+      arrays.push_back(std::move(arr));
+    }
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  *out = RecordBatch::Make(GetIncludedSchema(schema, included_fields), num_rows,
+                           std::move(arrays));
   return Status::OK();
 }
 
+// Read a record batch whose body starts at body_offset in file, loading the
+// fields flagged in included_fields (all if null)
+static Status ReadRecordBatchFields(const flatbuf::RecordBatch* metadata,
+                                    const std::shared_ptr<Schema>& schema,
+                                    const std::vector<bool>* included_fields,
+                                    const DictionaryMemo* dictionary_memo,
+                                    const IpcOptions& options, io::RandomAccessFile* file,
+                                    int64_t body_offset,
+                                    std::shared_ptr<RecordBatch>* out) {
+  ARROW_TRACE_SPAN(span, "ipc", "ReadRecordBatch");
+  ScopedMemoryTag memory_tag("ipc.read");
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetCompression(metadata, &compression));
+  std::unique_ptr<util::Codec> codec;
+  if (compression != Compression::UNCOMPRESSED) {
+    RETURN_NOT_OK(util::Codec::Create(compression, &codec));
+  }
+
+  IpcComponentSource source(metadata, file, codec.get(), body_offset);
+  // Skipped fields are not read, so their buffers shouldn't be decompressed
+  if (codec != nullptr && options.use_threads && included_fields == nullptr) {
+    RETURN_NOT_OK(source.DecompressAllBuffers());
+  }
+  return LoadRecordBatchFromSource(schema, included_fields, metadata->length(),
+                                   options.max_recursion_depth, &source, dictionary_memo,
+                                   out);
+}
+
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      const DictionaryMemo* dictionary_memo,
                                      const IpcOptions& options,
                                      io::RandomAccessFile* file,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(),
-                                   options.max_recursion_depth, &source, dictionary_memo,
-                                   out);
+  if (options.included_fields.empty()) {
+    return ReadRecordBatchFields(metadata, schema, /*included_fields=*/NULLPTR,
+                                 dictionary_memo, options, file, /*body_offset=*/0, out);
+  }
+  std::vector<bool> included_fields;
+  RETURN_NOT_OK(GetIncludedFields(*schema, options.included_fields, &included_fields));
+  return ReadRecordBatchFields(metadata, schema, &included_fields, dictionary_memo,
+                               options, file, /*body_offset=*/0, out);
 }
 
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
@@ -446,6 +608,13 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
   auto dictionary = batch->column(0);
+  if (dictionary_batch->isDelta()) {
+    return dictionary_memo->AddDictionaryDelta(id, dictionary, default_memory_pool());
+  }
+  if (dictionary_memo->HasDictionary(id)) {
+    return Status::NotImplemented("Replacing the dictionary with id ", id,
+                                  " is not supported, only delta batches can extend it");
+  }
   return dictionary_memo->AddDictionary(id, dictionary);
 }
 
@@ -459,10 +628,17 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
 class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
  public:
   RecordBatchStreamReaderImpl() {}
-  ~RecordBatchStreamReaderImpl() {}
 
-  Status Open(std::unique_ptr<MessageReader> message_reader) {
+  ~RecordBatchStreamReaderImpl() {
+    // Make sure the prefetching task doesn't outlive the reader members
+    std::unique_lock<std::mutex> lock(prefetch_mutex_);
+    prefetch_stopping_ = true;
+    prefetch_cv_.wait(lock, [this] { return !prefetch_running_; });
+  }
+
+  Status Open(std::unique_ptr<MessageReader> message_reader, const IpcOptions& options) {
     message_reader_ = std::move(message_reader);
+    options_ = options;
     return ReadSchema();
   }
 
@@ -484,8 +660,8 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     // Only invoke this method if we already know we have a dictionary message
     DCHECK_EQ(message.type(), Message::DICTIONARY_BATCH);
     CHECK_HAS_BODY(message);
-    io::BufferReader reader(message.body());
-    return ReadDictionary(*message.metadata(), &dictionary_memo_, &reader);
+    auto reader = message.body_reader();
+    return ReadDictionary(*message.metadata(), &dictionary_memo_, reader.get());
   }
 
   Status ReadInitialDictionaries() {
@@ -527,6 +703,90 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
+    if (options_.prefetch_messages > 0) {
+      return ReadNextPrefetched(batch);
+    }
+    return ReadNextSerially(batch);
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+ private:
+  // A record batch read ahead by the prefetching task, or the end of the
+  // stream if batch is null
+  struct PrefetchedBatch {
+    Status status;
+    std::shared_ptr<RecordBatch> batch;
+  };
+
+  // Take the next batch read ahead on the I/O thread pool, waiting for it
+  // if needed, and make sure more batches are being read meanwhile
+  Status ReadNextPrefetched(std::shared_ptr<RecordBatch>* batch) {
+    std::unique_lock<std::mutex> lock(prefetch_mutex_);
+    if (prefetched_.empty() && prefetch_finished_) {
+      // The end of stream, or the error, was already returned
+      *batch = nullptr;
+      return prefetch_final_status_;
+    }
+    RETURN_NOT_OK(StartPrefetchUnlocked());
+    prefetch_cv_.wait(lock, [this] { return !prefetched_.empty(); });
+    PrefetchedBatch next = std::move(prefetched_.front());
+    prefetched_.pop_front();
+    if (!next.status.ok() || next.batch == nullptr) {
+      prefetch_final_status_ = next.status;
+    } else {
+      // Keep reading ahead while the caller consumes this batch
+      RETURN_NOT_OK(StartPrefetchUnlocked());
+    }
+    *batch = std::move(next.batch);
+    return next.status;
+  }
+
+  // Spawn the prefetching task, unless it is running or has nothing to do.
+  // prefetch_mutex_ must be held
+  Status StartPrefetchUnlocked() {
+    if (prefetch_running_ || prefetch_finished_ ||
+        static_cast<int>(prefetched_.size()) >= options_.prefetch_messages) {
+      return Status::OK();
+    }
+    prefetch_running_ = true;
+    Status st = ::arrow::internal::GetIOThreadPool()->Spawn([this] { Prefetch(); });
+    if (!st.ok()) {
+      prefetch_running_ = false;
+    }
+    return st;
+  }
+
+  // Read and decode batches until prefetch_messages of them are waiting, the
+  // stream ends or the reader is destroyed. Messages are read and dictionaries
+  // applied in stream order, since only one such task runs at a time
+  void Prefetch() {
+    while (true) {
+      {
+        std::lock_guard<std::mutex> lock(prefetch_mutex_);
+        if (prefetch_stopping_ ||
+            static_cast<int>(prefetched_.size()) >= options_.prefetch_messages) {
+          prefetch_running_ = false;
+          prefetch_cv_.notify_all();
+          return;
+        }
+      }
+      PrefetchedBatch next;
+      next.status = ReadNextSerially(&next.batch);
+      std::lock_guard<std::mutex> lock(prefetch_mutex_);
+      const bool finished = !next.status.ok() || next.batch == nullptr;
+      prefetched_.push_back(std::move(next));
+      if (finished) {
+        prefetch_finished_ = true;
+        prefetch_running_ = false;
+        prefetch_cv_.notify_all();
+        return;
+      }
+      prefetch_cv_.notify_all();
+    }
+  }
+
+  Status ReadNextSerially(std::shared_ptr<RecordBatch>* batch) {
     if (!read_initial_dictionaries_) {
       RETURN_NOT_OK(ReadInitialDictionaries());
     }
@@ -539,28 +799,28 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     }
 
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
-    if (message == nullptr) {
-      // End of stream
-      *batch = nullptr;
-      return Status::OK();
+    while (true) {
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+      if (message == nullptr) {
+        // End of stream
+        *batch = nullptr;
+        return Status::OK();
+      }
+      if (message->type() != Message::DICTIONARY_BATCH) {
+        break;
+      }
+      // Delta dictionaries apply to the record batches that follow them
+      RETURN_NOT_OK(ParseDictionary(*message));
     }
 
-    if (message->type() == Message::DICTIONARY_BATCH) {
-      // TODO(wesm): implement delta dictionaries
-      return Status::NotImplemented("Delta dictionaries not yet implemented");
-    } else {
-      CHECK_HAS_BODY(*message);
-      io::BufferReader reader(message->body());
-      return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, &reader,
-                             batch);
-    }
+    CHECK_HAS_BODY(*message);
+    auto reader = message->body_reader();
+    return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, options_,
+                           reader.get(), batch);
   }
 
-  std::shared_ptr<Schema> schema() const { return schema_; }
-
- private:
   std::unique_ptr<MessageReader> message_reader_;
+  IpcOptions options_;
 
   bool read_initial_dictionaries_ = false;
 
@@ -570,6 +830,15 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
   DictionaryMemo dictionary_memo_;
   std::shared_ptr<Schema> schema_;
+
+  // State shared with the prefetching task, guarded by prefetch_mutex_
+  std::mutex prefetch_mutex_;
+  std::condition_variable prefetch_cv_;
+  std::deque<PrefetchedBatch> prefetched_;
+  bool prefetch_running_ = false;
+  bool prefetch_finished_ = false;
+  bool prefetch_stopping_ = false;
+  Status prefetch_final_status_;
 };
 
 RecordBatchStreamReader::RecordBatchStreamReader() {
@@ -580,22 +849,28 @@ RecordBatchStreamReader::~RecordBatchStreamReader() {}
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::shared_ptr<RecordBatchReader>* reader) {
-  // Private ctor
-  auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
-  *reader = result;
-  return Status::OK();
+  return Open(std::move(message_reader), IpcOptions::Defaults(), reader);
 }
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::unique_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::unique_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), IpcOptions::Defaults()));
   *reader = std::move(result);
   return Status::OK();
 }
 
+Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
+                                     const IpcOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* reader) {
+  // Private ctor
+  auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), options));
+  *reader = result;
+  return Status::OK();
+}
+
 Status RecordBatchStreamReader::Open(io::InputStream* stream,
                                      std::shared_ptr<RecordBatchReader>* out) {
   return Open(MessageReader::Open(stream), out);
@@ -606,6 +881,12 @@ Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& str
   return Open(MessageReader::Open(stream), out);
 }
 
+Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
+                                     const IpcOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* out) {
+  return Open(MessageReader::Open(stream), options, out);
+}
+
 std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
   return impl_->schema();
 }
@@ -619,7 +900,11 @@ Status RecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
 
 class RecordBatchFileReader::RecordBatchFileReaderImpl {
  public:
-  RecordBatchFileReaderImpl() : file_(NULLPTR), footer_offset_(0), footer_(NULLPTR) {}
+  RecordBatchFileReaderImpl()
+      : file_(NULLPTR),
+        footer_offset_(0),
+        footer_(NULLPTR),
+        options_(IpcOptions::Defaults()) {}
 
   Status ReadFooter() {
     int magic_size = static_cast<int>(strlen(kArrowMagicBytes));
@@ -695,8 +980,9 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       std::unique_ptr<Message> message;
       RETURN_NOT_OK(ReadMessageFromBlock(GetDictionaryBlock(i), &message));
 
-      io::BufferReader reader(message->body());
-      RETURN_NOT_OK(ReadDictionary(*message->metadata(), &dictionary_memo_, &reader));
+      auto reader = message->body_reader();
+      RETURN_NOT_OK(
+          ReadDictionary(*message->metadata(), &dictionary_memo_, reader.get()));
     }
     return Status::OK();
   }
@@ -710,12 +996,135 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       read_dictionaries_ = true;
     }
 
+    // Projections only read the buffers of the included fields from the file
+    if (!included_fields_.empty()) {
+      return ReadRecordBatchFields(i, included_fields_, batch);
+    }
+
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
 
-    io::BufferReader reader(message->body());
+    auto reader = message->body_reader();
     return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         &reader, batch);
+                                         options_, reader.get(), batch);
+  }
+
+  // Read the metadata of a record batch, leaving its body in the file
+  Status ReadRecordBatchMetadata(const FileBlock& block,
+                                 std::shared_ptr<Buffer>* metadata,
+                                 const flatbuf::RecordBatch** out) {
+    if (block.metadata_length <= static_cast<int32_t>(sizeof(int32_t))) {
+      return Status::Invalid("Invalid record batch metadata length: ",
+                             block.metadata_length);
+    }
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(file_->ReadAt(block.offset, block.metadata_length, &buffer));
+    if (buffer->size() < block.metadata_length) {
+      return Status::Invalid("Expected to read ", block.metadata_length,
+                             " metadata bytes but got ", buffer->size());
+    }
+    *metadata = SliceBuffer(buffer, 4, buffer->size() - 4);
+
+    const flatbuf::Message* message;
+    RETURN_NOT_OK(
+        internal::VerifyMessage((*metadata)->data(), (*metadata)->size(), &message));
+    *out = message->header_as_RecordBatch();
+    if (*out == nullptr) {
+      return Status::IOError(
+          "Header-type of flatbuffer-encoded Message is not RecordBatch.");
+    }
+    return Status::OK();
+  }
+
+  // Read only the buffers of the included fields of a record batch
+  Status ReadRecordBatchFields(int i, const std::vector<bool>& included_fields,
+                               std::shared_ptr<RecordBatch>* batch) {
+    const FileBlock block = GetRecordBatchBlock(i);
+    std::shared_ptr<Buffer> metadata;
+    const flatbuf::RecordBatch* batch_metadata;
+    RETURN_NOT_OK(ReadRecordBatchMetadata(block, &metadata, &batch_metadata));
+    return ::arrow::ipc::ReadRecordBatchFields(batch_metadata, schema_, &included_fields,
+                                               &dictionary_memo_, options_, file_,
+                                               block.offset + block.metadata_length,
+                                               batch);
+  }
+
+  // Record the number of rows preceding each record batch, from their
+  // metadata only
+  Status BuildRowIndex() {
+    if (!batch_row_offsets_.empty()) {
+      return Status::OK();
+    }
+    std::vector<int64_t> row_offsets(1, 0);
+    row_offsets.reserve(num_record_batches() + 1);
+    for (int i = 0; i < num_record_batches(); ++i) {
+      std::shared_ptr<Buffer> metadata;
+      const flatbuf::RecordBatch* batch_metadata;
+      RETURN_NOT_OK(
+          ReadRecordBatchMetadata(GetRecordBatchBlock(i), &metadata, &batch_metadata));
+      row_offsets.push_back(row_offsets.back() + batch_metadata->length());
+    }
+    batch_row_offsets_ = std::move(row_offsets);
+    return Status::OK();
+  }
+
+  Status CountRows(int64_t* num_rows) {
+    RETURN_NOT_OK(BuildRowIndex());
+    *num_rows = batch_row_offsets_.back();
+    return Status::OK();
+  }
+
+  // Read a range of rows of the fields flagged in included_fields, or of the
+  // fields included by the options if null
+  Status ReadRows(int64_t offset, int64_t length,
+                  const std::vector<bool>* included_fields,
+                  std::shared_ptr<Table>* out) {
+    RETURN_NOT_OK(BuildRowIndex());
+    const int64_t num_rows = batch_row_offsets_.back();
+    if (offset < 0 || length < 0 || offset > num_rows) {
+      return Status::Invalid("Row range out of bounds: offset ", offset, ", length ",
+                             length, " in a file of ", num_rows, " rows");
+    }
+    length = std::min(length, num_rows - offset);
+
+    if (included_fields == nullptr && !included_fields_.empty()) {
+      included_fields = &included_fields_;
+    }
+
+    if (!read_dictionaries_) {
+      RETURN_NOT_OK(ReadDictionaries());
+      read_dictionaries_ = true;
+    }
+
+    // The last batch starting at or before offset, skipping empty ones
+    const int first_batch =
+        static_cast<int>(std::upper_bound(batch_row_offsets_.begin(),
+                                          batch_row_offsets_.end(), offset) -
+                         batch_row_offsets_.begin()) -
+        1;
+    const int64_t end = offset + length;
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int i = first_batch; i < num_record_batches() && batch_row_offsets_[i] < end;
+         ++i) {
+      const int64_t batch_rows = batch_row_offsets_[i + 1] - batch_row_offsets_[i];
+      const int64_t batch_start = std::max<int64_t>(offset - batch_row_offsets_[i], 0);
+      const int64_t batch_end = std::min(end - batch_row_offsets_[i], batch_rows);
+      if (batch_end <= batch_start) {
+        continue;
+      }
+      std::shared_ptr<RecordBatch> batch;
+      if (included_fields != nullptr) {
+        RETURN_NOT_OK(ReadRecordBatchFields(i, *included_fields, &batch));
+      } else {
+        RETURN_NOT_OK(ReadRecordBatch(i, &batch));
+      }
+      if (batch_start > 0 || batch_end < batch_rows) {
+        batch = batch->Slice(batch_start, batch_end - batch_start);
+      }
+      batches.push_back(std::move(batch));
+    }
+    return Table::FromRecordBatches(GetIncludedSchema(schema_, included_fields), batches,
+                                    out);
   }
 
   Status ReadSchema() {
@@ -723,16 +1132,24 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_);
   }
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+              const IpcOptions& options) {
     owned_file_ = file;
-    return Open(file.get(), footer_offset);
+    return Open(file.get(), footer_offset, options);
   }
 
-  Status Open(io::RandomAccessFile* file, int64_t footer_offset) {
+  Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+              const IpcOptions& options) {
     file_ = file;
     footer_offset_ = footer_offset;
+    options_ = options;
     RETURN_NOT_OK(ReadFooter());
-    return ReadSchema();
+    RETURN_NOT_OK(ReadSchema());
+    if (!options_.included_fields.empty()) {
+      RETURN_NOT_OK(
+          GetIncludedFields(*schema_, options_.included_fields, &included_fields_));
+    }
+    return Status::OK();
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
@@ -753,8 +1170,16 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
+  // Number of rows preceding each record batch, followed by the total number
+  // of rows. Empty until first needed
+  std::vector<int64_t> batch_row_offsets_;
+
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
+
+  IpcOptions options_;
+  // The fields selected by options_.included_fields, empty if all are read
+  std::vector<bool> included_fields_;
 };
 
 RecordBatchFileReader::RecordBatchFileReader() {
@@ -772,8 +1197,14 @@ Status RecordBatchFileReader::Open(io::RandomAccessFile* file,
 
 Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
+                                   const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, options);
 }
 
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
@@ -786,8 +1217,14 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   int64_t footer_offset, const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, options);
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
@@ -803,6 +1240,23 @@ Status RecordBatchFileReader::ReadRecordBatch(int i,
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Status RecordBatchFileReader::CountRows(int64_t* num_rows) {
+  return impl_->CountRows(num_rows);
+}
+
+Status RecordBatchFileReader::ReadRows(int64_t offset, int64_t length,
+                                       std::shared_ptr<Table>* out) {
+  return impl_->ReadRows(offset, length, /*included_fields=*/NULLPTR, out);
+}
+
+Status RecordBatchFileReader::ReadRows(int64_t offset, int64_t length,
+                                       const std::vector<int>& field_indices,
+                                       std::shared_ptr<Table>* out) {
+  std::vector<bool> included_fields;
+  RETURN_NOT_OK(GetIncludedFields(*schema(), field_indices, &included_fields));
+  return impl_->ReadRows(offset, length, &included_fields, out);
+}
+
 static Status ReadContiguousPayload(io::InputStream* file,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, message));
@@ -836,9 +1290,9 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   auto options = IpcOptions::Defaults();
   std::unique_ptr<Message> message;
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
-  io::BufferReader buffer_reader(message->body());
+  auto buffer_reader = message->body_reader();
   return ReadRecordBatch(*message->metadata(), schema, dictionary_memo, options,
-                         &buffer_reader, out);
+                         buffer_reader.get(), out);
 }
 
 Status ReadTensor(io::InputStream* file, std::shared_ptr<Tensor>* out) {
@@ -876,10 +1330,11 @@ Status ReadSparseCOOIndex(const flatbuf::SparseTensor* sparse_tensor, int64_t nd
   return Status::OK();
 }
 
-Status ReadSparseCSRIndex(const flatbuf::SparseTensor* sparse_tensor, int64_t ndim,
-                          int64_t non_zero_length, io::RandomAccessFile* file,
-                          std::shared_ptr<SparseIndex>* out) {
-  auto* sparse_index = sparse_tensor->sparseIndex_as_SparseMatrixIndexCSR();
+template <typename SparseIndexType, typename FBSparseIndexType>
+Status ReadSparseCompressedIndex(const FBSparseIndexType* sparse_index,
+                                 int64_t indptr_length, int64_t non_zero_length,
+                                 io::RandomAccessFile* file,
+                                 std::shared_ptr<SparseIndex>* out) {
 
   auto* indptr_buffer = sparse_index->indptrBuffer();
   std::shared_ptr<Buffer> indptr_data;
@@ -891,11 +1346,81 @@ Status ReadSparseCSRIndex(const flatbuf::SparseTensor* sparse_tensor, int64_t nd
   RETURN_NOT_OK(
       file->ReadAt(indices_buffer->offset(), indices_buffer->length(), &indices_data));
 
-  std::vector<int64_t> indptr_shape({ndim + 1});
+  std::vector<int64_t> indptr_shape({indptr_length});
   std::vector<int64_t> indices_shape({non_zero_length});
-  *out = std::make_shared<SparseCSRIndex>(
-      std::make_shared<SparseCSRIndex::IndexTensor>(indptr_data, indptr_shape),
-      std::make_shared<SparseCSRIndex::IndexTensor>(indices_data, indices_shape));
+  using IndexTensor = typename SparseIndexType::IndexTensor;
+  *out = std::make_shared<SparseIndexType>(
+      std::make_shared<IndexTensor>(indptr_data, indptr_shape),
+      std::make_shared<IndexTensor>(indices_data, indices_shape));
+  return Status::OK();
+}
+
+Status ReadSparseCSRIndex(const flatbuf::SparseTensor* sparse_tensor,
+                          const std::vector<int64_t>& shape, int64_t non_zero_length,
+                          io::RandomAccessFile* file, std::shared_ptr<SparseIndex>* out) {
+  if (shape.size() != 2) {
+    return Status::Invalid("CSR sparse index of a tensor of ", shape.size(),
+                           " dimensions");
+  }
+  return ReadSparseCompressedIndex<SparseCSRIndex>(
+      sparse_tensor->sparseIndex_as_SparseMatrixIndexCSR(), shape[0] + 1,
+      non_zero_length, file, out);
+}
+
+Status ReadSparseCSCIndex(const flatbuf::SparseTensor* sparse_tensor,
+                          const std::vector<int64_t>& shape, int64_t non_zero_length,
+                          io::RandomAccessFile* file, std::shared_ptr<SparseIndex>* out) {
+  if (shape.size() != 2) {
+    return Status::Invalid("CSC sparse index of a tensor of ", shape.size(),
+                           " dimensions");
+  }
+  return ReadSparseCompressedIndex<SparseCSCIndex>(
+      sparse_tensor->sparseIndex_as_SparseMatrixIndexCSC(), shape[1] + 1,
+      non_zero_length, file, out);
+}
+
+Status ReadSparseCSFIndex(const flatbuf::SparseTensor* sparse_tensor,
+                          const std::vector<int64_t>& shape, int64_t non_zero_length,
+                          io::RandomAccessFile* file, std::shared_ptr<SparseIndex>* out) {
+  auto* sparse_index = sparse_tensor->sparseIndex_as_SparseTensorIndexCSF();
+  const int64_t ndim = static_cast<int64_t>(shape.size());
+  auto* fb_indptr = sparse_index->indptrBuffers();
+  auto* fb_indices = sparse_index->indicesBuffers();
+  auto* fb_axis_order = sparse_index->axisOrder();
+  if (ndim == 0 || fb_indptr == nullptr || fb_indices == nullptr ||
+      fb_axis_order == nullptr || static_cast<int64_t>(fb_indptr->size()) != ndim - 1 ||
+      static_cast<int64_t>(fb_indices->size()) != ndim ||
+      static_cast<int64_t>(fb_axis_order->size()) != ndim) {
+    return Status::IOError("Malformed CSF sparse index of a tensor of ", ndim,
+                           " dimensions");
+  }
+
+  // The index values are int64, so the lengths of their buffers are exact
+  auto read_index = [file](const flatbuf::Buffer* buffer,
+                           std::shared_ptr<SparseCSFIndex::IndexTensor>* out) {
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(file->ReadAt(buffer->offset(), buffer->length(), &data));
+    const int64_t length = buffer->length() / static_cast<int64_t>(sizeof(int64_t));
+    std::vector<int64_t> shape({length});
+    *out = std::make_shared<SparseCSFIndex::IndexTensor>(data, shape);
+    return Status::OK();
+  };
+
+  std::vector<std::shared_ptr<SparseCSFIndex::IndexTensor>> indptr(fb_indptr->size());
+  for (flatbuffers::uoffset_t i = 0; i < fb_indptr->size(); ++i) {
+    RETURN_NOT_OK(read_index(fb_indptr->Get(i), &indptr[i]));
+  }
+  std::vector<std::shared_ptr<SparseCSFIndex::IndexTensor>> indices(fb_indices->size());
+  for (flatbuffers::uoffset_t i = 0; i < fb_indices->size(); ++i) {
+    RETURN_NOT_OK(read_index(fb_indices->Get(i), &indices[i]));
+  }
+  if (indices.back()->size() != non_zero_length) {
+    return Status::IOError("CSF sparse index has ", indices.back()->size(),
+                           " leaves for ", non_zero_length, " non-zero values");
+  }
+  std::vector<int64_t> axis_order(fb_axis_order->begin(), fb_axis_order->end());
+
+  *out = std::make_shared<SparseCSFIndex>(indptr, indices, axis_order);
   return Status::OK();
 }
 
@@ -919,6 +1444,26 @@ Status MakeSparseTensorWithSparseCSRIndex(
   return Status::OK();
 }
 
+Status MakeSparseTensorWithSparseCSCIndex(
+    const std::shared_ptr<DataType>& type, const std::vector<int64_t>& shape,
+    const std::vector<std::string>& dim_names,
+    const std::shared_ptr<SparseCSCIndex>& sparse_index, int64_t non_zero_length,
+    const std::shared_ptr<Buffer>& data, std::shared_ptr<SparseTensor>* out) {
+  *out = std::make_shared<SparseTensorImpl<SparseCSCIndex>>(sparse_index, type, data,
+                                                            shape, dim_names);
+  return Status::OK();
+}
+
+Status MakeSparseTensorWithSparseCSFIndex(
+    const std::shared_ptr<DataType>& type, const std::vector<int64_t>& shape,
+    const std::vector<std::string>& dim_names,
+    const std::shared_ptr<SparseCSFIndex>& sparse_index, int64_t non_zero_length,
+    const std::shared_ptr<Buffer>& data, std::shared_ptr<SparseTensor>* out) {
+  *out = std::make_shared<SparseTensorImpl<SparseCSFIndex>>(sparse_index, type, data,
+                                                            shape, dim_names);
+  return Status::OK();
+}
+
 }  // namespace
 
 Status ReadSparseTensor(const Buffer& metadata, io::RandomAccessFile* file,
@@ -959,20 +1504,34 @@ Status ReadSparseTensor(const Buffer& metadata, io::RandomAccessFile* file,
           non_zero_length, data, out);
 
     case SparseTensorFormat::CSR:
-      RETURN_NOT_OK(ReadSparseCSRIndex(sparse_tensor, shape.size(), non_zero_length, file,
-                                       &sparse_index));
+      RETURN_NOT_OK(
+          ReadSparseCSRIndex(sparse_tensor, shape, non_zero_length, file, &sparse_index));
       return MakeSparseTensorWithSparseCSRIndex(
           type, shape, dim_names, checked_pointer_cast<SparseCSRIndex>(sparse_index),
           non_zero_length, data, out);
 
+    case SparseTensorFormat::CSC:
+      RETURN_NOT_OK(
+          ReadSparseCSCIndex(sparse_tensor, shape, non_zero_length, file, &sparse_index));
+      return MakeSparseTensorWithSparseCSCIndex(
+          type, shape, dim_names, checked_pointer_cast<SparseCSCIndex>(sparse_index),
+          non_zero_length, data, out);
+
+    case SparseTensorFormat::CSF:
+      RETURN_NOT_OK(
+          ReadSparseCSFIndex(sparse_tensor, shape, non_zero_length, file, &sparse_index));
+      return MakeSparseTensorWithSparseCSFIndex(
+          type, shape, dim_names, checked_pointer_cast<SparseCSFIndex>(sparse_index),
+          non_zero_length, data, out);
+
     default:
       return Status::Invalid("Unsupported sparse index format");
   }
 }
 
 Status ReadSparseTensor(const Message& message, std::shared_ptr<SparseTensor>* out) {
-  io::BufferReader buffer_reader(message.body());
-  return ReadSparseTensor(*message.metadata(), &buffer_reader, out);
+  auto buffer_reader = message.body_reader();
+  return ReadSparseTensor(*message.metadata(), buffer_reader.get(), out);
 }
 
 Status ReadSparseTensor(io::InputStream* file, std::shared_ptr<SparseTensor>* out) {
@@ -980,8 +1539,8 @@ Status ReadSparseTensor(io::InputStream* file, std::shared_ptr<SparseTensor>* ou
   RETURN_NOT_OK(ReadContiguousPayload(file, &message));
   CHECK_MESSAGE_TYPE(message->type(), Message::SPARSE_TENSOR);
   CHECK_HAS_BODY(*message);
-  io::BufferReader buffer_reader(message->body());
-  return ReadSparseTensor(*message->metadata(), &buffer_reader, out);
+  auto buffer_reader = message->body_reader();
+  return ReadSparseTensor(*message->metadata(), buffer_reader.get(), out);
 }
 
 }  // namespace ipc
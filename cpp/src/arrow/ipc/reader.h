@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
@@ -36,6 +37,7 @@ class Schema;
 class Status;
 class Tensor;
 class SparseTensor;
+class Table;
 
 namespace io {
 
@@ -54,6 +56,9 @@ using RecordBatchReader = ::arrow::RecordBatchReader;
 /// This class reads the schema (plus any dictionaries) as the first messages
 /// in the stream, followed by record batches. For more granular zero-copy
 /// reads see the ReadRecordBatch functions
+///
+/// If IpcOptions::prefetch_messages is positive, up to that many record
+/// batches are read and decoded ahead on the I/O thread pool
 class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
  public:
   ~RecordBatchStreamReader() override;
@@ -69,6 +74,15 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(std::unique_ptr<MessageReader> message_reader,
                      std::unique_ptr<RecordBatchReader>* out);
 
+  /// \brief Create batch reader from generic MessageReader with options
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] options options for deserialization and prefetching
+  /// \param[out] out the created RecordBatchReader object
+  /// \return Status
+  static Status Open(std::unique_ptr<MessageReader> message_reader,
+                     const IpcOptions& options, std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Record batch stream reader from InputStream
   ///
   /// \param[in] stream an input stream instance. Must stay alive throughout
@@ -84,6 +98,14 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(const std::shared_ptr<io::InputStream>& stream,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Open stream with options and retain ownership of stream object
+  /// \param[in] stream the input stream
+  /// \param[in] options options for deserialization and prefetching
+  /// \param[out] out the batch reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::InputStream>& stream,
+                     const IpcOptions& options, std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Returns the schema read from the stream
   std::shared_ptr<Schema> schema() const override;
 
@@ -142,6 +164,26 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
+  /// \brief Open a RecordBatchFileReader with options
+  ///
+  /// Record batches are read with the fields in options.included_fields
+  /// only, if not empty; the buffers of the other fields are not read from
+  /// the file. schema() still returns the schema of the whole file
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options for deserialization
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
+  /// \brief Version of Open with options that retains ownership of file
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     int64_t footer_offset, const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
   /// \brief The schema read from the file
   std::shared_ptr<Schema> schema() const;
 
@@ -152,13 +194,48 @@ class ARROW_EXPORT RecordBatchFileReader {
   MetadataVersion version() const;
 
   /// \brief Read a particular record batch from the file. Does not copy memory
-  /// if the input source supports zero-copy.
+  /// if the input source supports zero-copy. Only holds the included_fields
+  /// of the options, if any.
   ///
   /// \param[in] i the index of the record batch to return
   /// \param[out] batch the read batch
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Return the total number of rows in the file
+  ///
+  /// The row counts of the record batches are read from their metadata on
+  /// first use and cached, so that ReadRows only reads the record batches
+  /// overlapping the requested rows
+  ///
+  /// \param[out] num_rows the number of rows
+  /// \return Status
+  Status CountRows(int64_t* num_rows);
+
+  /// \brief Read a range of rows, as zero-copy slices of the record batches
+  /// holding them if the input source supports zero-copy
+  ///
+  /// \param[in] offset the index of the first row to read
+  /// \param[in] length the number of rows to read, truncated at the end of
+  /// the file
+  /// \param[out] out the table of the rows, with one chunk per record batch
+  /// \return Status
+  Status ReadRows(int64_t offset, int64_t length, std::shared_ptr<Table>* out);
+
+  /// \brief Read a range of rows of some of the fields. Only the buffers of
+  /// these fields are read
+  ///
+  /// \param[in] offset the index of the first row to read
+  /// \param[in] length the number of rows to read, truncated at the end of
+  /// the file
+  /// \param[in] field_indices the indices of the fields of schema() to read,
+  /// which are returned in schema order. They override the included_fields
+  /// option
+  /// \param[out] out the table of the rows, with one chunk per record batch
+  /// \return Status
+  Status ReadRows(int64_t offset, int64_t length, const std::vector<int>& field_indices,
+                  std::shared_ptr<Table>* out);
+
  private:
   RecordBatchFileReader();
 
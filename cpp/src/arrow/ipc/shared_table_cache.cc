@@ -0,0 +1,306 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/shared_table_cache.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/util.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace ipc {
+
+namespace {
+
+// A table file starts with a header of kHeaderSize bytes holding the magic
+// bytes and the end of the IPC file which follows it, before any padding up
+// to the page size.  The header keeps the IPC file aligned to 64 bytes.
+constexpr char kHeaderMagic[] = "ARWSHTB1";
+constexpr int64_t kMagicSize = 8;
+constexpr int64_t kHeaderSize = kArrowAlignment;
+
+Status ValidateName(const std::string& name) {
+  // Names starting with '.' are those of the temporary files of Publish
+  if (name.empty() || name[0] == '.' || name.find('/') != std::string::npos) {
+    return Status::Invalid("Invalid shared table name '", name, "'");
+  }
+  return Status::OK();
+}
+
+Status ErrnoStatus(const std::string& action, const std::string& path) {
+  const int errnum = errno;
+  if (errnum == ENOENT) {
+    return Status::KeyError("No shared table at ", path);
+  }
+  return Status::IOError("Failed to ", action, " ", path, ": ",
+                         ::arrow::internal::ErrnoMessage(errnum));
+}
+
+Status WriteTable(const Table& table, io::OutputStream* sink) {
+  std::shared_ptr<RecordBatchWriter> writer;
+  RETURN_NOT_OK(RecordBatchFileWriter::Open(sink, table.schema(), &writer));
+  RETURN_NOT_OK(writer->WriteTable(table));
+  return writer->Close();
+}
+
+Status WriteTableFile(const std::string& path, const Table& table, int64_t page_size) {
+  // Files on hugetlbfs can only be written through a memory map, whose size is
+  // fixed up front, so the IPC file is first written to a mock stream to size it
+  io::MockOutputStream mock;
+  RETURN_NOT_OK(WriteTable(table, &mock));
+  const int64_t ipc_end = kHeaderSize + mock.GetExtentBytesWritten();
+  const int64_t file_size = BitUtil::RoundUp(ipc_end, page_size);
+
+  std::shared_ptr<io::MemoryMappedFile> file;
+  RETURN_NOT_OK(io::MemoryMappedFile::Create(path, file_size, &file));
+  uint8_t header[kHeaderSize] = {};
+  std::memcpy(header, kHeaderMagic, kMagicSize);
+  std::memcpy(header + kMagicSize, &ipc_end, sizeof(ipc_end));
+  RETURN_NOT_OK(file->Write(header, kHeaderSize));
+  RETURN_NOT_OK(WriteTable(table, file.get()));
+  return file->Close();
+}
+
+struct FileId {
+  dev_t device;
+  ino_t inode;
+
+  bool operator==(const FileId& other) const {
+    return device == other.device && inode == other.inode;
+  }
+};
+
+Status GetFileId(int fd, const std::string& path, FileId* out) {
+  struct stat st;
+  if (fstat(fd, &st) != 0) {
+    return ErrnoStatus("stat", path);
+  }
+  *out = {st.st_dev, st.st_ino};
+  return Status::OK();
+}
+
+}  // namespace
+
+SharedTableCacheOptions SharedTableCacheOptions::Defaults() {
+  return SharedTableCacheOptions();
+}
+
+class SharedTableCache::Impl {
+ public:
+  explicit Impl(const SharedTableCacheOptions& options) : options_(options) {}
+
+  Status Init() {
+    if (options_.page_size <= 0) {
+      return Status::Invalid("Page size must be positive, got ", options_.page_size);
+    }
+    ::arrow::internal::PlatformFilename directory;
+    RETURN_NOT_OK(
+        ::arrow::internal::PlatformFilename::FromString(options_.directory, &directory));
+    return ::arrow::internal::CreateDirTree(directory);
+  }
+
+  Status Publish(const std::string& name, const Table& table) {
+    RETURN_NOT_OK(ValidateName(name));
+    const std::string temp_path = options_.directory + "/." + name + "." +
+                                  std::to_string(getpid()) + "." +
+                                  std::to_string(temp_counter_++) + ".tmp";
+    Status st = WriteTableFile(temp_path, table, options_.page_size);
+    if (st.ok() && std::rename(temp_path.c_str(), TablePath(name).c_str()) != 0) {
+      st = ErrnoStatus("publish", temp_path);
+    }
+    if (!st.ok()) {
+      unlink(temp_path.c_str());
+    }
+    return st;
+  }
+
+  Status Get(const std::string& name, std::shared_ptr<Table>* out) {
+    RETURN_NOT_OK(ValidateName(name));
+    const std::string path = TablePath(name);
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0) {
+      return ErrnoStatus("stat", path);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tables_.find(name);
+    if (it != tables_.end() && it->second.id == FileId{st.st_dev, st.st_ino}) {
+      *out = it->second.table.lock();
+      if (*out != nullptr) {
+        return Status::OK();
+      }
+    }
+
+    // The buffers of the table keep the map, and so the file descriptor and
+    // its shared lock, alive
+    std::shared_ptr<io::MemoryMappedFile> file;
+    RETURN_NOT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READ, &file));
+    if (flock(file->file_descriptor(), LOCK_SH) != 0) {
+      return ErrnoStatus("lock", path);
+    }
+    Entry entry;
+    RETURN_NOT_OK(GetFileId(file->file_descriptor(), path, &entry.id));
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(ReadTableFile(path, file.get(), &table));
+    entry.table = table;
+    tables_[name] = std::move(entry);
+    *out = std::move(table);
+    return Status::OK();
+  }
+
+  Status Remove(const std::string& name) {
+    RETURN_NOT_OK(ValidateName(name));
+    const std::string path = TablePath(name);
+    if (unlink(path.c_str()) != 0) {
+      return ErrnoStatus("remove", path);
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    tables_.erase(name);
+    return Status::OK();
+  }
+
+  Status RemoveIfUnused(const std::string& name, bool* removed) {
+    RETURN_NOT_OK(ValidateName(name));
+    *removed = false;
+    const std::string path = TablePath(name);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return ErrnoStatus("open", path);
+    }
+    Status status;
+    // Readers hold shared locks, so the exclusive lock is only granted if
+    // there are none
+    if (flock(fd, LOCK_EX | LOCK_NB) == 0) {
+      FileId id;
+      struct stat st;
+      status = GetFileId(fd, path, &id);
+      // Don't remove a table published since the file was opened
+      if (status.ok() && stat(path.c_str(), &st) == 0 &&
+          id == FileId{st.st_dev, st.st_ino}) {
+        if (unlink(path.c_str()) == 0) {
+          *removed = true;
+        } else {
+          status = ErrnoStatus("remove", path);
+        }
+      }
+    } else if (errno != EWOULDBLOCK) {
+      status = ErrnoStatus("lock", path);
+    }
+    close(fd);
+    return status;
+  }
+
+  const SharedTableCacheOptions& options() const { return options_; }
+
+ private:
+  struct Entry {
+    FileId id;
+    std::weak_ptr<Table> table;
+  };
+
+  std::string TablePath(const std::string& name) const {
+    return options_.directory + "/" + name + ".arrow";
+  }
+
+  static Status ReadTableFile(const std::string& path, io::MemoryMappedFile* file,
+                              std::shared_ptr<Table>* out) {
+    std::shared_ptr<Buffer> header;
+    RETURN_NOT_OK(file->ReadAt(0, kHeaderSize, &header));
+    int64_t ipc_end = 0;
+    int64_t file_size = 0;
+    RETURN_NOT_OK(file->GetSize(&file_size));
+    if (header->size() == kHeaderSize) {
+      std::memcpy(&ipc_end, header->data() + kMagicSize, sizeof(ipc_end));
+    }
+    if (header->size() < kHeaderSize ||
+        std::memcmp(header->data(), kHeaderMagic, kMagicSize) != 0 ||
+        ipc_end <= kHeaderSize || ipc_end > file_size) {
+      return Status::IOError("Not a shared table file: ", path);
+    }
+
+    std::shared_ptr<RecordBatchFileReader> reader;
+    RETURN_NOT_OK(RecordBatchFileReader::Open(file, ipc_end, &reader));
+    std::vector<std::shared_ptr<RecordBatch>> batches(reader->num_record_batches());
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      RETURN_NOT_OK(reader->ReadRecordBatch(i, &batches[i]));
+    }
+    return Table::FromRecordBatches(reader->schema(), batches, out);
+  }
+
+  SharedTableCacheOptions options_;
+  std::atomic<int64_t> temp_counter_{0};
+  std::mutex mutex_;
+  // The tables this process got, to share them between its gets
+  std::unordered_map<std::string, Entry> tables_;
+};
+
+SharedTableCache::SharedTableCache(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+SharedTableCache::~SharedTableCache() {}
+
+Status SharedTableCache::Open(const SharedTableCacheOptions& options,
+                              std::shared_ptr<SharedTableCache>* out) {
+  std::unique_ptr<Impl> impl(new Impl(options));
+  RETURN_NOT_OK(impl->Init());
+  out->reset(new SharedTableCache(std::move(impl)));
+  return Status::OK();
+}
+
+Status SharedTableCache::Publish(const std::string& name, const Table& table) {
+  return impl_->Publish(name, table);
+}
+
+Status SharedTableCache::Get(const std::string& name, std::shared_ptr<Table>* out) {
+  return impl_->Get(name, out);
+}
+
+Status SharedTableCache::Remove(const std::string& name) { return impl_->Remove(name); }
+
+Status SharedTableCache::RemoveIfUnused(const std::string& name, bool* removed) {
+  return impl_->RemoveIfUnused(name, removed);
+}
+
+const SharedTableCacheOptions& SharedTableCache::options() const {
+  return impl_->options();
+}
+
+}  // namespace ipc
+}  // namespace arrow
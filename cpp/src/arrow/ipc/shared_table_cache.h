@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Tables shared between the processes of a host through memory-mapped files
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Table;
+
+namespace ipc {
+
+struct ARROW_EXPORT SharedTableCacheOptions {
+  /// The directory holding the published tables, which should be on a
+  /// memory-backed file system such as /dev/shm or a hugetlbfs mount.  It is
+  /// created if it doesn't exist.
+  std::string directory = "/dev/shm/arrow-shared-tables";
+
+  /// The sizes of the table files are rounded up to a multiple of this, which
+  /// must be the huge page size for hugetlbfs
+  int64_t page_size = 4096;
+
+  static SharedTableCacheOptions Defaults();
+};
+
+/// \class SharedTableCache
+/// \brief A registry of tables which the processes of a host share without
+/// copying them
+///
+/// Publish writes a table as an Arrow IPC file in the directory of the
+/// cache.  Get maps the file into memory and returns a table whose buffers
+/// point into the mapping, so that all the processes reading a table share
+/// the same pages.  Within a process, the gets of a table return the same
+/// Table while it is alive.
+///
+/// A process holds a shared lock on a table file while a table it got from
+/// it is alive, which RemoveIfUnused uses to only remove the tables no
+/// process reads.  Removing or republishing a table never invalidates the
+/// tables already handed out, which keep the previous file mapped until they
+/// are destroyed.
+///
+/// Only available on POSIX systems.
+class ARROW_EXPORT SharedTableCache {
+ public:
+  ~SharedTableCache();
+
+  /// \brief Open the cache stored in options.directory
+  static Status Open(const SharedTableCacheOptions& options,
+                     std::shared_ptr<SharedTableCache>* out);
+
+  /// \brief Publish a table under a name, replacing the table previously
+  /// published under it, if any
+  ///
+  /// The table is written to a temporary file first, then renamed, so that
+  /// readers never see a partially written table.  The name must be a
+  /// valid file name not starting with '.'.
+  Status Publish(const std::string& name, const Table& table);
+
+  /// \brief Get the table published under a name, mapped into memory
+  ///
+  /// Returns KeyError if no table is published under the name.
+  Status Get(const std::string& name, std::shared_ptr<Table>* out);
+
+  /// \brief Remove the table published under a name
+  ///
+  /// The processes which got the table keep reading it until they release
+  /// it.  Returns KeyError if no table is published under the name.
+  Status Remove(const std::string& name);
+
+  /// \brief Remove the table published under a name if no process holds it
+  ///
+  /// \param[in] name the name of the table
+  /// \param[out] removed whether the table was removed
+  Status RemoveIfUnused(const std::string& name, bool* removed);
+
+  const SharedTableCacheOptions& options() const;
+
+ private:
+  class Impl;
+  explicit SharedTableCache(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ipc
+}  // namespace arrow
@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/ipc/shared_table_cache.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+using internal::PlatformFilename;
+using internal::TemporaryDir;
+
+namespace ipc {
+
+class TestSharedTableCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK(TemporaryDir::Make("shared-table-cache-test-", &temp_dir_));
+    options_.directory = temp_dir_->path().ToString() + "tables";
+    ASSERT_OK(SharedTableCache::Open(options_, &cache_));
+  }
+
+  std::shared_ptr<Table> MakeTable(int64_t length, int64_t num_batches) {
+    random::RandomArrayGenerator rng(0x5AB1E + length);
+    auto schema = ::arrow::schema({field("i", int32()), field("s", utf8())});
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int64_t i = 0; i < num_batches; ++i) {
+      batches.push_back(RecordBatch::Make(
+          schema, length,
+          {rng.Int32(length, 0, 1000, 0.1), rng.String(length, 0, 10, 0.1)}));
+    }
+    std::shared_ptr<Table> table;
+    ABORT_NOT_OK(Table::FromRecordBatches(schema, batches, &table));
+    return table;
+  }
+
+  int64_t FileSize(const std::string& name) {
+    PlatformFilename path;
+    ABORT_NOT_OK(PlatformFilename::FromString(
+        options_.directory + "/" + name + ".arrow", &path));
+    int fd = -1;
+    int64_t size = -1;
+    ABORT_NOT_OK(internal::FileOpenReadable(path, &fd));
+    ABORT_NOT_OK(internal::FileGetSize(fd, &size));
+    ABORT_NOT_OK(internal::FileClose(fd));
+    return size;
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  SharedTableCacheOptions options_;
+  std::shared_ptr<SharedTableCache> cache_;
+};
+
+TEST_F(TestSharedTableCache, PublishGet) {
+  auto table = MakeTable(1000, 3);
+  ASSERT_OK(cache_->Publish("table", *table));
+  ASSERT_EQ(0, FileSize("table") % options_.page_size);
+
+  std::shared_ptr<Table> read;
+  ASSERT_OK(cache_->Get("table", &read));
+  ASSERT_OK(read->Validate());
+  AssertTablesEqual(*table, *read);
+  // The buffers point into the read-only mapping of the file
+  ASSERT_FALSE(read->column(0)->chunk(0)->data()->buffers[1]->is_mutable());
+
+  // Gets within a process share the table
+  std::shared_ptr<Table> read_again;
+  ASSERT_OK(cache_->Get("table", &read_again));
+  ASSERT_EQ(read, read_again);
+
+  // As do gets from another cache over the same directory, through the mapping
+  std::shared_ptr<SharedTableCache> other;
+  ASSERT_OK(SharedTableCache::Open(options_, &other));
+  ASSERT_OK(other->Get("table", &read_again));
+  ASSERT_NE(read, read_again);
+  AssertTablesEqual(*table, *read_again);
+
+  auto empty = MakeTable(0, 0);
+  ASSERT_OK(cache_->Publish("empty", *empty));
+  ASSERT_OK(cache_->Get("empty", &read));
+  AssertTablesEqual(*empty, *read);
+}
+
+TEST_F(TestSharedTableCache, Republish) {
+  auto first = MakeTable(100, 1);
+  auto second = MakeTable(200, 2);
+  ASSERT_OK(cache_->Publish("table", *first));
+  std::shared_ptr<Table> read_first;
+  ASSERT_OK(cache_->Get("table", &read_first));
+
+  ASSERT_OK(cache_->Publish("table", *second));
+  std::shared_ptr<Table> read_second;
+  ASSERT_OK(cache_->Get("table", &read_second));
+  AssertTablesEqual(*second, *read_second);
+  // The table got before stays valid
+  AssertTablesEqual(*first, *read_first);
+}
+
+TEST_F(TestSharedTableCache, Remove) {
+  auto table = MakeTable(100, 1);
+  ASSERT_OK(cache_->Publish("table", *table));
+
+  std::shared_ptr<SharedTableCache> other;
+  ASSERT_OK(SharedTableCache::Open(options_, &other));
+  std::shared_ptr<Table> read;
+  ASSERT_OK(other->Get("table", &read));
+
+  bool removed = true;
+  ASSERT_OK(cache_->RemoveIfUnused("table", &removed));
+  ASSERT_FALSE(removed);
+
+  // The lock is held as long as a buffer of the table is alive
+  auto column = read->column(1);
+  read.reset();
+  ASSERT_OK(cache_->RemoveIfUnused("table", &removed));
+  ASSERT_FALSE(removed);
+  column.reset();
+  ASSERT_OK(cache_->RemoveIfUnused("table", &removed));
+  ASSERT_TRUE(removed);
+  ASSERT_RAISES(KeyError, cache_->Get("table", &read));
+  ASSERT_RAISES(KeyError, cache_->RemoveIfUnused("table", &removed));
+
+  // Remove doesn't wait for the readers
+  ASSERT_OK(cache_->Publish("table", *table));
+  ASSERT_OK(other->Get("table", &read));
+  ASSERT_OK(cache_->Remove("table"));
+  ASSERT_RAISES(KeyError, cache_->Get("table", &read));
+  ASSERT_RAISES(KeyError, cache_->Remove("table"));
+  AssertTablesEqual(*table, *read);
+}
+
+TEST_F(TestSharedTableCache, InvalidNames) {
+  auto table = MakeTable(10, 1);
+  std::shared_ptr<Table> read;
+  for (const std::string name : {"", ".hidden", "a/b"}) {
+    ASSERT_RAISES(Invalid, cache_->Publish(name, *table));
+    ASSERT_RAISES(Invalid, cache_->Get(name, &read));
+    ASSERT_RAISES(Invalid, cache_->Remove(name));
+  }
+  ASSERT_RAISES(KeyError, cache_->Get("missing", &read));
+}
+
+}  // namespace ipc
+}  // namespace arrow
@@ -28,6 +28,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/dictionary.h"
@@ -44,8 +45,12 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/stl.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -124,6 +129,13 @@ class RecordBatchSerializer : public ArrayVisitor {
 
   ~RecordBatchSerializer() override = default;
 
+  // Reference the buffers lying in the given memory region at their position
+  // relative to its start, instead of laying them out from buffer_start_offset
+  void KeepInPlace(const uint8_t* region_start, int64_t region_size) {
+    region_start_ = region_start;
+    region_size_ = region_size;
+  }
+
   Status VisitArray(const Array& arr) {
     if (max_recursion_depth_ <= 0) {
       return Status::Invalid("Max recursion depth reached");
@@ -151,10 +163,63 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
+  }
+
+  // Replace a buffer with its compressed representation, prefixed with the
+  // uncompressed length as a little-endian int64
+  Status CompressBuffer(const Buffer& buffer, util::Codec* codec,
+                        std::shared_ptr<Buffer>* out) {
+    const int64_t prefix_length = static_cast<int64_t>(sizeof(int64_t));
+    const int64_t maximum_length = codec->MaxCompressedLen(buffer.size(), buffer.data());
+
+    std::shared_ptr<ResizableBuffer> result;
+    RETURN_NOT_OK(
+        AllocateResizableBuffer(pool_, prefix_length + maximum_length, &result));
+
+    int64_t actual_length;
+    RETURN_NOT_OK(codec->Compress(buffer.size(), buffer.data(), maximum_length,
+                                  result->mutable_data() + prefix_length,
+                                  &actual_length));
+    const int64_t uncompressed_length = BitUtil::ToLittleEndian(buffer.size());
+    std::memcpy(result->mutable_data(), &uncompressed_length, prefix_length);
+    RETURN_NOT_OK(result->Resize(prefix_length + actual_length, /*shrink_to_fit=*/true));
+    *out = std::move(result);
+    return Status::OK();
+  }
+
+  Status CompressBodyBuffers() {
+    if (options_.compression != Compression::LZ4 &&
+        options_.compression != Compression::ZSTD) {
+      return Status::Invalid("Unsupported IPC body compression: ",
+                             util::Codec::GetCodecAsString(options_.compression));
+    }
+    std::unique_ptr<util::Codec> codec;
+    RETURN_NOT_OK(util::Codec::Create(options_.compression, &codec));
+
+    auto CompressOne = [&](int i) {
+      std::shared_ptr<Buffer>& buffer = out_->body_buffers[i];
+      // Zero-length buffers are written as-is
+      if (buffer == nullptr || buffer->size() == 0) {
+        return Status::OK();
+      }
+      return CompressBuffer(*buffer, codec.get(), &buffer);
+    };
+
+    // One-shot compression is stateless, so the codec can be shared
+    const int num_buffers = static_cast<int>(out_->body_buffers.size());
+    if (options_.use_threads) {
+      return ::arrow::internal::ParallelFor(num_buffers, CompressOne);
+    }
+    for (int i = 0; i < num_buffers; ++i) {
+      RETURN_NOT_OK(CompressOne(i));
+    }
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
+    ARROW_TRACE_SPAN(span, "ipc", "AssembleRecordBatch");
+    ScopedMemoryTag memory_tag("ipc.write");
     if (field_nodes_.size() > 0) {
       field_nodes_.clear();
       buffer_meta_.clear();
@@ -166,6 +231,10 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    if (options_.compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -173,6 +242,7 @@ class RecordBatchSerializer : public ArrayVisitor {
     buffer_meta_.reserve(out_->body_buffers.size());
 
     // Construct the buffer metadata for the record batch header
+    std::vector<std::shared_ptr<Buffer>> laid_out_buffers;
     for (size_t i = 0; i < out_->body_buffers.size(); ++i) {
       const Buffer* buffer = out_->body_buffers[i].get();
       int64_t size = 0;
@@ -184,11 +254,24 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf8(size) - size;
       }
 
+      if (size > 0 && IsInPlace(*buffer)) {
+        buffer_meta_.push_back({buffer->data() - region_start_, size});
+        continue;
+      }
       buffer_meta_.push_back({offset, size + padding});
       offset += size + padding;
+      if (region_start_ != nullptr) {
+        laid_out_buffers.push_back(std::move(out_->body_buffers[i]));
+      }
     }
 
-    out_->body_length = offset - buffer_start_offset_;
+    if (region_start_ != nullptr) {
+      // The body spans the region and the buffers laid out after it
+      out_->body_buffers = std::move(laid_out_buffers);
+      out_->body_length = offset;
+    } else {
+      out_->body_length = offset - buffer_start_offset_;
+    }
     DCHECK(BitUtil::IsMultipleOf8(out_->body_length));
 
     // Now that we have computed the locations of all of the buffers in shared
@@ -222,6 +305,16 @@ class RecordBatchSerializer : public ArrayVisitor {
     return Status::OK();
   }
 
+  bool IsInPlace(const Buffer& buffer) const {
+    if (region_start_ == nullptr) {
+      return false;
+    }
+    const uint8_t* data = buffer.data();
+    return data >= region_start_ &&
+           data + buffer.size() <= region_start_ + region_size_ &&
+           BitUtil::IsMultipleOf8(data - region_start_);
+  }
+
   template <typename ArrayType>
   Status GetZeroBasedValueOffsets(const ArrayType& array,
                                   std::shared_ptr<Buffer>* value_offsets) {
@@ -504,18 +597,24 @@ class RecordBatchSerializer : public ArrayVisitor {
   const IpcOptions& options_;
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
+
+  const uint8_t* region_start_ = nullptr;
+  int64_t region_size_ = 0;
 };
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
-  DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   const IpcOptions& options, IpcPayload* out)
+  DictionaryWriter(int64_t dictionary_id, bool is_delta, MemoryPool* pool,
+                   int64_t buffer_start_offset, const IpcOptions& options,
+                   IpcPayload* out)
       : RecordBatchSerializer(pool, buffer_start_offset, options, out),
-        dictionary_id_(dictionary_id) {}
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
-    return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+    return WriteDictionaryMessage(dictionary_id_, is_delta_, num_rows, out_->body_length,
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -527,18 +626,141 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
+};
+
+// A RecordBatchSerializer patching the metadata of the previous record batch
+// when the next one has the same number of field nodes and buffers, since the
+// layout of the flatbuffer only depends on those
+class ReusingRecordBatchSerializer : public RecordBatchSerializer {
+ public:
+  ReusingRecordBatchSerializer(MemoryPool* pool, const IpcOptions& options)
+      : RecordBatchSerializer(pool, /*buffer_start_offset=*/0, options, nullptr) {}
+
+  Status Build(const RecordBatch& batch, IpcPayload* out) {
+    out->type = Message::RECORD_BATCH;
+    out->body_buffers.clear();
+    out_ = out;
+    return Assemble(batch);
+  }
+
+  void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
+
+  Status SerializeMetadata(int64_t num_rows) override {
+    if (!has_template_ || field_nodes_.size() != num_nodes_ ||
+        buffer_meta_.size() != num_buffers_) {
+      RETURN_NOT_OK(RecordBatchSerializer::SerializeMetadata(num_rows));
+      metadata_ = out_->metadata;
+      MakeTemplate();
+      return Status::OK();
+    }
+
+    // Copy the previous metadata unless the previous payload was released
+    if (metadata_.use_count() > 1 || !metadata_->is_mutable()) {
+      std::shared_ptr<Buffer> metadata;
+      RETURN_NOT_OK(AllocateBuffer(pool_, metadata_->size(), &metadata));
+      std::memcpy(metadata->mutable_data(), metadata_->data(), metadata_->size());
+      metadata_ = std::move(metadata);
+    }
+
+    uint8_t* data = metadata_->mutable_data();
+    flatbuffers::WriteScalar<int64_t>(data + length_offset_, num_rows);
+    flatbuffers::WriteScalar<int64_t>(data + body_length_offset_, out_->body_length);
+    uint8_t* node_data = data + nodes_offset_;
+    for (const auto& node : field_nodes_) {
+      const flatbuf::FieldNode fb_node(node.length, node.null_count);
+      std::memcpy(node_data, &fb_node, sizeof(fb_node));
+      node_data += sizeof(fb_node);
+    }
+    uint8_t* buffer_data = data + buffers_offset_;
+    for (const auto& buffer : buffer_meta_) {
+      const flatbuf::Buffer fb_buffer(buffer.offset, buffer.length);
+      std::memcpy(buffer_data, &fb_buffer, sizeof(fb_buffer));
+      buffer_data += sizeof(fb_buffer);
+    }
+    out_->metadata = metadata_;
+    return Status::OK();
+  }
+
+ private:
+  // Record where the lengths and offsets lie in the metadata.  Flatbuffers
+  // omits scalar fields equal to their default value, in which case there is
+  // no template until a later batch.
+  void MakeTemplate() {
+    has_template_ = false;
+    const uint8_t* data = metadata_->data();
+    const flatbuf::Message* message = flatbuf::GetMessage(data);
+    const flatbuf::RecordBatch* batch = message->header_as_RecordBatch();
+    if (batch == nullptr || batch->nodes() == nullptr || batch->buffers() == nullptr) {
+      return;
+    }
+    // The generated tables privately derive from flatbuffers::Table
+    const uint8_t* length = reinterpret_cast<const flatbuffers::Table*>(batch)
+                                ->GetAddressOf(flatbuf::RecordBatch::VT_LENGTH);
+    const uint8_t* body_length = reinterpret_cast<const flatbuffers::Table*>(message)
+                                     ->GetAddressOf(flatbuf::Message::VT_BODYLENGTH);
+    if (length == nullptr || body_length == nullptr) {
+      return;
+    }
+    length_offset_ = length - data;
+    body_length_offset_ = body_length - data;
+    nodes_offset_ = reinterpret_cast<const uint8_t*>(batch->nodes()->Data()) - data;
+    buffers_offset_ = reinterpret_cast<const uint8_t*>(batch->buffers()->Data()) - data;
+    num_nodes_ = field_nodes_.size();
+    num_buffers_ = buffer_meta_.size();
+    has_template_ = true;
+  }
+
+  std::shared_ptr<Buffer> metadata_;
+  bool has_template_ = false;
+  size_t num_nodes_ = 0;
+  size_t num_buffers_ = 0;
+  int64_t length_offset_ = 0;
+  int64_t body_length_offset_ = 0;
+  int64_t nodes_offset_ = 0;
+  int64_t buffers_offset_ = 0;
 };
 
+class RecordBatchPayloadBuilder::Impl {
+ public:
+  Impl(const IpcOptions& options, MemoryPool* pool)
+      : options_(options), serializer_(pool, options_) {}
+
+  // The serializer keeps a reference to the options
+  const IpcOptions options_;
+  ReusingRecordBatchSerializer serializer_;
+};
+
+RecordBatchPayloadBuilder::RecordBatchPayloadBuilder(const IpcOptions& options,
+                                                     MemoryPool* pool)
+    : impl_(new Impl(options, pool)) {}
+
+RecordBatchPayloadBuilder::~RecordBatchPayloadBuilder() {}
+
+Status RecordBatchPayloadBuilder::Build(const RecordBatch& batch, IpcPayload* out) {
+  return impl_->serializer_.Build(batch, out);
+}
+
+void RecordBatchPayloadBuilder::set_memory_pool(MemoryPool* pool) {
+  impl_->serializer_.set_memory_pool(pool);
+}
+
 Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
                        int32_t* metadata_length) {
-  RETURN_NOT_OK(internal::WriteMessage(*payload.metadata, kArrowIpcAlignment, dst,
-                                       metadata_length));
-
+  ARROW_TRACE_SPAN(span, "ipc", "WritePayload");
+  ARROW_TRACE_SPAN_BYTES(span, payload.body_length);
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
 
-  // Now write the buffers
+  // The metadata and all body buffers are handed to the stream at once, so
+  // that file streams write them with a single gather call
+  std::vector<io::WriteRegion> regions;
+  regions.reserve(3 + 2 * payload.body_buffers.size());
+  int32_t prefix;
+  internal::GetMessageRegions(*payload.metadata, kArrowIpcAlignment, &prefix,
+                              metadata_length, &regions);
+
   for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
     const Buffer* buffer = payload.body_buffers[i].get();
     int64_t size = 0;
@@ -551,13 +773,14 @@ Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
     }
 
     if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer->data(), size));
+      regions.push_back({buffer->data(), size});
     }
 
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      regions.push_back({kPaddingBytes, padding});
     }
   }
+  RETURN_NOT_OK(dst->WriteV(regions));
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -575,9 +798,16 @@ Status GetSchemaPayload(const Schema& schema, const IpcOptions& options,
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* out) {
+  return GetDictionaryPayload(id, /*is_delta=*/false, dictionary, options, pool, out);
+}
+
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* out) {
   out->type = Message::DICTIONARY_BATCH;
   // Frame of reference is 0, see ARROW-384
-  DictionaryWriter writer(id, pool, /*buffer_start_offset=*/0, options, out);
+  DictionaryWriter writer(id, is_delta, pool, /*buffer_start_offset=*/0, options, out);
   return writer.Assemble(dictionary);
 }
 
@@ -588,6 +818,21 @@ Status GetRecordBatchPayload(const RecordBatch& batch, const IpcOptions& options
   return writer.Assemble(batch);
 }
 
+Status GetRecordBatchPayloadInPlace(const RecordBatch& batch, const uint8_t* region_start,
+                                    int64_t region_size, const IpcOptions& options,
+                                    MemoryPool* pool, IpcPayload* out) {
+  if (options.compression != Compression::UNCOMPRESSED) {
+    return Status::Invalid("Buffers cannot be kept in place when compressing the body");
+  }
+  if (!BitUtil::IsMultipleOf8(region_size)) {
+    return Status::Invalid("The region size must be a multiple of 8");
+  }
+  out->type = Message::RECORD_BATCH;
+  RecordBatchSerializer writer(pool, /*buffer_start_offset=*/region_size, options, out);
+  writer.KeepInPlace(region_start, region_size);
+  return writer.Assemble(batch);
+}
+
 }  // namespace internal
 
 Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
@@ -670,6 +915,85 @@ Status GetContiguousTensor(const Tensor& tensor, MemoryPool* pool,
   return Status::OK();
 }
 
+// The copies into a memory map are split into tasks of at least this many bytes
+constexpr int64_t kMinTensorCopyTaskSize = 1 << 16;
+
+// Copy the rows [row_begin, row_end) of a strided tensor, a row being the
+// elements along its last dimension, to their row-major position in dst
+void CopyStridedTensorRows(const Tensor& tensor, int elem_size, int64_t row_begin,
+                           int64_t row_end, uint8_t* dst) {
+  const int last_dim = tensor.ndim() - 1;
+  const auto& shape = tensor.shape();
+  const auto& strides = tensor.strides();
+  const int64_t row_size = shape[last_dim] * elem_size;
+
+  // Unravel the first row into its index along each of the outer dimensions
+  std::vector<int64_t> index(last_dim);
+  int64_t offset = 0;
+  int64_t remainder = row_begin;
+  for (int i = last_dim - 1; i >= 0; --i) {
+    index[i] = remainder % shape[i];
+    remainder /= shape[i];
+    offset += index[i] * strides[i];
+  }
+
+  uint8_t* out = dst + row_begin * row_size;
+  for (int64_t row = row_begin; row < row_end; ++row, out += row_size) {
+    const uint8_t* data_ptr = tensor.raw_data() + offset;
+    if (strides[last_dim] == elem_size) {
+      memcpy(out, data_ptr, row_size);
+    } else {
+      for (int64_t i = 0; i < shape[last_dim]; ++i) {
+        memcpy(out + i * elem_size, data_ptr, elem_size);
+        data_ptr += strides[last_dim];
+      }
+    }
+    // Move on to the next row, carrying over the outer dimensions
+    for (int i = last_dim - 1; i >= 0; --i) {
+      offset += strides[i];
+      if (++index[i] < shape[i]) {
+        break;
+      }
+      offset -= shape[i] * strides[i];
+      index[i] = 0;
+    }
+  }
+}
+
+// Copy the data of a tensor, row-major, to dst
+Status CopyTensorData(const Tensor& tensor, int elem_size, bool use_threads,
+                      uint8_t* dst) {
+  const int64_t nbytes = tensor.size() * elem_size;
+  if (nbytes == 0) {
+    return Status::OK();
+  }
+  // Row-major data is copied in ranges of bytes, other data in ranges of rows
+  const bool row_major = tensor.is_row_major();
+  const int64_t num_units =
+      row_major ? nbytes : tensor.size() / tensor.shape()[tensor.ndim() - 1];
+  int64_t num_tasks = 1;
+  if (use_threads) {
+    const int64_t max_tasks = 4 * static_cast<int64_t>(GetCpuThreadPoolCapacity());
+    num_tasks = std::min(
+        {num_units, std::max<int64_t>(1, nbytes / kMinTensorCopyTaskSize), max_tasks});
+  }
+
+  auto copy_task = [&](int task) {
+    const int64_t begin = num_units * task / num_tasks;
+    const int64_t end = num_units * (task + 1) / num_tasks;
+    if (row_major) {
+      memcpy(dst + begin, tensor.raw_data() + begin, end - begin);
+    } else {
+      CopyStridedTensorRows(tensor, elem_size, begin, end, dst);
+    }
+    return Status::OK();
+  };
+  if (num_tasks == 1) {
+    return copy_task(0);
+  }
+  return ::arrow::internal::ParallelFor(static_cast<int>(num_tasks), copy_task);
+}
+
 }  // namespace
 
 Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadata_length,
@@ -706,6 +1030,56 @@ Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadat
   return Status::OK();
 }
 
+Status ReserveTensor(const std::shared_ptr<DataType>& type,
+                     const std::vector<int64_t>& shape,
+                     const std::vector<std::string>& dim_names,
+                     io::MemoryMappedFile* dst, int32_t* metadata_length,
+                     std::shared_ptr<Tensor>* out) {
+  if (!is_tensor_supported(type->id())) {
+    return Status::TypeError("Tensors of type ", type->ToString(), " not supported");
+  }
+  const auto& fw_type = checked_cast<const FixedWidthType&>(*type);
+  Tensor dummy(type, nullptr, shape, {}, dim_names);
+  const int64_t body_length = dummy.size() * (fw_type.bit_width() / 8);
+
+  // Check the message fits before writing anything
+  io::MockOutputStream mock;
+  RETURN_NOT_OK(WriteTensorHeader(dummy, &mock, metadata_length));
+  int64_t position = 0;
+  int64_t file_size = 0;
+  RETURN_NOT_OK(dst->Tell(&position));
+  RETURN_NOT_OK(dst->GetSize(&file_size));
+  if (position + *metadata_length + body_length > file_size) {
+    return Status::Invalid("Tensor message of ", *metadata_length + body_length,
+                           " bytes at ", position, " past end of file of ", file_size,
+                           " bytes");
+  }
+
+  RETURN_NOT_OK(WriteTensorHeader(dummy, dst, metadata_length));
+  std::shared_ptr<Buffer> body;
+  RETURN_NOT_OK(dst->MutableSliceAt(position + *metadata_length, body_length, &body));
+  RETURN_NOT_OK(dst->Seek(position + *metadata_length + body_length));
+  *out = std::make_shared<Tensor>(type, body, shape, std::vector<int64_t>{}, dim_names);
+  return Status::OK();
+}
+
+Status WriteTensor(const Tensor& tensor, io::MemoryMappedFile* dst,
+                   int32_t* metadata_length, int64_t* body_length, bool use_threads) {
+  auto data = tensor.data();
+  if (!data || !data->data()) {
+    return WriteTensor(tensor, static_cast<io::OutputStream*>(dst), metadata_length,
+                       body_length);
+  }
+  const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+  const int elem_size = type.bit_width() / 8;
+
+  std::shared_ptr<Tensor> reserved;
+  RETURN_NOT_OK(ReserveTensor(tensor.type(), tensor.shape(), tensor.dim_names(), dst,
+                              metadata_length, &reserved));
+  *body_length = reserved->size() * elem_size;
+  return CopyTensorData(tensor, elem_size, use_threads, reserved->raw_mutable_data());
+}
+
 Status GetTensorMessage(const Tensor& tensor, MemoryPool* pool,
                         std::unique_ptr<Message>* out) {
   const Tensor* tensor_to_write = &tensor;
@@ -743,6 +1117,16 @@ class SparseTensorSerializer {
             VisitSparseCSRIndex(checked_cast<const SparseCSRIndex&>(sparse_index)));
         break;
 
+      case SparseTensorFormat::CSC:
+        RETURN_NOT_OK(
+            VisitSparseCSCIndex(checked_cast<const SparseCSCIndex&>(sparse_index)));
+        break;
+
+      case SparseTensorFormat::CSF:
+        RETURN_NOT_OK(
+            VisitSparseCSFIndex(checked_cast<const SparseCSFIndex&>(sparse_index)));
+        break;
+
       default:
         std::stringstream ss;
         ss << "Unable to convert type: " << sparse_index.ToString() << std::endl;
@@ -795,6 +1179,22 @@ class SparseTensorSerializer {
     return Status::OK();
   }
 
+  Status VisitSparseCSCIndex(const SparseCSCIndex& sparse_index) {
+    out_->body_buffers.emplace_back(sparse_index.indptr()->data());
+    out_->body_buffers.emplace_back(sparse_index.indices()->data());
+    return Status::OK();
+  }
+
+  Status VisitSparseCSFIndex(const SparseCSFIndex& sparse_index) {
+    for (const auto& indptr : sparse_index.indptr()) {
+      out_->body_buffers.emplace_back(indptr->data());
+    }
+    for (const auto& indices : sparse_index.indices()) {
+      out_->body_buffers.emplace_back(indices->data());
+    }
+    return Status::OK();
+  }
+
   IpcPayload* out_;
 
   std::vector<internal::BufferMetadata> buffer_meta_;
@@ -929,11 +1329,10 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     if (!wrote_dictionaries_) {
       RETURN_NOT_OK(WriteDictionaries(batch));
       wrote_dictionaries_ = true;
+    } else if (options_.emit_dictionary_deltas) {
+      RETURN_NOT_OK(WriteDictionaryDeltas(batch));
     }
 
-    // TODO(wesm): Check for delta dictionaries. Can we scan for
-    // deltas while computing the RecordBatch payload to save time?
-
     internal::IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, pool_, &payload));
     return payload_writer_->WritePayload(payload);
@@ -978,6 +1377,40 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Write the entries appended to each dictionary since the previous batch.
+  // Dictionaries can only grow, as the stream has no way to replace them
+  Status WriteDictionaryDeltas(const RecordBatch& batch) {
+    DictionaryMap dictionaries;
+    RETURN_NOT_OK(CollectDictionaries(batch, dictionary_memo_, &dictionaries));
+
+    for (const auto& pair : dictionaries) {
+      int64_t dictionary_id = pair.first;
+      const auto& dictionary = pair.second;
+
+      std::shared_ptr<Array> previous;
+      RETURN_NOT_OK(dictionary_memo_->GetDictionary(dictionary_id, &previous));
+      if (dictionary.get() == previous.get()) {
+        continue;
+      }
+      const int64_t previous_length = previous->length();
+      if (dictionary->length() < previous_length ||
+          !dictionary->RangeEquals(0, previous_length, 0, previous)) {
+        return Status::Invalid("Dictionary with id ", dictionary_id,
+                               " does not start with the entries of the previous "
+                               "dictionary, so it cannot be written as a delta");
+      }
+      if (dictionary->length() > previous_length) {
+        internal::IpcPayload payload;
+        RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, /*is_delta=*/true,
+                                           dictionary->Slice(previous_length), options_,
+                                           pool_, &payload));
+        RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      }
+      RETURN_NOT_OK(dictionary_memo_->UpdateDictionary(dictionary_id, dictionary));
+    }
+    return Status::OK();
+  }
+
  protected:
   std::unique_ptr<internal::IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
@@ -1209,6 +1642,9 @@ Status RecordBatchFileWriter::Open(io::OutputStream* sink,
 Result<std::shared_ptr<RecordBatchWriter>> RecordBatchFileWriter::Open(
     io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
     const IpcOptions& options) {
+  if (options.emit_dictionary_deltas) {
+    return Status::Invalid("Delta dictionaries are not supported by the IPC file format");
+  }
   // ctor is private
   auto result = std::shared_ptr<RecordBatchFileWriter>(new RecordBatchFileWriter());
   result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema, options));
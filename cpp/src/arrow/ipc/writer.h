@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/ipc/dictionary.h"  // IWYU pragma: export
@@ -34,6 +35,7 @@ namespace arrow {
 
 class Array;
 class Buffer;
+class DataType;
 class MemoryPool;
 class RecordBatch;
 class Schema;
@@ -44,6 +46,7 @@ class SparseTensor;
 
 namespace io {
 
+class MemoryMappedFile;
 class OutputStream;
 
 }  // namespace io
@@ -157,6 +160,8 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   /// \return Status
   static Result<std::shared_ptr<RecordBatchWriter>> Open(
       io::OutputStream* sink, const std::shared_ptr<Schema>& schema);
+  /// Returns Invalid if options.emit_dictionary_deltas is set, as the file
+  /// format doesn't support delta dictionaries
   static Result<std::shared_ptr<RecordBatchWriter>> Open(
       io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
       const IpcOptions& options);
@@ -299,6 +304,49 @@ ARROW_EXPORT
 Status WriteTensor(const Tensor& tensor, io::OutputStream* dst, int32_t* metadata_length,
                    int64_t* body_length);
 
+/// \brief Write arrow::Tensor as a contiguous message to a memory-mapped file,
+/// copying the data straight into the map
+///
+/// Non-contiguous tensors are made contiguous by a strided copy into the map,
+/// split into ranges of rows copied in parallel if use_threads is true. Unlike
+/// the OutputStream version, the map is never resized: the file must be large
+/// enough to hold the message at the current position.
+///
+/// \param[in] tensor the Tensor to write
+/// \param[in] dst the MemoryMappedFile to write to, opened in a writable mode
+/// \param[out] metadata_length the actual metadata length, including padding
+/// \param[out] body_length the actual message body length
+/// \param[in] use_threads whether to copy the data on the CPU thread pool
+/// \return Status
+ARROW_EXPORT
+Status WriteTensor(const Tensor& tensor, io::MemoryMappedFile* dst,
+                   int32_t* metadata_length, int64_t* body_length,
+                   bool use_threads = true);
+
+/// \brief Reserve the message of a contiguous tensor in a memory-mapped file,
+/// for its data to be produced in place
+///
+/// The metadata is written at the current position, which is then moved past
+/// the body.  The returned tensor points into the map, so filling its data
+/// completes a message which ReadTensor reads back.  As with WriteTensor, the
+/// current position should be a 64-byte multiple, and the file must be large
+/// enough to hold the message.  The map can't be resized while the tensor is
+/// alive.
+///
+/// \param[in] type the value type of the tensor, fixed-width
+/// \param[in] shape the shape of the tensor
+/// \param[in] dim_names the dimension names of the tensor, possibly empty
+/// \param[in] dst the MemoryMappedFile to write to, opened in a writable mode
+/// \param[out] metadata_length the actual metadata length, including padding
+/// \param[out] out the row-major tensor over the body of the message
+/// \return Status
+ARROW_EXPORT
+Status ReserveTensor(const std::shared_ptr<DataType>& type,
+                     const std::vector<int64_t>& shape,
+                     const std::vector<std::string>& dim_names,
+                     io::MemoryMappedFile* dst, int32_t* metadata_length,
+                     std::shared_ptr<Tensor>* out);
+
 // \brief EXPERIMENTAL: Write arrow::SparseTensor as a contiguous mesasge. The metadata,
 // sparse index, and body are written assuming 64-byte alignment. It is the
 // user's responsibility to ensure that the OutputStream has been aligned
@@ -381,6 +429,20 @@ Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* payload);
 
+/// \brief Compute IpcPayload for a dictionary or a dictionary delta
+/// \param[in] id the dictionary id
+/// \param[in] is_delta whether the values are to be appended to the current
+/// dictionary with that id
+/// \param[in] dictionary the dictionary values
+/// \param[in] options options for serialization
+/// \param[out] payload the output IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* payload);
+
 /// \brief Compute IpcPayload for the given record batch
 /// \param[in] batch the RecordBatch that is being serialized
 /// \param[in] options options for serialization
@@ -391,6 +453,53 @@ ARROW_EXPORT
 Status GetRecordBatchPayload(const RecordBatch& batch, const IpcOptions& options,
                              MemoryPool* pool, IpcPayload* out);
 
+/// \brief Compute IpcPayload for a record batch whose buffers already lie in
+/// a memory region, which is then used as the message body without copying them
+///
+/// The buffers of the batch found at 8-byte aligned positions of the region are
+/// referenced at those positions.  The other ones are returned in
+/// out->body_buffers, to be written one after the other from offset
+/// region_size, each padded to a multiple of 8 bytes.  out->body_length then
+/// covers both the region and those buffers.  Body compression is not supported.
+///
+/// \param[in] batch the RecordBatch that is being serialized
+/// \param[in] region_start the start of the memory region
+/// \param[in] region_size the size of the region, a multiple of 8
+/// \param[in] options options for serialization
+/// \param[in,out] pool for any required temporary memory allocations
+/// \param[out] out the returned IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetRecordBatchPayloadInPlace(const RecordBatch& batch, const uint8_t* region_start,
+                                    int64_t region_size, const IpcOptions& options,
+                                    MemoryPool* pool, IpcPayload* out);
+
+/// \brief Compute the IpcPayloads of a sequence of record batches, reusing
+/// memory from one batch to the next
+///
+/// When a record batch has as many field nodes and buffers as the previous
+/// one, as with batches of the same schema, its metadata is a copy of the
+/// previous metadata with the lengths and offsets updated in place, instead
+/// of a new flatbuffer.  The metadata buffer itself is reused once the caller
+/// no longer holds the previous payload.
+class ARROW_EXPORT RecordBatchPayloadBuilder {
+ public:
+  /// \param[in] options options for serialization
+  /// \param[in,out] pool for any required temporary memory allocations
+  RecordBatchPayloadBuilder(const IpcOptions& options, MemoryPool* pool);
+  ~RecordBatchPayloadBuilder();
+
+  /// \brief Compute IpcPayload for the given record batch, as
+  /// GetRecordBatchPayload does
+  Status Build(const RecordBatch& batch, IpcPayload* out);
+
+  void set_memory_pool(MemoryPool* pool);
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 ARROW_EXPORT
 Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
                        int32_t* metadata_length);
@@ -28,9 +28,11 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
 #include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
+using internal::GetCpuThreadPool;
 using internal::TaskGroup;
 
 namespace json {
@@ -187,6 +189,8 @@ class ChunkedListArrayBuilder : public ChunkedArrayBuilder {
     return Status::OK();
   }
 
+  void InsertAbsentChunks() override { value_builder_->InsertAbsentChunks(); }
+
   void Insert(int64_t block_index, const std::shared_ptr<Field>&,
               const std::shared_ptr<Array>& unconverted) override {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -316,22 +320,16 @@ class ChunkedStructArrayBuilder : public ChunkedArrayBuilder {
   Status Finish(std::shared_ptr<ChunkedArray>* out) override {
     RETURN_NOT_OK(task_group_->Finish());
 
-    if (promotion_graph_ != nullptr) {
-      // insert absent child chunks
-      for (auto&& name_index : name_to_index_) {
-        auto child_builder = child_builders_[name_index.second].get();
-
-        RETURN_NOT_OK(child_builder->ReplaceTaskGroup(TaskGroup::MakeSerial()));
-
-        for (size_t i = 0; i < chunk_lengths_.size(); ++i) {
-          if (child_absent_[i].size() > static_cast<size_t>(name_index.second) &&
-              !child_absent_[i][name_index.second]) {
-            continue;
-          }
-          auto empty = std::make_shared<NullArray>(chunk_lengths_[i]);
-          child_builder->Insert(i, promotion_graph_->Null(name_index.first), empty);
-        }
-      }
+    if (promotion_graph_ != nullptr && !absent_chunks_inserted_) {
+      // insert absent child chunks throughout the nested builders at once, so that
+      // their conversions don't wait for each other.  The finished task group can't
+      // take new tasks; substitute one of the same kind.
+      auto task_group = task_group_->parallelism() > 1
+                            ? TaskGroup::MakeThreaded(GetCpuThreadPool())
+                            : TaskGroup::MakeSerial();
+      RETURN_NOT_OK(ReplaceTaskGroup(task_group));
+      InsertAbsentChunks();
+      RETURN_NOT_OK(task_group_->Finish());
     }
 
     std::vector<std::shared_ptr<Field>> fields(name_to_index_.size());
@@ -361,6 +359,29 @@ class ChunkedStructArrayBuilder : public ChunkedArrayBuilder {
     return Status::OK();
   }
 
+  void InsertAbsentChunks() override {
+    if (promotion_graph_ != nullptr) {
+      for (auto&& name_index : name_to_index_) {
+        auto child_builder = child_builders_[name_index.second].get();
+
+        for (size_t i = 0; i < chunk_lengths_.size(); ++i) {
+          if (child_absent_[i].size() > static_cast<size_t>(name_index.second) &&
+              !child_absent_[i][name_index.second]) {
+            continue;
+          }
+          auto empty = std::make_shared<NullArray>(chunk_lengths_[i]);
+          child_builder->Insert(i, promotion_graph_->Null(name_index.first), empty);
+        }
+      }
+      absent_chunks_inserted_ = true;
+    }
+
+    // the children's own absent chunks depend on the chunks inserted above
+    for (auto&& child_builder : child_builders_) {
+      child_builder->InsertAbsentChunks();
+    }
+  }
+
   Status ReplaceTaskGroup(const std::shared_ptr<TaskGroup>& task_group) override {
     RETURN_NOT_OK(task_group_->Finish());
     for (auto&& child_builder : child_builders_) {
@@ -415,6 +436,7 @@ class ChunkedStructArrayBuilder : public ChunkedArrayBuilder {
   std::vector<std::vector<bool>> child_absent_;
   BufferVector null_bitmap_chunks_;
   std::vector<int64_t> chunk_lengths_;
+  bool absent_chunks_inserted_ = false;
 };
 
 Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
@@ -52,6 +52,11 @@ class ARROW_EXPORT ChunkedArrayBuilder {
   /// Every chunk must be inserted before this is called!
   virtual Status Finish(std::shared_ptr<ChunkedArray>* out) = 0;
 
+  /// Spawn tasks converting the chunks which aren't known until every block has
+  /// been inserted, such as null chunks for the fields absent from some blocks.
+  /// Every chunk must be inserted before this is called!
+  virtual void InsertAbsentChunks() {}
+
   /// Finish current task group and substitute a new one
   virtual Status ReplaceTaskGroup(
       const std::shared_ptr<internal::TaskGroup>& task_group) = 0;
@@ -432,5 +432,38 @@ TEST(InferringChunkedArrayBuilder, MultipleChunkIntegerParallel) {
   AssertFieldEqual({"a"}, actual, *expected);
 }
 
+TEST(InferringChunkedArrayBuilder, MultipleChunkNestedAbsentParallel) {
+  auto tg = TaskGroup::MakeThreaded(GetCpuThreadPool());
+  std::unique_ptr<ChunkedArrayBuilder> builder;
+  ASSERT_OK(MakeChunkedArrayBuilder(tg, default_memory_pool(), GetPromotionGraph(),
+                                    struct_({}), &builder));
+
+  // "a.b" is absent from every other chunk and promoted to double by the last one
+  std::shared_ptr<ChunkedArray> actual;
+  std::vector<std::string> chunks;
+  std::vector<std::vector<bool>> expected_valid;
+  std::vector<std::vector<double>> expected_values;
+  for (int i = 0; i < 1 << 8; ++i) {
+    if (i % 2 == 0) {
+      chunks.push_back(R"({"a":{"b":)" + std::to_string(i) + "}}\n" +
+                       R"({"a":{"b":)" + std::to_string(i + 1) + "}}\n");
+      expected_valid.push_back({true, true});
+      expected_values.push_back({static_cast<double>(i), static_cast<double>(i + 1)});
+    } else {
+      chunks.push_back("{\"a\":{\"c\":\"x\"}}\n{}\n");
+      expected_valid.push_back({false, false});
+      expected_values.push_back({0, 0});
+    }
+  }
+  chunks.push_back("{\"a\":{\"b\":0.5}}\n");
+  expected_valid.push_back({true});
+  expected_values.push_back({0.5});
+  AssertBuilding(builder, chunks, &actual);
+
+  std::shared_ptr<ChunkedArray> expected;
+  ChunkedArrayFromVector<DoubleType>(expected_valid, expected_values, &expected);
+  AssertFieldEqual({"a", "b"}, actual, *expected);
+}
+
 }  // namespace json
 }  // namespace arrow
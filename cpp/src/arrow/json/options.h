@@ -19,6 +19,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/util/visibility.h"
 
@@ -44,6 +46,17 @@ struct ARROW_EXPORT ParseOptions {
   // How should parse handle fields outside the explicit_schema?
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  // If non-empty, indicates the names of the top-level fields whose types should be
+  // inferred. Other fields are skipped along with their values, without storage being
+  // allocated for them. The fields of explicit_schema are always parsed.
+  // This option is only used with UnexpectedFieldBehavior::InferType.
+  std::vector<std::string> include_fields;
+
+  // Whether to parse with a two-stage parser, which first indexes the structural
+  // characters of a block (using SIMD instructions where available) rather than
+  // with RapidJSON. Both parsers yield the same results
+  bool use_structural_index = false;
+
   static ParseOptions Defaults();
 };
 
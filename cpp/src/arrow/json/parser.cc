@@ -21,10 +21,12 @@
 #include <limits>
 #include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "arrow/json/rapidjson_defs.h"
+#include "arrow/json/structural_index.h"
 #include "rapidjson/error/en.h"
 #include "rapidjson/reader.h"
 
@@ -635,10 +637,11 @@ class HandlerBase : public BlockParser,
   /// @}
 
   /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  Status Initialize(const ParseOptions& options) {
+    use_structural_index_ = options.use_structural_index;
     auto type = struct_({});
-    if (s) {
-      type = struct_(s->fields());
+    if (options.explicit_schema) {
+      type = struct_(options.explicit_schema->fields());
     }
     return builder_set_.MakeBuilder(*type, 0, &builder_);
   }
@@ -683,6 +686,12 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (use_structural_index_) {
+      string_view data(reinterpret_cast<const char*>(json->data()), json->size());
+      RETURN_NOT_OK(IndexStructuralCharacters(data, &structural_index_));
+      return ParseIndexed(data, structural_index_, kMaxParserNumRows, &handler,
+                          &num_rows_, &unescaped_);
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -816,6 +825,10 @@ class HandlerBase : public BlockParser,
   // top of this stack == field_index_
   std::vector<int> field_index_stack_;
   StringBuilder scalar_values_builder_;
+  // state of the two-stage parser
+  bool use_structural_index_ = false;
+  std::vector<uint32_t> structural_index_;
+  std::string unescaped_;
 };
 
 template <UnexpectedFieldBehavior>
@@ -1030,6 +1043,114 @@ class Handler<UnexpectedFieldBehavior::InferType> : public HandlerBase {
   }
 };
 
+/// \brief Handler inferring the types of selected top-level fields
+///
+/// The values of other fields are skipped as by Handler<Ignore>
+class SelectingHandler : public Handler<UnexpectedFieldBehavior::InferType> {
+ public:
+  using Base = Handler<UnexpectedFieldBehavior::InferType>;
+
+  SelectingHandler(MemoryPool* pool, const std::vector<std::string>& include_fields)
+      : Base(pool), include_fields_(include_fields.begin(), include_fields.end()) {}
+
+  Status Parse(const std::shared_ptr<Buffer>& json) override {
+    return DoParse(*this, json);
+  }
+
+  bool Null() {
+    if (Skipping()) {
+      return true;
+    }
+    return Base::Null();
+  }
+
+  bool Bool(bool value) {
+    if (Skipping()) {
+      return true;
+    }
+    return Base::Bool(value);
+  }
+
+  bool RawNumber(const char* data, rj::SizeType size, ...) {
+    if (Skipping()) {
+      return true;
+    }
+    return Base::RawNumber(data, size);
+  }
+
+  bool String(const char* data, rj::SizeType size, ...) {
+    if (Skipping()) {
+      return true;
+    }
+    return Base::String(data, size);
+  }
+
+  bool StartObject() {
+    ++depth_;
+    if (Skipping()) {
+      return true;
+    }
+    return Base::StartObject();
+  }
+
+  /// \ingroup rapidjson-handler-interface
+  ///
+  /// if a top-level field is neither known nor included, skip until its value
+  /// has been consumed
+  bool Key(const char* key, rj::SizeType len, ...) {
+    MaybeStopSkipping();
+    if (Skipping()) {
+      return true;
+    }
+    if (builder_stack_.size() == 1) {
+      if (ARROW_PREDICT_TRUE(SetFieldBuilder(string_view(key, len)))) {
+        return true;
+      }
+      if (include_fields_.find(std::string(key, len)) == include_fields_.end()) {
+        skip_depth_ = depth_;
+        return true;
+      }
+    }
+    return Base::Key(key, len);
+  }
+
+  bool EndObject(...) {
+    MaybeStopSkipping();
+    --depth_;
+    if (Skipping()) {
+      return true;
+    }
+    return Base::EndObject();
+  }
+
+  bool StartArray() {
+    if (Skipping()) {
+      return true;
+    }
+    return Base::StartArray();
+  }
+
+  bool EndArray(rj::SizeType size) {
+    if (Skipping()) {
+      return true;
+    }
+    return Base::EndArray(size);
+  }
+
+ private:
+  bool Skipping() { return depth_ >= skip_depth_; }
+
+  void MaybeStopSkipping() {
+    if (skip_depth_ == depth_) {
+      skip_depth_ = std::numeric_limits<int>::max();
+    }
+  }
+
+  std::unordered_set<std::string> include_fields_;
+  int depth_ = 0;
+  int skip_depth_ = std::numeric_limits<int>::max();
+};
+
 Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
                          std::unique_ptr<BlockParser>* out) {
   DCHECK(options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType ||
@@ -1045,10 +1166,14 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       break;
     }
     case UnexpectedFieldBehavior::InferType:
+      if (!options.include_fields.empty()) {
+        *out = make_unique<SelectingHandler>(pool, options.include_fields);
+        break;
+      }
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
@@ -113,6 +113,18 @@ static void ParseJSONBlockWithSchema(
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+static void ParseJSONBlockWithSchemaStructuralIndex(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  options.explicit_schema = TestSchema();
+  options.use_structural_index = true;
+
+  auto json = TestJsonData(num_rows);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
@@ -158,6 +170,7 @@ static void ReadJSONBlockWithSchemaMultiThread(
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchemaStructuralIndex);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
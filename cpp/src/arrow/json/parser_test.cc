@@ -194,5 +194,63 @@ TEST(BlockParser, Nested) {
                       R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
 }
 
+TEST(BlockParser, IncludeFields) {
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  options.include_fields = {"nuf", "yo"};
+  for (bool use_structural_index : {false, true}) {
+    options.use_structural_index = use_structural_index;
+    std::shared_ptr<Array> parsed;
+    ASSERT_OK(ParseFromString(options, nested_src(), &parsed));
+    ASSERT_EQ(parsed->type()->num_children(), 2);
+    AssertParseColumns(options, nested_src(),
+                       {field("yo", utf8()),
+                        field("nuf", struct_({field("ps", utf8())}))},
+                       {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                        R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+  }
+
+  // Fields of the explicit schema are parsed even if not included
+  options.explicit_schema = schema({field("hello", float64())});
+  options.include_fields = {"world"};
+  std::shared_ptr<Array> parsed;
+  ASSERT_OK(ParseFromString(options, scalars_only_src(), &parsed));
+  ASSERT_EQ(parsed->type()->num_children(), 2);
+  AssertParseColumns(options, scalars_only_src(),
+                     {field("hello", utf8()), field("world", boolean())},
+                     {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]",
+                      "[false, null, null, true]"});
+}
+
+TEST(BlockParser, StructuralIndex) {
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  options.use_structural_index = true;
+  AssertParseColumns(
+      options, scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+  AssertParseColumns(options, nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+
+  options.explicit_schema = schema({field("yo", utf8()), field("arr", list(int32()))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8()))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])"});
+
+  std::shared_ptr<Array> parsed;
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"yo\": \"a\", \"arr\"", &parsed));
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"yo\": true}", &parsed));
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"hello\": 1}", &parsed));
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/json/reader.h"
 
+#include <deque>
+#include <future>
 #include <utility>
 #include <vector>
 
@@ -28,7 +30,9 @@
 #include "arrow/json/converter.h"
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
+#include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
 #include "arrow/util/task_group.h"
@@ -38,6 +42,7 @@ namespace arrow {
 
 using util::string_view;
 
+using internal::checked_cast;
 using internal::GetCpuThreadPool;
 using internal::TaskGroup;
 using internal::ThreadPool;
@@ -47,6 +52,67 @@ using io::internal::ReadaheadSpooler;
 
 namespace json {
 
+namespace {
+
+std::shared_ptr<DataType> InitialType(const ParseOptions& parse_options) {
+  return parse_options.explicit_schema
+             ? struct_(parse_options.explicit_schema->fields())
+             : struct_({});
+}
+
+const PromotionGraph* PromotionGraphFor(const ParseOptions& parse_options) {
+  return parse_options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+             ? GetPromotionGraph()
+             : nullptr;
+}
+
+// Parse the objects of a block, the first of which straddles the previous block
+// if completion is not empty
+Status ParseBlock(MemoryPool* pool, const ParseOptions& parse_options,
+                  const std::shared_ptr<Buffer>& partial,
+                  const std::shared_ptr<Buffer>& completion,
+                  const std::shared_ptr<Buffer>& whole, std::shared_ptr<Array>* out) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool, &straddling));
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  RETURN_NOT_OK(parser->Parse(whole));
+  return parser->Finish(out);
+}
+
+// Convert a parsed block to a RecordBatch, starting from the given type
+Status ConvertBlock(const std::shared_ptr<TaskGroup>& task_group, MemoryPool* pool,
+                    const PromotionGraph* promotion_graph,
+                    const std::shared_ptr<DataType>& type,
+                    const std::shared_ptr<Array>& parsed,
+                    std::shared_ptr<RecordBatch>* out) {
+  std::unique_ptr<ChunkedArrayBuilder> builder;
+  RETURN_NOT_OK(
+      MakeChunkedArrayBuilder(task_group, pool, promotion_graph, type, &builder));
+
+  builder->Insert(0, field("", parsed->type()), parsed);
+  std::shared_ptr<ChunkedArray> converted_chunked;
+  RETURN_NOT_OK(builder->Finish(&converted_chunked));
+  const auto& converted = checked_cast<const StructArray&>(*converted_chunked->chunk(0));
+
+  std::vector<std::shared_ptr<Array>> columns(converted.num_fields());
+  for (int i = 0; i < converted.num_fields(); ++i) {
+    columns[i] = converted.field(i);
+  }
+  *out = RecordBatch::Make(schema(converted.type()->children()), converted.length(),
+                           std::move(columns));
+  return Status::OK();
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader {
  public:
   TableReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
@@ -103,36 +169,15 @@ class TableReaderImpl : public TableReader {
 
  private:
   Status MakeBuilder() {
-    auto type = parse_options_.explicit_schema
-                    ? struct_(parse_options_.explicit_schema->fields())
-                    : struct_({});
-
-    auto promotion_graph =
-        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
-            : nullptr;
-
-    return MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph, type, &builder_);
+    return MakeChunkedArrayBuilder(task_group_, pool_, PromotionGraphFor(parse_options_),
+                                   InitialType(parse_options_), &builder_);
   }
 
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    RETURN_NOT_OK(parser->Parse(whole));
-
     std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, partial, completion, whole, &parsed));
     builder_->Insert(block_index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -146,6 +191,139 @@ class TableReaderImpl : public TableReader {
   std::unique_ptr<ChunkedArrayBuilder> builder_;
 };
 
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      const ReadOptions& read_options, const ParseOptions& parse_options)
+      : pool_(pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(Chunker::Make(parse_options_)),
+        thread_pool_(read_options_.use_threads ? GetCpuThreadPool() : nullptr),
+        max_in_flight_(thread_pool_ ? thread_pool_->GetCapacity() : 1),
+        readahead_(pool_, std::move(input), read_options_.block_size, max_in_flight_),
+        promotion_graph_(PromotionGraphFor(parse_options_)),
+        type_(InitialType(parse_options_)),
+        schema_(::arrow::schema(type_->children())),
+        partial_(std::make_shared<Buffer>("")) {}
+
+  Status Init() {
+    RETURN_NOT_OK(ReadNext(&first_batch_));
+    if (first_batch_ == nullptr) {
+      return Status::Invalid("Empty JSON file");
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    if (first_batch_) {
+      *out = std::move(first_batch_);
+      return Status::OK();
+    }
+    while (true) {
+      RETURN_NOT_OK(ScheduleBlocks());
+      if (in_flight_.empty()) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      auto parsed = in_flight_.front().get();
+      in_flight_.pop_front();
+      RETURN_NOT_OK(parsed.status());
+      // Keep the parse tasks busy during the conversion
+      RETURN_NOT_OK(ScheduleBlocks());
+
+      const std::shared_ptr<Array>& block = parsed.ValueOrDie();
+      if (block->length() == 0) {
+        // e.g. trailing whitespace
+        continue;
+      }
+      auto task_group =
+          thread_pool_ ? TaskGroup::MakeThreaded(thread_pool_) : TaskGroup::MakeSerial();
+      RETURN_NOT_OK(
+          ConvertBlock(task_group, pool_, promotion_graph_, type_, block, out));
+      type_ = struct_((*out)->schema()->fields());
+      schema_ = (*out)->schema();
+      return Status::OK();
+    }
+  }
+
+ private:
+  using ParseFuture = std::future<Result<std::shared_ptr<Array>>>;
+
+  // Chunk the next blocks of input and start parsing them, until enough are
+  // in flight
+  Status ScheduleBlocks() {
+    while (!eof_ && static_cast<int>(in_flight_.size()) < max_in_flight_) {
+      ReadaheadBuffer rh;
+      RETURN_NOT_OK(readahead_.Read(&rh));
+      auto empty = std::make_shared<Buffer>("");
+      std::shared_ptr<Buffer> completion, starts_with_whole, whole, next_partial;
+      if (rh.buffer == nullptr) {
+        eof_ = true;
+        if (string_view(*partial_).find_first_not_of(" \t\n\r") == string_view::npos) {
+          break;
+        }
+        // The last object isn't followed by a newline
+        whole = partial_;
+        partial_ = completion = empty;
+      } else {
+        // get completion of partial from previous block
+        RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, rh.buffer, &completion,
+                                                   &starts_with_whole));
+        // get all whole objects entirely inside the current buffer
+        RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+      }
+
+      MemoryPool* pool = pool_;
+      auto parse_options = parse_options_;
+      auto partial = partial_;
+      auto task = [pool, parse_options, partial, completion,
+                   whole]() -> Result<std::shared_ptr<Array>> {
+        std::shared_ptr<Array> parsed;
+        RETURN_NOT_OK(
+            ParseBlock(pool, parse_options, partial, completion, whole, &parsed));
+        return parsed;
+      };
+      in_flight_.push_back(thread_pool_ ? thread_pool_->Submit(std::move(task))
+                                        : std::async(std::launch::deferred, task));
+      partial_ = next_partial ? next_partial : empty;
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  ThreadPool* thread_pool_;
+  const int max_in_flight_;
+  ReadaheadSpooler readahead_;
+  const PromotionGraph* promotion_graph_;
+
+  // The type of the last batch, from which the next one is converted
+  std::shared_ptr<DataType> type_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+
+  std::shared_ptr<Buffer> partial_;
+  bool eof_ = false;
+  // The blocks being parsed, in order
+  std::deque<ParseFuture> in_flight_;
+};
+
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  auto reader = std::make_shared<StreamingReaderImpl>(pool, std::move(input),
+                                                      read_options, parse_options);
+  RETURN_NOT_OK(reader->Init());
+  *out = std::move(reader);
+  return Status::OK();
+}
+
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                          const ReadOptions& read_options,
                          const ParseOptions& parse_options,
@@ -168,29 +346,8 @@ Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
 
-  auto type =
-      options.explicit_schema ? struct_(options.explicit_schema->fields()) : struct_({});
-  auto promotion_graph =
-      options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-          ? GetPromotionGraph()
-          : nullptr;
-  std::unique_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(internal::TaskGroup::MakeSerial(),
-                                        default_memory_pool(), promotion_graph, type,
-                                        &builder));
-
-  builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
-
-  std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
-  for (int i = 0; i < converted->num_fields(); ++i) {
-    columns[i] = converted->field(i);
-  }
-  *out = RecordBatch::Make(schema(converted->type()->children()), converted->length(),
-                           std::move(columns));
-  return Status::OK();
+  return ConvertBlock(internal::TaskGroup::MakeSerial(), default_memory_pool(),
+                      PromotionGraphFor(options), InitialType(options), parsed, out);
 }
 
 }  // namespace json
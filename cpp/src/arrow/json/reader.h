@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -50,6 +51,26 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A reader yielding a RecordBatch per block of JSON input
+///
+/// Blocks of ReadOptions::block_size bytes are parsed ahead of the reads,
+/// as many at a time as there are CPU threads if ReadOptions::use_threads is
+/// true, and then converted in order.  When types are inferred, a batch may
+/// have a wider schema than the batches before it: fields are appended as
+/// they are first met, and types are promoted (e.g. from int64 to double)
+/// when the values of a block require it.  Earlier batches are not converted
+/// again, so that the schemas of consecutive batches may differ.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// Create a StreamingReader.  This reads and converts the first block of
+  /// data, so as to know the schema.
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
@@ -25,6 +25,7 @@
 #include "arrow/json/options.h"
 #include "arrow/json/reader.h"
 #include "arrow/json/test_common.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -257,5 +258,101 @@ TEST(ReaderTest, MultipleChunksParallel) {
   AssertTablesEqual(*serial, *threaded);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  Status MakeReader(util::string_view src) {
+    read_options_.use_threads = GetParam();
+    std::shared_ptr<io::InputStream> input;
+    RETURN_NOT_OK(MakeStream(src, &input));
+    return StreamingReader::Make(default_memory_pool(), input, read_options_,
+                                 parse_options_, &reader_);
+  }
+
+  std::vector<std::shared_ptr<RecordBatch>> ReadAll() {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ARROW_EXPECT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      batches.push_back(batch);
+    }
+    return batches;
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_CASE_P(StreamingReaderTest, StreamingReaderTest,
+                        ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, Empty) {
+  ASSERT_RAISES(Invalid, MakeReader(""));
+  ASSERT_RAISES(Invalid, MakeReader("  \n "));
+}
+
+TEST_P(StreamingReaderTest, MatchesTableReader) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  std::string src;
+  for (int i = 0; i < 200; ++i) {
+    src += "{\"a\": " + std::to_string(i) + ", \"b\": \"" + std::to_string(i * 7) +
+           "\"}\n";
+  }
+  read_options_.block_size = 256;
+  ASSERT_OK(MakeReader(src));
+  auto batches = ReadAll();
+  ASSERT_GT(batches.size(), 1);
+  std::shared_ptr<Table> streamed;
+  ASSERT_OK(Table::FromRecordBatches(batches, &streamed));
+
+  std::shared_ptr<io::InputStream> input;
+  std::shared_ptr<TableReader> table_reader;
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(MakeStream(src, &input));
+  ASSERT_OK(TableReader::Make(default_memory_pool(), input, read_options_,
+                              parse_options_, &table_reader));
+  ASSERT_OK(table_reader->Read(&expected));
+  AssertTablesEqual(*expected, *streamed, /*same_chunk_layout=*/false);
+  AssertSchemaEqual(*expected->schema(), *reader_->schema());
+}
+
+TEST_P(StreamingReaderTest, SchemaEvolution) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  // Rows of the same length, so that each part fits exactly in a block
+  std::string ints, doubles;
+  for (int i = 0; i < 20; ++i) {
+    std::string row = "{\"a\": " + std::to_string(i) + "}";
+    row.resize(22, ' ');
+    ints += row + "\n";
+    doubles += "{\"a\": 0.5, \"b\": true}\n";
+  }
+  read_options_.block_size = static_cast<int>(ints.size());
+  auto ints_schema = schema({field("a", int64())});
+  auto evolved_schema = schema({field("a", float64()), field("b", boolean())});
+
+  ASSERT_OK(MakeReader(ints + doubles));
+  AssertSchemaEqual(*ints_schema, *reader_->schema());
+  auto batches = ReadAll();
+  ASSERT_EQ(batches.size(), 2);
+  // The first batch is not converted again once "a" is promoted
+  AssertSchemaEqual(*ints_schema, *batches[0]->schema());
+  AssertSchemaEqual(*evolved_schema, *batches[1]->schema());
+  AssertSchemaEqual(*evolved_schema, *reader_->schema());
+  ASSERT_EQ(batches[0]->num_rows(), 20);
+  ASSERT_EQ(batches[1]->num_rows(), 20);
+
+  // Fields missing from a later block are null
+  ASSERT_OK(MakeReader(doubles + ints));
+  batches = ReadAll();
+  ASSERT_EQ(batches.size(), 2);
+  AssertSchemaEqual(*evolved_schema, *batches[1]->schema());
+  AssertArraysEqual(*ArrayFromJSON(float64(), "[0, 1, 2]"),
+                    *batches[1]->column(0)->Slice(0, 3));
+  ASSERT_EQ(batches[1]->column(1)->null_count(), 20);
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -0,0 +1,369 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_index.h"
+
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/sse_util.h"
+
+namespace arrow {
+namespace json {
+
+using util::string_view;
+
+namespace {
+
+constexpr int64_t kBlockSize = 64;
+
+// The characters of a block of 64, one bit per character
+struct CharacterMasks {
+  uint64_t backslash, quote, op, whitespace;
+};
+
+#ifdef ARROW_HAVE_SSE2
+
+uint64_t EqualMask(const __m128i (&chunks)[4], char c) {
+  const __m128i needle = _mm_set1_epi8(c);
+  uint64_t mask = 0;
+  for (int i = 0; i < 4; ++i) {
+    const __m128i equal = _mm_cmpeq_epi8(chunks[i], needle);
+    auto bits = static_cast<uint32_t>(_mm_movemask_epi8(equal));
+    mask |= static_cast<uint64_t>(bits) << (16 * i);
+  }
+  return mask;
+}
+
+CharacterMasks ClassifyBlock(const char* block) {
+  __m128i chunks[4];
+  for (int i = 0; i < 4; ++i) {
+    chunks[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+  }
+  CharacterMasks masks;
+  masks.backslash = EqualMask(chunks, '\\');
+  masks.quote = EqualMask(chunks, '"');
+  masks.op = EqualMask(chunks, '{') | EqualMask(chunks, '}') | EqualMask(chunks, '[') |
+             EqualMask(chunks, ']') | EqualMask(chunks, ':') | EqualMask(chunks, ',');
+  masks.whitespace = EqualMask(chunks, ' ') | EqualMask(chunks, '\n') |
+                     EqualMask(chunks, '\t') | EqualMask(chunks, '\r');
+  return masks;
+}
+
+#else
+
+CharacterMasks ClassifyBlock(const char* block) {
+  CharacterMasks masks = {0, 0, 0, 0};
+  for (int64_t i = 0; i < kBlockSize; ++i) {
+    const uint64_t bit = static_cast<uint64_t>(1) << i;
+    switch (block[i]) {
+      case '\\':
+        masks.backslash |= bit;
+        break;
+      case '"':
+        masks.quote |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        masks.op |= bit;
+        break;
+      case ' ':
+      case '\n':
+      case '\t':
+      case '\r':
+        masks.whitespace |= bit;
+        break;
+      default:
+        break;
+    }
+  }
+  return masks;
+}
+
+#endif
+
+// Each bit is the parity of the bits up to and including it
+uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+class StructuralIndexer {
+ public:
+  // Mask the characters escaped by an odd number of backslashes
+  uint64_t FindEscaped(uint64_t backslash) {
+    constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+    constexpr uint64_t kOddBits = ~kEvenBits;
+
+    const uint64_t starts = backslash & ~(backslash << 1);
+    // A run of backslashes continuing from the previous block starts one
+    // character early
+    const uint64_t even_start_mask = kEvenBits ^ ends_odd_backslash_;
+    const uint64_t even_starts = starts & even_start_mask;
+    const uint64_t odd_starts = starts & ~even_start_mask;
+
+    // Adding the start of a run carries past its end
+    const uint64_t even_carries = backslash + even_starts;
+    uint64_t odd_carries = backslash + odd_starts;
+    const uint64_t ends_odd_backslash = odd_carries < backslash ? 1 : 0;
+    odd_carries |= ends_odd_backslash_;
+    ends_odd_backslash_ = ends_odd_backslash;
+
+    const uint64_t even_carry_ends = even_carries & ~backslash;
+    const uint64_t odd_carry_ends = odd_carries & ~backslash;
+    return (even_carry_ends & kOddBits) | (odd_carry_ends & kEvenBits);
+  }
+
+  uint64_t Structurals(const CharacterMasks& masks) {
+    const uint64_t quotes = masks.quote & ~FindEscaped(masks.backslash);
+    // From an opening quote (included) to a closing quote (excluded)
+    const uint64_t in_string = PrefixXor(quotes) ^ in_string_;
+    in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+    const uint64_t strings = in_string | quotes;
+
+    const uint64_t scalars = ~(masks.op | masks.whitespace | strings);
+    const uint64_t scalar_starts = scalars & ~((scalars << 1) | ends_scalar_);
+    ends_scalar_ = scalars >> 63;
+
+    return (masks.op & ~strings) | quotes | scalar_starts;
+  }
+
+  bool in_string() const { return in_string_ != 0; }
+
+ private:
+  uint64_t ends_odd_backslash_ = 0;
+  uint64_t in_string_ = 0;
+  uint64_t ends_scalar_ = 0;
+};
+
+void AppendPositions(uint32_t base, uint64_t bits, std::vector<uint32_t>* out) {
+  size_t size = out->size();
+  out->resize(size + BitUtil::PopCount(bits));
+  uint32_t* positions = out->data() + size;
+  while (bits != 0) {
+    *positions++ = base + BitUtil::CountTrailingZeros(bits);
+    bits &= bits - 1;
+  }
+}
+
+}  // namespace
+
+Status IndexStructuralCharacters(string_view json, std::vector<uint32_t>* out) {
+  if (json.size() >= std::numeric_limits<uint32_t>::max()) {
+    return Status::Invalid("JSON block too large to index: ", json.size(), " bytes");
+  }
+  out->clear();
+
+  StructuralIndexer indexer;
+  const auto size = static_cast<int64_t>(json.size());
+  int64_t offset = 0;
+  for (; offset + kBlockSize <= size; offset += kBlockSize) {
+    auto masks = ClassifyBlock(json.data() + offset);
+    AppendPositions(static_cast<uint32_t>(offset), indexer.Structurals(masks), out);
+  }
+  if (offset < size) {
+    // Pad the last block with whitespace
+    char block[kBlockSize];
+    std::memset(block, ' ', kBlockSize);
+    std::memcpy(block, json.data() + offset, size - offset);
+    auto masks = ClassifyBlock(block);
+    AppendPositions(static_cast<uint32_t>(offset), indexer.Structurals(masks), out);
+  }
+
+  if (indexer.in_string()) {
+    return detail::IndexedParseError("Missing a closing quotation mark in string.");
+  }
+  return Status::OK();
+}
+
+namespace detail {
+
+bool IsJsonNumber(string_view number) {
+  const char* p = number.data();
+  const char* end = p + number.size();
+  auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+  auto skip_digits = [&]() {
+    const char* start = p;
+    while (p != end && is_digit(*p)) {
+      ++p;
+    }
+    return p != start;
+  };
+
+  if (p != end && *p == '-') {
+    ++p;
+  }
+  string_view rest(p, end - p);
+  if (rest == "NaN" || rest == "Inf" || rest == "Infinity") {
+    return true;
+  }
+
+  if (p == end) {
+    return false;
+  }
+  if (*p == '0') {
+    ++p;
+  } else if (!skip_digits()) {
+    return false;
+  }
+  if (p != end && *p == '.') {
+    ++p;
+    if (!skip_digits()) {
+      return false;
+    }
+  }
+  if (p != end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    if (p != end && (*p == '+' || *p == '-')) {
+      ++p;
+    }
+    if (!skip_digits()) {
+      return false;
+    }
+  }
+  return p == end;
+}
+
+namespace {
+
+bool ParseHex4(const char* p, uint32_t* out) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    char c = p[i];
+    value <<= 4;
+    if (c >= '0' && c <= '9') {
+      value |= c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      value |= c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      value |= c - 'A' + 10;
+    } else {
+      return false;
+    }
+  }
+  *out = value;
+  return true;
+}
+
+void AppendUtf8(uint32_t codepoint, std::string* out) {
+  if (codepoint < 0x80) {
+    out->push_back(static_cast<char>(codepoint));
+  } else if (codepoint < 0x800) {
+    out->push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out->push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else {
+    out->push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+}  // namespace
+
+Status UnescapeString(string_view quoted, std::string* scratch, string_view* out) {
+  const char* p = quoted.data();
+  const char* end = p + quoted.size();
+
+  // Most strings have no escapes and are used as is
+  const char* run = p;
+  while (run != end && *run != '\\' && static_cast<unsigned char>(*run) >= 0x20) {
+    ++run;
+  }
+  if (run == end) {
+    *out = quoted;
+    return Status::OK();
+  }
+
+  scratch->assign(p, run);
+  for (p = run; p != end; ++p) {
+    char c = *p;
+    if (ARROW_PREDICT_FALSE(static_cast<unsigned char>(c) < 0x20)) {
+      return IndexedParseError("Invalid encoding in string.");
+    }
+    if (c != '\\') {
+      scratch->push_back(c);
+      continue;
+    }
+    if (++p == end) {
+      return IndexedParseError("Invalid escape character in string.");
+    }
+    switch (*p) {
+      case '"':
+      case '\\':
+      case '/':
+        scratch->push_back(*p);
+        break;
+      case 'b':
+        scratch->push_back('\b');
+        break;
+      case 'f':
+        scratch->push_back('\f');
+        break;
+      case 'n':
+        scratch->push_back('\n');
+        break;
+      case 'r':
+        scratch->push_back('\r');
+        break;
+      case 't':
+        scratch->push_back('\t');
+        break;
+      case 'u': {
+        uint32_t codepoint;
+        if (end - p < 5 || !ParseHex4(p + 1, &codepoint)) {
+          return IndexedParseError("Incorrect hex digit after \\u escape in string.");
+        }
+        p += 4;
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+          // A high surrogate must be followed by a low one
+          uint32_t low;
+          if (end - p < 7 || p[1] != '\\' || p[2] != 'u' || !ParseHex4(p + 3, &low) ||
+              low < 0xDC00 || low > 0xDFFF) {
+            return IndexedParseError("The surrogate pair in string is invalid.");
+          }
+          p += 6;
+          codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        AppendUtf8(codepoint, scratch);
+        break;
+      }
+      default:
+        return IndexedParseError("Invalid escape character in string.");
+    }
+  }
+  *out = string_view(*scratch);
+  return Status::OK();
+}
+
+}  // namespace detail
+}  // namespace json
+}  // namespace arrow
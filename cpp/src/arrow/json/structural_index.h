@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+
+/// \brief Find the structural characters of a block of JSON
+///
+/// This is the first stage of a two-stage parser: the block is scanned 64
+/// characters at a time, classifying them into bitmasks (with SIMD instructions
+/// where available), from which the strings are masked out.  The positions of
+/// the braces, brackets, colons and commas outside of strings, of both quotes of
+/// each string and of the first character of each other scalar are stored in
+/// out, in order.
+ARROW_EXPORT Status IndexStructuralCharacters(util::string_view json,
+                                              std::vector<uint32_t>* out);
+
+namespace detail {
+
+template <typename... T>
+Status IndexedParseError(T&&... t) {
+  return Status::Invalid("JSON parse error: ", std::forward<T>(t)...);
+}
+
+/// \brief Check the characters of a number (NaN and Infinity included)
+ARROW_EXPORT bool IsJsonNumber(util::string_view number);
+
+/// \brief Unescape the characters between the quotes of a string
+///
+/// out is a view of the string itself if it has no escapes, otherwise of
+/// scratch into which it is unescaped.
+ARROW_EXPORT Status UnescapeString(util::string_view quoted, std::string* scratch,
+                                   util::string_view* out);
+
+inline bool IsJsonWhitespace(char c) {
+  return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+}  // namespace detail
+
+/// \brief Parse a block of JSON from its structural characters
+///
+/// This is the second stage of a two-stage parser: the values of an index from
+/// IndexStructuralCharacters are walked through, calling the methods of a
+/// handler as rapidjson::Reader would with kParseNumbersAsStringsFlag and
+/// kParseNanAndInfFlag.  Root values are parsed until the block is exhausted,
+/// incrementing num_rows for each.  An error is returned if max_rows would be
+/// exceeded, and handler.Error() if a method of the handler returns false.
+template <typename Handler>
+Status ParseIndexed(util::string_view json, const std::vector<uint32_t>& index,
+                    int32_t max_rows, Handler* handler, int32_t* num_rows,
+                    std::string* scratch) {
+  using util::string_view;
+
+  // The open arrays and objects, with their number of elements
+  struct Nested {
+    bool is_object;
+    uint32_t size;
+  };
+  std::vector<Nested> stack;
+
+  const char* data = json.data();
+  const uint32_t* it = index.data();
+  const uint32_t* end = it + index.size();
+
+  // Characters from a position up to the next structural one, excepting
+  // trailing whitespace
+  auto scalar_at = [&](uint32_t pos) {
+    uint32_t scalar_end = it == end ? static_cast<uint32_t>(json.size()) : *it;
+    while (scalar_end > pos && detail::IsJsonWhitespace(data[scalar_end - 1])) {
+      --scalar_end;
+    }
+    return string_view(data + pos, scalar_end - pos);
+  };
+  // Characters between the quotes of the string whose opening quote is at pos
+  auto quoted_at = [&](uint32_t pos) {
+    // Inside a string there are no structural characters but the closing quote
+    uint32_t closing = *it++;
+    return string_view(data + pos + 1, closing - pos - 1);
+  };
+
+  for (; it != end; ++*num_rows) {
+    if (*num_rows == max_rows) {
+      return Status::Invalid("Exceeded maximum rows");
+    }
+
+  value:
+    if (ARROW_PREDICT_FALSE(it == end)) {
+      return detail::IndexedParseError("Invalid value.");
+    }
+    {
+      uint32_t pos = *it++;
+      switch (data[pos]) {
+        case '{':
+          if (!handler->StartObject()) return handler->Error();
+          if (it != end && data[*it] == '}') {
+            ++it;
+            if (!handler->EndObject(0)) return handler->Error();
+            goto after_value;
+          }
+          stack.push_back({true, 0});
+          goto object_key;
+
+        case '[':
+          if (!handler->StartArray()) return handler->Error();
+          if (it != end && data[*it] == ']') {
+            ++it;
+            if (!handler->EndArray(0)) return handler->Error();
+            goto after_value;
+          }
+          stack.push_back({false, 0});
+          goto value;
+
+        case '"': {
+          string_view str;
+          RETURN_NOT_OK(detail::UnescapeString(quoted_at(pos), scratch, &str));
+          if (!handler->String(str.data(), static_cast<uint32_t>(str.size()), true)) {
+            return handler->Error();
+          }
+          goto after_value;
+        }
+
+        case 't':
+        case 'f':
+        case 'n': {
+          auto literal = scalar_at(pos);
+          bool ok;
+          if (literal == "true" || literal == "false") {
+            ok = handler->Bool(literal[0] == 't');
+          } else if (literal == "null") {
+            ok = handler->Null();
+          } else {
+            return detail::IndexedParseError("Invalid value.");
+          }
+          if (!ok) return handler->Error();
+          goto after_value;
+        }
+
+        default: {
+          auto number = scalar_at(pos);
+          if (ARROW_PREDICT_FALSE(!detail::IsJsonNumber(number))) {
+            return detail::IndexedParseError("Invalid value.");
+          }
+          if (!handler->RawNumber(number.data(), static_cast<uint32_t>(number.size()),
+                                  true)) {
+            return handler->Error();
+          }
+          goto after_value;
+        }
+      }
+    }
+
+  object_key:
+    if (ARROW_PREDICT_FALSE(it == end || data[*it] != '"')) {
+      return detail::IndexedParseError("Missing a name for object member.");
+    }
+    {
+      uint32_t pos = *it++;
+      string_view key;
+      RETURN_NOT_OK(detail::UnescapeString(quoted_at(pos), scratch, &key));
+      if (!handler->Key(key.data(), static_cast<uint32_t>(key.size()), true)) {
+        return handler->Error();
+      }
+    }
+    if (ARROW_PREDICT_FALSE(it == end || data[*it] != ':')) {
+      return detail::IndexedParseError("Missing a colon after a name of object member.");
+    }
+    ++it;
+    goto value;
+
+  after_value:
+    if (stack.empty()) {
+      // The root value is complete
+      continue;
+    }
+    {
+      Nested& top = stack.back();
+      ++top.size;
+      char c = it == end ? '\0' : data[*it];
+      if (top.is_object) {
+        if (c == ',') {
+          ++it;
+          goto object_key;
+        }
+        if (ARROW_PREDICT_FALSE(c != '}')) {
+          return detail::IndexedParseError(
+              "Missing a comma or '}' after an object member.");
+        }
+        ++it;
+        if (!handler->EndObject(top.size)) return handler->Error();
+      } else {
+        if (c == ',') {
+          ++it;
+          goto value;
+        }
+        if (ARROW_PREDICT_FALSE(c != ']')) {
+          return detail::IndexedParseError(
+              "Missing a comma or ']' after an array element.");
+        }
+        ++it;
+        if (!handler->EndArray(top.size)) return handler->Error();
+      }
+      stack.pop_back();
+      goto after_value;
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace json
+}  // namespace arrow
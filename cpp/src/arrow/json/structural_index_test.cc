@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/json/structural_index.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace json {
+
+using util::string_view;
+
+// Records the calls of ParseIndexed as a string of space separated events
+class RecordingHandler {
+ public:
+  bool Null() { return Record("null"); }
+  bool Bool(bool value) { return Record(value ? "true" : "false"); }
+  bool RawNumber(const char* data, uint32_t size, bool) {
+    return Record("n:" + std::string(data, size));
+  }
+  bool String(const char* data, uint32_t size, bool) {
+    return Record("s:" + std::string(data, size));
+  }
+  bool Key(const char* data, uint32_t size, bool) {
+    return Record("k:" + std::string(data, size));
+  }
+  bool StartObject() { return Record("{"); }
+  bool EndObject(uint32_t size) { return Record(std::to_string(size) + "}"); }
+  bool StartArray() { return Record("["); }
+  bool EndArray(uint32_t size) { return Record(std::to_string(size) + "]"); }
+
+  Status Error() { return Status::Invalid("handler error"); }
+
+  std::string events;
+  // Fail when this event is recorded
+  std::string fail_at;
+
+ private:
+  bool Record(const std::string& event) {
+    events += events.empty() ? event : " " + event;
+    return event != fail_at;
+  }
+};
+
+Status Parse(string_view json, RecordingHandler* handler, int32_t* num_rows,
+             int32_t max_rows = 100) {
+  std::vector<uint32_t> index;
+  std::string scratch;
+  RETURN_NOT_OK(IndexStructuralCharacters(json, &index));
+  *num_rows = 0;
+  return ParseIndexed(json, index, max_rows, handler, num_rows, &scratch);
+}
+
+void AssertEvents(string_view json, const std::string& expected_events,
+                  int32_t expected_rows = 1) {
+  RecordingHandler handler;
+  int32_t num_rows;
+  ASSERT_OK(Parse(json, &handler, &num_rows));
+  ASSERT_EQ(handler.events, expected_events);
+  ASSERT_EQ(num_rows, expected_rows);
+}
+
+void AssertParseError(string_view json) {
+  RecordingHandler handler;
+  int32_t num_rows;
+  Status st = Parse(json, &handler, &num_rows);
+  ASSERT_TRUE(st.IsInvalid()) << json;
+}
+
+TEST(StructuralIndex, Positions) {
+  std::vector<uint32_t> index;
+  std::string json = R"({"a": [1, true], "b,}": -2.5e3})";
+  ASSERT_OK(IndexStructuralCharacters(json, &index));
+  std::vector<uint32_t> expected = {0, 1, 3, 4, 6, 7, 8, 10, 14, 15, 17, 21, 22, 24, 30};
+  ASSERT_EQ(index, expected);
+
+  ASSERT_OK(IndexStructuralCharacters("  \n ", &index));
+  ASSERT_TRUE(index.empty());
+}
+
+TEST(StructuralIndex, Escapes) {
+  AssertEvents(R"({"a\"b": "c\\"})", R"({ k:a"b s:c\ 1})");
+  AssertEvents(R"(["\\\"", "\/\b\f\n\r\t", "\u00e9\u5fcd\ud83d\ude00"])",
+               "[ s:\\\" s:/\b\f\n\r\t s:\xc3\xa9\xe5\xbf\x8d\xf0\x9f\x98\x80 3]");
+
+  // Runs of backslashes straddling blocks of 64 characters
+  for (int padding = 50; padding < 70; ++padding) {
+    for (int num_backslashes = 1; num_backslashes <= 4; ++num_backslashes) {
+      std::string value(padding, 'x');
+      for (int i = 0; i < num_backslashes; ++i) {
+        value += "\\\\";
+      }
+      value += "\\\"";
+      std::string expected(padding, 'x');
+      expected += std::string(num_backslashes, '\\') + "\"";
+      AssertEvents("[\"" + value + "\", 1]", "[ s:" + expected + " n:1 2]");
+    }
+  }
+}
+
+TEST(StructuralIndex, Values) {
+  AssertEvents(R"({"a": {}, "b": [], "c": [null, [false]], "d": {"e": "f"}})",
+               "{ k:a { 0} k:b [ 0] k:c [ null [ false 1] 2] k:d { k:e s:f 1} 4}");
+  AssertEvents("[0, -1, 2.5, 1E+10, 3e-2, NaN, -Infinity, Inf]",
+               "[ n:0 n:-1 n:2.5 n:1E+10 n:3e-2 n:NaN n:-Infinity n:Inf 8]");
+  AssertEvents("{\"a\":1}\n{\"a\":2} {}\n\n", "{ k:a n:1 1} { k:a n:2 1} { 0}", 3);
+  AssertEvents("", "", 0);
+  AssertEvents(" \t\r\n", "", 0);
+
+  // Strings made of structural characters
+  std::string long_string(100, ',');
+  AssertEvents("{\"" + long_string + "\": \"{}[]:\"}",
+               "{ k:" + long_string + " s:{}[]: 1}");
+}
+
+TEST(StructuralIndex, Errors) {
+  for (auto json : {"{\"a\": 1", "{\"a\" 1}", "{\"a\": 1,}", "{1: 2}", "[1 2]", "[1,]",
+                    "[tru]", "[nul]", "[01]", "[1.]", "[-]", "[1e]", "[+1]", "[\"a]",
+                    "[\"\\x\"]", "[\"\\u12g4\"]", "[\"\\ud83d\"]", "[\"a\tb\"]", "]",
+                    "{\"a\": 1}}", "[,1]", "{\"a\":1 \"b\":2}"}) {
+    AssertParseError(json);
+  }
+}
+
+TEST(StructuralIndex, HandlerErrors) {
+  RecordingHandler handler;
+  handler.fail_at = "n:2";
+  int32_t num_rows;
+  ASSERT_RAISES(Invalid, Parse("[1, 2, 3]", &handler, &num_rows));
+  ASSERT_EQ(handler.events, "[ n:1 n:2");
+
+  // Too many rows
+  handler = RecordingHandler();
+  ASSERT_OK(Parse("{} {}", &handler, &num_rows, 2));
+  ASSERT_EQ(num_rows, 2);
+  ASSERT_RAISES(Invalid, Parse("{} {} {}", &handler, &num_rows, 2));
+}
+
+}  // namespace json
+}  // namespace arrow
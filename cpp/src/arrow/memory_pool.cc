@@ -22,10 +22,18 @@
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/tracing.h"
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -162,6 +170,7 @@ class DefaultMemoryPool : public MemoryPool {
     RETURN_NOT_OK(AllocateAligned(size, out));
 
     stats_.UpdateAllocatedBytes(size);
+    ARROW_TRACE_COUNTER("memory", "bytes_allocated", stats_.bytes_allocated());
     return Status::OK();
   }
 
@@ -169,6 +178,7 @@ class DefaultMemoryPool : public MemoryPool {
     RETURN_NOT_OK(ReallocateAligned(old_size, new_size, ptr));
 
     stats_.UpdateAllocatedBytes(new_size - old_size);
+    ARROW_TRACE_COUNTER("memory", "bytes_allocated", stats_.bytes_allocated());
     return Status::OK();
   }
 
@@ -178,6 +188,7 @@ class DefaultMemoryPool : public MemoryPool {
     DeallocateAligned(buffer, size);
 
     stats_.UpdateAllocatedBytes(-size);
+    ARROW_TRACE_COUNTER("memory", "bytes_allocated", stats_.bytes_allocated());
   }
 
   int64_t max_memory() const override { return stats_.max_memory(); }
@@ -285,4 +296,725 @@ int64_t ProxyMemoryPool::bytes_allocated() const { return impl_->bytes_allocated
 
 int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
+///////////////////////////////////////////////////////////////////////
+// LimitingMemoryPool implementation
+
+class LimitingMemoryPool::LimitingMemoryPoolImpl {
+ public:
+  LimitingMemoryPoolImpl(MemoryPool* pool, int64_t limit)
+      : pool_(pool), limit_(limit), next_callback_id_(0) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(Reserve(size));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      stats_.UpdateAllocatedBytes(-size);
+    }
+    return st;
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t diff = new_size - old_size;
+    if (diff > 0) {
+      RETURN_NOT_OK(Reserve(diff));
+    }
+    Status st = pool_->Reallocate(old_size, new_size, ptr);
+    if (!st.ok()) {
+      if (diff > 0) {
+        stats_.UpdateAllocatedBytes(-diff);
+      }
+      return st;
+    }
+    if (diff < 0) {
+      stats_.UpdateAllocatedBytes(diff);
+    }
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t limit() const { return limit_; }
+
+  int RegisterReclaimCallback(ReclaimCallback callback) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    const int callback_id = next_callback_id_++;
+    callbacks_.emplace_back(callback_id, std::move(callback));
+    return callback_id;
+  }
+
+  void UnregisterReclaimCallback(int callback_id) {
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    callbacks_.erase(std::remove_if(callbacks_.begin(), callbacks_.end(),
+                                    [&](const IdentifiedCallback& callback) {
+                                      return callback.first == callback_id;
+                                    }),
+                     callbacks_.end());
+  }
+
+ private:
+  using IdentifiedCallback = std::pair<int, ReclaimCallback>;
+
+  // Account for size more bytes if the limit allows it
+  bool TryReserve(int64_t size) {
+    int64_t allocated = stats_.bytes_allocated();
+    while (true) {
+      if (size > limit_ - allocated) {
+        return false;
+      }
+      if (stats_.TryUpdateAllocatedBytes(&allocated, allocated + size)) {
+        return true;
+      }
+    }
+  }
+
+  Status Reserve(int64_t size) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (TryReserve(size)) {
+      return Status::OK();
+    }
+    std::vector<IdentifiedCallback> callbacks;
+    {
+      std::lock_guard<std::mutex> lock(callbacks_mutex_);
+      callbacks = callbacks_;
+    }
+    for (const auto& callback : callbacks) {
+      callback.second(stats_.bytes_allocated() + size - limit_);
+      if (TryReserve(size)) {
+        return Status::OK();
+      }
+    }
+    return Status::OutOfMemory("allocation of size ", size, " exceeds memory limit (",
+                               stats_.bytes_allocated(), " of ", limit_,
+                               " bytes allocated)");
+  }
+
+  MemoryPool* pool_;
+  const int64_t limit_;
+  internal::MemoryPoolStats stats_;
+
+  std::mutex callbacks_mutex_;
+  std::vector<IdentifiedCallback> callbacks_;
+  int next_callback_id_;
+};
+
+LimitingMemoryPool::LimitingMemoryPool(MemoryPool* pool, int64_t limit) {
+  impl_.reset(new LimitingMemoryPoolImpl(pool, limit));
+}
+
+LimitingMemoryPool::~LimitingMemoryPool() {}
+
+Status LimitingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status LimitingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void LimitingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t LimitingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t LimitingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t LimitingMemoryPool::limit() const { return impl_->limit(); }
+
+int LimitingMemoryPool::RegisterReclaimCallback(ReclaimCallback callback) {
+  return impl_->RegisterReclaimCallback(std::move(callback));
+}
+
+void LimitingMemoryPool::UnregisterReclaimCallback(int callback_id) {
+  impl_->UnregisterReclaimCallback(callback_id);
+}
+
+///////////////////////////////////////////////////////////////////////
+// TaggingMemoryPool implementation
+
+namespace {
+
+thread_local const char* current_memory_tag = NULLPTR;
+
+}  // namespace
+
+ScopedMemoryTag::ScopedMemoryTag(const char* tag) : previous_(current_memory_tag) {
+  current_memory_tag = tag;
+}
+
+ScopedMemoryTag::~ScopedMemoryTag() { current_memory_tag = previous_; }
+
+const char* ScopedMemoryTag::current() { return current_memory_tag; }
+
+class TaggingMemoryPool::TaggingMemoryPoolImpl {
+ public:
+  explicit TaggingMemoryPoolImpl(MemoryPool* pool) : pool_(pool) {}
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    MemoryTagStats* tag = CurrentTag();
+    ++tag->num_allocations;
+    Account(tag, *out, size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const uint8_t* old_ptr = *ptr;
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+
+    // The region stays with the tag it was allocated under
+    std::lock_guard<std::mutex> lock(mutex_);
+    MemoryTagStats* tag = Release(old_ptr, old_size);
+    Account(tag != nullptr ? tag : CurrentTag(), *ptr, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Release(buffer, size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  std::map<std::string, MemoryTagStats> tag_stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return tags_;
+  }
+
+  MemoryTagStats tag_stats(const std::string& tag) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tags_.find(tag);
+    return it == tags_.end() ? MemoryTagStats() : it->second;
+  }
+
+ private:
+  // Must be called with mutex_ held
+  MemoryTagStats* CurrentTag() {
+    const char* name = current_memory_tag;
+    auto it = tags_by_address_.find(name);
+    if (it != tags_by_address_.end()) {
+      return it->second;
+    }
+    MemoryTagStats* tag = &tags_[name == nullptr ? "" : name];
+    tags_by_address_.emplace(name, tag);
+    return tag;
+  }
+
+  void Account(MemoryTagStats* tag, const uint8_t* ptr, int64_t size) {
+    // Zero-size regions may share their address, so they are not tracked
+    if (size == 0) {
+      return;
+    }
+    tag->bytes_allocated += size;
+    tag->max_memory = std::max(tag->max_memory, tag->bytes_allocated);
+    regions_[ptr] = tag;
+  }
+
+  // Return the tag the region was accounted to, or nullptr
+  MemoryTagStats* Release(const uint8_t* ptr, int64_t size) {
+    if (size == 0) {
+      return nullptr;
+    }
+    auto it = regions_.find(ptr);
+    if (it == regions_.end()) {
+      return nullptr;
+    }
+    MemoryTagStats* tag = it->second;
+    regions_.erase(it);
+    tag->bytes_allocated -= size;
+    return tag;
+  }
+
+  MemoryPool* pool_;
+  internal::MemoryPoolStats stats_;
+
+  mutable std::mutex mutex_;
+  // Entries of a std::map are stable, so they can be pointed to
+  std::map<std::string, MemoryTagStats> tags_;
+  std::unordered_map<const char*, MemoryTagStats*> tags_by_address_;
+  std::unordered_map<const uint8_t*, MemoryTagStats*> regions_;
+};
+
+TaggingMemoryPool::TaggingMemoryPool(MemoryPool* pool)
+    : impl_(new TaggingMemoryPoolImpl(pool)) {}
+
+TaggingMemoryPool::~TaggingMemoryPool() {}
+
+Status TaggingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status TaggingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void TaggingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(buffer, size);
+}
+
+int64_t TaggingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t TaggingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::map<std::string, MemoryTagStats> TaggingMemoryPool::tag_stats() const {
+  return impl_->tag_stats();
+}
+
+MemoryTagStats TaggingMemoryPool::tag_stats(const std::string& tag) const {
+  return impl_->tag_stats(tag);
+}
+
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+constexpr int64_t ArenaMemoryPool::kMaxSmallSize;
+constexpr int64_t ArenaMemoryPool::kDefaultBlockSize;
+
+namespace {
+
+// The smallest size class matches the required alignment, so that regions
+// carved out of an aligned block stay aligned
+constexpr int kMinSizeClassLog2 = 6;
+constexpr int kNumSizeClasses = 11;
+constexpr int kNumArenaShards = 16;
+
+static_assert((int64_t(1) << kMinSizeClassLog2) == kAlignment,
+              "smallest size class should match the alignment");
+static_assert((int64_t(1) << (kMinSizeClassLog2 + kNumSizeClasses - 1)) ==
+                  ArenaMemoryPool::kMaxSmallSize,
+              "largest size class should match kMaxSmallSize");
+
+int SizeClass(int64_t size) {
+  if (size <= static_cast<int64_t>(kAlignment)) {
+    return 0;
+  }
+  return BitUtil::Log2(static_cast<uint64_t>(size)) - kMinSizeClassLog2;
+}
+
+int64_t SizeClassBytes(int size_class) {
+  return int64_t(1) << (size_class + kMinSizeClassLog2);
+}
+
+// Threads are assigned shards round-robin the first time they use any arena
+int CurrentArenaShard() {
+  static std::atomic<int> next_shard(0);
+  static thread_local int shard = next_shard.fetch_add(1) % kNumArenaShards;
+  return shard;
+}
+
+}  // namespace
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  ArenaMemoryPoolImpl(MemoryPool* parent, int64_t block_size)
+      : parent_(parent),
+        block_size_(std::max(block_size, kMaxSmallSize)),
+        bytes_reserved_(0) {}
+
+  ~ArenaMemoryPoolImpl() {
+    FreeLargeAllocations();
+    for (auto& shard : shards_) {
+      for (uint8_t* block : shard.blocks) {
+        parent_->Free(block, block_size_);
+      }
+    }
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size > kMaxSmallSize) {
+      RETURN_NOT_OK(AllocateLarge(size, out));
+    } else {
+      Shard& shard = shards_[CurrentArenaShard()];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      RETURN_NOT_OK(AllocateSmall(&shard, SizeClass(size), out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    if (old_size <= kMaxSmallSize && new_size <= kMaxSmallSize &&
+        SizeClass(old_size) == SizeClass(new_size)) {
+      // The region is large enough already
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (old_size > kMaxSmallSize && new_size > kMaxSmallSize) {
+      // Let the parent pool resize the region, possibly in place
+      std::lock_guard<std::mutex> lock(large_mutex_);
+      uint8_t* new_ptr = *ptr;
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, &new_ptr));
+      large_allocations_.erase(*ptr);
+      large_allocations_[new_ptr] = new_size;
+      *ptr = new_ptr;
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* new_ptr;
+    RETURN_NOT_OK(Allocate(new_size, &new_ptr));
+    memcpy(new_ptr, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = new_ptr;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    if (size > kMaxSmallSize) {
+      std::lock_guard<std::mutex> lock(large_mutex_);
+      parent_->Free(buffer, size);
+      large_allocations_.erase(buffer);
+    } else {
+      // The region goes to the free list of the calling thread's shard,
+      // whichever shard it was carved from
+      Shard& shard = shards_[CurrentArenaShard()];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      uint8_t*& head = shard.free_lists[SizeClass(size)];
+      *reinterpret_cast<uint8_t**>(buffer) = head;
+      head = buffer;
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  void Reset() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      std::fill(std::begin(shard.free_lists), std::end(shard.free_lists), nullptr);
+      shard.next_block = 0;
+      shard.cursor = shard.end = nullptr;
+    }
+    FreeLargeAllocations();
+    stats_.UpdateAllocatedBytes(-stats_.bytes_allocated());
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_reserved() const { return bytes_reserved_.load(); }
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    // Singly-linked lists threaded through the freed regions
+    uint8_t* free_lists[kNumSizeClasses] = {};
+    // All blocks owned by the shard; those before next_block are in use
+    std::vector<uint8_t*> blocks;
+    size_t next_block = 0;
+    // The unused part of the current block
+    uint8_t* cursor = nullptr;
+    uint8_t* end = nullptr;
+  };
+
+  Status AllocateSmall(Shard* shard, int size_class, uint8_t** out) {
+    uint8_t*& head = shard->free_lists[size_class];
+    if (head != nullptr) {
+      *out = head;
+      head = *reinterpret_cast<uint8_t**>(head);
+      return Status::OK();
+    }
+    const int64_t nbytes = SizeClassBytes(size_class);
+    if (shard->end - shard->cursor < nbytes) {
+      // The rest of the current block is abandoned until the next Reset()
+      if (shard->next_block == shard->blocks.size()) {
+        uint8_t* block;
+        RETURN_NOT_OK(parent_->Allocate(block_size_, &block));
+        shard->blocks.push_back(block);
+        bytes_reserved_ += block_size_;
+      }
+      shard->cursor = shard->blocks[shard->next_block++];
+      shard->end = shard->cursor + block_size_;
+    }
+    *out = shard->cursor;
+    shard->cursor += nbytes;
+    return Status::OK();
+  }
+
+  Status AllocateLarge(int64_t size, uint8_t** out) {
+    std::lock_guard<std::mutex> lock(large_mutex_);
+    RETURN_NOT_OK(parent_->Allocate(size, out));
+    large_allocations_[*out] = size;
+    return Status::OK();
+  }
+
+  void FreeLargeAllocations() {
+    std::lock_guard<std::mutex> lock(large_mutex_);
+    for (const auto& allocation : large_allocations_) {
+      parent_->Free(allocation.first, allocation.second);
+    }
+    large_allocations_.clear();
+  }
+
+  MemoryPool* parent_;
+  const int64_t block_size_;
+  Shard shards_[kNumArenaShards];
+
+  std::mutex large_mutex_;
+  std::unordered_map<uint8_t*, int64_t> large_allocations_;
+
+  std::atomic<int64_t> bytes_reserved_;
+  internal::MemoryPoolStats stats_;
+};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* parent, int64_t block_size) {
+  impl_.reset(new ArenaMemoryPoolImpl(parent, block_size));
+}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+void ArenaMemoryPool::Reset() { impl_->Reset(); }
+
+int64_t ArenaMemoryPool::bytes_reserved() const { return impl_->bytes_reserved(); }
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+constexpr int64_t RecyclingMemoryPool::kMinRecycledSize;
+constexpr int64_t RecyclingMemoryPool::kMaxRecycledSize;
+constexpr int64_t RecyclingMemoryPool::kDefaultMaxRetainedBytes;
+
+namespace {
+
+constexpr int kMinRecycledLog2 = 16;
+constexpr int kMaxRecycledLog2 = 26;
+// Four size classes per power of two bound the rounding waste to 25%
+constexpr int kRecycledClassesPerLog2 = 4;
+constexpr int kNumRecycledClasses =
+    (kMaxRecycledLog2 - kMinRecycledLog2 + 1) * kRecycledClassesPerLog2;
+constexpr int kNumRecyclingShards = 16;
+
+static_assert((int64_t(1) << (kMinRecycledLog2 - 1)) ==
+                  RecyclingMemoryPool::kMinRecycledSize,
+              "smallest size classes should start above kMinRecycledSize");
+static_assert((int64_t(1) << kMaxRecycledLog2) == RecyclingMemoryPool::kMaxRecycledSize,
+              "largest size class should match kMaxRecycledSize");
+
+bool IsRecycled(int64_t size) {
+  return size > RecyclingMemoryPool::kMinRecycledSize &&
+         size <= RecyclingMemoryPool::kMaxRecycledSize;
+}
+
+// The size of a region of the size class of size, which is recycled
+int64_t RecycledClassBytes(int64_t size) {
+  const int log2 = BitUtil::Log2(static_cast<uint64_t>(size));
+  const int64_t step = int64_t(1) << (log2 - 3);
+  return BitUtil::RoundUp(size, step);
+}
+
+int RecycledClass(int64_t size) {
+  const int log2 = BitUtil::Log2(static_cast<uint64_t>(size));
+  const int64_t step = int64_t(1) << (log2 - 3);
+  // The class bytes are 5, 6, 7 or 8 steps
+  return (log2 - kMinRecycledLog2) * kRecycledClassesPerLog2 +
+         static_cast<int>(RecycledClassBytes(size) / step) - 5;
+}
+
+int CurrentRecyclingShard() {
+  static std::atomic<int> next_shard(0);
+  static thread_local int shard = next_shard.fetch_add(1) % kNumRecyclingShards;
+  return shard;
+}
+
+}  // namespace
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* parent, int64_t max_retained_bytes)
+      : parent_(parent), max_retained_bytes_(max_retained_bytes), bytes_retained_(0) {}
+
+  ~RecyclingMemoryPoolImpl() { ReleaseRetained(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (IsRecycled(size)) {
+      RETURN_NOT_OK(AllocateRecycled(size, out));
+    } else {
+      RETURN_NOT_OK(parent_->Allocate(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    const bool old_recycled = IsRecycled(old_size);
+    const bool new_recycled = IsRecycled(new_size);
+    if (old_recycled && new_recycled &&
+        RecycledClass(old_size) == RecycledClass(new_size)) {
+      // The region is large enough already
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    if (!old_recycled && !new_recycled) {
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, ptr));
+      stats_.UpdateAllocatedBytes(new_size - old_size);
+      return Status::OK();
+    }
+    uint8_t* new_ptr;
+    RETURN_NOT_OK(Allocate(new_size, &new_ptr));
+    memcpy(new_ptr, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    Free(*ptr, old_size);
+    *ptr = new_ptr;
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    stats_.UpdateAllocatedBytes(-size);
+    if (!IsRecycled(size)) {
+      parent_->Free(buffer, size);
+      return;
+    }
+    const int64_t nbytes = RecycledClassBytes(size);
+    if (bytes_retained_.fetch_add(nbytes) + nbytes > max_retained_bytes_) {
+      bytes_retained_ -= nbytes;
+      parent_->Free(buffer, nbytes);
+      return;
+    }
+    Shard& shard = shards_[CurrentRecyclingShard()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.free_lists[RecycledClass(size)].push_back(buffer);
+  }
+
+  void ReleaseRetained() {
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for (int size_class = 0; size_class < kNumRecycledClasses; ++size_class) {
+        const int64_t nbytes = ClassBytes(size_class);
+        for (uint8_t* region : shard.free_lists[size_class]) {
+          parent_->Free(region, nbytes);
+          bytes_retained_ -= nbytes;
+        }
+        shard.free_lists[size_class].clear();
+      }
+    }
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_retained() const { return bytes_retained_.load(); }
+
+ private:
+  struct Shard {
+    std::mutex mutex;
+    std::vector<uint8_t*> free_lists[kNumRecycledClasses];
+  };
+
+  static int64_t ClassBytes(int size_class) {
+    const int log2 = size_class / kRecycledClassesPerLog2 + kMinRecycledLog2;
+    const int64_t step = int64_t(1) << (log2 - 3);
+    return (size_class % kRecycledClassesPerLog2 + 5) * step;
+  }
+
+  Status AllocateRecycled(int64_t size, uint8_t** out) {
+    const int size_class = RecycledClass(size);
+    // The shard of the calling thread first, then the regions other threads
+    // freed, e.g. when a thread allocates blocks which another one consumes
+    const int first_shard = CurrentRecyclingShard();
+    for (int i = 0; i < kNumRecyclingShards; ++i) {
+      Shard& shard = shards_[(first_shard + i) % kNumRecyclingShards];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      std::vector<uint8_t*>& free_list = shard.free_lists[size_class];
+      if (!free_list.empty()) {
+        *out = free_list.back();
+        free_list.pop_back();
+        bytes_retained_ -= ClassBytes(size_class);
+        return Status::OK();
+      }
+    }
+    return parent_->Allocate(RecycledClassBytes(size), out);
+  }
+
+  MemoryPool* parent_;
+  const int64_t max_retained_bytes_;
+  Shard shards_[kNumRecyclingShards];
+  std::atomic<int64_t> bytes_retained_;
+  internal::MemoryPoolStats stats_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* parent,
+                                         int64_t max_retained_bytes) {
+  impl_.reset(new RecyclingMemoryPoolImpl(parent, max_retained_bytes));
+}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t RecyclingMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t RecyclingMemoryPool::bytes_retained() const { return impl_->bytes_retained(); }
+
+void RecyclingMemoryPool::ReleaseRetained() { impl_->ReleaseRetained(); }
+
+MemoryPool* scratch_memory_pool(MemoryPool* pool) {
+  if (pool != default_memory_pool()) {
+    return pool;
+  }
+  // Never destroyed, as buffers may be freed during static destruction
+  static RecyclingMemoryPool* recycling_pool = new RecyclingMemoryPool();
+  return recycling_pool;
+}
+
 }  // namespace arrow
@@ -20,7 +20,10 @@
 
 #include <atomic>
 #include <cstdint>
+#include <functional>
+#include <map>
 #include <memory>
+#include <string>
 
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
@@ -49,6 +52,19 @@ class MemoryPoolStats {
     }
   }
 
+  /// \brief Set the allocated bytes to desired if they are still expected
+  ///
+  /// On failure, *expected is updated to the current value.
+  inline bool TryUpdateAllocatedBytes(int64_t* expected, int64_t desired) {
+    if (!bytes_allocated_.compare_exchange_weak(*expected, desired)) {
+      return false;
+    }
+    if (desired > *expected && desired > max_memory_) {
+      max_memory_ = desired;
+    }
+    return true;
+  }
+
  protected:
   std::atomic<int64_t> bytes_allocated_;
   std::atomic<int64_t> max_memory_;
@@ -141,6 +157,107 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A MemoryPool wrapper which enforces a limit on the number of bytes
+/// allocated through it.
+///
+/// When an allocation would exceed the limit, the registered reclaim callbacks
+/// are called in registration order until enough memory has been released,
+/// after which the allocation fails with Status::OutOfMemory if that is still
+/// not the case.  Callbacks are passed the number of bytes missing and are
+/// called without any lock held, so they may free memory allocated from this
+/// pool.  They must be thread-safe, as concurrent allocations may call them
+/// concurrently.
+class ARROW_EXPORT LimitingMemoryPool : public MemoryPool {
+ public:
+  /// \brief Release memory, returning an estimate of the number of bytes freed
+  using ReclaimCallback = std::function<int64_t(int64_t bytes_needed)>;
+
+  LimitingMemoryPool(MemoryPool* pool, int64_t limit);
+  ~LimitingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The maximum number of bytes allocated through this pool at any time
+  int64_t limit() const;
+
+  /// \brief Register a callback, returning an id for unregistering it
+  int RegisterReclaimCallback(ReclaimCallback callback);
+
+  void UnregisterReclaimCallback(int callback_id);
+
+ private:
+  class LimitingMemoryPoolImpl;
+  std::unique_ptr<LimitingMemoryPoolImpl> impl_;
+};
+
+/// \brief Attribute the allocations of the current thread to a tag
+///
+/// Until the object is destroyed, allocations made by the current thread
+/// through a TaggingMemoryPool are accounted to the given tag, such as
+/// "parquet.decode" or "csv.convert".  Tags nest, the innermost one winning.
+/// The tag must outlive the object, which is the case of string literals.
+class ARROW_EXPORT ScopedMemoryTag {
+ public:
+  explicit ScopedMemoryTag(const char* tag);
+  ~ScopedMemoryTag();
+
+  /// \brief The tag of the current thread, or nullptr
+  static const char* current();
+
+ private:
+  const char* previous_;
+};
+
+/// \brief The allocations of a tag in a TaggingMemoryPool
+struct MemoryTagStats {
+  /// The number of bytes allocated under the tag and not yet freed
+  int64_t bytes_allocated = 0;
+  /// The peak of bytes_allocated
+  int64_t max_memory = 0;
+  /// The number of calls to Allocate() under the tag
+  int64_t num_allocations = 0;
+};
+
+/// \brief A MemoryPool wrapper accounting each allocation to the tag of the
+/// ScopedMemoryTag that was current when it was made
+///
+/// A region stays accounted to its tag until it is freed, whichever the
+/// thread or the tag current at that point.  Allocations made outside of any
+/// ScopedMemoryTag are accounted to the empty tag.  This takes a lock per
+/// call, so it is meant for diagnosing memory use rather than for production
+/// pools with many small allocations.
+class ARROW_EXPORT TaggingMemoryPool : public MemoryPool {
+ public:
+  explicit TaggingMemoryPool(MemoryPool* pool);
+  ~TaggingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The statistics of every tag seen so far, keyed by tag
+  std::map<std::string, MemoryTagStats> tag_stats() const;
+
+  /// \brief The statistics of one tag, all zero if it was never seen
+  MemoryTagStats tag_stats(const std::string& tag) const;
+
+ private:
+  class TaggingMemoryPoolImpl;
+  std::unique_ptr<TaggingMemoryPoolImpl> impl_;
+};
+
 /// Return the process-wide default memory pool.
 ARROW_EXPORT MemoryPool* default_memory_pool();
 
@@ -148,6 +265,102 @@ ARROW_EXPORT MemoryPool* default_memory_pool();
 #define ARROW_MEMORY_POOL_DEFAULT = default_memory_pool()
 #endif
 
+/// \brief EXPERIMENTAL: A memory pool for many short-lived small allocations,
+/// such as the buffers of builders and kernel outputs for a single batch.
+///
+/// Allocations of up to kMaxSmallSize bytes are rounded up to a power-of-two
+/// size class and carved out of large blocks obtained from the parent pool.
+/// Freed regions are kept on per-size-class free lists for reuse.  Threads
+/// are spread over a fixed number of shards, each with its own blocks and
+/// free lists, to limit contention.  Larger allocations are forwarded to the
+/// parent pool.
+///
+/// Blocks are only returned to the parent pool when the arena is destroyed.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kMaxSmallSize = 64 * 1024;
+  static constexpr int64_t kDefaultBlockSize = 1024 * 1024;
+
+  /// \param[in] parent the pool blocks and large allocations are obtained from
+  /// \param[in] block_size the size of blocks, at least kMaxSmallSize
+  explicit ArenaMemoryPool(MemoryPool* parent = default_memory_pool(),
+                           int64_t block_size = kDefaultBlockSize);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief Release all allocations at once, keeping the blocks for reuse
+  ///
+  /// Meant to be called when a batch scope ends.  No memory allocated from
+  /// this pool before the call may be used or freed afterwards.
+  void Reset();
+
+  /// \brief The number of bytes currently obtained from the parent pool,
+  /// including unused block space
+  int64_t bytes_reserved() const;
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief EXPERIMENTAL: A memory pool recycling large buffers of about
+/// constant size, such as IO blocks and decompressed pages, which are
+/// allocated and freed in a steady stream.
+///
+/// Allocations of more than kMinRecycledSize and up to kMaxRecycledSize bytes
+/// are rounded up to a size class, four per power of two, and freed regions
+/// are kept for the next allocations of the same class rather than returned
+/// to the parent pool, as long as no more than max_retained_bytes are kept.
+/// Each thread frees to, and allocates first from, its own shard of free
+/// lists, then takes regions freed by other threads.  Other allocations are
+/// forwarded to the parent pool.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kMinRecycledSize = 32 * 1024;
+  static constexpr int64_t kMaxRecycledSize = 64 * 1024 * 1024;
+  static constexpr int64_t kDefaultMaxRetainedBytes = 64 * 1024 * 1024;
+
+  /// \param[in] parent the pool regions are obtained from
+  /// \param[in] max_retained_bytes the maximum number of bytes of freed
+  /// regions kept for reuse
+  explicit RecyclingMemoryPool(MemoryPool* parent = default_memory_pool(),
+                               int64_t max_retained_bytes = kDefaultMaxRetainedBytes);
+  ~RecyclingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief The number of bytes of freed regions kept for reuse
+  int64_t bytes_retained() const;
+
+  /// \brief Return the regions kept for reuse to the parent pool
+  void ReleaseRetained();
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief The pool for short-lived buffers of about constant size, such as
+/// IO blocks and decompression buffers: a process-wide RecyclingMemoryPool if
+/// pool is the default memory pool, pool itself otherwise, so that the
+/// allocations made through a custom pool stay accounted to it.
+ARROW_EXPORT MemoryPool* scratch_memory_pool(MemoryPool* pool);
+
 }  // namespace arrow
 
 #endif  // ARROW_MEMORY_POOL_H
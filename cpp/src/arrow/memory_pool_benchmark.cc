@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+
+// The default pool (jemalloc if enabled), used directly
+struct DefaultPoolScope {
+  MemoryPool* pool() { return default_memory_pool(); }
+  void EndBatch() {}
+};
+
+// An arena reset after each batch
+struct ArenaPoolScope {
+  MemoryPool* pool() { return &arena; }
+  void EndBatch() { arena.Reset(); }
+
+  ArenaMemoryPool arena;
+};
+
+constexpr int kAllocationsPerBatch = 256;
+
+template <typename PoolScope>
+static void AllocateFreeSmall(benchmark::State& state) {  // NOLINT non-const reference
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int64_t> size_dist(1, 4096);
+  std::vector<int64_t> sizes(kAllocationsPerBatch);
+  for (auto& size : sizes) {
+    size = size_dist(rng);
+  }
+  std::vector<uint8_t*> data(kAllocationsPerBatch);
+
+  PoolScope scope;
+  for (auto _ : state) {
+    MemoryPool* pool = scope.pool();
+    for (int i = 0; i < kAllocationsPerBatch; ++i) {
+      ABORT_NOT_OK(pool->Allocate(sizes[i], &data[i]));
+    }
+    for (int i = 0; i < kAllocationsPerBatch; ++i) {
+      pool->Free(data[i], sizes[i]);
+    }
+    scope.EndBatch();
+  }
+  state.SetItemsProcessed(state.iterations() * kAllocationsPerBatch);
+}
+
+// Build many small arrays per batch, as when converting or filtering small
+// record batches
+template <typename PoolScope>
+static void BuildSmallArrays(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t length = state.range(0);
+  constexpr int kArraysPerBatch = 64;
+
+  PoolScope scope;
+  for (auto _ : state) {
+    {
+      std::vector<std::shared_ptr<Array>> arrays;
+      for (int i = 0; i < kArraysPerBatch; ++i) {
+        Int32Builder int_builder(scope.pool());
+        StringBuilder string_builder(scope.pool());
+        for (int64_t j = 0; j < length; ++j) {
+          if (j % 10 == 0) {
+            ABORT_NOT_OK(int_builder.AppendNull());
+            ABORT_NOT_OK(string_builder.AppendNull());
+          } else {
+            ABORT_NOT_OK(int_builder.Append(static_cast<int32_t>(j)));
+            ABORT_NOT_OK(string_builder.Append("value"));
+          }
+        }
+        std::shared_ptr<Array> out;
+        ABORT_NOT_OK(int_builder.Finish(&out));
+        arrays.push_back(out);
+        ABORT_NOT_OK(string_builder.Finish(&out));
+        arrays.push_back(out);
+      }
+    }
+    scope.EndBatch();
+  }
+  state.SetItemsProcessed(state.iterations() * kArraysPerBatch * length);
+}
+
+BENCHMARK_TEMPLATE(AllocateFreeSmall, DefaultPoolScope);
+BENCHMARK_TEMPLATE(AllocateFreeSmall, ArenaPoolScope);
+
+BENCHMARK_TEMPLATE(BuildSmallArrays, DefaultPoolScope)
+    ->RangeMultiplier(8)
+    ->Range(8, 4096);
+BENCHMARK_TEMPLATE(BuildSmallArrays, ArenaPoolScope)->RangeMultiplier(8)->Range(8, 4096);
+
+}  // namespace arrow
@@ -15,7 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <cstdint>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -99,4 +105,459 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pool->bytes_allocated());
   ASSERT_EQ(0, pp.bytes_allocated());
 }
+
+class TestLimitingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  LimitingMemoryPool pool_{default_memory_pool(), std::numeric_limits<int64_t>::max()};
+};
+
+TEST_F(TestLimitingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestLimitingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestLimitingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(LimitingMemoryPool, Limit) {
+  ProxyMemoryPool parent(default_memory_pool());
+  LimitingMemoryPool pool(&parent, 1000);
+  ASSERT_EQ(1000, pool.limit());
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(600, &data1));
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(401, &data2));
+  ASSERT_EQ(600, pool.bytes_allocated());
+  ASSERT_OK(pool.Allocate(400, &data2));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+
+  // Reallocation is limited too
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(400, 401, &data2));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+  ASSERT_OK(pool.Reallocate(400, 100, &data2));
+  ASSERT_OK(pool.Reallocate(600, 900, &data1));
+  ASSERT_EQ(1000, pool.bytes_allocated());
+  ASSERT_EQ(1000, parent.bytes_allocated());
+
+  pool.Free(data1, 900);
+  pool.Free(data2, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(1000, pool.max_memory());
+}
+
+TEST(LimitingMemoryPool, ReclaimCallbacks) {
+  LimitingMemoryPool pool(default_memory_pool(), 1000);
+
+  // A cache of buffers allocated from the pool, released under pressure
+  std::vector<std::pair<uint8_t*, int64_t>> cache;
+  std::vector<int64_t> requests;
+  auto release_cache = [&](int64_t bytes_needed) {
+    requests.push_back(bytes_needed);
+    int64_t released = 0;
+    while (!cache.empty() && released < bytes_needed) {
+      pool.Free(cache.back().first, cache.back().second);
+      released += cache.back().second;
+      cache.pop_back();
+    }
+    return released;
+  };
+  int calls_unregistered = 0;
+  const int unregistered_id = pool.RegisterReclaimCallback([&](int64_t) {
+    ++calls_unregistered;
+    return 0;
+  });
+  int calls_first = 0;
+  pool.RegisterReclaimCallback([&](int64_t) {
+    ++calls_first;
+    return 0;
+  });
+  pool.RegisterReclaimCallback(release_cache);
+  pool.UnregisterReclaimCallback(unregistered_id);
+
+  for (int i = 0; i < 4; ++i) {
+    uint8_t* data;
+    ASSERT_OK(pool.Allocate(200, &data));
+    cache.emplace_back(data, 200);
+  }
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(500, &data));
+  ASSERT_EQ(std::vector<int64_t>{300}, requests);
+  ASSERT_EQ(2, static_cast<int>(cache.size()));
+  ASSERT_EQ(900, pool.bytes_allocated());
+  ASSERT_EQ(1, calls_first);
+  ASSERT_EQ(0, calls_unregistered);
+
+  // Not enough memory can be released
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, pool.Allocate(600, &data2));
+  ASSERT_TRUE(cache.empty());
+  ASSERT_EQ(500, pool.bytes_allocated());
+
+  pool.Free(data, 500);
+}
+
+class TestTaggingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  TaggingMemoryPool pool_{default_memory_pool()};
+};
+
+TEST_F(TestTaggingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestTaggingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestTaggingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(TaggingMemoryPool, Tags) {
+  TaggingMemoryPool pool(default_memory_pool());
+  uint8_t* untagged;
+  uint8_t* decode;
+  uint8_t* convert;
+  uint8_t* empty;
+
+  ASSERT_EQ(ScopedMemoryTag::current(), nullptr);
+  ASSERT_OK(pool.Allocate(100, &untagged));
+  {
+    ScopedMemoryTag outer("decode");
+    ASSERT_OK(pool.Allocate(200, &decode));
+    {
+      ScopedMemoryTag inner("convert");
+      ASSERT_STREQ(ScopedMemoryTag::current(), "convert");
+      ASSERT_OK(pool.Allocate(300, &convert));
+      ASSERT_OK(pool.Allocate(0, &empty));
+      // Regions stay with the tag they were allocated under
+      ASSERT_OK(pool.Reallocate(200, 1000, &decode));
+    }
+    ASSERT_STREQ(ScopedMemoryTag::current(), "decode");
+    ASSERT_OK(pool.Reallocate(0, 50, &empty));
+  }
+  ASSERT_EQ(ScopedMemoryTag::current(), nullptr);
+
+  auto stats = pool.tag_stats();
+  ASSERT_EQ(stats.size(), 3);
+  ASSERT_EQ(stats[""].bytes_allocated, 100);
+  ASSERT_EQ(stats[""].num_allocations, 1);
+  ASSERT_EQ(stats["decode"].bytes_allocated, 1050);
+  ASSERT_EQ(stats["decode"].num_allocations, 1);
+  ASSERT_EQ(stats["convert"].bytes_allocated, 300);
+  ASSERT_EQ(stats["convert"].num_allocations, 2);
+  ASSERT_EQ(pool.bytes_allocated(), 1450);
+
+  // Frees are accounted to the tag of the region, not the current one
+  {
+    ScopedMemoryTag tag("other");
+    pool.Free(decode, 1000);
+    pool.Free(convert, 300);
+  }
+  pool.Free(empty, 50);
+  pool.Free(untagged, 100);
+
+  ASSERT_EQ(pool.bytes_allocated(), 0);
+  ASSERT_EQ(pool.tag_stats().size(), 3);
+  ASSERT_EQ(pool.tag_stats("decode").bytes_allocated, 0);
+  ASSERT_EQ(pool.tag_stats("decode").max_memory, 1050);
+  ASSERT_EQ(pool.tag_stats("convert").max_memory, 300);
+  ASSERT_EQ(pool.tag_stats("other").num_allocations, 0);
+}
+
+TEST(TaggingMemoryPool, Threads) {
+  TaggingMemoryPool pool(default_memory_pool());
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&pool, i]() {
+      ScopedMemoryTag tag(i % 2 == 0 ? "even" : "odd");
+      for (int j = 0; j < 100; ++j) {
+        uint8_t* data;
+        ASSERT_OK(pool.Allocate(64, &data));
+        pool.Free(data, 64);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(pool.tag_stats("even").num_allocations, 200);
+  ASSERT_EQ(pool.tag_stats("odd").num_allocations, 200);
+  ASSERT_EQ(pool.tag_stats("even").bytes_allocated, 0);
+  ASSERT_EQ(pool.tag_stats("").num_allocations, 0);
+}
+
+class TestArenaMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  ArenaMemoryPool pool_;
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(ArenaMemoryPool, ReuseFreedRegions) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool pool(&parent, /*block_size=*/ArenaMemoryPool::kMaxSmallSize);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(0, &data2));
+  ASSERT_NE(data1, data2);
+  ASSERT_EQ(ArenaMemoryPool::kMaxSmallSize, parent.bytes_allocated());
+
+  // A freed region is reused for allocations of the same size class
+  pool.Free(data1, 100);
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(128, &data3));
+  ASSERT_EQ(data1, data3);
+
+  // Growing within the size class doesn't move the region
+  ASSERT_OK(pool.Reallocate(128, 120, &data3));
+  ASSERT_EQ(data1, data3);
+  ASSERT_EQ(120, pool.bytes_allocated());
+
+  // A new block is obtained once the current one is exhausted
+  uint8_t* data4;
+  ASSERT_OK(pool.Allocate(ArenaMemoryPool::kMaxSmallSize, &data4));
+  EXPECT_EQ(static_cast<uint64_t>(0), reinterpret_cast<uint64_t>(data4) % 64);
+  ASSERT_EQ(2 * ArenaMemoryPool::kMaxSmallSize, parent.bytes_allocated());
+  ASSERT_EQ(2 * ArenaMemoryPool::kMaxSmallSize, pool.bytes_reserved());
+
+  pool.Free(data2, 0);
+  pool.Free(data3, 120);
+  pool.Free(data4, ArenaMemoryPool::kMaxSmallSize);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(ArenaMemoryPool::kMaxSmallSize + 120, pool.max_memory());
+}
+
+TEST(ArenaMemoryPool, LargeAllocations) {
+  ProxyMemoryPool parent(default_memory_pool());
+  ArenaMemoryPool pool(&parent);
+  const int64_t large_size = ArenaMemoryPool::kMaxSmallSize + 1;
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(100, &data));
+  data[0] = 42;
+  // Grow past the small size limit
+  ASSERT_OK(pool.Reallocate(100, large_size, &data));
+  ASSERT_EQ(42, data[0]);
+  ASSERT_EQ(large_size, pool.bytes_allocated());
+  ASSERT_EQ(ArenaMemoryPool::kDefaultBlockSize + large_size, parent.bytes_allocated());
+
+  ASSERT_OK(pool.Reallocate(large_size, 2 * large_size, &data));
+  ASSERT_EQ(42, data[0]);
+  ASSERT_EQ(ArenaMemoryPool::kDefaultBlockSize + 2 * large_size,
+            parent.bytes_allocated());
+
+  // And shrink back
+  ASSERT_OK(pool.Reallocate(2 * large_size, 10, &data));
+  ASSERT_EQ(42, data[0]);
+  ASSERT_EQ(ArenaMemoryPool::kDefaultBlockSize, parent.bytes_allocated());
+  pool.Free(data, 10);
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, Reset) {
+  ProxyMemoryPool parent(default_memory_pool());
+  {
+    ArenaMemoryPool pool(&parent);
+    uint8_t* data;
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_OK(pool.Allocate(10000, &data));
+    }
+    ASSERT_OK(pool.Allocate(ArenaMemoryPool::kMaxSmallSize * 2, &data));
+    const int64_t reserved = pool.bytes_reserved();
+    ASSERT_GT(reserved, ArenaMemoryPool::kDefaultBlockSize);
+    ASSERT_EQ(reserved + ArenaMemoryPool::kMaxSmallSize * 2, parent.bytes_allocated());
+
+    // Blocks are kept and reused after a reset, large allocations are freed
+    pool.Reset();
+    ASSERT_EQ(0, pool.bytes_allocated());
+    ASSERT_EQ(reserved, parent.bytes_allocated());
+    for (int i = 0; i < 100; ++i) {
+      ASSERT_OK(pool.Allocate(10000, &data));
+    }
+    ASSERT_EQ(reserved, pool.bytes_reserved());
+    ASSERT_EQ(100 * 10000, pool.bytes_allocated());
+  }
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, Threads) {
+  ArenaMemoryPool pool;
+  constexpr int kNumThreads = 8;
+  std::vector<std::vector<uint8_t*>> allocations(kNumThreads);
+
+  auto allocate = [&](int thread_index) {
+    for (int i = 0; i < 1000; ++i) {
+      uint8_t* data;
+      const int64_t size = (i * 37) % 2000;
+      ASSERT_OK(pool.Allocate(size, &data));
+      memset(data, thread_index, static_cast<size_t>(size));
+      if (i % 2 == 0) {
+        pool.Free(data, size);
+      } else {
+        allocations[thread_index].push_back(data);
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back(allocate, i);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  // Free everything from another thread
+  for (int i = 0; i < kNumThreads; ++i) {
+    int j = 1;
+    for (uint8_t* data : allocations[i]) {
+      const int64_t size = (j * 37) % 2000;
+      if (size > 0) {
+        ASSERT_EQ(i, data[size - 1]);
+      }
+      pool.Free(data, size);
+      j += 2;
+    }
+  }
+  ASSERT_EQ(0, pool.bytes_allocated());
+}
+
+class TestRecyclingMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  ::arrow::MemoryPool* memory_pool() override { return &pool_; }
+
+ protected:
+  RecyclingMemoryPool pool_;
+};
+
+TEST_F(TestRecyclingMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestRecyclingMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestRecyclingMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(RecyclingMemoryPool, RecycleFreedRegions) {
+  ProxyMemoryPool parent(default_memory_pool());
+  RecyclingMemoryPool pool(&parent);
+  const int64_t size = 1000 * 1000;
+
+  uint8_t* data1;
+  ASSERT_OK(pool.Allocate(size, &data1));
+  // Rounded up to a quarter of the power of two below the size
+  ASSERT_EQ(1024 * 1024, parent.bytes_allocated());
+  ASSERT_EQ(size, pool.bytes_allocated());
+
+  // A freed region is kept and reused for allocations of the same size class
+  pool.Free(data1, size);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(1024 * 1024, pool.bytes_retained());
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(size + 1000, &data2));
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(0, pool.bytes_retained());
+  ASSERT_EQ(1024 * 1024, parent.bytes_allocated());
+
+  // Growing within the size class doesn't move the region
+  data2[0] = 42;
+  ASSERT_OK(pool.Reallocate(size + 1000, 1024 * 1024, &data2));
+  ASSERT_EQ(data1, data2);
+  // Growing to the next one does
+  ASSERT_OK(pool.Reallocate(1024 * 1024, 1024 * 1024 + 1, &data2));
+  ASSERT_EQ(42, data2[0]);
+  ASSERT_EQ(1024 * 1024, pool.bytes_retained());
+  ASSERT_EQ(1024 * 1024 + 1280 * 1024, parent.bytes_allocated());
+
+  // Small allocations aren't recycled
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(1000, &data3));
+  pool.Free(data3, 1000);
+  ASSERT_EQ(1024 * 1024, pool.bytes_retained());
+
+  pool.Free(data2, 1024 * 1024 + 1);
+  pool.ReleaseRetained();
+  ASSERT_EQ(0, pool.bytes_retained());
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, BoundedRetention) {
+  ProxyMemoryPool parent(default_memory_pool());
+  const int64_t size = 1024 * 1024;
+  {
+    RecyclingMemoryPool pool(&parent, /*max_retained_bytes=*/2 * size);
+    std::vector<uint8_t*> regions(4);
+    for (auto& region : regions) {
+      ASSERT_OK(pool.Allocate(size, &region));
+    }
+    for (auto region : regions) {
+      pool.Free(region, size);
+    }
+    ASSERT_EQ(2 * size, pool.bytes_retained());
+    ASSERT_EQ(2 * size, parent.bytes_allocated());
+  }
+  // Retained regions are freed with the pool
+  ASSERT_EQ(0, parent.bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, Threads) {
+  ProxyMemoryPool parent(default_memory_pool());
+  RecyclingMemoryPool pool(&parent);
+  const int64_t size = 256 * 1024;
+  constexpr int kNumBlocks = 200;
+
+  // One thread produces blocks which another one consumes and frees, as a
+  // readahead thread does
+  constexpr int kQueueSize = 4;
+  std::vector<uint8_t*> blocks(kNumBlocks);
+  std::atomic<int> num_produced(0);
+  std::atomic<int> num_consumed(0);
+  std::thread producer([&]() {
+    for (int i = 0; i < kNumBlocks; ++i) {
+      while (i - num_consumed.load() >= kQueueSize) {
+        std::this_thread::yield();
+      }
+      ASSERT_OK(pool.Allocate(size, &blocks[i]));
+      memset(blocks[i], i % 256, static_cast<size_t>(size));
+      num_produced.store(i + 1);
+    }
+  });
+  for (int i = 0; i < kNumBlocks; ++i) {
+    while (num_produced.load() <= i) {
+      std::this_thread::yield();
+    }
+    ASSERT_EQ(i % 256, blocks[i][size - 1]);
+    pool.Free(blocks[i], size);
+    num_consumed.store(i + 1);
+  }
+  producer.join();
+
+  ASSERT_EQ(0, pool.bytes_allocated());
+  // The producer reused the blocks freed by the consumer
+  ASSERT_LE(parent.max_memory(), (kQueueSize + 1) * size);
+}
+
 }  // namespace arrow
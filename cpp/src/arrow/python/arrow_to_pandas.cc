@@ -262,6 +262,7 @@ class PandasBlock {
 
     block_data_ = reinterpret_cast<uint8_t*>(
         PyArray_DATA(reinterpret_cast<PyArrayObject*>(block_arr)));
+    block_item_size_ = PyArray_ITEMSIZE(reinterpret_cast<PyArrayObject*>(block_arr));
 
     placement_data_ = reinterpret_cast<int64_t*>(
         PyArray_DATA(reinterpret_cast<PyArrayObject*>(placement_arr)));
@@ -274,6 +275,7 @@ class PandasBlock {
 
   OwnedRefNoGIL block_arr_;
   uint8_t* block_data_;
+  int64_t block_item_size_;
 
   PandasOptions options_;
 
@@ -285,6 +287,38 @@ class PandasBlock {
   ARROW_DISALLOW_COPY_AND_ASSIGN(PandasBlock);
 };
 
+// The number of rows of a column written by a single task, when converting
+// with threads
+constexpr int64_t kRowRangeLength = 1 << 20;
+
+// A block of values converted without the GIL.  Distinct row ranges of a
+// column may be written concurrently.
+class RowRangeBlock : public PandasBlock {
+ public:
+  using PandasBlock::PandasBlock;
+
+  Status Write(const std::shared_ptr<ChunkedArray>& data, int64_t abs_placement,
+               int64_t rel_placement) override {
+    RETURN_NOT_OK(WriteRows(*data, rel_placement, 0));
+    SetPlacement(abs_placement, rel_placement);
+    return Status::OK();
+  }
+
+  // Write data into rows [row_offset, row_offset + data.length()) of the
+  // column at rel_placement
+  virtual Status WriteRows(const ChunkedArray& data, int64_t rel_placement,
+                           int64_t row_offset) = 0;
+
+  void SetPlacement(int64_t abs_placement, int64_t rel_placement) {
+    placement_data_[rel_placement] = abs_placement;
+  }
+
+  // The memory of the column at rel_placement
+  uint8_t* column_data(int64_t rel_placement) {
+    return block_data_ + rel_placement * num_rows_ * block_item_size_;
+  }
+};
+
 template <typename T>
 inline const T* GetPrimitiveValues(const Array& arr) {
   if (arr.length() == 0) {
@@ -802,28 +836,27 @@ class ObjectBlock : public PandasBlock {
 };
 
 template <int ARROW_TYPE, typename C_TYPE>
-class IntBlock : public PandasBlock {
+class IntBlock : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override {
     return AllocateNDArray(internal::arrow_traits<ARROW_TYPE>::npy_type);
   }
 
-  Status Write(const std::shared_ptr<ChunkedArray>& data, int64_t abs_placement,
-               int64_t rel_placement) override {
-    Type::type type = data->type()->id();
+  Status WriteRows(const ChunkedArray& data, int64_t rel_placement,
+                   int64_t row_offset) override {
+    Type::type type = data.type()->id();
 
     C_TYPE* out_buffer =
-        reinterpret_cast<C_TYPE*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<C_TYPE*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     if (type != ARROW_TYPE) {
       return Status::NotImplemented("Cannot write Arrow data of type ",
-                                    data->type()->ToString(), " to a Pandas int",
+                                    data.type()->ToString(), " to a Pandas int",
                                     sizeof(C_TYPE), " block");
     }
 
-    ConvertIntegerNoNullsSameType<C_TYPE>(options_, *data, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
+    ConvertIntegerNoNullsSameType<C_TYPE>(options_, data, out_buffer);
     return Status::OK();
   }
 };
@@ -837,67 +870,66 @@ using Int32Block = IntBlock<Type::INT32, int32_t>;
 using UInt64Block = IntBlock<Type::UINT64, uint64_t>;
 using Int64Block = IntBlock<Type::INT64, int64_t>;
 
-class Float16Block : public PandasBlock {
+class Float16Block : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT16); }
 
-  Status Write(const std::shared_ptr<ChunkedArray>& data, int64_t abs_placement,
-               int64_t rel_placement) override {
-    Type::type type = data->type()->id();
+  Status WriteRows(const ChunkedArray& data, int64_t rel_placement,
+                   int64_t row_offset) override {
+    Type::type type = data.type()->id();
 
     if (type != Type::HALF_FLOAT) {
       return Status::NotImplemented("Cannot write Arrow data of type ",
-                                    data->type()->ToString(),
+                                    data.type()->ToString(),
                                     " to a Pandas float16 block");
     }
 
     npy_half* out_buffer =
-        reinterpret_cast<npy_half*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<npy_half*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
-    ConvertNumericNullable<npy_half>(*data, NPY_HALF_NAN, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
+    ConvertNumericNullable<npy_half>(data, NPY_HALF_NAN, out_buffer);
     return Status::OK();
   }
 };
 
-class Float32Block : public PandasBlock {
+class Float32Block : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT32); }
 
-  Status Write(const std::shared_ptr<ChunkedArray>& data, int64_t abs_placement,
-               int64_t rel_placement) override {
-    Type::type type = data->type()->id();
+  Status WriteRows(const ChunkedArray& data, int64_t rel_placement,
+                   int64_t row_offset) override {
+    Type::type type = data.type()->id();
 
     if (type != Type::FLOAT) {
       return Status::NotImplemented("Cannot write Arrow data of type ",
-                                    data->type()->ToString(),
+                                    data.type()->ToString(),
                                     " to a Pandas float32 block");
     }
 
-    float* out_buffer = reinterpret_cast<float*>(block_data_) + rel_placement * num_rows_;
+    float* out_buffer =
+        reinterpret_cast<float*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
-    ConvertNumericNullable<float>(*data, NAN, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
+    ConvertNumericNullable<float>(data, NAN, out_buffer);
     return Status::OK();
   }
 };
 
-class Float64Block : public PandasBlock {
+class Float64Block : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_FLOAT64); }
 
-  Status Write(const std::shared_ptr<ChunkedArray>& data, int64_t abs_placement,
-               int64_t rel_placement) override {
-    Type::type type = data->type()->id();
+  Status WriteRows(const ChunkedArray& data, int64_t rel_placement,
+                   int64_t row_offset) override {
+    Type::type type = data.type()->id();
 
     double* out_buffer =
-        reinterpret_cast<double*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<double*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
-#define INTEGER_CASE(IN_TYPE)                                    \
-  ConvertIntegerWithNulls<IN_TYPE>(options_, *data, out_buffer); \
+#define INTEGER_CASE(IN_TYPE)                                   \
+  ConvertIntegerWithNulls<IN_TYPE>(options_, data, out_buffer); \
   break;
 
     switch (type) {
@@ -918,49 +950,47 @@ class Float64Block : public PandasBlock {
       case Type::INT64:
         INTEGER_CASE(int64_t);
       case Type::FLOAT:
-        ConvertNumericNullableCast<float, double>(*data, NAN, out_buffer);
+        ConvertNumericNullableCast<float, double>(data, NAN, out_buffer);
         break;
       case Type::DOUBLE:
-        ConvertNumericNullable<double>(*data, NAN, out_buffer);
+        ConvertNumericNullable<double>(data, NAN, out_buffer);
         break;
       default:
         return Status::NotImplemented("Cannot write Arrow data of type ",
-                                      data->type()->ToString(),
+                                      data.type()->ToString(),
                                       " to a Pandas float64 block");
     }
 
 #undef INTEGER_CASE
 
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
 
-class BoolBlock : public PandasBlock {
+class BoolBlock : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status Allocate() override { return AllocateNDArray(NPY_BOOL); }
 
-  Status Write(const std::shared_ptr<ChunkedArray>& data, int64_t abs_placement,
-               int64_t rel_placement) override {
-    if (data->type()->id() != Type::BOOL) {
+  Status WriteRows(const ChunkedArray& data, int64_t rel_placement,
+                   int64_t row_offset) override {
+    if (data.type()->id() != Type::BOOL) {
       return Status::NotImplemented("Cannot write Arrow data of type ",
-                                    data->type()->ToString(),
+                                    data.type()->ToString(),
                                     " to a Pandas boolean block");
     }
 
     uint8_t* out_buffer =
-        reinterpret_cast<uint8_t*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<uint8_t*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
-    ConvertBooleanNoNulls(options_, *data, out_buffer);
-    placement_data_[rel_placement] = abs_placement;
+    ConvertBooleanNoNulls(options_, data, out_buffer);
     return Status::OK();
   }
 };
 
-class DatetimeBlock : public PandasBlock {
+class DatetimeBlock : public RowRangeBlock {
  public:
-  using PandasBlock::PandasBlock;
+  using RowRangeBlock::RowRangeBlock;
   Status AllocateDatetime(int ndim) {
     RETURN_NOT_OK(AllocateNDArray(NPY_DATETIME, ndim));
 
@@ -973,41 +1003,40 @@ class DatetimeBlock : public PandasBlock {
 
   Status Allocate() override { return AllocateDatetime(2); }
 
-  Status Write(const std::shared_ptr<ChunkedArray>& data, int64_t abs_placement,
-               int64_t rel_placement) override {
-    Type::type type = data->type()->id();
+  Status WriteRows(const ChunkedArray& data, int64_t rel_placement,
+                   int64_t row_offset) override {
+    Type::type type = data.type()->id();
 
     int64_t* out_buffer =
-        reinterpret_cast<int64_t*>(block_data_) + rel_placement * num_rows_;
+        reinterpret_cast<int64_t*>(block_data_) + rel_placement * num_rows_ + row_offset;
 
     if (type == Type::DATE32) {
       // Convert from days since epoch to datetime64[ns]
-      ConvertDatetimeNanos<int32_t, kNanosecondsInDay>(*data, out_buffer);
+      ConvertDatetimeNanos<int32_t, kNanosecondsInDay>(data, out_buffer);
     } else if (type == Type::DATE64) {
       // Date64Type is millisecond timestamp stored as int64_t
       // TODO(wesm): Do we want to make sure to zero out the milliseconds?
-      ConvertDatetimeNanos<int64_t, 1000000L>(*data, out_buffer);
+      ConvertDatetimeNanos<int64_t, 1000000L>(data, out_buffer);
     } else if (type == Type::TIMESTAMP) {
-      const auto& ts_type = checked_cast<const TimestampType&>(*data->type());
+      const auto& ts_type = checked_cast<const TimestampType&>(*data.type());
 
       if (ts_type.unit() == TimeUnit::NANO) {
-        ConvertNumericNullable<int64_t>(*data, kPandasTimestampNull, out_buffer);
+        ConvertNumericNullable<int64_t>(data, kPandasTimestampNull, out_buffer);
       } else if (ts_type.unit() == TimeUnit::MICRO) {
-        ConvertDatetimeNanos<int64_t, 1000L>(*data, out_buffer);
+        ConvertDatetimeNanos<int64_t, 1000L>(data, out_buffer);
       } else if (ts_type.unit() == TimeUnit::MILLI) {
-        ConvertDatetimeNanos<int64_t, 1000000L>(*data, out_buffer);
+        ConvertDatetimeNanos<int64_t, 1000000L>(data, out_buffer);
       } else if (ts_type.unit() == TimeUnit::SECOND) {
-        ConvertDatetimeNanos<int64_t, 1000000000L>(*data, out_buffer);
+        ConvertDatetimeNanos<int64_t, 1000000000L>(data, out_buffer);
       } else {
         return Status::NotImplemented("Unsupported time unit");
       }
     } else {
       return Status::NotImplemented("Cannot write Arrow data of type ",
-                                    data->type()->ToString(),
+                                    data.type()->ToString(),
                                     " to a Pandas datetime block.");
     }
 
-    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 };
@@ -1312,18 +1341,19 @@ Status MakeBlock(const PandasOptions& options, PandasBlock::type type, int64_t n
 
 using BlockMap = std::unordered_map<int, std::shared_ptr<PandasBlock>>;
 
-static Status GetPandasBlockType(const ChunkedArray& data, const PandasOptions& options,
+static Status GetPandasBlockType(const DataType& type, int64_t null_count,
+                                 const PandasOptions& options,
                                  PandasBlock::type* output_type) {
 #define INTEGER_CASE(NAME)                                                           \
   *output_type =                                                                     \
-      data.null_count() > 0                                                          \
+      null_count > 0                                                                 \
           ? options.integer_object_nulls ? PandasBlock::OBJECT : PandasBlock::DOUBLE \
           : PandasBlock::NAME;                                                       \
   break;
 
-  switch (data.type()->id()) {
+  switch (type.id()) {
     case Type::BOOL:
-      *output_type = data.null_count() > 0 ? PandasBlock::OBJECT : PandasBlock::BOOL;
+      *output_type = null_count > 0 ? PandasBlock::OBJECT : PandasBlock::BOOL;
       break;
     case Type::UINT8:
       INTEGER_CASE(UINT8);
@@ -1369,7 +1399,7 @@ static Status GetPandasBlockType(const ChunkedArray& data, const PandasOptions&
       *output_type = options.date_as_object ? PandasBlock::OBJECT : PandasBlock::DATETIME;
       break;
     case Type::TIMESTAMP: {
-      const auto& ts_type = checked_cast<const TimestampType&>(*data.type());
+      const auto& ts_type = checked_cast<const TimestampType&>(type);
       if (ts_type.timezone() != "") {
         *output_type = PandasBlock::DATETIME_WITH_TZ;
       } else {
@@ -1377,10 +1407,10 @@ static Status GetPandasBlockType(const ChunkedArray& data, const PandasOptions&
       }
     } break;
     case Type::LIST: {
-      auto list_type = std::static_pointer_cast<ListType>(data.type());
-      if (!ListTypeSupported(*list_type->value_type())) {
+      const auto& list_type = checked_cast<const ListType&>(type);
+      if (!ListTypeSupported(*list_type.value_type())) {
         return Status::NotImplemented("Not implemented type for list in DataFrameBlock: ",
-                                      list_type->value_type()->ToString());
+                                      list_type.value_type()->ToString());
       }
       *output_type = PandasBlock::OBJECT;
     } break;
@@ -1389,12 +1419,64 @@ static Status GetPandasBlockType(const ChunkedArray& data, const PandasOptions&
       break;
     default:
       return Status::NotImplemented(
-          "No known equivalent Pandas block for Arrow data of type ",
-          data.type()->ToString(), " is known.");
+          "No known equivalent Pandas block for Arrow data of type ", type.ToString(),
+          " is known.");
   }
   return Status::OK();
 }
 
+// The type of the values a PandasColumnSource writes directly into a block,
+// nullptr if it can't
+static std::shared_ptr<DataType> GetDirectWriteType(PandasBlock::type type) {
+  switch (type) {
+    case PandasBlock::UINT8:
+      return uint8();
+    case PandasBlock::INT8:
+      return int8();
+    case PandasBlock::UINT16:
+      return uint16();
+    case PandasBlock::INT16:
+      return int16();
+    case PandasBlock::UINT32:
+      return uint32();
+    case PandasBlock::INT32:
+      return int32();
+    case PandasBlock::UINT64:
+      return uint64();
+    case PandasBlock::INT64:
+      return int64();
+    case PandasBlock::FLOAT:
+      return float32();
+    case PandasBlock::DOUBLE:
+      return float64();
+    case PandasBlock::DATETIME:  // fall through
+    case PandasBlock::DATETIME_WITH_TZ:
+      return timestamp(TimeUnit::NANO);
+    default:
+      return nullptr;
+  }
+}
+
+// The columns of a table in memory
+class TableColumnSource : public PandasColumnSource {
+ public:
+  explicit TableColumnSource(const std::shared_ptr<Table>& table) : table_(table) {}
+
+  std::shared_ptr<Schema> schema() const override { return table_->schema(); }
+
+  int64_t num_rows() const override { return table_->num_rows(); }
+
+  int64_t null_count(int i) override { return table_->column(i)->null_count(); }
+
+  Status ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) override {
+    *out = table_->column(i);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Table> table_;
+};
+
 // Construct the exact pandas 0.x "BlockManager" memory layout
 //
 // * For each column determine the correct output pandas type
@@ -1402,39 +1484,62 @@ static Status GetPandasBlockType(const ChunkedArray& data, const PandasOptions&
 // * Allocate  block placement arrays
 // * Write Arrow columns out into each slice of memory; populate block
 // * placement arrays as we go
+//
+// Columns are read from the source as they are written, and released once
+// written, unless the source already holds them in memory.
 class DataFrameBlockCreator {
  public:
-  explicit DataFrameBlockCreator(const PandasOptions& options,
-                                 const std::shared_ptr<Table>& table, MemoryPool* pool)
-      : table_(table), options_(options), pool_(pool) {}
+  DataFrameBlockCreator(const PandasOptions& options,
+                        const std::unordered_set<std::string>& categorical_columns,
+                        PandasColumnSource* source, bool columns_in_memory,
+                        MemoryPool* pool)
+      : source_(source),
+        columns_in_memory_(columns_in_memory),
+        categorical_columns_(categorical_columns),
+        options_(options),
+        pool_(pool) {}
 
   Status Convert(PyObject** output) {
-    column_types_.resize(table_->num_columns());
-    column_block_placement_.resize(table_->num_columns());
+    schema_ = source_->schema();
+    num_rows_ = source_->num_rows();
+    column_types_.resize(schema_->num_fields());
+    column_block_placement_.resize(schema_->num_fields());
+    columns_.assign(schema_->num_fields(), nullptr);
     type_counts_.clear();
     blocks_.clear();
 
     RETURN_NOT_OK(CreateBlocks());
-    RETURN_NOT_OK(WriteTableToBlocks());
+    RETURN_NOT_OK(WriteColumnsToBlocks());
 
     return GetResultList(output);
   }
 
   Status CreateBlocks() {
-    for (int i = 0; i < table_->num_columns(); ++i) {
-      std::shared_ptr<ChunkedArray> col = table_->column(i);
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const std::shared_ptr<Field>& field = schema_->field(i);
       PandasBlock::type output_type = PandasBlock::OBJECT;
-      RETURN_NOT_OK(GetPandasBlockType(*col, options_, &output_type));
+      if (categorical_columns_.count(field->name())) {
+        output_type = PandasBlock::CATEGORICAL;
+      } else {
+        int64_t null_count = source_->null_count(i);
+        const Type::type type_id = field->type()->id();
+        if (null_count < 0 && (is_integer(type_id) || type_id == Type::BOOL)) {
+          RETURN_NOT_OK(ReadColumn(i, &columns_[i]));
+          null_count = columns_[i]->null_count();
+        }
+        RETURN_NOT_OK(
+            GetPandasBlockType(*field->type(), null_count, options_, &output_type));
+      }
 
       int block_placement = 0;
       std::shared_ptr<PandasBlock> block;
       if (output_type == PandasBlock::CATEGORICAL) {
-        block = std::make_shared<CategoricalBlock>(options_, pool_, table_->num_rows());
+        block = std::make_shared<CategoricalBlock>(options_, pool_, num_rows_);
         categorical_blocks_[i] = block;
       } else if (output_type == PandasBlock::DATETIME_WITH_TZ) {
-        const auto& ts_type = checked_cast<const TimestampType&>(*col->type());
-        block = std::make_shared<DatetimeTZBlock>(options_, ts_type.timezone(),
-                                                  table_->num_rows());
+        const auto& ts_type = checked_cast<const TimestampType&>(*field->type());
+        block =
+            std::make_shared<DatetimeTZBlock>(options_, ts_type.timezone(), num_rows_);
         RETURN_NOT_OK(block->Allocate());
         datetimetz_blocks_[i] = block;
       } else {
@@ -1456,8 +1561,7 @@ class DataFrameBlockCreator {
     for (const auto& it : this->type_counts_) {
       PandasBlock::type type = static_cast<PandasBlock::type>(it.first);
       std::shared_ptr<PandasBlock> block;
-      RETURN_NOT_OK(
-          MakeBlock(this->options_, type, this->table_->num_rows(), it.second, &block));
+      RETURN_NOT_OK(MakeBlock(this->options_, type, num_rows_, it.second, &block));
       this->blocks_[type] = block;
     }
     return Status::OK();
@@ -1488,21 +1592,103 @@ class DataFrameBlockCreator {
     return Status::OK();
   }
 
-  Status WriteTableToBlocks() {
-    auto WriteColumn = [this](int i) {
-      std::shared_ptr<PandasBlock> block;
-      RETURN_NOT_OK(this->GetBlock(i, &block));
-      return block->Write(this->table_->column(i), i, this->column_block_placement_[i]);
-    };
+  // Read column i, dictionary encoding it if it's to be categorical
+  Status ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) {
+    std::shared_ptr<ChunkedArray> col;
+    RETURN_NOT_OK(source_->ReadColumn(i, &col));
+    if (!categorical_columns_.count(schema_->field(i)->name())) {
+      *out = std::move(col);
+      return Status::OK();
+    }
+    FunctionContext ctx(pool_);
+    Datum encoded;
+    RETURN_NOT_OK(DictionaryEncode(&ctx, Datum(col), &encoded));
+    *out = encoded.chunked_array();
+    return Status::OK();
+  }
 
-    if (options_.use_threads) {
-      return ParallelFor(table_->num_columns(), WriteColumn);
-    } else {
-      for (int i = 0; i < table_->num_columns(); ++i) {
+  // Take column i if it was read to create the blocks, read it otherwise
+  Status TakeColumn(int i, std::shared_ptr<ChunkedArray>* out) {
+    if (columns_[i] != nullptr) {
+      *out = std::move(columns_[i]);
+      columns_[i] = nullptr;
+      return Status::OK();
+    }
+    return ReadColumn(i, out);
+  }
+
+  Status WriteColumn(int i) {
+    std::shared_ptr<PandasBlock> block;
+    RETURN_NOT_OK(GetBlock(i, &block));
+
+    // Let the source decode the values into the block if it can
+    std::shared_ptr<DataType> direct_type = GetDirectWriteType(column_types_[i]);
+    auto range_block = dynamic_cast<RowRangeBlock*>(block.get());
+    if (columns_[i] == nullptr && direct_type != nullptr && range_block != nullptr) {
+      bool done = false;
+      RETURN_NOT_OK(source_->ReadColumnInto(
+          i, *direct_type, range_block->column_data(column_block_placement_[i]), &done));
+      if (done) {
+        range_block->SetPlacement(i, column_block_placement_[i]);
+        return Status::OK();
+      }
+    }
+
+    std::shared_ptr<ChunkedArray> col;
+    RETURN_NOT_OK(TakeColumn(i, &col));
+    return block->Write(col, i, column_block_placement_[i]);
+  }
+
+  Status WriteColumnsToBlocks() {
+    const int num_columns = schema_->num_fields();
+    if (!options_.use_threads) {
+      for (int i = 0; i < num_columns; ++i) {
         RETURN_NOT_OK(WriteColumn(i));
       }
       return Status::OK();
     }
+
+    if (!columns_in_memory_) {
+      // One task per column, so that each column is released once written
+      return ParallelFor(num_columns, [this](int i) { return this->WriteColumn(i); });
+    }
+
+    // Columns written without the GIL are split into row ranges, so that a
+    // table with few long columns is still converted on several threads
+    struct WriteTask {
+      int column;
+      RowRangeBlock* block;
+      int64_t row_offset;
+    };
+    std::vector<WriteTask> tasks;
+    for (int i = 0; i < num_columns; ++i) {
+      std::shared_ptr<PandasBlock> block;
+      RETURN_NOT_OK(this->GetBlock(i, &block));
+      auto range_block = dynamic_cast<RowRangeBlock*>(block.get());
+      if (range_block == nullptr) {
+        tasks.push_back({i, nullptr, 0});
+        continue;
+      }
+      if (columns_[i] == nullptr) {
+        RETURN_NOT_OK(ReadColumn(i, &columns_[i]));
+      }
+      range_block->SetPlacement(i, this->column_block_placement_[i]);
+      for (int64_t offset = 0; offset < num_rows_; offset += kRowRangeLength) {
+        tasks.push_back({i, range_block, offset});
+      }
+    }
+
+    RETURN_NOT_OK(ParallelFor(static_cast<int>(tasks.size()), [&](int t) {
+      const WriteTask& task = tasks[t];
+      if (task.block == nullptr) {
+        return WriteColumn(task.column);
+      }
+      auto rows = this->columns_[task.column]->Slice(task.row_offset, kRowRangeLength);
+      return task.block->WriteRows(*rows, this->column_block_placement_[task.column],
+                                   task.row_offset);
+    }));
+    columns_.clear();
+    return Status::OK();
   }
 
   Status AppendBlocks(const BlockMap& blocks, PyObject* list) {
@@ -1534,7 +1720,15 @@ class DataFrameBlockCreator {
   }
 
  private:
-  std::shared_ptr<Table> table_;
+  PandasColumnSource* source_;
+  bool columns_in_memory_;
+  const std::unordered_set<std::string>& categorical_columns_;
+
+  std::shared_ptr<Schema> schema_;
+  int64_t num_rows_;
+
+  // column num -> column read before being written, or nullptr
+  std::vector<std::shared_ptr<ChunkedArray>> columns_;
 
   // column num -> block type id
   std::vector<PandasBlock::type> column_types_;
@@ -1945,23 +2139,24 @@ Status ConvertTableToPandas(const PandasOptions& options,
                             const std::unordered_set<std::string>& categorical_columns,
                             const std::shared_ptr<Table>& table, MemoryPool* pool,
                             PyObject** out) {
-  std::shared_ptr<Table> current_table = table;
-  if (!categorical_columns.empty()) {
-    FunctionContext ctx;
-    for (int i = 0; i < table->num_columns(); i++) {
-      std::shared_ptr<ChunkedArray> col = table->column(i);
-      if (categorical_columns.count(table->field(i)->name())) {
-        Datum out;
-        RETURN_NOT_OK(DictionaryEncode(&ctx, Datum(col), &out));
-        std::shared_ptr<ChunkedArray> array = out.chunked_array();
-        auto field = table->field(i)->WithType(array->type());
-        RETURN_NOT_OK(current_table->RemoveColumn(i, &current_table));
-        RETURN_NOT_OK(current_table->AddColumn(i, field, array, &current_table));
-      }
-    }
-  }
+  TableColumnSource source(table);
+  DataFrameBlockCreator helper(options, categorical_columns, &source,
+                               /*columns_in_memory=*/true, pool);
+  return helper.Convert(out);
+}
+
+Status PandasColumnSource::ReadColumnInto(int i, const DataType& out_type, uint8_t* out,
+                                          bool* done) {
+  *done = false;
+  return Status::OK();
+}
 
-  DataFrameBlockCreator helper(options, current_table, pool);
+Status ConvertColumnsToPandas(const PandasOptions& options,
+                              const std::unordered_set<std::string>& categorical_columns,
+                              PandasColumnSource* source, MemoryPool* pool,
+                              PyObject** out) {
+  DataFrameBlockCreator helper(options, categorical_columns, source,
+                               /*columns_in_memory=*/false, pool);
   return helper.Convert(out);
 }
 
@@ -23,6 +23,7 @@
 
 #include "arrow/python/platform.h"
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -36,6 +37,7 @@ class ChunkedArray;
 class Column;
 class DataType;
 class MemoryPool;
+class Schema;
 class Status;
 class Table;
 
@@ -47,6 +49,8 @@ struct PandasOptions {
   bool zero_copy_only = false;
   bool integer_object_nulls = false;
   bool date_as_object = false;
+  /// If true, convert columns on the CPU thread pool.  Long numeric, boolean
+  /// and datetime columns are also split into row ranges converted in parallel
   bool use_threads = false;
 
   /// \brief If true, do not create duplicate PyObject versions of equal
@@ -91,6 +95,48 @@ Status ConvertTableToPandas(const PandasOptions& options,
                             const std::shared_ptr<Table>& table, MemoryPool* pool,
                             PyObject** out);
 
+/// \brief The columns of a table converted with ConvertColumnsToPandas, which
+/// are only read when they are converted.
+///
+/// With PandasOptions::use_threads, distinct columns may be read concurrently.
+class ARROW_PYTHON_EXPORT PandasColumnSource {
+ public:
+  virtual ~PandasColumnSource() = default;
+
+  virtual std::shared_ptr<Schema> schema() const = 0;
+  virtual int64_t num_rows() const = 0;
+
+  /// \brief The number of nulls of column i, or -1 if it's only known once
+  /// the column is read. Integer and boolean columns, whose pandas type
+  /// depends on it, are then read before the other columns are converted.
+  virtual int64_t null_count(int i) = 0;
+
+  /// \brief Read column i, which is released once it's converted
+  virtual Status ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) = 0;
+
+  /// \brief Write the values of column i directly into the memory of a
+  /// pandas block, instead of reading it with ReadColumn.
+  ///
+  /// out holds num_rows() values of out_type, which is the type of the
+  /// column for integer blocks, float32, float64 or timestamp[ns]. Integer
+  /// types are only requested for columns without nulls. Nulls are written
+  /// as NaN for floating point types and as NaT (INT64_MIN) for timestamps.
+  /// The default implementation leaves done false.
+  virtual Status ReadColumnInto(int i, const DataType& out_type, uint8_t* out,
+                                bool* done);
+};
+
+/// \brief Convert the columns of source to a pandas.DataFrame, as
+/// ConvertTableToPandas does for a table.
+///
+/// Only the columns being converted are held in memory, in addition to the
+/// blocks of the DataFrame, instead of the whole table.
+ARROW_PYTHON_EXPORT
+Status ConvertColumnsToPandas(const PandasOptions& options,
+                              const std::unordered_set<std::string>& categorical_columns,
+                              PandasColumnSource* source, MemoryPool* pool,
+                              PyObject** out);
+
 }  // namespace py
 }  // namespace arrow
 
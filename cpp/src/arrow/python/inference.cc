@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <limits>
 #include <map>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -308,7 +309,9 @@ class TypeInferrer {
         numpy_dtype_count_(0),
         max_decimal_metadata_(std::numeric_limits<int32_t>::min(),
                               std::numeric_limits<int32_t>::min()),
-        decimal_type_() {
+        decimal_type_(),
+        cached_type_(nullptr),
+        cached_kind_(CachedKind::INT) {
     ARROW_CHECK_OK(internal::ImportDecimalType(&decimal_type_));
   }
 
@@ -319,7 +322,10 @@ class TypeInferrer {
   Status Visit(PyObject* obj, bool* keep_going) {
     ++total_count_;
 
-    if (obj == Py_None || (pandas_null_sentinels_ && internal::PyFloat_IsNaN(obj))) {
+    if (Py_TYPE(obj) == cached_type_) {
+      RETURN_NOT_OK(VisitCachedType(obj, keep_going));
+    } else if (obj == Py_None ||
+               (pandas_null_sentinels_ && internal::PyFloat_IsNaN(obj))) {
       ++none_count_;
     } else if (PyBool_Check(obj)) {
       ++bool_count_;
@@ -329,6 +335,7 @@ class TypeInferrer {
       *keep_going = make_unions_;
     } else if (internal::IsPyInteger(obj)) {
       ++int_count_;
+      CacheType(obj, CachedKind::INT);
     } else if (PyDateTime_Check(obj)) {
       ++timestamp_micro_count_;
       *keep_going = make_unions_;
@@ -346,15 +353,20 @@ class TypeInferrer {
       *keep_going = make_unions_;
     } else if (PyArray_CheckAnyScalarExact(obj)) {
       RETURN_NOT_OK(VisitDType(PyArray_DescrFromScalar(obj), keep_going));
+      CacheType(obj, CachedKind::NUMPY_SCALAR);
     } else if (PyList_Check(obj)) {
       RETURN_NOT_OK(VisitList(obj, keep_going));
+      CacheType(obj, CachedKind::LIST);
     } else if (PyArray_Check(obj)) {
       RETURN_NOT_OK(VisitNdarray(obj, keep_going));
+      CacheType(obj, CachedKind::NDARRAY);
     } else if (PyDict_Check(obj)) {
       RETURN_NOT_OK(VisitDict(obj));
+      CacheType(obj, CachedKind::DICT);
     } else if (PyObject_IsInstance(obj, decimal_type_.obj())) {
       RETURN_NOT_OK(max_decimal_metadata_.Update(obj));
       ++decimal_count_;
+      CacheType(obj, CachedKind::DECIMAL);
     } else {
       return internal::InvalidValue(obj,
                                     "did not recognize Python value type when inferring "
@@ -368,6 +380,59 @@ class TypeInferrer {
     return Status::OK();
   }
 
+  // Infer value type from a sample of a sequence of values: the first head_size
+  // values and random_size values drawn at random from the rest
+  Status VisitSequenceSample(PyObject* obj, PyObject* mask, int64_t head_size,
+                             int64_t random_size) {
+    // A fixed seed, so that the inferred type is deterministic
+    static constexpr uint64_t kSampleSeed = 0x5EED;
+
+    const int64_t size = static_cast<int64_t>(PySequence_Size(obj));
+    RETURN_IF_PYERROR();
+    std::vector<int64_t> sample;
+    if (random_size > 0 && size > head_size) {
+      std::mt19937_64 gen(kSampleSeed);
+      std::uniform_int_distribution<int64_t> index_dist(head_size, size - 1);
+      for (int64_t i = 0; i < random_size; ++i) {
+        sample.push_back(index_dist(gen));
+      }
+      std::sort(sample.begin(), sample.end());
+      sample.erase(std::unique(sample.begin(), sample.end()), sample.end());
+    }
+
+    int64_t index = -1;
+    auto next_sampled = sample.begin();
+    // Skip the values which weren't sampled and stop after the last one
+    auto is_sampled = [&](bool* keep_going) -> bool {
+      if (++index < head_size) {
+        return true;
+      }
+      if (next_sampled == sample.end()) {
+        *keep_going = false;
+        return false;
+      }
+      if (*next_sampled != index) {
+        return false;
+      }
+      ++next_sampled;
+      return true;
+    };
+    if (mask == nullptr || mask == Py_None) {
+      return internal::VisitSequence(obj, [&](PyObject* value, bool* keep_going) {
+        return is_sampled(keep_going) ? Visit(value, keep_going) : Status::OK();
+      });
+    } else {
+      return internal::VisitSequenceMasked(
+          obj, mask, [&](PyObject* value, uint8_t masked, bool* keep_going) {
+            if (is_sampled(keep_going) && !masked) {
+              return Visit(value, keep_going);
+            } else {
+              return Status::OK();
+            }
+          });
+    }
+  }
+
   // Infer value type from a sequence of values
   Status VisitSequence(PyObject* obj, PyObject* mask = nullptr) {
     if (mask == nullptr || mask == Py_None) {
@@ -492,6 +557,39 @@ class TypeInferrer {
     return Status::OK();
   }
 
+  // The kinds of values which don't end the inference early, so that sequences of
+  // them are visited entirely
+  enum class CachedKind { INT, NUMPY_SCALAR, LIST, NDARRAY, DICT, DECIMAL };
+
+  // Remember the kind of the first such value, so that the following values of the
+  // same exact type skip the chain of type checks in Visit()
+  void CacheType(PyObject* obj, CachedKind kind) {
+    if (cached_type_ == nullptr) {
+      cached_type_ = Py_TYPE(obj);
+      cached_kind_ = kind;
+    }
+  }
+
+  Status VisitCachedType(PyObject* obj, bool* keep_going) {
+    switch (cached_kind_) {
+      case CachedKind::INT:
+        ++int_count_;
+        return Status::OK();
+      case CachedKind::NUMPY_SCALAR:
+        return VisitDType(PyArray_DescrFromScalar(obj), keep_going);
+      case CachedKind::LIST:
+        return VisitList(obj, keep_going);
+      case CachedKind::NDARRAY:
+        return VisitNdarray(obj, keep_going);
+      case CachedKind::DICT:
+        return VisitDict(obj);
+      case CachedKind::DECIMAL:
+        ++decimal_count_;
+        return max_decimal_metadata_.Update(obj);
+    }
+    return Status::OK();
+  }
+
   Status VisitDType(PyArray_Descr* dtype, bool* keep_going) {
     // Continue visiting dtypes for now.
     // TODO(wesm): devise approach for unions
@@ -612,6 +710,9 @@ class TypeInferrer {
   // Place to accumulate errors
   // std::vector<Status> errors_;
   OwnedRefNoGIL decimal_type_;
+
+  PyTypeObject* cached_type_;
+  CachedKind cached_kind_;
 };
 
 // Non-exhaustive type inference
@@ -628,6 +729,20 @@ Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
   return Status::OK();
 }
 
+Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
+                      int64_t head_size, int64_t random_size,
+                      std::shared_ptr<DataType>* out_type) {
+  PyDateTime_IMPORT;
+  TypeInferrer inferrer(pandas_null_sentinels);
+  RETURN_NOT_OK(inferrer.VisitSequenceSample(obj, mask, head_size, random_size));
+  RETURN_NOT_OK(inferrer.GetType(out_type));
+  if (*out_type == nullptr) {
+    return Status::TypeError("Unable to determine data type");
+  }
+
+  return Status::OK();
+}
+
 Status InferArrowTypeAndSize(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
                              int64_t* size, std::shared_ptr<DataType>* out_type) {
   if (!PySequence_Check(obj)) {
@@ -50,6 +50,23 @@ ARROW_PYTHON_EXPORT
 arrow::Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
                              std::shared_ptr<arrow::DataType>* out_type);
 
+/// \brief Infer Arrow type from a sample of a Python sequence
+///
+/// The type may not fit the values which are not in the sample.
+/// \param[in] obj the sequence of values
+/// \param[in] mask an optional mask where True values are null. May
+/// be nullptr
+/// \param[in] pandas_null_sentinels use pandas's null value markers
+/// \param[in] head_size the number of values sampled from the start of the
+/// sequence
+/// \param[in] random_size the number of values sampled at random from the rest
+/// of the sequence
+/// \param[out] out_type the inferred type
+ARROW_PYTHON_EXPORT
+arrow::Status InferArrowType(PyObject* obj, PyObject* mask, bool pandas_null_sentinels,
+                             int64_t head_size, int64_t random_size,
+                             std::shared_ptr<arrow::DataType>* out_type);
+
 ARROW_PYTHON_EXPORT
 arrow::Status InferArrowTypeAndSize(PyObject* obj, PyObject* mask,
                                     bool pandas_null_sentinels, int64_t* size,
@@ -21,6 +21,7 @@
 #include "arrow/python/numpy_interop.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -39,7 +40,9 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
@@ -83,6 +86,34 @@ Status AllocateNullBitmap(MemoryPool* pool, int64_t length,
   return Status::OK();
 }
 
+// Loops over arrays at least this long are split across the CPU thread pool
+constexpr int64_t kParallelConversionLength = 1 << 20;
+
+// Call func(start, length) on ranges covering [0, length), and return the sum of
+// the results.
+//
+// Long arrays are split into ranges converted on the CPU thread pool.  Range
+// starts are multiples of 8, so that each range writes its own bitmap bytes.
+// The conversion loops only access NumPy data, and don't need the GIL.
+template <typename Function>
+int64_t ConvertRanges(int64_t length, Function&& func) {
+  const int num_tasks = static_cast<int>(
+      std::min<int64_t>(GetCpuThreadPoolCapacity(), length / kParallelConversionLength));
+  if (num_tasks <= 1) {
+    return func(0, length);
+  }
+
+  const int64_t range_length =
+      BitUtil::RoundUpToMultipleOf8(BitUtil::CeilDiv(length, num_tasks));
+  std::atomic<int64_t> total(0);
+  ARROW_CHECK_OK(::arrow::internal::ParallelFor(num_tasks, [&](int i) {
+    const int64_t start = std::min(length, i * range_length);
+    total += func(start, std::min(range_length, length - start));
+    return Status::OK();
+  }));
+  return total;
+}
+
 // ----------------------------------------------------------------------
 // Conversion from NumPy-in-Pandas to Arrow null bitmap
 
@@ -91,18 +122,18 @@ inline int64_t ValuesToBitmap(PyArrayObject* arr, uint8_t* bitmap) {
   typedef internal::npy_traits<TYPE> traits;
   typedef typename traits::value_type T;
 
-  int64_t null_count = 0;
-
   Ndarray1DIndexer<T> values(arr);
-  for (int i = 0; i < values.size(); ++i) {
-    if (traits::isnull(values[i])) {
-      ++null_count;
-    } else {
-      BitUtil::SetBit(bitmap, i);
+  return ConvertRanges(values.size(), [&](int64_t start, int64_t length) {
+    int64_t null_count = 0;
+    for (int64_t i = start; i < start + length; ++i) {
+      if (traits::isnull(values[i])) {
+        ++null_count;
+      } else {
+        BitUtil::SetBit(bitmap, i);
+      }
     }
-  }
-
-  return null_count;
+    return null_count;
+  });
 }
 
 class NumPyNullsConverter {
@@ -154,18 +185,19 @@ class NumPyNullsConverter {
 
 // Returns null count
 int64_t MaskToBitmap(PyArrayObject* mask, int64_t length, uint8_t* bitmap) {
-  int64_t null_count = 0;
-
   Ndarray1DIndexer<uint8_t> mask_values(mask);
-  for (int i = 0; i < length; ++i) {
-    if (mask_values[i]) {
-      ++null_count;
-      BitUtil::ClearBit(bitmap, i);
-    } else {
-      BitUtil::SetBit(bitmap, i);
+  return ConvertRanges(length, [&](int64_t start, int64_t range_length) {
+    int64_t null_count = 0;
+    for (int64_t i = start; i < start + range_length; ++i) {
+      if (mask_values[i]) {
+        ++null_count;
+        BitUtil::ClearBit(bitmap, i);
+      } else {
+        BitUtil::SetBit(bitmap, i);
+      }
     }
-  }
-  return null_count;
+    return null_count;
+  });
 }
 
 }  // namespace
@@ -407,14 +439,19 @@ class NumPyStridedConverter {
     RETURN_NOT_OK(AllocateBuffer(pool_, sizeof(T) * length_, &buffer_));
 
     const int64_t stride = PyArray_STRIDES(arr)[0];
-    if (stride % sizeof(T) == 0) {
-      const int64_t stride_elements = stride / sizeof(T);
-      CopyStridedNatural(reinterpret_cast<T*>(PyArray_DATA(arr)), length_,
-                         stride_elements, reinterpret_cast<T*>(buffer_->mutable_data()));
-    } else {
-      CopyStridedBytewise(reinterpret_cast<int8_t*>(PyArray_DATA(arr)), length_, stride,
-                          reinterpret_cast<T*>(buffer_->mutable_data()));
-    }
+    auto input_data = reinterpret_cast<int8_t*>(PyArray_DATA(arr));
+    auto output_data = reinterpret_cast<T*>(buffer_->mutable_data());
+    ConvertRanges(length_, [&](int64_t start, int64_t length) {
+      if (stride % sizeof(T) == 0) {
+        const int64_t stride_elements = stride / sizeof(T);
+        CopyStridedNatural(reinterpret_cast<T*>(input_data + start * stride), length,
+                           stride_elements, output_data + start);
+      } else {
+        CopyStridedBytewise(input_data + start * stride, length, stride,
+                            output_data + start);
+      }
+      return int64_t(0);
+    });
     return Status::OK();
   }
 
@@ -442,9 +479,13 @@ inline Status NumPyConverter::PrepareInputData(std::shared_ptr<Buffer>* data) {
     RETURN_NOT_OK(AllocateBuffer(pool_, nbytes, &buffer));
 
     Ndarray1DIndexer<uint8_t> values(arr_);
-    int64_t i = 0;
-    const auto generate = [&values, &i]() -> bool { return values[i++] > 0; };
-    GenerateBitsUnrolled(buffer->mutable_data(), 0, length_, generate);
+    uint8_t* bitmap = buffer->mutable_data();
+    ConvertRanges(length_, [&](int64_t start, int64_t length) {
+      int64_t i = start;
+      const auto generate = [&values, &i]() -> bool { return values[i++] > 0; };
+      GenerateBitsUnrolled(bitmap, start, length, generate);
+      return int64_t(0);
+    });
 
     *data = buffer;
   } else if (is_strided()) {
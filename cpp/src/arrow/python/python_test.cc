@@ -32,6 +32,7 @@
 #include "arrow/python/arrow_to_pandas.h"
 #include "arrow/python/decimal.h"
 #include "arrow/python/helpers.h"
+#include "arrow/python/inference.h"
 #include "arrow/python/python_to_arrow.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -337,6 +338,38 @@ TEST(BuiltinConversionTest, TestMixedTypeFails) {
   ASSERT_RAISES(TypeError, ConvertPySequence(list, {}, &arr));
 }
 
+TEST(BuiltinConversionTest, TestSampledInference) {
+  const Py_ssize_t size = 1000;
+  OwnedRef list_ref(PyList_New(size));
+  PyObject* list = list_ref.obj();
+  ASSERT_NE(list, nullptr);
+
+  // Nulls first, then integers
+  for (Py_ssize_t i = 0; i < size; ++i) {
+    PyObject* item = i < 10 ? Py_None : PyLong_FromSsize_t(i);
+    if (item == Py_None) {
+      Py_INCREF(item);
+    }
+    ASSERT_NE(item, nullptr);
+    ASSERT_EQ(PyList_SetItem(list, i, item), 0);
+  }
+
+  std::shared_ptr<DataType> type;
+  ASSERT_OK(InferArrowType(list, nullptr, false, 10, 0, &type));
+  AssertTypeEqual(*null(), *type);
+  ASSERT_OK(InferArrowType(list, nullptr, false, 10, 5, &type));
+  AssertTypeEqual(*int64(), *type);
+
+  // The integers don't fit the type of the sample, which is inferred again
+  PyConversionOptions options;
+  options.infer_head_size = 10;
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_OK(ConvertPySequence(list, options, &arr));
+  AssertTypeEqual(*int64(), *arr->type());
+  ASSERT_EQ(arr->length(), size);
+  ASSERT_EQ(arr->null_count(), 10);
+}
+
 TEST_F(DecimalTest, FromPythonDecimalRescaleNotTruncateable) {
   // We fail when truncating values that would lose data if cast to a decimal type with
   // lower scale
@@ -1028,6 +1028,39 @@ Status ConvertToSequenceAndInferSize(PyObject* obj, PyObject** seq, int64_t* siz
   return Status::OK();
 }
 
+// Convert the first size values of the sequence seq to real_type
+Status ConvertSequence(PyObject* seq, PyObject* mask, int64_t size,
+                       const std::shared_ptr<DataType>& real_type,
+                       const PyConversionOptions& options, bool strict_conversions,
+                       std::shared_ptr<ChunkedArray>* out) {
+  // Create the sequence converter, initialize with the builder
+  std::unique_ptr<SeqConverter> converter;
+  RETURN_NOT_OK(
+      GetConverter(real_type, options.from_pandas, strict_conversions, &converter));
+
+  // Create ArrayBuilder for type, then pass into the SeqConverter
+  // instance. The reason this is created here rather than in GetConverter is
+  // because of nested types (child SeqConverter objects need the child
+  // builders created by MakeBuilder)
+  std::unique_ptr<ArrayBuilder> type_builder;
+  RETURN_NOT_OK(MakeBuilder(options.pool, real_type, &type_builder));
+  RETURN_NOT_OK(converter->Init(type_builder.get()));
+
+  // Convert values
+  if (mask != nullptr && mask != Py_None) {
+    RETURN_NOT_OK(converter->AppendMultipleMasked(seq, mask, size));
+  } else {
+    RETURN_NOT_OK(converter->AppendMultiple(seq, size));
+  }
+
+  // Retrieve result. Conversion may yield one or more array values
+  std::vector<std::shared_ptr<Array>> chunks;
+  RETURN_NOT_OK(converter->GetResult(&chunks));
+
+  *out = std::make_shared<ChunkedArray>(chunks);
+  return Status::OK();
+}
+
 Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
                          const PyConversionOptions& options,
                          std::shared_ptr<ChunkedArray>* out) {
@@ -1048,41 +1081,35 @@ Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
   // passed pa.string(), then we will error if we encounter any non-UTF8
   // value. If not, then we will allow the result to be a BinaryArray
   bool strict_conversions = false;
+  bool sampled_type = false;
 
   if (options.type == nullptr) {
-    RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas, &real_type));
+    if (options.infer_head_size >= 0) {
+      RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas,
+                                   options.infer_head_size, options.infer_random_size,
+                                   &real_type));
+      sampled_type = true;
+    } else {
+      RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas, &real_type));
+    }
   } else {
     real_type = options.type;
     strict_conversions = true;
   }
   DCHECK_GE(size, 0);
 
-  // Create the sequence converter, initialize with the builder
-  std::unique_ptr<SeqConverter> converter;
-  RETURN_NOT_OK(
-      GetConverter(real_type, options.from_pandas, strict_conversions, &converter));
-
-  // Create ArrayBuilder for type, then pass into the SeqConverter
-  // instance. The reason this is created here rather than in GetConverter is
-  // because of nested types (child SeqConverter objects need the child
-  // builders created by MakeBuilder)
-  std::unique_ptr<ArrayBuilder> type_builder;
-  RETURN_NOT_OK(MakeBuilder(options.pool, real_type, &type_builder));
-  RETURN_NOT_OK(converter->Init(type_builder.get()));
-
-  // Convert values
-  if (mask != nullptr && mask != Py_None) {
-    RETURN_NOT_OK(converter->AppendMultipleMasked(seq, mask, size));
-  } else {
-    RETURN_NOT_OK(converter->AppendMultiple(seq, size));
+  Status st =
+      ConvertSequence(seq, mask, size, real_type, options, strict_conversions, out);
+  if (ARROW_PREDICT_FALSE(!st.ok()) && sampled_type) {
+    // Some values not in the sample don't fit its type: infer from all of them
+    std::shared_ptr<DataType> full_type;
+    RETURN_NOT_OK(InferArrowType(seq, mask, options.from_pandas, &full_type));
+    if (!full_type->Equals(*real_type)) {
+      return ConvertSequence(seq, mask, size, full_type, options, strict_conversions,
+                             out);
+    }
   }
-
-  // Retrieve result. Conversion may yield one or more array values
-  std::vector<std::shared_ptr<Array>> chunks;
-  RETURN_NOT_OK(converter->GetResult(&chunks));
-
-  *out = std::make_shared<ChunkedArray>(chunks);
-  return Status::OK();
+  return st;
 }
 
 Status ConvertPySequence(PyObject* obj, const PyConversionOptions& options,
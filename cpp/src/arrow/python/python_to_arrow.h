@@ -40,11 +40,22 @@ class Status;
 namespace py {
 
 struct PyConversionOptions {
-  PyConversionOptions() : type(NULLPTR), size(-1), pool(NULLPTR), from_pandas(false) {}
+  PyConversionOptions()
+      : type(NULLPTR),
+        size(-1),
+        pool(NULLPTR),
+        from_pandas(false),
+        infer_head_size(-1),
+        infer_random_size(0) {}
 
   PyConversionOptions(const std::shared_ptr<DataType>& type, int64_t size,
                       MemoryPool* pool, bool from_pandas)
-      : type(type), size(size), pool(default_memory_pool()), from_pandas(from_pandas) {}
+      : type(type),
+        size(size),
+        pool(default_memory_pool()),
+        from_pandas(from_pandas),
+        infer_head_size(-1),
+        infer_random_size(0) {}
 
   // Set to null if to be inferred
   std::shared_ptr<DataType> type;
@@ -57,6 +68,19 @@ struct PyConversionOptions {
 
   // Default false
   bool from_pandas;
+
+  // If non-negative and the type is to be inferred, infer it from a sample of
+  // the first infer_head_size values and infer_random_size values drawn at
+  // random from the rest.  If any value can't be converted to the sampled type,
+  // the type is inferred from all of the values and the conversion started over.
+  // Values which can be converted are converted as if the type had been passed, e.g. a
+  // sample of ints gives an integer type which other numbers are truncated to.
+  //
+  // Default -1: infer from all of the values
+  int64_t infer_head_size;
+
+  // Default 0
+  int64_t infer_random_size;
 };
 
 /// \brief Convert sequence (list, generator, NumPy array with dtype object) of
@@ -248,6 +248,15 @@ Status RecordBatch::Validate() const {
   return Status::OK();
 }
 
+Status RecordBatch::ToTensor(bool row_major, MemoryPool* pool,
+                             std::shared_ptr<Tensor>* out) const {
+  std::vector<std::shared_ptr<Array>> columns(num_columns());
+  for (int i = 0; i < num_columns(); ++i) {
+    columns[i] = column(i);
+  }
+  return Table::Make(schema_, columns, num_rows_)->ToTensor(row_major, pool, out);
+}
+
 // ----------------------------------------------------------------------
 // Base record batch reader
 
@@ -153,6 +153,20 @@ class ARROW_EXPORT RecordBatch {
   /// \return Status
   virtual Status Validate() const;
 
+  /// \brief Convert the batch to a 2-dim tensor whose columns are the batch's
+  ///
+  /// All the columns must be of the same numeric type and have no nulls.  The
+  /// values are copied by several threads when there are many of them.  No
+  /// copy is made for a single column, nor for a column-major tensor whose
+  /// columns already lie one after the other in a common buffer.
+  ///
+  /// \param[in] row_major whether the tensor is row-major (C order) rather
+  /// than column-major (Fortran order)
+  /// \param[in] pool The pool for buffer allocations, if any
+  /// \param[out] out The tensor of shape {num_rows(), num_columns()}
+  /// \return Status
+  Status ToTensor(bool row_major, MemoryPool* pool, std::shared_ptr<Tensor>* out) const;
+
  protected:
   RecordBatch(const std::shared_ptr<Schema>& schema, int64_t num_rows);
 
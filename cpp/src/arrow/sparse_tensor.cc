@@ -17,30 +17,109 @@
 
 #include "arrow/sparse_tensor.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <vector>
 
 #include "arrow/compare.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
 namespace {
 
 // ----------------------------------------------------------------------
-// SparseTensorConverter
+// Parallel conversion helpers
+//
+// Dense tensors are converted in two passes: the non-zero values of ranges of
+// rows (or columns, for CSC) are counted, then each range is filled at the
+// position given by the prefix sum of the counts.  Large tensors have their
+// ranges processed in parallel.
+
+// Tensors of at least this many cells are converted in parallel
+constexpr int64_t kParallelConversionThreshold = 1 << 20;
+
+// The number of ranges to split a conversion over num_units rows or columns
+int NumConversionTasks(const Tensor& tensor, int64_t num_units) {
+  if (tensor.size() < kParallelConversionThreshold || num_units < 2) {
+    return 1;
+  }
+  const int64_t num_tasks = 4 * GetCpuThreadPoolCapacity();
+  return static_cast<int>(std::min(num_units, num_tasks));
+}
 
-template <typename TYPE, typename SparseIndexType>
-class SparseTensorConverter {
+// Call func(task, begin, end) for num_tasks consecutive ranges of [0, length)
+template <typename Function>
+Status ForEachRange(int num_tasks, int64_t length, Function&& func) {
+  auto range_begin = [&](int task) { return length * task / num_tasks; };
+  if (num_tasks == 1) {
+    func(0, 0, length);
+    return Status::OK();
+  }
+  return internal::ParallelFor(num_tasks, [&](int task) {
+    func(task, range_begin(task), range_begin(task + 1));
+    return Status::OK();
+  });
+}
+
+// The rows of a tensor are its cells of fixed leading coordinates, the last
+// coordinate varying.  A 0-dim tensor has a row of one cell.
+int64_t NumTensorRows(const Tensor& tensor) {
+  const auto& shape = tensor.shape();
+  return std::accumulate(shape.begin(), shape.end() - std::min<size_t>(1, shape.size()),
+                         static_cast<int64_t>(1), std::multiplies<int64_t>());
+}
+
+int64_t TensorRowLength(const Tensor& tensor) {
+  return tensor.ndim() == 0 ? 1 : tensor.shape().back();
+}
+
+int64_t TensorRowStride(const Tensor& tensor) {
+  return tensor.ndim() == 0 ? 0 : tensor.strides().back();
+}
+
+// Visit the rows of a tensor in row-major order, from a given row
+class TensorRowIterator {
  public:
-  explicit SparseTensorConverter(const NumericTensor<TYPE>&) {}
+  TensorRowIterator(const Tensor& tensor, int64_t row)
+      : shape_(tensor.shape()),
+        strides_(tensor.strides()),
+        coord_(std::max(tensor.ndim() - 1, 0), 0),
+        offset_(0) {
+    for (int d = static_cast<int>(coord_.size()) - 1; d >= 0; --d) {
+      coord_[d] = row % shape_[d];
+      row /= shape_[d];
+      offset_ += coord_[d] * strides_[d];
+    }
+  }
 
-  Status Convert() { return Status::Invalid("Unsupported sparse index"); }
-};
+  // The leading coordinates of the row
+  const std::vector<int64_t>& coord() const { return coord_; }
 
-// ----------------------------------------------------------------------
-// SparseTensorConverter for SparseCOOIndex
+  // The byte offset of the first cell of the row
+  int64_t offset() const { return offset_; }
+
+  void Next() {
+    for (int d = static_cast<int>(coord_.size()) - 1; d >= 0; --d) {
+      offset_ += strides_[d];
+      if (++coord_[d] < shape_[d]) {
+        return;
+      }
+      offset_ -= coord_[d] * strides_[d];
+      coord_[d] = 0;
+    }
+  }
+
+ private:
+  const std::vector<int64_t>& shape_;
+  const std::vector<int64_t>& strides_;
+  std::vector<int64_t> coord_;
+  int64_t offset_;
+};
 
 template <typename TYPE>
 struct SparseTensorConverterBase {
@@ -49,9 +128,97 @@ struct SparseTensorConverterBase {
 
   explicit SparseTensorConverterBase(const NumericTensorType& tensor) : tensor_(tensor) {}
 
+  value_type CellAt(int64_t offset) const {
+    return *reinterpret_cast<const value_type*>(tensor_.raw_data() + offset);
+  }
+
+  // Count the non-zero values of each of num_tasks ranges of rows
+  Status CountRanges(int num_tasks, std::vector<int64_t>* counts) const {
+    const int64_t row_length = TensorRowLength(tensor_);
+    const int64_t row_stride = TensorRowStride(tensor_);
+    counts->assign(num_tasks, 0);
+    return ForEachRange(
+        num_tasks, NumTensorRows(tensor_), [&](int task, int64_t begin, int64_t end) {
+          TensorRowIterator it(tensor_, begin);
+          int64_t count = 0;
+          for (int64_t r = begin; r < end; ++r, it.Next()) {
+            int64_t offset = it.offset();
+            for (int64_t k = 0; k < row_length; ++k, offset += row_stride) {
+              count += CellAt(offset) != 0;
+            }
+          }
+          (*counts)[task] = count;
+        });
+  }
+
+  // Write the values and the column-major coordinates of the non-zero values
+  // of the tensor, in row-major order
+  Status ExtractCoordinates(int64_t* nonzero_count, std::shared_ptr<Buffer>* coords_out,
+                            std::shared_ptr<Buffer>* values_out) const {
+    const int64_t ndim = tensor_.ndim();
+    const int num_tasks = NumConversionTasks(tensor_, NumTensorRows(tensor_));
+    std::vector<int64_t> offsets;
+    RETURN_NOT_OK(CountRanges(num_tasks, &offsets));
+    const int64_t nnz = std::accumulate(offsets.begin(), offsets.end(),
+                                        static_cast<int64_t>(0));
+    // Turn the counts into the starting positions of the ranges
+    int64_t position = 0;
+    for (auto& offset : offsets) {
+      const int64_t count = offset;
+      offset = position;
+      position += count;
+    }
+
+    RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * ndim * nnz, coords_out));
+    RETURN_NOT_OK(AllocateBuffer(sizeof(value_type) * nnz, values_out));
+    int64_t* coords = reinterpret_cast<int64_t*>((*coords_out)->mutable_data());
+    value_type* values = reinterpret_cast<value_type*>((*values_out)->mutable_data());
+
+    const int64_t row_length = TensorRowLength(tensor_);
+    const int64_t row_stride = TensorRowStride(tensor_);
+    RETURN_NOT_OK(ForEachRange(
+        num_tasks, NumTensorRows(tensor_), [&](int task, int64_t begin, int64_t end) {
+          TensorRowIterator it(tensor_, begin);
+          int64_t pos = offsets[task];
+          for (int64_t r = begin; r < end; ++r, it.Next()) {
+            int64_t offset = it.offset();
+            for (int64_t k = 0; k < row_length; ++k, offset += row_stride) {
+              const value_type x = CellAt(offset);
+              if (x == 0) {
+                continue;
+              }
+              values[pos] = x;
+              for (int64_t d = 0; d < ndim - 1; ++d) {
+                coords[d * nnz + pos] = it.coord()[d];
+              }
+              if (ndim > 0) {
+                coords[(ndim - 1) * nnz + pos] = k;
+              }
+              ++pos;
+            }
+          }
+        }));
+    *nonzero_count = nnz;
+    return Status::OK();
+  }
+
   const NumericTensorType& tensor_;
 };
 
+// ----------------------------------------------------------------------
+// SparseTensorConverter
+
+template <typename TYPE, typename SparseIndexType>
+class SparseTensorConverter {
+ public:
+  explicit SparseTensorConverter(const NumericTensor<TYPE>&) {}
+
+  Status Convert() { return Status::Invalid("Unsupported sparse index"); }
+};
+
+// ----------------------------------------------------------------------
+// SparseTensorConverter for SparseCOOIndex
+
 template <typename TYPE>
 class SparseTensorConverter<TYPE, SparseCOOIndex>
     : private SparseTensorConverterBase<TYPE> {
@@ -65,55 +232,8 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
   Status Convert() {
     const int64_t ndim = tensor_.ndim();
     int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
-
     std::shared_ptr<Buffer> indices_buffer;
-    RETURN_NOT_OK(
-        AllocateBuffer(sizeof(int64_t) * ndim * nonzero_count, &indices_buffer));
-    int64_t* indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
-
-    std::shared_ptr<Buffer> values_buffer;
-    RETURN_NOT_OK(AllocateBuffer(sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      const value_type* data = reinterpret_cast<const value_type*>(tensor_.raw_data());
-      const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
-      for (int64_t i = 0; i < count; ++i, ++data) {
-        if (*data != 0) {
-          *indices++ = i;
-          *values++ = *data;
-        }
-      }
-    } else {
-      const std::vector<int64_t>& shape = tensor_.shape();
-      std::vector<int64_t> coord(ndim, 0);
-
-      for (int64_t n = tensor_.size(); n > 0; n--) {
-        const value_type x = tensor_.Value(coord);
-        if (tensor_.Value(coord) != 0) {
-          *values++ = x;
-
-          int64_t* indp = indices;
-          for (int64_t i = 0; i < ndim; ++i) {
-            *indp = coord[i];
-            indp += nonzero_count;
-          }
-          indices++;
-        }
-
-        // increment index
-        ++coord[ndim - 1];
-        if (n > 1 && coord[ndim - 1] == shape[ndim - 1]) {
-          int64_t d = ndim - 1;
-          while (d > 0 && coord[d] == shape[d]) {
-            coord[d] = 0;
-            ++coord[d - 1];
-            --d;
-          }
-        }
-      }
-    }
+    RETURN_NOT_OK(this->ExtractCoordinates(&nonzero_count, &indices_buffer, &data));
 
     // make results
     const std::vector<int64_t> indices_shape = {nonzero_count, ndim};
@@ -123,7 +243,6 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
     sparse_index =
         std::make_shared<SparseCOOIndex>(std::make_shared<SparseCOOIndex::CoordsTensor>(
             indices_buffer, indices_shape, indices_strides));
-    data = values_buffer;
 
     return Status::OK();
   }
@@ -136,79 +255,218 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
 };
 
 // ----------------------------------------------------------------------
-// SparseTensorConverter for SparseCSRIndex
+// SparseTensorConverter for SparseCSRIndex and SparseCSCIndex
 
-template <typename TYPE>
-class SparseTensorConverter<TYPE, SparseCSRIndex>
-    : private SparseTensorConverterBase<TYPE> {
+// Convert a matrix compressed along its rows (CSR) or its columns (CSC).  The
+// indptr entries are counted first, in parallel for ranges of rows or columns.
+template <typename TYPE, typename SparseIndexType>
+class SparseCompressedConverter : private SparseTensorConverterBase<TYPE> {
  public:
   using BaseClass = SparseTensorConverterBase<TYPE>;
   using NumericTensorType = typename BaseClass::NumericTensorType;
   using value_type = typename BaseClass::value_type;
 
-  explicit SparseTensorConverter(const NumericTensorType& tensor) : BaseClass(tensor) {}
+  static constexpr bool kRowMajor = SparseIndexType::format_id == SparseTensorFormat::CSR;
+
+  explicit SparseCompressedConverter(const NumericTensorType& tensor)
+      : BaseClass(tensor) {}
 
   Status Convert() {
     const int64_t ndim = tensor_.ndim();
     if (ndim > 2) {
       return Status::Invalid("Invalid tensor dimension");
+    } else if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
     }
 
-    const int64_t nr = tensor_.shape()[0];
-    const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+    // The compressed axis is the major one, the other the minor one
+    const int64_t major_length = tensor_.shape()[kRowMajor ? 0 : 1];
+    const int64_t minor_length = tensor_.shape()[kRowMajor ? 1 : 0];
+    const int64_t major_stride = tensor_.strides()[kRowMajor ? 0 : 1];
+    const int64_t minor_stride = tensor_.strides()[kRowMajor ? 1 : 0];
+    const int num_tasks = NumConversionTasks(tensor_, major_length);
 
     std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * (major_length + 1), &indptr_buffer));
+    int64_t* indptr = reinterpret_cast<int64_t*>(indptr_buffer->mutable_data());
+    std::fill(indptr, indptr + major_length + 1, 0);
+
+    // Count the non-zero values of each major index into indptr[index + 1]
+    RETURN_NOT_OK(ForEachRange(num_tasks, major_length, [&](int, int64_t begin,
+                                                            int64_t end) {
+      VisitNonZero(begin, end, major_stride, minor_length, minor_stride,
+                   [&](int64_t major, int64_t, value_type) { ++indptr[major + 1]; });
+    }));
+    for (int64_t i = 0; i < major_length; ++i) {
+      indptr[i + 1] += indptr[i];
+    }
+    const int64_t nonzero_count = indptr[major_length];
 
+    std::shared_ptr<Buffer> indices_buffer;
+    RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * nonzero_count, &indices_buffer));
+    int64_t* indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
     std::shared_ptr<Buffer> values_buffer;
     RETURN_NOT_OK(AllocateBuffer(sizeof(value_type) * nonzero_count, &values_buffer));
     value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
 
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * (nr + 1), &indptr_buffer));
-      int64_t* indptr = reinterpret_cast<int64_t*>(indptr_buffer->mutable_data());
+    RETURN_NOT_OK(ForEachRange(
+        num_tasks, major_length, [&](int, int64_t begin, int64_t end) {
+          // The next position of each major index of the range
+          std::vector<int64_t> cursors(indptr + begin, indptr + end);
+          VisitNonZero(begin, end, major_stride, minor_length, minor_stride,
+                       [&](int64_t major, int64_t minor, value_type x) {
+                         const int64_t pos = cursors[major - begin]++;
+                         indices[pos] = minor;
+                         values[pos] = x;
+                       });
+        }));
+
+    using IndexTensor = typename SparseIndexType::IndexTensor;
+    std::vector<int64_t> indptr_shape({major_length + 1});
+    auto indptr_tensor = std::make_shared<IndexTensor>(indptr_buffer, indptr_shape);
 
-      RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * nonzero_count, &indices_buffer));
-      int64_t* indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
+    std::vector<int64_t> indices_shape({nonzero_count});
+    auto indices_tensor = std::make_shared<IndexTensor>(indices_buffer, indices_shape);
 
-      int64_t k = 0;
-      *indptr++ = 0;
-      for (int64_t i = 0; i < nr; ++i) {
-        for (int64_t j = 0; j < nc; ++j) {
-          const value_type x = tensor_.Value({i, j});
+    sparse_index = std::make_shared<SparseIndexType>(indptr_tensor, indices_tensor);
+    data = values_buffer;
+
+    return Status::OK();
+  }
+
+  std::shared_ptr<SparseIndexType> sparse_index;
+  std::shared_ptr<Buffer> data;
+
+ private:
+  using BaseClass::tensor_;
+
+  // Call func(major, minor, value) for the non-zero values of the major
+  // indices [begin, end), in increasing minor order for each major index.
+  // CSC visits tiles of whole rows, so that row-major tensors are read a
+  // contiguous run at a time.
+  template <typename Function>
+  void VisitNonZero(int64_t begin, int64_t end, int64_t major_stride,
+                    int64_t minor_length, int64_t minor_stride, Function&& func) const {
+    if (kRowMajor) {
+      for (int64_t major = begin; major < end; ++major) {
+        int64_t offset = major * major_stride;
+        for (int64_t minor = 0; minor < minor_length; ++minor, offset += minor_stride) {
+          const value_type x = this->CellAt(offset);
+          if (x != 0) {
+            func(major, minor, x);
+          }
+        }
+      }
+    } else {
+      for (int64_t minor = 0; minor < minor_length; ++minor) {
+        int64_t offset = minor * minor_stride + begin * major_stride;
+        for (int64_t major = begin; major < end; ++major, offset += major_stride) {
+          const value_type x = this->CellAt(offset);
           if (x != 0) {
-            *values++ = x;
-            *indices++ = j;
-            k++;
+            func(major, minor, x);
           }
         }
-        *indptr++ = k;
       }
     }
+  }
+};
 
-    std::vector<int64_t> indptr_shape({nr + 1});
-    std::shared_ptr<SparseCSRIndex::IndexTensor> indptr_tensor =
-        std::make_shared<SparseCSRIndex::IndexTensor>(indptr_buffer, indptr_shape);
+template <typename TYPE>
+class SparseTensorConverter<TYPE, SparseCSRIndex>
+    : public SparseCompressedConverter<TYPE, SparseCSRIndex> {
+ public:
+  using SparseCompressedConverter<TYPE, SparseCSRIndex>::SparseCompressedConverter;
+};
 
-    std::vector<int64_t> indices_shape({nonzero_count});
-    std::shared_ptr<SparseCSRIndex::IndexTensor> indices_tensor =
-        std::make_shared<SparseCSRIndex::IndexTensor>(indices_buffer, indices_shape);
+template <typename TYPE>
+class SparseTensorConverter<TYPE, SparseCSCIndex>
+    : public SparseCompressedConverter<TYPE, SparseCSCIndex> {
+ public:
+  using SparseCompressedConverter<TYPE, SparseCSCIndex>::SparseCompressedConverter;
+};
 
-    sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
-    data = values_buffer;
+// ----------------------------------------------------------------------
+// SparseTensorConverter for SparseCSFIndex
+
+template <typename TYPE>
+class SparseTensorConverter<TYPE, SparseCSFIndex>
+    : private SparseTensorConverterBase<TYPE> {
+ public:
+  using BaseClass = SparseTensorConverterBase<TYPE>;
+  using typename BaseClass::NumericTensorType;
+  using typename BaseClass::value_type;
+
+  explicit SparseTensorConverter(const NumericTensorType& tensor) : BaseClass(tensor) {}
+
+  Status Convert() {
+    const int64_t ndim = tensor_.ndim();
+    if (ndim == 0) {
+      return Status::Invalid("Invalid tensor dimension");
+    }
+
+    // The coordinates are in row-major order, which is the CSF order for the
+    // default axis order
+    int64_t nonzero_count = -1;
+    std::shared_ptr<Buffer> coords_buffer;
+    RETURN_NOT_OK(this->ExtractCoordinates(&nonzero_count, &coords_buffer, &data));
+    const int64_t* coords = reinterpret_cast<const int64_t*>(coords_buffer->data());
+
+    // A value adds a node to each level from the first coordinate where it
+    // differs from the previous value
+    std::vector<std::vector<int64_t>> indptr(ndim - 1), indices(ndim);
+    for (int64_t n = 0; n < nonzero_count; ++n) {
+      int64_t first = 0;
+      if (n > 0) {
+        while (first < ndim - 1 && coords[first * nonzero_count + n] ==
+                                       coords[first * nonzero_count + n - 1]) {
+          ++first;
+        }
+      }
+      for (int64_t d = first; d < ndim; ++d) {
+        if (d < ndim - 1) {
+          indptr[d].push_back(static_cast<int64_t>(indices[d + 1].size()));
+        }
+        indices[d].push_back(coords[d * nonzero_count + n]);
+      }
+    }
 
+    std::vector<std::shared_ptr<SparseCSFIndex::IndexTensor>> indptr_tensors,
+        indices_tensors;
+    for (int64_t d = 0; d < ndim; ++d) {
+      if (d < ndim - 1) {
+        indptr[d].push_back(static_cast<int64_t>(indices[d + 1].size()));
+        std::shared_ptr<SparseCSFIndex::IndexTensor> tensor;
+        RETURN_NOT_OK(MakeIndexTensor(indptr[d], &tensor));
+        indptr_tensors.push_back(std::move(tensor));
+      }
+      std::shared_ptr<SparseCSFIndex::IndexTensor> tensor;
+      RETURN_NOT_OK(MakeIndexTensor(indices[d], &tensor));
+      indices_tensors.push_back(std::move(tensor));
+    }
+    std::vector<int64_t> axis_order(ndim);
+    std::iota(axis_order.begin(), axis_order.end(), 0);
+
+    sparse_index =
+        std::make_shared<SparseCSFIndex>(indptr_tensors, indices_tensors, axis_order);
     return Status::OK();
   }
 
-  std::shared_ptr<SparseCSRIndex> sparse_index;
+  std::shared_ptr<SparseCSFIndex> sparse_index;
   std::shared_ptr<Buffer> data;
 
  private:
   using BaseClass::tensor_;
+
+  static Status MakeIndexTensor(const std::vector<int64_t>& values,
+                                std::shared_ptr<SparseCSFIndex::IndexTensor>* out) {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * values.size(), &buffer));
+    std::copy(values.begin(), values.end(),
+              reinterpret_cast<int64_t*>(buffer->mutable_data()));
+    const std::vector<int64_t> shape({static_cast<int64_t>(values.size())});
+    *out = std::make_shared<SparseCSFIndex::IndexTensor>(buffer, shape);
+    return Status::OK();
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -229,6 +487,8 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
 
 INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCOOIndex);
 INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCSRIndex);
+INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCSCIndex);
+INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCSFIndex);
 
 }  // namespace
 
@@ -305,6 +565,12 @@ void MakeSparseTensorFromTensor(const Tensor& tensor,
     case SparseTensorFormat::CSR:
       MakeSparseTensorFromTensor<SparseCSRIndex>(tensor, sparse_index, data);
       break;
+    case SparseTensorFormat::CSC:
+      MakeSparseTensorFromTensor<SparseCSCIndex>(tensor, sparse_index, data);
+      break;
+    case SparseTensorFormat::CSF:
+      MakeSparseTensorFromTensor<SparseCSFIndex>(tensor, sparse_index, data);
+      break;
     default:
       ARROW_LOG(FATAL) << "Invalid sparse tensor format ID";
       break;
@@ -330,13 +596,66 @@ std::string SparseCOOIndex::ToString() const { return std::string("SparseCOOInde
 // Constructor with two index vectors
 SparseCSRIndex::SparseCSRIndex(const std::shared_ptr<IndexTensor>& indptr,
                                const std::shared_ptr<IndexTensor>& indices)
-    : SparseIndexBase(indices->shape()[0]), indptr_(indptr), indices_(indices) {
+    : SparseCompressedIndexBase(indptr, indices) {
   ARROW_CHECK_EQ(1, indptr_->ndim());
   ARROW_CHECK_EQ(1, indices_->ndim());
 }
 
 std::string SparseCSRIndex::ToString() const { return std::string("SparseCSRIndex"); }
 
+// ----------------------------------------------------------------------
+// SparseCSCIndex
+
+// Constructor with two index vectors
+SparseCSCIndex::SparseCSCIndex(const std::shared_ptr<IndexTensor>& indptr,
+                               const std::shared_ptr<IndexTensor>& indices)
+    : SparseCompressedIndexBase(indptr, indices) {
+  ARROW_CHECK_EQ(1, indptr_->ndim());
+  ARROW_CHECK_EQ(1, indices_->ndim());
+}
+
+std::string SparseCSCIndex::ToString() const { return std::string("SparseCSCIndex"); }
+
+// ----------------------------------------------------------------------
+// SparseCSFIndex
+
+SparseCSFIndex::SparseCSFIndex(const std::vector<std::shared_ptr<IndexTensor>>& indptr,
+                               const std::vector<std::shared_ptr<IndexTensor>>& indices,
+                               const std::vector<int64_t>& axis_order)
+    : SparseIndexBase(indices.empty() ? 0 : indices.back()->shape()[0]),
+      indptr_(indptr),
+      indices_(indices),
+      axis_order_(axis_order) {
+  ARROW_CHECK_EQ(indices_.size(), axis_order_.size());
+  ARROW_CHECK_EQ(indices_.size(), indptr_.size() + 1);
+  for (const auto& tensor : indptr_) {
+    ARROW_CHECK_EQ(1, tensor->ndim());
+  }
+  for (const auto& tensor : indices_) {
+    ARROW_CHECK_EQ(1, tensor->ndim());
+  }
+}
+
+std::string SparseCSFIndex::ToString() const { return std::string("SparseCSFIndex"); }
+
+bool SparseCSFIndex::Equals(const SparseCSFIndex& other) const {
+  if (axis_order_ != other.axis_order_ || indptr_.size() != other.indptr_.size() ||
+      indices_.size() != other.indices_.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < indptr_.size(); ++i) {
+    if (!indptr_[i]->Equals(*other.indptr_[i])) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < indices_.size(); ++i) {
+    if (!indices_[i]->Equals(*other.indices_[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // ----------------------------------------------------------------------
 // SparseTensor
 
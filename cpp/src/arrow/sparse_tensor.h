@@ -31,7 +31,7 @@ namespace arrow {
 
 struct SparseTensorFormat {
   /// EXPERIMENTAL: The index format type of SparseTensor
-  enum type { COO, CSR };
+  enum type { COO, CSR, CSC, CSF };
 };
 
 /// \brief EXPERIMENTAL: The base class for the index of a sparse tensor
@@ -104,7 +104,39 @@ class ARROW_EXPORT SparseCOOIndex : public internal::SparseIndexBase<SparseCOOIn
 };
 
 // ----------------------------------------------------------------------
-// SparseCSRIndex class
+// SparseCSRIndex and SparseCSCIndex classes
+
+namespace internal {
+
+/// \brief The index data of a sparse matrix compressed along one axis
+template <typename SparseIndexType>
+class SparseCompressedIndexBase : public SparseIndexBase<SparseIndexType> {
+ public:
+  using IndexTensor = NumericTensor<Int64Type>;
+
+  SparseCompressedIndexBase(const std::shared_ptr<IndexTensor>& indptr,
+                            const std::shared_ptr<IndexTensor>& indices)
+      : SparseIndexBase<SparseIndexType>(indices->shape()[0]),
+        indptr_(indptr),
+        indices_(indices) {}
+
+  /// \brief Return a 1D tensor of indptr vector
+  const std::shared_ptr<IndexTensor>& indptr() const { return indptr_; }
+
+  /// \brief Return a 1D tensor of indices vector
+  const std::shared_ptr<IndexTensor>& indices() const { return indices_; }
+
+  /// \brief Return whether the indices are equal
+  bool Equals(const SparseIndexType& other) const {
+    return indptr()->Equals(*other.indptr()) && indices()->Equals(*other.indices());
+  }
+
+ protected:
+  std::shared_ptr<IndexTensor> indptr_;
+  std::shared_ptr<IndexTensor> indices_;
+};
+
+}  // namespace internal
 
 /// \brief EXPERIMENTAL: The index data for a CSR sparse matrix
 ///
@@ -118,33 +150,80 @@ class ARROW_EXPORT SparseCOOIndex : public internal::SparseIndexBase<SparseCOOIn
 /// The other vector, called indices, represents the column indices of the
 /// corresponding non-zero values.  So the length of an indices vector is same
 /// as the number of non-zero-values.
-class ARROW_EXPORT SparseCSRIndex : public internal::SparseIndexBase<SparseCSRIndex> {
+class ARROW_EXPORT SparseCSRIndex
+    : public internal::SparseCompressedIndexBase<SparseCSRIndex> {
  public:
-  using IndexTensor = NumericTensor<Int64Type>;
-
   static constexpr SparseTensorFormat::type format_id = SparseTensorFormat::CSR;
 
   // Constructor with two index vectors
   explicit SparseCSRIndex(const std::shared_ptr<IndexTensor>& indptr,
                           const std::shared_ptr<IndexTensor>& indices);
 
-  /// \brief Return a 1D tensor of indptr vector
-  const std::shared_ptr<IndexTensor>& indptr() const { return indptr_; }
+  /// \brief Return a string representation of the sparse index
+  std::string ToString() const override;
+};
 
-  /// \brief Return a 1D tensor of indices vector
-  const std::shared_ptr<IndexTensor>& indices() const { return indices_; }
+/// \brief EXPERIMENTAL: The index data for a CSC sparse matrix
+///
+/// A CSC sparse index is the transpose of a CSR one: the j-th column spans
+/// from indptr[j] to indptr[j+1] in the value vector, and indices holds the
+/// row indices of the non-zero values.  So the length of an indptr vector is
+/// the number of columns + 1.
+class ARROW_EXPORT SparseCSCIndex
+    : public internal::SparseCompressedIndexBase<SparseCSCIndex> {
+ public:
+  static constexpr SparseTensorFormat::type format_id = SparseTensorFormat::CSC;
+
+  // Constructor with two index vectors
+  explicit SparseCSCIndex(const std::shared_ptr<IndexTensor>& indptr,
+                          const std::shared_ptr<IndexTensor>& indices);
 
   /// \brief Return a string representation of the sparse index
   std::string ToString() const override;
+};
 
-  /// \brief Return whether the CSR indices are equal
-  bool Equals(const SparseCSRIndex& other) const {
-    return indptr()->Equals(*other.indptr()) && indices()->Equals(*other.indices());
-  }
+// ----------------------------------------------------------------------
+// SparseCSFIndex class
+
+/// \brief EXPERIMENTAL: The index data for a CSF sparse tensor
+///
+/// A CSF (compressed sparse fiber) index represents the non-zero values as a
+/// tree of ndim levels, the dimensions being visited in axis_order.  The
+/// nodes of level i are the distinct coordinates along axis_order[0..i] of
+/// the non-zero values: indices()[i] holds their coordinate along
+/// axis_order[i], and the children of the k-th node of level i span from
+/// indptr()[i][k] to indptr()[i][k+1] in level i + 1.  The leaves are in the
+/// order of the value vector.
+class ARROW_EXPORT SparseCSFIndex : public internal::SparseIndexBase<SparseCSFIndex> {
+ public:
+  using IndexTensor = NumericTensor<Int64Type>;
+
+  static constexpr SparseTensorFormat::type format_id = SparseTensorFormat::CSF;
+
+  // Constructor with the ndim - 1 indptr and the ndim indices vectors
+  SparseCSFIndex(const std::vector<std::shared_ptr<IndexTensor>>& indptr,
+                 const std::vector<std::shared_ptr<IndexTensor>>& indices,
+                 const std::vector<int64_t>& axis_order);
+
+  /// \brief Return the 1D tensors of the indptr vectors
+  const std::vector<std::shared_ptr<IndexTensor>>& indptr() const { return indptr_; }
+
+  /// \brief Return the 1D tensors of the indices vectors
+  const std::vector<std::shared_ptr<IndexTensor>>& indices() const { return indices_; }
+
+  /// \brief Return the order in which the dimensions are visited
+  const std::vector<int64_t>& axis_order() const { return axis_order_; }
+
+  /// \brief Return a string representation of the sparse index
+  std::string ToString() const override;
+
+  /// \brief Return whether the CSF indices are equal
+  bool Equals(const SparseCSFIndex& other) const;
 
  protected:
-  std::shared_ptr<IndexTensor> indptr_;
-  std::shared_ptr<IndexTensor> indices_;
+  std::vector<std::shared_ptr<IndexTensor>> indptr_;
+  std::vector<std::shared_ptr<IndexTensor>> indices_;
+  std::vector<int64_t> axis_order_;
 };
 
 // ----------------------------------------------------------------------
@@ -266,6 +345,12 @@ using SparseTensorCOO = SparseTensorImpl<SparseCOOIndex>;
 using SparseTensorCSR = SparseTensorImpl<SparseCSRIndex>;
 using SparseMatrixCSR = SparseTensorImpl<SparseCSRIndex>;
 
+/// \brief EXPERIMENTAL: Type alias for CSC sparse matrix
+using SparseMatrixCSC = SparseTensorImpl<SparseCSCIndex>;
+
+/// \brief EXPERIMENTAL: Type alias for CSF sparse tensor
+using SparseTensorCSF = SparseTensorImpl<SparseCSFIndex>;
+
 }  // namespace arrow
 
 #endif  // ARROW_SPARSE_TENSOR_H
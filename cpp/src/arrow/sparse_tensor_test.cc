@@ -39,6 +39,12 @@ static inline void CheckSparseIndexFormatType(SparseTensorFormat::type expected,
   ASSERT_EQ(expected, sparse_tensor.sparse_index()->format_id());
 }
 
+static inline std::vector<int64_t> IndexValues(
+    const std::shared_ptr<NumericTensor<Int64Type>>& tensor) {
+  const int64_t* begin = reinterpret_cast<const int64_t*>(tensor->raw_data());
+  return std::vector<int64_t>(begin, begin + tensor->shape()[0]);
+}
+
 static inline void AssertCOOIndex(
     const std::shared_ptr<SparseCOOIndex::CoordsTensor>& sidx, const int64_t nth,
     const std::vector<int64_t>& expected_values) {
@@ -308,4 +314,202 @@ TEST(TestSparseCSRMatrix, TensorEquality) {
   ASSERT_TRUE(!st1.Equals(st3));
 }
 
+TEST(TestSparseCSCMatrix, CreationFromNumericTensor2D) {
+  std::vector<int64_t> shape = {6, 4};
+  std::vector<int64_t> values = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                 0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(values);
+  NumericTensor<Int64Type> tensor(buffer, shape);
+
+  SparseTensorImpl<SparseCSCIndex> st(tensor);
+
+  CheckSparseIndexFormatType(SparseTensorFormat::CSC, st);
+  ASSERT_EQ(12, st.non_zero_length());
+
+  const int64_t* raw_data = reinterpret_cast<const int64_t*>(st.raw_data());
+  AssertNumericDataEqual(raw_data, {1, 5, 13, 3, 11, 15, 2, 6, 14, 4, 12, 16});
+
+  const auto& si = internal::checked_cast<const SparseCSCIndex&>(*st.sparse_index());
+  ASSERT_EQ(std::string("SparseCSCIndex"), si.ToString());
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 6, 9, 12}), IndexValues(si.indptr()));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 4, 1, 3, 5, 0, 2, 4, 1, 3, 5}),
+            IndexValues(si.indices()));
+}
+
+TEST(TestSparseCSCMatrix, CreationFromNonContiguousTensor) {
+  std::vector<int64_t> shape = {6, 4};
+  std::vector<int64_t> values = {1,  0, 0, 0, 2,  0, 0, 0, 0, 0, 3,  0, 0, 0, 4,  0,
+                                 5,  0, 0, 0, 6,  0, 0, 0, 0, 0, 11, 0, 0, 0, 12, 0,
+                                 13, 0, 0, 0, 14, 0, 0, 0, 0, 0, 15, 0, 0, 0, 16, 0};
+  std::vector<int64_t> strides = {64, 16};
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(values);
+  Tensor tensor(int64(), buffer, shape, strides);
+  SparseTensorImpl<SparseCSCIndex> st(tensor);
+
+  ASSERT_EQ(12, st.non_zero_length());
+  const int64_t* raw_data = reinterpret_cast<const int64_t*>(st.raw_data());
+  AssertNumericDataEqual(raw_data, {1, 5, 13, 3, 11, 15, 2, 6, 14, 4, 12, 16});
+
+  const auto& si = internal::checked_cast<const SparseCSCIndex&>(*st.sparse_index());
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 6, 9, 12}), IndexValues(si.indptr()));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 4, 1, 3, 5, 0, 2, 4, 1, 3, 5}),
+            IndexValues(si.indices()));
+}
+
+TEST(TestSparseCSCMatrix, TensorEquality) {
+  std::vector<int64_t> shape = {6, 4};
+  std::vector<int64_t> values1 = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                  0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+  std::vector<int64_t> values2(24, 0);
+  NumericTensor<Int64Type> tensor1(Buffer::Wrap(values1), shape);
+  NumericTensor<Int64Type> tensor2(Buffer::Wrap(values2), shape);
+  SparseTensorImpl<SparseCSCIndex> st1(tensor1);
+  SparseTensorImpl<SparseCSCIndex> st2(tensor1);
+  SparseTensorImpl<SparseCSCIndex> st3(tensor2);
+  SparseTensorImpl<SparseCSRIndex> st4(tensor1);
+
+  ASSERT_TRUE(st1.Equals(st2));
+  ASSERT_FALSE(st1.Equals(st3));
+  ASSERT_FALSE(st1.Equals(st4));
+}
+
+TEST(TestSparseCSFTensor, CreationFromNumericTensor) {
+  std::vector<int64_t> shape = {2, 3, 4};
+  std::vector<int64_t> values(24, 0);
+  // X[0, 0, 1], X[0, 0, 3], X[0, 2, 0], X[1, 1, 1] and X[1, 1, 2]
+  values[1] = 1;
+  values[3] = 2;
+  values[8] = 3;
+  values[17] = 4;
+  values[18] = 5;
+  std::vector<std::string> dim_names = {"foo", "bar", "baz"};
+  NumericTensor<Int64Type> tensor(Buffer::Wrap(values), shape, {}, dim_names);
+
+  SparseTensorImpl<SparseCSFIndex> st(tensor);
+
+  CheckSparseIndexFormatType(SparseTensorFormat::CSF, st);
+  ASSERT_EQ(5, st.non_zero_length());
+  ASSERT_EQ("bar", st.dim_name(1));
+
+  const int64_t* raw_data = reinterpret_cast<const int64_t*>(st.raw_data());
+  AssertNumericDataEqual(raw_data, {1, 2, 3, 4, 5});
+
+  const auto& si = internal::checked_cast<const SparseCSFIndex&>(*st.sparse_index());
+  ASSERT_EQ(std::string("SparseCSFIndex"), si.ToString());
+  ASSERT_EQ(std::vector<int64_t>({0, 1, 2}), si.axis_order());
+  ASSERT_EQ(2, si.indptr().size());
+  ASSERT_EQ(3, si.indices().size());
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 3}), IndexValues(si.indptr()[0]));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 3, 5}), IndexValues(si.indptr()[1]));
+  ASSERT_EQ(std::vector<int64_t>({0, 1}), IndexValues(si.indices()[0]));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 1}), IndexValues(si.indices()[1]));
+  ASSERT_EQ(std::vector<int64_t>({1, 3, 0, 1, 2}), IndexValues(si.indices()[2]));
+
+  SparseTensorImpl<SparseCSFIndex> st2(tensor);
+  ASSERT_TRUE(st.Equals(st2));
+}
+
+TEST(TestSparseCSFTensor, CreationFromVector) {
+  std::vector<int64_t> values = {0, 7, 0, 0, 8};
+  NumericTensor<Int64Type> tensor(Buffer::Wrap(values), {5});
+  SparseTensorImpl<SparseCSFIndex> st(tensor);
+
+  ASSERT_EQ(2, st.non_zero_length());
+  const auto& si = internal::checked_cast<const SparseCSFIndex&>(*st.sparse_index());
+  ASSERT_EQ(0, si.indptr().size());
+  ASSERT_EQ(std::vector<int64_t>({1, 4}), IndexValues(si.indices()[0]));
+}
+
+// Large enough tensors are converted in parallel
+class TestSparseTensorParallelConversion : public ::testing::Test {
+ public:
+  void SetUp() {
+    values_.resize(kRows * kColumns);
+    for (int64_t i = 0; i < kRows; ++i) {
+      for (int64_t j = 0; j < kColumns; ++j) {
+        values_[i * kColumns + j] = (i * 7 + j * 13) % 97 == 0 ? i * kColumns + j + 1 : 0;
+      }
+    }
+  }
+
+ protected:
+  static constexpr int64_t kRows = 1500;
+  static constexpr int64_t kColumns = 1000;
+
+  std::vector<int64_t> values_;
+};
+
+constexpr int64_t TestSparseTensorParallelConversion::kRows;
+constexpr int64_t TestSparseTensorParallelConversion::kColumns;
+
+TEST_F(TestSparseTensorParallelConversion, CSRAndCSC) {
+  NumericTensor<Int64Type> tensor(Buffer::Wrap(values_), {kRows, kColumns});
+  std::vector<int64_t> csr_indptr = {0}, csr_indices, csr_values;
+  for (int64_t i = 0; i < kRows; ++i) {
+    for (int64_t j = 0; j < kColumns; ++j) {
+      if (values_[i * kColumns + j] != 0) {
+        csr_indices.push_back(j);
+        csr_values.push_back(values_[i * kColumns + j]);
+      }
+    }
+    csr_indptr.push_back(static_cast<int64_t>(csr_indices.size()));
+  }
+  std::vector<int64_t> csc_indptr = {0}, csc_indices, csc_values;
+  for (int64_t j = 0; j < kColumns; ++j) {
+    for (int64_t i = 0; i < kRows; ++i) {
+      if (values_[i * kColumns + j] != 0) {
+        csc_indices.push_back(i);
+        csc_values.push_back(values_[i * kColumns + j]);
+      }
+    }
+    csc_indptr.push_back(static_cast<int64_t>(csc_indices.size()));
+  }
+
+  SparseTensorImpl<SparseCSRIndex> csr(tensor);
+  const auto& csr_index =
+      internal::checked_cast<const SparseCSRIndex&>(*csr.sparse_index());
+  ASSERT_EQ(csr_indptr, IndexValues(csr_index.indptr()));
+  ASSERT_EQ(csr_indices, IndexValues(csr_index.indices()));
+  const int64_t* data = reinterpret_cast<const int64_t*>(csr.raw_data());
+  ASSERT_EQ(csr_values, std::vector<int64_t>(data, data + csr.non_zero_length()));
+
+  SparseTensorImpl<SparseCSCIndex> csc(tensor);
+  const auto& csc_index =
+      internal::checked_cast<const SparseCSCIndex&>(*csc.sparse_index());
+  ASSERT_EQ(csc_indptr, IndexValues(csc_index.indptr()));
+  ASSERT_EQ(csc_indices, IndexValues(csc_index.indices()));
+  data = reinterpret_cast<const int64_t*>(csc.raw_data());
+  ASSERT_EQ(csc_values, std::vector<int64_t>(data, data + csc.non_zero_length()));
+}
+
+TEST_F(TestSparseTensorParallelConversion, COO) {
+  // As a 3-dim tensor, both contiguous and column-major
+  const std::vector<int64_t> shape = {kRows / 10, 10, kColumns};
+  NumericTensor<Int64Type> tensor(Buffer::Wrap(values_), shape);
+  std::vector<std::vector<int64_t>> expected_coords;
+  std::vector<int64_t> expected_values;
+  for (int64_t n = 0; n < tensor.size(); ++n) {
+    if (values_[n] != 0) {
+      expected_coords.push_back({n / (10 * kColumns), n / kColumns % 10, n % kColumns});
+      expected_values.push_back(values_[n]);
+    }
+  }
+
+  const int64_t elsize = sizeof(int64_t);
+  Tensor column_major(int64(), Buffer::Wrap(values_), {kColumns, 10, kRows / 10},
+                      {elsize, elsize * kColumns, elsize * kColumns * 10});
+  SparseTensorImpl<SparseCOOIndex> column_major_coo(column_major);
+  ASSERT_EQ(static_cast<int64_t>(expected_values.size()),
+            column_major_coo.non_zero_length());
+
+  SparseTensorImpl<SparseCOOIndex> coo(tensor);
+  ASSERT_EQ(static_cast<int64_t>(expected_values.size()), coo.non_zero_length());
+  const auto& si = internal::checked_cast<const SparseCOOIndex&>(*coo.sparse_index());
+  const int64_t* data = reinterpret_cast<const int64_t*>(coo.raw_data());
+  for (size_t n = 0; n < expected_values.size(); ++n) {
+    ASSERT_EQ(expected_values[n], data[n]);
+    AssertCOOIndex(si.indices(), static_cast<int64_t>(n), expected_coords[n]);
+  }
+}
+
 }  // namespace arrow
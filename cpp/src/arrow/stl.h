@@ -18,9 +18,13 @@
 #ifndef ARROW_STL_H
 #define ARROW_STL_H
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/builder.h"
@@ -29,6 +33,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -208,50 +213,123 @@ struct SchemaFromTuple<Tuple, 0> {
 
 namespace internal {
 
-template <typename Tuple, std::size_t N = std::tuple_size<Tuple>::value>
-struct CreateBuildersRecursive {
-  static Status Make(MemoryPool* pool,
-                     std::vector<std::unique_ptr<ArrayBuilder>>* builders) {
-    using Element = BareTupleElement<N - 1, Tuple>;
-    std::shared_ptr<DataType> type = ConversionTraits<Element>::type_singleton();
-    ARROW_RETURN_NOT_OK(MakeBuilder(pool, type, &builders->at(N - 1)));
-
-    return CreateBuildersRecursive<Tuple, N - 1>::Make(pool, builders);
+/// Append column I of the rows [begin, end) to a builder, one column at a time.
+///
+/// The builder is presized for all the rows, so that the specializations for
+/// fixed-width and string cells append without further capacity checks.
+template <typename Element, typename Enable = void>
+struct ColumnAppender {
+  template <std::size_t I, typename Iterator, typename BuilderType>
+  static Status Append(Iterator begin, Iterator end, int64_t length,
+                       BuilderType* builder) {
+    using std::get;
+    ARROW_RETURN_NOT_OK(builder->Reserve(length));
+    for (auto it = begin; it != end; ++it) {
+      ARROW_RETURN_NOT_OK(ConversionTraits<Element>::AppendRow(*builder, get<I>(*it)));
+    }
+    return Status::OK();
   }
 };
 
-template <typename Tuple>
-struct CreateBuildersRecursive<Tuple, 0> {
-  static Status Make(MemoryPool*, std::vector<std::unique_ptr<ArrayBuilder>>*) {
+template <typename Element>
+struct ColumnAppender<Element,
+                      typename std::enable_if<std::is_arithmetic<Element>::value>::type> {
+  template <std::size_t I, typename Iterator, typename BuilderType>
+  static Status Append(Iterator begin, Iterator end, int64_t length,
+                       BuilderType* builder) {
+    using std::get;
+    ARROW_RETURN_NOT_OK(builder->Reserve(length));
+    for (auto it = begin; it != end; ++it) {
+      builder->UnsafeAppend(get<I>(*it));
+    }
     return Status::OK();
   }
 };
 
-template <typename Tuple, std::size_t N = std::tuple_size<Tuple>::value>
-struct RowIterator {
-  static Status Append(const std::vector<std::unique_ptr<ArrayBuilder>>& builders,
-                       const Tuple& row) {
+template <>
+struct ColumnAppender<std::string> {
+  template <std::size_t I, typename Iterator>
+  static Status Append(Iterator begin, Iterator end, int64_t length,
+                       StringBuilder* builder) {
     using std::get;
-    using Element = BareTupleElement<N - 1, Tuple>;
+    int64_t data_length = 0;
+    for (auto it = begin; it != end; ++it) {
+      data_length += static_cast<int64_t>(get<I>(*it).size());
+    }
+    ARROW_RETURN_NOT_OK(builder->Reserve(length));
+    ARROW_RETURN_NOT_OK(builder->ReserveData(data_length));
+    for (auto it = begin; it != end; ++it) {
+      const std::string& cell = get<I>(*it);
+      builder->UnsafeAppend(cell.data(), static_cast<int32_t>(cell.size()));
+    }
+    return Status::OK();
+  }
+};
+
+/// Convert column I of the rows [begin, end) to an array
+template <typename Tuple, std::size_t I>
+struct ColumnFromTupleRange {
+  template <typename Iterator>
+  static Status Make(MemoryPool* pool, Iterator begin, Iterator end, int64_t length,
+                     std::shared_ptr<Array>* out) {
+    using Element = BareTupleElement<I, Tuple>;
     using BuilderType =
         typename TypeTraits<typename ConversionTraits<Element>::ArrowType>::BuilderType;
 
-    BuilderType& builder =
-        ::arrow::internal::checked_cast<BuilderType&>(*builders[N - 1]);
-    ARROW_RETURN_NOT_OK(ConversionTraits<Element>::AppendRow(builder, get<N - 1>(row)));
+    std::unique_ptr<ArrayBuilder> builder;
+    ARROW_RETURN_NOT_OK(
+        MakeBuilder(pool, ConversionTraits<Element>::type_singleton(), &builder));
+    auto typed_builder = ::arrow::internal::checked_cast<BuilderType*>(builder.get());
+    ARROW_RETURN_NOT_OK(
+        ColumnAppender<Element>::template Append<I>(begin, end, length, typed_builder));
+    return builder->Finish(out);
+  }
+};
 
-    return RowIterator<Tuple, N - 1>::Append(builders, row);
+/// Convert all the columns of the rows [begin, end), unrolled at compile time
+template <typename Tuple, std::size_t N = std::tuple_size<Tuple>::value>
+struct ColumnsFromTupleRange {
+  template <typename Iterator>
+  static Status Make(MemoryPool* pool, Iterator begin, Iterator end, int64_t length,
+                     std::vector<std::shared_ptr<Array>>* arrays) {
+    using Previous = ColumnsFromTupleRange<Tuple, N - 1>;
+    ARROW_RETURN_NOT_OK(Previous::Make(pool, begin, end, length, arrays));
+    return ColumnFromTupleRange<Tuple, N - 1>::Make(pool, begin, end, length,
+                                                    &(*arrays)[N - 1]);
   }
 };
 
 template <typename Tuple>
-struct RowIterator<Tuple, 0> {
-  static Status Append(const std::vector<std::unique_ptr<ArrayBuilder>>& builders,
-                       const Tuple& row) {
+struct ColumnsFromTupleRange<Tuple, 0> {
+  template <typename Iterator>
+  static Status Make(MemoryPool*, Iterator, Iterator, int64_t,
+                     std::vector<std::shared_ptr<Array>>*) {
     return Status::OK();
   }
 };
 
+/// The ColumnFromTupleRange functions of all the columns, so that they can
+/// be picked by index at runtime
+template <typename Tuple, typename Iterator,
+          std::size_t N = std::tuple_size<Tuple>::value>
+struct ColumnMakers {
+  using Maker = Status (*)(MemoryPool*, Iterator, Iterator, int64_t,
+                           std::shared_ptr<Array>*);
+
+  static void Fill(std::vector<Maker>* makers) {
+    ColumnMakers<Tuple, Iterator, N - 1>::Fill(makers);
+    makers->push_back(&ColumnFromTupleRange<Tuple, N - 1>::template Make<Iterator>);
+  }
+};
+
+template <typename Tuple, typename Iterator>
+struct ColumnMakers<Tuple, Iterator, 0> {
+  using Maker = Status (*)(MemoryPool*, Iterator, Iterator, int64_t,
+                           std::shared_ptr<Array>*);
+
+  static void Fill(std::vector<Maker>*) {}
+};
+
 template <typename Tuple, std::size_t N = std::tuple_size<Tuple>::value>
 struct EnsureColumnTypes {
   static Status Cast(const Table& table, std::shared_ptr<Table>* table_owner,
@@ -315,6 +393,12 @@ struct TupleSetter<Range, Tuple, 0> {
 
 }  // namespace internal
 
+/// Convert a range of tuple-like rows to a Table, with the column names
+/// given at runtime.
+///
+/// The range must be traversable more than once: the builder of each column
+/// is presized from the number of rows, then filled in its own pass over the
+/// rows.
 template <typename Range>
 Status TableFromTupleRange(MemoryPool* pool, const Range& rows,
                            const std::vector<std::string>& names,
@@ -324,21 +408,70 @@ Status TableFromTupleRange(MemoryPool* pool, const Range& rows,
 
   std::shared_ptr<Schema> schema = SchemaFromTuple<row_type>::MakeSchema(names);
 
-  std::vector<std::unique_ptr<ArrayBuilder>> builders(n_columns);
-  ARROW_RETURN_NOT_OK(internal::CreateBuildersRecursive<row_type>::Make(pool, &builders));
+  auto begin = std::begin(rows);
+  auto end = std::end(rows);
+  const int64_t length = static_cast<int64_t>(std::distance(begin, end));
 
-  for (auto const& row : rows) {
-    ARROW_RETURN_NOT_OK(internal::RowIterator<row_type>::Append(builders, row));
-  }
+  std::vector<std::shared_ptr<Array>> arrays(n_columns);
+  ARROW_RETURN_NOT_OK(internal::ColumnsFromTupleRange<row_type>::Make(pool, begin, end,
+                                                                     length, &arrays));
+
+  *table = Table::Make(schema, arrays);
+
+  return Status::OK();
+}
+
+/// Convert a random-access range of tuple-like rows to a Table like
+/// TableFromTupleRange, on the CPU thread pool.
+///
+/// The rows are split into slices of chunk_size rows, each column of each
+/// slice being converted by its own task, so that the columns of the Table
+/// have a chunk per slice.
+template <typename Range>
+Status TableFromTupleRangeParallel(MemoryPool* pool, const Range& rows,
+                                   const std::vector<std::string>& names,
+                                   int64_t chunk_size, std::shared_ptr<Table>* table) {
+  using iterator_type = decltype(std::begin(rows));
+  using row_type = typename std::iterator_traits<iterator_type>::value_type;
+  using iterator_category =
+      typename std::iterator_traits<iterator_type>::iterator_category;
+  static_assert(
+      std::is_base_of<std::random_access_iterator_tag, iterator_category>::value,
+      "TableFromTupleRangeParallel needs a random-access range");
+  constexpr std::size_t n_columns = std::tuple_size<row_type>::value;
 
-  std::vector<std::shared_ptr<Array>> arrays;
-  for (auto const& builder : builders) {
-    std::shared_ptr<Array> array;
-    ARROW_RETURN_NOT_OK(builder->Finish(&array));
-    arrays.emplace_back(array);
+  if (chunk_size <= 0) {
+    return Status::Invalid("chunk_size must be positive, got ", chunk_size);
+  }
+  auto begin = std::begin(rows);
+  const int64_t length = static_cast<int64_t>(std::distance(begin, std::end(rows)));
+  if (length <= chunk_size) {
+    return TableFromTupleRange(pool, rows, names, table);
   }
 
-  *table = Table::Make(schema, arrays);
+  std::shared_ptr<Schema> schema = SchemaFromTuple<row_type>::MakeSchema(names);
+
+  std::vector<typename internal::ColumnMakers<row_type, iterator_type>::Maker> makers;
+  internal::ColumnMakers<row_type, iterator_type>::Fill(&makers);
+
+  const int64_t num_chunks = (length + chunk_size - 1) / chunk_size;
+  std::vector<ArrayVector> chunks(n_columns, ArrayVector(num_chunks));
+  const int num_tasks = static_cast<int>(num_chunks * n_columns);
+  ARROW_RETURN_NOT_OK(::arrow::internal::ParallelFor(num_tasks, [&](int task) {
+    const int64_t chunk = task / static_cast<int64_t>(n_columns);
+    const std::size_t column = task % n_columns;
+    const int64_t offset = chunk * chunk_size;
+    const int64_t chunk_length = std::min(chunk_size, length - offset);
+    return makers[column](pool, begin + offset, begin + offset + chunk_length,
+                          chunk_length, &chunks[column][chunk]);
+  }));
+
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (std::size_t i = 0; i < n_columns; ++i) {
+    columns.push_back(
+        std::make_shared<ChunkedArray>(std::move(chunks[i]), schema->field(i)->type()));
+  }
+  *table = Table::Make(schema, columns, length);
 
   return Status::OK();
 }
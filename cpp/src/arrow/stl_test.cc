@@ -188,6 +188,44 @@ TEST(TestTableFromTupleVector, ReferenceTuple) {
   ASSERT_TRUE(expected_table->Equals(*table));
 }
 
+TEST(TestTableFromTupleVector, Parallel) {
+  using tuple_type =
+      std::tuple<int32_t, double, bool, std::string, std::vector<int64_t>>;
+  std::vector<std::string> names{"column1", "column2", "column3", "column4", "column5"};
+
+  std::vector<tuple_type> rows;
+  for (int32_t i = 0; i < 1000; ++i) {
+    rows.emplace_back(i, i * 0.5, i % 3 == 0, std::string(i % 7, 'x'),
+                      std::vector<int64_t>(i % 4, i));
+  }
+  std::shared_ptr<Table> expected_table;
+  ASSERT_OK(TableFromTupleRange(default_memory_pool(), rows, names, &expected_table));
+  ASSERT_EQ(1000, expected_table->num_rows());
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK(
+      TableFromTupleRangeParallel(default_memory_pool(), rows, names, 64, &table));
+  ASSERT_OK(table->Validate());
+  ASSERT_EQ(16, table->column(0)->num_chunks());
+  ASSERT_EQ(40, table->column(4)->chunk(15)->length());
+  ASSERT_TRUE(expected_table->Equals(*table));
+
+  // A single slice is converted on the calling thread
+  ASSERT_OK(
+      TableFromTupleRangeParallel(default_memory_pool(), rows, names, 1000, &table));
+  ASSERT_EQ(1, table->column(3)->num_chunks());
+  ASSERT_TRUE(expected_table->Equals(*table));
+
+  std::vector<tuple_type> no_rows;
+  ASSERT_OK(
+      TableFromTupleRangeParallel(default_memory_pool(), no_rows, names, 64, &table));
+  ASSERT_EQ(0, table->num_rows());
+  ASSERT_EQ(5, table->num_columns());
+
+  ASSERT_RAISES(Invalid, TableFromTupleRangeParallel(default_memory_pool(), rows, names,
+                                                     0, &table));
+}
+
 TEST(TestTupleVectorFromTable, PrimitiveTypes) {
   compute::FunctionContext ctx;
   compute::CastOptions cast_options;
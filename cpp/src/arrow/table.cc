@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -28,10 +29,13 @@
 #include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/stl.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -47,10 +51,13 @@ ChunkedArray::ChunkedArray(const ArrayVector& chunks) : chunks_(chunks) {
   ARROW_CHECK_GT(chunks.size(), 0)
       << "cannot construct ChunkedArray from empty vector and omitted type";
   type_ = chunks[0]->type();
+  chunk_offsets_.reserve(chunks.size() + 1);
   for (const std::shared_ptr<Array>& chunk : chunks) {
+    chunk_offsets_.push_back(length_);
     length_ += chunk->length();
     null_count_ += chunk->null_count();
   }
+  chunk_offsets_.push_back(length_);
 }
 
 ChunkedArray::ChunkedArray(const ArrayVector& chunks,
@@ -58,10 +65,13 @@ ChunkedArray::ChunkedArray(const ArrayVector& chunks,
     : chunks_(chunks), type_(type) {
   length_ = 0;
   null_count_ = 0;
+  chunk_offsets_.reserve(chunks.size() + 1);
   for (const std::shared_ptr<Array>& chunk : chunks) {
+    chunk_offsets_.push_back(length_);
     length_ += chunk->length();
     null_count_ += chunk->null_count();
   }
+  chunk_offsets_.push_back(length_);
 }
 
 bool ChunkedArray::Equals(const ChunkedArray& other) const {
@@ -552,6 +562,189 @@ Status Table::CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Convert a table to a tensor
+
+namespace {
+
+// Large tables are copied into tensors by several threads, each of which
+// copies at least this many bytes
+constexpr int64_t kTensorBytesPerTask = 1 << 20;
+
+// Rows of a row-major copy are transposed this many at a time, so that the
+// output rows being written stay in cache across the columns
+constexpr int64_t kTensorRowsPerTile = 256;
+
+// The values of the non-empty chunks of a column, chunk_starts[i] being the
+// first row of chunk i and chunk_starts.back() the number of rows
+struct TensorColumn {
+  std::vector<std::shared_ptr<Buffer>> chunk_buffers;
+  std::vector<const uint8_t*> chunk_values;
+  std::vector<int64_t> chunk_starts;
+};
+
+// Call func(values, row, length) for the chunk pieces of the rows [begin, end)
+// of the column, values pointing at row `row`
+template <typename Function>
+void VisitColumnRows(const TensorColumn& column, int byte_width, int64_t begin,
+                     int64_t end, Function&& func) {
+  const auto& starts = column.chunk_starts;
+  size_t chunk =
+      std::upper_bound(starts.begin(), starts.end(), begin) - starts.begin() - 1;
+  for (int64_t row = begin; row < end; ++chunk) {
+    const int64_t length = std::min(end, starts[chunk + 1]) - row;
+    func(column.chunk_values[chunk] + (row - starts[chunk]) * byte_width, row, length);
+    row += length;
+  }
+}
+
+template <typename T>
+void CopyRowMajor(const std::vector<TensorColumn>& columns, int64_t begin, int64_t end,
+                  uint8_t* out) {
+  const int64_t num_columns = static_cast<int64_t>(columns.size());
+  T* out_values = reinterpret_cast<T*>(out);
+  for (int64_t tile = begin; tile < end; tile += kTensorRowsPerTile) {
+    const int64_t tile_end = std::min(end, tile + kTensorRowsPerTile);
+    for (int64_t i = 0; i < num_columns; ++i) {
+      VisitColumnRows(columns[i], sizeof(T), tile, tile_end,
+                      [&](const uint8_t* data, int64_t row, int64_t length) {
+                        const T* values = reinterpret_cast<const T*>(data);
+                        T* dst = out_values + row * num_columns + i;
+                        for (int64_t j = 0; j < length; ++j) {
+                          dst[j * num_columns] = values[j];
+                        }
+                      });
+    }
+  }
+}
+
+void CopyColumnMajor(const std::vector<TensorColumn>& columns, int byte_width,
+                     int64_t num_rows, int64_t begin, int64_t end, uint8_t* out) {
+  for (size_t i = 0; i < columns.size(); ++i) {
+    uint8_t* column_out = out + i * num_rows * byte_width;
+    VisitColumnRows(columns[i], byte_width, begin, end,
+                    [&](const uint8_t* data, int64_t row, int64_t length) {
+                      std::memcpy(column_out + row * byte_width, data,
+                                  length * byte_width);
+                    });
+  }
+}
+
+// The slice of size bytes at data of the root buffer of buffer, or null if
+// the root buffer doesn't hold them
+std::shared_ptr<Buffer> SliceRootBuffer(std::shared_ptr<Buffer> buffer,
+                                        const uint8_t* data, int64_t size) {
+  while (buffer->parent() != nullptr) {
+    buffer = buffer->parent();
+  }
+  if (data < buffer->data() || data + size > buffer->data() + buffer->size()) {
+    return nullptr;
+  }
+  return SliceBuffer(buffer, data - buffer->data(), size);
+}
+
+}  // namespace
+
+Status Table::ToTensor(bool row_major, MemoryPool* pool,
+                       std::shared_ptr<Tensor>* out) const {
+  const int ncolumns = num_columns();
+  if (ncolumns == 0) {
+    return Status::Invalid("Cannot convert a table without columns to a tensor");
+  }
+  const auto& type = column(0)->type();
+  if (!is_tensor_supported(type->id())) {
+    return Status::TypeError("Cannot convert columns of type ", type->ToString(),
+                             " to a tensor");
+  }
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t nrows = num_rows();
+
+  std::vector<TensorColumn> columns(ncolumns);
+  bool single_chunks = true;
+  for (int i = 0; i < ncolumns; ++i) {
+    const ChunkedArray& chunked = *column(i);
+    if (!chunked.type()->Equals(*type)) {
+      return Status::TypeError("Cannot convert columns of types ", type->ToString(),
+                               " and ", chunked.type()->ToString(), " to a tensor");
+    }
+    if (chunked.null_count() > 0) {
+      return Status::Invalid("Cannot convert column ", i, " with nulls to a tensor");
+    }
+    TensorColumn& column = columns[i];
+    column.chunk_starts.push_back(0);
+    for (const auto& chunk : chunked.chunks()) {
+      if (chunk->length() == 0) {
+        continue;
+      }
+      const ArrayData& data = *chunk->data();
+      column.chunk_buffers.push_back(data.buffers[1]);
+      column.chunk_values.push_back(data.buffers[1]->data() + data.offset * byte_width);
+      column.chunk_starts.push_back(column.chunk_starts.back() + data.length);
+    }
+    single_chunks &= column.chunk_values.size() == 1;
+  }
+
+  const std::vector<int64_t> shape = {nrows, ncolumns};
+  const std::vector<int64_t> strides =
+      row_major ? std::vector<int64_t>{ncolumns * byte_width, byte_width}
+                : std::vector<int64_t>{byte_width, nrows * byte_width};
+  const int64_t nbytes = nrows * ncolumns * byte_width;
+
+  // Zero-copy if the values already are in tensor order
+  if (single_chunks && (ncolumns == 1 || !row_major)) {
+    bool adjacent = true;
+    const uint8_t* first = columns[0].chunk_values[0];
+    for (int i = 1; i < ncolumns && adjacent; ++i) {
+      adjacent = columns[i].chunk_values[0] == first + i * nrows * byte_width;
+    }
+    auto data =
+        adjacent ? SliceRootBuffer(columns[0].chunk_buffers[0], first, nbytes) : nullptr;
+    if (data != nullptr) {
+      *out = std::make_shared<Tensor>(type, data, shape, strides);
+      return Status::OK();
+    }
+  }
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, nbytes, &data));
+  uint8_t* out_data = data->mutable_data();
+
+  const int num_tasks = static_cast<int>(std::max<int64_t>(
+      1, std::min<int64_t>(GetCpuThreadPoolCapacity(), nbytes / kTensorBytesPerTask)));
+  const int64_t rows_per_task = (nrows + num_tasks - 1) / num_tasks;
+  auto copy_rows = [&](int task) {
+    const int64_t begin = std::min(nrows, task * rows_per_task);
+    const int64_t end = std::min(nrows, begin + rows_per_task);
+    if (!row_major) {
+      CopyColumnMajor(columns, byte_width, nrows, begin, end, out_data);
+      return Status::OK();
+    }
+    switch (byte_width) {
+      case 1:
+        CopyRowMajor<uint8_t>(columns, begin, end, out_data);
+        break;
+      case 2:
+        CopyRowMajor<uint16_t>(columns, begin, end, out_data);
+        break;
+      case 4:
+        CopyRowMajor<uint32_t>(columns, begin, end, out_data);
+        break;
+      default:
+        CopyRowMajor<uint64_t>(columns, begin, end, out_data);
+        break;
+    }
+    return Status::OK();
+  };
+  if (num_tasks == 1) {
+    RETURN_NOT_OK(copy_rows(0));
+  } else {
+    RETURN_NOT_OK(internal::ParallelFor(num_tasks, copy_rows));
+  }
+
+  *out = std::make_shared<Tensor>(type, data, shape, strides);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
@@ -33,6 +33,7 @@ namespace arrow {
 
 class MemoryPool;
 class Status;
+class Tensor;
 
 /// \class ChunkedArray
 /// \brief A data structure managing a list of primitive Arrow arrays logically
@@ -67,6 +68,12 @@ class ARROW_EXPORT ChunkedArray {
 
   const ArrayVector& chunks() const { return chunks_; }
 
+  /// \brief the logical position of the first element of each chunk,
+  /// followed by the total length; computed on construction
+  ///
+  /// The chunk holding a logical position can be found by binary search.
+  const std::vector<int64_t>& chunk_offsets() const { return chunk_offsets_; }
+
   /// \brief Construct a zero-copy slice of the chunked array with the
   /// indicated offset and length
   ///
@@ -109,6 +116,7 @@ class ARROW_EXPORT ChunkedArray {
 
  protected:
   ArrayVector chunks_;
+  std::vector<int64_t> chunk_offsets_;
   int64_t length_;
   int64_t null_count_;
   std::shared_ptr<DataType> type_;
@@ -255,12 +263,27 @@ class ARROW_EXPORT Table {
   /// \brief Make a new table by combining the chunks this table has.
   ///
   /// All the underlying chunks in the ChunkedArray of each column are
-  /// concatenated into zero or one chunk.
+  /// concatenated into zero or one chunk.  Large columns are copied using
+  /// several threads, see Concatenate().
   ///
   /// \param[in] pool The pool for buffer allocations
   /// \param[out] out The table with chunks combined
   Status CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const;
 
+  /// \brief Convert the table to a 2-dim tensor whose columns are the table's
+  ///
+  /// All the columns must be of the same numeric type and have no nulls.  The
+  /// values are copied by several threads when there are many of them.  No
+  /// copy is made for a single column, nor for a column-major tensor whose
+  /// columns already lie one after the other in a common buffer.
+  ///
+  /// \param[in] row_major whether the tensor is row-major (C order) rather
+  /// than column-major (Fortran order)
+  /// \param[in] pool The pool for buffer allocations, if any
+  /// \param[out] out The tensor of shape {num_rows(), num_columns()}
+  /// \return Status
+  Status ToTensor(bool row_major, MemoryPool* pool, std::shared_ptr<Tensor>* out) const;
+
  protected:
   Table();
 
@@ -17,6 +17,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <gmock/gmock.h>
@@ -26,7 +27,9 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/tensor.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
@@ -136,6 +139,18 @@ TEST_F(TestChunkedArray, SliceEquals) {
   ASSERT_TRUE(slice5->type()->Equals(one_->type()));
 }
 
+TEST_F(TestChunkedArray, ChunkOffsets) {
+  arrays_one_.push_back(MakeRandomArray<Int32Array>(100));
+  arrays_one_.push_back(MakeRandomArray<Int32Array>(0));
+  arrays_one_.push_back(MakeRandomArray<Int32Array>(50));
+  Construct();
+  ASSERT_EQ(one_->chunk_offsets(), std::vector<int64_t>({0, 100, 100, 150}));
+  ASSERT_EQ(one_->Slice(120)->chunk_offsets(), std::vector<int64_t>({0, 30}));
+
+  ChunkedArray empty(ArrayVector{}, int32());
+  ASSERT_EQ(empty.chunk_offsets(), std::vector<int64_t>({0}));
+}
+
 TEST_F(TestChunkedArray, Validate) {
   // Valid if empty
   ArrayVector empty = {};
@@ -375,6 +390,98 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+template <typename T>
+std::vector<T> TensorValues(const Tensor& tensor) {
+  const T* values = reinterpret_cast<const T*>(tensor.raw_data());
+  return std::vector<T>(values, values + tensor.size());
+}
+
+TEST_F(TestTable, ToTensor) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", int32())});
+  auto a = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[]"),
+                  ArrayFromJSON(int32(), "[3, 4, 5]")});
+  auto b = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[6]"), ArrayFromJSON(int32(), "[7, 8, 9, 10]")});
+  auto table = Table::Make(schema, {a, b});
+
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(table->ToTensor(true, default_memory_pool(), &tensor));
+  ASSERT_EQ(std::vector<int64_t>({5, 2}), tensor->shape());
+  ASSERT_TRUE(tensor->is_row_major());
+  ASSERT_EQ(std::vector<int32_t>({1, 6, 2, 7, 3, 8, 4, 9, 5, 10}),
+            TensorValues<int32_t>(*tensor));
+
+  ASSERT_OK(table->ToTensor(false, default_memory_pool(), &tensor));
+  ASSERT_EQ(std::vector<int64_t>({5, 2}), tensor->shape());
+  ASSERT_TRUE(tensor->is_column_major());
+  ASSERT_EQ(std::vector<int32_t>({1, 2, 3, 4, 5, 6, 7, 8, 9, 10}),
+            TensorValues<int32_t>(*tensor));
+
+  // Slices of the table
+  ASSERT_OK(table->Slice(1, 3)->ToTensor(true, default_memory_pool(), &tensor));
+  ASSERT_EQ(std::vector<int32_t>({2, 7, 3, 8, 4, 9}), TensorValues<int32_t>(*tensor));
+}
+
+TEST_F(TestTable, ToTensorInvalid) {
+  std::shared_ptr<Tensor> tensor;
+  auto empty = Table::Make(::arrow::schema({}), std::vector<std::shared_ptr<Array>>{});
+  ASSERT_RAISES(Invalid, empty->ToTensor(true, default_memory_pool(), &tensor));
+
+  auto with_nulls = Table::Make(::arrow::schema({field("a", float64())}),
+                                {ArrayFromJSON(float64(), "[1, null]")});
+  ASSERT_RAISES(Invalid, with_nulls->ToTensor(true, default_memory_pool(), &tensor));
+
+  auto mixed_schema = ::arrow::schema({field("a", int32()), field("b", int64())});
+  auto mixed = Table::Make(mixed_schema, {ArrayFromJSON(int32(), "[1]"),
+                                          ArrayFromJSON(int64(), "[2]")});
+  ASSERT_RAISES(TypeError, mixed->ToTensor(true, default_memory_pool(), &tensor));
+
+  auto strings = Table::Make(::arrow::schema({field("a", utf8())}),
+                             {ArrayFromJSON(utf8(), R"(["a"])")});
+  ASSERT_RAISES(TypeError, strings->ToTensor(true, default_memory_pool(), &tensor));
+}
+
+TEST_F(TestTable, ToTensorLarge) {
+  // Large enough to be copied by several threads
+  const int64_t length = 1 << 18;
+  const int ncolumns = 5;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < ncolumns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), float64()));
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < length;) {
+      const int64_t chunk_length = std::min<int64_t>(length - offset, 10000 + 777 * i);
+      std::vector<double> values(chunk_length);
+      for (int64_t j = 0; j < chunk_length; ++j) {
+        values[j] = static_cast<double>((offset + j) * ncolumns + i);
+      }
+      std::shared_ptr<Array> chunk;
+      ArrayFromVector<DoubleType, double>(values, &chunk);
+      chunks.push_back(chunk);
+      offset += chunk_length;
+    }
+    columns.push_back(std::make_shared<ChunkedArray>(chunks));
+  }
+  auto table = Table::Make(::arrow::schema(fields), columns);
+
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(table->ToTensor(true, default_memory_pool(), &tensor));
+  auto values = TensorValues<double>(*tensor);
+  for (int64_t j = 0; j < length * ncolumns; ++j) {
+    ASSERT_EQ(static_cast<double>(j), values[j]);
+  }
+
+  ASSERT_OK(table->ToTensor(false, default_memory_pool(), &tensor));
+  values = TensorValues<double>(*tensor);
+  for (int i = 0; i < ncolumns; ++i) {
+    for (int64_t j = 0; j < length; ++j) {
+      ASSERT_EQ(static_cast<double>(j * ncolumns + i), values[i * length + j]);
+    }
+  }
+}
+
 TEST_F(TestTable, ConcatenateTables) {
   const int64_t length = 10;
 
@@ -751,6 +858,59 @@ TEST_F(TestRecordBatch, RemoveColumnEmpty) {
   ASSERT_TRUE(added->Equals(*batch1));
 }
 
+TEST_F(TestRecordBatch, ToTensor) {
+  auto schema = ::arrow::schema({field("a", int64()), field("b", int64())});
+  auto batch = RecordBatch::Make(schema, 3,
+                                 {ArrayFromJSON(int64(), "[1, 2, 3]"),
+                                  ArrayFromJSON(int64(), "[4, 5, 6]")});
+
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(batch->ToTensor(true, default_memory_pool(), &tensor));
+  ASSERT_EQ(std::vector<int64_t>({3, 2}), tensor->shape());
+  ASSERT_EQ(std::vector<int64_t>({1, 4, 2, 5, 3, 6}), TensorValues<int64_t>(*tensor));
+
+  ASSERT_OK(batch->ToTensor(false, default_memory_pool(), &tensor));
+  ASSERT_EQ(std::vector<int64_t>({1, 2, 3, 4, 5, 6}), TensorValues<int64_t>(*tensor));
+}
+
+TEST_F(TestRecordBatch, ToTensorZeroCopy) {
+  const int64_t length = 4;
+  std::vector<int64_t> values = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+  auto buffer = Buffer::Wrap(values);
+  auto schema = ::arrow::schema({field("a", int64()), field("b", int64())});
+
+  // A single column
+  auto column = std::make_shared<Int64Array>(length, SliceBuffer(buffer, 8, 32));
+  auto single = RecordBatch::Make(::arrow::schema({field("a", int64())}), length - 1,
+                                  {column->Slice(1)});
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(single->ToTensor(true, default_memory_pool(), &tensor));
+  ASSERT_EQ(std::vector<int64_t>({3, 1}), tensor->shape());
+  ASSERT_EQ(buffer->data() + 16, tensor->raw_data());
+  ASSERT_EQ(std::vector<int64_t>({3, 4, 5}), TensorValues<int64_t>(*tensor));
+
+  // Columns one after the other in a common buffer
+  auto batch = RecordBatch::Make(
+      schema, length,
+      {std::make_shared<Int64Array>(length, SliceBuffer(buffer, 32, 32)),
+       std::make_shared<Int64Array>(length, SliceBuffer(buffer, 64, 32))});
+  ASSERT_OK(batch->ToTensor(false, default_memory_pool(), &tensor));
+  ASSERT_EQ(buffer->data() + 32, tensor->raw_data());
+  ASSERT_TRUE(tensor->is_column_major());
+  ASSERT_EQ(std::vector<int64_t>({5, 6, 7, 8, 9, 10, 11, 12}),
+            TensorValues<int64_t>(*tensor));
+
+  // Not adjacent, the values are copied
+  batch = RecordBatch::Make(
+      schema, length,
+      {std::make_shared<Int64Array>(length, SliceBuffer(buffer, 64, 32)),
+       std::make_shared<Int64Array>(length, SliceBuffer(buffer, 32, 32))});
+  ASSERT_OK(batch->ToTensor(false, default_memory_pool(), &tensor));
+  ASSERT_NE(buffer->data() + 64, tensor->raw_data());
+  ASSERT_EQ(std::vector<int64_t>({9, 10, 11, 12, 5, 6, 7, 8}),
+            TensorValues<int64_t>(*tensor));
+}
+
 class TestTableBatchReader : public TestBase {};
 
 TEST_F(TestTableBatchReader, ReadNext) {
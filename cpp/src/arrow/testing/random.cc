@@ -18,6 +18,7 @@
 #include "arrow/testing/random.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <random>
 #include <vector>
@@ -26,11 +27,13 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace random {
@@ -236,5 +239,215 @@ std::shared_ptr<arrow::Array> RandomArrayGenerator::StringWithRepeats(
   ABORT_NOT_OK(builder.Finish(&result));
   return result;
 }
+
+namespace {
+
+// Binary values of letters, with lengths of the given shape
+template <typename TypeClass>
+std::shared_ptr<Array> GenerateShapedBinary(SeedType seed, int64_t size,
+                                            const ArrayShape& shape) {
+  using BuilderType = typename TypeTraits<TypeClass>::BuilderType;
+
+  std::default_random_engine rng(seed);
+  std::uniform_int_distribution<int32_t> uniform_length(shape.min_length,
+                                                        shape.max_length);
+  const double mean_extra_length = (shape.max_length - shape.min_length) / 4.0;
+  std::geometric_distribution<int32_t> extra_length(1.0 / (1.0 + mean_extra_length));
+  std::uniform_int_distribution<int> letter('A', 'z');
+
+  std::string value;
+  BuilderType builder;
+  for (int64_t i = 0; i < size; ++i) {
+    const int32_t length =
+        shape.length_distribution == ArrayShape::UNIFORM
+            ? uniform_length(rng)
+            : std::min(shape.max_length, shape.min_length + extra_length(rng));
+    value.resize(length);
+    for (auto& c : value) {
+      c = static_cast<char>(letter(rng));
+    }
+    ABORT_NOT_OK(builder.Append(value));
+  }
+  std::shared_ptr<Array> result;
+  ABORT_NOT_OK(builder.Finish(&result));
+  return result;
+}
+
+template <typename ArrowType>
+std::shared_ptr<Array> GenerateFullRange(RandomArrayGenerator* gen, int64_t size) {
+  using CType = typename ArrowType::c_type;
+  return gen->Numeric<ArrowType>(size, std::numeric_limits<CType>::lowest(),
+                                 std::numeric_limits<CType>::max());
+}
+
+std::shared_ptr<Array> ViewAs(const std::shared_ptr<Array>& array,
+                              const std::shared_ptr<DataType>& type) {
+  std::shared_ptr<Array> out;
+  ABORT_NOT_OK(array->View(type, &out));
+  return out;
+}
+
+// The non-null values which a shaped array is drawn from
+std::shared_ptr<Array> GenerateShapedValues(RandomArrayGenerator* gen,
+                                            const std::shared_ptr<DataType>& type,
+                                            int64_t size, const ArrayShape& shape) {
+  constexpr int64_t kDays = 100000;
+  switch (type->id()) {
+    case Type::BOOL:
+      return gen->Boolean(size, 0.5);
+    case Type::UINT8:
+      return GenerateFullRange<UInt8Type>(gen, size);
+    case Type::INT8:
+      return GenerateFullRange<Int8Type>(gen, size);
+    case Type::UINT16:
+      return GenerateFullRange<UInt16Type>(gen, size);
+    case Type::INT16:
+      return GenerateFullRange<Int16Type>(gen, size);
+    case Type::UINT32:
+      return GenerateFullRange<UInt32Type>(gen, size);
+    case Type::INT32:
+      return GenerateFullRange<Int32Type>(gen, size);
+    case Type::UINT64:
+      return GenerateFullRange<UInt64Type>(gen, size);
+    case Type::INT64:
+      return GenerateFullRange<Int64Type>(gen, size);
+    case Type::FLOAT:
+      return gen->Float32(size, -1e6, 1e6);
+    case Type::DOUBLE:
+      return gen->Float64(size, -1e6, 1e6);
+    case Type::DATE32:
+      return ViewAs(gen->Int32(size, 0, kDays - 1), type);
+    case Type::TIMESTAMP: {
+      static const int64_t kPerSecond[] = {1, 1000, 1000000, 1000000000};
+      const auto unit = internal::checked_cast<const TimestampType&>(*type).unit();
+      const int64_t max = kDays * 86400 * kPerSecond[static_cast<int>(unit)] - 1;
+      return ViewAs(gen->Int64(size, 0, max), type);
+    }
+    case Type::BINARY:
+      return GenerateShapedBinary<BinaryType>(gen->seed(), size, shape);
+    case Type::STRING:
+      return GenerateShapedBinary<StringType>(gen->seed(), size, shape);
+    case Type::LARGE_BINARY:
+      return GenerateShapedBinary<LargeBinaryType>(gen->seed(), size, shape);
+    case Type::LARGE_STRING:
+      return GenerateShapedBinary<LargeStringType>(gen->seed(), size, shape);
+    default:
+      break;
+  }
+  ABORT_NOT_OK(Status::NotImplemented("Generating arrays of type ", type->ToString()));
+  return NULLPTR;
+}
+
+// The values at the given indices, null where the validity bitmap isn't set.
+// Null binary values are empty.
+template <typename offset_type>
+void GatherBinary(const ArrayData& values, const std::vector<int64_t>& indices,
+                  const uint8_t* validity, ArrayData* out) {
+  const int64_t size = static_cast<int64_t>(indices.size());
+  const auto* offsets = values.GetValues<offset_type>(1);
+  const uint8_t* data = values.buffers[2]->data();
+
+  ABORT_NOT_OK(AllocateBuffer((size + 1) * sizeof(offset_type), &out->buffers[1]));
+  auto out_offsets = reinterpret_cast<offset_type*>(out->buffers[1]->mutable_data());
+  out_offsets[0] = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    const bool valid = validity == NULLPTR || BitUtil::GetBit(validity, i);
+    const offset_type length =
+        valid ? offsets[indices[i] + 1] - offsets[indices[i]] : 0;
+    out_offsets[i + 1] = out_offsets[i] + length;
+  }
+  ABORT_NOT_OK(AllocateBuffer(out_offsets[size], &out->buffers[2]));
+  uint8_t* out_data = out->buffers[2]->mutable_data();
+  for (int64_t i = 0; i < size; ++i) {
+    std::memcpy(out_data + out_offsets[i], data + offsets[indices[i]],
+                out_offsets[i + 1] - out_offsets[i]);
+  }
+}
+
+void GatherFixedWidth(const ArrayData& values, const std::vector<int64_t>& indices,
+                      ArrayData* out) {
+  const int64_t size = static_cast<int64_t>(indices.size());
+  const int bit_width =
+      internal::checked_cast<const FixedWidthType&>(*values.type).bit_width();
+  const uint8_t* data = values.buffers[1]->data();
+  if (bit_width == 1) {
+    ABORT_NOT_OK(AllocateEmptyBitmap(size, &out->buffers[1]));
+    uint8_t* out_data = out->buffers[1]->mutable_data();
+    for (int64_t i = 0; i < size; ++i) {
+      if (BitUtil::GetBit(data, indices[i])) {
+        BitUtil::SetBit(out_data, i);
+      }
+    }
+    return;
+  }
+  const int byte_width = bit_width / 8;
+  ABORT_NOT_OK(AllocateBuffer(size * byte_width, &out->buffers[1]));
+  uint8_t* out_data = out->buffers[1]->mutable_data();
+  for (int64_t i = 0; i < size; ++i) {
+    std::memcpy(out_data + i * byte_width, data + indices[i] * byte_width, byte_width);
+  }
+}
+
+}  // namespace
+
+std::shared_ptr<Array> RandomArrayGenerator::ArrayOf(
+    const std::shared_ptr<DataType>& type, int64_t size, const ArrayShape& shape) {
+  if (shape.null_probability < 0 || shape.null_probability > 1) {
+    ABORT_NOT_OK(Status::Invalid("null_probability must be between 0 and 1"));
+  }
+  std::default_random_engine rng(seed());
+
+  // Pick the value of each run
+  std::vector<int64_t> indices(size);
+  std::geometric_distribution<int64_t> extra_run_length(
+      1.0 / std::max(shape.mean_run_length, 1.0));
+  std::uniform_int_distribution<int64_t> pick(
+      0, std::max<int64_t>(shape.cardinality - 1, 0));
+  int64_t num_runs = 0;
+  for (int64_t i = 0; i < size; ++num_runs) {
+    const int64_t index = shape.cardinality > 0 ? pick(rng) : num_runs;
+    const int64_t run_end = std::min(size, i + 1 + extra_run_length(rng));
+    for (; i < run_end; ++i) {
+      indices[i] = index;
+    }
+  }
+  const int64_t num_values = shape.cardinality > 0 ? shape.cardinality : num_runs;
+  auto values = GenerateShapedValues(this, type, num_values, shape);
+
+  auto out = ArrayData::Make(type, size, {NULLPTR, NULLPTR}, 0);
+  if (shape.null_probability > 0) {
+    GenerateOptions<int, std::uniform_int_distribution<int>> null_gen(
+        seed(), 0, 1, shape.null_probability);
+    ABORT_NOT_OK(AllocateEmptyBitmap(size, &out->buffers[0]));
+    null_gen.GenerateBitmap(out->buffers[0]->mutable_data(), size, &out->null_count);
+  }
+  const uint8_t* validity = out->buffers[0] ? out->buffers[0]->data() : NULLPTR;
+  switch (type->id()) {
+    case Type::BINARY:
+    case Type::STRING:
+      out->buffers.resize(3);
+      GatherBinary<int32_t>(*values->data(), indices, validity, out.get());
+      break;
+    case Type::LARGE_BINARY:
+    case Type::LARGE_STRING:
+      out->buffers.resize(3);
+      GatherBinary<int64_t>(*values->data(), indices, validity, out.get());
+      break;
+    default:
+      GatherFixedWidth(*values->data(), indices, out.get());
+      break;
+  }
+  return MakeArray(out);
+}
+
+std::shared_ptr<RecordBatch> RandomArrayGenerator::BatchOf(
+    const std::shared_ptr<Schema>& schema, int64_t size, const ArrayShape& shape) {
+  ArrayVector columns;
+  for (const auto& field : schema->fields()) {
+    columns.push_back(ArrayOf(field->type(), size, shape));
+  }
+  return RecordBatch::Make(schema, size, columns);
+}
+
 }  // namespace random
 }  // namespace arrow
@@ -31,12 +31,39 @@
 namespace arrow {
 
 class Array;
+class RecordBatch;
 
 namespace random {
 
 using SeedType = std::random_device::result_type;
 constexpr SeedType kSeedMax = std::numeric_limits<SeedType>::max();
 
+/// \brief The distribution of the values of an array generated by
+/// RandomArrayGenerator::ArrayOf
+struct ARROW_EXPORT ArrayShape {
+  enum LengthDistribution {
+    /// Lengths uniform between min_length and max_length
+    UNIFORM,
+    /// Lengths of min_length plus a geometric variable of mean a quarter of
+    /// max_length - min_length, capped to max_length: mostly short values and
+    /// a few long ones
+    GEOMETRIC
+  };
+
+  /// The probability of a slot being null
+  double null_probability = 0;
+  /// The number of distinct non-null values (though some may be equal), or 0
+  /// for a value drawn anew for each run
+  int64_t cardinality = 0;
+  /// The lengths of binary and string values, in bytes
+  int32_t min_length = 0;
+  int32_t max_length = 16;
+  LengthDistribution length_distribution = UNIFORM;
+  /// The mean length of the runs of equal consecutive values, whose lengths
+  /// are geometric; 1 for no runs
+  double mean_run_length = 1;
+};
+
 class ARROW_EXPORT RandomArrayGenerator {
  public:
   explicit RandomArrayGenerator(SeedType seed)
@@ -249,6 +276,27 @@ class ARROW_EXPORT RandomArrayGenerator {
                                                   int32_t min_length, int32_t max_length,
                                                   double null_probability = 0);
 
+  /// \brief Generates a random array of the given shape
+  ///
+  /// Non-null values are drawn from the whole range of integer types, from
+  /// [-1e6, 1e6] for floating point types, from letters for binary and
+  /// string types, and from the 100000 days from 1970 for date32 and
+  /// timestamp types.
+  ///
+  /// \param[in] type the type of the array: boolean, a numeric, binary,
+  ///            string, date32 or timestamp type
+  /// \param[in] size the size of the array to generate
+  /// \param[in] shape the distribution of the values
+  ///
+  /// \return a generated Array
+  std::shared_ptr<arrow::Array> ArrayOf(const std::shared_ptr<DataType>& type,
+                                        int64_t size, const ArrayShape& shape);
+
+  /// \brief Generates a random record batch, all of whose columns have the
+  /// given shape
+  std::shared_ptr<arrow::RecordBatch> BatchOf(const std::shared_ptr<Schema>& schema,
+                                              int64_t size, const ArrayShape& shape);
+
   SeedType seed() { return seed_distribution_(seed_rng_); }
 
  private:
@@ -17,8 +17,10 @@
 
 #include "arrow/type.h"
 
+#include <algorithm>
 #include <climits>
 #include <cstddef>
+#include <mutex>
 #include <ostream>
 #include <sstream>  // IWYU pragma: keep
 #include <string>
@@ -66,10 +68,9 @@ std::vector<std::shared_ptr<Field>> Field::Flatten() const {
   std::vector<std::shared_ptr<Field>> flattened;
   if (type_->id() == Type::STRUCT) {
     for (const auto& child : type_->children()) {
-      auto flattened_child = child->Copy();
-      flattened.push_back(flattened_child);
-      flattened_child->name_.insert(0, name() + ".");
-      flattened_child->nullable_ |= nullable_;
+      flattened.push_back(::arrow::field(name_ + "." + child->name_, child->type_,
+                                         child->nullable_ || nullable_,
+                                         child->metadata_));
     }
   } else {
     flattened.push_back(this->Copy());
@@ -78,7 +79,7 @@ std::vector<std::shared_ptr<Field>> Field::Flatten() const {
 }
 
 std::shared_ptr<Field> Field::Copy() const {
-  return ::arrow::field(name_, type_, nullable_, metadata_);
+  return std::make_shared<Field>(name_, type_, nullable_, metadata_);
 }
 
 bool Field::Equals(const Field& other, bool check_metadata) const {
@@ -540,6 +541,17 @@ bool Schema::Equals(const Schema& other, bool check_metadata) const {
     return false;
   }
 
+  // Fast path for schemas sharing their fields, e.g. fields made by the
+  // (interning) factory functions
+  const auto& fields = impl_->fields_;
+  const auto& other_fields = other.impl_->fields_;
+  if (std::equal(fields.begin(), fields.end(), other_fields.begin())) {
+    if (!check_metadata || (!HasMetadata() && !other.HasMetadata())) {
+      return true;
+    }
+    return metadata_fingerprint() == other.metadata_fingerprint();
+  }
+
   if (check_metadata) {
     const auto& metadata_fp = metadata_fingerprint();
     const auto& other_metadata_fp = other.metadata_fingerprint();
@@ -787,26 +799,27 @@ std::string Field::ComputeFingerprint() const {
     // Underlying DataType doesn't support fingerprinting.
     return "";
   }
-  std::stringstream ss;
-  ss << 'F';
-  if (nullable_) {
-    ss << 'n';
-  } else {
-    ss << 'N';
-  }
-  ss << name_;
-  ss << '{' << type_fingerprint << '}';
-  return ss.str();
+  // Since field names can contain arbitrary characters, prefix with
+  // string length to disambiguate.
+  std::string s = nullable_ ? "Fn" : "FN";
+  s += std::to_string(name_.length()) + ':' + name_;
+  s += '{' + type_fingerprint + '}';
+  return s;
 }
 
 std::string Field::ComputeMetadataFingerprint() const {
-  std::stringstream ss;
+  std::string s;
   if (metadata_) {
+    std::stringstream ss;
     AppendMetadataFingerprint(*metadata_, &ss);
-  } else {
-    AppendEmptyMetadataFingerprint(&ss);
+    s = ss.str();
   }
-  return ss.str();
+  // Include the metadata of nested fields, if any
+  const auto& type_metadata_fingerprint = type_->metadata_fingerprint();
+  if (!type_metadata_fingerprint.empty()) {
+    s += '{' + type_metadata_fingerprint + '}';
+  }
+  return s;
 }
 
 std::string Schema::ComputeFingerprint() const {
@@ -846,12 +859,16 @@ std::string DataType::ComputeFingerprint() const {
 }
 
 std::string DataType::ComputeMetadataFingerprint() const {
-  // Whatever the data type, metadata can only be found on child fields
+  // Whatever the data type, metadata can only be found on child fields.
+  // The fingerprint is empty if none of them has metadata.
   std::string s;
+  bool has_metadata = false;
   for (const auto& child : children_) {
-    s += child->metadata_fingerprint();
+    const auto& child_metadata_fingerprint = child->metadata_fingerprint();
+    has_metadata |= !child_metadata_fingerprint.empty();
+    s += child_metadata_fingerprint + ";";
   }
-  return s;
+  return has_metadata ? s : "";
 }
 
 #define PARAMETER_LESS_FINGERPRINT(TYPE_CLASS)               \
@@ -891,7 +908,7 @@ std::string DictionaryType::ComputeFingerprint() const {
     return TypeIdFingerprint(*this) + index_fingerprint + value_fingerprint +
            ordered_fingerprint;
   }
-  return ordered_fingerprint;
+  return "";
 }
 
 std::string ListType::ComputeFingerprint() const {
@@ -910,6 +927,15 @@ std::string LargeListType::ComputeFingerprint() const {
   return "";
 }
 
+std::string FixedSizeListType::ComputeFingerprint() const {
+  const auto& child_fingerprint = children_[0]->fingerprint();
+  if (!child_fingerprint.empty()) {
+    return TypeIdFingerprint(*this) + "[" + std::to_string(list_size_) + "]{" +
+           child_fingerprint + "}";
+  }
+  return "";
+}
+
 std::string MapType::ComputeFingerprint() const {
   const auto& child_fingerprint = children_[0]->fingerprint();
   if (!child_fingerprint.empty()) {
@@ -979,28 +1005,20 @@ std::string UnionType::ComputeFingerprint() const {
 }
 
 std::string TimeType::ComputeFingerprint() const {
-  std::stringstream ss;
-  ss << TypeIdFingerprint(*this) << TimeUnitFingerprint(unit_);
-  return ss.str();
+  return TypeIdFingerprint(*this) + TimeUnitFingerprint(unit_);
 }
 
 std::string TimestampType::ComputeFingerprint() const {
-  std::stringstream ss;
-  ss << TypeIdFingerprint(*this) << TimeUnitFingerprint(unit_) << timezone_.length()
-     << ':' << timezone_;
-  return ss.str();
+  return TypeIdFingerprint(*this) + TimeUnitFingerprint(unit_) +
+         std::to_string(timezone_.length()) + ':' + timezone_;
 }
 
 std::string IntervalType::ComputeFingerprint() const {
-  std::stringstream ss;
-  ss << TypeIdFingerprint(*this) << IntervalTypeFingerprint(interval_type());
-  return ss.str();
+  return TypeIdFingerprint(*this) + IntervalTypeFingerprint(interval_type());
 }
 
 std::string DurationType::ComputeFingerprint() const {
-  std::stringstream ss;
-  ss << TypeIdFingerprint(*this) << TimeUnitFingerprint(unit_);
-  return ss.str();
+  return TypeIdFingerprint(*this) + TimeUnitFingerprint(unit_);
 }
 
 // ----------------------------------------------------------------------
@@ -1010,6 +1028,114 @@ Status DataType::Accept(TypeVisitor* visitor) const {
   return VisitTypeInline(*this, visitor);
 }
 
+namespace {
+
+// A table of the instances made by the factory functions, so that factory calls
+// with equal arguments share one instance and most equality checks stop at
+// comparing pointers.  The table holds weak references, so an instance is still
+// destroyed once it isn't used anymore.
+template <typename T, typename Key, typename KeyHash = std::hash<Key>>
+class InternTable {
+ public:
+  // Return the live instance for key, or the one returned by make_value()
+  template <typename MakeValue>
+  std::shared_ptr<T> Intern(Key key, MakeValue&& make_value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = instances_.find(key);
+    if (it != instances_.end()) {
+      auto interned = it->second.lock();
+      if (interned) {
+        return interned;
+      }
+      std::shared_ptr<T> value = make_value();
+      it->second = value;
+      return value;
+    }
+    std::shared_ptr<T> value = make_value();
+    if (instances_.size() >= purge_threshold_) {
+      PurgeExpired();
+    }
+    instances_.emplace(std::move(key), value);
+    return value;
+  }
+
+ private:
+  // Drop the entries of destroyed instances, at most once for each doubling
+  // of the table
+  void PurgeExpired() {
+    for (auto it = instances_.begin(); it != instances_.end();) {
+      if (it->second.expired()) {
+        it = instances_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    purge_threshold_ = 2 * instances_.size();
+    if (purge_threshold_ < kMinPurgeThreshold) {
+      purge_threshold_ = kMinPurgeThreshold;
+    }
+  }
+
+  static constexpr size_t kMinPurgeThreshold = 1024;
+
+  std::mutex mutex_;
+  std::unordered_map<Key, std::weak_ptr<T>, KeyHash> instances_;
+  size_t purge_threshold_ = kMinPurgeThreshold;
+};
+
+template <typename T, typename Key, typename KeyHash>
+constexpr size_t InternTable<T, Key, KeyHash>::kMinPurgeThreshold;
+
+// Types are keyed on their fingerprints
+std::shared_ptr<DataType> InternType(std::shared_ptr<DataType> type) {
+  const auto& fingerprint = type->fingerprint();
+  if (fingerprint.empty()) {
+    // Equal types can't be told apart from their fingerprints
+    return type;
+  }
+  // The fingerprint is prefixed with its length to disambiguate
+  std::string key = std::to_string(fingerprint.length()) + ':' + fingerprint +
+                    type->metadata_fingerprint();
+  // Never destroyed, as types may be made during static destruction
+  static auto table = new InternTable<DataType, std::string>();
+  return table->Intern(std::move(key), [&type]() { return type; });
+}
+
+// Fields are keyed on their name, nullability and the instances of their type and
+// metadata, which are kept alive by an interned field.  Equal types made by the
+// factory functions are a single instance already.
+struct FieldKey {
+  std::string name;
+  bool nullable;
+  const DataType* type;
+  const KeyValueMetadata* metadata;
+
+  bool operator==(const FieldKey& other) const {
+    return name == other.name && nullable == other.nullable && type == other.type &&
+           metadata == other.metadata;
+  }
+};
+
+struct FieldKeyHash {
+  size_t operator()(const FieldKey& key) const {
+    size_t h = std::hash<std::string>()(key.name);
+    h = h * 31 + std::hash<const void*>()(key.type);
+    h = h * 31 + std::hash<const void*>()(key.metadata);
+    return h * 2 + key.nullable;
+  }
+};
+
+std::shared_ptr<Field> InternField(
+    const std::string& name, const std::shared_ptr<DataType>& type, bool nullable,
+    const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  static auto table = new InternTable<Field, FieldKey, FieldKeyHash>();
+  return table->Intern(FieldKey{name, nullable, type.get(), metadata.get()}, [&]() {
+    return std::make_shared<Field>(name, type, nullable, metadata);
+  });
+}
+
+}  // namespace
+
 #define TYPE_FACTORY(NAME, KLASS)                                        \
   std::shared_ptr<DataType> NAME() {                                     \
     static std::shared_ptr<DataType> result = std::make_shared<KLASS>(); \
@@ -1037,77 +1163,77 @@ TYPE_FACTORY(date64, Date64Type)
 TYPE_FACTORY(date32, Date32Type)
 
 std::shared_ptr<DataType> fixed_size_binary(int32_t byte_width) {
-  return std::make_shared<FixedSizeBinaryType>(byte_width);
+  return InternType(std::make_shared<FixedSizeBinaryType>(byte_width));
 }
 
 std::shared_ptr<DataType> duration(TimeUnit::type unit) {
-  return std::make_shared<DurationType>(unit);
+  return InternType(std::make_shared<DurationType>(unit));
 }
 
 std::shared_ptr<DataType> day_time_interval() {
-  return std::make_shared<DayTimeIntervalType>();
+  return InternType(std::make_shared<DayTimeIntervalType>());
 }
 
 std::shared_ptr<DataType> month_interval() {
-  return std::make_shared<MonthIntervalType>();
+  return InternType(std::make_shared<MonthIntervalType>());
 }
 
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit) {
-  return std::make_shared<TimestampType>(unit);
+  return InternType(std::make_shared<TimestampType>(unit));
 }
 
 std::shared_ptr<DataType> timestamp(TimeUnit::type unit, const std::string& timezone) {
-  return std::make_shared<TimestampType>(unit, timezone);
+  return InternType(std::make_shared<TimestampType>(unit, timezone));
 }
 
 std::shared_ptr<DataType> time32(TimeUnit::type unit) {
-  return std::make_shared<Time32Type>(unit);
+  return InternType(std::make_shared<Time32Type>(unit));
 }
 
 std::shared_ptr<DataType> time64(TimeUnit::type unit) {
-  return std::make_shared<Time64Type>(unit);
+  return InternType(std::make_shared<Time64Type>(unit));
 }
 
 std::shared_ptr<DataType> list(const std::shared_ptr<DataType>& value_type) {
-  return std::make_shared<ListType>(value_type);
+  return InternType(std::make_shared<ListType>(value_type));
 }
 
 std::shared_ptr<DataType> list(const std::shared_ptr<Field>& value_field) {
-  return std::make_shared<ListType>(value_field);
+  return InternType(std::make_shared<ListType>(value_field));
 }
 
 std::shared_ptr<DataType> large_list(const std::shared_ptr<DataType>& value_type) {
-  return std::make_shared<LargeListType>(value_type);
+  return InternType(std::make_shared<LargeListType>(value_type));
 }
 
 std::shared_ptr<DataType> large_list(const std::shared_ptr<Field>& value_field) {
-  return std::make_shared<LargeListType>(value_field);
+  return InternType(std::make_shared<LargeListType>(value_field));
 }
 
 std::shared_ptr<DataType> map(const std::shared_ptr<DataType>& key_type,
                               const std::shared_ptr<DataType>& value_type,
                               bool keys_sorted) {
-  return std::make_shared<MapType>(key_type, value_type, keys_sorted);
+  return InternType(std::make_shared<MapType>(key_type, value_type, keys_sorted));
 }
 
 std::shared_ptr<DataType> fixed_size_list(const std::shared_ptr<DataType>& value_type,
                                           int32_t list_size) {
-  return std::make_shared<FixedSizeListType>(value_type, list_size);
+  return InternType(std::make_shared<FixedSizeListType>(value_type, list_size));
 }
 
 std::shared_ptr<DataType> fixed_size_list(const std::shared_ptr<Field>& value_field,
                                           int32_t list_size) {
-  return std::make_shared<FixedSizeListType>(value_field, list_size);
+  return InternType(std::make_shared<FixedSizeListType>(value_field, list_size));
 }
 
 std::shared_ptr<DataType> struct_(const std::vector<std::shared_ptr<Field>>& fields) {
-  return std::make_shared<StructType>(fields);
+  return InternType(std::make_shared<StructType>(fields));
 }
 
 std::shared_ptr<DataType> union_(const std::vector<std::shared_ptr<Field>>& child_fields,
                                  const std::vector<uint8_t>& type_codes,
                                  UnionMode::type mode) {
-  return std::make_shared<UnionType>(child_fields, type_codes, mode);
+  return InternType(std::make_shared<UnionType>(child_fields, type_codes, mode));
 }
 
 std::shared_ptr<DataType> union_(const std::vector<std::shared_ptr<Array>>& children,
@@ -1134,17 +1260,17 @@ std::shared_ptr<DataType> union_(const std::vector<std::shared_ptr<Array>>& chil
 std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type,
                                      const std::shared_ptr<DataType>& dict_type,
                                      bool ordered) {
-  return std::make_shared<DictionaryType>(index_type, dict_type, ordered);
+  return InternType(std::make_shared<DictionaryType>(index_type, dict_type, ordered));
 }
 
 std::shared_ptr<Field> field(const std::string& name,
                              const std::shared_ptr<DataType>& type, bool nullable,
                              const std::shared_ptr<const KeyValueMetadata>& metadata) {
-  return std::make_shared<Field>(name, type, nullable, metadata);
+  return InternField(name, type, nullable, metadata);
 }
 
 std::shared_ptr<DataType> decimal(int32_t precision, int32_t scale) {
-  return std::make_shared<Decimal128Type>(precision, scale);
+  return InternType(std::make_shared<Decimal128Type>(precision, scale));
 }
 
 std::string Decimal128Type::ToString() const {
@@ -713,6 +713,8 @@ class ARROW_EXPORT FixedSizeListType : public NestedType {
   int32_t list_size() const { return list_size_; }
 
  protected:
+  std::string ComputeFingerprint() const override;
+
   int32_t list_size_;
 };
 
@@ -1374,6 +1376,9 @@ class ARROW_EXPORT Schema : public detail::Fingerprintable {
 // ----------------------------------------------------------------------
 // Parametric factory functions
 // Other factory functions are in type_fwd.h
+//
+// The factory functions intern the types and fields they make: while an
+// instance is alive, calls with equal arguments return that same instance.
 
 /// \addtogroup type-factories
 /// @{
@@ -1495,6 +1500,9 @@ std::shared_ptr<DataType> dictionary(const std::shared_ptr<DataType>& index_type
 
 /// \brief Create a Field instance
 ///
+/// While a Field with the same name, type, nullability and metadata is alive,
+/// it is returned instead of a new instance.
+///
 /// \param name the field name
 /// \param type the field value type
 /// \param nullable whether the values are nullable, default true
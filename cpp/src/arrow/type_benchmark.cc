@@ -161,10 +161,59 @@ static void SchemaEqualsWithMetadata(
   state.SetItemsProcessed(state.iterations() * 2);
 }
 
+static std::vector<std::shared_ptr<Field>> WideSchemaFields() {
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < 1000; ++i) {
+    auto name = "f" + std::to_string(i);
+    switch (i % 4) {
+      case 0:
+        fields.push_back(field(name, int64()));
+        break;
+      case 1:
+        fields.push_back(field(name, utf8()));
+        break;
+      case 2:
+        fields.push_back(field(name, list(float32())));
+        break;
+      default:
+        fields.push_back(field(name, timestamp(TimeUnit::MICRO, "UTC")));
+        break;
+    }
+  }
+  return fields;
+}
+
+static void SchemaConstructionWide(
+    benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    auto schema = ::arrow::schema(WideSchemaFields());
+    benchmark::DoNotOptimize(schema);
+  }
+  state.SetItemsProcessed(state.iterations() * 1000);
+}
+
+// Compare a new schema with a reference schema, as when checking the schema
+// of each incoming batch
+static void SchemaEqualsWide(benchmark::State& state) {  // NOLINT non-const reference
+  auto reference = ::arrow::schema(WideSchemaFields());
+
+  int64_t total = 0;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto schema = ::arrow::schema(WideSchemaFields());
+    state.ResumeTiming();
+    total += reference->Equals(*schema);
+  }
+  benchmark::DoNotOptimize(total);
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(TypeEqualsSimple);
 BENCHMARK(TypeEqualsComplex);
 BENCHMARK(TypeEqualsWithMetadata);
 BENCHMARK(SchemaEquals);
 BENCHMARK(SchemaEqualsWithMetadata);
+BENCHMARK(SchemaConstructionWide);
+BENCHMARK(SchemaEqualsWide);
 
 }  // namespace arrow
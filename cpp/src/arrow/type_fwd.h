@@ -50,6 +50,7 @@ class Buffer;
 class MemoryPool;
 class RecordBatch;
 class Schema;
+struct Scalar;
 
 class DictionaryType;
 class DictionaryArray;
@@ -133,6 +133,36 @@ TEST(TestField, Equals) {
   AssertFieldsEqual(f0_with_meta1, f0_with_meta2, false);
 }
 
+TEST(TestField, Interning) {
+  auto meta = key_value_metadata({{"a", "1"}});
+
+  auto f0 = field("f0", list(int32()));
+  ASSERT_EQ(f0, field("f0", list(int32())));
+  ASSERT_EQ(f0->type(), list(int32()));
+  ASSERT_NE(f0, field("f0", list(int32()), false));
+  ASSERT_NE(f0, field("f0", list(int32()), true, meta));
+  ASSERT_NE(f0, field("f1", list(int32())));
+  ASSERT_NE(f0, field("f0", list(int64())));
+  ASSERT_EQ(field("f0", list(int32()), true, meta),
+            field("f0", list(int32()), true, meta));
+  AssertFieldsEqual(*field("f0", list(int32()), true, meta),
+                    *field("f0", list(int32()), true, key_value_metadata({{"a", "1"}})));
+
+  // Copies are distinct instances
+  ASSERT_NE(f0, f0->Copy());
+  AssertFieldsEqual(*f0, *f0->Copy());
+}
+
+TEST(TestField, FingerprintsDisambiguateNames) {
+  // A name looking like the end of a field and the start of another
+  auto f0 = field("a{" + int32()->fingerprint() + "};Fnb", int32());
+  auto s0 = struct_({f0});
+  auto s1 = struct_({field("a", int32()), field("b", int32())});
+  ASSERT_NE(s0->fingerprint(), s1->fingerprint());
+  ASSERT_FALSE(s0->Equals(*s1));
+  ASSERT_EQ(s0->num_children(), 1);
+}
+
 TEST(TestField, TestMetadataConstruction) {
   auto metadata = std::shared_ptr<KeyValueMetadata>(
       new KeyValueMetadata({"foo", "bar"}, {"bizz", "buzz"}));
@@ -808,6 +838,20 @@ TEST(TestStructType, Basics) {
   // TODO(wesm): out of bounds for field(...)
 }
 
+TEST(TestStructType, NestedMetadata) {
+  auto meta = key_value_metadata({{"a", "1"}});
+  auto inner = struct_({field("x", int8())});
+  auto inner_with_meta = struct_({field("x", int8(), true, meta)});
+  ASSERT_NE(inner, inner_with_meta);
+
+  auto outer = struct_({field("y", inner)});
+  auto outer_with_meta = struct_({field("y", inner_with_meta)});
+  ASSERT_NE(outer, outer_with_meta);
+  ASSERT_FALSE(outer->Equals(*outer_with_meta));
+  ASSERT_TRUE(outer->Equals(*outer_with_meta, /*check_metadata=*/false));
+  ASSERT_EQ(outer, struct_({field("y", struct_({field("x", int8())}))}));
+}
+
 TEST(TestStructType, GetFieldByName) {
   auto f0 = field("f0", int32());
   auto f1 = field("f1", uint8(), false);
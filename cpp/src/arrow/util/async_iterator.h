@@ -0,0 +1,423 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+/// \brief An iterator whose elements are produced in the background
+///
+/// Next() returns a future of the next element, nullptr once the iteration
+/// is completed.  It does not wait for the element, and may be called again
+/// before the previous future is ready: the futures are given the elements
+/// in the order of the calls.  After a future is given an error, the
+/// iterator should not be used anymore.
+///
+/// Next() must not be called concurrently.
+template <typename T>
+class AsyncIterator {
+ public:
+  static_assert(std::is_assignable<T, std::nullptr_t>::value,
+                "NULL is used to signal completion");
+
+  virtual ~AsyncIterator() = default;
+
+  /// \brief Return a future of the next element of the sequence, nullptr
+  /// when the iteration is completed
+  virtual std::future<Result<T>> Next() = 0;
+};
+
+namespace detail {
+
+template <typename T>
+std::future<T> MakeReadyFuture(T value) {
+  std::promise<T> promise;
+  promise.set_value(std::move(value));
+  return promise.get_future();
+}
+
+template <typename R>
+struct result_value {};
+
+template <typename T>
+struct result_value<Result<T>> {
+  using type = T;
+};
+
+// Pull from a set of sources on an executor, at most one task per source
+// at a time, while elements are awaited or fewer than max_readahead are
+// buffered.  The elements are handed out in the order they are pulled.
+template <typename T>
+class MergedIteratorState {
+ public:
+  MergedIteratorState(std::vector<std::unique_ptr<Iterator<T>>> sources,
+                      int max_readahead, internal::ThreadPool* executor)
+      : sources_(std::move(sources)),
+        max_readahead_(max_readahead),
+        executor_(executor),
+        num_live_(sources_.size()),
+        finished_(sources_.empty()) {
+    // Sources are taken from the back: start with the first one
+    for (size_t i = sources_.size(); i > 0; --i) {
+      idle_.push_back(i - 1);
+    }
+  }
+
+  static std::future<Result<T>> Next(const std::shared_ptr<MergedIteratorState>& state) {
+    std::future<Result<T>> future;
+    std::vector<size_t> to_start;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex_);
+      if (!state->ready_.empty()) {
+        future = MakeReadyFuture(std::move(state->ready_.front()));
+        state->ready_.pop_front();
+      } else if (state->finished_) {
+        future = MakeReadyFuture(Result<T>(T(NULLPTR)));
+      } else {
+        state->waiting_.emplace_back();
+        future = state->waiting_.back().get_future();
+      }
+      to_start = state->TakeIdleSources();
+    }
+    Start(state, to_start);
+    return future;
+  }
+
+  // Stop pulling and end the sequence
+  void Close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Finish(Status::OK());
+    ready_.clear();
+  }
+
+ private:
+  static void Start(const std::shared_ptr<MergedIteratorState>& state,
+                    const std::vector<size_t>& sources) {
+    for (size_t i : sources) {
+      Status st = state->executor_->Spawn([state, i] { state->Pull(i); });
+      if (!st.ok()) {
+        std::lock_guard<std::mutex> lock(state->mutex_);
+        --state->num_pulling_;
+        state->Finish(st);
+      }
+    }
+  }
+
+  // Whether another element should be pulled.  Requires the mutex.
+  bool Demand() const {
+    return static_cast<int64_t>(ready_.size()) + num_pulling_ <
+           static_cast<int64_t>(waiting_.size()) + max_readahead_;
+  }
+
+  // Take the idle sources to pull from, counting their pulls.  Requires the
+  // mutex.
+  std::vector<size_t> TakeIdleSources() {
+    std::vector<size_t> sources;
+    while (!finished_ && !idle_.empty() && Demand()) {
+      sources.push_back(idle_.back());
+      idle_.pop_back();
+      ++num_pulling_;
+    }
+    return sources;
+  }
+
+  // Pull from source i until there is no more demand, its pull having been
+  // counted
+  void Pull(size_t i) {
+    for (;;) {
+      T value;
+      Status st = sources_[i]->Next(&value);
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_pulling_;
+      if (finished_) {
+        return;
+      }
+      if (!st.ok()) {
+        Finish(st);
+        return;
+      }
+      if (value == NULLPTR) {
+        if (--num_live_ == 0) {
+          Finish(Status::OK());
+        }
+        return;
+      }
+      Deliver(Result<T>(std::move(value)));
+      if (!Demand()) {
+        idle_.push_back(i);
+        return;
+      }
+      ++num_pulling_;
+    }
+  }
+
+  // Requires the mutex
+  void Deliver(Result<T> result) {
+    if (waiting_.empty()) {
+      ready_.push_back(std::move(result));
+    } else {
+      waiting_.front().set_value(std::move(result));
+      waiting_.pop_front();
+    }
+  }
+
+  // End the sequence after the buffered elements and the error, if any.
+  // Requires the mutex.
+  void Finish(const Status& st) {
+    if (finished_) {
+      return;
+    }
+    finished_ = true;
+    if (!st.ok()) {
+      Deliver(Result<T>(st));
+    }
+    for (auto& promise : waiting_) {
+      promise.set_value(Result<T>(T(NULLPTR)));
+    }
+    waiting_.clear();
+  }
+
+  // Each source is only accessed by the task pulling from it
+  std::vector<std::unique_ptr<Iterator<T>>> sources_;
+  const int max_readahead_;
+  internal::ThreadPool* executor_;
+
+  std::mutex mutex_;
+  // The sources which are not finished and have no task pulling from them
+  std::vector<size_t> idle_;
+  size_t num_live_;
+  int64_t num_pulling_ = 0;
+  bool finished_;
+  // Never both non-empty
+  std::deque<Result<T>> ready_;
+  std::deque<std::promise<Result<T>>> waiting_;
+};
+
+template <typename T>
+class MergedIterator : public AsyncIterator<T> {
+ public:
+  MergedIterator(std::vector<std::unique_ptr<Iterator<T>>> sources, int max_readahead,
+                 internal::ThreadPool* executor)
+      : state_(std::make_shared<MergedIteratorState<T>>(std::move(sources),
+                                                        max_readahead, executor)) {}
+
+  ~MergedIterator() override { state_->Close(); }
+
+  std::future<Result<T>> Next() override {
+    return MergedIteratorState<T>::Next(state_);
+  }
+
+ private:
+  std::shared_ptr<MergedIteratorState<T>> state_;
+};
+
+// The tasks of a ParallelMapIterator each pull the next element and take the
+// next promise under the mutex, so that the promises are given the results
+// in the order of the source.
+template <typename Fn, typename I, typename O>
+struct ParallelMapState {
+  ParallelMapState(Fn map, std::unique_ptr<Iterator<I>> source)
+      : map(std::move(map)), source(std::move(source)) {}
+
+  void RunOne() {
+    std::promise<Result<O>> promise;
+    I input;
+    Status st;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      promise = std::move(waiting.front());
+      waiting.pop_front();
+      if (!source_finished) {
+        st = source->Next(&input);
+        source_finished = !st.ok() || input == NULLPTR;
+      }
+    }
+    if (!st.ok()) {
+      promise.set_value(Result<O>(st));
+    } else if (input == NULLPTR) {
+      promise.set_value(Result<O>(O(NULLPTR)));
+    } else {
+      promise.set_value(map(std::move(input)));
+    }
+  }
+
+  Fn map;
+  std::mutex mutex;
+  std::unique_ptr<Iterator<I>> source;
+  bool source_finished = false;
+  std::deque<std::promise<Result<O>>> waiting;
+};
+
+template <typename Fn, typename I, typename O>
+class ParallelMapIterator : public AsyncIterator<O> {
+ public:
+  using State = ParallelMapState<Fn, I, O>;
+
+  ParallelMapIterator(Fn map, std::unique_ptr<Iterator<I>> source, int max_parallelism,
+                      internal::ThreadPool* executor)
+      : state_(std::make_shared<State>(std::move(map), std::move(source))),
+        max_parallelism_(max_parallelism),
+        executor_(executor) {}
+
+  std::future<Result<O>> Next() override {
+    while (static_cast<int>(in_flight_.size()) < max_parallelism_ || in_flight_.empty()) {
+      in_flight_.push_back(Dispatch());
+    }
+    std::future<Result<O>> future = std::move(in_flight_.front());
+    in_flight_.pop_front();
+    return future;
+  }
+
+ private:
+  std::future<Result<O>> Dispatch() {
+    std::future<Result<O>> future;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->waiting.emplace_back();
+      future = state_->waiting.back().get_future();
+    }
+    auto state = state_;
+    Status st = executor_->Spawn([state] { state->RunOne(); });
+    if (!st.ok()) {
+      // No task will take the promise, which is the last one
+      std::lock_guard<std::mutex> lock(state_->mutex);
+      state_->waiting.back().set_value(Result<O>(st));
+      state_->waiting.pop_back();
+    }
+    return future;
+  }
+
+  std::shared_ptr<State> state_;
+  const int max_parallelism_;
+  internal::ThreadPool* executor_;
+  // The results being computed, in the order of the source
+  std::deque<std::future<Result<O>>> in_flight_;
+};
+
+template <typename T>
+class SyncIterator : public Iterator<T> {
+ public:
+  explicit SyncIterator(std::unique_ptr<AsyncIterator<T>> it) : it_(std::move(it)) {}
+
+  Status Next(T* out) override {
+    Result<T> result = it_->Next().get();
+    ARROW_RETURN_NOT_OK(result.status());
+    *out = std::move(result).ValueOrDie();
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<AsyncIterator<T>> it_;
+};
+
+}  // namespace detail
+
+/// \brief Merge iterators, pulling from them concurrently on an executor
+///
+/// Each source is pulled by at most one task at a time, pulling ahead of the
+/// consumer until max_readahead elements are buffered overall.  The elements
+/// of a source keep their order, but those of different sources are
+/// interleaved in the order they are pulled.  The sequence is completed when
+/// all sources are, and ends at the first error of any of them.
+///
+/// The sources must not wait for tasks of the executor, e.g. be readahead
+/// iterators on the same executor, lest they deadlock it.  They are destroyed
+/// once the merged iterator is and their pending pulls are completed.
+///
+/// \param[in] sources the iterators to merge
+/// \param[in] max_readahead the number of elements to pull ahead of the
+///            consumer, 0 to only pull on demand
+/// \param[in] executor the thread pool on which to pull, usually the I/O one
+template <typename T>
+std::unique_ptr<AsyncIterator<T>> MakeMergedIterator(
+    std::vector<std::unique_ptr<Iterator<T>>> sources, int max_readahead,
+    internal::ThreadPool* executor) {
+  return std::unique_ptr<AsyncIterator<T>>(
+      new detail::MergedIterator<T>(std::move(sources), max_readahead, executor));
+}
+
+/// \brief Pull from an iterator on an executor, up to max_readahead elements
+/// ahead of the consumer
+///
+/// This adapts any Iterator, such as a dataset's ScanTaskIterator or a
+/// RecordBatchIterator, to an AsyncIterator.  The same restrictions on the
+/// source as for MakeMergedIterator apply.
+template <typename T>
+std::unique_ptr<AsyncIterator<T>> MakeAsyncIterator(std::unique_ptr<Iterator<T>> it,
+                                                    int max_readahead,
+                                                    internal::ThreadPool* executor) {
+  std::vector<std::unique_ptr<Iterator<T>>> sources;
+  sources.push_back(std::move(it));
+  return MakeMergedIterator(std::move(sources), max_readahead, executor);
+}
+
+/// \brief Iterate over an AsyncIterator, waiting for each element in turn
+template <typename T>
+std::unique_ptr<Iterator<T>> MakeSyncIterator(std::unique_ptr<AsyncIterator<T>> it) {
+  return std::unique_ptr<Iterator<T>>(new detail::SyncIterator<T>(std::move(it)));
+}
+
+/// \brief Pull from an iterator on an executor, up to max_readahead elements
+/// ahead of the consumer, which only waits when none is ready
+template <typename T>
+std::unique_ptr<Iterator<T>> MakeReadaheadIterator(std::unique_ptr<Iterator<T>> it,
+                                                   int max_readahead,
+                                                   internal::ThreadPool* executor) {
+  return MakeSyncIterator(MakeAsyncIterator(std::move(it), max_readahead, executor));
+}
+
+/// \brief Map a function over an iterator on an executor, keeping the order
+/// of the elements
+///
+/// Up to max_parallelism elements are mapped concurrently ahead of the
+/// consumer.  The source is pulled by the mapping tasks, one at a time, and
+/// must not wait for tasks of the executor.  The sequence ends at the first
+/// error of the source or of the function.  The function and the source are
+/// destroyed once the mapped iterator is and its pending tasks are completed.
+///
+/// \param[in] map the function, taking an element and returning a Result
+/// \param[in] it the source iterator
+/// \param[in] max_parallelism the number of elements mapped concurrently,
+///            at least 1
+/// \param[in] executor the thread pool on which to map, usually the CPU one
+template <typename Fn, typename I,
+          typename O = typename detail::result_value<
+              typename std::result_of<Fn(I)>::type>::type>
+std::unique_ptr<AsyncIterator<O>> MakeParallelMapIterator(
+    Fn map, std::unique_ptr<Iterator<I>> it, int max_parallelism,
+    internal::ThreadPool* executor) {
+  return std::unique_ptr<AsyncIterator<O>>(new detail::ParallelMapIterator<Fn, I, O>(
+      std::move(map), std::move(it), max_parallelism, executor));
+}
+
+}  // namespace arrow
@@ -0,0 +1,324 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/async_iterator.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+using IntPtr = std::shared_ptr<int>;
+
+static void SleepABit() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }
+
+// An iterator of 0 to length - 1, failing instead of yielding fail_at
+class CountingIterator : public Iterator<IntPtr> {
+ public:
+  explicit CountingIterator(int length, int fail_at = -1,
+                            std::atomic<int>* pulled = NULLPTR)
+      : length_(length), fail_at_(fail_at), pulled_(pulled) {}
+
+  Status Next(IntPtr* out) override {
+    if (pulled_ != NULLPTR) {
+      ++*pulled_;
+    }
+    if (i_ == fail_at_) {
+      return Status::IOError("Failed at ", i_);
+    }
+    *out = i_ < length_ ? std::make_shared<int>(i_++) : NULLPTR;
+    return Status::OK();
+  }
+
+ private:
+  int length_;
+  int fail_at_;
+  std::atomic<int>* pulled_;
+  int i_ = 0;
+};
+
+// An iterator of move-only elements
+class MovingIterator : public Iterator<std::unique_ptr<int>> {
+ public:
+  explicit MovingIterator(std::vector<std::unique_ptr<int>> values)
+      : values_(std::move(values)) {}
+
+  Status Next(std::unique_ptr<int>* out) override {
+    *out = i_ < values_.size() ? std::move(values_[i_++]) : NULLPTR;
+    return Status::OK();
+  }
+
+ private:
+  std::vector<std::unique_ptr<int>> values_;
+  size_t i_ = 0;
+};
+
+std::unique_ptr<Iterator<IntPtr>> Counting(int length, int fail_at = -1,
+                                           std::atomic<int>* pulled = NULLPTR) {
+  return std::unique_ptr<Iterator<IntPtr>>(
+      new CountingIterator(length, fail_at, pulled));
+}
+
+std::vector<int> Collect(Iterator<IntPtr>* it, Status* status) {
+  std::vector<int> values;
+  *status = it->Visit([&values](IntPtr value) {
+    values.push_back(*value);
+    return Status::OK();
+  });
+  return values;
+}
+
+std::vector<int> Range(int length) {
+  std::vector<int> values(length);
+  for (int i = 0; i < length; ++i) {
+    values[i] = i;
+  }
+  return values;
+}
+
+class TestAsyncIterator : public ::testing::Test {
+ public:
+  void SetUp() override { ASSERT_OK(ThreadPool::Make(4, &pool_)); }
+
+ protected:
+  std::shared_ptr<ThreadPool> pool_;
+};
+
+TEST_F(TestAsyncIterator, Readahead) {
+  for (int max_readahead : {0, 1, 8}) {
+    auto it = MakeReadaheadIterator(Counting(100), max_readahead, pool_.get());
+    Status st;
+    ASSERT_EQ(Collect(it.get(), &st), Range(100));
+    ASSERT_OK(st);
+    // Completed iterators keep yielding nullptr
+    IntPtr value;
+    ASSERT_OK(it->Next(&value));
+    ASSERT_EQ(value, NULLPTR);
+  }
+
+  auto it = MakeReadaheadIterator(Counting(0), 4, pool_.get());
+  Status st;
+  ASSERT_EQ(Collect(it.get(), &st), std::vector<int>());
+  ASSERT_OK(st);
+}
+
+TEST_F(TestAsyncIterator, ReadaheadPullsAhead) {
+  std::atomic<int> pulled(0);
+  auto it = MakeAsyncIterator(Counting(100, -1, &pulled), 5, pool_.get());
+  ASSERT_EQ(pulled.load(), 0);
+
+  Result<IntPtr> first = it->Next().get();
+  ASSERT_OK(first.status());
+  ASSERT_EQ(*first.ValueOrDie(), 0);
+  // The first element and 5 more are pulled, and no more
+  for (int i = 0; i < 1000 && pulled.load() < 6; ++i) {
+    SleepABit();
+  }
+  SleepABit();
+  ASSERT_EQ(pulled.load(), 6);
+
+  // Futures may be requested before the previous ones are ready
+  std::vector<std::future<Result<IntPtr>>> futures;
+  for (int i = 0; i < 20; ++i) {
+    futures.push_back(it->Next());
+  }
+  for (int i = 0; i < 20; ++i) {
+    Result<IntPtr> result = futures[i].get();
+    ASSERT_OK(result.status());
+    ASSERT_EQ(*result.ValueOrDie(), i + 1);
+  }
+}
+
+TEST_F(TestAsyncIterator, ReadaheadError) {
+  auto it = MakeReadaheadIterator(Counting(100, 3), 8, pool_.get());
+  Status st;
+  ASSERT_EQ(Collect(it.get(), &st), Range(3));
+  ASSERT_RAISES(IOError, st);
+}
+
+TEST_F(TestAsyncIterator, ReadaheadMoveOnly) {
+  std::vector<std::unique_ptr<int>> values;
+  for (int i = 0; i < 10; ++i) {
+    values.emplace_back(new int(i));
+  }
+  std::unique_ptr<Iterator<std::unique_ptr<int>>> source(
+      new MovingIterator(std::move(values)));
+  auto it = MakeReadaheadIterator(std::move(source), 2, pool_.get());
+  for (int j = 0; j < 10; ++j) {
+    std::unique_ptr<int> value;
+    ASSERT_OK(it->Next(&value));
+    ASSERT_NE(value, NULLPTR);
+    ASSERT_EQ(*value, j);
+  }
+  std::unique_ptr<int> value;
+  ASSERT_OK(it->Next(&value));
+  ASSERT_EQ(value, NULLPTR);
+}
+
+TEST_F(TestAsyncIterator, DestroyWhilePulling) {
+  std::atomic<int> pulled(0);
+  {
+    auto it = MakeAsyncIterator(Counting(1000, -1, &pulled), 100, pool_.get());
+    auto future = it->Next();
+  }
+  // The pending pulls complete, then no more are made
+  ASSERT_OK(pool_->Shutdown());
+  ASSERT_LE(pulled.load(), 101);
+}
+
+TEST_F(TestAsyncIterator, Merge) {
+  std::vector<std::unique_ptr<Iterator<IntPtr>>> sources;
+  sources.push_back(Counting(50));
+  sources.push_back(Counting(0));
+  sources.push_back(Counting(100));
+  sources.push_back(Counting(100));
+  auto it = MakeSyncIterator(MakeMergedIterator(std::move(sources), 4, pool_.get()));
+
+  Status st;
+  std::vector<int> values = Collect(it.get(), &st);
+  ASSERT_OK(st);
+  ASSERT_EQ(values.size(), 250U);
+  std::vector<int> expected = Range(50);
+  for (int i = 0; i < 2; ++i) {
+    std::vector<int> range = Range(100);
+    expected.insert(expected.end(), range.begin(), range.end());
+  }
+  std::sort(values.begin(), values.end());
+  std::sort(expected.begin(), expected.end());
+  ASSERT_EQ(values, expected);
+
+  auto empty = MakeSyncIterator(
+      MakeMergedIterator(std::vector<std::unique_ptr<Iterator<IntPtr>>>(), 4,
+                         pool_.get()));
+  ASSERT_EQ(Collect(empty.get(), &st), std::vector<int>());
+  ASSERT_OK(st);
+}
+
+TEST_F(TestAsyncIterator, MergeKeepsSourceOrder) {
+  // Tag the elements with their source
+  std::vector<std::unique_ptr<Iterator<IntPtr>>> sources;
+  for (int source = 0; source < 3; ++source) {
+    sources.push_back(MakeMapIterator(
+        [source](IntPtr value) { return std::make_shared<int>(*value * 10 + source); },
+        Counting(100)));
+  }
+  auto it = MakeSyncIterator(MakeMergedIterator(std::move(sources), 2, pool_.get()));
+
+  Status st;
+  std::vector<int> values = Collect(it.get(), &st);
+  ASSERT_OK(st);
+  ASSERT_EQ(values.size(), 300U);
+  std::vector<int> last(3, -1);
+  for (int value : values) {
+    ASSERT_GT(value, last[value % 10]);
+    last[value % 10] = value;
+  }
+}
+
+TEST_F(TestAsyncIterator, MergeError) {
+  std::vector<std::unique_ptr<Iterator<IntPtr>>> sources;
+  sources.push_back(Counting(1000));
+  sources.push_back(Counting(1000, 10));
+  auto it = MakeSyncIterator(MakeMergedIterator(std::move(sources), 4, pool_.get()));
+  Status st;
+  std::vector<int> values = Collect(it.get(), &st);
+  ASSERT_RAISES(IOError, st);
+  ASSERT_LT(values.size(), 2000U);
+}
+
+TEST_F(TestAsyncIterator, ParallelMap) {
+  std::atomic<int> running(0), max_running(0);
+  auto square = [&](IntPtr value) -> Result<IntPtr> {
+    int now = ++running;
+    int max = max_running.load();
+    while (now > max && !max_running.compare_exchange_weak(max, now)) {
+    }
+    // Later elements complete first
+    std::this_thread::sleep_for(std::chrono::microseconds(100 * (*value % 3)));
+    --running;
+    return std::make_shared<int>(*value * *value);
+  };
+  auto it =
+      MakeSyncIterator(MakeParallelMapIterator(square, Counting(100), 3, pool_.get()));
+
+  Status st;
+  std::vector<int> values = Collect(it.get(), &st);
+  ASSERT_OK(st);
+  ASSERT_EQ(values.size(), 100U);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(values[i], i * i);
+  }
+  ASSERT_LE(max_running.load(), 3);
+}
+
+TEST_F(TestAsyncIterator, ParallelMapError) {
+  auto fail_at_5 = [](IntPtr value) -> Result<IntPtr> {
+    if (*value == 5) {
+      return Status::Invalid("Failed at 5");
+    }
+    return value;
+  };
+  auto it =
+      MakeSyncIterator(MakeParallelMapIterator(fail_at_5, Counting(100), 4, pool_.get()));
+  Status st;
+  ASSERT_EQ(Collect(it.get(), &st), Range(5));
+  ASSERT_RAISES(Invalid, st);
+
+  // Errors of the source
+  auto identity = [](IntPtr value) -> Result<IntPtr> { return value; };
+  it = MakeSyncIterator(MakeParallelMapIterator(identity, Counting(100, 7), 4,
+                                                pool_.get()));
+  ASSERT_EQ(Collect(it.get(), &st), Range(7));
+  ASSERT_RAISES(IOError, st);
+}
+
+TEST_F(TestAsyncIterator, ParallelMapOfReadahead) {
+  // Read ahead on one pool and map on another
+  std::shared_ptr<ThreadPool> io_pool;
+  ASSERT_OK(ThreadPool::Make(2, &io_pool));
+  auto increment = [](IntPtr value) -> Result<IntPtr> {
+    return std::make_shared<int>(*value + 1);
+  };
+  auto it = MakeSyncIterator(MakeParallelMapIterator(
+      increment, MakeReadaheadIterator(Counting(100), 4, io_pool.get()), 4,
+      pool_.get()));
+  Status st;
+  std::vector<int> values = Collect(it.get(), &st);
+  ASSERT_OK(st);
+  std::vector<int> expected = Range(100);
+  for (int& value : expected) {
+    ++value;
+  }
+  ASSERT_EQ(values, expected);
+}
+
+}  // namespace arrow
@@ -620,6 +620,29 @@ static bool RescaleWouldCauseDataLoss(const BasicDecimal128& value, int32_t delt
   return (value < 0) ? *result > value : *result < value;
 }
 
+// Rescale a value that fits in an int64_t by a multiplier that does too, which
+// needs neither a full 128-bit multiplication nor a long division
+static DecimalStatus RescaleInt64(int64_t value, int32_t delta_scale,
+                                  int64_t multiplier, BasicDecimal128* out) {
+  if (delta_scale > 0) {
+    // The product takes at most 126 bits, so it can't overflow
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef __int128 int128_t;
+    const int128_t product = static_cast<int128_t>(value) * multiplier;
+    *out = BasicDecimal128(static_cast<int64_t>(product >> 64),
+                           static_cast<uint64_t>(product));
+#else
+    *out = BasicDecimal128(value) * BasicDecimal128(multiplier);
+#endif
+    return DecimalStatus::kSuccess;
+  }
+  if (value % multiplier != 0) {
+    return DecimalStatus::kRescaleDataLoss;
+  }
+  *out = BasicDecimal128(value / multiplier);
+  return DecimalStatus::kSuccess;
+}
+
 DecimalStatus BasicDecimal128::Rescale(int32_t original_scale, int32_t new_scale,
                                        BasicDecimal128* out) const {
   DCHECK_NE(out, nullptr);
@@ -631,6 +654,14 @@ DecimalStatus BasicDecimal128::Rescale(int32_t original_scale, int32_t new_scale
   DCHECK_GE(abs_delta_scale, 1);
   DCHECK_LE(abs_delta_scale, 38);
 
+  static constexpr int32_t kMaxInt64Scale = 18;
+  if (high_bits_ == (static_cast<int64_t>(low_bits_) >> 63) &&
+      abs_delta_scale <= kMaxInt64Scale) {
+    const auto multiplier =
+        static_cast<int64_t>(ScaleMultipliers[abs_delta_scale].low_bits());
+    return RescaleInt64(static_cast<int64_t>(low_bits_), delta_scale, multiplier, out);
+  }
+
   BasicDecimal128 result(*this);
   const bool rescale_would_cause_data_loss =
       RescaleWouldCauseDataLoss(result, delta_scale, abs_delta_scale, out);
@@ -135,6 +135,10 @@ class BitReader {
   template <typename T>
   int GetBatch(int num_bits, T* v, int batch_size);
 
+  /// Get a number of 1-bit values from the buffer and write them to a bitmap,
+  /// starting at bit 'bitmap_offset'. Return the number of values actually read.
+  int GetBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset);
+
   /// Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T
   /// needs to be a little-endian native type and big enough to store
   /// 'num_bytes'. The value is assumed to be byte-aligned so the stream will
@@ -359,6 +363,40 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
   return batch_size;
 }
 
+inline int BitReader::GetBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset) {
+  // Values are read 32 at a time, and written to the bitmap 64 at a time
+  constexpr int kBufferSize = 64;
+  uint32_t buffer[kBufferSize];
+
+  int values_read = 0;
+  while (values_read < batch_size) {
+    const int num_words =
+        GetBatch(32, buffer, std::min(kBufferSize, (batch_size - values_read) / 32));
+    for (int i = 0; i + 1 < num_words; i += 2) {
+      BitUtil::SetBitsFromWord(bitmap, bitmap_offset + values_read, 64,
+                               buffer[i] | static_cast<uint64_t>(buffer[i + 1]) << 32);
+      values_read += 64;
+    }
+    if (num_words % 2 == 1) {
+      BitUtil::SetBitsFromWord(bitmap, bitmap_offset + values_read, 32,
+                               buffer[num_words - 1]);
+      values_read += 32;
+    }
+    if (num_words < kBufferSize) {
+      break;
+    }
+  }
+
+  const int remaining_bits = (max_bytes_ - byte_offset_) * 8 - bit_offset_;
+  const int remaining = std::min(std::min(batch_size - values_read, 31), remaining_bits);
+  uint32_t last_word = 0;
+  if (remaining > 0 && GetValue(remaining, &last_word)) {
+    BitUtil::SetBitsFromWord(bitmap, bitmap_offset + values_read, remaining, last_word);
+    values_read += remaining;
+  }
+  return values_read;
+}
+
 template <typename T>
 inline bool BitReader::GetAligned(int num_bytes, T* v) {
   DCHECK_LE(num_bytes, static_cast<int>(sizeof(T)));
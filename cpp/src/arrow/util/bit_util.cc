@@ -77,10 +77,8 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   int64_t count = 0;
 
   const auto p = BitmapWordAlign<pop_len / 8>(data, bit_offset, length);
-  for (int64_t i = bit_offset; i < bit_offset + p.leading_bits; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
+  if (p.leading_bits > 0) {
+    count += BitUtil::PopCount(ReadBitmapWord(data, bit_offset, p.leading_bits));
   }
 
   if (p.aligned_words > 0) {
@@ -94,17 +92,44 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
     }
   }
 
-  // Account for left over bits (in theory we could fall back to smaller
-  // versions of popcount but the code complexity is likely not worth it)
-  for (int64_t i = p.trailing_bit_offset; i < bit_offset + length; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
+  // Account for left over bits, fewer than a word
+  if (p.trailing_bits > 0) {
+    count +=
+        BitUtil::PopCount(ReadBitmapWord(data, p.trailing_bit_offset, p.trailing_bits));
   }
 
   return count;
 }
 
+namespace {
+
+// Write `length` bits starting at out_offset, 64 at a time: word_op(i, n)
+// returns the n (at most 64) output bits starting at position i.  The bits
+// around the output range are kept.
+template <typename WordOp>
+void WriteBitmapWords(uint8_t* out, int64_t out_offset, int64_t length,
+                      WordOp&& word_op) {
+  // Bring the output to a byte boundary, then store whole words
+  const int64_t leading = std::min<int64_t>(length, (8 - out_offset % 8) % 8);
+  if (leading > 0) {
+    BitUtil::SetBitsFromWord(out, out_offset, static_cast<int>(leading),
+                             word_op(0, leading));
+  }
+  uint8_t* out_bytes = out + (out_offset + leading) / 8;
+  int64_t i = leading;
+  for (; i + 64 <= length; i += 64) {
+    const uint64_t word = BitUtil::ToLittleEndian(word_op(i, 64));
+    std::memcpy(out_bytes, &word, 8);
+    out_bytes += 8;
+  }
+  if (i < length) {
+    BitUtil::SetBitsFromWord(out, out_offset + i, static_cast<int>(length - i),
+                             word_op(i, length - i));
+  }
+}
+
+}  // namespace
+
 template <bool invert_bits, bool restore_trailing_bits>
 void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
                     int64_t dest_offset, uint8_t* dest) {
@@ -116,20 +141,12 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
   // Shift dest by its byte offset
   dest += dest_byte_offset;
 
-  if (dest_bit_offset > 0) {
-    internal::BitmapReader valid_reader(data, offset, length);
-    internal::BitmapWriter valid_writer(dest, dest_bit_offset, length);
-
-    for (int64_t i = 0; i < length; i++) {
-      if (invert_bits ^ valid_reader.IsSet()) {
-        valid_writer.Set();
-      } else {
-        valid_writer.Clear();
-      }
-      valid_reader.Next();
-      valid_writer.Next();
-    }
-    valid_writer.Finish();
+  if (bit_offset > 0 || dest_bit_offset > 0) {
+    // Shift a word at a time; the bits around the destination range are kept
+    WriteBitmapWords(dest, dest_bit_offset, length, [&](int64_t i, int64_t num_bits) {
+      const uint64_t word = ReadBitmapWord(data, offset + i, num_bits);
+      return invert_bits ? ~word : word;
+    });
   } else {
     // Take care of the trailing bits in the last byte
     int64_t trailing_bits = num_bytes * 8 - length;
@@ -138,35 +155,12 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
       trail = dest[num_bytes - 1];
     }
 
-    if (bit_offset > 0) {
-      uint8_t carry_mask = BitUtil::kPrecedingBitmask[bit_offset];
-      uint8_t carry_shift = static_cast<uint8_t>(8U - static_cast<uint8_t>(bit_offset));
-
-      uint8_t carry = 0U;
-      if (BitUtil::BytesForBits(length + bit_offset) > num_bytes) {
-        carry = static_cast<uint8_t>((data[byte_offset + num_bytes] & carry_mask)
-                                     << carry_shift);
-      }
-
-      int64_t i = num_bytes - 1;
-      while (i + 1 > 0) {
-        uint8_t cur_byte = data[byte_offset + i];
-        if (invert_bits) {
-          dest[i] = static_cast<uint8_t>(~((cur_byte >> bit_offset) | carry));
-        } else {
-          dest[i] = static_cast<uint8_t>((cur_byte >> bit_offset) | carry);
-        }
-        carry = static_cast<uint8_t>((cur_byte & carry_mask) << carry_shift);
-        --i;
+    if (invert_bits) {
+      for (int64_t i = 0; i < num_bytes; i++) {
+        dest[i] = static_cast<uint8_t>(~(data[byte_offset + i]));
       }
     } else {
-      if (invert_bits) {
-        for (int64_t i = 0; i < num_bytes; i++) {
-          dest[i] = static_cast<uint8_t>(~(data[byte_offset + i]));
-        }
-      } else {
-        std::memcpy(dest, data + byte_offset, static_cast<size_t>(num_bytes));
-      }
+      std::memcpy(dest, data + byte_offset, static_cast<size_t>(num_bytes));
     }
 
     if (restore_trailing_bits) {
@@ -245,10 +239,11 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
     return true;
   }
 
-  // Unaligned slow case
-  for (int64_t i = 0; i < bit_length; ++i) {
-    if (BitUtil::GetBit(left, left_offset + i) !=
-        BitUtil::GetBit(right, right_offset + i)) {
+  // Unaligned case: compare shifted words
+  for (int64_t i = 0; i < bit_length; i += 64) {
+    const int64_t num_bits = std::min<int64_t>(64, bit_length - i);
+    if (ReadBitmapWord(left, left_offset + i, num_bits) !=
+        ReadBitmapWord(right, right_offset + i, num_bits)) {
       return false;
     }
   }
@@ -257,6 +252,34 @@ bool BitmapEquals(const uint8_t* left, int64_t left_offset, const uint8_t* right
 
 namespace {
 
+struct AndOp {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left & right);
+  }
+};
+
+struct OrOp {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left | right);
+  }
+};
+
+struct XorOp {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left ^ right);
+  }
+};
+
+struct AndNotOp {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left & ~right);
+  }
+};
+
 template <typename Op>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
@@ -265,11 +288,20 @@ void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* ri
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
-  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset);
+  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset % 8);
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
-  for (int64_t i = 0; i < nbytes; ++i) {
+  // Whole words first, in a loop simple enough for the compiler to vectorize
+  const int64_t nwords = nbytes / 8;
+  for (int64_t i = 0; i < nwords; ++i) {
+    uint64_t left_word, right_word;
+    std::memcpy(&left_word, left + i * 8, 8);
+    std::memcpy(&right_word, right + i * 8, 8);
+    const uint64_t out_word = op(left_word, right_word);
+    std::memcpy(out + i * 8, &out_word, 8);
+  }
+  for (int64_t i = nwords * 8; i < nbytes; ++i) {
     out[i] = op(left[i], right[i]);
   }
 }
@@ -279,43 +311,35 @@ void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t*
                        int64_t right_offset, uint8_t* out, int64_t out_offset,
                        int64_t length) {
   Op op;
-  auto left_reader = internal::BitmapReader(left, left_offset, length);
-  auto right_reader = internal::BitmapReader(right, right_offset, length);
-  auto writer = internal::BitmapWriter(out, out_offset, length);
-  for (int64_t i = 0; i < length; ++i) {
-    if (op(left_reader.IsSet(), right_reader.IsSet())) {
-      writer.Set();
-    }
-    left_reader.Next();
-    right_reader.Next();
-    writer.Next();
-  }
-  writer.Finish();
+  // Shift the inputs into line with the output a word at a time
+  WriteBitmapWords(out, out_offset, length, [&](int64_t i, int64_t num_bits) {
+    return op(ReadBitmapWord(left, left_offset + i, num_bits),
+              ReadBitmapWord(right, right_offset + i, num_bits));
+  });
 }
 
-template <typename BitOp, typename LogicalOp>
+template <typename Op>
 void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
   if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
     // Fast case: can use bytewise AND
-    AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                           length);
+    AlignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset,
+                        length);
   } else {
     // Unaligned
-    UnalignedBitmapOp<LogicalOp>(left, left_offset, right, right_offset, dest, out_offset,
-                                 length);
+    UnalignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset,
+                          length);
   }
 }
 
-template <typename BitOp, typename LogicalOp>
+template <typename Op>
 Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                 const uint8_t* right, int64_t right_offset, int64_t length,
                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
   const int64_t phys_bits = length + out_offset;
   RETURN_NOT_OK(AllocateEmptyBitmap(pool, phys_bits, out_buffer));
   uint8_t* out = (*out_buffer)->mutable_data();
-  BitmapOp<BitOp, LogicalOp>(left, left_offset, right, right_offset, length, out_offset,
-                             out);
+  BitmapOp<Op>(left, left_offset, right, right_offset, length, out_offset, out);
   return Status::OK();
 }
 
@@ -324,40 +348,50 @@ Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
 Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
+  return BitmapOp<AndOp>(pool, left, left_offset, right, right_offset, length,
+                         out_offset, out_buffer);
 }
 
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<AndOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                 const uint8_t* right, int64_t right_offset, int64_t length,
                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
+  return BitmapOp<OrOp>(pool, left, left_offset, right, right_offset, length,
+                        out_offset, out_buffer);
 }
 
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<OrOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Status BitmapXor(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
-      pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
+  return BitmapOp<XorOp>(pool, left, left_offset, right, right_offset, length,
+                         out_offset, out_buffer);
 }
 
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
-      left, left_offset, right, right_offset, length, out_offset, out);
+  BitmapOp<XorOp>(left, left_offset, right, right_offset, length, out_offset, out);
+}
+
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
+  return BitmapOp<AndNotOp>(pool, left, left_offset, right, right_offset, length,
+                            out_offset, out_buffer);
+}
+
+void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, int64_t out_offset,
+                  uint8_t* out) {
+  BitmapOp<AndNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Status BitmapAllButOne(MemoryPool* pool, int64_t length, int64_t straggler_pos,
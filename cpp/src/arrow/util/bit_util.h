@@ -52,6 +52,7 @@
 #define ARROW_BYTE_SWAP32 __builtin_bswap32
 #endif
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
@@ -191,6 +192,21 @@ static inline uint64_t TrailingBits(uint64_t v, int num_bits) {
   return (v << n) >> n;
 }
 
+/// \brief Count the number of set bits in an unsigned integer.
+static inline int PopCount(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_popcountll(value);
+#elif defined(_MSC_VER)
+  return static_cast<int>(__popcnt64(value));
+#else
+  int count = 0;
+  for (; value != 0; value &= value - 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
 /// \brief Count the number of leading zeros in an unsigned integer.
 static inline int CountLeadingZeros(uint32_t value) {
 #if defined(__clang__) || defined(__GNUC__)
@@ -476,6 +492,36 @@ static inline void SetBitsTo(uint8_t* bits, int64_t start_offset, int64_t length
   bits[bytes_end - 1] |= static_cast<uint8_t>(fill_byte & ~last_byte_mask);
 }
 
+/// \brief Write the `length` (at most 64) lowest bits of `word` to the
+/// bitmap, starting at bit `start_offset`. The other bits of the bytes
+/// touched are preserved
+static inline void SetBitsFromWord(uint8_t* bits, int64_t start_offset, int length,
+                                   uint64_t word) {
+  if (length == 0) return;
+  if (length < 64) {
+    word &= (static_cast<uint64_t>(1) << length) - 1;
+  }
+
+  uint8_t* out = bits + start_offset / 8;
+  const int bit_offset = static_cast<int>(start_offset % 8);
+  const int bit_end = bit_offset + length;
+  const int num_bytes = static_cast<int>(BytesForBits(bit_end));
+
+  uint8_t bytes[9];
+  const uint64_t shifted = word << bit_offset;
+  for (int i = 0; i < 8; ++i) {
+    bytes[i] = static_cast<uint8_t>(shifted >> (8 * i));
+  }
+  bytes[8] = bit_offset == 0 ? 0 : static_cast<uint8_t>(word >> (64 - bit_offset));
+
+  bytes[0] = static_cast<uint8_t>(bytes[0] | (out[0] & kPrecedingBitmask[bit_offset]));
+  if (bit_end % 8 != 0) {
+    bytes[num_bytes - 1] = static_cast<uint8_t>(
+        bytes[num_bytes - 1] | (out[num_bytes - 1] & kTrailingBitmask[bit_end % 8]));
+  }
+  std::memcpy(out, bytes, num_bytes);
+}
+
 /// \brief Convert vector of bytes to bitmap buffer
 ARROW_EXPORT
 Status BytesToBits(const std::vector<uint8_t>&, MemoryPool*, std::shared_ptr<Buffer>*);
@@ -703,6 +749,56 @@ void GenerateBitsUnrolled(uint8_t* bitmap, int64_t start_offset, int64_t length,
   }
 }
 
+/// \brief Read up to 64 bits of a bitmap starting at an arbitrary bit offset
+///
+/// Bit i of the result is bit (bit_offset + i) of the bitmap; the bits past
+/// num_bits are zero.  Only the bytes covering the range are accessed.
+static inline uint64_t ReadBitmapWord(const uint8_t* bitmap, int64_t bit_offset,
+                                      int64_t num_bits) {
+  const uint8_t* bytes = bitmap + bit_offset / 8;
+  const int shift = static_cast<int>(bit_offset % 8);
+  if (num_bits == 64) {
+    // Fast path for whole words, spanning 8 or 9 bytes
+    uint64_t word;
+    std::memcpy(&word, bytes, 8);
+    word = BitUtil::FromLittleEndian(word);
+    if (shift == 0) {
+      return word;
+    }
+    return (word >> shift) | (static_cast<uint64_t>(bytes[8]) << (64 - shift));
+  }
+  const int64_t num_bytes = BitUtil::BytesForBits(shift + num_bits);
+  uint64_t word = 0;
+  std::memcpy(&word, bytes, static_cast<size_t>(std::min<int64_t>(num_bytes, 8)));
+  word = BitUtil::FromLittleEndian(word) >> shift;
+  if (num_bytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  if (num_bits < 64) {
+    word &= (static_cast<uint64_t>(1) << num_bits) - 1;
+  }
+  return word;
+}
+
+/// \brief Call visit(int64_t i) for each set bit, in order, where i is the
+/// position relative to start_offset
+///
+/// The bitmap is scanned a 64-bit word at a time, so runs of unset bits are
+/// skipped cheaply.
+template <class Visitor>
+void VisitSetBits(const uint8_t* bitmap, int64_t start_offset, int64_t length,
+                  Visitor&& visit) {
+  for (int64_t word_start = 0; word_start < length; word_start += 64) {
+    uint64_t word = ReadBitmapWord(bitmap, start_offset + word_start,
+                                   std::min<int64_t>(64, length - word_start));
+    while (word != 0) {
+      visit(word_start + BitUtil::CountTrailingZeros(word));
+      // Clear the lowest set bit
+      word &= word - 1;
+    }
+  }
+}
+
 // A function that visits each bit in a bitmap and calls a visitor function with a
 // boolean representation of that bit. This is intended to be analogous to
 // GenerateBits.
@@ -885,6 +981,26 @@ ARROW_EXPORT
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
 
+/// \brief Do a "bitmap and not" for the given bit-length on right and left
+/// buffers starting at their respective bit-offsets and put the results in
+/// out_buffer starting at the given bit offset: bits set in left and unset
+/// in right.
+///
+/// out_buffer will be allocated and initialized to zeros using pool before
+/// the operation.
+ARROW_EXPORT
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    int64_t out_offset, std::shared_ptr<Buffer>* out_buffer);
+
+/// \brief Do a "bitmap and not" for the given bit-length on right and left
+/// buffers starting at their respective bit-offsets and put the results in
+/// out starting at the given bit offset: bits set in left and unset in right.
+ARROW_EXPORT
+void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, int64_t out_offset,
+                  uint8_t* out);
+
 /// \brief Generate Bitmap with all position to `value` except for one found
 /// at `straggler_pos`.
 ARROW_EXPORT
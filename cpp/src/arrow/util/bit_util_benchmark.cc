@@ -25,6 +25,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
 
 namespace arrow {
 
@@ -293,6 +294,91 @@ static void CopyBitmapWithOffset(benchmark::State& state) {  // NOLINT non-const
   CopyBitmap<4>(state);
 }
 
+// Trigger the slow path where the destination is not byte aligned.
+static void CopyBitmapWithDestOffset(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  const int64_t length = buffer_size * 8 - 8;
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+
+  std::shared_ptr<Buffer> copy;
+  ABORT_NOT_OK(AllocateEmptyBitmap(default_memory_pool(), length + 8, &copy));
+
+  for (auto _ : state) {
+    internal::CopyBitmap(buffer->data(), 1, length, copy->mutable_data(), 3, false);
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
+template <int64_t LeftOffset, int64_t RightOffset, int64_t OutOffset>
+static void BenchmarkBitmapAnd(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  const int64_t length = buffer_size * 8 - 8;
+  std::shared_ptr<Buffer> left = CreateRandomBuffer(buffer_size);
+  std::shared_ptr<Buffer> right = CreateRandomBuffer(buffer_size);
+
+  std::shared_ptr<Buffer> out;
+  ABORT_NOT_OK(AllocateEmptyBitmap(default_memory_pool(), length + 8, &out));
+
+  for (auto _ : state) {
+    internal::BitmapAnd(left->data(), LeftOffset, right->data(), RightOffset, length,
+                        OutOffset, out->mutable_data());
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
+static void BitmapAndAligned(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkBitmapAnd<0, 0, 0>(state);
+}
+
+// Offsets that differ modulo 8, so that the inputs must be shifted
+static void BitmapAndUnaligned(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkBitmapAnd<1, 2, 3>(state);
+}
+
+static void VisitSetBits(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  const int64_t length = buffer_size * 8 - 3;
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+
+  for (auto _ : state) {
+    int64_t total = 0;
+    internal::VisitSetBits(buffer->data(), 3, length, [&](int64_t i) { total += i; });
+    benchmark::DoNotOptimize(total);
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
+static void CountSetBitsWithOffset(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t buffer_size = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+
+  for (auto _ : state) {
+    auto count = internal::CountSetBits(buffer->data(), 3, buffer_size * 8 - 60);
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
+static void Unpack32(benchmark::State& state) {  // NOLINT non-const reference
+  const int num_bits = static_cast<int>(state.range(0));
+  const int num_values = 32 * 1024;
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(num_values * num_bits / 8);
+  std::vector<uint32_t> values(num_values);
+
+  for (auto _ : state) {
+    internal::unpack32(reinterpret_cast<const uint32_t*>(buffer->data()), values.data(),
+                       num_values, num_bits);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 static void ReferenceNaiveBitmapReader(benchmark::State& state) {
   BenchmarkBitmapReader<NaiveBitmapReader>(state, state.range(0));
@@ -320,6 +406,13 @@ BENCHMARK(GenerateBitsUnrolled)->Arg(kBufferSize);
 
 BENCHMARK(CopyBitmapWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(CopyBitmapWithOffset)->Arg(kBufferSize);
+BENCHMARK(CopyBitmapWithDestOffset)->Arg(kBufferSize);
+BENCHMARK(BitmapAndAligned)->Arg(kBufferSize);
+BENCHMARK(BitmapAndUnaligned)->Arg(kBufferSize);
+BENCHMARK(VisitSetBits)->Arg(kBufferSize);
+BENCHMARK(CountSetBitsWithOffset)->Arg(kBufferSize);
+
+BENCHMARK(Unpack32)->Arg(1)->Arg(3)->Arg(8)->Arg(13)->Arg(20)->Arg(31);
 
 }  // namespace BitUtil
 }  // namespace arrow
@@ -41,6 +41,7 @@
 namespace arrow {
 
 using internal::BitmapAnd;
+using internal::BitmapAndNot;
 using internal::BitmapOr;
 using internal::BitmapXor;
 using internal::BitsetStack;
@@ -554,6 +555,22 @@ struct BitmapXorOp : public BitmapOperation {
   }
 };
 
+struct BitmapAndNotOp : public BitmapOperation {
+  Status Call(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+              const uint8_t* right, int64_t right_offset, int64_t length,
+              int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) const override {
+    return BitmapAndNot(pool, left, left_offset, right, right_offset, length, out_offset,
+                        out_buffer);
+  }
+
+  Status Call(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+              int64_t right_offset, int64_t length, int64_t out_offset,
+              uint8_t* out_buffer) const override {
+    BitmapAndNot(left, left_offset, right, right_offset, length, out_offset, out_buffer);
+    return Status::OK();
+  }
+};
+
 class BitmapOp : public TestBase {
  public:
   void TestAligned(const BitmapOperation& op, const std::vector<int>& left_bits,
@@ -646,6 +663,45 @@ TEST_F(BitmapOp, XorAligned) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, AndNot) {
+  BitmapAndNotOp op;
+  std::vector<int> left = {0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1};
+  std::vector<int> right = {0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 1, 0, 1, 0};
+  std::vector<int> result = {0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1};
+
+  TestAligned(op, left, right, result);
+  TestUnaligned(op, left, right, result);
+}
+
+TEST_F(BitmapOp, RandomLong) {
+  // Several words, so that the word-at-a-time loops are exercised
+  const int kNumBits = 1000;
+  uint8_t left_bytes[kNumBits / 8], right_bytes[kNumBits / 8];
+  random_bytes(kNumBits / 8, 1, left_bytes);
+  random_bytes(kNumBits / 8, 2, right_bytes);
+  std::vector<int> left, right;
+  for (int i = 0; i < kNumBits; ++i) {
+    left.push_back(BitUtil::GetBit(left_bytes, i));
+    right.push_back(BitUtil::GetBit(right_bytes, i));
+  }
+  std::vector<int> and_result, or_result, xor_result, and_not_result;
+  for (size_t i = 0; i < left.size(); ++i) {
+    and_result.push_back(left[i] & right[i]);
+    or_result.push_back(left[i] | right[i]);
+    xor_result.push_back(left[i] ^ right[i]);
+    and_not_result.push_back(left[i] & !right[i]);
+  }
+
+  TestAligned(BitmapAndOp(), left, right, and_result);
+  TestUnaligned(BitmapAndOp(), left, right, and_result);
+  TestAligned(BitmapOrOp(), left, right, or_result);
+  TestUnaligned(BitmapOrOp(), left, right, or_result);
+  TestAligned(BitmapXorOp(), left, right, xor_result);
+  TestUnaligned(BitmapXorOp(), left, right, xor_result);
+  TestAligned(BitmapAndNotOp(), left, right, and_not_result);
+  TestUnaligned(BitmapAndNotOp(), left, right, and_not_result);
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -679,6 +735,45 @@ TEST(BitUtilTests, TestCountSetBits) {
   }
 }
 
+TEST(BitUtilTests, TestReadBitmapWord) {
+  const int kBufferSize = 32;
+  uint8_t buffer[kBufferSize];
+  random_bytes(kBufferSize, 0, buffer);
+
+  for (const int64_t offset : {0, 1, 7, 8, 13, 64, 100}) {
+    for (const int64_t num_bits : {0, 1, 5, 8, 31, 57, 63, 64}) {
+      const uint64_t word = internal::ReadBitmapWord(buffer, offset, num_bits);
+      for (int64_t i = 0; i < 64; ++i) {
+        const bool expected = i < num_bits && BitUtil::GetBit(buffer, offset + i);
+        ASSERT_EQ(expected, ((word >> i) & 1) != 0)
+            << "offset " << offset << ", num_bits " << num_bits << ", bit " << i;
+      }
+    }
+  }
+}
+
+TEST(BitUtilTests, TestVisitSetBits) {
+  const int kBufferSize = 100;
+  uint8_t buffer[kBufferSize];
+  random_bytes(kBufferSize, 0, buffer);
+  // Leave a few empty words to skip
+  std::memset(buffer + 20, 0, 30);
+
+  for (const int64_t offset : {0, 3, 64, 77}) {
+    for (const int64_t length : {0, 1, 63, 64, 65, 500, kBufferSize * 8 - 77}) {
+      std::vector<int64_t> expected, actual;
+      for (int64_t i = 0; i < length; ++i) {
+        if (BitUtil::GetBit(buffer, offset + i)) {
+          expected.push_back(i);
+        }
+      }
+      internal::VisitSetBits(buffer, offset, length,
+                             [&](int64_t i) { actual.push_back(i); });
+      ASSERT_EQ(expected, actual) << "offset " << offset << ", length " << length;
+    }
+  }
+}
+
 TEST(BitUtilTests, TestSetBitsTo) {
   using BitUtil::SetBitsTo;
   for (const auto fill_byte_int : {0x00, 0xff}) {
@@ -0,0 +1,212 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/bpacking.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/dispatch.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+using UnpackFunc = int (*)(const uint32_t*, uint32_t*, int, int);
+
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+
+// A block of 32 values packed with num_bits bits each spans num_bits words.
+// The kernels unpack a block in groups of kLanes values: each lane fetches the
+// (at most two) words holding its value, shifts them into place and masks the
+// value out, so one loop serves all bit widths.
+//
+// The words of a group are fetched with a single unaligned load of kLanes
+// words and a permute when the group fits in them, and with gathers
+// otherwise, including for the last blocks where that load would read past
+// the input.
+template <int kLanes>
+struct UnpackLayout {
+  static constexpr int kGroups = 32 / kLanes;
+
+  explicit UnpackLayout(int num_bits) {
+    fits_in_lanes = true;
+    for (int g = 0; g < kGroups; ++g) {
+      const int first_bit = g * kLanes * num_bits;
+      group_word[g] = first_bit / 32;
+      const int last_bit = first_bit + kLanes * num_bits - 1;
+      fits_in_lanes = fits_in_lanes && last_bit / 32 - group_word[g] < kLanes;
+    }
+    for (int i = 0; i < 32; ++i) {
+      const int g = i / kLanes;
+      const int bit_pos = i * num_bits;
+      // Word indices are relative to the first word of the group
+      lo_index[i] = bit_pos / 32 - group_word[g];
+      // The upper word is only needed when the value crosses a word boundary;
+      // its index is clamped so the last value never reads past the block.
+      // Permutes only look at the low bits of an index, which is harmless
+      // for values within one word
+      hi_index[i] = std::min(lo_index[i] + 1, num_bits - group_word[g] - 1);
+      lo_shift[i] = bit_pos % 32;
+      // Shifting by 32 yields zero, which drops the upper word when the value
+      // starts at a word boundary
+      hi_shift[i] = 32 - lo_shift[i];
+    }
+  }
+
+  // Blocks from which the unaligned load of every group stays within the
+  // num_blocks blocks of input
+  int NumPermuteBlocks(int num_blocks, int num_bits) const {
+    if (!fits_in_lanes) {
+      return 0;
+    }
+    const int words_past_block = group_word[kGroups - 1] + kLanes - num_bits;
+    const int tail_blocks =
+        words_past_block <= 0 ? 0 : (words_past_block + num_bits - 1) / num_bits;
+    return std::max(0, num_blocks - tail_blocks);
+  }
+
+  int group_word[kGroups];
+  bool fits_in_lanes;
+  alignas(64) int32_t lo_index[32];
+  alignas(64) int32_t hi_index[32];
+  alignas(64) int32_t lo_shift[32];
+  alignas(64) int32_t hi_shift[32];
+};
+
+#define ARROW_LOAD_LAYOUT_AVX2(FIELD, GROUP) \
+  _mm256_load_si256(reinterpret_cast<const __m256i*>(layout.FIELD + (GROUP)*kLanes))
+
+ARROW_TARGET_AVX2 int Unpack32Avx2(const uint32_t* in, uint32_t* out, int batch_size,
+                                   int num_bits) {
+  constexpr int kLanes = 8;
+  constexpr int kGroups = 32 / kLanes;
+  const int num_blocks = batch_size / 32;
+  const UnpackLayout<kLanes> layout(num_bits);
+  const int num_permute_blocks = layout.NumPermuteBlocks(num_blocks, num_bits);
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>((1ULL << num_bits) - 1));
+
+  __m256i lo_index[kGroups], hi_index[kGroups], lo_shift[kGroups], hi_shift[kGroups];
+  for (int g = 0; g < kGroups; ++g) {
+    lo_index[g] = ARROW_LOAD_LAYOUT_AVX2(lo_index, g);
+    hi_index[g] = ARROW_LOAD_LAYOUT_AVX2(hi_index, g);
+    lo_shift[g] = ARROW_LOAD_LAYOUT_AVX2(lo_shift, g);
+    hi_shift[g] = ARROW_LOAD_LAYOUT_AVX2(hi_shift, g);
+  }
+
+  for (int block = 0; block < num_blocks; ++block) {
+    for (int g = 0; g < kGroups; ++g) {
+      const int* words = reinterpret_cast<const int*>(in + layout.group_word[g]);
+      __m256i lo, hi;
+      if (block < num_permute_blocks) {
+        const __m256i window =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(words));
+        lo = _mm256_permutevar8x32_epi32(window, lo_index[g]);
+        hi = _mm256_permutevar8x32_epi32(window, hi_index[g]);
+      } else {
+        lo = _mm256_i32gather_epi32(words, lo_index[g], 4);
+        hi = _mm256_i32gather_epi32(words, hi_index[g], 4);
+      }
+      const __m256i values = _mm256_and_si256(
+          _mm256_or_si256(_mm256_srlv_epi32(lo, lo_shift[g]),
+                          _mm256_sllv_epi32(hi, hi_shift[g])),
+          mask);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + g * kLanes), values);
+    }
+    in += num_bits;
+    out += 32;
+  }
+  return num_blocks * 32;
+}
+
+#undef ARROW_LOAD_LAYOUT_AVX2
+
+ARROW_TARGET_AVX512F int Unpack32Avx512(const uint32_t* in, uint32_t* out,
+                                        int batch_size, int num_bits) {
+  constexpr int kLanes = 16;
+  constexpr int kGroups = 32 / kLanes;
+  const int num_blocks = batch_size / 32;
+  const UnpackLayout<kLanes> layout(num_bits);
+  const int num_permute_blocks = layout.NumPermuteBlocks(num_blocks, num_bits);
+  const __m512i mask = _mm512_set1_epi32(static_cast<int>((1ULL << num_bits) - 1));
+  // Masked forms of the gathers and shifts, since the unmasked ones start
+  // from an undefined vector which GCC warns about
+  const __m512i zero = _mm512_setzero_si512();
+  const __mmask16 all_lanes = 0xFFFF;
+
+  __m512i lo_index[kGroups], hi_index[kGroups], lo_shift[kGroups], hi_shift[kGroups];
+  for (int g = 0; g < kGroups; ++g) {
+    lo_index[g] = _mm512_load_si512(layout.lo_index + g * kLanes);
+    hi_index[g] = _mm512_load_si512(layout.hi_index + g * kLanes);
+    lo_shift[g] = _mm512_load_si512(layout.lo_shift + g * kLanes);
+    hi_shift[g] = _mm512_load_si512(layout.hi_shift + g * kLanes);
+  }
+
+  for (int block = 0; block < num_blocks; ++block) {
+    for (int g = 0; g < kGroups; ++g) {
+      const uint32_t* words = in + layout.group_word[g];
+      __m512i lo, hi;
+      if (block < num_permute_blocks) {
+        const __m512i window = _mm512_loadu_si512(words);
+        lo = _mm512_maskz_permutexvar_epi32(all_lanes, lo_index[g], window);
+        hi = _mm512_maskz_permutexvar_epi32(all_lanes, hi_index[g], window);
+      } else {
+        lo = _mm512_mask_i32gather_epi32(zero, all_lanes, lo_index[g], words, 4);
+        hi = _mm512_mask_i32gather_epi32(zero, all_lanes, hi_index[g], words, 4);
+      }
+      const __m512i values = _mm512_and_si512(
+          _mm512_or_si512(_mm512_maskz_srlv_epi32(all_lanes, lo, lo_shift[g]),
+                          _mm512_maskz_sllv_epi32(all_lanes, hi, hi_shift[g])),
+          mask);
+      _mm512_storeu_si512(out + g * kLanes, values);
+    }
+    in += num_bits;
+    out += 32;
+  }
+  return num_blocks * 32;
+}
+
+#endif  // ARROW_HAVE_RUNTIME_X86_SIMD
+
+UnpackFunc SelectUnpack32() {
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+  auto cpu_info = CpuInfo::GetInstance();
+  if (cpu_info->IsSupported(CpuInfo::AVX512F)) {
+    return Unpack32Avx512;
+  } else if (cpu_info->IsSupported(CpuInfo::AVX2)) {
+    return Unpack32Avx2;
+  }
+#endif
+  return unpack32_default;
+}
+
+}  // namespace
+
+int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  // Widths 0 and 32 are a fill and a copy, which the portable kernels handle
+  // as well as any SIMD loop
+  if (num_bits == 0 || num_bits == 32) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+  static const UnpackFunc unpack = SelectUnpack32();
+  return unpack(in, out, batch_size, num_bits);
+}
+
+}  // namespace internal
+}  // namespace arrow
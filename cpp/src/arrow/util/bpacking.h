@@ -29,6 +29,7 @@
 
 #include "arrow/util/logging.h"
 #include "arrow/util/ubsan.h"
+#include "arrow/util/visibility.h"
 
 namespace arrow {
 namespace internal {
@@ -3720,7 +3721,11 @@ inline const uint32_t* nullunpacker32(const uint32_t* in, uint32_t* out) {
   return in;
 }
 
-inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+/// \brief Unpack whole blocks of 32 values with the portable kernels above.
+/// Returns the number of values unpacked, batch_size rounded down to a
+/// multiple of 32
+inline int unpack32_default(const uint32_t* in, uint32_t* out, int batch_size,
+                            int num_bits) {
   batch_size = batch_size / 32 * 32;
   int num_loops = batch_size / 32;
 
@@ -3831,6 +3836,11 @@ inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_b
   return batch_size;
 }
 
+/// \brief Like unpack32_default, but using the AVX2 or AVX-512 kernel when
+/// the CPU supports it
+ARROW_EXPORT int unpack32(const uint32_t* in, uint32_t* out, int batch_size,
+                          int num_bits);
+
 }  // namespace internal
 }  // namespace arrow
 
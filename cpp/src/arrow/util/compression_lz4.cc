@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 
 #include <lz4.h>
 #include <lz4frame.h>
@@ -286,12 +287,20 @@ int64_t Lz4Codec::MaxCompressedLen(int64_t input_len,
   return LZ4_compressBound(static_cast<int>(input_len));
 }
 
+// One-shot compression state, allocated once per thread instead of on the
+// stack for every call
+static void* GetThreadCompressionState() {
+  static thread_local std::unique_ptr<char[]> state(new char[LZ4_sizeofState()]);
+  return state.get();
+}
+
 Status Lz4Codec::Compress(int64_t input_len, const uint8_t* input,
                           int64_t output_buffer_len, uint8_t* output_buffer,
                           int64_t* output_len) {
-  *output_len = LZ4_compress_default(
-      reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
-      static_cast<int>(input_len), static_cast<int>(output_buffer_len));
+  *output_len = LZ4_compress_fast_extState(
+      GetThreadCompressionState(), reinterpret_cast<const char*>(input),
+      reinterpret_cast<char*>(output_buffer), static_cast<int>(input_len),
+      static_cast<int>(output_buffer_len), 1 /* acceleration */);
   if (*output_len == 0) {
     return Status::IOError("Lz4 compression failure.");
   }
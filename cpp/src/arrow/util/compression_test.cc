@@ -26,9 +26,13 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
+#ifdef ARROW_WITH_ZSTD
+#include "arrow/util/compression_zstd.h"
+#endif
 
 namespace arrow {
 namespace util {
@@ -543,6 +547,39 @@ INSTANTIATE_TEST_CASE_P(TestBZ2, CodecTest, ::testing::Values(Compression::BZ2))
 // require it here
 #ifdef ARROW_WITH_ZSTD
 INSTANTIATE_TEST_CASE_P(TestZSTD, CodecTest, ::testing::Values(Compression::ZSTD));
+
+TEST(TestZSTDCodec, Dictionary) {
+  // Many small, similar inputs, as with data pages
+  auto make_sample = [](int i) {
+    return "row " + std::to_string(i) + ": Apache Arrow is a cross-language " +
+           "development platform, value " + std::to_string(i * 7919 % 1000);
+  };
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (int i = 0; i < 1000; ++i) {
+    samples.push_back(Buffer::FromString(make_sample(i)));
+  }
+  std::shared_ptr<Buffer> dictionary;
+  ASSERT_OK(ZSTDCodec::TrainDictionary(samples, 4096, &dictionary));
+  ASSERT_GT(dictionary->size(), 0);
+
+  std::unique_ptr<Codec> c1(new ZSTDCodec()), c2(new ZSTDCodec());
+  ASSERT_OK(static_cast<ZSTDCodec*>(c1.get())->SetDictionary(dictionary));
+  ASSERT_OK(static_cast<ZSTDCodec*>(c2.get())->SetDictionary(dictionary));
+  const std::string page = make_sample(123456);
+  CheckCodecRoundtrip(c1, c2, std::vector<uint8_t>(page.begin(), page.end()));
+  CheckCodecRoundtrip(c1, c2, MakeCompressibleData(10000));
+
+  // The dictionary makes small inputs smaller
+  ZSTDCodec plain;
+  const auto data = reinterpret_cast<const uint8_t*>(page.data());
+  const auto size = static_cast<int64_t>(page.size());
+  std::vector<uint8_t> compressed(plain.MaxCompressedLen(size, data));
+  int64_t plain_size, dictionary_size;
+  const auto capacity = static_cast<int64_t>(compressed.size());
+  ASSERT_OK(plain.Compress(size, data, capacity, compressed.data(), &plain_size));
+  ASSERT_OK(c1->Compress(size, data, capacity, compressed.data(), &dictionary_size));
+  ASSERT_LT(dictionary_size, plain_size);
+}
 #endif
 
 }  // namespace util
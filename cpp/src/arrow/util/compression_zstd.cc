@@ -19,9 +19,12 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -37,8 +40,100 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+// One-shot compression and decompression contexts, created once per thread
+// and reused, as setting one up costs about as much as compressing a small
+// page
+struct ZSTDThreadContexts {
+  ~ZSTDThreadContexts() {
+    ZSTD_freeCCtx(compression);
+    ZSTD_freeDCtx(decompression);
+  }
+
+  ZSTD_CCtx* compression = nullptr;
+  ZSTD_DCtx* decompression = nullptr;
+};
+
+ZSTDThreadContexts* GetThreadContexts() {
+  static thread_local ZSTDThreadContexts contexts;
+  return &contexts;
+}
+
+Status GetCompressionContext(ZSTD_CCtx** out) {
+  auto contexts = GetThreadContexts();
+  if (contexts->compression == nullptr) {
+    contexts->compression = ZSTD_createCCtx();
+    if (contexts->compression == nullptr) {
+      return Status::OutOfMemory("ZSTD_createCCtx failed");
+    }
+  }
+  *out = contexts->compression;
+  return Status::OK();
+}
+
+Status GetDecompressionContext(ZSTD_DCtx** out) {
+  auto contexts = GetThreadContexts();
+  if (contexts->decompression == nullptr) {
+    contexts->decompression = ZSTD_createDCtx();
+    if (contexts->decompression == nullptr) {
+      return Status::OutOfMemory("ZSTD_createDCtx failed");
+    }
+  }
+  *out = contexts->decompression;
+  return Status::OK();
+}
+
 }  // namespace
 
+// ----------------------------------------------------------------------
+// ZSTD dictionary
+
+struct ZSTDCodec::Dictionary {
+  ~Dictionary() {
+    ZSTD_freeCDict(compression);
+    ZSTD_freeDDict(decompression);
+  }
+
+  ZSTD_CDict* compression = nullptr;
+  ZSTD_DDict* decompression = nullptr;
+};
+
+Status ZSTDCodec::TrainDictionary(const std::vector<std::shared_ptr<Buffer>>& samples,
+                                  int64_t max_dictionary_size,
+                                  std::shared_ptr<Buffer>* out) {
+  std::vector<uint8_t> sample_data;
+  std::vector<size_t> sample_sizes;
+  for (const auto& sample : samples) {
+    sample_data.insert(sample_data.end(), sample->data(),
+                       sample->data() + sample->size());
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+  }
+
+  std::shared_ptr<ResizableBuffer> dictionary;
+  RETURN_NOT_OK(AllocateResizableBuffer(max_dictionary_size, &dictionary));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_dictionary_size),
+      sample_data.data(), sample_sizes.data(), static_cast<unsigned>(samples.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  *out = dictionary;
+  return Status::OK();
+}
+
+Status ZSTDCodec::SetDictionary(const std::shared_ptr<Buffer>& dictionary) {
+  auto digested = std::make_shared<Dictionary>();
+  digested->compression = ZSTD_createCDict(
+      dictionary->data(), static_cast<size_t>(dictionary->size()), compression_level_);
+  digested->decompression =
+      ZSTD_createDDict(dictionary->data(), static_cast<size_t>(dictionary->size()));
+  if (digested->compression == nullptr || digested->decompression == nullptr) {
+    return Status::Invalid("Invalid ZSTD dictionary");
+  }
+  dictionary_ = std::move(digested);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
@@ -225,8 +320,19 @@ Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input,
     output_buffer = empty_buffer;
   }
 
-  size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len));
+  ZSTD_DCtx* context;
+  RETURN_NOT_OK(GetDecompressionContext(&context));
+  size_t ret;
+  if (dictionary_) {
+    ret = ZSTD_decompress_usingDDict(context, output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len),
+                                     dictionary_->decompression);
+  } else {
+    ret = ZSTD_decompressDCtx(context, output_buffer,
+                              static_cast<size_t>(output_buffer_len), input,
+                              static_cast<size_t>(input_len));
+  }
   if (ZSTD_isError(ret)) {
     return ZSTDError(ret, "ZSTD decompression failed: ");
   }
@@ -248,8 +354,19 @@ int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
 Status ZSTDCodec::Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer,
                            int64_t* output_len) {
-  size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
-                             static_cast<size_t>(input_len), compression_level_);
+  ZSTD_CCtx* context;
+  RETURN_NOT_OK(GetCompressionContext(&context));
+  size_t ret;
+  if (dictionary_) {
+    ret = ZSTD_compress_usingCDict(context, output_buffer,
+                                   static_cast<size_t>(output_buffer_len), input,
+                                   static_cast<size_t>(input_len),
+                                   dictionary_->compression);
+  } else {
+    ret = ZSTD_compressCCtx(context, output_buffer,
+                            static_cast<size_t>(output_buffer_len), input,
+                            static_cast<size_t>(input_len), compression_level_);
+  }
   if (ZSTD_isError(ret)) {
     return ZSTDError(ret, "ZSTD compression failed: ");
   }
@@ -177,16 +177,26 @@ static constexpr int64_t kPowersOfTen[kInt64DecimalDigits + 1] = {1LL,
                                                                   100000000000000000LL,
                                                                   1000000000000000000LL};
 
+// Any run of this many digits fits in a uint64_t
+static constexpr size_t kUInt64DecimalDigits = kInt64DecimalDigits + 1;
+
+// Appends data, a run of decimal digits, to the digits of value
+static inline uint64_t AccumulateDigits(const char* data, size_t length,
+                                        uint64_t value) {
+  for (size_t i = 0; i < length; ++i) {
+    value = value * 10 + static_cast<uint64_t>(data[i] - '0');
+  }
+  return value;
+}
+
 // Iterates over data and for each group of kInt64DecimalDigits multiple out by
 // the appropriate power of 10 necessary to add source parsed as uint64 and
 // then adds the parsed value of source.
 static inline void ShiftAndAdd(const char* data, size_t length, Decimal128* out) {
-  internal::StringConverter<Int64Type> converter;
   for (size_t posn = 0; posn < length;) {
     const size_t group_size = std::min(kInt64DecimalDigits, length - posn);
     const int64_t multiple = kPowersOfTen[group_size];
-    int64_t chunk = 0;
-    ARROW_CHECK(converter(data + posn, group_size, &chunk));
+    const auto chunk = static_cast<int64_t>(AccumulateDigits(data + posn, group_size, 0));
 
     *out *= multiple;
     *out += chunk;
@@ -205,6 +215,13 @@ static void StringToInteger(const util::string_view whole_digits,
   DCHECK_GT(whole_digits.size() + fractional_digits.size(), 0)
       << "length of parsed decimal string should be greater than 0";
 
+  if (whole_digits.size() + fractional_digits.size() <= kUInt64DecimalDigits) {
+    // Most values fit in 64 bits: parse them without 128-bit multiplications
+    uint64_t value = AccumulateDigits(whole_digits.data(), whole_digits.size(), 0);
+    value = AccumulateDigits(fractional_digits.data(), fractional_digits.size(), value);
+    *out = Decimal128(0, value);
+    return;
+  }
   ShiftAndAdd(whole_digits.data(), whole_digits.length(), out);
   ShiftAndAdd(fractional_digits.data(), fractional_digits.length(), out);
 }
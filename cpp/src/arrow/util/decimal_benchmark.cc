@@ -46,6 +46,23 @@ static void FromString(benchmark::State& state) {  // NOLINT non-const reference
 
 constexpr int32_t kValueSize = 10;
 
+static void Rescale(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<Decimal128> v;
+  for (int x = 0; x < kValueSize; x++) {
+    v.emplace_back(123456789 * (x - kValueSize / 2));
+  }
+  // A value which takes more than 64 bits
+  v.emplace_back(100, 0);
+  for (auto _ : state) {
+    for (const auto& value : v) {
+      Decimal128 result;
+      benchmark::DoNotOptimize(value.Rescale(2, 9, &result));
+      benchmark::DoNotOptimize(result.Rescale(9, 2, &result));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * v.size() * 2);
+}
+
 static void BinaryCompareOp(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<BasicDecimal128> v1, v2;
   for (int x = 0; x < kValueSize; x++) {
@@ -158,6 +175,7 @@ static void BinaryBitOp(benchmark::State& state) {  // NOLINT non-const referenc
 }
 
 BENCHMARK(FromString);
+BENCHMARK(Rescale);
 BENCHMARK(BinaryMathOp);
 BENCHMARK(BinaryMathOpAggregate);
 BENCHMARK(BinaryCompareOp);
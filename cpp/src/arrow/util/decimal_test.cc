@@ -19,6 +19,7 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <limits>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -93,6 +94,19 @@ TEST(DecimalTest, TestFromStringDecimal128) {
   ASSERT_NE(result.high_bits(), 0);
 }
 
+TEST(DecimalTest, TestFromStringUInt64Boundary) {
+  // Up to 19 digits are parsed in 64 bits, more in 128 bits
+  Decimal128 result;
+  ASSERT_OK(Decimal128::FromString("9999999999999.999999", &result));
+  ASSERT_EQ(result, Decimal128(0, 9999999999999999999ULL));
+  ASSERT_OK(Decimal128::FromString("-9999999999999999999", &result));
+  ASSERT_EQ(result, -Decimal128(0, 9999999999999999999ULL));
+  ASSERT_OK(Decimal128::FromString("18446744073709551615", &result));
+  ASSERT_EQ(result, Decimal128(0, 18446744073709551615ULL));
+  ASSERT_OK(Decimal128::FromString("184467440737095516.16", &result));
+  ASSERT_EQ(result, Decimal128(1, 0));
+}
+
 TEST(DecimalTest, TestFromDecimalString128) {
   std::string string_value("-23049223942343.532412");
   Decimal128 result;
@@ -659,6 +673,31 @@ TEST(Decimal128Test, IncreaseScale) {
   ASSERT_EQ(-1234000, out);
 }
 
+TEST(Decimal128Test, Rescale) {
+  Decimal128 result;
+
+  ASSERT_OK(Decimal128(1234).Rescale(0, 3, &result));
+  ASSERT_EQ(result, 1234000);
+  ASSERT_OK(Decimal128(-1234).Rescale(2, 20, &result));
+  ASSERT_EQ(result, Decimal128(-1234) * Decimal128::GetScaleMultiplier(18));
+  ASSERT_OK(Decimal128(-1234000).Rescale(3, 0, &result));
+  ASSERT_EQ(result, -1234);
+  ASSERT_RAISES(Invalid, Decimal128(1234).Rescale(3, 0, &result));
+  ASSERT_RAISES(Invalid, Decimal128(-1234).Rescale(1, 0, &result));
+
+  // Values and multipliers which don't fit in an int64
+  const Decimal128 int64_min(std::numeric_limits<int64_t>::min());
+  ASSERT_OK(int64_min.Rescale(0, 18, &result));
+  ASSERT_EQ(result, int64_min * Decimal128::GetScaleMultiplier(18));
+  ASSERT_OK(Decimal128(7).Rescale(0, 30, &result));
+  ASSERT_EQ(result, Decimal128(7) * Decimal128::GetScaleMultiplier(30));
+  ASSERT_OK(result.Rescale(30, 1, &result));
+  ASSERT_EQ(result, 70);
+  ASSERT_OK(Decimal128(int64_min * 100).Rescale(2, 0, &result));
+  ASSERT_EQ(result, int64_min);
+  ASSERT_RAISES(Invalid, Decimal128(int64_min * 100 + 1).Rescale(2, 0, &result));
+}
+
 TEST(Decimal128Test, ReduceScaleAndRound) {
   Decimal128 result;
   int32_t out;
@@ -0,0 +1,34 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Attributes for compiling functions for x86 targets beyond the baseline of
+// the build, to be selected at runtime according to CpuInfo.  Only include
+// this in .cc files.
+
+#pragma once
+
+#if defined(ARROW_USE_SIMD) && defined(__GNUC__) && defined(__x86_64__)
+#define ARROW_HAVE_RUNTIME_X86_SIMD
+#include <immintrin.h>
+
+#define ARROW_TARGET_SSE4_2 __attribute__((target("sse4.2")))
+#define ARROW_TARGET_AVX2 __attribute__((target("avx2")))
+// AVX-512 Foundation only, for CPUs with CpuInfo::AVX512F
+#define ARROW_TARGET_AVX512F __attribute__((target("avx2,avx512f")))
+// AVX-512 Foundation and Byte/Word, for CPUs with CpuInfo::AVX512F and AVX512BW
+#define ARROW_TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512bw")))
+#endif
@@ -244,6 +244,25 @@ class HashUtil {
     return (static_cast<uint64_t>(h1) << 32) + h2;
   }
 
+  /// Multiply two 64-bit values into 128 bits and xor both halves of the product.
+  /// All bits of both inputs thus affect the middle bits of the result.
+  static uint64_t MultiplyFold(uint64_t a, uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 uint128_t;
+    const uint128_t product = static_cast<uint128_t>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    const uint64_t a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+    const uint64_t b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+    const uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+    const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+    const uint64_t high = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    const uint64_t low = (cross << 32) | (lo_lo & 0xFFFFFFFFULL);
+    return low ^ high;
+#endif
+  }
+
   static const uint64_t MURMUR_PRIME = 0xc6a4a7935bd1e995;
   static const int MURMUR_R = 47;
 
@@ -166,6 +166,22 @@ hash_t ComputeStringHash(const void* data, int64_t length) {
     return n ^ hx ^ hy;
   }
 
+  if (length <= 32) {
+    // 16 < length <= 32
+    // Read the string as two overlapping 128-bit halves and fold each of them
+    // with a 64x64->128-bit multiply, which is cheaper than CRC for such sizes
+    auto p = reinterpret_cast<const uint8_t*>(data);
+    auto n = static_cast<uint64_t>(length);
+    static constexpr uint64_t seeds[] = {11400714785074694791ULL,
+                                         14029467366897019727ULL};
+    const uint64_t s0 = seeds[AlgNum], s1 = seeds[AlgNum ^ 1];
+    hash_t h = HashUtil::MultiplyFold(util::SafeLoadAs<uint64_t>(p) ^ s0,
+                                      util::SafeLoadAs<uint64_t>(p + 8) ^ s1);
+    h ^= HashUtil::MultiplyFold(util::SafeLoadAs<uint64_t>(p + n - 16) ^ s1,
+                                util::SafeLoadAs<uint64_t>(p + n - 8) ^ s0);
+    return ScalarHelper<uint64_t, AlgNum>::ComputeHash(n ^ h);
+  }
+
   if (HashUtil::have_hardware_crc32) {
 #ifdef ARROW_HAVE_ARMV8_CRYPTO
     auto h = HashUtil::Armv8CrcHashParallel(data, static_cast<int32_t>(length), AlgNum);
@@ -230,6 +246,15 @@ class HashTable {
     return {&entries_[p.first], p.second};
   }
 
+  // The hash under which a value of the given hash is stored, which differs
+  // from it only for the sentinel
+  static hash_t FixHash(hash_t h) { return (h == kSentinel) ? 42U : h; }
+
+  // Prefetch the first slot that a lookup of the given hash will probe
+  void Prefetch(hash_t h) const {
+    ARROW_PREFETCH(&entries_[FixHash(h) & capacity_mask_]);
+  }
+
   void Insert(Entry* entry, hash_t h, const Payload& payload) {
     // Ensure entry is empty before inserting
     assert(!*entry);
@@ -345,8 +370,6 @@ class HashTable {
     return Status::OK();
   }
 
-  hash_t FixHash(hash_t h) const { return (h == kSentinel) ? 42U : h; }
-
   // The number of slots available in the hash table array.
   uint64_t capacity_;
   uint64_t capacity_mask_;
@@ -361,6 +384,114 @@ class HashTable {
 
 constexpr int32_t kKeyNotFound = -1;
 
+// The number of values whose hashes are computed and whose slots are
+// prefetched at once by GetOrInsertBatch()
+constexpr int64_t kHashBatchSize = 32;
+
+// ----------------------------------------------------------------------
+// A blocked Bloom filter of hashes, after BlockSplitBloomFilter in
+// parquet/bloom_filter.h.  A hash sets one bit in each of the eight 32-bit
+// words of a single 32-byte block, so that a lookup reads one cache line.
+// Memo tables of large value sets are much bigger than the filter, which
+// therefore answers most misses without their cache misses.
+
+class BlockedBloomFilter {
+ public:
+  explicit BlockedBloomFilter(MemoryPool* pool) : pool_(pool) {}
+
+  // Allocate an empty filter for about `num_hashes` hashes, at 16 bits per
+  // hash (a false positive rate below 0.5%)
+  Status Init(int64_t num_hashes) {
+    const int64_t num_bytes = std::max<int64_t>(kBytesPerBlock, num_hashes * 2);
+    num_blocks_ = BitUtil::NextPower2((num_bytes + kBytesPerBlock - 1) / kBytesPerBlock);
+    block_shift_ = 64;
+    for (int64_t n = num_blocks_; n > 1; n >>= 1) {
+      --block_shift_;
+    }
+    // A single block is selected by the mask alone
+    block_shift_ = std::min(block_shift_, 63);
+    RETURN_NOT_OK(AllocateBuffer(pool_, num_blocks_ * kBytesPerBlock, &buffer_));
+    memset(buffer_->mutable_data(), 0, buffer_->size());
+    blocks_ = reinterpret_cast<uint32_t*>(buffer_->mutable_data());
+    return Status::OK();
+  }
+
+  void Insert(hash_t h) {
+    uint32_t* block = Block(h);
+    const uint32_t key = static_cast<uint32_t>(h);
+    for (int i = 0; i < kBitsSetPerBlock; ++i) {
+      block[i] |= BitMask(key, i);
+    }
+  }
+
+  // Whether a hash may have been inserted.  False positives mean that the
+  // caller must still look hits up.
+  bool MayContain(hash_t h) const {
+    const uint32_t* block = Block(h);
+    const uint32_t key = static_cast<uint32_t>(h);
+#ifdef ARROW_HAVE_SSE4_2
+    // Test the eight words four at a time.  1 << n is computed as the float
+    // 2^n converted to an integer, as SSE has no variable shift; 2^31
+    // overflows to 0x80000000, which is indeed 1 << 31.
+    const __m128i keys = _mm_set1_epi32(static_cast<int32_t>(key));
+    const __m128i one = _mm_set1_epi32(0x3f800000);  // 1.0f
+    auto bit_masks = [&](__m128i salts) {
+      const __m128i shifts = _mm_srli_epi32(_mm_mullo_epi32(keys, salts), 27);
+      const __m128i powers = _mm_add_epi32(_mm_slli_epi32(shifts, 23), one);
+      return _mm_cvttps_epi32(_mm_castsi128_ps(powers));
+    };
+    const __m128i masks_lo = bit_masks(_mm_setr_epi32(0x47b6137b, 0x44974d91,
+                                                      0x8824ad5b, 0xa2b7289d));
+    const __m128i masks_hi = bit_masks(_mm_setr_epi32(0x705495c7, 0x2df1424b,
+                                                      0x9efc4947, 0x5c6bfb31));
+    const __m128i block_lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+    const __m128i block_hi =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 4));
+    const __m128i missing = _mm_or_si128(_mm_andnot_si128(block_lo, masks_lo),
+                                         _mm_andnot_si128(block_hi, masks_hi));
+    return _mm_testz_si128(missing, missing) != 0;
+#else
+    // Branch-free so that the eight words are tested together
+    uint32_t missing = 0;
+    for (int i = 0; i < kBitsSetPerBlock; ++i) {
+      missing |= BitMask(key, i) & ~block[i];
+    }
+    return missing == 0;
+#endif
+  }
+
+  // Prefetch the block of a hash
+  void Prefetch(hash_t h) const { ARROW_PREFETCH(Block(h)); }
+
+  int64_t size_bytes() const { return num_blocks_ * kBytesPerBlock; }
+
+ private:
+  static constexpr int kBitsSetPerBlock = 8;
+  static constexpr int64_t kBytesPerBlock = kBitsSetPerBlock * sizeof(uint32_t);
+
+  // The bit of word i of a block set by a key
+  static uint32_t BitMask(uint32_t key, int i) {
+    // Eight odd salts, as in parquet::BlockSplitBloomFilter
+    static constexpr uint32_t salt[kBitsSetPerBlock] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+    return UINT32_C(1) << ((key * salt[i]) >> 27);
+  }
+
+  // The block is chosen by the high bits of a multiplicative remix of the hash,
+  // as the hashes of integers are only well mixed in some of their bits
+  uint32_t* Block(hash_t h) const {
+    const uint64_t index = (h * 0x9E3779B97F4A7C15ULL) >> block_shift_;
+    return blocks_ + (index & (num_blocks_ - 1)) * kBitsSetPerBlock;
+  }
+
+  MemoryPool* pool_;
+  std::shared_ptr<Buffer> buffer_;
+  uint32_t* blocks_ = NULLPTR;
+  int64_t num_blocks_ = 0;
+  int block_shift_ = 64;
+};
+
 // ----------------------------------------------------------------------
 // A base class for memoization table.
 
@@ -383,42 +514,95 @@ class ScalarMemoTable : public MemoTable {
   explicit ScalarMemoTable(MemoryPool* pool, int64_t entries = 0)
       : hash_table_(pool, static_cast<uint64_t>(entries)) {}
 
-  int32_t Get(const Scalar& value) const {
-    auto cmp_func = [value](const Payload* payload) -> bool {
-      return ScalarHelper<Scalar, 0>::CompareScalars(payload->value, value);
-    };
-    hash_t h = ComputeHash(value);
-    auto p = hash_table_.Lookup(h, cmp_func);
-    if (p.second) {
-      return p.first->payload.memo_index;
-    } else {
-      return kKeyNotFound;
-    }
-  }
+  int32_t Get(const Scalar& value) const { return Get(value, ComputeHash(value)); }
 
   template <typename Func1, typename Func2>
   int32_t GetOrInsert(const Scalar& value, Func1&& on_found, Func2&& on_not_found) {
-    auto cmp_func = [value](const Payload* payload) -> bool {
-      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
-    };
-    hash_t h = ComputeHash(value);
-    auto p = hash_table_.Lookup(h, cmp_func);
-    int32_t memo_index;
-    if (p.second) {
-      memo_index = p.first->payload.memo_index;
-      on_found(memo_index);
-    } else {
-      memo_index = size();
-      hash_table_.Insert(p.first, h, {value, memo_index});
-      on_not_found(memo_index);
-    }
-    return memo_index;
+    return GetOrInsert(value, ComputeHash(value), std::forward<Func1>(on_found),
+                       std::forward<Func2>(on_not_found));
   }
 
   int32_t GetOrInsert(const Scalar& value) {
     return GetOrInsert(value, [](int32_t i) {}, [](int32_t i) {});
   }
 
+  // Look up or insert `length` values, calling on_found or on_not_found for
+  // each of them in order.  The hashes of a block of values are computed
+  // first and their slots prefetched, so that the cache misses of the lookups
+  // overlap instead of being paid one after the other.
+  template <typename Func1, typename Func2>
+  void GetOrInsertBatch(const Scalar* values, int64_t length, Func1&& on_found,
+                        Func2&& on_not_found) {
+    hash_t hashes[kHashBatchSize];
+    for (int64_t offset = 0; offset < length; offset += kHashBatchSize) {
+      const Scalar* block = values + offset;
+      const int64_t block_length = std::min(kHashBatchSize, length - offset);
+      for (int64_t i = 0; i < block_length; ++i) {
+        hashes[i] = ComputeHash(block[i]);
+      }
+      for (int64_t i = 0; i < block_length; ++i) {
+        hash_table_.Prefetch(hashes[i]);
+      }
+      for (int64_t i = 0; i < block_length; ++i) {
+        GetOrInsert(block[i], hashes[i], on_found, on_not_found);
+      }
+    }
+  }
+
+  // Look up or insert `length` values, writing their memo indices to `out`
+  void GetOrInsertBatch(const Scalar* values, int64_t length, int32_t* out) {
+    auto on_index = [&out](int32_t i) { *out++ = i; };
+    GetOrInsertBatch(values, length, on_index, on_index);
+  }
+
+  // Look up `length` values, writing their memo indices, or kKeyNotFound, to
+  // `out`.  The values rejected by `filter`, if not null, are not looked up.
+  // The filter blocks and then the slots of a block of values are prefetched
+  // before probing, as in GetOrInsertBatch().
+  void GetBatch(const Scalar* values, int64_t length, const BlockedBloomFilter* filter,
+                int32_t* out) const {
+    hash_t hashes[kHashBatchSize];
+    int64_t candidates[kHashBatchSize];
+    for (int64_t offset = 0; offset < length; offset += kHashBatchSize) {
+      const Scalar* block = values + offset;
+      int32_t* block_out = out + offset;
+      const int64_t block_length = std::min(kHashBatchSize, length - offset);
+      for (int64_t i = 0; i < block_length; ++i) {
+        hashes[i] = ComputeHash(block[i]);
+      }
+      int64_t num_candidates = 0;
+      if (filter != NULLPTR) {
+        for (int64_t i = 0; i < block_length; ++i) {
+          filter->Prefetch(HashTableType::FixHash(hashes[i]));
+        }
+        for (int64_t i = 0; i < block_length; ++i) {
+          block_out[i] = kKeyNotFound;
+          candidates[num_candidates] = i;
+          num_candidates += filter->MayContain(HashTableType::FixHash(hashes[i]));
+        }
+      } else {
+        for (int64_t i = 0; i < block_length; ++i) {
+          candidates[num_candidates++] = i;
+        }
+      }
+      for (int64_t j = 0; j < num_candidates; ++j) {
+        hash_table_.Prefetch(hashes[candidates[j]]);
+      }
+      for (int64_t j = 0; j < num_candidates; ++j) {
+        const int64_t i = candidates[j];
+        block_out[i] = Get(block[i], hashes[i]);
+      }
+    }
+  }
+
+  // Visit the hashes of the stored values, as given to a BlockedBloomFilter
+  // by GetBatch().  The visitor function should have the signature
+  // `void(hash_t)`.
+  template <typename VisitFunc>
+  void VisitHashes(VisitFunc&& visit) const {
+    hash_table_.VisitEntries([&](const HashTableEntry* entry) { visit(entry->h); });
+  }
+
   int32_t GetNull() const { return null_index_; }
 
   template <typename Func1, typename Func2>
@@ -469,6 +653,37 @@ class ScalarMemoTable : public MemoTable {
   hash_t ComputeHash(const Scalar& value) const {
     return ScalarHelper<Scalar, 0>::ComputeHash(value);
   }
+
+  int32_t Get(const Scalar& value, hash_t h) const {
+    auto cmp_func = [value](const Payload* payload) -> bool {
+      return ScalarHelper<Scalar, 0>::CompareScalars(payload->value, value);
+    };
+    auto p = hash_table_.Lookup(h, cmp_func);
+    if (p.second) {
+      return p.first->payload.memo_index;
+    } else {
+      return kKeyNotFound;
+    }
+  }
+
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsert(const Scalar& value, hash_t h, Func1&& on_found,
+                      Func2&& on_not_found) {
+    auto cmp_func = [value](const Payload* payload) -> bool {
+      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
+    };
+    auto p = hash_table_.Lookup(h, cmp_func);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      hash_table_.Insert(p.first, h, {value, memo_index});
+      on_not_found(memo_index);
+    }
+    return memo_index;
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -527,6 +742,33 @@ class SmallScalarMemoTable : public MemoTable {
     return GetOrInsert(value, [](int32_t i) {}, [](int32_t i) {});
   }
 
+  // Look up or insert `length` values, calling on_found or on_not_found for
+  // each of them in order
+  template <typename Func1, typename Func2>
+  void GetOrInsertBatch(const Scalar* values, int64_t length, Func1&& on_found,
+                        Func2&& on_not_found) {
+    for (int64_t i = 0; i < length; ++i) {
+      GetOrInsert(values[i], on_found, on_not_found);
+    }
+  }
+
+  // Look up or insert `length` values, writing their memo indices to `out`
+  void GetOrInsertBatch(const Scalar* values, int64_t length, int32_t* out) {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = GetOrInsert(values[i]);
+    }
+  }
+
+  // Look up `length` values, writing their memo indices, or kKeyNotFound, to
+  // `out`.  The table is small enough that a filter would be of no use, so
+  // it is ignored.
+  void GetBatch(const Scalar* values, int64_t length, const BlockedBloomFilter* filter,
+                int32_t* out) const {
+    for (int64_t i = 0; i < length; ++i) {
+      out[i] = Get(values[i]);
+    }
+  }
+
   int32_t GetNull() const { return value_to_index_[cardinality]; }
 
   template <typename Func1, typename Func2>
@@ -589,13 +831,7 @@ class BinaryMemoTable : public MemoTable {
   }
 
   int32_t Get(const void* data, int32_t length) const {
-    hash_t h = ComputeStringHash<0>(data, length);
-    auto p = Lookup(h, data, length);
-    if (p.second) {
-      return p.first->payload.memo_index;
-    } else {
-      return kKeyNotFound;
-    }
+    return Get(data, length, ComputeStringHash<0>(data, length));
   }
 
   int32_t Get(const std::string& value) const {
@@ -609,7 +845,13 @@ class BinaryMemoTable : public MemoTable {
   template <typename Func1, typename Func2>
   int32_t GetOrInsert(const void* data, int32_t length, Func1&& on_found,
                       Func2&& on_not_found) {
-    hash_t h = ComputeStringHash<0>(data, length);
+    return GetOrInsert(data, length, ComputeStringHash<0>(data, length),
+                       std::forward<Func1>(on_found), std::forward<Func2>(on_not_found));
+  }
+
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsert(const void* data, int32_t length, hash_t h, Func1&& on_found,
+                      Func2&& on_not_found) {
     auto p = Lookup(h, data, length);
     int32_t memo_index;
     if (p.second) {
@@ -646,6 +888,87 @@ class BinaryMemoTable : public MemoTable {
     return GetOrInsert(value.data(), static_cast<int32_t>(value.length()));
   }
 
+  // Look up or insert the `length` values delimited by `offsets` in `data`,
+  // calling on_found or on_not_found for each of them in order.  As in
+  // ScalarMemoTable::GetOrInsertBatch(), the hashes of a block of values are
+  // computed and their slots prefetched before probing.
+  template <typename Offset, typename Func1, typename Func2>
+  void GetOrInsertBatch(const uint8_t* data, const Offset* offsets, int64_t length,
+                        Func1&& on_found, Func2&& on_not_found) {
+    hash_t hashes[kHashBatchSize];
+    for (int64_t offset = 0; offset < length; offset += kHashBatchSize) {
+      const Offset* block = offsets + offset;
+      const int64_t block_length = std::min(kHashBatchSize, length - offset);
+      for (int64_t i = 0; i < block_length; ++i) {
+        hashes[i] = ComputeStringHash<0>(data + block[i], block[i + 1] - block[i]);
+      }
+      for (int64_t i = 0; i < block_length; ++i) {
+        hash_table_.Prefetch(hashes[i]);
+      }
+      for (int64_t i = 0; i < block_length; ++i) {
+        GetOrInsert(data + block[i], static_cast<int32_t>(block[i + 1] - block[i]),
+                    hashes[i], on_found, on_not_found);
+      }
+    }
+  }
+
+  // Look up or insert the `length` values delimited by `offsets` in `data`,
+  // writing their memo indices to `out`
+  template <typename Offset>
+  void GetOrInsertBatch(const uint8_t* data, const Offset* offsets, int64_t length,
+                        int32_t* out) {
+    auto on_index = [&out](int32_t i) { *out++ = i; };
+    GetOrInsertBatch(data, offsets, length, on_index, on_index);
+  }
+
+  // Look up `length` values, writing their memo indices, or kKeyNotFound, to
+  // `out`, filtering and prefetching as ScalarMemoTable::GetBatch()
+  void GetBatch(const util::string_view* values, int64_t length,
+                const BlockedBloomFilter* filter, int32_t* out) const {
+    hash_t hashes[kHashBatchSize];
+    int64_t candidates[kHashBatchSize];
+    for (int64_t offset = 0; offset < length; offset += kHashBatchSize) {
+      const util::string_view* block = values + offset;
+      int32_t* block_out = out + offset;
+      const int64_t block_length = std::min(kHashBatchSize, length - offset);
+      for (int64_t i = 0; i < block_length; ++i) {
+        hashes[i] = ComputeStringHash<0>(block[i].data(),
+                                         static_cast<int64_t>(block[i].size()));
+      }
+      int64_t num_candidates = 0;
+      if (filter != NULLPTR) {
+        for (int64_t i = 0; i < block_length; ++i) {
+          filter->Prefetch(HashTableType::FixHash(hashes[i]));
+        }
+        for (int64_t i = 0; i < block_length; ++i) {
+          block_out[i] = kKeyNotFound;
+          candidates[num_candidates] = i;
+          num_candidates += filter->MayContain(HashTableType::FixHash(hashes[i]));
+        }
+      } else {
+        for (int64_t i = 0; i < block_length; ++i) {
+          candidates[num_candidates++] = i;
+        }
+      }
+      for (int64_t j = 0; j < num_candidates; ++j) {
+        hash_table_.Prefetch(hashes[candidates[j]]);
+      }
+      for (int64_t j = 0; j < num_candidates; ++j) {
+        const int64_t i = candidates[j];
+        block_out[i] = Get(block[i].data(), static_cast<int32_t>(block[i].size()),
+                           hashes[i]);
+      }
+    }
+  }
+
+  // Visit the hashes of the stored values, as given to a BlockedBloomFilter
+  // by GetBatch().  The visitor function should have the signature
+  // `void(hash_t)`.
+  template <typename VisitFunc>
+  void VisitHashes(VisitFunc&& visit) const {
+    hash_table_.VisitEntries([&](const HashTableEntry* entry) { visit(entry->h); });
+  }
+
   int32_t GetNull() const { return null_index_; }
 
   template <typename Func1, typename Func2>
@@ -793,6 +1116,15 @@ class BinaryMemoTable : public MemoTable {
 
   int32_t null_index_ = kKeyNotFound;
 
+  int32_t Get(const void* data, int32_t length, hash_t h) const {
+    auto p = Lookup(h, data, length);
+    if (p.second) {
+      return p.first->payload.memo_index;
+    } else {
+      return kKeyNotFound;
+    }
+  }
+
   std::pair<const HashTableEntry*, bool> Lookup(hash_t h, const void* data,
                                                 int32_t length) const {
     auto cmp_func = [=](const Payload* payload) {
@@ -111,6 +111,83 @@ static void HashLargeStrings(benchmark::State& state) {  // NOLINT non-const ref
   BenchmarkStringHashing(state, values);
 }
 
+// ----------------------------------------------------------------------
+// Memo table benchmarks, inserting state.range(0) distinct keys twice into a
+// table sized for them up front
+
+static void MemoTableIntegers(benchmark::State& state,  // NOLINT non-const reference
+                              bool batch) {
+  const auto n_values = static_cast<int32_t>(state.range(0));
+  std::vector<int64_t> values = MakeIntegers<int64_t>(n_values);
+  values.insert(values.end(), values.begin(), values.end());
+
+  std::vector<int32_t> indices(values.size());
+
+  while (state.KeepRunning()) {
+    ScalarMemoTable<int64_t> table(default_memory_pool(), n_values);
+    if (batch) {
+      table.GetOrInsertBatch(values.data(), static_cast<int64_t>(values.size()),
+                             indices.data());
+    } else {
+      for (size_t i = 0; i < values.size(); ++i) {
+        indices[i] = table.GetOrInsert(values[i]);
+      }
+    }
+    benchmark::DoNotOptimize(indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+static void MemoTableIntegers(benchmark::State& state) {  // NOLINT non-const reference
+  MemoTableIntegers(state, false);
+}
+
+static void MemoTableIntegersBatch(  // NOLINT non-const reference
+    benchmark::State& state) {
+  MemoTableIntegers(state, true);
+}
+
+static void MemoTableStrings(benchmark::State& state,  // NOLINT non-const reference
+                             bool batch) {
+  const auto n_values = static_cast<int32_t>(state.range(0));
+  const std::vector<std::string> strings = MakeStrings(n_values, 2, 20);
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (int32_t repeat = 0; repeat < 2; ++repeat) {
+    for (const std::string& v : strings) {
+      data += v;
+      offsets.push_back(static_cast<int32_t>(data.size()));
+    }
+  }
+  const int64_t length = static_cast<int64_t>(offsets.size()) - 1;
+  const auto bytes = reinterpret_cast<const uint8_t*>(data.data());
+
+  std::vector<int32_t> indices(length);
+
+  while (state.KeepRunning()) {
+    BinaryMemoTable table(default_memory_pool(), n_values);
+    if (batch) {
+      table.GetOrInsertBatch(bytes, offsets.data(), length, indices.data());
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        indices[i] = table.GetOrInsert(bytes + offsets[i], offsets[i + 1] - offsets[i]);
+      }
+    }
+    benchmark::DoNotOptimize(indices.data());
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+static void MemoTableStrings(benchmark::State& state) {  // NOLINT non-const reference
+  MemoTableStrings(state, false);
+}
+
+static void MemoTableStringsBatch(  // NOLINT non-const reference
+    benchmark::State& state) {
+  MemoTableStrings(state, true);
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -119,5 +196,23 @@ BENCHMARK(HashSmallStrings);
 BENCHMARK(HashMediumStrings);
 BENCHMARK(HashLargeStrings);
 
+// Large tables, whose slots are mostly cache misses
+BENCHMARK(MemoTableIntegers)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 25)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MemoTableIntegersBatch)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 25)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MemoTableStrings)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(MemoTableStringsBatch)
+    ->RangeMultiplier(4)
+    ->Range(1 << 20, 1 << 24)
+    ->Unit(benchmark::kMillisecond);
+
 }  // namespace internal
 }  // namespace arrow
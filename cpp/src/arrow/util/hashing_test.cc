@@ -15,10 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <random>
 #include <string>
 #include <unordered_map>
@@ -32,6 +34,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
 
 namespace arrow {
 namespace internal {
@@ -128,7 +131,8 @@ TEST(HashingQuality, Strings) {
 }
 
 TEST(HashingBounds, Strings) {
-  std::vector<size_t> sizes({1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 18, 19, 20, 21});
+  std::vector<size_t> sizes(
+      {1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 18, 19, 20, 21, 24, 31, 32, 33});
   for (const auto s : sizes) {
     std::string str;
     for (size_t i = 0; i < s; i++) {
@@ -353,6 +357,89 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(ScalarMemoTable, BatchInt64) {
+  // Enough values for several batches and upsizings of the hash table
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-500, 500);
+  std::vector<int64_t> values(3000);
+  std::generate(values.begin(), values.end(), [&]() { return value_dist(gen); });
+
+  ScalarMemoTable<int64_t> expected_table(default_memory_pool(), 0);
+  ScalarMemoTable<int64_t> table(default_memory_pool(), 0);
+  std::vector<int32_t> indices(values.size());
+  table.GetOrInsertBatch(values.data(), static_cast<int64_t>(values.size()),
+                         indices.data());
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(indices[i], expected_table.GetOrInsert(values[i]));
+  }
+  ASSERT_EQ(table.size(), expected_table.size());
+
+  // Values are all found on a second pass
+  int32_t num_not_found = 0;
+  table.GetOrInsertBatch(values.data(), static_cast<int64_t>(values.size()),
+                         [](int32_t) {}, [&](int32_t) { ++num_not_found; });
+  ASSERT_EQ(num_not_found, 0);
+}
+
+TEST(ScalarMemoTable, GetBatchInt64) {
+  ScalarMemoTable<int64_t> table(default_memory_pool(), 0);
+  for (int64_t i = 0; i < 1000; ++i) {
+    table.GetOrInsert(i * 3);
+  }
+  BlockedBloomFilter filter(default_memory_pool());
+  ASSERT_OK(filter.Init(table.size()));
+  table.VisitHashes([&](hash_t h) { filter.Insert(h); });
+
+  std::vector<int64_t> values(3000);
+  std::iota(values.begin(), values.end(), -10);
+  const std::vector<const BlockedBloomFilter*> filters = {&filter, nullptr};
+  for (const BlockedBloomFilter* batch_filter : filters) {
+    std::vector<int32_t> indices(values.size());
+    table.GetBatch(values.data(), static_cast<int64_t>(values.size()), batch_filter,
+                   indices.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(indices[i], table.Get(values[i]));
+    }
+  }
+}
+
+TEST(SmallScalarMemoTable, GetBatchInt8) {
+  SmallScalarMemoTable<int8_t> table(default_memory_pool(), 0);
+  table.GetOrInsert(5);
+  table.GetOrInsert(-3);
+  const std::vector<int8_t> values = {-3, 0, 5, 5, 127};
+  std::vector<int32_t> indices(values.size());
+  table.GetBatch(values.data(), static_cast<int64_t>(values.size()), nullptr,
+                 indices.data());
+  ASSERT_EQ(indices, std::vector<int32_t>({1, -1, 0, 0, -1}));
+}
+
+TEST(BlockedBloomFilter, Basics) {
+  const int64_t kNumHashes = 10000;
+  BlockedBloomFilter filter(default_memory_pool());
+  ASSERT_OK(filter.Init(kNumHashes));
+  ASSERT_GE(filter.size_bytes(), kNumHashes * 2);
+
+  // No false negatives, and few false positives
+  for (int64_t i = 0; i < kNumHashes; ++i) {
+    filter.Insert(ScalarHelper<int64_t, 0>::ComputeHash(i));
+  }
+  for (int64_t i = 0; i < kNumHashes; ++i) {
+    ASSERT_TRUE(filter.MayContain(ScalarHelper<int64_t, 0>::ComputeHash(i)));
+  }
+  int64_t false_positives = 0;
+  for (int64_t i = kNumHashes; i < 11 * kNumHashes; ++i) {
+    false_positives += filter.MayContain(ScalarHelper<int64_t, 0>::ComputeHash(i));
+  }
+  ASSERT_LT(false_positives, kNumHashes / 10);
+
+  // A single block still filters
+  BlockedBloomFilter small_filter(default_memory_pool());
+  ASSERT_OK(small_filter.Init(0));
+  small_filter.Insert(42);
+  ASSERT_TRUE(small_filter.MayContain(42));
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -452,5 +539,53 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, Batch) {
+  const auto distinct_values = MakeDistinctStrings(100);
+  std::string data;
+  std::vector<int32_t> offsets = {0};
+  for (int32_t i = 0; i < 3; ++i) {
+    for (const auto& value : distinct_values) {
+      data += value;
+      offsets.push_back(static_cast<int32_t>(data.size()));
+    }
+  }
+  const int64_t length = static_cast<int64_t>(offsets.size()) - 1;
+
+  BinaryMemoTable expected_table(default_memory_pool(), 0);
+  BinaryMemoTable table(default_memory_pool(), 0);
+  std::vector<int32_t> indices(length);
+  table.GetOrInsertBatch(reinterpret_cast<const uint8_t*>(data.data()), offsets.data(),
+                         length, indices.data());
+  for (int64_t i = 0; i < length; ++i) {
+    ASSERT_EQ(indices[i], expected_table.GetOrInsert(data.data() + offsets[i],
+                                                     offsets[i + 1] - offsets[i]));
+  }
+  ASSERT_EQ(table.size(), static_cast<int32_t>(distinct_values.size()));
+}
+
+TEST(BinaryMemoTable, GetBatch) {
+  const auto distinct_set = MakeDistinctStrings(100);
+  const std::vector<std::string> distinct_values(distinct_set.begin(),
+                                                 distinct_set.end());
+  BinaryMemoTable table(default_memory_pool(), 0);
+  for (size_t i = 0; i < distinct_values.size(); i += 2) {
+    table.GetOrInsert(distinct_values[i]);
+  }
+  BlockedBloomFilter filter(default_memory_pool());
+  ASSERT_OK(filter.Init(table.size()));
+  table.VisitHashes([&](hash_t h) { filter.Insert(h); });
+
+  std::vector<util::string_view> values(distinct_values.begin(), distinct_values.end());
+  const std::vector<const BlockedBloomFilter*> filters = {&filter, nullptr};
+  for (const BlockedBloomFilter* batch_filter : filters) {
+    std::vector<int32_t> indices(values.size());
+    table.GetBatch(values.data(), static_cast<int64_t>(values.size()), batch_filter,
+                   indices.data());
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(indices[i], i % 2 == 0 ? static_cast<int32_t>(i / 2) : kKeyNotFound);
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace arrow
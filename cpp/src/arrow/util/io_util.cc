@@ -910,11 +910,22 @@ TemporaryDir::~TemporaryDir() {
 }
 
 Status TemporaryDir::Make(const std::string& prefix, std::unique_ptr<TemporaryDir>* out) {
+  bfs::path parent;
+
+  BOOST_FILESYSTEM_TRY
+  parent = bfs::temp_directory_path();
+  BOOST_FILESYSTEM_CATCH
+
+  return Make(PlatformFilename(parent.native()), prefix, out);
+}
+
+Status TemporaryDir::Make(const PlatformFilename& parent, const std::string& prefix,
+                          std::unique_ptr<TemporaryDir>* out) {
   bfs::path path;
   std::string suffix = MakeRandomName(8);
 
   BOOST_FILESYSTEM_TRY
-  path = bfs::temp_directory_path() / (prefix + suffix);
+  path = bfs::path(parent.ToNative()) / (prefix + suffix);
   path += "/";
   BOOST_FILESYSTEM_CATCH
 
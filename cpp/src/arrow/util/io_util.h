@@ -223,6 +223,11 @@ class ARROW_EXPORT TemporaryDir {
 
   static Status Make(const std::string& prefix, std::unique_ptr<TemporaryDir>* out);
 
+  /// Create the temporary directory in parent rather than in the system
+  /// temporary directory
+  static Status Make(const PlatformFilename& parent, const std::string& prefix,
+                     std::unique_ptr<TemporaryDir>* out);
+
  private:
   PlatformFilename path_;
 
@@ -186,6 +186,20 @@ TEST(TemporaryDir, Basics) {
   AssertNotExists(child);
 }
 
+TEST(TemporaryDir, InParent) {
+  std::unique_ptr<TemporaryDir> parent, temp_dir;
+  ASSERT_OK(TemporaryDir::Make("some-parent-", &parent));
+  ASSERT_OK(TemporaryDir::Make(parent->path(), "some-prefix-", &temp_dir));
+  PlatformFilename fn = temp_dir->path();
+  AssertExists(fn);
+  ASSERT_EQ(fn.ToString().find(parent->path().ToString()), 0);
+  ASSERT_NE(fn.ToString().find("some-prefix-"), std::string::npos);
+
+  temp_dir.reset();
+  AssertNotExists(fn);
+  AssertExists(parent->path());
+}
+
 TEST(CreateDirTree, Basics) {
   std::unique_ptr<TemporaryDir> temp_dir;
   PlatformFilename fn;
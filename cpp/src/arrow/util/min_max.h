@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// Vectorized min/max loops over numeric values, shared by the MinMax kernel
+// and the Parquet column statistics
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/sse_util.h"
+
+namespace arrow {
+namespace internal {
+
+/// The identities of min and max, such that NaN values never replace them
+template <typename CType, typename Enable = void>
+struct MinMaxIdentity {
+  static constexpr CType min() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType max() { return std::numeric_limits<CType>::lowest(); }
+};
+
+template <typename CType>
+struct MinMaxIdentity<
+    CType, typename std::enable_if<std::is_floating_point<CType>::value>::type> {
+  static constexpr CType min() { return std::numeric_limits<CType>::infinity(); }
+  static constexpr CType max() { return -std::numeric_limits<CType>::infinity(); }
+};
+
+// Written as selects which compilers turn into vector min/max instructions.
+// A NaN value compares false and thus keeps the current extremum.
+template <typename CType>
+inline CType MinOf(CType value, CType current) {
+  return value < current ? value : current;
+}
+
+template <typename CType>
+inline CType MaxOf(CType value, CType current) {
+  return value > current ? value : current;
+}
+
+/// \brief Update min and max with values, through independent lanes of
+/// extrema which the compiler can vectorize
+///
+/// NaN values are ignored: if all values are NaN, min and max are unchanged.
+template <typename CType>
+void DenseMinMax(const CType* values, int64_t length, CType* min, CType* max) {
+  constexpr int kLanes = 8;
+  CType mins[kLanes];
+  CType maxs[kLanes];
+  for (int j = 0; j < kLanes; ++j) {
+    mins[j] = *min;
+    maxs[j] = *max;
+  }
+
+  const int64_t body_length = length - length % kLanes;
+  for (int64_t i = 0; i < body_length; i += kLanes) {
+    for (int j = 0; j < kLanes; ++j) {
+      mins[j] = MinOf(values[i + j], mins[j]);
+      maxs[j] = MaxOf(values[i + j], maxs[j]);
+    }
+  }
+  for (int64_t i = body_length; i < length; ++i) {
+    mins[0] = MinOf(values[i], mins[0]);
+    maxs[0] = MaxOf(values[i], maxs[0]);
+  }
+
+  for (int j = 0; j < kLanes; ++j) {
+    *min = MinOf(mins[j], *min);
+    *max = MaxOf(maxs[j], *max);
+  }
+}
+
+#ifdef ARROW_HAVE_SSE2
+
+// Compilers don't vectorize the floating point selects above, as they can't
+// reorder them without -ffast-math.  minpd and maxpd return their second
+// operand if either is NaN, so NaN values keep the current extrema.
+
+inline void DenseMinMax(const double* values, int64_t length, double* min,
+                        double* max) {
+  __m128d mins[2] = {_mm_set1_pd(*min), _mm_set1_pd(*min)};
+  __m128d maxs[2] = {_mm_set1_pd(*max), _mm_set1_pd(*max)};
+  const int64_t body_length = length - length % 4;
+  for (int64_t i = 0; i < body_length; i += 4) {
+    const __m128d left = _mm_loadu_pd(values + i);
+    const __m128d right = _mm_loadu_pd(values + i + 2);
+    mins[0] = _mm_min_pd(left, mins[0]);
+    mins[1] = _mm_min_pd(right, mins[1]);
+    maxs[0] = _mm_max_pd(left, maxs[0]);
+    maxs[1] = _mm_max_pd(right, maxs[1]);
+  }
+
+  double lanes[4];
+  _mm_storeu_pd(lanes, _mm_min_pd(mins[0], mins[1]));
+  *min = MinOf(lanes[0], MinOf(lanes[1], *min));
+  _mm_storeu_pd(lanes + 2, _mm_max_pd(maxs[0], maxs[1]));
+  *max = MaxOf(lanes[2], MaxOf(lanes[3], *max));
+  for (int64_t i = body_length; i < length; ++i) {
+    *min = MinOf(values[i], *min);
+    *max = MaxOf(values[i], *max);
+  }
+}
+
+inline void DenseMinMax(const float* values, int64_t length, float* min, float* max) {
+  __m128 mins[2] = {_mm_set1_ps(*min), _mm_set1_ps(*min)};
+  __m128 maxs[2] = {_mm_set1_ps(*max), _mm_set1_ps(*max)};
+  const int64_t body_length = length - length % 8;
+  for (int64_t i = 0; i < body_length; i += 8) {
+    const __m128 left = _mm_loadu_ps(values + i);
+    const __m128 right = _mm_loadu_ps(values + i + 4);
+    mins[0] = _mm_min_ps(left, mins[0]);
+    mins[1] = _mm_min_ps(right, mins[1]);
+    maxs[0] = _mm_max_ps(left, maxs[0]);
+    maxs[1] = _mm_max_ps(right, maxs[1]);
+  }
+
+  float lanes[8];
+  _mm_storeu_ps(lanes, _mm_min_ps(mins[0], mins[1]));
+  _mm_storeu_ps(lanes + 4, _mm_max_ps(maxs[0], maxs[1]));
+  for (int j = 0; j < 4; ++j) {
+    *min = MinOf(lanes[j], *min);
+    *max = MaxOf(lanes[4 + j], *max);
+  }
+  for (int64_t i = body_length; i < length; ++i) {
+    *min = MinOf(values[i], *min);
+    *max = MaxOf(values[i], *max);
+  }
+}
+
+#endif  // ARROW_HAVE_SSE2
+
+/// \brief Update min and max with the values whose bit is set in a bitmap
+///
+/// The bitmap is read a 64-bit word at a time.  Words of 64 null values are
+/// skipped and words of 64 valid values go through DenseMinMax.  Words of a
+/// few valid values or more also do, on a copy of their values whose null
+/// slots are overwritten with one of their valid values, and the others one
+/// valid value at a time, their set bits being found with CountTrailingZeros.
+/// NaN values are ignored.
+template <typename CType>
+void SpacedMinMax(const CType* values, int64_t length, const uint8_t* bitmap,
+                  int64_t bitmap_offset, CType* min, CType* max) {
+  // The number of valid values from which a word goes through DenseMinMax
+  constexpr int kMinDenseCount = 8;
+  auto visit_set_bits = [&](uint64_t word, const CType* word_values) {
+    for (; word != 0; word &= word - 1) {
+      const CType value = word_values[BitUtil::CountTrailingZeros(word)];
+      *min = MinOf(value, *min);
+      *max = MaxOf(value, *max);
+    }
+  };
+
+  const int64_t body_length = length - length % 64;
+  for (int64_t word_start = 0; word_start < body_length; word_start += 64) {
+    const uint64_t word = ReadBitmapWord(bitmap, bitmap_offset + word_start, 64);
+    const CType* word_values = values + word_start;
+    if (word == ~static_cast<uint64_t>(0)) {
+      DenseMinMax(word_values, 64, min, max);
+    } else if (BitUtil::PopCount(word) >= kMinDenseCount) {
+      CType masked[64];
+      std::copy(word_values, word_values + 64, masked);
+      const CType valid_value = word_values[BitUtil::CountTrailingZeros(word)];
+      for (uint64_t nulls = ~word; nulls != 0; nulls &= nulls - 1) {
+        masked[BitUtil::CountTrailingZeros(nulls)] = valid_value;
+      }
+      DenseMinMax(masked, 64, min, max);
+    } else {
+      visit_set_bits(word, word_values);
+    }
+  }
+  // The last, partial word: the values past its end may not be readable
+  if (body_length < length) {
+    visit_set_bits(
+        ReadBitmapWord(bitmap, bitmap_offset + body_length, length - body_length),
+        values + body_length);
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -57,6 +57,32 @@ static std::vector<std::string> MakeFloatStrings(int32_t num_items) {
   return strings;
 }
 
+// Decimals without exponent, exactly representable before rounding
+static std::vector<std::string> MakeDecimalFloatStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {"0.0",      "5",          "-12.3",
+                                           "3456.789", "0.0012345",  "-98765.4321",
+                                           "1.5",      "12345678.9"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
+// Shortest round-trip representations with exponents, as written by most
+// serializers
+static std::vector<std::string> MakeExponentFloatStrings(int32_t num_items) {
+  std::vector<std::string> base_strings = {
+      "1.2345678901234567e-7",   "-9.87654321e+123",      "3.141592653589793e0",
+      "6.02214076e23",           "1.602176634e-19",       "-2.718281828459045e5",
+      "4.9406564584124654e-300", "1.7976931348623157e308"};
+  std::vector<std::string> strings;
+  for (int32_t i = 0; i < num_items; ++i) {
+    strings.push_back(base_strings[i % base_strings.size()]);
+  }
+  return strings;
+}
+
 static std::vector<std::string> MakeTimestampStrings(int32_t num_items) {
   std::vector<std::string> base_strings = {"2018-11-13 17:11:10", "2018-11-13 11:22:33",
                                            "2016-02-29 11:22:33"};
@@ -89,8 +115,8 @@ static void IntegerParsing(benchmark::State& state) {  // NOLINT non-const refer
 }
 
 template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
-static void FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
-  auto strings = MakeFloatStrings(1000);
+static void BenchmarkFloatParsing(benchmark::State& state,  // NOLINT non-const reference
+                                  const std::vector<std::string>& strings) {
   StringConverter<ARROW_TYPE> converter;
 
   while (state.KeepRunning()) {
@@ -108,6 +134,21 @@ static void FloatParsing(benchmark::State& state) {  // NOLINT non-const referen
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+template <typename ARROW_TYPE>
+static void FloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFloatParsing<ARROW_TYPE>(state, MakeFloatStrings(1000));
+}
+
+template <typename ARROW_TYPE>
+static void DecimalFloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFloatParsing<ARROW_TYPE>(state, MakeDecimalFloatStrings(1000));
+}
+
+template <typename ARROW_TYPE>
+static void ExponentFloatParsing(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkFloatParsing<ARROW_TYPE>(state, MakeExponentFloatStrings(1000));
+}
+
 template <TimeUnit::type UNIT>
 static void TimestampParsing(benchmark::State& state) {  // NOLINT non-const reference
   using c_type = TimestampType::c_type;
@@ -142,6 +183,9 @@ BENCHMARK_TEMPLATE(IntegerParsing, UInt64Type);
 
 BENCHMARK_TEMPLATE(FloatParsing, FloatType);
 BENCHMARK_TEMPLATE(FloatParsing, DoubleType);
+BENCHMARK_TEMPLATE(DecimalFloatParsing, FloatType);
+BENCHMARK_TEMPLATE(DecimalFloatParsing, DoubleType);
+BENCHMARK_TEMPLATE(ExponentFloatParsing, DoubleType);
 
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::SECOND);
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::MILLI);
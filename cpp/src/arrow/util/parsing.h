@@ -22,6 +22,7 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -31,8 +32,10 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
 
 namespace arrow {
@@ -87,10 +90,120 @@ class StringConverter<BooleanType> {
   }
 };
 
+namespace detail {
+
+inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
+
+// Parse eight decimal digits at once, with arithmetic on a 64-bit word
+// holding all of them.  Return false if any of them is not a digit.
+inline bool ParseEightDigits(const char* s, uint64_t* out) {
+  uint64_t v;
+  std::memcpy(&v, s, sizeof(v));
+  v = BitUtil::FromLittleEndian(v);
+  // Each byte must be within 0x30 and 0x39 ('0' and '9')
+  if ((v & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL ||
+      ((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) != 0x3030303030303030ULL) {
+    return false;
+  }
+  v -= 0x3030303030303030ULL;
+  // Combine pairs of digits, then pairs of pairs, and so on
+  v = v * 10 + (v >> 8);
+  v = ((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32)) +
+       ((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32))) >>
+      32;
+  *out = v & 0xFFFFFFFFULL;
+  return true;
+}
+
+template <typename T>
+struct SimpleDecimalLimits;
+
+// The mantissas and powers of ten exactly representable in the type
+template <>
+struct SimpleDecimalLimits<double> {
+  static constexpr uint64_t kMaxMantissa = 1ULL << 53;
+  static constexpr int kMaxExponent = 22;
+};
+
+template <>
+struct SimpleDecimalLimits<float> {
+  static constexpr uint64_t kMaxMantissa = 1ULL << 24;
+  static constexpr int kMaxExponent = 10;
+};
+
+// Parse a decimal number without exponent, such as "-123.45", if its digits
+// and its power of ten are exactly representable in T.  The value is then a
+// single correctly rounded division (Clinger's fast path).  Return false for
+// any other input.
+template <typename T>
+inline bool ParseSimpleDecimal(const char* s, size_t length, T* out) {
+  static constexpr double kPowersOfTen[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  // No more digits than fit in a uint64_t
+  static constexpr int kMaxDigits = 19;
+
+  const char* end = s + length;
+  bool negative = false;
+  if (s != end && *s == '-') {
+    negative = true;
+    ++s;
+  }
+  uint64_t mantissa = 0;
+  int num_digits = 0;
+  uint8_t digit;
+  while (s != end && (digit = ParseDecimalDigit(*s)) <= 9 && num_digits < kMaxDigits) {
+    mantissa = mantissa * 10 + digit;
+    ++num_digits;
+    ++s;
+  }
+  if (num_digits == 0) {
+    return false;
+  }
+  int exponent = 0;
+  if (s != end && *s == '.') {
+    ++s;
+    while (s != end && (digit = ParseDecimalDigit(*s)) <= 9 && num_digits < kMaxDigits) {
+      mantissa = mantissa * 10 + digit;
+      ++num_digits;
+      ++exponent;
+      ++s;
+    }
+    if (exponent == 0) {
+      return false;
+    }
+  }
+  if (s != end || mantissa > SimpleDecimalLimits<T>::kMaxMantissa ||
+      exponent > SimpleDecimalLimits<T>::kMaxExponent) {
+    return false;
+  }
+  const T value = static_cast<T>(mantissa) / static_cast<T>(kPowersOfTen[exponent]);
+  *out = negative ? -value : value;
+  return true;
+}
+
+// Parse a decimal number such as "-123.45" or "6.02e23" with at most 19 significant
+// digits into the nearest double, with the Eisel-Lemire algorithm.  Return false
+// for any other input, and for values which the algorithm can't round cheaply
+// (e.g. subnormal values), which should then be parsed by an exact parser.
+ARROW_EXPORT
+bool ParseDecimalDouble(const char* s, size_t length, double* out);
+
+inline bool ParseFastFloat(const char* s, size_t length, float* out) {
+  return ParseSimpleDecimal(s, length, out);
+}
+
+inline bool ParseFastFloat(const char* s, size_t length, double* out) {
+  return ParseSimpleDecimal(s, length, out) || ParseDecimalDouble(s, length, out);
+}
+
+}  // namespace detail
+
 // Ideas for faster float parsing:
 // - http://rapidjson.org/md_doc_internals.html#ParsingDouble
 // - https://github.com/google/double-conversion [used here]
 // - https://github.com/achan001/dtoa-fast
+// - https://github.com/fastfloat/fast_float [Eisel-Lemire, used here for doubles]
 
 template <class ARROW_TYPE>
 class StringToFloatConverterMixin {
@@ -103,6 +216,9 @@ class StringToFloatConverterMixin {
                             "nan") {}
 
   bool operator()(const char* s, size_t length, value_type* out) {
+    if (ARROW_PREDICT_TRUE(detail::ParseFastFloat(s, length, out))) {
+      return true;
+    }
     value_type v;
     // double-conversion doesn't give us an error flag but signals parse
     // errors with sentinel values.  Since a sentinel value can appear as
@@ -161,8 +277,6 @@ class StringConverter<DoubleType> : public StringToFloatConverterMixin<DoubleTyp
 
 namespace detail {
 
-inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
-
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -243,6 +357,26 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   uint64_t result = 0;
 
+  // Up to 19 digits cannot overflow: parse them eight at a time
+  if (length >= 8 && length < 20) {
+    for (; length >= 8; s += 8, length -= 8) {
+      uint64_t chunk;
+      if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &chunk))) {
+        return false;
+      }
+      result = result * 100000000ULL + chunk;
+    }
+    for (; length > 0; --length) {
+      uint8_t digit = ParseDecimalDigit(*s++);
+      if (ARROW_PREDICT_FALSE(digit > 9U)) {
+        return false;
+      }
+      result = result * 10U + digit;
+    }
+    *out = result;
+    return true;
+  }
+
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
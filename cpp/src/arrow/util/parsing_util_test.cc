@@ -15,7 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <locale>
+#include <random>
 #include <stdexcept>
 #include <string>
 
@@ -98,12 +103,59 @@ TEST(StringConversion, ToDouble) {
   AssertConversionFails(converter, "e");
 }
 
+TEST(StringConversion, ToDoubleCorrectlyRounded) {
+  // Exponents and long mantissas take the Eisel-Lemire path, which must agree
+  // with strtod bit for bit
+  StringConverter<DoubleType> converter;
+  for (const std::string s :
+       {"1e23", "8.988465674311580536566680e307", "1.7976931348623157e308",
+        "2.2250738585072014e-308", "2.2250738585072011e-308", "4.9e-324",
+        "7.3177701707893310e+15", "9007199254740993", "9007199254740992.5",
+        "123456789012345678e-8", "1e-22", "1e22", "-2.5E-3", "3e-5", "0e400",
+        "1e-400", "1e310", "12345678901234567890123e-10"}) {
+    AssertConversion(converter, s, std::strtod(s.c_str(), NULLPTR));
+  }
+
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint64_t> bits_dist;
+  std::uniform_int_distribution<int> precision_dist(1, 17);
+  char buf[64];
+  for (int i = 0; i < 10000; ++i) {
+    uint64_t bits = bits_dist(gen);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    if (!std::isfinite(value)) {
+      continue;
+    }
+    snprintf(buf, sizeof(buf), "%.*e", precision_dist(gen), value);
+    AssertConversion(converter, buf, std::strtod(buf, NULLPTR));
+  }
+}
+
 #ifndef _WIN32
 // Test that casting is locale-independent
 // ARROW-6108: can't run these tests on Windows.  std::locale() will simply throw
 // on release builds, but may crash with an assertion failure on debug builds.
 // (similar issue here: https://gerrit.libreoffice.org/#/c/54110/)
 
+TEST(StringConversion, ToFloatDecimals) {
+  // Decimals without exponent take a faster path when exactly representable
+  StringConverter<FloatType> float_converter;
+  StringConverter<DoubleType> double_converter;
+  for (const std::string s :
+       {"0.1", "-3170.55766", "123.456", "16777216", "16777217", "0.0000000001",
+        "0.00000000001", "9007199254740993", "1234567890.1234567890123", "1.",
+        "00012.50"}) {
+    AssertConversion(float_converter, s, std::strtof(s.c_str(), NULLPTR));
+    AssertConversion(double_converter, s, std::strtod(s.c_str(), NULLPTR));
+  }
+
+  AssertConversionFails(double_converter, "-");
+  AssertConversionFails(double_converter, "1.2.3");
+  AssertConversionFails(double_converter, "12a");
+  AssertConversionFails(double_converter, "-.");
+}
+
 TEST(StringConversion, ToFloatLocale) {
   // French locale uses the comma as decimal point
   LocaleGuard locale_guard("fr_FR.UTF-8");
@@ -261,11 +313,20 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "12345678", 12345678ULL);
+  AssertConversion(converter, "1234567890123456789", 1234567890123456789ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
 
+  // Non-digits within and after blocks of eight digits
+  AssertConversionFails(converter, "1234/678");
+  AssertConversionFails(converter, "1234:678");
+  AssertConversionFails(converter, "12345678 ");
+  AssertConversionFails(converter, "123456789-");
+
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
   AssertConversionFails(converter, "0.0");
@@ -131,6 +131,11 @@ class RleDecoder {
                              int null_count, const uint8_t* valid_bits,
                              int64_t valid_bits_offset);
 
+  /// Like GetBatch but write 1-bit values to a bitmap, starting at bit
+  /// bitmap_offset: runs are written as ranges of bits and literals are copied
+  /// as they are stored. Only valid for a bit width of 1
+  int GetBatchBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset);
+
  protected:
   BitUtil::BitReader bit_reader_;
   /// Number of bits needed to encode the value. Must be between 0 and 64.
@@ -315,6 +320,35 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+inline int RleDecoder::GetBatchBitmap(int batch_size, uint8_t* bitmap,
+                                      int64_t bitmap_offset) {
+  DCHECK_EQ(bit_width_, 1);
+  int values_read = 0;
+
+  while (values_read < batch_size) {
+    if (repeat_count_ > 0) {
+      int repeat_batch =
+          std::min(batch_size - values_read, static_cast<int>(repeat_count_));
+      BitUtil::SetBitsTo(bitmap, bitmap_offset + values_read, repeat_batch,
+                         current_value_ != 0);
+      repeat_count_ -= repeat_batch;
+      values_read += repeat_batch;
+    } else if (literal_count_ > 0) {
+      int literal_batch =
+          std::min(batch_size - values_read, static_cast<int>(literal_count_));
+      int actual_read =
+          bit_reader_.GetBitmap(literal_batch, bitmap, bitmap_offset + values_read);
+      DCHECK_EQ(actual_read, literal_batch);
+      literal_count_ -= literal_batch;
+      values_read += literal_batch;
+    } else {
+      if (!NextCounts<uint8_t>()) return values_read;
+    }
+  }
+
+  return values_read;
+}
+
 template <typename T>
 inline int RleDecoder::GetBatchSpaced(int batch_size, int null_count,
                                       const uint8_t* valid_bits,
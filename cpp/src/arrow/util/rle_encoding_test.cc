@@ -32,6 +32,7 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
 #include "arrow/util/rle_encoding.h"
 
 namespace arrow {
@@ -174,6 +175,64 @@ TEST(BitArray, TestMixed) {
   }
 }
 
+TEST(BitArray, GetBitmap) {
+  const int num_values = 1000;
+  std::vector<uint8_t> buffer(BitUtil::BytesForBits(num_values));
+  std::vector<bool> values;
+  BitUtil::BitWriter writer(buffer.data(), static_cast<int>(buffer.size()));
+  for (int i = 0; i < num_values; ++i) {
+    values.push_back(i % 3 == 0 || i % 7 == 0);
+    ASSERT_TRUE(writer.PutValue(values.back(), 1));
+  }
+  writer.Flush();
+
+  for (int batch_size : {1, 5, 33, 64, 130, num_values + 1}) {
+    BitUtil::BitReader reader(buffer.data(), static_cast<int>(buffer.size()));
+    std::vector<uint8_t> bitmap(BitUtil::BytesForBits(num_values + 5), 0xFF);
+    int values_read = 0;
+    while (values_read < num_values) {
+      const int num_read = reader.GetBitmap(batch_size, bitmap.data(), 5 + values_read);
+      ASSERT_EQ(std::min(batch_size, num_values - values_read), num_read);
+      values_read += num_read;
+    }
+    ASSERT_EQ(0, reader.GetBitmap(batch_size, bitmap.data(), 0));
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(values[i], BitUtil::GetBit(bitmap.data(), 5 + i)) << i;
+    }
+  }
+}
+
+// The SIMD unpacking kernels must agree with the portable ones for every
+// width, including on input that isn't aligned to 32 bits
+TEST(BitArray, Unpack32) {
+  const int num_values = 1024 + 32 * 3;
+  std::vector<uint32_t> packed(num_values + 1);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint32_t> dist;
+  for (uint32_t& word : packed) {
+    word = dist(gen);
+  }
+  std::vector<uint8_t> unaligned(packed.size() * sizeof(uint32_t) + 1);
+  std::memcpy(unaligned.data() + 1, packed.data(), packed.size() * sizeof(uint32_t));
+  const auto unaligned_words = reinterpret_cast<const uint32_t*>(unaligned.data() + 1);
+
+  for (int num_bits = 0; num_bits <= MAX_WIDTH; ++num_bits) {
+    for (int batch_size : {0, 31, 32, 96, 100, num_values}) {
+      std::vector<uint32_t> expected(batch_size), actual(batch_size),
+          unaligned_actual(batch_size);
+      const int num_expected = ::arrow::internal::unpack32_default(
+          packed.data(), expected.data(), batch_size, num_bits);
+      ASSERT_EQ(num_expected, ::arrow::internal::unpack32(packed.data(), actual.data(),
+                                                          batch_size, num_bits));
+      ASSERT_EQ(num_expected,
+                ::arrow::internal::unpack32(unaligned_words, unaligned_actual.data(),
+                                            batch_size, num_bits));
+      ASSERT_EQ(expected, actual) << "num_bits " << num_bits;
+      ASSERT_EQ(expected, unaligned_actual) << "num_bits " << num_bits;
+    }
+  }
+}
+
 // Validates encoding of values by encoding and decoding them.  If
 // expected_encoding != NULL, also validates that the encoded buffer is
 // exactly 'expected_encoding'.
@@ -411,6 +470,60 @@ TEST(BitRle, Random) {
 
 // Test a sequence of 1 0's, 2 1's, 3 0's. etc
 // e.g. 011000111100000
+// Decoding 1-bit values to a bitmap must match decoding them one by one,
+// whatever the run structure and the offsets in the input and the output
+TEST(BitRle, GetBatchBitmap) {
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<int> run_length(1, 40);
+  std::bernoulli_distribution coin;
+
+  std::vector<int> values;
+  bool parity = false;
+  while (values.size() < 10000) {
+    // Alternate between runs, encoded as repeated runs, and noise, encoded as
+    // literals
+    const int length = run_length(gen);
+    for (int i = 0; i < length; ++i) {
+      values.push_back(coin(gen) ? parity : coin(gen));
+    }
+    parity = !parity;
+  }
+
+  const int len = 64 * 1024;
+  std::vector<uint8_t> buffer(len);
+  RleEncoder encoder(buffer.data(), len, 1);
+  for (int value : values) {
+    ASSERT_TRUE(encoder.Put(value));
+  }
+  const int encoded_len = encoder.Flush();
+
+  const int64_t bitmap_offset = 3;
+  for (int batch_size : {1, 7, 64, 100, 1000}) {
+    RleDecoder decoder(buffer.data(), encoded_len, 1);
+    std::vector<uint8_t> bitmap(BitUtil::BytesForBits(values.size() + bitmap_offset), 0);
+    // Bits before the output range are preserved
+    BitUtil::SetBitsTo(bitmap.data(), 0, bitmap_offset, true);
+
+    const int num_values = static_cast<int>(values.size());
+    int values_read = 0;
+    while (values_read < num_values) {
+      const int num_decoded =
+          decoder.GetBatchBitmap(std::min(batch_size, num_values - values_read),
+                                 bitmap.data(), bitmap_offset + values_read);
+      ASSERT_GT(num_decoded, 0);
+      values_read += num_decoded;
+    }
+
+    for (int64_t i = 0; i < bitmap_offset; ++i) {
+      ASSERT_TRUE(BitUtil::GetBit(bitmap.data(), i));
+    }
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(values[i] != 0, BitUtil::GetBit(bitmap.data(), bitmap_offset + i))
+          << "batch_size " << batch_size << " value " << i;
+    }
+  }
+}
+
 TEST(BitRle, RepeatedPattern) {
   std::vector<int> values;
   const int min_run = 1;
@@ -25,6 +25,7 @@
 
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace internal {
@@ -37,6 +38,7 @@ class SerialTaskGroup : public TaskGroup {
   void AppendReal(std::function<Status()> task) override {
     DCHECK(!finished_);
     if (status_.ok()) {
+      ARROW_TRACE_SPAN(span, "task_group", "Task");
       status_ &= task();
     }
   }
@@ -91,6 +93,7 @@ class ThreadedTaskGroup : public TaskGroup {
       Status st = thread_pool_->Spawn([this, task]() {
         if (ok_.load(std::memory_order_acquire)) {
           // XXX what about exceptions?
+          ARROW_TRACE_SPAN(span, "task_group", "Task");
           Status st = task();
           UpdateStatus(std::move(st));
         }
@@ -110,6 +113,7 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
+      ARROW_TRACE_SPAN(span, "task_group", "Finish");
       cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
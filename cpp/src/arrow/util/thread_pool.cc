@@ -18,7 +18,10 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <deque>
 #include <list>
 #include <mutex>
@@ -26,14 +29,74 @@
 #include <thread>
 #include <vector>
 
+#include "arrow/util/atomic_shared_ptr.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+int64_t NowNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+struct QueuedTask {
+  std::function<void()> func;
+  // When the task was submitted, as returned by NowNanos()
+  int64_t submit_time;
+};
+
+// Statistics of a worker.  Only the worker updates them, they are atomic so
+// that ThreadPool::GetStats() can read them meanwhile.
+struct WorkerStats {
+  // Tasks spawned from the worker without taking the pool lock
+  std::atomic<int64_t> tasks_submitted{0};
+  std::atomic<int64_t> tasks_completed{0};
+  std::atomic<int64_t> queued_time{0};
+  std::atomic<int64_t> running_time{0};
+  std::atomic<int64_t> idle_time{0};
+
+  static void Add(std::atomic<int64_t>* counter, int64_t value) {
+    counter->store(counter->load(std::memory_order_relaxed) + value,
+                   std::memory_order_relaxed);
+  }
+
+  void AddTo(ThreadPoolStats* stats) const {
+    stats->tasks_submitted += tasks_submitted.load(std::memory_order_relaxed);
+    stats->tasks_completed += tasks_completed.load(std::memory_order_relaxed);
+    stats->queued_time += queued_time.load(std::memory_order_relaxed);
+    stats->running_time += running_time.load(std::memory_order_relaxed);
+    stats->idle_time += idle_time.load(std::memory_order_relaxed);
+  }
+};
+
+// The task deque of a worker in a work-stealing ThreadPool
+struct WorkerQueue {
+  std::mutex mutex_;
+  std::deque<QueuedTask> tasks_;
+};
+
+using WorkerQueueVector = std::vector<std::shared_ptr<WorkerQueue>>;
+
+}  // namespace
+
 struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+  State()
+      : desired_capacity_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        work_stealing_(false),
+        queues_(std::make_shared<WorkerQueueVector>()),
+        queues_version_(0),
+        num_queued_tasks_(0),
+        num_sleeping_workers_(0),
+        interrupt_workers_(false),
+        next_queue_(0) {}
 
   // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
   // such as https://github.com/cameron314/concurrentqueue
@@ -45,15 +108,93 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+  std::deque<QueuedTask> pending_tasks_;
+  // Protected by mutex_
+  std::string name_;
 
   // Desired number of threads
   int desired_capacity_;
   // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
+
+  // Work-stealing mode: tasks are queued in per-worker deques instead of
+  // pending_tasks_, and workers only take mutex_ when they run out of work.
+  bool work_stealing_;
+  // One deque per worker slot.  Slots are never removed, and the vector is
+  // replaced rather than modified (under mutex_) so that workers can read it
+  // without locking.  queues_version_ is bumped on every replacement.
+  std::shared_ptr<WorkerQueueVector> queues_;
+  std::atomic<uint64_t> queues_version_;
+  // Whether each slot is currently owned by a worker (protected by mutex_)
+  std::vector<bool> queues_in_use_;
+  // Number of tasks in all deques.  May be transiently off by the number
+  // of spawns in progress.
+  std::atomic<int64_t> num_queued_tasks_;
+  std::atomic<int> num_sleeping_workers_;
+  // Set when workers must check the shutdown and capacity settings
+  std::atomic<bool> interrupt_workers_;
+  // Round-robin counter for tasks spawned from outside the pool
+  std::atomic<uint32_t> next_queue_;
+
+  // Statistics (protected by mutex_).  Each worker updates its own entry of
+  // worker_stats_, which is folded into exited_worker_stats_ when it exits.
+  std::list<WorkerStats> worker_stats_;
+  ThreadPoolStats exited_worker_stats_;
+  // Tasks spawned under the pool lock
+  int64_t tasks_submitted_ = 0;
 };
 
+namespace {
+
+// The pool, deque and statistics of the current thread, if it is a
+// work-stealing worker
+struct CurrentWorker {
+  ThreadPool::State* state;
+  WorkerQueue* queue;
+  WorkerStats* stats;
+};
+
+thread_local CurrentWorker current_worker = {nullptr, nullptr, nullptr};
+
+void RunTask(QueuedTask* task, WorkerStats* stats) {
+  ARROW_TRACE_SPAN(span, "thread_pool", "Task");
+  const int64_t start_time = NowNanos();
+  task->func();
+  // Release what the callable holds before looking for more work
+  task->func = nullptr;
+  const int64_t end_time = NowNanos();
+  WorkerStats::Add(&stats->queued_time, start_time - task->submit_time);
+  WorkerStats::Add(&stats->running_time, end_time - start_time);
+  WorkerStats::Add(&stats->tasks_completed, 1);
+}
+
+// Accounts its lifetime as idle time of a worker
+class IdleScope {
+ public:
+  explicit IdleScope(WorkerStats* stats) : stats_(stats), start_time_(NowNanos()) {}
+
+  ~IdleScope() { WorkerStats::Add(&stats_->idle_time, NowNanos() - start_time_); }
+
+ private:
+  WorkerStats* stats_;
+  int64_t start_time_;
+};
+
+// Register the statistics of a new worker, with the pool lock held
+std::list<WorkerStats>::iterator AddWorkerStats(ThreadPool::State* state) {
+  state->worker_stats_.emplace_back();
+  return --state->worker_stats_.end();
+}
+
+// Fold the statistics of an exiting worker, with the pool lock held
+void RemoveWorkerStats(ThreadPool::State* state, std::list<WorkerStats>::iterator it) {
+  it->AddTo(&state->exited_worker_stats_);
+  state->worker_stats_.erase(it);
+}
+
+}  // namespace
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
@@ -69,6 +210,9 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
   };
 
+  auto stats_it = AddWorkerStats(state.get());
+  WorkerStats* stats = &*stats_it;
+
   while (true) {
     // By the time this thread is started, some tasks may have been pushed
     // or shutdown could even have been requested.  So we only wait on the
@@ -82,10 +226,10 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
         break;
       }
       {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
+        QueuedTask task = std::move(state->pending_tasks_.front());
         state->pending_tasks_.pop_front();
         lock.unlock();
-        task();
+        RunTask(&task, stats);
       }
       lock.lock();
     }
@@ -94,6 +238,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
       break;
     }
     // Wait for next wakeup
+    IdleScope idle(stats);
     state->cv_.wait(lock);
   }
 
@@ -105,6 +250,7 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   //    are exited before the ThreadPool is destroyed.  Otherwise subtle
   //    timing conditions can lead to false positives with Valgrind.
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  RemoveWorkerStats(state.get(), stats_it);
   state->finished_workers_.push_back(std::move(*it));
   state->workers_.erase(it);
   if (state->please_shutdown_) {
@@ -113,6 +259,110 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   }
 }
 
+// Take a task from the worker's own deque (newest first), or steal one from
+// another deque (oldest first).  `queues` and `version` cache the slot vector.
+static bool TakeTask(ThreadPool::State* state, size_t queue_index,
+                     std::shared_ptr<WorkerQueueVector>* queues, uint64_t* version,
+                     QueuedTask* task) {
+  const uint64_t current_version = state->queues_version_.load();
+  if (*version != current_version) {
+    *queues = internal::atomic_load(&state->queues_);
+    *version = current_version;
+  }
+  const size_t num_queues = (*queues)->size();
+  for (size_t i = 0; i < num_queues; ++i) {
+    WorkerQueue* queue = (**queues)[(queue_index + i) % num_queues].get();
+    std::lock_guard<std::mutex> lock(queue->mutex_);
+    if (queue->tasks_.empty()) {
+      continue;
+    }
+    if (i == 0) {
+      *task = std::move(queue->tasks_.back());
+      queue->tasks_.pop_back();
+    } else {
+      *task = std::move(queue->tasks_.front());
+      queue->tasks_.pop_front();
+    }
+    state->num_queued_tasks_.fetch_sub(1);
+    return true;
+  }
+  return false;
+}
+
+static void WorkStealingWorkerLoop(std::shared_ptr<ThreadPool::State> state,
+                                   std::list<std::thread>::iterator it,
+                                   size_t queue_index) {
+  std::unique_lock<std::mutex> lock(state->mutex_);
+
+  // Since we hold the lock, `it` now points to the correct thread object
+  // (LaunchWorkersUnlocked has exited)
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+
+  const auto should_secede = [&]() -> bool {
+    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
+  };
+  // Whether we should exit, requires the lock
+  const auto should_exit = [&]() -> bool {
+    return state->quick_shutdown_ || should_secede() ||
+           (state->please_shutdown_ && state->num_queued_tasks_.load() <= 0);
+  };
+
+  std::shared_ptr<WorkerQueueVector> queues = state->queues_;
+  uint64_t version = state->queues_version_.load();
+  auto stats_it = AddWorkerStats(state.get());
+  WorkerStats* stats = &*stats_it;
+  current_worker = {state.get(), (*queues)[queue_index].get(), stats};
+
+  while (!should_exit()) {
+    lock.unlock();
+    // Execute tasks as long as we find some, without taking the pool lock
+    // unless asked to
+    QueuedTask task;
+    bool interrupted = false;
+    while (TakeTask(state.get(), queue_index, &queues, &version, &task)) {
+      RunTask(&task, stats);
+      if (state->interrupt_workers_.load()) {
+        interrupted = true;
+        break;
+      }
+    }
+    lock.lock();
+    if (interrupted) {
+      if (!state->please_shutdown_ && !should_secede()) {
+        // Capacity changes have been dealt with
+        state->interrupt_workers_ = false;
+      }
+      continue;
+    }
+    // No task found, wait for one.  Spawners check the number of sleeping
+    // workers after queueing a task, so we must register ourselves before
+    // checking for tasks.
+    state->num_sleeping_workers_.fetch_add(1);
+    {
+      IdleScope idle(stats);
+      state->cv_.wait(lock, [&] {
+        return state->num_queued_tasks_.load() > 0 || state->please_shutdown_ ||
+               should_secede();
+      });
+    }
+    state->num_sleeping_workers_.fetch_sub(1);
+  }
+
+  current_worker = {nullptr, nullptr, nullptr};
+  // Let other workers take the tasks left in our deque
+  state->queues_in_use_[queue_index] = false;
+  state->cv_.notify_all();
+
+  // See WorkerLoop
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  RemoveWorkerStats(state.get(), stats_it);
+  state->finished_workers_.push_back(std::move(*it));
+  state->workers_.erase(it);
+  if (state->please_shutdown_) {
+    state->cv_shutdown_.notify_one();
+  }
+}
+
 ThreadPool::ThreadPool()
     : sp_state_(std::make_shared<ThreadPool::State>()),
       state_(sp_state_.get()),
@@ -139,8 +389,13 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
+    new_state->work_stealing_ = state_->work_stealing_;
+    {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      new_state->name_ = state_->name_;
+    }
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -171,6 +426,7 @@ Status ThreadPool::SetCapacity(int threads) {
     LaunchWorkersUnlocked(diff);
   } else if (diff < 0) {
     // Wake threads to ask them to stop
+    state_->interrupt_workers_ = true;
     state_->cv_.notify_all();
   }
   return Status::OK();
@@ -182,6 +438,34 @@ int ThreadPool::GetCapacity() {
   return state_->desired_capacity_;
 }
 
+ThreadPoolStats ThreadPool::GetStats() {
+  ProtectAgainstFork();
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  ThreadPoolStats stats = state_->exited_worker_stats_;
+  for (const auto& worker_stats : state_->worker_stats_) {
+    worker_stats.AddTo(&stats);
+  }
+  stats.tasks_submitted += state_->tasks_submitted_;
+  if (state_->work_stealing_) {
+    stats.queue_depth = std::max<int64_t>(0, state_->num_queued_tasks_.load());
+  } else {
+    stats.queue_depth = static_cast<int64_t>(state_->pending_tasks_.size());
+  }
+  return stats;
+}
+
+std::string ThreadPool::name() {
+  ProtectAgainstFork();
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  return state_->name_;
+}
+
+void ThreadPool::SetName(std::string name) {
+  ProtectAgainstFork();
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  state_->name_ = std::move(name);
+}
+
 int ThreadPool::GetActualCapacity() {
   ProtectAgainstFork();
   std::unique_lock<std::mutex> lock(state_->mutex_);
@@ -197,12 +481,19 @@ Status ThreadPool::Shutdown(bool wait) {
   }
   state_->please_shutdown_ = true;
   state_->quick_shutdown_ = !wait;
+  state_->interrupt_workers_ = true;
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
     DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_queued_tasks_.load(), 0);
   } else {
     state_->pending_tasks_.clear();
+    for (const auto& queue : *state_->queues_) {
+      std::lock_guard<std::mutex> queue_lock(queue->mutex_);
+      queue->tasks_.clear();
+    }
+    state_->num_queued_tasks_ = 0;
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -222,11 +513,71 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   for (int i = 0; i < threads; i++) {
     state_->workers_.emplace_back();
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    if (!state_->work_stealing_) {
+      *it = std::thread([state, it] { WorkerLoop(state, it); });
+      continue;
+    }
+    // Find a free deque for the new worker, or add one
+    auto& in_use = state_->queues_in_use_;
+    size_t queue_index = std::find(in_use.begin(), in_use.end(), false) - in_use.begin();
+    if (queue_index == in_use.size()) {
+      auto queues = std::make_shared<WorkerQueueVector>(*state_->queues_);
+      queues->push_back(std::make_shared<WorkerQueue>());
+      internal::atomic_store(&state_->queues_, std::move(queues));
+      state_->queues_version_.fetch_add(1);
+      in_use.push_back(true);
+    } else {
+      in_use[queue_index] = true;
+    }
+    *it = std::thread(
+        [state, it, queue_index] { WorkStealingWorkerLoop(state, it, queue_index); });
   }
 }
 
+Status ThreadPool::SpawnWorkStealing(std::function<void()> task) {
+  if (current_worker.state == state_) {
+    // Spawned from one of our workers: push to its own deque
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    {
+      std::lock_guard<std::mutex> queue_lock(current_worker.queue->mutex_);
+      current_worker.queue->tasks_.push_back({std::move(task), NowNanos()});
+    }
+    WorkerStats::Add(&current_worker.stats->tasks_submitted, 1);
+    state_->num_queued_tasks_.fetch_add(1);
+    if (state_->num_sleeping_workers_.load() > 0) {
+      // Taking the lock ensures the sleeping worker is waiting on cv_
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->cv_.notify_one();
+    }
+    return Status::OK();
+  }
+
+  std::lock_guard<std::mutex> lock(state_->mutex_);
+  if (state_->please_shutdown_) {
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  CollectFinishedWorkersUnlocked();
+  const auto& queues = *state_->queues_;
+  WorkerQueue* queue = queues[state_->next_queue_.fetch_add(1) % queues.size()].get();
+  {
+    std::lock_guard<std::mutex> queue_lock(queue->mutex_);
+    queue->tasks_.push_back({std::move(task), NowNanos()});
+  }
+  ++state_->tasks_submitted_;
+  state_->num_queued_tasks_.fetch_add(1);
+  if (state_->num_sleeping_workers_.load() > 0) {
+    state_->cv_.notify_one();
+  }
+  return Status::OK();
+}
+
 Status ThreadPool::SpawnReal(std::function<void()> task) {
+  if (state_->work_stealing_) {
+    ProtectAgainstFork();
+    return SpawnWorkStealing(std::move(task));
+  }
   {
     ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
@@ -234,7 +585,8 @@ Status ThreadPool::SpawnReal(std::function<void()> task) {
       return Status::Invalid("operation forbidden during or after shutdown");
     }
     CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
+    state_->pending_tasks_.push_back({std::move(task), NowNanos()});
+    ++state_->tasks_submitted_;
   }
   state_->cv_.notify_one();
   return Status::OK();
@@ -247,6 +599,14 @@ Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
   return Status::OK();
 }
 
+Status ThreadPool::MakeWorkStealing(int threads, std::shared_ptr<ThreadPool>* out) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->work_stealing_ = true;
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  *out = std::move(pool);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -287,9 +647,9 @@ int ThreadPool::DefaultCapacity() {
 }
 
 // Helper for the singleton pattern
-std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+std::shared_ptr<ThreadPool> ThreadPool::MakeGlobalThreadPool(int threads) {
   std::shared_ptr<ThreadPool> pool;
-  ARROW_CHECK_OK(ThreadPool::Make(ThreadPool::DefaultCapacity(), &pool));
+  ARROW_CHECK_OK(ThreadPool::Make(threads, &pool));
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -300,11 +660,37 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   return pool;
 }
 
+std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+  auto pool = MakeGlobalThreadPool(ThreadPool::DefaultCapacity());
+  pool->SetName("cpu");
+  return pool;
+}
+
+// Enough concurrent requests to hide the first-byte latency of object stores
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+std::shared_ptr<ThreadPool> ThreadPool::MakeIOThreadPool() {
+  // Sized independently of the CPU pool, so that blocking reads do not take
+  // CPU workers away from compute tasks
+  int capacity = ParseOMPEnvVar("ARROW_IO_THREADS");
+  if (capacity == 0) {
+    capacity = kDefaultIOThreadPoolCapacity;
+  }
+  auto pool = MakeGlobalThreadPool(capacity);
+  pool->SetName("io");
+  return pool;
+}
+
 ThreadPool* GetCpuThreadPool() {
   static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
   return singleton.get();
 }
 
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeIOThreadPool();
+  return singleton.get();
+}
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -313,4 +699,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
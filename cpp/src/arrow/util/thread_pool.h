@@ -53,6 +53,21 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking I/O tasks, such as background reads from
+/// remote filesystems.  It defaults to 8, or to the value of the
+/// ARROW_IO_THREADS environment variable if set.
+///
+/// You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
@@ -72,11 +87,35 @@ struct packaged_task_wrapper {
 
 }  // namespace detail
 
+// Cumulative statistics of a ThreadPool, as returned by ThreadPool::GetStats().
+// Durations are in nanoseconds and summed over all tasks or workers.
+struct ThreadPoolStats {
+  int64_t tasks_submitted = 0;
+  int64_t tasks_completed = 0;
+  // Tasks submitted but not started yet, at the time of the call
+  int64_t queue_depth = 0;
+  // Time between the submission and the start of the completed tasks
+  int64_t queued_time = 0;
+  // Time spent running the completed tasks
+  int64_t running_time = 0;
+  // Time workers spent waiting for tasks
+  int64_t idle_time = 0;
+};
+
 class ARROW_EXPORT ThreadPool {
  public:
   // Construct a thread pool with the given number of worker threads
   static Status Make(int threads, std::shared_ptr<ThreadPool>* out);
 
+  // Construct a work-stealing thread pool with the given number of worker
+  // threads.  Instead of a single shared queue, each worker has its own task
+  // deque: tasks spawned from a worker go to the back of its deque and are
+  // popped from there (LIFO), other tasks are distributed round-robin, and
+  // idle workers steal from the front of other deques.  This reduces
+  // contention when many small tasks are spawned, especially from within
+  // tasks.  Tasks are not started in submission order.
+  static Status MakeWorkStealing(int threads, std::shared_ptr<ThreadPool>* out);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -94,6 +133,15 @@ class ARROW_EXPORT ThreadPool {
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
 
+  // Return the statistics of the pool since its creation.  Each worker
+  // maintains its own counters, which this sums under the pool lock.
+  ThreadPoolStats GetStats();
+
+  // The name of the pool, for telling pools apart in diagnostics.  The
+  // global pools are named "cpu" and "io", other pools are unnamed.
+  std::string name();
+  void SetName(std::string name);
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
@@ -135,12 +183,14 @@ class ARROW_EXPORT ThreadPool {
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   ThreadPool();
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
   Status SpawnReal(std::function<void()> task);
+  Status SpawnWorkStealing(std::function<void()> task);
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
   // Launch a given number of additional workers
@@ -151,6 +201,8 @@ class ARROW_EXPORT ThreadPool {
   void ProtectAgainstFork();
 
   static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> MakeIOThreadPool();
+  static std::shared_ptr<ThreadPool> MakeGlobalThreadPool(int threads);
 
   std::shared_ptr<State> sp_state_;
   State* state_;
@@ -163,6 +215,11 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for blocking I/O tasks.  Its
+// capacity does not depend on the number of cores, since its workers
+// mostly wait.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -18,12 +18,15 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <vector>
 
@@ -73,8 +76,18 @@ struct Task {
   Workload workload_;
 };
 
+static std::shared_ptr<ThreadPool> MakeThreadPool(int nthreads, bool work_stealing) {
+  std::shared_ptr<ThreadPool> pool;
+  if (work_stealing) {
+    ABORT_NOT_OK(ThreadPool::MakeWorkStealing(nthreads, &pool));
+  } else {
+    ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+  }
+  return pool;
+}
+
 // Benchmark ThreadPool::Spawn
-static void ThreadPoolSpawn(benchmark::State& state) {
+static void ThreadPoolSpawn(benchmark::State& state, bool work_stealing) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
 
@@ -85,8 +98,7 @@ static void ThreadPoolSpawn(benchmark::State& state) {
 
   for (auto _ : state) {
     state.PauseTiming();
-    std::shared_ptr<ThreadPool> pool;
-    ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+    std::shared_ptr<ThreadPool> pool = MakeThreadPool(nthreads, work_stealing);
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -103,6 +115,72 @@ static void ThreadPoolSpawn(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// A binary tree of tasks, where each task spawns its children
+class NestedSpawner {
+ public:
+  NestedSpawner(ThreadPool* pool, Workload* workload, int depth)
+      : pool_(pool), workload_(workload), remaining_((1 << (depth + 1)) - 1) {
+    Spawn(depth);
+  }
+
+  void Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return finished_; });
+  }
+
+ private:
+  void Spawn(int depth) {
+    ABORT_NOT_OK(pool_->Spawn([this, depth]() { Run(depth); }));
+  }
+
+  void Run(int depth) {
+    if (depth > 0) {
+      Spawn(depth - 1);
+      Spawn(depth - 1);
+    }
+    (*workload_)();
+    if (remaining_.fetch_sub(1) == 1) {
+      // Notify under the lock so that the spawner cannot be destroyed before
+      // notify_one() has returned
+      std::lock_guard<std::mutex> lock(mutex_);
+      finished_ = true;
+      cv_.notify_one();
+    }
+  }
+
+  ThreadPool* pool_;
+  Workload* workload_;
+  std::atomic<int32_t> remaining_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool finished_ = false;
+};
+
+// Benchmark ThreadPool::Spawn called from running tasks
+static void ThreadPoolSpawnNested(benchmark::State& state, bool work_stealing) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  // Spawn about as many tasks as ThreadPoolSpawn
+  int depth = 0;
+  while ((int64_t(2) << depth) < 200000000 / workload_size + 1) {
+    ++depth;
+  }
+  const int32_t nspawns = (1 << (depth + 1)) - 1;
+
+  std::shared_ptr<ThreadPool> pool = MakeThreadPool(nthreads, work_stealing);
+
+  for (auto _ : state) {
+    NestedSpawner spawner(pool.get(), &workload, depth);
+    spawner.Wait();
+  }
+  ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+
+  state.SetItemsProcessed(state.iterations() * nspawns);
+}
+
 // Benchmark serial TaskGroup
 static void SerialTaskGroup(benchmark::State& state) {
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -123,12 +201,11 @@ static void SerialTaskGroup(benchmark::State& state) {
 }
 
 // Benchmark threaded TaskGroup
-static void ThreadedTaskGroup(benchmark::State& state) {
+static void ThreadedTaskGroup(benchmark::State& state, bool work_stealing) {
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
 
-  std::shared_ptr<ThreadPool> pool;
-  ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+  std::shared_ptr<ThreadPool> pool = MakeThreadPool(nthreads, work_stealing);
 
   Task task(workload_size);
 
@@ -159,7 +236,7 @@ static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
 
 static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   for (const int32_t w : kWorkloadSizes) {
-    for (const int nthreads : {1, 2, 4, 8}) {
+    for (const int nthreads : {1, 2, 4, 8, 16, 32}) {
       b->Args({nthreads, w});
     }
   }
@@ -188,8 +265,16 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 #endif
 
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
-BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
-BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_CAPTURE(ThreadPoolSpawn, shared_queue, false)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_CAPTURE(ThreadPoolSpawn, work_stealing, true)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_CAPTURE(ThreadPoolSpawnNested, shared_queue, false)
+    ->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_CAPTURE(ThreadPoolSpawnNested, work_stealing, true)
+    ->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_CAPTURE(ThreadedTaskGroup, shared_queue, false)
+    ->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK_CAPTURE(ThreadedTaskGroup, work_stealing, true)
+    ->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
 }  // namespace arrow
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -132,7 +133,8 @@ class AddTester {
   std::vector<int> outs;
 };
 
-class TestThreadPool : public ::testing::Test {
+// Parameterized on whether the pool is work-stealing
+class TestThreadPool : public ::testing::TestWithParam<bool> {
  public:
   void TearDown() {
     fflush(stdout);
@@ -143,7 +145,8 @@ class TestThreadPool : public ::testing::Test {
 
   std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
     std::shared_ptr<ThreadPool> pool;
-    Status st = ThreadPool::Make(threads, &pool);
+    Status st = GetParam() ? ThreadPool::MakeWorkStealing(threads, &pool)
+                           : ThreadPool::Make(threads, &pool);
     return pool;
   }
 
@@ -175,7 +178,7 @@ class TestThreadPool : public ::testing::Test {
   }
 };
 
-TEST_F(TestThreadPool, ConstructDestruct) {
+TEST_P(TestThreadPool, ConstructDestruct) {
   // Stress shutdown-at-destruction logic
   for (int threads : {1, 2, 3, 8, 32, 70}) {
     auto pool = this->MakeThreadPool(threads);
@@ -184,22 +187,22 @@ TEST_F(TestThreadPool, ConstructDestruct) {
 
 // Correctness and stress tests using Spawn() and Shutdown()
 
-TEST_F(TestThreadPool, Spawn) {
+TEST_P(TestThreadPool, Spawn) {
   auto pool = this->MakeThreadPool(3);
   SpawnAdds(pool.get(), 7, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawn) {
+TEST_P(TestThreadPool, StressSpawn) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawnThreaded) {
+TEST_P(TestThreadPool, StressSpawnThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
 }
 
-TEST_F(TestThreadPool, SpawnSlow) {
+TEST_P(TestThreadPool, SpawnSlow) {
   // This checks that Shutdown() waits for all tasks to finish
   auto pool = this->MakeThreadPool(2);
   SpawnAdds(pool.get(), 7, [](int x, int y, int* out) {
@@ -207,21 +210,21 @@ TEST_F(TestThreadPool, SpawnSlow) {
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlow) {
+TEST_P(TestThreadPool, StressSpawnSlow) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlowThreaded) {
+TEST_P(TestThreadPool, StressSpawnSlowThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, QuickShutdown) {
+TEST_P(TestThreadPool, QuickShutdown) {
   AddTester add_tester(100);
   {
     auto pool = this->MakeThreadPool(3);
@@ -234,7 +237,7 @@ TEST_F(TestThreadPool, QuickShutdown) {
   add_tester.CheckNotAllComputed();
 }
 
-TEST_F(TestThreadPool, SetCapacity) {
+TEST_P(TestThreadPool, SetCapacity) {
   auto pool = this->MakeThreadPool(3);
   ASSERT_EQ(pool->GetCapacity(), 3);
   ASSERT_EQ(pool->GetActualCapacity(), 3);
@@ -266,9 +269,39 @@ TEST_F(TestThreadPool, SetCapacity) {
   ASSERT_OK(pool->Shutdown());
 }
 
+// Tasks spawning tasks, which exercises the work-stealing deques
+
+static void SpawnRecursively(ThreadPool* pool, int depth, std::atomic<int>* count) {
+  count->fetch_add(1);
+  if (depth > 0) {
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_OK(pool->Spawn([=] { SpawnRecursively(pool, depth - 1, count); }));
+    }
+  }
+}
+
+TEST_P(TestThreadPool, SpawnNested) {
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> count(0);
+  ASSERT_OK(pool->Spawn([&] { SpawnRecursively(pool.get(), 12, &count); }));
+  busy_wait(5.0, [&] { return count.load() == (1 << 13) - 1; });
+  ASSERT_EQ(count.load(), (1 << 13) - 1);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_P(TestThreadPool, SubmitNested) {
+  auto pool = this->MakeThreadPool(2);
+  auto fut = pool->Submit([&] {
+    auto inner = pool->Submit(add<int>, 4, 5);
+    return inner;
+  });
+  ASSERT_EQ(fut.get().get(), 9);
+  ASSERT_OK(pool->Shutdown());
+}
+
 // Test Submit() functionality
 
-TEST_F(TestThreadPool, Submit) {
+TEST_P(TestThreadPool, Submit) {
   auto pool = this->MakeThreadPool(3);
   {
     auto fut = pool->Submit(add<int>, 4, 5);
@@ -296,11 +329,52 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+TEST_P(TestThreadPool, Stats) {
+  auto pool = this->MakeThreadPool(1);
+  // Let the worker wait for tasks
+  sleep_for(0.01);
+
+  std::promise<void> unblock;
+  std::shared_future<void> unblocked(unblock.get_future());
+  std::promise<void> started;
+  ASSERT_OK(pool->Spawn([&] {
+    started.set_value();
+    unblocked.wait();
+  }));
+  started.get_future().wait();
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(pool->Spawn([] {}));
+  }
+  auto stats = pool->GetStats();
+  ASSERT_EQ(stats.tasks_submitted, 4);
+  ASSERT_EQ(stats.tasks_completed, 0);
+  ASSERT_EQ(stats.queue_depth, 3);
+  ASSERT_GT(stats.idle_time, 0);
+
+  sleep_for(0.01);
+  unblock.set_value();
+  ASSERT_OK(pool->Shutdown());
+  stats = pool->GetStats();
+  ASSERT_EQ(stats.tasks_submitted, 4);
+  ASSERT_EQ(stats.tasks_completed, 4);
+  ASSERT_EQ(stats.queue_depth, 0);
+  // The last three tasks waited for the first one
+  ASSERT_GE(stats.running_time, 10000000);
+  ASSERT_GE(stats.queued_time, 3 * 10000000);
+}
+
+TEST_P(TestThreadPool, Name) {
+  auto pool = this->MakeThreadPool(1);
+  ASSERT_EQ(pool->name(), "");
+  pool->SetName("decode");
+  ASSERT_EQ(pool->name(), "decode");
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
       defined(THREAD_SANITIZER))
-TEST_F(TestThreadPool, ForkSafety) {
+TEST_P(TestThreadPool, ForkSafety) {
   pid_t child_pid;
   int child_status;
 
@@ -356,6 +430,8 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+INSTANTIATE_TEST_CASE_P(TestThreadPool, TestThreadPool, ::testing::Values(false, true));
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
@@ -401,5 +477,23 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestGlobalThreadPool, Names) {
+  ASSERT_EQ(GetCpuThreadPool()->name(), "cpu");
+  ASSERT_EQ(GetIOThreadPool()->name(), "io");
+}
+
+TEST(TestGlobalThreadPool, IOCapacity) {
+  auto pool = GetIOThreadPool();
+  ASSERT_NE(pool, GetCpuThreadPool());
+  int capacity = pool->GetCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 1));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 1);
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+  ASSERT_EQ(pool->Submit([] { return 42; }).get(), 42);
+}
+
 }  // namespace internal
 }  // namespace arrow
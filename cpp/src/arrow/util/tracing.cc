@@ -0,0 +1,166 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include "arrow/util/tracing.h"
+
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include <utility>
+
+#include "arrow/util/atomic_shared_ptr.h"
+
+namespace arrow {
+namespace util {
+
+namespace internal {
+
+std::atomic<bool> tracing_enabled(false);
+
+}  // namespace internal
+
+namespace {
+
+std::shared_ptr<TraceSink> global_sink;
+
+void AppendJsonString(const char* s, std::ostream* out) {
+  *out << '"';
+  for (; *s != '\0'; ++s) {
+    const char c = *s;
+    if (c == '"' || c == '\\') {
+      *out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", static_cast<int>(c));
+      *out << buf;
+    } else {
+      *out << c;
+    }
+  }
+  *out << '"';
+}
+
+// Chrome trace timestamps are microseconds
+void AppendMicros(int64_t nanos, std::ostream* out) {
+  *out << (nanos / 1000) << '.';
+  char buf[4];
+  snprintf(buf, sizeof(buf), "%03d", static_cast<int>(nanos % 1000));
+  *out << buf;
+}
+
+void AppendEventHeader(const char* category, const char* name, char phase,
+                       int64_t thread_id, int64_t time_ns, std::ostream* out) {
+  *out << "{\"name\":";
+  AppendJsonString(name, out);
+  *out << ",\"cat\":";
+  AppendJsonString(category, out);
+  *out << ",\"ph\":\"" << phase << "\",\"pid\":1,\"tid\":" << thread_id << ",\"ts\":";
+  AppendMicros(time_ns, out);
+}
+
+}  // namespace
+
+TraceSink::~TraceSink() {}
+
+void SetTraceSink(std::shared_ptr<TraceSink> sink) {
+  const bool enabled = sink != nullptr;
+  ::arrow::internal::atomic_store(&global_sink, std::move(sink));
+  internal::tracing_enabled.store(enabled);
+}
+
+std::shared_ptr<TraceSink> GetTraceSink() {
+  return ::arrow::internal::atomic_load(&global_sink);
+}
+
+namespace internal {
+
+int64_t TraceClockNanos() {
+  using ClockType = std::chrono::steady_clock;
+  static const ClockType::time_point epoch = ClockType::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(ClockType::now() - epoch)
+      .count();
+}
+
+int64_t TraceThreadId() {
+  static std::atomic<int64_t> next_thread_id(1);
+  thread_local const int64_t thread_id = next_thread_id.fetch_add(1);
+  return thread_id;
+}
+
+void RecordCounter(const char* category, const char* name, int64_t value) {
+  auto sink = GetTraceSink();
+  if (sink != nullptr) {
+    sink->RecordCounter({category, name, TraceThreadId(), TraceClockNanos(), value});
+  }
+}
+
+}  // namespace internal
+
+void ScopedSpan::Start() {
+  sink_ = GetTraceSink();
+  start_ns_ = internal::TraceClockNanos();
+}
+
+void ScopedSpan::End() {
+  const int64_t end_ns = internal::TraceClockNanos();
+  sink_->RecordSpan({category_, name_, internal::TraceThreadId(), start_ns_,
+                     end_ns - start_ns_, bytes_});
+}
+
+void ChromeTraceSink::RecordSpan(const TraceSpan& span) {
+  std::stringstream ss;
+  AppendEventHeader(span.category, span.name, 'X', span.thread_id, span.start_ns, &ss);
+  ss << ",\"dur\":";
+  AppendMicros(span.duration_ns, &ss);
+  if (span.bytes >= 0) {
+    ss << ",\"args\":{\"bytes\":" << span.bytes << "}";
+  }
+  ss << "}";
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  events_.push_back(ss.str());
+}
+
+void ChromeTraceSink::RecordCounter(const TraceCounter& counter) {
+  std::stringstream ss;
+  AppendEventHeader(counter.category, counter.name, 'C', counter.thread_id,
+                    counter.time_ns, &ss);
+  ss << ",\"args\":{\"value\":" << counter.value << "}}";
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  events_.push_back(ss.str());
+}
+
+int64_t ChromeTraceSink::num_events() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return static_cast<int64_t>(events_.size());
+}
+
+std::string ChromeTraceSink::ToJson() const {
+  std::stringstream ss;
+  ss << "{\"traceEvents\":[";
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < events_.size(); ++i) {
+    ss << (i == 0 ? "\n" : ",\n") << events_[i];
+  }
+  ss << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  return ss.str();
+}
+
+}  // namespace util
+}  // namespace arrow
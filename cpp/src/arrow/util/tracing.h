@@ -0,0 +1,178 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+// Scoped spans and counters for the hot paths of the library.
+//
+// The instrumentation points use the ARROW_TRACE_* macros below, which only
+// expand to code when the library is built with ARROW_WITH_TRACING (the
+// ARROW_TRACING CMake option).  Even then, nothing is recorded until a sink
+// is installed with SetTraceSink(); until that point a span costs a relaxed
+// atomic load.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \brief A completed span, as passed to TraceSink::RecordSpan()
+///
+/// The category and the name are string literals of the instrumentation
+/// point, and outlive the sink.
+struct TraceSpan {
+  const char* category;
+  const char* name;
+  /// Thread on which the span ran, numbered from 1 in order of first use
+  int64_t thread_id;
+  /// Start time, in nanoseconds since the first use of the tracing clock
+  int64_t start_ns;
+  int64_t duration_ns;
+  /// Bytes processed by the span, or -1 if it didn't report any
+  int64_t bytes;
+};
+
+/// \brief A counter sample, as passed to TraceSink::RecordCounter()
+struct TraceCounter {
+  const char* category;
+  const char* name;
+  int64_t thread_id;
+  int64_t time_ns;
+  int64_t value;
+};
+
+/// \brief Destination of the spans and counters
+///
+/// The methods are called from any thread, while the span or the sample is
+/// being closed, so they should be cheap and must be thread-safe.
+class ARROW_EXPORT TraceSink {
+ public:
+  virtual ~TraceSink();
+
+  virtual void RecordSpan(const TraceSpan& span) = 0;
+  virtual void RecordCounter(const TraceCounter& counter) = 0;
+};
+
+/// \brief Install the process-wide trace sink
+///
+/// Pass nullptr to stop tracing.  Spans which are open when the sink is
+/// changed are recorded to the sink they started with.
+ARROW_EXPORT void SetTraceSink(std::shared_ptr<TraceSink> sink);
+
+/// \brief Return the process-wide trace sink, or nullptr
+ARROW_EXPORT std::shared_ptr<TraceSink> GetTraceSink();
+
+/// \brief A TraceSink buffering the events in the Chrome trace event format
+///
+/// The output of ToJson() can be loaded by chrome://tracing or by Perfetto.
+class ARROW_EXPORT ChromeTraceSink : public TraceSink {
+ public:
+  void RecordSpan(const TraceSpan& span) override;
+  void RecordCounter(const TraceCounter& counter) override;
+
+  /// \brief The number of events recorded so far
+  int64_t num_events() const;
+
+  /// \brief Serialize the events recorded so far as a JSON object
+  std::string ToJson() const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::vector<std::string> events_;
+};
+
+namespace internal {
+
+ARROW_EXPORT extern std::atomic<bool> tracing_enabled;
+
+ARROW_EXPORT int64_t TraceClockNanos();
+ARROW_EXPORT int64_t TraceThreadId();
+ARROW_EXPORT void RecordCounter(const char* category, const char* name, int64_t value);
+
+}  // namespace internal
+
+/// \brief A span covering the lifetime of the object
+///
+/// Use the ARROW_TRACE_SPAN macro rather than this class, so that the span
+/// disappears from builds without tracing.
+class ARROW_EXPORT ScopedSpan {
+ public:
+  ScopedSpan(const char* category, const char* name) : category_(category), name_(name) {
+    if (ARROW_PREDICT_FALSE(internal::tracing_enabled.load(std::memory_order_relaxed))) {
+      Start();
+    }
+  }
+
+  ~ScopedSpan() {
+    if (ARROW_PREDICT_FALSE(sink_ != NULLPTR)) {
+      End();
+    }
+  }
+
+  /// \brief Add to the number of bytes processed by the span
+  void AddBytes(int64_t bytes) { bytes_ = (bytes_ < 0 ? 0 : bytes_) + bytes; }
+
+ private:
+  void Start();
+  void End();
+
+  const char* category_;
+  const char* name_;
+  std::shared_ptr<TraceSink> sink_;
+  int64_t start_ns_ = 0;
+  int64_t bytes_ = -1;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedSpan);
+};
+
+}  // namespace util
+}  // namespace arrow
+
+#ifdef ARROW_WITH_TRACING
+
+/// Open a span named `var` until the end of the enclosing scope
+#define ARROW_TRACE_SPAN(var, category, name) \
+  ::arrow::util::ScopedSpan var((category), (name))
+
+/// Add to the number of bytes processed by the span `var`
+#define ARROW_TRACE_SPAN_BYTES(var, bytes) var.AddBytes(bytes)
+
+/// Record a sample of a counter
+#define ARROW_TRACE_COUNTER(category, name, value)                                 \
+  do {                                                                             \
+    if (ARROW_PREDICT_FALSE(::arrow::util::internal::tracing_enabled.load(         \
+            std::memory_order_relaxed))) {                                         \
+      ::arrow::util::internal::RecordCounter((category), (name), (value));         \
+    }                                                                              \
+  } while (false)
+
+#else
+
+#define ARROW_TRACE_SPAN(var, category, name) static_cast<void>(0)
+#define ARROW_TRACE_SPAN_BYTES(var, bytes) static_cast<void>(0)
+#define ARROW_TRACE_COUNTER(category, name, value) static_cast<void>(0)
+
+#endif  // ARROW_WITH_TRACING
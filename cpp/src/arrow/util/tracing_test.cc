@@ -0,0 +1,180 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
+
+namespace arrow {
+namespace util {
+
+class CollectingSink : public TraceSink {
+ public:
+  void RecordSpan(const TraceSpan& span) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    spans_.push_back(span);
+  }
+
+  void RecordCounter(const TraceCounter& counter) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    counters_.push_back(counter);
+  }
+
+  std::vector<TraceSpan> spans() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return spans_;
+  }
+
+  std::vector<TraceCounter> counters() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return counters_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<TraceSpan> spans_;
+  std::vector<TraceCounter> counters_;
+};
+
+class TestTracing : public ::testing::Test {
+ public:
+  void SetUp() override {
+    sink_ = std::make_shared<CollectingSink>();
+    SetTraceSink(sink_);
+  }
+
+  void TearDown() override { SetTraceSink(nullptr); }
+
+ protected:
+  std::shared_ptr<CollectingSink> sink_;
+};
+
+TEST_F(TestTracing, ScopedSpan) {
+  ASSERT_EQ(GetTraceSink(), sink_);
+  {
+    ScopedSpan outer("test", "Outer");
+    {
+      ScopedSpan inner("test", "Inner");
+      inner.AddBytes(10);
+      inner.AddBytes(5);
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+  auto spans = sink_->spans();
+  ASSERT_EQ(spans.size(), 2);
+  ASSERT_STREQ(spans[0].name, "Inner");
+  ASSERT_STREQ(spans[0].category, "test");
+  ASSERT_EQ(spans[0].bytes, 15);
+  ASSERT_GE(spans[0].duration_ns, 1000000);
+  ASSERT_STREQ(spans[1].name, "Outer");
+  ASSERT_EQ(spans[1].bytes, -1);
+  ASSERT_LE(spans[1].start_ns, spans[0].start_ns);
+  ASSERT_GE(spans[1].duration_ns, spans[0].duration_ns);
+  ASSERT_EQ(spans[0].thread_id, spans[1].thread_id);
+
+  internal::RecordCounter("test", "Counter", 42);
+  auto counters = sink_->counters();
+  ASSERT_EQ(counters.size(), 1);
+  ASSERT_STREQ(counters[0].name, "Counter");
+  ASSERT_EQ(counters[0].value, 42);
+}
+
+TEST_F(TestTracing, ThreadIds) {
+  int64_t other_thread_id = 0;
+  std::thread thread([&]() {
+    ScopedSpan span("test", "Thread");
+    other_thread_id = internal::TraceThreadId();
+  });
+  thread.join();
+  ASSERT_NE(other_thread_id, internal::TraceThreadId());
+  auto spans = sink_->spans();
+  ASSERT_EQ(spans.size(), 1);
+  ASSERT_EQ(spans[0].thread_id, other_thread_id);
+}
+
+TEST_F(TestTracing, NoSink) {
+  SetTraceSink(nullptr);
+  ASSERT_EQ(GetTraceSink(), nullptr);
+  { ScopedSpan span("test", "Dropped"); }
+  internal::RecordCounter("test", "Dropped", 1);
+
+  // A span records to the sink it started with
+  ScopedSpan* span = nullptr;
+  SetTraceSink(sink_);
+  span = new ScopedSpan("test", "Started");
+  SetTraceSink(nullptr);
+  delete span;
+
+  ASSERT_EQ(sink_->spans().size(), 1);
+  ASSERT_STREQ(sink_->spans()[0].name, "Started");
+  ASSERT_EQ(sink_->counters().size(), 0);
+}
+
+TEST(ChromeTraceSink, ToJson) {
+  ChromeTraceSink sink;
+  ASSERT_EQ(sink.ToJson(), "{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n");
+
+  sink.RecordSpan({"cat", "Read \"x\"", 2, 1500, 2000042, 100});
+  sink.RecordSpan({"cat", "Parse", 3, 999, 1, -1});
+  sink.RecordCounter({"memory", "bytes_allocated", 1, 3000000, 4096});
+  ASSERT_EQ(sink.num_events(), 3);
+  ASSERT_EQ(sink.ToJson(),
+            "{\"traceEvents\":[\n"
+            "{\"name\":\"Read \\\"x\\\"\",\"cat\":\"cat\",\"ph\":\"X\",\"pid\":1,"
+            "\"tid\":2,\"ts\":1.500,\"dur\":2000.042,\"args\":{\"bytes\":100}},\n"
+            "{\"name\":\"Parse\",\"cat\":\"cat\",\"ph\":\"X\",\"pid\":1,"
+            "\"tid\":3,\"ts\":0.999,\"dur\":0.001},\n"
+            "{\"name\":\"bytes_allocated\",\"cat\":\"memory\",\"ph\":\"C\",\"pid\":1,"
+            "\"tid\":1,\"ts\":3000.000,\"args\":{\"value\":4096}}\n"
+            "],\"displayTimeUnit\":\"ns\"}\n");
+}
+
+#ifdef ARROW_WITH_TRACING
+
+TEST_F(TestTracing, Instrumentation) {
+  auto task_group = ::arrow::internal::TaskGroup::MakeThreaded(
+      ::arrow::internal::GetCpuThreadPool());
+  for (int i = 0; i < 4; ++i) {
+    task_group->Append([]() { return Status::OK(); });
+  }
+  // The spans of the tasks are closed before Finish() can return
+  ASSERT_OK(task_group->Finish());
+
+  int num_task_group_spans = 0;
+  for (const auto& span : sink_->spans()) {
+    if (std::string(span.category) == "task_group" && std::string(span.name) == "Task") {
+      ++num_task_group_spans;
+    }
+  }
+  ASSERT_EQ(num_task_group_spans, 4);
+}
+
+#endif  // ARROW_WITH_TRACING
+
+}  // namespace util
+}  // namespace arrow
@@ -21,6 +21,8 @@
 #include <stdexcept>
 #include <utility>
 
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/utf8.h"
 #include "arrow/vendored/utf8cpp/checked.h"
@@ -74,6 +76,221 @@ ARROW_EXPORT void CheckUTF8Initialized() {
       << "InitializeUTF8() must be called before calling UTF8 routines";
 }
 
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+
+// Vectorized validation with lookup tables, after "Validating UTF-8 In Less
+// Than One Instruction Per Byte" (Keiser & Lemire, 2021).
+//
+// Each byte is checked against the three bytes before it.  The high nibble of
+// the previous byte, its low nibble and the high nibble of the current byte
+// each index a 16-entry table of error flags; a pair of bytes is in error if
+// the three lookups share a flag.  Continuation bytes that must follow a lead
+// byte two or three positions back are checked separately.
+
+namespace {
+
+constexpr uint8_t kTooShort = 1 << 0;      // lead byte followed by a non-continuation
+constexpr uint8_t kTooLong = 1 << 1;       // ASCII followed by a continuation
+constexpr uint8_t kOverlong3 = 1 << 2;     // E0 80..9F
+constexpr uint8_t kTooLarge = 1 << 3;      // F4 90..BF, or F5..FF
+constexpr uint8_t kSurrogate = 1 << 4;     // ED A0..BF
+constexpr uint8_t kOverlong2 = 1 << 5;     // C0..C1
+constexpr uint8_t kTooLarge1000 = 1 << 6;  // F5..FF 80..8F
+constexpr uint8_t kOverlong4 = 1 << 6;     // F0 80..8F
+constexpr uint8_t kTwoConts = 1 << 7;      // two continuations, maybe valid
+constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// clang-format off
+alignas(16) const uint8_t kByte1High[16] = {
+  // 0_______ (ASCII)
+  kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______ (continuation)
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____
+  kTooShort | kOverlong2,
+  // 1101____
+  kTooShort,
+  // 1110____
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4,
+};
+
+alignas(16) const uint8_t kByte1Low[16] = {
+  // ____0000
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  // ____0001
+  kCarry | kOverlong2,
+  // ____001_
+  kCarry, kCarry,
+  // ____0100
+  kCarry | kTooLarge,
+  // ____0101 to ____1100
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+  // ____1101
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  // ____111_
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+};
+
+alignas(16) const uint8_t kByte2High[16] = {
+  // ________ 0_______
+  kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+  kTooShort,
+  // ________ 1000____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  // ________ 1001____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  // ________ 101_____
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // ________ 11______
+  kTooShort, kTooShort, kTooShort, kTooShort,
+};
+
+// Subtracted from the last bytes of a block to find unterminated sequences
+alignas(16) const uint8_t kIncompleteMax[16] = {
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF,
+};
+// clang-format on
+
+ARROW_TARGET_SSE4_2 int64_t ValidateUTF8SSE4(const uint8_t* data, int64_t size,
+                                             bool* valid) {
+  const __m128i byte_1_high =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte1High));
+  const __m128i byte_1_low =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte1Low));
+  const __m128i byte_2_high =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte2High));
+  const __m128i incomplete_max =
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kIncompleteMax));
+  const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+
+  __m128i error = _mm_setzero_si128();
+  __m128i prev_input = _mm_setzero_si128();
+  __m128i prev_incomplete = _mm_setzero_si128();
+  int64_t pos = 0;
+  for (; pos + 16 <= size; pos += 16) {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+    if (_mm_movemask_epi8(input) == 0) {
+      // All ASCII: only a sequence left open by the previous block is an error
+      error = _mm_or_si128(error, prev_incomplete);
+      prev_incomplete = _mm_setzero_si128();
+    } else {
+      const __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+      const __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+      const __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+      const __m128i prev1_high = _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble_mask);
+      const __m128i prev1_low = _mm_and_si128(prev1, nibble_mask);
+      const __m128i input_high = _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask);
+      const __m128i special_cases =
+          _mm_and_si128(_mm_and_si128(_mm_shuffle_epi8(byte_1_high, prev1_high),
+                                      _mm_shuffle_epi8(byte_1_low, prev1_low)),
+                        _mm_shuffle_epi8(byte_2_high, input_high));
+      // Bytes two or three positions after a 3- or 4-byte lead must be
+      // continuations, i.e. have kTwoConts set in special_cases
+      const __m128i must_be_2_3_continuation =
+          _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0x60)),
+                       _mm_subs_epu8(prev3, _mm_set1_epi8(0x70)));
+      const __m128i must_be_2_3_continuation_80 = _mm_and_si128(
+          must_be_2_3_continuation, _mm_set1_epi8(static_cast<char>(0x80)));
+      error = _mm_or_si128(error,
+                           _mm_xor_si128(must_be_2_3_continuation_80, special_cases));
+      prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+    }
+    prev_input = input;
+  }
+  *valid = _mm_testz_si128(error, error) != 0;
+  return pos;
+}
+
+ARROW_TARGET_AVX2 int64_t ValidateUTF8AVX2(const uint8_t* data, int64_t size,
+                                           bool* valid) {
+  const __m256i byte_1_high = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte1High)));
+  const __m256i byte_1_low = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte1Low)));
+  const __m256i byte_2_high = _mm256_broadcastsi128_si256(
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kByte2High)));
+  const __m256i incomplete_max = _mm256_inserti128_si256(
+      _mm256_set1_epi8(static_cast<char>(0xFF)),
+      _mm_load_si128(reinterpret_cast<const __m128i*>(kIncompleteMax)), 1);
+  const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+  __m256i error = _mm256_setzero_si256();
+  __m256i prev_input = _mm256_setzero_si256();
+  __m256i prev_incomplete = _mm256_setzero_si256();
+  int64_t pos = 0;
+  for (; pos + 32 <= size; pos += 32) {
+    const __m256i input =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+    if (_mm256_movemask_epi8(input) == 0) {
+      error = _mm256_or_si256(error, prev_incomplete);
+      prev_incomplete = _mm256_setzero_si256();
+    } else {
+      // alignr works within 128-bit lanes, so line up the preceding lane first
+      const __m256i shifted = _mm256_permute2x128_si256(prev_input, input, 0x21);
+      const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+      const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+      const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+      const __m256i prev1_high =
+          _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble_mask);
+      const __m256i prev1_low = _mm256_and_si256(prev1, nibble_mask);
+      const __m256i input_high =
+          _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble_mask);
+      const __m256i special_cases = _mm256_and_si256(
+          _mm256_and_si256(_mm256_shuffle_epi8(byte_1_high, prev1_high),
+                           _mm256_shuffle_epi8(byte_1_low, prev1_low)),
+          _mm256_shuffle_epi8(byte_2_high, input_high));
+      const __m256i must_be_2_3_continuation =
+          _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0x60)),
+                          _mm256_subs_epu8(prev3, _mm256_set1_epi8(0x70)));
+      const __m256i must_be_2_3_continuation_80 = _mm256_and_si256(
+          must_be_2_3_continuation, _mm256_set1_epi8(static_cast<char>(0x80)));
+      error = _mm256_or_si256(
+          error, _mm256_xor_si256(must_be_2_3_continuation_80, special_cases));
+      prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+    }
+    prev_input = input;
+  }
+  *valid = _mm256_testz_si256(error, error) != 0;
+  return pos;
+}
+
+}  // namespace
+
+#endif  // ARROW_HAVE_RUNTIME_X86_SIMD
+
+bool ValidateUTF8Large(const uint8_t* data, int64_t size) {
+#ifdef ARROW_HAVE_RUNTIME_X86_SIMD
+  using ::arrow::internal::CpuInfo;
+  static const bool have_avx2 = CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2);
+  static const bool have_sse4 = CpuInfo::GetInstance()->IsSupported(CpuInfo::SSE4_2);
+  if (have_avx2 || have_sse4) {
+    bool valid;
+    int64_t pos = have_avx2 ? ValidateUTF8AVX2(data, size, &valid)
+                            : ValidateUTF8SSE4(data, size, &valid);
+    if (!valid) {
+      return false;
+    }
+    // The blocks are valid except maybe for a sequence left open at their
+    // end: resume from its lead byte, which is at most 3 bytes back
+    for (int64_t i = pos - 1; i >= 0 && i >= pos - 3; --i) {
+      if (data[i] >= 0xC0) {
+        pos = i;
+        break;
+      }
+    }
+    return ValidateUTF8Inline(data + pos, size - pos);
+  }
+#endif
+  return ValidateUTF8Inline(data, size);
+}
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -85,7 +85,10 @@ ARROW_EXPORT void CheckUTF8Initialized();
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
-inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+namespace internal {
+
+// Validate with the state table, 8 ASCII bytes at a time
+inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   // For some reason, defining this variable outside the loop helps clang
   uint64_t mask;
@@ -165,6 +168,22 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
 }
 
+// Inputs of this size or more are validated by ValidateUTF8Large()
+static constexpr int64_t kUTF8LargeInputSize = 64;
+
+// Validate with SIMD instructions if the CPU supports them: AVX2 or SSE4.2
+// lookups check 32 or 16 bytes at a time
+ARROW_EXPORT bool ValidateUTF8Large(const uint8_t* data, int64_t size);
+
+}  // namespace internal
+
+inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+  if (size >= internal::kUTF8LargeInputSize) {
+    return internal::ValidateUTF8Large(data, size);
+  }
+  return internal::ValidateUTF8Inline(data, size);
+}
+
 inline bool ValidateUTF8(const util::string_view& str) {
   const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
   const size_t length = str.size();
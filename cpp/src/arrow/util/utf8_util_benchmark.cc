@@ -39,6 +39,10 @@ static const char* valid_almost_ascii =
 static const char* valid_non_ascii =
     "UTF-8 はISO/IEC 10646 (UCS) "
     "とUnicodeで使える8ビット符号単位の文字符号化形式及び文字符号化スキーム。 ";
+// Characters of 1 to 4 bytes, so that sequences straddle vector blocks
+static const char* valid_mixed =
+    "UTF-8: Юникод, Ελληνικά, 中文 и emoji 😀🚀, mixed at random réguliè"
+    "rement — ascii, кириллица, 日本語のテキスト, 🎉 and Ωμέγα again ";
 
 static std::string MakeLargeString(const std::string& base, int64_t nbytes) {
   int64_t nrepeats = (nbytes + base.size() - 1) / base.size();
@@ -92,6 +96,10 @@ static void ValidateSmallNonAscii(
   BenchmarkUTF8Validation(state, valid_non_ascii, true);
 }
 
+static void ValidateSmallMixed(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8Validation(state, valid_mixed, true);
+}
+
 static void ValidateLargeAscii(benchmark::State& state) {  // NOLINT non-const reference
   auto s = MakeLargeString(valid_ascii, 100000);
   BenchmarkUTF8Validation(state, s, true);
@@ -109,14 +117,21 @@ static void ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+static void ValidateLargeMixed(benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_mixed, 100000);
+  BenchmarkUTF8Validation(state, s, true);
+}
+
 BENCHMARK(ValidateTinyAscii);
 BENCHMARK(ValidateTinyNonAscii);
 BENCHMARK(ValidateSmallAscii);
 BENCHMARK(ValidateSmallAlmostAscii);
 BENCHMARK(ValidateSmallNonAscii);
+BENCHMARK(ValidateSmallMixed);
 BENCHMARK(ValidateLargeAscii);
 BENCHMARK(ValidateLargeAlmostAscii);
 BENCHMARK(ValidateLargeNonAscii);
+BENCHMARK(ValidateLargeMixed);
 
 }  // namespace util
 }  // namespace arrow
@@ -251,6 +251,62 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8ValidationTest, BlockBoundaries) {
+  // Put each sequence at every offset around the 16- and 32-byte blocks of the
+  // vectorized validator, in inputs large enough to take it
+  const std::string padding(80, 'x');
+  const std::string multibyte_padding = "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80";
+  for (int offset = 0; offset < 70; ++offset) {
+    for (const auto& prefix_char : {std::string("a"), multibyte_padding}) {
+      std::string prefix;
+      while (static_cast<int>(prefix.size()) < offset) {
+        prefix += prefix_char;
+      }
+      for (const auto& v : all_valid_sequences) {
+        AssertValidUTF8(prefix + v + padding);
+        AssertValidUTF8(padding + prefix + v);
+        if (v.size() > 1) {
+          AssertInvalidUTF8(prefix + v.substr(0, v.size() - 1) + padding);
+          AssertInvalidUTF8(padding + prefix + v.substr(0, v.size() - 1));
+        }
+      }
+      for (const auto& v : all_invalid_sequences) {
+        AssertInvalidUTF8(prefix + v + padding);
+        AssertInvalidUTF8(padding + prefix + v);
+      }
+    }
+  }
+}
+
+TEST_F(UTF8ValidationTest, RandomBytes) {
+  // The vectorized validator must agree with the scalar one
+#ifdef ARROW_VALGRIND
+  const int niters = 100;
+#else
+  const int niters = 10000;
+#endif
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> valid_dist(0, all_valid_sequences.size() - 1);
+  std::uniform_int_distribution<int> size_dist(64, 200);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+
+  for (int i = 0; i < niters; ++i) {
+    std::string s;
+    const int size = size_dist(gen);
+    while (static_cast<int>(s.size()) < size) {
+      s += all_valid_sequences[valid_dist(gen)];
+    }
+    // Corrupt a byte most of the time
+    if (i % 4 != 0) {
+      s[byte_dist(gen) % s.size()] = static_cast<char>(byte_dist(gen));
+    }
+    const auto data = reinterpret_cast<const uint8_t*>(s.data());
+    const auto length = static_cast<int64_t>(s.size());
+    ASSERT_EQ(internal::ValidateUTF8Inline(data, length), ValidateUTF8(data, length))
+        << HexEncode(data, static_cast<int32_t>(length));
+  }
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
@@ -200,7 +200,7 @@ struct ArrayDataVisitor<T, enable_if_base_binary<T>> {
     if (!arr.buffers[2]) {
       data = &empty_value;
     } else {
-      data = arr.GetValues<uint8_t>(2);
+      data = arr.GetValues<uint8_t>(2, /*absolute_offset=*/0);
     }
 
     if (arr.null_count != 0) {
@@ -234,7 +234,7 @@ struct ArrayDataVisitor<T, enable_if_fixed_size_binary<T>> {
     const auto& fw_type = internal::checked_cast<const FixedSizeBinaryType&>(*arr.type);
 
     const int32_t byte_width = fw_type.byte_width();
-    const uint8_t* data = arr.GetValues<uint8_t>(1);
+    const uint8_t* data = arr.GetValues<uint8_t>(1, arr.offset * byte_width);
 
     if (arr.null_count != 0) {
       internal::BitmapReader valid_reader(arr.buffers[0]->data(), arr.offset, arr.length);
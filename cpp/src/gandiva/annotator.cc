@@ -42,6 +42,12 @@ FieldDescriptorPtr Annotator::AddOutputFieldDescriptor(FieldPtr field) {
   return desc;
 }
 
+FieldDescriptorPtr Annotator::AddIntermediateFieldDescriptor(FieldPtr field) {
+  auto desc = CheckAndAddInputFieldDescriptor(field);
+  intermediate_descs_.push_back(desc);
+  return desc;
+}
+
 FieldDescriptorPtr Annotator::MakeDesc(FieldPtr field, bool is_output) {
   int data_idx = buffer_count_++;
   int validity_idx = buffer_count_++;
@@ -59,26 +65,35 @@ FieldDescriptorPtr Annotator::MakeDesc(FieldPtr field, bool is_output) {
 
 void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
                                        const arrow::ArrayData& array_data,
-                                       EvalBatch* eval_batch, bool is_output) {
+                                       EvalBatch* eval_batch, bool is_output,
+                                       int64_t offset) {
+  DCHECK_EQ(offset % 8, 0);
   int buffer_idx = 0;
 
   // The validity buffer is optional. Use nullptr if it does not have one.
   if (array_data.buffers[buffer_idx]) {
     uint8_t* validity_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-    eval_batch->SetBuffer(desc.validity_idx(), validity_buf);
+    eval_batch->SetBuffer(desc.validity_idx(), validity_buf + offset / 8);
   } else {
     eval_batch->SetBuffer(desc.validity_idx(), nullptr);
   }
   ++buffer_idx;
 
+  // Offsets keep pointing into the whole data buffer of var-len vectors, while
+  // fixed-width data is advanced along with the validity.
+  int64_t data_offset = 0;
   if (desc.HasOffsetsIdx()) {
     uint8_t* offsets_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-    eval_batch->SetBuffer(desc.offsets_idx(), offsets_buf);
+    eval_batch->SetBuffer(desc.offsets_idx(),
+                          offsets_buf + offset * static_cast<int64_t>(sizeof(int32_t)));
     ++buffer_idx;
+  } else if (offset > 0) {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*array_data.type);
+    data_offset = offset * fw_type.bit_width() / 8;
   }
 
   uint8_t* data_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-  eval_batch->SetBuffer(desc.data_idx(), data_buf);
+  eval_batch->SetBuffer(desc.data_idx(), data_buf + data_offset);
   if (is_output) {
     // pass in the Buffer object for output data buffers. Can be used for resizing.
     uint8_t* data_buf_ptr =
@@ -89,8 +104,21 @@ void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
 
 EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                          const ArrayDataVector& out_vector) {
-  EvalBatchPtr eval_batch = std::make_shared<EvalBatch>(
-      record_batch.num_rows(), buffer_count_, local_bitmap_count_);
+  return PrepareEvalBatch(record_batch, out_vector, 0, record_batch.num_rows());
+}
+
+EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                         const ArrayDataVector& out_vector,
+                                         int64_t offset, int64_t length) {
+  return PrepareEvalBatch(record_batch, out_vector, offset, length, {});
+}
+
+EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                         const ArrayDataVector& out_vector,
+                                         int64_t offset, int64_t length,
+                                         const ArrayDataVector& intermediates) {
+  EvalBatchPtr eval_batch =
+      std::make_shared<EvalBatch>(length, buffer_count_, local_bitmap_count_);
 
   // Fill in the entries for the input fields.
   for (int i = 0; i < record_batch.num_columns(); ++i) {
@@ -102,6 +130,12 @@ EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
     }
 
     PrepareBuffersForField(*(found->second), *(record_batch.column(i))->data(),
+                           eval_batch.get(), false /*is_output*/, offset);
+  }
+
+  // Fill in the entries for the intermediate fields.
+  for (size_t i = 0; i < intermediates.size(); ++i) {
+    PrepareBuffersForField(*intermediate_descs_.at(i), *intermediates[i],
                            eval_batch.get(), false /*is_output*/);
   }
 
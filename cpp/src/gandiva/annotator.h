@@ -44,6 +44,11 @@ class GANDIVA_EXPORT Annotator {
   /// Add an annotated field descriptor for an output field.
   FieldDescriptorPtr AddOutputFieldDescriptor(FieldPtr field);
 
+  /// Add an annotated field descriptor for an intermediate field, which the
+  /// expressions read like an input field but that is bound to vectors given
+  /// at evaluation instead of the columns of the record batch.
+  FieldDescriptorPtr AddIntermediateFieldDescriptor(FieldPtr field);
+
   /// Add a local bitmap (for saving validity bits of an intermediate node).
   /// Returns the index of the bitmap in the list of local bitmaps.
   int AddLocalBitMap() { return local_bitmap_count_++; }
@@ -52,15 +57,31 @@ class GANDIVA_EXPORT Annotator {
   EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                 const ArrayDataVector& out_vector);
 
+  /// Prepare an eval batch for the rows [offset, offset + length) of the incoming
+  /// record batch. The offset must be a multiple of 8, so that bitmaps start on a
+  /// byte boundary. The output arrays only hold the rows of the range.
+  EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                const ArrayDataVector& out_vector, int64_t offset,
+                                int64_t length);
+
+  /// Prepare an eval batch for the rows [offset, offset + length) of the incoming
+  /// record batch, with the intermediate fields bound to 'intermediates' in the
+  /// order they were added. The intermediate arrays only hold the rows of the
+  /// range.
+  EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                const ArrayDataVector& out_vector, int64_t offset,
+                                int64_t length, const ArrayDataVector& intermediates);
+
  private:
   /// Annotate a field and return the descriptor.
   FieldDescriptorPtr MakeDesc(FieldPtr field, bool is_output);
 
   /// Populate eval_batch by extracting the raw buffers from the arrow array, whose
-  /// contents are represent by the annotated descriptor 'desc'.
+  /// contents are represent by the annotated descriptor 'desc'. The buffers are
+  /// advanced to the slot at 'offset'.
   void PrepareBuffersForField(const FieldDescriptor& desc,
                               const arrow::ArrayData& array_data, EvalBatch* eval_batch,
-                              bool is_output);
+                              bool is_output, int64_t offset = 0);
 
   /// The list of input/output buffers (includes bitmap buffers, value buffers and
   /// offset buffers).
@@ -75,6 +96,9 @@ class GANDIVA_EXPORT Annotator {
 
   /// vector of annotated output field descriptors.
   std::vector<FieldDescriptorPtr> out_descs_;
+
+  /// vector of annotated intermediate field descriptors.
+  std::vector<FieldDescriptorPtr> intermediate_descs_;
 };
 
 }  // namespace gandiva
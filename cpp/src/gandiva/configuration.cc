@@ -25,11 +25,18 @@ const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration
     InitDefaultConfig();
 
 std::size_t Configuration::Hash() const {
-  return 0;  // dummy for now, no configuration properties yet
+  static const size_t kHashSeed = 0;
+  size_t result = kHashSeed;
+  boost::hash_combine(result, object_cache_dir_);
+  boost::hash_combine(result, use_threads_);
+  boost::hash_combine(result, optimize_in_background_);
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return true;  // always true, no configuration properties yet
+  return object_cache_dir_ == other.object_cache_dir_ &&
+         use_threads_ == other.use_threads_ &&
+         optimize_in_background_ == other.optimize_in_background_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
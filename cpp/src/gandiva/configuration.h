@@ -38,6 +38,20 @@ class GANDIVA_EXPORT Configuration {
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
   bool operator!=(const Configuration& other) const;
+
+  /// Directory of the persistent object code cache, empty if disabled
+  const std::string& object_cache_dir() const { return object_cache_dir_; }
+
+  /// Whether projectors evaluate large batches on the CPU thread pool
+  bool use_threads() const { return use_threads_; }
+
+  /// Whether projectors and filters are first built without optimisation
+  bool optimize_in_background() const { return optimize_in_background_; }
+
+ private:
+  std::string object_cache_dir_;
+  bool use_threads_ = false;
+  bool optimize_in_background_ = false;
 };
 
 /// \brief configuration builder for gandiva
@@ -47,10 +61,37 @@ class GANDIVA_EXPORT Configuration {
 class GANDIVA_EXPORT ConfigurationBuilder {
  public:
   std::shared_ptr<Configuration> build() {
-    std::shared_ptr<Configuration> configuration(new Configuration());
+    std::shared_ptr<Configuration> configuration(new Configuration(configuration_));
     return configuration;
   }
 
+  /// \brief Cache the object code of projectors and filters in the given
+  /// directory, which must exist.
+  ///
+  /// Processes sharing the directory then skip optimising and compiling the
+  /// expressions already compiled by any of them.
+  ConfigurationBuilder& set_object_cache_dir(const std::string& object_cache_dir) {
+    configuration_.object_cache_dir_ = object_cache_dir;
+    return *this;
+  }
+
+  /// \brief Split large batches into row ranges evaluated in parallel by
+  /// projectors, on the CPU thread pool. Off by default.
+  ConfigurationBuilder& set_use_threads(bool use_threads) {
+    configuration_.use_threads_ = use_threads;
+    return *this;
+  }
+
+  /// \brief Build projectors and filters without optimising their code, and
+  /// switch them to optimised code compiled on the CPU thread pool once ready.
+  ///
+  /// Make() then returns sooner, at the cost of slower evaluation of the first
+  /// batches, which suits one-off expressions. Off by default.
+  ConfigurationBuilder& set_optimize_in_background(bool optimize_in_background) {
+    configuration_.optimize_in_background_ = optimize_in_background;
+    return *this;
+  }
+
   static std::shared_ptr<Configuration> DefaultConfiguration() {
     return default_configuration_;
   }
@@ -61,6 +102,8 @@ class GANDIVA_EXPORT ConfigurationBuilder {
     return configuration;
   }
 
+  Configuration configuration_;
+
   static const std::shared_ptr<Configuration> default_configuration_;
 };
 
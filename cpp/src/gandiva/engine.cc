@@ -92,9 +92,15 @@ void Engine::InitOnce() {
 /// factory method to construct the engine.
 Status Engine::Make(std::shared_ptr<Configuration> config,
                     std::unique_ptr<Engine>* engine) {
+  return Make(config, true /*optimize*/, engine);
+}
+
+Status Engine::Make(std::shared_ptr<Configuration> config, bool optimize,
+                    std::unique_ptr<Engine>* engine) {
   std::unique_ptr<Engine> engine_obj(new Engine());
 
   std::call_once(init_once_flag, [&engine_obj] { engine_obj->InitOnce(); });
+  engine_obj->config_ = config;
   engine_obj->context_.reset(new llvm::LLVMContext());
   engine_obj->ir_builder_.reset(new llvm::IRBuilder<>(*(engine_obj->context())));
   engine_obj->types_.reset(new LLVMTypes(*(engine_obj->context())));
@@ -106,7 +112,8 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
 
   llvm::EngineBuilder engineBuilder(std::move(cg_module));
   engineBuilder.setEngineKind(llvm::EngineKind::JIT);
-  engineBuilder.setOptLevel(llvm::CodeGenOpt::Aggressive);
+  engineBuilder.setOptLevel(optimize ? llvm::CodeGenOpt::Aggressive
+                                     : llvm::CodeGenOpt::None);
   engineBuilder.setErrorStr(&(engine_obj->llvm_error_));
   engine_obj->execution_engine_.reset(engineBuilder.create());
   if (engine_obj->execution_engine_ == NULL) {
@@ -188,6 +195,15 @@ Status Engine::RemoveUnusedFunctions() {
   return Status::OK();
 }
 
+void Engine::SetObjectCacheKey(std::size_t hash, const std::string& key) {
+  DCHECK(!module_finalized_);
+  if (config_->object_cache_dir().empty()) {
+    return;
+  }
+  object_cache_.reset(new ObjectCache(config_->object_cache_dir(), hash, key));
+  execution_engine_->setObjectCache(object_cache_.get());
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
   auto status = RemoveUnusedFunctions();
@@ -197,7 +213,10 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
     DumpIR("Before optimise");
   }
 
-  if (optimise_ir) {
+  // The execution engine loads cached object code in place of compiling the
+  // module, so optimising it would be wasted
+  const bool cached = object_cache_ != nullptr && object_cache_->HasObject();
+  if (optimise_ir && !cached) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
@@ -30,6 +30,7 @@
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/logging.h"
+#include "gandiva/object_cache.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
@@ -51,6 +52,15 @@ class GANDIVA_EXPORT Engine {
   static Status Make(std::shared_ptr<Configuration> config,
                      std::unique_ptr<Engine>* engine);
 
+  /// Factory method to create and initialize the engine object.
+  ///
+  /// \param[in] config the engine configuration
+  /// \param[in] optimize whether to generate optimised machine code, which takes
+  ///            longer to compile
+  /// \param[out] engine the created engine
+  static Status Make(std::shared_ptr<Configuration> config, bool optimize,
+                     std::unique_ptr<Engine>* engine);
+
   /// Add the function to the list of IR functions that need to be compiled.
   /// Compiling only the functions that are used by the module saves time.
   void AddFunctionToCompile(const std::string& fname) {
@@ -58,7 +68,14 @@ class GANDIVA_EXPORT Engine {
     functions_to_compile_.push_back(fname);
   }
 
-  /// Optimise and compile the module.
+  /// Look up the object code of the module in the persistent cache of the
+  /// configuration, if any, and store it there once compiled.
+  ///
+  /// \param[in] hash the hash of the projector or filter cache key
+  /// \param[in] key the text of the projector or filter cache key
+  void SetObjectCacheKey(std::size_t hash, const std::string& key);
+
+  /// Optimise and compile the module, unless its object code is cached.
   Status FinalizeModule(bool optimise_ir, bool dump_ir);
 
   /// Get the compiled function corresponding to the irfunction.
@@ -92,7 +109,10 @@ class GANDIVA_EXPORT Engine {
   /// dump the IR code to stdout with the prefix string.
   void DumpIR(std::string prefix);
 
+  std::shared_ptr<Configuration> config_;
   std::unique_ptr<llvm::LLVMContext> context_;
+  // Declared before the execution engine, which refers to it
+  std::unique_ptr<ObjectCache> object_cache_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
   std::unique_ptr<LLVMTypes> types_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -0,0 +1,284 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/expr_optimizer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "gandiva/node.h"
+
+namespace gandiva {
+
+namespace {
+
+NodePtr MakeBooleanLiteral(bool value) {
+  return std::make_shared<LiteralNode>(arrow::boolean(), LiteralHolder(value), false);
+}
+
+// Whether the node is a non-null boolean literal, and its value
+bool GetBooleanLiteral(const Node& node, bool* value) {
+  auto literal = dynamic_cast<const LiteralNode*>(&node);
+  if (literal == nullptr || literal->is_null() ||
+      literal->return_type()->id() != arrow::Type::BOOL) {
+    return false;
+  }
+  *value = arrow::util::get<bool>(literal->holder());
+  return true;
+}
+
+template <typename Type>
+const InExpressionNode<Type>* AsInNode(const Node& node) {
+  return dynamic_cast<const InExpressionNode<Type>*>(&node);
+}
+
+// The evaluated child of an in node, or null for other nodes
+const NodePtr* GetInEvalExpr(const Node& node) {
+  if (auto in = AsInNode<int32_t>(node)) return &in->eval_expr();
+  if (auto in = AsInNode<int64_t>(node)) return &in->eval_expr();
+  if (auto in = AsInNode<std::string>(node)) return &in->eval_expr();
+  return nullptr;
+}
+
+// The in node with another evaluated child
+NodePtr WithInEvalExpr(const Node& node, NodePtr eval_expr) {
+  if (auto in = AsInNode<int32_t>(node)) {
+    return std::make_shared<InExpressionNode<int32_t>>(eval_expr, in->values());
+  }
+  if (auto in = AsInNode<int64_t>(node)) {
+    return std::make_shared<InExpressionNode<int64_t>>(eval_expr, in->values());
+  }
+  auto in = AsInNode<std::string>(node);
+  return std::make_shared<InExpressionNode<std::string>>(eval_expr, in->values());
+}
+
+bool IsSupportedIntermediateType(const arrow::DataType& type) {
+  return arrow::is_primitive(type.id()) || type.id() == arrow::Type::DECIMAL ||
+         arrow::is_binary_like(type.id());
+}
+
+}  // namespace
+
+ExpressionPtr ExprOptimizer::Simplify(const ExpressionPtr& expr) {
+  auto root = SimplifyNode(expr->root());
+  if (root == expr->root()) {
+    return expr;
+  }
+  return std::make_shared<Expression>(root, expr->result());
+}
+
+NodePtr ExprOptimizer::SimplifyNode(const NodePtr& node) {
+  if (auto function = dynamic_cast<const FunctionNode*>(node.get())) {
+    NodeVector children;
+    bool changed = false;
+    for (auto& child : function->children()) {
+      children.push_back(SimplifyNode(child));
+      changed = changed || children.back() != child;
+    }
+
+    const std::string& name = function->descriptor()->name();
+    if (children.size() == 1) {
+      auto literal = dynamic_cast<const LiteralNode*>(children[0].get());
+      bool value;
+      if (name == "not" && GetBooleanLiteral(*children[0], &value)) {
+        return MakeBooleanLiteral(!value);
+      } else if (name == "isnull" && literal != nullptr) {
+        return MakeBooleanLiteral(literal->is_null());
+      } else if (name == "isnotnull" && literal != nullptr) {
+        return MakeBooleanLiteral(!literal->is_null());
+      }
+    }
+    if (!changed) {
+      return node;
+    }
+    return std::make_shared<FunctionNode>(name, children, function->return_type());
+  }
+
+  if (auto if_node = dynamic_cast<const IfNode*>(node.get())) {
+    auto condition = SimplifyNode(if_node->condition());
+    auto then_node = SimplifyNode(if_node->then_node());
+    auto else_node = SimplifyNode(if_node->else_node());
+    // A null condition selects the else branch, as for any non-true one
+    auto literal = dynamic_cast<const LiteralNode*>(condition.get());
+    if (literal != nullptr) {
+      bool value;
+      return GetBooleanLiteral(*literal, &value) && value ? then_node : else_node;
+    }
+    if (condition == if_node->condition() && then_node == if_node->then_node() &&
+        else_node == if_node->else_node()) {
+      return node;
+    }
+    return std::make_shared<IfNode>(condition, then_node, else_node,
+                                    if_node->return_type());
+  }
+
+  if (auto boolean = dynamic_cast<const BooleanNode*>(node.get())) {
+    // true is the identity of and, and false absorbs it; the converse for or.
+    // Null literals are kept, as they may still make the result null.
+    const bool identity = boolean->expr_type() == BooleanNode::AND;
+    NodeVector children;
+    bool changed = false;
+    for (auto& child : boolean->children()) {
+      auto simplified = SimplifyNode(child);
+      changed = changed || simplified != child;
+      bool value;
+      if (GetBooleanLiteral(*simplified, &value)) {
+        if (value != identity) {
+          return MakeBooleanLiteral(value);
+        }
+        changed = true;
+        continue;
+      }
+      children.push_back(simplified);
+    }
+    if (children.empty()) {
+      return MakeBooleanLiteral(identity);
+    } else if (children.size() == 1) {
+      return children[0];
+    } else if (!changed) {
+      return node;
+    }
+    return std::make_shared<BooleanNode>(boolean->expr_type(), children);
+  }
+
+  if (auto eval_expr = GetInEvalExpr(*node)) {
+    auto simplified = SimplifyNode(*eval_expr);
+    return simplified == *eval_expr ? node : WithInEvalExpr(*node, simplified);
+  }
+
+  // Fields and literals
+  return node;
+}
+
+bool ExprOptimizer::IsHoistable(const Node& node, std::string* key) const {
+  auto function = dynamic_cast<const FunctionNode*>(&node);
+  if (function == nullptr || !IsSupportedIntermediateType(*node.return_type())) {
+    return false;
+  }
+  const std::string& name = function->descriptor()->name();
+  if (name == "random" || name == "rand") {
+    return false;
+  }
+  bool nested = false;
+  for (auto& child : function->children()) {
+    nested = nested || (dynamic_cast<const LiteralNode*>(child.get()) == nullptr &&
+                        dynamic_cast<const FieldNode*>(child.get()) == nullptr);
+  }
+  if (!nested) {
+    return false;
+  }
+  *key = node.ToString();
+  return true;
+}
+
+void ExprOptimizer::CountSubexpressions(const NodePtr& node) {
+  std::string key;
+  if (IsHoistable(*node, &key)) {
+    ++subexpression_counts_[key];
+  }
+  // Function arguments and the values tested by in nodes are always evaluated,
+  // unlike the branches of if and and/or nodes
+  if (auto function = dynamic_cast<const FunctionNode*>(node.get())) {
+    for (auto& child : function->children()) {
+      CountSubexpressions(child);
+    }
+  } else if (auto eval_expr = GetInEvalExpr(*node)) {
+    CountSubexpressions(*eval_expr);
+  }
+}
+
+NodePtr ExprOptimizer::RewriteSubexpressions(const NodePtr& node,
+                                             ExpressionVector* common_exprs) {
+  std::string key;
+  if (IsHoistable(*node, &key) && subexpression_counts_[key] > 1) {
+    auto found = intermediate_fields_.find(key);
+    if (found == intermediate_fields_.end()) {
+      std::string name = "__gandiva_cse_" + std::to_string(common_exprs->size());
+      while (field_names_.count(name) > 0) {
+        name += "_";
+      }
+      auto field = arrow::field(name, node->return_type());
+      common_exprs->push_back(std::make_shared<Expression>(node, field));
+      found = intermediate_fields_.emplace(key, field).first;
+    }
+    return std::make_shared<FieldNode>(found->second);
+  }
+
+  if (auto function = dynamic_cast<const FunctionNode*>(node.get())) {
+    NodeVector children;
+    bool changed = false;
+    for (auto& child : function->children()) {
+      children.push_back(RewriteSubexpressions(child, common_exprs));
+      changed = changed || children.back() != child;
+    }
+    if (!changed) {
+      return node;
+    }
+    return std::make_shared<FunctionNode>(function->descriptor()->name(), children,
+                                          function->return_type());
+  }
+  if (auto eval_expr = GetInEvalExpr(*node)) {
+    auto rewritten = RewriteSubexpressions(*eval_expr, common_exprs);
+    return rewritten == *eval_expr ? node : WithInEvalExpr(*node, rewritten);
+  }
+  return node;
+}
+
+void ExprOptimizer::CollectFieldNames(const NodePtr& node) {
+  if (auto field = dynamic_cast<const FieldNode*>(node.get())) {
+    field_names_.insert(field->field()->name());
+  } else if (auto function = dynamic_cast<const FunctionNode*>(node.get())) {
+    for (auto& child : function->children()) {
+      CollectFieldNames(child);
+    }
+  } else if (auto if_node = dynamic_cast<const IfNode*>(node.get())) {
+    CollectFieldNames(if_node->condition());
+    CollectFieldNames(if_node->then_node());
+    CollectFieldNames(if_node->else_node());
+  } else if (auto boolean = dynamic_cast<const BooleanNode*>(node.get())) {
+    for (auto& child : boolean->children()) {
+      CollectFieldNames(child);
+    }
+  } else if (auto eval_expr = GetInEvalExpr(*node)) {
+    CollectFieldNames(*eval_expr);
+  }
+}
+
+void ExprOptimizer::ExtractCommonSubexpressions(const ExpressionVector& exprs,
+                                                ExpressionVector* common_exprs,
+                                                ExpressionVector* rewritten) {
+  subexpression_counts_.clear();
+  intermediate_fields_.clear();
+  field_names_.clear();
+  for (auto& expr : exprs) {
+    CountSubexpressions(expr->root());
+    CollectFieldNames(expr->root());
+  }
+
+  common_exprs->clear();
+  ExpressionVector result;
+  for (auto& expr : exprs) {
+    auto root = RewriteSubexpressions(expr->root(), common_exprs);
+    result.push_back(root == expr->root()
+                         ? expr
+                         : std::make_shared<Expression>(root, expr->result()));
+  }
+  *rewritten = std::move(result);
+}
+
+}  // namespace gandiva
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_EXPR_OPTIMIZER_H
+#define GANDIVA_EXPR_OPTIMIZER_H
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "gandiva/arrow.h"
+#include "gandiva/expression.h"
+#include "gandiva/gandiva_aliases.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Rewrites expression trees before code generation.
+class GANDIVA_EXPORT ExprOptimizer {
+ public:
+  /// \brief Fold the nodes whose outcome is known from literals: and/or nodes
+  /// with literal children, if nodes with a literal condition, and not, isnull
+  /// and isnotnull of literals. Returns the expression itself if unchanged.
+  ExpressionPtr Simplify(const ExpressionPtr& expr);
+
+  /// \brief Hoist the function subtrees occurring more than once across the
+  /// expressions into common expressions, which compute intermediate fields
+  /// that the rewritten expressions refer to.
+  ///
+  /// Only the subtrees evaluated for every row are hoisted, i.e. those not
+  /// below if or and/or nodes, so that evaluating them up front yields the
+  /// same errors. Subtrees calling a single function on fields and literals are
+  /// left as they are, as well as random functions.
+  ///
+  /// \param[in] exprs the expressions
+  /// \param[out] common_exprs the expressions computing the intermediate fields
+  /// \param[out] rewritten the expressions, reading the intermediate fields
+  void ExtractCommonSubexpressions(const ExpressionVector& exprs,
+                                   ExpressionVector* common_exprs,
+                                   ExpressionVector* rewritten);
+
+ private:
+  NodePtr SimplifyNode(const NodePtr& node);
+
+  void CountSubexpressions(const NodePtr& node);
+  NodePtr RewriteSubexpressions(const NodePtr& node, ExpressionVector* common_exprs);
+  void CollectFieldNames(const NodePtr& node);
+
+  // Whether a function subtree may be hoisted, with its text as key
+  bool IsHoistable(const Node& node, std::string* key) const;
+
+  std::unordered_map<std::string, int> subexpression_counts_;
+  std::unordered_map<std::string, FieldPtr> intermediate_fields_;
+  std::unordered_set<std::string> field_names_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_EXPR_OPTIMIZER_H
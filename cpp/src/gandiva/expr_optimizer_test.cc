@@ -0,0 +1,176 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/expr_optimizer.h"
+
+#include <gtest/gtest.h>
+#include "gandiva/node.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::int32;
+using arrow::utf8;
+
+class TestExprOptimizer : public ::testing::Test {
+ protected:
+  void SetUp() {
+    field_a_ = arrow::field("a", int32());
+    field_b_ = arrow::field("b", int32());
+    field_s_ = arrow::field("s", utf8());
+    result_ = arrow::field("res", int32());
+  }
+
+  NodePtr Less(const FieldPtr& field, int32_t value) {
+    return TreeExprBuilder::MakeFunction(
+        "less_than",
+        {TreeExprBuilder::MakeField(field), TreeExprBuilder::MakeLiteral(value)},
+        boolean());
+  }
+
+  FieldPtr field_a_;
+  FieldPtr field_b_;
+  FieldPtr field_s_;
+  FieldPtr result_;
+  ExprOptimizer optimizer_;
+};
+
+TEST_F(TestExprOptimizer, SimplifyBoolean) {
+  auto less_a = Less(field_a_, 5);
+  auto less_b = Less(field_b_, 5);
+  auto bool_result = arrow::field("res", boolean());
+
+  // a < 5 && true && b < 5 -> (a < 5 && b < 5)
+  auto expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeAnd({less_a, TreeExprBuilder::MakeLiteral(true), less_b}),
+      bool_result);
+  auto simplified = optimizer_.Simplify(expr);
+  EXPECT_EQ(simplified->root()->ToString(),
+            TreeExprBuilder::MakeAnd({less_a, less_b})->ToString());
+
+  // a < 5 && false -> false
+  expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeAnd({less_a, TreeExprBuilder::MakeLiteral(false)}),
+      bool_result);
+  simplified = optimizer_.Simplify(expr);
+  EXPECT_EQ(simplified->root()->ToString(),
+            TreeExprBuilder::MakeLiteral(false)->ToString());
+
+  // a < 5 || false -> a < 5
+  expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeOr({less_a, TreeExprBuilder::MakeLiteral(false)}),
+      bool_result);
+  simplified = optimizer_.Simplify(expr);
+  EXPECT_EQ(simplified->root(), less_a);
+
+  // a < 5 || not(false) -> true
+  expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeOr(
+          {less_a, TreeExprBuilder::MakeFunction(
+                       "not", {TreeExprBuilder::MakeLiteral(false)}, boolean())}),
+      bool_result);
+  simplified = optimizer_.Simplify(expr);
+  EXPECT_EQ(simplified->root()->ToString(),
+            TreeExprBuilder::MakeLiteral(true)->ToString());
+
+  // a null literal may make the result null, so it is kept
+  expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeAnd({less_a, TreeExprBuilder::MakeNull(boolean())}),
+      bool_result);
+  simplified = optimizer_.Simplify(expr);
+  EXPECT_EQ(simplified, expr);
+}
+
+TEST_F(TestExprOptimizer, SimplifyIf) {
+  auto node_a = TreeExprBuilder::MakeField(field_a_);
+  auto node_b = TreeExprBuilder::MakeField(field_b_);
+
+  // if (isnull(null)) a else b -> a
+  auto condition = TreeExprBuilder::MakeFunction(
+      "isnull", {TreeExprBuilder::MakeNull(int32())}, boolean());
+  auto expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeIf(condition, node_a, node_b, int32()), result_);
+  EXPECT_EQ(optimizer_.Simplify(expr)->root(), node_a);
+
+  // if (null) a else b -> b
+  expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeIf(TreeExprBuilder::MakeNull(boolean()), node_a, node_b,
+                              int32()),
+      result_);
+  EXPECT_EQ(optimizer_.Simplify(expr)->root(), node_b);
+
+  // if (a < 5) a else b is left as is
+  expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeIf(Less(field_a_, 5), node_a, node_b, int32()), result_);
+  EXPECT_EQ(optimizer_.Simplify(expr), expr);
+}
+
+TEST_F(TestExprOptimizer, ExtractCommonSubexpressions) {
+  auto node_a = TreeExprBuilder::MakeField(field_a_);
+  auto node_b = TreeExprBuilder::MakeField(field_b_);
+  auto sum = TreeExprBuilder::MakeFunction("add", {node_a, node_b}, int32());
+  auto product = TreeExprBuilder::MakeFunction("multiply", {sum, sum}, int32());
+
+  // (a + b) * (a + b) and ((a + b) * (a + b)) - a share the product, and
+  // a + b is too simple to be hoisted on its own.
+  auto expr0 = TreeExprBuilder::MakeExpression(product, result_);
+  auto expr1 = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("subtract", {product, node_a}, int32()),
+      arrow::field("res1", int32()));
+  // Subtrees below if nodes are not always evaluated, so not hoisted
+  auto expr2 = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeIf(Less(field_a_, 5), product, node_b, int32()),
+      arrow::field("res2", int32()));
+
+  ExpressionVector common_exprs;
+  ExpressionVector rewritten;
+  optimizer_.ExtractCommonSubexpressions({expr0, expr1, expr2}, &common_exprs,
+                                         &rewritten);
+  ASSERT_EQ(common_exprs.size(), 1);
+  EXPECT_EQ(common_exprs[0]->root(), product);
+  auto intermediate = common_exprs[0]->result();
+  EXPECT_TRUE(intermediate->type()->Equals(int32()));
+
+  ASSERT_EQ(rewritten.size(), 3);
+  auto node_intermediate = TreeExprBuilder::MakeField(intermediate);
+  EXPECT_EQ(rewritten[0]->root()->ToString(), node_intermediate->ToString());
+  EXPECT_EQ(rewritten[0]->result(), result_);
+  EXPECT_EQ(rewritten[1]->root()->ToString(),
+            TreeExprBuilder::MakeFunction("subtract", {node_intermediate, node_a},
+                                          int32())
+                ->ToString());
+  EXPECT_EQ(rewritten[2], expr2);
+}
+
+TEST_F(TestExprOptimizer, NoCommonSubexpressions) {
+  auto upper = TreeExprBuilder::MakeFunction(
+      "upper", {TreeExprBuilder::MakeField(field_s_)}, utf8());
+  auto expr0 = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("octet_length", {upper}, int32()), result_);
+  auto expr1 = TreeExprBuilder::MakeExpression(upper, arrow::field("res1", utf8()));
+
+  ExpressionVector common_exprs;
+  ExpressionVector rewritten;
+  optimizer_.ExtractCommonSubexpressions({expr0, expr1}, &common_exprs, &rewritten);
+  EXPECT_TRUE(common_exprs.empty());
+  ASSERT_EQ(rewritten.size(), 2);
+  EXPECT_EQ(rewritten[0], expr0);
+  EXPECT_EQ(rewritten[1], expr1);
+}
+
+}  // namespace gandiva
@@ -21,6 +21,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bit_util.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/cache.h"
 #include "gandiva/condition.h"
@@ -39,6 +41,11 @@ Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
 
 Filter::~Filter() {}
 
+void Filter::SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator) {
+  std::shared_ptr<LLVMGenerator> generator = std::move(llvm_generator);
+  std::atomic_store(&llvm_generator_, generator);
+}
+
 Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
                     std::shared_ptr<Configuration> configuration,
                     std::shared_ptr<Filter>* filter) {
@@ -57,35 +64,46 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
   // Build LLVM generator, and generate code for the specified expression
   std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+  const bool optimize_in_background = configuration->optimize_in_background();
+  ARROW_RETURN_NOT_OK(
+      LLVMGenerator::Make(configuration, !optimize_in_background, &llvm_gen));
 
   // Run the validation on the expression.
   // Return if the expression is invalid since we will not be able to process further.
   ExprValidator expr_validator(llvm_gen->types(), schema);
   ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+  // Only optimised code goes to the persistent cache
+  if (!optimize_in_background) {
+    llvm_gen->SetObjectCacheKey(cache_key.Hash(), cache_key.ToString());
+  }
   ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}, SelectionVector::Mode::MODE_NONE));
 
   // Instantiate the filter with the completely built llvm generator
   *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
   cache.PutModule(cache_key, *filter);
 
+  if (optimize_in_background) {
+    std::weak_ptr<Filter> weak_filter = *filter;
+    LLVMGenerator::BuildInBackground(
+        configuration, {condition}, SelectionVector::Mode::MODE_NONE, cache_key.Hash(),
+        cache_key.ToString(), [weak_filter](std::unique_ptr<LLVMGenerator> generator) {
+          auto filter = weak_filter.lock();
+          if (filter != nullptr) {
+            filter->SetLLVMGenerator(std::move(generator));
+          }
+        });
+  }
   return Status::OK();
 }
 
-Status Filter::Evaluate(const arrow::RecordBatch& batch,
-                        std::shared_ptr<SelectionVector> out_selection) {
+Status Filter::EvaluateBitMap(const arrow::RecordBatch& batch, uint8_t* result) {
   const auto num_rows = batch.num_rows();
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("RecordBatch schema must expected filter schema"));
   ARROW_RETURN_IF(num_rows == 0, Status::Invalid("RecordBatch must be non-empty."));
-  ARROW_RETURN_IF(out_selection == nullptr,
-                  Status::Invalid("out_selection must be non-null."));
-  ARROW_RETURN_IF(out_selection->GetMaxSlots() < num_rows,
-                  Status::Invalid("Output selection vector capacity too small"));
 
-  // Allocate three local_bitmaps (one for output, one for validity, one to compute the
-  // intersection).
-  LocalBitMapsHolder bitmaps(num_rows, 3 /*local_bitmaps*/);
+  // Allocate two local_bitmaps (one for output, one for validity).
+  LocalBitMapsHolder bitmaps(num_rows, 2 /*local_bitmaps*/);
   int64_t bitmap_size = bitmaps.GetLocalBitMapSize();
 
   auto validity = std::make_shared<arrow::Buffer>(bitmaps.GetLocalBitMap(0), bitmap_size);
@@ -93,14 +111,47 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  auto llvm_generator = std::atomic_load(&llvm_generator_);
+  ARROW_RETURN_NOT_OK(llvm_generator->Execute(batch, {array_data}));
 
   // Compute the intersection of the value and validity.
-  auto result = bitmaps.GetLocalBitMap(2);
   BitMapAccumulator::IntersectBitMaps(
       result, {bitmaps.GetLocalBitMap(0), bitmaps.GetLocalBitMap((1))}, num_rows);
+  return Status::OK();
+}
 
-  return out_selection->PopulateFromBitMap(result, bitmap_size, num_rows - 1);
+Status Filter::Evaluate(const arrow::RecordBatch& batch,
+                        std::shared_ptr<SelectionVector> out_selection) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_IF(out_selection == nullptr,
+                  Status::Invalid("out_selection must be non-null."));
+  ARROW_RETURN_IF(out_selection->GetMaxSlots() < num_rows,
+                  Status::Invalid("Output selection vector capacity too small"));
+
+  LocalBitMapsHolder bitmaps(num_rows, 1 /*local_bitmaps*/);
+  auto result = bitmaps.GetLocalBitMap(0);
+  ARROW_RETURN_NOT_OK(EvaluateBitMap(batch, result));
+  return out_selection->PopulateFromBitMap(result, bitmaps.GetLocalBitMapSize(),
+                                           num_rows - 1);
+}
+
+Status Filter::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                        std::shared_ptr<arrow::Buffer>* out_bitmap) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_IF(out_bitmap == nullptr, Status::Invalid("out_bitmap must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  // The intersection is computed in 64-bit words, straight into the output
+  const int64_t bitmap_size = arrow::BitUtil::RoundUpToMultipleOf64(num_rows) / 8;
+  std::shared_ptr<arrow::Buffer> bitmap;
+  ARROW_RETURN_NOT_OK(arrow::AllocateBuffer(pool, bitmap_size, &bitmap));
+  uint8_t* result = bitmap->mutable_data();
+  ARROW_RETURN_NOT_OK(EvaluateBitMap(batch, result));
+  for (int64_t i = num_rows; i < bitmap_size * 8; ++i) {
+    arrow::BitUtil::ClearBit(result, i);
+  }
+  *out_bitmap = std::move(bitmap);
+  return Status::OK();
 }
 
 }  // namespace gandiva
@@ -37,7 +37,9 @@ class LLVMGenerator;
 /// \brief filter records based on a condition.
 ///
 /// A filter is built for a specific schema and condition. Once the filter is built, it
-/// can be used to evaluate many row batches.
+/// can be used to evaluate many row batches. With a configuration optimizing in
+/// background, the filter evaluates unoptimised code until the optimised code is
+/// compiled.
 class GANDIVA_EXPORT Filter {
  public:
   Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
@@ -76,8 +78,28 @@ class GANDIVA_EXPORT Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Evaluate the specified record batch, and return a bitmap with the bits of the
+  /// rows that match the condition set. This skips the conversion to indices, for
+  /// consumers that work on bitmaps.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate the bitmap.
+  /// \param[out] out_bitmap the bitmap, of batch.num_rows() bits. The bits past the
+  ///             last row are cleared.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  std::shared_ptr<arrow::Buffer>* out_bitmap);
+
  private:
-  const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  /// Validate the batch, and write the bitmap of the rows that match the condition to
+  /// 'result', which must hold num_rows bits rounded up to a multiple of 64.
+  Status EvaluateBitMap(const arrow::RecordBatch& batch, uint8_t* result);
+
+  /// Switch to another generator for the condition, atomically with respect to
+  /// concurrent evaluations.
+  void SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator);
+
+  /// Accessed atomically, as background optimisation replaces it.
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   const SchemaPtr schema_;
   const std::shared_ptr<Configuration> configuration_;
 };
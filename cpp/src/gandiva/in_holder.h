@@ -18,30 +18,128 @@
 #ifndef GANDIVA_IN_HOLDER_H
 #define GANDIVA_IN_HOLDER_H
 
-#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
+#include "arrow/memory_pool.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/string_view.h"
 #include "gandiva/arrow.h"
 #include "gandiva/gandiva_aliases.h"
 
 namespace gandiva {
 
 /// Function Holder for IN Expressions
+///
+/// The lookup structure depends on the values of the list : a bitmap indexed
+/// from the smallest value when they span a small range, a scan of the values
+/// for short lists, and an open-addressing hash table otherwise.
 template <typename Type>
 class InHolder {
  public:
   explicit InHolder(const std::unordered_set<Type>& values) {
-    values_.max_load_factor(0.25f);
-    for (auto& value : values) {
-      values_.insert(value);
+    std::vector<Type> sorted_values(values.begin(), values.end());
+    std::sort(sorted_values.begin(), sorted_values.end());
+    if (sorted_values.empty()) {
+      return;
     }
+
+    min_value_ = sorted_values.front();
+    const uint64_t range = BitmapIndex(sorted_values.back());
+    if (range < kMaxBitmapBits && range < kBitmapBitsPerValue * sorted_values.size()) {
+      lookup_ = Lookup::BITMAP;
+      bitmap_length_ = range + 1;
+      bitmap_.resize(arrow::BitUtil::BytesForBits(bitmap_length_));
+      for (Type value : sorted_values) {
+        arrow::BitUtil::SetBit(bitmap_.data(), BitmapIndex(value));
+      }
+    } else if (sorted_values.size() <= kMaxScanLength) {
+      lookup_ = Lookup::SCAN;
+      scan_values_ = std::move(sorted_values);
+    } else {
+      lookup_ = Lookup::HASH;
+      memo_table_.reset(new arrow::internal::ScalarMemoTable<Type>(
+          arrow::default_memory_pool(), static_cast<int64_t>(sorted_values.size())));
+      for (Type value : sorted_values) {
+        memo_table_->GetOrInsert(value);
+      }
+    }
+  }
+
+  bool HasValue(Type value) const {
+    switch (lookup_) {
+      case Lookup::BITMAP: {
+        // Values below the minimum wrap around to large indices
+        const uint64_t index = BitmapIndex(value);
+        return index < bitmap_length_ && arrow::BitUtil::GetBit(bitmap_.data(), index);
+      }
+      case Lookup::SCAN: {
+        // Without early exit, so that the loop is vectorized
+        bool found = false;
+        for (Type scan_value : scan_values_) {
+          found |= scan_value == value;
+        }
+        return found;
+      }
+      default:
+        return memo_table_->Get(value) != arrow::internal::kKeyNotFound;
+    }
+  }
+
+ private:
+  enum class Lookup { SCAN, BITMAP, HASH };
+
+  // Lists of at most this many values are scanned
+  static constexpr size_t kMaxScanLength = 16;
+  // A bitmap is used when it takes at most 8 bytes per value, and 1MB
+  static constexpr uint64_t kBitmapBitsPerValue = 64;
+  static constexpr uint64_t kMaxBitmapBits = 8 * 1024 * 1024;
+
+  uint64_t BitmapIndex(Type value) const {
+    return static_cast<uint64_t>(value) - static_cast<uint64_t>(min_value_);
   }
 
-  bool HasValue(Type value) const { return values_.count(value) == 1; }
+  // An empty list has nothing to scan
+  Lookup lookup_ = Lookup::SCAN;
+  std::vector<Type> scan_values_;
+  Type min_value_ = 0;
+  uint64_t bitmap_length_ = 0;
+  std::vector<uint8_t> bitmap_;
+  std::unique_ptr<arrow::internal::ScalarMemoTable<Type>> memo_table_;
+};
+
+/// Function Holder for IN Expressions on strings, keeping the values one after
+/// the other in the buffer of an open-addressing hash table
+template <>
+class InHolder<std::string> {
+ public:
+  explicit InHolder(const std::unordered_set<std::string>& values)
+      : memo_table_(arrow::default_memory_pool(), static_cast<int64_t>(values.size()),
+                    TotalLength(values)) {
+    for (const auto& value : values) {
+      memo_table_.GetOrInsert(value);
+    }
+  }
+
+  bool HasValue(arrow::util::string_view value) const {
+    return memo_table_.Get(value) != arrow::internal::kKeyNotFound;
+  }
 
  private:
-  std::unordered_set<Type> values_;
+  static int64_t TotalLength(const std::unordered_set<std::string>& values) {
+    int64_t length = 0;
+    for (const auto& value : values) {
+      length += static_cast<int64_t>(value.length());
+    }
+    return length;
+  }
+
+  arrow::internal::BinaryMemoTable memo_table_;
 };
 
 }  // namespace gandiva
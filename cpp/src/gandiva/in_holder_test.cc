@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/in_holder.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_set>
+
+#include <gtest/gtest.h>
+
+namespace gandiva {
+
+TEST(TestInHolder, TestEmpty) {
+  InHolder<int32_t> holder(std::unordered_set<int32_t>{});
+  EXPECT_FALSE(holder.HasValue(0));
+  EXPECT_FALSE(holder.HasValue(-1));
+}
+
+TEST(TestInHolder, TestDenseValues) {
+  std::unordered_set<int32_t> values;
+  for (int32_t i = -100; i < 100; i += 3) {
+    values.insert(i);
+  }
+  InHolder<int32_t> holder(values);
+  for (int32_t i = -200; i < 200; ++i) {
+    EXPECT_EQ(holder.HasValue(i), values.count(i) == 1) << i;
+  }
+  EXPECT_FALSE(holder.HasValue(std::numeric_limits<int32_t>::min()));
+  EXPECT_FALSE(holder.HasValue(std::numeric_limits<int32_t>::max()));
+}
+
+TEST(TestInHolder, TestFewSparseValues) {
+  const int64_t kMin = std::numeric_limits<int64_t>::min();
+  const int64_t kMax = std::numeric_limits<int64_t>::max();
+  InHolder<int64_t> holder({kMin, -7, 42, kMax});
+  EXPECT_TRUE(holder.HasValue(kMin));
+  EXPECT_TRUE(holder.HasValue(-7));
+  EXPECT_TRUE(holder.HasValue(42));
+  EXPECT_TRUE(holder.HasValue(kMax));
+  EXPECT_FALSE(holder.HasValue(0));
+  EXPECT_FALSE(holder.HasValue(kMin + 1));
+  EXPECT_FALSE(holder.HasValue(kMax - 1));
+}
+
+TEST(TestInHolder, TestManySparseValues) {
+  std::unordered_set<int64_t> values;
+  for (int64_t i = 0; i < 1000; ++i) {
+    values.insert(i * 1000003 - 500000000);
+  }
+  InHolder<int64_t> holder(values);
+  for (int64_t value : values) {
+    EXPECT_TRUE(holder.HasValue(value)) << value;
+    EXPECT_FALSE(holder.HasValue(value + 1)) << value;
+  }
+}
+
+TEST(TestInHolder, TestStrings) {
+  InHolder<std::string> holder({"", "ab", "abc", std::string("a\0b", 3)});
+  EXPECT_TRUE(holder.HasValue(""));
+  EXPECT_TRUE(holder.HasValue("ab"));
+  EXPECT_TRUE(holder.HasValue("abc"));
+  EXPECT_TRUE(holder.HasValue(arrow::util::string_view("a\0b", 3)));
+  EXPECT_FALSE(holder.HasValue("a"));
+  EXPECT_FALSE(holder.HasValue("abcd"));
+}
+
+}  // namespace gandiva
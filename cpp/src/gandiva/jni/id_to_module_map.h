@@ -20,48 +20,56 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 
 namespace gandiva {
 
+/// Map from the module ids returned to Java to the module holders.
+///
+/// Lookups happen on every evaluation, while modules are rarely built or closed,
+/// so the map is copied on writes and swapped through the atomic shared_ptr
+/// functions. Those aren't lock-free (libstdc++ guards them with a pool of
+/// spinlocks), but a lookup only holds a lock while it copies the pointer, not
+/// while it searches the map, and never waits on a writer building a new map.
 template <typename HOLDER>
 class IdToModuleMap {
  public:
-  IdToModuleMap() : module_id_(kInitModuleId) {}
+  IdToModuleMap() : module_id_(kInitModuleId), map_(std::make_shared<Map>()) {}
 
   jlong Insert(HOLDER holder) {
-    mtx_.lock();
+    std::lock_guard<std::mutex> lock(mtx_);
     jlong result = module_id_++;
-    map_.insert(std::pair<jlong, HOLDER>(result, holder));
-    mtx_.unlock();
+    auto map = std::make_shared<Map>(*std::atomic_load(&map_));
+    map->insert(std::pair<jlong, HOLDER>(result, holder));
+    std::atomic_store(&map_, std::shared_ptr<const Map>(std::move(map)));
     return result;
   }
 
   void Erase(jlong module_id) {
-    mtx_.lock();
-    map_.erase(module_id);
-    mtx_.unlock();
+    std::lock_guard<std::mutex> lock(mtx_);
+    auto map = std::make_shared<Map>(*std::atomic_load(&map_));
+    map->erase(module_id);
+    std::atomic_store(&map_, std::shared_ptr<const Map>(std::move(map)));
   }
 
   HOLDER Lookup(jlong module_id) {
-    HOLDER result = nullptr;
-    mtx_.lock();
-    try {
-      result = map_.at(module_id);
-    } catch (const std::out_of_range&) {
-    }
-    mtx_.unlock();
-    return result;
+    std::shared_ptr<const Map> map = std::atomic_load(&map_);
+    auto it = map->find(module_id);
+    return it == map->end() ? nullptr : it->second;
   }
 
  private:
+  using Map = std::unordered_map<jlong, HOLDER>;
+
   static const int kInitModuleId = 4;
 
-  int64_t module_id_;
+  // serializes the writers
   std::mutex mtx_;
-  // map from module ids returned to Java and module pointers
-  std::unordered_map<jlong, HOLDER> map_;
+  int64_t module_id_;
+  // accessed atomically, replaced by the writers
+  std::shared_ptr<const Map> map_;
 };
 
 }  // namespace gandiva
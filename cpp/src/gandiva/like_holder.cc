@@ -17,36 +17,44 @@
 
 #include "gandiva/like_holder.h"
 
-#include <regex>
 #include "gandiva/node.h"
 #include "gandiva/regex_util.h"
 
 namespace gandiva {
 
-RE2 LikeHolder::starts_with_regex_(R"((\w|\s)*\.\*)");
-RE2 LikeHolder::ends_with_regex_(R"(\.\*(\w|\s)*)");
-
-// Short-circuit pattern matches for the two common sub cases :
-// - starts_with and ends_with.
+// Short-circuit pattern matches for the common sub cases, i.e. patterns without
+// '_' whose '%' are all leading or trailing :
+// - equal, starts_with, ends_with and is_substr.
 const FunctionNode LikeHolder::TryOptimize(const FunctionNode& node) {
   std::shared_ptr<LikeHolder> holder;
   auto status = Make(node, &holder);
   if (status.ok()) {
-    std::string& pattern = holder->pattern_;
-    auto literal_type = node.children().at(1)->return_type();
-
-    if (RE2::FullMatch(pattern, starts_with_regex_)) {
-      auto prefix = pattern.substr(0, pattern.length() - 2);  // trim .*
-      auto prefix_node =
-          std::make_shared<LiteralNode>(literal_type, LiteralHolder(prefix), false);
-      return FunctionNode("starts_with", {node.children().at(0), prefix_node},
-                          node.return_type());
-    } else if (RE2::FullMatch(pattern, ends_with_regex_)) {
-      auto suffix = pattern.substr(2);  // skip .*
-      auto suffix_node =
-          std::make_shared<LiteralNode>(literal_type, LiteralHolder(suffix), false);
-      return FunctionNode("ends_with", {node.children().at(0), suffix_node},
-                          node.return_type());
+    auto literal = dynamic_cast<LiteralNode*>(node.children().at(1).get());
+    const auto& sql_pattern = arrow::util::get<std::string>(literal->holder());
+    auto begin = sql_pattern.find_first_not_of('%');
+    if (begin == std::string::npos) {
+      begin = sql_pattern.size();
+    }
+    auto end = sql_pattern.find_last_not_of('%') + 1;
+    if (end < begin) {
+      end = begin;
+    }
+    auto word = sql_pattern.substr(begin, end - begin);
+
+    if (word.find_first_of("%_") == std::string::npos) {
+      const bool leading = begin > 0;
+      const bool trailing = end < sql_pattern.size();
+      const char* name = "equal";
+      if (leading && trailing) {
+        name = "is_substr";
+      } else if (leading) {
+        name = "ends_with";
+      } else if (trailing) {
+        name = "starts_with";
+      }
+      auto word_node = std::make_shared<LiteralNode>(literal->return_type(),
+                                                     LiteralHolder(word), false);
+      return FunctionNode(name, {node.children().at(0), word_node}, node.return_type());
     }
   }
 
@@ -105,6 +105,16 @@ TEST_F(TestLikeHolder, TestOptimise) {
   EXPECT_EQ(fnode.descriptor()->name(), "ends_with");
   EXPECT_EQ(fnode.ToString(), "bool ends_with((string) in, (const string) xyz)");
 
+  // optimise for 'is_substr'
+  fnode = LikeHolder::TryOptimize(BuildLike("%xy.*z%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "is_substr");
+  EXPECT_EQ(fnode.ToString(), "bool is_substr((string) in, (const string) xy.*z)");
+
+  // optimise for 'equal'
+  fnode = LikeHolder::TryOptimize(BuildLike("x(yz)"));
+  EXPECT_EQ(fnode.descriptor()->name(), "equal");
+  EXPECT_EQ(fnode.ToString(), "bool equal((string) in, (const string) x(yz))");
+
   // no optimisation for others.
   fnode = LikeHolder::TryOptimize(BuildLike("xyz_"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
@@ -112,9 +122,6 @@ TEST_F(TestLikeHolder, TestOptimise) {
   fnode = LikeHolder::TryOptimize(BuildLike("_xyz"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
 
-  fnode = LikeHolder::TryOptimize(BuildLike("%xyz%"));
-  EXPECT_EQ(fnode.descriptor()->name(), "like");
-
   fnode = LikeHolder::TryOptimize(BuildLike("_xyz_"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
 
@@ -123,6 +130,9 @@ TEST_F(TestLikeHolder, TestOptimise) {
 
   fnode = LikeHolder::TryOptimize(BuildLike("x_yz%"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
+
+  fnode = LikeHolder::TryOptimize(BuildLike("%x%yz"));
+  EXPECT_EQ(fnode.descriptor()->name(), "like");
 }
 
 }  // namespace gandiva
@@ -17,17 +17,23 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/parallel.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
+#include "gandiva/expr_optimizer.h"
 #include "gandiva/expression.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/lvalue.h"
@@ -40,18 +46,46 @@ namespace gandiva {
   }
 
 LLVMGenerator::LLVMGenerator()
-    : dump_ir_(false), optimise_ir_(true), enable_ir_traces_(false) {}
+    : num_intermediates_(0),
+      dump_ir_(false),
+      optimise_ir_(true),
+      enable_ir_traces_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
+  return Make(config, true /*optimise*/, llvm_generator);
+}
+
+Status LLVMGenerator::Make(std::shared_ptr<Configuration> config, bool optimise,
+                           std::unique_ptr<LLVMGenerator>* llvm_generator) {
   std::unique_ptr<LLVMGenerator> llvmgen_obj(new LLVMGenerator());
+  llvmgen_obj->optimise_ir_ = optimise;
 
-  ARROW_RETURN_NOT_OK(Engine::Make(config, &(llvmgen_obj->engine_)));
+  ARROW_RETURN_NOT_OK(Engine::Make(config, optimise, &(llvmgen_obj->engine_)));
   *llvm_generator = std::move(llvmgen_obj);
 
   return Status::OK();
 }
 
+void LLVMGenerator::BuildInBackground(
+    std::shared_ptr<Configuration> config, const ExpressionVector& exprs,
+    SelectionVector::Mode mode, std::size_t cache_hash, const std::string& cache_key,
+    std::function<void(std::unique_ptr<LLVMGenerator>)> on_built) {
+  auto task = [config, exprs, mode, cache_hash, cache_key, on_built]() {
+    std::unique_ptr<LLVMGenerator> generator;
+    if (!Make(config, &generator).ok()) {
+      return;
+    }
+    generator->SetObjectCacheKey(cache_hash, cache_key);
+    if (!generator->Build(exprs, mode).ok()) {
+      return;
+    }
+    on_built(std::move(generator));
+  };
+  // The pool only refuses tasks once shut down, at exit
+  ARROW_UNUSED(arrow::internal::GetCpuThreadPool()->Spawn(std::move(task)));
+}
+
 Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr output) {
   int idx = static_cast<int>(compiled_exprs_.size());
   // decompose the expression to separate out value and validities.
@@ -72,7 +106,27 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
 /// Build and optimise module for projection expression.
 Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode mode) {
   selection_vector_mode_ = mode;
+  ExprOptimizer optimizer;
+  ExpressionVector simplified;
   for (auto& expr : exprs) {
+    simplified.push_back(optimizer.Simplify(expr));
+  }
+
+  // Subexpressions shared by the expressions are evaluated once into
+  // intermediate vectors, which needs all rows to be evaluated.
+  ExpressionVector common_exprs;
+  ExpressionVector rewritten = simplified;
+  if (mode == SelectionVector::MODE_NONE) {
+    optimizer.ExtractCommonSubexpressions(simplified, &common_exprs, &rewritten);
+  }
+  for (auto& expr : common_exprs) {
+    auto output = annotator_.AddOutputFieldDescriptor(expr->result());
+    ARROW_RETURN_NOT_OK(Add(expr, output));
+    annotator_.AddIntermediateFieldDescriptor(expr->result());
+  }
+  num_intermediates_ = static_cast<int>(common_exprs.size());
+
+  for (auto& expr : rewritten) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
     ARROW_RETURN_NOT_OK(Add(expr, output));
   }
@@ -102,9 +156,6 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
   DCHECK_GT(record_batch.num_rows(), 0);
 
-  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
-  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
-
   auto mode = SelectionVector::MODE_NONE;
   if (selection_vector != nullptr) {
     mode = selection_vector->GetMode();
@@ -113,33 +164,194 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
     return Status::Invalid("llvm expression built for selection vector mode ",
                            selection_vector_mode_, " received vector with mode ", mode);
   }
+  return Execute(record_batch, 0, record_batch.num_rows(), selection_vector,
+                 arrow::default_memory_pool(), output_vector);
+}
 
-  for (auto& compiled_expr : compiled_exprs_) {
+// Allocate an intermediate vector, like the output vectors of projectors.
+static Status AllocIntermediate(const DataTypePtr& type, int64_t length,
+                                arrow::MemoryPool* pool, ArrayDataPtr* out) {
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers(1);
+  ARROW_RETURN_NOT_OK(
+      arrow::AllocateBuffer(pool, arrow::BitUtil::BytesForBits(length), &buffers[0]));
+  int64_t data_len = 0;
+  if (arrow::is_binary_like(type->id())) {
+    std::shared_ptr<arrow::Buffer> offsets;
+    ARROW_RETURN_NOT_OK(arrow::AllocateBuffer(
+        pool, (length + 1) * static_cast<int64_t>(sizeof(int32_t)), &offsets));
+    buffers.push_back(offsets);
+  } else {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*type);
+    data_len = arrow::BitUtil::BytesForBits(length * fw_type.bit_width());
+  }
+  std::shared_ptr<arrow::ResizableBuffer> data;
+  ARROW_RETURN_NOT_OK(arrow::AllocateResizableBuffer(pool, data_len, &data));
+  if (type->id() == arrow::Type::BOOL) {
+    memset(data->mutable_data(), 0, static_cast<size_t>(data_len));
+  }
+  buffers.push_back(data);
+  *out = arrow::ArrayData::Make(type, length, buffers);
+  return Status::OK();
+}
+
+Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch, int64_t offset,
+                              int64_t length, const SelectionVector* selection_vector,
+                              arrow::MemoryPool* pool,
+                              const ArrayDataVector& output_vector) {
+  const int num_exprs = static_cast<int>(compiled_exprs_.size());
+  if (num_intermediates_ == 0) {
+    auto eval_batch =
+        annotator_.PrepareEvalBatch(record_batch, output_vector, offset, length);
+    DCHECK_GT(eval_batch->GetNumBuffers(), 0);
+    return Execute(*eval_batch, selection_vector, 0, num_exprs);
+  }
+  DCHECK_EQ(selection_vector, nullptr);
+
+  // The common subexpressions come first, evaluated into intermediate vectors.
+  ArrayDataVector intermediates;
+  for (int i = 0; i < num_intermediates_; ++i) {
+    ArrayDataPtr intermediate;
+    ARROW_RETURN_NOT_OK(AllocIntermediate(compiled_exprs_[i]->output()->Type(), length,
+                                          pool, &intermediate));
+    intermediates.push_back(intermediate);
+  }
+  auto eval_batch =
+      annotator_.PrepareEvalBatch(record_batch, intermediates, offset, length);
+  ARROW_RETURN_NOT_OK(Execute(*eval_batch, nullptr, 0, num_intermediates_));
+
+  // Var-len intermediates may have been reallocated meanwhile, so they are only
+  // bound as inputs once evaluated.
+  ArrayDataVector outputs = intermediates;
+  outputs.insert(outputs.end(), output_vector.begin(), output_vector.end());
+  eval_batch = annotator_.PrepareEvalBatch(record_batch, outputs, offset, length,
+                                           intermediates);
+  return Execute(*eval_batch, nullptr, num_intermediates_, num_exprs);
+}
+
+Status LLVMGenerator::Execute(const EvalBatch& eval_batch,
+                              const SelectionVector* selection_vector, int begin,
+                              int end) {
+  auto mode = SelectionVector::MODE_NONE;
+  if (selection_vector != nullptr) {
+    mode = selection_vector->GetMode();
+  }
+
+  for (int i = begin; i < end; ++i) {
+    const auto& compiled_expr = compiled_exprs_[i];
     // generate data/offset vectors.
     const uint8_t* selection_buffer = nullptr;
-    auto num_output_rows = record_batch.num_rows();
+    auto num_output_rows = eval_batch.num_records();
     if (selection_vector != nullptr) {
       selection_buffer = selection_vector->GetBuffer().data();
       num_output_rows = selection_vector->GetNumSlots();
     }
 
     EvalFunc jit_function = compiled_expr->GetJITFunction(mode);
-    jit_function(eval_batch->GetBufferArray(), eval_batch->GetLocalBitMapArray(),
-                 selection_buffer, (int64_t)eval_batch->GetExecutionContext(),
+    jit_function(eval_batch.GetBufferArray(), eval_batch.GetLocalBitMapArray(),
+                 selection_buffer, (int64_t)eval_batch.GetExecutionContext(),
                  num_output_rows);
 
     // check for execution errors
     ARROW_RETURN_IF(
-        eval_batch->GetExecutionContext()->has_error(),
-        Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+        eval_batch.GetExecutionContext()->has_error(),
+        Status::ExecutionError(eval_batch.GetExecutionContext()->get_error()));
 
     // generate validity vectors.
-    ComputeBitMapsForExpr(*compiled_expr, *eval_batch, selection_vector);
+    ComputeBitMapsForExpr(*compiled_expr, eval_batch, selection_vector);
   }
 
   return Status::OK();
 }
 
+// Smallest row range evaluated by a task, a multiple of 64 so that the ranges
+// of the output bitmaps don't share any word.
+static constexpr int64_t kMinRowsPerTask = 64 * 1024;
+
+Status LLVMGenerator::ExecuteParallel(const arrow::RecordBatch& record_batch,
+                                      arrow::MemoryPool* pool,
+                                      const ArrayDataVector& output_vector) {
+  const int64_t num_rows = record_batch.num_rows();
+  const int64_t max_tasks = std::min<int64_t>(
+      arrow::GetCpuThreadPoolCapacity(),
+      (num_rows + kMinRowsPerTask - 1) / kMinRowsPerTask);
+  if (max_tasks <= 1 || selection_vector_mode_ != SelectionVector::MODE_NONE) {
+    return Execute(record_batch, nullptr, output_vector);
+  }
+  const int64_t rows_per_task =
+      arrow::BitUtil::RoundUpToMultipleOf64((num_rows + max_tasks - 1) / max_tasks);
+  const int num_tasks = static_cast<int>((num_rows + rows_per_task - 1) / rows_per_task);
+
+  // Fixed-width outputs are evaluated into slices of the output buffers, var-len
+  // ones into buffers of their own.
+  std::vector<ArrayDataVector> range_outputs(num_tasks);
+  for (int task = 0; task < num_tasks; ++task) {
+    const int64_t offset = task * rows_per_task;
+    const int64_t length = std::min(rows_per_task, num_rows - offset);
+    for (auto& array_data : output_vector) {
+      const auto& type = array_data->type;
+      auto validity =
+          arrow::SliceMutableBuffer(array_data->buffers[0], offset / 8, (length + 7) / 8);
+      if (arrow::is_binary_like(type->id())) {
+        std::shared_ptr<arrow::Buffer> offsets;
+        std::shared_ptr<arrow::ResizableBuffer> data;
+        ARROW_RETURN_NOT_OK(arrow::AllocateBuffer(
+            pool, (length + 1) * static_cast<int64_t>(sizeof(int32_t)), &offsets));
+        ARROW_RETURN_NOT_OK(arrow::AllocateResizableBuffer(pool, 0, &data));
+        range_outputs[task].push_back(
+            arrow::ArrayData::Make(type, length, {validity, offsets, data}));
+      } else {
+        const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*type);
+        auto data = arrow::SliceMutableBuffer(
+            array_data->buffers[1], offset * fw_type.bit_width() / 8,
+            arrow::BitUtil::BytesForBits(length * fw_type.bit_width()));
+        range_outputs[task].push_back(
+            arrow::ArrayData::Make(type, length, {validity, data}));
+      }
+    }
+  }
+
+  ARROW_RETURN_NOT_OK(arrow::internal::ParallelFor(num_tasks, [&](int task) {
+    const int64_t offset = task * rows_per_task;
+    return Execute(record_batch, offset, range_outputs[task][0]->length, nullptr, pool,
+                   range_outputs[task]);
+  }));
+
+  // Append the var-len ranges to the output vectors, shifting their offsets.
+  for (size_t i = 0; i < output_vector.size(); ++i) {
+    const auto& array_data = output_vector[i];
+    if (!arrow::is_binary_like(array_data->type->id())) {
+      continue;
+    }
+    auto data = dynamic_cast<arrow::ResizableBuffer*>(array_data->buffers[2].get());
+    DCHECK_NE(data, nullptr);
+    int64_t data_size = data->size();
+    for (auto& outputs : range_outputs) {
+      data_size += outputs[i]->buffers[2]->size();
+    }
+    ARROW_RETURN_IF(data_size > std::numeric_limits<int32_t>::max(),
+                    Status::CapacityError("Var-len output exceeds 2GB"));
+
+    auto out_offsets = reinterpret_cast<int32_t*>(array_data->buffers[1]->mutable_data());
+    int32_t base = static_cast<int32_t>(data->size());
+    ARROW_RETURN_NOT_OK(data->Resize(data_size, false /*shrink*/));
+    for (int task = 0; task < num_tasks; ++task) {
+      const auto& range = *range_outputs[task][i];
+      auto range_offsets = reinterpret_cast<const int32_t*>(range.buffers[1]->data());
+      int32_t* dst_offsets = out_offsets + task * rows_per_task;
+      for (int64_t j = 0; j <= range.length; ++j) {
+        dst_offsets[j] = base + range_offsets[j];
+      }
+      const auto& range_data = *range.buffers[2];
+      if (range_data.size() > 0) {
+        memcpy(data->mutable_data() + base, range_data.data(),
+               static_cast<size_t>(range_data.size()));
+        base += static_cast<int32_t>(range_data.size());
+      }
+    }
+  }
+  return Status::OK();
+}
+
 llvm::Value* LLVMGenerator::LoadVectorAtIndex(llvm::Value* arg_addrs, int idx,
                                               const std::string& name) {
   llvm::IRBuilder<>* builder = ir_builder();
@@ -19,6 +19,7 @@
 #define GANDIVA_LLVMGENERATOR_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -50,6 +51,28 @@ class GANDIVA_EXPORT LLVMGenerator {
   static Status Make(std::shared_ptr<Configuration> config,
                      std::unique_ptr<LLVMGenerator>* llvm_generator);
 
+  /// \brief Factory method to initialize the generator, which neither optimises
+  /// the IR nor the machine code when 'optimise' is false.
+  static Status Make(std::shared_ptr<Configuration> config, bool optimise,
+                     std::unique_ptr<LLVMGenerator>* llvm_generator);
+
+  /// \brief Build an optimised generator for the expressions on the CPU thread
+  /// pool, and hand it to 'on_built'. Failures are ignored, as the caller keeps
+  /// using the generator it already has.
+  ///
+  /// \param[in] cache_hash the hash of the projector or filter cache key
+  /// \param[in] cache_key the text of the projector or filter cache key
+  static void BuildInBackground(
+      std::shared_ptr<Configuration> config, const ExpressionVector& exprs,
+      SelectionVector::Mode mode, std::size_t cache_hash, const std::string& cache_key,
+      std::function<void(std::unique_ptr<LLVMGenerator>)> on_built);
+
+  /// \brief Use the persistent object code cache of the configuration, if
+  /// any, for the module built next, under the given cache key.
+  void SetObjectCacheKey(std::size_t hash, const std::string& key) {
+    engine_->SetObjectCacheKey(hash, key);
+  }
+
   /// \brief Build the code for the expression trees for default mode. Each
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs, SelectionVector::Mode mode);
@@ -71,6 +94,13 @@ class GANDIVA_EXPORT LLVMGenerator {
                  const SelectionVector* selection_vector,
                  const ArrayDataVector& output_vector);
 
+  /// \brief Execute the built expression against the provided arguments for
+  /// default mode, splitting large batches into row ranges evaluated on the CPU
+  /// thread pool. Var-len outputs are evaluated into per-range buffers allocated
+  /// from the pool, and concatenated at the end.
+  Status ExecuteParallel(const arrow::RecordBatch& record_batch, arrow::MemoryPool* pool,
+                         const ArrayDataVector& output_vector);
+
   SelectionVector::Mode selection_vector_mode() { return selection_vector_mode_; }
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
@@ -167,6 +197,17 @@ class GANDIVA_EXPORT LLVMGenerator {
   // the expression going to 'output'.
   Status Add(const ExpressionPtr expr, const FieldDescriptorPtr output);
 
+  /// Evaluate all the expressions over the rows [offset, offset + length) of the
+  /// record batch, with intermediate vectors allocated from 'pool'.
+  Status Execute(const arrow::RecordBatch& record_batch, int64_t offset,
+                 int64_t length, const SelectionVector* selection_vector,
+                 arrow::MemoryPool* pool, const ArrayDataVector& output_vector);
+
+  /// Evaluate the compiled expressions [begin, end) over the buffers of an eval
+  /// batch.
+  Status Execute(const EvalBatch& eval_batch, const SelectionVector* selection_vector,
+                 int begin, int end);
+
   /// Generate code to load the vector at specified index in the 'arg_addrs' array.
   llvm::Value* LoadVectorAtIndex(llvm::Value* arg_addrs, int idx,
                                  const std::string& name);
@@ -237,6 +278,9 @@ class GANDIVA_EXPORT LLVMGenerator {
   FunctionRegistry function_registry_;
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
+  // The leading compiled expressions, which evaluate the common subexpressions
+  // into intermediate vectors.
+  int num_intermediates_;
 
   // used for debug
   bool dump_ir_;
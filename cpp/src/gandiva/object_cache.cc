@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/raw_ostream.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "boost/functional/hash.hpp"
+
+namespace gandiva {
+
+namespace {
+
+// The LLVM version and the host CPU with its features, all of which the object
+// code depends on besides the module
+std::string ObjectCodeTarget() {
+  std::vector<std::string> features;
+  llvm::StringMap<bool> host_features;
+  if (llvm::sys::getHostCPUFeatures(host_features)) {
+    for (auto& feature : host_features) {
+      features.push_back((feature.getValue() ? "+" : "-") + feature.getKey().str());
+    }
+  }
+  std::sort(features.begin(), features.end());
+
+  std::stringstream ss;
+  ss << "LLVM " << LLVM_VERSION_STRING << "\n" << llvm::sys::getHostCPUName().str();
+  for (auto& feature : features) {
+    ss << "," << feature;
+  }
+  ss << "\n";
+  return ss.str();
+}
+
+}  // namespace
+
+ObjectCache::ObjectCache(const std::string& directory, std::size_t hash,
+                         const std::string& key)
+    : directory_(directory), loaded_(false), found_(false) {
+  static const std::string target = ObjectCodeTarget();
+  key_ = target + key;
+
+  boost::hash_combine(hash, target);
+  std::stringstream ss;
+  ss << directory_ << "/gandiva-" << std::hex << hash << ".o";
+  path_ = ss.str();
+}
+
+bool ObjectCache::HasObject() {
+  if (loaded_) {
+    return found_;
+  }
+  loaded_ = true;
+
+  auto buffer_or_error = llvm::MemoryBuffer::getFile(path_, -1, false);
+  if (!buffer_or_error) {
+    return false;
+  }
+  // The file holds the key and a NUL byte, followed by the object code
+  llvm::StringRef contents = buffer_or_error.get()->getBuffer();
+  if (contents.size() <= key_.size() || !contents.startswith(key_) ||
+      contents[key_.size()] != '\0') {
+    return false;
+  }
+  object_ = llvm::MemoryBuffer::getMemBufferCopy(contents.substr(key_.size() + 1),
+                                                 path_);
+  found_ = true;
+  return true;
+}
+
+void ObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                       llvm::MemoryBufferRef object) {
+  int fd;
+  llvm::SmallString<128> temp_path;
+  if (llvm::sys::fs::createUniqueFile(path_ + ".%%%%%%%%.tmp", fd, temp_path)) {
+    return;
+  }
+  {
+    llvm::raw_fd_ostream stream(fd, /*shouldClose=*/true);
+    stream << key_ << '\0';
+    stream.write(object.getBufferStart(), object.getBufferSize());
+    stream.close();
+    if (stream.has_error()) {
+      stream.clear_error();
+      llvm::sys::fs::remove(temp_path);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(temp_path, path_)) {
+    llvm::sys::fs::remove(temp_path);
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> ObjectCache::getObject(const llvm::Module* module) {
+  HasObject();
+  // The execution engine takes the object code over
+  return std::move(object_);
+}
+
+}  // namespace gandiva
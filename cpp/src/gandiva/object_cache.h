@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "arrow/util/macros.h"
+
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Persistent cache of the object code of one module.
+///
+/// The object code is stored in a file of the cache directory named after
+/// the hash of the projector or filter cache key, combined with the LLVM
+/// version and the host CPU and its features. The file also holds the full
+/// key, so that hash collisions and stale files are detected on load.
+///
+/// Failing to read or write the cache is not an error, the module is then
+/// compiled as if there was no cache. Files are written under a temporary
+/// name and renamed, so processes sharing a directory never see partial
+/// files.
+class GANDIVA_EXPORT ObjectCache : public llvm::ObjectCache {
+ public:
+  /// \param[in] directory the cache directory, which must exist
+  /// \param[in] hash the hash of the cache key of the module
+  /// \param[in] key the text of the cache key of the module
+  ObjectCache(const std::string& directory, std::size_t hash, const std::string& key);
+
+  /// \brief Whether the object code of the module is in the cache, in which case
+  /// the module needs neither optimising nor compiling.
+  bool HasObject();
+
+  const std::string& path() const { return path_; }
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+ private:
+  std::string directory_;
+  std::string path_;
+  // The key, prefixed with the LLVM version and the host CPU
+  std::string key_;
+  bool loaded_;
+  bool found_;
+  std::unique_ptr<llvm::MemoryBuffer> object_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ObjectCache);
+};
+
+}  // namespace gandiva
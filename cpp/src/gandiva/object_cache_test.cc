@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/object_cache.h"
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace gandiva {
+
+class TestObjectCache : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK(arrow::internal::TemporaryDir::Make("gandiva-object-cache-", &dir_));
+    path_ = dir_->path().ToString();
+  }
+
+ protected:
+  std::unique_ptr<arrow::internal::TemporaryDir> dir_;
+  std::string path_;
+};
+
+TEST_F(TestObjectCache, RoundTrip) {
+  const std::string object = std::string("object\0code", 11);
+
+  ObjectCache cache(path_, 42, "key");
+  ASSERT_FALSE(cache.HasObject());
+  ASSERT_EQ(nullptr, cache.getObject(nullptr));
+  cache.notifyObjectCompiled(nullptr, llvm::MemoryBufferRef(object, "object"));
+
+  ObjectCache other_cache(path_, 42, "key");
+  ASSERT_EQ(cache.path(), other_cache.path());
+  ASSERT_TRUE(other_cache.HasObject());
+  auto buffer = other_cache.getObject(nullptr);
+  ASSERT_NE(nullptr, buffer);
+  ASSERT_EQ(object, buffer->getBuffer().str());
+}
+
+TEST_F(TestObjectCache, KeyMismatch) {
+  ObjectCache cache(path_, 42, "key");
+  cache.notifyObjectCompiled(nullptr, llvm::MemoryBufferRef("object", "object"));
+
+  // Same hash, but a different key
+  ObjectCache colliding_cache(path_, 42, "other key");
+  ASSERT_EQ(cache.path(), colliding_cache.path());
+  ASSERT_FALSE(colliding_cache.HasObject());
+  ASSERT_EQ(nullptr, colliding_cache.getObject(nullptr));
+
+  ObjectCache other_cache(path_, 43, "key");
+  ASSERT_NE(cache.path(), other_cache.path());
+  ASSERT_FALSE(other_cache.HasObject());
+}
+
+TEST_F(TestObjectCache, MissingDirectory) {
+  ObjectCache cache(path_ + "/missing", 42, "key");
+  cache.notifyObjectCompiled(nullptr, llvm::MemoryBufferRef("object", "object"));
+  ASSERT_FALSE(cache.HasObject());
+}
+
+}  // namespace gandiva
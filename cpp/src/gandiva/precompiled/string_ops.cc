@@ -89,6 +89,27 @@ bool ends_with_utf8_utf8(const char* data, int32 data_len, const char* suffix,
           (memcmp(data + data_len - suffix_len, suffix, suffix_len) == 0));
 }
 
+// Search for the first occurrence of a non-empty substring, looking for its
+// first byte with memchr.
+FORCE_INLINE
+bool is_substr_utf8_utf8(const char* data, int32 data_len, const char* substr,
+                         int32 substr_len) {
+  if (substr_len == 0) {
+    return true;
+  }
+  const char* last = data + data_len - substr_len;
+  for (const char* cur = data; cur <= last; ++cur) {
+    cur = reinterpret_cast<const char*>(memchr(cur, substr[0], last - cur + 1));
+    if (cur == nullptr) {
+      return false;
+    }
+    if (memcmp(cur + 1, substr + 1, substr_len - 1) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
 FORCE_INLINE
 int32 utf8_char_length(char c) {
   if (c >= 0) {  // 1-byte char
@@ -146,7 +167,22 @@ FORCE_INLINE
 char* upper_utf8(int64 context, const char* data, int32 data_len, int32_t* out_len) {
   char* ret = reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, data_len));
   // TODO: handle allocation failures
-  for (int32 i = 0; i < data_len; ++i) {
+  static const uint64_t kOnes = 0x0101010101010101ULL;
+  static const uint64_t kHighBits = 0x8080808080808080ULL;
+  int32 i = 0;
+  // Eight bytes at a time : the high bit of each byte of 'lower' is set where
+  // the byte is in 'a' - 'z', so that shifting it to 0x20 flips the case.
+  for (; i + 8 <= data_len; i += 8) {
+    uint64_t word;
+    memcpy(&word, data + i, 8);
+    uint64_t low_bits = word & ~kHighBits;
+    uint64_t from_a = low_bits + (0x80 - 0x61) * kOnes;
+    uint64_t after_z = low_bits + (0x80 - 0x7b) * kOnes;
+    uint64_t lower = (from_a ^ after_z) & ~word & kHighBits;
+    word ^= lower >> 2;
+    memcpy(ret + i, &word, 8);
+  }
+  for (; i < data_len; ++i) {
     char cur = data[i];
 
     // 'A- - 'Z' : 0x41 - 0x5a
@@ -216,14 +252,8 @@ const char* substr_utf8_int64_int64(int64 context, const char* input, int32 in_l
     *out_len = in_len - startIndex;
   }
 
-  char* ret = reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, *out_len));
-  if (ret == nullptr) {
-    gdv_fn_context_set_error_msg(context, "Could not allocate memory for output string");
-    *out_len = 0;
-    return "";
-  }
-  memcpy(ret, input + startIndex, *out_len);
-  return ret;
+  // Var-len outputs are copied into the output vector, so point into the input
+  return input + startIndex;
 }
 
 FORCE_INLINE
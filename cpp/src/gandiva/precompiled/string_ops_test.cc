@@ -52,6 +52,34 @@ TEST(TestStringOps, TestBeginsEnds) {
   EXPECT_TRUE(ends_with_utf8_utf8("sir", 3, "sir", 3));
   EXPECT_FALSE(ends_with_utf8_utf8("ir", 2, "sir", 3));
   EXPECT_FALSE(ends_with_utf8_utf8("hello", 5, "sir", 3));
+
+  // is_substr
+  EXPECT_TRUE(is_substr_utf8_utf8("hello sir", 9, "lo s", 4));
+  EXPECT_TRUE(is_substr_utf8_utf8("hello sir", 9, "hello sir", 9));
+  EXPECT_TRUE(is_substr_utf8_utf8("hello", 5, "", 0));
+  EXPECT_TRUE(is_substr_utf8_utf8("aab", 3, "ab", 2));
+  EXPECT_FALSE(is_substr_utf8_utf8("hello sir", 9, "sirs", 4));
+  EXPECT_FALSE(is_substr_utf8_utf8("abab", 4, "abb", 3));
+  EXPECT_FALSE(is_substr_utf8_utf8("", 0, "a", 1));
+}
+
+TEST(TestStringOps, TestUpper) {
+  gandiva::ExecutionContext ctx;
+  uint64_t ctx_ptr = reinterpret_cast<int64>(&ctx);
+  int32 out_len = 0;
+
+  char* out_str = upper_utf8(ctx_ptr, "asdf", 4, &out_len);
+  EXPECT_EQ(std::string(out_str, out_len), "ASDF");
+
+  // Longer strings go eight bytes at a time, leaving other bytes as they are
+  std::string input("the Quick brown fox @[`{ jumps over âpple 0123456789_z");
+  out_str = upper_utf8(ctx_ptr, input.data(), static_cast<int32>(input.length()),
+                       &out_len);
+  EXPECT_EQ(std::string(out_str, out_len),
+            "THE QUICK BROWN FOX @[`{ JUMPS OVER âPPLE 0123456789_Z");
+
+  out_str = upper_utf8(ctx_ptr, "", 0, &out_len);
+  EXPECT_EQ(out_len, 0);
 }
 
 TEST(TestStringOps, TestCharLength) {
@@ -158,9 +158,13 @@ bool starts_with_utf8_utf8(const char* data, int32 data_len, const char* prefix,
                            int32 prefix_len);
 bool ends_with_utf8_utf8(const char* data, int32 data_len, const char* suffix,
                          int32 suffix_len);
+bool is_substr_utf8_utf8(const char* data, int32 data_len, const char* substr,
+                         int32 substr_len);
 
 int32 utf8_length(int64 context, const char* data, int32 data_len);
 
+char* upper_utf8(int64 context, const char* data, int32 data_len, int32_t* out_len);
+
 date64 castDATE_utf8(int64_t execution_context, const char* input, int32 length);
 
 timestamp castTIMESTAMP_utf8(int64_t execution_context, const char* input, int32 length);
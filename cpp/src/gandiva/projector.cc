@@ -18,6 +18,7 @@
 #include "gandiva/projector.h"
 
 #include <memory>
+#include <sstream>
 #include <utility>
 #include <vector>
 
@@ -38,6 +39,11 @@ Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr sc
 
 Projector::~Projector() {}
 
+void Projector::SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator) {
+  std::shared_ptr<LLVMGenerator> generator = std::move(llvm_generator);
+  std::atomic_store(&llvm_generator_, generator);
+}
+
 Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                        std::shared_ptr<Projector>* projector) {
   return Projector::Make(schema, exprs, SelectionVector::Mode::MODE_NONE,
@@ -71,7 +77,9 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   // Build LLVM generator, and generate code for the specified expressions
   std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+  const bool optimize_in_background = configuration->optimize_in_background();
+  ARROW_RETURN_NOT_OK(
+      LLVMGenerator::Make(configuration, !optimize_in_background, &llvm_gen));
 
   // Run the validation on the expressions.
   // Return if any of the expression is invalid since
@@ -81,6 +89,12 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
     ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
   }
 
+  std::stringstream cache_key_text;
+  cache_key_text << cache_key.ToString() << " Mode: " << selection_vector_mode;
+  // Only optimised code goes to the persistent cache
+  if (!optimize_in_background) {
+    llvm_gen->SetObjectCacheKey(cache_key.Hash(), cache_key_text.str());
+  }
   ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs, selection_vector_mode));
 
   // save the output field types. Used for validation at Evaluate() time.
@@ -95,6 +109,17 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
       new Projector(std::move(llvm_gen), schema, output_fields, configuration));
   cache.PutModule(cache_key, *projector);
 
+  if (optimize_in_background) {
+    std::weak_ptr<Projector> weak_projector = *projector;
+    LLVMGenerator::BuildInBackground(
+        configuration, exprs, selection_vector_mode, cache_key.Hash(),
+        cache_key_text.str(), [weak_projector](std::unique_ptr<LLVMGenerator> generator) {
+          auto projector = weak_projector.lock();
+          if (projector != nullptr) {
+            projector->SetLLVMGenerator(std::move(generator));
+          }
+        });
+  }
   return Status::OK();
 }
 
@@ -130,7 +155,12 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
         ValidateArrayDataCapacity(*array_data, *(output_fields_[idx]), num_rows));
     ++idx;
   }
-  return llvm_generator_->Execute(batch, selection_vector, output_data_vecs);
+  auto llvm_generator = std::atomic_load(&llvm_generator_);
+  if (selection_vector == nullptr && configuration_->use_threads()) {
+    return llvm_generator->ExecuteParallel(batch, arrow::default_memory_pool(),
+                                           output_data_vecs);
+  }
+  return llvm_generator->Execute(batch, selection_vector, output_data_vecs);
 }
 
 Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
@@ -157,8 +187,13 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(
-      llvm_generator_->Execute(batch, selection_vector, output_data_vecs));
+  auto llvm_generator = std::atomic_load(&llvm_generator_);
+  if (selection_vector == nullptr && configuration_->use_threads()) {
+    ARROW_RETURN_NOT_OK(llvm_generator->ExecuteParallel(batch, pool, output_data_vecs));
+  } else {
+    ARROW_RETURN_NOT_OK(
+        llvm_generator->Execute(batch, selection_vector, output_data_vecs));
+  }
 
   // Create and return array arrays.
   output->clear();
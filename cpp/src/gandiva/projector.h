@@ -38,6 +38,11 @@ class LLVMGenerator;
 ///
 /// A projector is built for a specific schema and vector of expressions.
 /// Once the projector is built, it can be used to evaluate many row batches.
+///
+/// With a configuration using threads, large batches evaluated without a selection
+/// vector are split into row ranges evaluated in parallel on the CPU thread pool.
+/// With a configuration optimizing in background, the projector evaluates
+/// unoptimised code until the optimised code is compiled.
 class GANDIVA_EXPORT Projector {
  public:
   // Inline dtor will attempt to resolve the destructor for
@@ -132,7 +137,12 @@ class GANDIVA_EXPORT Projector {
   /// Validate the common args for Evaluate() APIs.
   Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
 
-  const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  /// Switch to another generator for the expressions, atomically with respect to
+  /// concurrent evaluations.
+  void SetLLVMGenerator(std::unique_ptr<LLVMGenerator> llvm_generator);
+
+  /// Accessed atomically, as background optimisation replaces it.
+  std::shared_ptr<LLVMGenerator> llvm_generator_;
   const SchemaPtr schema_;
   const FieldVector output_fields_;
   const std::shared_ptr<Configuration> configuration_;
@@ -123,6 +123,37 @@ TEST_F(TestFilter, TestSimple) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
 }
 
+TEST_F(TestFilter, TestSimpleBitMap) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // Build condition f0 < f1
+  auto condition = TreeExprBuilder::MakeCondition("less_than", {field0, field1});
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  EXPECT_TRUE(status.ok());
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4, 6}, {true, true, true, false, true});
+  auto array1 = MakeArrowArrayInt32({5, 1, 6, 17, 7}, {true, true, false, true, true});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression
+  std::shared_ptr<arrow::Buffer> bitmap;
+  status = filter->Evaluate(*in_batch, pool_, &bitmap);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Rows 0 and 4 match, null rows don't
+  ASSERT_GE(bitmap->size(), 1);
+  EXPECT_EQ(bitmap->data()[0], 0x11);
+}
+
 TEST_F(TestFilter, TestSimpleCustomConfig) {
   // schema for input fields
   auto field0 = field("f0", int32());
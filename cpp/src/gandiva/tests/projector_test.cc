@@ -15,11 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
 #include <cmath>
+#include <thread>
 
 #include <gtest/gtest.h>
 
 #include "arrow/memory_pool.h"
+#include "arrow/util/io_util.h"
 
 #include "gandiva/projector.h"
 #include "gandiva/tests/test_util.h"
@@ -248,6 +251,157 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestObjectCache) {
+  std::unique_ptr<arrow::internal::TemporaryDir> dir;
+  ASSERT_OK(arrow::internal::TemporaryDir::Make("gandiva-projector-", &dir));
+  auto configuration =
+      ConfigurationBuilder().set_object_cache_dir(dir->path().ToString()).build();
+
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("add", int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr}, configuration, &projector));
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+}
+
+TEST_F(TestProjector, TestUseThreads) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", arrow::utf8());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sum = field("add", int32());
+  auto field_upper = field("upper", arrow::utf8());
+  auto field_greater = field("greater", boolean());
+
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field0}, field_sum);
+  auto upper_expr = TreeExprBuilder::MakeExpression("upper", {field1}, field_upper);
+  auto greater_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("greater_than",
+                                    {TreeExprBuilder::MakeField(field0),
+                                     TreeExprBuilder::MakeLiteral(int32_t(1000))},
+                                    boolean()),
+      field_greater);
+  ExpressionVector exprs = {sum_expr, upper_expr, greater_expr};
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, exprs, TestConfiguration(), &projector));
+  std::shared_ptr<Projector> threaded_projector;
+  ASSERT_OK(Projector::Make(schema, exprs,
+                            ConfigurationBuilder().set_use_threads(true).build(),
+                            &threaded_projector));
+  ASSERT_NE(projector, threaded_projector);
+
+  // Enough rows for several ranges, the last one partial
+  int num_records = 300000 + 17;
+  std::vector<int32_t> values(num_records);
+  std::vector<std::string> strings(num_records);
+  std::vector<bool> validity(num_records);
+  for (int i = 0; i < num_records; ++i) {
+    values[i] = i;
+    strings[i] = std::string(i % 7, 'a' + i % 26);
+    validity[i] = i % 5 != 0;
+  }
+  auto array0 = MakeArrowArrayInt32(values, validity);
+  auto array1 = MakeArrowArrayUtf8(strings, validity);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  arrow::ArrayVector expected;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &expected));
+  arrow::ArrayVector outputs;
+  ASSERT_OK(threaded_projector->Evaluate(*in_batch, pool_, &outputs));
+  ASSERT_EQ(expected.size(), outputs.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_ARROW_ARRAY_EQUALS(expected[i], outputs[i]);
+  }
+}
+
+TEST_F(TestProjector, TestOptimizeInBackground) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_sub = field("subtract", int32());
+  auto sub_expr =
+      TreeExprBuilder::MakeExpression("subtract", {field0, field1}, field_sub);
+
+  auto configuration = ConfigurationBuilder().set_optimize_in_background(true).build();
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sub_expr}, configuration, &projector));
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  auto exp_sub = MakeArrowArrayInt32({-10, -11, 0, 0}, {true, true, false, false});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Results are the same before and after the optimised code is swapped in
+  for (int i = 0; i < 20; ++i) {
+    arrow::ArrayVector outputs;
+    ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(0));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+}
+
+TEST_F(TestProjector, TestCommonSubexpressions) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", arrow::utf8());
+  auto schema = arrow::schema({field0, field1});
+
+  // upper(upper(f1)) and (f0 + f0) * f0 are each used by two expressions
+  auto node0 = TreeExprBuilder::MakeField(field0);
+  auto upper = TreeExprBuilder::MakeFunction(
+      "upper",
+      {TreeExprBuilder::MakeFunction("upper", {TreeExprBuilder::MakeField(field1)},
+                                     arrow::utf8())},
+      arrow::utf8());
+  auto product = TreeExprBuilder::MakeFunction(
+      "multiply",
+      {TreeExprBuilder::MakeFunction("add", {node0, node0}, int32()), node0}, int32());
+  auto upper_expr = TreeExprBuilder::MakeExpression(upper, field("upper", arrow::utf8()));
+  auto length_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("octet_length", {upper}, int32()),
+      field("length", int32()));
+  auto product_expr = TreeExprBuilder::MakeExpression(product, field("product", int32()));
+  auto sub_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction(
+          "subtract", {product, TreeExprBuilder::MakeLiteral(int32_t(1))}, int32()),
+      field("subtract", int32()));
+
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {upper_expr, length_expr, product_expr, sub_expr},
+                            TestConfiguration(), &projector));
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, false, true});
+  auto array1 = MakeArrowArrayUtf8({"ab", "", "cde", "f"}, {true, true, true, false});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  auto exp_upper = MakeArrowArrayUtf8({"AB", "", "CDE", ""}, {true, true, true, false});
+  auto exp_length = MakeArrowArrayInt32({2, 0, 3, 0}, {true, true, true, false});
+  auto exp_product = MakeArrowArrayInt32({2, 8, 0, 32}, {true, true, false, true});
+  auto exp_sub = MakeArrowArrayInt32({1, 7, 0, 31}, {true, true, false, true});
+
+  arrow::ArrayVector outputs;
+  ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+  ASSERT_EQ(outputs.size(), 4);
+  EXPECT_ARROW_ARRAY_EQUALS(exp_upper, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_length, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_product, outputs.at(2));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(3));
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
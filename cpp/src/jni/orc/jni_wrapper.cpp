@@ -21,9 +21,15 @@
 #include <arrow/io/api.h>
 #include <arrow/ipc/api.h>
 #include <arrow/util/logging.h>
+#include <arrow/util/thread_pool.h>
+#include <atomic>
 #include <cassert>
+#include <future>
 #include <iostream>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "org_apache_arrow_adapter_orc_OrcMemoryJniWrapper.h"
 #include "org_apache_arrow_adapter_orc_OrcReaderJniWrapper.h"
@@ -51,9 +57,86 @@ static jint JNI_VERSION = JNI_VERSION_1_6;
 
 using arrow::jni::ConcurrentMap;
 
-static ConcurrentMap<std::shared_ptr<arrow::Buffer>> buffer_holder_;
+// The Java side releases the buffers of a batch one by one; they are retained
+// together, under a single id, until the last of them is released.
+struct ExportedBatch {
+  ExportedBatch(std::shared_ptr<arrow::RecordBatch> batch, int64_t num_buffers)
+      : batch(std::move(batch)), pending_releases(num_buffers) {}
+
+  std::shared_ptr<arrow::RecordBatch> batch;
+  std::atomic<int64_t> pending_releases;
+};
+
+// An ORC file reader returned to Java.  Its stripe readers share its liborc
+// reader, which isn't thread-safe, so all the calls into liborc made through
+// it or through its stripe readers hold its mutex.
+struct SharedFileReader {
+  explicit SharedFileReader(std::unique_ptr<ORCFileReader> reader)
+      : reader(std::move(reader)) {}
+
+  std::unique_ptr<ORCFileReader> reader;
+  std::mutex mutex;
+};
+
+// A RecordBatchReader which reads the next batch on the IO thread pool while
+// the current one is processed by the Java side.  It keeps the file reader
+// of the stripe alive, and holds its mutex while reading.
+class PrefetchingRecordBatchReader : public RecordBatchReader {
+ public:
+  PrefetchingRecordBatchReader(std::shared_ptr<RecordBatchReader> reader,
+                               std::shared_ptr<SharedFileReader> file_reader)
+      : file_reader_(std::move(file_reader)), reader_(std::move(reader)) {
+    Prefetch();
+  }
+
+  ~PrefetchingRecordBatchReader() override {
+    if (next_.valid()) {
+      next_.wait();
+    }
+  }
+
+  std::shared_ptr<arrow::Schema> schema() const override { return reader_->schema(); }
+
+  arrow::Status ReadNext(std::shared_ptr<arrow::RecordBatch>* batch) override {
+    // Java threads may call next concurrently
+    std::lock_guard<std::mutex> lock(next_mutex_);
+    if (!next_.valid()) {
+      // End of stream, or a previous error
+      *batch = nullptr;
+      return arrow::Status::OK();
+    }
+    auto result = next_.get();
+    *batch = std::move(result.second);
+    if (result.first.ok() && *batch) {
+      Prefetch();
+    }
+    return result.first;
+  }
+
+ private:
+  using ReadResult = std::pair<arrow::Status, std::shared_ptr<arrow::RecordBatch>>;
+
+  void Prefetch() {
+    auto file_reader = file_reader_;
+    auto reader = reader_;
+    next_ = arrow::internal::GetIOThreadPool()->Submit([file_reader, reader]() {
+      std::lock_guard<std::mutex> lock(file_reader->mutex);
+      std::shared_ptr<arrow::RecordBatch> batch;
+      arrow::Status status = reader->ReadNext(&batch);
+      return ReadResult(std::move(status), std::move(batch));
+    });
+  }
+
+  // Destroyed after the stripe reader
+  std::shared_ptr<SharedFileReader> file_reader_;
+  std::shared_ptr<RecordBatchReader> reader_;
+  std::mutex next_mutex_;
+  std::future<ReadResult> next_;
+};
+
+static ConcurrentMap<std::shared_ptr<ExportedBatch>> exported_batch_holder_;
 static ConcurrentMap<std::shared_ptr<RecordBatchReader>> orc_stripe_reader_holder_;
-static ConcurrentMap<std::shared_ptr<ORCFileReader>> orc_reader_holder_;
+static ConcurrentMap<std::shared_ptr<SharedFileReader>> orc_reader_holder_;
 
 jclass CreateGlobalClassReference(JNIEnv* env, const char* class_name) {
   jclass local_class = env->FindClass(class_name);
@@ -82,7 +165,7 @@ std::string JStringToCString(JNIEnv* env, jstring string) {
   return std::string(buffer.data(), clen);
 }
 
-std::shared_ptr<ORCFileReader> GetFileReader(JNIEnv* env, jlong id) {
+std::shared_ptr<SharedFileReader> GetFileReader(JNIEnv* env, jlong id) {
   auto reader = orc_reader_holder_.Lookup(id);
   if (!reader) {
     std::string error_message = "invalid reader id " + std::to_string(id);
@@ -148,7 +231,7 @@ void JNI_OnUnload(JavaVM* vm, void* reserved) {
   env->DeleteGlobalRef(orc_memory_class);
   env->DeleteGlobalRef(record_batch_class);
 
-  buffer_holder_.Clear();
+  exported_batch_holder_.Clear();
   orc_stripe_reader_holder_.Clear();
   orc_reader_holder_.Clear();
 }
@@ -177,7 +260,8 @@ JNIEXPORT jlong JNICALL Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_op
       env->ThrowNew(io_exception_class, std::string("Failed open file" + path).c_str());
     }
 
-    return orc_reader_holder_.Insert(std::shared_ptr<ORCFileReader>(reader.release()));
+    return orc_reader_holder_.Insert(
+        std::make_shared<SharedFileReader>(std::move(reader)));
   }
 
   return static_cast<jlong>(ret.code()) * -1;
@@ -191,7 +275,11 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_clo
 JNIEXPORT jboolean JNICALL Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_seek(
     JNIEnv* env, jobject this_obj, jlong id, jint row_number) {
   auto reader = GetFileReader(env, id);
-  return reader->Seek(row_number).ok();
+  if (!reader) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(reader->mutex);
+  return reader->reader->Seek(row_number).ok();
 }
 
 JNIEXPORT jint JNICALL
@@ -199,7 +287,11 @@ Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_getNumberOfStripes(JNIEnv*
                                                                          jobject this_obj,
                                                                          jlong id) {
   auto reader = GetFileReader(env, id);
-  return reader->NumberOfStripes();
+  if (!reader) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> lock(reader->mutex);
+  return reader->reader->NumberOfStripes();
 }
 
 JNIEXPORT jlong JNICALL
@@ -208,9 +300,16 @@ Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_nextStripeReader(JNIEnv* e
                                                                        jlong id,
                                                                        jlong batch_size) {
   auto reader = GetFileReader(env, id);
+  if (!reader) {
+    return static_cast<jlong>(arrow::StatusCode::Invalid) * -1;
+  }
 
   std::shared_ptr<RecordBatchReader> stripe_reader;
-  auto status = reader->NextStripeReader(batch_size, &stripe_reader);
+  arrow::Status status;
+  {
+    std::lock_guard<std::mutex> lock(reader->mutex);
+    status = reader->reader->NextStripeReader(batch_size, &stripe_reader);
+  }
 
   if (!status.ok()) {
     return static_cast<jlong>(status.code()) * -1;
@@ -220,7 +319,8 @@ Java_org_apache_arrow_adapter_orc_OrcReaderJniWrapper_nextStripeReader(JNIEnv* e
     return static_cast<jlong>(arrow::StatusCode::Invalid) * -1;
   }
 
-  return orc_stripe_reader_holder_.Insert(stripe_reader);
+  return orc_stripe_reader_holder_.Insert(std::make_shared<PrefetchingRecordBatchReader>(
+      std::move(stripe_reader), std::move(reader)));
 }
 
 JNIEXPORT jbyteArray JNICALL
@@ -276,15 +376,21 @@ Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapper_next(JNIEnv* env,
     }
   }
 
-  // create OrcMemoryJniWrapper[]
+  // create OrcMemoryJniWrapper[], whose buffers share the id of the batch.  A
+  // batch without buffers is never released, so it isn't retained.
   jobjectArray memory_array =
       env->NewObjectArray(buffers.size(), orc_memory_class, nullptr);
+  jlong batch_id = 0;
+  if (!buffers.empty()) {
+    batch_id = exported_batch_holder_.Insert(
+        std::make_shared<ExportedBatch>(record_batch, buffers.size()));
+  }
 
   for (size_t j = 0; j < buffers.size(); ++j) {
     auto buffer = buffers[j];
-    jobject memory = env->NewObject(orc_memory_class, orc_memory_constructor,
-                                    buffer_holder_.Insert(buffer), buffer->data(),
-                                    buffer->size(), buffer->capacity());
+    jobject memory =
+        env->NewObject(orc_memory_class, orc_memory_constructor, batch_id,
+                       buffer->data(), buffer->size(), buffer->capacity());
     env->SetObjectArrayElement(memory_array, j, memory);
   }
 
@@ -302,7 +408,10 @@ JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcStripeReaderJniWrapp
 
 JNIEXPORT void JNICALL Java_org_apache_arrow_adapter_orc_OrcMemoryJniWrapper_release(
     JNIEnv* env, jobject this_obj, jlong id) {
-  buffer_holder_.Erase(id);
+  auto exported_batch = exported_batch_holder_.Lookup(id);
+  if (exported_batch && --exported_batch->pending_releases == 0) {
+    exported_batch_holder_.Erase(id);
+  }
 }
 
 #ifdef __cplusplus
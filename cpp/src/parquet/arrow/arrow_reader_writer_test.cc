@@ -24,9 +24,15 @@
 #include "gtest/gtest.h"
 
 #include <arrow/compute/api.h>
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <functional>
+#include <mutex>
+#include <numeric>
 #include <sstream>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "arrow/api.h"
@@ -39,8 +45,11 @@
 #include "parquet/api/reader.h"
 #include "parquet/api/writer.h"
 
+#include "parquet/arrow/column_summary.h"
+#include "parquet/arrow/read_into.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/reader_internal.h"
+#include "parquet/arrow/row_group_filter.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/test_util.h"
 #include "parquet/arrow/writer.h"
@@ -1861,6 +1870,28 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWrite) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 3, &table));
+
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  std::shared_ptr<Buffer> buffer;
+  // Several row groups, each spanning chunk boundaries
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, 300, arrow_properties, &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(4, reader->num_row_groups());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -1896,6 +1927,810 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   ASSERT_TRUE(table->Equals(*concatenated));
 }
 
+TEST(TestArrowReadWrite, WriteRecordBatches) {
+  const int num_columns = 3;
+  const int num_rows = 100;
+
+  // Ten batches of 100 rows, of which 90 are valid doubles
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 10, &table));
+
+  auto WriteBatches = [&](const std::shared_ptr<WriterProperties>& properties,
+                          std::shared_ptr<Buffer>* out) {
+    auto sink = CreateOutputStream();
+    std::unique_ptr<FileWriter> writer;
+    ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), ::arrow::default_memory_pool(),
+                                        sink, properties, &writer));
+    ::arrow::TableBatchReader batch_reader(*table);
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(batch_reader.ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK_NO_THROW(writer->Close());
+    ASSERT_OK_NO_THROW(sink->Finish(out));
+  };
+
+  auto CheckRowGroups = [&](const std::shared_ptr<Buffer>& buffer,
+                            const std::vector<int64_t>& expected_num_rows) {
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), &reader));
+    auto metadata = reader->parquet_reader()->metadata();
+    ASSERT_EQ(static_cast<int>(expected_num_rows.size()), metadata->num_row_groups());
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+      ASSERT_EQ(expected_num_rows[i], metadata->RowGroup(i)->num_rows());
+    }
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  };
+
+  // Row count limits split batches
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteBatches(WriterProperties::Builder().max_row_group_length(250)->build(),
+                   &buffer));
+  ASSERT_NO_FATAL_FAILURE(CheckRowGroups(buffer, {250, 250, 250, 250}));
+
+  // Each batch holds 3 * 720 bytes of PLAIN encoded values, so that the size
+  // limit is reached on the third batch of a row group
+  ASSERT_NO_FATAL_FAILURE(WriteBatches(WriterProperties::Builder()
+                                           .disable_dictionary()
+                                           ->max_row_group_bytes(5000)
+                                           ->build(),
+                                       &buffer));
+  ASSERT_NO_FATAL_FAILURE(CheckRowGroups(buffer, {300, 300, 300, 100}));
+
+  // A batch may also be written after a row group was
+  std::unique_ptr<FileWriter> writer;
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), ::arrow::default_memory_pool(),
+                                      sink, default_writer_properties(), &writer));
+  auto table_head = table->Slice(0, 500);
+  auto table_tail = table->Slice(500);
+  ASSERT_OK_NO_THROW(writer->WriteTable(*table_head, 500));
+  ::arrow::TableBatchReader batch_reader(*table_tail);
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(batch_reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+  ASSERT_NO_FATAL_FAILURE(CheckRowGroups(buffer, {500, 500}));
+}
+
+TEST(TestArrowReadWrite, WriteTableRowGroupBytes) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(3, 100, 10, &table));
+
+  // About 24 bytes per row in memory
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(
+      WriteTable(*table, ::arrow::default_memory_pool(), sink, table->num_rows(),
+                 WriterProperties::Builder().max_row_group_bytes(2400)->build()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  auto metadata = reader->parquet_reader()->metadata();
+  ASSERT_GE(metadata->num_row_groups(), 10);
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    ASSERT_LE(metadata->RowGroup(i)->num_rows(), 100);
+  }
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+}
+
+// A BufferReader which records the ranges it is told will be needed
+class WillNeedRecordingReader : public BufferReader {
+ public:
+  explicit WillNeedRecordingReader(const std::shared_ptr<Buffer>& buffer)
+      : BufferReader(buffer) {}
+
+  Status WillNeed(const std::vector<::arrow::io::ReadRange>& ranges) override {
+    ranges_.insert(ranges_.end(), ranges.begin(), ranges.end());
+    return Status::OK();
+  }
+
+  std::vector<::arrow::io::ReadRange> ranges_;
+};
+
+TEST(TestArrowReadWrite, PreBuffer) {
+  const int num_columns = 4;
+  const int num_rows = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  auto source = std::make_shared<WillNeedRecordingReader>(buffer);
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_pre_buffer(true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK_NO_THROW(builder.Open(source));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadRowGroups({1}, {0, 2}, &result));
+  ASSERT_EQ(2, source->ranges_.size());
+  auto metadata = reader->parquet_reader()->metadata()->RowGroup(1);
+  for (int i = 0; i < 2; ++i) {
+    auto column = metadata->ColumnChunk(i * 2);
+    const int64_t offset = column->has_dictionary_page()
+                               ? column->dictionary_page_offset()
+                               : column->data_page_offset();
+    ASSERT_EQ(offset, source->ranges_[i].offset);
+    ASSERT_EQ(column->total_compressed_size(), source->ranges_[i].length);
+  }
+  ASSERT_EQ(num_rows / 2, result->num_rows());
+  ASSERT_EQ(2, result->num_columns());
+
+  source->ranges_.clear();
+  std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, {3}, &batch_reader));
+  ASSERT_EQ(2, source->ranges_.size());
+  ASSERT_OK(batch_reader->ReadAll(&result));
+  ASSERT_EQ(num_rows, result->num_rows());
+  ASSERT_TRUE(table->column(3)->Equals(result->column(0)));
+}
+
+// A BufferReader which records the ranges read with ReadAt, possibly from
+// several threads
+class ReadAtRecordingReader : public BufferReader {
+ public:
+  explicit ReadAtRecordingReader(const std::shared_ptr<Buffer>& buffer)
+      : BufferReader(buffer) {}
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ranges_.push_back({position, nbytes});
+    }
+    return BufferReader::ReadAt(position, nbytes, out);
+  }
+
+  std::vector<::arrow::io::ReadRange> ranges() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ranges_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<::arrow::io::ReadRange> ranges_;
+};
+
+TEST(TestArrowReadWrite, PrefetchRowGroups) {
+  const int num_columns = 3;
+  const int num_rows = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 5,
+                                             default_arrow_writer_properties(), &buffer));
+
+  auto source = std::make_shared<ReadAtRecordingReader>(buffer);
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_prefetch_row_groups(2);
+  properties.set_batch_size(7);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK_NO_THROW(builder.Open(source));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+  ASSERT_EQ(5, reader->num_row_groups());
+  const size_t footer_reads = source->ranges().size();
+
+  std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+  ASSERT_OK_NO_THROW(
+      reader->GetRecordBatchReader({0, 1, 2, 3, 4}, {0, 2}, &batch_reader));
+  // Creating the reader reads the first row group and starts prefetching the
+  // next two, but no further
+  std::vector<::arrow::io::ReadRange> ranges = source->ranges();
+  for (int i = 0; i < 1000 && ranges.size() < footer_reads + 3 * 2; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    ranges = source->ranges();
+  }
+  ASSERT_EQ(footer_reads + 3 * 2, ranges.size());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(batch_reader->ReadAll(&result));
+  ASSERT_EQ(num_rows, result->num_rows());
+  ASSERT_TRUE(table->column(0)->Equals(result->column(0)));
+  ASSERT_TRUE(table->column(2)->Equals(result->column(1)));
+
+  // Each column chunk was read once
+  ranges = source->ranges();
+  ASSERT_EQ(footer_reads + 5 * 2, ranges.size());
+  std::vector<int64_t> offsets;
+  for (size_t i = footer_reads; i < ranges.size(); ++i) {
+    offsets.push_back(ranges[i].offset);
+  }
+  std::sort(offsets.begin(), offsets.end());
+  ASSERT_EQ(offsets.end(), std::unique(offsets.begin(), offsets.end()));
+}
+
+TEST(TestArrowReadWrite, MetaDataCache) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(2, 10, 1, &table));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, 10, default_arrow_writer_properties(), &buffer));
+
+  FileMetaDataCache cache(4);
+  std::shared_ptr<FileMetaData> metadata;
+  for (int i = 0; i < 2; ++i) {
+    auto source = std::make_shared<ReadAtRecordingReader>(buffer);
+    FileReaderBuilder builder;
+    ASSERT_OK_NO_THROW(builder.metadata_cache(&cache, "table.parquet", 1)->Open(source));
+    if (i == 0) {
+      metadata = builder.raw_reader()->metadata();
+      ASSERT_FALSE(source->ranges().empty());
+    } else {
+      // The footer isn't read again
+      ASSERT_EQ(metadata.get(), builder.raw_reader()->metadata().get());
+      ASSERT_TRUE(source->ranges().empty());
+    }
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK(builder.Build(&reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_TRUE(table->Equals(*result));
+  }
+  ASSERT_EQ(1, cache.size());
+}
+
+TEST(TestArrowReadWrite, ZeroCopyReads) {
+  const int num_rows = 1000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto schema = ::arrow::schema({::arrow::field("i64", ::arrow::int64(), false),
+                                 ::arrow::field("f64", ::arrow::float64(), false)});
+  auto table = Table::Make(schema, {rag.Int64(num_rows, -1000, 1000, 0),
+                                    rag.Float64(num_rows, -1, 1, 0)});
+
+  // Several uncompressed PLAIN data pages per row group
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .write_batch_size(100)
+                         ->data_pagesize(1024)
+                         ->disable_dictionary()
+                         ->compression(Compression::UNCOMPRESSED)
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, num_rows / 2,
+                                write_props, default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_zero_copy_reads(true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK(result->Validate());
+  for (int i = 0; i < result->num_columns(); ++i) {
+    const ChunkedArray& column = *result->column(i);
+    ASSERT_TRUE(table->column(i)->Equals(column));
+    // One chunk per data page, pointing into the file buffer
+    ASSERT_GT(column.num_chunks(), 2);
+    for (const std::shared_ptr<Array>& chunk : column.chunks()) {
+      const uint8_t* values = chunk->data()->buffers[1]->data();
+      ASSERT_GE(values, buffer->data());
+      ASSERT_LE(values + chunk->length() * 8, buffer->data() + buffer->size());
+    }
+  }
+
+  std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &batch_reader));
+  ASSERT_OK(batch_reader->ReadAll(&result));
+  ASSERT_EQ(num_rows, result->num_rows());
+  for (int i = 0; i < result->num_columns(); ++i) {
+    ASSERT_TRUE(table->column(i)->Equals(result->column(i)));
+  }
+}
+
+TEST(TestArrowReadWrite, FilterRowGroupsWithStatistics) {
+  const int num_rows = 1000;
+  const int row_group_size = 100;
+
+  // A sorted timestamp column, a string key column and a column which only
+  // has nulls in the fifth row group
+  ::arrow::Int64Builder ts_builder;
+  ::arrow::StringBuilder key_builder;
+  ::arrow::Int32Builder sparse_builder;
+  for (int i = 0; i < num_rows; ++i) {
+    ASSERT_OK(ts_builder.Append(1000 + i));
+    // Keys are prefixed by row group but unsorted within each
+    const int suffix = 10 + (i * 37) % 90;
+    ASSERT_OK(key_builder.Append("user-" + std::to_string(i / row_group_size) + "-" +
+                                 std::to_string(suffix)));
+    if (i / row_group_size == 4) {
+      ASSERT_OK(sparse_builder.AppendNull());
+    } else {
+      ASSERT_OK(sparse_builder.Append(i));
+    }
+  }
+  std::shared_ptr<Array> ts, key, sparse;
+  ASSERT_OK(ts_builder.Finish(&ts));
+  ASSERT_OK(key_builder.Finish(&key));
+  ASSERT_OK(sparse_builder.Finish(&sparse));
+  auto table = Table::Make(::arrow::schema({::arrow::field("ts", ::arrow::int64()),
+                                            ::arrow::field("key", ::arrow::utf8()),
+                                            ::arrow::field("sparse", ::arrow::int32())}),
+                           {ts, key, sparse});
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, row_group_size,
+                                             default_arrow_writer_properties(), &buffer));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(10, reader->num_row_groups());
+
+  auto int64_value = [](int64_t value) {
+    return std::make_shared<::arrow::Int64Scalar>(value);
+  };
+  auto CheckRowGroups = [&](const RowGroupFilter& filter,
+                            const std::vector<int>& expected) {
+    std::vector<int> row_groups;
+    ASSERT_OK_NO_THROW(reader->FilterRowGroups(filter, &row_groups));
+    ASSERT_EQ(expected, row_groups);
+  };
+
+  // 1250 <= ts < 1350
+  auto time_range =
+      RowGroupFilter::And({RowGroupFilter::Compare(0, RowGroupFilter::GREATER_EQUAL,
+                                                   int64_value(1250)),
+                           RowGroupFilter::Compare(0, RowGroupFilter::LESS,
+                                                   int64_value(1350))});
+  CheckRowGroups(*time_range, {2, 3});
+  CheckRowGroups(*RowGroupFilter::Compare(0, RowGroupFilter::EQUAL, int64_value(1999)),
+                 {9});
+  CheckRowGroups(*RowGroupFilter::Compare(0, RowGroupFilter::GREATER, int64_value(1999)),
+                 {});
+  CheckRowGroups(*RowGroupFilter::Compare(0, RowGroupFilter::NOT_EQUAL, int64_value(5)),
+                 {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  // Narrower integer scalars are widened to the column type
+  CheckRowGroups(*RowGroupFilter::Compare(0, RowGroupFilter::LESS,
+                                          std::make_shared<::arrow::Int16Scalar>(1100)),
+                 {0});
+  CheckRowGroups(*RowGroupFilter::Or({RowGroupFilter::Compare(0, RowGroupFilter::LESS,
+                                                              int64_value(1050)),
+                                      RowGroupFilter::Compare(
+                                          0, RowGroupFilter::GREATER_EQUAL,
+                                          int64_value(1950))}),
+                 {0, 9});
+
+  auto string_value = [](std::string value) {
+    return std::make_shared<::arrow::StringScalar>(Buffer::FromString(std::move(value)));
+  };
+  CheckRowGroups(*RowGroupFilter::Compare(1, RowGroupFilter::EQUAL,
+                                          string_value("user-7-42")),
+                 {7});
+  CheckRowGroups(*RowGroupFilter::Compare(1, RowGroupFilter::EQUAL,
+                                          string_value("user-7-0")),
+                 {});
+
+  CheckRowGroups(*RowGroupFilter::IsNull(2), {4});
+  CheckRowGroups(*RowGroupFilter::IsValid(2), {0, 1, 2, 3, 5, 6, 7, 8, 9});
+  CheckRowGroups(*RowGroupFilter::Compare(2, RowGroupFilter::LESS_EQUAL,
+                                          std::make_shared<::arrow::Int32Scalar>(450)),
+                 {0, 1, 2, 3});
+
+  // Unsupported comparisons never skip row groups
+  CheckRowGroups(*RowGroupFilter::Compare(
+                     1, RowGroupFilter::EQUAL, std::make_shared<::arrow::Int32Scalar>(1)),
+                 {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+  std::vector<int> row_groups;
+  ASSERT_RAISES(Invalid, reader->FilterRowGroups(
+                             *RowGroupFilter::Compare(3, RowGroupFilter::EQUAL,
+                                                      int64_value(0)),
+                             &row_groups));
+  ASSERT_RAISES(Invalid, reader->FilterRowGroups(
+                             *RowGroupFilter::Compare(0, RowGroupFilter::EQUAL, nullptr),
+                             &row_groups));
+
+  // Only the selected row groups are read
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(*time_range, {0, 1}, &result));
+  ASSERT_EQ(200, result->num_rows());
+  ASSERT_EQ(2, result->num_columns());
+  ASSERT_TRUE(table->column(0)->Slice(200, 200)->Equals(result->column(0)));
+
+  ASSERT_OK_NO_THROW(reader->ReadTable(
+      *RowGroupFilter::Compare(0, RowGroupFilter::LESS, int64_value(0)), {0}, &result));
+  ASSERT_EQ(0, result->num_rows());
+  ASSERT_EQ(1, result->num_columns());
+}
+
+TEST(TestArrowReadWrite, FilterRowGroupsWithBloomFilters) {
+  const int num_rows = 1000;
+  const int row_group_size = 100;
+
+  // Values are scattered over all row groups so that statistics can't rule
+  // any of them out
+  ::arrow::Int64Builder id_builder;
+  ::arrow::StringBuilder key_builder;
+  ::arrow::Int32Builder other_builder;
+  for (int i = 0; i < num_rows; ++i) {
+    const int64_t id = (i * 7) % num_rows;
+    ASSERT_OK(id_builder.Append(id));
+    ASSERT_OK(key_builder.Append("key-" + std::to_string(id)));
+    ASSERT_OK(other_builder.Append(i));
+  }
+  std::shared_ptr<Array> id, key, other;
+  ASSERT_OK(id_builder.Finish(&id));
+  ASSERT_OK(key_builder.Finish(&key));
+  ASSERT_OK(other_builder.Finish(&other));
+  auto table = Table::Make(::arrow::schema({::arrow::field("id", ::arrow::int64()),
+                                            ::arrow::field("key", ::arrow::utf8()),
+                                            ::arrow::field("other", ::arrow::int32())}),
+                           {id, key, other});
+
+  auto write_props = WriterProperties::Builder()
+                         .write_batch_size(100)
+                         ->enable_bloom_filter("id", num_rows)
+                         ->enable_bloom_filter("key", num_rows, 0.01)
+                         ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                row_group_size, write_props,
+                                default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  ASSERT_EQ(10, reader->num_row_groups());
+
+  int false_positives = 0;
+  for (int rg = 0; rg < 10; ++rg) {
+    auto row_group = reader->parquet_reader()->RowGroup(rg);
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(0)->has_bloom_filter());
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(1)->has_bloom_filter());
+    ASSERT_FALSE(row_group->metadata()->ColumnChunk(2)->has_bloom_filter());
+    ASSERT_EQ(nullptr, row_group->GetColumnBloomFilter(2));
+
+    // No false negatives
+    for (int i = rg * row_group_size; i < (rg + 1) * row_group_size; ++i) {
+      const int64_t value = (i * 7) % num_rows;
+      ASSERT_TRUE(row_group->RowGroupMayContain(0, value));
+      const std::string key_value = "key-" + std::to_string(value);
+      ASSERT_TRUE(row_group->RowGroupMayContain(1, ByteArray(key_value)));
+    }
+    for (int64_t value = num_rows; value < 2 * num_rows; ++value) {
+      false_positives += row_group->RowGroupMayContain(0, value);
+    }
+    // Columns without a Bloom filter may contain anything
+    ASSERT_TRUE(row_group->RowGroupMayContain(2, static_cast<int32_t>(-1)));
+    ASSERT_THROW(row_group->RowGroupMayContain(0, static_cast<int32_t>(1)),
+                 ParquetException);
+  }
+  ASSERT_LT(false_positives, 10 * num_rows / 20);
+
+  auto CheckRowGroups = [&](const RowGroupFilter& filter,
+                            const std::vector<int>& expected) {
+    std::vector<int> row_groups;
+    ASSERT_OK_NO_THROW(reader->FilterRowGroups(filter, &row_groups));
+    ASSERT_EQ(expected, row_groups);
+  };
+  // Row 150 has id 50
+  CheckRowGroups(*RowGroupFilter::Compare(0, RowGroupFilter::EQUAL,
+                                          std::make_shared<::arrow::Int64Scalar>(50)),
+                 {1});
+  auto key_value = std::make_shared<::arrow::StringScalar>(Buffer::FromString("key-50"));
+  CheckRowGroups(*RowGroupFilter::Compare(1, RowGroupFilter::EQUAL, key_value), {1});
+  // Other comparisons can't use Bloom filters
+  CheckRowGroups(*RowGroupFilter::Compare(0, RowGroupFilter::NOT_EQUAL,
+                                          std::make_shared<::arrow::Int64Scalar>(50)),
+                 {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+TEST(TestArrowReadWrite, SummarizeColumns) {
+  const int num_rows = 1000;
+  const int row_group_size = 100;
+
+  // Ints with nulls, strings, doubles with NaNs and a column of nulls
+  ::arrow::Int32Builder int_builder;
+  ::arrow::StringBuilder string_builder;
+  ::arrow::DoubleBuilder double_builder;
+  ::arrow::Int32Builder null_builder;
+  for (int i = 0; i < num_rows; ++i) {
+    if (i % 3 == 0) {
+      ASSERT_OK(int_builder.AppendNull());
+    } else {
+      ASSERT_OK(int_builder.Append(i - 500));
+    }
+    ASSERT_OK(string_builder.Append("v" + std::to_string(i % 50)));
+    ASSERT_OK(double_builder.Append(i % 7 == 0 ? NAN : i * 0.5));
+    ASSERT_OK(null_builder.AppendNull());
+  }
+  std::shared_ptr<Array> ints, strings, doubles, nulls;
+  ASSERT_OK(int_builder.Finish(&ints));
+  ASSERT_OK(string_builder.Finish(&strings));
+  ASSERT_OK(double_builder.Finish(&doubles));
+  ASSERT_OK(null_builder.Finish(&nulls));
+  auto table = Table::Make(::arrow::schema({::arrow::field("i", ::arrow::int32()),
+                                            ::arrow::field("s", ::arrow::utf8()),
+                                            ::arrow::field("d", ::arrow::float64()),
+                                            ::arrow::field("n", ::arrow::int32())}),
+                           {ints, strings, doubles, nulls});
+
+  auto CheckSummary = [&](const std::shared_ptr<WriterProperties>& write_props,
+                          int64_t expected_chunks_read) {
+    auto sink = CreateOutputStream();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  row_group_size, write_props,
+                                  default_arrow_writer_properties()));
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+    auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+
+    FileSummary summary;
+    ASSERT_OK_NO_THROW(SummarizeColumns(reader.get(), {}, &summary));
+    ASSERT_EQ(num_rows, summary.num_rows);
+    ASSERT_TRUE(summary.columns.empty());
+    ASSERT_EQ(0, summary.num_chunks_read);
+
+    ASSERT_OK_NO_THROW(SummarizeColumns(reader.get(), {3, 0, 1, 2}, &summary));
+    ASSERT_EQ(num_rows, summary.num_rows);
+    ASSERT_EQ(expected_chunks_read, summary.num_chunks_read);
+    ASSERT_EQ(4U, summary.columns.size());
+
+    const ColumnSummary& n = summary.columns[0];
+    ASSERT_EQ(0, n.num_values);
+    ASSERT_EQ(num_rows, n.null_count);
+    ASSERT_FALSE(n.statistics->HasMinMax());
+
+    const ColumnSummary& i = summary.columns[1];
+    ASSERT_EQ(666, i.num_values);
+    ASSERT_EQ(334, i.null_count);
+    auto int_statistics = std::static_pointer_cast<Int32Statistics>(i.statistics);
+    ASSERT_TRUE(int_statistics->HasMinMax());
+    ASSERT_EQ(-499, int_statistics->min());
+    ASSERT_EQ(498, int_statistics->max());
+
+    const ColumnSummary& s = summary.columns[2];
+    ASSERT_EQ(num_rows, s.num_values);
+    ASSERT_EQ(0, s.null_count);
+    auto string_statistics = std::static_pointer_cast<ByteArrayStatistics>(s.statistics);
+    ASSERT_EQ("v0", ByteArrayToString(string_statistics->min()));
+    ASSERT_EQ("v9", ByteArrayToString(string_statistics->max()));
+
+    // NaNs are values, but don't bound the others
+    const ColumnSummary& d = summary.columns[3];
+    ASSERT_EQ(num_rows, d.num_values);
+    ASSERT_EQ(0, d.null_count);
+    auto double_statistics = std::static_pointer_cast<DoubleStatistics>(d.statistics);
+    ASSERT_EQ(0.5, double_statistics->min());
+    ASSERT_EQ(499.5, double_statistics->max());
+
+    ASSERT_RAISES(Invalid, SummarizeColumns(reader.get(), {4}, &summary));
+  };
+
+  ASSERT_NO_FATAL_FAILURE(CheckSummary(default_writer_properties(), 0));
+  // Without statistics the row groups of the column are read
+  ASSERT_NO_FATAL_FAILURE(CheckSummary(
+      WriterProperties::Builder().disable_statistics("s")->build(), 10));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckSummary(WriterProperties::Builder().disable_statistics()->build(), 40));
+}
+
+TEST(TestArrowReadWrite, ReadColumnInto) {
+  auto table = Table::Make(
+      ::arrow::schema({::arrow::field("i", ::arrow::int32()),
+                       ::arrow::field("u", ::arrow::uint8()),
+                       ::arrow::field("d", ::arrow::float64()),
+                       ::arrow::field("f", ::arrow::float32()),
+                       ::arrow::field("l", ::arrow::int64()),
+                       ::arrow::field("t", ::arrow::timestamp(TimeUnit::MILLI)),
+                       ::arrow::field("dt", ::arrow::date32()),
+                       ::arrow::field("s", ::arrow::utf8()),
+                       ::arrow::field("li", ::arrow::list(::arrow::int32()))}),
+      {ArrayFromJSON(::arrow::int32(), "[1, -2, 3, 4, 5, 6, 7]"),
+       ArrayFromJSON(::arrow::uint8(), "[255, 0, 1, 2, 3, 4, 5]"),
+       ArrayFromJSON(::arrow::float64(), "[null, 1.5, null, null, 2.5, 3, null]"),
+       ArrayFromJSON(::arrow::float32(), "[0.5, null, 1, 2, 3, 4, 5]"),
+       ArrayFromJSON(::arrow::int64(), "[null, -1, 2, 3, null, 5, 6]"),
+       ArrayFromJSON(::arrow::timestamp(TimeUnit::MILLI),
+                     "[1, null, 3, 4, null, 6, 7]"),
+       ArrayFromJSON(::arrow::date32(), "[0, 1, null, 3, 4, 5, 6]"),
+       ArrayFromJSON(::arrow::utf8(), R"(["a", "b", "c", "d", "e", "f", "g"])"),
+       ArrayFromJSON(::arrow::list(::arrow::int32()),
+                     "[[1], [], null, [2], [3], [4], [5]]")});
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, /*row_group_size=*/3,
+                                             default_arrow_writer_properties(),
+                                             &buffer));
+  auto reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+
+  bool done = false;
+  std::vector<int32_t> ints(7);
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 0, *::arrow::int32(),
+                                    reinterpret_cast<uint8_t*>(ints.data()), &done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(std::vector<int32_t>({1, -2, 3, 4, 5, 6, 7}), ints);
+
+  std::vector<uint8_t> bytes(7);
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 1, *::arrow::uint8(), bytes.data(),
+                                    &done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(std::vector<uint8_t>({255, 0, 1, 2, 3, 4, 5}), bytes);
+
+  auto AssertDoubles = [&](int column_index, const std::vector<double>& expected) {
+    std::vector<double> doubles(7);
+    ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), column_index, *::arrow::float64(),
+                                      reinterpret_cast<uint8_t*>(doubles.data()),
+                                      &done));
+    ASSERT_TRUE(done);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      if (std::isnan(expected[i])) {
+        ASSERT_TRUE(std::isnan(doubles[i])) << "at " << i;
+      } else {
+        ASSERT_EQ(expected[i], doubles[i]) << "at " << i;
+      }
+    }
+  };
+  // Decoded in place, converted from float and from integers
+  ASSERT_NO_FATAL_FAILURE(AssertDoubles(2, {NAN, 1.5, NAN, NAN, 2.5, 3, NAN}));
+  ASSERT_NO_FATAL_FAILURE(AssertDoubles(3, {0.5, NAN, 1, 2, 3, 4, 5}));
+  ASSERT_NO_FATAL_FAILURE(AssertDoubles(4, {NAN, -1, 2, 3, NAN, 5, 6}));
+  ASSERT_NO_FATAL_FAILURE(AssertDoubles(1, {255, 0, 1, 2, 3, 4, 5}));
+
+  std::vector<float> floats(7);
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 3, *::arrow::float32(),
+                                    reinterpret_cast<uint8_t*>(floats.data()), &done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(0.5f, floats[0]);
+  ASSERT_TRUE(std::isnan(floats[1]));
+  ASSERT_EQ(5.0f, floats[6]);
+
+  const int64_t null = std::numeric_limits<int64_t>::min();
+  const int64_t day = 86400LL * 1000000000LL;
+  auto nanos = ::arrow::timestamp(TimeUnit::NANO);
+  std::vector<int64_t> timestamps(7);
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 5, *nanos,
+                                    reinterpret_cast<uint8_t*>(timestamps.data()),
+                                    &done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(std::vector<int64_t>({1000000, null, 3000000, 4000000, null, 6000000,
+                                  7000000}),
+            timestamps);
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 6, *nanos,
+                                    reinterpret_cast<uint8_t*>(timestamps.data()),
+                                    &done));
+  ASSERT_TRUE(done);
+  ASSERT_EQ(std::vector<int64_t>({0, day, null, 3 * day, 4 * day, 5 * day, 6 * day}),
+            timestamps);
+
+  // Unsupported conversions and repeated columns are left to the caller
+  std::vector<int64_t> longs(7);
+  auto longs_data = reinterpret_cast<uint8_t*>(longs.data());
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 7, *::arrow::float64(), longs_data,
+                                    &done));
+  ASSERT_FALSE(done);
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 8, *::arrow::int32(), longs_data,
+                                    &done));
+  ASSERT_FALSE(done);
+  ASSERT_OK_NO_THROW(ReadColumnInto(reader.get(), 2, *::arrow::timestamp(TimeUnit::MILLI),
+                                    longs_data, &done));
+  ASSERT_FALSE(done);
+
+  // Integers can't hold nulls
+  ASSERT_RAISES(Invalid, ReadColumnInto(reader.get(), 4, *::arrow::int64(), longs_data,
+                                        &done));
+  ASSERT_FALSE(done);
+  ASSERT_RAISES(Invalid, ReadColumnInto(reader.get(), 9, *::arrow::int64(), longs_data,
+                                        &done));
+}
+
+TEST(TestArrowReadWrite, ReadRowGroupsWithRowSelection) {
+  const int num_rows = 2000;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  std::shared_ptr<DataType> list_type;
+  std::shared_ptr<Array> lists;
+  ASSERT_NO_FATAL_FAILURE(MakeListArray(num_rows, 10, &list_type, &lists));
+  auto schema = ::arrow::schema({::arrow::field("key", ::arrow::int32()),
+                                 ::arrow::field("f64", ::arrow::float64(), false),
+                                 ::arrow::field("str", ::arrow::utf8()),
+                                 ::arrow::field("list", list_type)});
+  auto table = Table::Make(
+      schema, {rag.Int32(num_rows, 0, 1000, 0.1), rag.Float64(num_rows, -1, 1, 0),
+               rag.String(num_rows, 0, 10, 0.2), lists});
+
+  // Several data pages per row group
+  auto sink = CreateOutputStream();
+  auto write_props =
+      WriterProperties::Builder().write_batch_size(100)->data_pagesize(1024)->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, default_memory_pool(), sink, num_rows / 4,
+                                write_props, default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  std::shared_ptr<Table> expected_full;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&expected_full));
+
+  // A few scattered keys, then a contiguous run of rows crossing a row group
+  std::shared_ptr<Array> selection;
+  FileReader::RowSelector select_keys =
+      [&selection](const std::shared_ptr<ChunkedArray>& values,
+                   std::shared_ptr<ChunkedArray>* out) -> Status {
+    ::arrow::BooleanBuilder builder;
+    for (const std::shared_ptr<Array>& chunk : values->chunks()) {
+      const auto& keys = static_cast<const ::arrow::Int32Array&>(*chunk);
+      for (int64_t i = 0; i < keys.length(); ++i) {
+        RETURN_NOT_OK(keys.IsNull(i) ? builder.AppendNull()
+                                     : builder.Append(keys.Value(i) % 50 == 0));
+      }
+    }
+    RETURN_NOT_OK(builder.Finish(&selection));
+    *out = std::make_shared<ChunkedArray>(selection);
+    return Status::OK();
+  };
+  FileReader::RowSelector select_run =
+      [&selection](const std::shared_ptr<ChunkedArray>& values,
+                   std::shared_ptr<ChunkedArray>* out) -> Status {
+    ::arrow::BooleanBuilder builder;
+    for (int64_t i = 0; i < values->length(); ++i) {
+      RETURN_NOT_OK(builder.Append(i >= 300 && i < 700));
+    }
+    RETURN_NOT_OK(builder.Finish(&selection));
+    *out = std::make_shared<ChunkedArray>(selection);
+    return Status::OK();
+  };
+
+  for (const FileReader::RowSelector& selector : {select_keys, select_run}) {
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(
+        reader->ReadRowGroups({0, 1, 2, 3}, {0, 1, 2, 3}, 0, selector, &result));
+    ASSERT_OK(result->Validate());
+    ASSERT_EQ(4, result->num_columns());
+
+    FunctionContext ctx(default_memory_pool());
+    for (int i = 0; i < result->num_columns(); ++i) {
+      ASSERT_EQ(1, expected_full->column(i)->num_chunks());
+      std::shared_ptr<Array> expected;
+      ASSERT_OK(::arrow::compute::Filter(&ctx, *expected_full->column(i)->chunk(0),
+                                         *selection, &expected));
+      ASSERT_TRUE(result->column(i)->Equals(ChunkedArray(expected)))
+          << result->field(i)->ToString();
+    }
+  }
+
+  // The filter column doesn't need to be read
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadRowGroups({1, 2}, {1}, 0, select_run, &result));
+  ASSERT_EQ(1, result->num_columns());
+  ASSERT_EQ(400, result->num_rows());
+  ASSERT_TRUE(result->column(0)->Equals(
+      expected_full->column(1)->Slice(num_rows / 4 + 300, 400)));
+
+  ASSERT_RAISES(Invalid, reader->ReadRowGroups({0}, {0}, 3, select_run, &result));
+}
+
 TEST(TestArrowReadWrite, GetRecordBatchReader) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2044,6 +2879,134 @@ TEST(TestArrowReadWrite, ListLargeRecords) {
   ASSERT_TRUE(table->Equals(*chunked_table));
 }
 
+// Round trip every slice of a list column, with row groups of a few rows
+void CheckListRoundtrip(const std::shared_ptr<Array>& lists, bool nullable = true) {
+  auto schema = ::arrow::schema({::arrow::field("lists", lists->type(), nullable)});
+  for (int64_t offset = 0; offset < lists->length(); ++offset) {
+    for (int64_t length = 1; offset + length <= lists->length(); ++length) {
+      auto table = Table::Make(schema, {lists->Slice(offset, length)});
+      for (int64_t row_group_size : {1, 2, 3}) {
+        SCOPED_TRACE("offset " + std::to_string(offset) + ", length " +
+                     std::to_string(length) + ", row group size " +
+                     std::to_string(row_group_size));
+        ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, row_group_size));
+      }
+    }
+  }
+}
+
+// Read a list column back in batches of a few rows, so that batches end
+// within and across row groups
+void CheckListBatches(const std::shared_ptr<Array>& lists, bool nullable) {
+  auto schema = ::arrow::schema({::arrow::field("lists", lists->type(), nullable)});
+  auto table = Table::Make(schema, {lists});
+  for (int64_t row_group_size : std::vector<int64_t>{1, 2, 3, lists->length()}) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(
+        table, row_group_size, default_arrow_writer_properties(), &buffer));
+    for (int64_t batch_size : {1, 2, 3, 4}) {
+      SCOPED_TRACE("row group size " + std::to_string(row_group_size) +
+                   ", batch size " + std::to_string(batch_size));
+      ArrowReaderProperties properties = default_arrow_reader_properties();
+      properties.set_batch_size(batch_size);
+      std::unique_ptr<FileReader> reader;
+      FileReaderBuilder builder;
+      ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+      ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+      std::vector<int> row_groups(reader->num_row_groups());
+      std::iota(row_groups.begin(), row_groups.end(), 0);
+      std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+      ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(row_groups, &rb_reader));
+      std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+      while (true) {
+        std::shared_ptr<::arrow::RecordBatch> batch;
+        ASSERT_OK(rb_reader->ReadNext(&batch));
+        if (batch == nullptr) {
+          break;
+        }
+        ASSERT_OK(batch->Validate());
+        ASSERT_LE(batch->num_rows(), batch_size);
+        batches.push_back(batch);
+      }
+      std::shared_ptr<Table> result;
+      ASSERT_OK(Table::FromRecordBatches(schema, batches, &result));
+      ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, ListNullabilityCombinationsInBatches) {
+  auto nullable_values = ::arrow::list(::arrow::int32());
+  auto required_values =
+      ::arrow::list(::arrow::field("item", ::arrow::int32(), false /* nullable */));
+  // Empty and null lists at the start, middle and end, and next to each other
+  ASSERT_NO_FATAL_FAILURE(CheckListBatches(
+      ::arrow::ArrayFromJSON(nullable_values,
+                             "[[], null, [1, null], [], null, [2], [null, null, 3], "
+                             "[], null]"),
+      true /* nullable */));
+  ASSERT_NO_FATAL_FAILURE(CheckListBatches(
+      ::arrow::ArrayFromJSON(required_values,
+                             "[null, [], [1, 2], null, [], [3], [4, 5, 6], null, []]"),
+      true /* nullable */));
+  ASSERT_NO_FATAL_FAILURE(CheckListBatches(
+      ::arrow::ArrayFromJSON(nullable_values,
+                             "[[], [null], [1, null], [], [], [2], [null, null, 3], []]"),
+      false /* nullable */));
+  ASSERT_NO_FATAL_FAILURE(CheckListBatches(
+      ::arrow::ArrayFromJSON(required_values,
+                             "[[], [1], [1, 2], [], [], [3], [4, 5, 6], []]"),
+      false /* nullable */));
+  // Nullable lists none of which is null
+  ASSERT_NO_FATAL_FAILURE(CheckListBatches(
+      ::arrow::ArrayFromJSON(nullable_values, "[[1], [], [null, 2], [3]]"),
+      true /* nullable */));
+}
+
+TEST(TestArrowReadWrite, ListNullsAndEmptyLists) {
+  auto type = ::arrow::list(::arrow::int32());
+  ASSERT_NO_FATAL_FAILURE(CheckListRoundtrip(::arrow::ArrayFromJSON(
+      type, "[[1, 2], [], null, [null, 3], [], null, [4, null, null], [5]]")));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckListRoundtrip(::arrow::ArrayFromJSON(type, "[[], [], []]")));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckListRoundtrip(::arrow::ArrayFromJSON(type, "[null, null, null]")));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckListRoundtrip(::arrow::ArrayFromJSON(type, "[[null], [], [null, null]]")));
+}
+
+TEST(TestArrowReadWrite, ListRequiredListsAndValues) {
+  auto required_values =
+      ::arrow::list(::arrow::field("item", ::arrow::int32(), false /* nullable */));
+  ASSERT_NO_FATAL_FAILURE(CheckListRoundtrip(
+      ::arrow::ArrayFromJSON(required_values, "[[1, 2], [], [3], [], [4, 5, 6]]"),
+      false /* nullable */));
+  ASSERT_NO_FATAL_FAILURE(CheckListRoundtrip(
+      ::arrow::ArrayFromJSON(required_values, "[[1], null, [], [2, 3], null]")));
+  ASSERT_NO_FATAL_FAILURE(CheckListRoundtrip(
+      ::arrow::ArrayFromJSON(::arrow::list(::arrow::int32()),
+                             "[[1, null], [], [null], [2]]"),
+      false /* nullable */));
+}
+
+TEST(TestArrowReadWrite, ListSlicedValues) {
+  // The values of the lists start at an offset into their buffers
+  auto values =
+      ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 1, null, 3, 4, null, 6, 7, 8]")
+          ->Slice(2);
+  auto offsets = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 2, 2, 5, 6, 7]");
+  std::shared_ptr<Array> lists;
+  ASSERT_OK(ListArray::FromArrays(*offsets, *values, default_memory_pool(), &lists));
+  ASSERT_NO_FATAL_FAILURE(CheckListRoundtrip(lists));
+}
+
+TEST(TestArrowReadWrite, ListNullValues) {
+  // The values are a NullArray, which has no validity bitmap
+  ASSERT_NO_FATAL_FAILURE(CheckListRoundtrip(::arrow::ArrayFromJSON(
+      ::arrow::list(::arrow::null()), "[[null, null], [], null, [null], null, []]")));
+}
+
 typedef std::function<void(int, std::shared_ptr<DataType>*, std::shared_ptr<Array>*)>
     ArrayFactory;
 
@@ -2152,6 +3115,33 @@ TEST(TestArrowReadWrite, TableWithDuplicateColumns) {
   ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, table->num_rows()));
 }
 
+TEST(TestArrowReadWrite, LargeBinaryTypes) {
+  auto strings = ::arrow::ArrayFromJSON(::arrow::large_utf8(),
+                                        R"(["foo", null, "", "barbaz", "q"])");
+  auto binaries =
+      ::arrow::ArrayFromJSON(::arrow::large_binary(), R"(["", "x", null, "yz", "w"])");
+  auto schema = ::arrow::schema({::arrow::field("s", ::arrow::large_utf8()),
+                                 ::arrow::field("b", ::arrow::large_binary())});
+  auto table = Table::Make(schema, {strings, binaries});
+
+  // The 64-bit offsets are restored from the stored Arrow schema
+  auto props_store_schema = ArrowWriterProperties::Builder().store_schema()->build();
+  std::shared_ptr<Table> actual;
+  DoRoundtrip(table, /*row_group_size=*/2, &actual, default_writer_properties(),
+              props_store_schema);
+  ASSERT_OK(actual->Validate());
+  ::arrow::AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+
+  auto expected_schema = ::arrow::schema(
+      {::arrow::field("s", ::arrow::utf8()), ::arrow::field("b", ::arrow::binary())});
+  auto expected = Table::Make(
+      expected_schema,
+      {::arrow::ArrayFromJSON(::arrow::utf8(), R"(["foo", null, "", "barbaz", "q"])"),
+       ::arrow::ArrayFromJSON(::arrow::binary(), R"(["", "x", null, "yz", "w"])")});
+  DoRoundtrip(table, /*row_group_size=*/2, &actual);
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(TestArrowReadWrite, DictionaryColumnChunkedWrite) {
   // This is a regression test for this:
   //
@@ -2234,9 +3224,8 @@ class TestNestedSchemaRead : public ::testing::TestWithParam<Repetition::type> {
   std::shared_ptr<::arrow::Int32Array> values_array_ = nullptr;
 
   void InitReader() {
-    std::shared_ptr<Buffer> buffer;
-    ASSERT_OK_NO_THROW(nested_parquet_->Finish(&buffer));
-    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+    ASSERT_OK_NO_THROW(nested_parquet_->Finish(&nested_buffer_));
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(nested_buffer_),
                                 ::arrow::default_memory_pool(), &reader_));
   }
 
@@ -2476,6 +3465,7 @@ class TestNestedSchemaRead : public ::testing::TestWithParam<Repetition::type> {
   };
 
   std::shared_ptr<::arrow::io::BufferOutputStream> nested_parquet_;
+  std::shared_ptr<Buffer> nested_buffer_;
   std::unique_ptr<FileReader> reader_;
   std::unique_ptr<ParquetFileWriter> writer_;
   RowGroupWriter* row_group_writer_;
@@ -2513,6 +3503,40 @@ TEST_F(TestNestedSchemaRead, ReadIntoTableFull) {
   ASSERT_NO_FATAL_FAILURE(ValidateColumnArray(*leaf3_array, 0));
 }
 
+TEST_F(TestNestedSchemaRead, ReadStructInBatches) {
+  ASSERT_NO_FATAL_FAILURE(CreateSimpleNestedParquet(Repetition::OPTIONAL));
+
+  // Batches whose validity bitmaps end partway through a byte
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(7);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(nested_buffer_)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0}, {0, 1}, &rb_reader));
+  int64_t row = 0;
+  while (true) {
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    ASSERT_OK(rb_reader->ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    ASSERT_OK(batch->Validate());
+    const auto& struct_array =
+        static_cast<const ::arrow::StructArray&>(*batch->column(0));
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < struct_array.length(); ++i, ++row) {
+      // group1 is null in every third row
+      ASSERT_EQ(row % 3 != 0, struct_array.IsValid(i)) << "row " << row;
+      null_count += row % 3 == 0;
+    }
+    ASSERT_EQ(null_count, struct_array.null_count());
+  }
+  ASSERT_EQ(NUM_SIMPLE_TEST_ROWS, row);
+}
+
 TEST_F(TestNestedSchemaRead, ReadTablePartial) {
   ASSERT_NO_FATAL_FAILURE(CreateSimpleNestedParquet(Repetition::OPTIONAL));
   std::shared_ptr<Table> table;
@@ -2840,6 +3864,26 @@ TEST_P(TestArrowReadDictionary, ReadWholeFileDict) {
   CheckReadWholeFile(*ex_table);
 }
 
+TEST_P(TestArrowReadDictionary, ReadWholeFileUnifiedDict) {
+  properties_.set_read_dictionary(0, true);
+  properties_.set_unify_dictionaries(true);
+
+  // A single chunk whose dictionary lists the values of all row groups in
+  // order of first appearance
+  std::shared_ptr<Array> expected;
+  AsDictionary32Encoded(*dense_values_, &expected);
+  auto ex_table = MakeSimpleTable(expected, /*nullable=*/true);
+  CheckReadWholeFile(*ex_table);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer_)));
+  ASSERT_OK(builder.properties(properties_)->Build(&reader));
+  std::shared_ptr<ChunkedArray> column;
+  ASSERT_OK_NO_THROW(reader->ReadColumn(0, &column));
+  ASSERT_EQ(1, column->num_chunks());
+}
+
 TEST_P(TestArrowReadDictionary, ReadWholeFileDense) {
   properties_.set_read_dictionary(0, false);
   CheckReadWholeFile(*expected_dense_);
@@ -2874,6 +3918,79 @@ TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowWriteDictionaries, ChangingDictionariesStayDictionaryEncoded) {
+  constexpr int num_unique = 50;
+  constexpr int repeat = 1000;
+  constexpr int64_t min_length = 2;
+  constexpr int64_t max_length = 20;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto values = rag.StringWithRepeats(repeat * num_unique, num_unique, min_length,
+                                      max_length, /*null_probability=*/0.1);
+  auto expected = MakeSimpleTable(values, /*nullable=*/true);
+
+  const int num_chunks = 10;
+  std::vector<std::shared_ptr<Array>> chunks(num_chunks);
+  const int64_t chunk_size = values->length() / num_chunks;
+  for (int i = 0; i < num_chunks; ++i) {
+    AsDictionary32Encoded(*values->Slice(chunk_size * i, chunk_size), &chunks[i]);
+  }
+  auto dict_table = MakeSimpleTable(std::make_shared<ChunkedArray>(chunks),
+                                    /*nullable=*/true);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(dict_table, values->length() / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  // The dictionaries of all chunks are merged rather than falling back to
+  // PLAIN encoding
+  auto file_reader = ParquetFileReader::Open(std::make_shared<BufferReader>(buffer));
+  ASSERT_EQ(2, file_reader->metadata()->num_row_groups());
+  for (int i = 0; i < file_reader->metadata()->num_row_groups(); ++i) {
+    auto page_reader = file_reader->RowGroup(i)->GetColumnPageReader(0);
+    std::shared_ptr<Page> page;
+    while ((page = page_reader->NextPage()) != nullptr) {
+      if (page->type() == PageType::DATA_PAGE) {
+        ASSERT_EQ(Encoding::PLAIN_DICTIONARY,
+                  static_cast<const DataPage&>(*page).encoding());
+      }
+    }
+  }
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(), &reader));
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowWriteDictionaries, UnifiedDictionaryWithPlainFallback) {
+  constexpr int num_unique = 1000;
+  constexpr int repeat = 20;
+  constexpr int64_t min_length = 2;
+  constexpr int64_t max_length = 20;
+  ::arrow::random::RandomArrayGenerator rag(0);
+  auto values = rag.StringWithRepeats(repeat * num_unique, num_unique, min_length,
+                                      max_length, /*null_probability=*/0.1);
+  std::shared_ptr<Array> dict_values;
+  AsDictionary32Encoded(*values, &dict_values);
+  auto expected = MakeSimpleTable(dict_values, /*nullable=*/true);
+
+  // A small dictionary page limit makes each column chunk fall back to plain
+  // encoding after its first few values
+  auto writer_properties =
+      WriterProperties::Builder().dictionary_pagesize_limit(1024)->build();
+  ArrowReaderProperties reader_properties = default_arrow_reader_properties();
+  reader_properties.set_read_dictionary(0, true);
+  reader_properties.set_unify_dictionaries(true);
+
+  std::shared_ptr<Table> actual;
+  DoRoundtrip(expected, values->length() / 4, &actual, writer_properties,
+              default_arrow_writer_properties(), reader_properties);
+  ASSERT_EQ(1, actual->column(0)->num_chunks());
+  ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(TestArrowWriteDictionaries, AutoReadAsDictionary) {
   constexpr int num_unique = 50;
   constexpr int repeat = 100;
@@ -0,0 +1,179 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/arrow/column_summary.h"
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/checked_cast.h"
+
+#include "parquet/column_reader.h"
+#include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/types.h"
+
+using arrow::Status;
+using arrow::internal::checked_cast;
+
+namespace parquet {
+namespace arrow {
+
+namespace {
+
+constexpr int64_t kSummaryBatchSize = 4096;
+
+// Whether the statistics of a column chunk give its exact null count and,
+// unless it only has nulls, its min and max
+bool HasCompleteStatistics(const ColumnChunkMetaData& chunk,
+                           const Statistics* statistics) {
+  return statistics != nullptr && chunk.is_null_count_set() &&
+         (statistics->HasMinMax() || statistics->num_values() == 0);
+}
+
+// Read a column chunk, counting its values and nulls into summary, and
+// updating statistics with the values if it isn't null
+template <typename DType>
+void ReadColumnChunk(ColumnReader* untyped_reader, TypedStatistics<DType>* statistics,
+                     ColumnSummary* summary) {
+  using T = typename DType::c_type;
+  auto reader = checked_cast<TypedColumnReader<DType>*>(untyped_reader);
+  std::vector<int16_t> def_levels(kSummaryBatchSize);
+  std::vector<int16_t> rep_levels(kSummaryBatchSize);
+  std::unique_ptr<T[]> values(new T[kSummaryBatchSize]);
+
+  while (reader->HasNext()) {
+    int64_t values_read = 0;
+    int64_t levels_read =
+        reader->ReadBatch(kSummaryBatchSize, def_levels.data(), rep_levels.data(),
+                          values.get(), &values_read);
+    int64_t num_null = levels_read - values_read;
+    summary->num_values += values_read;
+    summary->null_count += num_null;
+    // The values are only valid until the next ReadBatch, Update copies the
+    // min and max it keeps
+    if (statistics != nullptr) {
+      statistics->Update(values.get(), values_read, num_null);
+    }
+  }
+}
+
+template <typename DType>
+void SummarizeColumn(ParquetFileReader* reader, int column_index, ColumnSummary* out,
+                     int64_t* num_chunks_read) {
+  const FileMetaData& metadata = *reader->metadata();
+  const ColumnDescriptor* descr = metadata.schema()->Column(column_index);
+
+  // Min and max are only kept for the columns whose order is known
+  std::shared_ptr<TypedStatistics<DType>> merged;
+  if (descr->sort_order() != SortOrder::UNKNOWN) {
+    merged = MakeStatistics<DType>(descr);
+  }
+
+  ColumnSummary summary;
+  for (int i = 0; i < metadata.num_row_groups(); ++i) {
+    auto chunk = metadata.RowGroup(i)->ColumnChunk(column_index);
+    std::shared_ptr<Statistics> statistics = chunk->statistics();
+    if (HasCompleteStatistics(*chunk, statistics.get())) {
+      summary.num_values += statistics->num_values();
+      summary.null_count += statistics->null_count();
+      merged->Merge(checked_cast<const TypedStatistics<DType>&>(*statistics));
+      continue;
+    }
+
+    std::shared_ptr<TypedStatistics<DType>> chunk_statistics;
+    if (merged != nullptr) {
+      chunk_statistics = MakeStatistics<DType>(descr);
+    }
+    ReadColumnChunk<DType>(reader->RowGroup(i)->Column(column_index).get(),
+                           chunk_statistics.get(), &summary);
+    if (merged != nullptr) {
+      merged->Merge(*chunk_statistics);
+    }
+    ++*num_chunks_read;
+  }
+
+  summary.statistics = std::move(merged);
+  *out = std::move(summary);
+}
+
+}  // namespace
+
+Status SummarizeColumns(ParquetFileReader* reader, const std::vector<int>& column_indices,
+                        FileSummary* out) {
+  const FileMetaData& metadata = *reader->metadata();
+  for (int column_index : column_indices) {
+    if (column_index < 0 || column_index >= metadata.num_columns()) {
+      return Status::Invalid("Column index ", column_index,
+                             " out of range for schema with ", metadata.num_columns(),
+                             " columns");
+    }
+  }
+
+  FileSummary summary;
+  summary.num_rows = metadata.num_rows();
+  summary.columns.resize(column_indices.size());
+  try {
+    for (size_t i = 0; i < column_indices.size(); ++i) {
+      int column_index = column_indices[i];
+      ColumnSummary* column = &summary.columns[i];
+      int64_t* num_chunks_read = &summary.num_chunks_read;
+      switch (metadata.schema()->Column(column_index)->physical_type()) {
+        case Type::BOOLEAN:
+          SummarizeColumn<BooleanType>(reader, column_index, column, num_chunks_read);
+          break;
+        case Type::INT32:
+          SummarizeColumn<Int32Type>(reader, column_index, column, num_chunks_read);
+          break;
+        case Type::INT64:
+          SummarizeColumn<Int64Type>(reader, column_index, column, num_chunks_read);
+          break;
+        case Type::INT96:
+          SummarizeColumn<Int96Type>(reader, column_index, column, num_chunks_read);
+          break;
+        case Type::FLOAT:
+          SummarizeColumn<FloatType>(reader, column_index, column, num_chunks_read);
+          break;
+        case Type::DOUBLE:
+          SummarizeColumn<DoubleType>(reader, column_index, column, num_chunks_read);
+          break;
+        case Type::BYTE_ARRAY:
+          SummarizeColumn<ByteArrayType>(reader, column_index, column, num_chunks_read);
+          break;
+        case Type::FIXED_LEN_BYTE_ARRAY:
+          SummarizeColumn<FLBAType>(reader, column_index, column, num_chunks_read);
+          break;
+        default:
+          return Status::NotImplemented("Summarizing column ", column_index,
+                                        " of unknown physical type");
+      }
+    }
+  } catch (const ParquetException& e) {
+    return Status::IOError(e.what());
+  }
+
+  *out = std::move(summary);
+  return Status::OK();
+}
+
+}  // namespace arrow
+}  // namespace parquet
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class ParquetFileReader;
+class Statistics;
+
+namespace arrow {
+
+/// \brief Aggregates of a leaf column over all the row groups of a file
+struct PARQUET_EXPORT ColumnSummary {
+  /// \brief The number of non-null values
+  int64_t num_values = 0;
+
+  /// \brief The number of null values. For a repeated column, null and
+  /// empty lists count as one null each.
+  int64_t null_count = 0;
+
+  /// \brief The merged statistics of the row groups, whose min() and max()
+  /// are those of the whole column. HasMinMax() is false if the column has
+  /// no non-null value other than NaN. nullptr if the sort order of the
+  /// column is unknown, e.g. for INT96 columns.
+  std::shared_ptr<Statistics> statistics;
+};
+
+/// \brief Aggregates of a Parquet file, see SummarizeColumns
+struct PARQUET_EXPORT FileSummary {
+  int64_t num_rows = 0;
+
+  /// \brief The summaries of the requested columns, in the requested order
+  std::vector<ColumnSummary> columns;
+
+  /// \brief The number of column chunks whose data pages had to be read
+  /// because their statistics were missing or incomplete
+  int64_t num_chunks_read = 0;
+};
+
+/// \brief Compute the row count of a file and the value counts, null counts,
+/// min and max of some of its leaf columns, from the file metadata where
+/// possible.
+///
+/// The statistics of a column chunk are used when they are known to be
+/// correct for the writer version, record the null count and, unless all
+/// the values are null, the min and max. The data pages of the other column
+/// chunks are read to compute their statistics, the other row groups are
+/// not read. With no columns, only the footer is used.
+///
+/// \param[in] reader the file to summarize
+/// \param[in] column_indices the leaf columns to summarize, as in
+/// FileReader::ReadRowGroups
+/// \param[out] out the summary
+PARQUET_EXPORT
+::arrow::Status SummarizeColumns(ParquetFileReader* reader,
+                                 const std::vector<int>& column_indices,
+                                 FileSummary* out);
+
+}  // namespace arrow
+}  // namespace parquet
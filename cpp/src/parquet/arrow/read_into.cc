@@ -0,0 +1,357 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/arrow/read_into.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "parquet/column_reader.h"
+#include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/types.h"
+
+using arrow::Status;
+using arrow::internal::checked_cast;
+
+namespace parquet {
+namespace arrow {
+
+namespace {
+
+constexpr int64_t kReadIntoBatchSize = 4096;
+
+constexpr int64_t kTimestampNull = std::numeric_limits<int64_t>::min();
+
+template <typename OutType>
+struct StaticCast {
+  template <typename T>
+  OutType operator()(T value) const {
+    return static_cast<OutType>(value);
+  }
+};
+
+// Reinterpret the value as unsigned before converting it
+template <typename UnsignedType, typename OutType>
+struct UnsignedCast {
+  template <typename T>
+  OutType operator()(T value) const {
+    return static_cast<OutType>(static_cast<UnsignedType>(value));
+  }
+};
+
+template <int64_t Factor>
+struct Multiply {
+  int64_t operator()(int64_t value) const { return value * Factor; }
+};
+
+struct Int96ToNanos {
+  int64_t operator()(const Int96& value) const { return Int96GetNanoSeconds(value); }
+};
+
+// Reads the chunks of a leaf column into consecutive rows of caller memory
+class ColumnIntoReader {
+ public:
+  ColumnIntoReader(ParquetFileReader* reader, int column_index)
+      : reader_(reader),
+        column_index_(column_index),
+        max_definition_level_(
+            reader->metadata()->schema()->Column(column_index)->max_definition_level()),
+        def_levels_(kReadIntoBatchSize) {}
+
+  // Decode the values directly into out, then move them towards the end of
+  // each batch to make room for the nulls
+  template <typename DType>
+  void ReadInPlace(typename DType::c_type null_value, typename DType::c_type* out) {
+    ReadRowGroups<DType>(out, [&](TypedColumnReader<DType>* reader, int64_t num_rows,
+                                  typename DType::c_type* chunk_out) {
+      int64_t row = 0;
+      while (row < num_rows && reader->HasNext()) {
+        int64_t batch_size = std::min(kReadIntoBatchSize, num_rows - row);
+        int64_t values_read = 0;
+        int64_t levels_read = reader->ReadBatch(batch_size, def_levels_.data(), nullptr,
+                                                chunk_out + row, &values_read);
+        if (levels_read > values_read) {
+          // From the back, so that no value is overwritten before it's moved
+          int64_t value = values_read;
+          for (int64_t i = levels_read - 1; i >= 0; --i) {
+            chunk_out[row + i] = def_levels_[i] == max_definition_level_
+                                     ? chunk_out[row + --value]
+                                     : null_value;
+          }
+          null_count_ += levels_read - values_read;
+        }
+        row += levels_read;
+      }
+      return row;
+    });
+  }
+
+  // Decode the values into a buffer, then write them converted into out
+  template <typename DType, typename OutType, typename Convert>
+  void ReadConverted(Convert&& convert, OutType null_value, OutType* out) {
+    std::vector<typename DType::c_type> values(kReadIntoBatchSize);
+    ReadRowGroups<DType>(out, [&](TypedColumnReader<DType>* reader, int64_t num_rows,
+                                  OutType* chunk_out) {
+      int64_t row = 0;
+      while (row < num_rows && reader->HasNext()) {
+        int64_t batch_size = std::min(kReadIntoBatchSize, num_rows - row);
+        int64_t values_read = 0;
+        int64_t levels_read = reader->ReadBatch(batch_size, def_levels_.data(), nullptr,
+                                                values.data(), &values_read);
+        if (levels_read == values_read) {
+          for (int64_t i = 0; i < levels_read; ++i) {
+            chunk_out[row + i] = convert(values[i]);
+          }
+        } else {
+          int64_t value = 0;
+          for (int64_t i = 0; i < levels_read; ++i) {
+            chunk_out[row + i] = def_levels_[i] == max_definition_level_
+                                     ? convert(values[value++])
+                                     : null_value;
+          }
+          null_count_ += levels_read - values_read;
+        }
+        row += levels_read;
+      }
+      return row;
+    });
+  }
+
+  int64_t null_count() const { return null_count_; }
+
+ private:
+  template <typename DType, typename OutType, typename ReadChunk>
+  void ReadRowGroups(OutType* out, ReadChunk&& read_chunk) {
+    const FileMetaData& metadata = *reader_->metadata();
+    int64_t offset = 0;
+    for (int i = 0; i < metadata.num_row_groups(); ++i) {
+      int64_t num_rows = metadata.RowGroup(i)->num_rows();
+      std::shared_ptr<ColumnReader> column = reader_->RowGroup(i)->Column(column_index_);
+      auto typed_column = checked_cast<TypedColumnReader<DType>*>(column.get());
+      // At most num_rows are read, so that a corrupt chunk can't write past
+      // the rows of its row group
+      if (read_chunk(typed_column, num_rows, out + offset) != num_rows ||
+          typed_column->HasNext()) {
+        std::stringstream ss;
+        ss << "Column chunk " << column_index_ << " of row group " << i
+           << " doesn't have the " << num_rows << " rows of its row group";
+        throw ParquetException(ss.str());
+      }
+      offset += num_rows;
+    }
+  }
+
+  ParquetFileReader* reader_;
+  int column_index_;
+  int16_t max_definition_level_;
+  std::vector<int16_t> def_levels_;
+  int64_t null_count_ = 0;
+};
+
+bool IsPlainInteger(const LogicalType& logical_type) {
+  return logical_type.is_none() || logical_type.is_int();
+}
+
+bool IsUnsigned(const LogicalType& logical_type) {
+  return logical_type.is_int() &&
+         !checked_cast<const IntLogicalType&>(logical_type).is_signed();
+}
+
+template <typename OutType>
+bool ReadIntegers(const ColumnDescriptor& descr, ColumnIntoReader* reader,
+                  uint8_t* out) {
+  if (!IsPlainInteger(*descr.logical_type())) {
+    return false;
+  }
+  auto values = reinterpret_cast<OutType*>(out);
+  if (descr.physical_type() == Type::INT32 && sizeof(OutType) == sizeof(int32_t)) {
+    reader->ReadInPlace<Int32Type>(0, reinterpret_cast<int32_t*>(out));
+  } else if (descr.physical_type() == Type::INT32 && sizeof(OutType) < sizeof(int32_t)) {
+    reader->ReadConverted<Int32Type>(StaticCast<OutType>(), OutType(0), values);
+  } else if (descr.physical_type() == Type::INT64 && sizeof(OutType) == sizeof(int64_t)) {
+    reader->ReadInPlace<Int64Type>(0, reinterpret_cast<int64_t*>(out));
+  } else {
+    return false;
+  }
+  return true;
+}
+
+template <typename OutType>
+bool ReadFloatingPoint(const ColumnDescriptor& descr, ColumnIntoReader* reader,
+                       uint8_t* out) {
+  const OutType null_value = static_cast<OutType>(NAN);
+  auto values = reinterpret_cast<OutType*>(out);
+  const LogicalType& logical_type = *descr.logical_type();
+  switch (descr.physical_type()) {
+    case Type::FLOAT:
+      if (sizeof(OutType) == sizeof(float)) {
+        reader->ReadInPlace<FloatType>(NAN, reinterpret_cast<float*>(out));
+      } else {
+        reader->ReadConverted<FloatType>(StaticCast<OutType>(), null_value, values);
+      }
+      return true;
+    case Type::DOUBLE:
+      if (sizeof(OutType) != sizeof(double)) {
+        return false;
+      }
+      reader->ReadInPlace<DoubleType>(NAN, reinterpret_cast<double*>(out));
+      return true;
+    case Type::INT32:
+      if (sizeof(OutType) != sizeof(double) || !IsPlainInteger(logical_type)) {
+        return false;
+      } else if (IsUnsigned(logical_type)) {
+        reader->ReadConverted<Int32Type>(UnsignedCast<uint32_t, OutType>(), null_value,
+                                         values);
+      } else {
+        reader->ReadConverted<Int32Type>(StaticCast<OutType>(), null_value, values);
+      }
+      return true;
+    case Type::INT64:
+      if (sizeof(OutType) != sizeof(double) || !IsPlainInteger(logical_type)) {
+        return false;
+      } else if (IsUnsigned(logical_type)) {
+        reader->ReadConverted<Int64Type>(UnsignedCast<uint64_t, OutType>(), null_value,
+                                         values);
+      } else {
+        reader->ReadConverted<Int64Type>(StaticCast<OutType>(), null_value, values);
+      }
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool ReadTimestampNanos(const ColumnDescriptor& descr, ColumnIntoReader* reader,
+                        uint8_t* out) {
+  auto values = reinterpret_cast<int64_t*>(out);
+  const LogicalType& logical_type = *descr.logical_type();
+  if (descr.physical_type() == Type::INT96) {
+    reader->ReadConverted<Int96Type>(Int96ToNanos(), kTimestampNull, values);
+    return true;
+  }
+  if (descr.physical_type() == Type::INT32 && logical_type.is_date()) {
+    reader->ReadConverted<Int32Type>(Multiply<kNanosecondsPerDay>(), kTimestampNull,
+                                     values);
+    return true;
+  }
+  if (descr.physical_type() != Type::INT64 || !logical_type.is_timestamp()) {
+    return false;
+  }
+  switch (checked_cast<const TimestampLogicalType&>(logical_type).time_unit()) {
+    case LogicalType::TimeUnit::MILLIS:
+      reader->ReadConverted<Int64Type>(Multiply<1000000>(), kTimestampNull, values);
+      return true;
+    case LogicalType::TimeUnit::MICROS:
+      reader->ReadConverted<Int64Type>(Multiply<1000>(), kTimestampNull, values);
+      return true;
+    case LogicalType::TimeUnit::NANOS:
+      reader->ReadInPlace<Int64Type>(kTimestampNull, values);
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+Status ReadColumnInto(ParquetFileReader* reader, int column_index,
+                      const ::arrow::DataType& out_type, uint8_t* out, bool* done) {
+  *done = false;
+  const FileMetaData& metadata = *reader->metadata();
+  if (column_index < 0 || column_index >= metadata.num_columns()) {
+    return Status::Invalid("Column index ", column_index,
+                           " out of range for schema with ", metadata.num_columns(),
+                           " columns");
+  }
+  const ColumnDescriptor& descr = *metadata.schema()->Column(column_index);
+  if (descr.max_repetition_level() > 0) {
+    return Status::OK();
+  }
+
+  bool read = false;
+  bool nullable = false;
+  try {
+    ColumnIntoReader column(reader, column_index);
+    switch (out_type.id()) {
+      case ::arrow::Type::UINT8:
+        read = ReadIntegers<uint8_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::INT8:
+        read = ReadIntegers<int8_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::UINT16:
+        read = ReadIntegers<uint16_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::INT16:
+        read = ReadIntegers<int16_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::UINT32:
+        read = ReadIntegers<uint32_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::INT32:
+        read = ReadIntegers<int32_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::UINT64:
+        read = ReadIntegers<uint64_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::INT64:
+        read = ReadIntegers<int64_t>(descr, &column, out);
+        break;
+      case ::arrow::Type::FLOAT:
+        read = ReadFloatingPoint<float>(descr, &column, out);
+        nullable = true;
+        break;
+      case ::arrow::Type::DOUBLE:
+        read = ReadFloatingPoint<double>(descr, &column, out);
+        nullable = true;
+        break;
+      case ::arrow::Type::TIMESTAMP:
+        if (checked_cast<const ::arrow::TimestampType&>(out_type).unit() ==
+            ::arrow::TimeUnit::NANO) {
+          read = ReadTimestampNanos(descr, &column, out);
+          nullable = true;
+        }
+        break;
+      default:
+        break;
+    }
+    if (read && !nullable && column.null_count() > 0) {
+      return Status::Invalid("Column ", column_index, " has ", column.null_count(),
+                             " nulls, which ", out_type.ToString(),
+                             " values cannot represent");
+    }
+  } catch (const ParquetException& e) {
+    return Status::IOError(e.what());
+  }
+
+  *done = read;
+  return Status::OK();
+}
+
+}  // namespace arrow
+}  // namespace parquet
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "parquet/platform.h"
+
+namespace arrow {
+
+class DataType;
+
+}  // namespace arrow
+
+namespace parquet {
+
+class ParquetFileReader;
+
+namespace arrow {
+
+/// \brief Decode all the values of a flat leaf column into caller-allocated
+/// memory, without building Arrow arrays.
+///
+/// out must hold metadata()->num_rows() values of the C type of out_type,
+/// which are written in row order. The supported conversions are those the
+/// Arrow reader followed by a cast would perform:
+///
+/// - integer out types from INT32 or INT64 columns at least as wide, which
+///   must not have nulls
+/// - float32 from FLOAT columns, nulls written as NaN
+/// - float64 from FLOAT, DOUBLE, INT32 and INT64 columns, nulls written as
+///   NaN; unsigned integer columns keep their unsigned values
+/// - timestamp[ns] from DATE, TIMESTAMP and INT96 columns, nulls written as
+///   INT64_MIN
+///
+/// Columns whose values need no conversion are decoded in place in out,
+/// other columns through a small buffer. The caller is responsible for
+/// choosing out_type consistently with the Arrow type of the column, e.g.
+/// uint32 for an unsigned 32-bit column.
+///
+/// \param[in] reader the file to read
+/// \param[in] column_index the leaf column to read
+/// \param[in] out_type the type of the values to write
+/// \param[out] out the memory to write the values to
+/// \param[out] done false if the column is repeated or the conversion is not
+/// supported, in which case nothing was read
+PARQUET_EXPORT
+::arrow::Status ReadColumnInto(ParquetFileReader* reader, int column_index,
+                               const ::arrow::DataType& out_type, uint8_t* out,
+                               bool* done);
+
+}  // namespace arrow
+}  // namespace parquet
@@ -24,14 +24,19 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/range.h"
 #include "arrow/util/thread_pool.h"
 
 #include "parquet/arrow/reader_internal.h"
+#include "parquet/arrow/row_group_filter.h"
+#include "parquet/column_page.h"
 #include "parquet/column_reader.h"
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
@@ -85,6 +90,33 @@ class ColumnReaderImpl : public ColumnReader {
   virtual const ColumnDescriptor* descr() const = 0;
 
   virtual ReaderType type() const = 0;
+
+  // Skip the next num_records records, or the remaining ones if fewer
+  virtual Status SkipRecords(int64_t num_records) = 0;
+
+  struct RecordRange {
+    // Counted from the current position of the reader
+    int64_t offset;
+    int64_t length;
+  };
+
+  // Read the records in the given ranges, in increasing order and not
+  // overlapping, skipping those in between. By default each range is read as
+  // a separate batch
+  virtual Status ReadRanges(const std::vector<RecordRange>& ranges,
+                            std::shared_ptr<ChunkedArray>* out) {
+    std::vector<std::shared_ptr<Array>> chunks;
+    int64_t position = 0;
+    for (const RecordRange& range : ranges) {
+      RETURN_NOT_OK(SkipRecords(range.offset - position));
+      std::shared_ptr<ChunkedArray> batch;
+      RETURN_NOT_OK(NextBatch(range.length, &batch));
+      chunks.insert(chunks.end(), batch->chunks().begin(), batch->chunks().end());
+      position = range.offset + range.length;
+    }
+    *out = std::make_shared<ChunkedArray>(chunks, field()->type());
+    return Status::OK();
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -102,9 +134,11 @@ class FileReaderImpl : public FileReader {
                                reader_properties_, &manifest_);
   }
 
-  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups) {
-    return [row_groups](int i, ParquetFileReader* reader) {
-      return new FileColumnIterator(i, reader, row_groups);
+  FileColumnIteratorFactory SomeRowGroupsFactory(
+      std::vector<int> row_groups,
+      std::shared_ptr<RowGroupPrefetcher> prefetcher = NULLPTR) {
+    return [row_groups, prefetcher](int i, ParquetFileReader* reader) {
+      return new FileColumnIterator(i, reader, row_groups, prefetcher);
     };
   }
 
@@ -153,12 +187,15 @@ class FileReaderImpl : public FileReader {
 
   Status GetFieldReader(int i, const std::vector<int>& indices,
                         const std::vector<int>& row_groups,
-                        std::unique_ptr<ColumnReaderImpl>* out) {
+                        std::unique_ptr<ColumnReaderImpl>* out,
+                        std::shared_ptr<RowGroupPrefetcher> prefetcher = NULLPTR) {
     ReaderContext ctx;
     ctx.reader = reader_.get();
     ctx.pool = pool_;
-    ctx.iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx.iterator_factory = SomeRowGroupsFactory(row_groups, std::move(prefetcher));
     ctx.filter_leaves = true;
+    ctx.unify_dictionaries = reader_properties_.unify_dictionaries();
+    ctx.zero_copy_reads = reader_properties_.zero_copy_reads();
     ctx.included_leaves.insert(indices.begin(), indices.end());
     return manifest_.schema_fields[i].GetReader(ctx, out);
   }
@@ -236,6 +273,21 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroups(row_groups, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowGroups(const std::vector<int>& row_groups,
+                       const std::vector<int>& indices, int filter_column_index,
+                       const RowSelector& selector,
+                       std::shared_ptr<Table>* out) override;
+
+  Status FilterRowGroups(const RowGroupFilter& filter,
+                         std::vector<int>* row_groups) override;
+
+  Status ReadTable(const RowGroupFilter& filter, const std::vector<int>& column_indices,
+                   std::shared_ptr<Table>* out) override {
+    std::vector<int> row_groups;
+    RETURN_NOT_OK(FilterRowGroups(filter, &row_groups));
+    return ReadRowGroups(row_groups, column_indices, out);
+  }
+
   Status ReadRowGroup(int row_group_index, const std::vector<int>& column_indices,
                       std::shared_ptr<Table>* out) override {
     return ReadRowGroups({row_group_index}, column_indices, out);
@@ -300,41 +352,63 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
     if (!reader->manifest_.GetFieldIndices(column_indices, &field_indices)) {
       return Status::Invalid("Invalid column index");
     }
+    // The column iterators of all fields advance through the row groups
+    // together, so they share the prefetching of the row groups ahead
+    std::shared_ptr<RowGroupPrefetcher> prefetcher;
+    const int prefetch_row_groups = reader->reader_properties_.prefetch_row_groups();
+    if (prefetch_row_groups > 0) {
+      prefetcher = std::make_shared<RowGroupPrefetcher>(
+          reader->parquet_reader(), row_groups, column_indices, prefetch_row_groups);
+    }
     std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers(field_indices.size());
     std::vector<std::shared_ptr<Field>> fields;
+    // Creating the field readers reads their first column chunks
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
     for (size_t i = 0; i < field_indices.size(); ++i) {
       RETURN_NOT_OK(reader->GetFieldReader(field_indices[i], column_indices, row_groups,
-                                           &field_readers[i]));
+                                           &field_readers[i], prefetcher));
       fields.push_back(field_readers[i]->field());
     }
+    END_PARQUET_CATCH_EXCEPTIONS
     out->reset(new RowGroupRecordBatchReader(std::move(field_readers),
                                              ::arrow::schema(fields), batch_size));
     return Status::OK();
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
+    // Drain the batches of the previous table first: its columns may be
+    // chunked, e.g. one chunk per data page when reading zero-copy
+    if (table_batch_reader_ != nullptr) {
+      RETURN_NOT_OK(table_batch_reader_->ReadNext(out));
+      if (*out != nullptr) {
+        return Status::OK();
+      }
+      table_batch_reader_.reset();
+      table_.reset();
+    }
+
     // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
     // does not currently honor the use_threads option.
     std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
     for (size_t i = 0; i < field_readers_.size(); ++i) {
       RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
-        return Status::NotImplemented("This class cannot yet iterate chunked arrays");
-      }
     }
 
     // Create an intermediate table and use TableBatchReader as an adaptor to a
     // RecordBatch
-    std::shared_ptr<Table> table = Table::Make(schema_, columns);
-    RETURN_NOT_OK(table->Validate());
-    ::arrow::TableBatchReader table_batch_reader(*table);
-    return table_batch_reader.ReadNext(out);
+    table_ = Table::Make(schema_, columns);
+    RETURN_NOT_OK(table_->Validate());
+    table_batch_reader_.reset(new ::arrow::TableBatchReader(*table_));
+    table_batch_reader_->set_chunksize(batch_size_);
+    return table_batch_reader_->ReadNext(out);
   }
 
  private:
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+  std::shared_ptr<Table> table_;
+  std::unique_ptr<::arrow::TableBatchReader> table_batch_reader_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -407,17 +481,35 @@ class LeafReader : public ColumnReaderImpl {
              std::unique_ptr<FileColumnIterator> input)
       : ctx_(ctx), field_(field), input_(std::move(input)), descr_(input_->descr()) {
     record_reader_ = RecordReader::Make(descr_, ctx_.pool,
-                                        field->type()->id() == ::arrow::Type::DICTIONARY);
-    NextRowGroup();
+                                        field->type()->id() == ::arrow::Type::DICTIONARY,
+                                        ctx_.unify_dictionaries);
+    // Only the readers of nested fields ask their children for levels, so
+    // those of a top-level column can go straight to its validity bitmap
+    record_reader_->set_materialize_levels(!IsTopLevel());
+    zero_copy_ = ctx_.zero_copy_reads && CanReadZeroCopy();
+    if (!zero_copy_) {
+      NextRowGroup();
+    }
   }
 
   Status GetDefLevels(const int16_t** data, int64_t* length) override {
+    if (zero_copy_) {
+      // Required top-level column: no levels
+      *data = nullptr;
+      *length = 0;
+      return Status::OK();
+    }
     *data = record_reader_->def_levels();
     *length = record_reader_->levels_position();
     return Status::OK();
   }
 
   Status GetRepLevels(const int16_t** data, int64_t* length) override {
+    if (zero_copy_) {
+      *data = nullptr;
+      *length = 0;
+      return Status::OK();
+    }
     *data = record_reader_->rep_levels();
     *length = record_reader_->levels_position();
     return Status::OK();
@@ -425,27 +517,49 @@ class LeafReader : public ColumnReaderImpl {
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
+    if (zero_copy_) {
+      NextZeroCopyBatch(records_to_read, out);
+      return Status::OK();
+    }
 
     // Pre-allocation gives much better performance for flat columns
     record_reader_->Reserve(records_to_read);
 
     record_reader_->Reset();
-    while (records_to_read > 0) {
-      if (!record_reader_->HasMoreData()) {
-        break;
-      }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
-      records_to_read -= records_read;
-      if (records_read == 0) {
-        NextRowGroup();
-      }
-    }
+    ReadRecords(records_to_read);
     RETURN_NOT_OK(
         TransferColumnData(record_reader_.get(), field_->type(), descr_, ctx_.pool, out));
     return Status::OK();
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  Status SkipRecords(int64_t num_records) override {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    Skip(num_records);
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  // Accumulate the records of all ranges in the record reader so that they
+  // are transferred to contiguous arrays
+  Status ReadRanges(const std::vector<RecordRange>& ranges,
+                    std::shared_ptr<ChunkedArray>* out) override {
+    if (zero_copy_) {
+      return ColumnReaderImpl::ReadRanges(ranges, out);
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    record_reader_->Reset();
+    int64_t position = 0;
+    for (const RecordRange& range : ranges) {
+      Skip(range.offset - position);
+      ReadRecords(range.length);
+      position = range.offset + range.length;
+    }
+    return TransferColumnData(record_reader_.get(), field_->type(), descr_, ctx_.pool,
+                              out);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   const std::shared_ptr<Field> field() override { return field_; }
   const ColumnDescriptor* descr() const override { return descr_; }
 
@@ -457,11 +571,167 @@ class LeafReader : public ColumnReaderImpl {
     record_reader_->SetPageReader(std::move(page_reader));
   }
 
+  // Read records into the record reader, moving on to the next row groups as
+  // needed
+  void ReadRecords(int64_t records_to_read) {
+    while (records_to_read > 0) {
+      if (!record_reader_->HasMoreData()) {
+        break;
+      }
+      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      records_to_read -= records_read;
+      if (records_read == 0) {
+        NextRowGroup();
+      }
+    }
+  }
+
+  void Skip(int64_t num_records) {
+    if (zero_copy_) {
+      while (num_records > 0) {
+        if (page_values_remaining_ == 0 && !NextZeroCopyPage()) {
+          break;
+        }
+        const int64_t skipped = std::min(num_records, page_values_remaining_);
+        page_values_remaining_ -= skipped;
+        num_records -= skipped;
+      }
+      return;
+    }
+    while (num_records > 0 && record_reader_->HasMoreData()) {
+      int64_t records_skipped = record_reader_->SkipRecords(num_records);
+      num_records -= records_skipped;
+      if (records_skipped == 0) {
+        NextRowGroup();
+      }
+    }
+  }
+
+  bool IsTopLevel() const {
+    const schema::Node* parent = descr_->schema_node()->parent();
+    return parent != nullptr && parent->parent() == nullptr;
+  }
+
+  // Whether the values can be sliced out of the data pages as they are: the
+  // column is required and top-level, the Arrow type has the layout of the
+  // physical type, and no column chunk is compressed or dictionary-encoded
+  bool CanReadZeroCopy() const {
+    if (descr_->max_definition_level() != 0 || descr_->max_repetition_level() != 0 ||
+        !IsTopLevel()) {
+      return false;
+    }
+    if (!HasPhysicalLayout(*field_->type(), descr_->physical_type())) {
+      return false;
+    }
+    std::shared_ptr<FileMetaData> metadata = input_->metadata();
+    for (int row_group : input_->row_groups()) {
+      std::unique_ptr<ColumnChunkMetaData> chunk =
+          metadata->RowGroup(row_group)->ColumnChunk(input_->column_index());
+      if (chunk->compression() != Compression::UNCOMPRESSED ||
+          chunk->has_dictionary_page()) {
+        return false;
+      }
+      for (Encoding::type encoding : chunk->encodings()) {
+        // RLE and BIT_PACKED are only listed for the (empty) levels
+        if (encoding != Encoding::PLAIN && encoding != Encoding::RLE &&
+            encoding != Encoding::BIT_PACKED) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  static bool HasPhysicalLayout(const DataType& type, Type::type physical_type) {
+    switch (physical_type) {
+      case Type::INT32:
+        return type.id() == ::arrow::Type::INT32 || type.id() == ::arrow::Type::UINT32 ||
+               type.id() == ::arrow::Type::DATE32 || type.id() == ::arrow::Type::TIME32;
+      case Type::INT64:
+        return type.id() == ::arrow::Type::INT64 || type.id() == ::arrow::Type::UINT64 ||
+               type.id() == ::arrow::Type::TIME64 ||
+               type.id() == ::arrow::Type::TIMESTAMP;
+      case Type::FLOAT:
+        return type.id() == ::arrow::Type::FLOAT;
+      case Type::DOUBLE:
+        return type.id() == ::arrow::Type::DOUBLE;
+      default:
+        return false;
+    }
+  }
+
+  // Advance to the next data page holding values, returning false at the end
+  // of the column
+  bool NextZeroCopyPage() {
+    while (true) {
+      if (page_reader_ == nullptr) {
+        page_reader_ = input_->NextChunk();
+        if (page_reader_ == nullptr) {
+          return false;
+        }
+      }
+      std::shared_ptr<Page> page = page_reader_->NextPage();
+      if (page == nullptr) {
+        page_reader_.reset();
+        continue;
+      }
+      int64_t levels_byte_length = 0;
+      if (page->type() == PageType::DATA_PAGE_V2) {
+        const auto& page_v2 = static_cast<const DataPageV2&>(*page);
+        levels_byte_length = page_v2.definition_levels_byte_length() +
+                             page_v2.repetition_levels_byte_length();
+      } else if (page->type() != PageType::DATA_PAGE) {
+        throw ParquetException("Unexpected page in column chunk without dictionary");
+      }
+      const auto& data_page = static_cast<const DataPage&>(*page);
+      if (data_page.encoding() != Encoding::PLAIN) {
+        throw ParquetException("Zero-copy reads require PLAIN-encoded data pages");
+      }
+      const int64_t byte_width = GetTypeByteSize(descr_->physical_type());
+      if (levels_byte_length + data_page.num_values() * byte_width > page->size()) {
+        throw ParquetException("Data page is smaller than its values");
+      }
+      if (data_page.num_values() == 0) {
+        continue;
+      }
+      page_values_ = ::arrow::SliceBuffer(page->buffer(), levels_byte_length,
+                                 data_page.num_values() * byte_width);
+      page_values_remaining_ = data_page.num_values();
+      return true;
+    }
+  }
+
+  void NextZeroCopyBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) {
+    const int64_t byte_width = GetTypeByteSize(descr_->physical_type());
+    std::vector<std::shared_ptr<Array>> chunks;
+    while (records_to_read > 0) {
+      if (page_values_remaining_ == 0 && !NextZeroCopyPage()) {
+        break;
+      }
+      const int64_t length = std::min(records_to_read, page_values_remaining_);
+      const int64_t offset = page_values_->size() / byte_width - page_values_remaining_;
+      std::shared_ptr<Buffer> values =
+          ::arrow::SliceBuffer(page_values_, offset * byte_width, length * byte_width);
+      chunks.push_back(::arrow::MakeArray(
+          ::arrow::ArrayData::Make(field_->type(), length, {nullptr, values}, 0)));
+      page_values_remaining_ -= length;
+      records_to_read -= length;
+    }
+    *out = std::make_shared<ChunkedArray>(chunks, field_->type());
+  }
+
   ReaderContext ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
   std::shared_ptr<RecordReader> record_reader_;
+
+  bool zero_copy_ = false;
+  // Zero-copy state: the column chunk being read and the values of its current
+  // data page that have not been returned yet
+  std::unique_ptr<PageReader> page_reader_;
+  std::shared_ptr<Buffer> page_values_;
+  int64_t page_values_remaining_ = 0;
 };
 
 class NestedListReader : public ColumnReaderImpl {
@@ -512,6 +782,10 @@ class NestedListReader : public ColumnReaderImpl {
 
   const std::shared_ptr<Field> field() override { return field_; }
 
+  Status SkipRecords(int64_t num_records) override {
+    return item_reader_->SkipRecords(num_records);
+  }
+
   const ColumnDescriptor* descr() const override { return nullptr; }
 
   ReaderType type() const override { return LIST; }
@@ -538,6 +812,12 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, int64_t* length) override;
   Status GetRepLevels(const int16_t** data, int64_t* length) override;
+  Status SkipRecords(int64_t num_records) override {
+    for (auto& child : children_) {
+      RETURN_NOT_OK(child->SkipRecords(num_records));
+    }
+    return Status::OK();
+  }
   const std::shared_ptr<Field> field() override { return filtered_field_; }
   const ColumnDescriptor* descr() const override { return nullptr; }
   ReaderType type() const override { return STRUCT; }
@@ -555,21 +835,24 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
 Status StructReader::DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap_out,
                                           int64_t* null_count_out) {
   std::shared_ptr<Buffer> null_bitmap;
-  auto null_count = 0;
+  int64_t null_count = 0;
   const int16_t* def_levels_data;
   int64_t def_levels_length;
   RETURN_NOT_OK(GetDefLevels(&def_levels_data, &def_levels_length));
-  RETURN_NOT_OK(AllocateEmptyBitmap(ctx_.pool, def_levels_length, &null_bitmap));
-  uint8_t* null_bitmap_ptr = null_bitmap->mutable_data();
-  for (int64_t i = 0; i < def_levels_length; i++) {
-    if (def_levels_data[i] < struct_def_level_) {
-      // Mark null
-      null_count += 1;
-    } else {
-      DCHECK_EQ(def_levels_data[i], struct_def_level_);
-      ::arrow::BitUtil::SetBit(null_bitmap_ptr, i);
-    }
-  }
+  RETURN_NOT_OK(AllocateBuffer(ctx_.pool,
+                               ::arrow::BitUtil::BytesForBits(def_levels_length),
+                               &null_bitmap));
+  // Write the bitmap a byte at a time rather than setting bits one by one
+  const int16_t struct_def_level = struct_def_level_;
+  const int16_t* def_level = def_levels_data;
+  ::arrow::internal::GenerateBitsUnrolled(
+      null_bitmap->mutable_data(), 0, def_levels_length, [&]() -> bool {
+        const bool valid = *def_level >= struct_def_level;
+        DCHECK(!valid || *def_level == struct_def_level);
+        ++def_level;
+        null_count += !valid;
+        return valid;
+      });
 
   *null_count_out = null_count;
   *null_bitmap_out = (null_count == 0) ? nullptr : null_bitmap;
@@ -728,6 +1011,14 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_in
   for (auto row_group_index : row_group_indices) {
     RETURN_NOT_OK(BoundsCheckRowGroup(row_group_index));
   }
+  if (reader_properties_.pre_buffer()) {
+    for (auto column_index : column_indices) {
+      RETURN_NOT_OK(BoundsCheckColumn(column_index));
+    }
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    reader_->PreBuffer(row_group_indices, column_indices);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
   return RowGroupRecordBatchReader::Make(row_group_indices, column_indices, this,
                                          reader_properties_.batch_size(), out);
 }
@@ -740,6 +1031,8 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx.pool = pool_;
   ctx.iterator_factory = AllRowGroupsFactory();
   ctx.filter_leaves = false;
+  ctx.unify_dictionaries = reader_properties_.unify_dictionaries();
+  ctx.zero_copy_reads = reader_properties_.zero_copy_reads();
   std::unique_ptr<ColumnReaderImpl> result;
   RETURN_NOT_OK(manifest_.schema_fields[i].GetReader(ctx, &result));
   out->reset(result.release());
@@ -758,6 +1051,13 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
     return Status::Invalid("Invalid column index");
   }
 
+  if (reader_properties_.pre_buffer()) {
+    for (auto row_group : row_groups) {
+      RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+    }
+    reader_->PreBuffer(row_groups, indices);
+  }
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Field>> fields(num_fields);
   std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
@@ -793,6 +1093,124 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   END_PARQUET_CATCH_EXCEPTIONS
 }
 
+// The runs of rows selected by a boolean array
+static std::vector<ColumnReaderImpl::RecordRange> SelectedRanges(
+    const ChunkedArray& selection) {
+  std::vector<ColumnReaderImpl::RecordRange> ranges;
+  int64_t row = 0;
+  for (const std::shared_ptr<Array>& chunk : selection.chunks()) {
+    const auto& values = static_cast<const BooleanArray&>(*chunk);
+    for (int64_t i = 0; i < values.length(); ++i, ++row) {
+      if (!values.IsValid(i) || !values.Value(i)) {
+        continue;
+      }
+      if (!ranges.empty() && ranges.back().offset + ranges.back().length == row) {
+        ++ranges.back().length;
+      } else {
+        ranges.push_back({row, 1});
+      }
+    }
+  }
+  return ranges;
+}
+
+Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
+                                     const std::vector<int>& indices,
+                                     int filter_column_index, const RowSelector& selector,
+                                     std::shared_ptr<Table>* out) {
+  RETURN_NOT_OK(BoundsCheckColumn(filter_column_index));
+  for (auto row_group : row_groups) {
+    RETURN_NOT_OK(BoundsCheckRowGroup(row_group));
+  }
+  std::vector<int> field_indices;
+  if (!manifest_.GetFieldIndices(indices, &field_indices)) {
+    return Status::Invalid("Invalid column index");
+  }
+  int filter_field_index = -1;
+  for (size_t i = 0; i < manifest_.schema_fields.size(); ++i) {
+    if (manifest_.schema_fields[i].column_index == filter_column_index) {
+      filter_field_index = static_cast<int>(i);
+    }
+  }
+  if (filter_field_index == -1) {
+    return Status::Invalid("Filter column ", filter_column_index,
+                           " is not a top-level primitive column");
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  if (reader_properties_.pre_buffer()) {
+    std::vector<int> columns_to_buffer = indices;
+    if (std::find(indices.begin(), indices.end(), filter_column_index) ==
+        indices.end()) {
+      columns_to_buffer.push_back(filter_column_index);
+    }
+    reader_->PreBuffer(row_groups, columns_to_buffer);
+  }
+
+  // Read the filter column in full and compute the selection
+  int64_t num_rows = 0;
+  for (auto row_group : row_groups) {
+    num_rows += reader_->metadata()->RowGroup(row_group)->num_rows();
+  }
+  std::unique_ptr<ColumnReaderImpl> filter_reader;
+  RETURN_NOT_OK(GetFieldReader(filter_field_index, {filter_column_index}, row_groups,
+                               &filter_reader));
+  std::shared_ptr<ChunkedArray> filter_values;
+  RETURN_NOT_OK(filter_reader->NextBatch(num_rows, &filter_values));
+  std::shared_ptr<ChunkedArray> selection;
+  RETURN_NOT_OK(selector(filter_values, &selection));
+  if (selection->type()->id() != ::arrow::Type::BOOL ||
+      selection->length() != filter_values->length()) {
+    return Status::Invalid(
+        "Row selection must be a boolean array with one entry per row");
+  }
+  const std::vector<ColumnReaderImpl::RecordRange> ranges = SelectedRanges(*selection);
+  int64_t num_selected_rows = 0;
+  for (const auto& range : ranges) {
+    num_selected_rows += range.length;
+  }
+
+  // Read the selected rows of the indicated columns
+  int num_fields = static_cast<int>(field_indices.size());
+  std::vector<std::shared_ptr<Field>> fields(num_fields);
+  std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
+
+  auto ReadColumnFunc = [&](int i) -> Status {
+    std::unique_ptr<ColumnReaderImpl> reader;
+    RETURN_NOT_OK(GetFieldReader(field_indices[i], indices, row_groups, &reader));
+    fields[i] = reader->field();
+    return reader->ReadRanges(ranges, &columns[i]);
+  };
+
+  if (reader_properties_.use_threads()) {
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(num_fields, ReadColumnFunc));
+  } else {
+    for (int i = 0; i < num_fields; i++) {
+      RETURN_NOT_OK(ReadColumnFunc(i));
+    }
+  }
+
+  auto result_schema = ::arrow::schema(fields, manifest_.schema_metadata);
+  *out = Table::Make(result_schema, columns, num_selected_rows);
+  return (*out)->Validate();
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+Status FileReaderImpl::FilterRowGroups(const RowGroupFilter& filter,
+                                       std::vector<int>* row_groups) {
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  std::shared_ptr<FileMetaData> metadata = reader_->metadata();
+  RETURN_NOT_OK(filter.Validate(*metadata->schema()));
+  row_groups->clear();
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    if (filter.MayMatch(reader_->RowGroup(i).get())) {
+      row_groups->push_back(i);
+    }
+  }
+  return Status::OK();
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 std::shared_ptr<RowGroupReader> FileReaderImpl::RowGroup(int row_group_index) {
   return std::make_shared<RowGroupReaderImpl>(this, row_group_index);
 }
@@ -816,12 +1234,26 @@ Status FileReader::Make(::arrow::MemoryPool* pool,
 
 FileReaderBuilder::FileReaderBuilder()
     : pool_(::arrow::default_memory_pool()),
-      properties_(default_arrow_reader_properties()) {}
+      properties_(default_arrow_reader_properties()),
+      metadata_cache_(NULLPTR),
+      metadata_cache_modification_time_(0) {}
 
 Status FileReaderBuilder::Open(const std::shared_ptr<::arrow::io::RandomAccessFile>& file,
                                const ReaderProperties& properties,
                                const std::shared_ptr<FileMetaData>& metadata) {
-  PARQUET_CATCH_NOT_OK(raw_reader_ = ParquetReader::Open(file, properties, metadata));
+  if (metadata != nullptr || metadata_cache_ == nullptr) {
+    PARQUET_CATCH_NOT_OK(raw_reader_ = ParquetReader::Open(file, properties, metadata));
+    return Status::OK();
+  }
+  int64_t file_size = -1;
+  RETURN_NOT_OK(file->GetSize(&file_size));
+  std::shared_ptr<FileMetaData> cached = metadata_cache_->Get(
+      metadata_cache_path_, file_size, metadata_cache_modification_time_);
+  PARQUET_CATCH_NOT_OK(raw_reader_ = ParquetReader::Open(file, properties, cached));
+  if (cached == nullptr) {
+    metadata_cache_->Put(metadata_cache_path_, file_size,
+                         metadata_cache_modification_time_, raw_reader_->metadata());
+  }
   return Status::OK();
 }
 
@@ -836,6 +1268,15 @@ FileReaderBuilder* FileReaderBuilder::properties(
   return this;
 }
 
+FileReaderBuilder* FileReaderBuilder::metadata_cache(FileMetaDataCache* cache,
+                                                     const std::string& path,
+                                                     int64_t modification_time) {
+  metadata_cache_ = cache;
+  metadata_cache_path_ = path;
+  metadata_cache_modification_time_ = modification_time;
+  return this;
+}
+
 Status FileReaderBuilder::Build(std::unique_ptr<FileReader>* out) {
   return FileReader::Make(pool_, std::move(raw_reader_), properties_, out);
 }
@@ -19,7 +19,9 @@
 #define PARQUET_ARROW_READER_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/util/iterator.h"
@@ -47,6 +49,7 @@ namespace arrow {
 
 class ColumnChunkReader;
 class ColumnReader;
+class RowGroupFilter;
 class RowGroupReader;
 
 // Arrow read adapter class for deserializing Parquet files as Arrow row
@@ -204,7 +207,43 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Return the indices of the row groups whose column statistics
+  ///   and Bloom filters don't rule out the filter, in file order. Besides
+  ///   file metadata, only the Bloom filters of columns compared for
+  ///   equality are read.
+  /// \returns error Status if the filter refers to an invalid column index
+  virtual ::arrow::Status FilterRowGroups(const RowGroupFilter& filter,
+                                          std::vector<int>* row_groups) = 0;
+
+  /// \brief Read the indicated column indices from the row groups selected
+  ///   by FilterRowGroups. Rows of the selected row groups are not filtered.
+  virtual ::arrow::Status ReadTable(const RowGroupFilter& filter,
+                                    const std::vector<int>& column_indices,
+                                    std::shared_ptr<::arrow::Table>* out) = 0;
+
+  /// \brief Computes the rows to keep from the values of a column, as a
+  ///   boolean array with one entry per row. Null entries are not kept.
+  using RowSelector = std::function<::arrow::Status(
+      const std::shared_ptr<::arrow::ChunkedArray>& values,
+      std::shared_ptr<::arrow::ChunkedArray>* selection)>;
+
+  /// \brief Read the indicated column indices from the row groups, keeping
+  ///   only the rows chosen by the selector (late materialization).
+  ///
+  /// The filter column, which must be a top-level primitive column, is read
+  /// first and passed to the selector. The indicated columns are then read
+  /// skipping the rows that were not selected: pages holding none of the
+  /// selected rows of a column without repetition levels are not decoded.
+  virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
+                                        const std::vector<int>& column_indices,
+                                        int filter_column_index,
+                                        const RowSelector& selector,
+                                        std::shared_ptr<::arrow::Table>* out) = 0;
+
   /// \brief Scan file contents with one thread, return number of rows
+  ///
+  /// This decodes the selected columns. SummarizeColumns counts rows and
+  /// values from the file metadata instead.
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
                                        int64_t* num_rows) = 0;
@@ -284,12 +323,22 @@ class PARQUET_EXPORT FileReaderBuilder {
 
   FileReaderBuilder* memory_pool(::arrow::MemoryPool* pool);
   FileReaderBuilder* properties(const ArrowReaderProperties& arg_properties);
+
+  /// \brief Have the next Open take the file metadata from the cache, where
+  /// the file is known by the given path and modification time, and add it to
+  /// the cache when missing. Metadata passed to Open takes precedence.
+  FileReaderBuilder* metadata_cache(FileMetaDataCache* cache, const std::string& path,
+                                    int64_t modification_time);
+
   ::arrow::Status Build(std::unique_ptr<FileReader>* out);
 
  private:
   ::arrow::MemoryPool* pool_;
   ArrowReaderProperties properties_;
   std::unique_ptr<ParquetFileReader> raw_reader_;
+  FileMetaDataCache* metadata_cache_;
+  std::string metadata_cache_path_;
+  int64_t metadata_cache_modification_time_;
 };
 
 PARQUET_EXPORT
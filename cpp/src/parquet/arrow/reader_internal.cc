@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -30,14 +31,19 @@
 #include <boost/algorithm/string/predicate.hpp>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/cast.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
@@ -82,6 +88,18 @@ namespace arrow {
 template <typename ArrowType>
 using ArrayType = typename ::arrow::TypeTraits<ArrowType>::ArrayType;
 
+// ----------------------------------------------------------------------
+// Iteration utilities
+
+void RowGroupPrefetcher::Advance(int position) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const int end_position =
+      std::min(position + num_prefetch_ + 1, static_cast<int>(row_groups_.size()));
+  for (; next_position_ < end_position; ++next_position_) {
+    reader_->PrefetchRowGroup(row_groups_[next_position_], column_indices_);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Schema logic
 
@@ -600,6 +618,13 @@ Status GetOriginSchema(const std::shared_ptr<const KeyValueMetadata>& metadata,
 Status ApplyOriginalMetadata(std::shared_ptr<Field> field, const Field& origin_field,
                              std::shared_ptr<Field>* out) {
   auto origin_type = origin_field.type();
+  if ((field->type()->id() == ::arrow::Type::BINARY &&
+       origin_type->id() == ::arrow::Type::LARGE_BINARY) ||
+      (field->type()->id() == ::arrow::Type::STRING &&
+       origin_type->id() == ::arrow::Type::LARGE_STRING)) {
+    // Restore 64-bit offsets, which Parquet doesn't distinguish
+    field = field->WithType(origin_type);
+  }
   if (field->type()->id() == ::arrow::Type::TIMESTAMP) {
     // Restore time zone, if any
     const auto& ts_type = static_cast<const ::arrow::TimestampType&>(*field->type());
@@ -794,6 +819,34 @@ Status TransferBinary(RecordReader* reader,
   return Status::OK();
 }
 
+// The record reader accumulates 32-bit offset chunks, which are widened and
+// concatenated so that large binary columns aren't split at 2 GB
+Status TransferLargeBinary(RecordReader* reader, MemoryPool* pool,
+                           const std::shared_ptr<DataType>& logical_value_type,
+                           std::shared_ptr<ChunkedArray>* out) {
+  const auto narrow_type = logical_value_type->id() == ::arrow::Type::LARGE_STRING
+                               ? ::arrow::utf8()
+                               : ::arrow::binary();
+  std::shared_ptr<ChunkedArray> narrow_chunks;
+  RETURN_NOT_OK(TransferBinary(reader, narrow_type, &narrow_chunks));
+
+  ::arrow::compute::FunctionContext ctx(pool);
+  ::arrow::ArrayVector chunks;
+  for (const auto& chunk : narrow_chunks->chunks()) {
+    std::shared_ptr<Array> wide_chunk;
+    RETURN_NOT_OK(::arrow::compute::Cast(&ctx, *chunk, logical_value_type,
+                                         ::arrow::compute::CastOptions(), &wide_chunk));
+    chunks.push_back(std::move(wide_chunk));
+  }
+  if (chunks.size() > 1) {
+    std::shared_ptr<Array> combined;
+    RETURN_NOT_OK(::arrow::Concatenate(chunks, pool, &combined));
+    chunks = {combined};
+  }
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), logical_value_type);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // INT32 / INT64 / BYTE_ARRAY / FIXED_LEN_BYTE_ARRAY -> Decimal128
 
@@ -1143,6 +1196,11 @@ Status TransferColumnData(internal::RecordReader* reader,
       RETURN_NOT_OK(TransferBinary(reader, value_type, &chunked_result));
       result = chunked_result;
     } break;
+    case ::arrow::Type::LARGE_BINARY:
+    case ::arrow::Type::LARGE_STRING: {
+      RETURN_NOT_OK(TransferLargeBinary(reader, pool, value_type, &chunked_result));
+      result = chunked_result;
+    } break;
     case ::arrow::Type::DECIMAL: {
       switch (descr->physical_type()) {
         case ::parquet::Type::INT32: {
@@ -1203,6 +1261,64 @@ Status TransferColumnData(internal::RecordReader* reader,
   return Status::OK();
 }
 
+// Build the offsets and validity of a single-level list straight from its
+// levels. Every level with repetition level 0 starts a list, so the result never
+// needs more offsets than there are levels and the buffers are written without
+// going through builders.
+static Status ReconstructSingleList(const std::shared_ptr<Array>& arr,
+                                    bool list_nullable, bool values_nullable,
+                                    int16_t max_def_level, const int16_t* def_levels,
+                                    const int16_t* rep_levels, int64_t total_levels,
+                                    ::arrow::MemoryPool* pool,
+                                    std::shared_ptr<Array>* out) {
+  std::shared_ptr<ResizableBuffer> offsets;
+  std::shared_ptr<ResizableBuffer> valid_bits;
+  RETURN_NOT_OK(AllocateResizableBuffer(
+      pool, (total_levels + 1) * static_cast<int64_t>(sizeof(int32_t)), &offsets));
+  RETURN_NOT_OK(AllocateResizableBuffer(
+      pool, ::arrow::BitUtil::BytesForBits(total_levels), &valid_bits));
+
+  // Levels from values_def_level up hold a slot in the values array. A nullable
+  // list is null at definition level 0, which -1 never matches for a required one
+  const int16_t values_def_level =
+      static_cast<int16_t>(values_nullable ? max_def_level - 1 : max_def_level);
+  const int16_t null_list_def_level = list_nullable ? 0 : -1;
+
+  auto out_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+  ::arrow::internal::FirstTimeBitmapWriter valid_writer(valid_bits->mutable_data(), 0,
+                                                        total_levels);
+  int64_t length = 0;
+  int64_t null_count = 0;
+  int32_t values_offset = 0;
+  for (int64_t i = 0; i < total_levels; i++) {
+    const int16_t def_level = def_levels[i];
+    if (rep_levels[i] == 0) {
+      out_offsets[length++] = values_offset;
+      if (def_level == null_list_def_level) {
+        ++null_count;
+      } else {
+        valid_writer.Set();
+      }
+      valid_writer.Next();
+    }
+    values_offset += def_level >= values_def_level;
+  }
+  out_offsets[length] = values_offset;
+  valid_writer.Finish();
+
+  RETURN_NOT_OK(offsets->Resize((length + 1) * static_cast<int64_t>(sizeof(int32_t))));
+  std::shared_ptr<Buffer> null_bitmap;
+  if (null_count > 0) {
+    RETURN_NOT_OK(valid_bits->Resize(::arrow::BitUtil::BytesForBits(length)));
+    null_bitmap = valid_bits;
+  }
+
+  auto list_type = ::arrow::list(::arrow::field("item", arr->type(), values_nullable));
+  *out = std::make_shared<ListArray>(list_type, length, offsets, arr, null_bitmap,
+                                     null_count);
+  return Status::OK();
+}
+
 Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
                              std::shared_ptr<Field> field, int16_t max_def_level,
                              int16_t max_rep_level, const int16_t* def_levels,
@@ -1230,6 +1346,11 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
   }
 
   int64_t list_depth = offset_builders.size();
+  if (list_depth == 1 && max_rep_level == 1) {
+    return ReconstructSingleList(arr, nullable[0], nullable[1], max_def_level,
+                                 def_levels, rep_levels, total_levels, pool, out);
+  }
+
   // This describes the minimal definition that describes a level that
   // reflects a value in the primitive values array.
   int16_t values_def_level = max_def_level;
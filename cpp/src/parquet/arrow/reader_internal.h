@@ -21,6 +21,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -56,16 +57,44 @@ class ColumnReaderImpl;
 // ----------------------------------------------------------------------
 // Iteration utilities
 
+// Prefetches the column chunks of the row groups following the one being
+// read, shared by the column iterators of a reader
+class RowGroupPrefetcher {
+ public:
+  RowGroupPrefetcher(ParquetFileReader* reader, std::vector<int> row_groups,
+                     std::vector<int> column_indices, int num_prefetch)
+      : reader_(reader),
+        row_groups_(std::move(row_groups)),
+        column_indices_(std::move(column_indices)),
+        num_prefetch_(num_prefetch),
+        next_position_(0) {}
+
+  // Called before reading the row group at the given position of row_groups:
+  // prefetches it and the num_prefetch row groups after it, unless done already
+  void Advance(int position);
+
+ private:
+  ParquetFileReader* reader_;
+  std::vector<int> row_groups_;
+  std::vector<int> column_indices_;
+  int num_prefetch_;
+  std::mutex mutex_;
+  int next_position_;
+};
+
 // Abstraction to decouple row group iteration details from the ColumnReader,
 // so we can read only a single row group if we want
 class FileColumnIterator {
  public:
   explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+                              std::vector<int> row_groups,
+                              std::shared_ptr<RowGroupPrefetcher> prefetcher = NULLPTR)
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        prefetcher_(std::move(prefetcher)),
+        position_(0) {}
 
   virtual ~FileColumnIterator() {}
 
@@ -73,9 +102,13 @@ class FileColumnIterator {
     if (row_groups_.empty()) {
       return nullptr;
     }
+    if (prefetcher_ != nullptr) {
+      prefetcher_->Advance(position_);
+    }
 
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
+    ++position_;
     return row_group_reader->GetColumnPageReader(column_index_);
   }
 
@@ -87,11 +120,16 @@ class FileColumnIterator {
 
   int column_index() const { return column_index_; }
 
+  /// The row groups whose column chunks have not been returned yet
+  const std::deque<int>& row_groups() const { return row_groups_; }
+
  protected:
   int column_index_;
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  std::shared_ptr<RowGroupPrefetcher> prefetcher_;
+  int position_;
 };
 
 using FileColumnIteratorFactory =
@@ -115,6 +153,10 @@ struct ReaderContext {
   FileColumnIteratorFactory iterator_factory;
   bool filter_leaves;
   std::unordered_set<int> included_leaves;
+  // Merge the dictionaries of all row groups when reading dictionary columns
+  bool unify_dictionaries = false;
+  // Slice eligible columns out of their data pages instead of decoding them
+  bool zero_copy_reads = false;
 
   bool IncludesLeaf(int leaf_index) const {
     return (!this->filter_leaves ||
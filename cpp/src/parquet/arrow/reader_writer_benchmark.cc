@@ -17,7 +17,13 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
 
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
@@ -28,6 +34,10 @@
 #include "parquet/platform.h"
 
 #include "arrow/api.h"
+#include "arrow/io/caching.h"
+#include "arrow/io/memory.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/thread_pool.h"
 
 using arrow::BooleanBuilder;
 using arrow::NumericBuilder;
@@ -270,6 +280,319 @@ static void BM_ReadMultipleRowGroups(::benchmark::State& state) {
 
 BENCHMARK(BM_ReadMultipleRowGroups);
 
+// ----------------------------------------------------------------------
+// Nested columns
+
+// Wrap the values in lists of 0 to 8 of them, one list in ten being null
+std::shared_ptr<::arrow::Array> MakeLists(const std::shared_ptr<::arrow::Array>& values) {
+  std::default_random_engine rng(42);
+  std::uniform_int_distribution<int32_t> length(0, 8);
+  const auto num_values = static_cast<int32_t>(values->length());
+  ::arrow::Int32Builder offsets;
+  int32_t offset = 0;
+  for (int64_t i = 0; offset < num_values; ++i) {
+    if (i % 10 == 9) {
+      EXIT_NOT_OK(offsets.AppendNull());
+    } else {
+      EXIT_NOT_OK(offsets.Append(offset));
+      offset = std::min(offset + length(rng), num_values);
+    }
+  }
+  EXIT_NOT_OK(offsets.Append(num_values));
+  std::shared_ptr<::arrow::Array> offsets_array, lists;
+  EXIT_NOT_OK(offsets.Finish(&offsets_array));
+  EXIT_NOT_OK(::arrow::ListArray::FromArrays(*offsets_array, *values,
+                                             ::arrow::default_memory_pool(), &lists));
+  return lists;
+}
+
+// A column of BENCHMARK_SIZE int64 values nested in `depth` levels of lists
+std::shared_ptr<::arrow::Table> ListTable(int64_t depth) {
+  ::arrow::random::RandomArrayGenerator rgen(1337);
+  std::shared_ptr<::arrow::Array> array = rgen.Int64(BENCHMARK_SIZE, 0, 1000000, 0.1);
+  for (int64_t i = 0; i < depth; ++i) {
+    array = MakeLists(array);
+  }
+  auto schema = ::arrow::schema({::arrow::field("column", array->type())});
+  return ::arrow::Table::Make(schema, {array});
+}
+
+static void BM_WriteListColumn(::benchmark::State& state) {
+  std::shared_ptr<::arrow::Table> table = ListTable(state.range(0));
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(
+        WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+  }
+  SetBytesProcessed<true, Int64Type>(state);
+}
+
+// The argument is the depth of nesting
+BENCHMARK(BM_WriteListColumn)->Arg(1)->Arg(2);
+
+static void BM_ReadListColumn(::benchmark::State& state) {
+  std::shared_ptr<::arrow::Table> table = ListTable(state.range(0));
+  auto output = CreateOutputStream();
+  EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(output->Finish(&buffer));
+
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  SetBytesProcessed<true, Int64Type>(state);
+}
+
+BENCHMARK(BM_ReadListColumn)->Arg(1)->Arg(2);
+
+// ----------------------------------------------------------------------
+// Dictionary-encoded columns
+
+// Read a dictionary-encoded column of strings drawn from 1000 distinct ones,
+// either as dense strings or, with read_dictionary, as a DictionaryArray
+template <bool read_dictionary>
+static void BM_ReadDictionaryColumn(::benchmark::State& state) {
+  constexpr int64_t kLength = BENCHMARK_SIZE / 10;
+  ::arrow::random::RandomArrayGenerator rgen(1337);
+  auto array = rgen.StringWithRepeats(kLength, 1000, 8, 24, 0.1);
+  auto schema = ::arrow::schema({::arrow::field("column", array->type())});
+  auto table = ::arrow::Table::Make(schema, {array});
+  auto output = CreateOutputStream();
+  EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output, kLength));
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(output->Finish(&buffer));
+
+  ArrowReaderProperties properties;
+  properties.set_read_dictionary(0, read_dictionary);
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 properties, &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  const auto& strings = static_cast<const ::arrow::StringArray&>(*array);
+  state.SetBytesProcessed(state.iterations() * strings.value_data()->size());
+  state.SetItemsProcessed(state.iterations() * kLength);
+}
+
+BENCHMARK_TEMPLATE(BM_ReadDictionaryColumn, false);
+BENCHMARK_TEMPLATE(BM_ReadDictionaryColumn, true);
+
+// ----------------------------------------------------------------------
+// File layout
+
+// The arguments are the number of rows per row group and the data page size
+static void LayoutArguments(::benchmark::internal::Benchmark* b) {
+  for (int64_t row_group_length : {BENCHMARK_SIZE / 100, BENCHMARK_SIZE / 10,
+                                   BENCHMARK_SIZE}) {
+    for (int64_t page_size : {64 << 10, 1 << 20, 8 << 20}) {
+      b->Args({row_group_length, page_size});
+    }
+  }
+}
+
+std::shared_ptr<Buffer> WriteWithLayout(const ::arrow::Table& table,
+                                        ::benchmark::State& state) {
+  std::shared_ptr<WriterProperties> properties = WriterProperties::Builder()
+                                                     .disable_dictionary()
+                                                     ->data_pagesize(state.range(1))
+                                                     ->build();
+  auto output = CreateOutputStream();
+  EXIT_NOT_OK(WriteTable(table, ::arrow::default_memory_pool(), output, state.range(0),
+                         properties));
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(output->Finish(&buffer));
+  return buffer;
+}
+
+std::shared_ptr<::arrow::Table> RandomInt64Table() {
+  ::arrow::random::RandomArrayGenerator rgen(1337);
+  auto array = rgen.Int64(BENCHMARK_SIZE, 0, 1000000, 0.1);
+  auto schema = ::arrow::schema({::arrow::field("column", array->type())});
+  return ::arrow::Table::Make(schema, {array});
+}
+
+static void BM_WriteColumnLayout(::benchmark::State& state) {
+  std::shared_ptr<::arrow::Table> table = RandomInt64Table();
+
+  while (state.KeepRunning()) {
+    WriteWithLayout(*table, state);
+  }
+  SetBytesProcessed<true, Int64Type>(state);
+}
+
+BENCHMARK(BM_WriteColumnLayout)->Apply(LayoutArguments);
+
+static void BM_ReadColumnLayout(::benchmark::State& state) {
+  std::shared_ptr<Buffer> buffer = WriteWithLayout(*RandomInt64Table(), state);
+
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  SetBytesProcessed<true, Int64Type>(state);
+}
+
+BENCHMARK(BM_ReadColumnLayout)->Apply(LayoutArguments);
+
+// ----------------------------------------------------------------------
+// High-latency files
+
+constexpr auto kReadLatency = std::chrono::milliseconds(5);
+
+// A BufferReader which waits before each read, as a remote filesystem such
+// as S3 would before the first byte
+class LatencyBufferReader : public ::arrow::io::BufferReader {
+ public:
+  using BufferReader::BufferReader;
+
+  ::arrow::Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    std::this_thread::sleep_for(kReadLatency);
+    return BufferReader::Read(nbytes, bytes_read, out);
+  }
+
+  ::arrow::Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    std::this_thread::sleep_for(kReadLatency);
+    return BufferReader::Read(nbytes, out);
+  }
+
+  ::arrow::Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                         void* out) override {
+    std::this_thread::sleep_for(kReadLatency);
+    return BufferReader::ReadAt(position, nbytes, bytes_read, out);
+  }
+
+  ::arrow::Status ReadAt(int64_t position, int64_t nbytes,
+                         std::shared_ptr<Buffer>* out) override {
+    std::this_thread::sleep_for(kReadLatency);
+    return BufferReader::ReadAt(position, nbytes, out);
+  }
+};
+
+// A LatencyBufferReader which, like the S3 filesystem's files, coalesces the
+// ranges given to WillNeed() and reads them ahead on the I/O thread pool
+class PrefetchingLatencyReader : public ::arrow::io::RandomAccessFile {
+ public:
+  explicit PrefetchingLatencyReader(const std::shared_ptr<Buffer>& buffer)
+      : raw_(std::make_shared<LatencyBufferReader>(buffer)),
+        cache_(raw_, ::arrow::io::CacheOptions::Defaults(),
+               ::arrow::internal::GetIOThreadPool()) {}
+
+  ::arrow::Status Close() override { return raw_->Close(); }
+
+  bool closed() const override { return raw_->closed(); }
+
+  ::arrow::Status Tell(int64_t* position) const override { return raw_->Tell(position); }
+
+  ::arrow::Status GetSize(int64_t* size) override { return raw_->GetSize(size); }
+
+  ::arrow::Status Seek(int64_t position) override { return raw_->Seek(position); }
+
+  ::arrow::Status WillNeed(const std::vector<::arrow::io::ReadRange>& ranges) override {
+    return cache_.Cache(ranges);
+  }
+
+  ::arrow::Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                         void* out) override {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(ReadAt(position, nbytes, &buffer));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    *bytes_read = buffer->size();
+    return ::arrow::Status::OK();
+  }
+
+  ::arrow::Status ReadAt(int64_t position, int64_t nbytes,
+                         std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(cache_.Read({position, nbytes}, out));
+    if (*out != nullptr) {
+      return ::arrow::Status::OK();
+    }
+    return raw_->ReadAt(position, nbytes, out);
+  }
+
+  ::arrow::Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    return raw_->Read(nbytes, bytes_read, out);
+  }
+
+  ::arrow::Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    return raw_->Read(nbytes, out);
+  }
+
+ private:
+  std::shared_ptr<LatencyBufferReader> raw_;
+  ::arrow::io::internal::ReadRangeCache cache_;
+};
+
+enum LatencyReadMode { kPlainRead = 0, kPreBufferRead = 1, kPrefetchRead = 2 };
+
+// Read 4 columns of 10 row groups from a file with a latency of kReadLatency
+// per request, through a RecordBatchReader.  The argument is the
+// LatencyReadMode: reading each column chunk when it is needed, coalescing
+// all of them ahead with pre_buffer, or prefetching 2 row groups ahead.
+static void BM_ReadHighLatency(::benchmark::State& state) {
+  constexpr int64_t kLength = BENCHMARK_SIZE / 10;
+  constexpr int kNumColumns = 4;
+  ::arrow::random::RandomArrayGenerator rgen(1337);
+  std::vector<std::shared_ptr<::arrow::Field>> fields;
+  std::vector<std::shared_ptr<::arrow::Array>> arrays;
+  for (int i = 0; i < kNumColumns; ++i) {
+    arrays.push_back(rgen.Int64(kLength, 0, 1000000, 0.1));
+    fields.push_back(::arrow::field("column" + std::to_string(i), ::arrow::int64()));
+  }
+  auto table = ::arrow::Table::Make(::arrow::schema(fields), arrays);
+  auto output = CreateOutputStream();
+  EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output, kLength / 10));
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(output->Finish(&buffer));
+
+  const auto mode = static_cast<LatencyReadMode>(state.range(0));
+  ArrowReaderProperties properties;
+  properties.set_pre_buffer(mode == kPreBufferRead);
+  properties.set_prefetch_row_groups(mode == kPrefetchRead ? 2 : 0);
+  while (state.KeepRunning()) {
+    std::shared_ptr<::arrow::io::RandomAccessFile> source;
+    if (mode == kPreBufferRead) {
+      source = std::make_shared<PrefetchingLatencyReader>(buffer);
+    } else {
+      source = std::make_shared<LatencyBufferReader>(buffer);
+    }
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(),
+                                 ParquetFileReader::Open(source), properties,
+                                 &arrow_reader));
+    std::vector<int> row_groups(arrow_reader->num_row_groups());
+    std::iota(row_groups.begin(), row_groups.end(), 0);
+    std::shared_ptr<::arrow::RecordBatchReader> batch_reader;
+    EXIT_NOT_OK(arrow_reader->GetRecordBatchReader(row_groups, &batch_reader));
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    do {
+      EXIT_NOT_OK(batch_reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  state.SetBytesProcessed(state.iterations() * kLength * kNumColumns * sizeof(int64_t));
+}
+
+BENCHMARK(BM_ReadHighLatency)
+    ->Arg(kPlainRead)
+    ->Arg(kPreBufferRead)
+    ->Arg(kPrefetchRead)
+    ->UseRealTime();
+
 }  // namespace benchmark
 
 }  // namespace parquet
@@ -0,0 +1,449 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/arrow/row_group_filter.h"
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/types.h"
+
+using arrow::Status;
+using arrow::internal::checked_cast;
+
+namespace parquet {
+namespace arrow {
+
+RowGroupFilter::RowGroupFilter(Kind kind, int column_index, CompareOperator op,
+                               std::shared_ptr<::arrow::Scalar> value,
+                               std::vector<std::shared_ptr<RowGroupFilter>> children)
+    : kind_(kind),
+      column_index_(column_index),
+      op_(op),
+      value_(std::move(value)),
+      children_(std::move(children)) {}
+
+std::shared_ptr<RowGroupFilter> RowGroupFilter::Compare(
+    int column_index, CompareOperator op, std::shared_ptr<::arrow::Scalar> value) {
+  return std::shared_ptr<RowGroupFilter>(
+      new RowGroupFilter(COMPARE, column_index, op, std::move(value), {}));
+}
+
+std::shared_ptr<RowGroupFilter> RowGroupFilter::IsNull(int column_index) {
+  return std::shared_ptr<RowGroupFilter>(
+      new RowGroupFilter(IS_NULL, column_index, EQUAL, nullptr, {}));
+}
+
+std::shared_ptr<RowGroupFilter> RowGroupFilter::IsValid(int column_index) {
+  return std::shared_ptr<RowGroupFilter>(
+      new RowGroupFilter(IS_VALID, column_index, EQUAL, nullptr, {}));
+}
+
+std::shared_ptr<RowGroupFilter> RowGroupFilter::And(
+    std::vector<std::shared_ptr<RowGroupFilter>> children) {
+  return std::shared_ptr<RowGroupFilter>(
+      new RowGroupFilter(AND, -1, EQUAL, nullptr, std::move(children)));
+}
+
+std::shared_ptr<RowGroupFilter> RowGroupFilter::Or(
+    std::vector<std::shared_ptr<RowGroupFilter>> children) {
+  return std::shared_ptr<RowGroupFilter>(
+      new RowGroupFilter(OR, -1, EQUAL, nullptr, std::move(children)));
+}
+
+Status RowGroupFilter::Validate(const SchemaDescriptor& schema) const {
+  if (kind_ == AND || kind_ == OR) {
+    for (const auto& child : children_) {
+      if (child == nullptr) {
+        return Status::Invalid("Null child in row group filter");
+      }
+      RETURN_NOT_OK(child->Validate(schema));
+    }
+    return Status::OK();
+  }
+  if (column_index_ < 0 || column_index_ >= schema.num_columns()) {
+    return Status::Invalid("Row group filter column index ", column_index_,
+                           " out of range for schema with ", schema.num_columns(),
+                           " columns");
+  }
+  if (kind_ == COMPARE && (value_ == nullptr || !value_->is_valid)) {
+    return Status::Invalid("Row group filter comparison requires a non-null value");
+  }
+  return Status::OK();
+}
+
+bool RowGroupFilter::MayMatch(const RowGroupMetaData& row_group) const {
+  switch (kind_) {
+    case AND:
+      for (const auto& child : children_) {
+        if (!child->MayMatch(row_group)) {
+          return false;
+        }
+      }
+      return true;
+    case OR:
+      for (const auto& child : children_) {
+        if (child->MayMatch(row_group)) {
+          return true;
+        }
+      }
+      return children_.empty();
+    default:
+      break;
+  }
+  if (column_index_ < 0 || column_index_ >= row_group.num_columns()) {
+    return true;
+  }
+  std::shared_ptr<Statistics> statistics =
+      row_group.ColumnChunk(column_index_)->statistics();
+  if (statistics == nullptr) {
+    return true;
+  }
+  return MayMatch(*statistics);
+}
+
+namespace {
+
+// Return the value of an integer-like scalar, or false if it has none (or
+// the value doesn't fit in int64_t)
+bool GetIntegerValue(const ::arrow::Scalar& value, int64_t* out) {
+  switch (value.type->id()) {
+#define INTEGER_SCALAR_CASE(TYPE_ID, SCALAR_TYPE)                \
+  case ::arrow::Type::TYPE_ID:                                   \
+    *out = static_cast<int64_t>(                                 \
+        checked_cast<const ::arrow::SCALAR_TYPE&>(value).value); \
+    return true;
+
+    INTEGER_SCALAR_CASE(INT8, Int8Scalar)
+    INTEGER_SCALAR_CASE(INT16, Int16Scalar)
+    INTEGER_SCALAR_CASE(INT32, Int32Scalar)
+    INTEGER_SCALAR_CASE(INT64, Int64Scalar)
+    INTEGER_SCALAR_CASE(UINT8, UInt8Scalar)
+    INTEGER_SCALAR_CASE(UINT16, UInt16Scalar)
+    INTEGER_SCALAR_CASE(UINT32, UInt32Scalar)
+    INTEGER_SCALAR_CASE(DATE32, Date32Scalar)
+    INTEGER_SCALAR_CASE(DATE64, Date64Scalar)
+    INTEGER_SCALAR_CASE(TIME32, Time32Scalar)
+    INTEGER_SCALAR_CASE(TIME64, Time64Scalar)
+    INTEGER_SCALAR_CASE(TIMESTAMP, TimestampScalar)
+    INTEGER_SCALAR_CASE(DURATION, DurationScalar)
+
+#undef INTEGER_SCALAR_CASE
+
+    case ::arrow::Type::UINT64: {
+      uint64_t v = checked_cast<const ::arrow::UInt64Scalar&>(value).value;
+      if (v > static_cast<uint64_t>(std::numeric_limits<int64_t>::max())) {
+        return false;
+      }
+      *out = static_cast<int64_t>(v);
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+bool GetFloatingValue(const ::arrow::Scalar& value, double* out) {
+  switch (value.type->id()) {
+    case ::arrow::Type::FLOAT:
+      *out = checked_cast<const ::arrow::FloatScalar&>(value).value;
+      return true;
+    case ::arrow::Type::DOUBLE:
+      *out = checked_cast<const ::arrow::DoubleScalar&>(value).value;
+      return true;
+    default: {
+      int64_t integer_value;
+      if (!GetIntegerValue(value, &integer_value)) {
+        return false;
+      }
+      *out = static_cast<double>(integer_value);
+      return true;
+    }
+  }
+}
+
+// Convert a scalar to the physical representation of a column, returning
+// false if that isn't possible
+
+template <typename DType>
+bool GetPhysicalValue(const ::arrow::Scalar& value, const ColumnDescriptor& descr,
+                      typename DType::c_type* out);
+
+template <>
+bool GetPhysicalValue<BooleanType>(const ::arrow::Scalar& value,
+                                   const ColumnDescriptor& descr, bool* out) {
+  if (value.type->id() != ::arrow::Type::BOOL) {
+    return false;
+  }
+  *out = checked_cast<const ::arrow::BooleanScalar&>(value).value;
+  return true;
+}
+
+template <>
+bool GetPhysicalValue<Int32Type>(const ::arrow::Scalar& value,
+                                 const ColumnDescriptor& descr, int32_t* out) {
+  int64_t v;
+  if (!GetIntegerValue(value, &v)) {
+    return false;
+  }
+  // Unsigned columns store uint32 bit patterns
+  if (descr.sort_order() == SortOrder::UNSIGNED) {
+    if (v < 0 || v > std::numeric_limits<uint32_t>::max()) {
+      return false;
+    }
+    *out = static_cast<int32_t>(static_cast<uint32_t>(v));
+    return true;
+  }
+  if (v < std::numeric_limits<int32_t>::min() ||
+      v > std::numeric_limits<int32_t>::max()) {
+    return false;
+  }
+  *out = static_cast<int32_t>(v);
+  return true;
+}
+
+template <>
+bool GetPhysicalValue<Int64Type>(const ::arrow::Scalar& value,
+                                 const ColumnDescriptor& descr, int64_t* out) {
+  if (value.type->id() == ::arrow::Type::UINT64 &&
+      descr.sort_order() == SortOrder::UNSIGNED) {
+    *out = static_cast<int64_t>(checked_cast<const ::arrow::UInt64Scalar&>(value).value);
+    return true;
+  }
+  if (!GetIntegerValue(value, out)) {
+    return false;
+  }
+  return descr.sort_order() != SortOrder::UNSIGNED || *out >= 0;
+}
+
+template <>
+bool GetPhysicalValue<FloatType>(const ::arrow::Scalar& value,
+                                 const ColumnDescriptor& descr, float* out) {
+  if (value.type->id() == ::arrow::Type::FLOAT) {
+    *out = checked_cast<const ::arrow::FloatScalar&>(value).value;
+    return true;
+  }
+  // Only compare against floats which represent the value exactly
+  double v;
+  if (!GetFloatingValue(value, &v) || static_cast<double>(static_cast<float>(v)) != v) {
+    return false;
+  }
+  *out = static_cast<float>(v);
+  return true;
+}
+
+template <>
+bool GetPhysicalValue<DoubleType>(const ::arrow::Scalar& value,
+                                  const ColumnDescriptor& descr, double* out) {
+  return GetFloatingValue(value, out);
+}
+
+template <>
+bool GetPhysicalValue<ByteArrayType>(const ::arrow::Scalar& value,
+                                     const ColumnDescriptor& descr, ByteArray* out) {
+  switch (value.type->id()) {
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING: {
+      const auto& buffer = checked_cast<const ::arrow::BinaryScalar&>(value).value;
+      *out = ByteArray(static_cast<uint32_t>(buffer->size()), buffer->data());
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+
+template <>
+bool GetPhysicalValue<FLBAType>(const ::arrow::Scalar& value,
+                                const ColumnDescriptor& descr, FixedLenByteArray* out) {
+  if (value.type->id() != ::arrow::Type::FIXED_SIZE_BINARY) {
+    return false;
+  }
+  const auto& buffer = checked_cast<const ::arrow::FixedSizeBinaryScalar&>(value).value;
+  if (buffer->size() != descr.type_length()) {
+    return false;
+  }
+  *out = FixedLenByteArray(buffer->data());
+  return true;
+}
+
+template <typename DType>
+bool TypedStatisticsMayMatch(const Statistics& untyped_statistics,
+                             RowGroupFilter::CompareOperator op,
+                             const ::arrow::Scalar& scalar) {
+  using T = typename DType::c_type;
+  const auto& statistics =
+      checked_cast<const TypedStatistics<DType>&>(untyped_statistics);
+  const ColumnDescriptor* descr = statistics.descr();
+  T value;
+  if (descr == nullptr || !GetPhysicalValue<DType>(scalar, *descr, &value)) {
+    return true;
+  }
+
+  // less(a, b) is a < b in the column's sort order
+  auto comparator = MakeComparator<DType>(descr);
+  auto less = [&](const T& a, const T& b) { return comparator->Compare(a, b); };
+  const T& min = statistics.min();
+  const T& max = statistics.max();
+
+  switch (op) {
+    case RowGroupFilter::EQUAL:
+      return !less(value, min) && !less(max, value);
+    case RowGroupFilter::NOT_EQUAL:
+      // Only ruled out if every value equals the operand
+      return less(min, max) || less(min, value) || less(value, min);
+    case RowGroupFilter::LESS:
+      return less(min, value);
+    case RowGroupFilter::LESS_EQUAL:
+      return !less(value, min);
+    case RowGroupFilter::GREATER:
+      return less(value, max);
+    case RowGroupFilter::GREATER_EQUAL:
+      return !less(max, value);
+  }
+  return true;
+}
+
+template <typename DType>
+bool TypedBloomFilterMayMatch(RowGroupReader* row_group, int column_index,
+                              const ::arrow::Scalar& scalar) {
+  const ColumnDescriptor* descr = row_group->metadata()->schema()->Column(column_index);
+  typename DType::c_type value;
+  if (!GetPhysicalValue<DType>(scalar, *descr, &value)) {
+    return true;
+  }
+  return row_group->RowGroupMayContain(column_index, value);
+}
+
+// Floating point zeros compare equal but hash differently
+template <>
+bool TypedBloomFilterMayMatch<FloatType>(RowGroupReader* row_group, int column_index,
+                                         const ::arrow::Scalar& scalar) {
+  const ColumnDescriptor* descr = row_group->metadata()->schema()->Column(column_index);
+  float value;
+  if (!GetPhysicalValue<FloatType>(scalar, *descr, &value) || value == 0.0f) {
+    return true;
+  }
+  return row_group->RowGroupMayContain(column_index, value);
+}
+
+template <>
+bool TypedBloomFilterMayMatch<DoubleType>(RowGroupReader* row_group, int column_index,
+                                          const ::arrow::Scalar& scalar) {
+  const ColumnDescriptor* descr = row_group->metadata()->schema()->Column(column_index);
+  double value;
+  if (!GetPhysicalValue<DoubleType>(scalar, *descr, &value) || value == 0.0) {
+    return true;
+  }
+  return row_group->RowGroupMayContain(column_index, value);
+}
+
+}  // namespace
+
+bool RowGroupFilter::MayMatch(::parquet::RowGroupReader* row_group) const {
+  switch (kind_) {
+    case AND:
+      for (const auto& child : children_) {
+        if (!child->MayMatch(row_group)) {
+          return false;
+        }
+      }
+      return true;
+    case OR:
+      for (const auto& child : children_) {
+        if (child->MayMatch(row_group)) {
+          return true;
+        }
+      }
+      return children_.empty();
+    default:
+      break;
+  }
+  if (!MayMatch(*row_group->metadata())) {
+    return false;
+  }
+  if (kind_ != COMPARE || op_ != EQUAL || value_ == nullptr || !value_->is_valid ||
+      column_index_ < 0 || column_index_ >= row_group->metadata()->num_columns()) {
+    return true;
+  }
+  switch (row_group->metadata()->schema()->Column(column_index_)->physical_type()) {
+    case Type::INT32:
+      return TypedBloomFilterMayMatch<Int32Type>(row_group, column_index_, *value_);
+    case Type::INT64:
+      return TypedBloomFilterMayMatch<Int64Type>(row_group, column_index_, *value_);
+    case Type::FLOAT:
+      return TypedBloomFilterMayMatch<FloatType>(row_group, column_index_, *value_);
+    case Type::DOUBLE:
+      return TypedBloomFilterMayMatch<DoubleType>(row_group, column_index_, *value_);
+    case Type::BYTE_ARRAY:
+      return TypedBloomFilterMayMatch<ByteArrayType>(row_group, column_index_, *value_);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return TypedBloomFilterMayMatch<FLBAType>(row_group, column_index_, *value_);
+    default:
+      return true;
+  }
+}
+
+bool RowGroupFilter::MayMatch(const Statistics& statistics) const {
+  switch (kind_) {
+    case IS_NULL:
+      return statistics.null_count() > 0;
+    case IS_VALID:
+      return statistics.num_values() > 0;
+    case COMPARE:
+      break;
+    default:
+      return true;
+  }
+  // Nulls never satisfy a comparison
+  if (statistics.num_values() == 0 && statistics.null_count() > 0) {
+    return false;
+  }
+  if (value_ == nullptr || !value_->is_valid || !statistics.HasMinMax()) {
+    return true;
+  }
+  switch (statistics.physical_type()) {
+    case Type::BOOLEAN:
+      return TypedStatisticsMayMatch<BooleanType>(statistics, op_, *value_);
+    case Type::INT32:
+      return TypedStatisticsMayMatch<Int32Type>(statistics, op_, *value_);
+    case Type::INT64:
+      return TypedStatisticsMayMatch<Int64Type>(statistics, op_, *value_);
+    case Type::FLOAT:
+      return TypedStatisticsMayMatch<FloatType>(statistics, op_, *value_);
+    case Type::DOUBLE:
+      return TypedStatisticsMayMatch<DoubleType>(statistics, op_, *value_);
+    case Type::BYTE_ARRAY:
+      return TypedStatisticsMayMatch<ByteArrayType>(statistics, op_, *value_);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return TypedStatisticsMayMatch<FLBAType>(statistics, op_, *value_);
+    default:
+      return true;
+  }
+}
+
+}  // namespace arrow
+}  // namespace parquet
@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace arrow {
+
+struct Scalar;
+
+}  // namespace arrow
+
+namespace parquet {
+
+class RowGroupMetaData;
+class RowGroupReader;
+class SchemaDescriptor;
+class Statistics;
+
+namespace arrow {
+
+/// \brief A predicate over the leaf columns of a Parquet file, used to skip
+/// row groups whose column chunk statistics show that no row can match.
+///
+/// Leaf predicates compare a column (identified by its leaf column index, as
+/// in FileReader::ReadRowGroups) with a scalar value, or test it for nulls.
+/// Scalar values are compared with the column's physical representation, so
+/// e.g. a TimestampScalar must use the unit the column was written with.
+///
+/// Evaluation is conservative: a row group is only ruled out when its
+/// statistics (or, for EQUAL comparisons, its Bloom filters) prove that the
+/// predicate cannot hold. Missing statistics and unsupported value types never
+/// exclude a row group.
+class PARQUET_EXPORT RowGroupFilter {
+ public:
+  enum Kind { COMPARE, IS_NULL, IS_VALID, AND, OR };
+
+  enum CompareOperator { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+  /// \brief Rows where `column <op> value` holds; nulls never match
+  static std::shared_ptr<RowGroupFilter> Compare(
+      int column_index, CompareOperator op, std::shared_ptr<::arrow::Scalar> value);
+
+  static std::shared_ptr<RowGroupFilter> IsNull(int column_index);
+  static std::shared_ptr<RowGroupFilter> IsValid(int column_index);
+
+  static std::shared_ptr<RowGroupFilter> And(
+      std::vector<std::shared_ptr<RowGroupFilter>> children);
+  static std::shared_ptr<RowGroupFilter> Or(
+      std::vector<std::shared_ptr<RowGroupFilter>> children);
+
+  /// \brief Check that column indices and values are valid for the schema
+  ::arrow::Status Validate(const SchemaDescriptor& schema) const;
+
+  /// \brief Return false if the row group statistics show that no row in the
+  /// row group satisfies the predicate
+  bool MayMatch(const RowGroupMetaData& row_group) const;
+
+  /// \brief Like MayMatch(const RowGroupMetaData&), but also probe the Bloom
+  /// filters of columns compared for equality
+  bool MayMatch(::parquet::RowGroupReader* row_group) const;
+
+  /// \brief Evaluate a leaf predicate against the statistics of its column
+  /// chunk. Always true for AND/OR filters.
+  bool MayMatch(const Statistics& statistics) const;
+
+  Kind kind() const { return kind_; }
+  CompareOperator compare_operator() const { return op_; }
+  int column_index() const { return column_index_; }
+  const std::shared_ptr<::arrow::Scalar>& value() const { return value_; }
+  const std::vector<std::shared_ptr<RowGroupFilter>>& children() const {
+    return children_;
+  }
+
+ private:
+  RowGroupFilter(Kind kind, int column_index, CompareOperator op,
+                 std::shared_ptr<::arrow::Scalar> value,
+                 std::vector<std::shared_ptr<RowGroupFilter>> children);
+
+  Kind kind_;
+  int column_index_;
+  CompareOperator op_;
+  std::shared_ptr<::arrow::Scalar> value_;
+  std::vector<std::shared_ptr<RowGroupFilter>> children_;
+};
+
+}  // namespace arrow
+}  // namespace parquet
@@ -239,10 +239,12 @@ Status FieldToNode(const std::shared_ptr<Field>& field,
       type = ParquetType::DOUBLE;
       break;
     case ArrowTypeId::STRING:
+    case ArrowTypeId::LARGE_STRING:
       type = ParquetType::BYTE_ARRAY;
       logical_type = LogicalType::String();
       break;
     case ArrowTypeId::BINARY:
+    case ArrowTypeId::LARGE_BINARY:
       type = ParquetType::BYTE_ARRAY;
       break;
     case ArrowTypeId::FIXED_SIZE_BINARY: {
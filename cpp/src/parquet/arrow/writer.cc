@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <limits>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -27,8 +28,10 @@
 #include "arrow/array.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 #include "parquet/arrow/reader_internal.h"
@@ -40,6 +43,7 @@
 #include "parquet/schema.h"
 
 using arrow::Array;
+using arrow::ArrayData;
 using arrow::BinaryArray;
 using arrow::BooleanArray;
 using arrow::ChunkedArray;
@@ -52,6 +56,7 @@ using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
 using arrow::Table;
@@ -194,8 +199,12 @@ class LevelBuilder {
       // is the sum of the length of each list array  + number of elements
       // but this might be too loose of an upper bound so we choose to use
       // safe methods.
-      RETURN_NOT_OK(rep_levels_.Append(0));
-      RETURN_NOT_OK(HandleListEntries(0, 0, 0, array.length()));
+      if (offsets_.size() == 1) {
+        RETURN_NOT_OK(HandleSingleListEntries(array.length()));
+      } else {
+        RETURN_NOT_OK(rep_levels_.Append(0));
+        RETURN_NOT_OK(HandleListEntries(0, 0, 0, array.length()));
+      }
 
       RETURN_NOT_OK(def_levels_.Finish(def_levels_out));
       RETURN_NOT_OK(rep_levels_.Finish(rep_levels_out));
@@ -262,6 +271,69 @@ class LevelBuilder {
     return Status::OK();
   }
 
+  // The levels of a list of primitive values, the most common nested shape,
+  // generated from the offsets and validity bitmaps in two passes: one sizing
+  // the levels and one filling them, with runs of levels of the same value
+  // appended at once rather than one value at a time through HandleList.
+  Status HandleSingleListEntries(int64_t length) {
+    const int32_t* offsets = offsets_[0];
+    const bool check_lists = nullable_[0] && null_counts_[0] != 0;
+    auto IsValidList = [&](int64_t i) {
+      return !check_lists || BitUtil::GetBit(valid_bitmaps_[0], i + array_offsets_[0]);
+    };
+
+    // Non-empty lists have a level per value, the others a single one
+    int64_t num_levels = 0;
+    for (int64_t i = 0; i < length; i++) {
+      const int32_t list_length = offsets[i + 1] - offsets[i];
+      num_levels += (list_length > 0 && IsValidList(i)) ? list_length : 1;
+    }
+    RETURN_NOT_OK(def_levels_.Reserve(num_levels));
+    RETURN_NOT_OK(rep_levels_.Reserve(num_levels));
+
+    // The definition level of non-null lists, that of their values being one
+    // or two more, whether their values are null or not
+    const int16_t list_def_level = nullable_[0] ? 1 : 0;
+    const bool values_nullable = nullable_[1];
+    const int64_t values_null_count = null_counts_[1];
+    const uint8_t* values_valid_bitmap = valid_bitmaps_[1];
+    const int64_t values_offset = array_offsets_[1];
+    // The definition level of all the values, or -1 if it depends on each one's
+    // validity bit.  Values of a null array have no bitmap and are all null.
+    int16_t values_def_level = -1;
+    if (!values_nullable || (values_null_count != 0 && values_valid_bitmap == nullptr)) {
+      values_def_level = static_cast<int16_t>(list_def_level + 1);
+    } else if (values_null_count == 0) {
+      values_def_level = static_cast<int16_t>(list_def_level + 2);
+    }
+
+    for (int64_t i = 0; i < length; i++) {
+      rep_levels_.UnsafeAppend(0);
+      if (!IsValidList(i)) {
+        def_levels_.UnsafeAppend(0);
+        continue;
+      }
+      const int32_t list_offset = offsets[i];
+      const int32_t list_length = offsets[i + 1] - list_offset;
+      if (list_length == 0) {
+        def_levels_.UnsafeAppend(list_def_level);
+        continue;
+      }
+      rep_levels_.UnsafeAppend(static_cast<int64_t>(list_length - 1),
+                               static_cast<int16_t>(1));
+      if (values_def_level >= 0) {
+        def_levels_.UnsafeAppend(static_cast<int64_t>(list_length), values_def_level);
+      } else {
+        for (int64_t j = list_offset; j < list_offset + list_length; j++) {
+          def_levels_.UnsafeAppend(static_cast<int16_t>(
+              list_def_level + 1 +
+              BitUtil::GetBit(values_valid_bitmap, j + values_offset)));
+        }
+      }
+    }
+    return Status::OK();
+  }
+
   Status HandleListEntries(int16_t def_level, int16_t rep_level, int64_t offset,
                            int64_t length) {
     for (int64_t i = 0; i < length; i++) {
@@ -307,6 +379,34 @@ Status GetLeafType(const ::arrow::DataType& type, ::arrow::Type::type* leaf_type
   }
 }
 
+// The size of the buffers of an array, those of its children and dictionary
+// included.  Sliced arrays count the whole of their buffers.
+int64_t ArrayDataBufferSize(const ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataBufferSize(*child);
+  }
+  if (data.dictionary != nullptr) {
+    size += ArrayDataBufferSize(*data.dictionary->data());
+  }
+  return size;
+}
+
+int64_t TableBufferSize(const Table& table) {
+  int64_t size = 0;
+  for (int i = 0; i < table.num_columns(); i++) {
+    for (const auto& chunk : table.column(i)->chunks()) {
+      size += ArrayDataBufferSize(*chunk->data());
+    }
+  }
+  return size;
+}
+
 class ArrowColumnWriter {
  public:
   ArrowColumnWriter(ArrowWriteContext* ctx, ColumnWriter* column_writer,
@@ -420,6 +520,7 @@ class FileWriterImpl : public FileWriter {
         row_group_writer_(nullptr),
         column_write_context_(pool, arrow_properties.get()),
         arrow_properties_(arrow_properties),
+        buffered_row_group_rows_(-1),
         closed_(false) {}
 
   Status Init() {
@@ -431,10 +532,64 @@ class FileWriterImpl : public FileWriter {
     if (row_group_writer_ != nullptr) {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
+    buffered_row_group_rows_ = -1;
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
     return Status::OK();
   }
 
+  Status NewBufferedRowGroup() override {
+    if (buffered_row_group_rows_ >= 0) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+      row_group_writer_ = nullptr;
+      buffered_row_group_rows_ = -1;
+    }
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("batch schema does not match this writer's. batch:'",
+                             batch.schema()->ToString(), "' this:'", schema_->ToString(),
+                             "'");
+    } else if (batch.num_columns() != writer_->schema()->num_columns()) {
+      return Status::NotImplemented("Writing record batches of nested columns");
+    }
+    const WriterProperties& props = properties();
+
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (buffered_row_group_rows_ < 0) {
+        if (row_group_writer_ != nullptr) {
+          PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        }
+        PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+        buffered_row_group_rows_ = 0;
+      }
+      const int64_t size =
+          std::min(props.max_row_group_length() - buffered_row_group_rows_,
+                   batch.num_rows() - offset);
+      for (int i = 0; i < batch.num_columns(); i++) {
+        const SchemaField* schema_field;
+        RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+        ColumnWriter* column_writer;
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(i));
+        ArrowColumnWriter arrow_writer(&column_write_context_, column_writer,
+                                       schema_field, &schema_manifest_);
+        RETURN_NOT_OK(arrow_writer.Write(*batch.column(i)->Slice(offset, size)));
+      }
+      offset += size;
+      buffered_row_group_rows_ += size;
+
+      int64_t estimated_bytes;
+      PARQUET_CATCH_NOT_OK(estimated_bytes = row_group_writer_->estimated_total_bytes());
+      if (buffered_row_group_rows_ >= props.max_row_group_length() ||
+          estimated_bytes >= props.max_row_group_bytes()) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+      }
+    }
+    return Status::OK();
+  }
+
   Status Close() override {
     if (!closed_) {
       // Make idempotent
@@ -486,6 +641,16 @@ class FileWriterImpl : public FileWriter {
     } else if (chunk_size > this->properties().max_row_group_length()) {
       chunk_size = this->properties().max_row_group_length();
     }
+    // The encoded size of the row groups is only known once written, so it
+    // is bounded through the in-memory size of the rows, which it rarely
+    // exceeds
+    if (table.num_rows() > 0 &&
+        this->properties().max_row_group_bytes() < std::numeric_limits<int64_t>::max()) {
+      const int64_t row_bytes =
+          std::max<int64_t>(1, TableBufferSize(table) / table.num_rows());
+      chunk_size = std::max<int64_t>(
+          1, std::min(chunk_size, this->properties().max_row_group_bytes() / row_bytes));
+    }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
       RETURN_NOT_OK(NewRowGroup(size));
@@ -495,6 +660,61 @@ class FileWriterImpl : public FileWriter {
       return Status::OK();
     };
 
+    // With use_threads, the column chunks of a row group are encoded and
+    // compressed concurrently into a buffered row group, each with its own
+    // scratch context.  The buffered chunks are written to the sink serially,
+    // in schema order, when the row group is closed.
+    auto WriteBufferedColumnChunk = [&](int i, int64_t offset, int64_t size) -> Status {
+      const SchemaField* schema_field;
+      RETURN_NOT_OK(schema_manifest_.GetColumnField(i, &schema_field));
+      ArrowWriteContext ctx(column_write_context_.memory_pool, arrow_properties_.get());
+      ColumnWriter* column_writer;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(i));
+      ArrowColumnWriter arrow_writer(&ctx, column_writer, schema_field,
+                                     &schema_manifest_);
+      Status st;
+      PARQUET_CATCH_NOT_OK(st = arrow_writer.Write(*table.column(i), offset, size));
+      return st;
+    };
+
+    auto WriteBufferedRowGroup = [&](int64_t offset, int64_t size) -> Status {
+      if (row_group_writer_ != nullptr) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+      }
+      buffered_row_group_rows_ = -1;
+      PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+
+      std::vector<std::future<Status>> futures;
+      auto pool = ::arrow::internal::GetCpuThreadPool();
+      for (int i = 0; i < table.num_columns(); i++) {
+        futures.push_back(pool->Submit(WriteBufferedColumnChunk, i, offset, size));
+      }
+      Status final_status = Status::OK();
+      for (auto& fut : futures) {
+        Status st = fut.get();
+        if (!st.ok()) {
+          final_status = std::move(st);
+        }
+      }
+      RETURN_NOT_OK(final_status);
+      // Compresses the remaining pages of every column and writes the chunks out
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+      row_group_writer_ = nullptr;
+      return Status::OK();
+    };
+
+    if (arrow_properties_->use_threads() && table.num_rows() > 0 &&
+        table.num_columns() > 1 &&
+        table.num_columns() == writer_->schema()->num_columns()) {
+      for (int chunk = 0; chunk * chunk_size < table.num_rows(); chunk++) {
+        int64_t offset = chunk * chunk_size;
+        int64_t size = std::min(chunk_size, table.num_rows() - offset);
+        RETURN_NOT_OK_ELSE(WriteBufferedRowGroup(offset, size),
+                           PARQUET_IGNORE_NOT_OK(Close()));
+      }
+      return Status::OK();
+    }
+
     if (table.num_rows() == 0) {
       // Append a row group with 0 rows
       RETURN_NOT_OK_ELSE(WriteRowGroup(0, 0), PARQUET_IGNORE_NOT_OK(Close()));
@@ -531,6 +751,9 @@ class FileWriterImpl : public FileWriter {
   RowGroupWriter* row_group_writer_;
   ArrowWriteContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
+  // The number of rows of the buffered row group of WriteRecordBatch, or -1
+  // if row_group_writer_ is not one
+  int64_t buffered_row_group_rows_;
   bool closed_;
 };
 
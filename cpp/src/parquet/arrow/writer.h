@@ -46,6 +46,11 @@ namespace arrow {
  * Iterative API:
  *  Start a new RowGroup/Chunk with NewRowGroup
  *  Write column-by-column the whole column chunk
+ *
+ * Streaming API:
+ *  Write RecordBatches with WriteRecordBatch, which appends them to buffered
+ *  row groups of up to max_row_group_length rows and max_row_group_bytes
+ *  bytes
  */
 class PARQUET_EXPORT FileWriter {
  public:
@@ -82,6 +87,24 @@ class PARQUET_EXPORT FileWriter {
 
   virtual ::arrow::Status WriteColumnChunk(
       const std::shared_ptr<::arrow::ChunkedArray>& data) = 0;
+
+  /// \brief Append a RecordBatch to the current buffered row group
+  ///
+  /// The rows of the batch are encoded into the column chunks of a row group
+  /// buffered in memory, whose columns are paged as they grow.  The row group
+  /// is written out once it holds max_row_group_length rows, the rest of the
+  /// batch starting the next one, or once its estimated size reaches
+  /// max_row_group_bytes, so that small batches make full row groups.  The
+  /// last row group is written by NewBufferedRowGroup, NewRowGroup, WriteTable
+  /// or Close.
+  ///
+  /// Only schemas whose fields are all leaf columns are supported.
+  virtual ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch) = 0;
+
+  /// \brief Write out the buffered row group of WriteRecordBatch, if any, so
+  /// that the next batch starts a new row group
+  virtual ::arrow::Status NewBufferedRowGroup() = 0;
+
   virtual ::arrow::Status Close() = 0;
   virtual ~FileWriter();
 
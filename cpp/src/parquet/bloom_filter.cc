@@ -96,6 +96,9 @@ BlockSplitBloomFilter BlockSplitBloomFilter::Deserialize(ArrowInputStream* input
 
   std::shared_ptr<Buffer> buffer;
   PARQUET_THROW_NOT_OK(input->Read(len, &buffer));
+  if (static_cast<uint32_t>(buffer->size()) != len) {
+    throw ParquetException("Failed to deserialize from input stream");
+  }
   bloom_filter.Init(buffer->data(), len);
   return bloom_filter;
 }
@@ -196,6 +196,51 @@ BENCHMARK_TEMPLATE(BM_ReadInt64Column, Repetition::OPTIONAL, Compression::ZSTD)
 BENCHMARK_TEMPLATE(BM_ReadInt64Column, Repetition::REPEATED, Compression::ZSTD)
     ->RangePair(1024, 65536, 1, 1024);
 
+// Read a column of random values written with data pages of state.range(1)
+// bytes, in batches of 1024 values
+static void BM_ReadInt64ColumnPageSize(::benchmark::State& state) {
+  format::ColumnChunk thrift_metadata;
+  ::arrow::random::RandomArrayGenerator rgen(1337);
+  auto values = rgen.Int64(state.range(0), 0, 1000000, 0);
+  const auto& i8_values = static_cast<const ::arrow::Int64Array&>(*values);
+  std::vector<int16_t> definition_levels(state.range(0), 1);
+  std::shared_ptr<ColumnDescriptor> schema = Int64Schema(Repetition::OPTIONAL);
+  std::shared_ptr<WriterProperties> properties = WriterProperties::Builder()
+                                                     .encoding(Encoding::PLAIN)
+                                                     ->disable_dictionary()
+                                                     ->data_pagesize(state.range(1))
+                                                     ->build();
+  auto metadata = ColumnChunkMetaDataBuilder::Make(
+      properties, schema.get(), reinterpret_cast<uint8_t*>(&thrift_metadata));
+
+  auto stream = CreateOutputStream();
+  std::shared_ptr<Int64Writer> writer =
+      BuildWriter(state.range(0), stream, metadata.get(), schema.get(), properties.get());
+  writer->WriteBatch(i8_values.length(), definition_levels.data(), nullptr,
+                     i8_values.raw_values());
+  writer->Close();
+
+  std::shared_ptr<Buffer> src;
+  PARQUET_THROW_NOT_OK(stream->Finish(&src));
+  std::vector<int64_t> values_out(1024);
+  std::vector<int16_t> definition_levels_out(1024);
+  while (state.KeepRunning()) {
+    std::shared_ptr<Int64Reader> reader = BuildReader(src, state.range(0), schema.get());
+    int64_t values_read = 0;
+    for (int64_t i = 0; i < state.range(0); i += values_read) {
+      reader->ReadBatch(values_out.size(), definition_levels_out.data(), nullptr,
+                        values_out.data(), &values_read);
+    }
+  }
+  SetBytesProcessed(state, Repetition::OPTIONAL);
+}
+
+BENCHMARK(BM_ReadInt64ColumnPageSize)
+    ->Args({1 << 20, 4 << 10})
+    ->Args({1 << 20, 64 << 10})
+    ->Args({1 << 20, 1 << 20})
+    ->Args({1 << 20, 8 << 20});
+
 static void BM_RleEncoding(::benchmark::State& state) {
   std::vector<int16_t> levels(state.range(0), 0);
   int64_t n = 0;
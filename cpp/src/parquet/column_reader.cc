@@ -18,23 +18,32 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/builder.h"
+#include "arrow/memory_pool.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/tracing.h"
 
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
@@ -98,6 +107,22 @@ int LevelDecoder::Decode(int batch_size, int16_t* levels) {
   return num_decoded;
 }
 
+int LevelDecoder::DecodeBitmap(int batch_size, uint8_t* valid_bits,
+                               int64_t valid_bits_offset) {
+  DCHECK_EQ(bit_width_, 1);
+  int num_decoded = 0;
+
+  int num_values = std::min(num_values_remaining_, batch_size);
+  if (encoding_ == Encoding::RLE) {
+    num_decoded = rle_decoder_->GetBatchBitmap(num_values, valid_bits, valid_bits_offset);
+  } else {
+    num_decoded =
+        bit_packed_decoder_->GetBitmap(num_values, valid_bits, valid_bits_offset);
+  }
+  num_values_remaining_ -= num_decoded;
+  return num_decoded;
+}
+
 ReaderProperties default_reader_properties() {
   static ReaderProperties default_reader_properties;
   return default_reader_properties;
@@ -107,6 +132,81 @@ ReaderProperties default_reader_properties() {
 // SerializedPageReader deserializes Thrift metadata and pages that have been
 // assembled in a serialized stream for storing in a Parquet files
 
+namespace {
+
+// The compressed pages of a column chunk, decompressed on the CPU thread
+// pool. The calling thread takes part in the work and only ever waits for
+// pages that another thread has already started, so Decompress() cannot
+// deadlock when it is itself called from a thread pool task.
+struct ParallelPageDecompression
+    : public std::enable_shared_from_this<ParallelPageDecompression> {
+  ParallelPageDecompression(Compression::type codec, ::arrow::MemoryPool* pool)
+      : codec(codec), pool(::arrow::scratch_memory_pool(pool)) {}
+
+  void Decompress() {
+    const int num_helpers =
+        std::min(::arrow::GetCpuThreadPoolCapacity(),
+                 static_cast<int>(compressed.size())) -
+        1;
+    uncompressed.resize(compressed.size());
+    auto self = shared_from_this();
+    for (int i = 0; i < num_helpers; ++i) {
+      PARQUET_THROW_NOT_OK(
+          ::arrow::internal::GetCpuThreadPool()->Spawn([self]() { self->Run(); }));
+    }
+    Run();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() { return num_finished == compressed.size(); });
+    PARQUET_THROW_NOT_OK(status);
+  }
+
+  void Run() {
+    std::unique_ptr<::arrow::util::Codec> decompressor;
+    for (size_t i = next_page++; i < compressed.size(); i = next_page++) {
+      ::arrow::Status st;
+      try {
+        if (decompressor == nullptr) {
+          // Codecs may keep state between calls, so use one per thread
+          decompressor = GetCodec(codec);
+        }
+        ARROW_TRACE_SPAN(span, "parquet", "DecompressPage");
+        ARROW_TRACE_SPAN_BYTES(span, uncompressed_lengths[i]);
+        ::arrow::ScopedMemoryTag memory_tag("parquet.decompress");
+        std::shared_ptr<ResizableBuffer> out =
+            AllocateBuffer(pool, uncompressed_lengths[i]);
+        st = decompressor->Decompress(compressed[i]->size(), compressed[i]->data(),
+                                      uncompressed_lengths[i], out->mutable_data());
+        uncompressed[i] = std::move(out);
+      } catch (const std::exception& e) {
+        st = ::arrow::Status::IOError(e.what());
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      if (!st.ok() && status.ok()) {
+        status = st;
+      }
+      if (++num_finished == compressed.size()) {
+        finished.notify_all();
+      }
+    }
+  }
+
+  const Compression::type codec;
+  ::arrow::MemoryPool* const pool;
+  std::vector<std::shared_ptr<Buffer>> compressed;
+  std::vector<int64_t> uncompressed_lengths;
+  std::vector<std::shared_ptr<Buffer>> uncompressed;
+
+  std::atomic<size_t> next_page{0};
+  std::mutex mutex;
+  std::condition_variable finished;
+  size_t num_finished = 0;
+  ::arrow::Status status;
+};
+
+}  // namespace
+
 // This subclass delimits pages appearing in a serialized stream, each preceded
 // by a serialized Thrift format::PageHeader indicating the type of each page
 // and the page metadata.
@@ -114,11 +214,16 @@ class SerializedPageReader : public PageReader {
  public:
   SerializedPageReader(const std::shared_ptr<ArrowInputStream>& stream,
                        int64_t total_num_rows, Compression::type codec,
-                       ::arrow::MemoryPool* pool)
+                       ::arrow::MemoryPool* pool, bool parallel_decompression)
       : stream_(stream),
-        decompression_buffer_(AllocateBuffer(pool, 0)),
+        codec_(codec),
+        pool_(pool),
+        decompression_buffer_(AllocateBuffer(::arrow::scratch_memory_pool(pool), 0)),
         seen_num_rows_(0),
-        total_num_rows_(total_num_rows) {
+        total_num_rows_(total_num_rows),
+        parallel_decompression_(parallel_decompression),
+        prefetched_(false),
+        next_prefetched_page_(0) {
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
     decompressor_ = GetCodec(codec);
   }
@@ -129,12 +234,30 @@ class SerializedPageReader : public PageReader {
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
  private:
+  // Deserialize the next page header into current_page_header_. Returns false
+  // at the end of the stream
+  bool ReadPageHeader();
+
+  // Read the page data following current_page_header_, still compressed
+  std::shared_ptr<Buffer> ReadPageData();
+
+  // Make a page from a header and its uncompressed data, or return nullptr
+  // for page types that are skipped
+  std::shared_ptr<Page> MakePage(const format::PageHeader& header,
+                                 const std::shared_ptr<Buffer>& page_buffer);
+
+  // Read all remaining pages of the column chunk and decompress them in
+  // parallel
+  void PrefetchPages();
+
   std::shared_ptr<ArrowInputStream> stream_;
 
   format::PageHeader current_page_header_;
   std::shared_ptr<Page> current_page_;
 
   // Compression codec to use.
+  Compression::type codec_;
+  ::arrow::MemoryPool* pool_;
   std::unique_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
@@ -146,60 +269,122 @@ class SerializedPageReader : public PageReader {
 
   // Number of rows in all the data pages
   int64_t total_num_rows_;
+
+  bool parallel_decompression_;
+  bool prefetched_;
+
+  // Headers and uncompressed data of the pages read by PrefetchPages
+  std::vector<format::PageHeader> prefetched_headers_;
+  std::vector<std::shared_ptr<Buffer>> prefetched_buffers_;
+  size_t next_prefetched_page_;
 };
 
-std::shared_ptr<Page> SerializedPageReader::NextPage() {
-  // Loop here because there may be unhandled page types that we skip until
-  // finding a page that we do know what to do with
-  while (seen_num_rows_ < total_num_rows_) {
-    uint32_t header_size = 0;
-    uint32_t allowed_page_size = kDefaultPageHeaderSize;
+bool SerializedPageReader::ReadPageHeader() {
+  uint32_t header_size = 0;
+  uint32_t allowed_page_size = kDefaultPageHeaderSize;
+
+  // Page headers can be very large because of page statistics
+  // We try to deserialize a larger buffer progressively
+  // until a maximum allowed header limit
+  while (true) {
+    string_view buffer;
+    PARQUET_THROW_NOT_OK(stream_->Peek(allowed_page_size, &buffer));
+    if (buffer.size() == 0) {
+      return false;
+    }
 
-    // Page headers can be very large because of page statistics
-    // We try to deserialize a larger buffer progressively
-    // until a maximum allowed header limit
-    while (true) {
-      string_view buffer;
-      PARQUET_THROW_NOT_OK(stream_->Peek(allowed_page_size, &buffer));
-      if (buffer.size() == 0) {
-        return std::shared_ptr<Page>(nullptr);
+    // This gets used, then set by DeserializeThriftMsg
+    header_size = static_cast<uint32_t>(buffer.size());
+    try {
+      DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(buffer.data()),
+                           &header_size, &current_page_header_);
+      break;
+    } catch (std::exception& e) {
+      // Failed to deserialize. Double the allowed page header size and try again
+      std::stringstream ss;
+      ss << e.what();
+      allowed_page_size *= 2;
+      if (allowed_page_size > max_page_header_size_) {
+        ss << "Deserializing page header failed.\n";
+        throw ParquetException(ss.str());
       }
+    }
+  }
+  // Advance the stream offset
+  PARQUET_THROW_NOT_OK(stream_->Advance(header_size));
+  return true;
+}
 
-      // This gets used, then set by DeserializeThriftMsg
-      header_size = static_cast<uint32_t>(buffer.size());
-      try {
-        DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(buffer.data()),
-                             &header_size, &current_page_header_);
-        break;
-      } catch (std::exception& e) {
-        // Failed to deserialize. Double the allowed page header size and try again
-        std::stringstream ss;
-        ss << e.what();
-        allowed_page_size *= 2;
-        if (allowed_page_size > max_page_header_size_) {
-          ss << "Deserializing page header failed.\n";
-          throw ParquetException(ss.str());
-        }
-      }
+std::shared_ptr<Buffer> SerializedPageReader::ReadPageData() {
+  int compressed_len = current_page_header_.compressed_page_size;
+
+  // Read the compressed data page.
+  std::shared_ptr<Buffer> page_buffer;
+  PARQUET_THROW_NOT_OK(stream_->Read(compressed_len, &page_buffer));
+  if (page_buffer->size() != compressed_len) {
+    std::stringstream ss;
+    ss << "Page was smaller (" << page_buffer->size() << ") than expected ("
+       << compressed_len << ")";
+    ParquetException::EofException(ss.str());
+  }
+  return page_buffer;
+}
+
+void SerializedPageReader::PrefetchPages() {
+  // Helper tasks keep the state alive, as they may only start after all
+  // pages have been decompressed
+  auto decompression = std::make_shared<ParallelPageDecompression>(codec_, pool_);
+
+  int64_t num_rows = seen_num_rows_;
+  while (num_rows < total_num_rows_ && ReadPageHeader()) {
+    if (current_page_header_.type == format::PageType::DATA_PAGE) {
+      num_rows += current_page_header_.data_page_header.num_values;
+    } else if (current_page_header_.type == format::PageType::DATA_PAGE_V2) {
+      num_rows += current_page_header_.data_page_header_v2.num_values;
     }
-    // Advance the stream offset
-    PARQUET_THROW_NOT_OK(stream_->Advance(header_size));
+    prefetched_headers_.push_back(current_page_header_);
+    decompression->compressed.push_back(ReadPageData());
+    decompression->uncompressed_lengths.push_back(
+        current_page_header_.uncompressed_page_size);
+  }
 
-    int compressed_len = current_page_header_.compressed_page_size;
-    int uncompressed_len = current_page_header_.uncompressed_page_size;
+  decompression->Decompress();
+  prefetched_buffers_ = std::move(decompression->uncompressed);
+}
 
-    // Read the compressed data page.
-    std::shared_ptr<Buffer> page_buffer;
-    PARQUET_THROW_NOT_OK(stream_->Read(compressed_len, &page_buffer));
-    if (page_buffer->size() != compressed_len) {
-      std::stringstream ss;
-      ss << "Page was smaller (" << page_buffer->size() << ") than expected ("
-         << compressed_len << ")";
-      ParquetException::EofException(ss.str());
+std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (parallel_decompression_ && decompressor_ != nullptr) {
+    if (!prefetched_) {
+      prefetched_ = true;
+      PrefetchPages();
+    }
+    while (next_prefetched_page_ < prefetched_headers_.size()) {
+      const size_t i = next_prefetched_page_++;
+      std::shared_ptr<Buffer> page_buffer = std::move(prefetched_buffers_[i]);
+      std::shared_ptr<Page> page = MakePage(prefetched_headers_[i], page_buffer);
+      if (page != nullptr) {
+        return page;
+      }
+    }
+    return std::shared_ptr<Page>(nullptr);
+  }
+
+  // Loop here because there may be unhandled page types that we skip until
+  // finding a page that we do know what to do with
+  while (seen_num_rows_ < total_num_rows_) {
+    if (!ReadPageHeader()) {
+      return std::shared_ptr<Page>(nullptr);
     }
+    std::shared_ptr<Buffer> page_buffer = ReadPageData();
 
     // Uncompress it if we need to
     if (decompressor_ != nullptr) {
+      int compressed_len = current_page_header_.compressed_page_size;
+      int uncompressed_len = current_page_header_.uncompressed_page_size;
+      ARROW_TRACE_SPAN(span, "parquet", "DecompressPage");
+      ARROW_TRACE_SPAN_BYTES(span, uncompressed_len);
+      ::arrow::ScopedMemoryTag memory_tag("parquet.decompress");
+
       // Grow the uncompressed buffer if we need to.
       if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
         PARQUET_THROW_NOT_OK(decompression_buffer_->Resize(uncompressed_len, false));
@@ -210,65 +395,70 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       page_buffer = decompression_buffer_;
     }
 
-    if (current_page_header_.type == format::PageType::DICTIONARY_PAGE) {
-      const format::DictionaryPageHeader& dict_header =
-          current_page_header_.dictionary_page_header;
+    std::shared_ptr<Page> page = MakePage(current_page_header_, page_buffer);
+    if (page != nullptr) {
+      return page;
+    }
+  }
+  return std::shared_ptr<Page>(nullptr);
+}
+
+std::shared_ptr<Page> SerializedPageReader::MakePage(
+    const format::PageHeader& page_header, const std::shared_ptr<Buffer>& page_buffer) {
+  if (page_header.type == format::PageType::DICTIONARY_PAGE) {
+    const format::DictionaryPageHeader& dict_header = page_header.dictionary_page_header;
 
-      bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
+    bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
 
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              FromThrift(dict_header.encoding),
-                                              is_sorted);
-    } else if (current_page_header_.type == format::PageType::DATA_PAGE) {
-      const format::DataPageHeader& header = current_page_header_.data_page_header;
+    return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
+                                            FromThrift(dict_header.encoding), is_sorted);
+  } else if (page_header.type == format::PageType::DATA_PAGE) {
+    const format::DataPageHeader& header = page_header.data_page_header;
 
-      EncodedStatistics page_statistics;
-      if (header.__isset.statistics) {
-        const format::Statistics& stats = header.statistics;
-        if (stats.__isset.max) {
-          page_statistics.set_max(stats.max);
-        }
-        if (stats.__isset.min) {
-          page_statistics.set_min(stats.min);
-        }
-        if (stats.__isset.null_count) {
-          page_statistics.set_null_count(stats.null_count);
-        }
-        if (stats.__isset.distinct_count) {
-          page_statistics.set_distinct_count(stats.distinct_count);
-        }
+    EncodedStatistics page_statistics;
+    if (header.__isset.statistics) {
+      const format::Statistics& stats = header.statistics;
+      if (stats.__isset.max) {
+        page_statistics.set_max(stats.max);
+      }
+      if (stats.__isset.min) {
+        page_statistics.set_min(stats.min);
       }
+      if (stats.__isset.null_count) {
+        page_statistics.set_null_count(stats.null_count);
+      }
+      if (stats.__isset.distinct_count) {
+        page_statistics.set_distinct_count(stats.distinct_count);
+      }
+    }
 
-      seen_num_rows_ += header.num_values;
+    seen_num_rows_ += header.num_values;
 
-      return std::make_shared<DataPageV1>(
-          page_buffer, header.num_values, FromThrift(header.encoding),
-          FromThrift(header.definition_level_encoding),
-          FromThrift(header.repetition_level_encoding), page_statistics);
-    } else if (current_page_header_.type == format::PageType::DATA_PAGE_V2) {
-      const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
-      bool is_compressed = header.__isset.is_compressed ? header.is_compressed : false;
+    return std::make_shared<DataPageV1>(
+        page_buffer, header.num_values, FromThrift(header.encoding),
+        FromThrift(header.definition_level_encoding),
+        FromThrift(header.repetition_level_encoding), page_statistics);
+  } else if (page_header.type == format::PageType::DATA_PAGE_V2) {
+    const format::DataPageHeaderV2& header = page_header.data_page_header_v2;
+    bool is_compressed = header.__isset.is_compressed ? header.is_compressed : false;
 
-      seen_num_rows_ += header.num_values;
+    seen_num_rows_ += header.num_values;
 
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          FromThrift(header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, is_compressed);
-    } else {
-      // We don't know what this page type is. We're allowed to skip non-data
-      // pages.
-      continue;
-    }
+    return std::make_shared<DataPageV2>(
+        page_buffer, header.num_values, header.num_nulls, header.num_rows,
+        FromThrift(header.encoding), header.definition_levels_byte_length,
+        header.repetition_levels_byte_length, is_compressed);
   }
+  // We don't know what this page type is. We're allowed to skip non-data
+  // pages.
   return std::shared_ptr<Page>(nullptr);
 }
 
 std::unique_ptr<PageReader> PageReader::Open(
     const std::shared_ptr<ArrowInputStream>& stream, int64_t total_num_rows,
-    Compression::type codec, ::arrow::MemoryPool* pool) {
-  return std::unique_ptr<PageReader>(
-      new SerializedPageReader(stream, total_num_rows, codec, pool));
+    Compression::type codec, ::arrow::MemoryPool* pool, bool parallel_decompression) {
+  return std::unique_ptr<PageReader>(new SerializedPageReader(
+      stream, total_num_rows, codec, pool, parallel_decompression));
 }
 
 // ----------------------------------------------------------------------
@@ -303,6 +493,8 @@ class ColumnReaderImplBase {
   //
   // @returns: the number of values read into the out buffer
   int64_t ReadValues(int64_t batch_size, T* out) {
+    ARROW_TRACE_SPAN(span, "parquet", "DecodeValues");
+    ::arrow::ScopedMemoryTag memory_tag("parquet.decode");
     int64_t num_decoded = current_decoder_->Decode(out, static_cast<int>(batch_size));
     return num_decoded;
   }
@@ -314,6 +506,8 @@ class ColumnReaderImplBase {
   // @returns: the number of values read into the out buffer
   int64_t ReadValuesSpaced(int64_t batch_size, T* out, int64_t null_count,
                            uint8_t* valid_bits, int64_t valid_bits_offset) {
+    ARROW_TRACE_SPAN(span, "parquet", "DecodeValues");
+    ::arrow::ScopedMemoryTag memory_tag("parquet.decode");
     return current_decoder_->DecodeSpaced(out, static_cast<int>(batch_size),
                                           static_cast<int>(null_count), valid_bits,
                                           valid_bits_offset);
@@ -329,6 +523,14 @@ class ColumnReaderImplBase {
     return definition_level_decoder_.Decode(static_cast<int>(batch_size), levels);
   }
 
+  // Read definition levels with a maximum of 1 into a validity bitmap
+  int64_t ReadDefinitionLevelsBitmap(int64_t batch_size, uint8_t* valid_bits,
+                                     int64_t valid_bits_offset) {
+    DCHECK_EQ(max_def_level_, 1);
+    return definition_level_decoder_.DecodeBitmap(static_cast<int>(batch_size),
+                                                  valid_bits, valid_bits_offset);
+  }
+
   bool HasNextInternal() {
     // Either there is no data page available yet, or the data page has been
     // exhausted
@@ -353,6 +555,7 @@ class ColumnReaderImplBase {
   bool ReadNewPage() {
     // Loop until we find the next data page.
     while (true) {
+      ARROW_TRACE_SPAN(span, "parquet", "ReadPage");
       current_page_ = pager_->NextPage();
       if (!current_page_) {
         // EOS
@@ -483,8 +686,12 @@ class ColumnReaderImplBase {
       current_decoder_ = it->second.get();
     } else {
       switch (encoding) {
-        case Encoding::PLAIN: {
-          auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
+        case Encoding::PLAIN:
+        case Encoding::DELTA_BINARY_PACKED:
+        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+        case Encoding::DELTA_BYTE_ARRAY:
+        case Encoding::BYTE_STREAM_SPLIT: {
+          auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
           current_decoder_ = decoder.get();
           decoders_[static_cast<int>(encoding)] = std::move(decoder);
           break;
@@ -492,11 +699,6 @@ class ColumnReaderImplBase {
         case Encoding::RLE_DICTIONARY:
           throw ParquetException("Dictionary page must be before data page.");
 
-        case Encoding::DELTA_BINARY_PACKED:
-        case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-        case Encoding::DELTA_BYTE_ARRAY:
-          ParquetException::NYI("Unsupported encoding");
-
         default:
           throw ParquetException("Unknown encoding type.");
       }
@@ -815,6 +1017,10 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   }
 
   int64_t ReadRecords(int64_t num_records) override {
+    if (LevelsToBitmap()) {
+      return ReadRecordsBitmap(num_records);
+    }
+
     // Delimit records, then read values at the end
     int64_t records_read = 0;
 
@@ -883,6 +1089,184 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     return records_read;
   }
 
+  int64_t SkipRecords(int64_t num_records) override {
+    if (LevelsToBitmap()) {
+      return SkipRecordsBitmap(num_records);
+    }
+
+    int64_t records_skipped = 0;
+
+    if (levels_position_ < levels_written_) {
+      records_skipped += SkipRecordData(num_records);
+    }
+
+    while (!at_record_start_ || records_skipped < num_records) {
+      if (!this->HasNextInternal()) {
+        if (!at_record_start_) {
+          // The row group ended inside the last record
+          ++records_skipped;
+          at_record_start_ = true;
+        }
+        break;
+      }
+
+      const int64_t available = available_values_current_page();
+      if (this->max_rep_level_ == 0 && num_records - records_skipped >= available) {
+        // Without repetition levels each level is a record, so the rest of the
+        // page can be dropped without decoding its levels or values
+        this->ConsumeBufferedValues(available);
+        records_skipped += available;
+        continue;
+      }
+
+      const int64_t batch_size = std::min(kMinLevelBatchSize, available);
+      if (this->max_def_level_ > 0) {
+        ReserveLevels(batch_size);
+
+        int16_t* def_levels = this->def_levels() + levels_written_;
+        int16_t* rep_levels = this->rep_levels() + levels_written_;
+
+        int64_t levels_read = this->ReadDefinitionLevels(batch_size, def_levels);
+        if (this->max_rep_level_ > 0 &&
+            this->ReadRepetitionLevels(batch_size, rep_levels) != levels_read) {
+          throw ParquetException("Number of decoded rep / def levels did not match");
+        }
+
+        // Exhausted column chunk
+        if (levels_read == 0) {
+          break;
+        }
+
+        levels_written_ += levels_read;
+        records_skipped += SkipRecordData(num_records - records_skipped);
+      } else {
+        const int64_t values_to_skip =
+            std::min(num_records - records_skipped, batch_size);
+        SkipValues(values_to_skip);
+        this->ConsumeBufferedValues(values_to_skip);
+        records_skipped += values_to_skip;
+      }
+    }
+
+    return records_skipped;
+  }
+
+  // Whether the definition levels are decoded straight into the validity
+  // bitmap: every level is then a record, and a value if the level is 1
+  bool LevelsToBitmap() const {
+    return !materialize_levels_ && this->max_def_level_ == 1 &&
+           this->max_rep_level_ == 0;
+  }
+
+  int64_t ReadRecordsBitmap(int64_t num_records) {
+    int64_t records_read = 0;
+    while (records_read < num_records && this->HasNextInternal()) {
+      const int64_t batch_size =
+          std::min(num_records - records_read, available_values_current_page());
+      ReserveValues(batch_size);
+
+      uint8_t* valid_bits = valid_bits_->mutable_data();
+      const int64_t levels_read =
+          this->ReadDefinitionLevelsBitmap(batch_size, valid_bits, values_written_);
+      if (levels_read == 0) {
+        break;
+      }
+      const int64_t null_count =
+          levels_read -
+          ::arrow::internal::CountSetBits(valid_bits, values_written_, levels_read);
+
+      ReadValuesSpaced(levels_read, null_count);
+      this->ConsumeBufferedValues(levels_read);
+      values_written_ += levels_read;
+      null_count_ += null_count;
+      records_read += levels_read;
+    }
+    return records_read;
+  }
+
+  int64_t SkipRecordsBitmap(int64_t num_records) {
+    int64_t records_skipped = 0;
+    while (records_skipped < num_records && this->HasNextInternal()) {
+      const int64_t available = available_values_current_page();
+      if (num_records - records_skipped >= available) {
+        this->ConsumeBufferedValues(available);
+        records_skipped += available;
+        continue;
+      }
+
+      // Only the levels of the skipped records are decoded, so that reading
+      // resumes at the next level
+      const int64_t batch_size = num_records - records_skipped;
+      if (!skip_valid_bits_) {
+        skip_valid_bits_ = AllocateBuffer(this->pool_);
+      }
+      PARQUET_THROW_NOT_OK(
+          skip_valid_bits_->Resize(BitUtil::BytesForBits(batch_size), false));
+      uint8_t* valid_bits = skip_valid_bits_->mutable_data();
+      const int64_t levels_read =
+          this->ReadDefinitionLevelsBitmap(batch_size, valid_bits, 0);
+      if (levels_read == 0) {
+        break;
+      }
+      SkipValues(::arrow::internal::CountSetBits(valid_bits, 0, levels_read));
+      this->ConsumeBufferedValues(levels_read);
+      records_skipped += levels_read;
+    }
+    return records_skipped;
+  }
+
+  // Skip records in the decoded levels that haven't been consumed yet, and
+  // remove their levels so that def_levels() and rep_levels() only hold those
+  // of the records read since the last Reset
+  //
+  // \return Number of records skipped
+  int64_t SkipRecordData(int64_t num_records) {
+    const int64_t start_levels_position = levels_position_;
+
+    int64_t values_to_skip = 0;
+    int64_t records_skipped = 0;
+    if (this->max_rep_level_ > 0) {
+      records_skipped = DelimitRecords(num_records, &values_to_skip);
+    } else {
+      records_skipped = std::min(levels_written_ - levels_position_, num_records);
+      levels_position_ += records_skipped;
+      values_to_skip = std::count(def_levels() + start_levels_position,
+                                  def_levels() + levels_position_, this->max_def_level_);
+    }
+    SkipValues(values_to_skip);
+
+    const int64_t levels_skipped = levels_position_ - start_levels_position;
+    this->ConsumeBufferedValues(levels_skipped);
+
+    int16_t* def_data = def_levels();
+    std::copy(def_data + levels_position_, def_data + levels_written_,
+              def_data + start_levels_position);
+    if (this->max_rep_level_ > 0) {
+      int16_t* rep_data = rep_levels();
+      std::copy(rep_data + levels_position_, rep_data + levels_written_,
+                rep_data + start_levels_position);
+    }
+    levels_written_ -= levels_skipped;
+    levels_position_ = start_levels_position;
+
+    return records_skipped;
+  }
+
+  // Decoders cannot skip values, so decode them into a scratch buffer
+  void SkipValues(int64_t num_values) {
+    if (skip_scratch_ == nullptr) {
+      skip_scratch_ = AllocateBuffer(this->pool_, kMinLevelBatchSize * sizeof(T));
+    }
+    T* scratch = reinterpret_cast<T*>(skip_scratch_->mutable_data());
+    while (num_values > 0) {
+      const int batch_size = static_cast<int>(std::min(kMinLevelBatchSize, num_values));
+      if (this->current_decoder_->Decode(scratch, batch_size) != batch_size) {
+        throw ParquetException("Data page has fewer values than its levels");
+      }
+      num_values -= batch_size;
+    }
+  }
+
   // We may outwardly have the appearance of having exhausted a column chunk
   // when in fact we are in the middle of processing the last batch
   bool has_values_to_process() const { return levels_position_ < levels_written_; }
@@ -1085,6 +1469,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
       records_read = values_to_read = num_records;
     }
 
+    ARROW_TRACE_SPAN(span, "parquet", "DecodeValues");
+    ::arrow::ScopedMemoryTag memory_tag("parquet.decode");
     int64_t null_count = 0;
     if (nullable_values_) {
       int64_t values_with_nulls = 0;
@@ -1150,6 +1536,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  std::shared_ptr<ResizableBuffer> skip_scratch_;
+  std::shared_ptr<ResizableBuffer> skip_valid_bits_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1320,6 +1709,158 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
+/// \brief Read BYTE_ARRAY records to dictionary-encoded form with a single
+/// dictionary for all row groups read since the last call to GetResult
+///
+/// Each new dictionary page is merged into a memo table once, yielding a
+/// mapping from page indices to unified indices. The decoded indices are then
+/// remapped, so dictionary-encoded values are never hashed. Values of pages
+/// that fell back to plain encoding are hashed into the memo table one by one.
+class ByteArrayUnifiedDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
+                                               virtual public DictionaryRecordReader {
+ public:
+  ByteArrayUnifiedDictionaryRecordReader(const ColumnDescriptor* descr,
+                                         ::arrow::MemoryPool* pool)
+      : TypedRecordReader<ByteArrayType>(descr, pool),
+        memo_table_(pool),
+        indices_builder_(pool),
+        fallback_builder_(kBinaryChunksize, pool) {
+    this->read_dictionary_ = true;
+  }
+
+  std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
+    std::vector<std::shared_ptr<::arrow::Array>> chunks;
+    if (indices_builder_.length() > 0) {
+      std::shared_ptr<::arrow::Array> indices;
+      PARQUET_THROW_NOT_OK(indices_builder_.Finish(&indices));
+
+      // The memo table only grows, so indices finished by earlier calls remain
+      // valid for the dictionary built here
+      using DictTraits = ::arrow::internal::DictionaryTraits<::arrow::BinaryType>;
+      std::shared_ptr<::arrow::ArrayData> dictionary;
+      PARQUET_THROW_NOT_OK(DictTraits::GetDictionaryArrayData(
+          this->pool_, ::arrow::binary(), memo_table_, /*start_offset=*/0, &dictionary));
+      chunks.push_back(std::make_shared<::arrow::DictionaryArray>(
+          ::arrow::dictionary(::arrow::int32(), ::arrow::binary()), indices,
+          ::arrow::MakeArray(dictionary)));
+    }
+    return std::make_shared<::arrow::ChunkedArray>(std::move(chunks));
+  }
+
+  void ReadValuesDense(int64_t values_to_read) override {
+    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+      auto decoder = MaybeMergeNewDictionary();
+      int32_t* indices = ReserveIndices(values_to_read);
+      int64_t num_decoded =
+          decoder->DecodeIndices(static_cast<int>(values_to_read), indices);
+      DCHECK_EQ(num_decoded, values_to_read);
+      for (int64_t i = 0; i < values_to_read; ++i) {
+        indices[i] = RemapIndex(indices[i]);
+      }
+      PARQUET_THROW_NOT_OK(indices_builder_.AppendValues(indices, values_to_read));
+    } else {
+      int64_t num_decoded = this->current_decoder_->DecodeArrowNonNull(
+          static_cast<int>(values_to_read), &fallback_builder_);
+      DCHECK_EQ(num_decoded, values_to_read);
+      InsertFallbackValues();
+
+      /// Flush values since they have been copied into the builder
+      ResetValues();
+    }
+  }
+
+  void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
+    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+      auto decoder = MaybeMergeNewDictionary();
+      int32_t* indices = ReserveIndices(values_to_read);
+      int64_t num_decoded = decoder->DecodeIndicesSpaced(
+          static_cast<int>(values_to_read), static_cast<int>(null_count),
+          valid_bits_->mutable_data(), values_written_, indices);
+      DCHECK_EQ(num_decoded, values_to_read - null_count);
+
+      valid_bytes_.resize(values_to_read);
+      ::arrow::internal::BitmapReader bit_reader(valid_bits_->data(), values_written_,
+                                                 values_to_read);
+      for (int64_t i = 0; i < values_to_read; ++i) {
+        const bool is_valid = bit_reader.IsSet();
+        valid_bytes_[i] = static_cast<uint8_t>(is_valid);
+        indices[i] = is_valid ? RemapIndex(indices[i]) : 0;
+        bit_reader.Next();
+      }
+      PARQUET_THROW_NOT_OK(
+          indices_builder_.AppendValues(indices, values_to_read, valid_bytes_.data()));
+    } else {
+      int64_t num_decoded = this->current_decoder_->DecodeArrow(
+          static_cast<int>(values_to_read), static_cast<int>(null_count),
+          valid_bits_->mutable_data(), values_written_, &fallback_builder_);
+      DCHECK_EQ(num_decoded, values_to_read - null_count);
+      InsertFallbackValues();
+
+      /// Flush values since they have been copied into the builder
+      ResetValues();
+    }
+  }
+
+ private:
+  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+
+  // ARROW-4688(wesm): Using 2^31 - 1 chunks for now
+  static constexpr int32_t kBinaryChunksize = 2147483647;
+
+  BinaryDictDecoder* MaybeMergeNewDictionary() {
+    auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+    if (this->new_dictionary_) {
+      const ByteArray* dictionary = nullptr;
+      int32_t dictionary_length = 0;
+      decoder->GetDictionary(&dictionary, &dictionary_length);
+      dictionary_remap_.resize(dictionary_length);
+      for (int32_t i = 0; i < dictionary_length; ++i) {
+        dictionary_remap_[i] = memo_table_.GetOrInsert(
+            dictionary[i].ptr, static_cast<int32_t>(dictionary[i].len));
+      }
+      this->new_dictionary_ = false;
+    }
+    return decoder;
+  }
+
+  int32_t RemapIndex(int32_t index) const {
+    if (ARROW_PREDICT_FALSE(index < 0 ||
+                            index >= static_cast<int32_t>(dictionary_remap_.size()))) {
+      throw ParquetException("Dictionary index out of bounds");
+    }
+    return dictionary_remap_[index];
+  }
+
+  int32_t* ReserveIndices(int64_t num_values) {
+    indices_scratch_.resize(num_values);
+    return indices_scratch_.data();
+  }
+
+  void InsertFallbackValues() {
+    std::vector<std::shared_ptr<::arrow::Array>> chunks;
+    PARQUET_THROW_NOT_OK(fallback_builder_.Finish(&chunks));
+    for (const auto& chunk : chunks) {
+      const auto& values = static_cast<const ::arrow::BinaryArray&>(*chunk);
+      PARQUET_THROW_NOT_OK(indices_builder_.Reserve(values.length()));
+      for (int64_t i = 0; i < values.length(); ++i) {
+        if (values.IsNull(i)) {
+          indices_builder_.UnsafeAppendNull();
+        } else {
+          indices_builder_.UnsafeAppend(memo_table_.GetOrInsert(values.GetView(i)));
+        }
+      }
+    }
+  }
+
+  ::arrow::internal::BinaryMemoTable memo_table_;
+  // Unified index of each value of the current dictionary page
+  std::vector<int32_t> dictionary_remap_;
+  std::vector<int32_t> indices_scratch_;
+  std::vector<uint8_t> valid_bytes_;
+  ::arrow::Int32Builder indices_builder_;
+  ::arrow::internal::ChunkedBinaryBuilder fallback_builder_;
+};
+
 // TODO(wesm): Implement these to some satisfaction
 template <>
 void TypedRecordReader<Int96Type>::DebugPrintState() {}
@@ -1332,8 +1873,11 @@ void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
 std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
                                                         arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
-  if (read_dictionary) {
+                                                        bool read_dictionary,
+                                                        bool unify_dictionaries) {
+  if (read_dictionary && unify_dictionaries) {
+    return std::make_shared<ByteArrayUnifiedDictionaryRecordReader>(descr, pool);
+  } else if (read_dictionary) {
     return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
@@ -1342,7 +1886,8 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
 
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
-                                                 const bool read_dictionary) {
+                                                 const bool read_dictionary,
+                                                 const bool unify_dictionaries) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
@@ -1357,7 +1902,8 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::DOUBLE:
       return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, pool, read_dictionary);
+      return MakeByteArrayRecordReader(descr, pool, read_dictionary,
+                                       unify_dictionaries);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, pool);
     default: {
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "parquet/exception.h"
+#include "parquet/level_conversion.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -64,6 +65,11 @@ class PARQUET_EXPORT LevelDecoder {
   // Decodes a batch of levels into an array and returns the number of levels decoded
   int Decode(int batch_size, int16_t* levels);
 
+  // Decodes a batch of levels with a maximum level of 1 straight into a
+  // bitmap, starting at bit valid_bits_offset, and returns the number of
+  // levels decoded
+  int DecodeBitmap(int batch_size, uint8_t* valid_bits, int64_t valid_bits_offset);
+
  private:
   int bit_width_;
   int num_values_remaining_;
@@ -78,10 +84,17 @@ class PARQUET_EXPORT PageReader {
  public:
   virtual ~PageReader() = default;
 
+  /// \brief Open a reader for the serialized pages of a column chunk
+  ///
+  /// With parallel_decompression, the first call to NextPage reads all pages
+  /// of the column chunk and decompresses them concurrently on the CPU thread
+  /// pool. This trades memory, as the whole column chunk is held uncompressed,
+  /// for faster reads of large compressed column chunks.
   static std::unique_ptr<PageReader> Open(
       const std::shared_ptr<ArrowInputStream>& stream, int64_t total_num_rows,
       Compression::type codec,
-      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
+      bool parallel_decompression = false);
 
   // @returns: shared_ptr<Page>(nullptr) on EOS, std::shared_ptr<Page>
   // containing new Page otherwise
@@ -188,7 +201,7 @@ class RecordReader {
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      const bool read_dictionary = false);
+      const bool read_dictionary = false, const bool unify_dictionaries = false);
 
   virtual ~RecordReader() = default;
 
@@ -196,6 +209,12 @@ class RecordReader {
   /// \return number of records read
   virtual int64_t ReadRecords(int64_t num_records) = 0;
 
+  /// \brief Attempt to skip indicated number of records from column chunk,
+  /// without adding their values or levels to those read. Pages made only of
+  /// skipped records of a column without repetition levels are not decoded
+  /// \return number of records skipped
+  virtual int64_t SkipRecords(int64_t num_records) = 0;
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   virtual void Reserve(int64_t num_values) = 0;
 
@@ -254,6 +273,13 @@ class RecordReader {
   /// \brief True if reading directly as Arrow dictionary-encoded
   bool read_dictionary() const { return read_dictionary_; }
 
+  /// \brief Whether to decode definition levels into def_levels(). If not,
+  /// the levels of a column without repetition levels and with a maximum
+  /// definition level of 1 are decoded straight into the validity bitmap,
+  /// and def_levels() and levels_position() are left empty. Other columns
+  /// always decode their levels. Must be set before reading.
+  void set_materialize_levels(bool materialize) { materialize_levels_ = materialize; }
+
  protected:
   bool nullable_values_;
 
@@ -278,6 +304,7 @@ class RecordReader {
   std::shared_ptr<::arrow::ResizableBuffer> rep_levels_;
 
   bool read_dictionary_ = false;
+  bool materialize_levels_ = true;
 };
 
 class BinaryRecordReader : virtual public RecordReader {
@@ -287,54 +314,16 @@ class BinaryRecordReader : virtual public RecordReader {
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
 /// indices). Only valid for BYTE_ARRAY columns
+///
+/// By default a new chunk is started whenever a column chunk has a new
+/// dictionary. If the reader was made with unify_dictionaries, GetResult
+/// instead returns a single chunk whose dictionary holds the values of all
+/// dictionaries read so far.
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
 };
 
-static inline void DefinitionLevelsToBitmap(
-    const int16_t* def_levels, int64_t num_def_levels, const int16_t max_definition_level,
-    const int16_t max_repetition_level, int64_t* values_read, int64_t* null_count,
-    uint8_t* valid_bits, int64_t valid_bits_offset) {
-  // We assume here that valid_bits is large enough to accommodate the
-  // additional definition levels and the ones that have already been written
-  ::arrow::internal::BitmapWriter valid_bits_writer(valid_bits, valid_bits_offset,
-                                                    num_def_levels);
-
-  // TODO(itaiin): As an interim solution we are splitting the code path here
-  // between repeated+flat column reads, and non-repeated+nested reads.
-  // Those paths need to be merged in the future
-  for (int i = 0; i < num_def_levels; ++i) {
-    if (def_levels[i] == max_definition_level) {
-      valid_bits_writer.Set();
-    } else if (max_repetition_level > 0) {
-      // repetition+flat case
-      if (def_levels[i] == (max_definition_level - 1)) {
-        valid_bits_writer.Clear();
-        *null_count += 1;
-      } else {
-        continue;
-      }
-    } else {
-      // non-repeated+nested case
-      if (def_levels[i] < max_definition_level) {
-        valid_bits_writer.Clear();
-        *null_count += 1;
-      } else {
-        throw ParquetException("definition level exceeds maximum");
-      }
-    }
-
-    valid_bits_writer.Next();
-  }
-  valid_bits_writer.Finish();
-  *values_read = valid_bits_writer.position();
-}
-
-}  // namespace internal
-
-namespace internal {
-
 // TODO(itaiin): another code path split to merge when the general case is done
 static inline bool HasSpacedValues(const ColumnDescriptor* descr) {
   if (descr->max_repetition_level() > 0) {
@@ -433,5 +433,34 @@ TEST(TestColumnReader, DefinitionLevelsToBitmapPowerOfTwo) {
   ASSERT_EQ(0, null_count);
 }
 
+TEST(TestColumnReader, DefinitionLevelsToBitmapNonRepeated) {
+  // More than one batch of 64 levels, written at an unaligned offset
+  const int num_levels = 150;
+  std::vector<int16_t> def_levels(num_levels);
+  for (int i = 0; i < num_levels; ++i) {
+    def_levels[i] = static_cast<int16_t>(i % 5 == 0 ? i % 2 : 2);
+  }
+  std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(num_levels + 3), 0xFF);
+
+  int64_t values_read = -1;
+  int64_t null_count = 0;
+  internal::DefinitionLevelsToBitmap(def_levels.data(), num_levels, 2, 0, &values_read,
+                                     &null_count, valid_bits.data(), 3);
+  ASSERT_EQ(num_levels, values_read);
+  ASSERT_EQ(num_levels / 5, null_count);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_TRUE(BitUtil::GetBit(valid_bits.data(), i));
+  }
+  for (int i = 0; i < num_levels; ++i) {
+    ASSERT_EQ(i % 5 != 0, BitUtil::GetBit(valid_bits.data(), 3 + i)) << i;
+  }
+
+  def_levels[100] = 3;
+  ASSERT_THROW(internal::DefinitionLevelsToBitmap(def_levels.data(), num_levels, 2, 0,
+                                                  &values_read, &null_count,
+                                                  valid_bits.data(), 0),
+               ParquetException);
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -18,26 +18,32 @@
 #include "parquet/column_writer.h"
 
 #include <algorithm>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/builder.h"
 #include "arrow/compute/api.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_stream_utils.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -130,6 +136,96 @@ int LevelEncoder::Encode(int batch_size, const int16_t* levels) {
 // ----------------------------------------------------------------------
 // PageWriter implementation
 
+namespace {
+
+// Decompressions of a trial sample, of which the fastest is kept
+constexpr int kTrialDecompressionRuns = 3;
+
+struct CodecTrial {
+  CodecSetting setting;
+  int64_t compressed_size;
+  double decompression_seconds;
+};
+
+// Trial compress the sample with each usable candidate of options and set
+// *out to the best one by the objective of options. Returns false if no
+// candidate is usable.
+bool ChooseCodec(const AdaptiveCompressionOptions& options, const uint8_t* sample,
+                 int64_t sample_size, MemoryPool* pool, CodecSetting* out) {
+  std::vector<CodecTrial> trials;
+  std::shared_ptr<ResizableBuffer> compressed = AllocateBuffer(pool, 0);
+  std::shared_ptr<ResizableBuffer> decompressed = AllocateBuffer(pool, sample_size);
+  for (const CodecSetting& candidate : options.candidates) {
+    std::unique_ptr<arrow::util::Codec> codec;
+    if (candidate.codec == Compression::UNCOMPRESSED ||
+        !IsCodecSupported(candidate.codec) ||
+        !arrow::util::Codec::Create(candidate.codec, candidate.compression_level, &codec)
+             .ok()) {
+      continue;
+    }
+    const int64_t max_compressed_size = codec->MaxCompressedLen(sample_size, sample);
+    PARQUET_THROW_NOT_OK(compressed->Resize(max_compressed_size, false));
+    int64_t compressed_size;
+    PARQUET_THROW_NOT_OK(codec->Compress(sample_size, sample, max_compressed_size,
+                                         compressed->mutable_data(), &compressed_size));
+
+    double seconds = std::numeric_limits<double>::infinity();
+    for (int run = 0; run < kTrialDecompressionRuns; ++run) {
+      const auto start = std::chrono::steady_clock::now();
+      PARQUET_THROW_NOT_OK(codec->Decompress(compressed_size, compressed->data(),
+                                             sample_size, decompressed->mutable_data()));
+      const std::chrono::duration<double> elapsed =
+          std::chrono::steady_clock::now() - start;
+      seconds = std::min(seconds, elapsed.count());
+    }
+    trials.push_back({candidate, compressed_size, seconds});
+  }
+  if (trials.empty()) {
+    return false;
+  }
+
+  auto smaller = [](const CodecTrial& a, const CodecTrial& b) {
+    return a.compressed_size < b.compressed_size ||
+           (a.compressed_size == b.compressed_size &&
+            a.decompression_seconds < b.decompression_seconds);
+  };
+  auto faster = [](const CodecTrial& a, const CodecTrial& b) {
+    return a.decompression_seconds < b.decompression_seconds ||
+           (a.decompression_seconds == b.decompression_seconds &&
+            a.compressed_size < b.compressed_size);
+  };
+  std::vector<CodecTrial>::const_iterator best;
+  switch (options.objective) {
+    case AdaptiveCompressionOptions::SIZE:
+      best = std::min_element(trials.begin(), trials.end(), smaller);
+      break;
+    case AdaptiveCompressionOptions::DECOMPRESSION_SPEED:
+      best = std::min_element(trials.begin(), trials.end(), faster);
+      break;
+    case AdaptiveCompressionOptions::WEIGHTED: {
+      // Both terms are relative to the best candidate, so that they are
+      // commensurable; the floors keep them finite
+      const double min_size = std::max<double>(
+          std::min_element(trials.begin(), trials.end(), smaller)->compressed_size, 1);
+      const double min_seconds = std::max(
+          std::min_element(trials.begin(), trials.end(), faster)->decompression_seconds,
+          1e-9);
+      auto score = [&](const CodecTrial& trial) {
+        return options.size_weight * (trial.compressed_size / min_size) +
+               (1 - options.size_weight) * (trial.decompression_seconds / min_seconds);
+      };
+      best = std::min_element(
+          trials.begin(), trials.end(),
+          [&](const CodecTrial& a, const CodecTrial& b) { return score(a) < score(b); });
+      break;
+    }
+  }
+  *out = best->setting;
+  return true;
+}
+
+}  // namespace
+
 // This subclass delimits pages appearing in a serialized stream, each preceded
 // by a serialized Thrift format::PageHeader indicating the type of each page
 // and the page metadata.
@@ -138,7 +234,10 @@ class SerializedPageWriter : public PageWriter {
   SerializedPageWriter(const std::shared_ptr<ArrowOutputStream>& sink,
                        Compression::type codec, int compression_level,
                        ColumnChunkMetaDataBuilder* metadata,
-                       MemoryPool* pool = arrow::default_memory_pool())
+                       MemoryPool* pool = arrow::default_memory_pool(),
+                       bool write_page_index = false,
+                       const AdaptiveCompressionOptions* adaptive_options = NULLPTR,
+                       AdaptiveCodecChoice* choice = NULLPTR)
       : sink_(sink),
         metadata_(metadata),
         pool_(pool),
@@ -146,9 +245,18 @@ class SerializedPageWriter : public PageWriter {
         dictionary_page_offset_(0),
         data_page_offset_(0),
         total_uncompressed_size_(0),
-        total_compressed_size_(0) {
-    compressor_ = GetCodec(codec, compression_level);
+        total_compressed_size_(0),
+        adaptive_options_(adaptive_options),
+        choice_(choice),
+        codec_chosen_(false) {
+    // With adaptive compression, the codec is chosen by the first Compress
+    if (adaptive_options_ == nullptr) {
+      compressor_ = GetCodec(codec, compression_level);
+    }
     thrift_serializer_.reset(new ThriftSerializer);
+    if (write_page_index) {
+      page_index_builder_.reset(new PageIndexBuilder(metadata->descr()));
+    }
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
@@ -191,7 +299,8 @@ class SerializedPageWriter : public PageWriter {
     return final_pos - start_pos;
   }
 
-  void Close(bool has_dictionary, bool fallback) override {
+  void Close(bool has_dictionary, bool fallback,
+             const BloomFilter* bloom_filter) override {
     // index_page_offset = -1 since they are not supported
     metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
@@ -199,12 +308,45 @@ class SerializedPageWriter : public PageWriter {
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(sink_.get());
+
+    // The Bloom filter follows the column chunk metadata, so that its offset
+    // only ends up in the file footer
+    if (bloom_filter != nullptr) {
+      int64_t bloom_filter_offset = -1;
+      PARQUET_THROW_NOT_OK(sink_->Tell(&bloom_filter_offset));
+      metadata_->SetBloomFilterOffset(bloom_filter_offset);
+      bloom_filter->WriteTo(sink_.get());
+    }
+
+    WritePageIndex(0);
+  }
+
+  // Write the page indexes, if enabled, to the sink. `base_offset` is the
+  // position of the sink in the file.
+  void WritePageIndex(int64_t base_offset) {
+    if (page_index_builder_ != nullptr) {
+      page_index_builder_->WriteTo(sink_.get(), base_offset, metadata_);
+    }
   }
 
   /**
    * Compress a buffer.
    */
   void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) override {
+    if (adaptive_options_ != nullptr) {
+      if (!codec_chosen_) {
+        ChooseCompressor(src_buffer);
+      }
+      if (compressor_ == nullptr) {
+        // No candidate was usable, the pages are stored as is
+        PARQUET_THROW_NOT_OK(dest_buffer->Resize(src_buffer.size(), false));
+        if (src_buffer.size() > 0) {
+          std::memcpy(dest_buffer->mutable_data(), src_buffer.data(),
+                      static_cast<size_t>(src_buffer.size()));
+        }
+        return;
+      }
+    }
     DCHECK(compressor_ != nullptr);
 
     // Compress the data
@@ -253,14 +395,22 @@ class SerializedPageWriter : public PageWriter {
 
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += compressed_data->size() + header_size;
-    num_values_ += page.num_values();
 
     int64_t current_pos = -1;
     PARQUET_THROW_NOT_OK(sink_->Tell(&current_pos));
+    if (page_index_builder_ != nullptr) {
+      // Without repetition levels, every value starts a new row
+      const auto page_size = static_cast<int32_t>(current_pos - start_pos);
+      page_index_builder_->AddPage(start_pos, page_size, num_values_, page.num_values(),
+                                   page.statistics());
+    }
+    num_values_ += page.num_values();
     return current_pos - start_pos;
   }
 
-  bool has_compressor() override { return (compressor_ != nullptr); }
+  bool has_compressor() override {
+    return compressor_ != nullptr || adaptive_options_ != nullptr;
+  }
 
   int64_t num_values() { return num_values_; }
 
@@ -273,6 +423,23 @@ class SerializedPageWriter : public PageWriter {
   int64_t total_uncompressed_size() { return total_uncompressed_size_; }
 
  private:
+  // Choose the codec of the column chunk from a sample of its first page
+  void ChooseCompressor(const Buffer& page) {
+    const int64_t sample_size = std::min(page.size(), adaptive_options_->sample_size);
+    CodecSetting setting = {Compression::UNCOMPRESSED,
+                            arrow::util::Codec::UseDefaultCompressionLevel()};
+    if (ChooseCodec(*adaptive_options_, page.data(), sample_size, pool_, &setting)) {
+      compressor_ = GetCodec(setting.codec, setting.compression_level);
+    }
+    metadata_->SetCompression(setting.codec);
+    codec_chosen_ = true;
+    // An empty sample says nothing of the data, the next row group tries again
+    if (choice_ != nullptr && sample_size > 0) {
+      choice_->chosen = true;
+      choice_->setting = setting;
+    }
+  }
+
   std::shared_ptr<ArrowOutputStream> sink_;
   ColumnChunkMetaDataBuilder* metadata_;
   MemoryPool* pool_;
@@ -286,6 +453,14 @@ class SerializedPageWriter : public PageWriter {
 
   // Compression codec to use.
   std::unique_ptr<arrow::util::Codec> compressor_;
+
+  // Null unless the codec is chosen by adaptive compression
+  const AdaptiveCompressionOptions* adaptive_options_;
+  AdaptiveCodecChoice* choice_;
+  bool codec_chosen_;
+
+  // Null unless page indexes are written
+  std::unique_ptr<PageIndexBuilder> page_index_builder_;
 };
 
 // This implementation of the PageWriter writes to the final sink on Close .
@@ -294,18 +469,23 @@ class BufferedPageWriter : public PageWriter {
   BufferedPageWriter(const std::shared_ptr<ArrowOutputStream>& sink,
                      Compression::type codec, int compression_level,
                      ColumnChunkMetaDataBuilder* metadata,
-                     MemoryPool* pool = arrow::default_memory_pool())
+                     MemoryPool* pool = arrow::default_memory_pool(),
+                     bool write_page_index = false,
+                     const AdaptiveCompressionOptions* adaptive_options = NULLPTR,
+                     AdaptiveCodecChoice* choice = NULLPTR)
       : final_sink_(sink), metadata_(metadata) {
     in_memory_sink_ = CreateOutputStream(pool);
-    pager_ = std::unique_ptr<SerializedPageWriter>(new SerializedPageWriter(
-        in_memory_sink_, codec, compression_level, metadata, pool));
+    pager_ = std::unique_ptr<SerializedPageWriter>(
+        new SerializedPageWriter(in_memory_sink_, codec, compression_level, metadata,
+                                 pool, write_page_index, adaptive_options, choice));
   }
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
     return pager_->WriteDictionaryPage(page);
   }
 
-  void Close(bool has_dictionary, bool fallback) override {
+  void Close(bool has_dictionary, bool fallback,
+             const BloomFilter* bloom_filter) override {
     // index_page_offset = -1 since they are not supported
     int64_t final_position = -1;
     PARQUET_THROW_NOT_OK(final_sink_->Tell(&final_position));
@@ -317,6 +497,15 @@ class BufferedPageWriter : public PageWriter {
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
 
+    if (bloom_filter != nullptr) {
+      int64_t bloom_filter_offset = -1;
+      PARQUET_THROW_NOT_OK(in_memory_sink_->Tell(&bloom_filter_offset));
+      metadata_->SetBloomFilterOffset(bloom_filter_offset + final_position);
+      bloom_filter->WriteTo(in_memory_sink_.get());
+    }
+
+    pager_->WritePageIndex(final_position);
+
     // flush everything to the serialized sink
     std::shared_ptr<Buffer> buffer;
     PARQUET_THROW_NOT_OK(in_memory_sink_->Finish(&buffer));
@@ -343,13 +532,36 @@ class BufferedPageWriter : public PageWriter {
 std::unique_ptr<PageWriter> PageWriter::Open(
     const std::shared_ptr<ArrowOutputStream>& sink, Compression::type codec,
     int compression_level, ColumnChunkMetaDataBuilder* metadata, MemoryPool* pool,
-    bool buffered_row_group) {
+    bool buffered_row_group, bool write_page_index) {
+  if (write_page_index && metadata->descr()->max_repetition_level() > 0) {
+    throw ParquetException("Page indexes can only be written for non-repeated columns");
+  }
+  if (buffered_row_group) {
+    return std::unique_ptr<PageWriter>(new BufferedPageWriter(
+        sink, codec, compression_level, metadata, pool, write_page_index));
+  } else {
+    return std::unique_ptr<PageWriter>(new SerializedPageWriter(
+        sink, codec, compression_level, metadata, pool, write_page_index));
+  }
+}
+
+std::unique_ptr<PageWriter> PageWriter::OpenAdaptive(
+    const std::shared_ptr<ArrowOutputStream>& sink,
+    const AdaptiveCompressionOptions& options, AdaptiveCodecChoice* choice,
+    ColumnChunkMetaDataBuilder* metadata, MemoryPool* pool, bool buffered_row_group,
+    bool write_page_index) {
+  if (write_page_index && metadata->descr()->max_repetition_level() > 0) {
+    throw ParquetException("Page indexes can only be written for non-repeated columns");
+  }
+  const int level = arrow::util::Codec::UseDefaultCompressionLevel();
   if (buffered_row_group) {
     return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(sink, codec, compression_level, metadata, pool));
+        new BufferedPageWriter(sink, Compression::UNCOMPRESSED, level, metadata, pool,
+                               write_page_index, &options, choice));
   } else {
     return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(sink, codec, compression_level, metadata, pool));
+        new SerializedPageWriter(sink, Compression::UNCOMPRESSED, level, metadata, pool,
+                                 write_page_index, &options, choice));
   }
 }
 
@@ -381,6 +593,9 @@ class ColumnWriterImpl {
         total_compressed_bytes_(0),
         closed_(false),
         fallback_(false),
+        num_dictionary_values_(0),
+        dictionary_sampled_(false),
+        dictionary_rejected_(false),
         definition_levels_sink_(allocator_),
         repetition_levels_sink_(allocator_) {
     definition_levels_rle_ =
@@ -414,6 +629,9 @@ class ColumnWriterImpl {
   // Merges page statistics into chunk statistics, then resets the values
   virtual void ResetPageStatistics() = 0;
 
+  // Bloom filter of the whole chunk, or null if disabled for the column
+  virtual const BloomFilter* GetBloomFilter() = 0;
+
   // Adds Data Pages to an in memory buffer in dictionary encoding mode
   // Serializes the Data Pages in other encoding modes
   void AddDataPage();
@@ -484,6 +702,14 @@ class ColumnWriterImpl {
   // Flag to infer if dictionary encoding has fallen back to PLAIN
   bool fallback_;
 
+  // The number of non-null values put to the encoder, which the dictionary
+  // encoding estimate of WriterProperties::dictionary_sample_size waits for
+  int64_t num_dictionary_values_;
+
+  // Whether that estimate was made, and fell back to PLAIN
+  bool dictionary_sampled_;
+  bool dictionary_rejected_;
+
   arrow::BufferBuilder definition_levels_sink_;
   arrow::BufferBuilder repetition_levels_sink_;
 
@@ -614,7 +840,7 @@ int64_t ColumnWriterImpl::Close() {
     if (rows_written_ > 0 && chunk_statistics.is_set()) {
       metadata_->SetStatistics(chunk_statistics);
     }
-    pager_->Close(has_dictionary_, fallback_);
+    pager_->Close(has_dictionary_, fallback_, GetBloomFilter());
   }
 
   return total_bytes_written_;
@@ -679,6 +905,27 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+template <typename T>
+inline uint64_t ComputeBloomFilterHash(const BloomFilter& filter, T value,
+                                       const ColumnDescriptor*) {
+  return filter.Hash(value);
+}
+
+inline uint64_t ComputeBloomFilterHash(const BloomFilter& filter, const Int96& value,
+                                       const ColumnDescriptor*) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t ComputeBloomFilterHash(const BloomFilter& filter, const ByteArray& value,
+                                       const ColumnDescriptor*) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t ComputeBloomFilterHash(const BloomFilter& filter, const FLBA& value,
+                                       const ColumnDescriptor* descr) {
+  return filter.Hash(&value, static_cast<uint32_t>(descr->type_length()));
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -697,6 +944,17 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_ = MakeStatistics<DType>(descr_, allocator_);
       chunk_statistics_ = MakeStatistics<DType>(descr_, allocator_);
     }
+
+    // The Bloom filter hashes have no BOOLEAN variant, and two values
+    // would not be worth filtering anyway
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        DType::type_num != Type::BOOLEAN) {
+      const uint32_t num_bits = BlockSplitBloomFilter::OptimalNumOfBits(
+          static_cast<uint32_t>(properties->bloom_filter_ndv(descr_->path())),
+          properties->bloom_filter_fpp(descr_->path()));
+      bloom_filter_.reset(new BlockSplitBloomFilter());
+      bloom_filter_->Init(num_bits / 8);
+    }
   }
 
   int64_t Close() override { return ColumnWriterImpl::Close(); }
@@ -812,6 +1070,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  const BloomFilter* GetBloomFilter() override { return bloom_filter_.get(); }
+
   Type::type type() const override { return descr_->physical_type(); }
 
   const ColumnDescriptor* descr() const override { return descr_; }
@@ -824,18 +1084,24 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   const WriterProperties* properties() override { return properties_; }
 
+  bool dictionary_rejected() const override { return dictionary_rejected_; }
+
  private:
   using ValueEncoderType = typename EncodingTraits<DType>::Encoder;
   using TypedStats = TypedStatistics<DType>;
   std::unique_ptr<Encoder> current_encoder_;
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
+  std::unique_ptr<BlockSplitBloomFilter> bloom_filter_;
 
   // If writing a sequence of arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
   // subsequent array chunks to see either if materialization is required (in
   // which case we call back to the dense write path)
   std::shared_ptr<arrow::Array> preserved_dictionary_;
+  // The memo index of each value of preserved_dictionary_, if that dictionary
+  // was merged into a non-empty memo by DictEncoder<T>::InsertDictionary
+  std::shared_ptr<arrow::Array> preserved_memo_indices_;
 
   int64_t WriteLevels(int64_t num_values, const int16_t* def_levels,
                       const int16_t* rep_levels) {
@@ -947,7 +1213,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   // The encoding is switched to PLAIN
   //
   // Only one Dictionary Page is written.
-  // Fallback to PLAIN if dictionary page limit is reached.
+  // Fallback to PLAIN if dictionary page limit is reached, or if the values
+  // sampled per dictionary_sample_size are not smaller dictionary encoded.
   void CheckDictionarySizeLimit() {
     if (!has_dictionary_ || fallback_) {
       // Either not using dictionary encoding, or we have already fallen back
@@ -960,15 +1227,49 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
     if (dict_encoder->dict_encoded_size() >= properties_->dictionary_pagesize_limit()) {
       FallbackToPlainEncoding();
+      return;
+    }
+
+    const int64_t sample_size = properties_->dictionary_sample_size();
+    if (!dictionary_sampled_ && sample_size > 0 &&
+        num_dictionary_values_ >= sample_size) {
+      dictionary_sampled_ = true;
+      if (!DictionaryEncodingIsSmaller(dict_encoder)) {
+        dictionary_rejected_ = true;
+        FallbackToPlainEncoding();
+      }
+    }
+  }
+
+  // Whether the values put so far take less space as a dictionary and its
+  // indices than PLAIN encoded.  The dictionary is the PLAIN encoding of the
+  // distinct values, from which the PLAIN size of all the values is
+  // extrapolated; the indices are counted at their bit width, without the
+  // savings of their RLE runs.
+  bool DictionaryEncodingIsSmaller(DictEncoder<DType>* dict_encoder) {
+    const double num_values = static_cast<double>(num_dictionary_values_);
+    const double dict_size = static_cast<double>(dict_encoder->dict_encoded_size());
+    const int num_entries = dict_encoder->num_entries();
+    if (num_entries == 0) {
+      return true;
     }
+    const double plain_size = dict_size * num_values / num_entries;
+    const double indices_size = num_values * dict_encoder->bit_width() / 8;
+    return dict_size + indices_size < plain_size;
   }
 
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
     dynamic_cast<ValueEncoderType*>(current_encoder_.get())
         ->Put(values, static_cast<int>(num_values));
+    num_dictionary_values_ += num_values;
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      for (int64_t i = 0; i < num_values; i++) {
+        bloom_filter_->InsertHash(BloomFilterHash(values[i]));
+      }
+    }
   }
 
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
@@ -981,11 +1282,43 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       dynamic_cast<ValueEncoderType*>(current_encoder_.get())
           ->Put(values, static_cast<int>(num_values));
     }
+    num_dictionary_values_ += num_values;
     if (page_statistics_ != nullptr) {
       const int64_t num_nulls = num_spaced_values - num_values;
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, num_values,
                                      num_nulls);
     }
+    if (bloom_filter_ != nullptr) {
+      if (descr_->schema_node()->is_optional()) {
+        arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                        num_spaced_values);
+        for (int64_t i = 0; i < num_spaced_values; i++) {
+          if (valid_bits_reader.IsSet()) {
+            bloom_filter_->InsertHash(BloomFilterHash(values[i]));
+          }
+          valid_bits_reader.Next();
+        }
+      } else {
+        for (int64_t i = 0; i < num_values; i++) {
+          bloom_filter_->InsertHash(BloomFilterHash(values[i]));
+        }
+      }
+    }
+  }
+
+  uint64_t BloomFilterHash(const T& value) const {
+    return ComputeBloomFilterHash(*bloom_filter_, value, descr_);
+  }
+
+  // Insert the non-null values of a BinaryArray or StringArray
+  void UpdateBloomFilter(const arrow::Array& values) {
+    const auto& binary_array = checked_cast<const arrow::BinaryArray&>(values);
+    for (int64_t i = 0; i < binary_array.length(); i++) {
+      if (binary_array.IsValid(i)) {
+        const ByteArray value(binary_array.GetView(i));
+        bloom_filter_->InsertHash(bloom_filter_->Hash(&value));
+      }
+    }
   }
 };
 
@@ -1007,9 +1340,10 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
   //     preserved_dictionary_ so that subsequent calls to this method
   //     can make sure the dictionary has not changed
   //   - On subsequent calls, we have to check whether the dictionary
-  //     has changed. If it has, then we trigger the varying
-  //     dictionary path and materialize each chunk and then call
-  //     WriteArrow with that
+  //     has changed. If it has, then we merge the new dictionary values
+  //     into the encoder's memo and remap the indices of each chunk. Only
+  //     once the dictionary page limit is reached do we materialize each
+  //     chunk and call WriteArrow with that
   auto WriteDense = [&] {
     std::shared_ptr<arrow::Array> dense_array;
     RETURN_NOT_OK(
@@ -1044,21 +1378,51 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(const int16_t* def_lev
     value_offset += batch_num_spaced_values;
   };
 
-  // Handle seeing dictionary for the first time
-  if (!preserved_dictionary_) {
-    // It's a new dictionary. Call PutDictionary and keep track of it
-    PARQUET_CATCH_NOT_OK(dict_encoder->PutDictionary(*dictionary));
-
+  auto UpdateStatistics = [&]() -> Status {
     // TODO(wesm): If some dictionary values are unobserved, then the
     // statistics will be inaccurate. Do we care enough to fix it?
     if (page_statistics_ != nullptr) {
       PARQUET_CATCH_NOT_OK(page_statistics_->Update(*dictionary));
     }
+    // Likewise, the Bloom filter may report unobserved dictionary values
+    if (bloom_filter_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(UpdateBloomFilter(*dictionary));
+    }
+    return Status::OK();
+  };
+
+  // Handle seeing dictionary for the first time
+  if (!preserved_dictionary_ && dict_encoder->num_entries() == 0) {
+    // It's a new dictionary. Call PutDictionary and keep track of it
+    PARQUET_CATCH_NOT_OK(dict_encoder->PutDictionary(*dictionary));
+    RETURN_NOT_OK(UpdateStatistics());
     preserved_dictionary_ = dictionary;
-  } else if (!dictionary->Equals(*preserved_dictionary_)) {
-    // Dictionary has changed
-    PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
-    return WriteDense();
+    preserved_memo_indices_.reset();
+  } else if (!preserved_dictionary_ || !dictionary->Equals(*preserved_dictionary_)) {
+    // The dictionary has changed, or dense values were written before. Merge
+    // the new dictionary into the encoder's memo, hashing each dictionary value
+    // once, and remap the indices instead of densifying the array
+    std::vector<int32_t> memo_indices;
+    PARQUET_CATCH_NOT_OK(dict_encoder->InsertDictionary(*dictionary, &memo_indices));
+    RETURN_NOT_OK(UpdateStatistics());
+
+    arrow::Int32Builder memo_indices_builder(properties_->memory_pool());
+    RETURN_NOT_OK(memo_indices_builder.AppendValues(memo_indices));
+    RETURN_NOT_OK(memo_indices_builder.Finish(&preserved_memo_indices_));
+    preserved_dictionary_ = dictionary;
+
+    // The merged dictionary may exceed the dictionary page limit, in which
+    // case this and all following chunks are written as PLAIN
+    PARQUET_CATCH_NOT_OK(CheckDictionarySizeLimit());
+    if (!IsDictionaryEncoding(current_encoder_->encoding())) {
+      return WriteDense();
+    }
+  }
+
+  if (preserved_memo_indices_) {
+    arrow::compute::FunctionContext fn_ctx(properties_->memory_pool());
+    RETURN_NOT_OK(arrow::compute::Take(&fn_ctx, *preserved_memo_indices_, *indices,
+                                       arrow::compute::TakeOptions(), &indices));
   }
 
   PARQUET_CATCH_NOT_OK(
@@ -1456,10 +1820,23 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
                                                              int64_t num_levels,
                                                              const arrow::Array& array,
                                                              ArrowWriteContext* ctx) {
-  if (array.type()->id() != arrow::Type::BINARY &&
-      array.type()->id() != arrow::Type::STRING) {
-    ARROW_UNSUPPORTED();
+  std::shared_ptr<arrow::DataType> narrow_type;
+  switch (array.type()->id()) {
+    case arrow::Type::BINARY:
+    case arrow::Type::STRING:
+      break;
+    // Large binary batches are written through 32-bit offset views of their
+    // data, since the encoders and statistics expect a BinaryArray
+    case arrow::Type::LARGE_BINARY:
+      narrow_type = arrow::binary();
+      break;
+    case arrow::Type::LARGE_STRING:
+      narrow_type = arrow::utf8();
+      break;
+    default:
+      ARROW_UNSUPPORTED();
   }
+  arrow::compute::FunctionContext fn_ctx(ctx->memory_pool);
 
   int64_t value_offset = 0;
   auto WriteChunk = [&](int64_t offset, int64_t batch_size) {
@@ -1469,10 +1846,19 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(const int16_t* def_
                       &batch_num_values, &batch_num_spaced_values);
     std::shared_ptr<arrow::Array> data_slice =
         array.Slice(value_offset, batch_num_spaced_values);
+    if (narrow_type != nullptr) {
+      PARQUET_THROW_NOT_OK(arrow::compute::Cast(&fn_ctx, *data_slice, narrow_type,
+                                                arrow::compute::CastOptions(),
+                                                &data_slice));
+    }
     current_encoder_->Put(*data_slice);
+    num_dictionary_values_ += batch_num_values;
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice);
     }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(*data_slice);
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
@@ -1579,9 +1965,16 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(const int16_t* def_level
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
                                                  const WriterProperties* properties) {
+  return Make(metadata, std::move(pager), properties, /*use_dictionary=*/true);
+}
+
+std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
+                                                 std::unique_ptr<PageWriter> pager,
+                                                 const WriterProperties* properties,
+                                                 bool use_dictionary) {
   const ColumnDescriptor* descr = metadata->descr();
-  const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
-                              descr->physical_type() != Type::BOOLEAN;
+  use_dictionary = use_dictionary && properties->dictionary_enabled(descr->path()) &&
+                   descr->physical_type() != Type::BOOLEAN;
   Encoding::type encoding = properties->encoding(descr->path());
   if (use_dictionary) {
     encoding = properties->dictionary_index_encoding();
@@ -41,7 +41,10 @@ class RleEncoder;
 
 namespace parquet {
 
+struct AdaptiveCodecChoice;
+struct AdaptiveCompressionOptions;
 struct ArrowWriteContext;
+class BloomFilter;
 class ColumnDescriptor;
 class CompressedDataPage;
 class DictionaryPage;
@@ -82,16 +85,33 @@ class PARQUET_EXPORT PageWriter {
  public:
   virtual ~PageWriter() {}
 
+  // If write_page_index is true, the ColumnIndex and OffsetIndex of the
+  // column chunk are written on Close. The pages of the column must start at
+  // row boundaries, i.e. the column must not be repeated.
   static std::unique_ptr<PageWriter> Open(
       const std::shared_ptr<ArrowOutputStream>& sink, Compression::type codec,
       int compression_level, ColumnChunkMetaDataBuilder* metadata,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      bool buffered_row_group = false);
+      bool buffered_row_group = false, bool write_page_index = false);
+
+  // Open a page writer whose codec is chosen among the candidates of options
+  // when its first page is compressed. The choice is stored into *choice,
+  // and into the column chunk metadata.
+  static std::unique_ptr<PageWriter> OpenAdaptive(
+      const std::shared_ptr<ArrowOutputStream>& sink,
+      const AdaptiveCompressionOptions& options, AdaptiveCodecChoice* choice,
+      ColumnChunkMetaDataBuilder* metadata,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
+      bool buffered_row_group = false, bool write_page_index = false);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
   // page limit
-  virtual void Close(bool has_dictionary, bool fallback) = 0;
+  //
+  // If bloom_filter is not null, it is serialized after the column chunk and
+  // its offset recorded in the column chunk metadata
+  virtual void Close(bool has_dictionary, bool fallback,
+                     const BloomFilter* bloom_filter) = 0;
 
   virtual int64_t WriteDataPage(const CompressedDataPage& page) = 0;
 
@@ -111,6 +131,13 @@ class PARQUET_EXPORT ColumnWriter {
                                             std::unique_ptr<PageWriter>,
                                             const WriterProperties* properties);
 
+  /// \brief Make a writer which does not dictionary encode if use_dictionary
+  /// is false, whatever the properties of the column
+  static std::shared_ptr<ColumnWriter> Make(ColumnChunkMetaDataBuilder*,
+                                            std::unique_ptr<PageWriter>,
+                                            const WriterProperties* properties,
+                                            bool use_dictionary);
+
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
   virtual int64_t Close() = 0;
@@ -132,9 +159,17 @@ class PARQUET_EXPORT ColumnWriter {
   /// dictionary pages to the ColumnChunk so far
   virtual int64_t total_bytes_written() const = 0;
 
+  /// \brief Estimated size of the values that are not written to a page yet
+  virtual int64_t EstimatedBufferedValueBytes() const = 0;
+
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
+  /// \brief Whether the writer fell back to PLAIN encoding because dictionary
+  /// encoding of the values sampled per WriterProperties::dictionary_sample_size
+  /// was not smaller
+  virtual bool dictionary_rejected() const = 0;
+
   /// \brief Write Apache Arrow columnar data directly to ColumnWriter. Returns
   /// error status if the array data type is not compatible with the concrete
   /// writer type
@@ -183,9 +218,6 @@ class TypedColumnWriter : public ColumnWriter {
   virtual void WriteBatchSpaced(int64_t num_values, const int16_t* def_levels,
                                 const int16_t* rep_levels, const uint8_t* valid_bits,
                                 int64_t valid_bits_offset, const T* values) = 0;
-
-  // Estimated size of the values that are not written to a page yet
-  virtual int64_t EstimatedBufferedValueBytes() const = 0;
 };
 
 using BoolWriter = TypedColumnWriter<BooleanType>;
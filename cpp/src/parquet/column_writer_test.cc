@@ -885,6 +885,42 @@ TEST(TestLevels, TestLevelsDecodeMultipleSetData) {
   }
 }
 
+// Levels with a maximum of 1 decoded straight into a bitmap must match those
+// decoded one by one
+TEST(TestLevels, TestLevelsDecodeBitmap) {
+  const int16_t max_level = 1;
+  std::vector<int16_t> input_levels;
+  for (int i = 0; i < 2000; ++i) {
+    // Long runs followed by alternating levels, for repeated and literal runs
+    input_levels.push_back(static_cast<int16_t>(i % 400 < 200 ? (i / 400) % 2 : i % 2));
+  }
+  const int num_levels = static_cast<int>(input_levels.size());
+
+  for (Encoding::type encoding : {Encoding::RLE, Encoding::BIT_PACKED}) {
+    std::vector<uint8_t> bytes;
+    ASSERT_NO_FATAL_FAILURE(
+        EncodeLevels(encoding, max_level, num_levels, input_levels.data(), bytes));
+
+    LevelDecoder decoder;
+    decoder.SetData(encoding, max_level, num_levels, bytes.data());
+    const int64_t offset = 5;
+    std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(num_levels + offset), 0);
+    int levels_read = 0;
+    while (levels_read < num_levels) {
+      const int num_decoded =
+          decoder.DecodeBitmap(77, valid_bits.data(), offset + levels_read);
+      ASSERT_GT(num_decoded, 0);
+      levels_read += num_decoded;
+    }
+    ASSERT_EQ(num_levels, levels_read);
+    ASSERT_EQ(0, decoder.DecodeBitmap(1, valid_bits.data(), 0));
+    for (int i = 0; i < num_levels; ++i) {
+      ASSERT_EQ(input_levels[i] == 1,
+                ::arrow::BitUtil::GetBit(valid_bits.data(), offset + i));
+    }
+  }
+}
+
 TEST(TestLevelEncoder, MinimumBufferSize) {
   // PARQUET-676, PARQUET-698
   const int kNumToEncode = 1024;
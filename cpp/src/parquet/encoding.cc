@@ -21,6 +21,8 @@
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -31,6 +33,7 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/sse_util.h"
 #include "arrow/util/ubsan.h"
 
 #include "parquet/exception.h"
@@ -420,6 +423,8 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
 
   void Put(const arrow::Array& values) override;
   void PutDictionary(const arrow::Array& values) override;
+  void InsertDictionary(const arrow::Array& values,
+                        std::vector<int32_t>* memo_indices) override;
 
   template <typename ArrowType>
   void PutIndicesTyped(const arrow::Array& data) {
@@ -620,6 +625,558 @@ void DictEncoderImpl<ByteArrayType>::PutDictionary(const arrow::Array& values) {
   }
 }
 
+template <typename DType>
+void DictEncoderImpl<DType>::InsertDictionary(const arrow::Array& values,
+                                              std::vector<int32_t>* memo_indices) {
+  ParquetException::NYI(values.type()->ToString());
+}
+
+template <>
+void DictEncoderImpl<ByteArrayType>::InsertDictionary(
+    const arrow::Array& values, std::vector<int32_t>* memo_indices) {
+  AssertBinary(values);
+
+  const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+  if (data.null_count() > 0) {
+    throw ParquetException("Inserted binary dictionary cannot cannot contain nulls");
+  }
+  memo_indices->resize(data.length());
+  for (int64_t i = 0; i < data.length(); i++) {
+    auto v = data.GetView(i);
+    (*memo_indices)[i] = memo_table_.GetOrInsert(
+        v.data(), static_cast<int32_t>(v.size()),
+        /*on_found=*/[](int32_t memo_index) {},
+        /*on_not_found=*/[this, &v](int32_t memo_index) {
+          dict_encoded_size_ += static_cast<int>(v.size() + sizeof(uint32_t));
+        });
+  }
+}
+
+// ----------------------------------------------------------------------
+// Helpers shared by the DELTA_* encoders and decoders
+
+namespace {
+
+// BitWriter and BitReader only handle VLQ and bit-packed values of up to 32
+// bits, so we need these for INT64 data
+
+bool PutVlqInt64(arrow::BitUtil::BitWriter* writer, uint64_t v) {
+  bool result = true;
+  while ((v & ~static_cast<uint64_t>(0x7F)) != 0) {
+    result &= writer->PutAligned<uint8_t>(static_cast<uint8_t>((v & 0x7F) | 0x80), 1);
+    v >>= 7;
+  }
+  result &= writer->PutAligned<uint8_t>(static_cast<uint8_t>(v), 1);
+  return result;
+}
+
+bool PutZigZagVlqInt64(arrow::BitUtil::BitWriter* writer, int64_t v) {
+  // Note negative left shift is undefined
+  const uint64_t u = (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+  return PutVlqInt64(writer, u);
+}
+
+bool GetVlqInt64(arrow::BitUtil::BitReader* reader, uint64_t* v) {
+  *v = 0;
+  int shift = 0;
+  uint8_t byte = 0;
+  do {
+    if (shift >= 64 || !reader->GetAligned<uint8_t>(1, &byte)) return false;
+    *v |= static_cast<uint64_t>(byte & 0x7F) << shift;
+    shift += 7;
+  } while ((byte & 0x80) != 0);
+  return true;
+}
+
+bool GetZigZagVlqInt64(arrow::BitUtil::BitReader* reader, int64_t* v) {
+  uint64_t u;
+  if (!GetVlqInt64(reader, &u)) return false;
+  *v = static_cast<int64_t>((u >> 1) ^ (~(u & 1) + 1));
+  return true;
+}
+
+bool PutPackedValue(arrow::BitUtil::BitWriter* writer, uint64_t v, int num_bits) {
+  if (num_bits <= 32) {
+    return writer->PutValue(v, num_bits);
+  }
+  // Values are packed LSB first, so this is equivalent to a single wide write
+  return writer->PutValue(v & 0xFFFFFFFFU, 32) &&
+         writer->PutValue(v >> 32, num_bits - 32);
+}
+
+bool GetPackedValue(arrow::BitUtil::BitReader* reader, int num_bits, uint64_t* v) {
+  if (num_bits <= 32) {
+    return reader->GetValue(num_bits, v);
+  }
+  uint64_t low, high;
+  if (!reader->GetValue(32, &low) || !reader->GetValue(num_bits - 32, &high)) {
+    return false;
+  }
+  *v = low | (high << 32);
+  return true;
+}
+
+// Gather the non-null values of a spaced input into a scratch buffer
+template <typename T>
+int CompactSpaced(MemoryPool* pool, const T* src, int num_values,
+                  const uint8_t* valid_bits, int64_t valid_bits_offset,
+                  std::shared_ptr<ResizableBuffer>* out) {
+  PARQUET_THROW_NOT_OK(arrow::AllocateResizableBuffer(pool, num_values * sizeof(T), out));
+  int num_valid_values = 0;
+  arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                  num_values);
+  T* data = reinterpret_cast<T*>((*out)->mutable_data());
+  for (int i = 0; i < num_values; i++) {
+    if (valid_bits_reader.IsSet()) {
+      data[num_valid_values++] = src[i];
+    }
+    valid_bits_reader.Next();
+  }
+  return num_valid_values;
+}
+
+std::shared_ptr<Buffer> ConcatenateBuffers(MemoryPool* pool, const Buffer& left,
+                                           const Buffer& right) {
+  std::shared_ptr<ResizableBuffer> result =
+      AllocateBuffer(pool, left.size() + right.size());
+  if (left.size() > 0) {
+    memcpy(result->mutable_data(), left.data(), left.size());
+  }
+  if (right.size() > 0) {
+    memcpy(result->mutable_data() + left.size(), right.data(), right.size());
+  }
+  return result;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// DeltaBitPackEncoder
+
+// Block layout written by the DELTA_BINARY_PACKED encoder. The format allows
+// any block size that is a multiple of 128 with miniblocks holding a multiple
+// of 32 values; these are the values used by parquet-mr.
+constexpr int kDeltaValuesPerBlock = 128;
+constexpr int kDeltaMiniBlocksPerBlock = 4;
+constexpr int kDeltaValuesPerMiniBlock = kDeltaValuesPerBlock / kDeltaMiniBlocksPerBlock;
+
+// Largest possible encoded block: min delta, bit widths and miniblocks packed
+// at 64 bits per value
+constexpr int kDeltaMaxBlockBytes =
+    10 + kDeltaMiniBlocksPerBlock + kDeltaValuesPerBlock * sizeof(int64_t);
+
+// Largest possible page header: three VLQ ints and a zigzag VLQ first value
+constexpr int kDeltaMaxHeaderBytes = 5 * 3 + 10;
+
+/// See the DELTA_BINARY_PACKED section of
+/// https://github.com/apache/parquet-format/blob/master/Encodings.md.
+/// Deltas between consecutive values are buffered one block at a time; each
+/// full block is bit-packed relative to its minimum delta. The page header
+/// holds the total value count, so it is only written by FlushValues().
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        block_buffer_(AllocateBuffer(pool, kDeltaMaxBlockBytes)),
+        sink_(pool) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return kDeltaMaxHeaderBytes + sink_.length() + values_current_block_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override;
+
+  void Put(const T* src, int num_values) override;
+
+  void Put(const arrow::Array& values) override {
+    ParquetException::NYI(values.type()->ToString());
+  }
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::shared_ptr<ResizableBuffer> buffer;
+    const int num_valid_values = CompactSpaced(this->memory_pool(), src, num_values,
+                                               valid_bits, valid_bits_offset, &buffer);
+    Put(reinterpret_cast<const T*>(buffer->data()), num_valid_values);
+  }
+
+ private:
+  void FlushBlock();
+
+  std::shared_ptr<ResizableBuffer> block_buffer_;
+  arrow::BufferBuilder sink_;
+
+  int64_t total_value_count_ = 0;
+  T first_value_ = 0;
+  T current_value_ = 0;
+  int values_current_block_ = 0;
+  T deltas_[kDeltaValuesPerBlock];
+};
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
+  if (num_values == 0) {
+    return;
+  }
+  int idx = 0;
+  if (total_value_count_ == 0) {
+    first_value_ = current_value_ = src[0];
+    idx = 1;
+  }
+  total_value_count_ += num_values;
+  for (; idx < num_values; ++idx) {
+    // Deltas use wrapping arithmetic, as in the reference implementation
+    deltas_[values_current_block_++] =
+        static_cast<T>(static_cast<UT>(src[idx]) - static_cast<UT>(current_value_));
+    current_value_ = src[idx];
+    if (values_current_block_ == kDeltaValuesPerBlock) {
+      FlushBlock();
+    }
+  }
+}
+
+template <typename DType>
+void DeltaBitPackEncoder<DType>::FlushBlock() {
+  const T min_delta = *std::min_element(deltas_, deltas_ + values_current_block_);
+  arrow::BitUtil::BitWriter writer(block_buffer_->mutable_data(),
+                                   static_cast<int>(block_buffer_->size()));
+  PutZigZagVlqInt64(&writer, min_delta);
+  uint8_t* bit_widths = writer.GetNextBytePtr(kDeltaMiniBlocksPerBlock);
+
+  for (int i = 0; i < kDeltaMiniBlocksPerBlock; ++i) {
+    const int start = i * kDeltaValuesPerMiniBlock;
+    const int end = std::min(start + kDeltaValuesPerMiniBlock, values_current_block_);
+    if (start >= end) {
+      // Trailing miniblocks without values are not written
+      bit_widths[i] = 0;
+      continue;
+    }
+    UT max_relative_delta = 0;
+    for (int j = start; j < end; ++j) {
+      max_relative_delta = std::max(
+          max_relative_delta, static_cast<UT>(static_cast<UT>(deltas_[j]) -
+                                              static_cast<UT>(min_delta)));
+    }
+    const int bit_width = arrow::BitUtil::NumRequiredBits(max_relative_delta);
+    bit_widths[i] = static_cast<uint8_t>(bit_width);
+
+    // A partial miniblock is padded to its full length
+    for (int j = start; j < start + kDeltaValuesPerMiniBlock; ++j) {
+      const UT relative_delta =
+          j < end ? static_cast<UT>(static_cast<UT>(deltas_[j]) -
+                                    static_cast<UT>(min_delta))
+                  : 0;
+      PutPackedValue(&writer, relative_delta, bit_width);
+    }
+  }
+  writer.Flush();
+  PARQUET_THROW_NOT_OK(sink_.Append(writer.buffer(), writer.bytes_written()));
+  values_current_block_ = 0;
+}
+
+template <typename DType>
+std::shared_ptr<Buffer> DeltaBitPackEncoder<DType>::FlushValues() {
+  if (values_current_block_ > 0) {
+    FlushBlock();
+  }
+
+  uint8_t header_data[kDeltaMaxHeaderBytes];
+  arrow::BitUtil::BitWriter header(header_data, kDeltaMaxHeaderBytes);
+  header.PutVlqInt(kDeltaValuesPerBlock);
+  header.PutVlqInt(kDeltaMiniBlocksPerBlock);
+  header.PutVlqInt(static_cast<uint32_t>(total_value_count_));
+  PutZigZagVlqInt64(&header, first_value_);
+  header.Flush();
+
+  std::shared_ptr<Buffer> blocks;
+  PARQUET_THROW_NOT_OK(sink_.Finish(&blocks));
+  total_value_count_ = 0;
+  first_value_ = current_value_ = 0;
+
+  return ConcatenateBuffers(this->memory_pool(),
+                            Buffer(header_data, header.bytes_written()), *blocks);
+}
+
+// ----------------------------------------------------------------------
+// DeltaLengthByteArrayEncoder
+
+/// The lengths of all values are written with DELTA_BINARY_PACKED, followed
+/// by the concatenated value bytes.
+class DeltaLengthByteArrayEncoder : public EncoderImpl,
+                                    virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaLengthByteArrayEncoder(const ColumnDescriptor* descr,
+                                       MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        length_encoder_(nullptr, pool),
+        sink_(pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + sink_.length();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> data;
+    PARQUET_THROW_NOT_OK(sink_.Finish(&data));
+    return ConcatenateBuffers(this->memory_pool(), *lengths, *data);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        Put(reinterpret_cast<const uint8_t*>(view.data()),
+            static_cast<uint32_t>(view.size()));
+      }
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::shared_ptr<ResizableBuffer> buffer;
+    const int num_valid_values = CompactSpaced(this->memory_pool(), src, num_values,
+                                               valid_bits, valid_bits_offset, &buffer);
+    Put(reinterpret_cast<const ByteArray*>(buffer->data()), num_valid_values);
+  }
+
+  void Put(const uint8_t* data, uint32_t length) {
+    DCHECK(length == 0 || data != nullptr) << "Value ptr cannot be NULL";
+    const int32_t encoded_length = static_cast<int32_t>(length);
+    length_encoder_.Put(&encoded_length, 1);
+    PARQUET_THROW_NOT_OK(sink_.Append(data, length));
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  arrow::BufferBuilder sink_;
+};
+
+// ----------------------------------------------------------------------
+// DeltaByteArrayEncoder
+
+/// Incremental encoding: the length of the prefix shared with the previous
+/// value is written with DELTA_BINARY_PACKED, followed by the remaining
+/// suffixes written with DELTA_LENGTH_BYTE_ARRAY. Works best on sorted data.
+class DeltaByteArrayEncoder : public EncoderImpl,
+                              virtual public TypedEncoder<ByteArrayType> {
+ public:
+  explicit DeltaByteArrayEncoder(const ColumnDescriptor* descr,
+                                 MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    // Each page is decoded independently
+    last_value_.clear();
+    return ConcatenateBuffers(this->memory_pool(), *prefix_lengths, *suffixes);
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    for (int i = 0; i < num_values; ++i) {
+      Put(src[i].ptr, src[i].len);
+    }
+  }
+
+  void Put(const arrow::Array& values) override {
+    AssertBinary(values);
+    const auto& data = checked_cast<const arrow::BinaryArray&>(values);
+    for (int64_t i = 0; i < data.length(); i++) {
+      if (data.IsValid(i)) {
+        auto view = data.GetView(i);
+        Put(reinterpret_cast<const uint8_t*>(view.data()),
+            static_cast<uint32_t>(view.size()));
+      }
+    }
+  }
+
+  void PutSpaced(const ByteArray* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::shared_ptr<ResizableBuffer> buffer;
+    const int num_valid_values = CompactSpaced(this->memory_pool(), src, num_values,
+                                               valid_bits, valid_bits_offset, &buffer);
+    Put(reinterpret_cast<const ByteArray*>(buffer->data()), num_valid_values);
+  }
+
+ private:
+  void Put(const uint8_t* data, uint32_t length) {
+    DCHECK(length == 0 || data != nullptr) << "Value ptr cannot be NULL";
+    const uint32_t max_prefix =
+        std::min(length, static_cast<uint32_t>(last_value_.size()));
+    uint32_t prefix = 0;
+    while (prefix < max_prefix &&
+           data[prefix] == static_cast<uint8_t>(last_value_[prefix])) {
+      ++prefix;
+    }
+    const int32_t encoded_prefix = static_cast<int32_t>(prefix);
+    prefix_length_encoder_.Put(&encoded_prefix, 1);
+    suffix_encoder_.Put(data + prefix, length - prefix);
+    last_value_.assign(reinterpret_cast<const char*>(data), length);
+  }
+
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT
+
+#if defined(ARROW_HAVE_SSE2)
+
+// Interleave the bytes of the first half of the registers with those of the
+// second half. On the bytes of the registers seen as one array, this rotates
+// the bits of each byte index left by one
+template <int kNumStreams>
+inline void InterleaveBytesSse2(__m128i* registers) {
+  __m128i result[kNumStreams];
+  for (int i = 0; i < kNumStreams / 2; ++i) {
+    result[2 * i] = _mm_unpacklo_epi8(registers[i], registers[i + kNumStreams / 2]);
+    result[2 * i + 1] = _mm_unpackhi_epi8(registers[i], registers[i + kNumStreams / 2]);
+  }
+  std::memcpy(registers, result, sizeof(result));
+}
+
+#endif
+
+// Scatter the bytes of the values into kNumStreams streams of num_values bytes
+template <int kNumStreams>
+void ByteStreamSplitEncode(const uint8_t* raw_values, int64_t num_values,
+                           uint8_t* output) {
+  int64_t i = 0;
+#if defined(ARROW_HAVE_SSE2)
+  // Blocks of 16 values: the byte index within a block is (value, byte). Four
+  // rotations make it (byte, value), so that register b holds byte b of the
+  // 16 values
+  constexpr int kBlockSize = 16;
+  for (; i + kBlockSize <= num_values; i += kBlockSize) {
+    __m128i registers[kNumStreams];
+    for (int k = 0; k < kNumStreams; ++k) {
+      registers[k] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(raw_values + i * kNumStreams) + k);
+    }
+    for (int round = 0; round < 4; ++round) {
+      InterleaveBytesSse2<kNumStreams>(registers);
+    }
+    for (int k = 0; k < kNumStreams; ++k) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(output + k * num_values + i),
+                       registers[k]);
+    }
+  }
+#endif
+  for (; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      output[k * num_values + i] = raw_values[i * kNumStreams + k];
+    }
+  }
+}
+
+// Gather values [offset, offset + num_values) from kNumStreams streams of
+// stride bytes
+template <int kNumStreams>
+void ByteStreamSplitDecode(const uint8_t* data, int64_t stride, int64_t offset,
+                           int64_t num_values, uint8_t* out) {
+  int64_t i = 0;
+#if defined(ARROW_HAVE_SSE2)
+  // The inverse of the encoding: rotating a (byte, value) index until it is
+  // (value, byte) takes log2(kNumStreams) rotations
+  constexpr int kBlockSize = 16;
+  constexpr int kNumRounds = kNumStreams == 4 ? 2 : 3;
+  for (; i + kBlockSize <= num_values; i += kBlockSize) {
+    __m128i registers[kNumStreams];
+    for (int k = 0; k < kNumStreams; ++k) {
+      registers[k] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(data + k * stride + offset + i));
+    }
+    for (int round = 0; round < kNumRounds; ++round) {
+      InterleaveBytesSse2<kNumStreams>(registers);
+    }
+    for (int k = 0; k < kNumStreams; ++k) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * kNumStreams) + k,
+                       registers[k]);
+    }
+  }
+#endif
+  for (; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      out[i * kNumStreams + k] = data[k * stride + offset + i];
+    }
+  }
+}
+
+/// The values are split into one stream per byte: the first bytes of all
+/// values, then their second bytes, and so on. This makes floating-point data
+/// more compressible, as the sign, exponent and high mantissa bytes vary little
+template <typename DType>
+class ByteStreamSplitEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ByteStreamSplitEncoder(const ColumnDescriptor* descr,
+                                  MemoryPool* pool = arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::BYTE_STREAM_SPLIT, pool), values_(pool) {
+    if (DType::type_num != Type::FLOAT && DType::type_num != Type::DOUBLE) {
+      throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override { return values_.length(); }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<ResizableBuffer> output =
+        AllocateBuffer(this->memory_pool(), values_.length());
+    ByteStreamSplitEncode<sizeof(T)>(values_.data(), values_.length() / sizeof(T),
+                                     output->mutable_data());
+    values_.Rewind(0);
+    return std::move(output);
+  }
+
+  void Put(const T* src, int num_values) override {
+    PARQUET_THROW_NOT_OK(values_.Append(src, num_values * sizeof(T)));
+  }
+
+  void Put(const arrow::Array& values) override {
+    ParquetException::NYI(values.type()->ToString());
+  }
+
+  void PutSpaced(const T* src, int num_values, const uint8_t* valid_bits,
+                 int64_t valid_bits_offset) override {
+    std::shared_ptr<ResizableBuffer> buffer;
+    const int num_valid_values = CompactSpaced(this->memory_pool(), src, num_values,
+                                               valid_bits, valid_bits_offset, &buffer);
+    Put(reinterpret_cast<const T*>(buffer->data()), num_valid_values);
+  }
+
+ private:
+  // The values are buffered as is and split when flushed
+  arrow::BufferBuilder values_;
+};
+
 // ----------------------------------------------------------------------
 // Encoder and decoder factory functions
 
@@ -668,6 +1225,36 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         DCHECK(false) << "Encoder not implemented";
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<FloatType>(descr, pool));
+      case Type::DOUBLE:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<DoubleType>(descr, pool));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -879,39 +1466,124 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
   }
 
  private:
-  template <typename BuilderType>
-  arrow::Status DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
-                            int64_t valid_bits_offset, BuilderType* builder,
-                            int* out_values_decoded) {
-    RETURN_NOT_OK(builder->Reserve(num_values));
-    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
-    int increment;
-    int i = 0;
+  // The value bytes left in the page, less the length prefix of every value
+  // (nulls included, which makes it a lower bound). Reserving it up front
+  // avoids reallocating the value data repeatedly while appending.
+  int64_t RemainingValueBytes() const {
+    return std::max<int64_t>(
+        0, len_ - static_cast<int64_t>(sizeof(uint32_t)) * num_values_);
+  }
+
+  arrow::Status ReserveData(arrow::BinaryBuilder* builder) {
+    return builder->ReserveData(
+        std::min(RemainingValueBytes(),
+                 arrow::BinaryBuilder::memory_limit() - builder->value_data_length()));
+  }
+
+  arrow::Status ReserveData(arrow::internal::ChunkedBinaryBuilder* builder) {
+    return builder->ReserveData(RemainingValueBytes());
+  }
+
+  // Dictionary builders only store the distinct values
+  arrow::Status ReserveData(arrow::BinaryDictionary32Builder*) {
+    return arrow::Status::OK();
+  }
+
+  // Locate the values of the next num_values slots, those whose bit is set in
+  // valid_bits (all of them if it is null), in views_. The views of the null
+  // slots are empty.
+  void ScanValues(int num_values, const uint8_t* valid_bits, int64_t valid_bits_offset,
+                  int* values_decoded, int64_t* bytes_decoded, int64_t* data_bytes) {
+    views_.resize(num_values);
     const uint8_t* data = data_;
     int64_t data_size = len_;
-    int bytes_decoded = 0;
-    int values_decoded = 0;
-    while (i < num_values) {
-      if (bit_reader.IsSet()) {
-        uint32_t len = arrow::util::SafeLoadAs<uint32_t>(data);
-        increment = static_cast<int>(sizeof(uint32_t) + len);
-        if (data_size < increment) {
-          ParquetException::EofException();
-        }
-        RETURN_NOT_OK(builder->Append(data + sizeof(uint32_t), len));
-        data += increment;
-        data_size -= increment;
-        bytes_decoded += increment;
-        ++values_decoded;
+    int values = 0;
+    int64_t value_bytes = 0;
+    for (int i = 0; i < num_values; ++i) {
+      if (valid_bits != nullptr &&
+          !arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        views_[i] = arrow::util::string_view();
+        continue;
+      }
+      if (data_size < static_cast<int64_t>(sizeof(uint32_t))) {
+        ParquetException::EofException();
+      }
+      const uint32_t len = arrow::util::SafeLoadAs<uint32_t>(data);
+      const int64_t increment = static_cast<int64_t>(sizeof(uint32_t)) + len;
+      if (data_size < increment) {
+        ParquetException::EofException();
+      }
+      views_[i] = arrow::util::string_view(
+          reinterpret_cast<const char*>(data + sizeof(uint32_t)), len);
+      data += increment;
+      data_size -= increment;
+      value_bytes += len;
+      ++values;
+    }
+    *values_decoded = values;
+    *bytes_decoded = len_ - data_size;
+    *data_bytes = value_bytes;
+  }
+
+  // Append the values located by ScanValues. Builders of contiguous binary
+  // data get the offsets and the value data of all the values written with a
+  // single reservation, instead of checking capacity for each value.
+  arrow::Status AppendViews(int num_values, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset, int64_t data_bytes,
+                            arrow::BinaryBuilder* builder) {
+    RETURN_NOT_OK(builder->Reserve(num_values));
+    RETURN_NOT_OK(builder->ReserveData(data_bytes));
+    for (int i = 0; i < num_values; ++i) {
+      if (valid_bits == nullptr ||
+          arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        builder->UnsafeAppend(views_[i]);
+      } else {
+        builder->UnsafeAppendNull();
+      }
+    }
+    return arrow::Status::OK();
+  }
+
+  arrow::Status AppendViews(int num_values, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset, int64_t,
+                            arrow::internal::ChunkedBinaryBuilder* builder) {
+    return builder->AppendValues(views_.data(), num_values, valid_bits,
+                                 valid_bits_offset);
+  }
+
+  arrow::Status AppendViews(int num_values, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset, int64_t,
+                            arrow::BinaryDictionary32Builder* builder) {
+    RETURN_NOT_OK(builder->Reserve(num_values));
+    for (int i = 0; i < num_values; ++i) {
+      if (valid_bits == nullptr ||
+          arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+        RETURN_NOT_OK(builder->Append(views_[i]));
       } else {
         RETURN_NOT_OK(builder->AppendNull());
       }
-      bit_reader.Next();
-      ++i;
     }
+    return arrow::Status::OK();
+  }
+
+  template <typename BuilderType>
+  arrow::Status DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset, BuilderType* builder,
+                            int* out_values_decoded) {
+    if (null_count == 0) {
+      valid_bits = nullptr;
+    }
+    int values_decoded = 0;
+    int64_t bytes_decoded = 0;
+    int64_t data_bytes = 0;
+    ScanValues(num_values, valid_bits, valid_bits_offset, &values_decoded,
+               &bytes_decoded, &data_bytes);
+    RETURN_NOT_OK(ReserveData(builder));
+    RETURN_NOT_OK(
+        AppendViews(num_values, valid_bits, valid_bits_offset, data_bytes, builder));
 
     data_ += bytes_decoded;
-    len_ -= bytes_decoded;
+    len_ -= static_cast<int>(bytes_decoded);
     num_values_ -= values_decoded;
     *out_values_decoded = values_decoded;
     return arrow::Status::OK();
@@ -921,29 +1593,12 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
   arrow::Status DecodeArrowNonNull(int num_values, BuilderType* builder,
                                    int* values_decoded) {
     num_values = std::min(num_values, num_values_);
-    RETURN_NOT_OK(builder->Reserve(num_values));
-    int i = 0;
-    const uint8_t* data = data_;
-    int64_t data_size = len_;
-    int bytes_decoded = 0;
-
-    while (i < num_values) {
-      uint32_t len = arrow::util::SafeLoadAs<uint32_t>(data);
-      int increment = static_cast<int>(sizeof(uint32_t) + len);
-      if (data_size < increment) ParquetException::EofException();
-      RETURN_NOT_OK(builder->Append(data + sizeof(uint32_t), len));
-      data += increment;
-      data_size -= increment;
-      bytes_decoded += increment;
-      ++i;
-    }
-
-    data_ += bytes_decoded;
-    len_ -= bytes_decoded;
-    num_values_ -= num_values;
-    *values_decoded = num_values;
-    return arrow::Status::OK();
+    return DecodeArrow(num_values, /*null_count=*/0, /*valid_bits=*/nullptr, 0, builder,
+                       values_decoded);
   }
+
+  // The values of the current batch, pointing into the page
+  std::vector<arrow::util::string_view> views_;
 };
 
 class PlainFLBADecoder : public PlainDecoder<FLBAType>, virtual public FLBADecoder {
@@ -1009,6 +1664,30 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
 
   void InsertDictionary(arrow::ArrayBuilder* builder) override;
 
+  void GetDictionary(const T** dictionary, int32_t* dictionary_length) override {
+    *dictionary = reinterpret_cast<const T*>(dictionary_->data());
+    *dictionary_length = dictionary_length_;
+  }
+
+  int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset, int32_t* indices) override {
+    if (num_values != idx_decoder_.GetBatchSpaced(num_values, null_count, valid_bits,
+                                                  valid_bits_offset, indices)) {
+      ParquetException::EofException();
+    }
+    num_values_ -= num_values - null_count;
+    return num_values - null_count;
+  }
+
+  int DecodeIndices(int num_values, int32_t* indices) override {
+    num_values = std::min(num_values, num_values_);
+    if (num_values != idx_decoder_.GetBatch(indices, num_values)) {
+      ParquetException::EofException();
+    }
+    num_values_ -= num_values;
+    return num_values;
+  }
+
   int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
                           int64_t valid_bits_offset,
                           arrow::ArrayBuilder* builder) override {
@@ -1021,11 +1700,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
 
     auto indices_buffer =
         reinterpret_cast<int32_t*>(indices_scratch_space_->mutable_data());
-
-    if (num_values != idx_decoder_.GetBatchSpaced(num_values, null_count, valid_bits,
-                                                  valid_bits_offset, indices_buffer)) {
-      ParquetException::EofException();
-    }
+    const int num_decoded = DecodeIndicesSpaced(num_values, null_count, valid_bits,
+                                                valid_bits_offset, indices_buffer);
 
     /// XXX(wesm): Cannot append "valid bits" directly to the builder
     std::vector<uint8_t> valid_bytes(num_values);
@@ -1038,12 +1714,10 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
     PARQUET_THROW_NOT_OK(
         binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
-    num_values_ -= num_values - null_count;
-    return num_values - null_count;
+    return num_decoded;
   }
 
   int DecodeIndices(int num_values, arrow::ArrayBuilder* builder) override {
-    num_values = std::min(num_values, num_values_);
     num_values = std::min(num_values, num_values_);
     if (num_values > 0) {
       // TODO(wesm): Refactor to batch reads for improved memory use. This is
@@ -1054,12 +1728,9 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     }
     auto indices_buffer =
         reinterpret_cast<int32_t*>(indices_scratch_space_->mutable_data());
-    if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
-      ParquetException::EofException();
-    }
+    num_values = DecodeIndices(num_values, indices_buffer);
     auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
     PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
-    num_values_ -= num_values;
     return num_values;
   }
 
@@ -1315,6 +1986,7 @@ template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
   typedef typename DType::c_type T;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                MemoryPool* pool = arrow::default_memory_pool())
@@ -1324,66 +1996,118 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
     }
   }
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    this->num_values_ = num_values;
-    decoder_ = arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+  // The number of encoded values is read from the page header, as num_values
+  // includes nulls
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    decoder_.Reset(data, len);
+    len_ = len;
+    InitHeader();
   }
 
-  virtual int Decode(T* buffer, int max_values) {
+  int Decode(T* buffer, int max_values) override {
     return GetInternal(buffer, max_values);
   }
 
+  /// Bytes consumed from the page data so far. Once all values are decoded,
+  /// this is the size of the encoded data
+  int bytes_consumed() { return len_ - decoder_.bytes_left(); }
+
  private:
-  void InitBlock() {
-    int32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
+  void InitHeader() {
+    int32_t total_value_count;
+    int64_t first_value;
+    if (!decoder_.GetVlqInt(&values_per_block_) ||
+        !decoder_.GetVlqInt(&mini_blocks_per_block_) ||
+        !decoder_.GetVlqInt(&total_value_count) ||
+        !GetZigZagVlqInt64(&decoder_, &first_value)) {
       ParquetException::EofException();
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    if (values_per_block_ <= 0 || mini_blocks_per_block_ <= 0 ||
+        values_per_block_ % mini_blocks_per_block_ != 0 || total_value_count < 0) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED header");
+    }
+    values_per_mini_block_ = values_per_block_ / mini_blocks_per_block_;
+    if (values_per_mini_block_ % 8 != 0) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED miniblock size");
+    }
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    PARQUET_THROW_NOT_OK(delta_bit_widths_->Resize(mini_blocks_per_block_, false));
+    mini_block_values_.resize(values_per_mini_block_);
+
+    num_values_ = total_value_count;
+    deltas_remaining_ = std::max(total_value_count - 1, 0);
+    first_value_pending_ = total_value_count > 0;
+    last_value_ = static_cast<T>(first_value);
+    // Force reading a block header on the first delta
+    mini_block_idx_ = mini_blocks_per_block_;
+    values_current_mini_block_ = 0;
+  }
+
+  void InitBlock() {
+    int64_t min_delta;
+    if (!GetZigZagVlqInt64(&decoder_, &min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(min_delta);
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (int i = 0; i < num_mini_blocks_; ++i) {
+    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+    for (int i = 0; i < mini_blocks_per_block_; ++i) {
       if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
         ParquetException::EofException();
       }
+      if (bit_width_data[i] > static_cast<int>(sizeof(T) * 8)) {
+        throw ParquetException("Invalid DELTA_BINARY_PACKED bit width");
+      }
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
     mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
+  }
+
+  // Unpack a whole miniblock at once, including any padding, so that the
+  // reader stays positioned at the end of the encoded data
+  void InitMiniBlock() {
+    if (mini_block_idx_ + 1 >= mini_blocks_per_block_) {
+      InitBlock();
+    } else {
+      ++mini_block_idx_;
+    }
+    const int bit_width = delta_bit_widths_->data()[mini_block_idx_];
+    const int needed = std::min(values_per_mini_block_, deltas_remaining_);
+    int unpacked = 0;
+    if (bit_width == 0) {
+      std::fill(mini_block_values_.begin(), mini_block_values_.end(), 0);
+      unpacked = values_per_mini_block_;
+    } else if (bit_width <= 32) {
+      unpacked = decoder_.GetBatch(bit_width, mini_block_values_.data(),
+                                   values_per_mini_block_);
+    } else {
+      uint64_t value;
+      while (unpacked < values_per_mini_block_ &&
+             GetPackedValue(&decoder_, bit_width, &value)) {
+        mini_block_values_[unpacked++] = static_cast<UT>(value);
+      }
+    }
+    if (unpacked < needed) {
+      ParquetException::EofException();
+    }
     values_current_mini_block_ = values_per_mini_block_;
   }
 
-  template <typename T>
   int GetInternal(T* buffer, int max_values) {
     max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
     for (int i = 0; i < max_values; ++i) {
+      if (ARROW_PREDICT_FALSE(first_value_pending_)) {
+        buffer[i] = last_value_;
+        first_value_pending_ = false;
+        continue;
+      }
       if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
-          InitBlock();
-          buffer[i] = last_value_;
-          continue;
-        }
+        InitMiniBlock();
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
+      const UT delta = mini_block_values_[values_per_mini_block_ -
+                                          values_current_mini_block_] +
+                       min_delta_;
+      last_value_ = static_cast<T>(static_cast<UT>(last_value_) + delta);
       buffer[i] = last_value_;
       --values_current_mini_block_;
+      --deltas_remaining_;
     }
     this->num_values_ -= max_values;
     return max_values;
@@ -1391,109 +2115,260 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
 
   MemoryPool* pool_;
   arrow::BitUtil::BitReader decoder_;
-  int32_t values_current_block_;
-  int32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
+  int32_t values_per_block_;
+  int32_t mini_blocks_per_block_;
+  int values_per_mini_block_;
+  int values_current_mini_block_;
+  int deltas_remaining_;
+  bool first_value_pending_;
+
+  UT min_delta_;
+  int mini_block_idx_;
+  std::shared_ptr<ResizableBuffer> delta_bit_widths_ = AllocateBuffer(pool_, 0);
+  std::vector<UT> mini_block_values_;
+
+  T last_value_;
+};
+
+// ----------------------------------------------------------------------
+// Shared base for the DELTA_*_BYTE_ARRAY decoders
+
+/// These decoders cannot append to Arrow builders straight from the page
+/// data, so the Arrow decoding methods go through Decode()
+class DeltaByteArrayDecoderBase : public DecoderImpl, virtual public ByteArrayDecoder {
+ public:
+  using ByteArrayDecoder::DecodeSpaced;
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  arrow::BinaryDictionary32Builder* builder) override {
+    return DecodeArrowImpl(num_values, null_count, valid_bits, valid_bits_offset,
+                           builder);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset,
+                  arrow::internal::ChunkedBinaryBuilder* builder) override {
+    return DecodeArrowImpl(num_values, null_count, valid_bits, valid_bits_offset,
+                           builder);
+  }
+
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
+                  int64_t valid_bits_offset, arrow::BinaryBuilder* builder) override {
+    return DecodeArrowImpl(num_values, null_count, valid_bits, valid_bits_offset,
+                           builder);
+  }
 
-  int32_t min_delta_;
-  size_t mini_block_idx_;
-  std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
+  int DecodeArrowNonNull(int num_values,
+                         arrow::BinaryDictionary32Builder* builder) override {
+    return DecodeArrowNonNullImpl(num_values, builder);
+  }
+
+  int DecodeArrowNonNull(int num_values,
+                         arrow::internal::ChunkedBinaryBuilder* builder) override {
+    return DecodeArrowNonNullImpl(num_values, builder);
+  }
 
-  int32_t last_value_;
+ protected:
+  DeltaByteArrayDecoderBase(const ColumnDescriptor* descr, Encoding::type encoding)
+      : DecoderImpl(descr, encoding) {}
+
+ private:
+  template <typename BuilderType>
+  int DecodeArrowImpl(int num_values, int null_count, const uint8_t* valid_bits,
+                      int64_t valid_bits_offset, BuilderType* builder) {
+    const int values_to_decode = num_values - null_count;
+    values_.resize(values_to_decode);
+    if (Decode(values_.data(), values_to_decode) != values_to_decode) {
+      ParquetException::EofException();
+    }
+    PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+    arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+    int value_idx = 0;
+    for (int i = 0; i < num_values; ++i) {
+      if (bit_reader.IsSet()) {
+        const ByteArray& value = values_[value_idx++];
+        PARQUET_THROW_NOT_OK(builder->Append(value.ptr, value.len));
+      } else {
+        PARQUET_THROW_NOT_OK(builder->AppendNull());
+      }
+      bit_reader.Next();
+    }
+    return values_to_decode;
+  }
+
+  template <typename BuilderType>
+  int DecodeArrowNonNullImpl(int num_values, BuilderType* builder) {
+    values_.resize(num_values);
+    num_values = Decode(values_.data(), num_values);
+    PARQUET_THROW_NOT_OK(builder->Reserve(num_values));
+    for (int i = 0; i < num_values; ++i) {
+      PARQUET_THROW_NOT_OK(builder->Append(values_[i].ptr, values_[i].len));
+    }
+    return num_values;
+  }
+
+  std::vector<ByteArray> values_;
 };
 
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
-class DeltaLengthByteArrayDecoder : public DecoderImpl,
-                                    virtual public TypedDecoder<ByteArrayType> {
+class DeltaLengthByteArrayDecoder : public DeltaByteArrayDecoderBase {
  public:
   explicit DeltaLengthByteArrayDecoder(const ColumnDescriptor* descr,
                                        MemoryPool* pool = arrow::default_memory_pool())
-      : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
+      : DeltaByteArrayDecoderBase(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+  // All lengths are decoded upfront, since the value bytes only start after
+  // the last encoded length
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    len_decoder_.SetData(num_values, data, len);
+    num_values_ = len_decoder_.values_left();
+    lengths_.resize(num_values_);
+    len_decoder_.Decode(lengths_.data(), num_values_);
+    length_idx_ = 0;
+
+    const int lengths_size = len_decoder_.bytes_consumed();
+    data_ = data + lengths_size;
+    len_ = len - lengths_size;
   }
 
-  virtual int Decode(ByteArray* buffer, int max_values) {
+  int Decode(ByteArray* buffer, int max_values) override {
     max_values = std::min(max_values, num_values_);
-    std::vector<int> lengths(max_values);
-    len_decoder_.Decode(lengths.data(), max_values);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths_[length_idx_++];
+      if (ARROW_PREDICT_FALSE(length < 0 || length > len_)) {
+        ParquetException::EofException();
+      }
+      buffer[i].len = length;
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += length;
+      len_ -= length;
     }
-    this->num_values_ -= max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
+  std::vector<int32_t> lengths_;
+  int length_idx_ = 0;
 };
 
 // ----------------------------------------------------------------------
 // DELTA_BYTE_ARRAY
 
-class DeltaByteArrayDecoder : public DecoderImpl,
-                              virtual public TypedDecoder<ByteArrayType> {
+class DeltaByteArrayDecoder : public DeltaByteArrayDecoderBase {
  public:
   explicit DeltaByteArrayDecoder(const ColumnDescriptor* descr,
                                  MemoryPool* pool = arrow::default_memory_pool())
-      : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
+      : DeltaByteArrayDecoderBase(descr, Encoding::DELTA_BYTE_ARRAY),
+        pool_(pool),
         prefix_len_decoder_(nullptr, pool),
-        suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        suffix_decoder_(nullptr, pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = arrow::util::SafeLoadAs<int32_t>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    prefix_len_decoder_.SetData(num_values, data, len);
+    num_values_ = prefix_len_decoder_.values_left();
+    prefix_lengths_.resize(num_values_);
+    prefix_len_decoder_.Decode(prefix_lengths_.data(), num_values_);
+    prefix_idx_ = 0;
+
+    const int prefix_lengths_size = prefix_len_decoder_.bytes_consumed();
+    suffix_decoder_.SetData(num_values_, data + prefix_lengths_size,
+                            len - prefix_lengths_size);
+    last_value_ = ByteArray(0, nullptr);
+    value_buffers_.clear();
+  }
+
+  // Decoded values are owned by the decoder and remain valid until the next
+  // call to SetData()
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    if (max_values == 0) {
+      return 0;
+    }
+    if (suffix_decoder_.Decode(buffer, max_values) != max_values) {
+      ParquetException::EofException();
+    }
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+    int64_t total_length = 0;
+    for (int i = 0; i < max_values; ++i) {
+      total_length += prefix_lengths_[prefix_idx_ + i] + buffer[i].len;
+    }
+    std::shared_ptr<ResizableBuffer> values = AllocateBuffer(pool_, total_length);
+    uint8_t* out = values->mutable_data();
 
-      buffer[i].ptr = result;
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_len = prefix_lengths_[prefix_idx_++];
+      if (ARROW_PREDICT_FALSE(prefix_len < 0 ||
+                              static_cast<uint32_t>(prefix_len) > last_value_.len)) {
+        throw ParquetException("Invalid DELTA_BYTE_ARRAY prefix length");
+      }
+      const ByteArray suffix = buffer[i];
+      memcpy(out, last_value_.ptr, prefix_len);
+      memcpy(out + prefix_len, suffix.ptr, suffix.len);
+      buffer[i] = ByteArray(prefix_len + suffix.len, out);
       last_value_ = buffer[i];
+      out += buffer[i].len;
     }
-    this->num_values_ -= max_values;
+    value_buffers_.push_back(std::move(values));
+    num_values_ -= max_values;
     return max_values;
   }
 
  private:
+  MemoryPool* pool_;
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
+  std::vector<int32_t> prefix_lengths_;
+  int prefix_idx_ = 0;
   ByteArray last_value_;
+  std::vector<std::shared_ptr<Buffer>> value_buffers_;
+};
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT
+
+template <typename DType>
+class ByteStreamSplitDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ByteStreamSplitDecoder(const ColumnDescriptor* descr)
+      : DecoderImpl(descr, Encoding::BYTE_STREAM_SPLIT) {
+    if (DType::type_num != Type::FLOAT && DType::type_num != Type::DOUBLE) {
+      throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
+  }
+
+  // The number of encoded values follows from the data size, as num_values
+  // includes nulls
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    if (len % sizeof(T) != 0) {
+      throw ParquetException(
+          "BYTE_STREAM_SPLIT data size is not a multiple of the value size");
+    }
+    DecoderImpl::SetData(len / static_cast<int>(sizeof(T)), data, len);
+    stride_ = num_values_;
+    num_values_decoded_ = 0;
+  }
+
+  int Decode(T* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    ByteStreamSplitDecode<sizeof(T)>(data_, stride_, num_values_decoded_, max_values,
+                                     reinterpret_cast<uint8_t*>(buffer));
+    num_values_decoded_ += max_values;
+    num_values_ -= max_values;
+    return max_values;
+  }
+
+ private:
+  // The number of values in the page, i.e. the length of each stream
+  int stride_ = 0;
+  int num_values_decoded_ = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -1521,6 +2396,34 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
       default:
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_LENGTH_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+  } else if (encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException("DELTA_BYTE_ARRAY only supports BYTE_ARRAY");
+    }
+    return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<FloatType>(descr));
+      case Type::DOUBLE:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<DoubleType>(descr));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -111,6 +111,16 @@ class DictEncoder : virtual public TypedEncoder<DType> {
   /// \param[in] values the dictionary values. Only valid for certain
   /// Parquet/Arrow type combinations, like BYTE_ARRAY/BinaryArray
   virtual void PutDictionary(const ::arrow::Array& values) = 0;
+
+  /// \brief EXPERIMENTAL: Merge dictionary values into the encoder's memo,
+  /// which may be non-empty. Each value is hashed once, and its memo index is
+  /// written to memo_indices, so that indices into `values` can be remapped
+  /// and passed to PutIndices
+  /// \param[in] values the dictionary values. Only valid for certain
+  /// Parquet/Arrow type combinations, like BYTE_ARRAY/BinaryArray
+  /// \param[out] memo_indices the memo index of each dictionary value
+  virtual void InsertDictionary(const ::arrow::Array& values,
+                                std::vector<int32_t>* memo_indices) = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -194,6 +204,20 @@ class DictDecoder : virtual public TypedDecoder<DType> {
   /// Remember to reset the builder each time the dict decoder is initialized
   /// with a new dictionary page
   virtual int DecodeIndices(int num_values, ::arrow::ArrayBuilder* builder) = 0;
+
+  /// \brief Access the values of the current dictionary page. The values are
+  /// owned by the decoder and only valid until the next call to SetDict
+  virtual void GetDictionary(const typename DType::c_type** dictionary,
+                             int32_t* dictionary_length) = 0;
+
+  /// \brief Decode only dictionary indices into an int32 buffer (no nulls)
+  virtual int DecodeIndices(int num_values, int32_t* indices) = 0;
+
+  /// \brief Decode only dictionary indices into an int32 buffer, leaving the
+  /// slots of null values uninitialized
+  virtual int DecodeIndicesSpaced(int num_values, int null_count,
+                                  const uint8_t* valid_bits, int64_t valid_bits_offset,
+                                  int32_t* indices) = 0;
 };
 
 // ----------------------------------------------------------------------
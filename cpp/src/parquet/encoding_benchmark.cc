@@ -263,6 +263,141 @@ static void BM_DictDecodingInt64_literals(benchmark::State& state) {
 
 BENCHMARK(BM_DictDecodingInt64_literals)->Range(MIN_RANGE, MAX_RANGE);
 
+// Monotonically increasing values with small jittered deltas, e.g. timestamps
+template <typename T>
+static std::vector<T> MakeSortedValues(int64_t length) {
+  std::vector<T> values(length);
+  T value = 1000000;
+  for (int64_t i = 0; i < length; ++i) {
+    value += static_cast<T>(100 + (i * 7919) % 64);
+    values[i] = value;
+  }
+  return values;
+}
+
+template <typename Type>
+static void EncodeDeltaBitPack(benchmark::State& state) {
+  typedef typename Type::c_type T;
+  std::vector<T> values = MakeSortedValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+
+  int64_t encoded_size = 0;
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoded_size = encoder->FlushValues()->size();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+  state.counters["encoded_bytes_per_value"] =
+      static_cast<double>(encoded_size) / static_cast<double>(values.size());
+}
+
+template <typename Type>
+static void DecodeDeltaBitPack(benchmark::State& state) {
+  typedef typename Type::c_type T;
+  std::vector<T> values = MakeSortedValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_DeltaBitPackEncodingInt32(benchmark::State& state) {
+  EncodeDeltaBitPack<Int32Type>(state);
+}
+
+BENCHMARK(BM_DeltaBitPackEncodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaBitPackDecodingInt32(benchmark::State& state) {
+  DecodeDeltaBitPack<Int32Type>(state);
+}
+
+BENCHMARK(BM_DeltaBitPackDecodingInt32)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaBitPackEncodingInt64(benchmark::State& state) {
+  EncodeDeltaBitPack<Int64Type>(state);
+}
+
+BENCHMARK(BM_DeltaBitPackEncodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_DeltaBitPackDecodingInt64(benchmark::State& state) {
+  DecodeDeltaBitPack<Int64Type>(state);
+}
+
+BENCHMARK(BM_DeltaBitPackDecodingInt64)->Range(MIN_RANGE, MAX_RANGE);
+
+// Noisy measurements, whose low mantissa bytes are close to random
+template <typename T>
+static std::vector<T> MakeSensorValues(int64_t length) {
+  std::default_random_engine gen(42);
+  std::normal_distribution<T> noise(0, 1);
+  std::vector<T> values(length);
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = static_cast<T>(20 + std::sin(static_cast<T>(i) / 100)) + noise(gen);
+  }
+  return values;
+}
+
+template <typename Type>
+static void EncodeByteStreamSplit(benchmark::State& state) {
+  typedef typename Type::c_type T;
+  std::vector<T> values = MakeSensorValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::BYTE_STREAM_SPLIT);
+
+  for (auto _ : state) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename Type>
+static void DecodeByteStreamSplit(benchmark::State& state) {
+  typedef typename Type::c_type T;
+  std::vector<T> values = MakeSensorValues<T>(state.range(0));
+  auto encoder = MakeTypedEncoder<Type>(Encoding::BYTE_STREAM_SPLIT);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  for (auto _ : state) {
+    auto decoder = MakeTypedDecoder<Type>(Encoding::BYTE_STREAM_SPLIT);
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_ByteStreamSplitEncodingFloat(benchmark::State& state) {
+  EncodeByteStreamSplit<FloatType>(state);
+}
+
+BENCHMARK(BM_ByteStreamSplitEncodingFloat)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_ByteStreamSplitDecodingFloat(benchmark::State& state) {
+  DecodeByteStreamSplit<FloatType>(state);
+}
+
+BENCHMARK(BM_ByteStreamSplitDecodingFloat)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_ByteStreamSplitEncodingDouble(benchmark::State& state) {
+  EncodeByteStreamSplit<DoubleType>(state);
+}
+
+BENCHMARK(BM_ByteStreamSplitEncodingDouble)->Range(MIN_RANGE, MAX_RANGE);
+
+static void BM_ByteStreamSplitDecodingDouble(benchmark::State& state) {
+  DecodeByteStreamSplit<DoubleType>(state);
+}
+
+BENCHMARK(BM_ByteStreamSplitDecodingDouble)->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Shared benchmarks for decoding using arrow builders
 class BenchmarkDecodeArrow : public ::benchmark::Fixture {
@@ -276,6 +411,7 @@ class BenchmarkDecodeArrow : public ::benchmark::Fixture {
   void TearDown(const ::benchmark::State& state) override {
     buffer_.reset();
     input_array_.reset();
+    values_.clear();
   }
 
   void InitDataInputs() {
@@ -419,6 +555,51 @@ BENCHMARK_DEFINE_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
 BENCHMARK_REGISTER_F(BM_ArrowBinaryPlain, DecodeArrowNonNull_Dict)
     ->Range(MIN_RANGE, MAX_RANGE);
 
+// ----------------------------------------------------------------------
+// Benchmark Decoding from the delta byte array encodings
+template <Encoding::type kEncoding>
+class BM_ArrowBinaryDelta : public BenchmarkDecodeArrow {
+ public:
+  void DoEncodeArrow() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(*input_array_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  void DoEncodeLowLevel() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(kEncoding);
+    encoder->Put(values_.data(), num_values_);
+    buffer_ = encoder->FlushValues();
+  }
+
+  std::unique_ptr<ByteArrayDecoder> InitializeDecoder() override {
+    auto decoder = MakeTypedDecoder<ByteArrayType>(kEncoding);
+    decoder->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+    return decoder;
+  }
+};
+
+using BM_ArrowBinaryDeltaLength = BM_ArrowBinaryDelta<Encoding::DELTA_LENGTH_BYTE_ARRAY>;
+using BM_ArrowBinaryDeltaPrefix = BM_ArrowBinaryDelta<Encoding::DELTA_BYTE_ARRAY>;
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, EncodeLowLevel)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowBenchmark<ChunkedBinaryBuilder>(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaLength, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaPrefix, EncodeLowLevel)
+(benchmark::State& state) { EncodeLowLevelBenchmark(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaPrefix, EncodeLowLevel)->Range(1 << 18, 1 << 20);
+
+BENCHMARK_DEFINE_F(BM_ArrowBinaryDeltaPrefix, DecodeArrow_Dense)
+(benchmark::State& state) { DecodeArrowBenchmark<ChunkedBinaryBuilder>(state); }
+BENCHMARK_REGISTER_F(BM_ArrowBinaryDeltaPrefix, DecodeArrow_Dense)
+    ->Range(MIN_RANGE, MAX_RANGE);
+
 // ----------------------------------------------------------------------
 // Benchmark Decoding from Dictionary Encoding
 class BM_ArrowBinaryDict : public BenchmarkDecodeArrow {
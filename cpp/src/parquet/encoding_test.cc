@@ -16,10 +16,12 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <string>
 #include <vector>
 
 #include "arrow/array.h"
@@ -247,6 +249,234 @@ TYPED_TEST(TestPlainEncoding, BasicRoundTrip) {
   ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
 }
 
+// ----------------------------------------------------------------------
+// Delta encoding tests
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackTypes;
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    // The encoded value count is read from the data rather than the
+    // (null-inclusive) page value count
+    decoder->SetData(num_values_ + 10, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    ASSERT_EQ(num_values_, decoder->values_left());
+
+    // Decode in uneven batches so as to cross miniblock boundaries
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_decoded = decoder->Decode(decode_buf_ + values_decoded, 77);
+      ASSERT_GT(batch_decoded, 0);
+      values_decoded += batch_decoded;
+    }
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+
+    // The encoder is reusable after flushing
+    encoder->Put(draws_, num_values_);
+    ASSERT_TRUE(encoder->FlushValues()->Equals(*encode_buffer_));
+  }
+
+  void ExecuteSorted(int nvalues) {
+    this->InitData(nvalues, 1);
+    std::sort(draws_, draws_ + num_values_);
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+TYPED_TEST_CASE(TestDeltaBitPackEncoding, DeltaBitPackTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Random values over the full range need the widest deltas
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  for (int nvalues : {1, 31, 32, 33, 128, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(nvalues, 1));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, SortedRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSorted(10000));
+}
+
+TEST(TestDeltaBitPackEncoding, SpecExample) {
+  // From the DELTA_BINARY_PACKED section of the Parquet format specification:
+  // all deltas are equal so every miniblock has a bit width of 0
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> encoded = encoder->FlushValues();
+
+  const std::vector<uint8_t> expected = {// block size, miniblocks, count, first value
+                                         0x80, 0x01, 0x04, 0x05, 0x02,
+                                         // min delta, miniblock bit widths
+                                         0x02, 0x00, 0x00, 0x00, 0x00};
+  ASSERT_TRUE(encoded->Equals(Buffer(expected.data(), expected.size())));
+}
+
+TEST(TestDeltaBitPackEncoding, MonotonicTimestamps) {
+  const int num_values = 10000;
+  std::vector<int64_t> values(num_values);
+  int64_t timestamp = 1570000000000000LL;
+  for (int i = 0; i < num_values; ++i) {
+    timestamp += 1000 + (i * 7919) % 500;
+    values[i] = timestamp;
+  }
+  auto encoder = MakeTypedEncoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), num_values);
+  std::shared_ptr<Buffer> encoded = encoder->FlushValues();
+  // Deltas fit in 9 bits
+  ASSERT_LT(encoded->size(), num_values * static_cast<int64_t>(sizeof(int64_t)) / 4);
+
+  std::vector<int64_t> decoded(num_values);
+  auto decoder = MakeTypedDecoder<Int64Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(num_values, encoded->data(), static_cast<int>(encoded->size()));
+  ASSERT_EQ(num_values, decoder->Decode(decoded.data(), num_values));
+  ASSERT_EQ(values, decoded);
+}
+
+TEST(TestDeltaBitPackEncoding, UnsupportedTypes) {
+  ASSERT_THROW(MakeTypedEncoder<DoubleType>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int96Type>(Encoding::DELTA_BINARY_PACKED),
+               ParquetException);
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::DELTA_BYTE_ARRAY), ParquetException);
+}
+
+class TestDeltaByteArrayEncoding : public TestEncodingBase<ByteArrayType>,
+                                   public ::testing::WithParamInterface<Encoding::type> {
+ public:
+  void CheckRoundtrip() override {
+    auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam(), false, descr_.get());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam(), descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_decoded = decoder->Decode(decode_buf_ + values_decoded, 77);
+      ASSERT_GT(batch_decoded, 0);
+      values_decoded += batch_decoded;
+    }
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<ByteArray>(decode_buf_, draws_, num_values_));
+  }
+};
+
+TEST_P(TestDeltaByteArrayEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->Execute(2500, 2));
+}
+
+TEST_P(TestDeltaByteArrayEncoding, SortedRoundTrip) {
+  // Sorted keys share long prefixes
+  std::vector<std::string> keys;
+  for (int i = 0; i < 1000; ++i) {
+    keys.push_back("user-" + std::to_string(1000000 + i * 13));
+  }
+  keys.push_back("");
+  std::vector<ByteArray> values;
+  for (const auto& key : keys) {
+    values.emplace_back(static_cast<uint32_t>(key.size()),
+                        reinterpret_cast<const uint8_t*>(key.data()));
+  }
+  num_values_ = static_cast<int>(values.size());
+  draws_ = values.data();
+  std::vector<ByteArray> decoded(values.size());
+  decode_buf_ = decoded.data();
+  CheckRoundtrip();
+}
+
+INSTANTIATE_TEST_CASE_P(DeltaEncodings, TestDeltaByteArrayEncoding,
+                        ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                          Encoding::DELTA_BYTE_ARRAY));
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT encoding tests
+
+typedef ::testing::Types<FloatType, DoubleType> ByteStreamSplitTypes;
+
+template <typename Type>
+class TestByteStreamSplitEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::BYTE_STREAM_SPLIT, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::BYTE_STREAM_SPLIT, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+    ASSERT_EQ(num_values_ * static_cast<int64_t>(sizeof(T)), encode_buffer_->size());
+
+    // Byte k of value i is at position k * num_values + i
+    const uint8_t* raw_values = reinterpret_cast<const uint8_t*>(draws_);
+    for (int i = 0; i < num_values_; ++i) {
+      for (size_t k = 0; k < sizeof(T); ++k) {
+        ASSERT_EQ(raw_values[i * sizeof(T) + k],
+                  encode_buffer_->data()[k * num_values_ + i]);
+      }
+    }
+
+    // The encoded value count follows from the data size rather than the
+    // (null-inclusive) page value count
+    decoder->SetData(num_values_ + 10, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    ASSERT_EQ(num_values_, decoder->values_left());
+
+    // Decode in uneven batches so as not to start at a multiple of the
+    // vectorized block size
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_decoded = decoder->Decode(decode_buf_ + values_decoded, 37);
+      ASSERT_GT(batch_decoded, 0);
+      values_decoded += batch_decoded;
+    }
+    ASSERT_EQ(num_values_, values_decoded);
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+
+    // The encoder is reusable after flushing
+    encoder->Put(draws_, num_values_);
+    ASSERT_TRUE(encoder->FlushValues()->Equals(*encode_buffer_));
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+TYPED_TEST_CASE(TestByteStreamSplitEncoding, ByteStreamSplitTypes);
+
+TYPED_TEST(TestByteStreamSplitEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+  for (int nvalues : {1, 15, 16, 17, 33, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(nvalues, 1));
+  }
+}
+
+TEST(TestByteStreamSplitEncoding, UnsupportedTypes) {
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::BYTE_STREAM_SPLIT),
+               ParquetException);
+  ASSERT_THROW(MakeTypedDecoder<Int64Type>(Encoding::BYTE_STREAM_SPLIT),
+               ParquetException);
+}
+
 // ----------------------------------------------------------------------
 // Dictionary encoding tests
 
@@ -481,6 +711,39 @@ TEST_F(PlainEncoding, CheckDecodeArrowNonNullDictBuilder) {
   this->CheckDecodeArrowNonNullUsingDictBuilder();
 }
 
+class DeltaByteArrayEncodings : public TestArrowBuilderDecoding,
+                                public ::testing::WithParamInterface<Encoding::type> {
+ public:
+  void SetupEncoderDecoder() override {
+    encoder_ = MakeTypedEncoder<ByteArrayType>(GetParam());
+    plain_decoder_ = MakeTypedDecoder<ByteArrayType>(GetParam());
+    decoder_ = plain_decoder_.get();
+    ASSERT_NO_THROW(encoder_->PutSpaced(input_data_.data(), num_values_, valid_bits_, 0));
+    buffer_ = encoder_->FlushValues();
+    decoder_->SetData(num_values_, buffer_->data(), static_cast<int>(buffer_->size()));
+  }
+};
+
+TEST_P(DeltaByteArrayEncodings, CheckDecodeArrowUsingDenseBuilder) {
+  this->CheckDecodeArrowUsingDenseBuilder();
+}
+
+TEST_P(DeltaByteArrayEncodings, CheckDecodeArrowUsingDictBuilder) {
+  this->CheckDecodeArrowUsingDictBuilder();
+}
+
+TEST_P(DeltaByteArrayEncodings, CheckDecodeArrowNonNullDenseBuilder) {
+  this->CheckDecodeArrowNonNullUsingDenseBuilder();
+}
+
+TEST_P(DeltaByteArrayEncodings, CheckDecodeArrowNonNullDictBuilder) {
+  this->CheckDecodeArrowNonNullUsingDictBuilder();
+}
+
+INSTANTIATE_TEST_CASE_P(DeltaEncodings, DeltaByteArrayEncodings,
+                        ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                          Encoding::DELTA_BYTE_ARRAY));
+
 TEST(PlainEncodingAdHoc, ArrowBinaryDirectPut) {
   // Implemented as part of ARROW-3246
 
@@ -618,6 +881,47 @@ TEST(DictEncodingAdHoc, PutDictionaryPutIndices) {
   arrow::AssertArraysEqual(*expected, *result);
 }
 
+TEST(DictEncodingAdHoc, InsertDictionaryPutIndices) {
+  auto dict_values = arrow::ArrayFromJSON(arrow::binary(), "[\"foo\", \"bar\"]");
+  auto other_dict_values =
+      arrow::ArrayFromJSON(arrow::binary(), "[\"baz\", \"foo\", \"qux\"]");
+
+  auto owned_encoder = MakeTypedEncoder<ByteArrayType>(Encoding::PLAIN,
+                                                       /*use_dictionary=*/true);
+  auto encoder = dynamic_cast<DictEncoder<ByteArrayType>*>(owned_encoder.get());
+
+  ASSERT_NO_THROW(encoder->PutDictionary(*dict_values));
+  const int dict_encoded_size = encoder->dict_encoded_size();
+
+  // Values already in the memo keep their index
+  std::vector<int32_t> memo_indices;
+  ASSERT_NO_THROW(encoder->InsertDictionary(*other_dict_values, &memo_indices));
+  ASSERT_EQ(std::vector<int32_t>({2, 0, 3}), memo_indices);
+  ASSERT_EQ(4, encoder->num_entries());
+  ASSERT_EQ(dict_encoded_size + 2 * static_cast<int>(3 + sizeof(uint32_t)),
+            encoder->dict_encoded_size());
+
+  auto indices = arrow::ArrayFromJSON(arrow::int32(), "[0, 3, null, 2]");
+  auto expected = arrow::ArrayFromJSON(arrow::binary(),
+                                       "[\"foo\", \"qux\", null, \"baz\"]");
+  ASSERT_NO_THROW(encoder->PutIndices(*indices));
+
+  std::unique_ptr<ByteArrayDecoder> decoder;
+  std::shared_ptr<Buffer> buf, dict_buf;
+  int num_values = static_cast<int>(expected->length() - expected->null_count());
+  GetBinaryDictDecoder(encoder, num_values, &buf, &dict_buf, &decoder);
+
+  arrow::BinaryBuilder builder;
+  ASSERT_EQ(num_values, decoder->DecodeArrow(static_cast<int>(expected->length()),
+                                             static_cast<int>(expected->null_count()),
+                                             expected->null_bitmap_data(),
+                                             expected->offset(), &builder));
+
+  std::shared_ptr<arrow::Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  arrow::AssertArraysEqual(*expected, *result);
+}
+
 class DictEncoding : public TestArrowBuilderDecoding {
  public:
   void SetupEncoderDecoder() override {
@@ -21,6 +21,7 @@
 #include <openssl/rand.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
 #include <sstream>
@@ -38,6 +39,7 @@ constexpr int kGcmMode = 0;
 constexpr int kCtrMode = 1;
 constexpr int kCtrIvLength = 16;
 constexpr int kBufferSizeLength = 4;
+constexpr int kMaxKeyLength = 32;
 
 #define ENCRYPT_INIT(CTX, ALG)                                        \
   if (1 != EVP_EncryptInit_ex(CTX, ALG, nullptr, nullptr, nullptr)) { \
@@ -49,6 +51,38 @@ constexpr int kBufferSizeLength = 4;
     throw ParquetException("Couldn't init ALG decryption");           \
   }
 
+// The key last set in a cipher context.  Setting a key expands its AES round
+// keys, and for GCM derives the GHASH tables, which costs as much as
+// encrypting a few kilobytes; a context that is given the same key again,
+// as is the case for all the pages of a column, only needs a new nonce.
+class CachedKey {
+ public:
+  CachedKey() : length_(0) {}
+
+  ~CachedKey() { Clear(); }
+
+  /// Return the key to pass to EVP_*Init_ex along with a new nonce: nullptr
+  /// if it is the key last set, which the context keeps.  The key is recorded
+  /// as set, so the caller must Clear() if EVP_*Init_ex fails.
+  const uint8_t* Update(const uint8_t* key, int key_len) {
+    if (key_len == length_ && std::memcmp(key, key_, key_len) == 0) {
+      return nullptr;
+    }
+    std::memcpy(key_, key, key_len);
+    length_ = key_len;
+    return key;
+  }
+
+  void Clear() {
+    OPENSSL_cleanse(key_, sizeof(key_));
+    length_ = 0;
+  }
+
+ private:
+  uint8_t key_[kMaxKeyLength];
+  int length_;
+};
+
 class AesEncryptor::AesEncryptorImpl {
  public:
   explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata);
@@ -71,12 +105,14 @@ class AesEncryptor::AesEncryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = NULLPTR;
     }
+    key_.Clear();
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
   EVP_CIPHER_CTX* ctx_;
+  CachedKey key_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -186,7 +222,10 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   memset(tag, 0, kGcmTagLength);
 
   // Setting key and IV (nonce)
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
+  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key_.Update(key, key_len),
+                              nonce)) {
+    // The context may not hold the key recorded by Update
+    key_.Clear();
     throw ParquetException("Couldn't set key and nonce");
   }
 
@@ -246,7 +285,9 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
+  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key_.Update(key, key_len), iv)) {
+    // The context may not hold the key recorded by Update
+    key_.Clear();
     throw ParquetException("Couldn't set key and IV");
   }
 
@@ -277,7 +318,7 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   return kBufferSizeLength + buffer_size;
 }
 
-AesEncryptor::~AesEncryptor() { impl_->~AesEncryptorImpl(); }
+AesEncryptor::~AesEncryptor() {}
 
 int AesEncryptor::SignedFooterEncrypt(const uint8_t* footer, int footer_len, uint8_t* key,
                                       int key_len, uint8_t* aad, int aad_len,
@@ -318,12 +359,14 @@ class AesDecryptor::AesDecryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = NULLPTR;
     }
+    key_.Clear();
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
   EVP_CIPHER_CTX* ctx_;
+  CachedKey key_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -341,7 +384,7 @@ int AesDecryptor::Decrypt(const uint8_t* plaintext, int plaintext_len, uint8_t*
 
 void AesDecryptor::WipeOut() { impl_->WipeOut(); }
 
-AesDecryptor::~AesDecryptor() { impl_->~AesDecryptorImpl(); }
+AesDecryptor::~AesDecryptor() {}
 
 AesDecryptor::AesDecryptorImpl::AesDecryptorImpl(ParquetCipher::type alg_id, int key_len,
                                                  bool metadata) {
@@ -457,7 +500,10 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
             tag);
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
+  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key_.Update(key, key_len),
+                              nonce)) {
+    // The context may not hold the key recorded by Update
+    key_.Clear();
     throw ParquetException("Couldn't set key and IV");
   }
 
@@ -519,7 +565,9 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
+  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key_.Update(key, key_len), iv)) {
+    // The context may not hold the key recorded by Update
+    key_.Clear();
     throw ParquetException("Couldn't set key and IV");
   }
 
@@ -44,6 +44,11 @@ constexpr int8_t kColumnIndex = 6;
 constexpr int8_t kOffsetIndex = 7;
 
 /// Performs AES encryption operations with GCM or CTR ciphers.
+///
+/// An encryptor owns one OpenSSL cipher context and keeps the key schedule of
+/// the last key it was given, so it is meant to encrypt all the modules of a
+/// column, or of the metadata.  It is not thread-safe: writers encoding
+/// columns in parallel use one encryptor per column.
 class AesEncryptor {
  public:
   static AesEncryptor* Make(ParquetCipher::type alg_id, int key_len, bool metadata,
@@ -75,6 +80,8 @@ class AesEncryptor {
 };
 
 /// Performs AES decryption operations with GCM or CTR ciphers.
+///
+/// As with AesEncryptor, one decryptor is used per column and thread.
 class AesDecryptor {
  public:
   static AesDecryptor* Make(ParquetCipher::type alg_id, int key_len, bool metadata,
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/encryption_internal.h"
+#include "parquet/exception.h"
+
+namespace parquet {
+namespace encryption {
+namespace test {
+
+class TestAesEncryption : public ::testing::TestWithParam<bool> {
+ protected:
+  void SetUp() override {
+    key0_ = std::string(kKeyLength, 'a');
+    key1_ = std::string(kKeyLength, 'b');
+    aad_ = "module aad";
+  }
+
+  // Encrypt a plaintext with a key, checking it round-trips through the
+  // decryptor with the same key
+  std::vector<uint8_t> RoundTrip(AesEncryptor* encryptor, AesDecryptor* decryptor,
+                                 const std::string& plaintext, std::string key) {
+    std::vector<uint8_t> ciphertext(plaintext.size() +
+                                    encryptor->CiphertextSizeDelta());
+    const int ciphertext_len = encryptor->Encrypt(
+        Bytes(plaintext), static_cast<int>(plaintext.size()), MutableBytes(&key),
+        kKeyLength, MutableBytes(&aad_), static_cast<int>(aad_.size()),
+        ciphertext.data());
+    EXPECT_EQ(static_cast<int>(ciphertext.size()), ciphertext_len);
+
+    std::vector<uint8_t> decrypted(plaintext.size());
+    const int decrypted_len =
+        decryptor->Decrypt(ciphertext.data(), ciphertext_len, MutableBytes(&key),
+                           kKeyLength, MutableBytes(&aad_),
+                           static_cast<int>(aad_.size()), decrypted.data());
+    EXPECT_EQ(static_cast<int>(plaintext.size()), decrypted_len);
+    EXPECT_EQ(plaintext, std::string(decrypted.begin(), decrypted.end()));
+    return ciphertext;
+  }
+
+  static const uint8_t* Bytes(const std::string& s) {
+    return reinterpret_cast<const uint8_t*>(s.data());
+  }
+
+  static uint8_t* MutableBytes(std::string* s) {
+    return reinterpret_cast<uint8_t*>(&(*s)[0]);
+  }
+
+  static constexpr int kKeyLength = 16;
+
+  std::string key0_;
+  std::string key1_;
+  std::string aad_;
+};
+
+constexpr int TestAesEncryption::kKeyLength;
+
+TEST_P(TestAesEncryption, AlternateKeys) {
+  // Metadata modules are encrypted with GCM, data modules with CTR
+  const bool metadata = GetParam();
+  std::unique_ptr<AesEncryptor> encryptor(
+      AesEncryptor::Make(ParquetCipher::AES_GCM_CTR_V1, kKeyLength, metadata, NULLPTR));
+  std::unique_ptr<AesDecryptor> decryptor(
+      AesDecryptor::Make(ParquetCipher::AES_GCM_CTR_V1, kKeyLength, metadata, NULLPTR));
+
+  const std::string plaintext = "some page of a column, long enough to span blocks";
+  for (int i = 0; i < 4; ++i) {
+    RoundTrip(encryptor.get(), decryptor.get(), plaintext, key0_);
+    auto ciphertext = RoundTrip(encryptor.get(), decryptor.get(), plaintext, key1_);
+
+    // The ciphertext was produced with the second key, not the cached first one
+    std::vector<uint8_t> decrypted(plaintext.size());
+    if (metadata) {
+      ASSERT_THROW(decryptor->Decrypt(ciphertext.data(),
+                                      static_cast<int>(ciphertext.size()),
+                                      MutableBytes(&key0_), kKeyLength,
+                                      MutableBytes(&aad_),
+                                      static_cast<int>(aad_.size()), decrypted.data()),
+                   ParquetException);
+    } else {
+      decryptor->Decrypt(ciphertext.data(), static_cast<int>(ciphertext.size()),
+                         MutableBytes(&key0_), kKeyLength, MutableBytes(&aad_),
+                         static_cast<int>(aad_.size()), decrypted.data());
+      ASSERT_NE(plaintext, std::string(decrypted.begin(), decrypted.end()));
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(GcmAndCtr, TestAesEncryption, ::testing::Values(true, false));
+
+}  // namespace test
+}  // namespace encryption
+}  // namespace parquet
@@ -68,11 +68,14 @@ class TestPageSerde : public ::testing::Test {
   }
 
   void InitSerializedPageReader(int64_t num_rows,
-                                Compression::type codec = Compression::UNCOMPRESSED) {
+                                Compression::type codec = Compression::UNCOMPRESSED,
+                                bool parallel_decompression = false) {
     EndStream();
 
     auto stream = std::make_shared<::arrow::io::BufferReader>(out_buffer_);
-    page_reader_ = PageReader::Open(stream, num_rows, codec);
+    page_reader_ = PageReader::Open(stream, num_rows, codec,
+                                    ::arrow::default_memory_pool(),
+                                    parallel_decompression);
   }
 
   void WriteDataPageHeader(int max_serialized_len = 1024, int32_t uncompressed_size = 0,
@@ -249,36 +252,40 @@ TEST_F(TestPageSerde, Compression) {
   for (auto codec_type : codec_types) {
     auto codec = GetCodec(codec_type);
 
-    std::vector<uint8_t> buffer;
-    for (int i = 0; i < num_pages; ++i) {
-      const uint8_t* data = faux_data[i].data();
-      int data_size = static_cast<int>(faux_data[i].size());
-
-      int64_t max_compressed_size = codec->MaxCompressedLen(data_size, data);
-      buffer.resize(max_compressed_size);
-
-      int64_t actual_size;
-      ASSERT_OK(codec->Compress(data_size, data, max_compressed_size, &buffer[0],
-                                &actual_size));
-
-      ASSERT_NO_FATAL_FAILURE(
-          WriteDataPageHeader(1024, data_size, static_cast<int32_t>(actual_size)));
-      ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
-    }
-
-    InitSerializedPageReader(num_rows * num_pages, codec_type);
-
-    std::shared_ptr<Page> page;
-    const DataPageV1* data_page;
-    for (int i = 0; i < num_pages; ++i) {
-      int data_size = static_cast<int>(faux_data[i].size());
-      page = page_reader_->NextPage();
-      data_page = static_cast<const DataPageV1*>(page.get());
-      ASSERT_EQ(data_size, data_page->size());
-      ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
+    for (bool parallel_decompression : {false, true}) {
+      std::vector<uint8_t> buffer;
+      for (int i = 0; i < num_pages; ++i) {
+        const uint8_t* data = faux_data[i].data();
+        int data_size = static_cast<int>(faux_data[i].size());
+
+        int64_t max_compressed_size = codec->MaxCompressedLen(data_size, data);
+        buffer.resize(max_compressed_size);
+
+        int64_t actual_size;
+        ASSERT_OK(codec->Compress(data_size, data, max_compressed_size, &buffer[0],
+                                  &actual_size));
+
+        ASSERT_NO_FATAL_FAILURE(
+            WriteDataPageHeader(1024, data_size, static_cast<int32_t>(actual_size)));
+        ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
+      }
+
+      InitSerializedPageReader(num_rows * num_pages, codec_type,
+                               parallel_decompression);
+
+      std::shared_ptr<Page> page;
+      const DataPageV1* data_page;
+      for (int i = 0; i < num_pages; ++i) {
+        int data_size = static_cast<int>(faux_data[i].size());
+        page = page_reader_->NextPage();
+        data_page = static_cast<const DataPageV1*>(page.get());
+        ASSERT_EQ(data_size, data_page->size());
+        ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
+      }
+      ASSERT_EQ(nullptr, page_reader_->NextPage());
+
+      ResetStream();
     }
-
-    ResetStream();
   }
 }
 
@@ -20,20 +20,29 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <utility>
 
 #include "arrow/io/file.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/deprecated_io.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -74,16 +83,213 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::unique_ptr<BloomFilter> RowGroupReader::Contents::GetColumnBloomFilter(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<BloomFilter> RowGroupReader::GetColumnBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnBloomFilter(i);
+}
+
+const BloomFilter* RowGroupReader::GetCachedBloomFilter(int i,
+                                                        Type::type physical_type) {
+  const int num_columns = metadata()->num_columns();
+  if (i < 0 || i >= num_columns) {
+    std::stringstream ss;
+    ss << "The RowGroup only has " << num_columns << " columns, requested column: " << i;
+    throw ParquetException(ss.str());
+  }
+  const ColumnDescriptor* descr = metadata()->schema()->Column(i);
+  if (descr->physical_type() != physical_type) {
+    std::stringstream ss;
+    ss << "Cannot probe the Bloom filter of column " << descr->path()->ToDotString()
+       << " (" << TypeToString(descr->physical_type()) << ") with a "
+       << TypeToString(physical_type) << " value";
+    throw ParquetException(ss.str());
+  }
+  if (bloom_filters_.empty()) {
+    bloom_filters_.resize(num_columns);
+    bloom_filters_loaded_.resize(num_columns, false);
+  }
+  if (!bloom_filters_loaded_[i]) {
+    bloom_filters_[i] = contents_->GetColumnBloomFilter(i);
+    bloom_filters_loaded_[i] = true;
+  }
+  return bloom_filters_[i].get();
+}
+
+std::shared_ptr<ColumnIndex> RowGroupReader::Contents::GetColumnIndex(int i) {
+  return nullptr;
+}
+
+std::shared_ptr<OffsetIndex> RowGroupReader::Contents::GetColumnOffsetIndex(int i) {
+  return nullptr;
+}
+
+std::unique_ptr<PageReader> RowGroupReader::Contents::GetColumnPageReader(
+    int i, const std::vector<int>& page_indices) {
+  throw ParquetException("Reading selected pages is not supported by this reader");
+}
+
+std::shared_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::shared_ptr<OffsetIndex> RowGroupReader::GetColumnOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnOffsetIndex(i);
+}
+
+std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(
+    int i, const std::vector<int>& page_indices) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnPageReader(i, page_indices);
+}
+
+bool RowGroupReader::RowGroupMayContain(int i, int32_t value) {
+  const BloomFilter* filter = GetCachedBloomFilter(i, Type::INT32);
+  return filter == nullptr || filter->FindHash(filter->Hash(value));
+}
+
+bool RowGroupReader::RowGroupMayContain(int i, int64_t value) {
+  const BloomFilter* filter = GetCachedBloomFilter(i, Type::INT64);
+  return filter == nullptr || filter->FindHash(filter->Hash(value));
+}
+
+bool RowGroupReader::RowGroupMayContain(int i, const Int96& value) {
+  const BloomFilter* filter = GetCachedBloomFilter(i, Type::INT96);
+  return filter == nullptr || filter->FindHash(filter->Hash(&value));
+}
+
+bool RowGroupReader::RowGroupMayContain(int i, float value) {
+  const BloomFilter* filter = GetCachedBloomFilter(i, Type::FLOAT);
+  return filter == nullptr || filter->FindHash(filter->Hash(value));
+}
+
+bool RowGroupReader::RowGroupMayContain(int i, double value) {
+  const BloomFilter* filter = GetCachedBloomFilter(i, Type::DOUBLE);
+  return filter == nullptr || filter->FindHash(filter->Hash(value));
+}
+
+bool RowGroupReader::RowGroupMayContain(int i, const ByteArray& value) {
+  const BloomFilter* filter = GetCachedBloomFilter(i, Type::BYTE_ARRAY);
+  return filter == nullptr || filter->FindHash(filter->Hash(&value));
+}
+
+bool RowGroupReader::RowGroupMayContain(int i, const FixedLenByteArray& value) {
+  const BloomFilter* filter = GetCachedBloomFilter(i, Type::FIXED_LEN_BYTE_ARRAY);
+  if (filter == nullptr) return true;
+  const uint32_t type_length =
+      static_cast<uint32_t>(metadata()->schema()->Column(i)->type_length());
+  return filter->FindHash(filter->Hash(&value, type_length));
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
+// Return the byte range of a column chunk in the file
+static ::arrow::io::ReadRange ComputeColumnChunkRange(FileMetaData* file_metadata,
+                                                      ArrowInputFile* source,
+                                                      const ColumnChunkMetaData& col) {
+  int64_t col_start = col.data_page_offset();
+  if (col.has_dictionary_page() && col.dictionary_page_offset() > 0 &&
+      col_start > col.dictionary_page_offset()) {
+    col_start = col.dictionary_page_offset();
+  }
+
+  int64_t col_length = col.total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata->writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t size = -1;
+    PARQUET_THROW_NOT_OK(source->GetSize(&size));
+    int64_t bytes_remaining = size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+  return {col_start, col_length};
+}
+
+// Column chunks read in the background by ParquetFileReader::PrefetchRowGroup.
+// Each of them is handed out once, to the page reader of its column chunk
+class ColumnChunkPrefetcher {
+ public:
+  void Prefetch(const std::shared_ptr<ArrowInputFile>& source, int row_group,
+                int column, ::arrow::io::ReadRange range) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_ptr<Chunk>& chunk = chunks_[std::make_pair(row_group, column)];
+    if (chunk != nullptr) {
+      return;
+    }
+    chunk = std::make_shared<Chunk>();
+    chunk->range = range;
+    std::shared_ptr<Chunk> task_chunk = chunk;
+    chunk->status = ::arrow::internal::GetIOThreadPool()->Submit([source, task_chunk]() {
+      return source->ReadAt(task_chunk->range.offset, task_chunk->range.length,
+                            &task_chunk->buffer);
+    });
+  }
+
+  // Wait for the bytes of a prefetched column chunk, or return nullptr if
+  // the column chunk wasn't prefetched
+  std::shared_ptr<Buffer> Take(int row_group, int column) {
+    std::shared_ptr<Chunk> chunk;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = chunks_.find(std::make_pair(row_group, column));
+      if (it == chunks_.end()) {
+        return nullptr;
+      }
+      chunk = std::move(it->second);
+      chunks_.erase(it);
+    }
+    PARQUET_THROW_NOT_OK(chunk->status.get());
+    if (chunk->buffer->size() != chunk->range.length) {
+      std::stringstream ss;
+      ss << "Tried reading " << chunk->range.length << " bytes starting at position "
+         << chunk->range.offset << " from file but only got " << chunk->buffer->size();
+      throw ParquetException(ss.str());
+    }
+    return std::move(chunk->buffer);
+  }
+
+ private:
+  struct Chunk {
+    ::arrow::io::ReadRange range;
+    std::shared_ptr<Buffer> buffer;
+    std::future<::arrow::Status> status;
+  };
+
+  std::mutex mutex_;
+  std::map<std::pair<int, int>, std::shared_ptr<Chunk>> chunks_;
+};
+
 // RowGroupReader::Contents implementation for the Parquet file specification
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
   SerializedRowGroup(const std::shared_ptr<ArrowInputFile>& source,
                      FileMetaData* file_metadata, int row_group_number,
-                     const ReaderProperties& props)
-      : source_(source), file_metadata_(file_metadata), properties_(props) {
+                     const ReaderProperties& props,
+                     const std::shared_ptr<ColumnChunkPrefetcher>& prefetcher)
+      : source_(source),
+        file_metadata_(file_metadata),
+        row_group_number_(row_group_number),
+        properties_(props),
+        prefetcher_(prefetcher) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -94,39 +300,145 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
-
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
+    std::shared_ptr<ArrowInputStream> stream;
+    std::shared_ptr<Buffer> prefetched = prefetcher_->Take(row_group_number_, i);
+    if (prefetched != nullptr) {
+      stream = std::make_shared<::arrow::io::BufferReader>(prefetched);
+    } else {
+      ::arrow::io::ReadRange range =
+          ComputeColumnChunkRange(file_metadata_, source_.get(), *col);
+      stream = properties_.GetStream(source_, range.offset, range.length);
     }
+    return PageReader::Open(stream, col->num_values(), col->compression(),
+                            properties_.memory_pool(),
+                            properties_.is_parallel_decompression_enabled());
+  }
 
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t size = -1;
-      PARQUET_THROW_NOT_OK(source_->GetSize(&size));
-      int64_t bytes_remaining = size - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
     }
 
+    int64_t file_size = -1;
+    PARQUET_THROW_NOT_OK(source_->GetSize(&file_size));
+    const int64_t offset = col->bloom_filter_offset();
+    if (offset < 0 || offset >= file_size) {
+      throw ParquetException("Invalid Bloom filter offset in column chunk metadata");
+    }
+    // The stream only reads the bytes the filter header asks for
     std::shared_ptr<ArrowInputStream> stream =
-        properties_.GetStream(source_, col_start, col_length);
+        ::arrow::io::RandomAccessFile::GetStream(source_, offset, file_size - offset);
+    return std::unique_ptr<BloomFilter>(
+        new BlockSplitBloomFilter(BlockSplitBloomFilter::Deserialize(stream.get())));
+  }
+
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadPageIndex(col->column_index_offset(), col->column_index_length());
+    return ColumnIndex::Make(row_group_metadata_->schema()->Column(i), buffer->data(),
+                             static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::shared_ptr<OffsetIndex> GetColumnOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadPageIndex(col->offset_index_offset(), col->offset_index_length());
+    return OffsetIndex::Make(buffer->data(), static_cast<uint32_t>(buffer->size()));
+  }
+
+  std::unique_ptr<PageReader> GetColumnPageReader(
+      int i, const std::vector<int>& page_indices) override {
+    std::shared_ptr<OffsetIndex> offset_index = GetColumnOffsetIndex(i);
+    if (offset_index == nullptr) {
+      throw ParquetException("Cannot select pages of a column chunk without OffsetIndex");
+    }
+    const std::vector<PageLocation>& locations = offset_index->page_locations();
+
+    // Coalesce adjacent pages into a single read
+    std::vector<::arrow::io::ReadRange> ranges;
+    auto AddRange = [&](int64_t offset, int64_t length) {
+      if (length <= 0) {
+        return;
+      }
+      if (!ranges.empty() && ranges.back().offset + ranges.back().length == offset) {
+        ranges.back().length += length;
+      } else {
+        ranges.push_back({offset, length});
+      }
+    };
+
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (col->has_dictionary_page() && !locations.empty()) {
+      // The dictionary page precedes the first data page
+      ::arrow::io::ReadRange chunk_range =
+          ComputeColumnChunkRange(file_metadata_, source_.get(), *col);
+      AddRange(chunk_range.offset, locations[0].offset - chunk_range.offset);
+    }
+    int previous_page = -1;
+    for (int page : page_indices) {
+      if (page <= previous_page || page >= offset_index->num_pages()) {
+        std::stringstream ss;
+        ss << "Invalid page index " << page << " for a column chunk with "
+           << offset_index->num_pages() << " pages";
+        throw ParquetException(ss.str());
+      }
+      AddRange(locations[page].offset, locations[page].compressed_page_size);
+      previous_page = page;
+    }
+
+    int64_t total_length = 0;
+    for (const auto& range : ranges) {
+      total_length += range.length;
+    }
+    std::shared_ptr<ResizableBuffer> pages =
+        AllocateBuffer(properties_.memory_pool(), total_length);
+    uint8_t* out = pages->mutable_data();
+    for (const auto& range : ranges) {
+      std::shared_ptr<Buffer> buffer;
+      PARQUET_THROW_NOT_OK(source_->ReadAt(range.offset, range.length, &buffer));
+      if (buffer->size() != range.length) {
+        throw ParquetException("Page locations exceed the file size");
+      }
+      memcpy(out, buffer->data(), static_cast<size_t>(range.length));
+      out += range.length;
+    }
+
+    // The page reader stops at the end of the selected pages
+    auto stream = std::make_shared<::arrow::io::BufferReader>(pages);
     return PageReader::Open(stream, col->num_values(), col->compression(),
-                            properties_.memory_pool());
+                            properties_.memory_pool(),
+                            properties_.is_parallel_decompression_enabled());
   }
 
  private:
+  std::shared_ptr<Buffer> ReadPageIndex(int64_t offset, int32_t length) {
+    int64_t file_size = -1;
+    PARQUET_THROW_NOT_OK(source_->GetSize(&file_size));
+    if (offset < 0 || length <= 0 || offset + length > file_size) {
+      throw ParquetException("Invalid page index location in column chunk metadata");
+    }
+    std::shared_ptr<Buffer> buffer;
+    PARQUET_THROW_NOT_OK(source_->ReadAt(offset, length, &buffer));
+    if (buffer->size() != length) {
+      throw ParquetException("Page index was truncated");
+    }
+    return buffer;
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   FileMetaData* file_metadata_;
+  int row_group_number_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
+  std::shared_ptr<ColumnChunkPrefetcher> prefetcher_;
 };
 
 // ----------------------------------------------------------------------
@@ -139,18 +451,45 @@ class SerializedFile : public ParquetFileReader::Contents {
  public:
   SerializedFile(const std::shared_ptr<ArrowInputFile>& source,
                  const ReaderProperties& props = default_reader_properties())
-      : source_(source), properties_(props) {}
+      : source_(source),
+        properties_(props),
+        prefetcher_(std::make_shared<ColumnChunkPrefetcher>()) {}
 
   void Close() override {}
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_, file_metadata_.get(), i, properties_));
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_, file_metadata_.get(), i, properties_, prefetcher_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices) override {
+    std::vector<::arrow::io::ReadRange> ranges;
+    for (int row_group : row_groups) {
+      std::unique_ptr<RowGroupMetaData> row_group_metadata =
+          file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        auto col = row_group_metadata->ColumnChunk(column);
+        ranges.push_back(ComputeColumnChunkRange(file_metadata_.get(), source_.get(), *col));
+      }
+    }
+    PARQUET_THROW_NOT_OK(source_->WillNeed(ranges));
+  }
+
+  void PrefetchRowGroup(int row_group, const std::vector<int>& column_indices) override {
+    std::unique_ptr<RowGroupMetaData> row_group_metadata =
+        file_metadata_->RowGroup(row_group);
+    for (int column : column_indices) {
+      auto col = row_group_metadata->ColumnChunk(column);
+      prefetcher_->Prefetch(
+          source_, row_group, column,
+          ComputeColumnChunkRange(file_metadata_.get(), source_.get(), *col));
+    }
+  }
+
   void set_metadata(const std::shared_ptr<FileMetaData>& metadata) {
     file_metadata_ = metadata;
   }
@@ -208,6 +547,7 @@ class SerializedFile : public ParquetFileReader::Contents {
   std::shared_ptr<ArrowInputFile> source_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
+  std::shared_ptr<ColumnChunkPrefetcher> prefetcher_;
 };
 
 // ----------------------------------------------------------------------
@@ -291,6 +631,25 @@ std::shared_ptr<FileMetaData> ParquetFileReader::metadata() const {
   return contents_->metadata();
 }
 
+void ParquetFileReader::Contents::PreBuffer(const std::vector<int>& row_groups,
+                                           const std::vector<int>& column_indices) {}
+
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices) {
+  contents_->PreBuffer(row_groups, column_indices);
+}
+
+void ParquetFileReader::Contents::PrefetchRowGroup(
+    int row_group, const std::vector<int>& column_indices) {}
+
+void ParquetFileReader::PrefetchRowGroup(int row_group,
+                                         const std::vector<int>& column_indices) {
+  DCHECK(row_group < metadata()->num_row_groups())
+      << "The file only has " << metadata()->num_row_groups()
+      << " row groups, requested prefetch of: " << row_group;
+  contents_->PrefetchRowGroup(row_group, column_indices);
+}
+
 std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   DCHECK(i < metadata()->num_row_groups())
       << "The file only has " << metadata()->num_row_groups()
@@ -306,6 +665,62 @@ std::shared_ptr<FileMetaData> ReadMetaData(
   return ParquetFileReader::Open(source)->metadata();
 }
 
+// ----------------------------------------------------------------------
+// FileMetaDataCache
+
+FileMetaDataCache::FileMetaDataCache(size_t capacity) : capacity_(capacity) {}
+
+FileMetaDataCache::~FileMetaDataCache() {}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const std::string& path,
+                                                     int64_t file_size,
+                                                     int64_t modification_time) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(path);
+  if (it == index_.end() || it->second->file_size != file_size ||
+      it->second->modification_time != modification_time) {
+    return nullptr;
+  }
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return entries_.front().metadata;
+}
+
+void FileMetaDataCache::Put(const std::string& path, int64_t file_size,
+                            int64_t modification_time,
+                            std::shared_ptr<FileMetaData> metadata) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(path);
+  if (it != index_.end()) {
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+  if (capacity_ == 0) {
+    return;
+  }
+  while (entries_.size() >= capacity_) {
+    index_.erase(entries_.back().path);
+    entries_.pop_back();
+  }
+  entries_.push_front({path, file_size, modification_time, std::move(metadata)});
+  index_[path] = entries_.begin();
+}
+
+void FileMetaDataCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  index_.clear();
+  entries_.clear();
+}
+
+size_t FileMetaDataCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+FileMetaDataCache* default_file_metadata_cache() {
+  static FileMetaDataCache cache(128);
+  return &cache;
+}
+
 // ----------------------------------------------------------------------
 // File scanner for performance testing
 
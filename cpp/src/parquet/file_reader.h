@@ -19,11 +19,16 @@
 #define PARQUET_FILE_READER_H
 
 #include <cstdint>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
-#include "parquet/metadata.h"  // IWYU pragma: keep
+#include "parquet/bloom_filter.h"  // IWYU pragma: keep
+#include "parquet/metadata.h"       // IWYU pragma: keep
+#include "parquet/page_index.h"     // IWYU pragma: keep
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 
@@ -45,6 +50,14 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    // Returns null unless overridden
+    virtual std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+    // Return null unless overridden
+    virtual std::shared_ptr<ColumnIndex> GetColumnIndex(int i);
+    virtual std::shared_ptr<OffsetIndex> GetColumnOffsetIndex(int i);
+    // Throws unless overridden
+    virtual std::unique_ptr<PageReader> GetColumnPageReader(
+        int i, const std::vector<int>& page_indices);
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -58,9 +71,49 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Read the Bloom filter of the indicated column chunk, or return null if
+  // none was written
+  std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i);
+
+  // Return false if the Bloom filter of the indicated column chunk shows that
+  // the value does not occur in it. Column chunks without a Bloom filter may
+  // contain any value. Throws if the value type does not match the column's
+  // physical type.
+  bool RowGroupMayContain(int i, int32_t value);
+  bool RowGroupMayContain(int i, int64_t value);
+  bool RowGroupMayContain(int i, const Int96& value);
+  bool RowGroupMayContain(int i, float value);
+  bool RowGroupMayContain(int i, double value);
+  bool RowGroupMayContain(int i, const ByteArray& value);
+  bool RowGroupMayContain(int i, const FixedLenByteArray& value);
+
+  // Read the ColumnIndex of the indicated column chunk, or return null if
+  // none was written
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  // Read the OffsetIndex of the indicated column chunk, or return null if
+  // none was written
+  std::shared_ptr<OffsetIndex> GetColumnOffsetIndex(int i);
+
+  // Construct a PageReader returning the dictionary page, if any, followed by
+  // only the indicated data pages, as numbered by the OffsetIndex of the
+  // column chunk. The page indices must be increasing. Only the bytes of
+  // those pages are read from the file. Throws if the column chunk has no
+  // OffsetIndex.
+  std::unique_ptr<PageReader> GetColumnPageReader(int i,
+                                                  const std::vector<int>& page_indices);
+
  private:
+  // Return the cached Bloom filter of the column chunk after checking its
+  // physical type
+  const BloomFilter* GetCachedBloomFilter(int i, Type::type physical_type);
+
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
+
+  // Lazily loaded Bloom filters, indexed by column
+  std::vector<std::shared_ptr<BloomFilter>> bloom_filters_;
+  std::vector<bool> bloom_filters_loaded_;
 };
 
 class PARQUET_EXPORT ParquetFileReader {
@@ -79,6 +132,12 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    // Hint that the given column chunks will be read. The default does nothing
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices);
+    // Start reading the given column chunks of a row group in the background.
+    // The default does nothing
+    virtual void PrefetchRowGroup(int row_group, const std::vector<int>& column_indices);
   };
 
   ParquetFileReader();
@@ -118,6 +177,20 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  // Tell the source which column chunks are about to be read, so that it may
+  // fetch them ahead of time (see ::arrow::io::RandomAccessFile::WillNeed).
+  // Only useful for high-latency sources such as object stores
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices);
+
+  // Start reading the given column chunks of a row group on the I/O thread
+  // pool (see ::arrow::internal::GetIOThreadPool). The page reader of each of
+  // these column chunks then waits for, and takes ownership of, its bytes
+  // instead of reading them itself. Prefetched column chunks are held in
+  // memory until their page reader is created, so only prefetch the ones
+  // that will be read
+  void PrefetchRowGroup(int row_group, const std::vector<int>& column_indices);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -127,6 +200,49 @@ class PARQUET_EXPORT ParquetFileReader {
 std::shared_ptr<FileMetaData> PARQUET_EXPORT
 ReadMetaData(const std::shared_ptr<::arrow::io::RandomAccessFile>& source);
 
+/// \brief A thread-safe cache of the metadata of recently opened files, so that
+/// a file opened repeatedly has its footer read and deserialized only once.
+///
+/// Entries are looked up by a path (or any other name the caller gives the
+/// file) and only match a file of the same size and modification time; a
+/// stale entry is replaced by the next Put for its path. The least recently
+/// used entries are evicted beyond the capacity.
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  explicit FileMetaDataCache(size_t capacity);
+  ~FileMetaDataCache();
+
+  /// \brief Return the cached metadata of the file, or nullptr
+  std::shared_ptr<FileMetaData> Get(const std::string& path, int64_t file_size,
+                                    int64_t modification_time);
+
+  void Put(const std::string& path, int64_t file_size, int64_t modification_time,
+           std::shared_ptr<FileMetaData> metadata);
+
+  void Clear();
+
+  size_t size() const;
+  size_t capacity() const { return capacity_; }
+
+ private:
+  struct Entry {
+    std::string path;
+    int64_t file_size;
+    int64_t modification_time;
+    std::shared_ptr<FileMetaData> metadata;
+  };
+
+  const size_t capacity_;
+  mutable std::mutex mutex_;
+  // Most recently used first
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+};
+
+/// \brief The process-wide FileMetaDataCache, holding up to 128 entries
+PARQUET_EXPORT
+FileMetaDataCache* default_file_metadata_cache();
+
 /// \brief Scan all values in file. Useful for performance testing
 /// \param[in] columns the column numbers to scan. If empty scans all
 /// \param[in] column_batch_size number of values to read at a time when scanning column
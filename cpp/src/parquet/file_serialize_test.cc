@@ -17,11 +17,16 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <vector>
+
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
+#include "parquet/statistics.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
 
@@ -308,6 +313,335 @@ TYPED_TEST(TestSerialize, SmallFileZstd) {
 }
 #endif
 
+// ----------------------------------------------------------------------
+// Page indexes
+
+class TestPageIndex : public ::testing::TestWithParam<bool> {
+ public:
+  static constexpr int kNumRows = 400;
+
+  void SetUp() {
+    for (int i = 0; i < kNumRows; ++i) {
+      a_values_.push_back(i);
+      // Nulls in every other group of 20 rows
+      const bool is_valid = (i / 20) % 2 == 1;
+      b_def_levels_.push_back(is_valid ? 1 : 0);
+      if (is_valid) {
+        b_values_.push_back(-i);
+      }
+    }
+  }
+
+  // Write two row groups of kNumRows rows with small data pages
+  void WriteFile(bool buffered_row_group) {
+    auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+        "schema", Repetition::REQUIRED,
+        {PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT64),
+         PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::INT64),
+         PrimitiveNode::Make("c", Repetition::REQUIRED, Type::INT64)}));
+    auto properties = WriterProperties::Builder()
+                          .disable_dictionary()
+                          ->data_pagesize(100)
+                          ->write_batch_size(16)
+                          ->enable_page_index()
+                          ->disable_page_index("c")
+                          ->build();
+
+    auto sink = CreateOutputStream();
+    auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+    for (int rg = 0; rg < 2; ++rg) {
+      RowGroupWriter* row_group_writer = buffered_row_group
+                                             ? file_writer->AppendBufferedRowGroup()
+                                             : file_writer->AppendRowGroup();
+      for (int col = 0; col < 3; ++col) {
+        auto column_writer = static_cast<Int64Writer*>(
+            buffered_row_group ? row_group_writer->column(col)
+                               : row_group_writer->NextColumn());
+        if (col == 1) {
+          column_writer->WriteBatch(kNumRows, b_def_levels_.data(), nullptr,
+                                    b_values_.data());
+        } else {
+          column_writer->WriteBatch(kNumRows, nullptr, nullptr, a_values_.data());
+        }
+        if (!buffered_row_group) {
+          column_writer->Close();
+        }
+      }
+      row_group_writer->Close();
+    }
+    file_writer->Close();
+
+    std::shared_ptr<Buffer> buffer;
+    PARQUET_THROW_NOT_OK(sink->Finish(&buffer));
+    auto source = std::make_shared<::arrow::io::BufferReader>(buffer);
+    file_reader_ = ParquetFileReader::Open(source);
+  }
+
+  // Read all values of a column through the given page reader
+  std::vector<int64_t> ReadValues(int column, std::unique_ptr<PageReader> pager) {
+    const ColumnDescriptor* descr = file_reader_->metadata()->schema()->Column(column);
+    auto reader = std::static_pointer_cast<Int64Reader>(
+        ColumnReader::Make(descr, std::move(pager)));
+    std::vector<int64_t> values(kNumRows);
+    std::vector<int16_t> def_levels(kNumRows);
+    int64_t total_values_read = 0;
+    while (reader->HasNext()) {
+      int64_t values_read = 0;
+      reader->ReadBatch(kNumRows - total_values_read, def_levels.data(), nullptr,
+                        values.data() + total_values_read, &values_read);
+      total_values_read += values_read;
+    }
+    values.resize(total_values_read);
+    return values;
+  }
+
+ protected:
+  std::vector<int64_t> a_values_;
+  std::vector<int64_t> b_values_;
+  std::vector<int16_t> b_def_levels_;
+  std::unique_ptr<ParquetFileReader> file_reader_;
+};
+
+constexpr int TestPageIndex::kNumRows;
+
+TEST_P(TestPageIndex, WriteAndRead) {
+  ASSERT_NO_FATAL_FAILURE(WriteFile(GetParam()));
+
+  for (int rg = 0; rg < 2; ++rg) {
+    auto row_group = file_reader_->RowGroup(rg);
+
+    // Required column: the pages hold consecutive row indices
+    std::shared_ptr<OffsetIndex> offset_index = row_group->GetColumnOffsetIndex(0);
+    std::shared_ptr<ColumnIndex> column_index = row_group->GetColumnIndex(0);
+    ASSERT_NE(nullptr, offset_index);
+    ASSERT_NE(nullptr, column_index);
+    ASSERT_GT(offset_index->num_pages(), 3);
+    ASSERT_EQ(offset_index->num_pages(), column_index->num_pages());
+
+    const auto& locations = offset_index->page_locations();
+    int64_t num_rows = 0;
+    for (int page = 0; page < offset_index->num_pages(); ++page) {
+      ASSERT_EQ(num_rows, locations[page].first_row_index);
+      const int64_t page_rows = offset_index->page_num_rows(page, kNumRows);
+      ASSERT_GT(page_rows, 0);
+
+      ASSERT_FALSE(column_index->null_page(page));
+      if (column_index->has_null_counts()) {
+        ASSERT_EQ(0, column_index->null_count(page));
+      }
+      int64_t min, max;
+      ASSERT_EQ(sizeof(int64_t), column_index->encoded_min(page).size());
+      ASSERT_EQ(sizeof(int64_t), column_index->encoded_max(page).size());
+      std::memcpy(&min, column_index->encoded_min(page).data(), sizeof(int64_t));
+      std::memcpy(&max, column_index->encoded_max(page).data(), sizeof(int64_t));
+      ASSERT_EQ(num_rows, min);
+      ASSERT_EQ(num_rows + page_rows - 1, max);
+
+      auto stats = std::static_pointer_cast<Int64Statistics>(
+          column_index->page_statistics(page));
+      ASSERT_TRUE(stats->HasMinMax());
+      ASSERT_EQ(min, stats->min());
+      ASSERT_EQ(max, stats->max());
+      num_rows += page_rows;
+    }
+    ASSERT_EQ(kNumRows, num_rows);
+
+    // Read only the second and fourth pages
+    std::vector<int64_t> expected;
+    for (int page : {1, 3}) {
+      const int64_t first_row = locations[page].first_row_index;
+      for (int64_t i = 0; i < offset_index->page_num_rows(page, kNumRows); ++i) {
+        expected.push_back(first_row + i);
+      }
+    }
+    ASSERT_EQ(expected, ReadValues(0, row_group->GetColumnPageReader(0, {1, 3})));
+    ASSERT_THROW(row_group->GetColumnPageReader(0, {3, 1}), ParquetException);
+    ASSERT_THROW(row_group->GetColumnPageReader(0, {offset_index->num_pages()}),
+                 ParquetException);
+
+    std::vector<int> pages = offset_index->PagesInRowRange(100, 10);
+    ASSERT_FALSE(pages.empty());
+    ASSERT_LE(locations[pages.front()].first_row_index, 100);
+    ASSERT_GT(locations[pages.back()].first_row_index +
+                  offset_index->page_num_rows(pages.back(), kNumRows),
+              109);
+
+    // Optional column: null counts match the definition levels
+    offset_index = row_group->GetColumnOffsetIndex(1);
+    column_index = row_group->GetColumnIndex(1);
+    ASSERT_NE(nullptr, offset_index);
+    ASSERT_NE(nullptr, column_index);
+    ASSERT_TRUE(column_index->has_null_counts());
+    for (int page = 0; page < offset_index->num_pages(); ++page) {
+      const int64_t first_row = offset_index->page_locations()[page].first_row_index;
+      const int64_t page_rows = offset_index->page_num_rows(page, kNumRows);
+      int64_t null_count = 0;
+      for (int64_t i = first_row; i < first_row + page_rows; ++i) {
+        null_count += b_def_levels_[i] == 0;
+      }
+      ASSERT_EQ(null_count, column_index->null_count(page));
+      ASSERT_EQ(null_count == page_rows, column_index->null_page(page));
+    }
+    const auto& locations_b = offset_index->page_locations();
+    const int last_page = offset_index->num_pages() - 1;
+    expected.clear();
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      const bool selected = i < offset_index->page_num_rows(0, kNumRows) ||
+                            i >= locations_b[last_page].first_row_index;
+      if (selected && b_def_levels_[i] == 1) {
+        expected.push_back(-i);
+      }
+    }
+    ASSERT_EQ(expected, ReadValues(1, row_group->GetColumnPageReader(1, {0, last_page})));
+
+    // Page indexes were disabled for the last column
+    ASSERT_EQ(nullptr, row_group->GetColumnOffsetIndex(2));
+    ASSERT_EQ(nullptr, row_group->GetColumnIndex(2));
+    ASSERT_THROW(row_group->GetColumnPageReader(2, {0}), ParquetException);
+    ASSERT_EQ(a_values_, ReadValues(2, row_group->GetColumnPageReader(2)));
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(BufferedRowGroup, TestPageIndex, ::testing::Bool());
+
+// ----------------------------------------------------------------------
+// Dictionary sampling
+
+class TestDictionarySampling : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestDictionarySampling, RejectedColumnsStayPlain) {
+  const bool buffered_row_group = GetParam();
+  constexpr int kNumRows = 4000;
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("distinct", Repetition::REQUIRED, Type::INT64),
+       PrimitiveNode::Make("repeated", Repetition::REQUIRED, Type::INT64)}));
+  auto properties = WriterProperties::Builder()
+                        .dictionary_sample_size(1000)
+                        ->write_batch_size(256)
+                        ->build();
+
+  std::vector<std::vector<int64_t>> values(4, std::vector<int64_t>(kNumRows));
+  for (int rg = 0; rg < 2; ++rg) {
+    for (int i = 0; i < kNumRows; ++i) {
+      values[2 * rg][i] = rg * kNumRows + i;
+      values[2 * rg + 1][i] = i % 10;
+    }
+  }
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  for (int rg = 0; rg < 2; ++rg) {
+    RowGroupWriter* row_group_writer = buffered_row_group
+                                           ? file_writer->AppendBufferedRowGroup()
+                                           : file_writer->AppendRowGroup();
+    for (int col = 0; col < 2; ++col) {
+      auto column_writer =
+          static_cast<Int64Writer*>(buffered_row_group ? row_group_writer->column(col)
+                                                       : row_group_writer->NextColumn());
+      column_writer->WriteBatch(kNumRows, nullptr, nullptr, values[2 * rg + col].data());
+      ASSERT_EQ(col == 0 && rg == 0, column_writer->dictionary_rejected());
+    }
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(sink->Finish(&buffer));
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  for (int rg = 0; rg < 2; ++rg) {
+    auto row_group = file_reader->RowGroup(rg);
+    // The distinct column falls back after its first 1000 values, whose dictionary
+    // is written, and is PLAIN encoded from the start of the next row group
+    ASSERT_EQ(rg == 0, row_group->metadata()->ColumnChunk(0)->has_dictionary_page());
+    ASSERT_TRUE(row_group->metadata()->ColumnChunk(1)->has_dictionary_page());
+    for (int col = 0; col < 2; ++col) {
+      auto reader = std::static_pointer_cast<Int64Reader>(row_group->Column(col));
+      std::vector<int64_t> read_values(kNumRows);
+      int64_t total_values_read = 0;
+      while (reader->HasNext()) {
+        int64_t values_read = 0;
+        reader->ReadBatch(kNumRows - total_values_read, nullptr, nullptr,
+                          read_values.data() + total_values_read, &values_read);
+        total_values_read += values_read;
+      }
+      ASSERT_EQ(kNumRows, total_values_read);
+      ASSERT_EQ(values[2 * rg + col], read_values);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(BufferedRowGroup, TestDictionarySampling, ::testing::Bool());
+
+// ----------------------------------------------------------------------
+// Adaptive compression
+
+class TestAdaptiveCompression : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestAdaptiveCompression, ChoiceIsReused) {
+  const bool buffered_row_group = GetParam();
+  constexpr int kNumRows = 10000;
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("adaptive", Repetition::REQUIRED, Type::INT64),
+       PrimitiveNode::Make("fixed", Repetition::REQUIRED, Type::INT64)}));
+  AdaptiveCompressionOptions options;
+  options.objective = AdaptiveCompressionOptions::SIZE;
+  // LZO isn't supported by Parquet and is skipped
+  options.candidates = {{Compression::LZO, Codec::UseDefaultCompressionLevel()},
+                        {Compression::SNAPPY, Codec::UseDefaultCompressionLevel()},
+                        {Compression::GZIP, 9}};
+  auto properties = WriterProperties::Builder()
+                        .compression(Compression::SNAPPY)
+                        ->disable_dictionary()
+                        ->enable_adaptive_compression("adaptive")
+                        ->adaptive_compression_options(options)
+                        ->build();
+
+  // Long runs, which GZIP compresses much better than SNAPPY
+  std::vector<int64_t> values(kNumRows);
+  for (int i = 0; i < kNumRows; ++i) {
+    values[i] = (i / 100) % 7;
+  }
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  for (int rg = 0; rg < 2; ++rg) {
+    RowGroupWriter* row_group_writer = buffered_row_group
+                                           ? file_writer->AppendBufferedRowGroup()
+                                           : file_writer->AppendRowGroup();
+    for (int col = 0; col < 2; ++col) {
+      auto column_writer =
+          static_cast<Int64Writer*>(buffered_row_group ? row_group_writer->column(col)
+                                                       : row_group_writer->NextColumn());
+      column_writer->WriteBatch(kNumRows, nullptr, nullptr, values.data());
+    }
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(sink->Finish(&buffer));
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  for (int rg = 0; rg < 2; ++rg) {
+    auto row_group = file_reader->RowGroup(rg);
+    ASSERT_EQ(Compression::GZIP, row_group->metadata()->ColumnChunk(0)->compression());
+    ASSERT_EQ(Compression::SNAPPY, row_group->metadata()->ColumnChunk(1)->compression());
+    for (int col = 0; col < 2; ++col) {
+      auto reader = std::static_pointer_cast<Int64Reader>(row_group->Column(col));
+      std::vector<int64_t> read_values(kNumRows);
+      int64_t values_read = 0;
+      reader->ReadBatch(kNumRows, nullptr, nullptr, read_values.data(), &values_read);
+      ASSERT_EQ(kNumRows, values_read);
+      ASSERT_EQ(values, read_values);
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(BufferedRowGroup, TestAdaptiveCompression, ::testing::Bool());
+
 }  // namespace test
 
 }  // namespace parquet
@@ -58,6 +58,10 @@ int64_t RowGroupWriter::total_compressed_bytes() const {
   return contents_->total_compressed_bytes();
 }
 
+int64_t RowGroupWriter::estimated_total_bytes() const {
+  return contents_->estimated_total_bytes();
+}
+
 int64_t RowGroupWriter::total_bytes_written() const {
   return contents_->total_bytes_written();
 }
@@ -80,12 +84,20 @@ inline void ThrowRowsMisMatchError(int col, int64_t prev, int64_t curr) {
 // RowGroupWriter::Contents implementation for the Parquet file specification
 class RowGroupSerializer : public RowGroupWriter::Contents {
  public:
+  // dictionary_rejected holds whether each column gave up dictionary encoding
+  // in a previous row group, see WriterProperties::dictionary_sample_size, and
+  // codec_choices the codec adaptive compression chose for each column
   RowGroupSerializer(const std::shared_ptr<ArrowOutputStream>& sink,
                      RowGroupMetaDataBuilder* metadata,
-                     const WriterProperties* properties, bool buffered_row_group = false)
+                     const WriterProperties* properties,
+                     std::vector<bool>* dictionary_rejected,
+                     std::vector<AdaptiveCodecChoice>* codec_choices,
+                     bool buffered_row_group = false)
       : sink_(sink),
         metadata_(metadata),
         properties_(properties),
+        dictionary_rejected_(dictionary_rejected),
+        codec_choices_(codec_choices),
         total_bytes_written_(0),
         closed_(false),
         next_column_index_(0),
@@ -120,16 +132,16 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     auto col_meta = metadata_->NextColumnChunk();
 
     if (column_writers_[0]) {
-      total_bytes_written_ += column_writers_[0]->Close();
+      total_bytes_written_ +=
+          CloseColumn(next_column_index_ - 1, column_writers_[0].get());
     }
 
     ++next_column_index_;
 
-    const auto& path = col_meta->descr()->path();
-    std::unique_ptr<PageWriter> pager = PageWriter::Open(
-        sink_, properties_->compression(path), properties_->compression_level(path),
-        col_meta, properties_->memory_pool());
-    column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
+    std::unique_ptr<PageWriter> pager =
+        OpenPageWriter(next_column_index_ - 1, col_meta, /*buffered_row_group=*/false);
+    column_writers_[0] =
+        MakeColumnWriter(next_column_index_ - 1, col_meta, std::move(pager));
     return column_writers_[0].get();
   }
 
@@ -157,6 +169,19 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     return total_compressed_bytes;
   }
 
+  int64_t estimated_total_bytes() const override {
+    // The bytes of the columns already closed, when written one at a time
+    int64_t estimated_bytes = total_bytes_written_;
+    for (const auto& column_writer : column_writers_) {
+      if (column_writer) {
+        estimated_bytes += column_writer->total_bytes_written() +
+                           column_writer->total_compressed_bytes() +
+                           column_writer->EstimatedBufferedValueBytes();
+      }
+    }
+    return estimated_bytes;
+  }
+
   int64_t total_bytes_written() const override {
     int64_t total_bytes_written = 0;
     for (size_t i = 0; i < column_writers_.size(); i++) {
@@ -174,7 +199,9 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
 
       for (size_t i = 0; i < column_writers_.size(); i++) {
         if (column_writers_[i]) {
-          total_bytes_written_ += column_writers_[i]->Close();
+          const int column = buffered_row_group_ ? static_cast<int>(i)
+                                                 : next_column_index_ - 1;
+          total_bytes_written_ += CloseColumn(column, column_writers_[i].get());
           column_writers_[i].reset();
         }
       }
@@ -191,6 +218,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   std::shared_ptr<ArrowOutputStream> sink_;
   mutable RowGroupMetaDataBuilder* metadata_;
   const WriterProperties* properties_;
+  std::vector<bool>* dictionary_rejected_;
+  std::vector<AdaptiveCodecChoice>* codec_choices_;
   int64_t total_bytes_written_;
   bool closed_;
   int next_column_index_;
@@ -219,15 +248,56 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     }
   }
 
+  std::shared_ptr<ColumnWriter> MakeColumnWriter(int column,
+                                                 ColumnChunkMetaDataBuilder* col_meta,
+                                                 std::unique_ptr<PageWriter> pager) {
+    return ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                              /*use_dictionary=*/!(*dictionary_rejected_)[column]);
+  }
+
+  int64_t CloseColumn(int column, ColumnWriter* writer) {
+    const int64_t bytes_written = writer->Close();
+    if (writer->dictionary_rejected()) {
+      (*dictionary_rejected_)[column] = true;
+    }
+    return bytes_written;
+  }
+
+  bool WritePageIndex(const ColumnDescriptor* descr) const {
+    return properties_->page_index_enabled(descr->path()) &&
+           descr->max_repetition_level() == 0;
+  }
+
+  std::unique_ptr<PageWriter> OpenPageWriter(int column,
+                                             ColumnChunkMetaDataBuilder* col_meta,
+                                             bool buffered_row_group) {
+    const auto& path = col_meta->descr()->path();
+    const bool write_page_index = WritePageIndex(col_meta->descr());
+    if (!properties_->adaptive_compression_enabled(path)) {
+      return PageWriter::Open(sink_, properties_->compression(path),
+                              properties_->compression_level(path), col_meta,
+                              properties_->memory_pool(), buffered_row_group,
+                              write_page_index);
+    }
+    AdaptiveCodecChoice* choice = &(*codec_choices_)[column];
+    if (choice->chosen) {
+      col_meta->SetCompression(choice->setting.codec);
+      return PageWriter::Open(sink_, choice->setting.codec,
+                              choice->setting.compression_level, col_meta,
+                              properties_->memory_pool(), buffered_row_group,
+                              write_page_index);
+    }
+    return PageWriter::OpenAdaptive(sink_, properties_->adaptive_compression_options(),
+                                    choice, col_meta, properties_->memory_pool(),
+                                    buffered_row_group, write_page_index);
+  }
+
   void InitColumns() {
     for (int i = 0; i < num_columns(); i++) {
       auto col_meta = metadata_->NextColumnChunk();
-      const auto& path = col_meta->descr()->path();
-      std::unique_ptr<PageWriter> pager = PageWriter::Open(
-          sink_, properties_->compression(path), properties_->compression_level(path),
-          col_meta, properties_->memory_pool(), buffered_row_group_);
-      column_writers_.push_back(
-          ColumnWriter::Make(col_meta, std::move(pager), properties_));
+      std::unique_ptr<PageWriter> pager =
+          OpenPageWriter(i, col_meta, buffered_row_group_);
+      column_writers_.push_back(MakeColumnWriter(i, col_meta, std::move(pager)));
     }
   }
 
@@ -286,8 +356,10 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
     num_row_groups_++;
     auto rg_metadata = metadata_->AppendRowGroup();
-    std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
-        sink_, rg_metadata, properties_.get(), buffered_row_group));
+    std::unique_ptr<RowGroupWriter::Contents> contents(
+        new RowGroupSerializer(sink_, rg_metadata, properties_.get(),
+                               &dictionary_rejected_, &codec_choices_,
+                               buffered_row_group));
     row_group_writer_.reset(new RowGroupWriter(std::move(contents)));
     return row_group_writer_.get();
   }
@@ -314,7 +386,9 @@ class FileSerializer : public ParquetFileWriter::Contents {
         properties_(properties),
         num_row_groups_(0),
         num_rows_(0),
-        metadata_(FileMetaDataBuilder::Make(&schema_, properties, key_value_metadata)) {
+        metadata_(FileMetaDataBuilder::Make(&schema_, properties, key_value_metadata)),
+        dictionary_rejected_(schema_.num_columns(), false),
+        codec_choices_(schema_.num_columns()) {
     StartFile();
   }
 
@@ -326,6 +400,10 @@ class FileSerializer : public ParquetFileWriter::Contents {
   std::unique_ptr<FileMetaDataBuilder> metadata_;
   // Only one of the row group writers is active at a time
   std::unique_ptr<RowGroupWriter> row_group_writer_;
+  // Per column, whether a previous row group gave up dictionary encoding
+  std::vector<bool> dictionary_rejected_;
+  // Per column, the codec chosen by adaptive compression in a previous row group
+  std::vector<AdaptiveCodecChoice> codec_choices_;
 
   void StartFile() {
     // Parquet files always start with PAR1
@@ -53,6 +53,8 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_bytes_written() const = 0;
     // total bytes still compressed but not written
     virtual int64_t total_compressed_bytes() const = 0;
+    // estimated size of the row group once closed
+    virtual int64_t estimated_total_bytes() const = 0;
   };
 
   explicit RowGroupWriter(std::unique_ptr<Contents> contents);
@@ -87,6 +89,11 @@ class PARQUET_EXPORT RowGroupWriter {
   int64_t total_bytes_written() const;
   int64_t total_compressed_bytes() const;
 
+  /// \brief Estimated size of the column chunks of the row group: the pages
+  /// written, those buffered until the dictionary is written, and the
+  /// encoded values not in a page yet
+  int64_t estimated_total_bytes() const;
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
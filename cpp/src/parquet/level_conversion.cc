@@ -0,0 +1,146 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/level_conversion.h"
+
+#include <algorithm>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/sse_util.h"
+
+#include "parquet/exception.h"
+
+namespace parquet {
+namespace internal {
+
+namespace {
+
+// Levels are converted 64 at a time, one bitmap word per batch
+constexpr int64_t kLevelBatchSize = 64;
+
+// Classification of a batch of at most 64 levels: bit i of each mask is set
+// if levels[i] compares so to the maximum definition level
+struct LevelMasks {
+  uint64_t equal = 0;
+  uint64_t equal_minus_one = 0;
+  uint64_t greater = 0;
+};
+
+#if defined(ARROW_HAVE_SSE2)
+// Pack the results of comparing two vectors of 8 levels to 16 bits
+inline uint64_t MoveMask16(__m128i lo, __m128i hi) {
+  return static_cast<uint16_t>(_mm_movemask_epi8(_mm_packs_epi16(lo, hi)));
+}
+#endif
+
+LevelMasks ClassifyLevels(const int16_t* levels, int num_levels, int16_t max_level) {
+  LevelMasks masks;
+  int i = 0;
+#if defined(ARROW_HAVE_SSE2)
+  const __m128i max = _mm_set1_epi16(max_level);
+  const __m128i max_minus_one = _mm_set1_epi16(static_cast<int16_t>(max_level - 1));
+  for (; i + 16 <= num_levels; i += 16) {
+    const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(levels + i));
+    const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(levels + i + 8));
+    masks.equal |= MoveMask16(_mm_cmpeq_epi16(lo, max), _mm_cmpeq_epi16(hi, max)) << i;
+    masks.equal_minus_one |= MoveMask16(_mm_cmpeq_epi16(lo, max_minus_one),
+                                        _mm_cmpeq_epi16(hi, max_minus_one))
+                             << i;
+    masks.greater |= MoveMask16(_mm_cmpgt_epi16(lo, max), _mm_cmpgt_epi16(hi, max))
+                     << i;
+  }
+#endif
+  for (; i < num_levels; ++i) {
+    const uint64_t bit = static_cast<uint64_t>(1) << i;
+    if (levels[i] == max_level) {
+      masks.equal |= bit;
+    } else if (levels[i] == max_level - 1) {
+      masks.equal_minus_one |= bit;
+    } else if (levels[i] > max_level) {
+      masks.greater |= bit;
+    }
+  }
+  return masks;
+}
+
+// Convert levels one by one. With repetition levels, levels below
+// max_definition_level - 1 and above max_definition_level have no slot
+int64_t RepeatedDefinitionLevelsToBitmap(const int16_t* def_levels,
+                                         int64_t num_def_levels,
+                                         const int16_t max_definition_level,
+                                         int64_t* null_count, uint8_t* valid_bits,
+                                         int64_t valid_bits_offset) {
+  ::arrow::internal::BitmapWriter valid_bits_writer(valid_bits, valid_bits_offset,
+                                                    num_def_levels);
+  for (int64_t i = 0; i < num_def_levels; ++i) {
+    if (def_levels[i] == max_definition_level) {
+      valid_bits_writer.Set();
+    } else if (def_levels[i] == max_definition_level - 1) {
+      valid_bits_writer.Clear();
+      *null_count += 1;
+    } else {
+      continue;
+    }
+    valid_bits_writer.Next();
+  }
+  valid_bits_writer.Finish();
+  return valid_bits_writer.position();
+}
+
+}  // namespace
+
+void DefinitionLevelsToBitmap(const int16_t* def_levels, int64_t num_def_levels,
+                              const int16_t max_definition_level,
+                              const int16_t max_repetition_level, int64_t* values_read,
+                              int64_t* null_count, uint8_t* valid_bits,
+                              int64_t valid_bits_offset) {
+  // We assume here that valid_bits is large enough to accommodate the
+  // additional definition levels and the ones that have already been written
+  int64_t num_slots = 0;
+  for (int64_t i = 0; i < num_def_levels; i += kLevelBatchSize) {
+    const int batch_size =
+        static_cast<int>(std::min(kLevelBatchSize, num_def_levels - i));
+    const LevelMasks masks =
+        ClassifyLevels(def_levels + i, batch_size, max_definition_level);
+
+    if (max_repetition_level == 0) {
+      // Every level is a slot, null if below the maximum
+      if (ARROW_PREDICT_FALSE(masks.greater != 0)) {
+        throw ParquetException("definition level exceeds maximum");
+      }
+    } else {
+      const uint64_t all_levels = batch_size == kLevelBatchSize
+                                      ? ~static_cast<uint64_t>(0)
+                                      : (static_cast<uint64_t>(1) << batch_size) - 1;
+      if ((masks.equal | masks.equal_minus_one) != all_levels) {
+        // Some levels belong to empty or null lists and have no slot
+        num_slots += RepeatedDefinitionLevelsToBitmap(
+            def_levels + i, batch_size, max_definition_level, null_count, valid_bits,
+            valid_bits_offset + num_slots);
+        continue;
+      }
+    }
+    ::arrow::BitUtil::SetBitsFromWord(valid_bits, valid_bits_offset + num_slots,
+                                      batch_size, masks.equal);
+    *null_count += batch_size - ::arrow::BitUtil::PopCount(masks.equal);
+    num_slots += batch_size;
+  }
+  *values_read = num_slots;
+}
+
+}  // namespace internal
+}  // namespace parquet
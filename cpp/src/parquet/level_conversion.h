@@ -0,0 +1,47 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Conversion of definition levels to Arrow validity bitmaps
+
+#pragma once
+
+#include <cstdint>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+namespace internal {
+
+/// \brief Write the slots of the given definition levels to a validity
+/// bitmap, starting at bit valid_bits_offset.
+///
+/// Without repetition levels every level is a slot, which is valid if the
+/// level is max_definition_level and null otherwise. With repetition levels,
+/// levels below max_definition_level - 1 belong to empty or null lists and
+/// have no slot.
+///
+/// \param[out] values_read number of slots written, including nulls
+/// \param[in,out] null_count incremented by the number of null slots
+PARQUET_EXPORT
+void DefinitionLevelsToBitmap(const int16_t* def_levels, int64_t num_def_levels,
+                              const int16_t max_definition_level,
+                              const int16_t max_repetition_level, int64_t* values_read,
+                              int64_t* null_count, uint8_t* valid_bits,
+                              int64_t valid_bits_offset);
+
+}  // namespace internal
+}  // namespace parquet
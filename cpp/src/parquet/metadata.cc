@@ -172,6 +172,11 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return is_stats_set() ? possible_stats_ : nullptr;
   }
 
+  inline bool is_null_count_set() const {
+    return column_->meta_data.__isset.statistics &&
+           column_->meta_data.statistics.__isset.null_count;
+  }
+
   inline Compression::type compression() const {
     return FromThrift(column_->meta_data.codec);
   }
@@ -196,6 +201,26 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_->meta_data.index_page_offset;
   }
 
+  inline bool has_bloom_filter() const {
+    return column_->meta_data.__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_->meta_data.bloom_filter_offset;
+  }
+
+  inline bool has_column_index() const { return column_->__isset.column_index_offset; }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const { return column_->__isset.offset_index_offset; }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
   inline int64_t total_compressed_size() const {
     return column_->meta_data.total_compressed_size;
   }
@@ -247,6 +272,10 @@ std::shared_ptr<Statistics> ColumnChunkMetaData::statistics() const {
 
 bool ColumnChunkMetaData::is_stats_set() const { return impl_->is_stats_set(); }
 
+bool ColumnChunkMetaData::is_null_count_set() const {
+  return impl_->is_null_count_set();
+}
+
 bool ColumnChunkMetaData::has_dictionary_page() const {
   return impl_->has_dictionary_page();
 }
@@ -265,6 +294,32 @@ int64_t ColumnChunkMetaData::index_page_offset() const {
   return impl_->index_page_offset();
 }
 
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
 Compression::type ColumnChunkMetaData::compression() const {
   return impl_->compression();
 }
@@ -660,6 +715,24 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(ToThrift(val));
   }
 
+  void SetBloomFilterOffset(int64_t offset) {
+    column_chunk_->meta_data.__set_bloom_filter_offset(offset);
+  }
+
+  void SetColumnIndexLocation(int64_t offset, int32_t length) {
+    column_chunk_->__set_column_index_offset(offset);
+    column_chunk_->__set_column_index_length(length);
+  }
+
+  void SetOffsetIndexLocation(int64_t offset, int32_t length) {
+    column_chunk_->__set_offset_index_offset(offset);
+    column_chunk_->__set_offset_index_length(length);
+  }
+
+  void SetCompression(Compression::type codec) {
+    column_chunk_->meta_data.__set_codec(ToThrift(codec));
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -775,6 +848,22 @@ void ColumnChunkMetaDataBuilder::SetStatistics(const EncodedStatistics& result)
   impl_->SetStatistics(result);
 }
 
+void ColumnChunkMetaDataBuilder::SetBloomFilterOffset(int64_t offset) {
+  impl_->SetBloomFilterOffset(offset);
+}
+
+void ColumnChunkMetaDataBuilder::SetColumnIndexLocation(int64_t offset, int32_t length) {
+  impl_->SetColumnIndexLocation(offset, length);
+}
+
+void ColumnChunkMetaDataBuilder::SetOffsetIndexLocation(int64_t offset, int32_t length) {
+  impl_->SetOffsetIndexLocation(offset, length);
+}
+
+void ColumnChunkMetaDataBuilder::SetCompression(Compression::type codec) {
+  impl_->SetCompression(codec);
+}
+
 class RowGroupMetaDataBuilder::RowGroupMetaDataBuilderImpl {
  public:
   explicit RowGroupMetaDataBuilderImpl(const std::shared_ptr<WriterProperties>& props,
@@ -117,6 +117,9 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t num_values() const;
   std::shared_ptr<schema::ColumnPath> path_in_schema() const;
   bool is_stats_set() const;
+  // Whether the statistics record the null count. Older writers omit it, in
+  // which case statistics()->null_count() reads as 0.
+  bool is_null_count_set() const;
   std::shared_ptr<Statistics> statistics() const;
   Compression::type compression() const;
   const std::vector<Encoding::type>& encodings() const;
@@ -125,6 +128,14 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t data_page_offset() const;
   bool has_index_page() const;
   int64_t index_page_offset() const;
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
 
@@ -227,6 +238,13 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(const EncodedStatistics& stats);
+  // file offset of the column chunk's Bloom filter
+  void SetBloomFilterOffset(int64_t offset);
+  // file locations of the column chunk's page indexes
+  void SetColumnIndexLocation(int64_t offset, int32_t length);
+  void SetOffsetIndexLocation(int64_t offset, int32_t length);
+  // codec of the column chunk's pages, if not the one of the writer properties
+  void SetCompression(Compression::type codec);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
   // commit the metadata
@@ -0,0 +1,207 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/thrift.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+OffsetIndex::OffsetIndex(std::vector<PageLocation> page_locations)
+    : page_locations_(std::move(page_locations)) {}
+
+std::shared_ptr<OffsetIndex> OffsetIndex::Make(const uint8_t* serialized,
+                                               uint32_t length) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(serialized, &length, &offset_index);
+
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  for (const format::PageLocation& location : offset_index.page_locations) {
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::make_shared<OffsetIndex>(std::move(page_locations));
+}
+
+int64_t OffsetIndex::page_num_rows(int i, int64_t row_group_num_rows) const {
+  const int64_t next_first_row = i + 1 < num_pages()
+                                     ? page_locations_[i + 1].first_row_index
+                                     : row_group_num_rows;
+  return next_first_row - page_locations_[i].first_row_index;
+}
+
+std::vector<int> OffsetIndex::PagesInRowRange(int64_t first_row, int64_t num_rows) const {
+  std::vector<int> pages;
+  const int64_t end_row = first_row + num_rows;
+  for (int i = 0; i < num_pages(); i++) {
+    if (page_locations_[i].first_row_index >= end_row) {
+      break;
+    }
+    if (i + 1 < num_pages() && page_locations_[i + 1].first_row_index <= first_row) {
+      continue;
+    }
+    pages.push_back(i);
+  }
+  return pages;
+}
+
+void OffsetIndex::WriteTo(ArrowOutputStream* sink) const {
+  format::OffsetIndex offset_index;
+  offset_index.page_locations.reserve(page_locations_.size());
+  for (const PageLocation& location : page_locations_) {
+    format::PageLocation thrift_location;
+    thrift_location.__set_offset(location.offset);
+    thrift_location.__set_compressed_page_size(location.compressed_page_size);
+    thrift_location.__set_first_row_index(location.first_row_index);
+    offset_index.page_locations.push_back(thrift_location);
+  }
+  ThriftSerializer serializer;
+  serializer.Serialize(&offset_index, sink);
+}
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+ColumnIndex::ColumnIndex(const ColumnDescriptor* descr, std::vector<bool> null_pages,
+                         std::vector<std::string> min_values,
+                         std::vector<std::string> max_values,
+                         std::vector<int64_t> null_counts)
+    : descr_(descr),
+      null_pages_(std::move(null_pages)),
+      min_values_(std::move(min_values)),
+      max_values_(std::move(max_values)),
+      null_counts_(std::move(null_counts)) {}
+
+std::shared_ptr<ColumnIndex> ColumnIndex::Make(const ColumnDescriptor* descr,
+                                               const uint8_t* serialized,
+                                               uint32_t length) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(serialized, &length, &column_index);
+
+  const size_t num_pages = column_index.null_pages.size();
+  if (column_index.min_values.size() != num_pages ||
+      column_index.max_values.size() != num_pages ||
+      (column_index.__isset.null_counts && column_index.null_counts.size() != num_pages)) {
+    throw ParquetException("Corrupt ColumnIndex: lists have different lengths");
+  }
+  std::vector<int64_t> null_counts;
+  if (column_index.__isset.null_counts) {
+    null_counts = std::move(column_index.null_counts);
+  }
+  return std::make_shared<ColumnIndex>(
+      descr, std::move(column_index.null_pages), std::move(column_index.min_values),
+      std::move(column_index.max_values), std::move(null_counts));
+}
+
+std::shared_ptr<Statistics> ColumnIndex::page_statistics(int i,
+                                                          ::arrow::MemoryPool* pool) const {
+  const bool is_null_page = null_pages_[i];
+  int64_t null_count = 0;
+  if (has_null_counts()) {
+    null_count = null_counts_[i];
+  } else if (is_null_page) {
+    null_count = 1;
+  }
+  return Statistics::Make(descr_, min_values_[i], max_values_[i],
+                          /*num_values=*/is_null_page ? 0 : 1, null_count,
+                          /*distinct_count=*/0, /*has_min_max=*/!is_null_page, pool);
+}
+
+void ColumnIndex::WriteTo(ArrowOutputStream* sink) const {
+  format::ColumnIndex column_index;
+  column_index.__set_null_pages(null_pages_);
+  column_index.__set_min_values(min_values_);
+  column_index.__set_max_values(max_values_);
+  column_index.__set_boundary_order(format::BoundaryOrder::UNORDERED);
+  if (has_null_counts()) {
+    column_index.__set_null_counts(null_counts_);
+  }
+  ThriftSerializer serializer;
+  serializer.Serialize(&column_index, sink);
+}
+
+// ----------------------------------------------------------------------
+// PageIndexBuilder
+
+PageIndexBuilder::PageIndexBuilder(const ColumnDescriptor* descr)
+    : descr_(descr),
+      has_column_index_(descr->sort_order() != SortOrder::UNKNOWN),
+      has_null_counts_(true) {}
+
+void PageIndexBuilder::AddPage(int64_t offset, int32_t compressed_page_size,
+                               int64_t first_row_index, int32_t num_values,
+                               const EncodedStatistics& page_statistics) {
+  page_locations_.push_back({offset, compressed_page_size, first_row_index});
+  if (!has_column_index_) {
+    return;
+  }
+
+  const bool is_null_page =
+      page_statistics.has_null_count && page_statistics.null_count == num_values;
+  if (!is_null_page && !(page_statistics.has_min && page_statistics.has_max)) {
+    has_column_index_ = false;
+    return;
+  }
+  null_pages_.push_back(is_null_page);
+  min_values_.push_back(is_null_page ? std::string() : page_statistics.min());
+  max_values_.push_back(is_null_page ? std::string() : page_statistics.max());
+  has_null_counts_ = has_null_counts_ && page_statistics.has_null_count;
+  null_counts_.push_back(page_statistics.null_count);
+}
+
+void PageIndexBuilder::WriteTo(ArrowOutputStream* sink, int64_t base_offset,
+                               ColumnChunkMetaDataBuilder* metadata) const {
+  if (page_locations_.empty()) {
+    return;
+  }
+
+  int64_t start_pos = -1;
+  int64_t end_pos = -1;
+  if (has_column_index_) {
+    ColumnIndex column_index(descr_, null_pages_, min_values_, max_values_,
+                             has_null_counts_ ? null_counts_ : std::vector<int64_t>());
+    PARQUET_THROW_NOT_OK(sink->Tell(&start_pos));
+    column_index.WriteTo(sink);
+    PARQUET_THROW_NOT_OK(sink->Tell(&end_pos));
+    metadata->SetColumnIndexLocation(base_offset + start_pos,
+                                     static_cast<int32_t>(end_pos - start_pos));
+  }
+
+  std::vector<PageLocation> page_locations = page_locations_;
+  for (PageLocation& location : page_locations) {
+    location.offset += base_offset;
+  }
+  OffsetIndex offset_index(std::move(page_locations));
+  PARQUET_THROW_NOT_OK(sink->Tell(&start_pos));
+  offset_index.WriteTo(sink);
+  PARQUET_THROW_NOT_OK(sink->Tell(&end_pos));
+  metadata->SetOffsetIndexLocation(base_offset + start_pos,
+                                   static_cast<int32_t>(end_pos - start_pos));
+}
+
+}  // namespace parquet
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Page-level indexes of a column chunk (ColumnIndex and OffsetIndex in the
+// Parquet format), used to locate and skip individual data pages
+
+#ifndef PARQUET_PAGE_INDEX_H
+#define PARQUET_PAGE_INDEX_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+#include "parquet/types.h"
+
+namespace parquet {
+
+class ColumnChunkMetaDataBuilder;
+class ColumnDescriptor;
+class EncodedStatistics;
+class Statistics;
+
+/// \brief Location of a data page in the file
+struct PARQUET_EXPORT PageLocation {
+  /// File offset of the page header
+  int64_t offset;
+  /// Size of the page, including its header
+  int32_t compressed_page_size;
+  /// Index within the row group of the first row of the page
+  int64_t first_row_index;
+};
+
+/// \brief The OffsetIndex of a column chunk, locating each of its data pages
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  explicit OffsetIndex(std::vector<PageLocation> page_locations);
+
+  /// \brief Deserialize an OffsetIndex from the bytes stored in the file
+  static std::shared_ptr<OffsetIndex> Make(const uint8_t* serialized, uint32_t length);
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  /// \brief The number of rows in page i of a row group with the given number
+  /// of rows
+  int64_t page_num_rows(int i, int64_t row_group_num_rows) const;
+
+  /// \brief The indices of the pages holding any of the rows in
+  /// [first_row, first_row + num_rows)
+  std::vector<int> PagesInRowRange(int64_t first_row, int64_t num_rows) const;
+
+  void WriteTo(ArrowOutputStream* sink) const;
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+/// \brief The ColumnIndex of a column chunk, holding the plain-encoded min
+/// and max values and the null count of each of its data pages
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  ColumnIndex(const ColumnDescriptor* descr, std::vector<bool> null_pages,
+              std::vector<std::string> min_values, std::vector<std::string> max_values,
+              std::vector<int64_t> null_counts);
+
+  /// \brief Deserialize a ColumnIndex from the bytes stored in the file
+  static std::shared_ptr<ColumnIndex> Make(const ColumnDescriptor* descr,
+                                           const uint8_t* serialized, uint32_t length);
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  /// \brief Whether page i only holds nulls, in which case it has no min and
+  /// max values
+  bool null_page(int i) const { return null_pages_[i]; }
+
+  const std::string& encoded_min(int i) const { return min_values_[i]; }
+  const std::string& encoded_max(int i) const { return max_values_[i]; }
+
+  bool has_null_counts() const { return !null_counts_.empty(); }
+  int64_t null_count(int i) const { return null_counts_[i]; }
+
+  /// \brief The statistics of page i, e.g. for RowGroupFilter::MayMatch.
+  ///
+  /// The index doesn't record how many values a page holds, so num_values()
+  /// is 0 for pages holding only nulls and 1 otherwise
+  std::shared_ptr<Statistics> page_statistics(
+      int i, ::arrow::MemoryPool* pool = ::arrow::default_memory_pool()) const;
+
+  void WriteTo(ArrowOutputStream* sink) const;
+
+ private:
+  const ColumnDescriptor* descr_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  std::vector<int64_t> null_counts_;
+};
+
+/// \brief Collects the page indexes of a column chunk while its data pages
+/// are written
+class PARQUET_EXPORT PageIndexBuilder {
+ public:
+  explicit PageIndexBuilder(const ColumnDescriptor* descr);
+
+  /// \brief Record a data page written at `offset`, holding `num_values`
+  /// levels
+  void AddPage(int64_t offset, int32_t compressed_page_size, int64_t first_row_index,
+               int32_t num_values, const EncodedStatistics& page_statistics);
+
+  /// \brief Write the ColumnIndex and OffsetIndex to the sink and record their
+  /// locations in the column chunk metadata. `base_offset` is added to all
+  /// positions, for sinks that are later copied into the file.
+  ///
+  /// The ColumnIndex is left out if a non-null page has no min or max value,
+  /// e.g. because they exceeded the maximum statistics size
+  void WriteTo(ArrowOutputStream* sink, int64_t base_offset,
+               ColumnChunkMetaDataBuilder* metadata) const;
+
+ private:
+  const ColumnDescriptor* descr_;
+  std::vector<PageLocation> page_locations_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> min_values_;
+  std::vector<std::string> max_values_;
+  std::vector<int64_t> null_counts_;
+  bool has_column_index_;
+  bool has_null_counts_;
+};
+
+}  // namespace parquet
+
+#endif  // PARQUET_PAGE_INDEX_H
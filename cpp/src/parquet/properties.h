@@ -18,10 +18,12 @@
 #ifndef PARQUET_COLUMN_PROPERTIES_H
 #define PARQUET_COLUMN_PROPERTIES_H
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "arrow/type.h"
 #include "arrow/util/compression.h"
@@ -47,6 +49,7 @@ class PARQUET_EXPORT ReaderProperties {
       : pool_(pool) {
     buffered_stream_enabled_ = DEFAULT_USE_BUFFERED_STREAM;
     buffer_size_ = DEFAULT_BUFFER_SIZE;
+    parallel_decompression_enabled_ = false;
   }
 
   MemoryPool* memory_pool() const { return pool_; }
@@ -64,10 +67,21 @@ class PARQUET_EXPORT ReaderProperties {
 
   int64_t buffer_size() const { return buffer_size_; }
 
+  /// Decompress the pages of each column chunk in parallel on the CPU thread
+  /// pool. Each column chunk is then held uncompressed in memory at once.
+  bool is_parallel_decompression_enabled() const {
+    return parallel_decompression_enabled_;
+  }
+
+  void enable_parallel_decompression() { parallel_decompression_enabled_ = true; }
+
+  void disable_parallel_decompression() { parallel_decompression_enabled_ = false; }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_;
   bool buffered_stream_enabled_;
+  bool parallel_decompression_enabled_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
@@ -75,16 +89,77 @@ ReaderProperties PARQUET_EXPORT default_reader_properties();
 static constexpr int64_t kDefaultDataPageSize = 1024 * 1024;
 static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
+static constexpr int64_t DEFAULT_DICTIONARY_SAMPLE_SIZE = 0;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES =
+    std::numeric_limits<int64_t>::max();
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr int32_t DEFAULT_BLOOM_FILTER_NDV = 1024 * 1024;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.05;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+static constexpr bool DEFAULT_IS_ADAPTIVE_COMPRESSION_ENABLED = false;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 
+/// \brief A compression codec and the level it compresses at
+struct PARQUET_EXPORT CodecSetting {
+  Compression::type codec;
+  int compression_level;
+};
+
+/// \brief How the writer chooses the codec of the columns for which adaptive
+/// compression is enabled
+///
+/// The first page of the first column chunk of such a column is trial
+/// compressed, up to sample_size bytes, with each of the candidates that are
+/// built, and the compressed sample is decompressed again to time it. The
+/// winner compresses the column chunk and the column chunks of the column
+/// in the later row groups.
+struct PARQUET_EXPORT AdaptiveCompressionOptions {
+  enum Objective {
+    /// The smallest compressed sample wins
+    SIZE,
+    /// The sample which is the fastest to decompress wins
+    DECOMPRESSION_SPEED,
+    /// The sample with the lowest weighted sum of its compressed size and
+    /// decompression time, each relative to the best one among the
+    /// candidates, wins
+    WEIGHTED
+  };
+
+  Objective objective = WEIGHTED;
+
+  /// The weight of the size in the WEIGHTED objective, in [0, 1]. The weight
+  /// of the decompression time is 1 - size_weight.
+  double size_weight = 0.5;
+
+  /// The maximum number of bytes of the first page which are trial compressed
+  int64_t sample_size = 1 << 20;
+
+  /// The codecs and levels to choose from. UNCOMPRESSED and the codecs which
+  /// are not built into this Arrow library are skipped; the column is not
+  /// compressed if no candidate is left.
+  std::vector<CodecSetting> candidates = {
+      {Compression::LZ4, ::arrow::util::kUseDefaultCompressionLevel},
+      {Compression::SNAPPY, ::arrow::util::kUseDefaultCompressionLevel},
+      {Compression::ZSTD, 1},
+      {Compression::ZSTD, 3},
+      {Compression::ZSTD, 9}};
+};
+
+/// \brief The codec which adaptive compression chose for a column, which
+/// the column chunks of the later row groups reuse
+struct PARQUET_EXPORT AdaptiveCodecChoice {
+  bool chosen = false;
+  CodecSetting setting;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -97,7 +172,12 @@ class PARQUET_EXPORT ColumnProperties {
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        compression_level_(Codec::UseDefaultCompressionLevel()) {}
+        compression_level_(Codec::UseDefaultCompressionLevel()),
+        bloom_filter_enabled_(DEFAULT_IS_BLOOM_FILTER_ENABLED),
+        bloom_filter_ndv_(DEFAULT_BLOOM_FILTER_NDV),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP),
+        page_index_enabled_(DEFAULT_IS_PAGE_INDEX_ENABLED),
+        adaptive_compression_enabled_(DEFAULT_IS_ADAPTIVE_COMPRESSION_ENABLED) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -119,6 +199,22 @@ class PARQUET_EXPORT ColumnProperties {
     compression_level_ = compression_level;
   }
 
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
+  void set_bloom_filter_ndv(int32_t ndv) { bloom_filter_ndv_ = ndv; }
+
+  void set_bloom_filter_fpp(double fpp) { bloom_filter_fpp_ = fpp; }
+
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
+  void set_adaptive_compression_enabled(bool adaptive_compression_enabled) {
+    adaptive_compression_enabled_ = adaptive_compression_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -131,6 +227,16 @@ class PARQUET_EXPORT ColumnProperties {
 
   int compression_level() const { return compression_level_; }
 
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
+  int32_t bloom_filter_ndv() const { return bloom_filter_ndv_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
+  bool page_index_enabled() const { return page_index_enabled_; }
+
+  bool adaptive_compression_enabled() const { return adaptive_compression_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -138,6 +244,11 @@ class PARQUET_EXPORT ColumnProperties {
   bool statistics_enabled_;
   size_t max_stats_size_;
   int compression_level_;
+  bool bloom_filter_enabled_;
+  int32_t bloom_filter_ndv_;
+  double bloom_filter_fpp_;
+  bool page_index_enabled_;
+  bool adaptive_compression_enabled_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -147,8 +258,10 @@ class PARQUET_EXPORT WriterProperties {
     Builder()
         : pool_(::arrow::default_memory_pool()),
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
+          dictionary_sample_size_(DEFAULT_DICTIONARY_SAMPLE_SIZE),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(kDefaultDataPageSize),
           version_(DEFAULT_WRITER_VERSION),
           created_by_(DEFAULT_CREATED_BY) {}
@@ -192,6 +305,17 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Number of values of a column chunk after which its writer estimates
+    /// whether dictionary encoding is smaller than PLAIN encoding, and falls
+    /// back to PLAIN if it is not, rather than hashing the rest of a column
+    /// of (nearly) distinct values until dictionary_pagesize_limit is reached.
+    /// The columns rejected so are PLAIN encoded in the later row groups of
+    /// the file.  0 (the default) disables the estimate.
+    Builder* dictionary_sample_size(int64_t dictionary_sample_size) {
+      dictionary_sample_size_ = dictionary_sample_size;
+      return this;
+    }
+
     Builder* write_batch_size(int64_t write_batch_size) {
       write_batch_size_ = write_batch_size;
       return this;
@@ -202,6 +326,16 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Target size of a row group, in encoded and compressed bytes.  The Arrow
+    /// writer closes a row group once the estimated size of its column chunks
+    /// reaches it, or, when writing a whole table column by column, sizes its
+    /// row groups from the in-memory size of the table's rows.  Unlimited by
+    /// default, so that only max_row_group_length applies.
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     Builder* data_pagesize(int64_t pg_size) {
       pagesize_ = pg_size;
       return this;
@@ -357,6 +491,130 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// Write a Bloom filter for each column chunk of every column, except
+    /// BOOLEAN columns. Bloom filters are disabled by default.
+    Builder* enable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(true);
+      return this;
+    }
+
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(false);
+      return this;
+    }
+
+    /// Write a Bloom filter for each column chunk of the column. The filter is
+    /// sized for `ndv` distinct values per column chunk at a false positive
+    /// probability of `fpp`, which must lie in (0, 1).
+    Builder* enable_bloom_filter(const std::string& path,
+                                 int32_t ndv = DEFAULT_BLOOM_FILTER_NDV,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      if (ndv <= 0) {
+        throw ParquetException("Bloom filter NDV must be positive");
+      }
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException("Bloom filter FPP must be in the range (0, 1)");
+      }
+      bloom_filter_enabled_[path] = true;
+      bloom_filter_ndv_[path] = ndv;
+      bloom_filter_fpp_[path] = fpp;
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 int32_t ndv = DEFAULT_BLOOM_FILTER_NDV,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      return this->enable_bloom_filter(path->ToDotString(), ndv, fpp);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// Write the ColumnIndex and OffsetIndex of each column chunk of every
+    /// column, so that readers can skip individual data pages. Only written
+    /// for non-repeated columns, whose pages always start at a row boundary.
+    /// Page indexes are disabled by default.
+    Builder* enable_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    Builder* enable_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_page_index(path->ToDotString());
+    }
+
+    Builder* disable_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_page_index(path->ToDotString());
+    }
+
+    /// Choose the codec and compression level of every column from the
+    /// candidates of the adaptive compression options, rather than using
+    /// the compression and compression_level set for the column. Adaptive
+    /// compression is disabled by default.
+    Builder* enable_adaptive_compression() {
+      default_column_properties_.set_adaptive_compression_enabled(true);
+      return this;
+    }
+
+    Builder* disable_adaptive_compression() {
+      default_column_properties_.set_adaptive_compression_enabled(false);
+      return this;
+    }
+
+    Builder* enable_adaptive_compression(const std::string& path) {
+      adaptive_compression_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_adaptive_compression(
+        const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_adaptive_compression(path->ToDotString());
+    }
+
+    Builder* disable_adaptive_compression(const std::string& path) {
+      adaptive_compression_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_adaptive_compression(
+        const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_adaptive_compression(path->ToDotString());
+    }
+
+    /// The candidates and objective of adaptive compression, see
+    /// AdaptiveCompressionOptions
+    Builder* adaptive_compression_options(const AdaptiveCompressionOptions& options) {
+      if (options.candidates.empty()) {
+        throw ParquetException("Adaptive compression needs at least one candidate");
+      }
+      if (!(options.size_weight >= 0.0 && options.size_weight <= 1.0)) {
+        throw ParquetException("Adaptive compression size weight must be in [0, 1]");
+      }
+      adaptive_compression_options_ = options;
+      return this;
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -375,21 +633,34 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
-
-      return std::shared_ptr<WriterProperties>(
-          new WriterProperties(pool_, dictionary_pagesize_limit_, write_batch_size_,
-                               max_row_group_length_, pagesize_, version_, created_by_,
-                               default_column_properties_, column_properties));
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
+      for (const auto& item : bloom_filter_ndv_)
+        get(item.first).set_bloom_filter_ndv(item.second);
+      for (const auto& item : bloom_filter_fpp_)
+        get(item.first).set_bloom_filter_fpp(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : adaptive_compression_enabled_)
+        get(item.first).set_adaptive_compression_enabled(item.second);
+
+      return std::shared_ptr<WriterProperties>(new WriterProperties(
+          pool_, dictionary_pagesize_limit_, dictionary_sample_size_, write_batch_size_,
+          max_row_group_length_, max_row_group_bytes_, pagesize_, version_, created_by_,
+          adaptive_compression_options_, default_column_properties_, column_properties));
     }
 
    private:
     MemoryPool* pool_;
     int64_t dictionary_pagesize_limit_;
+    int64_t dictionary_sample_size_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     std::string created_by_;
+    AdaptiveCompressionOptions adaptive_compression_options_;
 
     // Settings used for each column unless overridden in any of the maps below
     ColumnProperties default_column_properties_;
@@ -398,22 +669,35 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, int32_t> codecs_compression_level_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
+    std::unordered_map<std::string, int32_t> bloom_filter_ndv_;
+    std::unordered_map<std::string, double> bloom_filter_fpp_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, bool> adaptive_compression_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
 
   inline int64_t dictionary_pagesize_limit() const { return dictionary_pagesize_limit_; }
 
+  inline int64_t dictionary_sample_size() const { return dictionary_sample_size_; }
+
   inline int64_t write_batch_size() const { return write_batch_size_; }
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetVersion::type version() const { return parquet_version_; }
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  inline const AdaptiveCompressionOptions& adaptive_compression_options() const {
+    return adaptive_compression_options_;
+  }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -461,29 +745,59 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  int32_t bloom_filter_ndv(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_ndv();
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
+  bool adaptive_compression_enabled(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_compression_enabled();
+  }
+
  private:
   explicit WriterProperties(
-      MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
-      const std::string& created_by, const ColumnProperties& default_column_properties,
+      MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t dictionary_sample_size,
+      int64_t write_batch_size, int64_t max_row_group_length,
+      int64_t max_row_group_bytes, int64_t pagesize,
+      ParquetVersion::type version, const std::string& created_by,
+      const AdaptiveCompressionOptions& adaptive_compression_options,
+      const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
+        dictionary_sample_size_(dictionary_sample_size),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        adaptive_compression_options_(adaptive_compression_options),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
 
   MemoryPool* pool_;
   int64_t dictionary_pagesize_limit_;
+  int64_t dictionary_sample_size_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  AdaptiveCompressionOptions adaptive_compression_options_;
   ColumnProperties default_column_properties_;
   std::unordered_map<std::string, ColumnProperties> column_properties_;
 };
@@ -504,7 +818,11 @@ class PARQUET_EXPORT ArrowReaderProperties {
   explicit ArrowReaderProperties(bool use_threads = kArrowDefaultUseThreads)
       : use_threads_(use_threads),
         read_dict_indices_(),
-        batch_size_(kArrowDefaultBatchSize) {}
+        unify_dictionaries_(false),
+        batch_size_(kArrowDefaultBatchSize),
+        pre_buffer_(false),
+        zero_copy_reads_(false),
+        prefetch_row_groups_(0) {}
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
@@ -525,14 +843,57 @@ class PARQUET_EXPORT ArrowReaderProperties {
     }
   }
 
+  /// \brief Read columns set with set_read_dictionary as a single dictionary
+  /// array chunk, merging the dictionaries of all row groups into one instead
+  /// of starting a new chunk on each dictionary change. Disabled by default.
+  void set_unify_dictionaries(bool unify_dictionaries) {
+    unify_dictionaries_ = unify_dictionaries;
+  }
+
+  bool unify_dictionaries() const { return unify_dictionaries_; }
+
   void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
 
   int64_t batch_size() const { return batch_size_; }
 
+  /// \brief Enable read coalescing: before reading row groups, give the file
+  /// the byte ranges of all column chunks involved, so that it can prefetch
+  /// them with fewer, larger requests. Worthwhile on high-latency
+  /// filesystems such as S3; disabled by default.
+  void set_pre_buffer(bool pre_buffer) { pre_buffer_ = pre_buffer; }
+
+  bool pre_buffer() const { return pre_buffer_; }
+
+  /// \brief Read required top-level columns of fixed-width types that are
+  /// stored uncompressed and PLAIN-encoded as slices of their data pages,
+  /// giving one array chunk per page. When the source is zero-copy (e.g.
+  /// ::arrow::io::MemoryMappedFile or ::arrow::io::BufferReader) and buffered
+  /// streams are disabled, the values are not copied at all. The value buffers
+  /// are not necessarily aligned to the value width. Other columns are read
+  /// as usual. Disabled by default.
+  void set_zero_copy_reads(bool zero_copy_reads) { zero_copy_reads_ = zero_copy_reads; }
+
+  bool zero_copy_reads() const { return zero_copy_reads_; }
+
+  /// \brief Number of row groups following the one being read whose column
+  /// chunks a RecordBatchReader reads in the background on the I/O thread
+  /// pool, so that decoding overlaps with I/O. Up to this many row groups
+  /// beyond the current one are held in memory. 0 (the default) disables
+  /// prefetching.
+  void set_prefetch_row_groups(int prefetch_row_groups) {
+    prefetch_row_groups_ = prefetch_row_groups;
+  }
+
+  int prefetch_row_groups() const { return prefetch_row_groups_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
+  bool unify_dictionaries_;
   int64_t batch_size_;
+  bool pre_buffer_;
+  bool zero_copy_reads_;
+  int prefetch_row_groups_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -548,7 +909,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
           coerce_timestamps_enabled_(false),
           coerce_timestamps_unit_(::arrow::TimeUnit::SECOND),
           truncated_timestamps_allowed_(false),
-          store_schema_(false) {}
+          store_schema_(false),
+          use_threads_(false) {}
     virtual ~Builder() {}
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -585,10 +947,18 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Encode and compress the column chunks of each row group written
+    /// by WriteTable in parallel. The chunks are buffered in memory and
+    /// written to the sink in schema order when the row group is closed
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
-          truncated_timestamps_allowed_, store_schema_));
+          truncated_timestamps_allowed_, store_schema_, use_threads_));
     }
 
    private:
@@ -599,6 +969,7 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool truncated_timestamps_allowed_;
 
     bool store_schema_;
+    bool use_threads_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -612,22 +983,27 @@ class PARQUET_EXPORT ArrowWriterProperties {
 
   bool store_schema() const { return store_schema_; }
 
+  bool use_threads() const { return use_threads_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
-                                 bool truncated_timestamps_allowed, bool store_schema)
+                                 bool truncated_timestamps_allowed, bool store_schema,
+                                 bool use_threads)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
         truncated_timestamps_allowed_(truncated_timestamps_allowed),
-        store_schema_(store_schema) {}
+        store_schema_(store_schema),
+        use_threads_(use_threads) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
   const ::arrow::TimeUnit::type coerce_timestamps_unit_;
   const bool truncated_timestamps_allowed_;
   const bool store_schema_;
+  const bool use_threads_;
 };
 
 /// \brief State object used for writing Arrow data directly to a Parquet
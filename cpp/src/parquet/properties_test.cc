@@ -65,6 +65,32 @@ TEST(TestWriterProperties, AdvancedHandling) {
             props->encoding(ColumnPath::FromDotString("delta-length")));
 }
 
+TEST(TestWriterProperties, BloomFilter) {
+  WriterProperties::Builder builder;
+  builder.enable_bloom_filter("id");
+  builder.enable_bloom_filter("key", 1000, 0.01);
+  std::shared_ptr<WriterProperties> props = builder.build();
+
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("other")));
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("id")));
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_NDV,
+            props->bloom_filter_ndv(ColumnPath::FromDotString("id")));
+  ASSERT_EQ(DEFAULT_BLOOM_FILTER_FPP,
+            props->bloom_filter_fpp(ColumnPath::FromDotString("id")));
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("key")));
+  ASSERT_EQ(1000, props->bloom_filter_ndv(ColumnPath::FromDotString("key")));
+  ASSERT_EQ(0.01, props->bloom_filter_fpp(ColumnPath::FromDotString("key")));
+
+  builder.enable_bloom_filter();
+  builder.disable_bloom_filter("id");
+  props = builder.build();
+  ASSERT_TRUE(props->bloom_filter_enabled(ColumnPath::FromDotString("other")));
+  ASSERT_FALSE(props->bloom_filter_enabled(ColumnPath::FromDotString("id")));
+
+  ASSERT_THROW(builder.enable_bloom_filter("key", 1000, 1.0), ParquetException);
+  ASSERT_THROW(builder.enable_bloom_filter("key", 0), ParquetException);
+}
+
 TEST(TestReaderProperties, GetStreamInsufficientData) {
   // ARROW-6058
   std::string data = "shorter than expected";
@@ -213,6 +213,38 @@ TEST_F(TestLocalFile, OpenWithMetadata) {
   ASSERT_EQ(metadata.get(), reader2->metadata().get());
 }
 
+TEST_F(TestLocalFile, FileMetaDataCache) {
+  std::shared_ptr<FileMetaData> metadata = ReadMetaData(handle);
+  const std::string path = alltypes_plain();
+
+  FileMetaDataCache cache(2);
+  ASSERT_EQ(nullptr, cache.Get(path, 100, 1));
+  cache.Put(path, 100, 1, metadata);
+  ASSERT_EQ(metadata.get(), cache.Get(path, 100, 1).get());
+  // A file of another size or modification time doesn't match the entry,
+  // which is replaced by the next Put for its path
+  ASSERT_EQ(nullptr, cache.Get(path, 101, 1));
+  ASSERT_EQ(nullptr, cache.Get(path, 100, 2));
+  std::shared_ptr<FileMetaData> other_metadata = ReadMetaData(handle);
+  cache.Put(path, 100, 2, other_metadata);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(nullptr, cache.Get(path, 100, 1));
+  ASSERT_EQ(other_metadata.get(), cache.Get(path, 100, 2).get());
+
+  // The least recently used entry is evicted
+  cache.Put("a", 100, 1, metadata);
+  ASSERT_NE(nullptr, cache.Get(path, 100, 2));
+  cache.Put("b", 100, 1, metadata);
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(nullptr, cache.Get("a", 100, 1));
+  ASSERT_NE(nullptr, cache.Get(path, 100, 2));
+  ASSERT_NE(nullptr, cache.Get("b", 100, 1));
+
+  cache.Clear();
+  ASSERT_EQ(0, cache.size());
+  ASSERT_EQ(nullptr, cache.Get("b", 100, 1));
+}
+
 TEST(TestFileReaderAdHoc, NationDictTruncatedDataPage) {
   // PARQUET-816. Some files generated by older Parquet implementations may
   // contain malformed data page metadata, and we can successfully decode them
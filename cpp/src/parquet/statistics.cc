@@ -22,8 +22,10 @@
 
 #include "arrow/array.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/min_max.h"
 
 #include "parquet/encoding.h"
 #include "parquet/exception.h"
@@ -130,6 +132,34 @@ struct CompareHelper<FLBAType, false> {
   }
 };
 
+// The numeric types whose min and max are computed by the vectorized loops
+// of arrow/util/min_max.h, over values reinterpreted as CType: unsigned for
+// the unsigned sort order
+template <typename DType, bool is_signed>
+struct NumericMinMax : std::false_type {
+  using CType = typename DType::c_type;
+};
+
+template <bool is_signed>
+struct NumericMinMax<Int32Type, is_signed> : std::true_type {
+  using CType = typename std::conditional<is_signed, int32_t, uint32_t>::type;
+};
+
+template <bool is_signed>
+struct NumericMinMax<Int64Type, is_signed> : std::true_type {
+  using CType = typename std::conditional<is_signed, int64_t, uint64_t>::type;
+};
+
+template <>
+struct NumericMinMax<FloatType, true> : std::true_type {
+  using CType = float;
+};
+
+template <>
+struct NumericMinMax<DoubleType, true> : std::true_type {
+  using CType = double;
+};
+
 template <bool is_signed, typename DType>
 class TypedComparatorImpl : virtual public TypedComparator<DType> {
  public:
@@ -144,6 +174,48 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
   bool Compare(const T& a, const T& b) override { return CompareInline(a, b); }
 
   void GetMinMax(const T* values, int64_t length, T* out_min, T* out_max) override {
+    GetMinMax(values, length, out_min, out_max, NumericMinMax<DType, is_signed>());
+  }
+
+  void GetMinMaxSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
+                       int64_t valid_bits_offset, T* out_min, T* out_max) override {
+    GetMinMaxSpaced(values, length, valid_bits, valid_bits_offset, out_min, out_max,
+                    NumericMinMax<DType, is_signed>());
+  }
+
+  void GetMinMax(const ::arrow::Array& values, T* out_min, T* out_max) override;
+
+ private:
+  using CType = typename NumericMinMax<DType, is_signed>::CType;
+
+  // Numeric types.  NaN values are skipped: the callers ensure there is at
+  // least another value.
+
+  void GetMinMax(const T* values, int64_t length, T* out_min, T* out_max,
+                 std::true_type) {
+    CType min = ::arrow::internal::MinMaxIdentity<CType>::min();
+    CType max = ::arrow::internal::MinMaxIdentity<CType>::max();
+    ::arrow::internal::DenseMinMax(reinterpret_cast<const CType*>(values), length, &min,
+                                   &max);
+    *out_min = static_cast<T>(min);
+    *out_max = static_cast<T>(max);
+  }
+
+  void GetMinMaxSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
+                       int64_t valid_bits_offset, T* out_min, T* out_max,
+                       std::true_type) {
+    CType min = ::arrow::internal::MinMaxIdentity<CType>::min();
+    CType max = ::arrow::internal::MinMaxIdentity<CType>::max();
+    ::arrow::internal::SpacedMinMax(reinterpret_cast<const CType*>(values), length,
+                                    valid_bits, valid_bits_offset, &min, &max);
+    *out_min = static_cast<T>(min);
+    *out_max = static_cast<T>(max);
+  }
+
+  // Other types, through CompareHelper
+
+  void GetMinMax(const T* values, int64_t length, T* out_min, T* out_max,
+                 std::false_type) {
     T min = values[0];
     T max = values[0];
     for (int64_t i = 1; i < length; i++) {
@@ -158,7 +230,8 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
   }
 
   void GetMinMaxSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
-                       int64_t valid_bits_offset, T* out_min, T* out_max) override {
+                       int64_t valid_bits_offset, T* out_min, T* out_max,
+                       std::false_type) {
     ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
                                                       length);
 
@@ -186,9 +259,6 @@ class TypedComparatorImpl : virtual public TypedComparator<DType> {
     *out_max = max;
   }
 
-  void GetMinMax(const ::arrow::Array& values, T* out_min, T* out_max) override;
-
- private:
   int type_length_;
 };
 
@@ -196,6 +266,26 @@ template <bool is_signed, typename DType>
 void TypedComparatorImpl<is_signed, DType>::GetMinMax(const ::arrow::Array& values,
                                                       typename DType::c_type* out_min,
                                                       typename DType::c_type* out_max) {
+  // Numeric arrays whose values have the physical type's representation are
+  // read directly, through their validity bitmap
+  const auto type_id = values.type_id();
+  if (NumericMinMax<DType, is_signed>::value && ::arrow::is_primitive(type_id) &&
+      type_id != ::arrow::Type::NA && type_id != ::arrow::Type::BOOL &&
+      type_id != ::arrow::Type::INTERVAL &&
+      ::arrow::is_floating(type_id) == std::is_floating_point<T>::value &&
+      checked_cast<const ::arrow::FixedWidthType&>(*values.type()).bit_width() ==
+          static_cast<int>(sizeof(T) * 8)) {
+    const auto& data = checked_cast<const ::arrow::PrimitiveArray&>(values);
+    const T* raw_values =
+        reinterpret_cast<const T*>(data.values()->data()) + data.offset();
+    if (data.null_count() == 0) {
+      GetMinMax(raw_values, data.length(), out_min, out_max);
+    } else {
+      GetMinMaxSpaced(raw_values, data.length(), data.null_bitmap_data(), data.offset(),
+                      out_min, out_max);
+    }
+    return;
+  }
   ParquetException::NYI(values.type()->ToString());
 }
 
@@ -448,13 +538,15 @@ class TypedStatisticsImpl : public TypedStatistics<DType> {
       return;
     }
 
-    StatsHelper<T> helper;
-    if (helper.CanHaveNaN()) {
-      ParquetException::NYI("No NaN handling for Arrow arrays yet");
-    }
-
     T batch_min, batch_max;
     comparator_->GetMinMax(values, &batch_min, &batch_max);
+    // PARQUET-1225: NaN values are skipped, so if there are only NaN values
+    // the extrema are left inverted; as in UpdateSpaced, min and max are then
+    // not set
+    StatsHelper<T> helper;
+    if (helper.CanHaveNaN() && comparator_->Compare(batch_max, batch_min)) {
+      return;
+    }
     SetMinMax(batch_min, batch_max);
   }
 
@@ -611,7 +703,7 @@ void TypedStatisticsImpl<DType>::UpdateSpaced(const T* values, const uint8_t* va
     }
 
     // All are NaNs and stats are not set yet
-    if ((i == length) && helper.IsNaN(values[i - 1])) {
+    if (i == length) {
       // Don't set has_min_max flag since
       // these values must be over-written by valid stats later
       if (!has_min_max_) {
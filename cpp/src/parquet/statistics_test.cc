@@ -19,12 +19,17 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
@@ -850,6 +855,80 @@ TEST(TestByteArrayStatisticsFromArrow, Basics) {
   ASSERT_EQ(ByteArray(typed_values.GetView(9)), stats->max());
 }
 
+TEST(TestNumericStatisticsFromArrow, Int32) {
+  auto values = ArrayFromJSON(::arrow::int32(), "[5, -3, null, 7, -10, null, 2]");
+
+  NodePtr node = PrimitiveNode::Make("field", Repetition::OPTIONAL, Type::INT32);
+  ColumnDescriptor descr(node, 1, 0);
+  auto stats = MakeStatistics<Int32Type>(&descr);
+  ASSERT_NO_FATAL_FAILURE(stats->Update(*values));
+  ASSERT_EQ(-10, stats->min());
+  ASSERT_EQ(7, stats->max());
+  ASSERT_EQ(2, stats->null_count());
+
+  // In the unsigned sort order, negative values are the largest
+  NodePtr unsigned_node = PrimitiveNode::Make("field", Repetition::OPTIONAL, Type::INT32,
+                                              ConvertedType::UINT_32);
+  ColumnDescriptor unsigned_descr(unsigned_node, 1, 0);
+  auto unsigned_stats = MakeStatistics<Int32Type>(&unsigned_descr);
+  ASSERT_NO_FATAL_FAILURE(unsigned_stats->Update(*values->Slice(1)));
+  ASSERT_EQ(2, unsigned_stats->min());
+  ASSERT_EQ(-3, unsigned_stats->max());
+}
+
+TEST(TestNumericStatisticsFromArrow, Sliced) {
+  ::arrow::random::RandomArrayGenerator rgen(42);
+  auto values = rgen.Int64(1000, -1000000, 1000000, 0.3);
+  NodePtr node = PrimitiveNode::Make("field", Repetition::OPTIONAL, Type::INT64);
+  ColumnDescriptor descr(node, 1, 0);
+
+  for (int64_t offset : {0, 3, 64, 131, 999}) {
+    const auto& slice =
+        static_cast<const ::arrow::Int64Array&>(*values->Slice(offset, 500));
+    int64_t min = std::numeric_limits<int64_t>::max();
+    int64_t max = std::numeric_limits<int64_t>::min();
+    for (int64_t i = 0; i < slice.length(); i++) {
+      if (slice.IsValid(i)) {
+        min = std::min(min, slice.Value(i));
+        max = std::max(max, slice.Value(i));
+      }
+    }
+
+    auto stats = MakeStatistics<Int64Type>(&descr);
+    ASSERT_NO_FATAL_FAILURE(stats->Update(slice));
+    ASSERT_EQ(slice.null_count(), stats->null_count());
+    ASSERT_EQ(slice.length() - slice.null_count(), stats->num_values());
+    if (slice.null_count() < slice.length()) {
+      ASSERT_TRUE(stats->HasMinMax());
+      ASSERT_EQ(min, stats->min());
+      ASSERT_EQ(max, stats->max());
+    }
+  }
+}
+
+TEST(TestNumericStatisticsFromArrow, DoubleNaN) {
+  ::arrow::DoubleBuilder builder;
+  ASSERT_OK(builder.Append(std::nan("")));
+  ASSERT_OK(builder.Append(1.5));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append(-2.5));
+  ASSERT_OK(builder.Append(std::nan("")));
+  std::shared_ptr<::arrow::Array> values;
+  ASSERT_OK(builder.Finish(&values));
+
+  NodePtr node = PrimitiveNode::Make("field", Repetition::OPTIONAL, Type::DOUBLE);
+  ColumnDescriptor descr(node, 1, 0);
+  auto stats = MakeStatistics<DoubleType>(&descr);
+  ASSERT_NO_FATAL_FAILURE(stats->Update(*values));
+  ASSERT_EQ(-2.5, stats->min());
+  ASSERT_EQ(1.5, stats->max());
+
+  // Only NaN values: no min and max
+  auto nan_stats = MakeStatistics<DoubleType>(&descr);
+  ASSERT_NO_FATAL_FAILURE(nan_stats->Update(*values->Slice(4, 1)));
+  ASSERT_FALSE(nan_stats->HasMinMax());
+}
+
 // Ensure UNKNOWN sort order is handled properly
 using TestStatisticsSortOrderFLBA = TestStatisticsSortOrder<FLBAType>;
 
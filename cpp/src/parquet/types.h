@@ -452,6 +452,7 @@ struct Encoding {
     DELTA_LENGTH_BYTE_ARRAY = 6,
     DELTA_BYTE_ARRAY = 7,
     RLE_DICTIONARY = 8,
+    BYTE_STREAM_SPLIT = 9,
     UNKNOWN = 999
   };
 };
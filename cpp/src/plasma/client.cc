@@ -23,6 +23,7 @@
 #include <Win32_Interop/win32_types.h>
 #endif
 
+#include <errno.h>
 #include <fcntl.h>
 #include <netinet/in.h>
 #include <stdio.h>
@@ -38,9 +39,12 @@
 
 #include <algorithm>
 #include <deque>
+#include <future>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
@@ -229,9 +233,19 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   Status CreateAndSeal(const ObjectID& object_id, const std::string& data,
                        const std::string& metadata);
 
+  Status CreateAndSealBatch(const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& data,
+                            const std::vector<std::string>& metadata);
+
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
+  std::future<Status> GetAsync(const std::vector<ObjectID>& object_ids,
+                               int64_t timeout_ms,
+                               std::vector<ObjectBuffer>* object_buffers);
+
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status Get(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
              ObjectBuffer* object_buffers);
 
@@ -259,6 +273,10 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   Status GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                          int64_t* metadata_size);
 
+  Status GetNotifications(int fd, std::vector<ObjectID>* object_ids,
+                          std::vector<int64_t>* data_sizes,
+                          std::vector<int64_t>* metadata_sizes);
+
   Status Disconnect();
 
   std::string DebugString();
@@ -319,6 +337,9 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   int64_t store_capacity_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// The start of a notification read by GetNotifications but not decoded
+  /// yet because it was incomplete, by notification file descriptor.
+  std::unordered_map<int, std::vector<uint8_t>> notification_buffers_;
   /// A mutex which protects this class.
   std::recursive_mutex client_mutex_;
 
@@ -410,8 +431,10 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
 
   ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                    << data_size << " and metadata size " << metadata_size;
-  RETURN_NOT_OK(
-      SendCreateRequest(store_conn_, object_id, data_size, metadata_size, device_num));
+  // The store prefers the memory of the NUMA node of the creating thread, which
+  // is likely to access the object first.
+  RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, data_size, metadata_size,
+                                  device_num, GetCurrentNumaNode()));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateReply, &buffer));
   ObjectID id;
@@ -496,6 +519,40 @@ Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::CreateAndSealBatch(const std::vector<ObjectID>& object_ids,
+                                              const std::vector<std::string>& data,
+                                              const std::vector<std::string>& metadata) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  ARROW_LOG(DEBUG) << "called CreateAndSealBatch on conn " << store_conn_;
+  if (data.size() != object_ids.size() || metadata.size() != object_ids.size()) {
+    return Status::Invalid("CreateAndSealBatch() called with ", object_ids.size(),
+                           " object IDs, ", data.size(), " data and ", metadata.size(),
+                           " metadata");
+  }
+  // CreateAndSealBatch currently only supports device_num = 0, which
+  // corresponds to the host.
+  int device_num = 0;
+  std::vector<std::string> digests;
+  digests.reserve(object_ids.size());
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    uint64_t hash = ComputeObjectHash(
+        reinterpret_cast<const uint8_t*>(data[i].data()), data[i].size(),
+        reinterpret_cast<const uint8_t*>(metadata[i].data()), metadata[i].size(),
+        device_num);
+    std::string digest(kDigestSize, '\0');
+    memcpy(&digest[0], &hash, sizeof(hash));
+    digests.push_back(std::move(digest));
+  }
+
+  RETURN_NOT_OK(
+      SendCreateAndSealBatchRequest(store_conn_, object_ids, data, metadata, digests));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(
+      PlasmaReceive(store_conn_, MessageType::PlasmaCreateAndSealBatchReply, &buffer));
+  return ReadCreateAndSealBatchReply(buffer.data(), buffer.size());
+}
+
 Status PlasmaClient::Impl::GetBuffers(
     const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
     const std::function<std::shared_ptr<Buffer>(
@@ -644,6 +701,22 @@ Status PlasmaClient::Impl::Get(const std::vector<ObjectID>& object_ids,
   return GetBuffers(&object_ids[0], num_objects, timeout_ms, wrap_buffer, &(*out)[0]);
 }
 
+std::future<Status> PlasmaClient::Impl::GetAsync(
+    const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
+    std::vector<ObjectBuffer>* object_buffers) {
+  // The thread keeps the client alive until the reply has been processed
+  auto self = shared_from_this();
+  return std::async(std::launch::async, [self, object_ids, timeout_ms, object_buffers]() {
+    return self->Get(object_ids, timeout_ms, object_buffers);
+  });
+}
+
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+  // The store does not reply, as for releases
+  return SendPrefetchRequest(store_conn_, object_ids);
+}
+
 Status PlasmaClient::Impl::Get(const ObjectID* object_ids, int64_t num_objects,
                                int64_t timeout_ms, ObjectBuffer* out) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
@@ -942,6 +1015,7 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
   // Return the file descriptor that the client should use to read notifications
   // about sealed objects.
   *fd = sock[0];
+  notification_buffers_.erase(*fd);
   return Status::OK();
 }
 
@@ -967,6 +1041,26 @@ Status PlasmaClient::Impl::GetNotification(int fd, ObjectID* object_id,
                                            int64_t* data_size, int64_t* metadata_size) {
   std::lock_guard<std::recursive_mutex> guard(client_mutex_);
 
+  auto it = notification_buffers_.find(fd);
+  if (it != notification_buffers_.end() && !it->second.empty()) {
+    // Read the rest of the notification started by GetNotifications.
+    std::vector<uint8_t>& buffer = it->second;
+    size_t length = buffer.size();
+    if (length < sizeof(int64_t)) {
+      buffer.resize(sizeof(int64_t));
+      RETURN_NOT_OK(ReadBytes(fd, buffer.data() + length, sizeof(int64_t) - length));
+      length = sizeof(int64_t);
+    }
+    int64_t size;
+    memcpy(&size, buffer.data(), sizeof(size));
+    buffer.resize(sizeof(int64_t) + static_cast<size_t>(size));
+    RETURN_NOT_OK(ReadBytes(fd, buffer.data() + length, buffer.size() - length));
+    Status s = DecodeNotification(buffer.data() + sizeof(int64_t), object_id, data_size,
+                                  metadata_size);
+    buffer.clear();
+    return s;
+  }
+
   auto notification = ReadMessageAsync(fd);
   if (notification == NULL) {
     return Status::IOError("Failed to read object notification from Plasma socket");
@@ -974,6 +1068,57 @@ Status PlasmaClient::Impl::GetNotification(int fd, ObjectID* object_id,
   return DecodeNotification(notification.get(), object_id, data_size, metadata_size);
 }
 
+// The number of bytes GetNotifications attempts to read at once.
+constexpr size_t kNotificationReadSize = 64 * 1024;
+
+Status PlasmaClient::Impl::GetNotifications(int fd, std::vector<ObjectID>* object_ids,
+                                            std::vector<int64_t>* data_sizes,
+                                            std::vector<int64_t>* metadata_sizes) {
+  std::lock_guard<std::recursive_mutex> guard(client_mutex_);
+
+  object_ids->clear();
+  data_sizes->clear();
+  metadata_sizes->clear();
+  std::vector<uint8_t>& buffer = notification_buffers_[fd];
+  size_t offset = 0;
+  while (true) {
+    // Decode the complete notifications.
+    while (buffer.size() - offset >= sizeof(int64_t)) {
+      int64_t size;
+      memcpy(&size, buffer.data() + offset, sizeof(size));
+      if (buffer.size() - offset - sizeof(int64_t) < static_cast<size_t>(size)) {
+        break;
+      }
+      ObjectID object_id;
+      int64_t data_size;
+      int64_t metadata_size;
+      RETURN_NOT_OK(DecodeNotification(buffer.data() + offset + sizeof(int64_t),
+                                       &object_id, &data_size, &metadata_size));
+      object_ids->push_back(object_id);
+      data_sizes->push_back(data_size);
+      metadata_sizes->push_back(metadata_size);
+      offset += sizeof(int64_t) + static_cast<size_t>(size);
+    }
+    buffer.erase(buffer.begin(), buffer.begin() + offset);
+    offset = 0;
+    if (!object_ids->empty()) {
+      return Status::OK();
+    }
+
+    // Wait for more notifications, and take all those available.
+    const size_t length = buffer.size();
+    buffer.resize(length + kNotificationReadSize);
+    ssize_t nbytes;
+    do {
+      nbytes = read(fd, buffer.data() + length, kNotificationReadSize);
+    } while (nbytes < 0 && errno == EINTR);
+    buffer.resize(length + static_cast<size_t>(std::max<ssize_t>(nbytes, 0)));
+    if (nbytes <= 0) {
+      return Status::IOError("Failed to read object notifications from Plasma socket");
+    }
+  }
+}
+
 Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
                                    const std::string& manager_socket_name,
                                    int release_delay, int num_retries) {
@@ -1064,11 +1209,27 @@ Status PlasmaClient::CreateAndSeal(const ObjectID& object_id, const std::string&
   return impl_->CreateAndSeal(object_id, data, metadata);
 }
 
+Status PlasmaClient::CreateAndSealBatch(const std::vector<ObjectID>& object_ids,
+                                        const std::vector<std::string>& data,
+                                        const std::vector<std::string>& metadata) {
+  return impl_->CreateAndSealBatch(object_ids, data, metadata);
+}
+
 Status PlasmaClient::Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
                          std::vector<ObjectBuffer>* object_buffers) {
   return impl_->Get(object_ids, timeout_ms, object_buffers);
 }
 
+std::future<Status> PlasmaClient::GetAsync(const std::vector<ObjectID>& object_ids,
+                                           int64_t timeout_ms,
+                                           std::vector<ObjectBuffer>* object_buffers) {
+  return impl_->GetAsync(object_ids, timeout_ms, object_buffers);
+}
+
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::Get(const ObjectID* object_ids, int64_t num_objects,
                          int64_t timeout_ms, ObjectBuffer* object_buffers) {
   return impl_->Get(object_ids, num_objects, timeout_ms, object_buffers);
@@ -1111,6 +1272,12 @@ Status PlasmaClient::GetNotification(int fd, ObjectID* object_id, int64_t* data_
   return impl_->GetNotification(fd, object_id, data_size, metadata_size);
 }
 
+Status PlasmaClient::GetNotifications(int fd, std::vector<ObjectID>* object_ids,
+                                      std::vector<int64_t>* data_sizes,
+                                      std::vector<int64_t>* metadata_sizes) {
+  return impl_->GetNotifications(fd, object_ids, data_sizes, metadata_sizes);
+}
+
 Status PlasmaClient::DecodeNotification(const uint8_t* buffer, ObjectID* object_id,
                                         int64_t* data_size, int64_t* metadata_size) {
   return impl_->DecodeNotification(buffer, object_id, data_size, metadata_size);
@@ -19,6 +19,7 @@
 #define PLASMA_CLIENT_H
 
 #include <functional>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
@@ -108,6 +109,17 @@ class ARROW_EXPORT PlasmaClient {
   Status CreateAndSeal(const ObjectID& object_id, const std::string& data,
                        const std::string& metadata);
 
+  /// Create and seal a batch of objects in the object store with a single
+  /// message to the store. Either all the objects are created, or none of them.
+  ///
+  /// \param object_ids The IDs of the objects to create.
+  /// \param data The data for the objects to create.
+  /// \param metadata The metadata for the objects to create.
+  /// \return The return status.
+  Status CreateAndSealBatch(const std::vector<ObjectID>& object_ids,
+                            const std::vector<std::string>& data,
+                            const std::vector<std::string>& metadata);
+
   /// Get some objects from the Plasma Store. This function will block until the
   /// objects have all been created and sealed in the Plasma Store or the
   /// timeout expires.
@@ -125,6 +137,28 @@ class ARROW_EXPORT PlasmaClient {
   Status Get(const std::vector<ObjectID>& object_ids, int64_t timeout_ms,
              std::vector<ObjectBuffer>* object_buffers);
 
+  /// Asynchronous variant of Get(), which waits for the objects on a separate
+  /// thread so that the caller can keep working in the meantime. The other
+  /// calls on this client wait until the get has completed.
+  ///
+  /// \param object_ids The IDs of the objects to get.
+  /// \param timeout_ms The amount of time in milliseconds to wait before this
+  ///        request times out. If this value is -1, then no timeout is set.
+  /// \param[out] object_buffers The object results, which must not be accessed
+  ///        until the returned future is ready.
+  /// \return A future holding the status of the get.
+  std::future<Status> GetAsync(const std::vector<ObjectID>& object_ids,
+                               int64_t timeout_ms,
+                               std::vector<ObjectBuffer>* object_buffers);
+
+  /// Ask the store to bring objects evicted to the external store back into
+  /// memory, so that a later Get() does not wait for them. This returns
+  /// without waiting for the objects.
+  ///
+  /// \param object_ids The IDs of the objects to prefetch.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// Deprecated variant of Get() that doesn't automatically release buffers
   /// when they get out of scope.
   ///
@@ -248,6 +282,23 @@ class ARROW_EXPORT PlasmaClient {
   Status GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                          int64_t* metadata_size);
 
+  /// Receive all the object notifications available for this client if
+  /// Subscribe has been called, waiting for one if there are none. This takes
+  /// a single system call for many notifications, rather than two for each
+  /// notification with GetNotification, with which it can be mixed.
+  ///
+  /// \param fd The file descriptor we are reading the notifications from.
+  /// \param object_ids Out parameter, the object_ids of the objects that were sealed
+  ///        or deleted.
+  /// \param data_sizes Out parameter, the data sizes of the objects that were
+  ///        sealed, or -1 if they were deleted.
+  /// \param metadata_sizes Out parameter, the metadata sizes of the objects that
+  ///        were sealed, or -1 if they were deleted.
+  /// \return The return status.
+  Status GetNotifications(int fd, std::vector<ObjectID>* object_ids,
+                          std::vector<int64_t>* data_sizes,
+                          std::vector<int64_t>* metadata_sizes);
+
   Status DecodeNotification(const uint8_t* buffer, ObjectID* object_id,
                             int64_t* data_size, int64_t* metadata_size);
 
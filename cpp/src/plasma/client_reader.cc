@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/client_reader.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <thread>
+#include <utility>
+
+#include "arrow/util/logging.h"
+
+#include "plasma/fling.h"
+#include "plasma/io.h"
+
+namespace plasma {
+
+struct ClientReader::ReaderThread {
+  EventLoop loop;
+  std::thread thread;
+  /// Pipe waking up the event loop of the thread when clients are added.
+  int wakeup_fds[2];
+  /// The clients added since the thread last woke up.
+  std::vector<Client*> new_clients;
+  bool shutdown = false;
+};
+
+static void MakeNonBlockingPipe(int fds[2]) {
+  ARROW_CHECK(pipe(fds) == 0);
+  for (int i = 0; i < 2; ++i) {
+    ARROW_CHECK(fcntl(fds[i], F_SETFL, fcntl(fds[i], F_GETFL) | O_NONBLOCK) == 0);
+  }
+}
+
+static void WakeUp(int fd) {
+  // The byte only wakes up the event loop, so a full pipe is fine
+  char byte = 0;
+  if (write(fd, &byte, 1) < 0 && errno != EAGAIN) {
+    ARROW_LOG(WARNING) << "failed to wake up an event loop";
+  }
+}
+
+static void Drain(int fd) {
+  char buffer[64];
+  while (read(fd, buffer, sizeof(buffer)) > 0) {
+  }
+}
+
+ClientReader::ClientReader(int num_threads) : next_reader_(0) {
+  ARROW_CHECK(num_threads > 0);
+  MakeNonBlockingPipe(message_fds_);
+  for (int i = 0; i < num_threads; ++i) {
+    readers_.emplace_back(new ReaderThread);
+    ReaderThread* reader = readers_.back().get();
+    MakeNonBlockingPipe(reader->wakeup_fds);
+    reader->loop.AddFileEvent(reader->wakeup_fds[0], kEventLoopRead,
+                              [this, reader](int events) { WatchNewClients(reader); });
+    reader->thread = std::thread([reader] { reader->loop.Start(); });
+  }
+}
+
+ClientReader::~ClientReader() {
+  for (auto& reader : readers_) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      reader->shutdown = true;
+    }
+    WakeUp(reader->wakeup_fds[1]);
+  }
+  for (auto& reader : readers_) {
+    reader->thread.join();
+    close(reader->wakeup_fds[0]);
+    close(reader->wakeup_fds[1]);
+  }
+  close(message_fds_[0]);
+  close(message_fds_[1]);
+}
+
+void ClientReader::AddClient(Client* client) {
+  ReaderThread* reader;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    reader = readers_[next_reader_].get();
+    next_reader_ = (next_reader_ + 1) % readers_.size();
+    reader->new_clients.push_back(client);
+  }
+  WakeUp(reader->wakeup_fds[1]);
+}
+
+void ClientReader::Poll(std::vector<Message>* messages) {
+  Drain(message_fds_[0]);
+  std::lock_guard<std::mutex> lock(mutex_);
+  *messages = std::move(messages_);
+  messages_.clear();
+}
+
+void ClientReader::WatchNewClients(ReaderThread* reader) {
+  Drain(reader->wakeup_fds[0]);
+  std::vector<Client*> clients;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (reader->shutdown) {
+      reader->loop.Stop();
+      return;
+    }
+    clients.swap(reader->new_clients);
+  }
+  for (Client* client : clients) {
+    ARROW_CHECK(reader->loop.AddFileEvent(
+        client->fd, kEventLoopRead,
+        [this, reader, client](int events) { ReadRequest(reader, client); }));
+  }
+}
+
+void ClientReader::ReadRequest(ReaderThread* reader, Client* client) {
+  Message message{client, flatbuf::MessageType::PlasmaDisconnectClient, {}, -1};
+  Status s = ReadMessage(client->fd, &message.type, &message.data);
+  if (!s.ok()) {
+    // A client whose requests can't be read is disconnected rather than
+    // taking the store down
+    ARROW_LOG(DEBUG) << "failed to read a request from client " << client->fd << ": "
+                     << s;
+    message.type = flatbuf::MessageType::PlasmaDisconnectClient;
+    message.data.clear();
+  }
+  if (message.type == flatbuf::MessageType::PlasmaSubscribeRequest) {
+    // The notification socket follows the request on the connection, so it
+    // must be received before the next request is read
+    message.fd = recv_fd(client->fd);
+    if (message.fd < 0) {
+      ARROW_LOG(DEBUG) << "failed to receive the notification socket of client "
+                       << client->fd;
+      message.type = flatbuf::MessageType::PlasmaDisconnectClient;
+    }
+  }
+  if (message.type == flatbuf::MessageType::PlasmaDisconnectClient) {
+    // The store closes the socket once it has processed the message
+    reader->loop.RemoveFileEvent(client->fd);
+  }
+
+  bool was_empty;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    was_empty = messages_.empty();
+    messages_.push_back(std::move(message));
+  }
+  // The store is already due to poll the earlier messages otherwise
+  if (was_empty) {
+    WakeUp(message_fds_[1]);
+  }
+}
+
+}  // namespace plasma
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_CLIENT_READER_H
+#define PLASMA_CLIENT_READER_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "plasma/events.h"
+#include "plasma/plasma.h"
+#include "plasma/plasma_generated.h"
+
+namespace plasma {
+
+// ==== The client reader ====
+//
+// Reads the requests of the clients of the store on background threads, each
+// running its own event loop, so that the event loop of the store only
+// processes complete requests and does not spend its time in the system calls
+// reading them. The requests of a client are all read by the same thread and
+// are handed to the store in order; the replies are still sent by the store.
+
+class ClientReader {
+ public:
+  /// A request read from a client.
+  struct Message {
+    Client* client;
+    flatbuf::MessageType type;
+    std::vector<uint8_t> data;
+    /// The file descriptor sent along with a subscribe request, or -1.
+    int fd;
+  };
+
+  /// Start the reader threads.
+  ///
+  /// \param num_threads The number of threads reading the requests.
+  explicit ClientReader(int num_threads);
+
+  /// Stop the reader threads. The clients are left connected.
+  ~ClientReader();
+
+  /// File descriptor which becomes readable whenever a request has been read.
+  int message_fd() const { return message_fds_[0]; }
+
+  /// Start reading the requests of a client. The client must remain valid
+  /// until a PlasmaDisconnectClient message has been polled for it, after
+  /// which its socket is not read anymore.
+  ///
+  /// \param client The newly connected client.
+  void AddClient(Client* client);
+
+  /// Take the requests which have been read, and drain the message file
+  /// descriptor.
+  ///
+  /// \param[out] messages The requests read, in order for each client.
+  void Poll(std::vector<Message>* messages);
+
+ private:
+  struct ReaderThread;
+
+  void WatchNewClients(ReaderThread* reader);
+
+  void ReadRequest(ReaderThread* reader, Client* client);
+
+  std::vector<std::unique_ptr<ReaderThread>> readers_;
+  size_t next_reader_;
+  std::mutex mutex_;
+  std::vector<Message> messages_;
+  int message_fds_[2];
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_CLIENT_READER_H
@@ -43,6 +43,7 @@ int fake_munmap(void*, int64_t);
 #define DIRECT_MUNMAP(a, s) fake_munmap(a, s)
 #define USE_DL_PREFIX
 #define HAVE_MORECORE 0
+#define MSPACES 1
 #define DEFAULT_MMAP_THRESHOLD MAX_SIZE_T
 #define DEFAULT_GRANULARITY ((size_t)128U * 1024U)
 
@@ -54,6 +55,7 @@ int fake_munmap(void*, int64_t);
 #undef DIRECT_MUNMAP
 #undef USE_DL_PREFIX
 #undef HAVE_MORECORE
+#undef MSPACES
 #undef DEFAULT_GRANULARITY
 
 // dlmalloc.c defined DEBUG which will conflict with ARROW_LOG(DEBUG).
@@ -126,12 +128,17 @@ void* fake_mmap(size_t size) {
     return pointer;
   }
 
+  if (mmap_numa_node >= 0 && !BindToNumaNode(pointer, size, mmap_numa_node)) {
+    ARROW_LOG(WARNING) << "failed to bind memory to NUMA node " << mmap_numa_node
+                       << ": " << std::strerror(errno);
+  }
   // Increase dlmalloc's allocation granularity directly.
   mparams.granularity *= GRANULARITY_MULTIPLIER;
 
   MmapRecord& record = mmap_records[pointer];
   record.fd = fd;
   record.size = size;
+  record.numa_node = mmap_numa_node;
 
   // We lie to dlmalloc about where mapped memory actually lives.
   pointer = pointer_advance(pointer, kMmapRegionsGap);
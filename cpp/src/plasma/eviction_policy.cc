@@ -19,10 +19,63 @@
 #include "plasma/plasma_allocator.h"
 
 #include <algorithm>
+#include <iterator>
+#include <limits>
 #include <sstream>
 
 namespace plasma {
 
+bool ParseEvictionCacheKind(const std::string& name, EvictionCacheKind* kind) {
+  if (name == "lru") {
+    *kind = EvictionCacheKind::LRU;
+  } else if (name == "tinylfu") {
+    *kind = EvictionCacheKind::TINY_LFU;
+  } else if (name == "gds") {
+    *kind = EvictionCacheKind::GREEDY_DUAL_SIZE;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+std::unique_ptr<EvictionCache> EvictionCache::Make(EvictionCacheKind kind,
+                                                   const std::string& name,
+                                                   int64_t size) {
+  switch (kind) {
+    case EvictionCacheKind::TINY_LFU:
+      return std::unique_ptr<EvictionCache>(new TinyLFUCache(name, size));
+    case EvictionCacheKind::GREEDY_DUAL_SIZE:
+      return std::unique_ptr<EvictionCache>(new GreedyDualSizeCache(name, size));
+    default:
+      return std::unique_ptr<EvictionCache>(new LRUCache(name, size));
+  }
+}
+
+void EvictionCache::AdjustCapacity(int64_t delta) {
+  ARROW_LOG(INFO) << "adjusting global lru capacity from " << Capacity() << " to "
+                  << (Capacity() + delta) << " (max " << OriginalCapacity() << ")";
+  capacity_ += delta;
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+}
+
+int64_t EvictionCache::Capacity() const { return capacity_; }
+
+int64_t EvictionCache::OriginalCapacity() const { return original_capacity_; }
+
+int64_t EvictionCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
+
+std::string EvictionCache::DebugString() const {
+  std::stringstream result;
+  result << "\n(" << name_ << ") capacity: " << Capacity();
+  result << "\n(" << name_
+         << ") used: " << 100. * (1. - (RemainingCapacity() / (double)OriginalCapacity()))
+         << "%";
+  result << "\n(" << name_ << ") num objects: " << NumObjects();
+  result << "\n(" << name_ << ") num evictions: " << num_evictions_total_;
+  result << "\n(" << name_ << ") bytes evicted: " << bytes_evicted_total_;
+  return result.str();
+}
+
 void LRUCache::Add(const ObjectID& key, int64_t size) {
   auto it = item_map_.find(key);
   ARROW_CHECK(it == item_map_.end());
@@ -41,37 +94,12 @@ void LRUCache::Remove(const ObjectID& key) {
   ARROW_CHECK(used_capacity_ >= 0) << DebugString();
 }
 
-void LRUCache::AdjustCapacity(int64_t delta) {
-  ARROW_LOG(INFO) << "adjusting global lru capacity from " << Capacity() << " to "
-                  << (Capacity() + delta) << " (max " << OriginalCapacity() << ")";
-  capacity_ += delta;
-  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
-}
-
-int64_t LRUCache::Capacity() const { return capacity_; }
-
-int64_t LRUCache::OriginalCapacity() const { return original_capacity_; }
-
-int64_t LRUCache::RemainingCapacity() const { return capacity_ - used_capacity_; }
-
 void LRUCache::Foreach(std::function<void(const ObjectID&)> f) {
   for (auto& pair : item_list_) {
     f(pair.first);
   }
 }
 
-std::string LRUCache::DebugString() const {
-  std::stringstream result;
-  result << "\n(" << name_ << ") capacity: " << Capacity();
-  result << "\n(" << name_
-         << ") used: " << 100. * (1. - (RemainingCapacity() / (double)OriginalCapacity()))
-         << "%";
-  result << "\n(" << name_ << ") num objects: " << item_map_.size();
-  result << "\n(" << name_ << ") num evictions: " << num_evictions_total_;
-  result << "\n(" << name_ << ") bytes evicted: " << bytes_evicted_total_;
-  return result.str();
-}
-
 int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
                                        std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted = 0;
@@ -80,29 +108,219 @@ int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
     it--;
     objects_to_evict->push_back(it->first);
     bytes_evicted += it->second;
-    bytes_evicted_total_ += it->second;
-    num_evictions_total_ += 1;
+    RecordEviction(it->second);
   }
   return bytes_evicted;
 }
 
-EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size)
-    : pinned_memory_bytes_(0), store_info_(store_info), cache_("global lru", max_size) {}
+FrequencySketch::FrequencySketch() : counters_(kDepth * kWidth, 0), num_accesses_(0) {}
+
+size_t FrequencySketch::Index(const ObjectID& key, int row) const {
+  static const uint64_t kSeeds[kDepth] = {0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL,
+                                          0x165667B19E3779F9ULL, 0x85EBCA77C2B2AE63ULL};
+  uint64_t hash = static_cast<uint64_t>(key.hash()) * kSeeds[row];
+  return row * kWidth + static_cast<size_t>((hash >> 32) & (kWidth - 1));
+}
+
+int FrequencySketch::Increment(const ObjectID& key) {
+  // Halve the counts once there were about ten times as many accesses as
+  // counters in a row, as W-TinyLFU does
+  if (++num_accesses_ >= 10 * kWidth) {
+    for (auto& counter : counters_) {
+      counter >>= 1;
+    }
+    num_accesses_ = 0;
+  }
+  int estimate = std::numeric_limits<int>::max();
+  for (int row = 0; row < kDepth; ++row) {
+    uint8_t& counter = counters_[Index(key, row)];
+    if (counter < std::numeric_limits<uint8_t>::max()) {
+      ++counter;
+    }
+    estimate = std::min<int>(estimate, counter);
+  }
+  return estimate;
+}
+
+int FrequencySketch::Estimate(const ObjectID& key) const {
+  int estimate = std::numeric_limits<int>::max();
+  for (int row = 0; row < kDepth; ++row) {
+    estimate = std::min<int>(estimate, counters_[Index(key, row)]);
+  }
+  return estimate;
+}
+
+void TinyLFUCache::Demote(ItemList* from, ItemList* to, Segment segment) {
+  auto& item = item_map_[from->back().first];
+  to->splice(to->begin(), *from, std::prev(from->end()));
+  item.segment = segment;
+  item.position = to->begin();
+}
+
+void TinyLFUCache::Add(const ObjectID& key, int64_t size) {
+  ARROW_CHECK(item_map_.find(key) == item_map_.end());
+  sketch_.Increment(key);
+  window_.emplace_front(key, size);
+  item_map_.emplace(key, Item{kWindow, window_.begin()});
+  used_capacity_ += size;
+  window_bytes_ += size;
+
+  const int64_t window_capacity = Capacity() / 100;
+  const int64_t protected_capacity = (Capacity() - window_capacity) / 10 * 8;
+  while (window_bytes_ > window_capacity) {
+    int64_t item_size = window_.back().second;
+    window_bytes_ -= item_size;
+    if (sketch_.Estimate(window_.back().first) > 1) {
+      protected_bytes_ += item_size;
+      Demote(&window_, &protected_, kProtected);
+    } else {
+      Demote(&window_, &probation_, kProbation);
+    }
+  }
+  while (protected_bytes_ > protected_capacity) {
+    protected_bytes_ -= protected_.back().second;
+    Demote(&protected_, &probation_, kProbation);
+  }
+}
+
+void TinyLFUCache::Remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it != item_map_.end());
+  int64_t size = it->second.position->second;
+  used_capacity_ -= size;
+  switch (it->second.segment) {
+    case kWindow:
+      window_bytes_ -= size;
+      window_.erase(it->second.position);
+      break;
+    case kProbation:
+      probation_.erase(it->second.position);
+      break;
+    case kProtected:
+      protected_bytes_ -= size;
+      protected_.erase(it->second.position);
+      break;
+  }
+  item_map_.erase(it);
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+}
+
+void TinyLFUCache::Foreach(std::function<void(const ObjectID&)> f) {
+  for (const ItemList* list : {&window_, &probation_, &protected_}) {
+    for (auto& pair : *list) {
+      f(pair.first);
+    }
+  }
+}
+
+int64_t TinyLFUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                           std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  auto window_it = window_.end();
+  auto probation_it = probation_.end();
+  auto protected_it = protected_.end();
+  while (bytes_evicted < num_bytes_required) {
+    ItemList::iterator* it;
+    if (window_it != window_.begin() && probation_it != probation_.begin()) {
+      // The window object is only kept if accessed more often
+      bool keep_window = sketch_.Estimate(std::prev(window_it)->first) >
+                         sketch_.Estimate(std::prev(probation_it)->first);
+      it = keep_window ? &probation_it : &window_it;
+    } else if (window_it != window_.begin()) {
+      it = &window_it;
+    } else if (probation_it != probation_.begin()) {
+      it = &probation_it;
+    } else if (protected_it != protected_.begin()) {
+      it = &protected_it;
+    } else {
+      break;
+    }
+    --*it;
+    objects_to_evict->push_back((*it)->first);
+    bytes_evicted += (*it)->second;
+    RecordEviction((*it)->second);
+  }
+  return bytes_evicted;
+}
+
+std::string TinyLFUCache::DebugString() const {
+  std::stringstream result;
+  result << EvictionCache::DebugString();
+  result << "\n(" << name_ << ") window bytes: " << window_bytes_;
+  result << "\n(" << name_ << ") protected bytes: " << protected_bytes_;
+  return result.str();
+}
+
+void GreedyDualSizeCache::Add(const ObjectID& key, int64_t size) {
+  ARROW_CHECK(item_map_.find(key) == item_map_.end());
+  int frequency = sketch_.Increment(key);
+  double priority =
+      inflation_ + frequency / static_cast<double>(std::max<int64_t>(size, 1));
+  item_map_.emplace(key, item_queue_.emplace(priority, std::make_pair(key, size)));
+  used_capacity_ += size;
+}
+
+void GreedyDualSizeCache::Remove(const ObjectID& key) {
+  auto it = item_map_.find(key);
+  ARROW_CHECK(it != item_map_.end());
+  used_capacity_ -= it->second->second.second;
+  item_queue_.erase(it->second);
+  item_map_.erase(it);
+  ARROW_CHECK(used_capacity_ >= 0) << DebugString();
+}
+
+void GreedyDualSizeCache::Foreach(std::function<void(const ObjectID&)> f) {
+  for (auto& item : item_queue_) {
+    f(item.second.first);
+  }
+}
+
+int64_t GreedyDualSizeCache::ChooseObjectsToEvict(
+    int64_t num_bytes_required, std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  for (auto it = item_queue_.begin();
+       bytes_evicted < num_bytes_required && it != item_queue_.end(); ++it) {
+    objects_to_evict->push_back(it->second.first);
+    bytes_evicted += it->second.second;
+    RecordEviction(it->second.second);
+    inflation_ = it->first;
+  }
+  return bytes_evicted;
+}
+
+std::string GreedyDualSizeCache::DebugString() const {
+  std::stringstream result;
+  result << EvictionCache::DebugString();
+  result << "\n(" << name_ << ") inflation: " << inflation_;
+  return result.str();
+}
+
+EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                               EvictionCacheKind cache_kind)
+    : pinned_memory_bytes_(0),
+      store_info_(store_info),
+      cache_kind_(cache_kind),
+      cache_(EvictionCache::Make(cache_kind, "global lru", max_size)),
+      num_accesses_(0),
+      num_restores_(0) {}
 
 int64_t EvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
                                              std::vector<ObjectID>* objects_to_evict) {
   int64_t bytes_evicted =
-      cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
+      cache_->ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
   // Update the LRU cache.
   for (auto& object_id : *objects_to_evict) {
-    cache_.Remove(object_id);
+    cache_->Remove(object_id);
   }
   return bytes_evicted;
 }
 
 void EvictionPolicy::ObjectCreated(const ObjectID& object_id, Client* client,
                                    bool is_create) {
-  cache_.Add(object_id, GetObjectSize(object_id));
+  if (!is_create) {
+    num_restores_ += 1;
+  }
+  cache_->Add(object_id, GetObjectSize(object_id));
 }
 
 bool EvictionPolicy::SetClientQuota(Client* client, int64_t output_memory_quota) {
@@ -136,20 +354,21 @@ bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_t
 
 void EvictionPolicy::BeginObjectAccess(const ObjectID& object_id) {
   // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  cache_->Remove(object_id);
+  num_accesses_ += 1;
   pinned_memory_bytes_ += GetObjectSize(object_id);
 }
 
 void EvictionPolicy::EndObjectAccess(const ObjectID& object_id) {
   auto size = GetObjectSize(object_id);
   // Add the object to the LRU cache.
-  cache_.Add(object_id, size);
+  cache_->Add(object_id, size);
   pinned_memory_bytes_ -= size;
 }
 
 void EvictionPolicy::RemoveObject(const ObjectID& object_id) {
   // If the object is in the LRU cache, remove it.
-  cache_.Remove(object_id);
+  cache_->Remove(object_id);
 }
 
 int64_t EvictionPolicy::GetObjectSize(const ObjectID& object_id) const {
@@ -157,6 +376,21 @@ int64_t EvictionPolicy::GetObjectSize(const ObjectID& object_id) const {
   return entry->data_size + entry->metadata_size;
 }
 
-std::string EvictionPolicy::DebugString() const { return cache_.DebugString(); }
+std::string EvictionPolicy::DebugString() const {
+  std::stringstream result;
+  result << AccessDebugString() << cache_->DebugString();
+  return result.str();
+}
+
+std::string EvictionPolicy::AccessDebugString() const {
+  std::stringstream result;
+  result << "num accesses: " << num_accesses_;
+  result << "\nnum restores: " << num_restores_;
+  if (num_accesses_ > 0) {
+    result << "\nhit rate: "
+           << 100. * (1. - std::min(1., num_restores_ / (double)num_accesses_)) << "%";
+  }
+  return result.str();
+}
 
 }  // namespace plasma
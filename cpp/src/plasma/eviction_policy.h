@@ -20,6 +20,8 @@
 
 #include <functional>
 #include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -38,9 +40,30 @@ namespace plasma {
 //
 // It does not implement memory quotas; see quota_aware_policy for that.
 
-class LRUCache {
+/// The kind of cache which chooses the objects to evict.
+enum class EvictionCacheKind {
+  /// Evict the least recently used objects first.
+  LRU,
+  /// W-TinyLFU: recently added objects go through a small LRU window, and only
+  /// the objects accessed more often than the ones they would replace are kept
+  /// over them. Frequently reused objects thus survive bursts of objects which
+  /// are only used once.
+  TINY_LFU,
+  /// GreedyDual-Size-Frequency: evict the objects with the least accesses per
+  /// byte first, aging the objects not accessed for a while. This keeps the
+  /// most objects, favouring small frequently accessed ones.
+  GREEDY_DUAL_SIZE
+};
+
+/// Parse the name of an eviction cache kind: "lru", "tinylfu" or "gds".
+///
+/// @return False if the name is not one of an eviction cache kind.
+bool ParseEvictionCacheKind(const std::string& name, EvictionCacheKind* kind);
+
+/// The objects which may be evicted, ordered by the eviction cache kind.
+class EvictionCache {
  public:
-  LRUCache(const std::string& name, int64_t size)
+  EvictionCache(const std::string& name, int64_t size)
       : name_(name),
         original_capacity_(size),
         capacity_(size),
@@ -48,12 +71,23 @@ class LRUCache {
         num_evictions_total_(0),
         bytes_evicted_total_(0) {}
 
-  void Add(const ObjectID& key, int64_t size);
+  virtual ~EvictionCache() {}
 
-  void Remove(const ObjectID& key);
+  /// Create an empty cache of the given kind.
+  static std::unique_ptr<EvictionCache> Make(EvictionCacheKind kind,
+                                             const std::string& name, int64_t size);
 
-  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
-                               std::vector<ObjectID>* objects_to_evict);
+  virtual void Add(const ObjectID& key, int64_t size) = 0;
+
+  virtual void Remove(const ObjectID& key) = 0;
+
+  /// Choose objects to evict, in eviction order, until at least
+  /// num_bytes_required bytes are chosen or none are left. The caller is
+  /// expected to remove the chosen objects.
+  ///
+  /// @return The total number of bytes of the chosen objects.
+  virtual int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                                       std::vector<ObjectID>* objects_to_evict) = 0;
 
   int64_t OriginalCapacity() const;
 
@@ -63,18 +97,19 @@ class LRUCache {
 
   void AdjustCapacity(int64_t delta);
 
-  void Foreach(std::function<void(const ObjectID&)>);
+  virtual void Foreach(std::function<void(const ObjectID&)>) = 0;
 
-  std::string DebugString() const;
+  virtual std::string DebugString() const;
 
- private:
-  /// A doubly-linked list containing the items in the cache and
-  /// their sizes in LRU order.
-  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
-  ItemList item_list_;
-  /// A hash table mapping the object ID of an object in the cache to its
-  /// location in the doubly linked list item_list_.
-  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+ protected:
+  /// The number of objects in the cache.
+  virtual size_t NumObjects() const = 0;
+
+  /// Account for an object chosen to be evicted.
+  void RecordEviction(int64_t size) {
+    bytes_evicted_total_ += size;
+    num_evictions_total_ += 1;
+  }
 
   /// The name of this cache, used for debugging purposes only.
   const std::string name_;
@@ -90,6 +125,136 @@ class LRUCache {
   int64_t bytes_evicted_total_;
 };
 
+class LRUCache : public EvictionCache {
+ public:
+  LRUCache(const std::string& name, int64_t size) : EvictionCache(name, size) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  void Remove(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+ protected:
+  size_t NumObjects() const override { return item_map_.size(); }
+
+ private:
+  /// A doubly-linked list containing the items in the cache and
+  /// their sizes in LRU order.
+  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
+  ItemList item_list_;
+  /// A hash table mapping the object ID of an object in the cache to its
+  /// location in the doubly linked list item_list_.
+  std::unordered_map<ObjectID, ItemList::iterator> item_map_;
+};
+
+/// Approximate access counts of objects, including the objects no longer in
+/// the cache, in a count-min sketch of saturating 8-bit counters. All counts
+/// are halved after a number of accesses, so that old accesses fade out.
+class FrequencySketch {
+ public:
+  FrequencySketch();
+
+  /// Record an access to an object.
+  ///
+  /// @return The estimated number of accesses to the object, including this one.
+  int Increment(const ObjectID& key);
+
+  /// The estimated number of accesses to an object.
+  int Estimate(const ObjectID& key) const;
+
+ private:
+  static constexpr int kDepth = 4;
+  static constexpr int kWidth = 1 << 12;
+
+  size_t Index(const ObjectID& key, int row) const;
+
+  std::vector<uint8_t> counters_;
+  /// The number of accesses since the counts were last halved.
+  int64_t num_accesses_;
+};
+
+/// W-TinyLFU, adapted to caches which only evict when asked to: objects leaving
+/// the window are protected if accessed before, and otherwise put on probation.
+/// Evictions compare the least recent objects of the window and of the
+/// probation list, and evict the window one unless it was accessed more often.
+class TinyLFUCache : public EvictionCache {
+ public:
+  TinyLFUCache(const std::string& name, int64_t size)
+      : EvictionCache(name, size), window_bytes_(0), protected_bytes_(0) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  void Remove(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  std::string DebugString() const override;
+
+ protected:
+  size_t NumObjects() const override { return item_map_.size(); }
+
+ private:
+  typedef std::list<std::pair<ObjectID, int64_t>> ItemList;
+  enum Segment { kWindow, kProbation, kProtected };
+  struct Item {
+    Segment segment;
+    ItemList::iterator position;
+  };
+
+  /// Move the least recent object of a list to the head of another one.
+  void Demote(ItemList* from, ItemList* to, Segment segment);
+
+  /// The objects added last, most recent first, up to 1% of the capacity.
+  ItemList window_;
+  /// The objects which left the window without having been accessed before.
+  ItemList probation_;
+  /// The objects which left the window after having been accessed before, up to
+  /// 80% of the rest of the capacity.
+  ItemList protected_;
+  std::unordered_map<ObjectID, Item> item_map_;
+  /// The number of bytes of the objects in the window and protected lists.
+  int64_t window_bytes_;
+  int64_t protected_bytes_;
+  FrequencySketch sketch_;
+};
+
+class GreedyDualSizeCache : public EvictionCache {
+ public:
+  GreedyDualSizeCache(const std::string& name, int64_t size)
+      : EvictionCache(name, size), inflation_(0) {}
+
+  void Add(const ObjectID& key, int64_t size) override;
+
+  void Remove(const ObjectID& key) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void Foreach(std::function<void(const ObjectID&)>) override;
+
+  std::string DebugString() const override;
+
+ protected:
+  size_t NumObjects() const override { return item_map_.size(); }
+
+ private:
+  /// The objects and their sizes by priority, the lowest evicted first.
+  typedef std::multimap<double, std::pair<ObjectID, int64_t>> ItemQueue;
+  ItemQueue item_queue_;
+  std::unordered_map<ObjectID, ItemQueue::iterator> item_map_;
+  /// The priority of the last evicted object, added to the priorities of the
+  /// objects added next.
+  double inflation_;
+  FrequencySketch sketch_;
+};
+
 /// The eviction policy.
 class EvictionPolicy {
  public:
@@ -98,7 +263,9 @@ class EvictionPolicy {
   /// @param store_info Information about the Plasma store that is exposed
   ///        to the eviction policy.
   /// @param max_size Max size in bytes total of objects to store.
-  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size);
+  /// @param cache_kind The kind of cache choosing the objects to evict.
+  explicit EvictionPolicy(PlasmaStoreInfo* store_info, int64_t max_size,
+                          EvictionCacheKind cache_kind = EvictionCacheKind::LRU);
 
   /// Destroy an eviction policy.
   virtual ~EvictionPolicy() {}
@@ -196,13 +363,23 @@ class EvictionPolicy {
   /// Returns the size of the object
   int64_t GetObjectSize(const ObjectID& object_id) const;
 
+  /// Returns the number of accesses and cache misses, with the hit rate.
+  std::string AccessDebugString() const;
+
   /// The number of bytes pinned by applications.
   int64_t pinned_memory_bytes_;
 
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
-  /// Datastructure for the LRU cache.
-  LRUCache cache_;
+  /// The kind of the caches.
+  EvictionCacheKind cache_kind_;
+  /// Datastructure for the global cache.
+  std::unique_ptr<EvictionCache> cache_;
+  /// The number of times objects started to be used.
+  int64_t num_accesses_;
+  /// The number of evicted objects which had to be recreated to be used again,
+  /// i.e. cache misses.
+  int64_t num_restores_;
 };
 
 }  // namespace plasma
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/external_store_worker.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <utility>
+
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+ExternalStoreWorker::ExternalStoreWorker(std::shared_ptr<ExternalStore> external_store)
+    : external_store_(external_store), num_pending_(0), shutdown_(false) {
+  ARROW_CHECK(pipe(completion_fds_) == 0);
+  for (int fd : completion_fds_) {
+    ARROW_CHECK(fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK) == 0);
+  }
+  thread_ = std::thread(&ExternalStoreWorker::Run, this);
+}
+
+ExternalStoreWorker::~ExternalStoreWorker() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  request_cv_.notify_one();
+  thread_.join();
+  close(completion_fds_[0]);
+  close(completion_fds_[1]);
+}
+
+void ExternalStoreWorker::Put(const std::vector<ObjectID>& object_ids,
+                              const std::vector<std::shared_ptr<Buffer>>& data) {
+  Submit(Request{true, object_ids, data});
+}
+
+void ExternalStoreWorker::Get(const std::vector<ObjectID>& object_ids,
+                              const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  Submit(Request{false, object_ids, buffers});
+}
+
+void ExternalStoreWorker::Submit(Request request) {
+  ARROW_CHECK(request.object_ids.size() == request.buffers.size());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    requests_.push_back(std::move(request));
+    ++num_pending_;
+  }
+  request_cv_.notify_one();
+}
+
+void ExternalStoreWorker::Poll(bool wait, std::vector<Completion>* completions) {
+  if (!wait) {
+    char buffer[64];
+    while (read(completion_fds_[0], buffer, sizeof(buffer)) > 0) {
+    }
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (wait) {
+    completion_cv_.wait(lock,
+                        [this] { return !completions_.empty() || num_pending_ == 0; });
+  }
+  num_pending_ -= static_cast<int64_t>(completions_.size());
+  *completions = std::move(completions_);
+  completions_.clear();
+}
+
+int64_t ExternalStoreWorker::NumPending() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_pending_;
+}
+
+void ExternalStoreWorker::Run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    request_cv_.wait(lock, [this] { return shutdown_ || !requests_.empty(); });
+    if (requests_.empty()) {
+      return;
+    }
+    Request request = std::move(requests_.front());
+    requests_.pop_front();
+    lock.unlock();
+
+    Status status = request.is_put
+                        ? external_store_->Put(request.object_ids, request.buffers)
+                        : external_store_->Get(request.object_ids, request.buffers);
+    if (!status.ok()) {
+      ARROW_LOG(WARNING) << "external store " << (request.is_put ? "put" : "get")
+                         << " failed: " << status.ToString();
+    }
+
+    lock.lock();
+    completions_.push_back(
+        Completion{request.is_put, std::move(request.object_ids), status});
+    completion_cv_.notify_all();
+    // The byte only wakes up the event loop, so a full pipe is fine
+    char byte = 0;
+    if (write(completion_fds_[1], &byte, 1) < 0 && errno != EAGAIN) {
+      ARROW_LOG(WARNING) << "failed to notify the plasma store of a completion";
+    }
+  }
+}
+
+}  // namespace plasma
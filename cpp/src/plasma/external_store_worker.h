@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef EXTERNAL_STORE_WORKER_H
+#define EXTERNAL_STORE_WORKER_H
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "plasma/common.h"
+#include "plasma/external_store.h"
+
+namespace plasma {
+
+// ==== The external store worker ====
+//
+// Writes objects to and reads them back from an external store on a
+// background thread, so that the event loop of the store does not block on
+// the external storage service. Requests are processed in order, and the
+// external store is only accessed from the worker thread.
+
+class ExternalStoreWorker {
+ public:
+  /// The outcome of a request processed by the worker.
+  struct Completion {
+    /// Whether the objects were put, or else fetched.
+    bool is_put;
+    std::vector<ObjectID> object_ids;
+    Status status;
+  };
+
+  explicit ExternalStoreWorker(std::shared_ptr<ExternalStore> external_store);
+
+  /// Wait for the pending requests and stop the worker thread.
+  ~ExternalStoreWorker();
+
+  /// File descriptor which becomes readable whenever a request completes.
+  int completion_fd() const { return completion_fds_[0]; }
+
+  /// Write objects to the external store. The buffers must remain valid
+  /// until the completion has been polled.
+  ///
+  /// \param object_ids The IDs of the objects to put.
+  /// \param data The object data to put.
+  void Put(const std::vector<ObjectID>& object_ids,
+           const std::vector<std::shared_ptr<Buffer>>& data);
+
+  /// Read objects from the external store into buffers, which must remain
+  /// valid until the completion has been polled.
+  ///
+  /// \param object_ids The IDs of the objects to get.
+  /// \param buffers The buffers the data should be written to.
+  void Get(const std::vector<ObjectID>& object_ids,
+           const std::vector<std::shared_ptr<Buffer>>& buffers);
+
+  /// Take the completed requests.
+  ///
+  /// \param wait Whether to block until a request completes, if any is
+  ///        pending. Otherwise the completion file descriptor is drained.
+  /// \param[out] completions The completed requests, in order.
+  void Poll(bool wait, std::vector<Completion>* completions);
+
+  /// The number of requests which have not been polled yet.
+  int64_t NumPending();
+
+ private:
+  struct Request {
+    bool is_put;
+    std::vector<ObjectID> object_ids;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+  };
+
+  void Submit(Request request);
+
+  void Run();
+
+  std::shared_ptr<ExternalStore> external_store_;
+  std::mutex mutex_;
+  std::condition_variable request_cv_;
+  std::condition_variable completion_cv_;
+  std::deque<Request> requests_;
+  std::vector<Completion> completions_;
+  int64_t num_pending_;
+  bool shutdown_;
+  int completion_fds_[2];
+  std::thread thread_;
+};
+
+}  // namespace plasma
+
+#endif  // EXTERNAL_STORE_WORKER_H
@@ -24,8 +24,12 @@
 #include <string.h>
 #include <sys/mman.h>
 #include <unistd.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #include <cerrno>
+#include <fstream>
 #include <string>
 #include <vector>
 
@@ -36,6 +40,8 @@ namespace plasma {
 
 std::unordered_map<void*, MmapRecord> mmap_records;
 
+int mmap_numa_node = -1;
+
 static void* pointer_advance(void* p, ptrdiff_t n) { return (unsigned char*)p + n; }
 
 static ptrdiff_t pointer_distance(void const* pfrom, void const* pto) {
@@ -57,6 +63,51 @@ void GetMallocMapinfo(void* addr, int* fd, int64_t* map_size, ptrdiff_t* offset)
   *offset = 0;
 }
 
+int GetMallocNumaNode(void* addr) {
+  for (const auto& entry : mmap_records) {
+    if (addr >= entry.first && addr < pointer_advance(entry.first, entry.second.size)) {
+      return entry.second.numa_node;
+    }
+  }
+  return -1;
+}
+
+int GetNumNumaNodes() {
+  // The possible nodes are listed as a range such as "0-1", or as "0".
+  std::ifstream possible("/sys/devices/system/node/possible");
+  std::string nodes;
+  if (!(possible >> nodes)) {
+    return 1;
+  }
+  auto last = nodes.find_last_of("-,");
+  return std::stoi(last == std::string::npos ? nodes : nodes.substr(last + 1)) + 1;
+}
+
+int GetCurrentNumaNode() {
+#if defined(__linux__) && defined(SYS_getcpu)
+  unsigned cpu;
+  unsigned node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return -1;
+}
+
+bool BindToNumaNode(void* addr, size_t size, int numa_node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // MPOL_PREFERRED falls back to the other nodes when the node is full.
+  constexpr int kMpolPreferred = 1;
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+  std::vector<unsigned long> node_mask(numa_node / kBitsPerWord + 1, 0);  // NOLINT
+  node_mask[numa_node / kBitsPerWord] |= 1UL << (numa_node % kBitsPerWord);
+  return syscall(SYS_mbind, addr, size, kMpolPreferred, node_mask.data(),
+                 node_mask.size() * kBitsPerWord + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
 int64_t GetMmapSize(int fd) {
   for (const auto& entry : mmap_records) {
     if (entry.second.fd == fd) {
@@ -42,6 +42,8 @@ int64_t GetMmapSize(int fd);
 struct MmapRecord {
   int fd;
   int64_t size;
+  /// The NUMA node the segment is bound to, or -1.
+  int numa_node;
 };
 
 /// Hashtable that contains one entry per segment that we got from the OS
@@ -49,6 +51,35 @@ struct MmapRecord {
 /// and size.
 extern std::unordered_map<void*, MmapRecord> mmap_records;
 
+/// The NUMA node the segments mapped next are bound to, or -1 to leave their
+/// placement to the operating system.
+extern int mmap_numa_node;
+
+/// Get the NUMA node of the segment containing an address.
+///
+/// @param addr The address to look up.
+/// @return The NUMA node the segment is bound to, or -1.
+int GetMallocNumaNode(void* addr);
+
+/// Get the number of NUMA nodes of the machine.
+///
+/// @return The number of nodes, or 1 if it cannot be determined.
+int GetNumNumaNodes();
+
+/// Get the NUMA node of the CPU the calling thread runs on.
+///
+/// @return The node, or -1 if it cannot be determined.
+int GetCurrentNumaNode();
+
+/// Prefer allocating the pages of a memory region from a NUMA node. The
+/// region must start at a page boundary and not have been accessed yet.
+///
+/// @param addr The start of the memory region.
+/// @param size The size of the memory region.
+/// @param numa_node The NUMA node.
+/// @return Whether the memory policy could be set.
+bool BindToNumaNode(void* addr, size_t size, int numa_node);
+
 }  // namespace plasma
 
 #endif  // PLASMA_MALLOC_H
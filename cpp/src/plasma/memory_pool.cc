@@ -0,0 +1,203 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/memory_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+namespace BitUtil = arrow::BitUtil;
+
+constexpr int64_t kPoolAlignment = 64;
+
+PlasmaMemoryPool::PlasmaMemoryPool(std::shared_ptr<Buffer> data)
+    : data_(std::move(data)), end_(0), bytes_allocated_(0), max_memory_(0) {
+  ARROW_CHECK(data_->is_mutable());
+  ARROW_CHECK(reinterpret_cast<uintptr_t>(data_->data()) % kPoolAlignment == 0);
+}
+
+PlasmaMemoryPool::~PlasmaMemoryPool() {}
+
+Status PlasmaMemoryPool::AllocateUnlocked(int64_t size, uint8_t** out) {
+  if (size < 0) {
+    return Status::Invalid("negative malloc size");
+  }
+  const int64_t start = BitUtil::RoundUpToMultipleOf64(end_);
+  if (size > data_->size() - std::min(start, data_->size())) {
+    return Status::OutOfMemory("plasma object of ", data_->size(),
+                               " bytes is too small to allocate ", size, " more bytes");
+  }
+  *out = data_->mutable_data() + start;
+  end_ = start + size;
+  bytes_allocated_ += size;
+  max_memory_ = std::max(max_memory_, bytes_allocated_);
+  return Status::OK();
+}
+
+Status PlasmaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return AllocateUnlocked(size, out);
+}
+
+Status PlasmaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const int64_t start = *ptr - data_->mutable_data();
+  if (start + old_size == end_ && new_size <= data_->size() - start) {
+    // The last allocation grows or shrinks in place
+    end_ = start + new_size;
+  } else if (new_size > old_size) {
+    uint8_t* out;
+    RETURN_NOT_OK(AllocateUnlocked(new_size, &out));
+    std::memcpy(out, *ptr, static_cast<size_t>(old_size));
+    *ptr = out;
+    // The old region is lost until the object is sealed
+    bytes_allocated_ -= new_size;
+  }
+  bytes_allocated_ += new_size - old_size;
+  max_memory_ = std::max(max_memory_, bytes_allocated_);
+  return Status::OK();
+}
+
+void PlasmaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const int64_t start = buffer - data_->mutable_data();
+  if (start + size == end_) {
+    end_ = start;
+  }
+  bytes_allocated_ -= size;
+}
+
+int64_t PlasmaMemoryPool::bytes_allocated() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_allocated_;
+}
+
+int64_t PlasmaMemoryPool::max_memory() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return max_memory_;
+}
+
+int64_t PlasmaMemoryPool::used_size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return end_;
+}
+
+namespace {
+
+// Written at the end of the object data to locate the messages
+struct InPlaceFooter {
+  int64_t magic;
+  int64_t schema_offset;
+  int64_t metadata_offset;
+  int64_t metadata_length;
+};
+
+constexpr int64_t kFooterSize = static_cast<int64_t>(sizeof(InPlaceFooter));
+
+// "PLASMARB" in little-endian byte order
+constexpr int64_t kInPlaceMagic = 0x42524d414d53414cLL;
+
+}  // namespace
+
+Status WriteRecordBatchInPlace(const arrow::RecordBatch& batch, PlasmaMemoryPool* pool) {
+  const std::shared_ptr<Buffer>& data = pool->data();
+  const int64_t region_size = BitUtil::RoundUpToMultipleOf8(pool->used_size());
+
+  // Temporary copies of sliced buffers are not allocated from the object, as
+  // they are written to it after the region anyway
+  arrow::ipc::internal::IpcPayload payload;
+  RETURN_NOT_OK(arrow::ipc::internal::GetRecordBatchPayloadInPlace(
+      batch, data->data(), region_size, arrow::ipc::IpcOptions::Defaults(),
+      arrow::default_memory_pool(), &payload));
+
+  arrow::ipc::DictionaryMemo dictionary_memo;
+  std::shared_ptr<Buffer> schema;
+  RETURN_NOT_OK(arrow::ipc::SerializeSchema(*batch.schema(), &dictionary_memo,
+                                            arrow::default_memory_pool(), &schema));
+  if (dictionary_memo.num_fields() > 0) {
+    return Status::NotImplemented(
+        "writing dictionary-encoded columns to plasma objects in place");
+  }
+
+  const int64_t schema_offset = payload.body_length;
+  const int64_t metadata_offset =
+      schema_offset + BitUtil::RoundUpToMultipleOf8(schema->size());
+  const int64_t total_size = metadata_offset + payload.metadata->size() + kFooterSize;
+  if (total_size > data->size()) {
+    return Status::OutOfMemory("plasma object of ", data->size(),
+                               " bytes is too small to write a record batch of ",
+                               total_size, " bytes");
+  }
+
+  arrow::io::FixedSizeBufferWriter writer(data);
+  RETURN_NOT_OK(writer.Seek(region_size));
+  static const uint8_t kPadding[8] = {0};
+  for (const auto& buffer : payload.body_buffers) {
+    const int64_t size = buffer ? buffer->size() : 0;
+    if (size > 0) {
+      RETURN_NOT_OK(writer.Write(buffer->data(), size));
+    }
+    RETURN_NOT_OK(writer.Write(kPadding, BitUtil::RoundUpToMultipleOf8(size) - size));
+  }
+  RETURN_NOT_OK(writer.WriteAt(schema_offset, schema->data(), schema->size()));
+  RETURN_NOT_OK(writer.WriteAt(metadata_offset, payload.metadata->data(),
+                               payload.metadata->size()));
+  InPlaceFooter footer = {kInPlaceMagic, schema_offset, metadata_offset,
+                          payload.metadata->size()};
+  return writer.WriteAt(data->size() - kFooterSize, &footer, kFooterSize);
+}
+
+Status ReadRecordBatchInPlace(const std::shared_ptr<Buffer>& data,
+                              std::shared_ptr<arrow::RecordBatch>* out) {
+  InPlaceFooter footer;
+  const int64_t footer_offset = data->size() - kFooterSize;
+  if (footer_offset < 0) {
+    return Status::Invalid("plasma object is too small to hold a record batch");
+  }
+  std::memcpy(&footer, data->data() + footer_offset, sizeof(footer));
+  if (footer.magic != kInPlaceMagic || footer.schema_offset < 0 ||
+      footer.metadata_offset < footer.schema_offset || footer.metadata_length < 0 ||
+      footer.metadata_offset + footer.metadata_length > footer_offset) {
+    return Status::Invalid("plasma object does not hold a record batch written in place");
+  }
+
+  arrow::ipc::DictionaryMemo dictionary_memo;
+  std::shared_ptr<arrow::Schema> schema;
+  arrow::io::BufferReader schema_reader(SliceBuffer(
+      data, footer.schema_offset, footer.metadata_offset - footer.schema_offset));
+  RETURN_NOT_OK(arrow::ipc::ReadSchema(&schema_reader, &dictionary_memo, &schema));
+
+  // The buffer offsets are relative to the start of the object data
+  auto metadata = SliceBuffer(data, footer.metadata_offset, footer.metadata_length);
+  arrow::io::BufferReader body_reader(data);
+  return arrow::ipc::ReadRecordBatch(*metadata, schema, &dictionary_memo, &body_reader,
+                                     out);
+}
+
+}  // namespace plasma
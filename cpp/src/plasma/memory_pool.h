@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_MEMORY_POOL_H
+#define PLASMA_MEMORY_POOL_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+class RecordBatch;
+}  // namespace arrow
+
+namespace plasma {
+
+using arrow::Buffer;
+using arrow::Status;
+
+/// A memory pool allocating from the data of a plasma object which has been
+/// created but not sealed, so that Arrow arrays can be built directly in the
+/// object, and published with WriteRecordBatchInPlace without being copied.
+///
+/// Allocations are carved out one after the other, and fail with
+/// Status::OutOfMemory once the object data is full. Only the space at the end
+/// of the allocations is reused when freed or reallocated, so builders should
+/// preferably be filled one at a time, or have their capacity reserved.
+class ARROW_EXPORT PlasmaMemoryPool : public arrow::MemoryPool {
+ public:
+  /// \param data The mutable data of an object returned by PlasmaClient::Create.
+  ///        It must be 64-byte aligned, and remain valid as long as the
+  ///        buffers allocated from the pool are used.
+  explicit PlasmaMemoryPool(std::shared_ptr<Buffer> data);
+  ~PlasmaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The object data the allocations are made from.
+  const std::shared_ptr<Buffer>& data() const { return data_; }
+
+  /// The offset in the object data of the end of the last allocation in use.
+  int64_t used_size() const;
+
+ private:
+  Status AllocateUnlocked(int64_t size, uint8_t** out);
+
+  std::shared_ptr<Buffer> data_;
+  mutable std::mutex mutex_;
+  int64_t end_;
+  int64_t bytes_allocated_;
+  int64_t max_memory_;
+};
+
+/// Lay out a record batch built with a PlasmaMemoryPool as an Arrow IPC
+/// record batch message in the object data of the pool, so that the object
+/// can be sealed and read back with ReadRecordBatchInPlace.
+///
+/// The buffers of the batch allocated from the pool are referenced where they
+/// are, and form the message body together with copies of the other buffers.
+/// The schema and record batch messages follow the body, and a footer locating
+/// them is written at the end of the object data. Nothing may be allocated
+/// from the pool afterwards. Dictionary-encoded columns are not supported.
+///
+/// \param batch The record batch to write.
+/// \param pool The pool the object data is taken from.
+/// \return Status::OutOfMemory if the object data is too small for the
+///         messages, in which case a larger object must be created.
+ARROW_EXPORT
+Status WriteRecordBatchInPlace(const arrow::RecordBatch& batch, PlasmaMemoryPool* pool);
+
+/// Read a record batch written with WriteRecordBatchInPlace, whose arrays
+/// reference the object data without copying it.
+///
+/// \param data The data of the sealed object.
+/// \param[out] out The record batch read.
+/// \return The return status.
+ARROW_EXPORT
+Status ReadRecordBatchInPlace(const std::shared_ptr<Buffer>& data,
+                              std::shared_ptr<arrow::RecordBatch>* out);
+
+}  // namespace plasma
+
+#endif  // PLASMA_MEMORY_POOL_H
@@ -15,6 +15,8 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <sstream>
+
 #include <arrow/util/logging.h>
 
 #include "plasma/malloc.h"
@@ -25,23 +27,47 @@ namespace plasma {
 extern "C" {
 void* dlmemalign(size_t alignment, size_t bytes);
 void dlfree(void* mem);
+void* create_mspace(size_t capacity, int locked);
+void* mspace_memalign(void* msp, size_t alignment, size_t bytes);
+void mspace_free(void* msp, void* mem);
 }
 
 int64_t PlasmaAllocator::footprint_limit_ = 0;
 int64_t PlasmaAllocator::allocated_ = 0;
+std::vector<void*> PlasmaAllocator::numa_arenas_;
+std::vector<int64_t> PlasmaAllocator::numa_allocated_;
 
-void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
+void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes, int numa_node) {
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
-  void* mem = dlmemalign(alignment, bytes);
+  void* mem;
+  if (numa_node >= 0 && numa_node < NumNumaNodes()) {
+    // The segments mapped for the arena are bound to the node
+    mmap_numa_node = numa_node;
+    if (numa_arenas_[numa_node] == nullptr) {
+      numa_arenas_[numa_node] = create_mspace(0, 0);
+      ARROW_CHECK(numa_arenas_[numa_node]);
+    }
+    mem = mspace_memalign(numa_arenas_[numa_node], alignment, bytes);
+    mmap_numa_node = -1;
+    numa_allocated_[numa_node] += bytes;
+  } else {
+    mem = dlmemalign(alignment, bytes);
+  }
   ARROW_CHECK(mem);
   allocated_ += bytes;
   return mem;
 }
 
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
-  dlfree(mem);
+  int numa_node = NumNumaNodes() > 0 ? GetMallocNumaNode(mem) : -1;
+  if (numa_node >= 0) {
+    mspace_free(numa_arenas_[numa_node], mem);
+    numa_allocated_[numa_node] -= bytes;
+  } else {
+    dlfree(mem);
+  }
   allocated_ -= bytes;
 }
 
@@ -53,4 +79,27 @@ int64_t PlasmaAllocator::GetFootprintLimit() { return footprint_limit_; }
 
 int64_t PlasmaAllocator::Allocated() { return allocated_; }
 
+void PlasmaAllocator::EnableNumaArenas() {
+  int num_nodes = GetNumNumaNodes();
+  if (num_nodes <= 1) {
+    ARROW_LOG(INFO) << "Not using NUMA arenas on a machine with a single NUMA node";
+    return;
+  }
+  ARROW_LOG(INFO) << "Using NUMA arenas for " << num_nodes << " NUMA nodes";
+  numa_arenas_.assign(num_nodes, nullptr);
+  numa_allocated_.assign(num_nodes, 0);
+}
+
+int PlasmaAllocator::NumNumaNodes() { return static_cast<int>(numa_arenas_.size()); }
+
+int64_t PlasmaAllocator::Allocated(int numa_node) { return numa_allocated_[numa_node]; }
+
+std::string PlasmaAllocator::DebugString() {
+  std::stringstream result;
+  for (int i = 0; i < NumNumaNodes(); ++i) {
+    result << "\n(numa node " << i << ") allocated: " << numa_allocated_[i];
+  }
+  return result.str();
+}
+
 }  // namespace plasma
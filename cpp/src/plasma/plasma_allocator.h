@@ -20,6 +20,8 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 namespace plasma {
 
@@ -30,8 +32,10 @@ class PlasmaAllocator {
   ///
   /// \param alignment Memory alignment.
   /// \param bytes Number of bytes.
+  /// \param numa_node The NUMA node whose memory is preferred, or -1. This is
+  ///        only used if NUMA arenas are enabled.
   /// \return Pointer to allocated memory.
-  static void* Memalign(size_t alignment, size_t bytes);
+  static void* Memalign(size_t alignment, size_t bytes, int numa_node = -1);
 
   /// Frees the memory space pointed to by mem, which must have been returned by
   /// a previous call to Memalign()
@@ -54,9 +58,32 @@ class PlasmaAllocator {
   /// \return Number of bytes allocated by Plasma so far.
   static int64_t Allocated();
 
+  /// Allocate the memory requested for a NUMA node from a separate arena,
+  /// whose segments are bound to the node. This has no effect on machines
+  /// with a single node.
+  static void EnableNumaArenas();
+
+  /// Get the number of NUMA nodes with an arena.
+  ///
+  /// \return The number of nodes, or 0 if NUMA arenas are disabled.
+  static int NumNumaNodes();
+
+  /// Get the number of bytes allocated from the arena of a NUMA node.
+  ///
+  /// \param numa_node The NUMA node.
+  /// \return Number of bytes allocated for the node so far.
+  static int64_t Allocated(int numa_node);
+
+  /// Describe the memory allocated for each NUMA node, if NUMA arenas are
+  /// enabled.
+  static std::string DebugString();
+
  private:
   static int64_t allocated_;
   static int64_t footprint_limit_;
+  /// The dlmalloc mspaces of the NUMA nodes, created on first use.
+  static std::vector<void*> numa_arenas_;
+  static std::vector<int64_t> numa_allocated_;
 };
 
 }  // namespace plasma
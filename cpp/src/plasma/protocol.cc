@@ -158,15 +158,17 @@ Status ReadGetDebugStringReply(uint8_t* data, size_t size, std::string* debug_st
 // Create messages.
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
-                         int64_t metadata_size, int device_num) {
+                         int64_t metadata_size, int device_num, int numa_node) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()),
-                                               data_size, metadata_size, device_num);
+  auto message =
+      fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()), data_size,
+                                    metadata_size, device_num, numa_node);
   return PlasmaSend(sock, MessageType::PlasmaCreateRequest, &fbb, message);
 }
 
 Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
-                         int64_t* data_size, int64_t* metadata_size, int* device_num) {
+                         int64_t* data_size, int64_t* metadata_size, int* device_num,
+                         int* numa_node) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaCreateRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
@@ -174,6 +176,7 @@ Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
   *metadata_size = message->metadata_size();
   *object_id = ObjectID::from_binary(message->object_id()->str());
   *device_num = message->device_num();
+  *numa_node = message->numa_node();
   return Status::OK();
 }
 
@@ -274,6 +277,62 @@ Status ReadCreateAndSealReply(uint8_t* data, size_t size) {
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendCreateAndSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                                     const std::vector<std::string>& data,
+                                     const std::vector<std::string>& metadata,
+                                     const std::vector<std::string>& digests) {
+  DCHECK(object_ids.size() == data.size());
+  DCHECK(object_ids.size() == metadata.size());
+  DCHECK(object_ids.size() == digests.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaCreateAndSealBatchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVectorOfStrings(data), fbb.CreateVectorOfStrings(metadata),
+      fbb.CreateVectorOfStrings(digests));
+  return PlasmaSend(sock, MessageType::PlasmaCreateAndSealBatchRequest, &fbb, message);
+}
+
+Status ReadCreateAndSealBatchRequest(uint8_t* data, size_t size,
+                                     std::vector<ObjectID>* object_ids,
+                                     std::vector<std::string>* object_data,
+                                     std::vector<std::string>* metadata,
+                                     std::vector<std::string>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateAndSealBatchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+
+  const auto num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->data()->size() == num_objects);
+  ARROW_CHECK(message->metadata()->size() == num_objects);
+  ARROW_CHECK(message->digest()->size() == num_objects);
+  object_ids->clear();
+  object_data->clear();
+  metadata->clear();
+  digests->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    object_data->push_back(message->data()->Get(i)->str());
+    metadata->push_back(message->metadata()->Get(i)->str());
+    digests->push_back(message->digest()->Get(i)->str());
+    ARROW_CHECK(digests->back().size() == kDigestSize);
+  }
+  return Status::OK();
+}
+
+Status SendCreateAndSealBatchReply(int sock, PlasmaError error) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message =
+      fb::CreatePlasmaCreateAndSealBatchReply(fbb, static_cast<PlasmaError>(error));
+  return PlasmaSend(sock, MessageType::PlasmaCreateAndSealBatchReply, &fbb, message);
+}
+
+Status ReadCreateAndSealBatchReply(uint8_t* data, size_t size) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateAndSealBatchReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  return PlasmaErrorStatus(message->error());
+}
+
 Status SendAbortRequest(int sock, ObjectID object_id) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = fb::CreatePlasmaAbortRequest(fbb, fbb.CreateString(object_id.binary()));
@@ -424,6 +483,28 @@ Status ReadDeleteReply(uint8_t* data, size_t size, std::vector<ObjectID>* object
   return Status::OK();
 }
 
+// Prefetch messages.
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaPrefetchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaPrefetchRequest, &fbb, message);
+}
+
+Status ReadPrefetchRequest(uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  DCHECK(object_ids);
+  auto message = flatbuffers::GetRoot<fb::PlasmaPrefetchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  object_ids->clear();
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  return Status::OK();
+}
+
 // Contains messages.
 
 Status SendContainsRequest(int sock, ObjectID object_id) {
@@ -67,10 +67,11 @@ Status ReadGetDebugStringReply(uint8_t* data, size_t size, std::string* debug_st
 /* Plasma Create message functions. */
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
-                         int64_t metadata_size, int device_num);
+                         int64_t metadata_size, int device_num, int numa_node);
 
 Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
-                         int64_t* data_size, int64_t* metadata_size, int* device_num);
+                         int64_t* data_size, int64_t* metadata_size, int* device_num,
+                         int* numa_node);
 
 Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
                        PlasmaError error, int64_t mmap_size);
@@ -90,6 +91,21 @@ Status SendCreateAndSealReply(int sock, PlasmaError error);
 
 Status ReadCreateAndSealReply(uint8_t* data, size_t size);
 
+Status SendCreateAndSealBatchRequest(int sock, const std::vector<ObjectID>& object_ids,
+                                     const std::vector<std::string>& data,
+                                     const std::vector<std::string>& metadata,
+                                     const std::vector<std::string>& digests);
+
+Status ReadCreateAndSealBatchRequest(uint8_t* data, size_t size,
+                                     std::vector<ObjectID>* object_ids,
+                                     std::vector<std::string>* object_data,
+                                     std::vector<std::string>* metadata,
+                                     std::vector<std::string>* digests);
+
+Status SendCreateAndSealBatchReply(int sock, PlasmaError error);
+
+Status ReadCreateAndSealBatchReply(uint8_t* data, size_t size);
+
 Status SendAbortRequest(int sock, ObjectID object_id);
 
 Status ReadAbortRequest(uint8_t* data, size_t size, ObjectID* object_id);
@@ -148,6 +164,12 @@ Status SendDeleteReply(int sock, const std::vector<ObjectID>& object_ids,
 Status ReadDeleteReply(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
                        std::vector<PlasmaError>* errors);
 
+/* Plasma Prefetch message functions. */
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadPrefetchRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids);
+
 /* Plasma Constains message functions. */
 
 Status SendContainsRequest(int sock, ObjectID object_id);
@@ -21,7 +21,9 @@
 // (name passed in via the -s option of the executable) and uses a
 // single thread to serve the clients. Each client establishes a
 // connection and can create objects, wait for objects and seal
-// objects through that connection.
+// objects through that connection. The requests can be read from
+// the connections by background threads (-t option), in which case
+// the store thread only processes them.
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
 // just enough to store and SHA1 hash) to memory mapped files.
@@ -40,9 +42,11 @@
 #include <sys/socket.h>
 #include <sys/statvfs.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <ctime>
 #include <deque>
 #include <memory>
@@ -112,15 +116,28 @@ Client::Client(int fd) : fd(fd), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
+                         std::shared_ptr<ExternalStore> external_store,
+                         EvictionCacheKind eviction_cache_kind,
+                         int num_reader_threads)
     : loop_(loop),
-      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit()),
+      eviction_policy_(&store_info_, PlasmaAllocator::GetFootprintLimit(),
+                       eviction_cache_kind),
       external_store_(external_store) {
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
 #ifdef PLASMA_CUDA
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
+  if (external_store_) {
+    external_store_worker_.reset(new ExternalStoreWorker(external_store_));
+    loop_->AddFileEvent(external_store_worker_->completion_fd(), kEventLoopRead,
+                        [this](int events) { ProcessExternalStoreCompletions(false); });
+  }
+  if (num_reader_threads > 0) {
+    client_reader_.reset(new ClientReader(num_reader_threads));
+    loop_->AddFileEvent(client_reader_->message_fd(), kEventLoopRead,
+                        [this](int events) { ProcessClientMessages(); });
+  }
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
@@ -151,7 +168,8 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
 
 // Allocate memory
 uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
-                                     ptrdiff_t* offset, Client* client, bool is_create) {
+                                     ptrdiff_t* offset, Client* client, bool is_create,
+                                     int numa_node) {
   // First free up space from the client's LRU queue if quota enforcement is on.
   std::vector<ObjectID> client_objects_to_evict;
   bool quota_ok = eviction_policy_.EnforcePerClientQuota(client, size, is_create,
@@ -171,10 +189,16 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
     // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
     // it is not guaranteed that the corresponding pointer in the client will be
     // 64-byte aligned, but in practice it often will be.
-    pointer = reinterpret_cast<uint8_t*>(PlasmaAllocator::Memalign(kBlockSize, size));
+    pointer = reinterpret_cast<uint8_t*>(
+        PlasmaAllocator::Memalign(kBlockSize, size, numa_node));
     if (pointer) {
       break;
     }
+    // The objects being spilled to the external store free their memory once
+    // written, so wait for them before evicting more objects.
+    if (!spilling_objects_.empty() && ProcessExternalStoreCompletions(true)) {
+      continue;
+    }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
     bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
@@ -215,7 +239,8 @@ Status PlasmaStore::FreeCudaMemory(int device_num, int64_t size, uint8_t* pointe
 // Create a new object buffer in the hash table.
 PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_size,
                                       int64_t metadata_size, int device_num,
-                                      Client* client, PlasmaObject* result) {
+                                      Client* client, PlasmaObject* result,
+                                      int numa_node) {
   ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
 
   auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -232,7 +257,8 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
   auto total_size = data_size + metadata_size;
 
   if (device_num == 0) {
-    pointer = AllocateMemory(total_size, &fd, &map_size, &offset, client, true);
+    pointer =
+        AllocateMemory(total_size, &fd, &map_size, &offset, client, true, numa_node);
     if (!pointer) {
       ARROW_LOG(ERROR) << "Not enough memory to create the object " << object_id.hex()
                        << ", data_size=" << data_size
@@ -433,13 +459,59 @@ void PlasmaStore::UpdateObjectGetRequests(const ObjectID& object_id) {
   }
 }
 
+void PlasmaStore::RestoreObjects(const std::vector<ObjectID>& object_ids,
+                                 Client* client) {
+  std::vector<ObjectID> restored_ids;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (!entry || entry->state != ObjectState::PLASMA_EVICTED) {
+      continue;
+    }
+    if (entry->pointer) {
+      // The object is still being spilled, so its data is still there.
+      ARROW_CHECK(spilling_objects_.count(object_id) > 0);
+      entry->state = ObjectState::PLASMA_SEALED;
+      eviction_policy_.ObjectCreated(object_id, client, false);
+      restored_objects_.push_back(object_id);
+      continue;
+    }
+    entry->pointer = AllocateMemory(entry->data_size + entry->metadata_size, &entry->fd,
+                                    &entry->map_size, &entry->offset, client, false);
+    if (!entry->pointer) {
+      // We are out of memory and cannot allocate memory for this object. It
+      // stays evicted so some other request can try again.
+      continue;
+    }
+    entry->state = ObjectState::PLASMA_CREATED;
+    entry->create_time = std::time(nullptr);
+    restoring_objects_.insert(object_id);
+    restored_ids.push_back(object_id);
+    buffers.emplace_back(new arrow::MutableBuffer(
+        entry->pointer, entry->data_size + entry->metadata_size));
+  }
+  if (!restored_ids.empty()) {
+    external_store_worker_->Get(restored_ids, buffers);
+  }
+}
+
 void PlasmaStore::ProcessGetRequest(Client* client,
                                     const std::vector<ObjectID>& object_ids,
                                     int64_t timeout_ms) {
+  if (external_store_worker_) {
+    RestoreObjects(object_ids, client);
+    // Without a timeout, the objects are only returned if already restored
+    while (timeout_ms == 0 &&
+           std::any_of(object_ids.begin(), object_ids.end(), [this](const ObjectID& id) {
+             return restoring_objects_.count(id) > 0;
+           })) {
+      ProcessExternalStoreCompletions(true);
+    }
+    ProcessExternalStoreCompletions(false);
+  }
+
   // Create a get request for this object.
   auto get_req = new GetRequest(client, object_ids);
-  std::vector<ObjectID> evicted_ids;
-  std::vector<ObjectTableEntry*> evicted_entries;
   for (auto object_id : object_ids) {
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
@@ -451,62 +523,17 @@ void PlasmaStore::ProcessGetRequest(Client* client,
       // If necessary, record that this client is using this object. In the case
       // where entry == NULL, this will be called from SealObject.
       AddToClientObjectIds(object_id, entry, client);
-    } else if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
-      // Make sure the object pointer is not already allocated
-      ARROW_CHECK(!entry->pointer);
-
-      entry->pointer = AllocateMemory(entry->data_size + entry->metadata_size, &entry->fd,
-                                      &entry->map_size, &entry->offset, client, false);
-      if (entry->pointer) {
-        entry->state = ObjectState::PLASMA_CREATED;
-        entry->create_time = std::time(nullptr);
-        eviction_policy_.ObjectCreated(object_id, client, false);
-        AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
-        evicted_ids.push_back(object_id);
-        evicted_entries.push_back(entry);
-      } else {
-        // We are out of memory an cannot allocate memory for this object.
-        // Change the state of the object back to PLASMA_EVICTED so some
-        // other request can try again.
-        entry->state = ObjectState::PLASMA_EVICTED;
-      }
     } else {
       // Add a placeholder plasma object to the get request to indicate that the
       // object is not present. This will be parsed by the client. We set the
-      // data size to -1 to indicate that the object is not present.
+      // data size to -1 to indicate that the object is not present. Objects
+      // being restored from the external store are returned once restored.
       get_req->objects[object_id].data_size = -1;
       // Add the get request to the relevant data structures.
       object_get_requests_[object_id].push_back(get_req);
     }
   }
 
-  if (!evicted_ids.empty()) {
-    unsigned char digest[kDigestSize];
-    std::vector<std::shared_ptr<Buffer>> buffers;
-    for (size_t i = 0; i < evicted_ids.size(); ++i) {
-      ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
-    }
-    if (external_store_->Get(evicted_ids, buffers).ok()) {
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_SEALED;
-        std::memcpy(&evicted_entries[i]->digest[0], &digest[0], kDigestSize);
-        evicted_entries[i]->construct_duration =
-            std::time(nullptr) - evicted_entries[i]->create_time;
-        PlasmaObject_init(&get_req->objects[evicted_ids[i]], evicted_entries[i]);
-        get_req->num_satisfied += 1;
-      }
-    } else {
-      // We tried to get the objects from the external store, but could not get them.
-      // Set the state of these objects back to PLASMA_EVICTED so some other request
-      // can try again.
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_EVICTED;
-      }
-    }
-  }
-
   // If all of the objects are present already or if the timeout is 0, return to
   // the client.
   if (get_req->num_satisfied == get_req->num_objects_to_wait_for || timeout_ms == 0) {
@@ -561,6 +588,7 @@ void PlasmaStore::EraseFromObjectTable(const ObjectID& object_id) {
 #endif
   }
   store_info_.objects.erase(object_id);
+  external_objects_.erase(object_id);
 }
 
 void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
@@ -574,7 +602,8 @@ void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
 ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   return entry && (entry->state == ObjectState::PLASMA_SEALED ||
-                   entry->state == ObjectState::PLASMA_EVICTED)
+                   entry->state == ObjectState::PLASMA_EVICTED ||
+                   restoring_objects_.count(object_id) > 0)
              ? ObjectStatus::OBJECT_FOUND
              : ObjectStatus::OBJECT_NOT_FOUND;
 }
@@ -639,8 +668,9 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectNotSealed;
   }
 
-  if (entry->ref_count != 0) {
-    // To delete an object, there must be no clients currently using it.
+  if (entry->ref_count != 0 || spilling_objects_.count(object_id) > 0) {
+    // To delete an object, there must be no clients currently using it, and it
+    // must not be being written to the external store.
     // Put it into deletion cache, it will be deleted later.
     deletion_cache_.emplace(object_id);
     return PlasmaError::ObjectInUse;
@@ -662,8 +692,8 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     return;
   }
 
+  std::vector<ObjectID> spilled_object_ids;
   std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
-  std::vector<ObjectTableEntry*> evicted_entries;
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "evicting object " << object_id.hex();
     auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -680,9 +710,17 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     // external store, free the object data pointer and keep a placeholder
     // entry in ObjectTable
     if (external_store_) {
-      evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
-          entry->pointer, entry->data_size + entry->metadata_size));
-      evicted_entries.push_back(entry);
+      entry->state = ObjectState::PLASMA_EVICTED;
+      if (external_objects_.count(object_id) > 0) {
+        // The object was restored from the external store and is unchanged
+        PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+        entry->pointer = nullptr;
+      } else if (spilling_objects_.insert(object_id).second) {
+        // An object brought back while being spilled is already being written
+        spilled_object_ids.push_back(object_id);
+        evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
+            entry->pointer, entry->data_size + entry->metadata_size));
+      }
     } else {
       // If there is no backing external store, just erase the object entry
       // and send a deletion notification.
@@ -695,14 +733,75 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     }
   }
 
-  if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
-    for (auto entry : evicted_entries) {
-      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
-      entry->pointer = nullptr;
-      entry->state = ObjectState::PLASMA_EVICTED;
+  // The memory is freed once the objects have been written in the background
+  if (!spilled_object_ids.empty()) {
+    external_store_worker_->Put(spilled_object_ids, evicted_object_data);
+  }
+}
+
+bool PlasmaStore::ProcessExternalStoreCompletions(bool wait) {
+  std::vector<ExternalStoreWorker::Completion> completions;
+  external_store_worker_->Poll(wait, &completions);
+  for (const auto& completion : completions) {
+    for (const auto& object_id : completion.object_ids) {
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      ARROW_CHECK(entry != nullptr);
+      if (completion.is_put) {
+        spilling_objects_.erase(object_id);
+        if (completion.status.ok()) {
+          external_objects_.insert(object_id);
+        }
+        // Objects brought back in the meantime stay in memory, unless they
+        // were deleted while being written
+        if (entry->state != ObjectState::PLASMA_EVICTED) {
+          if (entry->ref_count == 0 && deletion_cache_.erase(object_id) > 0) {
+            ObjectID deleted_id = object_id;
+            DeleteObject(deleted_id);
+          }
+          continue;
+        }
+        if (completion.status.ok()) {
+          PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+          entry->pointer = nullptr;
+        } else {
+          // Keep the object, which can then be evicted again.
+          entry->state = ObjectState::PLASMA_SEALED;
+          eviction_policy_.ObjectCreated(object_id, nullptr, false);
+        }
+      } else {
+        restoring_objects_.erase(object_id);
+        ARROW_CHECK(entry->state == ObjectState::PLASMA_CREATED);
+        if (completion.status.ok()) {
+          entry->state = ObjectState::PLASMA_SEALED;
+          entry->construct_duration = std::time(nullptr) - entry->create_time;
+          eviction_policy_.ObjectCreated(object_id, nullptr, false);
+          restored_objects_.push_back(object_id);
+        } else {
+          // Set the state of the object back to PLASMA_EVICTED so some other
+          // request can try again.
+          PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+          entry->pointer = nullptr;
+          entry->state = ObjectState::PLASMA_EVICTED;
+        }
+      }
+    }
+  }
+
+  if (!wait) {
+    std::vector<ObjectID> restored_objects;
+    restored_objects.swap(restored_objects_);
+    for (const auto& object_id : restored_objects) {
+      // The object may have been evicted again before the update
+      auto entry = GetObjectTableEntry(&store_info_, object_id);
+      if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
+        RestoreObjects({object_id}, nullptr);
+      }
+      if (entry && entry->state == ObjectState::PLASMA_SEALED) {
+        UpdateObjectGetRequests(object_id);
+      }
     }
   }
+  return !completions.empty();
 }
 
 void PlasmaStore::ConnectClient(int listener_sock) {
@@ -711,6 +810,11 @@ void PlasmaStore::ConnectClient(int listener_sock) {
   Client* client = new Client(client_fd);
   connected_clients_[client_fd] = std::unique_ptr<Client>(client);
 
+  if (client_reader_) {
+    client_reader_->AddClient(client);
+    ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
+    return;
+  }
   // Add a callback to handle events on this socket.
   // TODO(pcm): Check return value.
   loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
@@ -773,9 +877,19 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   connected_clients_.erase(it);
 }
 
+// The maximum number of notifications sent with a single system call.
+constexpr int kMaxNotificationBatch = 64;
+
+// The size of a notification, including its length prefix.
+static int64_t NotificationSize(const uint8_t* notification) {
+  return sizeof(int64_t) + *(reinterpret_cast<const int64_t*>(notification));
+}
+
 /// Send notifications about sealed objects to the subscribers. This is called
-/// in SealObject. If the socket's send buffer is full, the notification will
-/// be buffered, and this will be called again when the send buffer has room.
+/// once the requests sealing the objects have been processed. The queued
+/// notifications are sent in batches, with one system call each. If the
+/// socket's send buffer is full, the rest of the notifications stay queued,
+/// and this will be called again when the send buffer has room.
 /// Since we call erase on pending_notifications_, all iterators get
 /// invalidated, which is why we return a valid iterator to the next client to
 /// be used in PushNotification.
@@ -785,23 +899,41 @@ void PlasmaStore::DisconnectClient(int client_fd) {
 PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
     PlasmaStore::NotificationMap::iterator it) {
   int client_fd = it->first;
-  auto& notifications = it->second.object_notifications;
+  auto& queue = it->second;
+  auto& notifications = queue.object_notifications;
 
-  int num_processed = 0;
   bool closed = false;
-  // Loop over the array of pending notifications and send as many of them as
-  // possible.
-  for (size_t i = 0; i < notifications.size(); ++i) {
-    auto& notification = notifications.at(i);
-    // Decode the length, which is the first bytes of the message.
-    int64_t size = *(reinterpret_cast<int64_t*>(notification.get()));
-
-    // Attempt to send a notification about this object ID.
-    ssize_t nbytes = send(client_fd, notification.get(), sizeof(int64_t) + size, 0);
+  // Send as many of the pending notifications as possible.
+  while (!notifications.empty()) {
+    struct iovec iov[kMaxNotificationBatch];
+    int num_iov = 0;
+    for (const auto& notification : notifications) {
+      if (num_iov == kMaxNotificationBatch) {
+        break;
+      }
+      const int64_t skip = num_iov == 0 ? queue.sent_bytes : 0;
+      iov[num_iov].iov_base = notification.get() + skip;
+      iov[num_iov].iov_len =
+          static_cast<size_t>(NotificationSize(notification.get()) - skip);
+      ++num_iov;
+    }
+
+    // Attempt to send the notifications about these object IDs.
+    ssize_t nbytes = writev(client_fd, iov, num_iov);
     if (nbytes >= 0) {
-      ARROW_CHECK(nbytes == static_cast<ssize_t>(sizeof(int64_t)) + size);
-    } else if (nbytes == -1 &&
-               (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
+      // Drop the notifications which were sent entirely.
+      int64_t remaining = nbytes;
+      while (remaining > 0) {
+        const int64_t size = NotificationSize(notifications.front().get());
+        if (remaining < size - queue.sent_bytes) {
+          queue.sent_bytes += remaining;
+          break;
+        }
+        remaining -= size - queue.sent_bytes;
+        queue.sent_bytes = 0;
+        notifications.pop_front();
+      }
+    } else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
       ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching this "
                           "notification and will send it later.";
       // Add a callback to the event loop to send queued notifications whenever
@@ -820,11 +952,11 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
         closed = true;
         break;
       }
+      // Give up on the first notification.
+      queue.sent_bytes = 0;
+      notifications.pop_front();
     }
-    num_processed += 1;
   }
-  // Remove the sent notifications from the array.
-  notifications.erase(notifications.begin(), notifications.begin() + num_processed);
 
   // If we have sent all notifications, remove the fd from the event loop.
   if (notifications.empty()) {
@@ -840,35 +972,58 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
   }
 }
 
+static std::shared_ptr<uint8_t> MakeNotification(fb::ObjectInfoT* object_info) {
+  return std::shared_ptr<uint8_t>(CreateObjectInfoBuffer(object_info).release(),
+                                  std::default_delete<uint8_t[]>());
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
-  auto it = pending_notifications_.begin();
-  while (it != pending_notifications_.end()) {
-    auto notification = CreateObjectInfoBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    it = SendNotifications(it);
+  if (pending_notifications_.empty()) {
+    return;
+  }
+  auto notification = MakeNotification(object_info);
+  for (auto& entry : pending_notifications_) {
+    entry.second.object_notifications.push_back(notification);
   }
+  ScheduleNotifications();
 }
 
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info, int client_fd) {
   auto it = pending_notifications_.find(client_fd);
   if (it != pending_notifications_.end()) {
-    auto notification = CreateObjectInfoBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    SendNotifications(it);
+    it->second.object_notifications.push_back(MakeNotification(object_info));
+    ScheduleNotifications();
   }
 }
 
+void PlasmaStore::ScheduleNotifications() {
+  if (notification_timer_ != -1) {
+    return;
+  }
+  // A timer expiring right away runs after the file events being processed,
+  // in the same iteration of the event loop.
+  notification_timer_ = loop_->AddTimer(0, [this](int64_t timer_id) {
+    notification_timer_ = -1;
+    auto it = pending_notifications_.begin();
+    while (it != pending_notifications_.end()) {
+      it = SendNotifications(it);
+    }
+    loop_->RemoveTimer(timer_id);
+    return kEventLoopTimerDone;
+  });
+}
+
 // Subscribe to notifications about sealed objects.
-void PlasmaStore::SubscribeToUpdates(Client* client) {
+void PlasmaStore::SubscribeToUpdates(Client* client, int fd) {
   ARROW_LOG(DEBUG) << "subscribing to updates on fd " << client->fd;
   if (client->notification_fd > 0) {
     // This client has already subscribed. Return.
+    if (fd >= 0) {
+      close(fd);
+    }
     return;
   }
 
-  // TODO(rkn): The store could block here if the client doesn't send a file
-  // descriptor.
-  int fd = recv_fd(client->fd);
   if (fd < 0) {
     // This may mean that the client died before sending the file descriptor.
     ARROW_LOG(WARNING) << "Failed to receive file descriptor from client on fd "
@@ -899,8 +1054,29 @@ Status PlasmaStore::ProcessMessage(Client* client) {
   Status s = ReadMessage(client->fd, &type, &input_buffer_);
   ARROW_CHECK(s.ok() || s.IsIOError());
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+  int fd = -1;
+  if (type == fb::MessageType::PlasmaSubscribeRequest) {
+    // TODO(rkn): The store could block here if the client doesn't send a file
+    // descriptor.
+    fd = recv_fd(client->fd);
+  }
+  return ProcessMessage(client, type, input_buffer_.data(), input_buffer_.size(), fd);
+}
+
+void PlasmaStore::ProcessClientMessages() {
+  std::vector<ClientReader::Message> messages;
+  client_reader_->Poll(&messages);
+  for (auto& message : messages) {
+    Status s = ProcessMessage(message.client, message.type, message.data.data(),
+                              message.data.size(), message.fd);
+    if (!s.ok()) {
+      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+    }
+  }
+}
+
+Status PlasmaStore::ProcessMessage(Client* client, fb::MessageType type, uint8_t* input,
+                                   size_t input_size, int fd) {
   ObjectID object_id;
   PlasmaObject object = {};
 
@@ -910,10 +1086,11 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       int64_t data_size;
       int64_t metadata_size;
       int device_num;
+      int numa_node;
       RETURN_NOT_OK(ReadCreateRequest(input, input_size, &object_id, &data_size,
-                                      &metadata_size, &device_num));
-      PlasmaError error_code =
-          CreateObject(object_id, data_size, metadata_size, device_num, client, &object);
+                                      &metadata_size, &device_num, &numa_node));
+      PlasmaError error_code = CreateObject(object_id, data_size, metadata_size,
+                                            device_num, client, &object, numa_node);
       int64_t mmap_size = 0;
       if (error_code == PlasmaError::OK && device_num == 0) {
         mmap_size = GetMmapSize(object.store_fd);
@@ -958,6 +1135,44 @@ Status PlasmaStore::ProcessMessage(Client* client) {
         ARROW_CHECK(RemoveFromClientObjectIds(object_id, entry, client) == 1);
       }
     } break;
+    case fb::MessageType::PlasmaCreateAndSealBatchRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> data;
+      std::vector<std::string> metadata;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadCreateAndSealBatchRequest(input, input_size, &object_ids, &data,
+                                                  &metadata, &digests));
+      // Either all the objects are created and sealed, or none of them.
+      int device_num = 0;
+      PlasmaError error_code = PlasmaError::OK;
+      size_t num_created = 0;
+      for (; num_created < object_ids.size(); ++num_created) {
+        error_code = CreateObject(object_ids[num_created], data[num_created].size(),
+                                  metadata[num_created].size(), device_num, client,
+                                  &object);
+        if (error_code != PlasmaError::OK) {
+          break;
+        }
+      }
+      if (error_code == PlasmaError::OK) {
+        for (size_t i = 0; i < object_ids.size(); ++i) {
+          auto entry = GetObjectTableEntry(&store_info_, object_ids[i]);
+          ARROW_CHECK(entry != nullptr);
+          std::memcpy(entry->pointer, data[i].data(), data[i].size());
+          std::memcpy(entry->pointer + data[i].size(), metadata[i].data(),
+                      metadata[i].size());
+          unsigned char digest[kDigestSize];
+          std::memcpy(&digest[0], digests[i].data(), kDigestSize);
+          SealObject(object_ids[i], &digest[0]);
+          ARROW_CHECK(RemoveFromClientObjectIds(object_ids[i], entry, client) == 1);
+        }
+      } else {
+        for (size_t i = 0; i < num_created; ++i) {
+          ARROW_CHECK(AbortObject(object_ids[i], client) == 1);
+        }
+      }
+      HANDLE_SIGPIPE(SendCreateAndSealBatchReply(client->fd, error_code), client->fd);
+    } break;
     case fb::MessageType::PlasmaAbortRequest: {
       RETURN_NOT_OK(ReadAbortRequest(input, input_size, &object_id));
       ARROW_CHECK(AbortObject(object_id, client) == 1) << "To abort an object, the only "
@@ -985,6 +1200,14 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       }
       HANDLE_SIGPIPE(SendDeleteReply(client->fd, object_ids, error_codes), client->fd);
     } break;
+    case fb::MessageType::PlasmaPrefetchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadPrefetchRequest(input, input_size, &object_ids));
+      if (external_store_worker_) {
+        RestoreObjects(object_ids, client);
+        ProcessExternalStoreCompletions(false);
+      }
+    } break;
     case fb::MessageType::PlasmaContainsRequest: {
       RETURN_NOT_OK(ReadContainsRequest(input, input_size, &object_id));
       if (ContainsObject(object_id) == ObjectStatus::OBJECT_FOUND) {
@@ -1013,7 +1236,7 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
     case fb::MessageType::PlasmaSubscribeRequest:
-      SubscribeToUpdates(client);
+      SubscribeToUpdates(client, fd);
       break;
     case fb::MessageType::PlasmaConnectRequest: {
       HANDLE_SIGPIPE(SendConnectReply(client->fd, PlasmaAllocator::GetFootprintLimit()),
@@ -1035,8 +1258,9 @@ Status PlasmaStore::ProcessMessage(Client* client) {
                      client->fd);
     } break;
     case fb::MessageType::PlasmaGetDebugStringRequest: {
-      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, eviction_policy_.DebugString()),
-                     client->fd);
+      std::string debug_string =
+          eviction_policy_.DebugString() + PlasmaAllocator::DebugString();
+      HANDLE_SIGPIPE(SendGetDebugStringReply(client->fd, debug_string), client->fd);
     } break;
     default:
       // This code should be unreachable.
@@ -1050,24 +1274,31 @@ class PlasmaStoreRunner {
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
+             std::shared_ptr<ExternalStore> external_store,
+             EvictionCacheKind eviction_cache_kind, int num_reader_threads) {
     // Create the event loop.
     loop_.reset(new EventLoop);
     store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+                                 external_store, eviction_cache_kind,
+                                 num_reader_threads));
     plasma_config = store_->GetPlasmaStoreInfo();
 
     // We are using a single memory-mapped file by mallocing and freeing a single
     // large amount of space up front. According to the documentation,
     // dlmalloc might need up to 128*sizeof(size_t) bytes for internal
-    // bookkeeping.
-    void* pointer = plasma::PlasmaAllocator::Memalign(
-        kBlockSize, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
-    ARROW_CHECK(pointer != nullptr);
-    // This will unmap the file, but the next one created will be as large
-    // as this one (this is an implementation detail of dlmalloc).
-    plasma::PlasmaAllocator::Free(
-        pointer, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
+    // bookkeeping. With NUMA arenas, each node gets its share up front.
+    int num_arenas = std::max(PlasmaAllocator::NumNumaNodes(), 1);
+    size_t arena_size =
+        PlasmaAllocator::GetFootprintLimit() / num_arenas - 256 * sizeof(size_t);
+    for (int i = 0; i < num_arenas; ++i) {
+      int numa_node = PlasmaAllocator::NumNumaNodes() > 0 ? i : -1;
+      void* pointer =
+          plasma::PlasmaAllocator::Memalign(kBlockSize, arena_size, numa_node);
+      ARROW_CHECK(pointer != nullptr);
+      // This will unmap the file, but the next one created will be as large
+      // as this one (this is an implementation detail of dlmalloc).
+      plasma::PlasmaAllocator::Free(pointer, arena_size);
+    }
 
     int socket = BindIpcSock(socket_name, true);
     // TODO(pcm): Check return value.
@@ -1104,14 +1335,16 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store,
+                 EvictionCacheKind eviction_cache_kind, int num_reader_threads) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  eviction_cache_kind, num_reader_threads);
 }
 
 }  // namespace plasma
@@ -1124,9 +1357,12 @@ int main(int argc, char* argv[]) {
   std::string plasma_directory;
   std::string external_store_endpoint;
   bool hugepages_enabled = false;
+  bool numa_arenas_enabled = false;
   int64_t system_memory = -1;
+  plasma::EvictionCacheKind eviction_cache_kind = plasma::EvictionCacheKind::LRU;
+  int num_reader_threads = 0;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:e:h")) != -1) {
+  while ((c = getopt(argc, argv, "s:m:d:e:p:t:hn")) != -1) {
     switch (c) {
       case 'd':
         plasma_directory = std::string(optarg);
@@ -1137,9 +1373,25 @@ int main(int argc, char* argv[]) {
       case 'h':
         hugepages_enabled = true;
         break;
+      case 'n':
+        numa_arenas_enabled = true;
+        break;
+      case 'p':
+        if (!plasma::ParseEvictionCacheKind(optarg, &eviction_cache_kind)) {
+          ARROW_LOG(FATAL) << "unknown eviction policy \"" << optarg
+                           << "\", expected lru, tinylfu or gds";
+        }
+        break;
       case 's':
         socket_name = optarg;
         break;
+      case 't': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &num_reader_threads, &extra);
+        ARROW_CHECK(scanned == 1 && num_reader_threads >= 0)
+            << "the number of reader threads must be a non-negative integer";
+        break;
+      }
       case 'm': {
         char extra;
         int scanned = sscanf(optarg, "%" SCNd64 "%c", &system_memory, &extra);
@@ -1203,6 +1455,9 @@ int main(int argc, char* argv[]) {
     plasma::SetMallocGranularity(1024 * 1024 * 1024);  // 1 GB
   }
 #endif
+  if (numa_arenas_enabled) {
+    plasma::PlasmaAllocator::EnableNumaArenas();
+  }
   // Get external store
   std::shared_ptr<plasma::ExternalStore> external_store{nullptr};
   if (!external_store_endpoint.empty()) {
@@ -1218,7 +1473,8 @@ int main(int argc, char* argv[]) {
     ARROW_CHECK_OK(external_store->Connect(external_store_endpoint));
   }
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      eviction_cache_kind, num_reader_threads);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -25,9 +25,11 @@
 #include <unordered_set>
 #include <vector>
 
+#include "plasma/client_reader.h"
 #include "plasma/common.h"
 #include "plasma/events.h"
 #include "plasma/external_store.h"
+#include "plasma/external_store_worker.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 #include "plasma/quota_aware_policy.h"
@@ -50,8 +52,11 @@ struct GetRequest;
 
 struct NotificationQueue {
   /// The object notifications for clients. We notify the client about the
-  /// objects in the order that the objects were sealed or deleted.
-  std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  /// objects in the order that the objects were sealed or deleted. A
+  /// notification is shared by the queues of all the subscribers.
+  std::deque<std::shared_ptr<uint8_t>> object_notifications;
+  /// The number of bytes of the first notification already sent.
+  int64_t sent_bytes = 0;
 };
 
 class PlasmaStore {
@@ -61,7 +66,9 @@ class PlasmaStore {
   // TODO: PascalCase PlasmaStore methods.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store,
+              EvictionCacheKind eviction_cache_kind = EvictionCacheKind::LRU,
+              int num_reader_threads = 0);
 
   ~PlasmaStore();
 
@@ -81,6 +88,7 @@ class PlasmaStore {
   ///        device_num = 2 corresponds to GPU1, etc.
   /// @param client The client that created the object.
   /// @param result The object that has been created.
+  /// @param numa_node The NUMA node whose memory is preferred, or -1.
   /// @return One of the following error codes:
   ///  - PlasmaError::OK, if the object was created successfully.
   ///  - PlasmaError::ObjectExists, if an object with this ID is already
@@ -91,7 +99,7 @@ class PlasmaStore {
   ///    plasma_release.
   PlasmaError CreateObject(const ObjectID& object_id, int64_t data_size,
                            int64_t metadata_size, int device_num, Client* client,
-                           PlasmaObject* result);
+                           PlasmaObject* result, int numa_node = -1);
 
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
@@ -130,6 +138,15 @@ class PlasmaStore {
   void ProcessGetRequest(Client* client, const std::vector<ObjectID>& object_ids,
                          int64_t timeout_ms);
 
+  /// Bring evicted objects back from the external store in the background.
+  /// Objects which are still being written to the external store are made
+  /// available again right away.
+  ///
+  /// @param object_ids Object IDs of the objects to restore. The ones which
+  ///   have not been evicted are ignored.
+  /// @param client The client making this request.
+  void RestoreObjects(const std::vector<ObjectID>& object_ids, Client* client);
+
   /// Seal an object. The object is now immutable and can be accessed with get.
   ///
   /// @param object_id Object ID of the object to be sealed.
@@ -153,7 +170,9 @@ class PlasmaStore {
   /// Subscribe a file descriptor to updates about new sealed objects.
   ///
   /// @param client The client making this request.
-  void SubscribeToUpdates(Client* client);
+  /// @param fd The file descriptor the client sent to receive the
+  ///   notifications, or -1 if it could not be received.
+  void SubscribeToUpdates(Client* client, int fd);
 
   /// Connect a new client to the PlasmaStore.
   ///
@@ -170,10 +189,28 @@ class PlasmaStore {
   arrow::Status ProcessMessage(Client* client);
 
  private:
+  /// Process a request read from a client.
+  ///
+  /// @param client The client making this request.
+  /// @param type The type of the request.
+  /// @param input The request message.
+  /// @param input_size The size of the request message.
+  /// @param fd The file descriptor sent along with a subscribe request.
+  arrow::Status ProcessMessage(Client* client, flatbuf::MessageType type,
+                               uint8_t* input, size_t input_size, int fd);
+
+  /// Process the requests read by the client reader threads.
+  void ProcessClientMessages();
+
   void PushNotification(ObjectInfoT* object_notification);
 
   void PushNotification(ObjectInfoT* object_notification, int client_fd);
 
+  /// Send the queued notifications once the requests being processed are
+  /// done, so that the notifications of a batch of requests are sent with a
+  /// single system call per subscriber.
+  void ScheduleNotifications();
+
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
 
@@ -196,8 +233,17 @@ class PlasmaStore {
 
   void EraseFromObjectTable(const ObjectID& object_id);
 
+  /// Handle the external store requests completed by the worker: free the
+  /// memory of the spilled objects and seal the restored ones.
+  ///
+  /// @param wait Whether to block until a request completes. The get requests
+  ///   waiting for restored objects are then only updated on the next call
+  ///   without waiting, from the event loop.
+  /// @return Whether any request had completed.
+  bool ProcessExternalStoreCompletions(bool wait);
+
   uint8_t* AllocateMemory(size_t size, int* fd, int64_t* map_size, ptrdiff_t* offset,
-                          Client* client, bool is_create);
+                          Client* client, bool is_create, int numa_node = -1);
 #ifdef PLASMA_CUDA
   Status AllocateCudaMemory(int device_num, int64_t size, uint8_t** out_pointer,
                             std::shared_ptr<CudaIpcMemHandle>* out_ipc_handle);
@@ -224,14 +270,31 @@ class PlasmaStore {
   /// TODO(pcm): Consider putting this into the Client data structure and
   /// reorganize the code slightly.
   NotificationMap pending_notifications_;
+  /// The timer sending the queued notifications, or -1.
+  int64_t notification_timer_ = -1;
 
   std::unordered_map<int, std::unique_ptr<Client>> connected_clients_;
+  /// Reads the requests of the clients on background threads, if any. It is
+  /// declared after the clients so that its threads are stopped first.
+  std::unique_ptr<ClientReader> client_reader_;
 
   std::unordered_set<ObjectID> deletion_cache_;
 
-  /// Manages worker threads for handling asynchronous/multi-threaded requests
-  /// for reading/writing data to/from external store.
+  /// The external store evicted objects are written to, if any.
   std::shared_ptr<ExternalStore> external_store_;
+  /// Manages the worker thread handling the asynchronous requests for
+  /// reading/writing data to/from the external store.
+  std::unique_ptr<ExternalStoreWorker> external_store_worker_;
+  /// Evicted objects whose memory is only freed once they have been written to
+  /// the external store. They can be brought back until then.
+  std::unordered_set<ObjectID> spilling_objects_;
+  /// Objects written to the external store, which need not be written again
+  /// when evicted after being restored.
+  std::unordered_set<ObjectID> external_objects_;
+  /// Objects being read back from the external store.
+  std::unordered_set<ObjectID> restoring_objects_;
+  /// Restored objects whose get requests have not been updated yet.
+  std::vector<ObjectID> restored_objects_;
 #ifdef PLASMA_CUDA
   arrow::cuda::CudaDeviceManager* manager_;
 #endif
@@ -32,6 +32,7 @@
 
 #include "plasma/client.h"
 #include "plasma/common.h"
+#include "plasma/io.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 #include "plasma/test_util.h"
@@ -62,7 +63,8 @@ class TestPlasmaStore : public ::testing::Test {
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
         plasma_directory + "/plasma-store-server -m 10000000 -s " + store_socket_name_ +
-        " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
+        StoreOptions() + " 1> /dev/null 2> /dev/null & " + "echo $! > " +
+        store_socket_name_ + ".pid";
     PLASMA_CHECK_SYSTEM(system(plasma_command.c_str()));
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -85,6 +87,9 @@ class TestPlasmaStore : public ::testing::Test {
     PLASMA_CHECK_SYSTEM(system(plasma_kill_command.c_str()));
   }
 
+  // Extra command line options of the store
+  virtual std::string StoreOptions() const { return ""; }
+
   void CreateObject(PlasmaClient& client, const ObjectID& object_id,
                     const std::vector<uint8_t>& metadata,
                     const std::vector<uint8_t>& data, bool release = true) {
@@ -153,6 +158,54 @@ TEST_F(TestPlasmaStore, NewSubscriberTest) {
   ARROW_CHECK_OK(local_client.Disconnect());
 }
 
+TEST_F(TestPlasmaStore, BatchedNotificationsTest) {
+  PlasmaClient local_client;
+  ARROW_CHECK_OK(local_client.Connect(store_socket_name_, ""));
+  int fd = -1;
+  ARROW_CHECK_OK(local_client.Subscribe(&fd));
+  ASSERT_GT(fd, 0);
+
+  std::vector<ObjectID> object_ids;
+  for (int64_t i = 0; i < 10; ++i) {
+    object_ids.push_back(random_object_id());
+    std::vector<uint8_t> data(i + 1, 0);
+    CreateObject(client_, object_ids.back(), {42}, data, true);
+  }
+  ARROW_CHECK_OK(client_.Delete(object_ids[0]));
+
+  // Single and batched reads can be mixed
+  ObjectID object_id;
+  int64_t data_size;
+  int64_t metadata_size;
+  ARROW_CHECK_OK(
+      local_client.GetNotification(fd, &object_id, &data_size, &metadata_size));
+  ASSERT_EQ(object_ids[0], object_id);
+  ASSERT_EQ(1, data_size);
+
+  std::vector<ObjectID> received_ids;
+  std::vector<int64_t> data_sizes;
+  std::vector<int64_t> metadata_sizes;
+  while (received_ids.size() < object_ids.size()) {
+    std::vector<ObjectID> ids;
+    std::vector<int64_t> sizes;
+    ARROW_CHECK_OK(local_client.GetNotifications(fd, &ids, &sizes, &metadata_sizes));
+    ASSERT_EQ(ids.size(), sizes.size());
+    ASSERT_EQ(ids.size(), metadata_sizes.size());
+    received_ids.insert(received_ids.end(), ids.begin(), ids.end());
+    data_sizes.insert(data_sizes.end(), sizes.begin(), sizes.end());
+  }
+  ASSERT_EQ(received_ids.size(), object_ids.size());
+  for (size_t i = 1; i < object_ids.size(); ++i) {
+    ASSERT_EQ(object_ids[i], received_ids[i - 1]);
+    ASSERT_EQ(static_cast<int64_t>(i + 1), data_sizes[i - 1]);
+  }
+  // The deletion comes last
+  ASSERT_EQ(object_ids[0], received_ids.back());
+  ASSERT_EQ(-1, data_sizes.back());
+
+  ARROW_CHECK_OK(local_client.Disconnect());
+}
+
 TEST_F(TestPlasmaStore, SealErrorsTest) {
   ObjectID object_id = random_object_id();
 
@@ -592,6 +645,41 @@ TEST_F(TestPlasmaStore, MultipleGetTest) {
   ASSERT_EQ(object_buffers[1].data->data()[0], 2);
 }
 
+TEST_F(TestPlasmaStore, CreateAndSealBatchTest) {
+  ObjectID object_id1 = random_object_id();
+  ObjectID object_id2 = random_object_id();
+  std::vector<ObjectBuffer> object_buffers;
+
+  ARROW_CHECK_OK(client_.CreateAndSealBatch({object_id1, object_id2},
+                                            {std::string{1, 2}, std::string{3}},
+                                            {std::string{42}, std::string()}));
+  ARROW_CHECK_OK(client_.Get({object_id1, object_id2}, -1, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {42}, {1, 2});
+  AssertObjectBufferEqual(object_buffers[1], {}, {3});
+
+  // A batch with an existing object creates none of the objects
+  ObjectID object_id3 = random_object_id();
+  Status status = client_.CreateAndSealBatch({object_id3, object_id1},
+                                             {std::string{4}, std::string{5}},
+                                             {std::string(), std::string()});
+  ASSERT_TRUE(IsPlasmaObjectExists(status));
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_id3, &has_object));
+  ASSERT_FALSE(has_object);
+}
+
+TEST_F(TestPlasmaStore, GetAsyncTest) {
+  ObjectID object_id = random_object_id();
+  std::vector<ObjectBuffer> object_buffers;
+
+  auto future = client_.GetAsync({object_id}, -1, &object_buffers);
+  // The object is created by another client while the get is pending
+  CreateObject(client2_, object_id, {42}, {1, 2, 3});
+  ARROW_CHECK_OK(future.get());
+  ASSERT_EQ(object_buffers.size(), 1);
+  AssertObjectBufferEqual(object_buffers[0], {42}, {1, 2, 3});
+}
+
 TEST_F(TestPlasmaStore, AbortTest) {
   ObjectID object_id = random_object_id();
   std::vector<ObjectBuffer> object_buffers;
@@ -757,6 +845,137 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+// The same requests with the store reading them on background threads
+class TestPlasmaStoreReaderThreads : public TestPlasmaStore {
+ protected:
+  std::string StoreOptions() const override { return " -t 2"; }
+};
+
+TEST_F(TestPlasmaStoreReaderThreads, CreateGetSealTest) {
+  // The two clients are read by different threads
+  std::vector<ObjectID> object_ids;
+  for (int i = 0; i < 20; ++i) {
+    object_ids.push_back(random_object_id());
+    std::vector<uint8_t> data(i + 1, static_cast<uint8_t>(i));
+    CreateObject(i % 2 == 0 ? client_ : client2_, object_ids.back(), {42}, data);
+  }
+  for (int i = 0; i < 20; ++i) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(
+        (i % 2 == 0 ? client2_ : client_).Get({object_ids[i]}, -1, &object_buffers));
+    ASSERT_EQ(1U, object_buffers.size());
+    AssertObjectBufferEqual(object_buffers[0], {42},
+                            std::vector<uint8_t>(i + 1, static_cast<uint8_t>(i)));
+  }
+
+  // A get waiting for an object is answered once another client seals it
+  ObjectID object_id = random_object_id();
+  std::vector<ObjectBuffer> object_buffers;
+  std::thread getter([&] {
+    ARROW_CHECK_OK(client2_.Get({object_id}, -1, &object_buffers));
+  });
+  std::shared_ptr<Buffer> data;
+  ARROW_CHECK_OK(client_.Create(object_id, 1, NULLPTR, 0, &data));
+  data->mutable_data()[0] = 7;
+  ARROW_CHECK_OK(client_.Seal(object_id));
+  getter.join();
+  ASSERT_EQ(1U, object_buffers.size());
+  AssertObjectBufferEqual(object_buffers[0], {}, {7});
+}
+
+TEST_F(TestPlasmaStoreReaderThreads, SubscribeTest) {
+  ObjectID existing_id = random_object_id();
+  CreateObject(client_, existing_id, {42}, {1, 2, 3});
+
+  PlasmaClient local_client;
+  ARROW_CHECK_OK(local_client.Connect(store_socket_name_, ""));
+  // The notification socket is received by the reader thread along with the
+  // subscribe request, and the request right after it must still be read
+  int fd = -1;
+  ARROW_CHECK_OK(local_client.Subscribe(&fd));
+  ASSERT_GT(fd, 0);
+  bool has_object;
+  ARROW_CHECK_OK(local_client.Contains(existing_id, &has_object));
+  ASSERT_TRUE(has_object);
+
+  std::vector<ObjectID> object_ids;
+  for (int64_t i = 0; i < 10; ++i) {
+    object_ids.push_back(random_object_id());
+    CreateObject(i % 2 == 0 ? client_ : client2_, object_ids.back(), {42},
+                 std::vector<uint8_t>(i + 1, 0));
+  }
+
+  ObjectID object_id;
+  int64_t data_size;
+  int64_t metadata_size;
+  ARROW_CHECK_OK(
+      local_client.GetNotification(fd, &object_id, &data_size, &metadata_size));
+  ASSERT_EQ(existing_id, object_id);
+  ASSERT_EQ(3, data_size);
+  for (int64_t i = 0; i < 10; ++i) {
+    ARROW_CHECK_OK(
+        local_client.GetNotification(fd, &object_id, &data_size, &metadata_size));
+    ASSERT_EQ(object_ids[i], object_id);
+    ASSERT_EQ(i + 1, data_size);
+    ASSERT_EQ(1, metadata_size);
+  }
+  ARROW_CHECK_OK(local_client.Disconnect());
+}
+
+TEST_F(TestPlasmaStoreReaderThreads, DisconnectWithQueuedRequestsTest) {
+  ObjectID sealed_id = random_object_id();
+  ObjectID unsealed_id = random_object_id();
+
+  // Send requests without waiting for the replies, then a truncated request,
+  // and hang up while the store may still be working through them
+  int fd;
+  ARROW_CHECK_OK(ConnectIpcSocketRetry(store_socket_name_, -1, -1, &fd));
+  ARROW_CHECK_OK(SendCreateRequest(fd, sealed_id, 1, 0, 0, 0));
+  ARROW_CHECK_OK(SendCreateRequest(fd, unsealed_id, 1, 0, 0, 0));
+  unsigned char digest[kDigestSize] = {};
+  ARROW_CHECK_OK(SendSealRequest(fd, sealed_id, digest));
+  int64_t version = kPlasmaProtocolVersion;
+  ARROW_CHECK_OK(WriteBytes(fd, reinterpret_cast<uint8_t*>(&version), sizeof(version)));
+  close(fd);
+
+  // The requests are processed in order, so once the object is sealed only
+  // the disconnection remains, which aborts the unsealed object
+  bool has_object = false;
+  for (int i = 0; i < 100 && !has_object; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ARROW_CHECK_OK(client_.Contains(sealed_id, &has_object));
+  }
+  ASSERT_TRUE(has_object);
+  std::shared_ptr<Buffer> data;
+  Status s;
+  for (int i = 0; i < 100; ++i) {
+    s = client_.Create(unsealed_id, 1, NULLPTR, 0, &data);
+    if (!IsPlasmaObjectExists(s)) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  ARROW_CHECK_OK(s);
+  ARROW_CHECK_OK(client_.Seal(unsealed_id));
+
+  // The other clients are unaffected
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({sealed_id, unsealed_id}, -1, &object_buffers));
+  ASSERT_EQ(2U, object_buffers.size());
+}
+
+TEST(PlasmaStoreOptions, InvalidReaderThreads) {
+  std::string plasma_directory =
+      test_executable.substr(0, test_executable.find_last_of("/"));
+  for (std::string threads : {"-1", "two", "2x"}) {
+    // The store exits before binding the socket
+    std::string plasma_command = plasma_directory +
+                                 "/plasma-store-server -m 10000000 -s /tmp/unused -t " +
+                                 threads + " 1> /dev/null 2> /dev/null";
+    ASSERT_NE(0, system(plasma_command.c_str())) << "-t " << threads;
+  }
+}
+
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaBuffer;
 using arrow::cuda::CudaBufferReader;
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/common.h"
+#include "plasma/eviction_policy.h"
+#include "plasma/test_util.h"
+
+namespace plasma {
+
+// Add an object, and access it 'num_accesses' more times as the store does,
+// i.e. by removing it while in use and adding it back.
+void AddObject(EvictionCache* cache, const ObjectID& object_id, int64_t size,
+               int num_accesses = 0) {
+  cache->Add(object_id, size);
+  for (int i = 0; i < num_accesses; ++i) {
+    cache->Remove(object_id);
+    cache->Add(object_id, size);
+  }
+}
+
+TEST(EvictionPolicyTest, ParseEvictionCacheKind) {
+  EvictionCacheKind kind;
+  ASSERT_TRUE(ParseEvictionCacheKind("lru", &kind));
+  ASSERT_EQ(kind, EvictionCacheKind::LRU);
+  ASSERT_TRUE(ParseEvictionCacheKind("tinylfu", &kind));
+  ASSERT_EQ(kind, EvictionCacheKind::TINY_LFU);
+  ASSERT_TRUE(ParseEvictionCacheKind("gds", &kind));
+  ASSERT_EQ(kind, EvictionCacheKind::GREEDY_DUAL_SIZE);
+  ASSERT_FALSE(ParseEvictionCacheKind("fifo", &kind));
+}
+
+TEST(EvictionPolicyTest, LRUCache) {
+  auto cache = EvictionCache::Make(EvictionCacheKind::LRU, "test", 1000);
+  ObjectID reused = random_object_id();
+  ObjectID transient = random_object_id();
+  AddObject(cache.get(), reused, 100, 3);
+  AddObject(cache.get(), transient, 10);
+  ASSERT_EQ(cache->RemainingCapacity(), 890);
+
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache->ChooseObjectsToEvict(50, &objects_to_evict), 100);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({reused}));
+}
+
+TEST(EvictionPolicyTest, TinyLFUCache) {
+  auto cache = EvictionCache::Make(EvictionCacheKind::TINY_LFU, "test", 1000);
+  ObjectID reused = random_object_id();
+  AddObject(cache.get(), reused, 100, 3);
+  // Objects used once, which pass through the window of 10 bytes
+  std::vector<ObjectID> transients;
+  for (int i = 0; i < 5; ++i) {
+    transients.push_back(random_object_id());
+    AddObject(cache.get(), transients.back(), 10);
+  }
+  ASSERT_EQ(cache->RemainingCapacity(), 850);
+
+  // The transient objects go first, from the window and then from probation,
+  // although the reused object was accessed last before them
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache->ChooseObjectsToEvict(50, &objects_to_evict), 50);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({transients[4], transients[0],
+                                                     transients[1], transients[2],
+                                                     transients[3]}));
+  for (auto& object_id : objects_to_evict) {
+    cache->Remove(object_id);
+  }
+
+  objects_to_evict.clear();
+  ASSERT_EQ(cache->ChooseObjectsToEvict(60, &objects_to_evict), 100);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({reused}));
+}
+
+TEST(EvictionPolicyTest, GreedyDualSizeCache) {
+  auto cache = EvictionCache::Make(EvictionCacheKind::GREEDY_DUAL_SIZE, "test", 1000);
+  ObjectID large = random_object_id();
+  ObjectID small = random_object_id();
+  ObjectID reused = random_object_id();
+  AddObject(cache.get(), large, 500);
+  AddObject(cache.get(), small, 10);
+  AddObject(cache.get(), reused, 100, 4);
+
+  // Priorities are accesses per byte: 1 / 500, 1 / 10 and 5 / 100
+  std::vector<ObjectID> objects_to_evict;
+  ASSERT_EQ(cache->ChooseObjectsToEvict(600, &objects_to_evict), 600);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({large, reused}));
+  for (auto& object_id : objects_to_evict) {
+    cache->Remove(object_id);
+  }
+
+  // Objects added later are favoured over the ones not accessed for a while
+  ObjectID later = random_object_id();
+  AddObject(cache.get(), later, 10);
+  objects_to_evict.clear();
+  ASSERT_EQ(cache->ChooseObjectsToEvict(1, &objects_to_evict), 10);
+  ASSERT_EQ(objects_to_evict, std::vector<ObjectID>({small}));
+}
+
+}  // namespace plasma
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
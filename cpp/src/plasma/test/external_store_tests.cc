@@ -134,6 +134,50 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+TEST_F(TestPlasmaStoreWithExternal, EvictionWithMetadataTest) {
+  std::vector<ObjectID> object_ids;
+  std::string data(100 * 1024, 'x');
+  std::string metadata(16, 'm');
+  for (int i = 0; i < 20; i++) {
+    object_ids.push_back(random_object_id());
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_ids.back(), data, metadata));
+  }
+
+  // The metadata is written to and restored from the external store as well
+  for (int i = 0; i < 20; i++) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_ids[i]}, -1, &object_buffers));
+    ASSERT_TRUE(object_buffers[0].data);
+    AssertObjectBufferEqual(object_buffers[0], metadata, data);
+  }
+}
+
+TEST_F(TestPlasmaStoreWithExternal, PrefetchTest) {
+  std::vector<ObjectID> object_ids;
+  std::string data(100 * 1024, 'x');
+  std::string metadata;
+  for (int i = 0; i < 20; i++) {
+    object_ids.push_back(random_object_id());
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_ids.back(), data, metadata));
+  }
+
+  // The first objects have been evicted, and are brought back ahead of use
+  std::vector<ObjectID> prefetched(object_ids.begin(), object_ids.begin() + 3);
+  ARROW_CHECK_OK(client_.Prefetch(prefetched));
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client_.Get(prefetched, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 3);
+  for (const auto& object_buffer : object_buffers) {
+    ASSERT_TRUE(object_buffer.data);
+    AssertObjectBufferEqual(object_buffer, metadata, data);
+  }
+
+  // Prefetching objects which are present or unknown does nothing
+  ARROW_CHECK_OK(client_.Prefetch({object_ids.back(), random_object_id()}));
+  ARROW_CHECK_OK(client_.Get({object_ids.back()}, 0, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], metadata, data);
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "plasma/memory_pool.h"
+
+namespace plasma {
+
+class TestPlasmaMemoryPool : public ::testing::Test {
+ public:
+  void MakePool(int64_t size) {
+    ASSERT_OK(arrow::AllocateBuffer(size, &data_));
+    pool_.reset(new PlasmaMemoryPool(data_));
+  }
+
+  int64_t OffsetOf(const uint8_t* pointer) { return pointer - data_->data(); }
+
+ protected:
+  std::shared_ptr<Buffer> data_;
+  std::unique_ptr<PlasmaMemoryPool> pool_;
+};
+
+TEST_F(TestPlasmaMemoryPool, Allocate) {
+  MakePool(256);
+  uint8_t* a;
+  uint8_t* b;
+  ASSERT_OK(pool_->Allocate(10, &a));
+  ASSERT_OK(pool_->Allocate(100, &b));
+  ASSERT_EQ(OffsetOf(a), 0);
+  ASSERT_EQ(OffsetOf(b), 64);
+  ASSERT_EQ(pool_->used_size(), 164);
+  ASSERT_EQ(pool_->bytes_allocated(), 110);
+
+  uint8_t* c;
+  ASSERT_RAISES(OutOfMemory, pool_->Allocate(100, &c));
+  ASSERT_OK(pool_->Allocate(64, &c));
+  ASSERT_EQ(OffsetOf(c), 192);
+
+  // Only the last allocation is reclaimed when freed
+  pool_->Free(b, 100);
+  ASSERT_EQ(pool_->used_size(), 256);
+  pool_->Free(c, 64);
+  ASSERT_EQ(pool_->used_size(), 192);
+  ASSERT_EQ(pool_->bytes_allocated(), 10);
+  ASSERT_EQ(pool_->max_memory(), 174);
+}
+
+TEST_F(TestPlasmaMemoryPool, Reallocate) {
+  MakePool(256);
+  uint8_t* a;
+  uint8_t* b;
+  ASSERT_OK(pool_->Allocate(16, &a));
+  a[0] = 42;
+  // The last allocation grows in place
+  ASSERT_OK(pool_->Reallocate(16, 32, &a));
+  ASSERT_EQ(OffsetOf(a), 0);
+  ASSERT_EQ(pool_->used_size(), 32);
+
+  ASSERT_OK(pool_->Allocate(16, &b));
+  ASSERT_OK(pool_->Reallocate(32, 100, &a));
+  ASSERT_EQ(OffsetOf(a), 128);
+  ASSERT_EQ(a[0], 42);
+  ASSERT_EQ(pool_->bytes_allocated(), 116);
+  ASSERT_RAISES(OutOfMemory, pool_->Reallocate(100, 200, &a));
+  ASSERT_OK(pool_->Reallocate(100, 128, &a));
+  ASSERT_EQ(pool_->used_size(), 256);
+}
+
+TEST_F(TestPlasmaMemoryPool, RecordBatchRoundTrip) {
+  MakePool(4096);
+  arrow::Int64Builder int_builder(pool_.get());
+  for (int64_t i = 0; i < 100; ++i) {
+    ASSERT_OK(i % 7 == 0 ? int_builder.AppendNull() : int_builder.Append(i));
+  }
+  std::shared_ptr<arrow::Array> ints;
+  ASSERT_OK(int_builder.Finish(&ints));
+
+  arrow::StringBuilder string_builder(pool_.get());
+  ASSERT_OK(string_builder.AppendValues({"foo", "", "barbaz", "quux"}));
+  std::shared_ptr<arrow::Array> strings;
+  ASSERT_OK(string_builder.Finish(&strings));
+
+  // A column allocated elsewhere, and a sliced one, are copied to the object
+  auto doubles = arrow::ArrayFromJSON(arrow::float64(), "[1.5, null, 3]");
+  auto schema = arrow::schema({arrow::field("ints", arrow::int64()),
+                               arrow::field("strings", arrow::utf8()),
+                               arrow::field("doubles", arrow::float64())});
+  auto batch = arrow::RecordBatch::Make(
+      schema, 3, {ints->Slice(10, 3), strings->Slice(1, 3), doubles});
+  ASSERT_OK(WriteRecordBatchInPlace(*batch, pool_.get()));
+
+  std::shared_ptr<arrow::RecordBatch> result;
+  ASSERT_OK(ReadRecordBatchInPlace(data_, &result));
+  ASSERT_OK(result->Validate());
+  AssertBatchesEqual(*batch, *result);
+}
+
+TEST_F(TestPlasmaMemoryPool, BuffersAreNotCopied) {
+  MakePool(4096);
+  arrow::Int64Builder builder(pool_.get());
+  for (int64_t i = 0; i < 100; ++i) {
+    ASSERT_OK(builder.Append(i));
+  }
+  std::shared_ptr<arrow::Array> values;
+  ASSERT_OK(builder.Finish(&values));
+  auto batch = arrow::RecordBatch::Make(
+      arrow::schema({arrow::field("values", arrow::int64())}), 100, {values});
+  ASSERT_OK(WriteRecordBatchInPlace(*batch, pool_.get()));
+
+  std::shared_ptr<arrow::RecordBatch> result;
+  ASSERT_OK(ReadRecordBatchInPlace(data_, &result));
+  AssertBatchesEqual(*batch, *result);
+  ASSERT_EQ(result->column_data(0)->buffers[1]->data(),
+            values->data()->buffers[1]->data());
+}
+
+TEST_F(TestPlasmaMemoryPool, ObjectTooSmall) {
+  MakePool(1024);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(arrow::AllocateBuffer(pool_.get(), 960, &buffer));
+  auto values = std::make_shared<arrow::Int64Array>(120, buffer);
+  auto batch = arrow::RecordBatch::Make(
+      arrow::schema({arrow::field("values", arrow::int64())}), 120, {values});
+  ASSERT_RAISES(OutOfMemory, WriteRecordBatchInPlace(*batch, pool_.get()));
+
+  std::shared_ptr<arrow::RecordBatch> result;
+  ASSERT_RAISES(Invalid, ReadRecordBatchInPlace(data_, &result));
+}
+
+}  // namespace plasma
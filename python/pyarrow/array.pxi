@@ -411,7 +411,8 @@ cdef class _PandasConvertible:
     def to_pandas(self, categories=None, bint strings_to_categorical=False,
                   bint zero_copy_only=False, bint integer_object_nulls=False,
                   bint date_as_object=True, bint use_threads=True,
-                  bint deduplicate_objects=True, bint ignore_metadata=False):
+                  bint deduplicate_objects=True, bint ignore_metadata=False,
+                  bint extension_arrays=False):
         """
         Convert to a pandas-compatible NumPy array or DataFrame, as appropriate
 
@@ -437,6 +438,12 @@ cdef class _PandasConvertible:
         ignore_metadata : boolean, default False
             If True, do not use the 'pandas' metadata to reconstruct the
             DataFrame index, if present
+        extension_arrays : boolean, default False
+            Return the columns which would otherwise be copied (strings,
+            binary, dictionaries, nested types and integers or booleans with
+            nulls) as pandas ExtensionArrays wrapping the Arrow data, see
+            pyarrow.pandas_ext.ArrowExtensionArray. Only applies to
+            table-like data structures, and requires pandas >= 0.24
 
         Returns
         -------
@@ -455,7 +462,8 @@ cdef class _PandasConvertible:
             deduplicate_objects=deduplicate_objects)
 
         return self._to_pandas(options, categories=categories,
-                               ignore_metadata=ignore_metadata)
+                               ignore_metadata=ignore_metadata,
+                               extension_arrays=extension_arrays)
 
 
 cdef class Array(_PandasConvertible):
@@ -631,7 +631,7 @@ def make_datetimetz(tz):
 
 
 def table_to_blockmanager(options, table, categories=None,
-                          ignore_metadata=False):
+                          ignore_metadata=False, extension_arrays=False):
     from pandas.core.internals import BlockManager
 
     all_columns = []
@@ -650,7 +650,7 @@ def table_to_blockmanager(options, table, categories=None,
 
     _check_data_column_metadata_consistency(all_columns)
     blocks = _table_to_blocks(options, table, pa.default_memory_pool(),
-                              categories)
+                              categories, extension_arrays)
     columns = _deserialize_column_index(table, all_columns, column_indexes)
 
     axes = [columns, index]
@@ -917,8 +917,12 @@ def _reconstruct_columns_from_metadata(columns, column_indexes):
     return pd.MultiIndex(new_levels, labels, names=columns.names)
 
 
-def _table_to_blocks(options, block_table, memory_pool, categories):
+def _table_to_blocks(options, block_table, memory_pool, categories,
+                     extension_arrays=False):
     # Part of table_to_blockmanager
+    if extension_arrays:
+        return _table_to_extension_blocks(options, block_table, memory_pool,
+                                          categories)
 
     # Convert an arrow table to Block from the internal pandas API
     result = pa.lib.table_to_blocks(options, block_table, memory_pool,
@@ -928,6 +932,39 @@ def _table_to_blocks(options, block_table, memory_pool, categories):
     return [_reconstruct_block(item) for item in result]
 
 
+def _table_to_extension_blocks(options, block_table, memory_pool, categories):
+    # Part of table_to_blockmanager: the columns to_pandas would have to copy
+    # are wrapped in ExtensionBlocks sharing the Arrow memory, the others are
+    # converted to NumPy-backed blocks as usual
+    import pandas.core.internals as _int
+    if _pandas_api.loose_version < '0.24.0':
+        raise NotImplementedError("extension_arrays=True requires "
+                                  "pandas >= 0.24")
+    from pyarrow.pandas_ext import (ArrowExtensionArray,
+                                    extension_array_columns)
+
+    wrapped = extension_array_columns(block_table, options, categories)
+    blocks = [_int.make_block(ArrowExtensionArray(block_table.column(i)),
+                              placement=[i])
+              for i in wrapped]
+
+    wrapped = set(wrapped)
+    converted = [i for i in range(block_table.num_columns)
+                 if i not in wrapped]
+    if converted:
+        converted_table = pa.Table.from_arrays(
+            [block_table.column(i) for i in converted],
+            schema=pa.schema([block_table.schema[i] for i in converted]))
+        result = pa.lib.table_to_blocks(options, converted_table,
+                                        memory_pool, categories)
+        converted = np.asarray(converted, dtype=np.int64)
+        for item in result:
+            # Placements index into converted_table, not block_table
+            item['placement'] = converted[item['placement']]
+            blocks.append(_reconstruct_block(item))
+    return blocks
+
+
 def _flatten_single_level_multiindex(index):
     pd = _pandas_api.pd
     if isinstance(index, pd.MultiIndex) and index.nlevels == 1:
@@ -0,0 +1,223 @@
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+"""
+pandas ExtensionArrays backed by Arrow memory, as returned by
+``to_pandas(extension_arrays=True)``.
+"""
+
+from __future__ import absolute_import
+
+import numbers
+
+import numpy as np
+import pandas as pd
+
+import pyarrow as pa
+
+
+class ArrowDtype(pd.api.extensions.ExtensionDtype):
+    """
+    pandas dtype of an ArrowExtensionArray, wrapping an Arrow DataType.
+    """
+
+    kind = 'O'
+    na_value = None
+    _metadata = ('arrow_type',)
+
+    def __init__(self, arrow_type):
+        self.arrow_type = arrow_type
+
+    @property
+    def type(self):
+        return object
+
+    @property
+    def name(self):
+        return 'arrow[{}]'.format(self.arrow_type)
+
+    @classmethod
+    def construct_array_type(cls):
+        return ArrowExtensionArray
+
+    @classmethod
+    def construct_from_string(cls, string):
+        raise TypeError("Cannot construct an 'ArrowDtype' from '{}'"
+                        .format(string))
+
+    def __eq__(self, other):
+        return (isinstance(other, ArrowDtype) and
+                self.arrow_type.equals(other.arrow_type))
+
+    def __hash__(self):
+        return hash(self.name)
+
+
+class ArrowExtensionArray(pd.api.extensions.ExtensionArray):
+    """
+    pandas ExtensionArray wrapping a pyarrow.ChunkedArray, without copying
+    it to NumPy. Values are converted to Python objects when accessed.
+    """
+
+    def __init__(self, values):
+        if isinstance(values, pa.Array):
+            values = pa.chunked_array([values], type=values.type)
+        elif not isinstance(values, pa.ChunkedArray):
+            raise TypeError("ArrowExtensionArray wraps a pyarrow Array or "
+                            "ChunkedArray, got {}".format(type(values)))
+        self._data = values
+
+    @classmethod
+    def _from_sequence(cls, scalars, dtype=None, copy=False):
+        if isinstance(scalars, ArrowExtensionArray):
+            return scalars
+        arrow_type = None
+        if isinstance(dtype, ArrowDtype):
+            arrow_type = dtype.arrow_type
+        return cls(pa.array(list(scalars), type=arrow_type, from_pandas=True))
+
+    @classmethod
+    def _from_factorized(cls, values, original):
+        return cls._from_sequence(values, dtype=original.dtype)
+
+    @classmethod
+    def _concat_same_type(cls, to_concat):
+        chunks = [chunk for array in to_concat
+                  for chunk in array._data.iterchunks()]
+        return cls(pa.chunked_array(chunks, type=to_concat[0]._data.type))
+
+    @property
+    def data(self):
+        """
+        The wrapped pyarrow.ChunkedArray
+        """
+        return self._data
+
+    @property
+    def dtype(self):
+        return ArrowDtype(self._data.type)
+
+    @property
+    def nbytes(self):
+        return sum(buf.size for chunk in self._data.iterchunks()
+                   for buf in chunk.buffers() if buf is not None)
+
+    def __len__(self):
+        return len(self._data)
+
+    def __getitem__(self, item):
+        if isinstance(item, numbers.Integral):
+            return self._data[int(item)].as_py()
+        if isinstance(item, slice) and item.step in (None, 1):
+            return type(self)(self._data[item])
+        if isinstance(item, slice):
+            item = np.arange(len(self))[item]
+        item = np.asarray(item)
+        if item.dtype == np.bool_:
+            item = np.flatnonzero(item)
+        return self.take(item)
+
+    def __arrow_array__(self, type=None):
+        values = self._combined()
+        if type is not None and not type.equals(values.type):
+            values = values.cast(type)
+        return values
+
+    def __array__(self, dtype=None):
+        values = self._data.to_pandas(integer_object_nulls=True)
+        return np.asarray(values, dtype=dtype)
+
+    def isna(self):
+        result = np.zeros(len(self), dtype=np.bool_)
+        position = 0
+        for chunk in self._data.iterchunks():
+            length = len(chunk)
+            bitmap = chunk.buffers()[0]
+            if chunk.null_count == length:
+                result[position:position + length] = True
+            elif chunk.null_count > 0:
+                # Arrow bitmaps are least significant bit first
+                bits = np.unpackbits(np.frombuffer(bitmap, dtype=np.uint8))
+                bits = bits.reshape(-1, 8)[:, ::-1].ravel()
+                valid = bits[chunk.offset:chunk.offset + length]
+                result[position:position + length] = valid == 0
+            position += length
+        return result
+
+    def take(self, indices, allow_fill=False, fill_value=None):
+        indices = np.asarray(indices, dtype=np.int64)
+        length = len(self)
+        mask = None
+        if allow_fill:
+            if fill_value is not None:
+                raise NotImplementedError("Only null fill values are "
+                                          "supported")
+            if (indices < -1).any():
+                raise ValueError("Invalid value in 'indices', must be all "
+                                 ">= -1 when allow_fill is True")
+            mask = indices == -1
+            indices = np.where(mask, 0, indices)
+        else:
+            indices = np.where(indices < 0, indices + length, indices)
+        taken_indices = indices if mask is None else indices[~mask]
+        if ((taken_indices < 0) | (taken_indices >= length)).any():
+            raise IndexError("Index out of bounds for an array of length {}"
+                             .format(length))
+
+        taken = self._combined().take(pa.array(indices, mask=mask))
+        return type(self)(taken)
+
+    def copy(self, deep=False):
+        # Arrow memory is immutable, so it can be shared between copies
+        return type(self)(self._data)
+
+    def _combined(self):
+        if self._data.num_chunks == 1:
+            return self._data.chunk(0)
+        if self._data.num_chunks == 0:
+            return pa.array([], type=self._data.type)
+        return pa.concat_arrays(self._data.chunks)
+
+
+def _is_copied_by_to_pandas(column):
+    # The types to_pandas cannot convert without copying
+    t = column.type
+    if pa.types.is_integer(t) or pa.types.is_boolean(t):
+        return column.null_count > 0
+    return (pa.types.is_binary(t) or pa.types.is_string(t) or
+            pa.types.is_large_binary(t) or pa.types.is_large_string(t) or
+            pa.types.is_fixed_size_binary(t) or
+            pa.types.is_dictionary(t) or pa.types.is_nested(t))
+
+
+def extension_array_columns(table, options, categories):
+    """
+    Return the indices of the columns of table to convert to
+    ArrowExtensionArrays.
+    """
+    categories = set(categories or ())
+    indices = []
+    for i, field in enumerate(table.schema):
+        if field.name in categories:
+            continue
+        if options['strings_to_categorical'] and (
+                pa.types.is_string(field.type) or
+                pa.types.is_binary(field.type)):
+            continue
+        if _is_copied_by_to_pandas(table.column(i)):
+            indices.append(i)
+    return indices
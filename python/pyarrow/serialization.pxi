@@ -332,6 +332,17 @@ cdef class SerializedPyObject:
 
         return PyObject_to_object(result)
 
+    def __reduce__(self):
+        # The components are pyarrow.Buffer objects, so with pickle protocol
+        # 5 the tensor and ndarray bodies can be passed out-of-band to the
+        # buffer_callback as PickleBuffers without being copied
+        return _serialized_from_components, (self.to_components(),)
+
+
+def _serialized_from_components(components):
+    # Part of SerializedPyObject.__reduce__
+    return SerializedPyObject.from_components(components)
+
 
 def serialize(object value, SerializationContext context=None):
     """EXPERIMENTAL: Serialize a Python sequence
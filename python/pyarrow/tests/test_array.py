@@ -1253,6 +1253,28 @@ def test_array_from_masked():
         pa.array(ma, mask=np.array([True, False, False, False]))
 
 
+def test_array_from_large_numpy():
+    # Long enough for the conversion to be split across threads
+    n = 3 * (1 << 20) + 13
+    values = np.arange(n, dtype='float64')
+    mask = values % 7 == 0
+    expected = np.where(mask, np.nan, values)
+
+    result = pa.array(values, mask=mask)
+    assert result.null_count == mask.sum()
+    np.testing.assert_array_equal(result.to_pandas(), expected)
+
+    result = pa.array(expected, from_pandas=True)
+    assert result.null_count == mask.sum()
+
+    # strided
+    result = pa.array(values[::3], mask=mask[::3])
+    np.testing.assert_array_equal(result.to_pandas(), expected[::3])
+
+    result = pa.array(mask)
+    np.testing.assert_array_equal(result.to_pandas(), mask)
+
+
 def test_array_from_invalid_dim_raises():
     msg = "only handle 1-dimensional arrays"
     arr2d = np.array([[1, 2, 3], [4, 5, 6]])
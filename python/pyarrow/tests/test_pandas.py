@@ -2192,6 +2192,20 @@ class TestConvertMisc(object):
             pool.close()
             pool.join()
 
+    def test_threaded_conversion_long_columns(self):
+        # Long columns are converted in row ranges on several threads
+        n = 3 * (1 << 20) + 13
+        values = np.arange(n, dtype=np.int64)
+        chunks = [pa.array(values[:1000]), pa.array(values[1000:],
+                                                    mask=values[1000:] % 5 == 0)]
+        table = pa.Table.from_arrays([pa.chunked_array(chunks),
+                                      pa.array(values % 3 == 0),
+                                      pa.array(values.astype('M8[s]'))],
+                                     names=['ints', 'bools', 'dates'])
+        expected = table.to_pandas(use_threads=False)
+        result = table.to_pandas(use_threads=True)
+        tm.assert_frame_equal(result, expected)
+
     def test_category(self):
         repeats = 5
         v1 = ['foo', None, 'bar', 'qux', np.nan]
@@ -2577,6 +2591,42 @@ def test_to_pandas_deduplicate_date_time():
                         len(casted_arr))
 
 
+@pytest.mark.skipif(LooseVersion(pd.__version__) < '0.24.0',
+                    reason='ExtensionArrays require pandas >= 0.24')
+def test_to_pandas_extension_arrays():
+    from pyarrow.pandas_ext import ArrowDtype, ArrowExtensionArray
+
+    strings = pa.chunked_array([['a', None], ['ccc']])
+    ints = pa.array([1, None, 3])
+    table = pa.Table.from_arrays(
+        [strings, ints, pa.array([1.5, 2.5, None]),
+         pa.array(['x', 'y', 'x']).dictionary_encode()],
+        names=['strings', 'ints', 'floats', 'dict'])
+
+    result = table.to_pandas(extension_arrays=True)
+    assert list(result.columns) == ['strings', 'ints', 'floats', 'dict']
+    for name in ['strings', 'ints', 'dict']:
+        assert isinstance(result[name].dtype, ArrowDtype)
+        assert result[name].dtype.arrow_type == table.column(name).type
+    assert result['floats'].dtype == np.float64
+
+    # The Arrow data is wrapped, not copied
+    values = result['strings'].values
+    assert isinstance(values, ArrowExtensionArray)
+    assert values.data.equals(strings)
+    assert values.isna().tolist() == [False, True, False]
+    assert values.take([2, -1], allow_fill=True).data.to_pylist() == [
+        'ccc', None]
+
+    expected = table.to_pandas(integer_object_nulls=True)
+    for name in ['strings', 'ints']:
+        assert result[name].tolist() == expected[name].tolist()
+    tm.assert_series_equal(result['floats'], expected['floats'])
+    assert result['dict'].tolist() == ['x', 'y', 'x']
+
+    assert pa.array(result['ints'].values).equals(ints)
+
+
 # ---------------------------------------------------------------------
 
 def test_table_from_pandas_checks_field_nullability():
@@ -762,6 +762,31 @@ def test_deserialize_components_in_different_process():
     subprocess.check_call(["python", "-c", code], env=subprocess_env)
 
 
+def test_serialized_pickle_out_of_band_buffers():
+    from pyarrow.compat import builtin_pickle
+    if builtin_pickle.HIGHEST_PROTOCOL < 5:
+        pytest.skip("pickle protocol 5 is not available")
+
+    data = np.arange(100000, dtype=np.float64)
+    ser = pa.serialize({'data': data, 'label': 'x'})
+
+    buffers = []
+    dumped = builtin_pickle.dumps(ser, protocol=5,
+                                  buffer_callback=buffers.append)
+    # The ndarray body is passed out-of-band, without a copy
+    assert len(dumped) < data.nbytes
+    addresses = [pa.py_buffer(buf.raw()).address for buf in buffers]
+    assert data.ctypes.data in addresses
+
+    result = builtin_pickle.loads(dumped, buffers=buffers).deserialize()
+    assert result['label'] == 'x'
+    np.testing.assert_array_equal(result['data'], data)
+
+    # In-band pickling still works
+    result = pickle.loads(pickle.dumps(ser, protocol=2)).deserialize()
+    np.testing.assert_array_equal(result['data'], data)
+
+
 def test_serialize_read_concatenated_records():
     # ARROW-1996 -- see stream alignment work in ARROW-2840, ARROW-3212
     f = pa.BufferOutputStream()